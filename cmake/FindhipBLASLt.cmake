@@ -0,0 +1,79 @@
+#===============================================================================
+# Copyright 2025 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#===============================================================================
+
+find_package(HIP REQUIRED)
+find_package(Threads REQUIRED)
+
+# Prioritize HIPBLASLTROOT
+list(APPEND hipblaslt_root_hints
+            $ENV{ROCM_PATH}
+            ${HIPBLASLTROOT}
+            $ENV{HIPBLASLTROOT}
+            "/opt/rocm"
+            "/opt/rocm/hipblaslt"
+            "/opt/rocm/lib")
+
+find_path(
+    hipBLASLt_INCLUDE_DIR "hipblaslt/hipblaslt.h"
+    HINTS ${hipblaslt_root_hints}
+    PATH_SUFFIXES include
+)
+
+find_library(
+    hipBLASLt_LIBRARY hipblaslt
+    HINTS ${hipblaslt_root_hints}
+    PATH_SUFFIXES lib lib/hipblaslt
+)
+
+if(EXISTS "${hipBLASLt_INCLUDE_DIR}/hipblaslt/hipblaslt-version.h")
+    file(READ "${hipBLASLt_INCLUDE_DIR}/hipblaslt/hipblaslt-version.h" hipBLASLt_VERSION_CONTENT)
+
+    string(REGEX MATCH "define hipblasltVersionMajor +([0-9]+)" _ "${hipBLASLt_VERSION_CONTENT}")
+    set(hipBLASLt_MAJOR_VERSION ${CMAKE_MATCH_1} CACHE INTERNAL "")
+
+    string(REGEX MATCH "define hipblasltVersionMinor +([0-9]+)" _ "${hipBLASLt_VERSION_CONTENT}")
+    set(hipBLASLt_MINOR_VERSION ${CMAKE_MATCH_1} CACHE INTERNAL "")
+
+    string(REGEX MATCH "define hipblasltVersionPatch +([0-9]+)" _ "${hipBLASLt_VERSION_CONTENT}")
+    set(hipBLASLt_PATCH_VERSION ${CMAKE_MATCH_1} CACHE INTERNAL "")
+
+    set(hipBLASLt_VERSION
+        "${hipBLASLt_MAJOR_VERSION}.${hipBLASLt_MINOR_VERSION}.${hipBLASLt_PATCH_VERSION}"
+    )
+
+    unset(hipBLASLt_VERSION_CONTENT)
+else()
+    message(WARNING "hipBLASLt version couldn't be identified.")
+endif()
+
+include(FindPackageHandleStandardArgs)
+
+find_package_handle_standard_args(hipBLASLt
+    FOUND_VAR hipBLASLt_FOUND
+    REQUIRED_VARS
+        hipBLASLt_LIBRARY
+        hipBLASLt_INCLUDE_DIR
+    VERSION_VAR hipBLASLt_VERSION
+)
+
+if(hipBLASLt_FOUND AND NOT TARGET hipBLASLt::hipBLASLt)
+    add_library(hipBLASLt::hipBLASLt SHARED IMPORTED)
+    set_target_properties(hipBLASLt::hipBLASLt PROPERTIES
+        IMPORTED_LOCATION "${hipBLASLt_LIBRARY}"
+        INTERFACE_INCLUDE_DIRECTORIES "${hipBLASLt_INCLUDE_DIR}"
+        INTERFACE_LINK_LIBRARIES "HIP::HIP;Threads::Threads"
+    )
+endif()
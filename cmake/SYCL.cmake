@@ -100,11 +100,24 @@ elseif(DNNL_SYCL_HIP)
     find_package(HIP REQUIRED)
     find_package(rocBLAS REQUIRED)
     find_package(MIOpen REQUIRED)
+    if(DNNL_AMD_USE_HIPBLASLT)
+        find_package(hipBLASLt QUIET)
+    endif()
+
+    set(HIP_LIBS HIP::HIP rocBLAS::rocBLAS MIOpen::MIOpen)
+    if(hipBLASLt_FOUND)
+        set(DNNL_AMD_ENABLE_HIPBLASLT TRUE)
+        list(APPEND HIP_LIBS hipBLASLt::hipBLASLt)
+        add_definitions_with_host_compiler("-DDNNL_AMD_ENABLE_HIPBLASLT")
+        message(STATUS "hipBLASLt matmul is enabled")
+    elseif(DNNL_AMD_USE_HIPBLASLT)
+        message(STATUS "hipBLASLt not found, using rocBLAS/MIOpen matmul")
+    endif()
 
-    adjust_headers_priority("HIP::HIP;rocBLAS::rocBLAS;MIOpen::MIOpen")
+    adjust_headers_priority("${HIP_LIBS}")
     add_definitions_with_host_compiler("-D__HIP_PLATFORM_AMD__=1")
 
-    list(APPEND EXTRA_SHARED_LIBS HIP::HIP rocBLAS::rocBLAS MIOpen::MIOpen)
+    list(APPEND EXTRA_SHARED_LIBS ${HIP_LIBS})
     message(STATUS "DPC++ support is enabled (HIP)")
 elseif(DNNL_SYCL_GENERIC)
     CHECK_CXX_COMPILER_FLAG("-fsycl -fsycl-targets=nvptx64-nvidia-cuda" NVIDIA_TARGET_SUPPORTED)
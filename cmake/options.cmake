@@ -122,9 +122,9 @@ set(DNNL_ENABLE_PRIMITIVE "ALL" CACHE STRING
     - ALL (the default). Includes all primitives to be enabled.
     - <PRIMITIVE_NAME>. Includes only the selected primitive to be enabled.
       Possible values are: BATCH_NORMALIZATION, BINARY, CONCAT, CONVOLUTION,
-      DECONVOLUTION, ELTWISE, GROUP_NORMALIZATION, INNER_PRODUCT,
-      LAYER_NORMALIZATION, LRN, MATMUL, POOLING, PRELU, REDUCTION, REORDER,
-      RESAMPLING, RNN, SDPA, SHUFFLE, SOFTMAX, SUM.
+      DECONVOLUTION, ELTWISE, GATHER, GROUP_NORMALIZATION, INNER_PRODUCT,
+      LAYER_NORMALIZATION, LRN, MATMUL, OPTIMIZER, POOLING, PRELU, REDUCTION,
+      REORDER, RESAMPLING, RNN, SDPA, SHUFFLE, SOFTMAX, SPLIT, SUM, TOPK.
     - <PRIMITIVE_NAME>;<PRIMITIVE_NAME>;... Includes only selected primitives to
       be enabled at build time. This is treated as CMake string, thus, semicolon
       is a mandatory delimiter between names. This is the way to specify several
@@ -169,6 +169,11 @@ set(DNNL_AMD_SYCL_KERNELS_TARGET_ARCH "" CACHE STRING
     stops to require specifying the target architecture. After removing the option
     the generic SYCL kernels will always be enabled for AMD vendor.")
 
+option(DNNL_AMD_USE_HIPBLASLT
+    "enables the hipBLASLt-based matmul implementation for AMD vendor when
+    hipBLASLt is found. If hipBLASLt is not available or the option is OFF,
+    matmul falls back to the rocBLAS/MIOpen-based implementation." ON)
+
 # =============
 # Optimizations
 # =============
@@ -267,6 +272,13 @@ if(NOT "${_DNNL_TEST_THREADPOOL_IMPL}" MATCHES "^(STANDALONE|TBB|EIGEN)$")
         "Unsupported threadpool implementation: ${_DNNL_TEST_THREADPOOL_IMPL}")
 endif()
 
+option(DNNL_ENABLE_NATIVE_THREADPOOL
+    "enables a built-in work-stealing threadpool that runs primitives when
+    DNNL_CPU_RUNTIME=THREADPOOL is selected and a stream is created without a
+    user threadpool (off by default). Without it, such streams execute
+    sequentially."
+    OFF)
+
 set(TBBROOT "" CACHE STRING
     "path to Thread Building Blocks (TBB).
     Use this option to specify TBB installation locaton.")
@@ -182,6 +182,32 @@ dnnl_status_t DNNL_API dnnl_primitive_create_from_cache_blob(
         dnnl_primitive_t *primitive, const_dnnl_primitive_desc_t primitive_desc,
         size_t size, const uint8_t *cache_blob);
 
+/// Creates a primitive asynchronously.
+///
+/// The primitive is created on a library-internal thread and added to the
+/// primitive cache, so that a subsequent #dnnl_primitive_create() call with
+/// an equivalent primitive descriptor returns it without delay. Once the
+/// creation completes, @p callback is invoked from that thread.
+///
+/// @note
+///     The primitive descriptor is copied and may be destroyed right after
+///     this call. The engine must outlive the creation.
+///
+/// @note
+///     Creations that have not started by the time the library is unloaded
+///     are canceled: @p callback is invoked with a NULL primitive and
+///     #dnnl_runtime_error from the unloading thread.
+///
+/// @param primitive_desc Primitive descriptor used to create the primitive.
+/// @param callback Function invoked once the creation completes.
+/// @param user_data User data passed to @p callback.
+/// @returns #dnnl_success if the creation was submitted and a status
+///     describing the error otherwise, in which case @p callback is not
+///     invoked.
+dnnl_status_t DNNL_API dnnl_primitive_create_async(
+        const_dnnl_primitive_desc_t primitive_desc,
+        dnnl_primitive_create_callback_t callback, void *user_data);
+
 /// Executes a primitive.
 ///
 /// @param primitive Primitive to execute.
@@ -202,6 +228,104 @@ dnnl_status_t DNNL_API dnnl_primitive_create_from_cache_blob(
 dnnl_status_t DNNL_API dnnl_primitive_execute(const_dnnl_primitive_t primitive,
         dnnl_stream_t stream, int nargs, const dnnl_exec_arg_t *args);
 
+/// Executes a primitive over several independent sets of arguments.
+///
+/// The result is the same as calling #dnnl_primitive_execute() for every set
+/// of arguments in order. On CPU engines with a native runtime, the executions
+/// are distributed between the threads within a single parallel region and
+/// each of them runs on one thread. This amortizes the per-execution
+/// threading overheads when a small primitive is applied to many tensors.
+///
+/// The sets of arguments must not share output memory objects. With the user
+/// scratchpad mode, every set must either pass its own scratchpad or pass no
+/// scratchpad.
+///
+/// @param primitive Primitive to execute.
+/// @param stream Stream to use.
+/// @param nbatch Number of sets of arguments.
+/// @param nargs Array of @p nbatch numbers of arguments in each set.
+/// @param args Array of @p nbatch arrays of arguments. See
+///     #dnnl_primitive_execute() for the description of the arguments.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_execute_batch(
+        const_dnnl_primitive_t primitive, dnnl_stream_t stream, int nbatch,
+        const int *nargs, const dnnl_exec_arg_t *const *args);
+
+/// Hints that a primitive is about to be executed with the given arguments.
+///
+/// On CPU engines with a native runtime, the weights, bias, and the scales and
+/// zero points of the weights among @p args are read on library-internal
+/// threads in the background, which brings them closer to the cores while
+/// the work submitted before the next execution is running. This hides the
+/// memory latency at the boundaries of bandwidth-bound primitives, such as
+/// the matrix multiplications of the decoding phase of large language
+/// models. On other engines, the call has no effect.
+///
+/// @note
+///     The prefetched memory objects must stay alive until the primitive is
+///     executed with them or destroyed. The execution skips the reads that
+///     haven't started yet and waits for the running ones.
+///
+/// @param primitive Primitive to be executed.
+/// @param stream Stream the primitive is to be executed on.
+/// @param nargs Number of arguments.
+/// @param args Array of arguments. See #dnnl_primitive_execute() for the
+///     description of the arguments.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_prefetch(const_dnnl_primitive_t primitive,
+        dnnl_stream_t stream, int nargs, const dnnl_exec_arg_t *args);
+
+/// Starts recording primitive executions submitted to a stream.
+///
+/// Primitives executed on the stream until #dnnl_stream_end_capture() is
+/// called are executed as usual and are also recorded together with their
+/// arguments. Only CPU streams and in-order NVIDIA GPU streams are supported.
+///
+/// On NVIDIA GPUs, the first replay records the executions into a CUDA graph
+/// and the next replays launch the graph, which removes the host overhead of
+/// the individual executions. If an execution cannot be recorded, for
+/// example because the primitive reads an argument on the host, the
+/// executions are replayed one by one instead.
+///
+/// @param stream Stream to record.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_begin_capture(dnnl_stream_t stream);
+
+/// Stops recording primitive executions submitted to a stream.
+///
+/// @param stream Stream that is being recorded.
+/// @param capture Output recorded sequence of primitive executions.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_end_capture(
+        dnnl_stream_t stream, dnnl_stream_capture_t *capture);
+
+/// Executes a recorded sequence of primitive executions.
+///
+/// The replay skips the argument conversion and checks done by
+/// #dnnl_primitive_execute(). The recorded primitives are kept alive by the
+/// capture, while the recorded memory objects must stay alive until the
+/// capture is destroyed. The data of the memory objects may change between
+/// replays.
+///
+/// @param capture Recorded sequence of primitive executions.
+/// @param stream Stream to execute on. Must be the recorded stream.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_capture_replay(
+        const_dnnl_stream_capture_t capture, dnnl_stream_t stream);
+
+/// Destroys a recorded sequence of primitive executions.
+///
+/// @param capture Recorded sequence of primitive executions to destroy.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_capture_destroy(
+        dnnl_stream_capture_t capture);
+
 /// Retrieves a constant reference to the primitive descriptor of a given
 /// primitive.
 ///
@@ -233,6 +357,29 @@ dnnl_status_t DNNL_API dnnl_primitive_get_primitive_desc(
 dnnl_status_t DNNL_API dnnl_primitive_get_cache_blob(
         const_dnnl_primitive_t primitive, size_t *size, uint8_t *cache_blob);
 
+/// Retrieves cumulative execution statistics of a primitive.
+///
+/// The statistics are collected for the executions of the primitive object
+/// since its creation or the last reset that happen while execution
+/// profiling is enabled, either with `ONEDNN_VERBOSE=profile_exec` (or
+/// #dnnl_set_verbose() with level 2) or with a stream created with the
+/// #dnnl_stream_profiling flag. Other executions are not timed or counted.
+///
+/// @param primitive Primitive to query.
+/// @param stats Output execution statistics.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_get_exec_stats(
+        const_dnnl_primitive_t primitive, dnnl_primitive_exec_stats_t *stats);
+
+/// Resets execution statistics of a primitive.
+///
+/// @param primitive Primitive to reset the statistics for.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_reset_exec_stats(
+        dnnl_primitive_t primitive);
+
 /// Destroys a primitive.
 ///
 /// @param primitive The primitive to destroy.
@@ -357,6 +504,206 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_deterministic(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_deterministic(
         dnnl_primitive_attr_t attr, int value);
 
+/// Returns the maximum number of threads a primitive may use.
+///
+/// @param attr Primitive attributes.
+/// @param nthr Output maximum number of threads. Zero means that the number
+///     of threads is not limited.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_max_threads(
+        const_dnnl_primitive_attr_t attr, int *nthr);
+
+/// Sets the maximum number of threads a primitive may use.
+///
+/// The limit applies both to the creation of a primitive descriptor, where it
+/// affects the work decomposition chosen by an implementation, and to the
+/// execution of the primitive. The limit only lowers the number of threads
+/// available from the threading runtime. It only applies to CPU engines.
+///
+/// @param attr Primitive attributes.
+/// @param nthr Maximum number of threads. Zero, which is the default, means
+///     that the number of threads is not limited.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_max_threads(
+        dnnl_primitive_attr_t attr, int nthr);
+
+/// Returns the constant quantization primitive attribute value.
+///
+/// @param attr Primitive attributes.
+/// @param value Output constant quantization attribute value.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_constant_quantization(
+        const_dnnl_primitive_attr_t attr, int *value);
+
+/// Sets the constant quantization primitive attribute value.
+///
+/// The attribute tells that the values of the scales, the zero-points and
+/// the weights passed to the primitive stay the same across its executions.
+/// Implementations may then compute values derived from them, such as
+/// combined source and weights scales or zero-point compensation, once at
+/// the first execution of the primitive object instead of every execution.
+/// Implementations that don't benefit from it ignore the attribute.
+///
+/// @param attr Primitive attributes.
+/// @param value Boolean value to set the constant quantization attribute.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_constant_quantization(
+        dnnl_primitive_attr_t attr, int value);
+
+/// Returns the data type the source tensor is dynamically quantized to.
+///
+/// @param attr Primitive attributes.
+/// @param data_type Output data type. #dnnl_data_type_undef means that
+///     dynamic quantization of the source is disabled.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_src_dynamic_quantization(
+        const_dnnl_primitive_attr_t attr, dnnl_data_type_t *data_type);
+
+/// Sets dynamic quantization of the source tensor.
+///
+/// When set, the primitive quantizes the floating-point source tensor to
+/// @p data_type at execution time. The quantization is symmetric with one
+/// scale per row of the source, computed as the maximum absolute value over
+/// the reduction dimension divided by the largest value of @p data_type,
+/// unless source scales are set. The scales are applied to the result before
+/// bias and post-ops. The attribute is only supported by matmul with integer
+/// weights.
+///
+/// @param attr Primitive attributes.
+/// @param data_type Quantized source data type. Only #dnnl_s8 is supported.
+///     #dnnl_data_type_undef, which is the default, disables the
+///     quantization.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_src_dynamic_quantization(
+        dnnl_primitive_attr_t attr, dnnl_data_type_t data_type);
+
+/// Returns whether the primitive computes the absolute maximum of the
+/// destination tensor.
+///
+/// @param attr Primitive attributes.
+/// @param value Output value: non-zero if the absolute maximum is computed.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_dst_amax(
+        const_dnnl_primitive_attr_t attr, int *value);
+
+/// Sets whether the primitive computes the absolute maximum of the
+/// destination tensor.
+///
+/// When enabled, the primitive writes the maximum absolute value of the
+/// destination, as stored in memory after post-ops and conversion to the
+/// destination data type, to a single-element f32 tensor passed at the
+/// execution stage as #DNNL_ARG_ATTR_DST_AMAX. The attribute is only
+/// supported by matmul.
+///
+/// @param attr Primitive attributes.
+/// @param value Non-zero to compute the absolute maximum, zero (the default)
+///     to disable it.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_dst_amax(
+        dnnl_primitive_attr_t attr, int value);
+
+/// Returns the data type of the secondary destination.
+///
+/// @param attr Primitive attributes.
+/// @param data_type Output data type, #dnnl_data_type_undef if the secondary
+///     destination is not written.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_secondary_dst(
+        const_dnnl_primitive_attr_t attr, dnnl_data_type_t *data_type);
+
+/// Sets the data type of the secondary destination.
+///
+/// When set, the primitive additionally writes the destination quantized to
+/// @p data_type to a tensor passed at the execution stage as
+/// #DNNL_ARG_ATTR_SECONDARY_DST. The tensor has the shape and the layout of
+/// the destination. The values are the destination values, as stored in
+/// memory, divided by the single f32 scale passed as
+/// #DNNL_ARG_ATTR_SECONDARY_DST_SCALE, rounded and saturated. The attribute
+/// is only supported by matmul.
+///
+/// @param attr Primitive attributes.
+/// @param data_type Data type of the secondary destination: #dnnl_s8,
+///     #dnnl_u8, #dnnl_f8_e5m2 or #dnnl_f8_e4m3. #dnnl_data_type_undef (the
+///     default) disables it.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_secondary_dst(
+        dnnl_primitive_attr_t attr, dnnl_data_type_t data_type);
+
+/// Returns whether the primitive computes the destination quantization
+/// parameters.
+///
+/// @param attr Primitive attributes.
+/// @param value Output value: non-zero if the destination scales and zero
+///     points are computed by the primitive.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_dst_dynamic_quantization(
+        const_dnnl_primitive_attr_t attr, int *value);
+
+/// Sets whether the primitive computes the destination quantization
+/// parameters.
+///
+/// When enabled, the destination scales, and the destination zero points if
+/// they are set, are computed from the source values of every group at the
+/// execution stage instead of being read. Their mask, groups and data types
+/// are still set with dnnl_primitive_attr_set_scales() and
+/// dnnl_primitive_attr_set_zero_points() for #DNNL_ARG_DST, and the tensors
+/// passed as #DNNL_ARG_ATTR_SCALES | #DNNL_ARG_DST and
+/// #DNNL_ARG_ATTR_ZERO_POINTS | #DNNL_ARG_DST become outputs. Without zero
+/// points the quantization is symmetric, based on the absolute maximum of
+/// the group, otherwise it is asymmetric, based on its minimum and maximum.
+/// The attribute is only supported by reorder.
+///
+/// @param attr Primitive attributes.
+/// @param value Non-zero to compute the quantization parameters, zero (the
+///     default) to read them.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_dst_dynamic_quantization(
+        dnnl_primitive_attr_t attr, int value);
+
+/// Returns the data type of the activation stash.
+///
+/// @param attr Primitive attributes.
+/// @param data_type Output data type, #dnnl_data_type_undef if activations
+///     are not stashed.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_activation_stash(
+        const_dnnl_primitive_attr_t attr, dnnl_data_type_t *data_type);
+
+/// Sets the data type of the activation stash.
+///
+/// When set for a forward training primitive, the primitive additionally
+/// writes a copy of the tensor its backward pass depends on, converted to
+/// @p data_type, to the workspace. The backward primitive created with the
+/// same attribute and with the forward primitive descriptor as a hint reads
+/// the copy from the workspace instead of the full precision source or
+/// destination, which reduces the memory kept between the passes. The
+/// attribute is only supported by the reference CPU eltwise implementation
+/// for dense memory formats; other primitives, including matmul and layer
+/// normalization, and optimized or GPU implementations reject it. Integer
+/// stash data types are not supported.
+///
+/// @param attr Primitive attributes.
+/// @param data_type Data type of the stash: #dnnl_bf16, #dnnl_f16,
+///     #dnnl_f8_e5m2 or #dnnl_f8_e4m3. #dnnl_data_type_undef (the default)
+///     disables it.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_activation_stash(
+        dnnl_primitive_attr_t attr, dnnl_data_type_t data_type);
+
 /// Returns the accumulation mode primitive attribute.
 ///
 /// @param attr Primitive attributes.
@@ -965,6 +1312,35 @@ dnnl_status_t DNNL_API dnnl_memory_desc_create_with_coo_encoding(
         dnnl_data_type_t data_type, dnnl_dim_t nnz,
         dnnl_data_type_t indices_dt);
 
+/// Creates a memory descriptor for BSR encoding.
+///
+/// The tensor is split in dense blocks of @p block_dims elements and only the
+/// blocks that contain non-zero values are stored. The blocks are described
+/// in the CSR manner with one entry per block. The created memory descriptor
+/// will describe a memory object that contains 3 buffers. The buffers have
+/// the following meaning and assigned numbers (index):
+///  - 0: values, `nnz` dense blocks stored one after another, each block
+///       in the row-major order
+///  - 1: block column indices, one per stored block
+///  - 2: block row pointers, `dims[0] / block_dims[0] + 1` entries
+///
+/// @param memory_desc Output memory descriptor.
+/// @param ndims Number of dimensions. Only 2 is supported.
+/// @param dims Array of dimensions. Each dimension must be divisible by the
+///     respective block dimension.
+/// @param data_type Elements data type.
+/// @param nnz Number of stored (non-zero) blocks.
+/// @param block_dims Array of @p ndims block dimensions.
+/// @param indices_dt Data type of indices.
+/// @param pointers_dt Data type of pointers.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_desc_create_with_bsr_encoding(
+        dnnl_memory_desc_t *memory_desc, int ndims, const dnnl_dims_t dims,
+        dnnl_data_type_t data_type, dnnl_dim_t nnz,
+        const dnnl_dims_t block_dims, dnnl_data_type_t indices_dt,
+        dnnl_data_type_t pointers_dt);
+
 /// Creates a memory descriptor for packed sparse encoding.
 ///
 /// The created memory descriptor cannot be used to create a memory
@@ -989,6 +1365,35 @@ dnnl_status_t DNNL_API dnnl_memory_desc_create_with_packed_encoding(
         dnnl_memory_desc_t *memory_desc, int ndims, const dnnl_dims_t dims,
         dnnl_data_type_t data_type, dnnl_dim_t nnz);
 
+/// Creates a memory descriptor for packed 2:4 structured sparse encoding.
+///
+/// At most 2 of every 4 consecutive values along the reduction dimension
+/// (`dims[ndims - 2]`) can be non-zero. A reorder to this encoding keeps the
+/// 2 values of the largest magnitude in every group, therefore it is exact
+/// only for tensors that follow the pattern. The number of non-zero entries
+/// is half of the number of elements.
+///
+/// Similarly to the packed encoding, the created memory descriptor cannot be
+/// used to create a memory object. It can only be used to create a primitive
+/// descriptor to query the actual memory descriptor (similar to the format
+/// tag `any`).
+///
+/// @warning
+///     The meaning and content of the handles of the memory object that
+///     is created using the queried memory descriptor are unspecified
+///     therefore using the content is an undefined behavior.
+///
+/// @param memory_desc Output memory descriptor.
+/// @param ndims Number of dimensions
+/// @param dims Array of dimensions.
+/// @param data_type Elements data type.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+/// @sa @ref dev_guide_sparsity
+dnnl_status_t DNNL_API dnnl_memory_desc_create_with_packed_2_4_encoding(
+        dnnl_memory_desc_t *memory_desc, int ndims, const dnnl_dims_t dims,
+        dnnl_data_type_t data_type);
+
 /// Creates a memory descriptor for a region inside an area
 /// described by an existing memory descriptor.
 ///
@@ -1291,6 +1696,32 @@ dnnl_status_t DNNL_API dnnl_memory_create_v2(dnnl_memory_t *memory,
         const_dnnl_memory_desc_t memory_desc, dnnl_engine_t engine,
         int nhandles, void **handles);
 
+/// Creates a memory object backed by a mapping of a file region.
+///
+/// The region of the file that starts at @p offset and has the size of
+/// @p memory_desc is mapped into memory and is used as the underlying buffer
+/// of the memory object without a copy. The library owns the mapping and
+/// unmaps it when the memory object is destroyed. The file descriptor is not
+/// used after the function returns and may be closed by the user.
+///
+/// The mapping is private: writes to the memory object are not stored in the
+/// file. The @p offset does not need to be a multiple of the page size. Only
+/// CPU engines with a non-SYCL runtime on POSIX systems are supported.
+///
+/// @param memory Output memory object.
+/// @param memory_desc Memory descriptor. Must describe a memory with a single
+///     handle.
+/// @param engine Engine to use.
+/// @param fd File descriptor opened for reading.
+/// @param offset Offset of the region in the file, in bytes.
+/// @param flags Mapping flags. A bitwise OR of #dnnl_memory_map_flags_t
+///     values.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_create_from_file(dnnl_memory_t *memory,
+        const_dnnl_memory_desc_t memory_desc, dnnl_engine_t engine, int fd,
+        size_t offset, unsigned flags);
+
 /// Returns the memory descriptor for a memory object.
 ///
 /// @param memory Memory object.
@@ -1363,6 +1794,33 @@ dnnl_status_t DNNL_API dnnl_memory_map_data(
 dnnl_status_t DNNL_API dnnl_memory_map_data_v2(
         const_dnnl_memory_t memory, void **mapped_ptr, int index);
 
+/// Maps a range of a memory object buffer and returns a host-side pointer to
+/// the first byte of the range. The memory buffer corresponds to the given
+/// index.
+///
+/// Only the range is transferred to the host and back, if the memory needs a
+/// copy at all. Host and shared USM allocations that the host can access
+/// directly are mapped without a copy. The mapping is released with
+/// dnnl_memory_unmap_data_v2() called on the returned pointer.
+///
+/// @note
+///     Any primitives working with @p memory should be completed before
+///     the memory is mapped. Use dnnl_stream_wait to synchronize the
+///     corresponding execution stream.
+///
+/// @note
+///     SYCL buffers are mapped as a whole regardless of the range.
+///
+/// @param memory Memory object.
+/// @param mapped_ptr Output pointer to the mapped range.
+/// @param offset Offset of the range in the buffer, in bytes.
+/// @param size Size of the range, in bytes.
+/// @param index Index of the buffer.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_map_data_range(const_dnnl_memory_t memory,
+        void **mapped_ptr, size_t offset, size_t size, int index);
+
 /// Unmaps a memory object and writes back any changes made to the previously
 /// mapped memory buffer. The pointer to the mapped buffer must be obtained
 /// via the dnnl_memory_map_data() call.
@@ -1504,6 +1962,32 @@ dnnl_status_t DNNL_API dnnl_concat_primitive_desc_create(
 
 /// @} dnnl_api_concat
 
+/// @addtogroup dnnl_api_split
+/// @{
+
+/// Creates a primitive descriptor for a split primitive.
+///
+/// @param split_primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param src_desc Source memory descriptor.
+/// @param n Number of destination parameters.
+/// @param split_dimension Source tensor will be split over dimension with
+///     this index. Note that order of dimensions does not depend on memory
+///     format.
+/// @param dst_descs Array of destination memory descriptors with @p n
+///     elements. A destination with #dnnl_format_tag_any format is
+///     initialized to the view of its part of the source tensor.
+/// @param attr Primitive attributes to use (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_split_primitive_desc_create(
+        dnnl_primitive_desc_t *split_primitive_desc, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t src_desc, int n, int split_dimension,
+        const_dnnl_memory_desc_t const *dst_descs,
+        const_dnnl_primitive_attr_t attr);
+
+/// @} dnnl_api_split
+
 /// @addtogroup dnnl_api_sum
 /// @{
 
@@ -2033,12 +2517,17 @@ dnnl_status_t DNNL_API dnnl_softmax_backward_primitive_desc_create(
 /// is the same as in the tensor: depth (for 3D tensors),
 /// height (for 3D and 2D tensors), and width.
 ///
+/// For the adaptive algorithms the window of each destination point is
+/// derived from the source and destination sizes, and @p strides, @p kernel,
+/// @p dilation, @p padding_l and @p padding_r are ignored and can be NULL.
+///
 /// @param primitive_desc Output primitive descriptor.
 /// @param engine Engine to use.
 /// @param prop_kind Propagation kind. Possible values are
 ///     #dnnl_forward_training and #dnnl_forward_inference.
 /// @param alg_kind Pooling algorithm kind: either #dnnl_pooling_max,
-///     #dnnl_pooling_avg_include_padding, or #dnnl_pooling_avg_exclude_padding.
+///     #dnnl_pooling_avg_include_padding, #dnnl_pooling_avg_exclude_padding,
+///     #dnnl_pooling_adaptive_max, or #dnnl_pooling_adaptive_avg.
 /// @param src_desc Source memory descriptor.
 /// @param dst_desc Destination memory descriptor.
 /// @param strides Array of strides for spatial dimension.
@@ -2069,10 +2558,15 @@ dnnl_status_t DNNL_API dnnl_pooling_forward_primitive_desc_create(
 /// is the same as in the tensor: depth (for 3D tensors),
 /// height (for 3D and 2D tensors), and width.
 ///
+/// For the adaptive algorithms the window of each destination point is
+/// derived from the source and destination sizes, and @p strides, @p kernel,
+/// @p dilation, @p padding_l and @p padding_r are ignored and can be NULL.
+///
 /// @param primitive_desc Output primitive descriptor.
 /// @param engine Engine to use.
 /// @param alg_kind Pooling algorithm kind: either #dnnl_pooling_max,
-///     #dnnl_pooling_avg_include_padding, or #dnnl_pooling_avg_exclude_padding.
+///     #dnnl_pooling_avg_include_padding, #dnnl_pooling_avg_exclude_padding,
+///     #dnnl_pooling_adaptive_max, or #dnnl_pooling_adaptive_avg.
 /// @param diff_src_desc Diff source memory descriptor.
 /// @param diff_dst_desc Diff destination memory descriptor.
 /// @param strides Array of strides for spatial dimension.
@@ -3525,6 +4019,36 @@ dnnl_status_t DNNL_API dnnl_matmul_primitive_desc_create(
         const_dnnl_memory_desc_t bias_desc, const_dnnl_memory_desc_t dst_desc,
         const_dnnl_primitive_attr_t attr);
 
+/// Creates a primitive descriptor for a grouped matrix multiplication
+/// primitive.
+///
+/// A grouped matmul computes G independent products that share K and N.
+/// The source and destination rows of all the groups are stored back to
+/// back, and group g covers rows [offsets[g - 1], offsets[g]) with
+/// offsets[-1] = 0. The offsets are passed at execution time as
+/// #DNNL_ARG_GROUP_OFFSETS.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param src_desc Source memory descriptor of shape M_total x K.
+/// @param weights_desc Weights memory descriptor of shape G x K x N.
+/// @param bias_desc Bias memory descriptor of shape G x N. Passing NULL, a
+///     zero memory descriptor, or a memory descriptor with format_kind set to
+///     #dnnl_format_kind_undef disables the bias term.
+/// @param dst_desc Destination memory descriptor of shape M_total x N.
+/// @param group_offsets_desc Group offsets memory descriptor: a
+///     one-dimensional #dnnl_s32 tensor of shape G.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_grouped_matmul_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t weights_desc,
+        const_dnnl_memory_desc_t bias_desc, const_dnnl_memory_desc_t dst_desc,
+        const_dnnl_memory_desc_t group_offsets_desc,
+        const_dnnl_primitive_attr_t attr);
+
 /// @} dnnl_api_matmul
 
 /// @addtogroup dnnl_api_resampling Resampling
@@ -3541,8 +4065,9 @@ dnnl_status_t DNNL_API dnnl_matmul_primitive_desc_create(
 /// @param engine Engine to use.
 /// @param prop_kind Propagation kind. Possible values are
 ///     #dnnl_forward_training and #dnnl_forward_inference.
-/// @param alg_kind resampling algorithm kind: either #dnnl_resampling_nearest,
-///     or #dnnl_resampling_linear.
+/// @param alg_kind resampling algorithm kind: #dnnl_resampling_nearest,
+///     #dnnl_resampling_linear, #dnnl_resampling_cubic, or
+///     #dnnl_resampling_linear_antialias.
 /// @param factors Array of scaling factors for spatial dimension.
 /// @param src_desc Source memory descriptor.
 /// @param dst_desc Destination memory descriptor.
@@ -3612,6 +4137,109 @@ dnnl_status_t DNNL_API dnnl_reduction_primitive_desc_create(
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_gather
+/// @{
+
+/// Creates a primitive descriptor for a gather primitive.
+///
+/// @note
+///     Destination memory descriptor is allowed to be initialized with
+///     #dnnl_format_tag_any or with format_kind set to #dnnl_format_kind_any.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param alg_kind Gather algorithm kind. Possible values:
+///     #dnnl_gather_none, #dnnl_gather_sum, #dnnl_gather_mean.
+/// @param src_desc Source (table) memory descriptor with dimensions
+///     {rows, columns}.
+/// @param indices_desc Indices memory descriptor with dimensions
+///     {bags, indices per bag}.
+/// @param dst_desc Destination memory descriptor with dimensions
+///     {bags, indices per bag, columns} for #dnnl_gather_none and
+///     {bags, columns} otherwise.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_gather_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t indices_desc,
+        const_dnnl_memory_desc_t dst_desc, const_dnnl_primitive_attr_t attr);
+
+/// @} dnnl_api_gather
+
+/// @addtogroup dnnl_api_topk
+/// @{
+
+/// Creates a primitive descriptor for a top-k primitive.
+///
+/// The primitive selects the @p k largest elements along @p axis, where @p k
+/// is the @p axis dimension of @p dst_desc. The elements are returned in
+/// descending order, together with their positions along @p axis.
+///
+/// @note
+///     Destination and indices memory descriptors are allowed to be
+///     initialized with #dnnl_format_tag_any or with format_kind set to
+///     #dnnl_format_kind_any.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param src_desc Source memory descriptor.
+/// @param dst_desc Destination (values) memory descriptor.
+/// @param indices_desc Destination indices memory descriptor. Must have the
+///     same dimensions as @p dst_desc and the #dnnl_s32 data type.
+/// @param axis Axis along which the elements are selected.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_topk_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t src_desc, const_dnnl_memory_desc_t dst_desc,
+        const_dnnl_memory_desc_t indices_desc, int axis,
+        const_dnnl_primitive_attr_t attr);
+
+/// @} dnnl_api_topk
+
+/// @addtogroup dnnl_api_optimizer
+/// @{
+
+/// Creates a primitive descriptor for an optimizer primitive.
+///
+/// The primitive updates the parameters (#DNNL_ARG_DST) in place using their
+/// gradients (#DNNL_ARG_SRC). The learning rate (#DNNL_ARG_LEARNING_RATE)
+/// and, for #dnnl_optimizer_adam and #dnnl_optimizer_adamw, the 1-based step
+/// counter (#DNNL_ARG_STEP) are passed at execution time. The optimizer state
+/// (#DNNL_ARG_MOMENT_1, #DNNL_ARG_MOMENT_2, #DNNL_ARG_MASTER_WEIGHTS) is
+/// updated in place as well.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param alg_kind Optimizer algorithm kind. Possible values:
+///     #dnnl_optimizer_sgd, #dnnl_optimizer_adam, #dnnl_optimizer_adamw.
+/// @param grad_desc Gradient memory descriptor.
+/// @param param_desc Parameters memory descriptor.
+/// @param master_desc Memory descriptor of the f32 master copy of the
+///     parameters. Can be NULL or a zero memory descriptor if the parameters
+///     are updated directly.
+/// @param momentum Momentum for #dnnl_optimizer_sgd or the exponential decay
+///     rate of the first moment (beta1) for the Adam algorithms.
+/// @param beta2 The exponential decay rate of the second moment. Ignored for
+///     #dnnl_optimizer_sgd.
+/// @param epsilon Denominator term for the numerical stability. Ignored for
+///     #dnnl_optimizer_sgd.
+/// @param weight_decay Weight decay factor.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_optimizer_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t grad_desc,
+        const_dnnl_memory_desc_t param_desc,
+        const_dnnl_memory_desc_t master_desc, float momentum, float beta2,
+        float epsilon, float weight_decay, const_dnnl_primitive_attr_t attr);
+
+/// @} dnnl_api_optimizer
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_primitive_cache
@@ -3640,8 +4268,100 @@ dnnl_status_t DNNL_API dnnl_get_primitive_cache_capacity(int *capacity);
 ///     success.
 dnnl_status_t DNNL_API dnnl_set_primitive_cache_capacity(int capacity);
 
+/// Creates primitives for a set of primitive descriptors in parallel and puts
+/// them into the primitive cache, so that creating the primitives afterwards
+/// doesn't wait for code generation.
+///
+/// Creation continues for the remaining primitive descriptors if one of them
+/// fails. The primitives are created by the threads of the CPU threading
+/// runtime, limited by the maximum number of threads of the calling thread.
+/// With the threadpool runtime, they are created on the calling thread.
+///
+/// @param npds Number of primitive descriptors.
+/// @param primitive_descs Array of @p npds primitive descriptors.
+/// @returns #dnnl_success if all primitives are created and the status of
+///     the first failure otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_cache_warm_up(
+        int npds, const const_dnnl_primitive_desc_t *primitive_descs);
+
+/// Returns the amount of memory in bytes that primitives held in the
+/// primitive cache may occupy at the same time.
+///
+/// @param limit Primitive cache memory limit to query. The value of 0 means
+///     that only the number of primitives is limited. Concurrently accessing
+///     @p limit is safe.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p limit value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_primitive_cache_memory_limit(size_t *limit);
+
+/// Sets the amount of memory in bytes that primitives held in the primitive
+/// cache may occupy at the same time.
+///
+/// The memory of a primitive accounts for its generated code. When the
+/// total exceeds @p limit, the least recently used primitives are evicted.
+/// The limit applies in addition to the primitive cache capacity.
+///
+/// @param limit Primitive cache memory limit to set. The value of 0 removes
+///     the limit. Concurrently modifying @p limit is safe.
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_set_primitive_cache_memory_limit(size_t limit);
+
 /// @} dnnl_api_primitive_cache
 
+/// @addtogroup dnnl_api_packed_weights_cache
+/// @{
+
+/// Returns the amount of memory in bytes that packed weights held in the
+/// packed weights cache may occupy at the same time.
+///
+/// @param capacity Packed weights cache capacity to query. The value of 0
+///     means that the cache is disabled. Concurrently accessing @p capacity
+///     is safe.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p capacity value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_packed_weights_cache_capacity(
+        size_t *capacity);
+
+/// Sets the amount of memory in bytes that packed weights held in the packed
+/// weights cache may occupy at the same time.
+///
+/// @param capacity Packed weights cache capacity to set. When the cached
+///     packed weights exceed @p capacity, the least recently used ones are
+///     evicted. Setting the @p capacity to 0 clears the cache and disables
+///     it. Concurrently modifying @p capacity is safe.
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_set_packed_weights_cache_capacity(size_t capacity);
+
+/// Returns a memory object that holds weights reordered into a given memory
+/// descriptor, e.g. the weights memory descriptor queried from a primitive
+/// descriptor.
+///
+/// Packed weights are cached by the weights buffer, the weights memory
+/// descriptor and the packed memory descriptor, so that primitives and model
+/// replicas using the same weights share a single packed copy. The weights are
+/// assumed to stay unchanged while their packed copy is cached; to update
+/// the weights, clear the cache with
+/// dnnl_set_packed_weights_cache_capacity().
+///
+/// @param packed Output memory object. The memory object may share its
+///     buffer with memory objects returned by other calls, so it must not be
+///     modified. It must be destroyed with dnnl_memory_destroy().
+/// @param packed_desc Memory descriptor of the packed weights. Must not
+///     have the #dnnl_format_kind_any format kind.
+/// @param weights Memory object with the weights.
+/// @param stream Stream to execute the reorder of the weights on. The
+///     reorder is complete on return. Must belong to the engine of the
+///     weights.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_packed_weights_get_or_create(dnnl_memory_t *packed,
+        const_dnnl_memory_desc_t packed_desc, const_dnnl_memory_t weights,
+        dnnl_stream_t stream);
+
+/// @} dnnl_api_packed_weights_cache
+
 /// @addtogroup dnnl_api_service
 /// @{
 
@@ -3790,6 +4510,23 @@ dnnl_status_t DNNL_API dnnl_set_cpu_isa_hints(dnnl_cpu_isa_hints_t isa_hints);
 /// library can follow.
 dnnl_cpu_isa_hints_t DNNL_API dnnl_get_cpu_isa_hints(void);
 
+/// Sets the placement policy for the CPU threads created by the library, such
+/// as the workers of the built-in threadpool. The threads of the OpenMP and
+/// TBB runtimes are placed by these runtimes. The policy can be set only
+/// before the first use of the library threads. This function overrides the
+/// ONEDNN_CPU_AFFINITY environment variable.
+///
+/// @sa @ref dev_guide_cpu_affinity for more details
+///
+/// @param policy Placement policy: `none`, `compact`, `scatter`,
+///     `numa:<node>`, or a list of CPUs, e.g. `0-3,8`.
+/// @returns #dnnl_success/#dnnl::status::success on success, a
+///     #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p policy is malformed, and a
+///     #dnnl_runtime_error/#dnnl::status::runtime_error if the policy cannot
+///     be changed at this time.
+dnnl_status_t DNNL_API dnnl_set_cpu_affinity(const char *policy);
+
 /// @} dnnl_api_service
 
 #ifdef DNNL_EXPERIMENTAL_PROFILING
@@ -4014,6 +4751,228 @@ dnnl_status_t DNNL_API dnnl_gemm_s8s8s32(char transa, char transb, char offsetc,
         dnnl_dim_t lda, int8_t ao, const int8_t *B, dnnl_dim_t ldb, int8_t bo,
         float beta, int32_t *C, dnnl_dim_t ldc, const int32_t *co);
 
+/// Performs a batch of single-precision matrix-matrix multiplies with matrices
+/// located at a constant stride from each other.
+///
+/// For every `i` in `[0, batch_size)` the operation is defined as for
+/// dnnl_sgemm() with `A + i * stride_a`, `B + i * stride_b`, and
+/// `C + i * stride_c` matrices. The batch is distributed between threads
+/// together with the rows of the matrix C, which is beneficial for batches of
+/// small matrices compared to a sequence of dnnl_sgemm() calls.
+///
+/// @note
+///     Only 'N', 'n', 'T', and 't' transposition flags are supported.
+///
+/// @param transa Transposition flag for matrices A.
+/// @param transb Transposition flag for matrices B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A A pointer to the first A matrix data.
+/// @param lda The leading dimension for the matrices A.
+/// @param stride_a The distance in elements between consecutive A matrices.
+/// @param B A pointer to the first B matrix data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param stride_b The distance in elements between consecutive B matrices.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C A pointer to the first C matrix data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param stride_c The distance in elements between consecutive C matrices.
+/// @param batch_size The number of matrix multiplies.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_batch_strided(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *A,
+        dnnl_dim_t lda, dnnl_dim_t stride_a, const float *B, dnnl_dim_t ldb,
+        dnnl_dim_t stride_b, float beta, float *C, dnnl_dim_t ldc,
+        dnnl_dim_t stride_c, dnnl_dim_t batch_size);
+
+/// Performs a batch of single-precision matrix-matrix multiplies with matrices
+/// passed as arrays of pointers.
+///
+/// For every `i` in `[0, batch_size)` the operation is defined as for
+/// dnnl_sgemm() with `A[i]`, `B[i]`, and `C[i]` matrices. All matrices share
+/// dimensions, leading dimensions and scalars. See
+/// dnnl_sgemm_batch_strided() for the parallelization details.
+///
+/// @param transa Transposition flag for matrices A.
+/// @param transb Transposition flag for matrices B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A An array of `batch_size` pointers to the A matrices data.
+/// @param lda The leading dimension for the matrices A.
+/// @param B An array of `batch_size` pointers to the B matrices data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C An array of `batch_size` pointers to the C matrices data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param batch_size The number of matrix multiplies.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_batch(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *const *A,
+        dnnl_dim_t lda, const float *const *B, dnnl_dim_t ldb, float beta,
+        float *const *C, dnnl_dim_t ldc, dnnl_dim_t batch_size);
+
+/// Performs a batch of integer matrix-matrix multiplies on 8-bit unsigned
+/// matrices A, 8-bit signed matrices B, and 32-bit signed resulting matrices
+/// C located at a constant stride from each other.
+///
+/// For every `i` in `[0, batch_size)` the operation is defined as for
+/// dnnl_gemm_u8s8s32() with `A + i * stride_a`, `B + i * stride_b`, and
+/// `C + i * stride_c` matrices. Offsets are shared by all matrices. See
+/// dnnl_sgemm_batch_strided() for the parallelization details.
+///
+/// @param transa Transposition flag for matrices A.
+/// @param transb Transposition flag for matrices B.
+/// @param offsetc Flag specifying how offsets should be applied to matrices C.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A A pointer to the first A matrix data.
+/// @param lda The leading dimension for the matrices A.
+/// @param stride_a The distance in elements between consecutive A matrices.
+/// @param ao The offset value for the matrices A.
+/// @param B A pointer to the first B matrix data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param stride_b The distance in elements between consecutive B matrices.
+/// @param bo The offset value for the matrices B.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C A pointer to the first C matrix data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param stride_c The distance in elements between consecutive C matrices.
+/// @param co An array of offset values for the matrices C.
+/// @param batch_size The number of matrix multiplies.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_batch_strided(char transa,
+        char transb, char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        float alpha, const uint8_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a,
+        uint8_t ao, const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b,
+        int8_t bo, float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c,
+        const int32_t *co, dnnl_dim_t batch_size);
+
+/// Performs a batch of integer matrix-matrix multiplies on 8-bit unsigned
+/// matrices A, 8-bit signed matrices B, and 32-bit signed resulting matrices
+/// C passed as arrays of pointers.
+///
+/// For every `i` in `[0, batch_size)` the operation is defined as for
+/// dnnl_gemm_u8s8s32() with `A[i]`, `B[i]`, and `C[i]` matrices. Offsets are
+/// shared by all matrices. See dnnl_sgemm_batch_strided() for the
+/// parallelization details.
+///
+/// @param transa Transposition flag for matrices A.
+/// @param transb Transposition flag for matrices B.
+/// @param offsetc Flag specifying how offsets should be applied to matrices C.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A An array of `batch_size` pointers to the A matrices data.
+/// @param lda The leading dimension for the matrices A.
+/// @param ao The offset value for the matrices A.
+/// @param B An array of `batch_size` pointers to the B matrices data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param bo The offset value for the matrices B.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C An array of `batch_size` pointers to the C matrices data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param co An array of offset values for the matrices C.
+/// @param batch_size The number of matrix multiplies.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_batch(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint8_t *const *A, dnnl_dim_t lda, uint8_t ao,
+        const int8_t *const *B, dnnl_dim_t ldb, int8_t bo, float beta,
+        int32_t *const *C, dnnl_dim_t ldc, const int32_t *co,
+        dnnl_dim_t batch_size);
+
+/// Performs a batch of integer matrix-matrix multiplies on 8-bit signed
+/// matrices A, 8-bit signed matrices B, and 32-bit signed resulting matrices
+/// C located at a constant stride from each other.
+///
+/// For every `i` in `[0, batch_size)` the operation is defined as for
+/// dnnl_gemm_s8s8s32() with `A + i * stride_a`, `B + i * stride_b`, and
+/// `C + i * stride_c` matrices. Offsets are shared by all matrices. See
+/// dnnl_sgemm_batch_strided() for the parallelization details.
+///
+/// @param transa Transposition flag for matrices A.
+/// @param transb Transposition flag for matrices B.
+/// @param offsetc Flag specifying how offsets should be applied to matrices C.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A A pointer to the first A matrix data.
+/// @param lda The leading dimension for the matrices A.
+/// @param stride_a The distance in elements between consecutive A matrices.
+/// @param ao The offset value for the matrices A.
+/// @param B A pointer to the first B matrix data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param stride_b The distance in elements between consecutive B matrices.
+/// @param bo The offset value for the matrices B.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C A pointer to the first C matrix data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param stride_c The distance in elements between consecutive C matrices.
+/// @param co An array of offset values for the matrices C.
+/// @param batch_size The number of matrix multiplies.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_batch_strided(char transa,
+        char transb, char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        float alpha, const int8_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a,
+        int8_t ao, const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b,
+        int8_t bo, float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c,
+        const int32_t *co, dnnl_dim_t batch_size);
+
+/// Performs a batch of integer matrix-matrix multiplies on 8-bit signed
+/// matrices A, 8-bit signed matrices B, and 32-bit signed resulting matrices
+/// C passed as arrays of pointers.
+///
+/// For every `i` in `[0, batch_size)` the operation is defined as for
+/// dnnl_gemm_s8s8s32() with `A[i]`, `B[i]`, and `C[i]` matrices. Offsets are
+/// shared by all matrices. See dnnl_sgemm_batch_strided() for the
+/// parallelization details.
+///
+/// @param transa Transposition flag for matrices A.
+/// @param transb Transposition flag for matrices B.
+/// @param offsetc Flag specifying how offsets should be applied to matrices C.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A An array of `batch_size` pointers to the A matrices data.
+/// @param lda The leading dimension for the matrices A.
+/// @param ao The offset value for the matrices A.
+/// @param B An array of `batch_size` pointers to the B matrices data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param bo The offset value for the matrices B.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C An array of `batch_size` pointers to the C matrices data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param co An array of offset values for the matrices C.
+/// @param batch_size The number of matrix multiplies.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_batch(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const int8_t *const *A, dnnl_dim_t lda, int8_t ao,
+        const int8_t *const *B, dnnl_dim_t ldb, int8_t bo, float beta,
+        int32_t *const *C, dnnl_dim_t ldc, const int32_t *co,
+        dnnl_dim_t batch_size);
+
 /// @} dnnl_api_blas
 
 /// @} dnnl_api
@@ -28,6 +28,7 @@
 /// @cond DO_NOT_DOCUMENT_THIS
 #include <algorithm>
 #include <cstdlib>
+#include <future>
 #include <iterator>
 #include <memory>
 #include <string>
@@ -88,6 +89,13 @@ struct handle_traits<dnnl_primitive_t> {
     }
 };
 
+template <>
+struct handle_traits<dnnl_stream_capture_t> {
+    static dnnl_status_t destructor(dnnl_stream_capture_t p) {
+        return dnnl_stream_capture_destroy(p);
+    }
+};
+
 /// @endcond
 
 /// @} dnnl_api_utils
@@ -151,6 +159,14 @@ struct primitive : public handle<dnnl_primitive_t> {
         layer_normalization = dnnl_layer_normalization,
         /// A group normalization primitive
         group_normalization = dnnl_group_normalization,
+        /// A split primitive.
+        split = dnnl_split,
+        /// A gather primitive.
+        gather = dnnl_gather,
+        /// A top-k primitive.
+        topk = dnnl_topk,
+        /// An optimizer primitive.
+        optimizer = dnnl_optimizer,
     };
 
     using handle::handle;
@@ -201,6 +217,17 @@ struct primitive : public handle<dnnl_primitive_t> {
     ///     constructor.
     inline std::vector<uint8_t> get_cache_blob() const;
 
+    /// Returns cumulative execution statistics of the primitive.
+    ///
+    /// @sa dnnl_primitive_get_exec_stats() for when executions are counted.
+    ///
+    /// @returns Execution statistics since the primitive creation or the
+    ///     last reset.
+    inline dnnl_primitive_exec_stats_t get_exec_stats() const;
+
+    /// Resets execution statistics of the primitive.
+    inline void reset_exec_stats();
+
     /// Executes computations specified by the primitive in a specified stream.
     ///
     /// Arguments are passed via an arguments map containing <index,
@@ -215,6 +242,29 @@ struct primitive : public handle<dnnl_primitive_t> {
     /// @param args Arguments map.
     void execute(const stream &astream,
             const std::unordered_map<int, memory> &args) const;
+
+    /// Executes the primitive over several independent arguments maps.
+    ///
+    /// The result is the same as calling primitive::execute() for every
+    /// arguments map in order, while on CPU the executions are distributed
+    /// between the threads in a single parallel region.
+    ///
+    /// @param astream Stream object. The stream must belong to the same engine
+    ///     as the primitive.
+    /// @param args Arguments maps. The maps must not share output memory
+    ///     objects.
+    void execute_batch(const stream &astream,
+            const std::vector<std::unordered_map<int, memory>> &args) const;
+
+    /// Hints that the primitive is about to be executed with the given
+    /// arguments, so that its weights are prefetched in the background.
+    ///
+    /// @param astream Stream object. The stream must belong to the same engine
+    ///     as the primitive.
+    /// @param args Arguments map. The memory objects must stay alive until
+    ///     the primitive is executed with them or destroyed.
+    void prefetch(const stream &astream,
+            const std::unordered_map<int, memory> &args) const;
 };
 
 /// Converts primitive kind enum value from C++ API to C API type.
@@ -255,6 +305,18 @@ std::vector<uint8_t> primitive::get_cache_blob() const {
     return cache_blob;
 }
 
+dnnl_primitive_exec_stats_t primitive::get_exec_stats() const {
+    dnnl_primitive_exec_stats_t stats;
+    error::wrap_c_api(dnnl_primitive_get_exec_stats(get(), &stats),
+            "could not get execution statistics from a primitive");
+    return stats;
+}
+
+void primitive::reset_exec_stats() {
+    error::wrap_c_api(dnnl_primitive_reset_exec_stats(get()),
+            "could not reset execution statistics of a primitive");
+}
+
 /// @} dnnl_api_primitives_common
 
 /// @addtogroup dnnl_api_attributes
@@ -433,6 +495,10 @@ enum class algorithm {
     pooling_avg_include_padding = dnnl_pooling_avg_include_padding,
     /// Average pooling exclude padding
     pooling_avg_exclude_padding = dnnl_pooling_avg_exclude_padding,
+    /// Adaptive max pooling
+    pooling_adaptive_max = dnnl_pooling_adaptive_max,
+    /// Adaptive average pooling
+    pooling_adaptive_avg = dnnl_pooling_adaptive_avg,
     /// RNN cell
     vanilla_rnn = dnnl_vanilla_rnn,
     /// LSTM cell
@@ -497,10 +563,26 @@ enum class algorithm {
     reduction_norm_lp_power_p_max = dnnl_reduction_norm_lp_power_p_max,
     /// Reduction using norm_lp_power_p_sum operation
     reduction_norm_lp_power_p_sum = dnnl_reduction_norm_lp_power_p_sum,
+    /// Cubic (Bicubic, Tricubic) resampling method
+    resampling_cubic = dnnl_resampling_cubic,
+    /// Linear resampling method with antialiasing
+    resampling_linear_antialias = dnnl_resampling_linear_antialias,
     /// Softmax, numerically stable
     softmax_accurate = dnnl_softmax_accurate,
     /// LogSoftmax, numerically stable
     softmax_log = dnnl_softmax_log,
+    /// Gather of table rows without reduction
+    gather_none = dnnl_gather_none,
+    /// Gather of table rows with summation over each bag
+    gather_sum = dnnl_gather_sum,
+    /// Gather of table rows with averaging over each bag
+    gather_mean = dnnl_gather_mean,
+    /// Stochastic gradient descent with momentum
+    optimizer_sgd = dnnl_optimizer_sgd,
+    /// Adam
+    optimizer_adam = dnnl_optimizer_adam,
+    /// Adam with decoupled weight decay
+    optimizer_adamw = dnnl_optimizer_adamw,
 };
 
 /// Converts algorithm kind enum value from C++ API to C API type.
@@ -579,6 +661,23 @@ enum class normalization_flags : unsigned {
     ///     When used with #dnnl::normalization_flags::use_global_stats,
     ///     only RMS norm is required to be provided as input.
     rms_norm = dnnl_rms_norm,
+
+    /// Fuse a residual Add in front of layer normalization. On forward
+    /// propagation, the library adds an additional input tensor passed as
+    /// #DNNL_ARG_SRC_1 to the source tensor and normalizes the sum. The
+    /// additional input must have the same memory descriptor as the source.
+    ///
+    /// @note
+    ///     The flag is supported for layer normalization forward propagation
+    ///     only.
+    fuse_residual_add = dnnl_fuse_residual_add,
+
+    /// Save the result of the residual Add. If specified together with
+    /// #dnnl::normalization_flags::fuse_residual_add, the library writes the
+    /// sum of the source and the additional input tensors to an extra output
+    /// tensor passed as #DNNL_ARG_DST_1, which has the same memory descriptor
+    /// as the source.
+    save_residual_sum = dnnl_save_residual_sum,
 };
 
 /// Converts normalization flags enum value from C++ API to C API type.
@@ -599,6 +698,9 @@ enum class rnn_flags : unsigned {
     undef = dnnl_rnn_flags_undef,
     /// Do not add weights gradient to existing diff_weights memory
     diff_weights_overwrite = dnnl_rnn_flags_diff_weights_overwrite,
+    /// Sequences in a batch have individual lengths passed at execution
+    /// time as #DNNL_ARG_SEQ_LENGTHS
+    seq_lengths = dnnl_rnn_flags_seq_lengths,
 };
 
 /// Converts RNN cell flags enum value from C++ API to C API type.
@@ -952,6 +1054,13 @@ struct memory : public handle<dnnl_memory_t> {
         packed = dnnl_packed,
         /// Coordinate Sparse (COO) encoding.
         coo = dnnl_coo,
+        /// Block Compressed Sparse Row (BSR) encoding.
+        bsr = dnnl_bsr,
+        /// An encoding that is used for an opaque storage schema for
+        /// tensors with 2:4 structured sparsity along the reduction
+        /// dimension. The same restrictions as for the packed encoding
+        /// apply.
+        packed_2_4 = dnnl_packed_2_4,
     };
 
     /// Memory format tag specification.
@@ -2926,6 +3035,46 @@ struct memory : public handle<dnnl_memory_t> {
             return desc {md};
         }
 
+        /// Function for creating a memory descriptor for BSR sparse encoding.
+        ///
+        /// The tensor is split in dense blocks of @p block_dims elements and
+        /// only the blocks that contain non-zero values are stored. The
+        /// created memory descriptor will describe a memory object that
+        /// contains 3 buffers. The buffers have the following meaning and
+        /// assigned numbers (index):
+        ///  - 0: values, blocks stored one after another in row-major order
+        ///  - 1: block column indices
+        ///  - 2: block row pointers
+        ///
+        /// @param adims Tensor dimensions.
+        /// @param adata_type Data precision/type.
+        /// @param nnz Number of stored (non-zero) blocks.
+        /// @param block_dims Block dimensions. Each tensor dimension must be
+        ///     divisible by the respective block dimension.
+        /// @param index_dt Data type of indices.
+        /// @param pointer_dt Data type of pointers.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case a
+        ///     zero memory descriptor will be constructed. This flag is
+        ///     optional and defaults to false.
+        /// @sa @ref dev_guide_sparsity
+        static desc bsr(const dims &adims, data_type adata_type, dim nnz,
+                const dims &block_dims, data_type index_dt,
+                data_type pointer_dt, bool allow_empty = false) {
+            validate_dims(adims);
+            validate_dims(block_dims, (int)adims.size());
+            dnnl_memory_desc_t md = nullptr;
+            dnnl_status_t status = dnnl_memory_desc_create_with_bsr_encoding(
+                    &md, (int)adims.size(), adims.data(),
+                    convert_to_c(adata_type), nnz, block_dims.data(),
+                    convert_to_c(index_dt), convert_to_c(pointer_dt));
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a memory descriptor for BSR sparse "
+                        "encoding");
+            return desc {md};
+        }
+
         /// Function for creating a memory descriptor for packed sparse
         /// encoding.
         ///
@@ -2961,6 +3110,40 @@ struct memory : public handle<dnnl_memory_t> {
             return desc {md};
         }
 
+        /// Function for creating a memory descriptor for packed 2:4
+        /// structured sparse encoding.
+        ///
+        /// At most 2 of every 4 consecutive values along the reduction
+        /// dimension can be non-zero. A reorder to this encoding keeps the
+        /// 2 values of the largest magnitude in every group.
+        ///
+        /// The created memory descriptor cannot be used to create a memory
+        /// object. It can only be used to create a primitive descriptor to
+        /// query the actual memory descriptor (similar to the format tag
+        /// `any`).
+        ///
+        /// @param adims Tensor dimensions.
+        /// @param adata_type Data precision/type.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case a
+        ///     zero memory descriptor will be constructed. This flag is
+        ///     optional and defaults to false.
+        /// @sa @ref dev_guide_sparsity
+        static desc packed_2_4(const dims &adims, data_type adata_type,
+                bool allow_empty = false) {
+            validate_dims(adims);
+            dnnl_memory_desc_t md = nullptr;
+            dnnl_status_t status
+                    = dnnl_memory_desc_create_with_packed_2_4_encoding(&md,
+                            (int)adims.size(), adims.data(),
+                            convert_to_c(adata_type));
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a memory descriptor for packed 2:4 "
+                        "sparse encoding");
+            return desc {md};
+        }
+
         /// Construct a memory descriptor from a C API ::dnnl_memory_desc_t
         /// handle. The resulting handle is not weak and the C handle will be
         /// destroyed during the destruction of the C++ object.
@@ -3318,6 +3501,18 @@ struct memory : public handle<dnnl_memory_t> {
         }
     };
 
+    /// Flags for memory objects created from a file mapping. Can be combined
+    /// using the bitwise OR operator.
+    enum class map_flags : unsigned {
+        /// Map the file region without any hints.
+        none = dnnl_memory_map_default,
+        /// Populate the page tables for the mapping at creation time.
+        populate = dnnl_memory_map_populate,
+        /// Advise the operating system that the file region will be accessed
+        /// soon.
+        prefetch = dnnl_memory_map_prefetch,
+    };
+
     /// Default constructor.
     ///
     /// Constructs an empty memory object, which can be used to indicate
@@ -3393,6 +3588,29 @@ struct memory : public handle<dnnl_memory_t> {
         reset(result);
     }
 
+    /// Constructs a memory object backed by a mapping of a file region.
+    ///
+    /// The region of the file that starts at @p offset and has the size of
+    /// @p md is used as the underlying buffer without a copy. The library
+    /// owns the mapping; the file descriptor may be closed once the
+    /// constructor returns. Writes to the memory object are not stored in
+    /// the file.
+    ///
+    /// @param md Memory descriptor.
+    /// @param aengine CPU engine to store the data on.
+    /// @param fd File descriptor opened for reading.
+    /// @param offset Offset of the region in the file, in bytes.
+    /// @param flags Mapping flags.
+    memory(const desc &md, const engine &aengine, int fd, size_t offset,
+            map_flags flags = map_flags::none) {
+        dnnl_memory_t result;
+        dnnl_status_t status = dnnl_memory_create_from_file(&result, md.get(),
+                aengine.get(), fd, offset, static_cast<unsigned>(flags));
+        error::wrap_c_api(
+                status, "could not create a memory object from a file");
+        reset(result);
+    }
+
     /// Returns the associated memory descriptor.
     desc get_desc() const {
         const_dnnl_memory_desc_t cdesc;
@@ -3466,6 +3684,31 @@ struct memory : public handle<dnnl_memory_t> {
         return static_cast<T *>(mapped_ptr);
     }
 
+    /// Maps a range of a memory object buffer and returns a host-side
+    /// pointer to the first byte of the range. Only the range is copied to
+    /// the host and back, and memory the host can access directly is mapped
+    /// without a copy. The mapping is released with
+    /// #dnnl::memory::unmap_data() called on the returned pointer.
+    ///
+    /// @note
+    ///     Any primitives working with the memory should be completed before
+    ///     the memory is mapped. Use #dnnl::stream::wait() to synchronize the
+    ///     corresponding execution stream.
+    ///
+    /// @tparam T Data type to return a pointer to.
+    /// @param offset Offset of the range in the buffer, in bytes.
+    /// @param size Size of the range, in bytes.
+    /// @param index Index of the buffer. Defaults to 0.
+    /// @returns Pointer to the mapped range.
+    template <typename T = void>
+    T *map_data_range(size_t offset, size_t size, int index = 0) const {
+        void *mapped_ptr;
+        error::wrap_c_api(dnnl_memory_map_data_range(
+                                  get(), &mapped_ptr, offset, size, index),
+                "could not map memory object data range");
+        return static_cast<T *>(mapped_ptr);
+    }
+
     /// Unmaps a memory object and writes back any changes made to the
     /// previously mapped memory buffer. The memory buffer corresponds to
     /// the given index.
@@ -3504,6 +3747,8 @@ inline bool operator!=(memory::data_type a, dnnl_data_type_t b) {
     return !(a == b);
 }
 
+DNNL_DEFINE_BITMASK_OPS(memory::map_flags)
+
 inline bool operator==(dnnl_format_tag_t a, memory::format_tag b) {
     return a == memory::convert_to_c(b);
 }
@@ -4030,6 +4275,178 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
                 "could not set deterministic primitive attribute");
     }
 
+    /// Returns the maximum number of threads a primitive may use. Zero means
+    /// that the number of threads is not limited.
+    int get_max_threads() const {
+        int result;
+        error::wrap_c_api(dnnl_primitive_attr_get_max_threads(get(), &result),
+                "could not get max threads primitive attribute");
+        return result;
+    }
+
+    /// Sets the maximum number of threads a primitive may use.
+    ///
+    /// The limit applies to the primitive descriptor creation, which uses it
+    /// to select the work decomposition, and to the primitive execution.
+    ///
+    /// @param nthr Maximum number of threads. Zero means that the number of
+    ///     threads is not limited.
+    void set_max_threads(int nthr) {
+        error::wrap_c_api(dnnl_primitive_attr_set_max_threads(get(), nthr),
+                "could not set max threads primitive attribute");
+    }
+
+    /// Returns the constant quantization attribute value.
+    bool get_constant_quantization() const {
+        int result;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_constant_quantization(get(), &result),
+                "could not get constant quantization primitive attribute");
+        return result;
+    }
+
+    /// Sets the constant quantization attribute value.
+    ///
+    /// @param value Whether the values of the scales, the zero-points and
+    ///     the weights stay the same across executions of the primitive.
+    void set_constant_quantization(bool value) {
+        error::wrap_c_api(dnnl_primitive_attr_set_constant_quantization(
+                                  get(), static_cast<int>(value)),
+                "could not set constant quantization primitive attribute");
+    }
+
+    /// Returns the data type the source tensor is dynamically quantized to.
+    /// #dnnl::memory::data_type::undef means that dynamic quantization of
+    /// the source is disabled.
+    memory::data_type get_src_dynamic_quantization() const {
+        dnnl_data_type_t result;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_src_dynamic_quantization(
+                        get(), &result),
+                "could not get src dynamic quantization primitive "
+                "attribute");
+        return static_cast<memory::data_type>(result);
+    }
+
+    /// Sets dynamic quantization of the source tensor.
+    ///
+    /// The floating-point source is quantized at execution time with one
+    /// symmetric scale per row, computed from the row or given as source
+    /// scales, and the scales are applied to the result before bias and
+    /// post-ops. Only supported by matmul with integer weights.
+    ///
+    /// @param data_type Quantized source data type. Only
+    ///     #dnnl::memory::data_type::s8 is supported.
+    ///     #dnnl::memory::data_type::undef disables the quantization.
+    void set_src_dynamic_quantization(memory::data_type data_type) {
+        error::wrap_c_api(dnnl_primitive_attr_set_src_dynamic_quantization(
+                                  get(), memory::convert_to_c(data_type)),
+                "could not set src dynamic quantization primitive attribute");
+    }
+
+    /// Returns whether the primitive computes the absolute maximum of the
+    /// destination tensor.
+    bool get_dst_amax() const {
+        int result;
+        error::wrap_c_api(dnnl_primitive_attr_get_dst_amax(get(), &result),
+                "could not get dst amax primitive attribute");
+        return result;
+    }
+
+    /// Sets whether the primitive computes the absolute maximum of the
+    /// destination tensor.
+    ///
+    /// The value is written to a single-element f32 tensor passed as
+    /// #DNNL_ARG_ATTR_DST_AMAX. Only supported by matmul.
+    ///
+    /// @param value Whether to compute the absolute maximum.
+    void set_dst_amax(bool value) {
+        error::wrap_c_api(dnnl_primitive_attr_set_dst_amax(get(), value),
+                "could not set dst amax primitive attribute");
+    }
+
+    /// Returns the data type of the secondary destination.
+    memory::data_type get_secondary_dst() const {
+        dnnl_data_type_t result;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_secondary_dst(get(), &result),
+                "could not get secondary dst primitive attribute");
+        return static_cast<memory::data_type>(result);
+    }
+
+    /// Sets the data type of the secondary destination.
+    ///
+    /// The destination quantized with the scale passed as
+    /// #DNNL_ARG_ATTR_SECONDARY_DST_SCALE is additionally written to the
+    /// tensor passed as #DNNL_ARG_ATTR_SECONDARY_DST. Only supported by
+    /// matmul.
+    ///
+    /// @param data_type Data type of the secondary destination:
+    ///     #dnnl::memory::data_type::s8, #dnnl::memory::data_type::u8,
+    ///     #dnnl::memory::data_type::f8_e5m2 or
+    ///     #dnnl::memory::data_type::f8_e4m3.
+    ///     #dnnl::memory::data_type::undef disables it.
+    void set_secondary_dst(memory::data_type data_type) {
+        error::wrap_c_api(dnnl_primitive_attr_set_secondary_dst(
+                                  get(), memory::convert_to_c(data_type)),
+                "could not set secondary dst primitive attribute");
+    }
+
+    /// Returns whether the primitive computes the destination quantization
+    /// parameters.
+    bool get_dst_dynamic_quantization() const {
+        int result;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_dst_dynamic_quantization(
+                        get(), &result),
+                "could not get dst dynamic quantization primitive "
+                "attribute");
+        return result;
+    }
+
+    /// Sets whether the primitive computes the destination quantization
+    /// parameters.
+    ///
+    /// The destination scales and zero points set for #DNNL_ARG_DST are
+    /// computed from the source groups and written to the tensors passed as
+    /// #DNNL_ARG_ATTR_SCALES | #DNNL_ARG_DST and
+    /// #DNNL_ARG_ATTR_ZERO_POINTS | #DNNL_ARG_DST. Only supported by reorder.
+    ///
+    /// @param value Whether to compute the quantization parameters.
+    void set_dst_dynamic_quantization(bool value) {
+        error::wrap_c_api(
+                dnnl_primitive_attr_set_dst_dynamic_quantization(get(), value),
+                "could not set dst dynamic quantization primitive attribute");
+    }
+
+    /// Returns the data type of the activation stash.
+    memory::data_type get_activation_stash() const {
+        dnnl_data_type_t result;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_activation_stash(get(), &result),
+                "could not get activation stash primitive attribute");
+        return static_cast<memory::data_type>(result);
+    }
+
+    /// Sets the data type of the activation stash.
+    ///
+    /// A forward training primitive additionally writes the tensor its
+    /// backward pass depends on, converted to @p data_type, to the
+    /// workspace, and the backward primitive created with the same attribute
+    /// reads it from there. Only supported by the reference CPU eltwise
+    /// implementation for dense memory formats.
+    ///
+    /// @param data_type Data type of the stash:
+    ///     #dnnl::memory::data_type::bf16, #dnnl::memory::data_type::f16,
+    ///     #dnnl::memory::data_type::f8_e5m2 or
+    ///     #dnnl::memory::data_type::f8_e4m3.
+    ///     #dnnl::memory::data_type::undef disables it.
+    void set_activation_stash(memory::data_type data_type) {
+        error::wrap_c_api(dnnl_primitive_attr_set_activation_stash(
+                                  get(), memory::convert_to_c(data_type)),
+                "could not set activation stash primitive attribute");
+    }
+
     /// Returns the rounding mode attribute value
     ///
     /// @param arg Argument for which rounding mode query applies.
@@ -5251,6 +5668,89 @@ struct concat : public primitive {
 
 /// @} dnnl_api_concat
 
+/// @addtogroup dnnl_api_split Split
+///
+/// A primitive to split data by arbitrary dimension. It is the inverse of
+/// the concat primitive.
+///
+/// @sa @ref dev_guide_split in developer guide
+///
+/// @{
+
+/// Tensor split primitive.
+struct split : public primitive {
+    /// Primitive descriptor for a split primitive.
+    struct primitive_desc : public primitive_desc_base {
+        using primitive_desc_base::primitive_desc_base;
+
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a split primitive.
+        ///
+        /// @param aengine Engine to perform the operation on.
+        /// @param src Source memory descriptor.
+        /// @param split_dimension Source tensor will be split over dimension
+        ///     with this index. Note that order of dimensions does not depend
+        ///     on memory format.
+        /// @param dsts Vector of destination memory descriptors. A
+        ///     destination with #dnnl::memory::format_tag::any format is
+        ///     initialized to the view of its part of the source tensor.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, const memory::desc &src,
+                int split_dimension, const std::vector<memory::desc> &dsts,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false) {
+            auto c_dsts = convert_to_c(dsts);
+
+            dnnl_primitive_desc_t result;
+            dnnl_status_t status = dnnl_split_primitive_desc_create(&result,
+                    aengine.get(), src.get(), (int)c_dsts.size(),
+                    split_dimension, c_dsts.data(), attr.get());
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for "
+                        "the split primitive. Run workload with "
+                        "environment variable ONEDNN_VERBOSE=all to get "
+                        "additional diagnostic information.");
+            reset(status == dnnl_success ? result : dnnl_primitive_desc_t());
+        }
+
+        /// Constructs a primitive descriptor for split primitive from a C
+        /// API primitive descriptor which must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for split primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : primitive_desc_base(pd, dnnl::primitive::kind::split) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc(int)const
+        memory::desc dst_desc(int idx = 0) const { return base::dst_desc(idx); }
+    };
+
+    /// Default constructor. Produces an empty object.
+    split() = default;
+
+    /// Constructs a split primitive.
+    /// @param pd Primitive descriptor for split primitive.
+    split(const primitive_desc &pd) : primitive(pd.get()) {}
+
+    /// Constructs a split primitive from a cache blob.
+    /// @param pd Primitive descriptor for split primitive.
+    /// @param cache_blob Cache blob.
+    split(const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd.get(), cache_blob) {}
+};
+
+/// @} dnnl_api_split
+
 /// @addtogroup dnnl_api_sum Sum
 ///
 /// A primitive to sum multiple tensors.
@@ -5396,6 +5896,86 @@ struct primitive_desc : public primitive_desc_base {
     }
 };
 
+/// Creates a primitive asynchronously.
+///
+/// The primitive is created on a library-internal thread and added to the
+/// primitive cache, so that constructing a primitive from an equivalent
+/// primitive descriptor afterwards doesn't wait for code generation.
+///
+/// @note
+///     The engine must outlive the creation.
+///
+/// @param pd Primitive descriptor used to create the primitive.
+/// @returns A future holding the primitive. If the creation fails, the
+///     future holds a dnnl::error exception.
+inline std::future<primitive> create_primitive_async(const primitive_desc &pd) {
+    using promise_t = std::promise<primitive>;
+    std::unique_ptr<promise_t> promise(new promise_t());
+    std::future<primitive> result = promise->get_future();
+
+    auto callback = [](dnnl_primitive_t c_prim, dnnl_status_t status,
+                            void *user_data) {
+        std::unique_ptr<promise_t> p(static_cast<promise_t *>(user_data));
+        if (status == dnnl_success) {
+            p->set_value(primitive(c_prim));
+            return;
+        }
+#if DNNL_ENABLE_EXCEPTIONS
+        p->set_exception(std::make_exception_ptr(
+                error(status, "could not create a primitive")));
+#else
+        p->set_value(primitive());
+#endif
+    };
+    error::wrap_c_api(
+            dnnl_primitive_create_async(pd.get(), callback, promise.get()),
+            "could not submit an asynchronous primitive creation");
+    // The callback owns the promise from now on.
+    promise.release();
+    return result;
+}
+
+/// A recorded sequence of primitive executions.
+///
+/// @sa dnnl_stream_begin_capture()
+struct stream_capture : public handle<dnnl_stream_capture_t> {
+    using handle::handle;
+
+    /// Constructs an empty stream capture. Such an object should not be
+    /// used for anything other than assigning to it.
+    stream_capture() = default;
+
+    /// Starts recording primitive executions submitted to a stream. The
+    /// primitives are executed as usual while being recorded.
+    ///
+    /// @param astream Stream to record. Only CPU streams and in-order
+    ///     NVIDIA GPU streams are supported.
+    static void begin(const stream &astream) {
+        error::wrap_c_api(dnnl_stream_begin_capture(astream.get()),
+                "could not begin a stream capture");
+    }
+
+    /// Stops recording primitive executions submitted to a stream.
+    ///
+    /// @param astream Stream that is being recorded.
+    /// @returns The recorded sequence of primitive executions.
+    static stream_capture end(const stream &astream) {
+        dnnl_stream_capture_t c_capture;
+        error::wrap_c_api(dnnl_stream_end_capture(astream.get(), &c_capture),
+                "could not end a stream capture");
+        return stream_capture(c_capture);
+    }
+
+    /// Executes the recorded sequence of primitive executions. The recorded
+    /// memory objects must stay alive while the capture exists.
+    ///
+    /// @param astream Stream to execute on. Must be the recorded stream.
+    void replay(const stream &astream) const {
+        error::wrap_c_api(dnnl_stream_capture_replay(get(), astream.get()),
+                "could not replay a stream capture");
+    }
+};
+
 /// @} dnnl_api_primitives_common
 
 /// @addtogroup dnnl_api_convolution Convolution
@@ -12870,52 +13450,189 @@ struct matmul : public primitive {
         : primitive(pd, cache_blob) {}
 };
 
-/// @} dnnl_api_matmul
-
-/// @addtogroup dnnl_api_resampling Resampling
-///
-/// A primitive to compute resampling operation on 1D, 2D or 3D data tensor
-/// using Nearest Neighbor, or Linear (Bilinear, Trilinear) interpolation
-/// method.
-///
-/// @sa @ref dev_guide_resampling in developer guide
+/// Grouped matrix multiplication primitive.
 ///
-/// @{
-
-/// Resampling forward propagation.
-struct resampling_forward : public primitive {
-    /// Primitive descriptor for a resampling forward propagation primitive.
+/// Computes a set of independent matrix multiplications that share K and N
+/// but have a variable number of rows each. Rows of all the groups are
+/// stored back to back in the source and destination tensors, and the
+/// boundaries between groups are passed at execution time through the
+/// #DNNL_ARG_GROUP_OFFSETS argument.
+struct grouped_matmul : public primitive {
+    /// Primitive descriptor for a grouped matmul primitive.
     struct primitive_desc : public dnnl::primitive_desc {
         /// Default constructor. Produces an empty object.
         primitive_desc() = default;
 
-        /// Constructs a primitive descriptor for a resampling forward
-        ///     propagation primitive using source and destination memory
-        ///     descriptors.
-        ///
-        /// @note
-        ///     Destination memory descriptor may be initialized with
-        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        /// Constructs a primitive descriptor for a grouped matmul primitive
+        ///     without bias.
         ///
         /// @param aengine Engine to use.
-        /// @param aprop_kind Propagation kind. Possible values are
-        ///     #dnnl::prop_kind::forward_training, and
-        ///     #dnnl::prop_kind::forward_inference.
-        /// @param aalgorithm resampling algorithm kind: either
-        ///     #dnnl::algorithm::resampling_nearest, or
-        ///     #dnnl::algorithm::resampling_linear
-        /// @param src_desc Source memory descriptor.
-        /// @param dst_desc Destination memory descriptor.
+        /// @param src_desc Memory descriptor for source of shape
+        ///     M_total x K.
+        /// @param weights_desc Memory descriptor for weights of shape
+        ///     G x K x N.
+        /// @param dst_desc Memory descriptor for destination of shape
+        ///     M_total x N.
+        /// @param group_offsets_desc Memory descriptor for the s32 group
+        ///     offsets tensor of shape G.
         /// @param attr Primitive attributes to use. Attributes are optional
         ///     and default to empty attributes.
         /// @param allow_empty A flag signifying whether construction is
         ///     allowed to fail without throwing an exception. In this case an
         ///     empty object will be produced. This flag is optional and
         ///     defaults to false.
-        primitive_desc(const engine &aengine, prop_kind aprop_kind,
-                algorithm aalgorithm, const memory::desc &src_desc,
-                const memory::desc &dst_desc,
-                const primitive_attr &attr = default_attr(),
+        primitive_desc(const engine &aengine, const memory::desc &src_desc,
+                const memory::desc &weights_desc, const memory::desc &dst_desc,
+                const memory::desc &group_offsets_desc,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, src_desc, weights_desc, nullptr, dst_desc,
+                    group_offsets_desc, attr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a grouped matmul primitive
+        ///     with bias.
+        ///
+        /// @param aengine Engine to use.
+        /// @param src_desc Memory descriptor for source of shape
+        ///     M_total x K.
+        /// @param weights_desc Memory descriptor for weights of shape
+        ///     G x K x N.
+        /// @param bias_desc Memory descriptor for bias of shape G x N.
+        /// @param dst_desc Memory descriptor for destination of shape
+        ///     M_total x N.
+        /// @param group_offsets_desc Memory descriptor for the s32 group
+        ///     offsets tensor of shape G.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, const memory::desc &src_desc,
+                const memory::desc &weights_desc, const memory::desc &bias_desc,
+                const memory::desc &dst_desc,
+                const memory::desc &group_offsets_desc,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, src_desc, weights_desc, &bias_desc,
+                    dst_desc, group_offsets_desc, attr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a grouped matmul primitive
+        /// from a C API primitive descriptor that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a grouped matmul
+        ///     primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::matmul) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return query_md(query::src_md, 0); }
+
+        /// @copydoc dnnl::primitive_desc_base::weights_desc()const
+        memory::desc weights_desc() const {
+            return query_md(query::weights_md, 0);
+        }
+
+        /// @copydoc dnnl::convolution_forward::primitive_desc::bias_desc()const
+        memory::desc bias_desc() const {
+            return query_md(query::weights_md, 1);
+        }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return query_md(query::dst_md, 0); }
+
+        /// Returns a memory descriptor for the group offsets.
+        /// @returns Memory descriptor for the group offsets.
+        memory::desc group_offsets_desc() const {
+            return query_md(query::exec_arg_md, DNNL_ARG_GROUP_OFFSETS);
+        }
+
+    private:
+        primitive_desc(const engine &aengine, const memory::desc &src_desc,
+                const memory::desc &weights_desc, const memory::desc *bias_desc,
+                const memory::desc &dst_desc,
+                const memory::desc &group_offsets_desc,
+                const primitive_attr &attr, bool allow_empty) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_grouped_matmul_primitive_desc_create(
+                    &pd, aengine.get(), src_desc.get(), weights_desc.get(),
+                    optional_arg(bias_desc), dst_desc.get(),
+                    group_offsets_desc.get(), attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for "
+                        "the grouped matmul primitive. Run workload with "
+                        "environment variable ONEDNN_VERBOSE=all to get "
+                        "additional diagnostic information.");
+            reset(pd);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    grouped_matmul() = default;
+
+    /// Constructs a grouped matmul primitive.
+    /// @param pd Primitive descriptor for a grouped matmul primitive.
+    grouped_matmul(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs a grouped matmul primitive from a cache blob.
+    /// @param pd Primitive descriptor for a grouped matmul primitive.
+    /// @param cache_blob Cache blob.
+    grouped_matmul(
+            const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_matmul
+
+/// @addtogroup dnnl_api_resampling Resampling
+///
+/// A primitive to compute resampling operation on 1D, 2D or 3D data tensor
+/// using Nearest Neighbor, or Linear (Bilinear, Trilinear) interpolation
+/// method.
+///
+/// @sa @ref dev_guide_resampling in developer guide
+///
+/// @{
+
+/// Resampling forward propagation.
+struct resampling_forward : public primitive {
+    /// Primitive descriptor for a resampling forward propagation primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a resampling forward
+        ///     propagation primitive using source and destination memory
+        ///     descriptors.
+        ///
+        /// @note
+        ///     Destination memory descriptor may be initialized with
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::forward_training, and
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param aalgorithm resampling algorithm kind: either
+        ///     #dnnl::algorithm::resampling_nearest,
+        ///     #dnnl::algorithm::resampling_linear,
+        ///     #dnnl::algorithm::resampling_cubic, or
+        ///     #dnnl::algorithm::resampling_linear_antialias
+        /// @param src_desc Source memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, prop_kind aprop_kind,
+                algorithm aalgorithm, const memory::desc &src_desc,
+                const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr(),
                 bool allow_empty = false)
             : primitive_desc(aengine, aprop_kind, aalgorithm, nullptr, src_desc,
                     &dst_desc, attr, allow_empty) {}
@@ -12929,8 +13646,10 @@ struct resampling_forward : public primitive {
         ///     #dnnl::prop_kind::forward_training, and
         ///     #dnnl::prop_kind::forward_inference.
         /// @param aalgorithm resampling algorithm kind: either
-        ///     #dnnl::algorithm::resampling_nearest, or
-        ///     #dnnl::algorithm::resampling_linear
+        ///     #dnnl::algorithm::resampling_nearest,
+        ///     #dnnl::algorithm::resampling_linear,
+        ///     #dnnl::algorithm::resampling_cubic, or
+        ///     #dnnl::algorithm::resampling_linear_antialias
         /// @param factors Vector of scaling factors for spatial dimension.
         /// @param src_desc Source memory descriptor.
         /// @param attr Primitive attributes to use. Attributes are optional
@@ -12959,8 +13678,10 @@ struct resampling_forward : public primitive {
         ///     #dnnl::prop_kind::forward_training, and
         ///     #dnnl::prop_kind::forward_inference.
         /// @param aalgorithm resampling algorithm kind: either
-        ///     #dnnl::algorithm::resampling_nearest, or
-        ///     #dnnl::algorithm::resampling_linear
+        ///     #dnnl::algorithm::resampling_nearest,
+        ///     #dnnl::algorithm::resampling_linear,
+        ///     #dnnl::algorithm::resampling_cubic, or
+        ///     #dnnl::algorithm::resampling_linear_antialias
         /// @param factors Vector of scaling factors for spatial dimension.
         /// @param src_desc Source memory descriptor.
         /// @param dst_desc Destination memory descriptor.
@@ -13198,7 +13919,9 @@ struct pooling_forward : public primitive {
         /// @param aalgorithm Pooling algorithm kind: either
         ///     #dnnl::algorithm::pooling_max,
         ///     #dnnl::algorithm::pooling_avg_include_padding,
-        ///     or #dnnl::algorithm::pooling_avg_exclude_padding.
+        ///     #dnnl::algorithm::pooling_avg_exclude_padding,
+        ///     #dnnl::algorithm::pooling_adaptive_max,
+        ///     or #dnnl::algorithm::pooling_adaptive_avg.
         /// @param src_desc Source memory descriptor.
         /// @param dst_desc Destination memory descriptor.
         /// @param strides Vector of strides for spatial dimension.
@@ -13242,6 +13965,46 @@ struct pooling_forward : public primitive {
             reset(pd);
         }
 
+        /// Constructs a primitive descriptor for an adaptive pooling forward
+        ///     propagation primitive.
+        ///
+        /// The pooling window of each destination point is derived from the
+        /// source and destination spatial sizes.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::forward_training, and
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param aalgorithm Adaptive pooling algorithm kind: either
+        ///     #dnnl::algorithm::pooling_adaptive_max,
+        ///     or #dnnl::algorithm::pooling_adaptive_avg.
+        /// @param src_desc Source memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, prop_kind aprop_kind,
+                algorithm aalgorithm, const memory::desc &src_desc,
+                const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_pooling_forward_primitive_desc_create(
+                    &pd, aengine.get(), dnnl::convert_to_c(aprop_kind),
+                    convert_to_c(aalgorithm), src_desc.get(), dst_desc.get(),
+                    nullptr, nullptr, nullptr, nullptr, nullptr, attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a descriptor for a pooling forward "
+                        "propagation primitive");
+            reset(pd);
+        }
+
         /// Constructs a primitive descriptor for a pooling forward propagation
         /// primitive from a C API primitive descriptor that must have a
         /// matching kind.
@@ -13323,7 +14086,9 @@ struct pooling_backward : public primitive {
         /// @param aalgorithm Pooling algorithm kind: either
         ///     #dnnl::algorithm::pooling_max,
         ///     #dnnl::algorithm::pooling_avg_include_padding,
-        ///     or #dnnl::algorithm::pooling_avg_exclude_padding.
+        ///     #dnnl::algorithm::pooling_avg_exclude_padding,
+        ///     #dnnl::algorithm::pooling_adaptive_max,
+        ///     or #dnnl::algorithm::pooling_adaptive_avg.
         /// @param diff_src_desc Diff source memory descriptor.
         /// @param diff_dst_desc Diff destination memory descriptor.
         /// @param strides Vector of strides for spatial dimension.
@@ -13370,6 +14135,46 @@ struct pooling_backward : public primitive {
             reset(pd);
         }
 
+        /// Constructs a primitive descriptor for an adaptive pooling backward
+        ///     propagation primitive.
+        ///
+        /// The pooling window of each destination point is derived from the
+        /// source and destination spatial sizes.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm Adaptive pooling algorithm kind: either
+        ///     #dnnl::algorithm::pooling_adaptive_max,
+        ///     or #dnnl::algorithm::pooling_adaptive_avg.
+        /// @param diff_src_desc Diff source memory descriptor.
+        /// @param diff_dst_desc Diff destination memory descriptor.
+        /// @param hint_fwd_pd Primitive descriptor for a pooling
+        ///     forward propagation primitive. It is used as a hint for
+        ///     deciding which memory format to use.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &diff_src_desc,
+                const memory::desc &diff_dst_desc,
+                const pooling_forward::primitive_desc &hint_fwd_pd,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_pooling_backward_primitive_desc_create(
+                    &pd, aengine.get(), convert_to_c(aalgorithm),
+                    diff_src_desc.get(), diff_dst_desc.get(), nullptr, nullptr,
+                    nullptr, nullptr, nullptr, hint_fwd_pd.get(), attr.get());
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a descriptor for a pooling backward "
+                        "propagation primitive");
+            reset(pd);
+        }
+
         /// Constructs a primitive descriptor for a pooling backward propagation
         /// primitive from a C API primitive descriptor that must have a
         /// matching kind.
@@ -13713,6 +14518,304 @@ struct reduction : public primitive {
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_gather Gather
+///
+/// A primitive to gather rows of a table by indices, optionally reducing the
+/// rows of each bag with sum or mean (embedding bag).
+///
+/// @sa @ref dev_guide_gather in developer guide
+///
+/// @{
+
+/// Gather.
+struct gather : public primitive {
+    /// Primitive descriptor for a gather primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a gather primitive.
+        ///
+        /// @note
+        ///     Destination memory descriptor may be initialized with
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm Gather algorithm kind. Possible values:
+        ///     #dnnl::algorithm::gather_none, #dnnl::algorithm::gather_sum,
+        ///     #dnnl::algorithm::gather_mean.
+        /// @param src_desc Source (table) memory descriptor.
+        /// @param indices_desc Indices memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &indices_desc,
+                const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_gather_primitive_desc_create(&pd,
+                    aengine.get(), convert_to_c(aalgorithm), src_desc.get(),
+                    indices_desc.get(), dst_desc.get(), attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for "
+                        "the gather primitive. Run workload with "
+                        "environment variable ONEDNN_VERBOSE=all to get "
+                        "additional diagnostic information.");
+            reset(pd);
+        }
+
+        /// Constructs a primitive descriptor for a gather primitive from a C
+        /// API primitive descriptor that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a gather primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::gather) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// Returns an indices memory descriptor.
+        /// @returns Indices memory descriptor.
+        /// @returns A zero memory descriptor if the primitive does not have
+        ///     an indices parameter.
+        memory::desc indices_desc() const { return base::src_desc(1); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_algorithm()const
+        algorithm get_algorithm() const { return base::get_algorithm(); }
+    };
+
+    /// Default constructor. Produces an empty object.
+    gather() = default;
+
+    /// Constructs a gather primitive.
+    /// @param pd Primitive descriptor for a gather primitive.
+    gather(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs a gather primitive from a cache blob.
+    /// @param pd Primitive descriptor for a gather primitive.
+    /// @param cache_blob Cache blob.
+    gather(const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_gather
+
+/// @addtogroup dnnl_api_topk Top-k
+///
+/// A primitive to select the k largest elements along an axis together with
+/// their indices.
+///
+/// @sa @ref dev_guide_topk in developer guide
+///
+/// @{
+
+/// Top-k.
+struct topk : public primitive {
+    /// Primitive descriptor for a top-k primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a top-k primitive.
+        ///
+        /// @note
+        ///     Destination and indices memory descriptors may be initialized
+        ///     with #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aengine Engine to use.
+        /// @param src_desc Source memory descriptor.
+        /// @param dst_desc Destination (values) memory descriptor. Its
+        ///     @p axis dimension defines the number of selected elements.
+        /// @param indices_desc Destination indices memory descriptor.
+        /// @param axis Axis along which the elements are selected.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, const memory::desc &src_desc,
+                const memory::desc &dst_desc, const memory::desc &indices_desc,
+                int axis, const primitive_attr &attr = default_attr(),
+                bool allow_empty = false) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_topk_primitive_desc_create(&pd,
+                    aengine.get(), src_desc.get(), dst_desc.get(),
+                    indices_desc.get(), axis, attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for "
+                        "the top-k primitive. Run workload with "
+                        "environment variable ONEDNN_VERBOSE=all to get "
+                        "additional diagnostic information.");
+            reset(pd);
+        }
+
+        /// Constructs a primitive descriptor for a top-k primitive from a C
+        /// API primitive descriptor that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a top-k primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::topk) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// Returns a destination indices memory descriptor.
+        /// @returns Destination indices memory descriptor.
+        /// @returns A zero memory descriptor if the primitive does not have
+        ///     an indices output.
+        memory::desc indices_desc() const { return base::dst_desc(1); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_axis()const
+        int get_axis() const { return base::get_axis(); }
+    };
+
+    /// Default constructor. Produces an empty object.
+    topk() = default;
+
+    /// Constructs a top-k primitive.
+    /// @param pd Primitive descriptor for a top-k primitive.
+    topk(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs a top-k primitive from a cache blob.
+    /// @param pd Primitive descriptor for a top-k primitive.
+    /// @param cache_blob Cache blob.
+    topk(const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_topk
+
+/// @addtogroup dnnl_api_optimizer Optimizer
+///
+/// A primitive to update parameters with their gradients using stochastic
+/// gradient descent with momentum, Adam, or AdamW.
+///
+/// @sa @ref dev_guide_optimizer in developer guide
+///
+/// @{
+
+/// Optimizer.
+struct optimizer : public primitive {
+    /// Primitive descriptor for an optimizer primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for an optimizer primitive.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm Optimizer algorithm kind. Possible values:
+        ///     #dnnl::algorithm::optimizer_sgd,
+        ///     #dnnl::algorithm::optimizer_adam,
+        ///     #dnnl::algorithm::optimizer_adamw.
+        /// @param grad_desc Gradient memory descriptor.
+        /// @param param_desc Parameters memory descriptor.
+        /// @param master_desc Memory descriptor of the f32 master copy of the
+        ///     parameters. A zero memory descriptor if the parameters are
+        ///     updated directly.
+        /// @param momentum Momentum for SGD or beta1 for the Adam algorithms.
+        /// @param beta2 The exponential decay rate of the second moment.
+        /// @param epsilon Denominator term for the numerical stability.
+        /// @param weight_decay Weight decay factor.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &grad_desc, const memory::desc &param_desc,
+                const memory::desc &master_desc, float momentum, float beta2,
+                float epsilon, float weight_decay,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_optimizer_primitive_desc_create(&pd,
+                    aengine.get(), convert_to_c(aalgorithm), grad_desc.get(),
+                    param_desc.get(), optional_arg(&master_desc), momentum,
+                    beta2, epsilon, weight_decay, attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for "
+                        "the optimizer primitive. Run workload with "
+                        "environment variable ONEDNN_VERBOSE=all to get "
+                        "additional diagnostic information.");
+            reset(pd);
+        }
+
+        /// Constructs a primitive descriptor for an optimizer primitive from
+        /// a C API primitive descriptor that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for an optimizer primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::optimizer) {}
+
+        /// Returns a gradient memory descriptor.
+        /// @returns Gradient memory descriptor.
+        memory::desc grad_desc() const { return base::src_desc(0); }
+
+        /// Returns a parameters memory descriptor.
+        /// @returns Parameters memory descriptor.
+        memory::desc param_desc() const { return base::dst_desc(0); }
+
+        /// Returns a memory descriptor of a moment buffer.
+        /// @param idx Moment index: 0 for the first moment (momentum buffer)
+        ///     and 1 for the second moment.
+        /// @returns Moment memory descriptor.
+        /// @returns A zero memory descriptor if the algorithm does not keep
+        ///     the moment.
+        memory::desc moment_desc(int idx = 0) const {
+            return base::dst_desc(1 + idx);
+        }
+
+        /// Returns a memory descriptor of the f32 master copy of the
+        /// parameters.
+        /// @returns Master weights memory descriptor.
+        /// @returns A zero memory descriptor if the primitive updates the
+        ///     parameters directly.
+        memory::desc master_desc() const { return base::weights_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_algorithm()const
+        algorithm get_algorithm() const { return base::get_algorithm(); }
+    };
+
+    /// Default constructor. Produces an empty object.
+    optimizer() = default;
+
+    /// Constructs an optimizer primitive.
+    /// @param pd Primitive descriptor for an optimizer primitive.
+    optimizer(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs an optimizer primitive from a cache blob.
+    /// @param pd Primitive descriptor for an optimizer primitive.
+    /// @param cache_blob Cache blob.
+    optimizer(const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_optimizer
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_service Service
@@ -13852,6 +14955,11 @@ inline cpu_isa_hints get_cpu_isa_hints() {
     return static_cast<cpu_isa_hints>(dnnl_get_cpu_isa_hints());
 }
 
+/// @copydoc dnnl_set_cpu_affinity()
+inline status set_cpu_affinity(const std::string &policy) {
+    return static_cast<status>(dnnl_set_cpu_affinity(policy.c_str()));
+}
+
 /// @} dnnl_api_service
 
 #ifdef DNNL_EXPERIMENTAL_PROFILING
@@ -13864,6 +14972,9 @@ enum class profiling_data_kind {
     undef = dnnl_profiling_data_kind_undef,
     /// Data kind to query an execution time in nanoseconds.
     time = dnnl_profiling_data_kind_time,
+    /// Data kind to query a sum of the device kernel durations of an
+    /// execution in nanoseconds.
+    kernel_time = dnnl_profiling_data_kind_kernel_time,
 };
 
 /// Resets a profiler's state.
@@ -13933,8 +15044,78 @@ inline void set_primitive_cache_capacity(int capacity) {
             "could not set primitive cache capacity");
 }
 
+/// Creates primitives for a set of primitive descriptors in parallel and puts
+/// them into the primitive cache.
+///
+/// @param pds Primitive descriptors.
+inline void warm_up_primitive_cache(const std::vector<primitive_desc> &pds) {
+    std::vector<const_dnnl_primitive_desc_t> c_pds;
+    c_pds.reserve(pds.size());
+    for (const auto &pd : pds)
+        c_pds.push_back(pd.get());
+    error::wrap_c_api(
+            dnnl_primitive_cache_warm_up((int)c_pds.size(), c_pds.data()),
+            "could not warm up primitive cache");
+}
+
+/// Returns the amount of memory in bytes that primitives held in the
+/// primitive cache may occupy at the same time.
+inline size_t get_primitive_cache_memory_limit() {
+    size_t result = 0;
+    error::wrap_c_api(dnnl_get_primitive_cache_memory_limit(&result),
+            "could not get primitive cache memory limit");
+    return result;
+}
+
+/// @copydoc dnnl_set_primitive_cache_memory_limit(size_t limit)
+inline void set_primitive_cache_memory_limit(size_t limit) {
+    error::wrap_c_api(dnnl_set_primitive_cache_memory_limit(limit),
+            "could not set primitive cache memory limit");
+}
+
 /// @} dnnl_api_primitive_cache
 
+/// @addtogroup dnnl_api_packed_weights_cache Packed Weights Cache
+///
+/// A set of functions that share packed copies of weights between
+/// primitives.
+///
+/// @{
+
+/// Returns the amount of memory in bytes that packed weights held in the
+/// packed weights cache may occupy at the same time.
+inline size_t get_packed_weights_cache_capacity() {
+    size_t result = 0;
+    error::wrap_c_api(dnnl_get_packed_weights_cache_capacity(&result),
+            "could not get packed weights cache capacity");
+    return result;
+}
+
+/// @copydoc dnnl_set_packed_weights_cache_capacity(size_t capacity)
+inline void set_packed_weights_cache_capacity(size_t capacity) {
+    error::wrap_c_api(dnnl_set_packed_weights_cache_capacity(capacity),
+            "could not set packed weights cache capacity");
+}
+
+/// Returns a memory object that holds weights reordered into a given memory
+/// descriptor. Memory objects for the same weights and memory descriptor
+/// share a single buffer, so they must not be modified.
+///
+/// @param packed_desc Memory descriptor of the packed weights.
+/// @param weights Memory object with the weights.
+/// @param astream Stream to execute the reorder of the weights on.
+/// @returns Memory object with the packed weights.
+inline memory get_packed_weights(const memory::desc &packed_desc,
+        const memory &weights, const stream &astream) {
+    dnnl_memory_t result;
+    error::wrap_c_api(dnnl_packed_weights_get_or_create(&result,
+                              packed_desc.get(), weights.get(), astream.get()),
+            "could not get packed weights");
+    return memory(result);
+}
+
+/// @} dnnl_api_packed_weights_cache
+
 /// @addtogroup dnnl_api_blas BLAS functions
 ///
 /// A subset of Basic Linear Algebra (BLAS) functions that perform
@@ -13968,6 +15149,74 @@ inline status gemm_s8s8s32(char transa, char transb, char offsetc, dnnl_dim_t M,
             K, alpha, A, lda, ao, B, ldb, bo, beta, C, ldc, co));
 }
 
+/// @copydoc dnnl_sgemm_batch_strided()
+inline status sgemm_batch_strided(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *A, dnnl_dim_t lda,
+        dnnl_dim_t stride_a, const float *B, dnnl_dim_t ldb,
+        dnnl_dim_t stride_b, float beta, float *C, dnnl_dim_t ldc,
+        dnnl_dim_t stride_c, dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_sgemm_batch_strided(transa, transb, M, N, K,
+            alpha, A, lda, stride_a, B, ldb, stride_b, beta, C, ldc, stride_c,
+            batch_size));
+}
+
+/// @copydoc dnnl_sgemm_batch()
+inline status sgemm_batch(char transa, char transb, dnnl_dim_t M, dnnl_dim_t N,
+        dnnl_dim_t K, float alpha, const float *const *A, dnnl_dim_t lda,
+        const float *const *B, dnnl_dim_t ldb, float beta, float *const *C,
+        dnnl_dim_t ldc, dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_sgemm_batch(transa, transb, M, N, K, alpha,
+            A, lda, B, ldb, beta, C, ldc, batch_size));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_batch_strided()
+inline status gemm_u8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint8_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a, uint8_t ao,
+        const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b, int8_t bo,
+        float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c,
+        const int32_t *co, dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_batch_strided(transa, transb,
+            offsetc, M, N, K, alpha, A, lda, stride_a, ao, B, ldb, stride_b, bo,
+            beta, C, ldc, stride_c, co, batch_size));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_batch()
+inline status gemm_u8s8s32_batch(char transa, char transb, char offsetc,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint8_t *const *A, dnnl_dim_t lda, uint8_t ao,
+        const int8_t *const *B, dnnl_dim_t ldb, int8_t bo, float beta,
+        int32_t *const *C, dnnl_dim_t ldc, const int32_t *co,
+        dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_batch(transa, transb, offsetc,
+            M, N, K, alpha, A, lda, ao, B, ldb, bo, beta, C, ldc, co,
+            batch_size));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_batch_strided()
+inline status gemm_s8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const int8_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a, int8_t ao,
+        const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b, int8_t bo,
+        float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c,
+        const int32_t *co, dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_batch_strided(transa, transb,
+            offsetc, M, N, K, alpha, A, lda, stride_a, ao, B, ldb, stride_b, bo,
+            beta, C, ldc, stride_c, co, batch_size));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_batch()
+inline status gemm_s8s8s32_batch(char transa, char transb, char offsetc,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const int8_t *const *A, dnnl_dim_t lda, int8_t ao,
+        const int8_t *const *B, dnnl_dim_t ldb, int8_t bo, float beta,
+        int32_t *const *C, dnnl_dim_t ldc, const int32_t *co,
+        dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_batch(transa, transb, offsetc,
+            M, N, K, alpha, A, lda, ao, B, ldb, bo, beta, C, ldc, co,
+            batch_size));
+}
+
 /// @} dnnl_api_blas
 
 // implementation section
@@ -14008,6 +15257,37 @@ inline void primitive::execute(const stream &astream,
             "could not execute a primitive");
 }
 
+inline void primitive::execute_batch(const stream &astream,
+        const std::vector<std::unordered_map<int, memory>> &args) const {
+    std::vector<std::vector<dnnl_exec_arg_t>> c_args(args.size());
+    std::vector<const dnnl_exec_arg_t *> c_args_ptrs(args.size());
+    std::vector<int> nargs(args.size());
+    for (size_t i = 0; i < args.size(); i++) {
+        c_args[i].reserve(args[i].size());
+        for (const auto &a : args[i])
+            c_args[i].push_back({a.first, a.second.get(true)});
+        c_args_ptrs[i] = c_args[i].data();
+        nargs[i] = (int)c_args[i].size();
+    }
+
+    error::wrap_c_api(
+            dnnl_primitive_execute_batch(get(), astream.get(),
+                    (int)args.size(), nargs.data(), c_args_ptrs.data()),
+            "could not execute a primitive over a batch of arguments");
+}
+
+inline void primitive::prefetch(const stream &astream,
+        const std::unordered_map<int, memory> &args) const {
+    std::vector<dnnl_exec_arg_t> c_args;
+    c_args.reserve(args.size());
+    for (const auto &a : args)
+        c_args.push_back({a.first, a.second.get(true)});
+
+    error::wrap_c_api(dnnl_primitive_prefetch(get(), astream.get(),
+                              (int)c_args.size(), c_args.data()),
+            "could not prefetch primitive arguments");
+}
+
 /// @endcond
 
 #undef DNNL_DEFINE_BITMASK_OPS
@@ -429,6 +429,59 @@ dnnl_status_t DNNL_API dnnl_graph_partition_compile(
         const dnnl_graph_logical_tensor_t **inputs, size_t out_num,
         const dnnl_graph_logical_tensor_t **outputs, dnnl_engine_t engine);
 
+/// Compiles a partition for a set of sizes of a dynamic dimension. Every
+/// dimension of the input logical tensors equal to #DNNL_GRAPH_UNKNOWN_DIM
+/// is dynamic and is replaced by each of the bucket sizes in turn, producing
+/// one set of kernels per bucket. The shapes of the output logical tensors
+/// are deduced for every bucket. At execution, the compiled partition
+/// dispatches to the kernels of the bucket matching the shapes of the input
+/// tensors, so the inputs are expected to be padded to a bucket size.
+/// Queries of the compiled partition return the logical tensors of the
+/// largest bucket.
+///
+/// @param partition The target partition.
+/// @param compiled_partition Output compiled partition.
+/// @param in_num The number of input logical tensors.
+/// @param inputs A list of input logical tensors.
+/// @param out_num The number of output logical tensors.
+/// @param outputs A list of output logical tensors.
+/// @param num_buckets The number of bucket sizes.
+/// @param buckets A list of positive bucket sizes.
+/// @param engine The target engine of the compilation.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_partition_compile_with_buckets(
+        dnnl_graph_partition_t partition,
+        dnnl_graph_compiled_partition_t compiled_partition, size_t in_num,
+        const dnnl_graph_logical_tensor_t **inputs, size_t out_num,
+        const dnnl_graph_logical_tensor_t **outputs, size_t num_buckets,
+        const dnnl_dim_t *buckets, dnnl_engine_t engine);
+
+/// Compiles a partition like #dnnl_graph_partition_compile() and reuses the
+/// kernels stored in a cache blob of a compiled partition of the same
+/// partition, which saves the time of generating them. Kernels which are not
+/// found in the cache blob, or can't be created from it, are generated as
+/// usual.
+///
+/// @param partition The target partition.
+/// @param compiled_partition Output compiled partition.
+/// @param in_num The number of input logical tensors.
+/// @param inputs A list of input logical tensors.
+/// @param out_num The number of output logical tensors.
+/// @param outputs A list of output logical tensors.
+/// @param engine The target engine of the compilation.
+/// @param size Size of the cache blob in bytes.
+/// @param cache_blob Cache blob of size @p size returned by
+///     #dnnl_graph_compiled_partition_get_cache_blob().
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_partition_compile_from_cache_blob(
+        dnnl_graph_partition_t partition,
+        dnnl_graph_compiled_partition_t compiled_partition, size_t in_num,
+        const dnnl_graph_logical_tensor_t **inputs, size_t out_num,
+        const dnnl_graph_logical_tensor_t **outputs, dnnl_engine_t engine,
+        size_t size, const uint8_t *cache_blob);
+
 /// Returns the number of input logical tensors of a partition.
 ///
 /// @param partition The target partition.
@@ -524,6 +577,55 @@ dnnl_status_t DNNL_API dnnl_graph_compiled_partition_execute(
         const_dnnl_graph_tensor_t *inputs, size_t num_outputs,
         const_dnnl_graph_tensor_t *outputs);
 
+/// Executes a compiled partition on a CPU stream and calls a call-back
+/// function once the execution completes. On the streams created with a
+/// non-blocking threadpool the execution is enqueued and the call returns
+/// immediately, otherwise the call-back is called before the call returns.
+///
+/// The compiled partition, the stream, and the tensors with their buffers
+/// must stay alive until the call-back is called.
+///
+/// @param compiled_partition The handle of target compiled partition.
+/// @param stream The CPU stream used for execution.
+/// @param num_inputs The number of input tensors.
+/// @param inputs A list of input tensors.
+/// @param num_outputs The number of output tensors.
+/// @param outputs A non-empty list of output tensors.
+/// @param callback The call-back function called exactly once with the
+///     status of the execution if the call succeeds.
+/// @param user_data The user data passed to the call-back function.
+/// @returns #dnnl_success if the execution is submitted or a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_graph_compiled_partition_execute_with_callback(
+        const_dnnl_graph_compiled_partition_t compiled_partition,
+        dnnl_stream_t stream, size_t num_inputs,
+        const_dnnl_graph_tensor_t *inputs, size_t num_outputs,
+        const_dnnl_graph_tensor_t *outputs,
+        dnnl_graph_execute_callback_f callback, void *user_data);
+
+/// Computes the constant tensors of a compiled partition and adds them into
+/// the constant tensor cache, so that the first execution doesn't pay for
+/// them. Only the constant input tensors are accessed. Different compiled
+/// partitions can be prepared concurrently from different threads.
+///
+/// @param compiled_partition The handle of target compiled partition.
+/// @param stream The stream used for computation.
+/// @param num_inputs The number of input tensors.
+/// @param inputs A list of input tensors, the same as given on execution.
+/// @param pin If non-zero, the cached constant tensors are kept when the
+///     cache capacity changes, until the compiled partition is destroyed or
+///     the cache is disabled.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+///
+/// @note The call does nothing if the constant tensor cache is disabled, and
+///     for compiled partitions whose constant tensors are computed on the
+///     first execution, like the ones of SYCL and OpenCL runtimes.
+dnnl_status_t DNNL_API dnnl_graph_compiled_partition_prepare_constants(
+        const_dnnl_graph_compiled_partition_t compiled_partition,
+        dnnl_stream_t stream, size_t num_inputs,
+        const_dnnl_graph_tensor_t *inputs, int pin);
+
 /// Destroys a compiled partition.
 ///
 /// @param compiled_partition The compiled partition to be destroyed.
@@ -565,6 +667,24 @@ dnnl_status_t DNNL_API dnnl_graph_compiled_partition_get_inplace_ports(
         size_t *num_inplace_pairs,
         const dnnl_graph_inplace_pair_t **inplace_pairs);
 
+/// Retrieves a cache blob with the kernels of a compiled partition. The blob
+/// can be stored and passed to #dnnl_graph_partition_compile_from_cache_blob()
+/// to compile the same partition faster, for example after an application
+/// restart.
+///
+/// @param compiled_partition The handle of target compiled_partition.
+/// @param size Size of the cache blob in bytes.
+/// @param cache_blob Cache blob of size @p size. If the @p cache_blob is
+///     nullptr then the size of the cache blob is returned in @p size.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+///
+/// @note The cache blob can be empty, as only kernels of some engines, like
+///     the GPU engines with OpenCL runtime, can be stored in cache blobs.
+dnnl_status_t DNNL_API dnnl_graph_compiled_partition_get_cache_blob(
+        const_dnnl_graph_compiled_partition_t compiled_partition, size_t *size,
+        uint8_t *cache_blob);
+
 /// @} dnnl_graph_api_compiled_partition
 
 /// @addtogroup dnnl_graph_api_graph
@@ -718,6 +838,41 @@ dnnl_status_t DNNL_API dnnl_graph_get_compiled_partition_cache_capacity(
 dnnl_status_t DNNL_API dnnl_graph_set_compiled_partition_cache_capacity(
         int capacity);
 
+/// Returns the amount of memory in bytes that compiled partitions held in the
+/// compiled partition cache may occupy at the same time.
+///
+/// @param limit Compiled partition cache memory limit to query. The value of 0
+///     means that only the number of compiled partitions is limited.
+///     Concurrently accessing @p limit is safe.
+/// @returns #dnnl_invalid_arguments if the @p limit value is invalid, and
+///     #dnnl_success on success.
+dnnl_status_t DNNL_API dnnl_graph_get_compiled_partition_cache_memory_limit(
+        size_t *limit);
+
+/// Sets the amount of memory in bytes that compiled partitions held in the
+/// compiled partition cache may occupy at the same time.
+///
+/// The memory of a compiled partition accounts for the generated code and the
+/// scratchpads of the primitives it holds. When the total exceeds @p limit,
+/// the least recently used compiled partitions are evicted. The limit applies
+/// in addition to the compiled partition cache capacity.
+///
+/// @param limit Compiled partition cache memory limit to set. The value of 0
+///     removes the limit. Concurrently modifying @p limit is safe.
+/// @returns #dnnl_success on success.
+dnnl_status_t DNNL_API dnnl_graph_set_compiled_partition_cache_memory_limit(
+        size_t limit);
+
+/// Returns the amount of memory in bytes occupied by the compiled partitions
+/// held in the compiled partition cache.
+///
+/// @param usage Compiled partition cache memory usage to query. Concurrently
+///     accessing @p usage is safe.
+/// @returns #dnnl_invalid_arguments if the @p usage value is invalid, and
+///     #dnnl_success on success.
+dnnl_status_t DNNL_API dnnl_graph_get_compiled_partition_cache_memory_usage(
+        size_t *usage);
+
 /// @} dnnl_graph_api_compiled_partition_cache
 
 /// @addtogroup dnnl_graph_api_constant_tensor_cache
@@ -24,6 +24,7 @@
 #include "oneapi/dnnl/dnnl_common.hpp"
 #include "oneapi/dnnl/dnnl_graph.h"
 
+#include <functional>
 #include <limits>
 #include <memory>
 #include <string>
@@ -730,6 +731,26 @@ public:
         return inplace_options;
     }
 
+    /// Returns a cache blob with the kernels of the compiled partition. The
+    /// blob can be passed to partition::compile() to compile the same
+    /// partition faster, for example after an application restart.
+    ///
+    /// @returns A cache blob, which is empty if none of the kernels can be
+    ///     stored in it.
+    std::vector<uint8_t> get_cache_blob() const {
+        size_t size = 0;
+        error::wrap_c_api(dnnl_graph_compiled_partition_get_cache_blob(
+                                  get(), &size, nullptr),
+                "could not get the cache blob size from a compiled partition");
+
+        std::vector<uint8_t> cache_blob(size);
+        if (size == 0) return cache_blob;
+        error::wrap_c_api(dnnl_graph_compiled_partition_get_cache_blob(
+                                  get(), &size, cache_blob.data()),
+                "could not get the cache blob from a compiled partition");
+        return cache_blob;
+    }
+
     /// Execute a compiled partition.
     ///
     /// @param astream Stream object to run over.
@@ -754,6 +775,71 @@ public:
                         c_outputs.data()),
                 "could not execute the compiled_partition");
     }
+
+    /// Executes a compiled partition on a CPU stream and calls @p callback
+    /// with the status of the execution once it completes. On the streams
+    /// created with a non-blocking threadpool the execution is enqueued and
+    /// the call returns immediately, otherwise @p callback is called before
+    /// the call returns.
+    ///
+    /// The compiled partition, the stream, and the tensors with their
+    /// buffers must stay alive until @p callback is called.
+    ///
+    /// @param astream CPU stream object to run over.
+    /// @param inputs A list of input tensors.
+    /// @param outputs A list of output tensors.
+    /// @param callback The function called exactly once if the call
+    ///     succeeds.
+    void execute(stream &astream, const std::vector<tensor> &inputs,
+            const std::vector<tensor> &outputs,
+            const std::function<void(status)> &callback) const {
+        std::vector<const_dnnl_graph_tensor_t> c_inputs;
+        c_inputs.reserve(inputs.size());
+        for (auto &in : inputs) {
+            c_inputs.push_back(in.get());
+        }
+        std::vector<const_dnnl_graph_tensor_t> c_outputs;
+        c_outputs.reserve(outputs.size());
+        for (auto &out : outputs) {
+            c_outputs.push_back(out.get());
+        }
+
+        auto *user_data = new std::function<void(status)>(callback);
+        const auto c_callback = [](dnnl_status_t s, void *data) {
+            auto *f = static_cast<std::function<void(status)> *>(data);
+            (*f)(static_cast<status>(s));
+            delete f;
+        };
+        const dnnl_status_t s
+                = dnnl_graph_compiled_partition_execute_with_callback(get(),
+                        astream.get(), c_inputs.size(), c_inputs.data(),
+                        c_outputs.size(), c_outputs.data(), c_callback,
+                        user_data);
+        if (s != dnnl_success) delete user_data;
+        error::wrap_c_api(s, "could not execute the compiled_partition");
+    }
+
+    /// Computes the constant tensors of a compiled partition and adds them
+    /// into the constant tensor cache ahead of the first execution.
+    ///
+    /// @param astream Stream object to run over.
+    /// @param inputs A list of input tensors, of which only the constant ones
+    ///     are accessed.
+    /// @param pin Keep the cached constant tensors when the cache capacity
+    ///     changes, until the compiled partition is destroyed.
+    void prepare_constants(stream &astream, const std::vector<tensor> &inputs,
+            bool pin = false) const {
+        std::vector<const_dnnl_graph_tensor_t> c_inputs;
+        c_inputs.reserve(inputs.size());
+        for (auto &in : inputs) {
+            c_inputs.push_back(in.get());
+        }
+
+        error::wrap_c_api(dnnl_graph_compiled_partition_prepare_constants(
+                                  get(), astream.get(), c_inputs.size(),
+                                  c_inputs.data(), pin),
+                "could not prepare constants of the compiled_partition");
+    }
 };
 
 /// @} dnnl_graph_api_compiled_partition
@@ -860,6 +946,10 @@ public:
         Wildcard = dnnl_graph_op_wildcard,
         GenIndex = dnnl_graph_op_gen_index,
         GreaterEqual = dnnl_graph_op_greater_equal,
+        RotaryEmbedding = dnnl_graph_op_rotary_embedding,
+        RMSNorm = dnnl_graph_op_rms_norm,
+        PagedCacheLoad = dnnl_graph_op_paged_cache_load,
+        Gather = dnnl_graph_op_gather,
         // Sentinel
         LastSymbol = dnnl_graph_op_last_symbol,
     };
@@ -1278,6 +1368,101 @@ public:
         return compile_(inputs, outputs, e);
     }
 
+    /// Compiles a partition with given input and output logical tensors and
+    /// reuses the kernels stored in a cache blob returned by
+    /// compiled_partition::get_cache_blob() for the same partition. Kernels
+    /// which are not found in the cache blob are generated as usual.
+    ///
+    /// @param inputs A list of input logical tensors.
+    /// @param outputs A list of output logical tensors.
+    /// @param e The engine used to compile the partition.
+    /// @param cache_blob The cache blob.
+    /// @returns A compiled partition.
+    compiled_partition compile(const std::vector<logical_tensor> &inputs,
+            const std::vector<logical_tensor> &outputs, const engine &e,
+            const std::vector<uint8_t> &cache_blob) const {
+        if (!is_supported()) {
+            error::wrap_c_api(dnnl_invalid_arguments,
+                    "could not compile an unsupported partition");
+        }
+
+        std::vector<const dnnl_graph_logical_tensor_t *> c_inputs;
+        std::vector<const dnnl_graph_logical_tensor_t *> c_outputs;
+
+        c_inputs.reserve(inputs.size());
+        for (const auto &in : inputs) {
+            c_inputs.push_back(&(in.data));
+        }
+
+        c_outputs.reserve(outputs.size());
+        for (const auto &out : outputs) {
+            c_outputs.push_back(&(out.data));
+        }
+
+        dnnl_graph_compiled_partition_t cpartitions = nullptr;
+        error::wrap_c_api(
+                dnnl_graph_compiled_partition_create(&cpartitions, get()),
+                "could not create compiled_partition");
+        error::wrap_c_api(dnnl_graph_partition_compile_from_cache_blob(get(),
+                                  cpartitions, c_inputs.size(), c_inputs.data(),
+                                  c_outputs.size(), c_outputs.data(), e.get(),
+                                  cache_blob.size(), cache_blob.data()),
+                "partition compile from cache blob failed");
+
+        return compiled_partition(cpartitions);
+    }
+
+    /// Compiles a partition for a set of sizes of a dynamic dimension. Every
+    /// dimension of the input logical tensors equal to
+    /// #DNNL_GRAPH_UNKNOWN_DIM is dynamic and is replaced by each of the
+    /// bucket sizes in turn. The returned compiled partition holds the
+    /// kernels of all buckets and, at execution, dispatches to the bucket
+    /// matching the shapes of the input tensors. The inputs are expected to
+    /// be padded to a bucket size. Queries of the compiled partition return
+    /// the logical tensors of the largest bucket.
+    ///
+    /// @param inputs A list of input logical tensors.
+    /// @param outputs A list of output logical tensors.
+    /// @param buckets A list of positive bucket sizes.
+    /// @param e The engine used to compile the partition.
+    /// @returns A compiled partition.
+    compiled_partition compile_with_buckets(
+            const std::vector<logical_tensor> &inputs,
+            const std::vector<logical_tensor> &outputs,
+            const std::vector<logical_tensor::dim> &buckets,
+            const engine &e) const {
+        if (!is_supported()) {
+            error::wrap_c_api(dnnl_invalid_arguments,
+                    "could not compile an unsupported partition");
+        }
+
+        std::vector<const dnnl_graph_logical_tensor_t *> c_inputs;
+        std::vector<const dnnl_graph_logical_tensor_t *> c_outputs;
+
+        c_inputs.reserve(inputs.size());
+        for (const auto &in : inputs) {
+            c_inputs.push_back(&(in.data));
+        }
+
+        c_outputs.reserve(outputs.size());
+        for (const auto &out : outputs) {
+            c_outputs.push_back(&(out.data));
+        }
+
+        dnnl_graph_compiled_partition_t cpartitions = nullptr;
+        error::wrap_c_api(
+                dnnl_graph_compiled_partition_create(&cpartitions, get()),
+                "could not create compiled_partition");
+        error::wrap_c_api(
+                dnnl_graph_partition_compile_with_buckets(get(), cpartitions,
+                        c_inputs.size(), c_inputs.data(), c_outputs.size(),
+                        c_outputs.data(), buckets.size(), buckets.data(),
+                        e.get()),
+                "partition compile with buckets failed");
+
+        return compiled_partition(cpartitions);
+    }
+
     /// Returns the supporting status of a partition. Some operations may not be
     /// supported by the library under certain circumstances. During
     /// partitioning stage, unsupported partitions will be returned to users
@@ -1569,6 +1754,33 @@ inline void set_compiled_partition_cache_capacity(int capacity) {
             "could not set compiled partition cache capacity");
 }
 
+/// Returns the amount of memory in bytes that compiled partitions held in the
+/// compiled partition cache may occupy at the same time.
+inline size_t get_compiled_partition_cache_memory_limit() {
+    size_t result = 0;
+    error::wrap_c_api(
+            dnnl_graph_get_compiled_partition_cache_memory_limit(&result),
+            "could not get compiled partition cache memory limit");
+    return result;
+}
+
+/// @copydoc dnnl_graph_set_compiled_partition_cache_memory_limit(size_t limit)
+inline void set_compiled_partition_cache_memory_limit(size_t limit) {
+    error::wrap_c_api(
+            dnnl_graph_set_compiled_partition_cache_memory_limit(limit),
+            "could not set compiled partition cache memory limit");
+}
+
+/// Returns the amount of memory in bytes occupied by the compiled partitions
+/// held in the compiled partition cache.
+inline size_t get_compiled_partition_cache_memory_usage() {
+    size_t result = 0;
+    error::wrap_c_api(
+            dnnl_graph_get_compiled_partition_cache_memory_usage(&result),
+            "could not get compiled partition cache memory usage");
+    return result;
+}
+
 /// @} dnnl_graph_api_compiled_partition_cache
 
 /// @addtogroup dnnl_graph_api_constant_tensor_cache Constant Tensor Cache
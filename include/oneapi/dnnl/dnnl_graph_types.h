@@ -261,6 +261,10 @@ typedef enum {
     dnnl_graph_op_group_norm,
     dnnl_graph_op_gen_index,
     dnnl_graph_op_greater_equal,
+    dnnl_graph_op_rotary_embedding,
+    dnnl_graph_op_rms_norm,
+    dnnl_graph_op_paged_cache_load,
+    dnnl_graph_op_gather,
     dnnl_graph_op_last_symbol,
 } dnnl_graph_op_kind_t;
 
@@ -453,6 +457,12 @@ typedef struct dnnl_graph_compiled_partition *dnnl_graph_compiled_partition_t;
 typedef const struct dnnl_graph_compiled_partition
         *const_dnnl_graph_compiled_partition_t;
 
+/// Completion call-back function interface for the execution of a compiled
+/// partition. It is called with the status of the execution and the user data
+/// given at submission.
+typedef void (*dnnl_graph_execute_callback_f)(
+        dnnl_status_t status, void *user_data);
+
 /// @} dnnl_graph_api_compiled_partition
 
 /// @addtogroup dnnl_graph_api_tensor
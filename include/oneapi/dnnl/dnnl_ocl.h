@@ -236,6 +236,37 @@ dnnl_status_t DNNL_API dnnl_ocl_interop_stream_create(
 dnnl_status_t DNNL_API dnnl_ocl_interop_stream_get_command_queue(
         dnnl_stream_t stream, cl_command_queue *queue);
 
+/// Starts recording the primitive executions submitted to an execution stream
+/// into an OpenCL command buffer (cl_khr_command_buffer). While recording,
+/// kernels are not executed. A previously recorded command buffer of the
+/// stream is discarded.
+///
+/// @param stream In-order execution stream without profiling enabled.
+/// @returns #dnnl_success on success, #dnnl_unimplemented if the device does
+///     not support command buffers, and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ocl_interop_stream_begin_recording(
+        dnnl_stream_t stream);
+
+/// Finishes recording into the command buffer of an execution stream. The
+/// command buffer is owned by the stream and can be replayed with
+/// #dnnl_ocl_interop_stream_replay().
+///
+/// @param stream Execution stream that is recording.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ocl_interop_stream_end_recording(
+        dnnl_stream_t stream);
+
+/// Submits the recorded command buffer of an execution stream to its OpenCL
+/// command queue. The recorded executions use the memory objects passed at
+/// recording time; their contents may be updated between replays.
+///
+/// @param stream Execution stream with a recorded command buffer.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ocl_interop_stream_replay(dnnl_stream_t stream);
+
 /// Executes computations specified by the primitive in a specified stream and
 /// returns an OpenCL event.
 ///
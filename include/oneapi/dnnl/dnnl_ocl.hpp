@@ -197,6 +197,32 @@ inline cl_command_queue get_command_queue(const stream &astream) {
     return queue;
 }
 
+/// Starts recording the primitive executions submitted to an execution stream
+/// into an OpenCL command buffer. While recording, kernels are not executed.
+///
+/// @param astream An in-order execution stream without profiling enabled.
+inline void begin_recording(stream &astream) {
+    error::wrap_c_api(dnnl_ocl_interop_stream_begin_recording(astream.get()),
+            "could not begin recording a stream");
+}
+
+/// Finishes recording into the command buffer of an execution stream.
+///
+/// @param astream An execution stream that is recording.
+inline void end_recording(stream &astream) {
+    error::wrap_c_api(dnnl_ocl_interop_stream_end_recording(astream.get()),
+            "could not end recording a stream");
+}
+
+/// Submits the recorded command buffer of an execution stream to its OpenCL
+/// queue.
+///
+/// @param astream An execution stream with a recorded command buffer.
+inline void replay(stream &astream) {
+    error::wrap_c_api(dnnl_ocl_interop_stream_replay(astream.get()),
+            "could not replay a stream");
+}
+
 /// Returns the OpenCL memory object associated with the memory object.
 ///
 /// @param amemory A memory object.
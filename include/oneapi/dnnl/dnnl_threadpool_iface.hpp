@@ -61,6 +61,13 @@ struct threadpool_iface {
     /// waiting for the submitted closures to finish execution on its own.
     static constexpr uint64_t ASYNCHRONOUS = 1;
 
+    /// If set, primitive execution on the streams created with this
+    /// threadpool returns as soon as the primitive is enqueued. The
+    /// primitives run in the submission order and dnnl::stream::wait()
+    /// blocks until all of them complete. The primitives and memory objects
+    /// passed for execution must stay alive until then.
+    static constexpr uint64_t NON_BLOCKING = 2;
+
     virtual ~threadpool_iface() = default;
 };
 
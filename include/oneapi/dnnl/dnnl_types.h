@@ -75,6 +75,14 @@ typedef enum {
     dnnl_packed,
     /// Coordinate Sparse Encoding (COO).
     dnnl_coo,
+    /// Block Compressed Sparse Row (BSR) encoding.
+    dnnl_bsr,
+    /// An encoding that is used for an opaque storage schema for tensors
+    /// with 2:4 structured sparsity: every group of 4 consecutive values
+    /// along the reduction dimension holds at most 2 non-zero values. The
+    /// values are stored with a fixed compression ratio of 2. The same
+    /// restrictions as for #dnnl_packed apply.
+    dnnl_packed_2_4,
 } dnnl_sparse_encoding_t;
 
 #ifdef DNNL_EXPERIMENTAL_PROFILING
@@ -84,6 +92,10 @@ typedef enum {
     dnnl_profiling_data_kind_undef = 0,
     /// Data kind to query an execution time in nanoseconds.
     dnnl_profiling_data_kind_time,
+    /// Data kind to query a sum of the device kernel durations of an
+    /// execution in nanoseconds. Unlike #dnnl_profiling_data_kind_time, it
+    /// doesn't include the gaps between the kernels.
+    dnnl_profiling_data_kind_kernel_time,
 
     // Max value to prevent UB for internal-use-only values.
     dnnl_profiling_data_max = 0x7fff,
@@ -2051,6 +2063,14 @@ typedef enum {
     dnnl_layer_normalization,
     /// A group normalization primitive.
     dnnl_group_normalization,
+    /// A split primitive.
+    dnnl_split,
+    /// A gather primitive.
+    dnnl_gather,
+    /// A top-k primitive.
+    dnnl_topk,
+    /// An optimizer primitive.
+    dnnl_optimizer,
 
     // Max value to prevent UB for internal-use-only values.
     dnnl_primitive_kind_max = 0x7fff,
@@ -2134,6 +2154,10 @@ typedef enum {
     dnnl_pooling_avg_include_padding = 0x2ff,
     /// Average pooling exclude padding
     dnnl_pooling_avg_exclude_padding = 0x3ff,
+    /// Adaptive max pooling
+    dnnl_pooling_adaptive_max = 0x4ff,
+    /// Adaptive average pooling
+    dnnl_pooling_adaptive_avg = 0x5ff,
     /// Local response normalization (LRN) across multiple channels
     dnnl_lrn_across_channels = 0xaff,
     /// LRN within a single channel
@@ -2204,10 +2228,26 @@ typedef enum {
     dnnl_reduction_norm_lp_power_p_max,
     /// Reduction using lp norm without final pth-root
     dnnl_reduction_norm_lp_power_p_sum,
+    /// Cubic Resampling Method
+    dnnl_resampling_cubic = 0x2fffb,
+    /// Linear Resampling Method with antialiasing
+    dnnl_resampling_linear_antialias = 0x2fffc,
     /// Softmax
     dnnl_softmax_accurate = 0x30000,
     /// Logsoftmax
     dnnl_softmax_log,
+    /// Gather of table rows without reduction
+    dnnl_gather_none = 0x40000,
+    /// Gather of table rows with summation over each bag
+    dnnl_gather_sum,
+    /// Gather of table rows with averaging over each bag
+    dnnl_gather_mean,
+    /// Stochastic gradient descent with momentum
+    dnnl_optimizer_sgd = 0x50000,
+    /// Adam
+    dnnl_optimizer_adam,
+    /// Adam with decoupled weight decay
+    dnnl_optimizer_adamw,
 } dnnl_alg_kind_t;
 
 /// Flags for normalization primitives.
@@ -2274,6 +2314,22 @@ typedef enum {
     ///     When used with #dnnl_use_global_stats,
     ///     only RMS norm is required to be provided as input.
     dnnl_rms_norm = 0x20U,
+
+    /// Fuse a residual Add in front of layer normalization. On forward
+    /// propagation, the library adds an additional input tensor passed as
+    /// #DNNL_ARG_SRC_1 to the source tensor and normalizes the sum. The
+    /// additional input must have the same memory descriptor as the source.
+    ///
+    /// @note
+    ///     The flag is supported for layer normalization forward propagation
+    ///     only.
+    dnnl_fuse_residual_add = 0x40U,
+
+    /// Save the result of the residual Add. If specified together with
+    /// #dnnl_fuse_residual_add, the library writes the sum of the source and
+    /// the additional input tensors to an extra output tensor passed as
+    /// #DNNL_ARG_DST_1, which has the same memory descriptor as the source.
+    dnnl_save_residual_sum = 0x80U,
 } dnnl_normalization_flags_t;
 
 /// @} dnnl_api_primitives_common
@@ -2331,6 +2387,19 @@ typedef struct dnnl_memory *dnnl_memory_t;
 /// A constant memory handle.
 typedef const struct dnnl_memory *const_dnnl_memory_t;
 
+/// Flags for memory objects created from a file mapping.
+typedef enum {
+    /// Map the file region without any hints.
+    dnnl_memory_map_default = 0x0U,
+    /// Populate the page tables for the mapping at creation time. This reads
+    /// the whole file region ahead of the first access.
+    dnnl_memory_map_populate = 0x1U,
+    /// Advise the operating system that the file region will be accessed
+    /// soon. Unlike #dnnl_memory_map_populate, the read ahead is
+    /// asynchronous.
+    dnnl_memory_map_prefetch = 0x2U,
+} dnnl_memory_map_flags_t;
+
 /// @} dnnl_api_memory
 
 /// @addtogroup dnnl_api_primitives
@@ -2345,6 +2414,10 @@ typedef enum {
     dnnl_rnn_flags_undef = 0x0,
     /// Do not add weights gradient to existing diff_weights memory
     dnnl_rnn_flags_diff_weights_overwrite = 0x1,
+    /// Sequences in a batch have individual lengths passed at execution
+    /// time as #DNNL_ARG_SEQ_LENGTHS. Supported for forward inference with
+    /// #dnnl_unidirectional_left2right direction only.
+    dnnl_rnn_flags_seq_lengths = 0x2,
 } dnnl_rnn_flags_t;
 
 /// A direction of RNN primitive execution.
@@ -2475,6 +2548,40 @@ typedef struct dnnl_primitive *dnnl_primitive_t;
 /// A constant primitive handle.
 typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 
+/// A callback invoked once an asynchronous primitive creation submitted with
+/// #dnnl_primitive_create_async() completes.
+///
+/// @param primitive Created primitive or NULL if the creation failed. The
+///     callee takes the ownership and must destroy it with
+///     #dnnl_primitive_destroy().
+/// @param status Status of the primitive creation.
+/// @param user_data User data passed to #dnnl_primitive_create_async().
+typedef void (*dnnl_primitive_create_callback_t)(
+        dnnl_primitive_t primitive, dnnl_status_t status, void *user_data);
+
+/// Cumulative execution statistics of a primitive.
+typedef struct {
+    /// Number of executions.
+    uint64_t count;
+    /// Total wall time of the executions in nanoseconds. For asynchronous
+    /// streams, only the submission is measured.
+    uint64_t total_ns;
+    /// Maximum wall time of a single execution in nanoseconds.
+    uint64_t max_ns;
+    /// Total size of the memory arguments of the executions in bytes.
+    uint64_t bytes;
+} dnnl_primitive_exec_stats_t;
+
+/// @struct dnnl_stream_capture
+/// An opaque structure to describe a recorded sequence of primitive
+/// executions.
+struct dnnl_stream_capture;
+
+/// A stream capture handle.
+typedef struct dnnl_stream_capture *dnnl_stream_capture_t;
+/// A constant stream capture handle.
+typedef const struct dnnl_stream_capture *const_dnnl_stream_capture_t;
+
 /// Undefined argument.
 #define DNNL_ARG_UNDEF 0
 /// Source argument #0.
@@ -2495,18 +2602,35 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// for #DNNL_ARG_SRC_1.
 #define DNNL_ARG_SRC_ITER DNNL_ARG_SRC_1
 
+/// A special mnemonic for gather indices. An alias for #DNNL_ARG_SRC_1.
+#define DNNL_ARG_INDICES DNNL_ARG_SRC_1
+
+/// A special mnemonic for the optimizer learning rate. An alias for
+/// #DNNL_ARG_SRC_1.
+#define DNNL_ARG_LEARNING_RATE DNNL_ARG_SRC_1
+
 /// Source argument #2.
 #define DNNL_ARG_SRC_2 3
 /// A special mnemonic for RNN input recurrent cell state vector. An alias for
 /// #DNNL_ARG_SRC_2.
 #define DNNL_ARG_SRC_ITER_C DNNL_ARG_SRC_2
 
+/// A special mnemonic for the optimizer step counter. An alias for
+/// #DNNL_ARG_SRC_2.
+#define DNNL_ARG_STEP DNNL_ARG_SRC_2
+
 /// Source argument #3.
 #define DNNL_ARG_SRC_3 4
 /// A special mnemonic for RNN input recurrent cell attention vector. An alias for
 /// #DNNL_ARG_SRC_3.
 #define DNNL_ARG_AUGRU_ATTENTION DNNL_ARG_SRC_3
 
+/// Source argument #4.
+#define DNNL_ARG_SRC_4 5
+/// A special mnemonic for RNN per-batch sequence lengths. An alias for
+/// #DNNL_ARG_SRC_4.
+#define DNNL_ARG_SEQ_LENGTHS DNNL_ARG_SRC_4
+
 /// Destination argument #0.
 #define DNNL_ARG_DST_0 17
 /// A special mnemonic for destination argument for primitives that have a
@@ -2524,12 +2648,24 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// alias for #DNNL_ARG_DST_1.
 #define DNNL_ARG_DST_ITER DNNL_ARG_DST_1
 
+/// A special mnemonic for top-k output indices. An alias for
+/// #DNNL_ARG_DST_1.
+#define DNNL_ARG_DST_INDICES DNNL_ARG_DST_1
+
+/// A special mnemonic for the optimizer first moment (momentum buffer). An
+/// alias for #DNNL_ARG_DST_1.
+#define DNNL_ARG_MOMENT_1 DNNL_ARG_DST_1
+
 /// Destination argument #2.
 #define DNNL_ARG_DST_2 19
 /// A special mnemonic for LSTM output recurrent cell state vector. An
 /// alias for #DNNL_ARG_DST_2.
 #define DNNL_ARG_DST_ITER_C DNNL_ARG_DST_2
 
+/// A special mnemonic for the optimizer second moment. An alias for
+/// #DNNL_ARG_DST_2.
+#define DNNL_ARG_MOMENT_2 DNNL_ARG_DST_2
+
 /// Weights argument #0.
 #define DNNL_ARG_WEIGHTS_0 33
 /// A special mnemonic for primitives that have a single weights
@@ -2539,6 +2675,10 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// alias for #DNNL_ARG_WEIGHTS_0.
 #define DNNL_ARG_WEIGHTS_LAYER DNNL_ARG_WEIGHTS_0
 
+/// A special mnemonic for the optimizer f32 master copy of the parameters.
+/// An alias for #DNNL_ARG_WEIGHTS_0.
+#define DNNL_ARG_MASTER_WEIGHTS DNNL_ARG_WEIGHTS_0
+
 /// Weights argument #1.
 #define DNNL_ARG_WEIGHTS_1 34
 /// A special mnemonic for RNN weights applied to the recurrent input.
@@ -2566,6 +2706,11 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// Note: when adding a new macro after `DNNL_ARG_REDUCE` please reserve a
 /// space for potential indices for `DNNL_ARG_REDUCE`.
 
+/// Group offsets tensor argument of a grouped matmul. A one-dimensional s32
+/// tensor holding, for every group, the cumulative end row of the group in
+/// the source and destination tensors.
+#define DNNL_ARG_GROUP_OFFSETS 46
+
 /// Mean values tensor argument.
 #define DNNL_ARG_MEAN 49
 /// Variance values tensor argument.
@@ -2678,10 +2823,19 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// Dropout RNG seed value passed via a buffer.
 #define DNNL_ARG_ATTR_DROPOUT_SEED 511
 
+/// Absolute maximum of the destination tensor output buffer.
+#define DNNL_ARG_ATTR_DST_AMAX 512
+
 /// Output scaling factors provided at execution time.
 /// Deprecated value.
 #define DNNL_ARG_ATTR_OUTPUT_SCALES 513
 
+/// Secondary destination output buffer.
+#define DNNL_ARG_ATTR_SECONDARY_DST 514
+
+/// Scale of the secondary destination passed via a buffer.
+#define DNNL_ARG_ATTR_SECONDARY_DST_SCALE 515
+
 /// Starting index for source arguments for primitives that take a variable
 /// number of source arguments.
 #define DNNL_ARG_MULTIPLE_SRC 1024
@@ -74,6 +74,18 @@ dnnl_status_t DNNL_API dnnl_ukernel_attr_params_set_A_scales(
 dnnl_status_t DNNL_API dnnl_ukernel_attr_params_set_B_scales(
         dnnl_ukernel_attr_params_t attr_params, const void *b_scales);
 
+/// Sets tensor B zero points argument to a storage.
+///
+/// Used by a transform object with zero points set by
+/// `dnnl_transform_set_zero_points`.
+///
+/// @param attr_params Memory pointers storage object.
+/// @param b_zero_points Pointer to the zero points storage.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_attr_params_set_B_zero_points(
+        dnnl_ukernel_attr_params_t attr_params, const void *b_zero_points);
+
 /// Sets tensor D scales argument to a storage.
 ///
 /// @param attr_params Memory pointers storage object.
@@ -98,7 +110,11 @@ dnnl_status_t DNNL_API dnnl_ukernel_attr_params_destroy(
 /// `C = [A x B]`.
 ///
 /// @param brgemm Output BRGeMM ukernel object.
-/// @param M Dimension M of tensor A.
+/// @param M Dimension M of tensor A. May be #DNNL_RUNTIME_DIM_VAL, in which
+///     case the actual value must be passed to `dnnl_brgemm_execute_with_M`
+///     or `dnnl_brgemm_execute_postops_with_M` and a single generated kernel
+///     serves any M. Runtime M is not supported on AMX and with binary
+///     post-ops.
 /// @param N Dimension N of tensor B.
 /// @param K Dimension K of tensors A and B.
 /// @param batch_size Number of batches to process.
@@ -174,6 +190,22 @@ dnnl_status_t DNNL_API dnnl_brgemm_set_B_scales(
 dnnl_status_t DNNL_API dnnl_brgemm_set_D_scales(
         dnnl_brgemm_t brgemm, int d_scale_mask);
 
+/// Sets software prefetch distances to a BRGeMM ukernel object.
+///
+/// The ukernel prefetches the blocks of tensors A and B it will process the
+/// given number of iterations ahead into the L2 cache. Distances are hints
+/// and are ignored by implementations that don't support software prefetch.
+///
+/// @param brgemm BRGeMM ukernel object.
+/// @param A_distance Prefetch distance for tensor A blocks. A negative value
+///     disables prefetching of tensor A, which is the default.
+/// @param B_distance Prefetch distance for tensor B blocks. A negative value
+///     disables prefetching of tensor B, which is the default.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_brgemm_set_prefetch_distance(
+        dnnl_brgemm_t brgemm, int A_distance, int B_distance);
+
 /// Finalizes initialization of a BRGeMM ukernel object.
 ///
 /// This step is mandatory to query information from the object.
@@ -276,6 +308,49 @@ dnnl_status_t DNNL_API dnnl_brgemm_execute_postops(const_dnnl_brgemm_t brgemm,
         const void *C_ptr, void *D_ptr, void *scratchpad_ptr,
         const_dnnl_ukernel_attr_params_t attr_params);
 
+/// Executes a BRGeMM ukernel object created with #DNNL_RUNTIME_DIM_VAL as M.
+///
+/// @param brgemm BRGeMM ukernel object.
+/// @param M Number of rows of tensors A and C to process.
+/// @param A_ptr Base pointer to a tensor A.
+/// @param B_ptr Base pointer to a tensor B.
+/// @param A_B_offsets Pointer to the set of tensor A and tensor B offsets for
+///     each batch; the set must be contiguous in memory. Single batch should
+///     supply offsets for both tensors A and B simultaneously. The number of
+///     batches must coincide with the `batch_size` value passed at the creation
+///     stage.
+/// @param C_ptr Pointer to a tensor C (accumulation buffer).
+/// @param scratchpad_ptr Pointer to a scratchpad buffer.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_brgemm_execute_with_M(const_dnnl_brgemm_t brgemm,
+        dnnl_dim_t M, const void *A_ptr, const void *B_ptr,
+        const dnnl_dim_t *A_B_offsets, void *C_ptr, void *scratchpad_ptr);
+
+/// Executes a BRGeMM ukernel object created with #DNNL_RUNTIME_DIM_VAL as M
+/// with post operations.
+///
+/// @param brgemm BRGeMM ukernel object.
+/// @param M Number of rows of tensors A, C and D to process.
+/// @param A Base pointer to a tensor A.
+/// @param B Base pointer to a tensor B.
+/// @param A_B_offsets Pointer to a set of tensor A and tensor B offsets for
+///     each batch. A set must be contiguous in memory. A single batch should
+///     supply offsets for both tensors A and B simultaneously. The number of
+///     batches must coincide with the `batch_size` value passed at the creation
+///     stage.
+/// @param C_ptr Pointer to a tensor C (accumulation buffer).
+/// @param D_ptr Pointer to a tensor D (output buffer).
+/// @param scratchpad_ptr Pointer to a scratchpad buffer.
+/// @param attr_params Ukernel attributes memory storage.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_brgemm_execute_postops_with_M(
+        const_dnnl_brgemm_t brgemm, dnnl_dim_t M, const void *A,
+        const void *B, const dnnl_dim_t *A_B_offsets, const void *C_ptr,
+        void *D_ptr, void *scratchpad_ptr,
+        const_dnnl_ukernel_attr_params_t attr_params);
+
 /// Destroys a BRGeMM ukernel object.
 ///
 /// @param brgemm BRGeMM ukernel object to destroy.
@@ -307,6 +382,65 @@ dnnl_status_t DNNL_API dnnl_transform_create(dnnl_transform_t *transform,
         dnnl_dim_t in_ld, dnnl_dim_t out_ld, dnnl_data_type_t in_dt,
         dnnl_data_type_t out_dt);
 
+/// Creates a transform object packing tensor A.
+///
+/// The output is a row-major M x K matrix with the leading dimension equal
+/// to K, which the BRGeMM ukernel reads with `lda = K`. Packing removes the
+/// stride penalties of reading a transposed tensor A, or a tensor A with a
+/// large leading dimension, when the same block is used by several ukernel
+/// calls.
+///
+/// @param transform Output transform object.
+/// @param M Dimension M.
+/// @param K Dimension K.
+/// @param in_pack_type Input packing type. Must be one of
+///     `dnnl_pack_type_no_trans`, or `dnnl_pack_type_trans`.
+/// @param in_ld Input leading dimension.
+/// @param dt Data type of tensor A.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_transform_create_pack_A(
+        dnnl_transform_t *transform, dnnl_dim_t M, dnnl_dim_t K,
+        dnnl_pack_type_t in_pack_type, dnnl_dim_t in_ld,
+        dnnl_data_type_t dt);
+
+/// Sets scales to a transform object. The input is dequantized as
+/// `(in - zero_point) * scale` before it is converted to the output data
+/// type and packed.
+///
+/// Scales are f32 values laid out as a row-major `K / group_K` by `N` (or by
+/// `1`, when the mask doesn't contain the N bit) matrix.
+///
+/// @param transform Transform object.
+/// @param mask Scales mask. Bit `0` stands for dimension K and bit `1`
+///     stands for dimension N.
+/// @param group_K Size of a group of K values sharing a scale. Must divide
+///     K. Ignored when the mask doesn't contain the K bit.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_transform_set_scales(
+        dnnl_transform_t transform, int mask, dnnl_dim_t group_K);
+
+/// Sets zero points to a transform object. The input is dequantized as
+/// `(in - zero_point) * scale` before it is converted to the output data
+/// type and packed.
+///
+/// Zero points are laid out the same way as scales, see
+/// #dnnl_transform_set_scales().
+///
+/// @param transform Transform object.
+/// @param mask Zero points mask. Bit `0` stands for dimension K and bit `1`
+///     stands for dimension N.
+/// @param group_K Size of a group of K values sharing a zero point. Must
+///     divide K. Ignored when the mask doesn't contain the K bit.
+/// @param zp_dt Zero points data type. Must be one of #dnnl_s32, #dnnl_s8,
+///     #dnnl_u8, #dnnl_s4, or #dnnl_u4.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_transform_set_zero_points(
+        dnnl_transform_t transform, int mask, dnnl_dim_t group_K,
+        dnnl_data_type_t zp_dt);
+
 /// Generates an executable part of transform object.
 /// @param transform Transform object.
 /// @returns #dnnl_success on success and a status describing the error
@@ -323,6 +457,19 @@ dnnl_status_t DNNL_API dnnl_transform_generate(dnnl_transform_t transform);
 dnnl_status_t DNNL_API dnnl_transform_execute(
         const_dnnl_transform_t transform, const void *in_ptr, void *out_ptr);
 
+/// Executes a transform object with scales or zero points.
+///
+/// @param transform Transform object.
+/// @param in_ptr Pointer to an input buffer.
+/// @param out_ptr Pointer to an output buffer.
+/// @param attr_params Ukernel attributes memory storage. B scales and B zero
+///     points are taken from it.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_transform_execute_with_params(
+        const_dnnl_transform_t transform, const void *in_ptr, void *out_ptr,
+        const_dnnl_ukernel_attr_params_t attr_params);
+
 /// Destroys a transform object.
 ///
 /// @param transform Transform object.
@@ -332,6 +479,105 @@ dnnl_status_t DNNL_API dnnl_transform_destroy(dnnl_transform_t transform);
 
 /// @} dnnl_api_ukernel_transform
 
+/// @addtogroup dnnl_api_ukernel_gpu_gemm
+/// @{
+
+/// Creates a GPU gemm ukernel object. The ukernel computes a work-group tile
+/// of C = A * B in registers, where A is an M x K matrix, B is a K x N
+/// matrix, and C is an M x N matrix accumulated in f32. The ukernel is
+/// called from a user OpenCL C kernel through the source returned by
+/// #dnnl_gpu_gemm_get_source().
+///
+/// @param gemm Output GPU gemm ukernel object.
+/// @param engine Engine the user kernel is built for. Must be an Intel GPU
+///     engine.
+/// @param name Name of the ukernel. The ukernel function is called
+///     `ugemm_<name>` and all the other symbols of the source are prefixed
+///     with `ugemm_<name>_`.
+/// @param M Dimension M used to select the ukernel configuration.
+/// @param N Dimension N used to select the ukernel configuration.
+/// @param K Dimension K used to select the ukernel configuration.
+/// @param a_dt Data type of A. Must be one of #dnnl_f16, or #dnnl_bf16.
+/// @param b_dt Data type of B. Must be equal to @p a_dt.
+/// @param a_pack_type Layout of A. Must be one of `dnnl_pack_type_no_trans`,
+///     or `dnnl_pack_type_trans`.
+/// @param b_pack_type Layout of B. Must be one of `dnnl_pack_type_no_trans`,
+///     or `dnnl_pack_type_trans`.
+/// @param lda Leading dimension of A, used to derive its alignment.
+/// @param ldb Leading dimension of B, used to derive its alignment.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_gpu_gemm_create(dnnl_gpu_gemm_t *gemm,
+        dnnl_engine_t engine, const char *name, dnnl_dim_t M, dnnl_dim_t N,
+        dnnl_dim_t K, dnnl_data_type_t a_dt, dnnl_data_type_t b_dt,
+        dnnl_pack_type_t a_pack_type, dnnl_pack_type_t b_pack_type,
+        dnnl_dim_t lda, dnnl_dim_t ldb);
+
+/// Returns the OpenCL C source of a GPU gemm ukernel object. The source
+/// declares the ukernel function and its tile types and must be included
+/// into the user kernel source. The string is owned by the object.
+///
+/// @param gemm GPU gemm ukernel object.
+/// @param source Output source.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_gpu_gemm_get_source(
+        const_dnnl_gpu_gemm_t gemm, const char **source);
+
+/// Returns the build options the user kernel must be compiled with. The
+/// string is owned by the object.
+///
+/// @param gemm GPU gemm ukernel object.
+/// @param options Output build options.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_gpu_gemm_get_build_options(
+        const_dnnl_gpu_gemm_t gemm, const char **options);
+
+/// Returns the tile of C computed by a work-group and the work-group shape
+/// in sub-groups. The local work size of the user kernel must be
+/// `{sg_size * sg_per_wg_m, sg_per_wg_n, 1}`.
+///
+/// @param gemm GPU gemm ukernel object.
+/// @param wg_tile_m Output number of rows of the work-group tile.
+/// @param wg_tile_n Output number of columns of the work-group tile.
+/// @param sg_size Output sub-group size.
+/// @param sg_per_wg_m Output number of sub-groups along M.
+/// @param sg_per_wg_n Output number of sub-groups along N.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_gpu_gemm_get_work_group_info(
+        const_dnnl_gpu_gemm_t gemm, dnnl_dim_t *wg_tile_m,
+        dnnl_dim_t *wg_tile_n, int *sg_size, int *sg_per_wg_m,
+        int *sg_per_wg_n);
+
+/// Fuses the ukernel machine code into the binary of a user program built
+/// from a source including the ukernel source. The caller queries the size
+/// of the fused binary by passing NULL as @p fused, then calls the function
+/// again with a buffer of that size. The fused binary is loaded with
+/// `clCreateProgramWithBinary()`.
+///
+/// @param gemm GPU gemm ukernel object.
+/// @param binary User program binary.
+/// @param binary_size Size of the user program binary in bytes.
+/// @param fused Output fused binary. May be NULL.
+/// @param fused_size Input size of @p fused in bytes, and output size of the
+///     fused binary in bytes.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_gpu_gemm_fuse(const_dnnl_gpu_gemm_t gemm,
+        const uint8_t *binary, size_t binary_size, uint8_t *fused,
+        size_t *fused_size);
+
+/// Destroys a GPU gemm ukernel object.
+///
+/// @param gemm GPU gemm ukernel object.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_gpu_gemm_destroy(dnnl_gpu_gemm_t gemm);
+
+/// @} dnnl_api_ukernel_gpu_gemm
+
 #endif
 
 /// @} dnnl_api_ukernel
@@ -51,6 +51,13 @@ struct handle_traits<dnnl_transform_t> {
     }
 };
 
+template <>
+struct handle_traits<dnnl_gpu_gemm_t> {
+    static dnnl_status_t destructor(dnnl_gpu_gemm_t p) {
+        return dnnl_gpu_gemm_destroy(p);
+    }
+};
+
 template <>
 struct handle_traits<dnnl_ukernel_attr_params_t> {
     static dnnl_status_t destructor(dnnl_ukernel_attr_params_t p) {
@@ -135,6 +142,19 @@ struct attr_params : public handle<dnnl_ukernel_attr_params_t> {
             error::wrap_c_api(status, "could not set B scales argument");
     }
 
+    /// Sets tensor B zero points arguments to a storage.
+    ///
+    /// Used by a transform object with zero points set by
+    /// @ref transform::set_zero_points.
+    ///
+    /// @param b_zero_points Pointer to zero points storage.
+    void set_B_zero_points(const void *b_zero_points) {
+        dnnl_status_t status = dnnl_ukernel_attr_params_set_B_zero_points(
+                get(), b_zero_points);
+        if (status != dnnl_success)
+            error::wrap_c_api(status, "could not set B zero points argument");
+    }
+
     /// Sets tensor D scales arguments to a storage.
     ///
     /// @param d_scales Pointer to scales storage.
@@ -159,7 +179,8 @@ struct brgemm : public handle<dnnl_brgemm_t> {
     /// Constructs a BRGeMM ukernel object. Operates by the following formula:
     /// `C = [A x B]`.
     ///
-    /// @param M Dimension M of tensor A.
+    /// @param M Dimension M of tensor A. May be #DNNL_RUNTIME_DIM_VAL, in
+    ///     which case the actual value is passed to `execute()`.
     /// @param N Dimension N of tensor B.
     /// @param K Dimension K of tensors A and B.
     /// @param batch_size Number of batches to process.
@@ -257,6 +278,24 @@ struct brgemm : public handle<dnnl_brgemm_t> {
             error::wrap_c_api(status, "could not set D scales");
     }
 
+    /// Sets software prefetch distances to a BRGeMM ukernel object.
+    ///
+    /// The ukernel prefetches the blocks of tensors A and B it will process
+    /// the given number of iterations ahead into the L2 cache. Distances are
+    /// hints and are ignored by implementations that don't support software
+    /// prefetch.
+    ///
+    /// @param A_distance Prefetch distance for tensor A blocks. A negative
+    ///     value disables prefetching of tensor A.
+    /// @param B_distance Prefetch distance for tensor B blocks. A negative
+    ///     value disables prefetching of tensor B.
+    void set_prefetch_distance(int A_distance, int B_distance) {
+        dnnl_status_t status = dnnl_brgemm_set_prefetch_distance(
+                get(), A_distance, B_distance);
+        if (status != dnnl_success)
+            error::wrap_c_api(status, "could not set prefetch distance");
+    }
+
     /// Finalizes initialization of a BRGeMM ukernel object.
     ///
     /// This step must be performed prior to querying information from the
@@ -381,6 +420,53 @@ struct brgemm : public handle<dnnl_brgemm_t> {
                     status, "could not execute a BRGeMM ukernel object");
     }
 
+    /// Executes a BRGeMM ukernel object created with #DNNL_RUNTIME_DIM_VAL as
+    /// M.
+    ///
+    /// @param M Number of rows of tensors A and C to process.
+    /// @param A Base pointer to a tensor A.
+    /// @param B Base pointer to a tensor B.
+    /// @param A_B_offsets Vector of pairs of tensors A and B offsets for
+    ///     each batch. The number of batches must coincide with the
+    ///     `batch_size` value passed at object construction stage.
+    /// @param C Pointer to a tensor C (accumulation buffer).
+    /// @param scratchpad Pointer to a scratchpad buffer.
+    void execute(memory::dim M, const void *A, const void *B,
+            const std::vector<std::pair<memory::dim, memory::dim>> &A_B_offsets,
+            void *C, void *scratchpad) const {
+        dnnl_status_t status = dnnl_brgemm_execute_with_M(get(), M, A, B,
+                (const dnnl_dim_t *)A_B_offsets.data(), C, scratchpad);
+        if (status != dnnl_success)
+            error::wrap_c_api(
+                    status, "could not execute a BRGeMM ukernel object");
+    }
+
+    /// Executes a BRGeMM ukernel object created with #DNNL_RUNTIME_DIM_VAL as
+    /// M with post operations.
+    ///
+    /// @param M Number of rows of tensors A, C and D to process.
+    /// @param A Base pointer to a tensor A.
+    /// @param B Base pointer to a tensor B.
+    /// @param A_B_offsets Vector of pairs of tensors A and B offsets for
+    ///     each batch. The number of batches must coincide with the
+    ///     `batch_size` value passed at object construction stage.
+    /// @param C Pointer to a tensor C (accumulation buffer).
+    /// @param D Pointer to a tensor D (output buffer).
+    /// @param scratchpad Pointer to a scratchpad buffer.
+    /// @param params Post-op memory arguments. Must be passed If binary
+    ///     post-op or scales were set.
+    void execute(memory::dim M, const void *A, const void *B,
+            const std::vector<std::pair<memory::dim, memory::dim>> &A_B_offsets,
+            const void *C, void *D, void *scratchpad,
+            const attr_params &params = default_attr_params()) const {
+        dnnl_status_t status = dnnl_brgemm_execute_postops_with_M(get(), M, A,
+                B, (const dnnl_dim_t *)A_B_offsets.data(), C, D, scratchpad,
+                params.get());
+        if (status != dnnl_success)
+            error::wrap_c_api(
+                    status, "could not execute a BRGeMM ukernel object");
+    }
+
     /// Returns a constant reference to a static instance of default constructed
     /// primitive post-operations attribute.
     static const post_ops &default_post_ops() {
@@ -436,6 +522,67 @@ struct transform : public handle<dnnl_transform_t> {
         reset(transform);
     }
 
+    /// Constructs a transform object packing tensor A.
+    ///
+    /// The output is a row-major M x K matrix with the leading dimension
+    /// equal to K, which the BRGeMM ukernel reads with `lda = K`.
+    ///
+    /// @param M Dimension M.
+    /// @param K Dimension K.
+    /// @param in_pack_type Input packing type. Must be one of
+    ///     `pack_type::no_trans`, or `pack_type::trans`.
+    /// @param in_ld Input leading dimension.
+    /// @param dt Data type of tensor A.
+    /// @param allow_empty A flag signifying whether construction is
+    ///     allowed to fail without throwing an exception. In this case an
+    ///     empty object will be produced. This flag is optional and
+    ///     defaults to false.
+    /// @returns A transform object.
+    static transform pack_A(memory::dim M, memory::dim K,
+            pack_type in_pack_type, memory::dim in_ld, memory::data_type dt,
+            bool allow_empty = false) {
+        dnnl_transform_t c_transform = nullptr;
+        dnnl_status_t status = dnnl_transform_create_pack_A(&c_transform, M,
+                K, static_cast<dnnl_pack_type_t>(in_pack_type), in_ld,
+                memory::convert_to_c(dt));
+
+        if (!allow_empty)
+            error::wrap_c_api(status,
+                    "could not create a BRGeMM ukernel packing A object");
+        transform t;
+        t.reset(c_transform);
+        return t;
+    }
+
+    /// Sets scales to a transform object. The input is dequantized as
+    /// `(in - zero_point) * scale` before it is converted to the output data
+    /// type and packed.
+    ///
+    /// @param mask Scales mask. Bit `0` stands for dimension K and bit `1`
+    ///     stands for dimension N.
+    /// @param group_K Size of a group of K values sharing a scale. Must
+    ///     divide K. Ignored when the mask doesn't contain the K bit.
+    void set_scales(int mask, memory::dim group_K = 1) {
+        dnnl_status_t status = dnnl_transform_set_scales(get(), mask, group_K);
+        if (status != dnnl_success)
+            error::wrap_c_api(status, "could not set transform scales");
+    }
+
+    /// Sets zero points to a transform object.
+    ///
+    /// @param mask Zero points mask. Bit `0` stands for dimension K and bit
+    ///     `1` stands for dimension N.
+    /// @param group_K Size of a group of K values sharing a zero point. Must
+    ///     divide K. Ignored when the mask doesn't contain the K bit.
+    /// @param zp_dt Zero points data type.
+    void set_zero_points(int mask, memory::dim group_K = 1,
+            memory::data_type zp_dt = memory::data_type::s32) {
+        dnnl_status_t status = dnnl_transform_set_zero_points(
+                get(), mask, group_K, memory::convert_to_c(zp_dt));
+        if (status != dnnl_success)
+            error::wrap_c_api(status, "could not set transform zero points");
+    }
+
     /// Generates an executable part of transform object.
     void generate() {
         dnnl_status_t status = dnnl_transform_generate(get());
@@ -454,10 +601,141 @@ struct transform : public handle<dnnl_transform_t> {
             error::wrap_c_api(status,
                     "could not execute a BRGeMM ukernel packing B object");
     }
+
+    /// Executes a transform object with scales or zero points.
+    ///
+    /// @param in Pointer to an input buffer.
+    /// @param out Pointer to an output buffer.
+    /// @param params Ukernel attributes memory storage with B scales and B
+    ///     zero points.
+    void execute(const void *in, void *out, const attr_params &params) const {
+        dnnl_status_t status = dnnl_transform_execute_with_params(
+                get(), in, out, params.get());
+        if (status != dnnl_success)
+            error::wrap_c_api(status,
+                    "could not execute a BRGeMM ukernel packing B object");
+    }
 };
 
 /// @} dnnl_api_ukernel_transform
 
+/// @addtogroup dnnl_api_ukernel_gpu_gemm GPU gemm ukernel
+/// GPU gemm ukernel to be called from user OpenCL C kernels.
+/// @{
+
+/// GPU gemm ukernel. The ukernel computes a work-group tile of
+/// C = A * B in registers of the sub-groups of a user kernel.
+struct gpu_gemm : public handle<dnnl_gpu_gemm_t> {
+    /// Default constructor. Produces an empty object.
+    gpu_gemm() = default;
+
+    /// Constructs a GPU gemm ukernel object.
+    ///
+    /// @param aengine Engine the user kernel is built for. Must be an Intel
+    ///     GPU engine.
+    /// @param name Name of the ukernel. The ukernel function is called
+    ///     `ugemm_<name>`.
+    /// @param M Dimension M used to select the ukernel configuration.
+    /// @param N Dimension N used to select the ukernel configuration.
+    /// @param K Dimension K used to select the ukernel configuration.
+    /// @param a_dt Data type of A.
+    /// @param b_dt Data type of B.
+    /// @param a_pack_type Layout of A. Must be one of `pack_type::no_trans`,
+    ///     or `pack_type::trans`.
+    /// @param b_pack_type Layout of B. Must be one of `pack_type::no_trans`,
+    ///     or `pack_type::trans`.
+    /// @param lda Leading dimension of A.
+    /// @param ldb Leading dimension of B.
+    /// @param allow_empty A flag signifying whether construction is
+    ///     allowed to fail without throwing an exception. In this case an
+    ///     empty object will be produced. This flag is optional and
+    ///     defaults to false.
+    gpu_gemm(const engine &aengine, const std::string &name, memory::dim M,
+            memory::dim N, memory::dim K, memory::data_type a_dt,
+            memory::data_type b_dt, pack_type a_pack_type,
+            pack_type b_pack_type, memory::dim lda, memory::dim ldb,
+            bool allow_empty = false) {
+        dnnl_gpu_gemm_t gemm = nullptr;
+        dnnl_status_t status = dnnl_gpu_gemm_create(&gemm, aengine.get(),
+                name.c_str(), M, N, K, memory::convert_to_c(a_dt),
+                memory::convert_to_c(b_dt),
+                static_cast<dnnl_pack_type_t>(a_pack_type),
+                static_cast<dnnl_pack_type_t>(b_pack_type), lda, ldb);
+
+        if (!allow_empty)
+            error::wrap_c_api(
+                    status, "could not create a GPU gemm ukernel object");
+        reset(gemm);
+    }
+
+    /// Returns the OpenCL C source to include into the user kernel source.
+    std::string get_source() const {
+        const char *source = nullptr;
+        error::wrap_c_api(dnnl_gpu_gemm_get_source(get(), &source),
+                "could not query a source from a GPU gemm ukernel object");
+        return std::string(source);
+    }
+
+    /// Returns the build options the user kernel must be compiled with.
+    std::string get_build_options() const {
+        const char *options = nullptr;
+        error::wrap_c_api(dnnl_gpu_gemm_get_build_options(get(), &options),
+                "could not query build options from a GPU gemm ukernel "
+                "object");
+        return std::string(options);
+    }
+
+    /// Returns the number of rows of C computed by a work-group.
+    memory::dim get_wg_tile_m() const { return wg_info().wg_tile_m; }
+
+    /// Returns the number of columns of C computed by a work-group.
+    memory::dim get_wg_tile_n() const { return wg_info().wg_tile_n; }
+
+    /// Returns the sub-group size of the user kernel.
+    int get_sg_size() const { return wg_info().sg_size; }
+
+    /// Returns the number of sub-groups of a work-group along M.
+    int get_sg_per_wg_m() const { return wg_info().sg_per_wg_m; }
+
+    /// Returns the number of sub-groups of a work-group along N.
+    int get_sg_per_wg_n() const { return wg_info().sg_per_wg_n; }
+
+    /// Fuses the ukernel machine code into the binary of a user program.
+    ///
+    /// @param binary User program binary.
+    /// @returns The fused binary to load with `clCreateProgramWithBinary()`.
+    std::vector<uint8_t> fuse(const std::vector<uint8_t> &binary) const {
+        size_t size = 0;
+        error::wrap_c_api(dnnl_gpu_gemm_fuse(get(), binary.data(),
+                                  binary.size(), nullptr, &size),
+                "could not fuse a GPU gemm ukernel object");
+        std::vector<uint8_t> fused(size);
+        error::wrap_c_api(dnnl_gpu_gemm_fuse(get(), binary.data(),
+                                  binary.size(), fused.data(), &size),
+                "could not fuse a GPU gemm ukernel object");
+        return fused;
+    }
+
+private:
+    struct wg_info_t {
+        memory::dim wg_tile_m, wg_tile_n;
+        int sg_size, sg_per_wg_m, sg_per_wg_n;
+    };
+
+    wg_info_t wg_info() const {
+        wg_info_t info {};
+        error::wrap_c_api(
+                dnnl_gpu_gemm_get_work_group_info(get(), &info.wg_tile_m,
+                        &info.wg_tile_n, &info.sg_size, &info.sg_per_wg_m,
+                        &info.sg_per_wg_n),
+                "could not query work-group information from a GPU gemm "
+                "ukernel object");
+        return info;
+    }
+};
+
+/// @} dnnl_api_ukernel_gpu_gemm
+
 #endif
 
 } // namespace ukernel
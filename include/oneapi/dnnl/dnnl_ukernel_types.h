@@ -85,6 +85,21 @@ typedef struct dnnl_transform *dnnl_transform_t;
 typedef const struct dnnl_transform *const_dnnl_transform_t;
 
 /// @} dnnl_api_ukernel_transform
+
+/// @addtogroup dnnl_api_ukernel_gpu_gemm
+/// @{
+
+/// @struct dnnl_gpu_gemm
+/// An opaque structure to describe a GPU gemm ukernel.
+struct dnnl_gpu_gemm;
+
+/// A GPU gemm ukernel handle.
+typedef struct dnnl_gpu_gemm *dnnl_gpu_gemm_t;
+
+/// A constant GPU gemm ukernel handle.
+typedef const struct dnnl_gpu_gemm *const_dnnl_gpu_gemm_t;
+
+/// @} dnnl_api_ukernel_gpu_gemm
 #endif
 
 /// @} dnnl_api_ukernel
@@ -0,0 +1,226 @@
+#! /bin/python3
+################################################################################
+# Copyright 2025 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+# Runs a mix of benchdnn problems concurrently in several instances pinned to
+# disjoint core subsets to mimic multi-tenant serving. Every instance cycles
+# through the mix starting at a different problem, and keeps running until all
+# instances completed the requested number of rounds, so measurements are
+# always taken under the load of the other instances. Reports per-problem and
+# per-instance latency, aggregate throughput, and, optionally, slowdown
+# against a solo run to expose interference on shared resources such as the
+# last level cache, memory bandwidth or matrix engines.
+
+import argparse
+import os
+import re
+import subprocess
+import threading
+
+PERF_RE = re.compile(
+    r"^multi_instance,([0-9.eE+-]+),([0-9.eE+-]+),([0-9.eE+-]+),"
+    r"([0-9.eE+-]+)$"
+)
+PERF_TEMPLATE = "multi_instance,%ops%,%-time%,%0time%,%p99time%"
+
+
+def log(output):
+    print("multi_instance: " + output)
+
+
+def error(output):
+    print("multi_instance: error: " + output)
+    exit(1)
+
+
+def split_cores(cores, n_instances, cores_per_instance):
+    if cores_per_instance is None:
+        cores_per_instance = len(cores) // n_instances
+    if cores_per_instance == 0 or cores_per_instance * n_instances > len(cores):
+        error(
+            f"{len(cores)} cores can't be split into {n_instances} instances"
+        )
+    return [
+        cores[i * cores_per_instance : (i + 1) * cores_per_instance]
+        for i in range(n_instances)
+    ]
+
+
+def run_benchdnn(args, problem, cores):
+    env = dict(os.environ)
+    env["OMP_NUM_THREADS"] = str(len(cores))
+    cmd = [args.benchdnn, "--mode=P", f"--perf-template={PERF_TEMPLATE}"]
+    cmd += problem.split()
+    result = subprocess.run(
+        cmd,
+        env=env,
+        stdout=subprocess.PIPE,
+        universal_newlines=True,
+        preexec_fn=lambda: os.sched_setaffinity(0, cores),
+    )
+    if result.returncode != 0:
+        return None
+    for line in result.stdout.splitlines():
+        m = PERF_RE.match(line)
+        if m:
+            ops, min_ms, avg_ms, p99_ms = map(float, m.groups())
+            return {"ops": ops, "min": min_ms, "avg": avg_ms, "p99": p99_ms}
+    return None
+
+
+class Instance:
+    def __init__(self, idx, cores, problems):
+        self.idx = idx
+        self.cores = cores
+        # Each instance starts at a different problem to mix them.
+        shift = idx % len(problems)
+        self.order = list(range(len(problems)))[shift:]
+        self.order += list(range(len(problems)))[:shift]
+        self.results = {}
+        self.rounds_done = 0
+
+
+def run_instance(args, problems, inst, all_done, n_done, lock):
+    while not all_done.is_set():
+        for i in inst.order:
+            if all_done.is_set():
+                break
+            res = run_benchdnn(args, problems[i], inst.cores)
+            # Results after the requested rounds are a load for others only.
+            if inst.rounds_done < args.rounds and res is not None:
+                inst.results.setdefault(i, []).append(res)
+        inst.rounds_done += 1
+        if inst.rounds_done == args.rounds:
+            with lock:
+                n_done[0] += 1
+                if n_done[0] == args.instances:
+                    all_done.set()
+
+
+def mean(values):
+    return sum(values) / len(values) if values else 0.0
+
+
+def report(args, problems, instances, solo):
+    print("instance,problem,avg(ms),p99(ms),solo_avg(ms),slowdown(%)")
+    total_gflops = 0.0
+    summary = []
+    for inst in instances:
+        ops, avg_ms, worst_p99 = 0.0, 0.0, 0.0
+        for i in sorted(inst.results):
+            res = inst.results[i]
+            p_avg = mean([r["avg"] for r in res])
+            p_p99 = max([r["p99"] for r in res])
+            ops += res[0]["ops"]
+            avg_ms += p_avg
+            worst_p99 = max(worst_p99, p_p99)
+            solo_avg, slowdown = "", ""
+            if i in solo:
+                solo_avg = f"{solo[i]['avg']:g}"
+                slowdown = f"{100.0 * (p_avg / solo[i]['avg'] - 1):.1f}"
+            print(
+                f"{inst.idx},{problems[i]},{p_avg:g},{p_p99:g},{solo_avg},"
+                f"{slowdown}"
+            )
+        gflops = ops / avg_ms / 1e6 if avg_ms else 0.0
+        total_gflops += gflops
+        summary.append((inst, gflops, worst_p99))
+
+    for inst, gflops, worst_p99 in summary:
+        log(
+            f"instance {inst.idx}: cores:{len(inst.cores)} "
+            f"problems:{len(inst.results)} throughput(GFLOPs):{gflops:g} "
+            f"worst_p99(ms):{worst_p99:g}"
+        )
+    log(f"aggregate throughput(GFLOPs): {total_gflops:g}")
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Runs a mix of benchdnn problems concurrently in several "
+        "instances pinned to disjoint core subsets."
+    )
+    parser.add_argument("benchdnn", help="path to benchdnn executable")
+    parser.add_argument(
+        "-b",
+        "--batch-file",
+        required=True,
+        help="file with a benchdnn driver and problem per line, "
+        "e.g. '--matmul --dt=bf16 128x4096:4096x4096'",
+    )
+    parser.add_argument(
+        "-n", "--instances", type=int, default=2, help="number of instances"
+    )
+    parser.add_argument(
+        "--cores-per-instance",
+        type=int,
+        help="cores per instance, available cores are split evenly by default",
+    )
+    parser.add_argument(
+        "--rounds",
+        type=int,
+        default=1,
+        help="number of passes over the mix measured per instance",
+    )
+    parser.add_argument(
+        "--solo",
+        action="store_true",
+        help="run every problem alone on the first core subset first to "
+        "report slowdown caused by concurrent instances",
+    )
+    args = parser.parse_args()
+
+    if not os.path.exists(args.benchdnn):
+        error(f"cannot execute {args.benchdnn}, no such file exists")
+    if args.instances <= 0 or args.rounds <= 0:
+        error("the number of instances and rounds must be positive")
+
+    with open(args.batch_file) as f:
+        problems = [l.strip() for l in f if l.strip() and l[0] != "#"]
+    if not problems:
+        error(f"no problems found in {args.batch_file}")
+
+    cores = sorted(os.sched_getaffinity(0))
+    core_sets = split_cores(cores, args.instances, args.cores_per_instance)
+
+    solo = {}
+    if args.solo:
+        log("solo run")
+        for i, problem in enumerate(problems):
+            res = run_benchdnn(args, problem, core_sets[0])
+            if res is not None:
+                solo[i] = res
+
+    log(f"concurrent run: {args.instances} instances")
+    instances = [Instance(i, c, problems) for i, c in enumerate(core_sets)]
+    all_done, n_done, lock = threading.Event(), [0], threading.Lock()
+    threads = [
+        threading.Thread(
+            target=run_instance,
+            args=(args, problems, inst, all_done, n_done, lock),
+        )
+        for inst in instances
+    ]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+
+    report(args, problems, instances, solo)
+
+
+if __name__ == "__main__":
+    main()
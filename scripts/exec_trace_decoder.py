@@ -0,0 +1,158 @@
+#! /usr/bin/env python3
+################################################################################
+# Copyright 2025 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+"""Decodes a binary execution trace written with ONEDNN_EXEC_TRACE.
+
+Each execution is printed as a comma-separated line:
+    onednn_trace,<tid>,<start_ms>,<duration_ms>,<status>,<nargs>,<args>,<info>
+where <start_ms> is relative to the first recorded execution, <args> is a
+space-separated list of <arg id>:<data type>:<ndims>d:<nelems> summaries of the
+memory arguments with the lowest ids, and <info> is the primitive information
+as printed by ONEDNN_VERBOSE. Parallel tasks are skipped.
+
+With --chrome, the trace is converted to the Chrome trace event format
+instead, including parallel tasks, which Perfetto and chrome://tracing open.
+Tasks that called a CPU JIT kernel are named after the last such kernel.
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+MAGIC = b"DNNLTRC1"
+MAX_ARGS = 4
+ARG = struct.Struct("=iIIiq")
+RECORD = struct.Struct("=QQQIiiiiI" + "iIIiq" * MAX_ARGS)
+KIND_EXEC, KIND_TASK = 0, 1
+# dnnl_data_type_t values.
+DATA_TYPES = [
+    "undef", "f16", "bf16", "f32", "s32", "s8", "u8", "f64", "boolean",
+    "f8_e5m2", "f8_e4m3", "s4", "u4", "e8m0", "f4_e2m1", "f4_e3m0",
+]
+
+
+def read(f, fmt):
+    size = struct.calcsize(fmt)
+    data = f.read(size)
+    if len(data) != size:
+        raise ValueError("unexpected end of file")
+    return struct.unpack(fmt, data)
+
+
+def summarize_arg(fields):
+    arg, data_type, _, ndims, nelems = fields
+    if ndims == 0:
+        return f"{arg}:none"
+    name = DATA_TYPES[data_type] if data_type < len(DATA_TYPES) else data_type
+    return f"{arg}:{name}:{ndims}d:{nelems}"
+
+
+def decode(f):
+    if f.read(len(MAGIC)) != MAGIC:
+        raise ValueError("not an execution trace")
+    version, record_size = read(f, "=II")
+    if version != 3 or record_size != RECORD.size:
+        raise ValueError(f"unsupported trace version {version}")
+
+    primitives = {}
+    (n_primitives,) = read(f, "=Q")
+    for _ in range(n_primitives):
+        id, length = read(f, "=QI")
+        primitives[id] = f.read(length).decode(errors="replace")
+
+    executions = []
+    (n_threads,) = read(f, "=Q")
+    for _ in range(n_threads):
+        thread, _, n_records = read(f, "=IIQ")
+        for _ in range(n_records):
+            fields = RECORD.unpack(f.read(RECORD.size))
+            id, start, end, kind, nargs, status, ithr, nthr, kernel = fields[:9]
+            args = [
+                summarize_arg(fields[9 + i * 5 : 14 + i * 5])
+                for i in range(min(nargs, MAX_ARGS))
+            ]
+            executions.append(
+                (
+                    start, end, thread, id, kind, nargs, status, ithr, nthr,
+                    args, kernel,
+                )
+            )
+    executions.sort()
+    return primitives, executions
+
+
+def to_chrome(primitives, executions):
+    events = []
+    for (
+        start, end, thread, id, kind, nargs, status, ithr, nthr, args, kernel
+    ) in executions:
+        is_task = kind == KIND_TASK
+        name = primitives.get(id, "unknown")
+        task_args = {"ithr": ithr, "nthr": nthr}
+        # Tasks that called a JIT kernel are named after it.
+        if is_task and kernel in primitives:
+            task_args["primitive"] = name
+            name = primitives[kernel]
+        events.append(
+            {
+                "name": name,
+                "cat": "task" if is_task else "primitive",
+                "ph": "X",
+                "pid": 0,
+                "tid": thread,
+                "ts": start / 1e3,
+                "dur": (end - start) / 1e3,
+                "args": (
+                    task_args
+                    if is_task
+                    else {"nargs": nargs, "status": status, "args": args}
+                ),
+            }
+        )
+    return {"traceEvents": events}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("trace", help="trace file")
+    parser.add_argument(
+        "--chrome",
+        action="store_true",
+        help="print the Chrome trace event format",
+    )
+    args = parser.parse_args()
+
+    with open(args.trace, "rb") as f:
+        primitives, executions = decode(f)
+    if args.chrome:
+        json.dump(to_chrome(primitives, executions), sys.stdout)
+        return 0
+
+    executions = [e for e in executions if e[4] == KIND_EXEC]
+    origin = executions[0][0] if executions else 0
+    for start, end, thread, id, _, nargs, status, _, _, args, _ in executions:
+        print(
+            f"onednn_trace,{thread},{(start - origin) / 1e6:.6f},"
+            f"{(end - start) / 1e6:.6f},{status},{nargs},{' '.join(args)},"
+            f"{primitives.get(id, 'unknown')}"
+        )
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
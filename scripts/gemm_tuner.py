@@ -0,0 +1,175 @@
+#! /bin/python3
+################################################################################
+# Copyright 2025 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+# Tunes the GPU gemm kernel selection for a list of matmul problems on the
+# local device. For every gemm kernel a problem needs, all catalog entries
+# considered by the kernel selector are benchmarked with benchdnn, and the
+# fastest one is written to a kernel database that is loaded by the library
+# from ONEDNN_GPU_GEMM_KERNEL_DB.
+
+import argparse
+import os
+import re
+import subprocess
+from tempfile import NamedTemporaryFile
+
+KEY_RE = re.compile(r"info,gpu,gemm,key:(.*)$")
+CONSIDER_RE = re.compile(r"info,gpu,gemm,consider:(.*),score:[^,]*$")
+TIME_RE = re.compile(r"^gemm_tuner,([0-9.eE+-]+)$")
+
+
+def log(output):
+    print("gemm_tuner: " + output)
+
+
+def error(output):
+    print("gemm_tuner: error: " + output)
+    exit(1)
+
+
+def read_db(path):
+    db = {}
+    if path is None or not os.path.exists(path):
+        return db
+    with open(path) as f:
+        for line in f:
+            line = line.rstrip("\n")
+            if not line or line.startswith("#") or "\t" not in line:
+                continue
+            key, entry = line.split("\t", 1)
+            db[key] = entry
+    return db
+
+
+def write_db(path, db):
+    with open(path, "w") as f:
+        f.write("# oneDNN GPU gemm kernel database\n")
+        for key in sorted(db):
+            f.write(f"{key}\t{db[key]}\n")
+
+
+def run_benchdnn(args, problem, mode, db=None):
+    env = dict(os.environ)
+    env.pop("ONEDNN_GPU_GEMM_KERNEL_DB", None)
+    cmd = [args.benchdnn, "--engine=gpu", "--matmul", f"--mode={mode}"]
+    if mode == "I":
+        env["ONEDNN_VERBOSE"] = "debuginfo=5"
+    else:
+        cmd.append("--perf-template=gemm_tuner,%-time%")
+    cmd += problem.split()
+
+    with NamedTemporaryFile("w+t", suffix=".db") as db_file:
+        if db is not None:
+            write_db(db_file.name, db)
+            env["ONEDNN_GPU_GEMM_KERNEL_DB"] = db_file.name
+        result = subprocess.run(
+            cmd, env=env, stdout=subprocess.PIPE, universal_newlines=True
+        )
+    if result.returncode != 0:
+        return None
+    return result.stdout.splitlines()
+
+
+def discover(args, problem):
+    lines = run_benchdnn(args, problem, "I")
+    if lines is None:
+        error(f"cannot create the primitive for '{problem}'")
+
+    # The considered entries of a kernel are printed before its key.
+    kernels = []
+    candidates = []
+    for line in lines:
+        m = CONSIDER_RE.search(line)
+        if m:
+            if m.group(1) not in candidates:
+                candidates.append(m.group(1))
+            continue
+        m = KEY_RE.search(line)
+        if m:
+            kernels.append((m.group(1), candidates))
+            candidates = []
+    return kernels
+
+
+def measure(args, problem, db):
+    lines = run_benchdnn(args, problem, "F", db)
+    if lines is None:
+        return None
+    for line in lines:
+        m = TIME_RE.match(line)
+        if m:
+            return float(m.group(1))
+    return None
+
+
+def tune(args, problem, db):
+    for key, candidates in discover(args, problem):
+        if key in db and not args.retune:
+            log(f"skipping tuned kernel: {key}")
+            continue
+        log(f"tuning kernel: {key} ({len(candidates)} candidates)")
+        best_time, best_entry = None, None
+        for entry in candidates:
+            trial_db = dict(db)
+            trial_db[key] = entry
+            time = measure(args, problem, trial_db)
+            if time is None:
+                continue
+            log(f"  {entry}: {time} ms")
+            if best_time is None or time < best_time:
+                best_time, best_entry = time, entry
+        if best_entry is not None:
+            log(f"  best: {best_entry}")
+            db[key] = best_entry
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Tunes the GPU gemm kernel selection for matmul problems."
+    )
+    parser.add_argument("benchdnn", help="path to benchdnn executable")
+    parser.add_argument(
+        "-b",
+        "--batch-file",
+        required=True,
+        help="file with a benchdnn matmul problem per line, "
+        "e.g. '--dt=f16 128x4096:4096x4096'",
+    )
+    parser.add_argument(
+        "-o", "--db", required=True, help="kernel database to update"
+    )
+    parser.add_argument(
+        "--retune",
+        action="store_true",
+        help="tune kernels that already have a database entry",
+    )
+    args = parser.parse_args()
+
+    if not os.path.exists(args.benchdnn):
+        error(f"cannot execute {args.benchdnn}, no such file exists")
+
+    db = read_db(args.db)
+    with open(args.batch_file) as f:
+        problems = [l.strip() for l in f if l.strip() and l[0] != "#"]
+    for problem in problems:
+        log(f"problem: {problem}")
+        tune(args, problem, db)
+        write_db(args.db, db)
+
+
+if __name__ == "__main__":
+    main()
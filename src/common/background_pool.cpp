@@ -0,0 +1,166 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+#include "background_pool.hpp"
+#include "kernel_cache.hpp"
+#include "primitive_cache.hpp"
+#include "utils.hpp"
+
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+#include "cpu/cpu_affinity.hpp"
+#endif
+
+namespace dnnl {
+namespace impl {
+
+background_pool_t &background_pool_t::get() {
+    static background_pool_t pool;
+    return pool;
+}
+
+background_pool_t::background_pool_t() {
+    // Tasks use the caches, make sure they are constructed first and hence
+    // destroyed after the pool.
+    primitive_cache();
+    kernel_cache::get();
+
+    // Code generation is mostly serial, a few threads are enough to hide it
+    // without taking cores from the compute threads.
+    const int nthr_hw = (int)std::thread::hardware_concurrency();
+    max_threads_ = std::min(4, std::max(1, nthr_hw / 4));
+}
+
+background_pool_t::~background_pool_t() {
+    std::deque<entry_t> canceled;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+        canceled.swap(tasks_);
+    }
+    cv_.notify_all();
+    // The handlers may release resources held by the tasks or notify the
+    // submitter, run them without the lock.
+    for (auto &e : canceled)
+        if (e.on_cancel) e.on_cancel();
+    // Joining threads is not allowed during process termination on some
+    // platforms, leave them to the OS in that case.
+    const bool can_join = is_destroying_cache_safe();
+    for (auto &t : threads_) {
+        if (can_join)
+            t.join();
+        else
+            t.detach();
+    }
+}
+
+status_t background_pool_t::submit(
+        std::function<void()> task, std::function<void()> on_cancel) {
+    if (!task) return status::invalid_arguments;
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stop_) return status::runtime_error;
+    tasks_.push_back({std::move(task), std::move(on_cancel)});
+    if ((int)threads_.size() < max_threads_) {
+        try {
+            threads_.emplace_back(&background_pool_t::run, this);
+        } catch (...) {
+            // Existing threads will pick the task up.
+            if (threads_.empty()) {
+                tasks_.pop_back();
+                return status::out_of_memory;
+            }
+        }
+    }
+    cv_.notify_one();
+    return status::success;
+}
+
+status_t background_pool_t::parallel_for(
+        int n, const std::function<status_t(int)> &task) {
+    struct state_t {
+        std::atomic<int> next {0};
+        std::atomic<status_t> status {status::success};
+        std::mutex mutex;
+        std::condition_variable cv;
+        int active = 0;
+        bool closed = false;
+        const std::function<status_t(int)> *task = nullptr;
+        int n = 0;
+
+        void run() {
+            for (int i = next++; i < n; i = next++) {
+                status_t st = status::runtime_error;
+                try {
+                    st = (*task)(i);
+                } catch (...) {}
+                status_t expected = status::success;
+                if (st != status::success)
+                    status.compare_exchange_strong(expected, st);
+            }
+        }
+    };
+
+    auto state = std::make_shared<state_t>();
+    state->task = &task;
+    state->n = n;
+
+    // A helper that starts after the calling thread is done finds the state
+    // closed and doesn't access `task`.
+    const int nhelpers = std::min(n - 1, max_threads_);
+    for (int i = 0; i < nhelpers; i++) {
+        status_t st = submit([state] {
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                if (state->closed) return;
+                state->active++;
+            }
+            state->run();
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->active--;
+            state->cv.notify_all();
+        });
+        if (st != status::success) break;
+    }
+
+    state->run();
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->closed = true;
+    state->cv.wait(lock, [&] { return state->active == 0; });
+    return state->status.load();
+}
+
+void background_pool_t::run() {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    cpu::affinity::restrict_current_thread();
+#endif
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+            if (stop_) return;
+            task = std::move(tasks_.front().task);
+            tasks_.pop_front();
+        }
+        task();
+    }
+}
+
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,75 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_BACKGROUND_POOL_HPP
+#define COMMON_BACKGROUND_POOL_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "c_types_map.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// A small pool of threads running work the caller doesn't want to wait for,
+// e.g. asynchronous primitive creation. The threads are started on the first
+// submission. When the library is unloaded, running tasks are completed and
+// the threads are joined. Tasks that haven't started are canceled: their
+// `on_cancel` handlers are called instead.
+struct background_pool_t {
+    static background_pool_t &get();
+
+    status_t submit(std::function<void()> task,
+            std::function<void()> on_cancel = nullptr);
+
+    // Runs `task(i)` for every i in [0, n) on the calling thread and on the
+    // pool threads, and returns once all calls are done. The calling thread
+    // takes part so that the call completes even when all pool threads are
+    // busy, e.g. when it is made from a pool thread. Returns the first
+    // failing status, if any.
+    status_t parallel_for(int n, const std::function<status_t(int)> &task);
+
+    ~background_pool_t();
+
+private:
+    background_pool_t();
+    DNNL_DISALLOW_COPY_AND_ASSIGN(background_pool_t);
+
+    void run();
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    struct entry_t {
+        std::function<void()> task;
+        std::function<void()> on_cancel;
+    };
+
+    std::deque<entry_t> tasks_;
+    std::vector<std::thread> threads_;
+    int max_threads_;
+    bool stop_ = false;
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
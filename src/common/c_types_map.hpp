@@ -108,6 +108,8 @@ const alg_kind_t eltwise_round = dnnl_eltwise_round;
 const alg_kind_t pooling_max = dnnl_pooling_max;
 const alg_kind_t pooling_avg_include_padding = dnnl_pooling_avg_include_padding;
 const alg_kind_t pooling_avg_exclude_padding = dnnl_pooling_avg_exclude_padding;
+const alg_kind_t pooling_adaptive_max = dnnl_pooling_adaptive_max;
+const alg_kind_t pooling_adaptive_avg = dnnl_pooling_adaptive_avg;
 const alg_kind_t lrn_across_channels = dnnl_lrn_across_channels;
 const alg_kind_t lrn_within_channel = dnnl_lrn_within_channel;
 const alg_kind_t vanilla_rnn = dnnl_vanilla_rnn;
@@ -131,6 +133,9 @@ const alg_kind_t binary_ne = dnnl_binary_ne;
 const alg_kind_t binary_select = dnnl_binary_select;
 const alg_kind_t resampling_nearest = dnnl_resampling_nearest;
 const alg_kind_t resampling_linear = dnnl_resampling_linear;
+const alg_kind_t resampling_cubic = dnnl_resampling_cubic;
+const alg_kind_t resampling_linear_antialias
+        = dnnl_resampling_linear_antialias;
 const alg_kind_t reduction_max = dnnl_reduction_max;
 const alg_kind_t reduction_min = dnnl_reduction_min;
 const alg_kind_t reduction_sum = dnnl_reduction_sum;
@@ -144,6 +149,12 @@ const alg_kind_t reduction_norm_lp_power_p_sum
         = dnnl_reduction_norm_lp_power_p_sum;
 const alg_kind_t softmax_accurate = dnnl_softmax_accurate;
 const alg_kind_t softmax_log = dnnl_softmax_log;
+const alg_kind_t gather_none = dnnl_gather_none;
+const alg_kind_t gather_sum = dnnl_gather_sum;
+const alg_kind_t gather_mean = dnnl_gather_mean;
+const alg_kind_t optimizer_sgd = dnnl_optimizer_sgd;
+const alg_kind_t optimizer_adam = dnnl_optimizer_adam;
+const alg_kind_t optimizer_adamw = dnnl_optimizer_adamw;
 // Internal only alg kinds.
 const alg_kind_t internal_only_start = (alg_kind_t)(1 << 12);
 // GPU only via jit_eltwise injector.
@@ -217,6 +228,8 @@ const sparse_encoding_t undef = dnnl_sparse_encoding_undef;
 const sparse_encoding_t csr = dnnl_csr;
 const sparse_encoding_t coo = dnnl_coo;
 const sparse_encoding_t packed = dnnl_packed;
+const sparse_encoding_t bsr = dnnl_bsr;
+const sparse_encoding_t packed_2_4 = dnnl_packed_2_4;
 } // namespace sparse_encoding
 
 using format_kind_t = dnnl_format_kind_t;
@@ -239,11 +252,13 @@ using profiling_data_kind_t = dnnl_profiling_data_kind_t;
 namespace profiling_data_kind {
 const profiling_data_kind_t undef = dnnl_profiling_data_kind_undef;
 const profiling_data_kind_t time = dnnl_profiling_data_kind_time;
+const profiling_data_kind_t kernel_time = dnnl_profiling_data_kind_kernel_time;
 #else
 using profiling_data_kind_t = int;
 namespace profiling_data_kind {
 const profiling_data_kind_t undef = 0;
 const profiling_data_kind_t time = 1;
+const profiling_data_kind_t kernel_time = 2;
 #endif
 // Internal only data kinds.
 const profiling_data_kind_t internal_only_start
@@ -1921,6 +1936,8 @@ const normalization_flags_t use_shift = dnnl_use_shift;
 const normalization_flags_t fuse_norm_relu = dnnl_fuse_norm_relu;
 const normalization_flags_t fuse_norm_add_relu = dnnl_fuse_norm_add_relu;
 const normalization_flags_t rms_norm = dnnl_rms_norm;
+const normalization_flags_t fuse_residual_add = dnnl_fuse_residual_add;
+const normalization_flags_t save_residual_sum = dnnl_save_residual_sum;
 } // namespace normalization_flags
 
 using rnn_flags_t = dnnl_rnn_flags_t;
@@ -1928,6 +1945,7 @@ namespace rnn_flags {
 const rnn_flags_t undef = dnnl_rnn_flags_undef;
 const rnn_flags_t diff_weights_overwrite
         = dnnl_rnn_flags_diff_weights_overwrite;
+const rnn_flags_t seq_lengths = dnnl_rnn_flags_seq_lengths;
 } // namespace rnn_flags
 
 using engine_kind_t = dnnl_engine_kind_t;
@@ -1981,6 +1999,10 @@ const primitive_kind_t reduction = dnnl_reduction;
 const primitive_kind_t softmax = dnnl_softmax;
 const primitive_kind_t layer_normalization = dnnl_layer_normalization;
 const primitive_kind_t group_normalization = dnnl_group_normalization;
+const primitive_kind_t split = dnnl_split;
+const primitive_kind_t gather = dnnl_gather;
+const primitive_kind_t topk = dnnl_topk;
+const primitive_kind_t optimizer = dnnl_optimizer;
 
 // Internal only primitive kinds.
 const primitive_kind_t internal_only_start = (primitive_kind_t)(1 << 12);
@@ -2074,6 +2096,31 @@ const matmul_reduce_kind_t undef = 0;
 const matmul_reduce_kind_t src = 1;
 } // namespace matmul_reduce_kind
 
+// NOLINTBEGIN(modernize-use-using)
+/// Types of attention mask, used by sdpa and softmax internal interfaces
+typedef enum {
+    dnnl_attn_mask_undef = 0,
+    /// explicit attention masks defined in a buffer
+    dnnl_attn_mask_buffer = 1,
+
+    /// causal mask with the diagonal starting from the top left hand side of
+    /// the mask tensor
+    dnnl_attn_mask_top_left = 2,
+
+    /// causal mask with the diagonal starting from the bottom right hand side
+    /// of the mask tensor
+    dnnl_attn_mask_bottom_right = 3,
+} dnnl_attn_mask_type_t;
+// NOLINTEND(modernize-use-using)
+
+using attn_mask_type_t = dnnl_attn_mask_type_t;
+namespace attn_mask_type {
+const attn_mask_type_t undef = dnnl_attn_mask_undef;
+const attn_mask_type_t buffer = dnnl_attn_mask_buffer;
+const attn_mask_type_t top_left = dnnl_attn_mask_top_left;
+const attn_mask_type_t bottom_right = dnnl_attn_mask_bottom_right;
+} // namespace attn_mask_type
+
 using rnn_direction_t = dnnl_rnn_direction_t;
 
 using engine_t = dnnl_engine;
@@ -2094,6 +2141,7 @@ const stream_flags_t profiling = static_cast<stream_flags_t>(1 << 2);
 #endif
 } // namespace stream_flags
 using stream_t = dnnl_stream;
+using stream_capture_t = dnnl_stream_capture;
 
 struct memory_storage_t;
 
@@ -2114,6 +2162,7 @@ struct deconvolution_pd_t;
 struct eltwise_bwd_pd_t;
 struct eltwise_fwd_pd_t;
 struct eltwise_pd_t;
+struct gather_pd_t;
 struct gemm_pd_t;
 struct group_normalization_bwd_pd_t;
 struct group_normalization_fwd_pd_t;
@@ -2129,6 +2178,7 @@ struct lrn_bwd_pd_t;
 struct lrn_fwd_pd_t;
 struct lrn_pd_t;
 struct matmul_pd_t;
+struct optimizer_pd_t;
 struct pooling_bwd_pd_t;
 struct pooling_fwd_pd_t;
 struct pooling_pd_t;
@@ -2143,7 +2193,9 @@ struct shuffle_pd_t;
 struct softmax_bwd_pd_t;
 struct softmax_fwd_pd_t;
 struct softmax_pd_t;
+struct split_pd_t;
 struct sum_pd_t;
+struct topk_pd_t;
 
 } // namespace impl
 } // namespace dnnl
@@ -46,9 +46,13 @@ struct cache_blob_impl_t {
 
     status_t get_binary(const uint8_t **binary, size_t *binary_size) {
         if (!binary || !binary_size) { return status::invalid_arguments; }
-        if (pos_ >= size_) { return status::invalid_arguments; }
+        if (pos_ + sizeof(*binary_size) > size_) {
+            return status::invalid_arguments;
+        }
         std::memcpy(binary_size, data_ + pos_, sizeof(*binary_size));
         pos_ += sizeof(*binary_size);
+        // Blobs may come from untrusted storage, don't read past the end.
+        if (*binary_size > size_ - pos_) { return status::invalid_arguments; }
         (*binary) = data_ + pos_;
         pos_ += *binary_size;
         return status::success;
@@ -65,7 +69,7 @@ struct cache_blob_impl_t {
 
     status_t get_value(uint8_t *value_ptr, size_t size) {
         if (!value_ptr) { return status::invalid_arguments; }
-        if (pos_ >= size_) { return status::invalid_arguments; }
+        if (pos_ + size > size_) { return status::invalid_arguments; }
         std::memcpy(value_ptr, data_ + pos_, size);
         pos_ += size;
         return status::success;
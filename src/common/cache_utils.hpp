@@ -18,8 +18,11 @@
 #define COMMON_CACHE_UTILS_HPP
 
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <future>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <unordered_map>
 
@@ -47,6 +50,11 @@ namespace utils {
 template <typename K, typename O>
 using key_merge_t = void (*)(const K &, const O &);
 
+// Returns the amount of memory held by object o. Used to bound the memory
+// usage of a cache in addition to the number of entries.
+template <typename O>
+using weight_t = size_t (*)(const O &);
+
 template <typename K, typename O, typename C,
         key_merge_t<K, O> key_merge = nullptr>
 struct cache_t {
@@ -115,35 +123,50 @@ protected:
     virtual value_t get_or_add(const key_t &key, const value_t &value) = 0;
     virtual void remove_if_invalidated(const key_t &key) = 0;
     virtual void update_entry(const key_t &key, const object_t &p) = 0;
-    static utils::rw_mutex_t &rw_mutex() {
-        static utils::rw_mutex_t mutex;
-        return mutex;
-    }
 };
 
-// The cache uses LRU replacement policy
+// The cache uses LRU replacement policy.
+//
+// Entries are partitioned by key hash into shards, each protected by its own
+// read-write lock, so that lookups of different keys from many threads don't
+// contend on a single lock. Lookups (the hot path) only take a read lock on
+// the shard of the key. Modifications of the cache structure (insertion,
+// eviction, removal) are additionally serialized by a single mutex: they
+// only happen on a cache miss, where creation of the object dominates, and
+// serializing them keeps the size and the LRU order global rather than per
+// shard.
+//
+// When `weight` is provided, the cache additionally evicts the least recently
+// used entries once the total weight of the created objects exceeds the
+// weight limit. A limit of 0 means no limit.
 template <typename K, typename O, typename C,
-        key_merge_t<K, O> key_merge = nullptr>
+        key_merge_t<K, O> key_merge = nullptr, weight_t<O> weight = nullptr>
 struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
     using lru_base_t = cache_t<K, O, C, key_merge>;
     using key_t = typename lru_base_t::key_t;
     using object_t = typename lru_base_t::object_t;
     using cache_object_t = typename lru_base_t::cache_object_t;
     using value_t = typename lru_base_t::value_t;
-    lru_cache_t(int capacity) : capacity_(capacity) {}
+    lru_cache_t(int capacity, size_t weight_limit = 0)
+        : capacity_(capacity)
+        , size_(0)
+        , weight_limit_(weight_limit)
+        , total_weight_(0) {}
 
     ~lru_cache_t() override {
-        if (cache_mapper().empty()) return;
+        if (get_size_no_lock() == 0) return;
 
         if (!is_destroying_cache_safe()) {
             // It is safe to remove those entries that are not affected by the
             // unloading order issue e.g. native CPU.
-            for (auto it = cache_mapper().begin();
-                    it != cache_mapper().end();) {
-                if (!it->first.has_runtime_dependencies()) {
-                    it = cache_mapper().erase(it);
-                } else {
-                    ++it;
+            for (auto &shard : shards_) {
+                auto &mapper = shard.mapper_;
+                for (auto it = mapper.begin(); it != mapper.end();) {
+                    if (!it->first.has_runtime_dependencies()) {
+                        it = mapper.erase(it);
+                    } else {
+                        ++it;
+                    }
                 }
             }
             release_cache();
@@ -154,90 +177,100 @@ struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
     cache_object_t get(const key_t &key) override {
         value_t e;
         {
-            utils::lock_read_t lock_r(this->rw_mutex());
-            if (capacity_ == 0) { return cache_object_t(); }
-            e = get_future(key);
+            auto &shard = get_shard(key);
+            utils::lock_read_t lock_r(shard.rw_mutex_);
+            if (capacity_.load(std::memory_order_relaxed) == 0) {
+                return cache_object_t();
+            }
+            e = get_future(shard, key);
         }
 
         if (e.valid()) return e.get();
         return cache_object_t();
     }
 
-    int get_capacity() const override {
-        utils::lock_read_t lock_r(this->rw_mutex());
-        return capacity_;
-    };
+    int get_capacity() const override { return capacity_.load(); };
 
     status_t set_capacity(int capacity) override {
-        utils::lock_write_t lock_w(this->rw_mutex());
-        capacity_ = capacity;
+        std::lock_guard<std::mutex> lock(modify_mutex_);
+        capacity_.store(capacity);
         // Check if number of entries exceeds the new capacity
-        if (get_size_no_lock() > capacity_) {
+        if (get_size_no_lock() > capacity) {
             // Evict excess entries
-            int n_excess_entries = get_size_no_lock() - capacity_;
+            int n_excess_entries = get_size_no_lock() - capacity;
             evict(n_excess_entries);
         }
         return status::success;
     }
     void set_capacity_without_clearing(int capacity) {
-        utils::lock_write_t lock_w(this->rw_mutex());
-        capacity_ = capacity;
+        std::lock_guard<std::mutex> lock(modify_mutex_);
+        capacity_.store(capacity);
     }
 
-    int get_size() const override {
-        utils::lock_read_t lock_r(this->rw_mutex());
-        return get_size_no_lock();
+    int get_size() const override { return get_size_no_lock(); }
+
+    void set_weight_limit(size_t weight_limit) {
+        std::lock_guard<std::mutex> lock(modify_mutex_);
+        weight_limit_.store(weight_limit);
+        evict_overweight();
     }
+    size_t get_weight_limit() const { return weight_limit_.load(); }
+    size_t get_weight() const { return total_weight_.load(); }
 
 protected:
-    int get_size_no_lock() const { return (int)cache_mapper().size(); }
+    int get_size_no_lock() const { return size_.load(); }
 
     value_t get_or_add(const key_t &key, const value_t &value) override {
+        auto &shard = get_shard(key);
         {
-            // 1. Section with shared access (read lock)
-            utils::lock_read_t lock_r(this->rw_mutex());
+            // 1. Section with shared access to the shard (read lock)
+            utils::lock_read_t lock_r(shard.rw_mutex_);
             // Check if the cache is enabled.
-            if (capacity_ == 0) { return value_t(); }
+            if (capacity_.load(std::memory_order_relaxed) == 0) {
+                return value_t();
+            }
             // Check if the requested entry is present in the cache (likely
             // cache_hit)
-            auto e = get_future(key);
+            auto e = get_future(shard, key);
             if (e.valid()) { return e; }
         }
 
-        utils::lock_write_t lock_w(this->rw_mutex());
-        // 2. Section with exclusive access (write lock).
+        // 2. Section with exclusive access to the cache structure.
         // In a multithreaded scenario, in the context of one thread the cache
         // may have changed by another thread between releasing the read lock
-        // and acquiring the write lock (a.k.a. ABA problem), therefore
-        // additional checks have to be performed for correctness. Double check
-        // the capacity due to possible race condition
-        if (capacity_ == 0) { return value_t(); }
-
-        // Double check if the requested entry is present in the cache (unlikely
-        // cache_hit).
-        auto e = get_future(key);
+        // and acquiring the mutex (a.k.a. ABA problem), therefore additional
+        // checks have to be performed for correctness. Double check the
+        // capacity due to possible race condition
+        std::lock_guard<std::mutex> lock(modify_mutex_);
+        if (capacity_.load() == 0) { return value_t(); }
+
+        // Double check if the requested entry is present in the cache
+        // (unlikely cache_hit). The shards are only modified under
+        // `modify_mutex_`, so no shard lock is required for reading.
+        auto e = get_future(shard, key);
         if (!e.valid()) {
             // If the entry is missing in the cache then add it (cache_miss)
-            add(key, value);
+            add(shard, key, value);
         }
         return e;
     }
 
     void remove_if_invalidated(const key_t &key) override {
-        utils::lock_write_t lock_w(this->rw_mutex());
+        std::lock_guard<std::mutex> lock(modify_mutex_);
 
-        if (capacity_ == 0) { return; }
+        if (capacity_.load() == 0) { return; }
 
-        auto it = cache_mapper().find(key);
+        auto &shard = get_shard(key);
+        auto it = shard.mapper_.find(key);
         // The entry has been already evicted at this point
-        if (it == cache_mapper().end()) { return; }
+        if (it == shard.mapper_.end()) { return; }
 
         const auto &value = it->second.value_;
         // If the entry is not invalidated
         if (!value.get().is_empty()) { return; }
 
         // Remove the invalidated entry
-        cache_mapper().erase(it);
+        erase(shard, it);
     }
 
 private:
@@ -249,36 +282,103 @@ private:
 #endif
     }
 
+    static constexpr int shard_bits = 4;
+    static constexpr size_t n_shards = size_t(1) << shard_bits;
+
+    struct timed_entry_t {
+        value_t value_;
+        std::atomic<size_t> timestamp_;
+        // Only accessed under `modify_mutex_`.
+        size_t weight_ = 0;
+        timed_entry_t(const value_t &value, size_t timestamp)
+            : value_(value), timestamp_(timestamp) {}
+    };
+
+    // Each entry in the cache has a corresponding key and timestamp. NOTE:
+    // pairs that contain atomics cannot be stored in an unordered_map *as an
+    // element*, since it invokes the copy constructor of std::atomic, which is
+    // deleted.
+    using mapper_t = std::unordered_map<key_t, timed_entry_t>;
+
+    struct shard_t {
+        utils::rw_mutex_t rw_mutex_;
+        mapper_t mapper_;
+    };
+
+    shard_t &get_shard(const key_t &key) {
+        // Key hashes may only populate the low bits, so the hash is remixed
+        // with a multiplicative (Fibonacci) hash, whose top bits depend on
+        // all the bits of the hash. They are also mostly independent of the
+        // bucket selection of std::unordered_map within the shard.
+        const uint64_t h = static_cast<uint64_t>(std::hash<key_t>()(key))
+                * UINT64_C(0x9e3779b97f4a7c15);
+        return shards_[static_cast<size_t>(h >> (64 - shard_bits))];
+    }
+
     void update_entry(const key_t &key, const object_t &p) override {
         // Cast to void as compilers may warn about comparing compile time
         // constant function pointers with nullptr, as that is often not an
         // intended behavior
-        if ((void *)key_merge == nullptr) return;
+        if ((void *)key_merge == nullptr && (void *)weight == nullptr) return;
 
-        utils::lock_write_t lock_w(this->rw_mutex());
+        std::lock_guard<std::mutex> lock(modify_mutex_);
 
-        if (capacity_ == 0) { return; }
+        if (capacity_.load() == 0) { return; }
 
         // There is nothing to do in two cases:
         // 1. The requested entry is not in the cache because it has been evicted
         //    by another thread
         // 2. After the requested entry had been evicted it was inserted again
         //    by another thread
-        auto it = cache_mapper().find(key);
-        if (it == cache_mapper().end()
+        auto &shard = get_shard(key);
+        auto it = shard.mapper_.find(key);
+        if (it == shard.mapper_.end()
                 || it->first.thread_id() != key.thread_id()) {
             return;
         }
 
-        key_merge(it->first, p);
+        if ((void *)key_merge != nullptr) {
+            utils::lock_write_t lock_w(shard.rw_mutex_);
+            key_merge(it->first, p);
+        }
+
+        if ((void *)weight != nullptr) {
+            // The object may be re-created for an existing entry when the
+            // creation is forced.
+            total_weight_ -= it->second.weight_;
+            it->second.weight_ = weight(p);
+            total_weight_ += it->second.weight_;
+            evict_overweight();
+        }
     }
 
-    void evict(int n) {
-        using v_t =
-                typename std::unordered_map<key_t, timed_entry_t>::value_type;
+    // Must be called under `modify_mutex_`.
+    void erase(shard_t &shard, typename mapper_t::iterator it) {
+        total_weight_ -= it->second.weight_;
+        utils::lock_write_t lock_w(shard.rw_mutex_);
+        shard.mapper_.erase(it);
+        size_--;
+    }
+
+    // Must be called under `modify_mutex_`.
+    void evict_overweight() {
+        const size_t limit = weight_limit_.load();
+        if (limit == 0) return;
+        // The most recently added object is evicted as well if it doesn't fit
+        // into the limit alone.
+        while (total_weight_.load() > limit && get_size_no_lock() > 0)
+            evict(1);
+    }
 
-        if (n == capacity_) {
-            cache_mapper().clear();
+    // Must be called under `modify_mutex_`.
+    void evict(int n) {
+        if (n == capacity_.load()) {
+            for (auto &shard : shards_) {
+                utils::lock_write_t lock_w(shard.rw_mutex_);
+                shard.mapper_.clear();
+            }
+            size_.store(0);
+            total_weight_.store(0);
             return;
         }
 
@@ -286,82 +386,80 @@ private:
             // Find the smallest timestamp
             // TODO: revisit the eviction algorithm due to O(n) complexity, E.g.
             // maybe evict multiple entries at once.
-            auto it = std::min_element(cache_mapper().begin(),
-                    cache_mapper().end(),
-                    [&](const v_t &left, const v_t &right) {
-                        // By default, load() and operator T use sequentially
-                        // consistent memory ordering, which enforces writing
-                        // the timestamps into registers in the same exact order
-                        // they are read from the CPU cache line. Since eviction
-                        // is performed under a write lock, this order is not
-                        // important, therefore we can safely use the weakest
-                        // memory ordering (relaxed). This brings about a few
-                        // microseconds performance improvement for default
-                        // cache capacity.
-                        return left.second.timestamp_.load(
-                                       std::memory_order_relaxed)
-                                < right.second.timestamp_.load(
-                                        std::memory_order_relaxed);
-                    });
-            auto res = cache_mapper().erase(it->first);
-            MAYBE_UNUSED(res);
-            assert(res);
+            shard_t *victim_shard = nullptr;
+            typename mapper_t::iterator victim;
+            size_t victim_timestamp = 0;
+            for (auto &shard : shards_) {
+                for (auto it = shard.mapper_.begin(); it != shard.mapper_.end();
+                        ++it) {
+                    // By default, load() and operator T use sequentially
+                    // consistent memory ordering, which enforces writing the
+                    // timestamps into registers in the same exact order they
+                    // are read from the CPU cache line. Since the order is not
+                    // important here, we can safely use the weakest memory
+                    // ordering (relaxed). This brings about a few
+                    // microseconds performance improvement for default cache
+                    // capacity.
+                    const size_t timestamp = it->second.timestamp_.load(
+                            std::memory_order_relaxed);
+                    if (!victim_shard || timestamp < victim_timestamp) {
+                        victim_shard = &shard;
+                        victim = it;
+                        victim_timestamp = timestamp;
+                    }
+                }
+            }
+            assert(victim_shard);
+            if (!victim_shard) return;
+            erase(*victim_shard, victim);
         }
     }
-    void add(const key_t &key, const value_t &value) {
-        // std::list::size() method has linear complexity. Check the cache size
-        // using std::unordered_map::size();
-        if (get_size_no_lock() == capacity_) {
+
+    // Must be called under `modify_mutex_`.
+    void add(shard_t &shard, const key_t &key, const value_t &value) {
+        if (get_size_no_lock() == capacity_.load()) {
             // Evict the least recently used entry
             evict(1);
         }
 
         size_t timestamp = get_timestamp();
 
-        auto res = cache_mapper().emplace(std::piecewise_construct,
+        utils::lock_write_t lock_w(shard.rw_mutex_);
+        auto res = shard.mapper_.emplace(std::piecewise_construct,
                 std::forward_as_tuple(key),
                 std::forward_as_tuple(value, timestamp));
         MAYBE_UNUSED(res);
         assert(res.second);
+        size_++;
     }
-    value_t get_future(const key_t &key) {
-        auto it = cache_mapper().find(key);
-        if (it == cache_mapper().end()) return value_t();
+
+    value_t get_future(shard_t &shard, const key_t &key) {
+        auto it = shard.mapper_.find(key);
+        if (it == shard.mapper_.end()) return value_t();
 
         size_t timestamp = get_timestamp();
-        it->second.timestamp_.store(timestamp);
+        it->second.timestamp_.store(timestamp, std::memory_order_relaxed);
         // Return the entry
         return it->second.value_;
     }
 
-    int capacity_;
-    struct timed_entry_t {
-        value_t value_;
-        std::atomic<size_t> timestamp_;
-        timed_entry_t(const value_t &value, size_t timestamp)
-            : value_(value), timestamp_(timestamp) {}
-    };
-
-    std::unordered_map<key_t, timed_entry_t> &cache_mapper() {
-        return cache_mapper_;
-    }
-
-    const std::unordered_map<key_t, timed_entry_t> &cache_mapper() const {
-        return cache_mapper_;
-    }
-
     // Leaks cached resources. Used to avoid issues with calling destructors
     // allocated by an already unloaded dynamic library.
     void release_cache() {
-        auto t = utils::make_unique<std::unordered_map<key_t, timed_entry_t>>();
-        std::swap(*t, cache_mapper_);
-        t.release();
+        for (auto &shard : shards_) {
+            auto t = utils::make_unique<mapper_t>();
+            std::swap(*t, shard.mapper_);
+            t.release();
+        }
     }
-    // Each entry in the cache has a corresponding key and timestamp. NOTE:
-    // pairs that contain atomics cannot be stored in an unordered_map *as an
-    // element*, since it invokes the copy constructor of std::atomic, which is
-    // deleted.
-    std::unordered_map<key_t, timed_entry_t> cache_mapper_;
+
+    std::atomic<int> capacity_;
+    std::atomic<int> size_;
+    std::atomic<size_t> weight_limit_;
+    std::atomic<size_t> total_weight_;
+    // Serializes modifications of the cache structure.
+    std::mutex modify_mutex_;
+    shard_t shards_[n_shards];
 };
 
 } // namespace utils
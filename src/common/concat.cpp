@@ -129,6 +129,7 @@ status_t concat_primitive_desc_create(std::shared_ptr<primitive_desc_t> &pd,
 
     auto desc = concat_desc_t(
             primitive_kind::concat, dst_md, n, concat_dim, src_mds);
+    max_threads_limit_guard_t max_threads_guard(attr->max_threads_);
     primitive_hashing::key_t key(
             engine, reinterpret_cast<op_desc_t *>(&desc), attr, 0, {}, -1);
     pd = primitive_cache().get_pd(key);
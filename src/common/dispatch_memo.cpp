@@ -0,0 +1,106 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+#include <unordered_map>
+
+#include "common/dispatch_memo.hpp"
+#include "common/opdesc.hpp"
+#include "common/primitive_attr.hpp"
+#include "common/rw_mutex.hpp"
+#include "common/utils.hpp"
+#include "common/verbose.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace dispatch_memo {
+
+namespace {
+
+struct entry_t {
+    // The key stored in the map points to these copies, the user-provided
+    // descriptor and attributes do not outlive the lookup.
+    std::unique_ptr<op_desc_t> op_desc;
+    std::unique_ptr<primitive_attr_t> attr;
+    int impl_idx;
+};
+
+struct memo_t {
+    memo_t(int capacity) : capacity_(capacity) {}
+
+    int get(const primitive_hashing::key_t &key) {
+        utils::lock_read_t lock(rw_mutex_);
+        const auto it = map_.find(key);
+        return it == map_.end() ? -1 : it->second.impl_idx;
+    }
+
+    void put(const primitive_hashing::key_t &key, int impl_idx) {
+        entry_t entry;
+        entry.op_desc = key.op_desc_->clone();
+        entry.attr = utils::make_unique<primitive_attr_t>(*key.attr_);
+        entry.impl_idx = impl_idx;
+        if (!entry.op_desc || !entry.attr) return;
+
+        utils::lock_write_t lock(rw_mutex_);
+        // The memo stores indices only and refilling it is cheap, so it is
+        // simply cleared when full instead of tracking the usage.
+        if ((int)map_.size() >= capacity_) map_.clear();
+        auto res = map_.emplace(key, std::move(entry));
+        if (!res.second) {
+            res.first->second.impl_idx = impl_idx;
+            return;
+        }
+        res.first->first.op_desc_ = res.first->second.op_desc.get();
+        res.first->first.attr_ = res.first->second.attr.get();
+    }
+
+    int capacity() const { return capacity_; }
+
+private:
+    const int capacity_;
+    utils::rw_mutex_t rw_mutex_;
+    std::unordered_map<primitive_hashing::key_t, entry_t> map_;
+};
+
+memo_t &global_memo() {
+    static memo_t memo(getenv_int_user("DISPATCH_MEMO_CAPACITY", 1024));
+    return memo;
+}
+
+bool is_memoizable(const primitive_hashing::key_t &key) {
+    // Engine IDs with runtime dependencies keep device resources alive,
+    // which must not happen in a static object destroyed at exit. The
+    // dispatch verbose mode reports every rejected candidate, so the walk is
+    // not shortened when it is enabled.
+    return global_memo().capacity() > 0 && !key.has_runtime_dependencies()
+            && !get_verbose(verbose_t::create_dispatch);
+}
+
+} // namespace
+
+int get(const primitive_hashing::key_t &key) {
+    if (!is_memoizable(key)) return -1;
+    return global_memo().get(key);
+}
+
+void put(const primitive_hashing::key_t &key, int impl_idx) {
+    if (!is_memoizable(key)) return;
+    global_memo().put(key, impl_idx);
+}
+
+} // namespace dispatch_memo
+} // namespace impl
+} // namespace dnnl
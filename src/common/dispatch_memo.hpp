@@ -0,0 +1,45 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_DISPATCH_MEMO_HPP
+#define COMMON_DISPATCH_MEMO_HPP
+
+#include "common/primitive_hashing.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace dispatch_memo {
+
+// Remembers which entry of an implementation list accepted a problem, so
+// that creating a primitive descriptor for the same problem again does not
+// call init() on the candidates that rejected it. The memo is keyed by the
+// primitive cache key and only holds problems for engines without runtime
+// dependencies. The capacity is set with ONEDNN_DISPATCH_MEMO_CAPACITY;
+// zero disables the memo.
+
+// Returns the index of the implementation that accepted the problem
+// described by `key`, or -1 if it is unknown.
+int get(const primitive_hashing::key_t &key);
+
+// Records that the implementation at `impl_idx` accepted the problem
+// described by `key`.
+void put(const primitive_hashing::key_t &key, int impl_idx);
+
+} // namespace dispatch_memo
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -100,6 +100,8 @@ const char *dnnl_sparse_encoding2str(dnnl_sparse_encoding_t v) {
     if (v == dnnl_csr) return "csr";
     if (v == dnnl_packed) return "packed";
     if (v == dnnl_coo) return "coo";
+    if (v == dnnl_bsr) return "bsr";
+    if (v == dnnl_packed_2_4) return "packed_2_4";
     assert(!"unknown sparse_encoding");
     return "unknown sparse_encoding";
 }
@@ -1785,6 +1787,10 @@ const char *dnnl_prim_kind2str(dnnl_primitive_kind_t v) {
     if (v == dnnl_softmax) return "softmax";
     if (v == dnnl_layer_normalization) return "layer_normalization";
     if (v == dnnl_group_normalization) return "group_normalization";
+    if (v == dnnl_split) return "split";
+    if (v == dnnl_gather) return "gather";
+    if (v == dnnl_topk) return "topk";
+    if (v == dnnl_optimizer) return "optimizer";
     if (v == dnnl_primitive_kind_max) return "primitive_kind_max";
     if (v == dnnl::impl::primitive_kind::sdpa) return "sdpa";
     assert(!"unknown prim_kind");
@@ -1829,6 +1835,8 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
     if (v == dnnl_pooling_max) return "pooling_max";
     if (v == dnnl_pooling_avg_include_padding) return "pooling_avg_include_padding";
     if (v == dnnl_pooling_avg_exclude_padding) return "pooling_avg_exclude_padding";
+    if (v == dnnl_pooling_adaptive_max) return "pooling_adaptive_max";
+    if (v == dnnl_pooling_adaptive_avg) return "pooling_adaptive_avg";
     if (v == dnnl_lrn_across_channels) return "lrn_across_channels";
     if (v == dnnl_lrn_within_channel) return "lrn_within_channel";
     if (v == dnnl_vanilla_rnn) return "vanilla_rnn";
@@ -1861,8 +1869,16 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
     if (v == dnnl_reduction_norm_lp_sum) return "reduction_norm_lp_sum";
     if (v == dnnl_reduction_norm_lp_power_p_max) return "reduction_norm_lp_power_p_max";
     if (v == dnnl_reduction_norm_lp_power_p_sum) return "reduction_norm_lp_power_p_sum";
+    if (v == dnnl_resampling_cubic) return "resampling_cubic";
+    if (v == dnnl_resampling_linear_antialias) return "resampling_linear_antialias";
     if (v == dnnl_softmax_accurate) return "softmax_accurate";
     if (v == dnnl_softmax_log) return "softmax_log";
+    if (v == dnnl_gather_none) return "gather_none";
+    if (v == dnnl_gather_sum) return "gather_sum";
+    if (v == dnnl_gather_mean) return "gather_mean";
+    if (v == dnnl_optimizer_sgd) return "optimizer_sgd";
+    if (v == dnnl_optimizer_adam) return "optimizer_adam";
+    if (v == dnnl_optimizer_adamw) return "optimizer_adamw";
     if (v == dnnl::impl::alg_kind::softmax_accurate_inf_as_zero) return "softmax_accurate_inf_as_zero";
     assert(!"unknown alg_kind");
     return "unknown alg_kind";
@@ -1871,6 +1887,7 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
 const char *dnnl_rnn_flags2str(dnnl_rnn_flags_t v) {
     if (v == dnnl_rnn_flags_undef) return "undef";
     if (v == dnnl_rnn_flags_diff_weights_overwrite) return "rnn_flags_diff_weights_overwrite";
+    if (v == dnnl_rnn_flags_seq_lengths) return "rnn_flags_seq_lengths";
     assert(!"unknown rnn_flags");
     return "unknown rnn_flags";
 }
@@ -18,6 +18,7 @@
 #define COMMON_DNNL_THREAD_HPP
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <mutex>
 
@@ -52,6 +53,20 @@
 #include "common/ittnotify.hpp"
 #endif
 
+#include "common/exec_trace.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// Applies the limit set by max_threads_limit_guard_t to `nthr`.
+inline int apply_max_threads_limit(int nthr) {
+    const int limit = get_max_threads_limit();
+    return limit > 0 ? std::min(nthr, limit) : nthr;
+}
+
+} // namespace impl
+} // namespace dnnl
+
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_SEQ
 #define DNNL_THR_SYNC 1
 inline int dnnl_get_max_threads() {
@@ -66,7 +81,7 @@ inline void dnnl_thr_barrier() {}
 #include "omp.h"
 #define DNNL_THR_SYNC 1
 inline int dnnl_get_max_threads() {
-    return omp_get_max_threads();
+    return dnnl::impl::apply_max_threads_limit(omp_get_max_threads());
 }
 inline int dnnl_in_parallel() {
     return omp_in_parallel();
@@ -81,7 +96,8 @@ inline void dnnl_thr_barrier() {
 
 #define DNNL_THR_SYNC 0
 inline int dnnl_get_max_threads() {
-    return tbb::this_task_arena::max_concurrency();
+    return dnnl::impl::apply_max_threads_limit(
+            tbb::this_task_arena::max_concurrency());
 }
 inline int dnnl_in_parallel() {
     return 0;
@@ -135,7 +151,8 @@ inline int dnnl_get_max_threads() {
 
     // Use the default max_concurrency only when no tp is passed by
     // user (e.g. primitive creation).
-    return tp ? std::max(1, tp->get_num_threads()) : max_concurrency;
+    return dnnl::impl::apply_max_threads_limit(
+            tp ? std::max(1, tp->get_num_threads()) : max_concurrency);
 }
 inline int dnnl_in_parallel() {
     using namespace dnnl::impl::threadpool_utils;
@@ -163,9 +180,10 @@ inline void dnnl_thr_barrier() {
 inline int dnnl_get_current_num_threads() {
     if (dnnl_in_parallel()) return 1;
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
-    return omp_get_max_threads();
+    return dnnl::impl::apply_max_threads_limit(omp_get_max_threads());
 #elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
-    return tbb::this_task_arena::max_concurrency();
+    return dnnl::impl::apply_max_threads_limit(
+            tbb::this_task_arena::max_concurrency());
 #elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
     using namespace dnnl::impl::threadpool_utils;
     dnnl::threadpool_interop::threadpool_iface *tp = get_active_threadpool();
@@ -245,6 +263,17 @@ void balance2D(U nthr, U ithr, T ny, T &ny_start, T &ny_end, T nx, T &nx_start,
     balance211(ny, grp_nthr, grp_ithr, ny_start, ny_end);
 }
 
+// Returns whether parallel_nd() hands out work to threads dynamically, in
+// chunks, instead of splitting it statically. The dynamic schedule keeps
+// fast cores busy on CPUs with cores of different types. The mode is set with
+// ONEDNN_PARALLEL_ND_SCHEDULE=static|dynamic and is dynamic by default on
+// hybrid CPUs only.
+bool DNNL_API use_dynamic_nd_schedule();
+
+// Overrides the schedule selected by use_dynamic_nd_schedule(). Returns the
+// previous setting. For testing only.
+bool DNNL_API set_dynamic_nd_schedule(bool dynamic);
+
 /* Functions:
  *  - parallel(nthr, f)                  - executes f in parallel using at
  *                                         most nthr threads. If nthr equals
@@ -256,7 +285,9 @@ void balance2D(U nthr, U ithr, T ny, T &ny_start, T &ny_end, T nx, T &nx_start,
  *                                         already created threads that passes
  *                                         ithr and nthr
  *  - parallel_nd(dims..., f)            - creates a parallel section and then
- *                                         calls for_nd
+ *                                         calls for_nd, or hands out chunks
+ *                                         of work dynamically, see
+ *                                         use_dynamic_nd_schedule()
  *  - parallel_nd_ext(nthr, dims..., f)  - creates a parallel section and then
  *                                         calls for_nd_ext
  */
@@ -271,8 +302,9 @@ inline int adjust_num_threads(int nthr, dim_t work_amount) {
 #endif
 }
 
-static inline void parallel(int nthr, const std::function<void(int, int)> &f) {
-    nthr = adjust_num_threads(nthr, INT64_MAX);
+static inline void parallel_impl(
+        int nthr, const std::function<void(int, int)> &f) {
+    nthr = apply_max_threads_limit(adjust_num_threads(nthr, INT64_MAX));
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_SEQ
     for (int i = 0; i < nthr; ++i) {
         f(i, nthr);
@@ -353,6 +385,24 @@ static inline void parallel(int nthr, const std::function<void(int, int)> &f) {
 #endif
 }
 
+static inline void parallel(int nthr, const std::function<void(int, int)> &f) {
+    if (!exec_trace::is_enabled()) {
+        parallel_impl(nthr, f);
+        return;
+    }
+    // Record a slice per task and attribute it to the executed primitive.
+    const uint64_t primitive_id = exec_trace::get_current_primitive();
+    parallel_impl(nthr, [&](int ithr, int nthr_) {
+        const bool prev_tracking = exec_trace::begin_task();
+        const uint64_t start_ns = exec_trace::now_ns();
+        f(ithr, nthr_);
+        const uint64_t end_ns = exec_trace::now_ns();
+        const uint64_t kernel_id = exec_trace::end_task(prev_tracking);
+        exec_trace::record_task(
+                primitive_id, start_ns, end_ns, ithr, nthr_, kernel_id);
+    });
+}
+
 // XXX: IMPORTANT!!!
 // Keep the functions below static.
 //
@@ -361,20 +411,14 @@ static inline void parallel(int nthr, const std::function<void(int, int)> &f) {
 // benchdnn on macOS with Intel 2021 compiler.
 
 /* for_nd section */
-static inline void for_nd(const int ithr, const int nthr, dim_t D0,
+// Iterates over the items [start, end) of the multidimensional space.
+static inline void for_nd_range(dim_t start, dim_t end, dim_t D0,
         const std::function<void(dim_t)> &f) {
-    dim_t start {0}, end {0};
-    balance211(D0, nthr, ithr, start, end);
     for (dim_t d0 = start; d0 < end; ++d0)
         f(d0);
 }
-static inline void for_nd(const int ithr, const int nthr, dim_t D0, dim_t D1,
+static inline void for_nd_range(dim_t start, dim_t end, dim_t D0, dim_t D1,
         const std::function<void(dim_t, dim_t)> &f) {
-    const dim_t work_amount = D0 * D1;
-    if (work_amount == 0) return;
-    dim_t start {0}, end {0};
-    balance211(work_amount, nthr, ithr, start, end);
-
     dim_t d0 {0}, d1 {0};
     utils::nd_iterator_init(start, d0, D0, d1, D1);
     for (dim_t iwork = start; iwork < end; ++iwork) {
@@ -382,13 +426,8 @@ static inline void for_nd(const int ithr, const int nthr, dim_t D0, dim_t D1,
         utils::nd_iterator_step(d0, D0, d1, D1);
     }
 }
-static inline void for_nd(const int ithr, const int nthr, dim_t D0, dim_t D1,
+static inline void for_nd_range(dim_t start, dim_t end, dim_t D0, dim_t D1,
         dim_t D2, const std::function<void(dim_t, dim_t, dim_t)> &f) {
-    const dim_t work_amount = D0 * D1 * D2;
-    if (work_amount == 0) return;
-    dim_t start {0}, end {0};
-    balance211(work_amount, nthr, ithr, start, end);
-
     dim_t d0 {0}, d1 {0}, d2 {0};
     utils::nd_iterator_init(start, d0, D0, d1, D1, d2, D2);
     for (dim_t iwork = start; iwork < end; ++iwork) {
@@ -396,14 +435,9 @@ static inline void for_nd(const int ithr, const int nthr, dim_t D0, dim_t D1,
         utils::nd_iterator_step(d0, D0, d1, D1, d2, D2);
     }
 }
-static inline void for_nd(const int ithr, const int nthr, dim_t D0, dim_t D1,
+static inline void for_nd_range(dim_t start, dim_t end, dim_t D0, dim_t D1,
         dim_t D2, dim_t D3,
         const std::function<void(dim_t, dim_t, dim_t, dim_t)> &f) {
-    const dim_t work_amount = D0 * D1 * D2 * D3;
-    if (work_amount == 0) return;
-    dim_t start {0}, end {0};
-    balance211(work_amount, nthr, ithr, start, end);
-
     dim_t d0 {0}, d1 {0}, d2 {0}, d3 {0};
     utils::nd_iterator_init(start, d0, D0, d1, D1, d2, D2, d3, D3);
     for (dim_t iwork = start; iwork < end; ++iwork) {
@@ -411,14 +445,9 @@ static inline void for_nd(const int ithr, const int nthr, dim_t D0, dim_t D1,
         utils::nd_iterator_step(d0, D0, d1, D1, d2, D2, d3, D3);
     }
 }
-static inline void for_nd(const int ithr, const int nthr, dim_t D0, dim_t D1,
+static inline void for_nd_range(dim_t start, dim_t end, dim_t D0, dim_t D1,
         dim_t D2, dim_t D3, dim_t D4,
         const std::function<void(dim_t, dim_t, dim_t, dim_t, dim_t)> &f) {
-    const dim_t work_amount = D0 * D1 * D2 * D3 * D4;
-    if (work_amount == 0) return;
-    dim_t start {0}, end {0};
-    balance211(work_amount, nthr, ithr, start, end);
-
     dim_t d0 {0}, d1 {0}, d2 {0}, d3 {0}, d4 {0};
     utils::nd_iterator_init(start, d0, D0, d1, D1, d2, D2, d3, D3, d4, D4);
     for (dim_t iwork = start; iwork < end; ++iwork) {
@@ -426,15 +455,10 @@ static inline void for_nd(const int ithr, const int nthr, dim_t D0, dim_t D1,
         utils::nd_iterator_step(d0, D0, d1, D1, d2, D2, d3, D3, d4, D4);
     }
 }
-static inline void for_nd(const int ithr, const int nthr, dim_t D0, dim_t D1,
+static inline void for_nd_range(dim_t start, dim_t end, dim_t D0, dim_t D1,
         dim_t D2, dim_t D3, dim_t D4, dim_t D5,
         const std::function<void(dim_t, dim_t, dim_t, dim_t, dim_t, dim_t)>
                 &f) {
-    const dim_t work_amount = D0 * D1 * D2 * D3 * D4 * D5;
-    if (work_amount == 0) return;
-    dim_t start {0}, end {0};
-    balance211(work_amount, nthr, ithr, start, end);
-
     dim_t d0 {0}, d1 {0}, d2 {0}, d3 {0}, d4 {0}, d5 {0};
     utils::nd_iterator_init(
             start, d0, D0, d1, D1, d2, D2, d3, D3, d4, D4, d5, D5);
@@ -444,6 +468,57 @@ static inline void for_nd(const int ithr, const int nthr, dim_t D0, dim_t D1,
     }
 }
 
+static inline void for_nd(const int ithr, const int nthr, dim_t D0,
+        const std::function<void(dim_t)> &f) {
+    dim_t start {0}, end {0};
+    balance211(D0, nthr, ithr, start, end);
+    for_nd_range(start, end, D0, f);
+}
+static inline void for_nd(const int ithr, const int nthr, dim_t D0, dim_t D1,
+        const std::function<void(dim_t, dim_t)> &f) {
+    const dim_t work_amount = D0 * D1;
+    if (work_amount == 0) return;
+    dim_t start {0}, end {0};
+    balance211(work_amount, nthr, ithr, start, end);
+    for_nd_range(start, end, D0, D1, f);
+}
+static inline void for_nd(const int ithr, const int nthr, dim_t D0, dim_t D1,
+        dim_t D2, const std::function<void(dim_t, dim_t, dim_t)> &f) {
+    const dim_t work_amount = D0 * D1 * D2;
+    if (work_amount == 0) return;
+    dim_t start {0}, end {0};
+    balance211(work_amount, nthr, ithr, start, end);
+    for_nd_range(start, end, D0, D1, D2, f);
+}
+static inline void for_nd(const int ithr, const int nthr, dim_t D0, dim_t D1,
+        dim_t D2, dim_t D3,
+        const std::function<void(dim_t, dim_t, dim_t, dim_t)> &f) {
+    const dim_t work_amount = D0 * D1 * D2 * D3;
+    if (work_amount == 0) return;
+    dim_t start {0}, end {0};
+    balance211(work_amount, nthr, ithr, start, end);
+    for_nd_range(start, end, D0, D1, D2, D3, f);
+}
+static inline void for_nd(const int ithr, const int nthr, dim_t D0, dim_t D1,
+        dim_t D2, dim_t D3, dim_t D4,
+        const std::function<void(dim_t, dim_t, dim_t, dim_t, dim_t)> &f) {
+    const dim_t work_amount = D0 * D1 * D2 * D3 * D4;
+    if (work_amount == 0) return;
+    dim_t start {0}, end {0};
+    balance211(work_amount, nthr, ithr, start, end);
+    for_nd_range(start, end, D0, D1, D2, D3, D4, f);
+}
+static inline void for_nd(const int ithr, const int nthr, dim_t D0, dim_t D1,
+        dim_t D2, dim_t D3, dim_t D4, dim_t D5,
+        const std::function<void(dim_t, dim_t, dim_t, dim_t, dim_t, dim_t)>
+                &f) {
+    const dim_t work_amount = D0 * D1 * D2 * D3 * D4 * D5;
+    if (work_amount == 0) return;
+    dim_t start {0}, end {0};
+    balance211(work_amount, nthr, ithr, start, end);
+    for_nd_range(start, end, D0, D1, D2, D3, D4, D5, f);
+}
+
 /* for_nd_ext section */
 static inline void for_nd_ext(const int ithr, const int nthr, dim_t D0,
         const std::function<void(int, int, dim_t)> &f) {
@@ -590,16 +665,38 @@ static inline void parallel_nd_ext(int nthr, dim_t D0, dim_t D1, dim_t D2,
 }
 
 /* parallel_nd section */
+// Splits [0, work_amount) into chunks that the threads of a parallel region
+// take one after another, so that faster threads process more of them.
+static inline void parallel_nd_dynamic(int nthr, dim_t work_amount,
+        const std::function<void(dim_t, dim_t)> &f) {
+    // A few chunks per thread keep the contention on the counter low and
+    // still let threads running at different speeds even out.
+    const dim_t chunk = utils::div_up(work_amount, (dim_t)nthr * 4);
+    std::atomic<dim_t> next {0};
+    parallel(nthr, [&](int, int) {
+        for (dim_t start = next.fetch_add(chunk); start < work_amount;
+                start = next.fetch_add(chunk))
+            f(start, nstl::min(work_amount, start + chunk));
+    });
+}
+
 static inline void parallel_nd(dim_t D0, const std::function<void(dim_t)> &f) {
     int nthr = adjust_num_threads(dnnl_get_current_num_threads(), D0);
-    if (nthr)
+    if (nthr > 1 && use_dynamic_nd_schedule())
+        parallel_nd_dynamic(nthr, D0,
+                [&](dim_t start, dim_t end) { for_nd_range(start, end, D0, f); });
+    else if (nthr)
         parallel(nthr, [&](int ithr, int nthr) { for_nd(ithr, nthr, D0, f); });
 }
 static inline void parallel_nd(
         dim_t D0, dim_t D1, const std::function<void(dim_t, dim_t)> &f) {
     const dim_t work_amount = D0 * D1;
     int nthr = adjust_num_threads(dnnl_get_current_num_threads(), work_amount);
-    if (nthr)
+    if (nthr > 1 && use_dynamic_nd_schedule())
+        parallel_nd_dynamic(nthr, work_amount, [&](dim_t start, dim_t end) {
+            for_nd_range(start, end, D0, D1, f);
+        });
+    else if (nthr)
         parallel(nthr,
                 [&](int ithr, int nthr) { for_nd(ithr, nthr, D0, D1, f); });
 }
@@ -607,7 +704,11 @@ static inline void parallel_nd(dim_t D0, dim_t D1, dim_t D2,
         const std::function<void(dim_t, dim_t, dim_t)> &f) {
     const dim_t work_amount = D0 * D1 * D2;
     int nthr = adjust_num_threads(dnnl_get_current_num_threads(), work_amount);
-    if (nthr)
+    if (nthr > 1 && use_dynamic_nd_schedule())
+        parallel_nd_dynamic(nthr, work_amount, [&](dim_t start, dim_t end) {
+            for_nd_range(start, end, D0, D1, D2, f);
+        });
+    else if (nthr)
         parallel(nthr,
                 [&](int ithr, int nthr) { for_nd(ithr, nthr, D0, D1, D2, f); });
 }
@@ -615,7 +716,11 @@ static inline void parallel_nd(dim_t D0, dim_t D1, dim_t D2, dim_t D3,
         const std::function<void(dim_t, dim_t, dim_t, dim_t)> &f) {
     const dim_t work_amount = D0 * D1 * D2 * D3;
     int nthr = adjust_num_threads(dnnl_get_current_num_threads(), work_amount);
-    if (nthr)
+    if (nthr > 1 && use_dynamic_nd_schedule())
+        parallel_nd_dynamic(nthr, work_amount, [&](dim_t start, dim_t end) {
+            for_nd_range(start, end, D0, D1, D2, D3, f);
+        });
+    else if (nthr)
         parallel(nthr, [&](int ithr, int nthr) {
             for_nd(ithr, nthr, D0, D1, D2, D3, f);
         });
@@ -624,7 +729,11 @@ static inline void parallel_nd(dim_t D0, dim_t D1, dim_t D2, dim_t D3, dim_t D4,
         const std::function<void(dim_t, dim_t, dim_t, dim_t, dim_t)> &f) {
     const dim_t work_amount = D0 * D1 * D2 * D3 * D4;
     int nthr = adjust_num_threads(dnnl_get_current_num_threads(), work_amount);
-    if (nthr)
+    if (nthr > 1 && use_dynamic_nd_schedule())
+        parallel_nd_dynamic(nthr, work_amount, [&](dim_t start, dim_t end) {
+            for_nd_range(start, end, D0, D1, D2, D3, D4, f);
+        });
+    else if (nthr)
         parallel(nthr, [&](int ithr, int nthr) {
             for_nd(ithr, nthr, D0, D1, D2, D3, D4, f);
         });
@@ -635,12 +744,15 @@ static inline void parallel_nd(dim_t D0, dim_t D1, dim_t D2, dim_t D3, dim_t D4,
                 &f) {
     const dim_t work_amount = D0 * D1 * D2 * D3 * D4 * D5;
     int nthr = adjust_num_threads(dnnl_get_current_num_threads(), work_amount);
-    if (nthr)
+    if (nthr > 1 && use_dynamic_nd_schedule())
+        parallel_nd_dynamic(nthr, work_amount, [&](dim_t start, dim_t end) {
+            for_nd_range(start, end, D0, D1, D2, D3, D4, D5, f);
+        });
+    else if (nthr)
         parallel(nthr, [&](int ithr, int nthr) {
             for_nd(ithr, nthr, D0, D1, D2, D3, D4, D5, f);
         });
 }
-
 } // namespace impl
 } // namespace dnnl
 
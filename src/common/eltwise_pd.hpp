@@ -83,16 +83,28 @@ struct eltwise_pd_t : public primitive_desc_t {
         return memory_desc_wrapper(data_md()).has_zero_dim();
     }
 
-    bool use_dst() const {
+    // Whether the backward pass of the algorithm is computed from the
+    // destination rather than from the source.
+    bool is_alg_use_dst_for_bwd() const {
         using namespace alg_kind;
-        return !is_fwd()
-                && utils::one_of(desc_.alg_kind, eltwise_relu_use_dst_for_bwd,
-                        eltwise_tanh_use_dst_for_bwd,
-                        eltwise_elu_use_dst_for_bwd,
-                        eltwise_sqrt_use_dst_for_bwd,
-                        eltwise_logistic_use_dst_for_bwd,
-                        eltwise_exp_use_dst_for_bwd,
-                        eltwise_clip_v2_use_dst_for_bwd);
+        return utils::one_of(desc_.alg_kind, eltwise_relu_use_dst_for_bwd,
+                eltwise_tanh_use_dst_for_bwd, eltwise_elu_use_dst_for_bwd,
+                eltwise_sqrt_use_dst_for_bwd, eltwise_logistic_use_dst_for_bwd,
+                eltwise_exp_use_dst_for_bwd, eltwise_clip_v2_use_dst_for_bwd);
+    }
+
+    bool use_dst() const { return !is_fwd() && is_alg_use_dst_for_bwd(); }
+
+    // Whether the tensor used by the backward pass is kept in the workspace
+    // in a lower precision.
+    bool with_activation_stash() const {
+        return attr()->activation_stash_dt_ != data_type::undef
+                && desc_.prop_kind != prop_kind::forward_inference;
+    }
+
+    const memory_desc_t *workspace_md(int index = 0) const override {
+        return index == 0 && !types::is_zero_md(&ws_md_) ? &ws_md_
+                                                        : &glob_zero_md;
     }
 
 protected:
@@ -101,6 +113,7 @@ protected:
 
     memory_desc_t src_md_;
     memory_desc_t dst_md_;
+    memory_desc_t ws_md_;
 
     eltwise_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
             const eltwise_fwd_pd_t *hint_fwd_pd)
@@ -108,7 +121,22 @@ protected:
         , desc_(*op_desc_t::to_desc<eltwise_desc_t>(adesc))
         , hint_fwd_pd_(hint_fwd_pd)
         , src_md_(desc_.src_desc)
-        , dst_md_(desc_.dst_desc) {}
+        , dst_md_(desc_.dst_desc)
+        , ws_md_(glob_zero_md) {}
+
+    // Initializes the workspace for the activation stash as a dense copy of
+    // the data tensor. Requires the data tensor to be dense.
+    status_t init_activation_stash_ws(const memory_desc_t &data_md) {
+        if (!with_activation_stash()) return status::success;
+        const memory_desc_wrapper data_d(&data_md);
+        if (!data_d.is_blocking_desc() || !data_d.is_dense(true))
+            return status::unimplemented;
+        ws_md_ = data_md;
+        ws_md_.data_type = attr()->activation_stash_dt_;
+        ws_md_.offset0 = 0;
+        ws_md_.extra = memory_extra_desc_t();
+        return status::success;
+    }
 
 private:
     const memory_desc_t *data_md(int index = 0) const {
@@ -126,6 +154,10 @@ struct eltwise_fwd_pd_t : public eltwise_pd_t {
 
         if (arg == DNNL_ARG_DST) return arg_usage_t::output;
 
+        if (arg == DNNL_ARG_WORKSPACE)
+            return !types::is_zero_md(workspace_md()) ? arg_usage_t::output
+                                                      : arg_usage_t::unused;
+
         return primitive_desc_t::arg_usage(arg);
     }
 
@@ -150,7 +182,9 @@ struct eltwise_fwd_pd_t : public eltwise_pd_t {
     }
 
     int n_inputs() const override { return 1 + n_binary_po_inputs(); }
-    int n_outputs() const override { return 1; }
+    int n_outputs() const override {
+        return 1 + !types::is_zero_md(workspace_md());
+    }
 
     static bool eltwise_preserves_zero(
             alg_kind_t alg, float alpha, float beta) {
@@ -199,10 +233,16 @@ struct eltwise_bwd_pd_t : public eltwise_pd_t {
     using hint_class = eltwise_fwd_pd_t;
 
     arg_usage_t arg_usage(int arg) const override {
+        // The stashed copy replaces the source or the destination.
+        const bool with_ws = !types::is_zero_md(workspace_md());
         if (arg == DNNL_ARG_SRC)
-            return !use_dst() ? arg_usage_t::input : arg_usage_t::unused;
+            return !use_dst() && !with_ws ? arg_usage_t::input
+                                          : arg_usage_t::unused;
         if (arg == DNNL_ARG_DST)
-            return use_dst() ? arg_usage_t::input : arg_usage_t::unused;
+            return use_dst() && !with_ws ? arg_usage_t::input
+                                         : arg_usage_t::unused;
+        if (arg == DNNL_ARG_WORKSPACE)
+            return with_ws ? arg_usage_t::input : arg_usage_t::unused;
 
         if (arg == DNNL_ARG_DIFF_DST) return arg_usage_t::input;
         if (arg == DNNL_ARG_DIFF_SRC) return arg_usage_t::output;
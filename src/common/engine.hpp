@@ -80,6 +80,13 @@ struct dnnl_engine : public dnnl::impl::c_compatible {
                 storage, dnnl::impl::memory_flags_t::alloc, size, nullptr);
     }
 
+    /** create memory storage backed by a mapping of a file region */
+    virtual dnnl::impl::status_t create_mapped_memory_storage(
+            dnnl::impl::memory_storage_t **storage, int fd, size_t offset,
+            size_t size, unsigned map_flags) {
+        return dnnl::impl::status::unimplemented;
+    }
+
     /** create stream */
     virtual dnnl::impl::status_t create_stream(dnnl::impl::stream_t **stream,
             dnnl::impl::stream_impl_t *stream_impl)
@@ -120,6 +127,11 @@ struct dnnl_engine : public dnnl::impl::c_compatible {
     virtual const dnnl::impl::impl_list_item_t *
     get_concat_implementation_list() const = 0;
 
+    /** return the list of split implementations. engine guarantees to return
+     * a NULL-terminated list */
+    virtual const dnnl::impl::impl_list_item_t *
+    get_split_implementation_list() const = 0;
+
     /** return the list of sum implementations. engine guarantees to return
      * a NULL-terminated list */
     virtual const dnnl::impl::impl_list_item_t *
@@ -149,6 +161,9 @@ struct dnnl_engine : public dnnl::impl::c_compatible {
     }
 
     virtual bool mayiuse_system_memory_allocators() const { return false; }
+    // Returns true if the device and the host share physical memory, so that
+    // host and shared USM allocations are accessed without migration.
+    virtual bool has_host_unified_memory() const { return false; }
     virtual bool mayiuse_f16_accumulator_with_f16() const { return false; }
 
     const dnnl::impl::engine_impl_t *impl() const { return impl_.get(); }
@@ -0,0 +1,368 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/exec_trace.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/primitive_exec_types.hpp"
+#include "common/utils.hpp"
+#include "common/verbose.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace exec_trace {
+
+namespace {
+
+constexpr uint32_t version = 3;
+constexpr size_t default_capacity = 65536;
+
+// Single-writer ring. The owning thread publishes each record by advancing
+// `head`; readers detect records overwritten during a copy by re-reading it.
+struct ring_t {
+    ring_t(uint32_t index, size_t capacity)
+        : index(index), records(capacity) {}
+
+    void push(const record_t &r) {
+        const uint64_t h = head.load(std::memory_order_relaxed);
+        records[h % records.size()] = r;
+        head.store(h + 1, std::memory_order_release);
+    }
+
+    std::vector<record_t> snapshot() const {
+        const size_t cap = records.size();
+        const uint64_t end = head.load(std::memory_order_acquire);
+        const uint64_t begin = end > cap ? end - cap : 0;
+        std::vector<record_t> out;
+        out.reserve(static_cast<size_t>(end - begin));
+        for (uint64_t i = begin; i < end; i++)
+            out.push_back(records[i % cap]);
+        // Drop the records the writer may have overwritten meanwhile. The
+        // record at `new_end` may be in the middle of being written, so its
+        // slot is not valid either.
+        const uint64_t new_end = head.load(std::memory_order_acquire);
+        const uint64_t valid_begin
+                = new_end + 1 > cap ? new_end + 1 - cap : 0;
+        if (valid_begin > begin) {
+            const size_t n_stale = static_cast<size_t>(
+                    std::min(valid_begin - begin, end - begin));
+            out.erase(out.begin(), out.begin() + n_stale);
+        }
+        return out;
+    }
+
+    const uint32_t index;
+    std::vector<record_t> records;
+    std::atomic<uint64_t> head {0};
+};
+
+// Returns "<data type>:<ndims>d:<nelems>", e.g. "f32:2d:4096".
+std::string arg_summary(const arg_t &a) {
+    if (a.ndims == 0) return "none";
+    return std::string(dnnl_dt2str((data_type_t)a.data_type)) + ":"
+            + std::to_string(a.ndims) + "d:" + std::to_string(a.nelems);
+}
+
+struct trace_t {
+    trace_t() {
+        const size_t capacity = getenv_size_user(
+                "EXEC_TRACE_CAPACITY", default_capacity);
+        char path[4096] = {0};
+        if (getenv("ONEDNN_EXEC_TRACE", path, sizeof(path)) <= 0)
+            getenv("DNNL_EXEC_TRACE", path, sizeof(path));
+        if (path[0] != '\0' && capacity > 0) {
+            path_ = path;
+            capacity_ = capacity;
+        }
+        enabled_flag = capacity_ > 0;
+    }
+
+    ~trace_t() {
+        if (!path_.empty()) dump(path_.c_str());
+    }
+
+    ring_t *get_ring() {
+        // Rings are owned by the trace so that records of finished threads
+        // stay available for the dump.
+        thread_local ring_t *ring = nullptr;
+        thread_local uint64_t ring_generation = 0;
+        if (ring && ring_generation == generation_.load()) return ring;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        const size_t capacity = capacity_.load();
+        if (capacity == 0) return nullptr;
+        rings_.emplace_back(new ring_t((uint32_t)rings_.size(), capacity));
+        ring = rings_.back().get();
+        ring_generation = generation_.load();
+        return ring;
+    }
+
+    uint64_t register_primitive(const char *info) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        primitives_.emplace_back(primitives_.size() + 1, info ? info : "");
+        return primitives_.back().first;
+    }
+
+    status_t dump(const char *path) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const std::string p(path);
+        const std::string json_ext = ".json";
+        if (p.size() >= json_ext.size()
+                && p.compare(p.size() - json_ext.size(), json_ext.size(),
+                           json_ext)
+                        == 0)
+            return dump_chrome(path);
+
+        FILE *f = fopen(path, "wb");
+        if (!f) return status::runtime_error;
+
+        bool ok = true;
+        auto write = [&](const void *data, size_t size) {
+            if (ok && size > 0) ok = std::fwrite(data, size, 1, f) == 1;
+        };
+        const uint32_t record_size = sizeof(record_t);
+        write("DNNLTRC1", 8);
+        write(&version, sizeof(version));
+        write(&record_size, sizeof(record_size));
+
+        const uint64_t n_primitives = primitives_.size();
+        write(&n_primitives, sizeof(n_primitives));
+        for (const auto &p : primitives_) {
+            const uint32_t len = (uint32_t)p.second.size();
+            write(&p.first, sizeof(p.first));
+            write(&len, sizeof(len));
+            write(p.second.data(), len);
+        }
+
+        const uint64_t n_threads = rings_.size();
+        write(&n_threads, sizeof(n_threads));
+        for (const auto &r : rings_) {
+            const auto records = r->snapshot();
+            const uint32_t reserved = 0;
+            const uint64_t n_records = records.size();
+            write(&r->index, sizeof(r->index));
+            write(&reserved, sizeof(reserved));
+            write(&n_records, sizeof(n_records));
+            write(records.data(), records.size() * sizeof(record_t));
+        }
+
+        ok = std::fclose(f) == 0 && ok;
+        return ok ? status::success : status::runtime_error;
+    }
+
+    // Writes the Chrome trace event format with one complete event per
+    // record. Timestamps are in microseconds.
+    status_t dump_chrome(const char *path) const {
+        FILE *f = fopen(path, "w");
+        if (!f) return status::runtime_error;
+
+        std::vector<std::string> names(primitives_.size() + 1, "unknown");
+        for (const auto &p : primitives_) {
+            std::string name;
+            for (char c : p.second) {
+                if (c == '"' || c == '\\') name += '\\';
+                if (static_cast<unsigned char>(c) >= 0x20) name += c;
+            }
+            if (p.first < names.size()) names[p.first] = name;
+        }
+
+        bool ok = std::fprintf(f, "{\"traceEvents\":[") >= 0;
+        const char *sep = "\n";
+        for (const auto &r : rings_) {
+            for (const auto &rec : r->snapshot()) {
+                const size_t id = rec.primitive_id < names.size()
+                        ? (size_t)rec.primitive_id
+                        : 0;
+                const bool is_task = rec.kind == record_kind_t::task;
+                const char *name = names[id].c_str();
+                std::string args;
+                if (is_task) {
+                    args = "\"ithr\":" + std::to_string(rec.ithr)
+                            + ",\"nthr\":" + std::to_string(rec.nthr);
+                    // Tasks that called a JIT kernel are named after it.
+                    if (rec.kernel_id != 0 && rec.kernel_id < names.size()) {
+                        args += ",\"primitive\":\"" + names[id] + "\"";
+                        name = names[rec.kernel_id].c_str();
+                    }
+                } else {
+                    args = "\"nargs\":" + std::to_string(rec.nargs)
+                            + ",\"status\":" + std::to_string(rec.status);
+                    for (int i = 0; i < std::min(rec.nargs, max_args); i++)
+                        args += ",\"" + arg2str(rec.args[i].arg) + "\":\""
+                                + arg_summary(rec.args[i]) + "\"";
+                }
+                ok = ok
+                        && std::fprintf(f,
+                                   "%s{\"name\":\"%s\",\"cat\":\"%s\","
+                                   "\"ph\":\"X\",\"pid\":0,\"tid\":%u,"
+                                   "\"ts\":%.3f,\"dur\":%.3f,"
+                                   "\"args\":{%s}}",
+                                   sep, name, is_task ? "task" : "primitive",
+                                   r->index,
+                                   rec.start_ns / 1e3,
+                                   (rec.end_ns - rec.start_ns) / 1e3,
+                                   args.c_str())
+                                >= 0;
+                sep = ",\n";
+            }
+        }
+        ok = ok && std::fprintf(f, "\n]}\n") >= 0;
+        ok = std::fclose(f) == 0 && ok;
+        return ok ? status::success : status::runtime_error;
+    }
+
+    void set_capacity(size_t capacity) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        capacity_ = capacity;
+        enabled_flag = capacity > 0;
+        // Threads pick up new rings on their next record. The old rings are
+        // released, so that is only safe while nothing is executing.
+        rings_.clear();
+        generation_++;
+    }
+
+    std::string path_;
+    std::atomic<size_t> capacity_ {0};
+    std::atomic<uint64_t> generation_ {0};
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<ring_t>> rings_;
+    std::vector<std::pair<uint64_t, std::string>> primitives_;
+};
+
+trace_t &trace() {
+    static trace_t t;
+    return t;
+}
+
+thread_local uint64_t current_primitive = 0;
+thread_local uint64_t task_kernel = 0;
+
+} // namespace
+
+bool is_enabled() {
+    return trace().capacity_.load(std::memory_order_relaxed) > 0;
+}
+
+uint64_t now_ns() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+}
+
+uint64_t register_primitive(const char *info) {
+    return trace().register_primitive(info);
+}
+
+uint64_t register_kernel(const char *name) {
+    // Primitives and kernels share the table of names.
+    return trace().register_primitive(name);
+}
+
+void record(uint64_t primitive_id, uint64_t start_ns, uint64_t end_ns,
+        const exec_args_t &args, status_t status) {
+    ring_t *ring = trace().get_ring();
+    if (!ring) return;
+    record_t r {};
+    r.primitive_id = primitive_id;
+    r.start_ns = start_ns;
+    r.end_ns = end_ns;
+    r.kind = record_kind_t::exec;
+    r.nargs = (int32_t)args.size();
+    r.status = (int32_t)status;
+
+    // Keep the arguments with the lowest ids, sorted by insertion.
+    int n = 0;
+    for (const auto &a : args) {
+        if (n == max_args && a.first >= r.args[n - 1].arg) continue;
+        int pos = n < max_args ? n++ : n - 1;
+        for (; pos > 0 && r.args[pos - 1].arg > a.first; pos--)
+            r.args[pos] = r.args[pos - 1];
+        arg_t &s = r.args[pos];
+        s = arg_t();
+        s.arg = a.first;
+        if (!a.second.mem) continue;
+        const memory_desc_wrapper mdw(a.second.mem->md());
+        s.data_type = (uint32_t)mdw.data_type();
+        s.format_kind = (uint32_t)mdw.format_kind();
+        s.ndims = mdw.ndims();
+        s.nelems = mdw.nelems();
+    }
+    ring->push(r);
+}
+
+void record_task(uint64_t primitive_id, uint64_t start_ns, uint64_t end_ns,
+        int ithr, int nthr, uint64_t kernel_id) {
+    ring_t *ring = trace().get_ring();
+    if (!ring) return;
+    record_t r {};
+    r.primitive_id = primitive_id;
+    r.start_ns = start_ns;
+    r.end_ns = end_ns;
+    r.kind = record_kind_t::task;
+    r.ithr = ithr;
+    r.nthr = nthr;
+    r.kernel_id = (uint32_t)kernel_id;
+    ring->push(r);
+}
+
+std::atomic<bool> enabled_flag {false};
+thread_local bool tracking_task_kernel = false;
+
+bool begin_task() {
+    const bool prev = tracking_task_kernel;
+    tracking_task_kernel = true;
+    task_kernel = 0;
+    return prev;
+}
+
+uint64_t end_task(bool prev_tracking) {
+    tracking_task_kernel = prev_tracking;
+    return task_kernel;
+}
+
+void set_task_kernel(uint64_t kernel_id) {
+    task_kernel = kernel_id;
+}
+
+uint64_t get_current_primitive() {
+    return current_primitive;
+}
+
+void set_current_primitive(uint64_t primitive_id) {
+    current_primitive = primitive_id;
+}
+
+status_t dump(const char *path) {
+    if (!path) return status::invalid_arguments;
+    return trace().dump(path);
+}
+
+void set_capacity(size_t capacity) {
+    trace().set_capacity(capacity);
+}
+
+} // namespace exec_trace
+} // namespace impl
+} // namespace dnnl
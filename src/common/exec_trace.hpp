@@ -0,0 +1,138 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_EXEC_TRACE_HPP
+#define COMMON_EXEC_TRACE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <unordered_map>
+
+#include "common/c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+
+struct memory_arg_t;
+using exec_args_t = std::unordered_map<int, memory_arg_t>;
+
+namespace exec_trace {
+
+// Binary execution trace. When ONEDNN_EXEC_TRACE is set to a file path, each
+// primitive execution and each task of a parallel section is stored as a
+// fixed-size record in a per-thread ring buffer without any formatting or
+// locking. The buffers are written to the file at process exit or on demand
+// with `dump()`. If the path ends with `.json`, the Chrome trace event format
+// is written, which Perfetto and chrome://tracing can open. Otherwise, the
+// binary format below is written and decoded offline with
+// scripts/exec_trace_decoder.py.
+//
+// Binary file layout (host endianness):
+//   char[8] magic "DNNLTRC1"
+//   uint32_t version, uint32_t record size
+//   uint64_t number of names, then for each:
+//     uint64_t id, uint32_t name length, char[] name
+//     where the name is a primitive info string or a JIT kernel name
+//   uint64_t number of threads, then for each:
+//     uint32_t thread index, uint32_t reserved, uint64_t number of records,
+//     record_t[] records from the oldest to the newest
+//
+// Executions keep a summary of the memory arguments with the lowest
+// `DNNL_ARG_*` values, up to `max_args`. Tasks keep the id of the last CPU
+// JIT kernel they called, if any.
+
+enum record_kind_t : uint32_t {
+    // Execution of a primitive.
+    exec = 0,
+    // Task of a parallel section, `primitive_id` is the executed primitive.
+    task = 1,
+};
+
+constexpr int max_args = 4;
+
+// Summary of a memory argument of an execution.
+struct arg_t {
+    int32_t arg;
+    // dnnl_data_type_t and dnnl_format_kind_t values.
+    uint32_t data_type;
+    uint32_t format_kind;
+    int32_t ndims;
+    int64_t nelems;
+};
+
+struct record_t {
+    uint64_t primitive_id;
+    uint64_t start_ns;
+    uint64_t end_ns;
+    uint32_t kind;
+    // Set for executions.
+    int32_t nargs;
+    int32_t status;
+    // Set for tasks.
+    int32_t ithr;
+    int32_t nthr;
+    uint32_t kernel_id;
+    // Set for executions, the first `min(nargs, max_args)` entries are valid.
+    arg_t args[max_args];
+};
+
+// The functions used by `parallel()` are exported as the threading header is
+// shared with tests.
+bool DNNL_API is_enabled();
+
+uint64_t DNNL_API now_ns();
+
+// Assigns an id to a primitive and stores its info string for the decoder.
+uint64_t register_primitive(const char *info);
+
+void record(uint64_t primitive_id, uint64_t start_ns, uint64_t end_ns,
+        const exec_args_t &args, status_t status);
+
+void DNNL_API record_task(uint64_t primitive_id, uint64_t start_ns,
+        uint64_t end_ns, int ithr, int nthr, uint64_t kernel_id = 0);
+
+// Tracks the JIT kernels called by a task: `begin_task()` starts the tracking
+// on the calling thread and returns the previous state, `end_task()` restores
+// it and returns the id of the last kernel called since, or 0.
+bool DNNL_API begin_task();
+uint64_t DNNL_API end_task(bool prev_tracking);
+
+// Set while a traced task runs on the calling thread. JIT kernels only
+// register themselves when it is set. `enabled_flag` mirrors `is_enabled()`
+// and is checked first, so that calls with the trace disabled only load a
+// global.
+extern std::atomic<bool> enabled_flag;
+extern thread_local bool tracking_task_kernel;
+
+// Assigns an id to a JIT kernel and stores its name for the decoder.
+uint64_t register_kernel(const char *name);
+void set_task_kernel(uint64_t kernel_id);
+
+// Returns the id of the primitive executed by the calling thread or 0.
+uint64_t DNNL_API get_current_primitive();
+void set_current_primitive(uint64_t primitive_id);
+
+// Undocumented API for testing. Writes the recorded trace to `path`.
+status_t DNNL_API dump(const char *path);
+// Undocumented API for testing. Enables the trace with `capacity` records per
+// thread, or disables it if `capacity` is 0.
+void DNNL_API set_capacity(size_t capacity);
+
+} // namespace exec_trace
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -22,7 +22,8 @@ namespace experimental {
 
 // Bnorm expermental feature: calculate mean & variance in single pass over
 // input tensor. Improves performance by 25-33% but uses numerically unstable
-// formula.
+// formula. CPU implementations accumulate data shifted by the first point of
+// each channel to reduce the cancellation error.
 bool DNNL_API use_bnorm_stats_one_pass() {
 #ifdef DNNL_EXPERIMENTAL
     static const bool stats_onepass_algo
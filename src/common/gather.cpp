@@ -0,0 +1,153 @@
+/*******************************************************************************
+* Copyright 2020-2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+#include "opdesc.hpp"
+#include "primitive_desc_iface.hpp"
+
+#include "c_types_map.hpp"
+#include "gather_pd.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::alg_kind;
+
+#define VCHECK_GATHER(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, gather, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__);
+
+#define VCHECK_GATHER_UNIMPL(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, gather, (cond), \
+            status::unimplemented, msg, ##__VA_ARGS__);
+namespace dnnl {
+namespace impl {
+
+status_t gather_desc_init(gather_desc_t *gather_desc, alg_kind_t alg_kind,
+        const memory_desc_t *src_desc, const memory_desc_t *indices_desc,
+        const memory_desc_t *dst_desc) {
+
+    VCHECK_GATHER(!any_null(src_desc, indices_desc, dst_desc),
+            VERBOSE_NULL_ARG);
+    VCHECK_GATHER(one_of(alg_kind, gather_none, gather_sum, gather_mean),
+            VERBOSE_BAD_ALGORITHM);
+
+    VCHECK_GATHER(src_desc->ndims == 2, VERBOSE_BAD_NDIMS, "src",
+            src_desc->ndims);
+    VCHECK_GATHER(indices_desc->ndims == 2, VERBOSE_BAD_NDIMS, "indices",
+            indices_desc->ndims);
+    VCHECK_GATHER(indices_desc->data_type == data_type::s32,
+            VERBOSE_INVALID_DATATYPE, "indices");
+
+    // Without a reduction every index produces its own row of the output.
+    const bool reduce = alg_kind != gather_none;
+    const int dst_ndims = reduce ? 2 : 3;
+    VCHECK_GATHER(dst_desc->ndims == dst_ndims, VERBOSE_BAD_NDIMS, "dst",
+            dst_desc->ndims);
+    VCHECK_GATHER(dst_desc->dims[0] == indices_desc->dims[0],
+            VERBOSE_INCONSISTENT_DIM, "dst", 0, "indices", 0);
+    VCHECK_GATHER(IMPLICATION(!reduce,
+                          dst_desc->dims[1] == indices_desc->dims[1]),
+            VERBOSE_INCONSISTENT_DIM, "dst", 1, "indices", 1);
+    VCHECK_GATHER(dst_desc->dims[dst_ndims - 1] == src_desc->dims[1],
+            VERBOSE_INCONSISTENT_DIM, "dst", dst_ndims - 1, "src", 1);
+
+    VCHECK_GATHER(src_desc->format_kind == format_kind::blocked,
+            VERBOSE_UNSUPPORTED_TAG_S, "src");
+    VCHECK_GATHER(indices_desc->format_kind == format_kind::blocked,
+            VERBOSE_UNSUPPORTED_TAG_S, "indices");
+    VCHECK_GATHER(one_of(dst_desc->format_kind, format_kind::blocked,
+                          format_kind::any),
+            VERBOSE_UNSUPPORTED_TAG_S, "dst");
+
+    VCHECK_GATHER(src_desc->extra.flags == 0, VERBOSE_UNSUPPORTED_MD_FLAG,
+            "src");
+    VCHECK_GATHER(indices_desc->extra.flags == 0, VERBOSE_UNSUPPORTED_MD_FLAG,
+            "indices");
+    VCHECK_GATHER(IMPLICATION(dst_desc->format_kind == format_kind::blocked,
+                          dst_desc->extra.flags == 0),
+            VERBOSE_UNSUPPORTED_MD_FLAG, "dst");
+
+    auto gd = gather_desc_t();
+    gd.primitive_kind = primitive_kind::gather;
+    gd.alg_kind = alg_kind;
+
+    gd.src_desc = *src_desc;
+    gd.indices_desc = *indices_desc;
+    gd.dst_desc = *dst_desc;
+
+    (*gather_desc) = gd;
+    return success;
+}
+
+status_t gather_attr_check(const gather_desc_t &desc, const engine_t *engine,
+        const primitive_attr_t *attr) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    if (attr == nullptr) return status::success;
+    if (attr->has_default_values()) return status::success;
+
+    // Check attributes
+    const data_type_t src_dt = desc.src_desc.data_type;
+    const data_type_t dst_dt = desc.dst_desc.data_type;
+
+    // Quantization parameters describe an integer table and are applied to
+    // the rows before the reduction.
+    auto attr_mask = smask_t::none;
+    const bool is_int8 = one_of(src_dt, data_type::s8, data_type::u8);
+    if (is_int8) attr_mask |= smask_t::scales | smask_t::zero_points;
+
+    VCHECK_GATHER_UNIMPL(attr->has_default_values(attr_mask, dst_dt),
+            VERBOSE_UNSUPPORTED_ATTR);
+
+    // Both a common value (mask = 0) and a value per table row (mask = 1)
+    // are supported.
+    if (!attr->scales_.has_default_values()) {
+        VCHECK_GATHER_UNIMPL(attr->scales_.has_default_values({DNNL_ARG_SRC}),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        VCHECK_GATHER_UNIMPL(
+                one_of(attr->scales_.get_mask(DNNL_ARG_SRC), 0, 1),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+    }
+    if (!attr->zero_points_.has_default_values()) {
+        VCHECK_GATHER_UNIMPL(
+                attr->zero_points_.has_default_values({DNNL_ARG_SRC}),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+        VCHECK_GATHER_UNIMPL(
+                one_of(attr->zero_points_.get_mask(DNNL_ARG_SRC), 0, 1),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+    }
+
+    return status::success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+dnnl_status_t dnnl_gather_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        alg_kind_t alg_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *indices_desc, const memory_desc_t *dst_desc,
+        const primitive_attr_t *attr) {
+
+    auto gather_desc = gather_desc_t();
+    CHECK(gather_desc_init(
+            &gather_desc, alg_kind, src_desc, indices_desc, dst_desc));
+    CHECK(gather_attr_check(gather_desc, engine, attr));
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&gather_desc, nullptr, attr);
+}
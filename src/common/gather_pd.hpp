@@ -0,0 +1,142 @@
+/*******************************************************************************
+* Copyright 2020-2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_GATHER_PD_HPP
+#define COMMON_GATHER_PD_HPP
+
+#include "c_types_map.hpp"
+#include "memory_desc_wrapper.hpp"
+#include "primitive_desc.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#define VDISPATCH_GATHER(cond, msg, ...) \
+    VCONDCHECK(primitive, create, dispatch, gather, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+#define VDISPATCH_GATHER_SC(f, msg, ...) \
+    VCHECK(primitive, create, dispatch, gather, (f), "%s," msg, \
+            this->info(engine), ##__VA_ARGS__)
+
+namespace dnnl {
+namespace impl {
+
+status_t gather_desc_init(gather_desc_t *gather_desc, alg_kind_t alg_kind,
+        const memory_desc_t *src_desc, const memory_desc_t *indices_desc,
+        const memory_desc_t *dst_desc);
+
+// NOLINTBEGIN(google-default-arguments)
+struct gather_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::gather;
+
+    using hint_class = gather_pd_t;
+
+    const gather_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::alg_kind:
+                *(alg_kind_t *)result = desc()->alg_kind;
+                break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC:
+            case DNNL_ARG_INDICES: return arg_usage_t::input;
+            case DNNL_ARG_DST: return arg_usage_t::output;
+            default: return primitive_desc_t::arg_usage(arg);
+        }
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_INDICES: return src_md(1);
+            case DNNL_ARG_DST: return dst_md(0, user_input);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0) return user_input ? &desc()->src_desc : &src_md_;
+        if (index == 1)
+            return user_input ? &desc()->indices_desc : &indices_md_;
+        return &glob_zero_md;
+    }
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0) return user_input ? &desc()->dst_desc : &dst_md_;
+        return &glob_zero_md;
+    }
+
+    int n_inputs() const override { return 2; }
+    int n_outputs() const override { return 1; }
+
+    // Returns true if rows of a bag are reduced into a single output row.
+    bool with_reduction() const {
+        return desc()->alg_kind != alg_kind::gather_none;
+    }
+
+    // The number of rows in the table.
+    dim_t num_rows() const { return src_md_.dims[0]; }
+    // The length of a row of the table.
+    dim_t row_size() const { return src_md_.dims[1]; }
+    // The number of bags.
+    dim_t num_bags() const { return indices_md_.dims[0]; }
+    // The number of indices in a bag.
+    dim_t bag_size() const { return indices_md_.dims[1]; }
+
+    bool has_zero_dim_memory() const {
+        return memory_desc_wrapper(dst_md()).has_zero_dim();
+    }
+
+protected:
+    gather_desc_t desc_;
+
+    memory_desc_t src_md_;
+    memory_desc_t indices_md_;
+    memory_desc_t dst_md_;
+
+    gather_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*op_desc_t::to_desc<gather_desc_t>(adesc))
+        , src_md_(desc_.src_desc)
+        , indices_md_(desc_.indices_desc)
+        , dst_md_(desc_.dst_desc) {}
+
+    status_t set_default_params() {
+        if (dst_md_.format_kind != format_kind::any) return status::success;
+
+        return memory_desc_init_by_strides(dst_md_, nullptr);
+    }
+};
+// NOLINTEND(google-default-arguments)
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -14,7 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
 #include <sstream>
+#include <vector>
 
 #include "oneapi/dnnl/dnnl.h"
 
@@ -57,6 +59,132 @@ std::string get_descriptor(dim_t M, dim_t N, dim_t K) {
     return s_;
 }
 
+// Returns the offset of the row `m` of the row-major matrix A.
+dim_t a_row_offset(char transa, dim_t m, dim_t lda) {
+    return utils::one_of(transa, 'N', 'n') ? m * lda : m;
+}
+
+// Computes a batch of problems distributing them between threads jointly with
+// the rows of the matrices C. `entry(i, m, m_len)` computes the rows
+// `[m, m + m_len)` of the i-th problem and runs single-threaded when called
+// from a parallel region. Small problems don't scale within a single call, so
+// running several of them at once occupies threads better than a sequence of
+// calls each making its own threading decision.
+template <typename entry_t>
+status_t gemm_batch(char transa, char transb, dim_t M, dim_t N, dim_t K,
+        dim_t batch_size, const entry_t &entry) {
+    if (batch_size < 0) return status::invalid_arguments;
+    // Packed formats can't be split by rows.
+    if (!utils::one_of(transa, 'N', 'n', 'T', 't')
+            || !utils::one_of(transb, 'N', 'n', 'T', 't'))
+        return status::invalid_arguments;
+    if (batch_size == 0) return status::success;
+
+    const int nthr = dnnl_get_current_num_threads();
+    // Rows are split only as much as needed to occupy all threads, and not
+    // finer than `m_blk_min` rows to keep kernels efficient.
+    const dim_t m_blk_min = 32;
+    const dim_t m_chunks = nstl::max(dim_t(1),
+            nstl::min(utils::div_up(dim_t(nthr), batch_size),
+                    utils::div_up(M, m_blk_min)));
+    const dim_t work_amount = batch_size * m_chunks;
+
+    // Problems that are too few to occupy threads, but big enough to scale by
+    // themselves, are computed one by one with all threads.
+    const dim_t big_problem = 128 * 128 * 128;
+    if (nthr == 1 || (work_amount < nthr / 2 && M * N * K >= big_problem)) {
+        for (dim_t i = 0; i < batch_size; i++)
+            CHECK(entry(i, 0, M));
+        return status::success;
+    }
+
+    const dim_t m_blk = utils::div_up(M, m_chunks);
+    std::atomic<status_t> status(status::success);
+    parallel(nthr, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(work_amount, nthr, ithr, start, end);
+        for (dim_t w = start; w < end; w++) {
+            const dim_t i = w / m_chunks;
+            const dim_t m = (w % m_chunks) * m_blk;
+            const dim_t m_len = nstl::min(m_blk, M - m);
+            if (m_len <= 0) continue;
+            const status_t st = entry(i, m, m_len);
+            if (st != status::success) status = st;
+        }
+    });
+    return status;
+}
+
+// Tries the batched gemv driver that streams the matrices of the batch one
+// after another, if the problem is a gemv.
+template <typename ab_t, typename gemv_fn_t, typename get_a_t,
+        typename get_b_t, typename get_c_t>
+status_t try_gemv_batch(const gemv_fn_t &gemv_fn, char transa, char transb,
+        dim_t M, dim_t N, dim_t K, float alpha, const get_a_t &get_a,
+        dim_t lda, const get_b_t &get_b, dim_t ldb, float beta,
+        const get_c_t &get_c, dim_t ldc, dim_t batch_size) {
+    if ((M != 1 && N != 1) || batch_size <= 1) return status::unimplemented;
+    if (!utils::one_of(transa, 'N', 'n', 'T', 't')
+            || !utils::one_of(transb, 'N', 'n', 'T', 't'))
+        return status::unimplemented;
+
+    std::vector<const ab_t *> A(batch_size), B(batch_size);
+    std::vector<float *> C(batch_size);
+    for (dim_t i = 0; i < batch_size; i++) {
+        A[i] = get_a(i);
+        B[i] = get_b(i);
+        C[i] = get_c(i);
+        if (utils::any_null(A[i], B[i], C[i]))
+            return status::invalid_arguments;
+    }
+    return gemv_fn(&transb, &transa, &N, &M, &K, &alpha, B.data(), &ldb,
+            A.data(), &lda, &beta, C.data(), &ldc, batch_size);
+}
+
+template <typename get_a_t, typename get_b_t, typename get_c_t>
+status_t sgemm_batch(char transa, char transb, dim_t M, dim_t N, dim_t K,
+        float alpha, const get_a_t &get_a, dim_t lda, const get_b_t &get_b,
+        dim_t ldb, float beta, const get_c_t &get_c, dim_t ldc,
+        dim_t batch_size) {
+    const status_t st = try_gemv_batch<float>(cpu::sgemv_batch, transa, transb,
+            M, N, K, alpha, get_a, lda, get_b, ldb, beta, get_c, ldc,
+            batch_size);
+    if (st != status::unimplemented) return st;
+
+    return gemm_batch(transa, transb, M, N, K, batch_size,
+            [&](dim_t i, dim_t m, dim_t m_len) -> status_t {
+                const float *A = get_a(i);
+                float *C = get_c(i);
+                if (utils::any_null(A, C)) return status::invalid_arguments;
+                return cpu::extended_sgemm(&transb, &transa, &N, &m_len, &K,
+                        &alpha, get_b(i), &ldb,
+                        A + a_row_offset(transa, m, lda), &lda, &beta,
+                        C + m * ldc, &ldc, nullptr, false);
+            });
+}
+
+template <typename a_t, typename gemm_fn_t, typename get_a_t,
+        typename get_b_t, typename get_c_t>
+status_t gemm_x8s8s32_batch(const gemm_fn_t &gemm_fn, char transa, char transb,
+        char offsetc, dim_t M, dim_t N, dim_t K, float alpha,
+        const get_a_t &get_a, dim_t lda, a_t ao, const get_b_t &get_b,
+        dim_t ldb, int8_t bo, float beta, const get_c_t &get_c, dim_t ldc,
+        const int32_t *co, dim_t batch_size) {
+    // Per-row offsets follow the rows split.
+    const bool co_per_row = utils::one_of(offsetc, 'C', 'c');
+    return gemm_batch(transa, transb, M, N, K, batch_size,
+            [&](dim_t i, dim_t m, dim_t m_len) -> status_t {
+                const a_t *A = get_a(i);
+                int32_t *C = get_c(i);
+                if (utils::any_null(A, C)) return status::invalid_arguments;
+                return gemm_fn(&transb, &transa, c2f_offsetC(&offsetc), &N,
+                        &m_len, &K, &alpha, get_b(i), &ldb, &bo,
+                        A + a_row_offset(transa, m, lda), &lda, &ao, &beta,
+                        C + m * ldc, &ldc,
+                        co && co_per_row ? co + m : co);
+            });
+}
+
 } // namespace
 #endif
 
@@ -157,6 +285,158 @@ extern "C" dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32(char transa,
 #endif
 }
 
+dnnl_status_t dnnl_sgemm_batch_strided(char transa, char transb, dim_t M,
+        dim_t N, dim_t K, float alpha, const float *A, dim_t lda,
+        dim_t stride_a, const float *B, dim_t ldb, dim_t stride_b, float beta,
+        float *C, dim_t ldc, dim_t stride_c, dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (utils::any_null(A, B, C)) return status::invalid_arguments;
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "f32", "f32", "f32",
+            sgemm_batch(
+                    transa, transb, M, N, K, alpha,
+                    [&](dim_t i) { return A + i * stride_a; }, lda,
+                    [&](dim_t i) { return B + i * stride_b; }, ldb, beta,
+                    [&](dim_t i) { return C + i * stride_c; }, ldc,
+                    batch_size));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_batch(char transa, char transb, dim_t M, dim_t N,
+        dim_t K, float alpha, const float *const *A, dim_t lda,
+        const float *const *B, dim_t ldb, float beta, float *const *C,
+        dim_t ldc, dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (utils::any_null(A, B, C)) return status::invalid_arguments;
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "f32", "f32", "f32",
+            sgemm_batch(
+                    transa, transb, M, N, K, alpha,
+                    [&](dim_t i) { return A[i]; }, lda,
+                    [&](dim_t i) { return B[i]; }, ldb, beta,
+                    [&](dim_t i) { return C[i]; }, ldc, batch_size));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dim_t M, dim_t N, dim_t K, float alpha, const uint8_t *A,
+        dim_t lda, dim_t stride_a, uint8_t ao, const int8_t *B, dim_t ldb,
+        dim_t stride_b, int8_t bo, float beta, int32_t *C, dim_t ldc,
+        dim_t stride_c, const int32_t *co, dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (utils::any_null(A, B, C)) return status::invalid_arguments;
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "u8", "s8", "s32",
+            gemm_x8s8s32_batch(
+                    cpu::gemm_s8u8s32, transa, transb, offsetc, M, N, K, alpha,
+                    [&](dim_t i) { return A + i * stride_a; }, lda, ao,
+                    [&](dim_t i) { return B + i * stride_b; }, ldb, bo, beta,
+                    [&](dim_t i) { return C + i * stride_c; }, ldc, co,
+                    batch_size));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_batch(char transa, char transb, char offsetc,
+        dim_t M, dim_t N, dim_t K, float alpha, const uint8_t *const *A,
+        dim_t lda, uint8_t ao, const int8_t *const *B, dim_t ldb, int8_t bo,
+        float beta, int32_t *const *C, dim_t ldc, const int32_t *co,
+        dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (utils::any_null(A, B, C)) return status::invalid_arguments;
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "u8", "s8", "s32",
+            gemm_x8s8s32_batch(
+                    cpu::gemm_s8u8s32, transa, transb, offsetc, M, N, K, alpha,
+                    [&](dim_t i) { return A[i]; }, lda, ao,
+                    [&](dim_t i) { return B[i]; }, ldb, bo, beta,
+                    [&](dim_t i) { return C[i]; }, ldc, co, batch_size));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dim_t M, dim_t N, dim_t K, float alpha, const int8_t *A,
+        dim_t lda, dim_t stride_a, int8_t ao, const int8_t *B, dim_t ldb,
+        dim_t stride_b, int8_t bo, float beta, int32_t *C, dim_t ldc,
+        dim_t stride_c, const int32_t *co, dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (utils::any_null(A, B, C)) return status::invalid_arguments;
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "s8", "s8", "s32",
+            gemm_x8s8s32_batch(
+                    cpu::gemm_s8s8s32, transa, transb, offsetc, M, N, K, alpha,
+                    [&](dim_t i) { return A + i * stride_a; }, lda, ao,
+                    [&](dim_t i) { return B + i * stride_b; }, ldb, bo, beta,
+                    [&](dim_t i) { return C + i * stride_c; }, ldc, co,
+                    batch_size));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_batch(char transa, char transb, char offsetc,
+        dim_t M, dim_t N, dim_t K, float alpha, const int8_t *const *A,
+        dim_t lda, int8_t ao, const int8_t *const *B, dim_t ldb, int8_t bo,
+        float beta, int32_t *const *C, dim_t ldc, const int32_t *co,
+        dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (utils::any_null(A, B, C)) return status::invalid_arguments;
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "s8", "s8", "s32",
+            gemm_x8s8s32_batch(
+                    cpu::gemm_s8s8s32, transa, transb, offsetc, M, N, K, alpha,
+                    [&](dim_t i) { return A[i]; }, lda, ao,
+                    [&](dim_t i) { return B[i]; }, ldb, bo, beta,
+                    [&](dim_t i) { return C[i]; }, ldc, co, batch_size));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+extern "C" dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32_batch_strided(
+        char transa, char transb, dim_t M, dim_t N, dim_t K, float alpha,
+        const bfloat16_t *A, dim_t lda, dim_t stride_a, const bfloat16_t *B,
+        dim_t ldb, dim_t stride_b, float beta, float *C, dim_t ldc,
+        dim_t stride_c, dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (utils::any_null(A, B, C)) return status::invalid_arguments;
+    status_t status = dnnl_success;
+    const auto get_a = [&](dim_t i) { return A + i * stride_a; };
+    const auto get_b = [&](dim_t i) { return B + i * stride_b; };
+    const auto get_c = [&](dim_t i) { return C + i * stride_c; };
+    MAYBE_VERBOSE(status, "bf16", "bf16", "f32",
+            try_gemv_batch<bfloat16_t>(cpu::gemv_bf16bf16f32_batch, transa,
+                    transb, M, N, K, alpha, get_a, lda, get_b, ldb, beta, get_c,
+                    ldc, batch_size));
+    if (status != status::unimplemented) return status;
+    MAYBE_VERBOSE(status, "bf16", "bf16", "f32",
+            gemm_batch(transa, transb, M, N, K, batch_size,
+                    [&](dim_t i, dim_t m, dim_t m_len) -> status_t {
+                        return cpu::gemm_bf16bf16f32(&transb, &transa, &N,
+                                &m_len, &K, &alpha, B + i * stride_b, &ldb,
+                                A + i * stride_a
+                                        + a_row_offset(transa, m, lda),
+                                &lda, &beta, C + i * stride_c + m * ldc, &ldc);
+                    }));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
 dnnl_status_t dnnl_threadpool_interop_sgemm(char transa, char transb, dim_t M,
         dim_t N, dim_t K, float alpha, const float *A, dim_t lda,
@@ -80,6 +80,12 @@ struct impl_list_item_t {
         constexpr concat_type_deduction_helper_t() = default;
     };
 
+    template <typename pd_t>
+    struct split_type_deduction_helper_t
+        : public type_deduction_helper_t<pd_t> {
+        constexpr split_type_deduction_helper_t() = default;
+    };
+
     template <typename pd_t>
     struct sum_type_deduction_helper_t : public type_deduction_helper_t<pd_t> {
     };
@@ -98,6 +104,11 @@ struct impl_list_item_t {
         : create_concat_pd_func_(
                 concat_type_deduction_helper_t<pd_t>::type::create) {}
 
+    template <typename pd_t>
+    constexpr impl_list_item_t(split_type_deduction_helper_t<pd_t>)
+        : create_split_pd_func_(
+                split_type_deduction_helper_t<pd_t>::type::create) {}
+
     template <typename pd_t>
     constexpr impl_list_item_t(sum_type_deduction_helper_t<pd_t>)
         : create_sum_pd_func_(sum_type_deduction_helper_t<pd_t>::type::create) {
@@ -110,8 +121,8 @@ struct impl_list_item_t {
 
     explicit operator bool() const {
         return !utils::everyone_is(nullptr, create_pd_func_,
-                create_concat_pd_func_, create_sum_pd_func_,
-                create_reorder_pd_func_);
+                create_concat_pd_func_, create_split_pd_func_,
+                create_sum_pd_func_, create_reorder_pd_func_);
     }
 
     // Currently, this only supports iterator friendly primitives. Can be
@@ -151,6 +162,15 @@ private:
                 concat_pd, engine, attr, dst_md, n, concat_dim, src_mds);
     }
 
+    status_t operator()(split_pd_t **split_pd, engine_t *engine,
+            const primitive_attr_t *attr, const memory_desc_t *src_md, int n,
+            int split_dim, const memory_desc_t *const *dst_mds) const {
+        assert(create_split_pd_func_);
+        if (!create_split_pd_func_) return status::runtime_error;
+        return create_split_pd_func_(
+                split_pd, engine, attr, src_md, n, split_dim, dst_mds);
+    }
+
     status_t operator()(sum_pd_t **sum_pd, engine_t *engine,
             const primitive_attr_t *attr, const memory_desc_t *dst_md, int n,
             const float *scales, const memory_desc_t *const *src_mds) const {
@@ -177,6 +197,10 @@ private:
             const primitive_attr_t *, const memory_desc_t *, int, int,
             const memory_desc_t *const *);
 
+    using create_split_pd_func_t = status_t (*)(split_pd_t **, engine_t *,
+            const primitive_attr_t *, const memory_desc_t *, int, int,
+            const memory_desc_t *const *);
+
     using create_sum_pd_func_t = status_t (*)(sum_pd_t **, engine_t *,
             const primitive_attr_t *, const memory_desc_t *, int, const float *,
             const memory_desc_t *const *);
@@ -187,6 +211,7 @@ private:
 
     create_pd_func_t create_pd_func_ = nullptr;
     create_concat_pd_func_t create_concat_pd_func_ = nullptr;
+    create_split_pd_func_t create_split_pd_func_ = nullptr;
     create_sum_pd_func_t create_sum_pd_func_ = nullptr;
     create_reorder_pd_func_t create_reorder_pd_func_ = nullptr;
 
@@ -197,6 +222,10 @@ private:
             std::shared_ptr<primitive_desc_t> &, engine_t *,
             const memory_desc_t *, int, int, const memory_desc_t *const *,
             const primitive_attr_t *);
+    friend status_t split_primitive_desc_create(
+            std::shared_ptr<primitive_desc_t> &, engine_t *,
+            const memory_desc_t *, int, int, const memory_desc_t *const *,
+            const primitive_attr_t *);
     friend status_t sum_primitive_desc_create(primitive_desc_iface_t **,
             const memory_desc_t *, int, const float *,
             const memory_desc_t *const *, const primitive_attr_t *, engine_t *);
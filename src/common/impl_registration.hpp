@@ -96,6 +96,13 @@
     {}
 #endif
 
+#if BUILD_PRIMITIVE_ALL || BUILD_GATHER
+#define REG_GATHER_P(...) __VA_ARGS__
+#else
+#define REG_GATHER_P(...) \
+    { nullptr }
+#endif
+
 #if BUILD_PRIMITIVE_ALL || BUILD_GROUP_NORMALIZATION
 #define REG_GNORM_P(...) __VA_ARGS__
 #else
@@ -194,6 +201,13 @@
     {}
 #endif
 
+#if BUILD_PRIMITIVE_ALL || BUILD_SPLIT
+#define REG_SPLIT_P(...) __VA_ARGS__
+#else
+#define REG_SPLIT_P(...) \
+    { nullptr }
+#endif
+
 #if BUILD_PRIMITIVE_ALL || BUILD_SUM
 #define REG_SUM_P(...) __VA_ARGS__
 #else
@@ -201,6 +215,20 @@
     { nullptr }
 #endif
 
+#if BUILD_PRIMITIVE_ALL || BUILD_TOPK
+#define REG_TOPK_P(...) __VA_ARGS__
+#else
+#define REG_TOPK_P(...) \
+    { nullptr }
+#endif
+
+#if BUILD_PRIMITIVE_ALL || BUILD_OPTIMIZER
+#define REG_OPTIMIZER_P(...) __VA_ARGS__
+#else
+#define REG_OPTIMIZER_P(...) \
+    { nullptr }
+#endif
+
 // Primitive CPU ISA section is in src/cpu/platform.hpp
 
 #if BUILD_PRIMITIVE_GPU_ISA_ALL || BUILD_XELP
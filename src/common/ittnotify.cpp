@@ -79,6 +79,10 @@ void primitive_task_start(primitive_kind_t kind) {
             CASE(softmax),
             CASE(layer_normalization),
             CASE(group_normalization),
+            CASE(split),
+            CASE(gather),
+            CASE(topk),
+            CASE(optimizer),
             CASE(sdpa),
     };
 #undef CASE
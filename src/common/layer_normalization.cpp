@@ -52,12 +52,20 @@ status_t lnorm_desc_init(layer_normalization_desc_t *lnorm_desc,
                          & ~(normalization_flags::use_global_stats
                                  | normalization_flags::use_scale
                                  | normalization_flags::use_shift
-                                 | normalization_flags::rms_norm))
+                                 | normalization_flags::rms_norm
+                                 | normalization_flags::fuse_residual_add
+                                 | normalization_flags::save_residual_sum))
                     == 0,
             VERBOSE_BAD_FLAGS);
 
     bool is_fwd
             = prop_kind == forward_training || prop_kind == forward_inference;
+    VCHECK_LNORM(IMPLICATION(flags & normalization_flags::fuse_residual_add,
+                         is_fwd),
+            VERBOSE_BAD_FLAGS);
+    VCHECK_LNORM(IMPLICATION(flags & normalization_flags::save_residual_sum,
+                         flags & normalization_flags::fuse_residual_add),
+            VERBOSE_BAD_FLAGS);
     VCHECK_LNORM(IMPLICATION(is_fwd, dst_desc != nullptr), VERBOSE_NULL_ARG);
     VCHECK_LNORM(IMPLICATION(!is_fwd, !any_null(diff_src_desc, diff_dst_desc)),
             VERBOSE_NULL_ARG);
@@ -87,6 +87,12 @@ struct layer_normalization_pd_t : public primitive_desc_t {
     bool skip_mean() const {
         return desc_.flags & normalization_flags::rms_norm;
     }
+    bool fuse_residual_add() const {
+        return desc_.flags & normalization_flags::fuse_residual_add;
+    }
+    bool save_residual_sum() const {
+        return desc_.flags & normalization_flags::save_residual_sum;
+    }
 
     bool is_fwd() const {
         return utils::one_of(desc_.prop_kind, prop_kind::forward_training,
@@ -166,7 +172,13 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
 
     arg_usage_t arg_usage(int arg) const override {
         if (arg == DNNL_ARG_SRC) return arg_usage_t::input;
+        if (arg == DNNL_ARG_SRC_1)
+            return fuse_residual_add() ? arg_usage_t::input
+                                       : arg_usage_t::unused;
         if (arg == DNNL_ARG_DST) return arg_usage_t::output;
+        if (arg == DNNL_ARG_DST_1)
+            return save_residual_sum() ? arg_usage_t::output
+                                       : arg_usage_t::unused;
 
         if (utils::one_of(arg, DNNL_ARG_MEAN, DNNL_ARG_VARIANCE)) {
             if (arg == DNNL_ARG_MEAN && skip_mean()) return arg_usage_t::unused;
@@ -187,7 +199,9 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
             int arg, bool user_input = false) const override {
         switch (arg) {
             case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_SRC_1: return src_md(3);
             case DNNL_ARG_DST: return dst_md(0, user_input);
+            case DNNL_ARG_DST_1: return dst_md(3);
             case DNNL_ARG_MEAN: return stats_are_src() ? src_md(1) : dst_md(1);
             case DNNL_ARG_VARIANCE:
                 return stats_are_src() ? src_md(2) : dst_md(2);
@@ -201,6 +215,7 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
             int index = 0, bool user_input = false) const override {
         if (index == 0) return user_input ? &desc()->src_desc : &src_md_;
         if (stats_are_src() && (index == 1 || index == 2)) return &stat_md_;
+        if (fuse_residual_add() && index == 3) return &src_md_;
         return &glob_zero_md;
     }
 
@@ -209,6 +224,7 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
         if (index == 0) return user_input ? &desc()->dst_desc : &dst_md_;
         if (!stats_are_src() && is_training() && (index == 1 || index == 2))
             return &stat_md_;
+        if (save_residual_sum() && index == 3) return &src_md_;
         return &glob_zero_md;
     }
 
@@ -219,13 +235,14 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
 
     int n_inputs() const override {
         return 1 + (2 - skip_mean()) * stats_are_src() + use_scale()
-                + use_shift() + n_binary_po_inputs();
+                + use_shift() + fuse_residual_add() + n_binary_po_inputs();
     }
     int n_outputs() const override {
         // Originally as '1 + 2 * (!stats_are_src()) * is_training()',
         // had to be worked around MSVC bug not copying inlined bodies
         // of stats_are_src() and is_training().
-        return (!stats_are_src() && is_training()) ? 3 - skip_mean() : 1;
+        return ((!stats_are_src() && is_training()) ? 3 - skip_mean() : 1)
+                + save_residual_sum();
     }
 
 protected:
@@ -75,6 +75,18 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
     // Matmul supports fpmath mode and accumulation mode
     attr_mask |= smask_t::fpmath_mode | smask_t::accumulation_mode;
 
+    // Dynamic quantization turns a floating-point source into an integer one
+    // and is only meaningful with integer weights.
+    const bool src_is_fp = utils::one_of(
+            src_dt, data_type::f32, data_type::bf16, data_type::f16);
+    if (src_is_fp && wei_dt == data_type::s8)
+        attr_mask |= smask_t::src_dyn_quant;
+
+    // The absolute maximum of the destination is an auxiliary output.
+    attr_mask |= smask_t::dst_amax;
+    // So is the secondary quantized destination.
+    attr_mask |= smask_t::secondary_dst;
+
     VCHECK_MATMUL_UNIMPL(attr->has_default_values(attr_mask, dst_dt),
             VERBOSE_UNSUPPORTED_ATTR);
 
@@ -452,6 +464,67 @@ status_t matmul_desc_init(matmul_desc_t *matmul_desc,
             dst_desc, nullptr, matmul_reduce_kind::undef);
 }
 
+status_t grouped_matmul_desc_init(matmul_desc_t *matmul_desc,
+        const memory_desc_t *src_desc, const memory_desc_t *weights_desc,
+        const memory_desc_t *bias_desc, const memory_desc_t *dst_desc,
+        const memory_desc_t *group_offsets_desc) {
+    VCHECK_MATMUL(!any_null(src_desc, weights_desc, dst_desc,
+                          group_offsets_desc),
+            VERBOSE_NULL_ARG);
+
+    auto op_d = matmul_desc_t();
+    op_d.primitive_kind = primitive_kind::matmul;
+
+    op_d.src_desc = *src_desc;
+    op_d.weights_desc = *weights_desc;
+    if (bias_desc) op_d.bias_desc = *bias_desc;
+    op_d.dst_desc = *dst_desc;
+    op_d.group_offsets_desc = *group_offsets_desc;
+
+    const bool with_bias = op_d.bias_desc.ndims != 0;
+    const auto &offs_d = op_d.group_offsets_desc;
+
+    // src: M_total x K, weights: G x K x N, dst: M_total x N, bias: G x N.
+    VCHECK_MATMUL(src_desc->ndims == 2, VERBOSE_BAD_NDIMS, "src",
+            src_desc->ndims);
+    VCHECK_MATMUL(dst_desc->ndims == 2, VERBOSE_BAD_NDIMS, "dst",
+            dst_desc->ndims);
+    VCHECK_MATMUL(weights_desc->ndims == 3, VERBOSE_BAD_NDIMS, "weights",
+            weights_desc->ndims);
+    VCHECK_MATMUL(IMPLICATION(with_bias, op_d.bias_desc.ndims == 2),
+            VERBOSE_BAD_NDIMS, "bias", op_d.bias_desc.ndims);
+    VCHECK_MATMUL(offs_d.ndims == 1, VERBOSE_BAD_NDIMS, "group_offsets",
+            offs_d.ndims);
+    VCHECK_MATMUL(offs_d.data_type == data_type::s32, VERBOSE_UNSUPPORTED_DT);
+
+    const dim_t G = weights_desc->dims[0];
+    VCHECK_MATMUL(G > 0 && !is_runtime_value(G), VERBOSE_BAD_DIM, "weights",
+            0);
+    VCHECK_MATMUL(offs_d.dims[0] == G, VERBOSE_INCONSISTENT_DIM,
+            "group_offsets", 0, "weights", 0);
+    VCHECK_MATMUL(dst_desc->dims[0] == src_desc->dims[0],
+            VERBOSE_INCONSISTENT_DIM, "dst", 0, "src", 0);
+    VCHECK_MATMUL(src_desc->dims[1] == weights_desc->dims[1],
+            VERBOSE_INCONSISTENT_DIM, "src", 1, "weights", 1);
+    VCHECK_MATMUL(dst_desc->dims[1] == weights_desc->dims[2],
+            VERBOSE_INCONSISTENT_DIM, "dst", 1, "weights", 2);
+    VCHECK_MATMUL(IMPLICATION(with_bias, op_d.bias_desc.dims[0] == G),
+            VERBOSE_INCONSISTENT_DIM, "bias", 0, "weights", 0);
+    VCHECK_MATMUL(IMPLICATION(with_bias,
+                          op_d.bias_desc.dims[1] == dst_desc->dims[1]),
+            VERBOSE_INCONSISTENT_DIM, "bias", 1, "dst", 1);
+    VCHECK_MATMUL(!is_runtime_value(src_desc->dims[1])
+                    && !is_runtime_value(dst_desc->dims[1]),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    op_d.accum_data_type = types::default_accum_data_type(src_desc->data_type,
+            weights_desc->data_type, dst_desc->data_type, prop_kind::forward);
+    VCHECK_MATMUL(op_d.accum_data_type != data_type::undef,
+            VERBOSE_INVALID_DATATYPE, "accumulation");
+    *matmul_desc = op_d;
+    return status::success;
+}
+
 } // namespace impl
 } // namespace dnnl
 
@@ -467,3 +540,26 @@ status_t dnnl_matmul_primitive_desc_create(
     return primitive_desc_create(primitive_desc_iface, engine,
             (const op_desc_t *)&matmul_desc, nullptr, attr);
 }
+
+status_t dnnl_grouped_matmul_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        const memory_desc_t *src_desc, const memory_desc_t *weights_desc,
+        const memory_desc_t *bias_desc, const memory_desc_t *dst_desc,
+        const memory_desc_t *group_offsets_desc,
+        const primitive_attr_t *attr) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    auto matmul_desc = matmul_desc_t();
+    CHECK(grouped_matmul_desc_init(&matmul_desc, src_desc, weights_desc,
+            bias_desc, dst_desc, group_offsets_desc));
+    // Quantization attributes are not defined for a per-group weights tensor
+    // yet.
+    VCHECK_MATMUL_UNIMPL(IMPLICATION(attr,
+                                 attr->has_default_values(smask_t::post_ops
+                                         | smask_t::sum_dt
+                                         | smask_t::fpmath_mode
+                                         | smask_t::accumulation_mode)),
+            VERBOSE_UNSUPPORTED_ATTR);
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&matmul_desc, nullptr, attr);
+}
@@ -45,6 +45,11 @@ status_t matmul_desc_init(matmul_desc_t *matmul_desc,
         const memory_desc_t *src_desc, const memory_desc_t *weights_desc,
         const memory_desc_t *bias_desc, const memory_desc_t *dst_desc);
 
+status_t grouped_matmul_desc_init(matmul_desc_t *matmul_desc,
+        const memory_desc_t *src_desc, const memory_desc_t *weights_desc,
+        const memory_desc_t *bias_desc, const memory_desc_t *dst_desc,
+        const memory_desc_t *group_offsets_desc);
+
 // NOLINTBEGIN(google-default-arguments)
 struct matmul_pd_t : public primitive_desc_t {
     static constexpr auto base_pkind = primitive_kind::matmul;
@@ -64,6 +69,9 @@ struct matmul_pd_t : public primitive_desc_t {
         if (arg == DNNL_ARG_BIAS)
             return with_bias() ? arg_usage_t::input : arg_usage_t::unused;
 
+        if (arg == DNNL_ARG_GROUP_OFFSETS)
+            return is_grouped() ? arg_usage_t::input : arg_usage_t::unused;
+
         if (arg == DNNL_ARG_REDUCE)
             return with_reduce() ? arg_usage_t::output : arg_usage_t::unused;
         if (arg == DNNL_ARG_DST) return arg_usage_t::output;
@@ -79,6 +87,8 @@ struct matmul_pd_t : public primitive_desc_t {
             case DNNL_ARG_BIAS: return weights_md(1);
             case DNNL_ARG_DST: return dst_md(0, user_input);
             case DNNL_ARG_REDUCE: return reduce_md(0);
+            case DNNL_ARG_GROUP_OFFSETS: return group_offsets_md();
+            case DNNL_ARG_ATTR_SECONDARY_DST: return &secondary_dst_md_;
             default: return primitive_desc_t::arg_md(arg);
         }
     }
@@ -109,8 +119,13 @@ struct matmul_pd_t : public primitive_desc_t {
         return &glob_zero_md;
     }
 
+    const memory_desc_t *group_offsets_md() const {
+        return &group_offsets_md_;
+    }
+
     int n_inputs() const override {
-        return 2 + with_bias() + n_binary_po_inputs() + n_prelu_po_inputs();
+        return 2 + with_bias() + is_grouped() + n_binary_po_inputs()
+                + n_prelu_po_inputs();
     }
     int n_outputs() const override { return 1 + with_reduce(); }
 
@@ -130,6 +145,12 @@ struct matmul_pd_t : public primitive_desc_t {
 
     bool with_bias() const { return bias_md_.ndims != 0; }
     bool with_reduce() const { return reduce_md_.ndims != 0; }
+    // Grouped matmul: src and dst hold the rows of all groups concatenated
+    // along M, weights hold one K x N matrix per group.
+    bool is_grouped() const { return group_offsets_md_.ndims != 0; }
+    dim_t n_groups() const {
+        return is_grouped() ? group_offsets_md_.dims[0] : 1;
+    }
 
     matmul_reduce_kind_t reduce_kind() const { return desc_.reduce_kind; }
 
@@ -254,6 +275,8 @@ protected:
     memory_desc_t bias_md_;
     memory_desc_t dst_md_;
     memory_desc_t reduce_md_;
+    memory_desc_t group_offsets_md_;
+    memory_desc_t secondary_dst_md_;
 
     matmul_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
             const matmul_pd_t *hint_fwd_pd)
@@ -263,7 +286,17 @@ protected:
         , weights_md_(desc_.weights_desc)
         , bias_md_(desc_.bias_desc)
         , dst_md_(desc_.dst_desc)
-        , reduce_md_(desc_.reduce_desc) {}
+        , reduce_md_(desc_.reduce_desc)
+        , group_offsets_md_(desc_.group_offsets_desc)
+        , secondary_dst_md_(glob_zero_md) {}
+
+    // Initializes the secondary destination descriptor from the destination
+    // one. Must be called once the destination format is set.
+    void init_secondary_dst_md() {
+        if (attr()->secondary_dst_dt_ == data_type::undef) return;
+        secondary_dst_md_ = dst_md_;
+        secondary_dst_md_.data_type = attr()->secondary_dst_dt_;
+    }
 
     // temporary solution to deal with format `any`
     bool set_default_formats() {
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <assert.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -40,6 +41,16 @@ using namespace dnnl::impl::data_type;
 namespace dnnl {
 namespace impl {
 memory_desc_t glob_zero_md = memory_desc_t();
+
+const memory_desc_t glob_amax_md = []() {
+    memory_desc_t md;
+    const dims_t dims = {1};
+    const status_t st
+            = memory_desc_init_by_tag(md, 1, dims, f32, format_tag::a);
+    assert(st == status::success);
+    MAYBE_UNUSED(st);
+    return md;
+}();
 }
 } // namespace dnnl
 
@@ -82,6 +93,8 @@ dnnl_memory::dnnl_memory(dnnl::impl::engine_t *engine,
     }
 
     memory_storages_ = std::move(mem_storages);
+    track_zero_padding_ = std::all_of(flags.begin(), flags.end(),
+            [](unsigned f) { return f == memory_flags_t::alloc; });
 }
 
 dnnl_memory::dnnl_memory(dnnl::impl::engine_t *engine,
@@ -105,6 +118,7 @@ status_t dnnl_memory::set_data_handle(void *handle, int index) const {
     void *old_handle;
     auto *ms = memory_storage(index);
     if (!ms) return status::invalid_arguments;
+    disable_zero_padding_tracking();
     CHECK(ms->get_data_handle(&old_handle));
     if (handle != old_handle) {
         CHECK(memory_storage(index)->set_data_handle(handle));
@@ -114,6 +128,7 @@ status_t dnnl_memory::set_data_handle(void *handle, int index) const {
 
 status_t dnnl_memory::reset_memory_storage(
         std::unique_ptr<dnnl::impl::memory_storage_t> &&memory_storage) {
+    disable_zero_padding_tracking();
     if (memory_storage) {
         if (memory_storages_.empty())
             memory_storages_.emplace_back(std::move(memory_storage));
@@ -211,6 +226,32 @@ status_t dnnl_memory_create_v2(memory_t **memory, const memory_desc_t *md,
     return success;
 }
 
+status_t dnnl_memory_create_from_file(memory_t **memory,
+        const memory_desc_t *md, engine_t *engine, int fd, size_t offset,
+        unsigned flags) {
+    if (any_null(memory, engine, md)) return invalid_arguments;
+    VCHECK_MEMORY(engine->kind() == engine_kind::cpu, unimplemented,
+            VERBOSE_BAD_ENGINE_KIND);
+
+    const auto mdw = memory_desc_wrapper(md);
+    VCHECK_MEMORY(
+            !mdw.format_any(), invalid_arguments, VERBOSE_UNSUPPORTED_TAG);
+    VCHECK_MEMORY(!mdw.has_runtime_dims_or_strides(), invalid_arguments,
+            VERBOSE_UNSUPPORTED_MEM_STRIDE);
+    VCHECK_MEMORY(!mdw.is_sparse_desc(), unimplemented,
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    memory_storage_t *memory_storage_ptr = nullptr;
+    CHECK(engine->create_mapped_memory_storage(
+            &memory_storage_ptr, fd, offset, mdw.size(), flags));
+    std::unique_ptr<memory_storage_t> memory_storage(memory_storage_ptr);
+
+    auto _memory = new memory_t(engine, md, std::move(memory_storage));
+    if (_memory == nullptr) return out_of_memory;
+    *memory = _memory;
+    return success;
+}
+
 status_t dnnl_memory_get_memory_desc(
         const memory_t *memory, const memory_desc_t **md) {
     if (any_null(memory, md)) return invalid_arguments;
@@ -230,6 +271,7 @@ status_t dnnl_memory_get_data_handle(const memory_t *memory, void **handle) {
         *handle = nullptr;
         return success;
     }
+    memory->disable_zero_padding_tracking();
     return memory->get_data_handle(handle);
 }
 
@@ -246,6 +288,7 @@ status_t dnnl_memory_get_data_handle_v2(
         *handle = nullptr;
         return success;
     }
+    memory->disable_zero_padding_tracking();
     return memory->get_data_handle(handle, index);
 }
 
@@ -274,10 +317,33 @@ status_t dnnl_memory_map_data_v2(
         return invalid_arguments;
     }
 
+    memory->disable_zero_padding_tracking();
     return memory->memory_storage(index)->map_data(
             mapped_ptr, nullptr, map_size);
 }
 
+status_t dnnl_memory_map_data_range(const memory_t *memory, void **mapped_ptr,
+        size_t offset, size_t size, int index) {
+    VCHECK_MEMORY(
+            !any_null(memory, mapped_ptr), invalid_arguments, VERBOSE_NULL_ARG);
+    VCHECK_MEMORY((index >= 0 && index < (int)memory->get_num_handles()),
+            invalid_arguments, VERBOSE_INVALID_MEM_IDX);
+
+    const size_t map_size = memory_desc_map_size(memory->md(), index);
+    if (map_size == DNNL_RUNTIME_SIZE_VAL) return invalid_arguments;
+    VCHECK_MEMORY(offset <= map_size && size <= map_size - offset,
+            invalid_arguments, VERBOSE_BAD_PARAM, "offset or size");
+
+    if (size == 0) {
+        *mapped_ptr = nullptr;
+        return success;
+    }
+
+    memory->disable_zero_padding_tracking();
+    return memory->memory_storage(index)->map_data_range(
+            mapped_ptr, nullptr, offset, size);
+}
+
 status_t dnnl_memory_unmap_data_v2(
         const memory_t *memory, void *mapped_ptr, int index) {
     VCHECK_MEMORY(!any_null(memory), invalid_arguments, VERBOSE_NULL_ARG);
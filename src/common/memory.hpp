@@ -18,6 +18,7 @@
 #define COMMON_MEMORY_HPP
 
 #include <assert.h>
+#include <atomic>
 #include <memory>
 
 #include "oneapi/dnnl/dnnl.h"
@@ -91,6 +92,27 @@ struct dnnl_memory : public dnnl::impl::c_compatible {
     /** zeros padding */
     dnnl::impl::status_t zero_pad(const dnnl::impl::exec_ctx_t &ctx) const;
 
+    /** Zero padding state tracking. The state is tracked only for memory
+     * allocated by the library whose content the user never accessed, since
+     * a user may write to the padded area through a handle at any time. */
+    void disable_zero_padding_tracking() const {
+        track_zero_padding_ = false;
+        padding_is_zero_ = false;
+        padding_was_zero_ = false;
+    }
+
+    /** marks the start of an execution that writes to the memory */
+    void begin_output_write() const {
+        padding_was_zero_ = padding_is_zero_.exchange(false);
+    }
+
+    /** marks the memory content as written outside of the padded area
+     * contract, e.g. via a raw pointer or storage obtained by a primitive */
+    void mark_padding_dirty() const {
+        padding_was_zero_ = false;
+        padding_is_zero_ = false;
+    }
+
     dnnl::impl::status_t reset_memory_storage(
             std::unique_ptr<dnnl::impl::memory_storage_t> &&memory_storage);
 
@@ -115,6 +137,11 @@ private:
     // Number of storages is larger than 1 only for sparse memory.
     std::vector<std::unique_ptr<dnnl::impl::memory_storage_t>> memory_storages_;
     std::atomic<int> counter_;
+
+    mutable std::atomic<bool> track_zero_padding_ {false};
+    // Padding state now and at the start of the current execution.
+    mutable std::atomic<bool> padding_is_zero_ {false};
+    mutable std::atomic<bool> padding_was_zero_ {false};
 };
 
 namespace dnnl {
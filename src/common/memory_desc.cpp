@@ -170,6 +170,48 @@ status_t memory_desc_init_by_coo_encoding(memory_desc_t &memory_desc, int ndims,
     return success;
 }
 
+status_t memory_desc_init_by_bsr_encoding(memory_desc_t &memory_desc, int ndims,
+        const dims_t dims, data_type_t data_type, dim_t nnz,
+        const dims_t block_dims, data_type_t indices_dt,
+        data_type_t pointers_dt) {
+    if (ndims == 0) {
+        memory_desc = types::zero_md();
+        return success;
+    }
+
+    // Blocks are only defined for matrices at this point.
+    VCHECK_MEMORY(ndims == sparse_desc_t::max_block_ndims, unimplemented,
+            VERBOSE_BAD_NDIMS, "", ndims);
+
+    bool args_ok = memory_desc_sanity_check(
+            ndims, dims, data_type, format_kind::undef);
+    VCHECK_MEMORY(args_ok, invalid_arguments, VERBOSE_MEM_DESC_CHECK_FAIL);
+    VCHECK_MEMORY(block_dims != nullptr && nnz >= 0, invalid_arguments,
+            VERBOSE_MEM_DESC_CHECK_FAIL);
+    for (int d = 0; d < ndims; d++) {
+        VCHECK_MEMORY(block_dims[d] > 0 && dims[d] % block_dims[d] == 0,
+                invalid_arguments, VERBOSE_MEM_DESC_CHECK_FAIL);
+    }
+    VCHECK_MEMORY(nnz <= (dims[0] / block_dims[0]) * (dims[1] / block_dims[1]),
+            invalid_arguments, VERBOSE_MEM_DESC_CHECK_FAIL);
+
+    auto md = memory_desc_t();
+    md.ndims = ndims;
+    array_copy(md.dims, dims, ndims);
+    md.data_type = data_type;
+    array_copy(md.padded_dims, dims, ndims);
+    md.format_kind = format_kind::sparse;
+    md.format_desc.sparse_desc.encoding = sparse_encoding::bsr;
+    md.format_desc.sparse_desc.nnz = nnz;
+    md.format_desc.sparse_desc.metadata_types[0] = indices_dt;
+    md.format_desc.sparse_desc.metadata_types[1] = pointers_dt;
+    array_copy(md.format_desc.sparse_desc.block_dims, block_dims, ndims);
+
+    memory_desc = md;
+
+    return success;
+}
+
 status_t memory_desc_init_by_packed_encoding(memory_desc_t &memory_desc,
         int ndims, const dims_t dims, data_type_t data_type, dim_t nnz) {
     if (ndims == 0) {
@@ -195,6 +237,36 @@ status_t memory_desc_init_by_packed_encoding(memory_desc_t &memory_desc,
     return success;
 }
 
+status_t memory_desc_init_by_packed_2_4_encoding(
+        memory_desc_t &memory_desc, int ndims, const dims_t dims,
+        data_type_t data_type) {
+    if (ndims == 0) {
+        memory_desc = types::zero_md();
+        return success;
+    }
+
+    // The groups are defined along the reduction dimension.
+    VCHECK_MEMORY(ndims >= 2, unimplemented, VERBOSE_BAD_NDIMS, "", ndims);
+
+    bool args_ok = memory_desc_sanity_check(
+            ndims, dims, data_type, format_kind::undef);
+    VCHECK_MEMORY(args_ok, invalid_arguments, VERBOSE_MEM_DESC_CHECK_FAIL);
+
+    auto md = memory_desc_t();
+    md.ndims = ndims;
+    array_copy(md.dims, dims, ndims);
+    md.data_type = data_type;
+    array_copy(md.padded_dims, dims, ndims);
+    md.format_kind = format_kind::sparse;
+    md.format_desc.sparse_desc.encoding = sparse_encoding::packed_2_4;
+    md.format_desc.sparse_desc.nnz
+            = utils::div_up(utils::array_product(dims, ndims), 2);
+
+    memory_desc = md;
+
+    return success;
+}
+
 status_t memory_desc_init_submemory(memory_desc_t &memory_desc,
         const memory_desc_t &parent_memory_desc, const dims_t dims,
         const dims_t offsets) {
@@ -640,6 +712,20 @@ status_t dnnl_memory_desc_create_with_coo_encoding(memory_desc_t **memory_desc,
     return success;
 }
 
+status_t dnnl_memory_desc_create_with_bsr_encoding(memory_desc_t **memory_desc,
+        int ndims, const dims_t dims, data_type_t data_type, dim_t nnz,
+        const dims_t block_dims, data_type_t indices_dt,
+        data_type_t pointers_dt) {
+    if (any_null(memory_desc)) return invalid_arguments;
+
+    auto md = utils::make_unique<memory_desc_t>();
+    if (!md) return out_of_memory;
+    CHECK(memory_desc_init_by_bsr_encoding(*md, ndims, dims, data_type, nnz,
+            block_dims, indices_dt, pointers_dt));
+    (*memory_desc) = md.release();
+    return success;
+}
+
 status_t dnnl_memory_desc_create_with_packed_encoding(
         memory_desc_t **memory_desc, int ndims, const dims_t dims,
         data_type_t data_type, dim_t nnz) {
@@ -653,6 +739,19 @@ status_t dnnl_memory_desc_create_with_packed_encoding(
     return success;
 }
 
+status_t dnnl_memory_desc_create_with_packed_2_4_encoding(
+        memory_desc_t **memory_desc, int ndims, const dims_t dims,
+        data_type_t data_type) {
+    if (any_null(memory_desc)) return invalid_arguments;
+
+    auto md = utils::make_unique<memory_desc_t>();
+    if (!md) return out_of_memory;
+    CHECK(memory_desc_init_by_packed_2_4_encoding(
+            *md, ndims, dims, data_type));
+    (*memory_desc) = md.release();
+    return success;
+}
+
 status_t dnnl_memory_desc_create_submemory(memory_desc_t **memory_desc,
         const memory_desc_t *parent_memory_desc, const dims_t dims,
         const dims_t offsets) {
@@ -790,7 +889,11 @@ status_t dnnl_memory_desc_query_v2(
                     case sparse_encoding::coo:
                         *(int *)result = md->ndims + 1;
                         break;
+                    case sparse_encoding::bsr:
                     case sparse_encoding::packed: *(int *)result = 3; break;
+                    case sparse_encoding::packed_2_4:
+                        *(int *)result = 2;
+                        break;
                     default: assert(!"unknown encoding"); *(int *)result = 0;
                 }
             } else
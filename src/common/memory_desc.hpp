@@ -168,6 +168,7 @@ struct cublaslt_blocked_desc_t {
 
 struct sparse_desc_t {
     static constexpr int max_metadata_types = 2;
+    static constexpr int max_block_ndims = 2;
     // Each encoding defines the number of handles it requires and their
     // meaning.
     //
@@ -176,21 +177,29 @@ struct sparse_desc_t {
     //  - 1: indices
     //  - 2: pointers
     //
+    // BSR: Number of handles is 3:
+    //  - 0: values, dense row-major blocks
+    //  - 1: block column indices
+    //  - 2: block row pointers
+    //
     // packed: Number of handles is 3:
     //  - 0: values
     //  - 1: offsets
     //  - 2: bitmask
     sparse_encoding_t encoding;
 
-    // Number of non-zero entries.
+    // Number of non-zero entries. For BSR it is the number of stored blocks.
     dnnl_dim_t nnz;
 
     // Metadata types. Each encoding defines how to interpret these.
-    // - CSR: 0th - index data type
-    //        1st - pointer data type
+    // - CSR, BSR: 0th - index data type
+    //             1st - pointer data type
     // - packed: N/A
     dnnl_data_type_t metadata_types[max_metadata_types];
 
+    // Dimensions of a block. Only used by BSR.
+    dnnl_dim_t block_dims[max_block_ndims];
+
     // The packed sparse encoding is described with `blocking_desc_t` and
     // can only be initialized by the implementation. The special encoding
     // `packed` will instruct the implementation to do that.
@@ -59,9 +59,11 @@ struct memory_desc_wrapper : public c_compatible {
         return format_kind() == format_kind::blocked;
     }
 
+    // Both packed encodings are described with `packed_desc`.
     bool is_sparse_packed_desc() const {
         return is_sparse_desc()
-                && sparse_desc().encoding == sparse_encoding::packed;
+                && utils::one_of(sparse_desc().encoding,
+                        sparse_encoding::packed, sparse_encoding::packed_2_4);
     }
 
     bool is_wino_desc() const { return format_kind() == format_kind::wino; }
@@ -111,6 +113,12 @@ struct memory_desc_wrapper : public c_compatible {
         return sparse_desc().nnz;
     }
 
+    // Returns the dimensions of a BSR block.
+    const dim_t *block_dims() const {
+        assert(is_sparse_desc() && encoding() == sparse_encoding::bsr);
+        return sparse_desc().block_dims;
+    }
+
     const dims_t &strides() const { return blocking_desc().strides; }
 
     const memory_extra_desc_t &extra() const { return md_->extra; }
@@ -308,6 +316,25 @@ struct memory_desc_wrapper : public c_compatible {
                     assert(!"unknown index");
                     return 0;
                 }
+            } else if (sparse_desc().encoding == sparse_encoding::bsr) {
+                switch (index) {
+                    // Return size for values.
+                    case 0:
+                        return nnz() * block_dims()[0] * block_dims()[1]
+                                * data_type_size();
+                    // Return size for block column indices.
+                    case 1: {
+                        const auto idx_dt = metadata_type(0);
+                        return nnz() * types::data_type_size(idx_dt);
+                    }
+                    // Return size for block row pointers.
+                    case 2: {
+                        const auto ptr_dt = metadata_type(1);
+                        return (dims()[0] / block_dims()[0] + 1)
+                                * types::data_type_size(ptr_dt);
+                    }
+                    default: assert(!"unknown index"); return 0;
+                }
             } else if (sparse_desc().encoding == sparse_encoding::packed) {
                 // If the size if queried from a user-created memory descriptor.
                 if (blocking_desc().strides[0] == 0) return 0;
@@ -326,6 +353,21 @@ struct memory_desc_wrapper : public c_compatible {
                         return utils::div_up(nelems(true), CHAR_BIT);
                     default: assert(!"unknown index"); return 0;
                 }
+            } else if (sparse_desc().encoding == sparse_encoding::packed_2_4) {
+                // If the size if queried from a user-created memory descriptor.
+                if (blocking_desc().strides[0] == 0) return 0;
+
+                switch (index) {
+                    case 0:
+                        // Return size for values, exactly 2 values are kept
+                        // in every group of 4.
+                        return nelems(true) / 2 * data_type_size();
+                    case 1:
+                        // Return size for bitmask. The bitmask has 1 bit
+                        // per each value.
+                        return utils::div_up(nelems(true), CHAR_BIT);
+                    default: assert(!"unknown index"); return 0;
+                }
             } else {
                 assert(!"unknown sparse encoding");
                 return 0;
@@ -61,6 +61,15 @@ struct memory_storage_t : public c_compatible {
     virtual status_t map_data(
             void **mapped_ptr, stream_t *stream, size_t size) const = 0;
 
+    // Maps `size` bytes of the storage starting at `offset`. The mapping is
+    // released with unmap_data() called on the returned pointer. Storages
+    // that can't map a part of the data support only a zero offset.
+    virtual status_t map_data_range(void **mapped_ptr, stream_t *stream,
+            size_t offset, size_t size) const {
+        if (offset != 0) return status::unimplemented;
+        return map_data(mapped_ptr, stream, size);
+    }
+
     virtual status_t unmap_data(void *mapped_ptr, stream_t *stream) const = 0;
 
     virtual bool is_host_accessible() const { return false; }
@@ -227,12 +227,15 @@ enum {
     key_conv_miopen_algo,
     key_conv_miopen_filter,
     key_deconv_bias,
+    key_deconv_subpixel_dst,
+    key_deconv_subpixel_wei,
     key_deconv_sum,
     key_deconv_zp,
     key_eltwise_diff_dst,
     key_eltwise_src,
     key_fusion_forward_scratchpad,
     key_fusion_inout_buffer,
+    key_gather_acc,
     key_gemm_asm_tmp_buffer,
     key_gemm_tmp_buffer,
     key_gemm_blocked_a,
@@ -263,6 +266,7 @@ enum {
     key_lnorm_tmp_var,
     key_lnorm_tmp_diff_ss,
     key_lnorm_reduction,
+    key_lnorm_residual_sum,
     key_matmul_pack_space,
     key_matmul_dst_in_acc_dt,
     key_matmul_lt_algo_scratch,
@@ -272,6 +276,12 @@ enum {
     key_matmul_dst_trans,
     key_matmul_dst_cast_acc,
     key_matmul_sparse_tmp_ptr,
+    key_matmul_sparse_col_blocks,
+    key_matmul_sparse_wei_vnni,
+    key_matmul_src_dyn_quant,
+    key_matmul_src_dyn_quant_scales,
+    key_matmul_dst_amax,
+    key_matmul_grouped_counter,
     key_pool_dst_bf16cvt,
     key_pool_dst_plain2blocked_cvt,
     key_pool_ind_plain2blocked_cvt,
@@ -305,7 +315,10 @@ enum {
     key_rnn_bf32_attention_trans,
     key_rnn_bf32_wei_layer_trans,
     key_rnn_bf32_wei_iter_trans,
+    key_rnn_wei_layer_decomp,
+    key_rnn_wei_iter_decomp,
     key_rnn_cell,
+    key_rnn_cell_sync,
     key_rnn_diff_states,
     key_rnn_gates,
     key_rnn_gates_blocked,
@@ -317,10 +330,18 @@ enum {
     key_rnn_ptrs_wei_layer,
     key_rnn_ptrs_wei_iter,
     key_rnn_ptrs_wei_projection,
+    key_sdpa_bwd_delta,
+    key_sdpa_cudnn_workspace,
     key_softmax_reduction,
     key_softmax_interim_store,
+    key_split_iptrs,
+    key_split_nelems,
+    key_split_optrs,
+    key_split_ostrides,
     key_sum_reduction,
     key_sum_srcs_cvt,
+    key_topk_indices,
+    key_topk_values,
     key_wino_U,
     key_wino_V,
     key_wino_M,
@@ -307,6 +307,13 @@ status_t memory_t::zero_pad(const exec_ctx_t &ctx) const {
             || mdw.is_zero() || !mdw.is_blocking_desc();
     if (skip_zeroing) return success;
 
+    // The padding is still zero if it was zero when the execution started and
+    // nothing has written to the memory since then.
+    if (track_zero_padding_ && padding_was_zero_.exchange(false)) {
+        padding_is_zero_ = true;
+        return success;
+    }
+
     stream_t *stream = ctx.stream();
     status_t status;
     if (stream == nullptr) {
@@ -319,6 +326,7 @@ status_t memory_t::zero_pad(const exec_ctx_t &ctx) const {
         status = stream->zero_pad(this, ctx);
     else
         status = ::zero_pad(this, ctx);
+    if (status == success) padding_is_zero_ = track_zero_padding_.load();
 
     return status;
 }
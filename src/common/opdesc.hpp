@@ -109,6 +109,28 @@ struct concat_desc_t : public op_desc_t {
     std::vector<const memory_desc_t *> src_mds;
 };
 
+// A descriptor of a split operation.
+struct split_desc_t : public op_desc_t {
+    split_desc_t() = default;
+    split_desc_t(primitive_kind_t primitive_kind, const memory_desc_t *src_md,
+            dim_t n, dim_t split_dimension,
+            const memory_desc_t *const *dst_mds)
+        : op_desc_t(primitive_kind)
+        , src_md(src_md)
+        , n(n)
+        , split_dimension(split_dimension) {
+        for (dim_t i = 0; i < n; i++)
+            this->dst_mds.push_back(dst_mds[i]);
+    }
+
+    DECLARE_COMMON_OP_DESC_CLONE(split_desc_t);
+
+    const memory_desc_t *src_md {};
+    dim_t n {};
+    dim_t split_dimension {};
+    std::vector<const memory_desc_t *> dst_mds;
+};
+
 // A descriptor of a sum operation.
 struct sum_desc_t : public op_desc_t {
     sum_desc_t() = default;
@@ -229,6 +251,64 @@ struct shuffle_desc_t : public op_desc_t {
     dim_t group_size {};
 };
 
+// A descriptor of a gather operation.
+struct gather_desc_t : public op_desc_t {
+    gather_desc_t() : op_desc_t(primitive_kind::gather) {}
+
+    DECLARE_COMMON_OP_DESC_CLONE(gather_desc_t);
+
+    // The kind of reduction over a bag. Possible values: #dnnl_gather_none,
+    // #dnnl_gather_sum, and #dnnl_gather_mean.
+    alg_kind_t alg_kind {};
+    // Source (table) memory descriptor.
+    memory_desc_t src_desc;
+    // Indices memory descriptor.
+    memory_desc_t indices_desc;
+    // Destination memory descriptor.
+    memory_desc_t dst_desc;
+};
+
+// A descriptor of a top-k operation.
+struct topk_desc_t : public op_desc_t {
+    topk_desc_t() : op_desc_t(primitive_kind::topk) {}
+
+    DECLARE_COMMON_OP_DESC_CLONE(topk_desc_t);
+
+    // Source memory descriptor.
+    memory_desc_t src_desc;
+    // Destination (values) memory descriptor.
+    memory_desc_t dst_desc;
+    // Destination indices memory descriptor.
+    memory_desc_t indices_desc;
+    // The axis along which the elements are selected.
+    int axis {};
+};
+
+// A descriptor of an optimizer operation.
+struct optimizer_desc_t : public op_desc_t {
+    optimizer_desc_t() : op_desc_t(primitive_kind::optimizer) {}
+
+    DECLARE_COMMON_OP_DESC_CLONE(optimizer_desc_t);
+
+    // The kind of the update rule.
+    alg_kind_t alg_kind {};
+    // Gradient memory descriptor.
+    memory_desc_t grad_desc;
+    // Parameters memory descriptor.
+    memory_desc_t param_desc;
+    // Memory descriptor of the f32 master copy of the parameters. A zero
+    // memory descriptor if the parameters are updated directly.
+    memory_desc_t master_desc;
+    // Momentum for SGD or the decay rate of the first moment for Adam.
+    float momentum {};
+    // The decay rate of the second moment.
+    float beta2 {};
+    // Denominator term for the numerical stability.
+    float epsilon {};
+    // Weight decay factor.
+    float weight_decay {};
+};
+
 // A descriptor of resampling operation.
 struct resampling_desc_t : public op_desc_t {
     resampling_desc_t() : op_desc_t(primitive_kind::resampling) {}
@@ -239,7 +319,8 @@ struct resampling_desc_t : public op_desc_t {
     // #dnnl_forward_inference, #dnnl_backward_data,
     prop_kind_t prop_kind {};
     // The kind of the resampling algorithm. Possible values:
-    // #dnnl_resampling_nearest, #dnnl_resampling_linear.
+    // #dnnl_resampling_nearest, #dnnl_resampling_linear,
+    // #dnnl_resampling_cubic, #dnnl_resampling_linear_antialias.
     alg_kind_t alg_kind {};
     // Source memory descriptor.
     memory_desc_t src_desc;
@@ -275,6 +356,8 @@ struct matmul_desc_t : public op_desc_t {
     memory_desc_t dst_desc;
     // Reduce memory descriptor;
     memory_desc_t reduce_desc;
+    // Group offsets memory descriptor. Non-empty for grouped matmul only.
+    memory_desc_t group_offsets_desc;
     // Reduce kind.
     matmul_reduce_kind_t reduce_kind {};
     // The accumulator data type. Initialized automatically.
@@ -523,6 +606,14 @@ struct softmax_desc_t : public op_desc_t {
     memory_desc_t dst_desc;
     // Destination gradient memory descriptor.
     memory_desc_t diff_dst_desc;
+    // Internal: attention scores preprocessing, forward only. When
+    // `with_scale` is set, source is multiplied by a runtime f32 scalar
+    // (DNNL_ARG_SCALE). Then a mask is applied according to `mask_type`:
+    // `mask_desc` tensor is added for attn_mask_type::buffer, and elements
+    // above the diagonal are set to -inf for causal mask types.
+    bool with_scale {};
+    attn_mask_type_t mask_type {};
+    memory_desc_t mask_desc;
 };
 
 // A descriptor of a binary operation.
@@ -578,8 +669,9 @@ struct pooling_desc_t : public op_desc_t {
     prop_kind_t prop_kind {};
     // The kind of pooling algorithm.
     // Possible values: #dnnl_pooling_max,
-    // #dnnl_pooling_avg_include_padding, and
-    // #dnnl_pooling_avg_exclude_padding.
+    // #dnnl_pooling_avg_include_padding,
+    // #dnnl_pooling_avg_exclude_padding, #dnnl_pooling_adaptive_max, and
+    // #dnnl_pooling_adaptive_avg.
     alg_kind_t alg_kind {};
     // Source memory descriptor.
     memory_desc_t src_desc;
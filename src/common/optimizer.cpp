@@ -0,0 +1,145 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+#include "opdesc.hpp"
+#include "primitive_desc_iface.hpp"
+
+#include "c_types_map.hpp"
+#include "optimizer_pd.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::alg_kind;
+
+#define VCHECK_OPTIMIZER(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, optimizer, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__);
+
+#define VCHECK_OPTIMIZER_UNIMPL(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, optimizer, (cond), \
+            status::unimplemented, msg, ##__VA_ARGS__);
+namespace dnnl {
+namespace impl {
+
+status_t optimizer_desc_init(optimizer_desc_t *optimizer_desc,
+        alg_kind_t alg_kind, const memory_desc_t *grad_desc,
+        const memory_desc_t *param_desc, const memory_desc_t *master_desc,
+        float momentum, float beta2, float epsilon, float weight_decay) {
+
+    VCHECK_OPTIMIZER(!any_null(grad_desc, param_desc), VERBOSE_NULL_ARG);
+    VCHECK_OPTIMIZER(
+            one_of(alg_kind, optimizer_sgd, optimizer_adam, optimizer_adamw),
+            VERBOSE_BAD_ALGORITHM);
+    VCHECK_OPTIMIZER(
+            !memory_desc_wrapper(param_desc).has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    const bool with_master = master_desc != nullptr
+            && !memory_desc_wrapper(master_desc).is_zero();
+
+    VCHECK_OPTIMIZER(memory_desc_wrapper(param_desc).consistent_with(
+                             memory_desc_wrapper(grad_desc)),
+            VERBOSE_INCONSISTENT_MDS, "param", "grad");
+    if (with_master) {
+        VCHECK_OPTIMIZER(memory_desc_wrapper(param_desc).consistent_with(
+                                 memory_desc_wrapper(master_desc)),
+                VERBOSE_INCONSISTENT_MDS, "param", "master");
+        VCHECK_OPTIMIZER(master_desc->data_type == data_type::f32,
+                VERBOSE_INVALID_DATATYPE, "master");
+    }
+
+    // The parameters are updated in place, so their layout must be known.
+    VCHECK_OPTIMIZER(param_desc->format_kind == format_kind::blocked,
+            VERBOSE_UNSUPPORTED_TAG_S, "param");
+    VCHECK_OPTIMIZER(one_of(grad_desc->format_kind, format_kind::blocked,
+                             format_kind::any),
+            VERBOSE_UNSUPPORTED_TAG_S, "grad");
+    if (with_master)
+        VCHECK_OPTIMIZER(one_of(master_desc->format_kind, format_kind::blocked,
+                                 format_kind::any),
+                VERBOSE_UNSUPPORTED_TAG_S, "master");
+
+    VCHECK_OPTIMIZER(param_desc->extra.flags == 0, VERBOSE_UNSUPPORTED_MD_FLAG,
+            "param");
+
+    VCHECK_OPTIMIZER(0.f <= momentum && momentum < 1.f, VERBOSE_BAD_PARAM,
+            "momentum");
+    VCHECK_OPTIMIZER(weight_decay >= 0.f, VERBOSE_BAD_PARAM, "weight_decay");
+    if (one_of(alg_kind, optimizer_adam, optimizer_adamw)) {
+        VCHECK_OPTIMIZER(0.f <= beta2 && beta2 < 1.f, VERBOSE_BAD_PARAM,
+                "beta2");
+        VCHECK_OPTIMIZER(epsilon > 0.f, VERBOSE_BAD_PARAM, "epsilon");
+    }
+
+    auto od = optimizer_desc_t();
+    od.primitive_kind = primitive_kind::optimizer;
+    od.alg_kind = alg_kind;
+    od.grad_desc = *grad_desc;
+    od.param_desc = *param_desc;
+    if (with_master) od.master_desc = *master_desc;
+    od.momentum = momentum;
+    // Parameters unused by the algorithm are zeroed to keep the cache keys
+    // of equivalent primitives equal.
+    const bool is_adam = one_of(alg_kind, optimizer_adam, optimizer_adamw);
+    od.beta2 = is_adam ? beta2 : 0.f;
+    od.epsilon = is_adam ? epsilon : 0.f;
+    od.weight_decay = weight_decay;
+
+    (*optimizer_desc) = od;
+    return success;
+}
+
+status_t optimizer_attr_check(const optimizer_desc_t &desc,
+        const engine_t *engine, const primitive_attr_t *attr) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    if (attr == nullptr) return status::success;
+    if (attr->has_default_values()) return status::success;
+
+    // Stochastic rounding applies to the parameters, which are written as
+    // the destination.
+    VCHECK_OPTIMIZER_UNIMPL(
+            attr->has_default_values(smask_t::rounding_mode, data_type::undef),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VCHECK_OPTIMIZER_UNIMPL(
+            attr->rounding_mode_.has_default_values(DNNL_ARG_DIFF_SRC)
+                    && attr->rounding_mode_.has_default_values(
+                            DNNL_ARG_DIFF_WEIGHTS),
+            VERBOSE_UNSUPPORTED_ATTR);
+
+    return status::success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+dnnl_status_t dnnl_optimizer_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        alg_kind_t alg_kind, const memory_desc_t *grad_desc,
+        const memory_desc_t *param_desc, const memory_desc_t *master_desc,
+        float momentum, float beta2, float epsilon, float weight_decay,
+        const primitive_attr_t *attr) {
+
+    auto optimizer_desc = optimizer_desc_t();
+    CHECK(optimizer_desc_init(&optimizer_desc, alg_kind, grad_desc, param_desc,
+            master_desc, momentum, beta2, epsilon, weight_decay));
+    CHECK(optimizer_attr_check(optimizer_desc, engine, attr));
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&optimizer_desc, nullptr, attr);
+}
@@ -0,0 +1,188 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_OPTIMIZER_PD_HPP
+#define COMMON_OPTIMIZER_PD_HPP
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#define VDISPATCH_OPTIMIZER(cond, msg, ...) \
+    VCONDCHECK(primitive, create, dispatch, optimizer, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+#define VDISPATCH_OPTIMIZER_SC(f, msg, ...) \
+    VCHECK(primitive, create, dispatch, optimizer, (f), "%s," msg, \
+            this->info(engine), ##__VA_ARGS__)
+
+namespace dnnl {
+namespace impl {
+
+status_t optimizer_desc_init(optimizer_desc_t *optimizer_desc,
+        alg_kind_t alg_kind, const memory_desc_t *grad_desc,
+        const memory_desc_t *param_desc, const memory_desc_t *master_desc,
+        float momentum, float beta2, float epsilon, float weight_decay);
+
+// NOLINTBEGIN(google-default-arguments)
+struct optimizer_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::optimizer;
+
+    using hint_class = optimizer_pd_t;
+
+    const optimizer_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::alg_kind:
+                *(alg_kind_t *)result = desc()->alg_kind;
+                break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC:
+            case DNNL_ARG_LEARNING_RATE: return arg_usage_t::input;
+            case DNNL_ARG_STEP:
+                return is_adam() ? arg_usage_t::input : arg_usage_t::unused;
+            case DNNL_ARG_DST: return arg_usage_t::output;
+            case DNNL_ARG_MOMENT_1:
+                return n_moments() > 0 ? arg_usage_t::output
+                                       : arg_usage_t::unused;
+            case DNNL_ARG_MOMENT_2:
+                return n_moments() > 1 ? arg_usage_t::output
+                                       : arg_usage_t::unused;
+            case DNNL_ARG_MASTER_WEIGHTS:
+                return with_master_weights() ? arg_usage_t::output
+                                             : arg_usage_t::unused;
+            default: return primitive_desc_t::arg_usage(arg);
+        }
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0, user_input);
+            case DNNL_ARG_LEARNING_RATE: return src_md(1);
+            case DNNL_ARG_STEP: return src_md(2);
+            case DNNL_ARG_DST: return dst_md(0, user_input);
+            case DNNL_ARG_MOMENT_1: return dst_md(1);
+            case DNNL_ARG_MOMENT_2: return dst_md(2);
+            case DNNL_ARG_MASTER_WEIGHTS: return weights_md(0, user_input);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0) return user_input ? &desc()->grad_desc : &grad_md_;
+        if (index == 1) return &lr_md_;
+        if (index == 2 && is_adam()) return &step_md_;
+        return &glob_zero_md;
+    }
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0) return user_input ? &desc()->param_desc : &param_md_;
+        if (index <= n_moments()) return &moment_md_;
+        return &glob_zero_md;
+    }
+    const memory_desc_t *weights_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0 && with_master_weights())
+            return user_input ? &desc()->master_desc : &master_md_;
+        return &glob_zero_md;
+    }
+
+    int n_inputs() const override { return 2 + is_adam(); }
+    int n_outputs() const override {
+        return 1 + n_moments() + with_master_weights();
+    }
+
+    bool is_adam() const {
+        return utils::one_of(desc_.alg_kind, alg_kind::optimizer_adam,
+                alg_kind::optimizer_adamw);
+    }
+    // The number of moment buffers of the algorithm. SGD without momentum
+    // keeps no state.
+    int n_moments() const {
+        if (is_adam()) return 2;
+        return desc_.momentum != 0.f ? 1 : 0;
+    }
+    bool with_master_weights() const {
+        return !memory_desc_wrapper(desc_.master_desc).is_zero();
+    }
+    const memory_desc_t *master_md() const { return weights_md(0); }
+
+    bool has_zero_dim_memory() const {
+        return memory_desc_wrapper(dst_md()).has_zero_dim();
+    }
+
+protected:
+    optimizer_desc_t desc_;
+
+    memory_desc_t grad_md_;
+    memory_desc_t param_md_;
+    memory_desc_t master_md_;
+    memory_desc_t moment_md_;
+    memory_desc_t lr_md_;
+    memory_desc_t step_md_;
+
+    optimizer_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*op_desc_t::to_desc<optimizer_desc_t>(adesc))
+        , grad_md_(desc_.grad_desc)
+        , param_md_(desc_.param_desc)
+        , master_md_(desc_.master_desc)
+        , moment_md_(desc_.param_desc)
+        , lr_md_()
+        , step_md_() {
+        // Moments are kept in f32 and follow the layout of the parameters.
+        moment_md_.data_type = data_type::f32;
+
+        const dims_t scalar_dims = {1};
+        memory_desc_init_by_tag(
+                lr_md_, 1, scalar_dims, data_type::f32, format_tag::a);
+        memory_desc_init_by_tag(
+                step_md_, 1, scalar_dims, data_type::s32, format_tag::a);
+    }
+
+    // The gradient and the master weights with the `any` format follow the
+    // layout of the parameters.
+    status_t set_default_params() {
+        const auto &param_blk = param_md_.format_desc.blocking;
+        if (grad_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_blocking_desc(grad_md_, param_blk));
+        if (with_master_weights()
+                && master_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_blocking_desc(master_md_, param_blk));
+        return status::success;
+    }
+};
+// NOLINTEND(google-default-arguments)
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,204 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <limits>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/cache_utils.hpp"
+#include "common/engine.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/packed_weights_cache.hpp"
+#include "common/primitive_hashing.hpp"
+#include "common/stream.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+// inject a specialization of std::hash for packed_weights_cache::key_t into
+// std namespace
+namespace std {
+template <>
+struct hash<dnnl::impl::packed_weights_cache::key_t> {
+    using argument_type = dnnl::impl::packed_weights_cache::key_t;
+    using result_type = std::size_t;
+    result_type operator()(const argument_type &key) const {
+        return key.hash();
+    }
+};
+} // namespace std
+
+namespace dnnl {
+namespace impl {
+namespace packed_weights_cache {
+
+key_t::key_t(const memory_t *weights, const memory_desc_t &packed_md)
+    : engine_id_(weights->engine()->engine_id())
+    , handle_(nullptr)
+    , weights_md_(*weights->md())
+    , packed_md_(packed_md)
+    , thread_id_(std::this_thread::get_id()) {
+    void *handle = nullptr;
+    weights->get_data_handle(&handle);
+    handle_ = handle;
+
+    size_t seed = engine_id_.hash();
+    seed = hash_combine(seed, handle_);
+    seed = hash_combine(seed, primitive_hashing::get_md_hash(weights_md_));
+    seed = hash_combine(seed, primitive_hashing::get_md_hash(packed_md_));
+    hash_ = seed;
+}
+
+bool key_t::operator==(const key_t &rhs) const {
+    return hash_ == rhs.hash_ && handle_ == rhs.handle_
+            && engine_id_ == rhs.engine_id_ && weights_md_ == rhs.weights_md_
+            && packed_md_ == rhs.packed_md_;
+}
+
+namespace {
+
+size_t footprint(const memory_t &m) {
+    return memory_desc_wrapper(m.md()).size();
+}
+
+using cache_t = utils::lru_cache_t<key_t, memory_t, result_t, nullptr,
+        footprint>;
+
+// The number of entries is not limited, only their total size.
+constexpr int unlimited_entries = std::numeric_limits<int>::max();
+
+cache_t &global_cache() {
+    static const size_t capacity
+            = getenv_size_user("PACKED_WEIGHTS_CACHE_CAPACITY", 0);
+    static cache_t cache(capacity ? unlimited_entries : 0, capacity);
+    return cache;
+}
+
+struct create_context_t {
+    const memory_desc_t &packed_md;
+    const memory_t *weights;
+    stream_t *stream;
+};
+
+result_t create_packed_weights(void *context) {
+    const auto &c = *static_cast<create_context_t *>(context);
+    engine_t *engine = c.weights->engine();
+
+    memory_t *packed_ptr = nullptr;
+    status_t status = dnnl_memory_create(
+            &packed_ptr, &c.packed_md, engine, DNNL_MEMORY_ALLOCATE);
+    if (status != status::success) return {nullptr, status};
+
+    // The engine is kept alive while the packed weights are cached.
+    engine->retain();
+    std::shared_ptr<memory_t> packed(packed_ptr, [engine](memory_t *m) {
+        m->release();
+        engine->release();
+    });
+
+    primitive_desc_iface_t *pd_ptr = nullptr;
+    status = dnnl_reorder_primitive_desc_create(&pd_ptr, c.weights->md(),
+            engine, &c.packed_md, engine, nullptr);
+    if (status != status::success) return {nullptr, status};
+    std::unique_ptr<primitive_desc_iface_t,
+            decltype(&dnnl_primitive_desc_destroy)>
+            pd(pd_ptr, &dnnl_primitive_desc_destroy);
+
+    primitive_iface_t *prim_ptr = nullptr;
+    status = dnnl_primitive_create(&prim_ptr, pd.get());
+    if (status != status::success) return {nullptr, status};
+    std::unique_ptr<primitive_iface_t, decltype(&dnnl_primitive_destroy)>
+            prim(prim_ptr, &dnnl_primitive_destroy);
+
+    const dnnl_exec_arg_t args[] = {
+            {DNNL_ARG_FROM, const_cast<memory_t *>(c.weights)},
+            {DNNL_ARG_TO, packed.get()},
+    };
+    status = dnnl_primitive_execute(prim.get(), c.stream, 2, args);
+    if (status != status::success) return {nullptr, status};
+    // Other threads may use the packed weights as soon as they are cached.
+    status = c.stream->wait();
+    if (status != status::success) return {nullptr, status};
+
+    return {std::move(packed), status::success};
+}
+
+} // namespace
+
+size_t get_capacity() {
+    auto &cache = global_cache();
+    return cache.get_capacity() == 0 ? 0 : cache.get_weight_limit();
+}
+
+status_t set_capacity(size_t capacity) {
+    auto &cache = global_cache();
+    if (capacity == 0) return cache.set_capacity(0);
+    cache.set_weight_limit(capacity);
+    return cache.set_capacity(unlimited_entries);
+}
+
+status_t get_or_create(memory_t **packed, const memory_desc_t &packed_md,
+        const memory_t *weights, stream_t *stream) {
+    if (utils::any_null(packed, weights, stream))
+        return status::invalid_arguments;
+    if (stream->engine() != weights->engine()) return status::invalid_arguments;
+
+    const memory_desc_wrapper weights_d(weights->md());
+    const memory_desc_wrapper packed_d(packed_md);
+    if (weights_d.has_runtime_dims_or_strides()
+            || packed_d.has_runtime_dims_or_strides()
+            || packed_d.format_any())
+        return status::invalid_arguments;
+
+    void *handle = nullptr;
+    CHECK(weights->get_data_handle(&handle));
+    if (handle == nullptr) return status::invalid_arguments;
+
+    key_t key(weights, packed_md);
+    create_context_t context {packed_md, weights, stream};
+    auto r = global_cache().get_or_create(
+            key, create_packed_weights, &context, false);
+    if (r.status != status::success) return r.status;
+
+    // The returned memory object is owned by the user in addition to the
+    // cache.
+    r.value->retain();
+    *packed = r.value.get();
+    return status::success;
+}
+
+} // namespace packed_weights_cache
+} // namespace impl
+} // namespace dnnl
+
+// API
+dnnl::impl::status_t dnnl_get_packed_weights_cache_capacity(size_t *capacity) {
+    if (capacity == nullptr) return dnnl::impl::status::invalid_arguments;
+    *capacity = dnnl::impl::packed_weights_cache::get_capacity();
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_set_packed_weights_cache_capacity(size_t capacity) {
+    return dnnl::impl::packed_weights_cache::set_capacity(capacity);
+}
+
+dnnl::impl::status_t dnnl_packed_weights_get_or_create(
+        dnnl::impl::memory_t **packed,
+        const dnnl::impl::memory_desc_t *packed_md,
+        const dnnl::impl::memory_t *weights, dnnl::impl::stream_t *stream) {
+    if (packed_md == nullptr) return dnnl::impl::status::invalid_arguments;
+    return dnnl::impl::packed_weights_cache::get_or_create(
+            packed, *packed_md, weights, stream);
+}
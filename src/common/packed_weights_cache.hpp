@@ -0,0 +1,85 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_PACKED_WEIGHTS_CACHE_HPP
+#define COMMON_PACKED_WEIGHTS_CACHE_HPP
+
+#include <memory>
+#include <thread>
+
+#include "common/c_types_map.hpp"
+#include "common/engine_id.hpp"
+#include "common/memory.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace packed_weights_cache {
+
+// The packed copy of weights is identified by the weights buffer, the weights
+// memory descriptor and the memory descriptor of the packed copy. The content
+// of the weights is not part of the key: weights are assumed to stay
+// constant while their packed copy is cached.
+struct key_t {
+    key_t(const memory_t *weights, const memory_desc_t &packed_md);
+
+    bool operator==(const key_t &rhs) const;
+    size_t hash() const { return hash_; }
+
+    const std::thread::id &thread_id() const { return thread_id_; }
+    bool has_runtime_dependencies() const {
+        return !(engine_id_.kind() == engine_kind::cpu
+                && is_native_runtime(engine_id_.runtime_kind()));
+    }
+
+private:
+    engine_id_t engine_id_;
+    const void *handle_;
+    memory_desc_t weights_md_;
+    memory_desc_t packed_md_;
+    // Thread ID is not used as part of the key, it's only used to get
+    // information about what thread inserted the key and the corresponding
+    // packed weights into the cache.
+    std::thread::id thread_id_;
+    size_t hash_;
+};
+
+struct result_t {
+    result_t() : status(status::success) {}
+    result_t(std::shared_ptr<memory_t> m, status_t s)
+        : value(std::move(m)), status(s) {}
+    bool is_empty() const { return value == nullptr; }
+    memory_t &get_value() const { return *value; }
+    std::shared_ptr<memory_t> value;
+    status_t status;
+};
+
+// The capacity is the amount of memory in bytes that the cached packed
+// weights may occupy. The capacity of 0 disables the cache.
+size_t get_capacity();
+status_t set_capacity(size_t capacity);
+
+// Returns a memory object described by `packed_md` that holds `weights`
+// reordered into `packed_md`. The reorder is executed on `stream` and is
+// complete on return. Memory objects returned for the same key share the
+// buffer, so users must not modify it.
+status_t get_or_create(memory_t **packed, const memory_desc_t &packed_md,
+        const memory_t *weights, stream_t *stream);
+
+} // namespace packed_weights_cache
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -19,6 +19,7 @@
 
 #include "c_types_map.hpp"
 #include "opdesc.hpp"
+#include "pooling_pd.hpp"
 #include "primitive_desc_iface.hpp"
 #include "type_helpers.hpp"
 #include "utils.hpp"
@@ -44,11 +45,15 @@ status_t pooling_desc_init(pooling_desc_t *pool_desc, prop_kind_t prop_kind,
         const memory_desc_t *dst_desc, const dims_t strides,
         const dims_t kernel, const dims_t dilation, const dims_t padding_l,
         const dims_t padding_r) {
-    VCHECK_POOLING(!any_null(pool_desc, src_desc, dst_desc, strides, kernel,
-                           padding_l),
+    const bool is_adaptive
+            = one_of(alg_kind, pooling_adaptive_max, pooling_adaptive_avg);
+    VCHECK_POOLING(!any_null(pool_desc, src_desc, dst_desc), VERBOSE_NULL_ARG);
+    VCHECK_POOLING(
+            IMPLICATION(!is_adaptive, !any_null(strides, kernel, padding_l)),
             VERBOSE_NULL_ARG);
     VCHECK_POOLING(one_of(alg_kind, pooling_max, pooling_avg_include_padding,
-                           pooling_avg_exclude_padding),
+                           pooling_avg_exclude_padding, pooling_adaptive_max,
+                           pooling_adaptive_avg),
             VERBOSE_BAD_ALGORITHM);
     VCHECK_POOLING(
             IMPLICATION(one_of(prop_kind, forward_training, forward_inference),
@@ -78,14 +83,17 @@ status_t pooling_desc_init(pooling_desc_t *pool_desc, prop_kind_t prop_kind,
     (is_fwd ? pd.dst_desc : pd.diff_dst_desc) = *dst_desc;
 
     int sp_dims = src_desc->ndims - 2;
-    utils::array_copy(pd.strides, strides, sp_dims);
-    utils::array_copy(pd.kernel, kernel, sp_dims);
-    utils::array_copy(pd.padding[0], padding_l, sp_dims);
-    utils::array_copy(pd.padding[1], padding_r, sp_dims);
-    utils::array_copy(pd.dilation, dilation, sp_dims);
+    if (!is_adaptive) {
+        utils::array_copy(pd.strides, strides, sp_dims);
+        utils::array_copy(pd.kernel, kernel, sp_dims);
+        utils::array_copy(pd.padding[0], padding_l, sp_dims);
+        utils::array_copy(pd.padding[1], padding_r, sp_dims);
+        utils::array_copy(pd.dilation, dilation, sp_dims);
+    }
 
     if (one_of(alg_kind, pooling_max, pooling_avg_include_padding,
-                pooling_avg_exclude_padding)) {
+                pooling_avg_exclude_padding, pooling_adaptive_max,
+                pooling_adaptive_avg)) {
         pd.accum_data_type = types::default_accum_data_type(
                 src_desc->data_type, dst_desc->data_type, false);
     } else {
@@ -105,6 +113,23 @@ status_t pooling_desc_init(pooling_desc_t *pool_desc, prop_kind_t prop_kind,
     for (int i = 2; i < src_desc->ndims; ++i) {
         const dim_t src = src_desc->dims[i];
         const dim_t dst = dst_desc->dims[i];
+
+        if (is_adaptive) {
+            // Windows of adaptive pooling vary per output point. The largest
+            // one is kept as the kernel, which also sizes the workspace
+            // indices, and the stride is set to the average window step.
+            VCHECK_POOLING(IMPLICATION(dst > 0, src > 0),
+                    VERBOSE_INCONSISTENT_PRB);
+            dim_t max_ker = 1;
+            for (dim_t o = 0; o < dst; ++o)
+                max_ker = nstl::max(max_ker,
+                        adaptive_pool_end(o, src, dst)
+                                - adaptive_pool_start(o, src, dst));
+            pd.kernel[i - 2] = max_ker;
+            pd.strides[i - 2] = nstl::max<dim_t>(1, dst > 0 ? src / dst : 1);
+            continue;
+        }
+
         const dim_t ker = kernel[i - 2];
         const dim_t dil = dilation ? dilation[i - 2] : 0;
         const dim_t pad_l = padding_l[i - 2];
@@ -40,6 +40,15 @@
 namespace dnnl {
 namespace impl {
 
+// Bounds [start, end) of the window of output point `o` for adaptive pooling
+// of `src` input points into `dst` output points.
+inline dim_t adaptive_pool_start(dim_t o, dim_t src, dim_t dst) {
+    return o * src / dst;
+}
+inline dim_t adaptive_pool_end(dim_t o, dim_t src, dim_t dst) {
+    return utils::div_up((o + 1) * src, dst);
+}
+
 struct pooling_fwd_pd_t;
 
 struct pooling_pd_t : public primitive_desc_t {
@@ -131,6 +140,11 @@ struct pooling_pd_t : public primitive_desc_t {
 
     bool is_dilated() const { return KDD() != 0 || KDH() != 0 || KDW() != 0; }
 
+    bool is_adaptive() const {
+        return utils::one_of(desc_.alg_kind, alg_kind::pooling_adaptive_max,
+                alg_kind::pooling_adaptive_avg);
+    }
+
     bool has_zero_dim_memory() const {
         return memory_desc_wrapper(src_desc()).has_zero_dim();
     }
@@ -41,6 +41,19 @@ using namespace dnnl::impl::primitive_kind;
 namespace dnnl {
 namespace impl {
 
+namespace {
+// Only grows, consumers compute differences.
+thread_local size_t reported_footprint = 0;
+} // namespace
+
+void report_primitive_footprint(size_t bytes) {
+    reported_footprint += bytes;
+}
+
+size_t get_reported_primitive_footprint() {
+    return reported_footprint;
+}
+
 nested_scratchpad_t::nested_scratchpad_t(const exec_ctx_t &master_ctx, int key,
         const std::shared_ptr<primitive_t> &nested_p) {
     auto scratchpad = master_ctx.get_scratchpad_grantor();
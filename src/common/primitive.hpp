@@ -28,6 +28,7 @@
 #include "memory_storage.hpp"
 #include "memory_tracking.hpp"
 #include "primitive_desc.hpp"
+#include "primitive_disk_cache.hpp"
 #include "primitive_exec_types.hpp"
 #include "rw_mutex.hpp"
 #include "scratchpad.hpp"
@@ -39,6 +40,14 @@ namespace dnnl {
 namespace impl {
 
 struct resource_mapper_t;
+
+// Implementations report memory they allocate outside of the heap objects
+// during initialization, e.g. JIT-generated code. The amount is accumulated
+// per thread and attributed to the primitive being initialized, to let the
+// primitive cache bound its memory usage.
+void report_primitive_footprint(size_t bytes);
+size_t get_reported_primitive_footprint();
+
 // Primitive implementation
 struct primitive_t : public c_compatible {
     using primitive_list_t = std::vector<const primitive_t *>;
@@ -51,7 +60,11 @@ struct primitive_t : public c_compatible {
     status_t init(engine_t *engine, bool use_global_scratchpad,
             const cache_blob_t &cache_blob) {
         cache_blob_ = cache_blob;
+        const size_t footprint_start = get_reported_primitive_footprint();
         CHECK(init(engine));
+        // Nested primitives created during initialization are accounted as
+        // well.
+        footprint_ = get_reported_primitive_footprint() - footprint_start;
         use_global_scratchpad_ = use_global_scratchpad;
         // The `cache_blob_` is no longer needed after primitive creation.
         cache_blob_ = cache_blob_t();
@@ -60,17 +73,20 @@ struct primitive_t : public c_compatible {
 
     const std::shared_ptr<primitive_desc_t> &pd() const { return pd_; }
     primitive_kind_t kind() const { return pd_->kind(); }
+    // Memory reported by the implementation during initialization and by the
+    // code generated lazily afterwards.
+    size_t footprint() const { return footprint_; }
     virtual status_t execute(const exec_ctx_t &ctx) const = 0;
 
+    // Not every CPU implementation can serialize its state; those that can
+    // override both methods.
     virtual status_t get_cache_blob(
             engine_t *engine, cache_blob_t &cache_blob) const {
-        assert(!"unexpected");
-        return status::runtime_error;
+        return status::unimplemented;
     }
 
     virtual status_t get_cache_blob_size(engine_t *engine, size_t *size) const {
-        assert(!"unexpected");
-        return status::runtime_error;
+        return status::unimplemented;
     }
 
     virtual status_t create_resource(
@@ -91,6 +107,7 @@ protected:
             const pd_t *pd, engine_t *engine, bool use_global_scratchpad,
             const cache_blob_t &cache_blob, bool force_create_from_blob) {
 
+        max_threads_limit_guard_t max_threads_guard(pd->attr()->max_threads_);
         auto global_primitive_cache = primitive_cache();
         primitive_hashing::key_t key(pd, engine);
 
@@ -110,10 +127,27 @@ protected:
 
         primitive_cache_iface_t::create_func_ptr_t create = [](void *context) {
             auto &c = *static_cast<create_context_t *>(context);
+            // On a miss in the in-memory cache try the on-disk one before
+            // generating the primitive from scratch.
+            std::vector<uint8_t> disk_blob;
+            if (!c.cache_blob
+                    && primitive_disk_cache::load(c.engine, c.pd, disk_blob)) {
+                std::shared_ptr<primitive_t> p
+                        = std::make_shared<impl_type>(c.pd);
+                cache_blob_t cb(disk_blob.data(), disk_blob.size());
+                if (p->init(c.engine, c.use_global_scratchpad, cb)
+                        == status::success) {
+                    c.cache_status = cache_state_t::persistent_hit;
+                    return primitive_cache_iface_t::result_t {
+                            std::move(p), status::success};
+                }
+            }
             std::shared_ptr<primitive_t> p = std::make_shared<impl_type>(c.pd);
             status_t status
                     = p->init(c.engine, c.use_global_scratchpad, c.cache_blob);
             c.cache_status = p->creation_cache_state();
+            if (status == status::success && !c.cache_blob)
+                primitive_disk_cache::store(c.engine, *p);
             return primitive_cache_iface_t::result_t {std::move(p), status};
         };
         auto result = global_primitive_cache.get_or_create(
@@ -126,6 +160,11 @@ protected:
     bool use_global_scratchpad_ = false;
     cache_blob_t cache_blob_;
     cache_state_t creation_cached_state_ = cache_state_t::miss;
+    mutable std::atomic<size_t> footprint_ {0};
+
+    // Accounts the memory reported while generating code lazily, e.g. at
+    // the first execution.
+    void add_footprint(size_t bytes) const { footprint_ += bytes; }
 
 private:
     primitive_t() = delete;
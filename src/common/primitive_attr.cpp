@@ -122,6 +122,15 @@ bool primitive_attr_t::has_default_values(dnnl_primitive_attr::skip_mask_t mask,
             (bool)(~mask & smask_t::dropout), dropout_.has_default_values()));
     CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::rounding_mode),
             rounding_mode_.has_default_values()));
+    CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::src_dyn_quant),
+            src_dyn_quant_dt_ == data_type::undef));
+    CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::dst_amax), !dst_amax_));
+    CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::secondary_dst),
+            secondary_dst_dt_ == data_type::undef));
+    CHECK_ARG(IMPLICATION(
+            (bool)(~mask & smask_t::dst_dyn_quant), !dst_dyn_quant_));
+    CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::activation_stash),
+            activation_stash_dt_ == data_type::undef));
     CHECK_ARG(this->defined(smask_t::none));
     bool fpmath_mode_ok = IMPLICATION(
             (bool)(~mask & smask_t::fpmath_mode) && fpmath_.apply_to_int_,
@@ -549,6 +558,113 @@ status_t dnnl_primitive_attr_set_deterministic(primitive_attr_t *attr, int d) {
     return success;
 }
 
+status_t dnnl_primitive_attr_get_max_threads(
+        const primitive_attr_t *attr, int *nthr) {
+    if (any_null(attr, nthr)) return invalid_arguments;
+    *nthr = attr->max_threads_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_max_threads(
+        primitive_attr_t *attr, int nthr) {
+    if (any_null(attr)) return invalid_arguments;
+    VCHECK_ATTR(nthr >= 0, VERBOSE_BAD_PARAM, "max_threads");
+    attr->max_threads_ = nthr;
+    return success;
+}
+
+status_t dnnl_primitive_attr_get_constant_quantization(
+        const primitive_attr_t *attr, int *value) {
+    if (any_null(attr, value)) return invalid_arguments;
+    *value = attr->constant_quant_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_constant_quantization(
+        primitive_attr_t *attr, int value) {
+    if (any_null(attr)) return invalid_arguments;
+    attr->constant_quant_ = value;
+    return success;
+}
+
+status_t dnnl_primitive_attr_get_src_dynamic_quantization(
+        const primitive_attr_t *attr, data_type_t *data_type) {
+    if (any_null(attr, data_type)) return invalid_arguments;
+    *data_type = attr->src_dyn_quant_dt_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_src_dynamic_quantization(
+        primitive_attr_t *attr, data_type_t data_type) {
+    if (any_null(attr)) return invalid_arguments;
+    VCHECK_ATTR(one_of(data_type, data_type::undef, data_type::s8),
+            VERBOSE_INVALID_DATATYPE, "src_dynamic_quantization");
+    attr->src_dyn_quant_dt_ = data_type;
+    return success;
+}
+
+status_t dnnl_primitive_attr_get_dst_amax(
+        const primitive_attr_t *attr, int *value) {
+    if (any_null(attr, value)) return invalid_arguments;
+    *value = attr->dst_amax_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_dst_amax(primitive_attr_t *attr, int value) {
+    if (any_null(attr)) return invalid_arguments;
+    attr->dst_amax_ = value;
+    return success;
+}
+
+status_t dnnl_primitive_attr_get_secondary_dst(
+        const primitive_attr_t *attr, data_type_t *data_type) {
+    if (any_null(attr, data_type)) return invalid_arguments;
+    *data_type = attr->secondary_dst_dt_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_secondary_dst(
+        primitive_attr_t *attr, data_type_t data_type) {
+    if (any_null(attr)) return invalid_arguments;
+    VCHECK_ATTR(one_of(data_type, data_type::undef, data_type::s8,
+                        data_type::u8, data_type::f8_e5m2, data_type::f8_e4m3),
+            VERBOSE_INVALID_DATATYPE, "secondary_dst");
+    attr->secondary_dst_dt_ = data_type;
+    return success;
+}
+
+status_t dnnl_primitive_attr_get_dst_dynamic_quantization(
+        const primitive_attr_t *attr, int *value) {
+    if (any_null(attr, value)) return invalid_arguments;
+    *value = attr->dst_dyn_quant_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_dst_dynamic_quantization(
+        primitive_attr_t *attr, int value) {
+    if (any_null(attr)) return invalid_arguments;
+    attr->dst_dyn_quant_ = value;
+    return success;
+}
+
+status_t dnnl_primitive_attr_get_activation_stash(
+        const primitive_attr_t *attr, data_type_t *data_type) {
+    if (any_null(attr, data_type)) return invalid_arguments;
+    *data_type = attr->activation_stash_dt_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_activation_stash(
+        primitive_attr_t *attr, data_type_t data_type) {
+    if (any_null(attr)) return invalid_arguments;
+    VCHECK_ATTR(one_of(data_type, data_type::undef, data_type::bf16,
+                        data_type::f16, data_type::f8_e5m2,
+                        data_type::f8_e4m3),
+            VERBOSE_INVALID_DATATYPE, "activation_stash");
+    attr->activation_stash_dt_ = data_type;
+    return success;
+}
+
 status_t dnnl_primitive_attr_get_scratchpad_mode(
         const primitive_attr_t *attr, scratchpad_mode_t *scratchpad_mode) {
     if (any_null(attr, scratchpad_mode)) return invalid_arguments;
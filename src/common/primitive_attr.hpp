@@ -535,7 +535,14 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         : scratchpad_mode_(dnnl::impl::scratchpad_mode::library)
         , fpmath_(dnnl::impl::get_fpmath_mode(), false)
         , acc_mode_(dnnl::impl::accumulation_mode::strict)
-        , deterministic_(false) {}
+        , deterministic_(false)
+        , max_threads_(0)
+        , constant_quant_(false)
+        , src_dyn_quant_dt_(dnnl::impl::data_type::undef)
+        , dst_amax_(false)
+        , secondary_dst_dt_(dnnl::impl::data_type::undef)
+        , dst_dyn_quant_(false)
+        , activation_stash_dt_(dnnl::impl::data_type::undef) {}
 
     ~dnnl_primitive_attr() = default;
 
@@ -559,6 +566,13 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         fpmath_ = other.fpmath_;
         acc_mode_ = other.acc_mode_;
         deterministic_ = other.deterministic_;
+        max_threads_ = other.max_threads_;
+        constant_quant_ = other.constant_quant_;
+        src_dyn_quant_dt_ = other.src_dyn_quant_dt_;
+        dst_amax_ = other.dst_amax_;
+        secondary_dst_dt_ = other.secondary_dst_dt_;
+        dst_dyn_quant_ = other.dst_dyn_quant_;
+        activation_stash_dt_ = other.activation_stash_dt_;
         post_ops_ = other.post_ops_;
         rnn_data_qparams_ = other.rnn_data_qparams_;
         CHECK(rnn_weights_qparams_.copy_from(other.rnn_weights_qparams_));
@@ -592,6 +606,11 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         fpmath_mode = 1u << 15,
         dropout = 1u << 16,
         rounding_mode = 1u << 17,
+        src_dyn_quant = 1u << 18,
+        dst_amax = 1u << 19,
+        secondary_dst = 1u << 20,
+        dst_dyn_quant = 1u << 21,
+        activation_stash = 1u << 22,
     };
 
     /** Returns true if the attributes have default values.
@@ -607,6 +626,13 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         bool ret = scratchpad_mode_ == rhs.scratchpad_mode_
                 && fpmath_ == rhs.fpmath_ && acc_mode_ == rhs.acc_mode_
                 && deterministic_ == rhs.deterministic_
+                && max_threads_ == rhs.max_threads_
+                && constant_quant_ == rhs.constant_quant_
+                && src_dyn_quant_dt_ == rhs.src_dyn_quant_dt_
+                && dst_amax_ == rhs.dst_amax_
+                && secondary_dst_dt_ == rhs.secondary_dst_dt_
+                && dst_dyn_quant_ == rhs.dst_dyn_quant_
+                && activation_stash_dt_ == rhs.activation_stash_dt_
                 && scales_ == rhs.scales_ && zero_points_ == rhs.zero_points_
                 && post_ops_ == rhs.post_ops_
                 && rnn_data_qparams_ == rhs.rnn_data_qparams_
@@ -687,6 +713,22 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl::impl::fpmath_t fpmath_;
     dnnl::impl::accumulation_mode_t acc_mode_;
     bool deterministic_;
+    // Maximum number of threads, zero means no limit.
+    int max_threads_;
+    // Whether the values of scales, zero-points and weights don't change
+    // between executions, so values derived from them may be computed once.
+    bool constant_quant_;
+    // Data type for dynamic quantization of the source, undef means off.
+    dnnl::impl::data_type_t src_dyn_quant_dt_;
+    // Whether the absolute maximum of the destination is computed.
+    bool dst_amax_;
+    // Data type of the secondary destination, undef means off.
+    dnnl::impl::data_type_t secondary_dst_dt_;
+    // Whether the destination scales and zero points are computed.
+    bool dst_dyn_quant_;
+    // Data type of the activation copy kept in the workspace for backward,
+    // undef means off.
+    dnnl::impl::data_type_t activation_stash_dt_;
     dnnl::impl::post_ops_t post_ops_;
     dnnl::impl::rnn_data_qparams_t rnn_data_qparams_;
     dnnl::impl::rnn_create_time_scales_t rnn_weights_qparams_;
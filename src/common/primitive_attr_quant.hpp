@@ -271,6 +271,11 @@ private:
         for (const auto &sa : {DNNL_ARG_SRC_1}) {
             if (arg == sa) return true;
         }
+        // backward propagation
+        for (const auto &sa : {DNNL_ARG_DIFF_SRC, DNNL_ARG_DIFF_WEIGHTS,
+                     DNNL_ARG_DIFF_DST}) {
+            if (arg == sa) return true;
+        }
         // concat
         if (arg & DNNL_ARG_MULTIPLE_SRC) return true;
         // depth-wise convolution post op
@@ -279,6 +284,8 @@ private:
         }
         // sdpa
         if (arg == DNNL_ARG_SRC_2) return true;
+        // rnn weight-only quantization
+        if (arg == DNNL_ARG_WEIGHTS_ITER) return true;
         return false;
     }
 };
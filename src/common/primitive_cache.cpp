@@ -32,7 +32,8 @@ struct primitive_cache_t {
     using result_t = primitive_cache_iface_t::result_t;
     using create_func_t = result_t (&)(void *);
 
-    primitive_cache_t(int capacity) : cache_(capacity) {};
+    primitive_cache_t(int capacity, size_t memory_limit)
+        : cache_(capacity, memory_limit) {};
 
     ~primitive_cache_t() = default;
 
@@ -42,6 +43,10 @@ struct primitive_cache_t {
     int get_capacity() const { return cache_.get_capacity(); }
     int get_size() const { return cache_.get_size(); }
 
+    void set_memory_limit(size_t limit) { cache_.set_weight_limit(limit); }
+    size_t get_memory_limit() const { return cache_.get_weight_limit(); }
+    size_t get_memory_usage() const { return cache_.get_weight(); }
+
     std::shared_ptr<primitive_desc_t> get_pd(const key_t &key) {
         result_t result = cache_.get(key);
         return result.value != nullptr ? result.value->pd() : nullptr;
@@ -58,6 +63,7 @@ private:
         key.op_desc_ = pd->op_desc();
         key.attr_ = pd->attr();
     }
+    static size_t footprint(const primitive_t &p) { return p.footprint(); }
     // Used for testing.
     friend size_t DNNL_API set_primitive_cache_capacity_without_clearing(
             size_t capacity);
@@ -65,17 +71,21 @@ private:
         cache_.set_capacity_without_clearing(capacity);
     }
 
-    utils::lru_cache_t<key_t, primitive_t, result_t, update_key> cache_;
+    utils::lru_cache_t<key_t, primitive_t, result_t, update_key, footprint>
+            cache_;
 };
 
 primitive_cache_t &global_primitive_cache() {
 #ifndef DNNL_DISABLE_PRIMITIVE_CACHE
     static const int capacity
             = getenv_int_user("PRIMITIVE_CACHE_CAPACITY", 1024);
+    static const size_t memory_limit
+            = getenv_size_user("PRIMITIVE_CACHE_MEMORY_LIMIT");
 #else
     static const int capacity = 0;
+    static const size_t memory_limit = 0;
 #endif
-    static primitive_cache_t cache(capacity);
+    static primitive_cache_t cache(capacity, memory_limit);
     return cache;
 }
 
@@ -93,6 +103,15 @@ status_t get_primitive_cache_size(int *size) {
     return dnnl::impl::status::success;
 }
 
+status_t get_primitive_cache_memory_usage(size_t *usage) {
+    if (usage == nullptr) return dnnl::impl::status::invalid_arguments;
+    *usage = 0;
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    *usage = global_primitive_cache().get_memory_usage();
+#endif
+    return dnnl::impl::status::success;
+}
+
 bool is_pd_in_cache(const primitive_desc_iface_t *pd_iface) {
     const auto *pd = pd_iface->impl().get();
     const auto *engine = pd_iface->engine();
@@ -165,3 +184,19 @@ dnnl::impl::status_t dnnl_get_primitive_cache_capacity(int *capacity) {
 dnnl::impl::status_t dnnl_set_primitive_cache_capacity(int capacity) {
     return dnnl::impl::set_primitive_cache_capacity(capacity, capacity);
 }
+
+dnnl::impl::status_t dnnl_get_primitive_cache_memory_limit(size_t *limit) {
+    if (limit == nullptr) return dnnl::impl::status::invalid_arguments;
+    *limit = 0;
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    *limit = dnnl::impl::global_primitive_cache().get_memory_limit();
+#endif
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_set_primitive_cache_memory_limit(size_t limit) {
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    dnnl::impl::global_primitive_cache().set_memory_limit(limit);
+#endif
+    return dnnl::impl::status::success;
+}
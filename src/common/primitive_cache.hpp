@@ -64,6 +64,7 @@ status_t set_primitive_cache_capacity(
 
 // Undocumented API for testing.
 status_t DNNL_API get_primitive_cache_size(int *size);
+status_t DNNL_API get_primitive_cache_memory_usage(size_t *usage);
 bool DNNL_API is_primitive_in_cache(const primitive_iface_t *p_iface);
 bool DNNL_API is_pd_in_cache(const primitive_desc_iface_t *pd_iface);
 size_t DNNL_API set_primitive_cache_capacity_without_clearing(size_t capacity);
@@ -180,6 +180,17 @@ struct primitive_desc_t : public c_compatible {
         if (arg == DNNL_ARG_ATTR_DROPOUT_SEED)
             return !attr()->dropout_.has_default_values() ? arg_usage_t::input
                                                           : arg_usage_t::unused;
+        if (arg == DNNL_ARG_ATTR_DST_AMAX)
+            return attr()->dst_amax_ ? arg_usage_t::output
+                                     : arg_usage_t::unused;
+        if (arg == DNNL_ARG_ATTR_SECONDARY_DST)
+            return attr()->secondary_dst_dt_ != data_type::undef
+                    ? arg_usage_t::output
+                    : arg_usage_t::unused;
+        if (arg == DNNL_ARG_ATTR_SECONDARY_DST_SCALE)
+            return attr()->secondary_dst_dt_ != data_type::undef
+                    ? arg_usage_t::input
+                    : arg_usage_t::unused;
         if (arg == DNNL_ARG_ATTR_ROUNDING_SEED)
             return !attr()->rounding_mode_.has_default_values()
                     ? arg_usage_t::input
@@ -232,6 +243,12 @@ struct primitive_desc_t : public c_compatible {
             case DNNL_ARG_SCRATCHPAD: return scratchpad_md(0);
             case DNNL_ARG_ATTR_DROPOUT_MASK:
                 return &attr()->dropout_.dropout_desc_;
+            case DNNL_ARG_ATTR_DST_AMAX:
+                return attr()->dst_amax_ ? &glob_amax_md : &glob_zero_md;
+            case DNNL_ARG_ATTR_SECONDARY_DST_SCALE:
+                return attr()->secondary_dst_dt_ != data_type::undef
+                        ? &glob_amax_md
+                        : &glob_zero_md;
             default: return &glob_zero_md;
         }
     }
@@ -20,6 +20,7 @@
 #include "oneapi/dnnl/dnnl.h"
 
 #include "c_types_map.hpp"
+#include "dispatch_memo.hpp"
 #include "engine.hpp"
 #include "impl_list_item.hpp"
 #include "primitive_attr.hpp"
@@ -69,6 +70,9 @@ struct primitive_desc_iterator_t : public c_compatible {
         // The state is equal to the state of the iterator that end() returns.
         if (idx_ == last_idx_) return *this;
 
+        // Implementations size their blocking by dnnl_get_max_threads().
+        max_threads_limit_guard_t max_threads_guard(attr_.max_threads_);
+
         offset_++;
         pd_.reset();
 
@@ -80,6 +84,21 @@ struct primitive_desc_iterator_t : public c_compatible {
         pd_ = primitive_cache().get_pd(key);
         if (pd_) { return *this; }
 
+        // The candidates before the memoized one rejected the same problem
+        // earlier. If the memoized one rejects it now, fall back to the full
+        // walk to keep the dispatching order.
+        const int memo_idx = dispatch_memo::get(key);
+        if (memo_idx > idx_ && memo_idx < last_idx_ && memo_idx != skip_idx_) {
+            primitive_desc_t *candidate_pd = nullptr;
+            auto s = impl_list_[memo_idx](&candidate_pd, op_desc_.get(),
+                    &attr_, engine_, hint_fwd_pd_, offset_, skip_idx_);
+            if (s == status::success) {
+                idx_ = memo_idx;
+                pd_.reset(candidate_pd);
+                return *this;
+            }
+        }
+
         while (++idx_ != last_idx_) {
             if (idx_ == skip_idx_) continue;
             primitive_desc_t *candidate_pd = nullptr;
@@ -87,6 +106,7 @@ struct primitive_desc_iterator_t : public c_compatible {
                     engine_, hint_fwd_pd_, offset_, skip_idx_);
             if (s == status::success) {
                 pd_.reset(candidate_pd);
+                if (idx_ != memo_idx) dispatch_memo::put(key, idx_);
                 break;
             }
         }
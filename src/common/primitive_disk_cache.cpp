@@ -0,0 +1,205 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "primitive.hpp"
+#include "primitive_desc.hpp"
+#include "primitive_disk_cache.hpp"
+#include "utils.hpp"
+#include "verbose.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace primitive_disk_cache {
+
+namespace {
+
+// Bump when the file layout changes.
+constexpr uint64_t file_magic = 0x314350444c4e4e44ULL; // "DNNLDPC1"
+
+struct state_t {
+    state_t() {
+        // Paths are case sensitive, so `getenv_string_user()` can't be used.
+        const int len = 4096;
+        char value[len];
+        for (const auto &prefix : {"ONEDNN_", "DNNL_"}) {
+            std::string name = std::string(prefix) + "PRIMITIVE_CACHE_DIR";
+            if (impl::getenv(name.c_str(), value, len) > 0) {
+                dir = value;
+                break;
+            }
+        }
+    }
+
+    std::mutex mutex;
+    std::string dir;
+};
+
+state_t &state() {
+    static state_t s;
+    return s;
+}
+
+// FNV-1a, which unlike `std::hash` is stable across builds and runs.
+uint64_t hash_id(const std::vector<uint8_t> &id) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (uint8_t b : id) {
+        h ^= b;
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+std::string entry_path(const std::string &dir, const std::vector<uint8_t> &id) {
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.dnnl",
+            (unsigned long long)hash_id(id));
+    return dir + "/" + name;
+}
+
+bool read_all(FILE *f, void *data, size_t size) {
+    return size == 0 || fread(data, 1, size, f) == size;
+}
+
+bool write_all(FILE *f, const void *data, size_t size) {
+    return size == 0 || fwrite(data, 1, size, f) == size;
+}
+
+} // namespace
+
+void set_dir(const std::string &dir) {
+    auto &s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    s.dir = dir;
+}
+
+std::string get_dir() {
+    auto &s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    return s.dir;
+}
+
+bool is_enabled() {
+    return !get_dir().empty();
+}
+
+bool load(engine_t *engine, const primitive_desc_t *pd,
+        std::vector<uint8_t> &blob) {
+    if (!is_enabled()) return false;
+    return load(pd->get_cache_blob_id(engine), blob);
+}
+
+void store(engine_t *engine, const primitive_t &p) {
+    if (!is_enabled()) return;
+
+    const auto &id = p.pd()->get_cache_blob_id(engine);
+    if (id.empty()) return;
+
+    size_t blob_size = 0;
+    if (p.get_cache_blob_size(engine, &blob_size) != status::success
+            || blob_size == 0)
+        return;
+    std::vector<uint8_t> blob(blob_size);
+    cache_blob_t cb(blob.data(), blob_size);
+    if (p.get_cache_blob(engine, cb) != status::success) return;
+
+    store(id, blob);
+}
+
+bool load(const std::vector<uint8_t> &id, std::vector<uint8_t> &blob) {
+    const std::string dir = get_dir();
+    if (dir.empty() || id.empty()) return false;
+
+    const std::string path = entry_path(dir, id);
+    FILE *f = impl::fopen(path.c_str(), "rb");
+    if (!f) return false;
+
+    uint64_t magic = 0;
+    size_t id_size = 0, blob_size = 0;
+    std::vector<uint8_t> stored_id;
+    bool id_matches = read_all(f, &magic, sizeof(magic))
+            && magic == file_magic && read_all(f, &id_size, sizeof(id_size))
+            && id_size == id.size();
+    if (id_matches) {
+        stored_id.resize(id_size);
+        id_matches = read_all(f, stored_id.data(), id_size) && stored_id == id;
+    }
+    bool ok = id_matches && read_all(f, &blob_size, sizeof(blob_size))
+            && blob_size > 0;
+    if (ok) {
+        blob.resize(blob_size);
+        ok = read_all(f, blob.data(), blob_size) && fgetc(f) == EOF;
+    }
+    fclose(f);
+
+    // A hash collision or an entry from another library version is not an
+    // error, a truncated entry is worth reporting.
+    if (id_matches && !ok)
+        VWARN(common, common, "ignoring corrupted primitive cache entry %s",
+                path.c_str());
+    if (!ok) blob.clear();
+    return ok;
+}
+
+void store(const std::vector<uint8_t> &id, const std::vector<uint8_t> &blob) {
+    const std::string dir = get_dir();
+    if (dir.empty() || id.empty() || blob.empty()) return;
+
+    // The temporary name has to be unique across threads and processes
+    // sharing the directory.
+    static std::atomic<uint64_t> counter {0};
+    const uint64_t salt
+            = std::hash<std::thread::id>()(std::this_thread::get_id())
+            ^ (uint64_t)std::chrono::steady_clock::now()
+                      .time_since_epoch()
+                      .count();
+    const std::string path = entry_path(dir, id);
+    const std::string tmp_path = path + ".tmp" + std::to_string(salt) + "_"
+            + std::to_string(counter++);
+
+    FILE *f = impl::fopen(tmp_path.c_str(), "wb");
+    if (!f) {
+        VWARN(common, common, "cannot create primitive cache entry in %s",
+                dir.c_str());
+        return;
+    }
+    const size_t id_size = id.size();
+    const size_t blob_size = blob.size();
+    bool ok = write_all(f, &file_magic, sizeof(file_magic))
+            && write_all(f, &id_size, sizeof(id_size))
+            && write_all(f, id.data(), id_size)
+            && write_all(f, &blob_size, sizeof(blob_size))
+            && write_all(f, blob.data(), blob_size);
+    ok = (fclose(f) == 0) && ok;
+
+    // Another process may have published the same entry in the meantime,
+    // which is fine as the contents are identical.
+    if (!ok || std::rename(tmp_path.c_str(), path.c_str()) != 0)
+        std::remove(tmp_path.c_str());
+    if (!ok)
+        VWARN(common, common, "cannot write primitive cache entry %s",
+                path.c_str());
+}
+
+} // namespace primitive_disk_cache
+} // namespace impl
+} // namespace dnnl
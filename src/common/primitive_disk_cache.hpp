@@ -0,0 +1,64 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_PRIMITIVE_DISK_CACHE_HPP
+#define COMMON_PRIMITIVE_DISK_CACHE_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+
+struct primitive_t;
+struct primitive_desc_t;
+
+// An opt-in second level for the primitive cache. It is enabled by setting
+// ONEDNN_PRIMITIVE_CACHE_DIR to an existing directory. Cache blobs are
+// stored in files named after a hash of the cache blob ID, so a directory
+// can be shared between processes and library instances: an entry is only
+// used when the complete ID stored in the file matches.
+namespace primitive_disk_cache {
+
+bool is_enabled();
+
+// Reads the cache blob for `pd` into `blob`. Returns false when the entry
+// doesn't exist or can't be used.
+bool load(engine_t *engine, const primitive_desc_t *pd,
+        std::vector<uint8_t> &blob);
+
+// Writes the cache blob of `p` if the implementation supports cache blobs.
+// An entry is written to a temporary file first and then renamed, so
+// concurrent readers never observe a partially written file.
+void store(engine_t *engine, const primitive_t &p);
+
+// Entries with an arbitrary ID, used by engines to store the binaries of the
+// kernels they compile. The ID has to identify the device and the driver.
+bool load(const std::vector<uint8_t> &id, std::vector<uint8_t> &blob);
+void store(const std::vector<uint8_t> &id, const std::vector<uint8_t> &blob);
+
+// Undocumented API for testing. An empty `dir` disables the cache.
+void DNNL_API set_dir(const std::string &dir);
+std::string DNNL_API get_dir();
+
+} // namespace primitive_disk_cache
+} // namespace impl
+} // namespace dnnl
+
+#endif
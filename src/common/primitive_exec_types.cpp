@@ -64,13 +64,19 @@ status_t cvt_primitive_args(const primitive_desc_t *pd, int nargs,
                                         | DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST))
                         || (arg == DNNL_ARG_ATTR_DROPOUT_PROBABILITY)
                         || (arg == DNNL_ARG_ATTR_DROPOUT_SEED)
-                        || (arg == DNNL_ARG_ATTR_ROUNDING_SEED);
+                        || (arg == DNNL_ARG_ATTR_ROUNDING_SEED)
+                        || (arg == DNNL_ARG_ATTR_SECONDARY_DST_SCALE);
                 break;
             case primitive_desc_t::arg_usage_t::output:
                 args[arg] = {mem, false};
                 n_outputs++;
                 extra_outputs += (arg == DNNL_ARG_SCRATCHPAD)
-                        || (arg == DNNL_ARG_ATTR_DROPOUT_MASK);
+                        || (arg == DNNL_ARG_ATTR_DROPOUT_MASK)
+                        || (arg == DNNL_ARG_ATTR_DST_AMAX)
+                        || (arg == DNNL_ARG_ATTR_SECONDARY_DST)
+                        // dynamically computed quantization parameters
+                        || (arg & DNNL_ARG_ATTR_SCALES)
+                        || (arg & DNNL_ARG_ATTR_ZERO_POINTS);
                 break;
             case primitive_desc_t::arg_usage_t::unused:
                 VINFO(primitive, exec, check, primitive,
@@ -99,6 +105,12 @@ memory_t *exec_ctx_t::input(int arg) const {
 }
 
 memory_t *exec_ctx_t::output(int arg) const {
+    memory_t *mem = clean_output(arg);
+    if (mem) mem->mark_padding_dirty();
+    return mem;
+}
+
+memory_t *exec_ctx_t::clean_output(int arg) const {
     if (args_.count(arg) != 1) return nullptr;
     const auto ma = args_.at(arg);
     assert(!ma.is_const);
@@ -106,7 +118,7 @@ memory_t *exec_ctx_t::output(int arg) const {
 }
 
 status_t exec_ctx_t::zero_pad_output(int arg) const {
-    memory_t *mem = this->output(arg);
+    memory_t *mem = this->clean_output(arg);
     if (mem == nullptr) return status::success;
 
     return mem->zero_pad(*this);
@@ -116,6 +128,7 @@ memory_t *exec_ctx_t::memory(int arg) const {
     assert(args_.count(arg) == 1);
     const auto ma = args_.at(arg);
     assert(!ma.is_const);
+    ma.mem->mark_padding_dirty();
     return ma.mem;
 }
 
@@ -131,8 +144,12 @@ void *exec_ctx_t::host_ptr(
 
     if (args_.count(arg) != 1) return nullptr;
 
-    auto *mem = args_.at(arg).mem;
-    if (do_zeropad) status = mem->zero_pad(*this);
+    const auto &ma = args_.at(arg);
+    auto *mem = ma.mem;
+    if (do_zeropad)
+        status = mem->zero_pad(*this);
+    else if (!ma.is_const)
+        mem->mark_padding_dirty();
     if (status_) *status_ = status;
 
     auto *mem_storage = mem->memory_storage(index);
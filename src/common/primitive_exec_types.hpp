@@ -51,8 +51,10 @@
 // may result in a failure returned via the `status` input since zero pad
 // may fail.
 #define CTX_OUT_CLEAN_STORAGE(arg, status) \
-    (ctx.output(arg) ? *(ctx.output(arg)->memory_storage_clean(ctx, status)) \
-                     : dnnl::impl::memory_storage_t::empty_storage())
+    (ctx.clean_output(arg) \
+                    ? *(ctx.clean_output(arg)->memory_storage_clean( \
+                            ctx, status)) \
+                    : dnnl::impl::memory_storage_t::empty_storage())
 
 namespace dnnl {
 namespace impl {
@@ -90,6 +92,9 @@ struct exec_ctx_t {
 
     memory_t *input(int arg) const;
     memory_t *output(int arg) const;
+    // Returns the destination memory without marking its padding as dirty.
+    // The caller must zero pad it before writing to it.
+    memory_t *clean_output(int arg) const;
     memory_t *memory(int arg) const;
 
     status_t zero_pad_output(int arg) const;
@@ -139,6 +144,15 @@ struct exec_ctx_t {
     const resource_mapper_t *get_resource_mapper() const;
     void set_resource_mapper(const resource_mapper_t *resource_mapper);
 
+    // Overrides the scratchpad owned by the primitive, e.g. when several
+    // executions of the same primitive run concurrently.
+    void set_scratchpad_storage(const memory_storage_t *scratchpad_storage) {
+        scratchpad_storage_ = scratchpad_storage;
+    }
+    const memory_storage_t *scratchpad_storage() const {
+        return scratchpad_storage_;
+    }
+
 private:
     stream_t *stream_;
     exec_args_t args_;
@@ -146,6 +160,7 @@ private:
     std::unordered_map<void *, void *> memory_mapping_;
     const resource_mapper_t *resource_mapper_ = nullptr;
     const memory_tracking::grantor_t *scratchpad_grantor_ = nullptr;
+    const memory_storage_t *scratchpad_storage_ = nullptr;
 };
 
 } // namespace impl
@@ -39,17 +39,89 @@ key_t::key_t(const engine_t *engine, const op_desc_t *op_desc,
     , skip_idx_(skip_idx)
     , hint_mds_(hint_mds)
     , engine_id_(engine->engine_id())
-    , thread_id_(std::this_thread::get_id()) {}
+    , thread_id_(std::this_thread::get_id())
+    , hash_(compute_hash()) {}
 
 key_t::key_t(const primitive_desc_t *pd, const engine_t *engine)
     : key_t(engine, pd->op_desc(), pd->attr(), pd->pd_iterator_offset(),
             pd->hint_mds(false /* is_hint */), pd->skip_idx()) {}
 
+size_t key_t::compute_hash() const {
+    size_t seed = 0;
+    // Compute hash for primitive_kind_, attr_, impl_id_ and impl_nthr_
+    seed = hash_combine(
+            seed, hash_combine(0, static_cast<size_t>(primitive_kind_)));
+    seed = hash_combine(seed, get_attr_hash(*attr_));
+    seed = hash_combine(seed, hash_combine(0, pd_iterator_offset_));
+    seed = hash_combine(seed, hash_combine(0, impl_nthr_));
+    seed = hash_combine(seed, hash_combine(0, skip_idx_));
+
+    seed = hash_combine(seed, engine_id_.hash());
+
+    seed = get_array_hash(seed, hint_mds_.data(), (int)hint_mds_.size());
+
+    const size_t verb_seed_before_desc = seed;
+    UNUSED(verb_seed_before_desc);
+
+    // Combine hash for op_desc with the computed hash
+#define CASE(pkind) \
+    case primitive_kind::pkind: \
+        seed = hash_combine(seed, \
+                get_desc_hash(*op_desc_t::to_desc<pkind##_desc_t>(op_desc_))); \
+        break;
+
+    // clang-format off
+    switch ((int)primitive_kind_) {
+        CASE(batch_normalization)
+        CASE(binary)
+        CASE(concat)
+        CASE(convolution)
+        CASE(deconvolution)
+        CASE(eltwise)
+        CASE(gather)
+        CASE(gemm)
+        CASE(group_normalization)
+        CASE(inner_product)
+        CASE(layer_normalization)
+        CASE(lrn)
+        CASE(matmul)
+        CASE(pooling)
+        CASE(prelu)
+        CASE(reduction)
+        CASE(reorder)
+        CASE(resampling)
+        CASE(rnn)
+        CASE(sdpa)
+        CASE(shuffle)
+        CASE(softmax)
+        CASE(split)
+        CASE(sum)
+        CASE(topk)
+        CASE(optimizer)
+        CASE(zero_pad)
+        default: assert(!"unknown primitive_kind");
+    }
+    // clang-format on
+#undef CASE
+
+    // Note: `16` is just a random number, as debuginfo hasn't received a
+    // single command center for levels across layers of the library.
+    // ANCHOR: HASHING_DEBUGINFO_16.
+    VDEBUGINFO(16, primitive, hashing,
+            "operator(),seed_before_desc=%zu seed_after_desc=%zu",
+            verb_seed_before_desc, seed);
+
+    return seed;
+}
+
 bool key_t::operator==(const key_t &rhs) const {
     DNNL_SHORT_CIRCUIT_SELF_COMPARISON(rhs);
     // clang-format off
     bool ret = true
-        // Less expensive comparisons come first
+        // Less expensive comparisons come first. Keys with different hashes
+        // are never equal, so the hash works as a fingerprint that rejects
+        // most mismatches before the deep comparison.
+        && hash_ == rhs.hash_
         && primitive_kind_ == rhs.primitive_kind_
         && engine_id_ == rhs.engine_id_
         && hint_mds_.size() == rhs.hint_mds_.size()
@@ -83,6 +155,7 @@ bool key_t::operator==(const key_t &rhs) const {
             break;
             CASE(deconvolution)
             CASE(eltwise)
+            CASE(gather)
             CASE(gemm)
             CASE(group_normalization)
             CASE(inner_product)
@@ -98,7 +171,10 @@ bool key_t::operator==(const key_t &rhs) const {
             CASE(sdpa)
             CASE(shuffle)
             CASE(softmax)
+            CASE(split)
             CASE(sum)
+            CASE(topk)
+            CASE(optimizer)
             CASE(zero_pad)
             default: assert(!"unknown primitive kind");
         }
@@ -181,6 +257,8 @@ size_t get_md_hash(const memory_desc_t &md) {
             seed = get_array_hash(seed,
                     md.format_desc.sparse_desc.metadata_types,
                     sparse_desc_t::max_metadata_types);
+            seed = get_array_hash(seed, md.format_desc.sparse_desc.block_dims,
+                    sparse_desc_t::max_block_ndims);
             // User cannot initialize `packed_desc` therefore `packed_desc`
             // is always zero initialized.
             break;
@@ -227,6 +305,20 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
     seed = hash_combine(seed, static_cast<size_t>(attr.fpmath_.apply_to_int_));
     // deterministic
     seed = hash_combine(seed, static_cast<size_t>(attr.deterministic_));
+    // max_threads
+    seed = hash_combine(seed, attr.max_threads_);
+    // constant_quant
+    seed = hash_combine(seed, static_cast<size_t>(attr.constant_quant_));
+    // src_dyn_quant
+    seed = hash_combine(seed, static_cast<size_t>(attr.src_dyn_quant_dt_));
+    // dst_amax
+    seed = hash_combine(seed, static_cast<size_t>(attr.dst_amax_));
+    // secondary_dst
+    seed = hash_combine(seed, static_cast<size_t>(attr.secondary_dst_dt_));
+    // dst_dyn_quant
+    seed = hash_combine(seed, static_cast<size_t>(attr.dst_dyn_quant_));
+    // activation_stash
+    seed = hash_combine(seed, static_cast<size_t>(attr.activation_stash_dt_));
     // acc_mode
     seed = hash_combine(seed, static_cast<size_t>(attr.acc_mode_));
     // rounding_mode
@@ -328,6 +420,22 @@ size_t get_desc_hash(const concat_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const split_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(*desc.src_md));
+    // N
+    seed = hash_combine(seed, desc.n);
+    // Split dimension
+    seed = hash_combine(seed, desc.split_dimension);
+    // Array of mds
+    seed = get_array_hash(seed, desc.dst_mds);
+    // Combined hash for split desc
+    return seed;
+}
+
 size_t get_desc_hash(const batch_normalization_desc_t &desc) {
     size_t seed = 0;
     // Kinds
@@ -423,6 +531,19 @@ size_t get_desc_hash(const eltwise_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const gather_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.indices_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    // Combined hash for gather desc
+    return seed;
+}
+
 size_t get_desc_hash(const gemm_desc_t &desc) {
     size_t seed = 0;
     // Kinds
@@ -535,6 +656,7 @@ size_t get_desc_hash(const matmul_desc_t &desc) {
     seed = hash_combine(seed, get_md_hash(desc.bias_desc));
     seed = hash_combine(seed, get_md_hash(desc.dst_desc));
     seed = hash_combine(seed, get_md_hash(desc.reduce_desc));
+    seed = hash_combine(seed, get_md_hash(desc.group_offsets_desc));
     // Reduce kind.
     seed = hash_combine(seed, static_cast<size_t>(desc.reduce_kind));
     // Accumulator type
@@ -699,6 +821,10 @@ size_t get_desc_hash(const softmax_desc_t &desc) {
     seed = hash_combine(seed, get_md_hash(desc.diff_dst_desc));
     // Axis
     seed = hash_combine(seed, desc.softmax_axis);
+    // Attention scores preprocessing
+    seed = hash_combine(seed, desc.with_scale);
+    seed = hash_combine(seed, static_cast<size_t>(desc.mask_type));
+    seed = hash_combine(seed, get_md_hash(desc.mask_desc));
     // Combined hash for softmax desc
     return seed;
 }
@@ -719,6 +845,38 @@ size_t get_desc_hash(const sum_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const topk_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    seed = hash_combine(seed, get_md_hash(desc.indices_desc));
+    // Axis
+    seed = hash_combine(seed, desc.axis);
+    // Combined hash for top-k desc
+    return seed;
+}
+
+size_t get_desc_hash(const optimizer_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.grad_desc));
+    seed = hash_combine(seed, get_md_hash(desc.param_desc));
+    seed = hash_combine(seed, get_md_hash(desc.master_desc));
+    // Hyperparameters
+    seed = hash_combine(seed, desc.momentum);
+    seed = hash_combine(seed, desc.beta2);
+    seed = hash_combine(seed, desc.epsilon);
+    seed = hash_combine(seed, desc.weight_decay);
+    // Combined hash for optimizer desc
+    return seed;
+}
+
 size_t get_desc_hash(const zero_pad_desc_t &desc) {
     size_t seed = 0;
     // Kinds
@@ -740,12 +898,21 @@ size_t get_desc_hash(const sdpa_desc_t &desc) {
     seed = hash_combine(seed, desc.vs_zero_points.get_hash());
     seed = hash_combine(seed, get_md_hash(desc.dst_desc));
     seed = hash_combine(seed, get_md_hash(desc.attn_mask_desc));
+    seed = hash_combine(seed, static_cast<size_t>(desc.prop_kind));
+    seed = hash_combine(seed, get_md_hash(desc.stats_desc));
+    seed = hash_combine(seed, get_md_hash(desc.diff_q_desc));
+    seed = hash_combine(seed, get_md_hash(desc.diff_k_desc));
+    seed = hash_combine(seed, get_md_hash(desc.diff_v_desc));
+    seed = hash_combine(seed, get_md_hash(desc.diff_dst_desc));
     // Scale type
     seed = hash_combine(seed, static_cast<size_t>(desc.scale_dt));
     seed = hash_combine(seed, desc.invert_scale);
     seed = hash_combine(seed, desc.kv_head_number);
     seed = hash_combine(seed, static_cast<size_t>(desc.mask_type));
     seed = hash_combine(seed, static_cast<size_t>(desc.softmax_alg));
+    seed = hash_combine(seed, desc.window_size);
+    seed = hash_combine(seed, desc.alibi_max_bias);
+    seed = hash_combine(seed, desc.softcap);
     // Combined hash for sdpa desc
     return seed;
 }
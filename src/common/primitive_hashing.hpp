@@ -40,6 +40,10 @@ struct key_t {
     key_t(const primitive_desc_t *pd, const engine_t *engine);
 
     bool operator==(const key_t &other) const;
+    // The hash is computed once at construction. Cache lookups hash the key
+    // more than once (shard selection and bucket lookup) and the stored keys
+    // are rehashed when the map grows.
+    size_t hash() const { return hash_; }
     const std::thread::id &thread_id() const { return thread_id_; }
     bool has_runtime_dependencies() const {
         return !(engine_id_.kind() == engine_kind::cpu
@@ -60,19 +64,24 @@ struct key_t {
 private:
     static primitive_kind_t get_pkind(primitive_kind_t pkind);
 
+    size_t compute_hash() const;
+
     // Thread ID is not used as part of the key, it's only used to get
     // information about what thread inserted the key and the corresponding
     // primitive to handle some multithreaded scenarios.
     std::thread::id thread_id_;
+    size_t hash_;
 };
 
 size_t get_md_hash(const memory_desc_t &md);
 size_t get_attr_hash(const primitive_attr_t &attr);
 size_t get_desc_hash(const concat_desc_t &desc);
+size_t get_desc_hash(const split_desc_t &desc);
 size_t get_desc_hash(const batch_normalization_desc_t &desc);
 size_t get_desc_hash(const binary_desc_t &desc);
 size_t get_desc_hash(const convolution_desc_t &desc);
 size_t get_desc_hash(const eltwise_desc_t &desc);
+size_t get_desc_hash(const gather_desc_t &desc);
 size_t get_desc_hash(const gemm_desc_t &desc);
 size_t get_desc_hash(const group_normalization_desc_t &desc);
 size_t get_desc_hash(const inner_product_desc_t &desc);
@@ -89,6 +98,8 @@ size_t get_desc_hash(const sdpa_desc_t &desc);
 size_t get_desc_hash(const shuffle_desc_t &desc);
 size_t get_desc_hash(const softmax_desc_t &desc);
 size_t get_desc_hash(const sum_desc_t &desc);
+size_t get_desc_hash(const topk_desc_t &desc);
+size_t get_desc_hash(const optimizer_desc_t &desc);
 size_t get_desc_hash(const zero_pad_desc_t &desc);
 
 template <typename T>
@@ -135,71 +146,7 @@ struct hash<dnnl::impl::primitive_hashing::key_t> {
     using argument_type = dnnl::impl::primitive_hashing::key_t;
     using result_type = std::size_t;
     result_type operator()(const argument_type &key) const {
-        using namespace dnnl::impl;
-        using namespace dnnl::impl::primitive_hashing;
-        size_t seed = 0;
-        // Compute hash for primitive_kind_, attr_, impl_id_ and impl_nthr_
-        seed = hash_combine(seed,
-                hash_combine(0, static_cast<size_t>(key.primitive_kind_)));
-        seed = hash_combine(seed, get_attr_hash(*key.attr_));
-        seed = hash_combine(seed, hash_combine(0, key.pd_iterator_offset_));
-        seed = hash_combine(seed, hash_combine(0, key.impl_nthr_));
-        seed = hash_combine(seed, hash_combine(0, key.skip_idx_));
-
-        seed = hash_combine(seed, key.engine_id_.hash());
-
-        seed = get_array_hash(
-                seed, key.hint_mds_.data(), (int)key.hint_mds_.size());
-
-        const result_type verb_seed_before_desc = seed;
-        UNUSED(verb_seed_before_desc);
-
-        // Combine hash for op_desc with the computed hash
-#define CASE(pkind) \
-    case primitive_kind::pkind: \
-        seed = hash_combine(seed, \
-                get_desc_hash( \
-                        *op_desc_t::to_desc<pkind##_desc_t>(key.op_desc_))); \
-        break;
-
-        // clang-format off
-        switch ((int)key.primitive_kind_) {
-            CASE(batch_normalization)
-            CASE(binary)
-            CASE(concat)
-            CASE(convolution)
-            CASE(deconvolution)
-            CASE(eltwise)
-            CASE(gemm)
-            CASE(group_normalization)
-            CASE(inner_product)
-            CASE(layer_normalization)
-            CASE(lrn)
-            CASE(matmul)
-            CASE(pooling)
-            CASE(prelu)
-            CASE(reduction)
-            CASE(reorder)
-            CASE(resampling)
-            CASE(rnn)
-            CASE(sdpa)
-            CASE(shuffle)
-            CASE(softmax)
-            CASE(sum)
-            CASE(zero_pad)
-            default: assert(!"unknown primitive_kind");
-        }
-            // clang-format on
-#undef CASE
-
-        // Note: `16` is just a random number, as debuginfo hasn't received a
-        // single command center for levels across layers of the library.
-        // ANCHOR: HASHING_DEBUGINFO_16.
-        VDEBUGINFO(16, primitive, hashing,
-                "operator(),seed_before_desc=%zu seed_after_desc=%zu",
-                verb_seed_before_desc, seed);
-
-        return seed;
+        return key.hash();
     }
 };
 
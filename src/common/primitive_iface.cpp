@@ -14,16 +14,25 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
 #include "engine.hpp"
 
 #if defined(DNNL_ENABLE_ITT_TASKS)
 #include "ittnotify.hpp"
 #endif
 
+#include "background_pool.hpp"
 #include "cache_hit_types.hpp"
+#include "exec_trace.hpp"
 #include "primitive.hpp"
 #include "primitive_desc_iface.hpp"
 #include "primitive_exec_types.hpp"
@@ -87,10 +96,49 @@ status_t primitive_create(primitive_iface_t **primitive_iface,
     return safe_ptr_assign((*primitive_iface), p_iface.first);
 }
 
+namespace {
+// Weights, bias, and the quantization parameters of weights are read-only
+// arguments that are usually not produced by the preceding primitives.
+bool is_prefetchable_arg(int arg) {
+    const int base = arg & ~(DNNL_ARG_ATTR_SCALES | DNNL_ARG_ATTR_ZERO_POINTS);
+    if (base != arg) return base == DNNL_ARG_WEIGHTS;
+    return utils::one_of(arg, DNNL_ARG_WEIGHTS_0, DNNL_ARG_WEIGHTS_1,
+            DNNL_ARG_WEIGHTS_2, DNNL_ARG_WEIGHTS_3, DNNL_ARG_BIAS);
+}
+
+// Reads a cache line at a time, which is enough for the hardware to bring the
+// whole buffer into the cache hierarchy.
+void touch_buffer(const char *ptr, size_t size) {
+    const size_t line_size = 64;
+    char sum = 0;
+    for (size_t off = 0; off < size; off += line_size)
+        sum += ptr[off];
+    volatile char sink = sum;
+    MAYBE_UNUSED(sink);
+}
+
+uint64_t get_nsec() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+}
+} // namespace
+
 status_t primitive_execute(
         const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
     auto stream = ctx.stream();
     status_t status = success;
+    const bool exec_profile = get_verbose(verbose_t::exec_profile,
+            prim_kind2_comp_kind(primitive_iface->pd()->impl()->kind()));
+    // Execution statistics are collected only when profiling is requested.
+    const bool collect_stats = exec_profile || stream->is_profiling_enabled();
+    const uint64_t exec_start_ns = collect_stats ? get_nsec() : 0;
+    max_threads_limit_guard_t max_threads_guard(
+            primitive_iface->pd()->impl()->attr()->max_threads_);
+
+    for (const auto &a : ctx.args())
+        if (!a.second.is_const && a.second.mem)
+            a.second.mem->begin_output_write();
 
 #if defined(DNNL_ENABLE_ITT_TASKS)
     const bool enable_itt = itt::get_itt(itt::__itt_task_level_low);
@@ -98,13 +146,19 @@ status_t primitive_execute(
         itt::primitive_task_start(primitive_iface->pd()->impl()->kind());
 #endif
 
-    if (get_verbose(verbose_t::exec_profile,
-                prim_kind2_comp_kind(primitive_iface->pd()->impl()->kind()))) {
+    if (exec_profile && primitive_iface->is_exec_profile_sampled()) {
         stream->wait();
         double start_ms = get_msec();
         status = stream->enqueue_primitive(primitive_iface, ctx);
         stream->wait();
         double duration_ms = get_msec() - start_ms;
+        // Device time excludes the submission and queueing delays, which
+        // dominate the host time of small primitives on GPU streams.
+        uint64_t kernel_nsec = 0;
+        if (get_verbose(verbose_t::exec_profile_device)
+                && stream->is_profiling_enabled()
+                && stream->get_last_exec_kernel_time(&kernel_nsec) == success)
+            duration_ms = kernel_nsec / 1e6;
         if (primitive_iface->pd()->impl()->has_runtime_dims_or_strides()) {
             // Take out mds from `ctx` here to avoid primitive_desc dependency
             // on `exec_ctx_t` type.
@@ -130,6 +184,15 @@ status_t primitive_execute(
             VPROF(start_ms, primitive, exec, VERBOSE_profile,
                     primitive_iface->pd()->info(), duration_ms);
         }
+    } else if (exec_trace::is_enabled()) {
+        const uint64_t trace_id = primitive_iface->trace_id();
+        const uint64_t parent_id = exec_trace::get_current_primitive();
+        exec_trace::set_current_primitive(trace_id);
+        const uint64_t start_ns = exec_trace::now_ns();
+        status = stream->enqueue_primitive(primitive_iface, ctx);
+        exec_trace::record(
+                trace_id, start_ns, exec_trace::now_ns(), ctx.args(), status);
+        exec_trace::set_current_primitive(parent_id);
     } else {
         status = stream->enqueue_primitive(primitive_iface, ctx);
     }
@@ -138,6 +201,9 @@ status_t primitive_execute(
     if (enable_itt) itt::primitive_task_end();
 #endif
 
+    if (collect_stats && status == success)
+        primitive_iface->update_exec_stats(ctx, get_nsec() - exec_start_ns);
+
     if (msan_enabled) unpoison_outputs(ctx.args());
 
     return status;
@@ -176,9 +242,7 @@ status_t dnnl_primitive_create_from_cache_blob(
     }
     const auto ekind = primitive_desc_iface->engine()->kind();
     const auto runtime_kind = primitive_desc_iface->engine()->runtime_kind();
-    if (ekind != engine_kind::gpu
-            || (ekind == engine_kind::gpu
-                    && runtime_kind != runtime_kind::ocl)) {
+    if (ekind == engine_kind::gpu && runtime_kind != runtime_kind::ocl) {
         return status::unimplemented;
     }
 
@@ -187,6 +251,67 @@ status_t dnnl_primitive_create_from_cache_blob(
             primitive_iface, primitive_desc_iface, cb);
 }
 
+status_t dnnl_primitive_create_async(
+        const primitive_desc_iface_t *primitive_desc_iface,
+        dnnl_primitive_create_callback_t callback, void *user_data) {
+    if (utils::any_null(primitive_desc_iface, callback))
+        return invalid_arguments;
+
+    // The user may destroy the primitive descriptor right after submission.
+    primitive_desc_iface_t *pd_iface = nullptr;
+    CHECK(dnnl_primitive_desc_clone(&pd_iface, primitive_desc_iface));
+
+    status_t status = background_pool_t::get().submit(
+            [pd_iface, callback, user_data]() {
+                primitive_iface_t *p_iface = nullptr;
+                status_t status = dnnl::impl::primitive_create(
+                        &p_iface, pd_iface);
+                dnnl_primitive_desc_destroy(pd_iface);
+                callback(status == success ? p_iface : nullptr, status,
+                        user_data);
+            },
+            // The library is unloaded before the creation started.
+            [pd_iface, callback, user_data]() {
+                dnnl_primitive_desc_destroy(pd_iface);
+                callback(nullptr, runtime_error, user_data);
+            });
+    if (status != success) dnnl_primitive_desc_destroy(pd_iface);
+    return status;
+}
+
+status_t dnnl_primitive_cache_warm_up(
+        int npds, const primitive_desc_iface_t *const *primitive_desc_ifaces) {
+    if (npds < 0 || (npds > 0 && primitive_desc_ifaces == nullptr))
+        return invalid_arguments;
+    for (int i = 0; i < npds; i++)
+        if (primitive_desc_ifaces[i] == nullptr) return invalid_arguments;
+
+    // Creation is mostly serial, so each thread of the threading runtime
+    // creates whole primitives. There is no active threadpool at this point
+    // with the threadpool runtime, and the primitives are created on the
+    // calling thread.
+    std::atomic<int> next {0};
+    std::atomic<status_t> first_error {success};
+    auto worker = [&]() {
+        for (int i = next++; i < npds; i = next++) {
+            primitive_iface_t *p_iface = nullptr;
+            status_t status = dnnl::impl::primitive_create(
+                    &p_iface, primitive_desc_ifaces[i]);
+            // The primitive stays in the primitive cache.
+            if (status == success)
+                p_iface->release();
+            else {
+                status_t expected = success;
+                first_error.compare_exchange_strong(expected, status);
+            }
+        }
+    };
+
+    const int nthr = std::min(npds, dnnl_get_max_threads());
+    if (nthr > 0) parallel(nthr, [&](int, int) { worker(); });
+    return first_error.load();
+}
+
 status_t dnnl_primitive_execute(const primitive_iface_t *primitive_iface,
         stream_t *stream, int nargs, const dnnl_exec_arg_t *c_args) {
     bool ok = true && !utils::any_null(primitive_iface, stream)
@@ -199,6 +324,11 @@ status_t dnnl_primitive_execute(const primitive_iface_t *primitive_iface,
             primitive_iface->pd()->impl().get(), nargs, c_args, args);
     if (status != status::success) return status;
 
+    if (stream->capture()) {
+        status = stream->capture()->record(primitive_iface, args);
+        if (status != status::success) return status;
+    }
+
     stream->before_exec_hook();
 
     exec_ctx_t ctx(stream, std::move(args));
@@ -219,6 +349,110 @@ status_t dnnl_primitive_execute(const primitive_iface_t *primitive_iface,
     return status;
 }
 
+status_t dnnl_primitive_execute_batch(const primitive_iface_t *primitive_iface,
+        stream_t *stream, int nbatch, const int *nargs,
+        const dnnl_exec_arg_t *const *c_args) {
+    bool ok = true && !utils::any_null(primitive_iface, stream)
+            && primitive_iface->engine() == stream->engine() && nbatch >= 0
+            && IMPLICATION(nbatch > 0, !utils::any_null(nargs, c_args));
+    if (!ok) return invalid_arguments;
+
+    const auto *pd = primitive_iface->pd()->impl().get();
+    std::vector<exec_args_t> batch_args(nbatch);
+    for (int i = 0; i < nbatch; i++) {
+        if (nargs[i] < 0 || (nargs[i] > 0 && c_args[i] == nullptr))
+            return invalid_arguments;
+        CHECK(cvt_primitive_args(pd, nargs[i], c_args[i], batch_args[i]));
+    }
+
+    // The executions are scheduled together only on native CPU runtimes and
+    // when they are not profiled or recorded individually. Otherwise, they
+    // are submitted one by one.
+    const engine_t *engine = stream->engine();
+    const bool is_profiled = get_verbose(
+            verbose_t::exec_profile, prim_kind2_comp_kind(pd->kind()));
+    const bool run_concurrently = nbatch > 1
+            && engine->kind() == engine_kind::cpu
+            && is_native_runtime(engine->runtime_kind()) && !stream->capture()
+            && !is_profiled;
+    if (!run_concurrently) {
+        for (int i = 0; i < nbatch; i++) {
+            if (stream->capture())
+                CHECK(stream->capture()->record(
+                        primitive_iface, batch_args[i]));
+            stream->before_exec_hook();
+            exec_ctx_t ctx(stream, std::move(batch_args[i]));
+            const status_t status
+                    = dnnl::impl::primitive_execute(primitive_iface, ctx);
+            stream->after_exec_hook();
+            CHECK(status);
+        }
+        return success;
+    }
+
+    stream->before_exec_hook();
+    max_threads_limit_guard_t max_threads_guard(pd->attr()->max_threads_);
+    const int nthr = std::min(nbatch, dnnl_get_current_num_threads());
+
+    // The scratchpad of the primitive can't be shared between concurrent
+    // executions, so every thread gets its own one.
+    const bool is_user_scratchpad
+            = pd->attr()->scratchpad_mode_ == scratchpad_mode::user;
+    const size_t scratchpad_size
+            = pd->scratchpad_size(pd->attr()->scratchpad_mode_);
+    std::vector<std::unique_ptr<scratchpad_t>> scratchpads(nthr);
+    for (int ithr = 0; ithr < nthr && scratchpad_size > 0; ithr++) {
+        scratchpads[ithr].reset(create_scratchpad(
+                stream->engine(), scratchpad_size, false));
+        if (!scratchpads[ithr]
+                || !scratchpads[ithr]->get_memory_storage()) {
+            stream->after_exec_hook();
+            return out_of_memory;
+        }
+    }
+
+    std::atomic<status_t> first_error {success};
+    parallel(nthr, [&](int ithr, int nthr_) {
+        int start = 0, end = 0;
+        balance211(nbatch, nthr_, ithr, start, end);
+        for (int i = start; i < end; i++) {
+            exec_ctx_t ctx(stream, std::move(batch_args[i]));
+            if (scratchpads[ithr]
+                    && !(is_user_scratchpad
+                            && ctx.output(DNNL_ARG_SCRATCHPAD)))
+                ctx.set_scratchpad_storage(
+                        scratchpads[ithr]->get_memory_storage());
+            const status_t status = primitive_iface->execute(ctx);
+            if (status != success) {
+                status_t expected = success;
+                first_error.compare_exchange_strong(expected, status);
+            }
+        }
+    });
+    stream->after_exec_hook();
+
+    return first_error.load();
+}
+
+status_t dnnl_primitive_prefetch(const primitive_iface_t *primitive_iface,
+        stream_t *stream, int nargs, const dnnl_exec_arg_t *c_args) {
+    bool ok = true && !utils::any_null(primitive_iface, stream)
+            && primitive_iface->engine() == stream->engine()
+            && IMPLICATION(nargs > 0, c_args != nullptr);
+    if (!ok) return invalid_arguments;
+
+    exec_args_t args;
+    CHECK(cvt_primitive_args(
+            primitive_iface->pd()->impl().get(), nargs, c_args, args));
+
+    const engine_t *engine = stream->engine();
+    if (engine->kind() != engine_kind::cpu
+            || !is_native_runtime(engine->runtime_kind()))
+        return success;
+
+    return primitive_iface->prefetch(args);
+}
+
 status_t dnnl_primitive_get_primitive_desc(
         const primitive_iface_t *primitive_iface,
         const primitive_desc_iface_t **primitive_desc_iface) {
@@ -235,9 +469,7 @@ status_t dnnl_primitive_get_cache_blob(const primitive_iface_t *primitive_iface,
 
     const auto ekind = primitive_iface->engine()->kind();
     const auto runtime_kind = primitive_iface->engine()->runtime_kind();
-    if (ekind != engine_kind::gpu
-            || (ekind == engine_kind::gpu
-                    && runtime_kind != runtime_kind::ocl)) {
+    if (ekind == engine_kind::gpu && runtime_kind != runtime_kind::ocl) {
         return status::unimplemented;
     }
 
@@ -252,6 +484,19 @@ status_t dnnl_primitive_get_cache_blob(const primitive_iface_t *primitive_iface,
     return primitive_iface->get_cache_blob(cb);
 }
 
+status_t dnnl_primitive_get_exec_stats(const primitive_iface_t *primitive_iface,
+        dnnl_primitive_exec_stats_t *stats) {
+    if (utils::any_null(primitive_iface, stats)) return invalid_arguments;
+    *stats = primitive_iface->get_exec_stats();
+    return success;
+}
+
+status_t dnnl_primitive_reset_exec_stats(primitive_iface_t *primitive_iface) {
+    if (utils::any_null(primitive_iface)) return invalid_arguments;
+    primitive_iface->reset_exec_stats();
+    return success;
+}
+
 status_t dnnl_primitive_destroy(primitive_iface_t *primitive_iface) {
     if (primitive_iface != nullptr) primitive_iface->release();
     return success;
@@ -263,7 +508,8 @@ dnnl_primitive::dnnl_primitive(
     : counter_(1)
     , primitive_(primitive)
     , pd_(utils::make_unique<primitive_desc_iface_t>(
-              primitive_->pd(), engine)) {}
+              primitive_->pd(), engine))
+    , prefetch_state_(std::make_shared<prefetch_state_t>()) {}
 
 // reorder specialization
 dnnl_primitive::dnnl_primitive(const std::shared_ptr<primitive_t> &primitive,
@@ -271,9 +517,11 @@ dnnl_primitive::dnnl_primitive(const std::shared_ptr<primitive_t> &primitive,
     : counter_(1)
     , primitive_(primitive)
     , pd_(utils::make_unique<reorder_primitive_desc_iface_t>(
-              primitive_->pd(), engine, src_engine, dst_engine)) {}
+              primitive_->pd(), engine, src_engine, dst_engine))
+    , prefetch_state_(std::make_shared<prefetch_state_t>()) {}
 
 dnnl_primitive::~dnnl_primitive() {
+    cancel_prefetch();
     if (scratchpad_debug::is_protect_scratchpad() && scratchpad_ != nullptr
             && scratchpad_->get_memory_storage() != nullptr) {
         const memory_tracking::registry_t &registry
@@ -287,7 +535,15 @@ status_t dnnl_primitive::init() {
     const size_t scratchpad_size
             = primitive_->pd()->scratchpad_size(scratchpad_mode::library);
 
-    if (scratchpad_size) {
+    // GPU primitives take the scratchpad from the memory pool of the stream
+    // at execution, so that buffers are shared between primitives and no
+    // allocation happens in steady state.
+    const bool use_stream_memory_pool = scratchpad_size
+            && pd_->engine()->kind() == engine_kind::gpu
+            && stream_memory_pool_limit() > 0;
+    if (use_stream_memory_pool) {
+        pooled_scratchpad_size_ = scratchpad_size;
+    } else if (scratchpad_size) {
         const memory_tracking::registry_t &registry
                 = primitive_->pd()->scratchpad_registry();
         bool use_global_scratchpad = scratchpad_debug::is_protect_scratchpad()
@@ -319,14 +575,90 @@ const primitive_desc_iface_t *dnnl_primitive::pd() const {
     return pd_.get();
 }
 
+size_t dnnl_primitive::footprint() const {
+    size_t bytes = primitive_->footprint();
+    // The global scratchpad is shared between primitives
+    if (scratchpad_ && !primitive_->use_global_scratchpad())
+        bytes += scratchpad_->size();
+    return bytes;
+}
+
+status_t dnnl_primitive::prefetch(const exec_args_t &args) const {
+    // The tasks are bound to the generation of the next execution, which
+    // skips the ones that haven't started by then.
+    const auto state = prefetch_state_;
+    const uint64_t generation = state->generation.load();
+
+    // Buffers are split into chunks so that several background threads can
+    // read a large buffer concurrently.
+    const size_t chunk_size = 1024 * 1024;
+    for (const auto &a : args) {
+        if (!is_prefetchable_arg(a.first)) continue;
+        const memory_t *mem = a.second.mem;
+        void *handle = nullptr;
+        CHECK(mem->memory_storage()->get_data_handle(&handle));
+        const size_t size = memory_desc_wrapper(mem->md()).size(
+                0, /* include_additional_size = */ true,
+                /* include_offset0 = */ true);
+        if (handle == nullptr || size == 0) continue;
+
+        const char *ptr = static_cast<const char *>(handle);
+        for (size_t off = 0; off < size; off += chunk_size) {
+            const size_t len = std::min(chunk_size, size - off);
+            CHECK(background_pool_t::get().submit([=]() {
+                // The task is accounted as running before the generation
+                // is checked, so that cancel_prefetch() either waits for it
+                // or the task sees the new generation.
+                state->n_running++;
+                if (state->generation.load() == generation)
+                    touch_buffer(ptr + off, len);
+                state->n_running--;
+            }));
+        }
+    }
+    return success;
+}
+
+void dnnl_primitive::cancel_prefetch() const {
+    prefetch_state_->generation++;
+    while (prefetch_state_->n_running.load() > 0)
+        std::this_thread::yield();
+}
+
+bool dnnl_primitive::use_global_scratchpad() const {
+    return scratchpad_ && primitive_->use_global_scratchpad();
+}
+
 status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
+    // The buffers can be released by the user after the execution.
+    cancel_prefetch();
+
     const memory_storage_t *mem_storage = nullptr;
-    if (primitive_->pd()->attr()->scratchpad_mode_ == scratchpad_mode::user) {
+    memory_storage_t *pooled_storage = nullptr;
+    if (ctx.scratchpad_storage()) {
+        mem_storage = ctx.scratchpad_storage();
+    } else if (primitive_->pd()->attr()->scratchpad_mode_
+            == scratchpad_mode::user) {
         memory_t *scratchpad_memory = ctx.output(DNNL_ARG_SCRATCHPAD);
-        mem_storage = scratchpad_memory ? scratchpad_memory->memory_storage()
-                                        : nullptr;
+        const size_t scratchpad_size
+                = primitive_->pd()->scratchpad_size(scratchpad_mode::user);
+        if (scratchpad_memory) {
+            mem_storage = scratchpad_memory->memory_storage();
+        } else if (scratchpad_size > 0 && ctx.stream()) {
+            // Serve the scratchpad from the stream-local arena.
+            stream_t *stream = ctx.stream();
+            if (!(stream->flags() & stream_flags::in_order))
+                return status::invalid_arguments;
+            mem_storage = stream->get_scratchpad_arena(scratchpad_size);
+            if (mem_storage == nullptr) return status::out_of_memory;
+        }
     } else if (scratchpad_) {
         mem_storage = scratchpad_->get_memory_storage();
+    } else if (pooled_scratchpad_size_ > 0 && ctx.stream()) {
+        pooled_storage
+                = ctx.stream()->memory_pool()->acquire(pooled_scratchpad_size_);
+        if (pooled_storage == nullptr) return status::out_of_memory;
+        mem_storage = pooled_storage;
     }
 
     auto scratchpad_grantor
@@ -336,9 +668,75 @@ status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
 
     auto status = primitive_->execute(ctx);
     ctx.set_scratchpad_grantor(nullptr);
+    // The buffer can be reused by the work submitted next to the stream.
+    if (pooled_storage) ctx.stream()->memory_pool()->release(pooled_storage);
     return status;
 }
 
+bool dnnl_primitive::is_exec_profile_sampled() const {
+    const auto &sampling = get_verbose_sampling();
+    if (!sampling.is_enabled()) return true;
+
+    const uint64_t n = n_sampled_execs_++;
+    if (sampling.period > 1 && n % sampling.period != 0) return false;
+    if (sampling.interval_ms > 0) {
+        const double now_ms = get_msec();
+        double last_ms = last_sampled_exec_ms_.load();
+        if (n != 0 && now_ms - last_ms < sampling.interval_ms) return false;
+        // Only one of concurrent executions is profiled.
+        if (!last_sampled_exec_ms_.compare_exchange_strong(last_ms, now_ms))
+            return false;
+    }
+    return true;
+}
+
+void dnnl_primitive::update_exec_stats(
+        const exec_ctx_t &ctx, uint64_t duration_ns) const {
+    uint64_t bytes = exec_arg_bytes_.load(std::memory_order_relaxed);
+    if (bytes == 0) {
+        for (const auto &arg : ctx.args()) {
+            if (arg.first == DNNL_ARG_SCRATCHPAD || !arg.second.mem) continue;
+            bytes += memory_desc_wrapper(arg.second.mem->md()).size();
+        }
+        if (!primitive_->pd()->has_runtime_dims_or_strides())
+            exec_arg_bytes_.store(bytes, std::memory_order_relaxed);
+    }
+
+    exec_count_.fetch_add(1, std::memory_order_relaxed);
+    exec_total_ns_.fetch_add(duration_ns, std::memory_order_relaxed);
+    exec_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+    uint64_t max_ns = exec_max_ns_.load(std::memory_order_relaxed);
+    while (duration_ns > max_ns
+            && !exec_max_ns_.compare_exchange_weak(max_ns, duration_ns))
+        ;
+}
+
+dnnl_primitive_exec_stats_t dnnl_primitive::get_exec_stats() const {
+    dnnl_primitive_exec_stats_t stats;
+    stats.count = exec_count_.load();
+    stats.total_ns = exec_total_ns_.load();
+    stats.max_ns = exec_max_ns_.load();
+    stats.bytes = exec_bytes_.load();
+    return stats;
+}
+
+void dnnl_primitive::reset_exec_stats() {
+    exec_count_ = 0;
+    exec_total_ns_ = 0;
+    exec_max_ns_ = 0;
+    exec_bytes_ = 0;
+}
+
+uint64_t dnnl_primitive::trace_id() const {
+    uint64_t id = trace_id_.load(std::memory_order_relaxed);
+    if (id != 0) return id;
+    // A concurrent first execution may register the primitive twice. Only
+    // one of the ids is used, the other one stays unreferenced in the trace.
+    const uint64_t new_id = exec_trace::register_primitive(pd()->info());
+    if (trace_id_.compare_exchange_strong(id, new_id)) return new_id;
+    return id;
+}
+
 status_t dnnl_primitive::get_cache_blob_size(size_t *size) const {
     return primitive_->get_cache_blob_size(engine(), size);
 }
@@ -18,6 +18,8 @@
 #define COMMON_PRIMITIVE_IFACE_HPP
 
 #include <assert.h>
+#include <atomic>
+#include <memory>
 
 #include "oneapi/dnnl/dnnl.h"
 
@@ -65,6 +67,24 @@ struct dnnl_primitive : public dnnl::impl::c_compatible {
     dnnl::impl::status_t get_cache_blob(
             dnnl::impl::cache_blob_t cache_blob) const;
     dnnl::impl::status_t execute(dnnl::impl::exec_ctx_t &ctx) const;
+    // Returns the memory held by the primitive: the footprint of the
+    // implementation and the scratchpad owned by the primitive, if any.
+    size_t footprint() const;
+    // Returns whether the scratchpad of the primitive is the global one,
+    // which is local to the thread that created the primitive.
+    bool use_global_scratchpad() const;
+    // Reads the buffers of the prefetchable arguments in the background.
+    dnnl::impl::status_t prefetch(const dnnl::impl::exec_args_t &args) const;
+    // Returns the id of the primitive in the execution trace.
+    uint64_t trace_id() const;
+    // Returns whether the current execution is profiled when verbose exec
+    // sampling is enabled.
+    bool is_exec_profile_sampled() const;
+
+    void update_exec_stats(const dnnl::impl::exec_ctx_t &ctx,
+            uint64_t duration_ns) const;
+    dnnl_primitive_exec_stats_t get_exec_stats() const;
+    void reset_exec_stats();
 
     void retain() { counter_++; }
 
@@ -76,11 +96,39 @@ protected:
     ~dnnl_primitive();
 
 private:
+    // State shared with the background prefetch tasks of the primitive.
+    struct prefetch_state_t {
+        // Incremented by every execution, tasks submitted for an older
+        // generation are skipped.
+        std::atomic<uint64_t> generation {0};
+        std::atomic<int> n_running {0};
+    };
+
+    // Skips the prefetch tasks that haven't started yet and waits for the
+    // running ones, so that the user may release the buffers after the
+    // execution.
+    void cancel_prefetch() const;
+
     std::atomic<int> counter_;
     std::shared_ptr<dnnl::impl::primitive_t> primitive_;
     std::unique_ptr<dnnl::impl::scratchpad_t> scratchpad_;
+    // Size of the scratchpad taken from the memory pool of the execution
+    // stream, if the primitive doesn't own one.
+    size_t pooled_scratchpad_size_ = 0;
     std::unique_ptr<primitive_desc_iface_t> pd_;
     dnnl::impl::resource_mapper_t resource_mapper_;
+    std::shared_ptr<prefetch_state_t> prefetch_state_;
+    mutable std::atomic<uint64_t> trace_id_ {0};
+    mutable std::atomic<uint64_t> n_sampled_execs_ {0};
+    mutable std::atomic<double> last_sampled_exec_ms_ {0};
+
+    mutable std::atomic<uint64_t> exec_count_ {0};
+    mutable std::atomic<uint64_t> exec_total_ns_ {0};
+    mutable std::atomic<uint64_t> exec_max_ns_ {0};
+    mutable std::atomic<uint64_t> exec_bytes_ {0};
+    // Size of the memory arguments, computed on the first execution unless
+    // the primitive has runtime dimensions.
+    mutable std::atomic<uint64_t> exec_arg_bytes_ {0};
 
     dnnl_primitive() = delete;
     DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_primitive);
@@ -35,6 +35,7 @@ status_t serialize_desc(
         CASE(convolution)
         CASE(deconvolution)
         CASE(eltwise)
+        CASE(gather)
         CASE(gemm)
         CASE(group_normalization)
         CASE(inner_product)
@@ -50,7 +51,10 @@ status_t serialize_desc(
         CASE(sdpa)
         CASE(shuffle)
         CASE(softmax)
+        CASE(split)
         CASE(sum)
+        CASE(topk)
+        CASE(optimizer)
         default: return status::invalid_arguments;
     }
 #undef CASE
@@ -183,6 +187,20 @@ void serialize(serialization_stream_t &sstream, const primitive_attr_t &attr) {
     sstream.append(attr.fpmath_.apply_to_int_);
     // deterministic
     sstream.append(attr.deterministic_);
+    // max_threads
+    sstream.append(attr.max_threads_);
+    // constant_quant
+    sstream.append(attr.constant_quant_);
+    // src_dyn_quant
+    sstream.append(attr.src_dyn_quant_dt_);
+    // dst_amax
+    sstream.append(attr.dst_amax_);
+    // secondary_dst
+    sstream.append(attr.secondary_dst_dt_);
+    // dst_dyn_quant
+    sstream.append(attr.dst_dyn_quant_);
+    // activation_stash
+    sstream.append(attr.activation_stash_dt_);
     // acc_mode
     sstream.append(attr.acc_mode_);
 
@@ -246,6 +264,20 @@ void serialize(serialization_stream_t &sstream, const concat_desc_t &desc) {
         serialize(sstream, *desc.src_mds[i]);
 }
 
+void serialize(serialization_stream_t &sstream, const split_desc_t &desc) {
+    // Kinds
+    sstream.append(desc.primitive_kind);
+    // Memory descriptors
+    serialize(sstream, *desc.src_md);
+    // N
+    sstream.append(desc.n);
+    // Split dimension
+    sstream.append(desc.split_dimension);
+    // Array of mds
+    for (int i = 0; i < desc.n; i++)
+        serialize(sstream, *desc.dst_mds[i]);
+}
+
 void serialize(serialization_stream_t &sstream,
         const batch_normalization_desc_t &desc) {
     // Kinds
@@ -319,6 +351,16 @@ void serialize(serialization_stream_t &sstream, const eltwise_desc_t &desc) {
     sstream.append(desc.beta);
 }
 
+void serialize(serialization_stream_t &sstream, const gather_desc_t &desc) {
+    // Kinds
+    sstream.append(desc.primitive_kind);
+    sstream.append(desc.alg_kind);
+    // Memory descriptors
+    serialize(sstream, desc.src_desc);
+    serialize(sstream, desc.indices_desc);
+    serialize(sstream, desc.dst_desc);
+}
+
 void serialize(serialization_stream_t &sstream, const gemm_desc_t &desc) {
     // Kind
     sstream.append(desc.primitive_kind);
@@ -417,6 +459,7 @@ void serialize(serialization_stream_t &sstream, const matmul_desc_t &desc) {
     serialize(sstream, desc.weights_desc);
     serialize(sstream, desc.bias_desc);
     serialize(sstream, desc.dst_desc);
+    serialize(sstream, desc.group_offsets_desc);
     // Accumulator type
     sstream.append(desc.accum_data_type);
 }
@@ -555,6 +598,10 @@ void serialize(serialization_stream_t &sstream, const softmax_desc_t &desc) {
     serialize(sstream, desc.diff_dst_desc);
     // Axis
     sstream.append(desc.softmax_axis);
+    // Attention scores preprocessing
+    sstream.append(desc.with_scale);
+    sstream.append(desc.mask_type);
+    serialize(sstream, desc.mask_desc);
 }
 
 void serialize(serialization_stream_t &sstream, const sum_desc_t &desc) {
@@ -571,6 +618,32 @@ void serialize(serialization_stream_t &sstream, const sum_desc_t &desc) {
         serialize(sstream, *desc.src_mds[i]);
 }
 
+void serialize(serialization_stream_t &sstream, const topk_desc_t &desc) {
+    // Kinds
+    sstream.append(desc.primitive_kind);
+    // Memory descriptors
+    serialize(sstream, desc.src_desc);
+    serialize(sstream, desc.dst_desc);
+    serialize(sstream, desc.indices_desc);
+    // Axis
+    sstream.append(desc.axis);
+}
+
+void serialize(serialization_stream_t &sstream, const optimizer_desc_t &desc) {
+    // Kinds
+    sstream.append(desc.primitive_kind);
+    sstream.append(desc.alg_kind);
+    // Memory descriptors
+    serialize(sstream, desc.grad_desc);
+    serialize(sstream, desc.param_desc);
+    serialize(sstream, desc.master_desc);
+    // Hyperparameters
+    sstream.append(desc.momentum);
+    sstream.append(desc.beta2);
+    sstream.append(desc.epsilon);
+    sstream.append(desc.weight_decay);
+}
+
 void serialize(serialization_stream_t &sstream, const sdpa_desc_t &desc) {
     // Kind
     sstream.append(desc.primitive_kind);
@@ -583,11 +656,20 @@ void serialize(serialization_stream_t &sstream, const sdpa_desc_t &desc) {
     desc.vs_zero_points.serialize(sstream);
     serialize(sstream, desc.dst_desc);
     serialize(sstream, desc.attn_mask_desc);
+    sstream.append(desc.prop_kind);
+    serialize(sstream, desc.stats_desc);
+    serialize(sstream, desc.diff_q_desc);
+    serialize(sstream, desc.diff_k_desc);
+    serialize(sstream, desc.diff_v_desc);
+    serialize(sstream, desc.diff_dst_desc);
     sstream.append(desc.scale_dt);
     sstream.append(desc.invert_scale);
     sstream.append(desc.kv_head_number);
     sstream.append(desc.mask_type);
     sstream.append(desc.softmax_alg);
+    sstream.append(desc.window_size);
+    sstream.append(desc.alibi_max_bias);
+    sstream.append(desc.softcap);
 }
 
 } // namespace impl
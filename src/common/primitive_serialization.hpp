@@ -29,11 +29,13 @@ void serialize(serialization_stream_t &sstream, const post_ops_t &post_ops);
 void serialize(serialization_stream_t &sstream, const primitive_attr_t &attr);
 void serialize(serialization_stream_t &sstream, const memory_desc_t &md);
 void serialize(serialization_stream_t &sstream, const concat_desc_t &desc);
+void serialize(serialization_stream_t &sstream, const split_desc_t &desc);
 void serialize(serialization_stream_t &sstream,
         const batch_normalization_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const binary_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const convolution_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const eltwise_desc_t &desc);
+void serialize(serialization_stream_t &sstream, const gather_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const gemm_desc_t &desc);
 void serialize(serialization_stream_t &sstream,
         const group_normalization_desc_t &desc);
@@ -53,6 +55,9 @@ void serialize(serialization_stream_t &sstream, const sdpa_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const shuffle_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const softmax_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const sum_desc_t &desc);
+void serialize(serialization_stream_t &sstream, const topk_desc_t &desc);
+void serialize(
+        serialization_stream_t &sstream, const optimizer_desc_t &desc);
 
 status_t serialize_desc(
         serialization_stream_t &sstream, const op_desc_t *op_desc);
@@ -140,16 +140,66 @@ status_t reorder_primitive_desc_create(std::shared_ptr<primitive_desc_t> &pd,
                     "mask is not consistent with groups");
         }
 
-        VCHECK_REORDER(sc.get(DNNL_ARG_DST).has_default_groups(),
+        VCHECK_REORDER(attr->dst_dyn_quant_
+                        || sc.get(DNNL_ARG_DST).has_default_groups(),
                 VERBOSE_UNSUPPORTED_SCALES_CFG);
     }
 
+    // Check dynamic quantization of the destination
+    if (attr->dst_dyn_quant_) {
+        using namespace data_type;
+        const auto &sc = attr->scales_;
+        const auto src_dt = src_md->data_type;
+        const auto dst_dt = dst_md->data_type;
+        VCHECK_REORDER(utils::one_of(src_dt, f32, bf16, f16),
+                VERBOSE_INVALID_DATATYPE, "src");
+        VCHECK_REORDER(
+                utils::one_of(dst_dt, s8, u8, s4, u4, f8_e5m2, f8_e4m3),
+                VERBOSE_INVALID_DATATYPE, "dst");
+        VCHECK_REORDER(!sc.has_default_values(DNNL_ARG_DST)
+                        && sc.has_default_values(DNNL_ARG_SRC),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        VCHECK_REORDER(zero_points.has_default_values(DNNL_ARG_SRC),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+
+        // Unsigned types can't represent a symmetric range
+        const auto &sc_dst = sc.get(DNNL_ARG_DST);
+        const auto &zp_dst = zero_points.get(DNNL_ARG_DST);
+        const bool with_zp = !zp_dst.has_default_values();
+        VCHECK_REORDER(IMPLICATION(utils::one_of(dst_dt, u8, u4), with_zp),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+        // Zero points share the groups of the scales
+        VCHECK_REORDER(IMPLICATION(with_zp,
+                               zp_dst.get_mask() == sc_dst.get_mask()
+                                       && zp_dst.get_group(0)
+                                               == sc_dst.get_group(0)
+                                       && zp_dst.get_group(1)
+                                               == sc_dst.get_group(1)),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+
+        if (!sc_dst.has_default_groups()) {
+            const int dst_ndims = d_mdw.ndims();
+            const int mask_dst = sc_dst.get_mask();
+            VCHECK_REORDER(dst_ndims >= 2
+                            && (mask_dst & (1 << (dst_ndims - 1)))
+                            && (mask_dst & (1 << (dst_ndims - 2)))
+                            && dst_md->dims[dst_ndims - 2]
+                                            % sc_dst.get_group(0)
+                                    == 0
+                            && dst_md->dims[dst_ndims - 1]
+                                            % sc_dst.get_group(1)
+                                    == 0,
+                    "groups are not consistent with reorder dimensions");
+        }
+    }
+
     bool is_cross_engine = src_engine != dst_engine
             && utils::one_of(
                     engine_kind::gpu, src_engine->kind(), dst_engine->kind());
 
     reorder_desc_t desc = {primitive_kind::reorder, src_md, dst_md, s_ek, d_ek,
             is_cross_engine};
+    max_threads_limit_guard_t max_threads_guard(attr->max_threads_);
     primitive_hashing::key_t key(
             engine, reinterpret_cast<op_desc_t *>(&desc), attr, 0, {}, -1);
     pd = primitive_cache().get_pd(key);
@@ -118,6 +118,14 @@ struct reorder_pd_t : public primitive_desc_t {
 
         if (arg == DNNL_ARG_TO) return arg_usage_t::output;
 
+        // Computed destination quantization parameters
+        if (attr()->dst_dyn_quant_
+                && utils::one_of(arg, DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST,
+                        DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_DST))
+            return primitive_desc_t::arg_usage(arg) == arg_usage_t::input
+                    ? arg_usage_t::output
+                    : arg_usage_t::unused;
+
         return primitive_desc_t::arg_usage(arg);
     }
 
@@ -42,7 +42,8 @@ namespace {
 status_t resampling_desc_init(resampling_desc_t *resampling_desc,
         prop_kind_t prop_kind, alg_kind_t alg_kind, const float *factors,
         const memory_desc_t *src_desc, const memory_desc_t *dst_desc) {
-    VCHECK_RS(one_of(alg_kind, resampling_nearest, resampling_linear),
+    VCHECK_RS(one_of(alg_kind, resampling_nearest, resampling_linear,
+                      resampling_cubic, resampling_linear_antialias),
             VERBOSE_BAD_ALGORITHM);
     VCHECK_RS(src_desc, VERBOSE_NULL_ARG);
     VCHECK_RS(IMPLICATION(dst_desc == nullptr, factors), VERBOSE_NULL_ARG);
@@ -50,6 +51,12 @@ status_t resampling_desc_init(resampling_desc_t *resampling_desc,
             src_desc->ndims);
 
     const bool is_fwd = one_of(prop_kind, forward_training, forward_inference);
+    // Cubic and antialiased interpolation are preprocessing operations and
+    // have no backward propagation.
+    VCHECK_RS_UNIMPL(IMPLICATION(one_of(alg_kind, resampling_cubic,
+                                         resampling_linear_antialias),
+                             is_fwd),
+            VERBOSE_BAD_PROPKIND);
     VCHECK_RS(IMPLICATION(is_fwd, src_desc->format_kind != format_kind::any),
             VERBOSE_UNSUPPORTED_TAG_S, "src");
 
@@ -138,6 +138,19 @@ status_t check_data_type_consistency_fwd(const rnn_desc_t &r) {
     const bool is_bf16 = is_xf16_helper(bf16);
     const bool is_f16 = is_xf16_helper(f16);
 
+    // Weight-only quantization: the weights are decompressed to bf16.
+    const bool is_bf16_wei_decomp = is_inference
+            && one_of(r.cell_kind, dnnl_vanilla_lstm, dnnl_vanilla_gru,
+                    dnnl_lbr_gru)
+            && everyone_is(bf16, src_layer_dt, dst_layer_dt)
+            && weights_iter_dt == weights_layer_dt
+            && one_of(weights_layer_dt, s8, u8, s4, u4)
+            && expect_dt(r.src_iter_desc, bf16)
+            && r.weights_peephole_desc.data_type == data_type::undef
+            && weights_projection_dt == data_type::undef
+            && expect_dt(r.dst_iter_desc, bf16)
+            && one_of(r.bias_desc.data_type, bf16, f32);
+
     const bool is_u8u8u8 = is_inference && is_int8_ok && src_layer_dt == u8
             && one_of(dst_layer_dt, u8, f32)
             && everyone_is(s8, weights_iter_dt, weights_layer_dt)
@@ -173,8 +186,9 @@ status_t check_data_type_consistency_fwd(const rnn_desc_t &r) {
             && expect_dt(r.dst_iter_desc, f32) && expect_dt(r.bias_desc, f32);
 
     return cell_state_check
-                    && (is_f32 || is_bf16 || is_f16 || is_u8u8u8 || is_f32u8f32
-                            || is_s8s8s8 || is_f32s8f32)
+                    && (is_f32 || is_bf16 || is_f16 || is_bf16_wei_decomp
+                            || is_u8u8u8 || is_f32u8f32 || is_s8s8s8
+                            || is_f32s8f32)
             ? success
             : unimplemented;
 }
@@ -330,6 +344,14 @@ status_t rnn_common_fwd_desc_init(rnn_desc_t *rnn_desc, prop_kind_t prop_kind,
                 "num_layers != 1");
     }
 
+    // check variable-length sequences restrictions
+    if (flags & rnn_flags::seq_lengths) {
+        VCONDCHECK_RNN(prop_kind == prop_kind::forward_inference,
+                VERBOSE_BAD_PROPKIND);
+        VCONDCHECK_RNN(direction == dnnl_unidirectional_left2right,
+                VERBOSE_BAD_PARAM, "direction != unidirectional_left2right");
+    }
+
     VCHECK_RNN(
             check_runtime_dims_or_strides({src_layer_desc, src_iter_desc,
                     src_iter_c_desc, weights_layer_desc, weights_iter_desc,
@@ -434,6 +456,9 @@ status_t rnn_common_bwd_desc_init(rnn_desc_t *rnn_desc, prop_kind_t prop_kind,
                 VERBOSE_NULL_ARG);
     }
 
+    // variable-length sequences are supported for inference only
+    VCONDCHECK_RNN(!(flags & rnn_flags::seq_lengths), VERBOSE_BAD_FLAGS);
+
     // check if optional md is provided then diff_md is provided too
     VCONDCHECK_RNN(xnor_md(bias_desc, diff_bias_desc), VERBOSE_NULL_ARG);
     VCONDCHECK_RNN(xnor_md(weights_peephole_desc, diff_weights_peephole_desc),
@@ -533,6 +558,16 @@ status_t rnn_attr_check(const rnn_desc_t &desc, const engine_t *engine,
                     | smask_t::rnn_weights_qparams
                     | smask_t::rnn_weights_projection_qparams;
 
+        // Weight-only quantized weights take their scales from the regular
+        // scales attribute.
+        const bool is_wei_decomp
+                = desc.prop_kind == prop_kind::forward_inference
+                && desc.src_layer_desc.data_type == data_type::bf16
+                && one_of(wei_layer_dt, data_type::s8, data_type::u8,
+                        data_type::s4, data_type::u4);
+        if (is_wei_decomp)
+            attr_mask |= smask_t::scales_groups | smask_t::scales_data_type;
+
         VCONDCHECK_RNN_UNIMPL(
                 attr->has_default_values(attr_mask), VERBOSE_UNSUPPORTED_ATTR);
 
@@ -166,6 +166,15 @@ struct rnn_pd_t : public primitive_desc_t {
 
     bool with_augru_attention() const { return is_augru(); }
 
+    bool with_seq_lengths() const {
+        return desc_.flags & rnn_flags::seq_lengths;
+    }
+
+    // Per-batch sequence lengths, an s32 vector of MB() elements.
+    const memory_desc_t *seq_lengths_md() const {
+        return with_seq_lengths() ? &seq_lengths_md_ : &glob_zero_md;
+    }
+
     bool with_src_iter() const {
         return !(memory_desc_wrapper(desc_.src_iter_desc).is_zero());
     }
@@ -228,6 +237,7 @@ protected:
     memory_desc_t dst_layer_md_;
     memory_desc_t dst_iter_md_;
     memory_desc_t dst_iter_c_md_;
+    memory_desc_t seq_lengths_md_;
 
     memory_desc_t ws_md_;
 
@@ -246,7 +256,14 @@ protected:
         , bias_md_(desc_.bias_desc)
         , dst_layer_md_(desc_.dst_layer_desc)
         , dst_iter_md_(desc_.dst_iter_desc)
-        , dst_iter_c_md_(desc_.dst_iter_c_desc) {}
+        , dst_iter_c_md_(desc_.dst_iter_c_desc)
+        , seq_lengths_md_(glob_zero_md) {
+        if (with_seq_lengths()) {
+            const dims_t dims = {MB()};
+            memory_desc_init_by_tag(
+                    seq_lengths_md_, 1, dims, data_type::s32, format_tag::a);
+        }
+    }
 };
 // NOLINTEND(google-default-arguments)
 
@@ -268,6 +285,10 @@ struct rnn_fwd_pd_t : public rnn_pd_t {
         if (arg == DNNL_ARG_SRC_ITER_C)
             return with_src_iter_c() ? arg_usage_t::input : arg_usage_t::unused;
 
+        if (arg == DNNL_ARG_SEQ_LENGTHS)
+            return with_seq_lengths() ? arg_usage_t::input
+                                      : arg_usage_t::unused;
+
         if (utils::one_of(arg, DNNL_ARG_WEIGHTS_LAYER, DNNL_ARG_WEIGHTS_ITER))
             return arg_usage_t::input;
 
@@ -304,6 +325,7 @@ struct rnn_fwd_pd_t : public rnn_pd_t {
             case DNNL_ARG_AUGRU_ATTENTION: return &const_augru_attention_md();
             case DNNL_ARG_SRC_ITER: return src_md(1);
             case DNNL_ARG_SRC_ITER_C: return src_md(2);
+            case DNNL_ARG_SEQ_LENGTHS: return seq_lengths_md();
             case DNNL_ARG_WEIGHTS_LAYER: return weights_md(0);
             case DNNL_ARG_WEIGHTS_ITER: return weights_md(1);
             case DNNL_ARG_WEIGHTS_PEEPHOLE:
@@ -323,7 +345,8 @@ struct rnn_fwd_pd_t : public rnn_pd_t {
 
     int n_inputs() const override {
         return 3 + is_lstm_peephole() + is_lstm_projection() + with_bias()
-                + with_src_iter() + with_src_iter_c() + is_augru();
+                + with_src_iter() + with_src_iter_c() + is_augru()
+                + with_seq_lengths();
     }
     int n_outputs() const override {
         return 1 + with_dst_iter() + with_dst_iter_c() + is_training();
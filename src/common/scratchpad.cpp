@@ -14,7 +14,11 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 #include "engine.hpp"
 #include "utils.hpp"
@@ -58,8 +62,104 @@ memory_storage_t *create_scratchpad_memory_storage(
     return mem_storage;
 }
 
+std::atomic<size_t> global_scratchpad_n_allocations {0};
+std::atomic<size_t> global_scratchpad_n_reuses {0};
+std::atomic<size_t> global_scratchpad_n_trims {0};
+
+std::atomic<size_t> &global_scratchpad_retain_limit() {
+    static std::atomic<size_t> limit {
+            getenv_size_user("GLOBAL_SCRATCHPAD_RETAIN_LIMIT", 0)};
+    return limit;
+}
+
+// Rounds the size up to one of four classes per power of two, so that
+// primitives with slightly different requirements share a buffer size and
+// growth is geometric. The overhead is at most 25%.
+size_t round_up_to_size_class(size_t size) {
+    const size_t min_step = 4096;
+    if (size <= min_step) return size == 0 ? 0 : min_step;
+    size_t pow2 = min_step;
+    while (pow2 <= size / 2)
+        pow2 *= 2;
+    return utils::rnd_up(size, std::max(min_step, pow2 / 4));
+}
+
+// Buffers without users kept for reuse, with a total size not exceeding the
+// retain limit. They are owned by the process rather than by the thread that
+// used them last, so that no thread-local object needs a destructor.
+struct kept_buffers_t {
+    ~kept_buffers_t() {
+        for (const auto &b : buffers_)
+            delete b.second;
+    }
+
+    // Takes ownership of `mem_storage`. Returns false if it does not fit into
+    // `limit`, the caller then keeps the ownership.
+    bool put(memory_storage_t *mem_storage, size_t size, size_t limit) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (size > limit || total_size_ > limit - size) return false;
+        buffers_.emplace_back(size, mem_storage);
+        total_size_ += size;
+        return true;
+    }
+
+    // Returns the smallest kept buffer of at least `size` bytes, or nullptr.
+    memory_storage_t *get(size_t size, size_t &buffer_size) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto best = buffers_.end();
+        for (auto it = buffers_.begin(); it != buffers_.end(); ++it) {
+            if (it->first >= size
+                    && (best == buffers_.end() || it->first < best->first))
+                best = it;
+        }
+        if (best == buffers_.end()) return nullptr;
+        memory_storage_t *mem_storage = best->second;
+        buffer_size = best->first;
+        total_size_ -= best->first;
+        buffers_.erase(best);
+        return mem_storage;
+    }
+
+    // Releases the biggest buffers until the total size fits into `limit`.
+    void trim(size_t limit) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        while (total_size_ > limit) {
+            auto biggest = buffers_.begin();
+            for (auto it = buffers_.begin(); it != buffers_.end(); ++it)
+                if (it->first > biggest->first) biggest = it;
+            delete biggest->second;
+            total_size_ -= biggest->first;
+            buffers_.erase(biggest);
+            global_scratchpad_n_trims++;
+        }
+    }
+
+private:
+    std::mutex mutex_;
+    std::vector<std::pair<size_t, memory_storage_t *>> buffers_;
+    size_t total_size_ = 0;
+};
+
+kept_buffers_t &kept_buffers() {
+    static kept_buffers_t buffers;
+    return buffers;
+}
+
 } // namespace
 
+void get_global_scratchpad_stats(global_scratchpad_stats_t *stats) {
+    if (!stats) return;
+    stats->n_allocations = global_scratchpad_n_allocations.load();
+    stats->n_reuses = global_scratchpad_n_reuses.load();
+    stats->n_trims = global_scratchpad_n_trims.load();
+}
+
+size_t set_global_scratchpad_retain_limit(size_t limit) {
+    const size_t old_limit = global_scratchpad_retain_limit().exchange(limit);
+    kept_buffers().trim(limit);
+    return old_limit;
+}
+
 /*
   Implementation of the scratchpad_t interface that is compatible with
   a concurrent execution
@@ -88,32 +188,55 @@ private:
 /*
   Implementation of the scratchpad_t interface that uses a global
   scratchpad
+
+  The buffer is shared by all primitives on a thread. Its size is rounded up
+  to a size class to reduce the number of reallocations. When the last user
+  is gone, the buffer is handed over to the process-wide kept buffers if they
+  stay within the retain limit, instead of being freed. The next thread that
+  creates a primitive without a buffer takes one from there, which avoids
+  repeated allocations and page faults when models with different needs
+  interleave.
 */
 
 struct global_scratchpad_t : public scratchpad_t {
     global_scratchpad_t(engine_t *engine, size_t size) {
+        if (reference_count_ == 0 && size > 0)
+            mem_storage_ = kept_buffers().get(
+                    round_up_to_size_class(size), size_);
         // TODO: check if engine is the same
         if (size > size_) {
             delete mem_storage_;
             // Try to expand the global scratchpad to the necessary size
-            mem_storage_ = create_scratchpad_memory_storage(engine, size);
+            const size_t new_size = round_up_to_size_class(size);
+            mem_storage_ = create_scratchpad_memory_storage(engine, new_size);
             if (mem_storage_ == nullptr) {
                 // Recreate scratchpad with original capacity
                 mem_storage_ = create_scratchpad_memory_storage(engine, size_);
                 if (mem_storage_ == nullptr) size_ = 0;
-            } else
-                size_ = size;
+            } else {
+                size_ = new_size;
+                global_scratchpad_n_allocations++;
+            }
+        } else if (size > 0) {
+            global_scratchpad_n_reuses++;
         }
         reference_count_++;
     }
 
     ~global_scratchpad_t() override {
         reference_count_--;
-        if (reference_count_ == 0) {
-            delete mem_storage_;
+        if (reference_count_ != 0) return;
+
+        const size_t limit = global_scratchpad_retain_limit().load();
+        if (mem_storage_ && kept_buffers().put(mem_storage_, size_, limit)) {
             mem_storage_ = nullptr;
             size_ = 0;
+            return;
         }
+        if (mem_storage_ && limit > 0) global_scratchpad_n_trims++;
+        delete mem_storage_;
+        mem_storage_ = nullptr;
+        size_ = 0;
     }
 
     const memory_storage_t *get_memory_storage() const override {
@@ -124,6 +247,7 @@ struct global_scratchpad_t : public scratchpad_t {
 
 private:
     DNNL_DISALLOW_COPY_AND_ASSIGN(global_scratchpad_t);
+
     thread_local static memory_storage_t *mem_storage_;
     thread_local static size_t size_;
     thread_local static unsigned int reference_count_;
@@ -33,6 +33,21 @@ struct scratchpad_t {
 scratchpad_t *create_scratchpad(
         engine_t *engine, size_t size, bool use_global_scratchpad);
 
+// Undocumented API for testing.
+struct global_scratchpad_stats_t {
+    // Number of times a global scratchpad buffer was allocated.
+    size_t n_allocations;
+    // Number of times an existing buffer was big enough for a primitive.
+    size_t n_reuses;
+    // Number of times an unused buffer was released because it exceeded the
+    // retain limit.
+    size_t n_trims;
+};
+void DNNL_API get_global_scratchpad_stats(global_scratchpad_stats_t *stats);
+// Releases the kept buffers that exceed the new limit. Returns the previous
+// limit.
+size_t DNNL_API set_global_scratchpad_retain_limit(size_t limit);
+
 } // namespace impl
 } // namespace dnnl
 #endif
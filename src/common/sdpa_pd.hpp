@@ -48,6 +48,16 @@ struct sdpa_pd_t : public primitive_desc_t {
         return reinterpret_cast<const op_desc_t *>(this->desc());
     }
 
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::prop_kind:
+                *(prop_kind_t *)result = desc()->prop_kind;
+                break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
     arg_usage_t arg_usage(int arg) const override {
         // TODO: this is broken for cases when the user passes quantization
         // memories unconditionally but the primitive desc is not set up for
@@ -62,6 +72,9 @@ struct sdpa_pd_t : public primitive_desc_t {
 
         if (arg == DNNL_ARG_DST) return arg_usage_t::output;
 
+        if (arg == DNNL_ARG_ATTN_STATS)
+            return is_training() ? arg_usage_t::output : arg_usage_t::unused;
+
         return primitive_desc_t::arg_usage(arg);
     }
 
@@ -73,6 +86,7 @@ struct sdpa_pd_t : public primitive_desc_t {
             case DNNL_ARG_VALUES: return src_md(2);
             case DNNL_ARG_ATTN_MASK: return src_md(3);
             case DNNL_ARG_DST: return dst_md(0, user_input);
+            case DNNL_ARG_ATTN_STATS: return workspace_md(0);
             default: return primitive_desc_t::arg_md(arg);
         }
     }
@@ -91,16 +105,34 @@ struct sdpa_pd_t : public primitive_desc_t {
             int index = 0, bool user_input = false) const override {
         return index == 0 ? &desc_.dst_desc : &glob_zero_md;
     }
+    const memory_desc_t *workspace_md(int index = 0) const override {
+        return index == 0 && with_stats() ? &desc_.stats_desc : &glob_zero_md;
+    }
 
     const memory_desc_t *qry_md() const { return &desc_.q_desc; }
     const memory_desc_t *key_md() const { return &desc_.k_desc; }
     const memory_desc_t *val_md() const { return &desc_.v_desc; }
     const memory_desc_t *attn_mask_md() const { return &desc_.attn_mask_desc; }
+    const memory_desc_t *stats_md() const { return &desc_.stats_desc; }
 
     int n_inputs() const override {
         return 3 + int(with_attn_mask()) + int(with_attn_scale());
     }
-    int n_outputs() const override { return 1; }
+    int n_outputs() const override { return 1 + int(is_training()); }
+
+    bool is_fwd() const {
+        return utils::one_of(desc_.prop_kind, prop_kind::forward_training,
+                prop_kind::forward_inference);
+    }
+    bool is_training() const {
+        return desc_.prop_kind == prop_kind::forward_training;
+    }
+
+    /// If true, the log-sum-exp statistics are written (forward training) or
+    /// read (backward)
+    bool with_stats() const {
+        return desc_.prop_kind != prop_kind::forward_inference;
+    }
 
     bool with_attn_scale() const {
         return (desc_.scale_dt != data_type::undef);
@@ -116,6 +148,21 @@ struct sdpa_pd_t : public primitive_desc_t {
                 || desc_.mask_type == attn_mask_type::bottom_right;
     }
 
+    /// If true, queries only attend to a window of keys before the diagonal
+    bool with_sliding_window() const { return desc_.window_size > 0; }
+
+    /// If true, ALiBi biases are added to the scores
+    bool with_alibi() const { return desc_.alibi_max_bias != 0.f; }
+
+    /// If true, the scores are soft-capped
+    bool with_softcap() const { return desc_.softcap != 0.f; }
+
+    /// If true, the scores are modified by sliding window, ALiBi, or
+    /// soft-capping
+    bool with_score_mods() const {
+        return with_sliding_window() || with_alibi() || with_softcap();
+    }
+
     /// If true, dequantize the K tensor using scaling in the KQ matmul
     bool with_key_scales() const {
         return (!desc()->kq_scales.has_default_values());
@@ -228,6 +275,81 @@ private:
         return static_cast<int>(out);
     }
 };
+
+// Backward SDPA. The probabilities are recomputed from the log-sum-exp
+// statistics saved by the forward training pass, so the attention matrix is
+// never stored.
+struct sdpa_bwd_pd_t : public sdpa_pd_t {
+    using base_class = sdpa_bwd_pd_t;
+    using hint_class = sdpa_pd_t;
+
+    arg_usage_t arg_usage(int arg) const override {
+        if (utils::one_of(arg, DNNL_ARG_QUERIES, DNNL_ARG_KEYS, DNNL_ARG_VALUES,
+                    DNNL_ARG_DST, DNNL_ARG_DIFF_DST, DNNL_ARG_ATTN_STATS))
+            return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_ATTN_MASK)
+            return with_attn_mask() ? arg_usage_t::input : arg_usage_t::unused;
+
+        if (arg == DNNL_ARG_SCALE)
+            return with_attn_scale() ? arg_usage_t::input
+                                     : arg_usage_t::unused;
+
+        if (utils::one_of(arg, DNNL_ARG_DIFF_QUERIES, DNNL_ARG_DIFF_KEYS,
+                    DNNL_ARG_DIFF_VALUES))
+            return arg_usage_t::output;
+
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_DIFF_QUERIES: return diff_src_md(0);
+            case DNNL_ARG_DIFF_KEYS: return diff_src_md(1);
+            case DNNL_ARG_DIFF_VALUES: return diff_src_md(2);
+            case DNNL_ARG_DIFF_DST: return diff_dst_md(0, user_input);
+            default: return sdpa_pd_t::arg_md(arg, user_input);
+        }
+    }
+
+    const memory_desc_t *diff_src_md(
+            int index = 0, bool user_input = false) const override {
+        switch (index) {
+            case 0: return &desc_.diff_q_desc;
+            case 1: return &desc_.diff_k_desc;
+            case 2: return &desc_.diff_v_desc;
+            default: return &glob_zero_md;
+        }
+    }
+    const memory_desc_t *diff_dst_md(
+            int index = 0, bool user_input = false) const override {
+        return index == 0 ? &desc_.diff_dst_desc : &glob_zero_md;
+    }
+
+    const memory_desc_t *diff_qry_md() const { return &desc_.diff_q_desc; }
+    const memory_desc_t *diff_key_md() const { return &desc_.diff_k_desc; }
+    const memory_desc_t *diff_val_md() const { return &desc_.diff_v_desc; }
+
+    int n_inputs() const override {
+        return 6 + int(with_attn_mask()) + int(with_attn_scale());
+    }
+    int n_outputs() const override { return 3; }
+
+protected:
+    sdpa_bwd_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd_pd)
+        : sdpa_pd_t(adesc, attr, hint_fwd_pd) {}
+
+    bool set_default_formats() {
+        bool ok = sdpa_pd_t::set_default_formats();
+        for (auto md : {&desc_.diff_q_desc, &desc_.diff_k_desc,
+                     &desc_.diff_v_desc, &desc_.diff_dst_desc}) {
+            ok = ok && set_default_format(md);
+        }
+        return ok;
+    }
+};
 // NOLINTEND(google-default-arguments)
 
 } // namespace impl
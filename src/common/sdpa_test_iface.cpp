@@ -46,3 +46,55 @@ dnnl_status_t DNNL_API sdpa_primitive_desc_create(
     return dnnl::impl::primitive_desc_create(primitive_desc_iface, engine,
             (const dnnl::impl::op_desc_t *)&sdpa_desc, nullptr, attr);
 }
+
+dnnl_status_t DNNL_API sdpa_training_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t query_desc, const_dnnl_memory_desc_t key_desc,
+        const_dnnl_memory_desc_t value_desc, const_dnnl_memory_desc_t dst_desc,
+        const_dnnl_memory_desc_t mask_desc,
+        const_dnnl_memory_desc_t stats_desc, dnnl_data_type_t scale_dt,
+        bool invert_scale, dnnl_dim_t kv_head_number, int attn_mask_type,
+        dnnl_alg_kind_t softmax_alg, const_dnnl_primitive_attr_t attr) {
+    CHECK(sdpa_desc_check(query_desc, key_desc, value_desc, dst_desc, mask_desc,
+            engine, attr, nullptr, nullptr));
+    CHECK(sdpa_attr_check(query_desc, key_desc, value_desc, engine, attr,
+            nullptr, nullptr));
+    CHECK(sdpa_stats_desc_check(stats_desc, dst_desc));
+
+    dnnl::impl::sdpa_desc_t sdpa_desc = dnnl::impl::create_sdpa_desc(query_desc,
+            key_desc, value_desc, dst_desc, mask_desc,
+            (dnnl::impl::data_type_t)scale_dt, invert_scale, kv_head_number,
+            static_cast<attn_mask_type_t>(attn_mask_type), softmax_alg, nullptr,
+            nullptr, prop_kind::forward_training, stats_desc);
+    return dnnl::impl::primitive_desc_create(primitive_desc_iface, engine,
+            (const dnnl::impl::op_desc_t *)&sdpa_desc, nullptr, attr);
+}
+
+dnnl_status_t DNNL_API sdpa_backward_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t diff_query_desc,
+        const_dnnl_memory_desc_t diff_key_desc,
+        const_dnnl_memory_desc_t diff_value_desc,
+        const_dnnl_memory_desc_t diff_dst_desc,
+        const_dnnl_primitive_desc_t hint_fwd_pd,
+        const_dnnl_primitive_attr_t attr) {
+    VCHECK_SDPA_COND(hint_fwd_pd
+                    && hint_fwd_pd->impl()->kind() == primitive_kind::sdpa,
+            "forward primitive descriptor must be an sdpa one");
+    const auto *fwd_pd = utils::downcast<const sdpa_pd_t *>(
+            hint_fwd_pd->impl().get());
+    VCHECK_SDPA_COND(fwd_pd->is_training(),
+            "forward primitive descriptor must be created for training");
+
+    const sdpa_desc_t &fwd_desc = *fwd_pd->desc();
+    CHECK(sdpa_bwd_desc_check(&fwd_desc.q_desc, &fwd_desc.k_desc,
+            &fwd_desc.v_desc, &fwd_desc.dst_desc, diff_query_desc,
+            diff_key_desc, diff_value_desc, diff_dst_desc,
+            &fwd_desc.stats_desc));
+
+    dnnl::impl::sdpa_desc_t sdpa_desc = dnnl::impl::create_sdpa_bwd_desc(
+            fwd_desc, diff_query_desc, diff_key_desc, diff_value_desc,
+            diff_dst_desc);
+    return dnnl::impl::primitive_desc_create(primitive_desc_iface, engine,
+            (const dnnl::impl::op_desc_t *)&sdpa_desc, hint_fwd_pd, attr);
+}
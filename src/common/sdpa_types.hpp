@@ -32,31 +32,13 @@ namespace impl {
 #define DNNL_ARG_KEYS DNNL_ARG_SRC_1
 #define DNNL_ARG_VALUES DNNL_ARG_SRC_2
 #define DNNL_ARG_ATTN_MASK DNNL_ARG_SHIFT
+// Log-sum-exp of each query row, produced by the forward training pass and
+// consumed by the backward pass to recompute attention probabilities.
+#define DNNL_ARG_ATTN_STATS DNNL_ARG_WORKSPACE
 
-// NOLINTBEGIN(modernize-use-using)
-/// Types of attention mask
-typedef enum {
-    dnnl_attn_mask_undef = 0,
-    /// explicit attention masks defined in a buffer
-    dnnl_attn_mask_buffer = 1,
-
-    /// causal mask with the diagonal starting from the top left hand side of
-    /// the mask tensor
-    dnnl_attn_mask_top_left = 2,
-
-    /// causal mask with the diagonal starting from the bottom right hand side
-    /// of the mask tensor
-    dnnl_attn_mask_bottom_right = 3,
-} dnnl_attn_mask_type_t;
-// NOLINTEND(modernize-use-using)
-
-using attn_mask_type_t = dnnl_attn_mask_type_t;
-namespace attn_mask_type {
-const attn_mask_type_t undef = dnnl_attn_mask_undef;
-const attn_mask_type_t buffer = dnnl_attn_mask_buffer;
-const attn_mask_type_t top_left = dnnl_attn_mask_top_left;
-const attn_mask_type_t bottom_right = dnnl_attn_mask_bottom_right;
-} // namespace attn_mask_type
+#define DNNL_ARG_DIFF_QUERIES DNNL_ARG_DIFF_SRC_0
+#define DNNL_ARG_DIFF_KEYS DNNL_ARG_DIFF_SRC_1
+#define DNNL_ARG_DIFF_VALUES DNNL_ARG_DIFF_SRC_2
 
 // A descriptor for a scaled dot product attention (SDPA) operation.
 struct sdpa_desc_t : public op_desc_t {
@@ -79,6 +61,18 @@ struct sdpa_desc_t : public op_desc_t {
 
     memory_desc_t dst_desc;
     memory_desc_t attn_mask_desc;
+
+    // forward_inference, forward_training or backward.
+    prop_kind_t prop_kind = prop_kind::forward_inference;
+    // f32 log-sum-exp statistics with dims (..., queries, 1). Used for
+    // forward_training and backward only.
+    memory_desc_t stats_desc;
+    // Backward only.
+    memory_desc_t diff_q_desc;
+    memory_desc_t diff_k_desc;
+    memory_desc_t diff_v_desc;
+    memory_desc_t diff_dst_desc;
+
     data_type_t scale_dt {};
     // invert_scale = false: multiply by scale
     // invert_scale = true:  divide by scale
@@ -88,6 +82,17 @@ struct sdpa_desc_t : public op_desc_t {
     attn_mask_type_t mask_type = attn_mask_type::undef;
     alg_kind_t softmax_alg = alg_kind::softmax_accurate;
 
+    // Score modifiers generated from scalars instead of a mask tensor.
+    // Sliding window: with a causal mask, a query only attends to the
+    // `window_size` keys ending at its diagonal. 0 disables the window.
+    dim_t window_size = 0;
+    // ALiBi: adds slope_h * (key - query) to the scaled scores of head h,
+    // with slope_h = 2^(-alibi_max_bias * (h + 1) / heads). 0 disables it.
+    float alibi_max_bias = 0.f;
+    // Soft-capping: replaces the scaled scores s by cap * tanh(s / cap).
+    // 0 disables it.
+    float softcap = 0.f;
+
     // Number of queries.
     dnnl_dim_t queries() const { return q_desc.dims[q_desc.ndims - 2]; }
     // Head size.
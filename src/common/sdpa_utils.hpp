@@ -77,6 +77,45 @@ static inline status_t sdpa_desc_check(const memory_desc_t *q_desc,
     return status::success;
 }
 
+static inline status_t sdpa_stats_desc_check(
+        const memory_desc_t *stats_desc, const memory_desc_t *dst_desc) {
+    int ndims = dst_desc->ndims;
+    VCHECK_SDPA_COND(stats_desc->ndims == ndims,
+            "number of dimensions have to match. expected: %d stats: %d",
+            ndims, stats_desc->ndims);
+    VCHECK_SDPA_COND(stats_desc->data_type == data_type::f32,
+            "stats data type(%s) must be f32",
+            dnnl_dt2str(stats_desc->data_type));
+    for (int i = 0; i < ndims - 1; i++)
+        VCHECK_SDPA_COND(stats_desc->dims[i] == dst_desc->dims[i],
+                "stats_desc->dims[%d](%s) must match dst_desc->dims[%d](%s)",
+                i, md2dim_str(stats_desc).c_str(), i,
+                md2dim_str(dst_desc).c_str());
+    VCHECK_SDPA_COND(stats_desc->dims[ndims - 1] == 1,
+            "stats_desc->dims[%d](%s) must be 1", ndims - 1,
+            md2dim_str(stats_desc).c_str());
+    return status::success;
+}
+
+static inline status_t sdpa_bwd_desc_check(const memory_desc_t *q_desc,
+        const memory_desc_t *k_desc, const memory_desc_t *v_desc,
+        const memory_desc_t *dst_desc, const memory_desc_t *diff_q_desc,
+        const memory_desc_t *diff_k_desc, const memory_desc_t *diff_v_desc,
+        const memory_desc_t *diff_dst_desc, const memory_desc_t *stats_desc) {
+    const memory_desc_t *pairs[][2] = {{q_desc, diff_q_desc},
+            {k_desc, diff_k_desc}, {v_desc, diff_v_desc},
+            {dst_desc, diff_dst_desc}};
+    for (const auto &p : pairs) {
+        const memory_desc_t *md = p[0], *diff_md = p[1];
+        VCHECK_SDPA_COND(md->ndims == diff_md->ndims
+                        && utils::array_cmp(md->dims, diff_md->dims, md->ndims),
+                "diff dims(%s) must match dims(%s)",
+                md2dim_str(diff_md).c_str(), md2dim_str(md).c_str());
+    }
+    CHECK(sdpa_stats_desc_check(stats_desc, dst_desc));
+    return status::success;
+}
+
 static inline status_t sdpa_attr_check(const memory_desc_t *q_desc,
         const memory_desc_t *k_desc, const memory_desc_t *v_desc,
         const engine_t *engine, const primitive_attr_t *attr,
@@ -137,7 +176,9 @@ static inline sdpa_desc_t create_sdpa_desc(const memory_desc_t *q_md,
         const memory_desc_t *dst_md, const memory_desc_t *attn_mask_md,
         data_type_t scale_dt, bool invert_scale, dim_t kv_head_number,
         attn_mask_type_t attn_mask_type, alg_kind_t softmax_alg,
-        const primitive_attr_t *kq_attr, const primitive_attr_t *vs_attr) {
+        const primitive_attr_t *kq_attr, const primitive_attr_t *vs_attr,
+        prop_kind_t prop_kind = prop_kind::forward_inference,
+        const memory_desc_t *stats_md = nullptr) {
     auto sdpa_desc = sdpa_desc_t();
     sdpa_desc.primitive_kind = primitive_kind::sdpa;
     sdpa_desc.q_desc = *q_md;
@@ -158,6 +199,21 @@ static inline sdpa_desc_t create_sdpa_desc(const memory_desc_t *q_md,
     sdpa_desc.kv_head_number = kv_head_number;
     sdpa_desc.mask_type = attn_mask_type;
     sdpa_desc.softmax_alg = softmax_alg;
+    sdpa_desc.prop_kind = prop_kind;
+    if (stats_md) sdpa_desc.stats_desc = *stats_md;
+    return sdpa_desc;
+}
+
+// Creates a backward descriptor from the forward training one.
+static inline sdpa_desc_t create_sdpa_bwd_desc(const sdpa_desc_t &fwd_desc,
+        const memory_desc_t *diff_q_md, const memory_desc_t *diff_k_md,
+        const memory_desc_t *diff_v_md, const memory_desc_t *diff_dst_md) {
+    auto sdpa_desc = fwd_desc;
+    sdpa_desc.prop_kind = prop_kind::backward;
+    sdpa_desc.diff_q_desc = *diff_q_md;
+    sdpa_desc.diff_k_desc = *diff_k_md;
+    sdpa_desc.diff_v_desc = *diff_v_md;
+    sdpa_desc.diff_dst_desc = *diff_dst_md;
     return sdpa_desc;
 }
 
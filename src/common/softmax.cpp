@@ -108,7 +108,9 @@ status_t softmax_attr_check(const softmax_desc_t &desc, const engine_t *engine,
 
         const bool is_int8 = utils::one_of(src_dt, data_type::s8, data_type::u8)
                 || utils::one_of(dst_dt, data_type::s8, data_type::u8);
-        if (is_int8) fwd_attr_mask |= smask_t::scales;
+        const bool is_f8 = utils::one_of(
+                dst_dt, data_type::f8_e5m2, data_type::f8_e4m3);
+        if (is_int8 || is_f8) fwd_attr_mask |= smask_t::scales;
 
         VCHECK_SOFTMAX_UNIMPL(attr->has_default_values(fwd_attr_mask, dst_dt),
                 VERBOSE_UNSUPPORTED_ATTR);
@@ -147,6 +149,49 @@ status_t softmax_attr_check(const softmax_desc_t &desc, const engine_t *engine,
     return status::success;
 }
 
+status_t softmax_attn_desc_init(softmax_desc_t *softmax_desc, bool with_scale,
+        attn_mask_type_t mask_type, const memory_desc_t *mask_desc) {
+    using namespace attn_mask_type;
+    const bool with_mask = mask_type != attn_mask_type::undef;
+    VCHECK_SOFTMAX(IMPLICATION(with_mask,
+                           one_of(mask_type, buffer, top_left, bottom_right)),
+            VERBOSE_BAD_PARAM, "attn_mask_type");
+    VCHECK_SOFTMAX(IMPLICATION(mask_type == buffer, mask_desc != nullptr),
+            VERBOSE_NULL_ARG);
+
+    const auto &dst_md = softmax_desc->dst_desc;
+    const int ndims = dst_md.ndims;
+    // Masks are defined for the scores matrix in the two innermost
+    // dimensions with normalization over the last one.
+    VCHECK_SOFTMAX_UNIMPL(IMPLICATION(with_mask,
+                                  ndims >= 2
+                                          && softmax_desc->softmax_axis
+                                                  == ndims - 1),
+            VERBOSE_BAD_AXIS);
+
+    if (mask_type == buffer) {
+        const memory_desc_wrapper mask_d(mask_desc);
+        VCHECK_SOFTMAX(mask_d.ndims() == ndims, VERBOSE_INCONSISTENT_NDIMS,
+                "mask", "dst");
+        for (int d = 0; d < ndims; d++) {
+            VCHECK_SOFTMAX(one_of(mask_d.dims()[d], 1, dst_md.dims[d]),
+                    VERBOSE_INCONSISTENT_DIM, "mask", d, "dst", d);
+        }
+        VCHECK_SOFTMAX_UNIMPL(one_of(mask_d.data_type(), data_type::f32,
+                                      data_type::bf16, data_type::f16),
+                VERBOSE_UNSUPPORTED_DT);
+        VCHECK_SOFTMAX(!mask_d.format_any(), VERBOSE_UNSUPPORTED_TAG_S, "mask");
+        VCONDCHECK(primitive, create, check, softmax,
+                !mask_d.has_runtime_dims_or_strides(), status::unimplemented,
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        softmax_desc->mask_desc = *mask_desc;
+    }
+
+    softmax_desc->with_scale = with_scale;
+    softmax_desc->mask_type = mask_type;
+    return success;
+}
+
 } // namespace
 
 status_t dnnl_softmax_forward_primitive_desc_create(
@@ -180,4 +225,26 @@ status_t dnnl_softmax_backward_primitive_desc_create(
             (const op_desc_t *)&softmax_desc, hint_fwd_pd, attr);
 }
 
+// Internal interface: softmax over attention scores. The source is scaled by a
+// runtime scalar and masked before normalization, saving a pass over the
+// scores tensor compared to scale and mask post-ops of the preceding matmul.
+dnnl_status_t DNNL_API softmax_attn_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        dnnl_prop_kind_t prop_kind, dnnl_alg_kind_t alg_kind,
+        const_dnnl_memory_desc_t src_desc, const_dnnl_memory_desc_t dst_desc,
+        int axis, bool with_scale, int attn_mask_type,
+        const_dnnl_memory_desc_t mask_desc, const_dnnl_primitive_attr_t attr) {
+    VCHECK_SOFTMAX(one_of(prop_kind, forward_inference, forward_training),
+            VERBOSE_BAD_PROPKIND);
+
+    auto softmax_desc = softmax_desc_t();
+    CHECK(softmax_desc_init(&softmax_desc, prop_kind, alg_kind, src_desc,
+            dst_desc, nullptr, nullptr, axis));
+    CHECK(softmax_attn_desc_init(&softmax_desc, with_scale,
+            static_cast<attn_mask_type_t>(attn_mask_type), mask_desc));
+    CHECK(softmax_attr_check(softmax_desc, engine, attr));
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&softmax_desc, nullptr, attr);
+}
+
 // vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
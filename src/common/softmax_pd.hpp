@@ -21,6 +21,7 @@
 
 #include "c_types_map.hpp"
 #include "primitive_desc.hpp"
+#include "sdpa_types.hpp"
 
 #define VDISPATCH_SOFTMAX(cond, msg, ...) \
     VCONDCHECK(primitive, create, dispatch, softmax, (cond), \
@@ -105,6 +106,20 @@ struct softmax_pd_t : public primitive_desc_t {
     }
     bool is_logsoftmax() const { return alg_kind() == alg_kind::softmax_log; }
 
+    // Attention scores preprocessing, see `softmax_desc_t`.
+    bool with_scale() const { return desc_.with_scale; }
+    attn_mask_type_t mask_type() const { return desc_.mask_type; }
+    bool with_mask_buffer() const {
+        return mask_type() == attn_mask_type::buffer;
+    }
+    bool with_causal_mask() const {
+        return utils::one_of(mask_type(), attn_mask_type::top_left,
+                attn_mask_type::bottom_right);
+    }
+    bool with_attn_preprocessing() const {
+        return with_scale() || mask_type() != attn_mask_type::undef;
+    }
+
 protected:
     softmax_desc_t desc_;
     const softmax_fwd_pd_t *hint_fwd_pd_;
@@ -136,6 +151,11 @@ struct softmax_fwd_pd_t : public softmax_pd_t {
             return !types::is_zero_md(workspace_md()) ? arg_usage_t::output
                                                       : arg_usage_t::unused;
 
+        if (arg == DNNL_ARG_SCALE && with_scale()) return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_ATTN_MASK && with_mask_buffer())
+            return arg_usage_t::input;
+
         return primitive_desc_t::arg_usage(arg);
     }
 
@@ -144,6 +164,10 @@ struct softmax_fwd_pd_t : public softmax_pd_t {
         switch (arg) {
             case DNNL_ARG_SRC: return src_md(0);
             case DNNL_ARG_DST: return dst_md(0, user_input);
+            case DNNL_ARG_SCALE:
+                return with_scale() ? &scale_md_ : &glob_zero_md;
+            case DNNL_ARG_ATTN_MASK:
+                return with_mask_buffer() ? &desc_.mask_desc : &glob_zero_md;
             default: return softmax_pd_t::arg_md(arg);
         }
     }
@@ -159,17 +183,28 @@ struct softmax_fwd_pd_t : public softmax_pd_t {
         return &glob_zero_md;
     }
 
-    int n_inputs() const override { return 1 + n_binary_po_inputs(); }
+    int n_inputs() const override {
+        return 1 + with_scale() + with_mask_buffer() + n_binary_po_inputs();
+    }
     int n_outputs() const override {
         return 1 + (!types::is_zero_md(workspace_md()));
     }
 
 protected:
     memory_desc_t src_md_;
+    memory_desc_t scale_md_;
 
     softmax_fwd_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
             const softmax_fwd_pd_t *hint_fwd_pd)
-        : softmax_pd_t(adesc, attr, hint_fwd_pd), src_md_(desc_.src_desc) {}
+        : softmax_pd_t(adesc, attr, hint_fwd_pd)
+        , src_md_(desc_.src_desc)
+        , scale_md_(types::zero_md()) {
+        if (with_scale()) {
+            const dims_t scale_dims = {1};
+            memory_desc_init_by_tag(
+                    scale_md_, 1, scale_dims, data_type::f32, format_tag::a);
+        }
+    }
 
     status_t set_default_formats() {
         if (dst_md()->format_kind != format_kind::any) return status::success;
@@ -0,0 +1,122 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "engine.hpp"
+#include "impl_list_item.hpp"
+#include "primitive_cache.hpp"
+#include "primitive_desc_iface.hpp"
+#include "primitive_hashing.hpp"
+#include "split.hpp"
+#include "split_pd.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::status;
+
+#define VCHECK_SPLIT(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, split, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__);
+
+#define VCHECK_SPLIT_UNIMPL(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, split, (cond), \
+            status::unimplemented, msg, ##__VA_ARGS__);
+namespace dnnl {
+namespace impl {
+
+status_t split_primitive_desc_create(std::shared_ptr<primitive_desc_t> &pd,
+        engine_t *engine, const memory_desc_t *src_md, int n, int split_dim,
+        const memory_desc_t *const *dst_mds, const primitive_attr_t *attr) {
+    VCHECK_SPLIT(!any_null(src_md, dst_mds) && n > 0, VERBOSE_NULL_ARG);
+
+    if (attr == nullptr) attr = &default_attr();
+    VCHECK_SPLIT_UNIMPL(attr->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+
+    const int ndims = src_md->ndims;
+    const dims_t &dims = src_md->dims;
+    const data_type_t dt = src_md->data_type;
+    VCHECK_SPLIT(split_dim >= 0 && split_dim < ndims, VERBOSE_BAD_AXIS);
+    VCHECK_SPLIT(!memory_desc_wrapper(src_md).format_any(),
+            VERBOSE_UNSUPPORTED_TAG_S, "src");
+    VCHECK_SPLIT_UNIMPL(
+            !memory_desc_wrapper(src_md).has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    dim_t split_dim_sz = 0;
+#define DST2STR(i) (std::string("dst_") + std::to_string(i)).c_str()
+    for (int i = 0; i < n; ++i) {
+        VCHECK_SPLIT(dst_mds[i] != nullptr, VERBOSE_NULL_ARG);
+        const memory_desc_t &dst_md = *dst_mds[i];
+        VCHECK_SPLIT(dst_md.ndims == ndims, VERBOSE_INCONSISTENT_NDIMS, "src",
+                DST2STR(i));
+        VCHECK_SPLIT_UNIMPL(
+                !memory_desc_wrapper(dst_md).has_runtime_dims_or_strides(),
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+        for (int d = 0; d < ndims; ++d) {
+            if (d == split_dim) continue;
+            VCHECK_SPLIT(dst_md.dims[d] == dims[d], VERBOSE_INCONSISTENT_DIM,
+                    "src", d, DST2STR(i), d);
+        }
+        VCHECK_SPLIT(dst_md.data_type == dt, VERBOSE_INCONSISTENT_DT, "src",
+                DST2STR(i));
+        split_dim_sz += dst_md.dims[split_dim];
+    }
+#undef DST2STR
+    VCHECK_SPLIT(split_dim_sz == dims[split_dim], VERBOSE_BAD_DIM, "src",
+            split_dim);
+
+    auto desc = split_desc_t(
+            primitive_kind::split, src_md, n, split_dim, dst_mds);
+    max_threads_limit_guard_t max_threads_guard(attr->max_threads_);
+    primitive_hashing::key_t key(
+            engine, reinterpret_cast<op_desc_t *>(&desc), attr, 0, {}, -1);
+    pd = primitive_cache().get_pd(key);
+
+    if (pd) return success;
+
+    split_pd_t *split_pd = nullptr;
+    for (auto s = engine->get_split_implementation_list(); *s; ++s) {
+        if ((*s)(&split_pd, engine, attr, src_md, n, split_dim, dst_mds)
+                == success) {
+            pd.reset(split_pd);
+            return success;
+        }
+    }
+    return unimplemented;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+status_t dnnl_split_primitive_desc_create(
+        primitive_desc_iface_t **split_pd_iface, engine_t *engine,
+        const memory_desc_t *src_md, int n, int split_dim,
+        const memory_desc_t *const *dst_mds, const primitive_attr_t *attr) {
+    if (any_null(split_pd_iface)) return invalid_arguments;
+
+    std::shared_ptr<primitive_desc_t> pd;
+    CHECK(split_primitive_desc_create(
+            pd, engine, src_md, n, split_dim, dst_mds, attr));
+    return safe_ptr_assign(
+            *split_pd_iface, new primitive_desc_iface_t(pd, engine));
+}
@@ -0,0 +1,237 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_SPLIT_PD_HPP
+#define COMMON_SPLIT_PD_HPP
+
+#include <assert.h>
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+#include "type_helpers.hpp"
+
+#include "utils.hpp"
+
+#define VDISPATCH_SPLIT(cond, msg, ...) \
+    VCONDCHECK(primitive, create, dispatch, split, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+namespace dnnl {
+namespace impl {
+
+// NOLINTBEGIN(google-default-arguments)
+struct split_pd_t : public primitive_desc_t {
+    const split_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    ~split_pd_t() override = default;
+
+    arg_usage_t arg_usage(int arg) const override {
+        if (arg == DNNL_ARG_SRC) return arg_usage_t::input;
+
+        if (arg >= DNNL_ARG_MULTIPLE_DST
+                && arg < DNNL_ARG_MULTIPLE_DST + n_outputs())
+            return arg_usage_t::output;
+
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        if (arg == DNNL_ARG_SRC) return src_md(0, user_input);
+        int dst_index = arg - DNNL_ARG_MULTIPLE_DST;
+        if (dst_index >= 0 && dst_index < n_outputs())
+            return dst_md(dst_index, user_input);
+        return primitive_desc_t::arg_md(arg);
+    }
+
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0) return user_input ? desc()->src_md : &src_md_;
+        return &glob_zero_md;
+    }
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        if (index < n_outputs())
+            return user_input ? desc()->dst_mds[index] : &dst_mds_[index];
+        return &glob_zero_md;
+    }
+
+    int n_inputs() const override { return 1; }
+    int n_outputs() const override { return n_; }
+
+    int split_dim() const { return split_dim_; }
+
+    // Returns the part of the source tensor that goes to the destination
+    // `index`, described as a sub-memory of the source.
+    const memory_desc_t *dst_image_md(int index = 0) const {
+        return index < n_outputs() ? &dst_image_mds_[index] : &glob_zero_md;
+    }
+
+    // A destination is a view when its memory descriptor coincides with its
+    // image in the source. A memory object created with such a descriptor
+    // over the source buffer requires no copy.
+    bool is_view(int index) const {
+        return index < n_outputs() && dst_mds_[index] == dst_image_mds_[index];
+    }
+
+protected:
+    int n_, split_dim_;
+    memory_desc_t src_md_;
+    std::vector<memory_desc_t> dst_mds_;
+
+    /* contains images of dsts in the src memory
+     * Lives here to simplify some implementations. An implementation might
+     * use this auxiliary array iff init() returned success */
+    std::vector<memory_desc_t> dst_image_mds_;
+
+    split_desc_t desc_;
+
+    split_pd_t(const primitive_attr_t *attr, const memory_desc_t *src_md,
+            int n, int split_dim, const memory_desc_t *const *dst_mds)
+        : primitive_desc_t(attr, primitive_kind::split)
+        , n_(n)
+        , split_dim_(split_dim)
+        , src_md_(*src_md)
+        , original_src_(*src_md) {
+        dst_mds_.reserve(n_);
+        original_dsts_.reserve(n_);
+        for (int i = 0; i < n_; ++i) {
+            dst_mds_.push_back(*dst_mds[i]);
+            original_dsts_.push_back(*dst_mds[i]);
+        }
+
+        init_desc();
+    }
+
+    split_pd_t(const split_pd_t &other)
+        : primitive_desc_t(other)
+        , n_(other.n_)
+        , split_dim_(other.split_dim_)
+        , src_md_(other.src_md_)
+        , dst_mds_(other.dst_mds_)
+        , dst_image_mds_(other.dst_image_mds_)
+        , original_src_(other.original_src_)
+        , original_dsts_(other.original_dsts_) {
+        init_desc();
+    }
+
+    split_pd_t &operator=(const split_pd_t &other) {
+        DNNL_SHORT_CIRCUIT_SELF_ASSIGN(other);
+        n_ = other.n_;
+        split_dim_ = other.split_dim_;
+        src_md_ = other.src_md_;
+        dst_mds_ = other.dst_mds_;
+        dst_image_mds_ = other.dst_image_mds_;
+        original_src_ = other.original_src_;
+        original_dsts_ = other.original_dsts_;
+
+        init_desc();
+        return *this;
+    }
+
+    /* inits dst_image_mds_ and destinations with `any` format. The latter
+     * are set to their images, so that users may create them over the source
+     * buffer and avoid the copy.
+     *
+     * @warning The call may fail. */
+    status_t init() {
+        const memory_desc_wrapper src_d(&src_md_);
+        if (!src_d.is_blocking_desc() || src_d.is_additional_buffer())
+            return status::unimplemented;
+
+        const int ndims = src_md_.ndims;
+        dim_t current_split_dim_offset = 0;
+        for (int i = 0; i < n_; ++i) {
+            const dim_t dim = dst_mds_[i].dims[split_dim_];
+            dims_t dims, offsets = {};
+            utils::array_copy(dims, src_md_.dims, ndims);
+            dims[split_dim_] = dim;
+            offsets[split_dim_] = current_split_dim_offset;
+
+            memory_desc_t dst_img_d;
+            status_t status = memory_desc_init_submemory(
+                    dst_img_d, src_md_, dims, offsets);
+            if (status != status::success) {
+                dst_image_mds_.clear();
+                return status;
+            }
+            dst_image_mds_.push_back(dst_img_d);
+            current_split_dim_offset += dim;
+        }
+
+        for (int i = 0; i < n_; ++i) {
+            if (dst_mds_[i].format_kind != format_kind::any) continue;
+            dst_mds_[i] = dst_image_mds_[i];
+        }
+
+        return status::success;
+    }
+
+private:
+    memory_desc_t original_src_;
+    std::vector<memory_desc_t> original_dsts_;
+
+    void init_desc() {
+        desc_ = split_desc_t();
+        desc_.primitive_kind = primitive_kind::split;
+        desc_.src_md = &original_src_;
+        desc_.n = n_;
+        desc_.split_dimension = split_dim_;
+        for (const auto &md : original_dsts_)
+            desc_.dst_mds.push_back(&md);
+    }
+};
+// NOLINTEND(google-default-arguments)
+
+#define DECLARE_SPLIT_PD_t(impl_name, ...) \
+    static status_t create(split_pd_t **split_pd, \
+            dnnl::impl::engine_t *engine, const primitive_attr_t *attr, \
+            const memory_desc_t *src_md, int n, int split_dim, \
+            const memory_desc_t *const *dst_mds) { \
+        using namespace status; \
+        auto _pd = make_unique_pd<pd_t>(attr, src_md, n, split_dim, dst_mds); \
+        if (_pd == nullptr) return out_of_memory; \
+        CHECK(_pd->init(engine)); \
+        CHECK(_pd->init_scratchpad_md()); \
+        return safe_ptr_assign(*split_pd, _pd.release()); \
+    } \
+    status_t create_primitive( \
+            std::pair<std::shared_ptr<impl::primitive_t>, cache_state_t> \
+                    &primitive, \
+            dnnl::impl::engine_t *engine, const cache_blob_t &cache_blob, \
+            bool force_create_from_blob) const override { \
+        return primitive_t::create_primitive_common<__VA_ARGS__, pd_t>( \
+                primitive, this, engine, false, cache_blob, \
+                force_create_from_blob); \
+    } \
+    pd_t *clone() const override { \
+        auto new_pd = utils::make_unique<pd_t>(*this); \
+        if (!new_pd->is_initialized()) return nullptr; \
+        return new_pd.release(); \
+    } \
+    const char *name() const override { return impl_name; }
+
+#define DECLARE_SPLIT_PD_T(impl_name, ...) \
+    DECLARE_SPLIT_PD_t(impl_name, __VA_ARGS__)
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
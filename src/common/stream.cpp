@@ -37,6 +37,29 @@ status_t stream_t::enqueue_primitive(
     return primitive_iface->execute(ctx);
 }
 
+status_t stream_t::enqueue_task(const std::function<status_t()> &task,
+        const std::function<void(status_t)> &on_drop) {
+    UNUSED(on_drop);
+    return task();
+}
+
+const memory_storage_t *stream_t::get_scratchpad_arena(size_t size) {
+    if (!(flags() & stream_flags::in_order)) return nullptr;
+    if (size <= scratchpad_arena_size_) return scratchpad_arena_.get();
+
+    // Previously submitted primitives may still use the buffer.
+    if (scratchpad_arena_ && wait() != success) return nullptr;
+    scratchpad_arena_.reset();
+    scratchpad_arena_size_ = 0;
+
+    memory_storage_t *mem_storage = nullptr;
+    status_t status = engine()->create_memory_storage(&mem_storage, size);
+    if (status != success) return nullptr;
+    scratchpad_arena_.reset(mem_storage);
+    scratchpad_arena_size_ = size;
+    return scratchpad_arena_.get();
+}
+
 /* API */
 
 status_t dnnl_stream_create(
@@ -62,7 +85,9 @@ status_t dnnl_stream_wait(stream_t *stream) {
     bool args_ok = !any_null(stream);
     if (!args_ok) return invalid_arguments;
 
-    return stream->wait();
+    CHECK(stream->wait());
+    stream->memory_pool()->notify_wait();
+    return success;
 }
 
 status_t dnnl_stream_destroy(stream_t *stream) {
@@ -18,17 +18,25 @@
 #define COMMON_STREAM_HPP
 
 #include <assert.h>
+#include <functional>
+#include <memory>
+
 #include "oneapi/dnnl/dnnl.h"
 #include "oneapi/dnnl/dnnl_threadpool_iface.hpp"
 
 #include "common/c_types_map.hpp"
 #include "common/engine.hpp"
+#include "common/memory_storage.hpp"
+#include "common/stream_capture.hpp"
 #include "common/stream_impl.hpp"
+#include "common/stream_memory_pool.hpp"
 #include "common/utils.hpp"
 
 struct dnnl_stream : public dnnl::impl::c_compatible {
     dnnl_stream(dnnl::impl::engine_t *engine, dnnl::impl::stream_impl_t *impl)
-        : engine_(engine), impl_(impl) {}
+        : engine_(engine)
+        , impl_(impl)
+        , memory_pool_(new dnnl::impl::stream_memory_pool_t(this)) {}
     virtual ~dnnl_stream() = default;
 
     /** returns stream's engine */
@@ -45,6 +53,15 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
             const primitive_iface_t *primitive_iface,
             dnnl::impl::exec_ctx_t &ctx);
 
+    /** runs a host task after the work submitted to the stream before it,
+     * the task may run asynchronously on non-blocking streams. If the task is
+     * skipped because a preceding execution failed, `on_drop` is called with
+     * the failed status instead. */
+    virtual dnnl::impl::status_t enqueue_task(
+            const std::function<dnnl::impl::status_t()> &task,
+            const std::function<void(dnnl::impl::status_t)> &on_drop
+            = nullptr);
+
     /** blocks until all submitted primitives to the stream are completed */
     virtual dnnl::impl::status_t wait() = 0;
 
@@ -65,6 +82,15 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
         return dnnl::impl::status::unimplemented;
     }
 
+    // Returns the sum of the device kernel durations of the last primitive
+    // execution on a stream with profiling enabled.
+    virtual dnnl::impl::status_t get_last_exec_kernel_time(
+            uint64_t *nsec) const {
+        if (!is_profiling_enabled())
+            return dnnl::impl::status::invalid_arguments;
+        return dnnl::impl::status::unimplemented;
+    }
+
     virtual dnnl::impl::status_t notify_profiling_complete() const {
         if (!is_profiling_enabled())
             return dnnl::impl::status::invalid_arguments;
@@ -78,6 +104,50 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
 
     dnnl::impl::stream_impl_t *impl() { return impl_.get(); }
 
+    /** returns a stream-local scratchpad buffer of at least `size` bytes
+     *
+     * The buffer serves primitives created with the user scratchpad mode and
+     * executed without a DNNL_ARG_SCRATCHPAD argument. It is shared by all
+     * such primitives executed on the stream, which is safe because the
+     * execution is ordered. Returns `nullptr` for out-of-order streams or
+     * if the allocation fails. */
+    const dnnl::impl::memory_storage_t *get_scratchpad_arena(size_t size);
+
+    /** returns the pool of library-owned buffers used by the stream work */
+    dnnl::impl::stream_memory_pool_t *memory_pool() const {
+        return memory_pool_.get();
+    }
+
+    /** returns true if the primitive executions can be recorded */
+    virtual bool is_capture_supported() const {
+        return engine_->kind() == dnnl::impl::engine_kind::cpu;
+    }
+
+    /** records the primitive executions of `capture` into a graph of the
+     * device runtime, which the next replays launch instead of executing the
+     * primitives. Returns `unimplemented` if the runtime has no such graphs
+     * or some of the executions cannot be recorded. */
+    virtual dnnl::impl::status_t create_capture_graph(
+            const dnnl::impl::stream_capture_t &capture,
+            std::unique_ptr<dnnl::impl::stream_capture_graph_t> &graph) {
+        return dnnl::impl::status::unimplemented;
+    }
+
+    /** returns the active capture or `nullptr` if the stream isn't recorded */
+    dnnl::impl::stream_capture_t *capture() const { return capture_.get(); }
+
+    dnnl::impl::status_t begin_capture() {
+        if (capture_) return dnnl::impl::status::invalid_arguments;
+        capture_.reset(new dnnl::impl::stream_capture_t(this));
+        return dnnl::impl::status::success;
+    }
+
+    dnnl::impl::status_t end_capture(dnnl::impl::stream_capture_t **capture) {
+        if (!capture_) return dnnl::impl::status::invalid_arguments;
+        *capture = capture_.release();
+        return dnnl::impl::status::success;
+    }
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     dnnl::impl::status_t get_threadpool(
             dnnl::threadpool_interop::threadpool_iface **threadpool) const {
@@ -91,6 +161,12 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
 protected:
     dnnl::impl::engine_t *engine_;
     std::unique_ptr<dnnl::impl::stream_impl_t> impl_;
+
+private:
+    std::unique_ptr<dnnl::impl::memory_storage_t> scratchpad_arena_;
+    size_t scratchpad_arena_size_ = 0;
+    std::unique_ptr<dnnl::impl::stream_capture_t> capture_;
+    std::unique_ptr<dnnl::impl::stream_memory_pool_t> memory_pool_;
 };
 
 #endif
@@ -0,0 +1,99 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/c_types_map.hpp"
+#include "common/engine.hpp"
+#include "common/primitive_iface.hpp"
+#include "common/stream.hpp"
+#include "common/stream_capture.hpp"
+#include "common/utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+
+dnnl_stream_capture::~dnnl_stream_capture() {
+    graph_.reset();
+    for (auto &e : entries_)
+        e.primitive_iface->release();
+}
+
+status_t dnnl_stream_capture::record(
+        const primitive_iface_t *primitive_iface, const exec_args_t &args) {
+    // The capture shares the ownership of the primitive, similar to a user
+    // primitive handle.
+    auto *p_iface = const_cast<primitive_iface_t *>(primitive_iface);
+    exec_args_t args_copy(args);
+    std::unique_ptr<exec_ctx_t> ctx(
+            new exec_ctx_t(stream_, std::move(args_copy)));
+    p_iface->retain();
+    entries_.push_back({p_iface, std::move(ctx)});
+    return success;
+}
+
+status_t dnnl_stream_capture::replay(stream_t *stream) const {
+    if (stream != stream_ || stream->capture() != nullptr)
+        return invalid_arguments;
+
+    status_t status = success;
+    stream->before_exec_hook();
+    if (!graph_tried_) {
+        graph_tried_ = true;
+        // The executions are only recorded, not run, when the graph is
+        // created. If the stream cannot record them, they are replayed one
+        // by one from now on.
+        if (stream->create_capture_graph(*this, graph_) != success)
+            graph_.reset();
+    }
+    status = graph_ ? graph_->launch(stream) : execute_entries();
+    stream->after_exec_hook();
+    return status;
+}
+
+status_t dnnl_stream_capture::execute_entries() const {
+    for (const auto &e : entries_)
+        CHECK(primitive_execute(e.primitive_iface, *e.ctx));
+    return success;
+}
+
+/* API */
+
+status_t dnnl_stream_begin_capture(stream_t *stream) {
+    if (any_null(stream)) return invalid_arguments;
+    if (!stream->is_capture_supported()) return unimplemented;
+    return stream->begin_capture();
+}
+
+status_t dnnl_stream_end_capture(
+        stream_t *stream, stream_capture_t **capture) {
+    if (any_null(stream, capture)) return invalid_arguments;
+    return stream->end_capture(capture);
+}
+
+status_t dnnl_stream_capture_replay(
+        const stream_capture_t *capture, stream_t *stream) {
+    if (any_null(capture, stream)) return invalid_arguments;
+    return capture->replay(stream);
+}
+
+status_t dnnl_stream_capture_destroy(stream_capture_t *capture) {
+    delete capture;
+    return success;
+}
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
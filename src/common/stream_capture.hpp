@@ -0,0 +1,84 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_STREAM_CAPTURE_HPP
+#define COMMON_STREAM_CAPTURE_HPP
+
+#include <memory>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_exec_types.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// The primitive executions of a capture recorded into a graph of the device
+// runtime, such as a CUDA graph, which is launched as a whole.
+struct stream_capture_graph_t {
+    virtual ~stream_capture_graph_t() = default;
+    virtual status_t launch(stream_t *stream) = 0;
+};
+
+} // namespace impl
+} // namespace dnnl
+
+// A sequence of primitive executions recorded on a stream. Each entry keeps
+// a fully constructed execution context, so a replay goes straight to the
+// stream enqueue and skips the argument conversion and validation done by
+// dnnl_primitive_execute().
+//
+// If the stream supports it, the first replay also records the executions
+// into a device graph, and the next replays launch the graph instead.
+struct dnnl_stream_capture : public dnnl::impl::c_compatible {
+    dnnl_stream_capture(dnnl::impl::stream_t *stream) : stream_(stream) {}
+    ~dnnl_stream_capture();
+
+    dnnl::impl::stream_t *stream() const { return stream_; }
+
+    size_t size() const { return entries_.size(); }
+    const primitive_iface_t *primitive_iface(size_t idx) const {
+        return entries_[idx].primitive_iface;
+    }
+
+    dnnl::impl::status_t record(const primitive_iface_t *primitive_iface,
+            const dnnl::impl::exec_args_t &args);
+    dnnl::impl::status_t replay(dnnl::impl::stream_t *stream) const;
+
+    // Executes the recorded primitives one by one.
+    dnnl::impl::status_t execute_entries() const;
+
+private:
+    struct entry_t {
+        primitive_iface_t *primitive_iface;
+        std::unique_ptr<dnnl::impl::exec_ctx_t> ctx;
+    };
+
+    dnnl::impl::stream_t *stream_;
+    std::vector<entry_t> entries_;
+    // Device graph of the executions, created at the first replay.
+    mutable std::unique_ptr<dnnl::impl::stream_capture_graph_t> graph_;
+    mutable bool graph_tried_ = false;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_stream_capture);
+};
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,160 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+
+#include "common/engine.hpp"
+#include "common/stream.hpp"
+#include "common/stream_memory_pool.hpp"
+
+namespace dnnl {
+namespace impl {
+
+namespace {
+
+std::atomic<size_t> &stream_memory_pool_limit_value() {
+    static std::atomic<size_t> limit {
+            getenv_size_user("GPU_MEMORY_POOL_LIMIT", size_t(1) << 30)};
+    return limit;
+}
+
+// Rounds the size up to one of four classes per power of two, so that
+// requests of slightly different sizes share buffers. The overhead is at
+// most 25%.
+size_t round_up_to_size_class(size_t size) {
+    const size_t min_step = 4096;
+    if (size <= min_step) return min_step;
+    size_t pow2 = min_step;
+    while (pow2 <= size / 2)
+        pow2 *= 2;
+    return utils::rnd_up(size, std::max(min_step, pow2 / 4));
+}
+
+} // namespace
+
+void get_stream_memory_pool_stats(
+        stream_t *stream, stream_memory_pool_stats_t *stats) {
+    if (!stream || !stats) return;
+    stream->memory_pool()->get_stats(stats);
+}
+
+size_t stream_memory_pool_limit() {
+    return stream_memory_pool_limit_value().load();
+}
+
+size_t set_stream_memory_pool_limit(size_t limit) {
+    return stream_memory_pool_limit_value().exchange(limit);
+}
+
+memory_storage_t *stream_memory_pool_t::acquire(size_t size) {
+    const size_t size_class = round_up_to_size_class(size);
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    // Larger buffers are taken only if the memory overhead stays within 2x.
+    auto it = free_.lower_bound(size_class);
+    if (it != free_.end() && it->first <= 2 * size_class) {
+        auto *storage = it->second.get();
+        cached_bytes_ -= it->first;
+        in_use_.emplace(
+                storage, std::make_pair(it->first, std::move(it->second)));
+        free_.erase(it);
+        stats_.n_reuses++;
+        return storage;
+    }
+
+    memory_storage_t *storage = nullptr;
+    status_t status
+            = stream_->engine()->create_memory_storage(&storage, size_class);
+    if (status != status::success) return nullptr;
+    in_use_.emplace(storage,
+            std::make_pair(
+                    size_class, std::unique_ptr<memory_storage_t>(storage)));
+    stats_.n_allocations++;
+    return storage;
+}
+
+void stream_memory_pool_t::release(memory_storage_t *storage) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = in_use_.find(storage);
+    assert(it != in_use_.end());
+    if (it == in_use_.end()) return;
+
+    const size_t size = it->second.first;
+    if (hold_) {
+        held_.push_back(std::move(it->second.second));
+        in_use_.erase(it);
+        return;
+    }
+    if (stream_->flags() & stream_flags::in_order) {
+        free_.emplace(size, std::move(it->second.second));
+        cached_bytes_ += size;
+    } else {
+        pending_.emplace_back(size, std::move(it->second.second));
+    }
+    in_use_.erase(it);
+
+    trim(stream_memory_pool_limit(), /* is_idle = */ false);
+}
+
+void stream_memory_pool_t::notify_wait() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    for (auto &p : pending_) {
+        cached_bytes_ += p.first;
+        free_.emplace(p.first, std::move(p.second));
+    }
+    pending_.clear();
+
+    trim(stream_memory_pool_limit(), /* is_idle = */ true);
+}
+
+void stream_memory_pool_t::begin_hold() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    hold_ = true;
+}
+
+std::vector<std::unique_ptr<memory_storage_t>>
+stream_memory_pool_t::end_hold() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    hold_ = false;
+    auto held = std::move(held_);
+    held_.clear();
+    return held;
+}
+
+void stream_memory_pool_t::get_stats(stream_memory_pool_stats_t *stats) {
+    if (!stats) return;
+    std::lock_guard<std::mutex> guard(mutex_);
+    *stats = stats_;
+    stats->cached_bytes = cached_bytes_;
+}
+
+void stream_memory_pool_t::trim(size_t limit, bool is_idle) {
+    if (cached_bytes_ <= limit) return;
+
+    // Work submitted earlier may still use the cached buffers.
+    if (!is_idle && stream_->wait() != status::success) return;
+    while (cached_bytes_ > limit && !free_.empty()) {
+        auto it = std::prev(free_.end());
+        cached_bytes_ -= it->first;
+        free_.erase(it);
+        stats_.n_trims++;
+    }
+}
+
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
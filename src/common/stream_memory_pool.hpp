@@ -0,0 +1,110 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_STREAM_MEMORY_POOL_HPP
+#define COMMON_STREAM_MEMORY_POOL_HPP
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_storage.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// Undocumented API for testing.
+struct stream_memory_pool_stats_t {
+    // Number of buffers allocated through the engine.
+    size_t n_allocations;
+    // Number of requests served by a cached buffer.
+    size_t n_reuses;
+    // Number of cached buffers released to stay within the limit.
+    size_t n_trims;
+    // Total size of the buffers cached by the pool.
+    size_t cached_bytes;
+};
+
+void DNNL_API get_stream_memory_pool_stats(
+        stream_t *stream, stream_memory_pool_stats_t *stats);
+
+// Returns the limit of cached bytes per stream. A zero limit disables the
+// pool.
+size_t stream_memory_pool_limit();
+// Returns the previous limit.
+size_t DNNL_API set_stream_memory_pool_limit(size_t limit);
+
+// Caching allocator for library-owned memory used by the work submitted to
+// a stream, such as GPU primitive scratchpads.
+//
+// Requests are rounded up to size classes. A buffer is returned to the pool
+// right after the work using it has been submitted: on an in-order stream
+// it can be reused at once as later work is executed after that work, on an
+// out-of-order stream it becomes reusable when the stream is waited on. When
+// the cached bytes exceed the limit, the pool waits for the stream and
+// releases the largest cached buffers.
+struct stream_memory_pool_t {
+    stream_memory_pool_t(stream_t *stream) : stream_(stream) {}
+
+    // Returns a buffer of at least `size` bytes or `nullptr` if the
+    // allocation fails.
+    memory_storage_t *acquire(size_t size);
+    void release(memory_storage_t *storage);
+
+    // Makes the buffers released on an out-of-order stream reusable. Called
+    // once the stream has completed all submitted work.
+    void notify_wait();
+
+    void get_stats(stream_memory_pool_stats_t *stats);
+
+    // Keeps the buffers released from now on out of the pool until
+    // end_hold(), which hands them over to the caller. Used when the work is
+    // recorded into a device graph that keeps using the buffers.
+    void begin_hold();
+    std::vector<std::unique_ptr<memory_storage_t>> end_hold();
+
+private:
+    void trim(size_t limit, bool is_idle);
+
+    stream_t *stream_;
+    std::mutex mutex_;
+    // Cached buffers by size.
+    std::multimap<size_t, std::unique_ptr<memory_storage_t>> free_;
+    // Buffers released on an out-of-order stream, by size.
+    std::vector<std::pair<size_t, std::unique_ptr<memory_storage_t>>>
+            pending_;
+    // Acquired buffers with their sizes.
+    std::unordered_map<memory_storage_t *,
+            std::pair<size_t, std::unique_ptr<memory_storage_t>>>
+            in_use_;
+    size_t cached_bytes_ = 0;
+    bool hold_ = false;
+    std::vector<std::unique_ptr<memory_storage_t>> held_;
+    stream_memory_pool_stats_t stats_ = {};
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(stream_memory_pool_t);
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -53,7 +53,14 @@ status_t sum_primitive_desc_create(primitive_desc_iface_t **sum_pd_iface,
             VERBOSE_NULL_ARG);
 
     if (attr == nullptr) attr = &default_attr();
-    VCHECK_SUM_UNIMPL(attr->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    // Only the rounding mode of the destination is supported.
+    using smask_t = primitive_attr_t::skip_mask_t;
+    VCHECK_SUM_UNIMPL(attr->has_default_values(smask_t::rounding_mode),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VCHECK_SUM_UNIMPL(attr->rounding_mode_.has_default_values(DNNL_ARG_DIFF_SRC)
+                    && attr->rounding_mode_.has_default_values(
+                            DNNL_ARG_DIFF_WEIGHTS),
+            VERBOSE_UNSUPPORTED_ATTR);
 
     const int ndims = src_mds[0]->ndims;
     const dims_t &dims = src_mds[0]->dims;
@@ -97,6 +104,7 @@ status_t sum_primitive_desc_create(primitive_desc_iface_t **sum_pd_iface,
     }
 
     auto desc = sum_desc_t(primitive_kind::sum, dst_md, n, scales, src_mds);
+    max_threads_limit_guard_t max_threads_guard(attr->max_threads_);
     primitive_hashing::key_t key(
             engine, reinterpret_cast<op_desc_t *>(&desc), attr, 0, {}, -1);
     auto pd = primitive_cache().get_pd(key);
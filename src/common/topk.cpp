@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2020-2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+#include "opdesc.hpp"
+#include "primitive_desc_iface.hpp"
+
+#include "c_types_map.hpp"
+#include "topk_pd.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+
+#define VCHECK_TOPK(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, topk, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__);
+
+#define VCHECK_TOPK_UNIMPL(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, topk, (cond), \
+            status::unimplemented, msg, ##__VA_ARGS__);
+namespace dnnl {
+namespace impl {
+
+status_t topk_desc_init(topk_desc_t *topk_desc, const memory_desc_t *src_desc,
+        const memory_desc_t *dst_desc, const memory_desc_t *indices_desc,
+        int axis) {
+
+    VCHECK_TOPK(!any_null(src_desc, dst_desc, indices_desc), VERBOSE_NULL_ARG);
+    VCHECK_TOPK(!memory_desc_wrapper(src_desc).has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    const int ndims = src_desc->ndims;
+    VCHECK_TOPK(0 <= axis && axis < ndims, VERBOSE_BAD_AXIS);
+    VCHECK_TOPK(dst_desc->ndims == ndims, VERBOSE_INCONSISTENT_NDIMS, "src",
+            "dst");
+    VCHECK_TOPK(indices_desc->ndims == ndims, VERBOSE_INCONSISTENT_NDIMS,
+            "src", "indices");
+
+    for (int d = 0; d < ndims; ++d) {
+        VCHECK_TOPK(dst_desc->dims[d] == indices_desc->dims[d],
+                VERBOSE_INCONSISTENT_DIM, "dst", d, "indices", d);
+        if (d == axis) continue;
+        VCHECK_TOPK(dst_desc->dims[d] == src_desc->dims[d],
+                VERBOSE_INCONSISTENT_DIM, "src", d, "dst", d);
+    }
+    // The number of selected elements is defined by the destination.
+    const dim_t k = dst_desc->dims[axis];
+    VCHECK_TOPK(0 < k && k <= src_desc->dims[axis], VERBOSE_BAD_PARAM, "k");
+
+    VCHECK_TOPK(indices_desc->data_type == data_type::s32,
+            VERBOSE_INVALID_DATATYPE, "indices");
+
+    VCHECK_TOPK(src_desc->format_kind == format_kind::blocked,
+            VERBOSE_UNSUPPORTED_TAG_S, "src");
+    VCHECK_TOPK(one_of(dst_desc->format_kind, format_kind::blocked,
+                        format_kind::any),
+            VERBOSE_UNSUPPORTED_TAG_S, "dst");
+    VCHECK_TOPK(one_of(indices_desc->format_kind, format_kind::blocked,
+                        format_kind::any),
+            VERBOSE_UNSUPPORTED_TAG_S, "indices");
+
+    VCHECK_TOPK(src_desc->extra.flags == 0, VERBOSE_UNSUPPORTED_MD_FLAG,
+            "src");
+
+    auto td = topk_desc_t();
+    td.primitive_kind = primitive_kind::topk;
+    td.src_desc = *src_desc;
+    td.dst_desc = *dst_desc;
+    td.indices_desc = *indices_desc;
+    td.axis = axis;
+
+    (*topk_desc) = td;
+    return success;
+}
+
+status_t topk_attr_check(const topk_desc_t &desc, const engine_t *engine,
+        const primitive_attr_t *attr) {
+    if (attr == nullptr) return status::success;
+
+    // Only the scratchpad mode is supported.
+    VCHECK_TOPK_UNIMPL(attr->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+
+    return status::success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+dnnl_status_t dnnl_topk_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        const memory_desc_t *src_desc, const memory_desc_t *dst_desc,
+        const memory_desc_t *indices_desc, int axis,
+        const primitive_attr_t *attr) {
+
+    auto topk_desc = topk_desc_t();
+    CHECK(topk_desc_init(&topk_desc, src_desc, dst_desc, indices_desc, axis));
+    CHECK(topk_attr_check(topk_desc, engine, attr));
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&topk_desc, nullptr, attr);
+}
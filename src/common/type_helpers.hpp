@@ -39,6 +39,10 @@ namespace impl {
 // Global zero memory descriptor. Mostly used for queries to return
 extern memory_desc_t DNNL_API glob_zero_md;
 
+// Single-element f32 memory descriptor of the destination absolute maximum
+// and of the secondary destination scale.
+extern const memory_desc_t glob_amax_md;
+
 template <typename base_type, typename derived_type>
 status_t safe_ptr_assign(base_type *&lhs, derived_type *rhs) {
     if (rhs == nullptr) return status::out_of_memory;
@@ -335,8 +339,8 @@ inline bool blocking_desc_is_equal(const memory_desc_t &lhs_md,
 
     auto is_sparse_packed_desc = [](const memory_desc_t &md) {
         return md.format_kind == format_kind::sparse
-                && md.format_desc.sparse_desc.encoding
-                == sparse_encoding::packed;
+                && utils::one_of(md.format_desc.sparse_desc.encoding,
+                        sparse_encoding::packed, sparse_encoding::packed_2_4);
     };
 
     const bool lhs_is_sparse_packed_desc = is_sparse_packed_desc(lhs_md);
@@ -405,6 +409,8 @@ inline bool sparse_desc_is_equal(
 
     for (int i = 0; i < sparse_desc_t::max_metadata_types; i++)
         ok = ok && lhs.metadata_types[i] == rhs.metadata_types[i];
+    for (int i = 0; i < sparse_desc_t::max_block_ndims; i++)
+        ok = ok && lhs.block_dims[i] == rhs.block_dims[i];
 
     return ok;
 }
@@ -683,6 +689,53 @@ inline bool operator==(const concat_desc_t &lhs, const concat_desc_t &rhs) {
     return ret;
 }
 
+inline bool operator==(const gather_desc_t &lhs, const gather_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(alg_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(indices_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc);
+    return ret;
+}
+
+inline bool operator==(const topk_desc_t &lhs, const topk_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_DESC_MEMBERS(indices_desc)
+            && COMPARE_DESC_MEMBERS(axis);
+    return ret;
+}
+
+inline bool operator==(
+        const optimizer_desc_t &lhs, const optimizer_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(alg_kind)
+            && COMPARE_DESC_MEMBERS(grad_desc)
+            && COMPARE_DESC_MEMBERS(param_desc)
+            && COMPARE_DESC_MEMBERS(master_desc)
+            && COMPARE_FLOAT_DESC_MEMBERS(momentum)
+            && COMPARE_FLOAT_DESC_MEMBERS(beta2)
+            && COMPARE_FLOAT_DESC_MEMBERS(epsilon)
+            && COMPARE_FLOAT_DESC_MEMBERS(weight_decay);
+    return ret;
+}
+
+inline bool operator==(const split_desc_t &lhs, const split_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && DEREF_AND_COMPARE_DESC_MEMBERS(src_md)
+            && COMPARE_DESC_MEMBERS(n)
+            && COMPARE_DESC_MEMBERS(split_dimension);
+
+    if (!ret) return ret;
+
+    for (int i = 0; i < lhs.n; i++) {
+        ret = *lhs.dst_mds[i] == *rhs.dst_mds[i];
+        if (!ret) break;
+    }
+    return ret;
+}
+
 // This function can only be used to compare the opdescs in the primitive cache.
 // For comparing the opdescs outside the primitive cache please use the regular
 // comparison operator (==).
@@ -824,6 +877,7 @@ inline bool operator==(const matmul_desc_t &lhs, const matmul_desc_t &rhs) {
             && COMPARE_DESC_MEMBERS(bias_desc)
             && COMPARE_DESC_MEMBERS(dst_desc)
             && COMPARE_DESC_MEMBERS(reduce_desc)
+            && COMPARE_DESC_MEMBERS(group_offsets_desc)
             && COMPARE_DESC_MEMBERS(reduce_kind)
             && COMPARE_DESC_MEMBERS(accum_data_type);
     return ret;
@@ -945,7 +999,10 @@ inline bool operator==(
             && COMPARE_DESC_MEMBERS(diff_src_desc)
             && COMPARE_DESC_MEMBERS(dst_desc)
             && COMPARE_DESC_MEMBERS(diff_dst_desc)
-            && COMPARE_DESC_MEMBERS(softmax_axis);
+            && COMPARE_DESC_MEMBERS(softmax_axis)
+            && COMPARE_DESC_MEMBERS(with_scale)
+            && COMPARE_DESC_MEMBERS(mask_type)
+            && COMPARE_DESC_MEMBERS(mask_desc);
      return ret;
 }
 
@@ -985,11 +1042,20 @@ inline bool operator==(const sdpa_desc_t &lhs, const sdpa_desc_t &rhs) {
             && COMPARE_DESC_MEMBERS(vs_zero_points)
             && COMPARE_DESC_MEMBERS(dst_desc)
             && COMPARE_DESC_MEMBERS(attn_mask_desc)
+            && COMPARE_DESC_MEMBERS(prop_kind)
+            && COMPARE_DESC_MEMBERS(stats_desc)
+            && COMPARE_DESC_MEMBERS(diff_q_desc)
+            && COMPARE_DESC_MEMBERS(diff_k_desc)
+            && COMPARE_DESC_MEMBERS(diff_v_desc)
+            && COMPARE_DESC_MEMBERS(diff_dst_desc)
             && COMPARE_DESC_MEMBERS(scale_dt)
             && COMPARE_DESC_MEMBERS(invert_scale)
             && COMPARE_DESC_MEMBERS(kv_head_number)
             && COMPARE_DESC_MEMBERS(mask_type)
-            && COMPARE_DESC_MEMBERS(softmax_alg);
+            && COMPARE_DESC_MEMBERS(softmax_alg)
+            && COMPARE_DESC_MEMBERS(window_size)
+            && COMPARE_FLOAT_DESC_MEMBERS(alibi_max_bias)
+            && COMPARE_FLOAT_DESC_MEMBERS(softcap);
     return ret;
 }
 
@@ -1008,13 +1074,13 @@ inline bool is_dense_format_kind(
     return true;
 }
 
-inline memory_desc_t cvt_blocked2sparse_packed(
-        const memory_desc_t &blocked_md, dim_t nnz) {
+inline memory_desc_t cvt_blocked2sparse_packed(const memory_desc_t &blocked_md,
+        dim_t nnz, sparse_encoding_t encoding = sparse_encoding::packed) {
     if (blocked_md.format_kind != format_kind::blocked) return glob_zero_md;
 
     auto sparse_packed_md = blocked_md;
     sparse_packed_md.format_kind = format_kind::sparse;
-    sparse_packed_md.format_desc.sparse_desc.encoding = sparse_encoding::packed;
+    sparse_packed_md.format_desc.sparse_desc.encoding = encoding;
     sparse_packed_md.format_desc.sparse_desc.nnz = nnz;
     sparse_packed_md.format_desc.sparse_desc.packed_desc
             = blocked_md.format_desc.blocking;
@@ -1024,8 +1090,8 @@ inline memory_desc_t cvt_blocked2sparse_packed(
 inline memory_desc_t cvt_sparse_packed2blocked(
         const memory_desc_t &sparse_packed_md) {
     if (sparse_packed_md.format_kind != format_kind::sparse
-            || sparse_packed_md.format_desc.sparse_desc.encoding
-                    != sparse_encoding::packed)
+            || !utils::one_of(sparse_packed_md.format_desc.sparse_desc.encoding,
+                    sparse_encoding::packed, sparse_encoding::packed_2_4))
         return glob_zero_md;
 
     const blocking_desc_t &blk_desc
@@ -1118,10 +1184,13 @@ inline status_t memory_desc_init_by_tag(
         return status::invalid_arguments;
 
     if (is_sparse) {
-        if (md.format_desc.sparse_desc.encoding != sparse_encoding::packed
+        const auto encoding = md.format_desc.sparse_desc.encoding;
+        if (!utils::one_of(encoding, sparse_encoding::packed,
+                    sparse_encoding::packed_2_4)
                 || md.offset0 != 0)
             return status::invalid_arguments;
-        md = cvt_blocked2sparse_packed(md_tmp, md.format_desc.sparse_desc.nnz);
+        md = cvt_blocked2sparse_packed(
+                md_tmp, md.format_desc.sparse_desc.nnz, encoding);
     } else {
         md = md_tmp;
     }
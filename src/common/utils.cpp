@@ -30,6 +30,7 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <climits>
 #include <cstdio>
 #include <cstdlib>
@@ -44,6 +45,7 @@
 #include "verbose.hpp"
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+#include "cpu/cpu_affinity.hpp"
 #include "cpu/platform.hpp"
 #endif
 
@@ -125,6 +127,32 @@ std::string getenv_string_user(const char *name) {
     return value;
 }
 
+size_t getenv_size_user(const char *name, size_t default_value) {
+    const int len = 32;
+    char value_str[len];
+    for (const auto &prefix : {"ONEDNN_", "DNNL_"}) {
+        std::string name_str = std::string(prefix) + std::string(name);
+        if (getenv(name_str.c_str(), value_str, len) <= 0) continue;
+
+        char *end = nullptr;
+        const unsigned long long value = strtoull(value_str, &end, 10);
+        if (end == value_str) return default_value;
+        size_t multiplier = 1;
+        switch (*end) {
+            case '\0': break;
+            case 'k':
+            case 'K': multiplier = size_t(1) << 10; break;
+            case 'm':
+            case 'M': multiplier = size_t(1) << 20; break;
+            case 'g':
+            case 'G': multiplier = size_t(1) << 30; break;
+            default: return default_value;
+        }
+        return (size_t)value * multiplier;
+    }
+    return default_value;
+}
+
 status_t check_for_symlinks(const char *filename, bool *res) {
 #ifdef _WIN32
     DWORD attr = GetFileAttributes(filename);
@@ -230,6 +258,16 @@ bool get_jit_dump() {
     return jit_dump.get();
 }
 
+static setting_t<bool> jit_lazy_kernels {false};
+bool get_jit_lazy_kernels() {
+    if (!jit_lazy_kernels.initialized()) {
+        static bool val
+                = getenv_int_user("JIT_LAZY_KERNELS", jit_lazy_kernels.get());
+        jit_lazy_kernels.set(val);
+    }
+    return jit_lazy_kernels.get();
+}
+
 #if defined(DNNL_AARCH64) && (DNNL_AARCH64 == 1)
 static setting_t<unsigned> jit_profiling_flags {DNNL_JIT_PROFILE_LINUX_PERFMAP};
 #else
@@ -344,6 +382,42 @@ bool is_destroying_cache_safe() {
 #endif
 }
 
+namespace {
+std::atomic<int> &dynamic_nd_schedule() {
+    static std::atomic<int> dynamic([] {
+        const std::string mode = getenv_string_user("PARALLEL_ND_SCHEDULE");
+        if (mode == "static") return 0;
+        if (mode == "dynamic") return 1;
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+        return cpu::platform::is_hybrid() ? 1 : 0;
+#else
+        return 0;
+#endif
+    }());
+    return dynamic;
+}
+} // namespace
+
+namespace {
+thread_local int max_threads_limit = 0;
+} // namespace
+
+int DNNL_API get_max_threads_limit() {
+    return max_threads_limit;
+}
+
+void DNNL_API set_max_threads_limit(int limit) {
+    max_threads_limit = limit;
+}
+
+bool DNNL_API use_dynamic_nd_schedule() {
+    return dynamic_nd_schedule().load(std::memory_order_relaxed) == 1;
+}
+
+bool DNNL_API set_dynamic_nd_schedule(bool dynamic) {
+    return dynamic_nd_schedule().exchange(dynamic ? 1 : 0) == 1;
+}
+
 } // namespace impl
 } // namespace dnnl
 
@@ -401,6 +475,14 @@ dnnl_status_t dnnl_set_cpu_isa_hints(dnnl_cpu_isa_hints_t isa_hints) {
     return status;
 }
 
+dnnl_status_t dnnl_set_cpu_affinity(const char *policy) {
+    auto status = dnnl::impl::status::unimplemented;
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    status = dnnl::impl::cpu::affinity::set_policy(policy);
+#endif
+    return status;
+}
+
 dnnl_cpu_isa_hints_t dnnl_get_cpu_isa_hints() {
     auto isa_hint = dnnl_cpu_isa_no_hints;
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
@@ -688,6 +688,34 @@ int getenv_int_user(const char *name, int default_value = 0);
 // prefix and checks both supported variants - with "ONEDNN_" (primary) and
 // "DNNL_" (secondary) prefixes.
 std::string getenv_string_user(const char *name);
+// Reads a size in bytes, with an optional K, M or G suffix, from user
+// environment. Takes a var name without prefix and checks both supported
+// variants - with "ONEDNN_" (primary) and "DNNL_" (secondary) prefixes.
+size_t getenv_size_user(const char *name, size_t default_value = 0);
+
+// Per-thread upper bound on the number of threads a primitive may use. A
+// value of 0 means no limit. Set for the duration of primitive descriptor
+// creation and primitive execution by max_threads_limit_guard_t.
+int DNNL_API get_max_threads_limit();
+void DNNL_API set_max_threads_limit(int limit);
+
+// Nested guards can only tighten the limit: the effective limit is the
+// minimum of the outer one and `limit`. The outer limit is restored on exit.
+struct max_threads_limit_guard_t {
+    explicit max_threads_limit_guard_t(int limit)
+        : old_limit_(get_max_threads_limit()) {
+        if (limit > 0 && (old_limit_ <= 0 || limit < old_limit_))
+            set_max_threads_limit(limit);
+    }
+    ~max_threads_limit_guard_t() { set_max_threads_limit(old_limit_); }
+
+    max_threads_limit_guard_t(const max_threads_limit_guard_t &) = delete;
+    max_threads_limit_guard_t &operator=(const max_threads_limit_guard_t &)
+            = delete;
+
+private:
+    int old_limit_;
+};
 
 // These are locale-invariant wrappers to define streaming objects for
 // string manipulation. Use these instead of the std library variants, namely,
@@ -728,6 +756,9 @@ private:
 
 // Various getter for profiling info
 bool get_jit_dump();
+// Rarely used kernel variants are generated on the first use instead of at
+// primitive creation. Supported by a subset of the implementations.
+bool get_jit_lazy_kernels();
 unsigned get_jit_profiling_flags();
 std::string get_jit_profiling_jitdumpdir();
 // Checks if the filepath is a valid path and not a symlink to ensure
@@ -15,6 +15,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <atomic>
 #include <regex>
 #include <sstream>
@@ -41,12 +42,14 @@
 #include "convolution_pd.hpp"
 #include "deconvolution_pd.hpp"
 #include "eltwise_pd.hpp"
+#include "gather_pd.hpp"
 #include "gemm_pd.hpp"
 #include "group_normalization_pd.hpp"
 #include "inner_product_pd.hpp"
 #include "layer_normalization_pd.hpp"
 #include "lrn_pd.hpp"
 #include "matmul_pd.hpp"
+#include "optimizer_pd.hpp"
 #include "pooling_pd.hpp"
 #include "prelu_pd.hpp"
 #include "reduction_pd.hpp"
@@ -56,7 +59,9 @@
 #include "sdpa_pd.hpp"
 #include "shuffle_pd.hpp"
 #include "softmax_pd.hpp"
+#include "split_pd.hpp"
 #include "sum_pd.hpp"
+#include "topk_pd.hpp"
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
 #include "common/dnnl_thread.hpp"
@@ -93,6 +98,12 @@ filter_status_t &filter_status() {
     return filter_status;
 }
 
+// Execution sampling is parsed together with the verbose flags.
+static verbose_sampling_t &verbose_sampling() {
+    static verbose_sampling_t verbose_sampling;
+    return verbose_sampling;
+}
+
 void print_header() noexcept {
     static std::atomic_flag version_printed = ATOMIC_FLAG_INIT;
     if (!version_printed.test_and_set()) {
@@ -161,6 +172,13 @@ void print_header() noexcept {
                     "common,error,filter format is ill-formed and is not "
                     "applied, error: %s\n",
                     filter_status().err_msg.c_str());
+        if (verbose_sampling().is_enabled())
+            verbose_printf(
+                    "common,info,exec sampling is enabled, every %llu "
+                    "executions, at most once per %g ms\n",
+                    (unsigned long long)std::max<uint64_t>(
+                            verbose_sampling().period, 1),
+                    verbose_sampling().interval_ms);
     }
 }
 
@@ -191,6 +209,8 @@ uint32_t get_verbose(verbose_t::flag_kind verbosity_kind,
                 k |= verbose_t::create_profile | verbose_t::exec_profile;
             if (s == "profile_create") k |= verbose_t::create_profile;
             if (s == "profile_exec") k |= verbose_t::exec_profile;
+            if (s == "profile_exec_device")
+                k |= verbose_t::exec_profile | verbose_t::exec_profile_device;
             // Enable profiling to external libraries
             if (s == "profile_externals") k |= verbose_t::profile_externals;
             if (s == "warn") k |= verbose_t::warn;
@@ -231,6 +251,10 @@ uint32_t get_verbose(verbose_t::flag_kind verbosity_kind,
                 REGEX_SEARCH(k, softmax, regexp);
                 REGEX_SEARCH(k, layer_normalization, regexp);
                 REGEX_SEARCH(k, group_normalization, regexp);
+                REGEX_SEARCH(k, split, regexp);
+                REGEX_SEARCH(k, gather, regexp);
+                REGEX_SEARCH(k, topk, regexp);
+                REGEX_SEARCH(k, optimizer, regexp);
                 REGEX_SEARCH(k, graph, regexp);
                 REGEX_SEARCH(k, gemm_api, regexp);
                 REGEX_SEARCH(k, ukernel, regexp);
@@ -267,6 +291,15 @@ uint32_t get_verbose(verbose_t::flag_kind verbosity_kind,
                 auto filter_str = tok.substr(7);
                 if (!filter_str.empty()) { flags = update_filter(filter_str); }
             }
+            // update exec sampling, invalid values disable it
+            if (tok.rfind("sample=", 0) == 0) {
+                const long long n = std::strtoll(tok.c_str() + 7, nullptr, 10);
+                verbose_sampling().period = n > 0 ? (uint64_t)n : 0;
+            }
+            if (tok.rfind("sample_ms=", 0) == 0) {
+                const double ms = std::strtod(tok.c_str() + 10, nullptr);
+                verbose_sampling().interval_ms = ms > 0 ? ms : 0;
+            }
             if (pos_en == std::string::npos) break;
         }
 
@@ -287,6 +320,12 @@ uint32_t get_verbose(verbose_t::flag_kind verbosity_kind,
     return filter_result ? result : 0;
 }
 
+const verbose_sampling_t &get_verbose_sampling() {
+    // Make sure the options are parsed.
+    get_verbose();
+    return verbose_sampling();
+}
+
 static setting_t<bool> verbose_timestamp {false};
 bool get_verbose_timestamp() {
 #if defined(DISABLE_VERBOSE)
@@ -360,12 +399,15 @@ std::string normalization_flags2str(unsigned flags) {
     if (flags & normalization_flags::fuse_norm_relu) s += "R";
     if (flags & normalization_flags::fuse_norm_add_relu) s += "A";
     if (flags & normalization_flags::rms_norm) s += "M";
+    if (flags & normalization_flags::fuse_residual_add) s += "S";
+    if (flags & normalization_flags::save_residual_sum) s += "W";
     return s;
 }
 
 std::string rnn_flags2str(unsigned flags) {
     std::string s;
     if (flags & rnn_flags::diff_weights_overwrite) s += "O";
+    if (flags & rnn_flags::seq_lengths) s += "L";
     return s;
 }
 
@@ -653,6 +695,9 @@ std::string get_arg(int arg) {
         case DNNL_ARG_SRC_2: s = "src"; break;
         case DNNL_ARG_DST: s = "dst"; break;
         case DNNL_ARG_WEIGHTS: s = "wei"; break;
+        case DNNL_ARG_DIFF_SRC: s = "diff_src"; break;
+        case DNNL_ARG_DIFF_DST: s = "diff_dst"; break;
+        case DNNL_ARG_DIFF_WEIGHTS: s = "diff_wei"; break;
         case DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_DST:
             s = "attr_post_op_dw_dst";
             break;
@@ -713,8 +758,6 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
         std::string delim = empty_delim;
         ss << field_delim() << "attr-rounding-mode:";
         for (const auto &e : rm.rounding_modes_map_) {
-            // TODO: add support for diff tensors in arg2str when
-            // support is added
             if (!rm.has_default_values(e.first))
                 ss << delim << arg2str(e.first) << ":"
                    << dnnl_rounding_mode2str(e.second);
@@ -727,6 +770,14 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
         ss << field_delim() << "attr-deterministic:" << deterministic;
     }
 
+    if (attr->max_threads_ > 0) {
+        ss << field_delim() << "attr-max-threads:" << attr->max_threads_;
+    }
+
+    if (attr->constant_quant_) {
+        ss << field_delim() << "attr-constant-quant:" << attr->constant_quant_;
+    }
+
     // Fast exit if rest attributes were not specified.
     if (attr->has_default_values()) return ss;
 
@@ -819,6 +870,22 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
             default: assert(!"unsupported format_kind");
         }
     }
+
+    if (attr->src_dyn_quant_dt_ != data_type::undef) {
+        ss << field_delim()
+           << "attr-src-dyn-quant:" << attr->src_dyn_quant_dt_;
+    }
+
+    if (attr->dst_amax_) ss << field_delim() << "attr-dst-amax";
+    if (attr->secondary_dst_dt_ != data_type::undef) {
+        ss << field_delim()
+           << "attr-secondary-dst:" << attr->secondary_dst_dt_;
+    }
+    if (attr->dst_dyn_quant_) ss << field_delim() << "attr-dst-dyn-quant";
+    if (attr->activation_stash_dt_ != data_type::undef) {
+        ss << field_delim()
+           << "attr-activation-stash:" << attr->activation_stash_dt_;
+    }
     return ss;
 }
 
@@ -910,6 +977,34 @@ std::string init_info_concat(const engine_t *e, const pd_t *pd) {
     return ss.str();
 }
 
+template <typename pd_t>
+std::string init_info_split(const engine_t *e, const pd_t *pd) {
+    stringstream_t ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    auto src_md = pd->invariant_src_md();
+    ss << md2fmt_str("src", src_md, pd->invariant_src_user_format_kind())
+       << " ";
+    for (int i = 0; i < pd->n_outputs(); ++i) {
+        auto dst_i_md = pd->dst_md(i);
+        ss << md2fmt_str("dst", dst_i_md,
+                pd->invariant_dst_user_format_kind(DNNL_ARG_MULTIPLE_DST + i));
+        if (i < pd->n_outputs() - 1) ss << " ";
+    }
+
+    ss << "," << pd->attr() << ",";
+    ss << "axis:" << pd->desc()->split_dimension << ",";
+
+    for (int i = 0; i < pd->n_outputs(); ++i) {
+        auto dst_i_md = pd->dst_md(i);
+        ss << md2dim_str(dst_i_md);
+        if (i < pd->n_outputs() - 1) ss << ":";
+    }
+
+    return ss.str();
+}
+
 template <typename pd_t>
 std::string init_info_convolution(const engine_t *e, const pd_t *pd) {
     stringstream_t ss;
@@ -1330,6 +1425,80 @@ std::string init_info_reduction(const engine_t *e, const pd_t *pd) {
     return ss.str();
 }
 
+template <typename pd_t>
+std::string init_info_gather(const engine_t *e, const pd_t *pd) {
+    stringstream_t ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    auto src_md = pd->invariant_src_md(0);
+    auto idx_md = pd->invariant_src_md(1);
+    auto dst_md = pd->invariant_dst_md();
+
+    ss << md2fmt_str("src", src_md, pd->invariant_src_user_format_kind(0))
+       << " ";
+    ss << md2fmt_str("idx", idx_md, pd->invariant_src_user_format_kind(1))
+       << " ";
+    ss << md2fmt_str("dst", dst_md, pd->invariant_dst_user_format_kind());
+
+    ss << "," << pd->attr() << ",";
+    ss << "alg:" << pd->desc()->alg_kind << ",";
+    ss << md2dim_str(src_md) << ":" << md2dim_str(idx_md);
+
+    return ss.str();
+}
+
+template <typename pd_t>
+std::string init_info_topk(const engine_t *e, const pd_t *pd) {
+    stringstream_t ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    auto src_md = pd->invariant_src_md();
+    auto dst_md = pd->invariant_dst_md();
+    auto idx_md = pd->dst_md(1);
+
+    ss << md2fmt_str("src", src_md, pd->invariant_src_user_format_kind())
+       << " ";
+    ss << md2fmt_str("dst", dst_md, pd->invariant_dst_user_format_kind())
+       << " ";
+    ss << md2fmt_str("idx", idx_md,
+            pd->invariant_dst_user_format_kind(DNNL_ARG_DST_INDICES));
+
+    ss << "," << pd->attr() << ",";
+    ss << "axis:" << pd->desc()->axis << " k:" << pd->k() << ",";
+    ss << md2dim_str(src_md);
+
+    return ss.str();
+}
+
+template <typename pd_t>
+std::string init_info_optimizer(const engine_t *e, const pd_t *pd) {
+    stringstream_t ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    auto src_md = pd->invariant_src_md();
+    auto dst_md = pd->invariant_dst_md();
+
+    ss << md2fmt_str("grad", src_md, pd->invariant_src_user_format_kind())
+       << " ";
+    ss << md2fmt_str("param", dst_md, pd->invariant_dst_user_format_kind());
+    if (pd->with_master_weights())
+        ss << " "
+           << md2fmt_str("master", pd->master_md(),
+                      pd->invariant_wei_user_format_kind());
+
+    const auto *d = pd->desc();
+    ss << "," << pd->attr() << ",";
+    ss << "alg:" << d->alg_kind << " momentum:" << d->momentum;
+    if (pd->is_adam()) ss << " beta2:" << d->beta2 << " eps:" << d->epsilon;
+    ss << " wd:" << d->weight_decay << ",";
+    ss << md2dim_str(dst_md);
+
+    return ss.str();
+}
+
 std::string mds2str_reorder(const memory_desc_t *src_md,
         format_kind_t src_user_format_kind, const memory_desc_t *dst_md,
         format_kind_t dst_user_format_kind) {
@@ -1530,9 +1699,21 @@ std::string init_info_softmax(const engine_t *e, const pd_t *pd) {
            << md2fmt_str("diff_dst", diff_dst_md,
                       pd->diff_dst_md(0, true)->format_kind);
     }
+    if (pd->with_mask_buffer()) {
+        auto *msk_md = &pd->desc()->mask_desc;
+        ss << " " << md2fmt_str("msk", msk_md, msk_md->format_kind);
+    }
 
     ss << "," << pd->attr() << ",";
-    ss << "alg:" << pd->alg_kind() << " axis:" << pd->axis() << ",";
+    ss << "alg:" << pd->alg_kind() << " axis:" << pd->axis();
+    if (pd->with_causal_mask()) {
+        if (pd->mask_type() == attn_mask_type::top_left)
+            ss << " msk:causal:top_left";
+        else
+            ss << " msk:causal:bottom_right";
+    }
+    if (pd->with_scale()) ss << " scl:mul:f32";
+    ss << ",";
     ss << md2dim_str(src_md);
 
     return ss.str();
@@ -1561,10 +1742,10 @@ std::string init_info_sum(const engine_t *e, const pd_t *pd) {
 template <typename pd_t>
 std::string init_info_sdpa(const engine_t *e, const pd_t *pd) {
     stringstream_t ss;
-    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+    const sdpa_desc_t *desc = pd->desc();
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << desc->prop_kind
        << ",";
 
-    const sdpa_desc_t *desc = pd->desc();
     ss << md2fmt_str(
             "query", pd->qry_md(), pd->invariant_src_user_format_kind(0))
        << " ";
@@ -1576,6 +1757,19 @@ std::string init_info_sdpa(const engine_t *e, const pd_t *pd) {
         ss << md2fmt_str("msk", pd->attn_mask_md(),
                 pd->invariant_src_user_format_kind(3))
            << " ";
+    if (pd->with_stats())
+        ss << md2fmt_str("stats", pd->stats_md(), pd->stats_md()->format_kind)
+           << " ";
+    if (!pd->is_fwd()) {
+        const char *diff_names[] = {"diff_query", "diff_key", "diff_val"};
+        for (int i = 0; i < 3; i++)
+            ss << md2fmt_str(diff_names[i], pd->diff_src_md(i),
+                    pd->diff_src_md(i, true)->format_kind)
+               << " ";
+        ss << md2fmt_str("diff_dst", pd->diff_dst_md(),
+                pd->diff_dst_md(0, true)->format_kind)
+           << " ";
+    }
     ss << md2fmt_str("dst", pd->dst_md(), pd->invariant_dst_user_format_kind())
        << ",";
 
@@ -1664,6 +1858,7 @@ std::string rt_mds2str(primitive_kind_t prim_kind, const memory_desc_t *src_md,
         case primitive_kind::convolution:
         case primitive_kind::deconvolution:
         case primitive_kind::eltwise:
+        case primitive_kind::gather:
         case primitive_kind::inner_product:
         case primitive_kind::layer_normalization:
         case primitive_kind::lrn:
@@ -1674,7 +1869,12 @@ std::string rt_mds2str(primitive_kind_t prim_kind, const memory_desc_t *src_md,
         case primitive_kind::rnn:
         case primitive_kind::shuffle:
         case primitive_kind::softmax:
-        case primitive_kind::sum: assert(!"unsupported primitive kind"); break;
+        case primitive_kind::split:
+        case primitive_kind::sum:
+        case primitive_kind::topk:
+        case primitive_kind::optimizer:
+            assert(!"unsupported primitive kind");
+            break;
         default: assert(!"unknown primitive kind");
     }
     return s;
@@ -1733,6 +1933,7 @@ std::string rt_dims2fmt_str(primitive_kind_t prim_kind,
         case primitive_kind::convolution:
         case primitive_kind::deconvolution:
         case primitive_kind::eltwise:
+        case primitive_kind::gather:
         case primitive_kind::inner_product:
         case primitive_kind::layer_normalization:
         case primitive_kind::lrn:
@@ -1743,7 +1944,12 @@ std::string rt_dims2fmt_str(primitive_kind_t prim_kind,
         case primitive_kind::rnn:
         case primitive_kind::shuffle:
         case primitive_kind::softmax:
-        case primitive_kind::sum: assert(!"unsupported primitive kind"); break;
+        case primitive_kind::split:
+        case primitive_kind::sum:
+        case primitive_kind::topk:
+        case primitive_kind::optimizer:
+            assert(!"unsupported primitive kind");
+            break;
         default: assert(!"unknown primitive kind");
     }
     return s;
@@ -1767,6 +1973,7 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(gather);
             CASE(gemm);
             CASE(group_normalization);
             CASE(inner_product);
@@ -1781,7 +1988,10 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(rnn);
             CASE(shuffle);
             CASE(softmax);
+            CASE(split);
             CASE(sum);
+            CASE(topk);
+            CASE(optimizer);
             CASE(sdpa);
             case primitive_kind::zero_pad:
               str_ = "zero_pad, unknown info";
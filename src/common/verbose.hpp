@@ -196,6 +196,8 @@ struct verbose_t {
         exec_profile = 1 << 7,
         profile_externals = 1 << 8,
         warn = 1 << 9,
+        // report device kernel time instead of host time in exec_profile
+        exec_profile_device = 1 << 10,
         // the upper 8 bits are reserved for devinfo levels
         debuginfo = 1 << 24,
         //
@@ -235,9 +237,13 @@ struct component_t {
         softmax = 1 << 19,
         layer_normalization = 1 << 20,
         group_normalization = 1 << 21,
-        graph = 1 << 22,
-        gemm_api = 1 << 23,
-        ukernel = 1 << 24,
+        split = 1 << 22,
+        gather = 1 << 23,
+        topk = 1 << 24,
+        optimizer = 1 << 25,
+        graph = 1 << 26,
+        gemm_api = 1 << 27,
+        ukernel = 1 << 28,
         all = (uint32_t)-1,
     };
 };
@@ -273,6 +279,18 @@ static inline uint32_t get_verbose_dev_mode(
 
 bool get_verbose_timestamp();
 
+// Limits the profiled executions of each primitive to every `period`-th one
+// and to at most one per `interval_ms`. Set with the `sample=N` and
+// `sample_ms=T` verbose options.
+struct verbose_sampling_t {
+    uint64_t period = 0;
+    double interval_ms = 0;
+
+    bool is_enabled() const { return period > 1 || interval_ms > 0; }
+};
+
+const verbose_sampling_t &get_verbose_sampling();
+
 // logging functionality for saving verbose outputs to logfiles
 #ifdef DNNL_EXPERIMENTAL_LOGGING
 inline const std::map<dnnl::impl::verbose_t::flag_kind,
@@ -35,6 +35,8 @@ status_t acl_layer_normalization_fwd_t::pd_t::init(engine_t *engine) {
             use_global_stats(), "ACL does not support global stats with lnorm");
     ACL_CHECK_SUPPORT(use_scale() || use_shift(),
             "ACL does not support lnorm scale and shift");
+    ACL_CHECK_SUPPORT(fuse_residual_add(),
+            "ACL does not support lnorm with residual add");
 
     // attr-scales
     ACL_CHECK_SUPPORT(!attr()->has_default_values(),
@@ -0,0 +1,114 @@
+/*******************************************************************************
+* Copyright 2022-2025 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "cpu/aarch64/acl_parallel_scheduler.hpp"
+
+#include "common/dnnl_thread.hpp"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/IScheduler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace arm_compute;
+
+namespace {
+class ThreadFeeder {
+public:
+    explicit ThreadFeeder(unsigned int start = 0, unsigned int end = 0)
+        : _atomic_counter(start), _end(end) {}
+
+    /// Function to check the next element in the range if there is one.
+    bool get_next(unsigned int &next) {
+        next = std::atomic_fetch_add_explicit(
+                &_atomic_counter, 1u, std::memory_order_relaxed);
+        return next < _end;
+    }
+
+private:
+    std::atomic_uint _atomic_counter;
+    const unsigned int _end;
+};
+
+void process_workloads(std::vector<IScheduler::Workload> &workloads,
+        ThreadFeeder &feeder, const ThreadInfo &info) {
+    unsigned int workload_index = 0;
+    while (feeder.get_next(workload_index)) {
+        ARM_COMPUTE_ERROR_ON(workload_index >= workloads.size());
+        workloads[workload_index](info);
+    }
+}
+} // namespace
+
+ParallelScheduler::ParallelScheduler() = default;
+
+ParallelScheduler::~ParallelScheduler() = default;
+
+unsigned int ParallelScheduler::num_threads() const {
+    // Compute Library splits the work into windows based on this value, so
+    // it is queried on every call: the number of threads depends on the
+    // active threadpool and on the thread limit of the executed primitive.
+    const unsigned int nthr = std::max(dnnl_get_max_threads(), 1);
+    const unsigned int max_nthr = _max_num_threads.load();
+    return max_nthr ? std::min(nthr, max_nthr) : nthr;
+}
+
+void ParallelScheduler::set_num_threads(unsigned int num_threads) {
+    _max_num_threads = num_threads;
+}
+
+void ParallelScheduler::schedule(ICPPKernel *kernel, const Hints &hints) {
+    ITensorPack tensors;
+    schedule_common(kernel, hints, kernel->window(), tensors);
+}
+
+void ParallelScheduler::schedule_op(ICPPKernel *kernel, const Hints &hints,
+        const Window &window, ITensorPack &tensors) {
+    schedule_common(kernel, hints, window, tensors);
+}
+
+void ParallelScheduler::run_workloads(
+        std::vector<arm_compute::IScheduler::Workload> &workloads) {
+    const unsigned int nthr = std::min(
+            num_threads(), static_cast<unsigned int>(workloads.size()));
+    if (nthr < 1) return;
+
+    // parallel() may run fewer threads than requested, e.g. when called
+    // from a parallel region or under a thread limit, so all the workloads
+    // are distributed dynamically.
+    ThreadFeeder feeder(0, workloads.size());
+    parallel(static_cast<int>(nthr), [&](int ithr, int nthr_) {
+        // Make ThreadInfo local to avoid race conditions
+        ThreadInfo info;
+        info.cpu_info = &cpu_info();
+        info.num_threads = nthr_;
+        info.thread_id = ithr;
+        process_workloads(workloads, feeder, info);
+    });
+}
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -14,30 +14,30 @@
 * limitations under the License.
 *******************************************************************************/
 
-#ifndef CPU_AARCH64_ACL_THREADPOOL_SCHEDULER_HPP
-#define CPU_AARCH64_ACL_THREADPOOL_SCHEDULER_HPP
+#ifndef CPU_AARCH64_ACL_PARALLEL_SCHEDULER_HPP
+#define CPU_AARCH64_ACL_PARALLEL_SCHEDULER_HPP
 
-#include "oneapi/dnnl/dnnl_config.h"
-
-#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
+#include <atomic>
 
 #include "arm_compute/runtime/IScheduler.h"
 
-#include <mutex>
-
 namespace dnnl {
 namespace impl {
 namespace cpu {
 namespace aarch64 {
 
-class ThreadpoolScheduler final : public arm_compute::IScheduler {
+// ParallelScheduler runs Compute Library workloads with oneDNN parallel(), so
+// they use the threading runtime of the library and honor the number of
+// threads available to the executed primitive, including the per-primitive
+// thread limit, instead of a thread count fixed at initialization.
+class ParallelScheduler final : public arm_compute::IScheduler {
 public:
-    ThreadpoolScheduler();
-    ~ThreadpoolScheduler() override;
+    ParallelScheduler();
+    ~ParallelScheduler() override;
 
-    /// Sets the number of threads the scheduler will use to run the kernels.
+    /// Sets the upper bound on the number of threads. 0 removes the bound.
     void set_num_threads(unsigned int num_threads) override;
-    /// Returns the number of threads that the ThreadpoolScheduler has in its pool.
+    /// Returns the number of threads available to the calling thread.
     unsigned int num_threads() const override;
 
     /// Multithread the execution of the passed kernel if possible.
@@ -55,8 +55,7 @@ protected:
     void run_workloads(std::vector<Workload> &workloads) override;
 
 private:
-    unsigned int _num_threads {};
-    std::mutex _mtx;
+    std::atomic<unsigned int> _max_num_threads {0};
 };
 
 } // namespace aarch64
@@ -64,6 +63,4 @@ private:
 } // namespace impl
 } // namespace dnnl
 
-#endif // DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
-
-#endif // CPU_AARCH64_ACL_THREADPOOL_SCHEDULER_HPP
+#endif // CPU_AARCH64_ACL_PARALLEL_SCHEDULER_HPP
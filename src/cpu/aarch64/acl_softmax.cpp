@@ -27,7 +27,7 @@ const acl_softmax_fwd_t::pd_t *acl_softmax_fwd_t::pd() const {
 
 status_t acl_softmax_fwd_t::pd_t::init(engine_t *engine) {
 
-    bool ok = is_fwd()
+    bool ok = is_fwd() && !with_attn_preprocessing()
             && set_default_formats() == status::success
             // ACL only supports matching src/dst (this must come after
             // set_default_formats() to handle format_kind::any)
@@ -29,22 +29,13 @@ namespace aarch64 {
 
 namespace acl_thread_utils {
 
-#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
-// Number of threads in Compute Library is set by OMP_NUM_THREADS
-// dnnl_get_max_threads() == OMP_NUM_THREADS
-void acl_thread_bind();
-// Swap BenchmarkScheduler for default ACL scheduler builds (i.e. CPPScheduler, OMPScheduler)
-// for DNNL_VERBOSE=profile,profile_externals
-void acl_set_benchmark_scheduler_default();
-#endif
-
-#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
-// Retrieve threadpool size during primitive execution and set ThreadpoolScheduler num_threads
-void acl_set_tp_scheduler();
-void acl_set_threadpool_num_threads();
-// Swap BenchmarkScheduler for custom scheduler builds (i.e. ThreadPoolScheduler) for DNNL_VERBOSE=profile,profile_externals
-void acl_set_tp_benchmark_scheduler();
-#endif
+// Compute Library kernels are scheduled with oneDNN parallel() by
+// ParallelScheduler in all threading runtimes, so they use the number of
+// threads available to the executed primitive.
+void acl_set_parallel_scheduler();
+// Swap BenchmarkScheduler for ParallelScheduler for
+// DNNL_VERBOSE=profile,profile_externals
+void acl_set_parallel_benchmark_scheduler();
 // Set threading for ACL
 void set_acl_threading();
 } // namespace acl_thread_utils
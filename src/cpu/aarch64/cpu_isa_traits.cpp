@@ -19,6 +19,11 @@
 #include <mutex>
 #include <string>
 
+#if defined(__linux__)
+#include <sys/auxv.h>
+#include <sys/prctl.h>
+#endif
+
 #include "common/utils.hpp"
 
 #include "cpu/aarch64/cpu_isa_traits.hpp"
@@ -156,6 +161,52 @@ status_t set_max_cpu_isa(dnnl_cpu_isa_t isa) {
 dnnl_cpu_isa_t get_effective_cpu_isa() {
     return get_isa_info_t().convert_to_public_enum();
 }
+
+namespace {
+#if defined(__linux__) && defined(AT_HWCAP2)
+// Old <sys/auxv.h> and <sys/prctl.h> may not define the SME bits.
+constexpr uint64_t hwcap2_sme = 1ULL << 23;
+constexpr uint64_t hwcap2_sme2 = 1ULL << 37;
+constexpr int pr_sme_get_vl = 64;
+constexpr int pr_sme_vl_len_mask = 0xffff;
+
+uint64_t get_hwcap2() {
+    static const uint64_t hwcap2 = getauxval(AT_HWCAP2);
+    return hwcap2;
+}
+
+// Limiting the max ISA with ONEDNN_MAX_CPU_ISA disables SME kernels as well.
+bool sme_is_allowed() {
+    return get_max_cpu_isa_mask(true) == isa_all;
+}
+#endif
+} // namespace
+
+bool mayiuse_sme() {
+#if defined(__linux__) && defined(AT_HWCAP2)
+    return sme_is_allowed() && (get_hwcap2() & hwcap2_sme);
+#else
+    return false;
+#endif
+}
+
+bool mayiuse_sme2() {
+#if defined(__linux__) && defined(AT_HWCAP2)
+    return mayiuse_sme() && (get_hwcap2() & hwcap2_sme2);
+#else
+    return false;
+#endif
+}
+
+uint64_t get_sme_length() {
+#if defined(__linux__) && defined(AT_HWCAP2)
+    if (!mayiuse_sme()) return 0;
+    static const int vl = prctl(pr_sme_get_vl, 0, 0, 0, 0);
+    return vl < 0 ? 0 : static_cast<uint64_t>(vl & pr_sme_vl_len_mask);
+#else
+    return 0;
+#endif
+}
 } // namespace aarch64
 } // namespace cpu
 } // namespace impl
@@ -249,6 +249,13 @@ static inline int isa_num_vregs(cpu_isa_t isa) {
 
 } // namespace
 
+// SME is not a part of cpu_isa_t: streaming mode kernels use their own
+// vector length and are dispatched independently of the SVE kernels.
+bool mayiuse_sme();
+bool mayiuse_sme2();
+// Returns the streaming vector length in bytes or 0 if SME is not supported.
+uint64_t get_sme_length();
+
 /* whatever is required to generate string literals... */
 #include "common/z_magic.hpp"
 /* clang-format off */
@@ -18,6 +18,8 @@
 
 #include <mutex>
 
+#include "common/packed_weights_cache.hpp"
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -177,6 +179,11 @@ status_t acl_matmul_t::pd_t::init(engine_t *engine) {
                                 &amp_.dst_tensor_info, amp_.gemm_info));
     }
 
+    if (amp_.is_transB && !amp_.do_transC) {
+        wei_trans_md_ = weights_md_;
+        CHECK(memory_desc_init_by_strides(wei_trans_md_, nullptr));
+    }
+
     auto scratchpad = scratchpad_registry().registrar();
     arm_compute::experimental::MemoryRequirements aux_mem_req;
 
@@ -196,6 +203,19 @@ status_t acl_matmul_t::pd_t::init(engine_t *engine) {
     return status::success;
 }
 
+memory_t *acl_matmul_t::get_cached_transposed_weights(
+        const exec_ctx_t &ctx) const {
+    if (packed_weights_cache::get_capacity() == 0) return nullptr;
+
+    // The transposition is a reorder of the weights into the dense layout,
+    // so it is done once per weights buffer and reused by all primitives
+    // with the same weights while the buffer is cached.
+    memory_t *wei_trans = nullptr;
+    const status_t status = packed_weights_cache::get_or_create(&wei_trans,
+            pd()->wei_trans_md_, ctx.input(DNNL_ARG_WEIGHTS), ctx.stream());
+    return status == status::success ? wei_trans : nullptr;
+}
+
 template <bool IsFixedFormat>
 status_t acl_matmul_t::execute_forward(const exec_ctx_t &ctx) const {
     status_t status = status::success;
@@ -218,6 +238,17 @@ status_t acl_matmul_t::execute_forward(const exec_ctx_t &ctx) const {
 
     const auto scratchpad = ctx.get_scratchpad_grantor();
 
+    memory_t *wei_trans = (is_transB && !do_transC)
+            ? get_cached_transposed_weights(ctx)
+            : nullptr;
+    void *wei_trans_base = nullptr;
+    if (wei_trans
+            && wei_trans->get_data_handle(&wei_trans_base)
+                    != status::success) {
+        wei_trans->release();
+        wei_trans = nullptr;
+    }
+
     arm_compute::Tensor src_tensor;
     arm_compute::Tensor wei_tensor;
     arm_compute::Tensor bia_tensor = nullptr;
@@ -251,6 +282,9 @@ status_t acl_matmul_t::execute_forward(const exec_ctx_t &ctx) const {
         acl_obj_->transA.run(transpose_pack);
         wei_tensor.allocator()->import_memory(const_cast<data_t *>(wei_base));
         src_acc_tensor.allocator()->free();
+    } else if (is_transB && !is_transA && wei_trans) {
+        src_tensor.allocator()->import_memory(const_cast<data_t *>(src_base));
+        wei_tensor.allocator()->import_memory(wei_trans_base);
     } else if (is_transB && !is_transA) {
         arm_compute::Tensor wei_acc_tensor;
         wei_acc_tensor.allocator()->init(amp.wei_acc_info);
@@ -269,33 +303,38 @@ status_t acl_matmul_t::execute_forward(const exec_ctx_t &ctx) const {
         wei_acc_tensor.allocator()->free();
     } else if (is_transA && is_transB && !do_transC) {
         arm_compute::Tensor src_acc_tensor;
-        arm_compute::Tensor wei_acc_tensor;
         src_acc_tensor.allocator()->init(amp.src_acc_info);
         src_acc_tensor.allocator()->import_memory(
                 const_cast<data_t *>(src_base));
-        wei_acc_tensor.allocator()->init(amp.wei_acc_info);
-        wei_acc_tensor.allocator()->import_memory(
-                const_cast<data_t *>(wei_base));
         auto transA_scratch = scratchpad.get<void>(
                 memory_tracking::names::key_matmul_src_trans);
-        auto transB_scratch = scratchpad.get<void>(
-                memory_tracking::names::key_matmul_wei_trans);
         src_tensor.allocator()->import_memory(transA_scratch);
-        wei_tensor.allocator()->import_memory(transB_scratch);
         arm_compute::ITensorPack transpose_packA;
         transpose_packA.add_tensor(
                 arm_compute::TensorType::ACL_SRC, &src_acc_tensor);
         transpose_packA.add_tensor(
                 arm_compute::TensorType::ACL_DST, &src_tensor);
-        arm_compute::ITensorPack transpose_packB;
-        transpose_packB.add_tensor(
-                arm_compute::TensorType::ACL_SRC, &wei_acc_tensor);
-        transpose_packB.add_tensor(
-                arm_compute::TensorType::ACL_DST, &wei_tensor);
         acl_obj_->transA.run(transpose_packA);
-        acl_obj_->transB.run(transpose_packB);
         src_acc_tensor.allocator()->free();
-        wei_acc_tensor.allocator()->free();
+
+        if (wei_trans) {
+            wei_tensor.allocator()->import_memory(wei_trans_base);
+        } else {
+            arm_compute::Tensor wei_acc_tensor;
+            wei_acc_tensor.allocator()->init(amp.wei_acc_info);
+            wei_acc_tensor.allocator()->import_memory(
+                    const_cast<data_t *>(wei_base));
+            auto transB_scratch = scratchpad.get<void>(
+                    memory_tracking::names::key_matmul_wei_trans);
+            wei_tensor.allocator()->import_memory(transB_scratch);
+            arm_compute::ITensorPack transpose_packB;
+            transpose_packB.add_tensor(
+                    arm_compute::TensorType::ACL_SRC, &wei_acc_tensor);
+            transpose_packB.add_tensor(
+                    arm_compute::TensorType::ACL_DST, &wei_tensor);
+            acl_obj_->transB.run(transpose_packB);
+            wei_acc_tensor.allocator()->free();
+        }
     } else {
         src_tensor.allocator()->import_memory(const_cast<data_t *>(src_base));
         wei_tensor.allocator()->import_memory(const_cast<data_t *>(wei_base));
@@ -368,6 +407,8 @@ status_t acl_matmul_t::execute_forward(const exec_ctx_t &ctx) const {
     void *dst = dst_tensor.buffer();
     pd()->acl_post_ops.execute(ctx, dst);
 
+    if (wei_trans) wei_trans->release();
+
     return status;
 }
 
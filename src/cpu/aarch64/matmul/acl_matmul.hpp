@@ -40,6 +40,10 @@ struct acl_matmul_t : public primitive_t {
         acl_matmul_conf_t amp_ = utils::zero<decltype(amp_)>();
         acl_post_ops_t acl_post_ops;
         dnnl::impl::format_kind_t weights_format_kind_;
+        // Dense layout of the weights that ACL expects after the weights
+        // transposition, used to take the transposed weights from the packed
+        // weights cache.
+        memory_desc_t wei_trans_md_ = types::zero_md();
     };
 
     acl_matmul_t(const pd_t *apd)
@@ -59,6 +63,11 @@ private:
     template <bool IsFixedFormat>
     status_t execute_forward(const exec_ctx_t &ctx) const;
 
+    // Returns the transposed weights from the packed weights cache or
+    // nullptr if the cache is disabled. The returned memory object must be
+    // released by the caller.
+    memory_t *get_cached_transposed_weights(const exec_ctx_t &ctx) const;
+
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
     std::unique_ptr<acl_matmul_obj_t> acl_obj_;
@@ -127,6 +127,18 @@ struct jit_int8_matmul_kernel_t : public jit_generator {
     ZReg acc(int bd, int ld) {
         return ZReg(bd * brg_.ld_block + ld + brg_.ld_block + 1);
     }
+    // Emits the i8mm instruction for the given signedness of the operands.
+    // The mixed case is only available with an unsigned first operand.
+    void mmla(const ZRegS &acc, const ZRegB &a, const ZRegB &b, bool a_s8,
+            bool b_s8) {
+        assert(IMPLICATION(a_s8, b_s8));
+        if (a_s8)
+            smmla(acc, a, b);
+        else if (b_s8)
+            usmmla(acc, a, b);
+        else
+            ummla(acc, a, b);
+    }
     void zero_regs() {
         for (int a = 0; a < brg_.bd_block / 2; a++)
             for (int b = 0; b < brg_.ld_block; b++)
@@ -290,12 +302,9 @@ struct jit_int8_matmul_kernel_t : public jit_generator {
                 ld1rqb(z0.b, P_ALL_ONE, ptr(X_DEFAULT_ADDR));
                 ao += brg_.m_blk * 2;
 
-                for (ld = 0; ld < ldb; ld++) {
-                    if (brg_.is_s8)
-                        smmla(acc(bd, ld).s, z0.b, loadb(ld).b);
-                    else
-                        ummla(acc(bd, ld).s, z0.b, loadb(ld).b);
-                }
+                for (ld = 0; ld < ldb; ld++)
+                    mmla(acc(bd, ld).s, z0.b, loadb(ld).b, brg_.is_src_s8,
+                            brg_.is_s8);
             }
             a_off += brg_.m_blk * brg_.k_blk;
             add_imm(reg_tmp, reg_tmp, brg_.k_blk * brg_.n_blk * brg_.ld_block,
@@ -518,13 +527,9 @@ struct jit_int8_matmul_kernel_t : public jit_generator {
                 ld1b(z1.b, P_ALL_ONE / T_z, ptr(reg_tmp));
                 ld1b(z2.b, P_ALL_ONE / T_z, ptr(reg_tmp, 1, MUL_VL));
                 add_imm(reg_tmp, reg_tmp, brg_.k_blk * brg_.m_blk, X_TMP_0);
-                if (brg_.is_s8) {
-                    smmla(z3.s, z0.b, z1.b);
-                    smmla(z4.s, z0.b, z2.b);
-                } else {
-                    ummla(z3.s, z0.b, z1.b);
-                    ummla(z4.s, z0.b, z2.b);
-                }
+                // Row sums of the source, z0 holds ones.
+                mmla(z3.s, z0.b, z1.b, false, brg_.is_src_s8);
+                mmla(z4.s, z0.b, z2.b, false, brg_.is_src_s8);
             }
         }
         if ((brg_.zp_type_a != jit_int8_broadcast_t::none) && is_a == 1) {
@@ -538,13 +543,8 @@ struct jit_int8_matmul_kernel_t : public jit_generator {
                 }
                 add_imm(reg_tmp, reg_tmp,
                         brg_.k_blk * brg_.n_blk * brg_.ld_block, X_TMP_0);
-                for (ld = 0; ld < ldb; ld++) {
-                    if (brg_.is_s8) {
-                        smmla(acc(2, ld).s, z0.b, acc(1, ld).b);
-                    } else {
-                        ummla(acc(2, ld).s, z0.b, acc(1, ld).b);
-                    }
-                }
+                for (ld = 0; ld < ldb; ld++)
+                    mmla(acc(2, ld).s, z0.b, acc(1, ld).b, false, brg_.is_s8);
             }
         }
     }
@@ -643,6 +643,8 @@ status_t jit_int8_matmul_t::pd_t::init(engine_t *engine) {
     bool is_s8_wei = utils::everyone_is(s8, wei_type);
     bool is_u8 = utils::everyone_is(u8, src_type, wei_type);
     bool is_s8 = utils::everyone_is(s8, src_type, wei_type);
+    // u8 source with s8 weights maps to usmmla.
+    bool is_u8s8 = src_type == u8 && wei_type == s8;
 
     int dims = src_d.ndims();
 
@@ -742,7 +744,7 @@ status_t jit_int8_matmul_t::pd_t::init(engine_t *engine) {
 
     bool no_post_ops = attr()->post_ops_.has_default_values();
     const bool problem_dt_correct
-            = (is_s8 || is_u8) && utils::everyone_is(f32, dst_type);
+            = (is_s8 || is_u8 || is_u8s8) && utils::everyone_is(f32, dst_type);
 
     VDISPATCH_MATMUL(problem_dt_correct, VERBOSE_UNSUPPORTED_DT);
     VDISPATCH_MATMUL(no_post_ops, VERBOSE_UNSUPPORTED_ATTR);
@@ -892,6 +894,7 @@ status_t jit_int8_matmul_t::pd_t::init(engine_t *engine) {
     brg_.k_tail = brg_.K % (brg_.k_blk * brg_.rd_block);
     brg_.n_tail = brg_.N % (brg_.n_blk * brg_.ld_block);
     brg_.is_s8 = is_s8_wei;
+    brg_.is_src_s8 = src_type == s8;
     brg_.is_bias = with_bias();
     brg_.with_scales = is_scales;
     brg_.with_dst_scales = is_dst_scales;
@@ -962,6 +965,7 @@ status_t jit_int8_matmul_t::init(engine_t *engine) {
     b.k_tail = b1.k_tail;
     b.dst_dt_sz = b1.dst_dt_sz;
     b.is_s8 = b1.is_s8;
+    b.is_src_s8 = b1.is_src_s8;
     b.B = b1.B;
     b.is_bias = b1.is_bias;
     b.zp_type_a = b1.zp_type_a;
@@ -0,0 +1,349 @@
+/*******************************************************************************
+* Copyright 2025 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/jit_generator.hpp"
+#include "cpu/matmul/matmul_utils.hpp"
+
+#include "cpu/aarch64/matmul/jit_sme_matmul.hpp"
+
+#define GET_OFF(field) (uint32_t) offsetof(call_params_t, field)
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+namespace matmul {
+
+using namespace Xbyak_aarch64;
+using namespace dnnl::impl::cpu::matmul;
+using namespace dnnl::impl::format_tag;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+using namespace data_type;
+
+// Computes a m_blk x n_blk block of dst:
+//   C[0:m, 0:n] (+)= A[0:m, 0:K] * B[0:K, 0:n]
+// where the block of A is packed so that a column of it is contiguous and
+// zero padded to m_blk, and B and C are row-major. Every step over K is four
+// FMOPA outer products of two A and two B vectors into the ZA tiles:
+//   za0 = rows [0, svl_s)       x columns [0, svl_s)
+//   za1 = rows [0, svl_s)       x columns [svl_s, 2 * svl_s)
+//   za2 = rows [svl_s, 2 * svl_s) x columns [0, svl_s)
+//   za3 = rows [svl_s, 2 * svl_s) x columns [svl_s, 2 * svl_s)
+//
+// Xbyak_aarch64 has no SME mnemonics, so SME instructions are encoded
+// directly. Only SVE instructions that are legal in the streaming mode are
+// used between smstart and smstop.
+struct jit_sme_f32_matmul_kernel_t : public jit_generator {
+
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_sme_f32_matmul_kernel_t)
+
+    struct call_params_t {
+        const float *a, *b;
+        float *c;
+        dim_t K, m, n;
+        dim_t ldb, ldc;
+    };
+
+    XReg reg_param = abi_param1;
+    XReg reg_a = x1;
+    XReg reg_b = x2;
+    XReg reg_c = x3;
+    XReg reg_k = x4;
+    XReg reg_m = x5;
+    XReg reg_n = x6;
+    XReg reg_ldb = x7;
+    XReg reg_ldc = x8;
+    XReg reg_svl = x10;
+    XReg reg_row = x11;
+    // Tile slice index. SME tile slice loads and stores take it from one of
+    // w12-w15.
+    XReg reg_slice = x12;
+    XReg reg_rows = x13;
+
+    PReg prd_n0 = p1;
+    PReg prd_n1 = p2;
+
+    void operator()(const call_params_t *p) {
+        return jit_generator::operator()(p);
+    }
+
+    // SMSTART: enter the streaming mode and enable the ZA array.
+    void sme_smstart() { dd(0xd503477f); }
+    // SMSTOP: exit the streaming mode and disable the ZA array.
+    void sme_smstop() { dd(0xd503467f); }
+    // ZERO {ZA}
+    void sme_zero_za() { dd(0xc00800ff); }
+
+    // FMOPA ZA<za>.S, Pn/M, Pm/M, Zn.S, Zm.S
+    void sme_fmopa(int za, const PReg &pn, const PReg &pm, const ZReg &zn,
+            const ZReg &zm) {
+        dd(0x80800000u | (zm.getIdx() << 16) | (pm.getIdx() << 13)
+                | (pn.getIdx() << 10) | (zn.getIdx() << 5) | za);
+    }
+
+    // LD1W/ST1W {ZA<za>H.S[W12, 0]}, Pg, [Xn, Xm, LSL #2]
+    void sme_za_row(bool store, int za, const PReg &pg, const XReg &xn,
+            const XReg &xm) {
+        assert(pg.getIdx() < 8);
+        const uint32_t opc = store ? 0xe0a00000u : 0xe0800000u;
+        dd(opc | (xm.getIdx() << 16) | (pg.getIdx() << 10) | (xn.getIdx() << 5)
+                | (za << 2));
+    }
+
+    // Loads or stores `reg_rows` rows of the ZA tiles `za` and `za + 1`
+    // starting at `reg_row`. A non-positive number of rows is a no-op.
+    void za_rows(bool store, int za) {
+        Label l_loop, l_done;
+        mov(reg_slice, 0);
+        L(l_loop);
+        cmp(reg_slice, reg_rows);
+        b(GE, l_done);
+        sme_za_row(store, za, prd_n0, reg_row, xzr);
+        sme_za_row(store, za + 1, prd_n1, reg_row, reg_svl);
+        add(reg_row, reg_row, reg_ldc);
+        add(reg_slice, reg_slice, 1);
+        b(l_loop);
+        L(l_done);
+    }
+
+    // Iterates over the two halves of the dst block rows.
+    void za_block(bool store) {
+        mov(reg_row, reg_c);
+        mov(reg_rows, reg_m);
+        za_rows(store, 0);
+
+        mov(reg_row, reg_c);
+        mul(reg_rows, reg_ldc, reg_svl);
+        add(reg_row, reg_row, reg_rows);
+        sub(reg_rows, reg_m, reg_svl);
+        za_rows(store, 2);
+    }
+
+    void loop_k() {
+        Label l_loop, l_done;
+        cbz(reg_k, l_done);
+        L(l_loop);
+        ld1w(z0.s, P_ALL_ONE / T_z, ptr(reg_a));
+        ld1w(z1.s, P_ALL_ONE / T_z, ptr(reg_a, 1, MUL_VL));
+        ld1w(z2.s, prd_n0 / T_z, ptr(reg_b));
+        ld1w(z3.s, prd_n1 / T_z, ptr(reg_b, 1, MUL_VL));
+        sme_fmopa(0, P_ALL_ONE, P_ALL_ONE, z0, z2);
+        sme_fmopa(1, P_ALL_ONE, P_ALL_ONE, z0, z3);
+        sme_fmopa(2, P_ALL_ONE, P_ALL_ONE, z1, z2);
+        sme_fmopa(3, P_ALL_ONE, P_ALL_ONE, z1, z3);
+        add_imm(reg_a, reg_a, brg.m_blk * sizeof(float), X_TMP_0);
+        add(reg_b, reg_b, reg_ldb);
+        subs(reg_k, reg_k, 1);
+        b(NE, l_loop);
+        L(l_done);
+    }
+
+    void generate() override {
+        preamble();
+
+        ldr(reg_a, ptr(reg_param, GET_OFF(a)));
+        ldr(reg_b, ptr(reg_param, GET_OFF(b)));
+        ldr(reg_c, ptr(reg_param, GET_OFF(c)));
+        ldr(reg_k, ptr(reg_param, GET_OFF(K)));
+        ldr(reg_m, ptr(reg_param, GET_OFF(m)));
+        ldr(reg_n, ptr(reg_param, GET_OFF(n)));
+        ldr(reg_ldb, ptr(reg_param, GET_OFF(ldb)));
+        ldr(reg_ldc, ptr(reg_param, GET_OFF(ldc)));
+        lsl(reg_ldb, reg_ldb, 2);
+        lsl(reg_ldc, reg_ldc, 2);
+        mov_imm(reg_svl, brg.svl_s);
+
+        // The streaming mode switch resets Z and P registers. The callee-saved
+        // d8-d15 are already saved by the preamble and restored by the
+        // postamble after the switch back.
+        sme_smstart();
+        ptrue(P_ALL_ONE.s);
+        whilelt(prd_n0.s, xzr, reg_n);
+        whilelt(prd_n1.s, reg_svl, reg_n);
+
+        if (brg.with_sum_po)
+            za_block(false);
+        else
+            sme_zero_za();
+        loop_k();
+        za_block(true);
+
+        sme_smstop();
+        postamble();
+    }
+
+    jit_sme_f32_matmul_kernel_t(const brg_sme_t &k) : brg(k) {}
+    ~jit_sme_f32_matmul_kernel_t() override = default;
+
+    brg_sme_t brg;
+};
+
+bool jit_sme_matmul_t::pd_t::formats_ok() const {
+    const int ndims = dst_md_.ndims;
+    const auto tag = pick(ndims - 2, ab, abc, abcd, abcde, abcdef);
+    for (const auto *md : {&src_md_, &weights_md_, &dst_md_})
+        if (!memory_desc_wrapper(md).matches_tag(tag)) return false;
+    return true;
+}
+
+status_t jit_sme_matmul_t::pd_t::init(engine_t *engine) {
+    const auto src_type = src_md(0)->data_type;
+    const auto wei_type = weights_md(0)->data_type;
+    const auto dst_type = dst_md(0)->data_type;
+
+    const memory_desc_wrapper src_d(src_md_);
+    const memory_desc_wrapper weights_d(weights_md_);
+    const memory_desc_wrapper dst_d(dst_md_);
+
+    VDISPATCH_MATMUL(is_dense_format_kind(), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(mayiuse_sme(), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_MATMUL(get_sme_length() >= 16, VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_MATMUL(everyone_is(f32, src_type, wei_type, dst_type),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_MATMUL(!(src_d.has_runtime_dims_or_strides()
+                             || weights_d.has_runtime_dims_or_strides()
+                             || dst_d.has_runtime_dims_or_strides()),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_MATMUL(attr()->has_default_values(
+                             primitive_attr_t::skip_mask_t::post_ops, dst_type),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL(formats_ok(), VERBOSE_UNSUPPORTED_TAG);
+
+    // Only the sum post-op that accumulates into dst is supported, it is
+    // applied by loading dst into the ZA tiles instead of zeroing them.
+    const auto &post_ops = attr()->post_ops_;
+    VDISPATCH_MATMUL(post_ops.len() == 0
+                    || (post_ops.len() == 1
+                            && post_ops.entry_[0].is_sum()
+                            && one_of(post_ops.entry_[0].sum.dt,
+                                    data_type::undef, f32)),
+            VERBOSE_UNSUPPORTED_POSTOP);
+
+    matmul_helper_t helper(src_d, weights_d, dst_d);
+    VDISPATCH_MATMUL(helper.src_batch() == helper.batch()
+                    && helper.wei_batch() == helper.batch(),
+            VERBOSE_UNSUPPORTED_FEATURE, "broadcast of batch dimensions");
+
+    brg.batch = helper.batch();
+    brg.M = helper.M();
+    brg.K = helper.K();
+    brg.N = helper.N();
+    brg.svl_s = static_cast<int>(get_sme_length() / sizeof(float));
+    brg.m_blk = 2 * brg.svl_s;
+    brg.n_blk = 2 * brg.svl_s;
+    brg.with_sum_po = post_ops.len() == 1;
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+void jit_sme_matmul_t::pd_t::init_scratchpad() {
+    // A block of src packed by columns for every thread.
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book<float>(key_matmul_src_trans,
+            static_cast<size_t>(brg.K) * brg.m_blk * dnnl_get_max_threads());
+}
+
+jit_sme_matmul_t::jit_sme_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+jit_sme_matmul_t::~jit_sme_matmul_t() = default;
+
+status_t jit_sme_matmul_t::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(
+            kernel_, new jit_sme_f32_matmul_kernel_t(pd()->get_b())));
+    return kernel_->create_kernel();
+}
+
+status_t jit_sme_matmul_t::execute(const exec_ctx_t &ctx) const {
+    const auto *src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    const auto *weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    auto *dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const auto &b = pd()->get_b();
+    const dim_t M = b.M, K = b.K, N = b.N;
+    if (b.batch * M * N == 0) return status::success;
+
+    auto *a_pack_base = ctx.get_scratchpad_grantor().get<float>(
+            key_matmul_src_trans);
+
+    const dim_t nb_m = div_up(M, b.m_blk);
+    const dim_t nb_n = div_up(N, b.n_blk);
+    const dim_t work_amount = b.batch * nb_m * nb_n;
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        float *a_pack = a_pack_base + static_cast<size_t>(ithr) * K * b.m_blk;
+        // Blocks of dst of the same rows are adjacent in the work order, so a
+        // packed block of src is reused for all of them.
+        dim_t packed_mb = -1;
+
+        dim_t mb {0}, nb {0}, ib {0};
+        nd_iterator_init(start, ib, b.batch, mb, nb_m, nb, nb_n);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            const dim_t m0 = mb * b.m_blk;
+            const dim_t n0 = nb * b.n_blk;
+            const dim_t m = nstl::min<dim_t>(b.m_blk, M - m0);
+            const dim_t n = nstl::min<dim_t>(b.n_blk, N - n0);
+
+            const dim_t cur_mb = ib * nb_m + mb;
+            if (cur_mb != packed_mb) {
+                const float *a = src + (ib * M + m0) * K;
+                for (dim_t k = 0; k < K; ++k) {
+                    float *a_col = a_pack + k * b.m_blk;
+                    for (dim_t i = 0; i < m; ++i)
+                        a_col[i] = a[i * K + k];
+                    for (dim_t i = m; i < b.m_blk; ++i)
+                        a_col[i] = 0.f;
+                }
+                packed_mb = cur_mb;
+            }
+
+            jit_sme_f32_matmul_kernel_t::call_params_t p;
+            p.a = a_pack;
+            p.b = weights + ib * K * N + n0;
+            p.c = dst + (ib * M + m0) * N + n0;
+            p.K = K;
+            p.m = m;
+            p.n = n;
+            p.ldb = N;
+            p.ldc = N;
+            (*kernel_)(&p);
+
+            nd_iterator_step(ib, b.batch, mb, nb_m, nb, nb_n);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace matmul
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,81 @@
+/*******************************************************************************
+* Copyright 2025 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_MATMUL_JIT_SME_MATMUL_HPP
+#define CPU_AARCH64_MATMUL_JIT_SME_MATMUL_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+namespace matmul {
+
+struct jit_sme_f32_matmul_kernel_t;
+
+struct brg_sme_t {
+    dim_t batch, M, K, N;
+    // Streaming vector length in f32 elements. A block of dst is
+    // m_blk x n_blk = (2 * svl_s) x (2 * svl_s) and is accumulated in the four
+    // 32-bit ZA tiles.
+    int svl_s;
+    int m_blk, n_blk;
+    bool with_sum_po;
+};
+
+// f32 matmul that accumulates outer products of src columns and weights rows
+// in the ZA array in the SME streaming mode.
+struct jit_sme_matmul_t : public primitive_t {
+    struct pd_t : public dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using ::dnnl::impl::cpu::matmul::cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T("jit:sme", jit_sme_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        const brg_sme_t &get_b() const { return brg; }
+
+    private:
+        bool formats_ok() const;
+        void init_scratchpad();
+
+        brg_sme_t brg;
+    };
+
+    jit_sme_matmul_t(const pd_t *apd);
+    ~jit_sme_matmul_t() override;
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    std::unique_ptr<jit_sme_f32_matmul_kernel_t> kernel_;
+};
+
+} // namespace matmul
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+#endif
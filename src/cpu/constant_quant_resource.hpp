@@ -0,0 +1,88 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CONSTANT_QUANT_RESOURCE_HPP
+#define CPU_CONSTANT_QUANT_RESOURCE_HPP
+
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#include "common/primitive.hpp"
+#include "common/primitive_exec_types.hpp"
+#include "common/resource.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Keeps values derived from quantization parameters, e.g. combined scales or
+// zero-point compensation, across executions of a primitive created with the
+// constant quantization attribute. The values are computed by the first
+// execution of the primitive object and copied out of the scratchpad.
+struct constant_quant_resource_t : public resource_t {
+    enum slot_t { scales = 0, zp_comp, n_slots };
+
+    // Returns `size` bytes produced by `compute()` on the first call for the
+    // slot, and the kept copy of them on subsequent calls.
+    template <typename T, typename F>
+    const T *get(slot_t slot, size_t size, const F &compute) const {
+        auto &e = entries_[slot];
+        std::call_once(e.once_, [&]() {
+            const T *values = compute();
+            e.data_.resize(size);
+            if (size) std::memcpy(e.data_.data(), values, size);
+        });
+        return reinterpret_cast<const T *>(e.data_.data());
+    }
+
+    // Adds the resource for primitives created with the constant
+    // quantization attribute.
+    static status_t create(const primitive_t *p, resource_mapper_t &mapper) {
+        if (!p->pd()->attr()->constant_quant_ || mapper.has_resource(p))
+            return status::success;
+        auto r = utils::make_unique<constant_quant_resource_t>();
+        if (!r) return status::out_of_memory;
+        mapper.add(p, std::move(r));
+        return status::success;
+    }
+
+    // Returns the resource of the primitive or nullptr if its quantization
+    // parameters are not constant. A nested primitive has no resource when
+    // its parent doesn't create one for it.
+    static const constant_quant_resource_t *get(
+            const primitive_t *p, const exec_ctx_t &ctx) {
+        const auto *mapper = ctx.get_resource_mapper();
+        if (!p->pd()->attr()->constant_quant_ || !mapper
+                || !mapper->has_resource(p))
+            return nullptr;
+        return mapper->get<constant_quant_resource_t>(p);
+    }
+
+private:
+    struct entry_t {
+        std::once_flag once_;
+        std::vector<char> data_;
+    };
+    mutable entry_t entries_[n_slots];
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
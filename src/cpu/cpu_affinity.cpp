@@ -0,0 +1,176 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "common/utils.hpp"
+
+#include "cpu/cpu_affinity.hpp"
+#include "cpu/numa.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace affinity {
+
+namespace {
+
+// Parses a list such as "0-3,8". Returns false if the list is malformed.
+bool parse_cpu_list(const std::string &s, std::vector<int> &cpus) {
+    cpus.clear();
+    size_t pos = 0;
+    while (pos < s.size()) {
+        size_t end = s.find(',', pos);
+        if (end == std::string::npos) end = s.size();
+        const std::string tok = s.substr(pos, end - pos);
+        const size_t dash = tok.find('-');
+        const std::string first_s = tok.substr(0, dash);
+        const std::string last_s
+                = dash == std::string::npos ? first_s : tok.substr(dash + 1);
+        const auto is_number = [](const std::string &n) {
+            return !n.empty() && n.size() < 8
+                    && std::all_of(n.begin(), n.end(),
+                            [](unsigned char c) { return std::isdigit(c); });
+        };
+        if (!is_number(first_s) || !is_number(last_s)) return false;
+        const int first = std::stoi(first_s);
+        const int last = std::stoi(last_s);
+        if (first > last) return false;
+        for (int cpu = first; cpu <= last; cpu++)
+            cpus.push_back(cpu);
+        pos = end + 1;
+    }
+    return !cpus.empty();
+}
+
+// Resolves `policy` into the ordered list of CPUs. Returns false if the
+// policy is malformed.
+bool resolve(const std::string &policy, std::vector<int> &cpus) {
+    cpus.clear();
+    if (policy.empty() || policy == "none") return true;
+
+    const auto process_cpus = get_process_cpus();
+    if (policy == "compact") {
+        cpus = process_cpus;
+        return true;
+    }
+
+    if (policy == "scatter") {
+        std::vector<std::vector<int>> node_cpus(numa::get_num_nodes());
+        for (int cpu : process_cpus)
+            node_cpus[numa::get_cpu_node(cpu)].push_back(cpu);
+        for (size_t k = 0; cpus.size() < process_cpus.size(); k++)
+            for (const auto &n : node_cpus)
+                if (k < n.size()) cpus.push_back(n[k]);
+        return true;
+    }
+
+    const std::string numa_prefix = "numa:";
+    if (policy.compare(0, numa_prefix.size(), numa_prefix) == 0) {
+        std::vector<int> nodes;
+        if (!parse_cpu_list(policy.substr(numa_prefix.size()), nodes)
+                || nodes.size() != 1)
+            return false;
+        for (int cpu : process_cpus)
+            if (numa::get_cpu_node(cpu) == nodes[0]) cpus.push_back(cpu);
+        return true;
+    }
+
+    std::vector<int> list;
+    if (!parse_cpu_list(policy, list)) return false;
+    for (int cpu : list)
+        if (std::find(process_cpus.begin(), process_cpus.end(), cpu)
+                != process_cpus.end())
+            cpus.push_back(cpu);
+    return true;
+}
+
+set_once_before_first_get_setting_t<std::string> &policy_setting() {
+    static set_once_before_first_get_setting_t<std::string> setting(
+            getenv_string_user("CPU_AFFINITY"));
+    return setting;
+}
+
+} // namespace
+
+status_t set_policy(const char *policy) {
+    if (!policy || !*policy) return status::invalid_arguments;
+    std::string p(policy);
+    std::transform(p.begin(), p.end(), p.begin(),
+            [](unsigned char c) { return (char)std::tolower(c); });
+    std::vector<int> cpus;
+    if (!resolve(p, cpus)) return status::invalid_arguments;
+    return policy_setting().set(p) ? status::success : status::runtime_error;
+}
+
+const std::vector<int> &get_cpus() {
+    static const std::vector<int> cpus = [] {
+        std::vector<int> c;
+        // A malformed environment value disables pinning.
+        if (!resolve(policy_setting().get(), c)) c.clear();
+        return c;
+    }();
+    return cpus;
+}
+
+std::vector<int> get_process_cpus() {
+    std::vector<int> cpus;
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+            if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+    }
+#endif
+    return cpus;
+}
+
+void pin_to_cpu(int cpu) {
+#if defined(__linux__)
+    if (cpu < 0 || cpu >= CPU_SETSIZE) return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    UNUSED(cpu);
+#endif
+}
+
+void restrict_current_thread() {
+#if defined(__linux__)
+    const auto &cpus = get_cpus();
+    if (cpus.empty()) return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus)
+        CPU_SET(cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#endif
+}
+
+} // namespace affinity
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,58 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_AFFINITY_HPP
+#define CPU_CPU_AFFINITY_HPP
+
+#include <vector>
+
+#include "common/c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace affinity {
+
+// Placement of the threads created by the library. The policy is set with
+// ONEDNN_CPU_AFFINITY or set_policy() and is fixed on the first use:
+// - none: threads are not pinned (default).
+// - compact: threads are pinned to consecutive CPUs of the process mask.
+// - scatter: threads are pinned round-robin across the NUMA nodes.
+// - numa:<node>: threads are pinned to the CPUs of the node, compactly.
+// - <cpu list>, e.g. 0-3,8: threads are pinned to the listed CPUs in order.
+// The CPUs outside the process affinity mask are ignored.
+status_t set_policy(const char *policy);
+
+// Returns the CPUs in the order the policy assigns them to threads, or an
+// empty vector when threads are not pinned.
+const std::vector<int> &get_cpus();
+
+// Returns the CPUs of the process affinity mask.
+std::vector<int> get_process_cpus();
+
+// Pins the calling thread to `cpu`. Does nothing for negative values.
+void pin_to_cpu(int cpu);
+
+// Restricts the calling thread to the CPUs of the policy. Used for the
+// auxiliary threads that don't take part in parallel computations.
+void restrict_current_thread();
+
+} // namespace affinity
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,104 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "cpu/cpu_affinity.hpp"
+#include "cpu/cpu_async_queue.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+async_queue_t::~async_queue_t() {
+    wait();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    if (!worker_.joinable()) return;
+    // Joining threads is not allowed during process termination on some
+    // platforms, leave the thread to the OS in that case.
+    if (is_destroying_cache_safe())
+        worker_.join();
+    else
+        worker_.detach();
+}
+
+status_t async_queue_t::submit(task_t &&task, drop_handler_t &&on_drop) {
+    if (!task) return status::invalid_arguments;
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stop_) return status::runtime_error;
+    if (!worker_.joinable()) {
+        try {
+            worker_ = std::thread(&async_queue_t::run, this);
+        } catch (...) { return status::out_of_memory; }
+    }
+    tasks_.push_back({std::move(task), std::move(on_drop)});
+    pending_++;
+    cv_.notify_all();
+    return status::success;
+}
+
+status_t async_queue_t::wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (std::this_thread::get_id() == worker_.get_id())
+        return status::success;
+    cv_.wait(lock, [this] { return pending_ == 0; });
+    // Report a failure once, the stream can be reused after it.
+    const status_t status = status_;
+    status_ = status::success;
+    return status;
+}
+
+bool async_queue_t::in_task() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return std::this_thread::get_id() == worker_.get_id();
+}
+
+void async_queue_t::run() {
+    affinity::restrict_current_thread();
+    for (;;) {
+        entry_t entry;
+        status_t failed_status = status::success;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+            if (tasks_.empty()) return;
+            entry = std::move(tasks_.front());
+            tasks_.pop_front();
+            failed_status = status_;
+        }
+        if (failed_status != status::success) {
+            // Drop the tasks depending on the failed one.
+            if (entry.on_drop) entry.on_drop(failed_status);
+            std::lock_guard<std::mutex> lock(mutex_);
+            pending_--;
+            if (pending_ == 0) cv_.notify_all();
+            continue;
+        }
+        const status_t status = entry.task();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (status_ == status::success) status_ = status;
+            pending_--;
+            if (pending_ == 0) cv_.notify_all();
+        }
+    }
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
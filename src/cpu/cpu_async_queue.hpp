@@ -0,0 +1,82 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_ASYNC_QUEUE_HPP
+#define CPU_CPU_ASYNC_QUEUE_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// In-order queue of tasks executed by a dedicated dispatcher thread. Backs
+// non-blocking CPU streams: a task is the execution of one primitive or of
+// one compiled partition, so each task depends on all the tasks submitted
+// before it.
+//
+// The first failed task status is kept and returned by wait(). The tasks
+// submitted after a failure are dropped, their drop handlers are called with
+// the failed status instead.
+struct async_queue_t {
+    using task_t = std::function<status_t()>;
+    using drop_handler_t = std::function<void(status_t)>;
+
+    async_queue_t() = default;
+    ~async_queue_t();
+
+    // Enqueues a task and returns immediately.
+    status_t submit(task_t &&task, drop_handler_t &&on_drop = nullptr);
+
+    // Blocks until all the submitted tasks complete. Returns immediately
+    // when called from a task, because the preceding tasks are complete.
+    status_t wait();
+
+    // Returns true when called from a task.
+    bool in_task();
+
+private:
+    struct entry_t {
+        task_t task;
+        drop_handler_t on_drop;
+    };
+
+    void run();
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<entry_t> tasks_;
+    // Number of submitted tasks that didn't complete yet.
+    size_t pending_ = 0;
+    status_t status_ = status::success;
+    bool stop_ = false;
+    std::thread worker_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(async_queue_t);
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
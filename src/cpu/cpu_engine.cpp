@@ -17,13 +17,19 @@
 #include <assert.h>
 
 #include "common/memory.hpp"
+#include "common/serialization.hpp"
 #include "common/stream_impl.hpp"
 #include "common/type_helpers.hpp"
 
 #include "cpu/cpu_engine.hpp"
+#include "cpu/cpu_mapped_memory_storage.hpp"
 #include "cpu/cpu_memory_storage.hpp"
 #include "cpu/cpu_stream.hpp"
 
+#if DNNL_X64
+#include "cpu/x64/cpu_isa_traits.hpp"
+#endif
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -44,11 +50,36 @@ status_t cpu_engine_t::create_memory_storage(
     return status::success;
 }
 
+status_t cpu_engine_t::create_mapped_memory_storage(memory_storage_t **storage,
+        int fd, size_t offset, size_t size, unsigned map_flags) {
+    assert(runtime_kind() != runtime_kind::sycl);
+    if (runtime_kind() == runtime_kind::sycl) return status::unimplemented;
+
+    auto _storage = new cpu_mapped_memory_storage_t(this);
+    if (_storage == nullptr) return status::out_of_memory;
+    status_t status = _storage->init_map(fd, offset, size, map_flags);
+    if (status != status::success) {
+        delete _storage;
+        return status;
+    }
+    *storage = _storage;
+    return status::success;
+}
+
 status_t cpu_engine_t::create_stream(
         stream_t **stream, impl::stream_impl_t *stream_impl) {
     return safe_ptr_assign(*stream, new cpu_stream_t(this, stream_impl));
 }
 
+status_t cpu_engine_t::serialize_device(serialization_stream_t &sstream) const {
+    // JIT code stored in a cache blob is only valid for the ISA it was
+    // generated for.
+#if DNNL_X64
+    sstream.append(x64::get_max_cpu_isa());
+#endif
+    return status::success;
+}
+
 engine_t *get_service_engine() {
     static std::unique_ptr<engine_t, engine_deleter_t> cpu_engine;
     static std::once_flag initialized;
@@ -26,6 +26,7 @@
 #include "common/engine.hpp"
 #include "common/engine_id.hpp"
 #include "common/impl_list_item.hpp"
+#include "common/sdpa_types.hpp"
 
 #include "cpu/platform.hpp"
 
@@ -59,6 +60,7 @@ DECLARE_IMPL_LIST(binary);
 DECLARE_IMPL_LIST(convolution);
 DECLARE_IMPL_LIST(deconvolution);
 DECLARE_IMPL_LIST(eltwise);
+DECLARE_IMPL_LIST(gather);
 DECLARE_IMPL_LIST(group_normalization);
 DECLARE_IMPL_LIST(inner_product);
 DECLARE_IMPL_LIST(layer_normalization);
@@ -69,8 +71,11 @@ DECLARE_IMPL_LIST(prelu);
 DECLARE_IMPL_LIST(reduction);
 DECLARE_IMPL_LIST(resampling);
 DECLARE_IMPL_LIST(rnn);
+DECLARE_IMPL_LIST(sdpa);
 DECLARE_IMPL_LIST(shuffle);
 DECLARE_IMPL_LIST(softmax);
+DECLARE_IMPL_LIST(topk);
+DECLARE_IMPL_LIST(optimizer);
 
 #undef DECLARE_IMPL_LIST
 
@@ -79,6 +84,7 @@ public:
     static const impl_list_item_t *get_concat_implementation_list();
     static const impl_list_item_t *get_reorder_implementation_list(
             const memory_desc_t *src_md, const memory_desc_t *dst_md);
+    static const impl_list_item_t *get_split_implementation_list();
     static const impl_list_item_t *get_sum_implementation_list();
 
     static const impl_list_item_t *get_implementation_list(
@@ -95,6 +101,7 @@ public:
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(gather);
             CASE(group_normalization);
             CASE(inner_product);
             CASE(layer_normalization);
@@ -105,9 +112,11 @@ public:
             CASE(reduction);
             CASE(resampling);
             CASE(rnn);
+            CASE(sdpa);
             CASE(shuffle);
             CASE(softmax);
-            case primitive_kind::sdpa: return empty_list;
+            CASE(topk);
+            CASE(optimizer);
             default: assert(!"unknown primitive kind"); return empty_list;
         }
 #undef CASE
@@ -124,6 +133,9 @@ public:
     status_t create_memory_storage(memory_storage_t **storage, unsigned flags,
             size_t size, void *handle) override;
 
+    status_t create_mapped_memory_storage(memory_storage_t **storage, int fd,
+            size_t offset, size_t size, unsigned map_flags) override;
+
     status_t create_stream(
             stream_t **stream, impl::stream_impl_t *stream_impl) override;
 
@@ -137,6 +149,9 @@ public:
         return cpu_engine_impl_list_t::get_reorder_implementation_list(
                 src_md, dst_md);
     }
+    const impl_list_item_t *get_split_implementation_list() const override {
+        return cpu_engine_impl_list_t::get_split_implementation_list();
+    }
     const impl_list_item_t *get_sum_implementation_list() const override {
         return cpu_engine_impl_list_t::get_sum_implementation_list();
     }
@@ -145,6 +160,8 @@ public:
         return cpu_engine_impl_list_t::get_implementation_list(desc);
     }
 
+    status_t serialize_device(serialization_stream_t &sstream) const override;
+
 protected:
     ~cpu_engine_t() override = default;
 };
@@ -0,0 +1,44 @@
+/*******************************************************************************
+* Copyright 2020-2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "cpu/cpu_engine.hpp"
+
+#include "cpu/simple_gather.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+using namespace dnnl::impl::data_type;
+
+// clang-format off
+constexpr impl_list_item_t impl_list[] = REG_GATHER_P({
+    CPU_INSTANCE(simple_gather_t)
+    /* eol */
+    nullptr,
+});
+// clang-format on
+} //namespace
+
+const impl_list_item_t *get_gather_impl_list(const gather_desc_t *desc) {
+    UNUSED(desc);
+    return impl_list;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
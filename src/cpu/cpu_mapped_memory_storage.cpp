@@ -0,0 +1,89 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_mapped_memory_storage.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+cpu_mapped_memory_storage_t::~cpu_mapped_memory_storage_t() {
+#if !defined(_WIN32)
+    if (map_base_) munmap(map_base_, map_size_);
+#endif
+}
+
+status_t cpu_mapped_memory_storage_t::init_map(
+        int fd, size_t offset, size_t size, unsigned map_flags) {
+#if !defined(_WIN32)
+    const unsigned supported_flags
+            = dnnl_memory_map_populate | dnnl_memory_map_prefetch;
+    if (fd < 0 || (map_flags & ~supported_flags) != 0)
+        return status::invalid_arguments;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) return status::invalid_arguments;
+    const size_t file_size = static_cast<size_t>(st.st_size);
+    if (offset > file_size || size > file_size - offset)
+        return status::invalid_arguments;
+
+    if (size == 0)
+        return init(memory_flags_t::use_runtime_ptr, size, nullptr);
+
+    // mmap() requires a page-aligned offset, so the mapping starts at the
+    // page that contains `offset` and the handle points inside it.
+    const long page_size = sysconf(_SC_PAGESIZE);
+    if (page_size <= 0) return status::runtime_error;
+    const size_t map_offset = utils::rnd_dn(offset, (size_t)page_size);
+    const size_t shift = offset - map_offset;
+
+    int mmap_flags = MAP_PRIVATE;
+#if defined(MAP_POPULATE)
+    if (map_flags & dnnl_memory_map_populate) mmap_flags |= MAP_POPULATE;
+#endif
+    void *base = mmap(nullptr, size + shift, PROT_READ | PROT_WRITE,
+            mmap_flags, fd, static_cast<off_t>(map_offset));
+    if (base == MAP_FAILED) return status::out_of_memory;
+
+    map_base_ = base;
+    map_size_ = size + shift;
+
+    if (map_flags & dnnl_memory_map_prefetch)
+        madvise(map_base_, map_size_, MADV_WILLNEED);
+
+    return init(memory_flags_t::use_runtime_ptr, size,
+            reinterpret_cast<uint8_t *>(map_base_) + shift);
+#else
+    UNUSED(fd);
+    UNUSED(offset);
+    UNUSED(size);
+    UNUSED(map_flags);
+    return status::unimplemented;
+#endif
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
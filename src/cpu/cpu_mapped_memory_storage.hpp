@@ -0,0 +1,52 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_MAPPED_MEMORY_STORAGE_HPP
+#define CPU_CPU_MAPPED_MEMORY_STORAGE_HPP
+
+#include "common/c_types_map.hpp"
+
+#include "cpu/cpu_memory_storage.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Memory storage that owns a private mapping of a file region. The mapping
+// is released with the storage; clones and sub-storages do not own it, the
+// same as for the storages allocated by the library.
+class cpu_mapped_memory_storage_t : public cpu_memory_storage_t {
+public:
+    cpu_mapped_memory_storage_t(engine_t *engine)
+        : cpu_memory_storage_t(engine) {}
+    ~cpu_mapped_memory_storage_t() override;
+
+    // Maps `size` bytes of file `fd` starting at `offset`. `map_flags` is a
+    // combination of dnnl_memory_map_flags_t values.
+    status_t init_map(int fd, size_t offset, size_t size, unsigned map_flags);
+
+private:
+    void *map_base_ = nullptr;
+    size_t map_size_ = 0;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(cpu_mapped_memory_storage_t);
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
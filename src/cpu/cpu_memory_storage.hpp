@@ -25,6 +25,7 @@
 #include "common/stream.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/huge_pages.hpp"
 #include "cpu/platform.hpp"
 
 namespace dnnl {
@@ -61,6 +62,14 @@ public:
         return get_data_handle(mapped_ptr);
     }
 
+    status_t map_data_range(void **mapped_ptr, stream_t *stream,
+            size_t offset, size_t size) const override {
+        CHECK(map_data(mapped_ptr, stream, size));
+        if (*mapped_ptr)
+            *mapped_ptr = reinterpret_cast<uint8_t *>(*mapped_ptr) + offset;
+        return status::success;
+    }
+
     status_t unmap_data(void *mapped_ptr, stream_t *stream) const override {
         UNUSED(mapped_ptr);
         if (stream != nullptr && stream->engine()->index() != engine()->index())
@@ -87,6 +96,12 @@ public:
 
 protected:
     status_t init_allocate(size_t size) override {
+        void *huge_ptr = huge_pages::malloc(size);
+        if (huge_ptr) {
+            data_ = decltype(data_)(huge_ptr, huge_pages::free);
+            return status::success;
+        }
+
         void *ptr = malloc(size, platform::get_cache_line_size());
         if (!ptr) return status::out_of_memory;
         data_ = decltype(data_)(ptr, destroy);
@@ -0,0 +1,105 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+
+#include "common/primitive_exec_types.hpp"
+#include "common/primitive_desc_iface.hpp"
+#include "common/primitive_iface.hpp"
+
+#include "cpu/cpu_stream.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+status_t cpu_stream_t::enqueue_primitive(
+        const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
+    // The primitives executed by a task run synchronously, the task is
+    // already ordered after the preceding work.
+    if (!queue_ || queue_->in_task())
+        return stream_t::enqueue_primitive(primitive_iface, ctx);
+
+    dnnl::threadpool_interop::threadpool_iface *tp = nullptr;
+    CHECK(get_threadpool(&tp));
+
+    // The primitive is kept alive until its execution completes. The memory
+    // objects are owned by the user and must outlive stream::wait().
+    auto *p = const_cast<primitive_iface_t *>(primitive_iface);
+    p->retain();
+    std::shared_ptr<primitive_iface_t> primitive(
+            p, [](primitive_iface_t *p) { p->release(); });
+
+    // The global scratchpad is thread local and is not available on the
+    // dispatcher thread, so the task uses the scratchpad of the stream.
+    size_t scratchpad_size = 0;
+    if (primitive->use_global_scratchpad()) {
+        const auto *pd = primitive->pd()->impl().get();
+        scratchpad_size = pd->scratchpad_size(pd->attr()->scratchpad_mode_);
+    }
+
+    // The per-thread state of the submitting thread is restored on the
+    // dispatcher thread.
+    const int max_threads_limit = get_max_threads_limit();
+    auto task = [this, primitive, scratchpad_size, ctx, tp,
+                        max_threads_limit]() mutable {
+        if (scratchpad_size > 0) {
+            const auto *storage = get_task_scratchpad(scratchpad_size);
+            if (!storage) return status::out_of_memory;
+            ctx.set_scratchpad_storage(storage);
+        }
+        max_threads_limit_guard_t max_threads_guard(max_threads_limit);
+        threadpool_utils::activate_threadpool(tp);
+        const status_t status = primitive->execute(ctx);
+        threadpool_utils::deactivate_threadpool();
+        return status;
+    };
+    return queue_->submit(std::move(task));
+}
+
+const memory_storage_t *cpu_stream_t::get_task_scratchpad(size_t size) {
+    if (!task_scratchpad_ || task_scratchpad_->size() < size) {
+        // Free the old buffer first to lower the peak footprint.
+        task_scratchpad_.reset();
+        task_scratchpad_.reset(create_scratchpad(engine(), size, false));
+    }
+    return task_scratchpad_ ? task_scratchpad_->get_memory_storage() : nullptr;
+}
+
+status_t cpu_stream_t::enqueue_task(const std::function<status_t()> &task,
+        const std::function<void(status_t)> &on_drop) {
+    if (!queue_ || queue_->in_task()) return stream_t::enqueue_task(task);
+
+    dnnl::threadpool_interop::threadpool_iface *tp = nullptr;
+    CHECK(get_threadpool(&tp));
+
+    const int max_threads_limit = get_max_threads_limit();
+    auto wrapped_task = [task, tp, max_threads_limit]() {
+        max_threads_limit_guard_t max_threads_guard(max_threads_limit);
+        threadpool_utils::activate_threadpool(tp);
+        const status_t status = task();
+        threadpool_utils::deactivate_threadpool();
+        return status;
+    };
+    return queue_->submit(std::move(wrapped_task),
+            std::function<void(status_t)>(on_drop));
+}
+#endif
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
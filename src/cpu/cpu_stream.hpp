@@ -25,8 +25,12 @@
 
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/scratchpad.hpp"
 #include "common/stream.hpp"
 
+#include "cpu/cpu_async_queue.hpp"
+#include "cpu/native_threadpool.hpp"
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -37,6 +41,9 @@ struct cpu_stream_t : public stream_t {
     ~cpu_stream_t() override = default;
 
     dnnl::impl::status_t wait() override {
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+        if (queue_) return queue_->wait();
+#endif
         // CPU execution is synchronous so return immediately
         return dnnl::impl::status::success;
     }
@@ -44,17 +51,45 @@ struct cpu_stream_t : public stream_t {
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     cpu_stream_t(engine_t *engine,
             dnnl::threadpool_interop::threadpool_iface *threadpool)
-        : stream_t(engine, new impl::stream_impl_t(threadpool)) {}
+        : stream_t(engine, new impl::stream_impl_t(threadpool)) {
+        using namespace dnnl::threadpool_interop;
+        if (threadpool
+                && (threadpool->get_flags() & threadpool_iface::NON_BLOCKING))
+            queue_.reset(new async_queue_t());
+    }
+
+    // Non-blocking streams return once the execution is enqueued.
+    dnnl::impl::status_t enqueue_primitive(
+            const primitive_iface_t *primitive_iface,
+            dnnl::impl::exec_ctx_t &ctx) override;
+
+    dnnl::impl::status_t enqueue_task(
+            const std::function<dnnl::impl::status_t()> &task,
+            const std::function<void(dnnl::impl::status_t)> &on_drop
+            = nullptr) override;
 
     void before_exec_hook() override {
         dnnl::threadpool_interop::threadpool_iface *tp;
         auto rc = this->get_threadpool(&tp);
+#if defined(DNNL_ENABLE_NATIVE_THREADPOOL)
+        if (rc == status::success && !tp) tp = native_threadpool::get();
+#endif
         if (rc == status::success) threadpool_utils::activate_threadpool(tp);
     }
 
     void after_exec_hook() override {
         threadpool_utils::deactivate_threadpool();
     }
+
+private:
+    // Returns the scratchpad shared by the tasks of a non-blocking stream,
+    // grown to at least `size` bytes if needed. Tasks run one at a time on
+    // the dispatcher thread, so the buffer is reused without locking.
+    const memory_storage_t *get_task_scratchpad(size_t size);
+
+    // Declared before the queue to outlive the tasks using it.
+    std::unique_ptr<scratchpad_t> task_scratchpad_;
+    std::unique_ptr<async_queue_t> queue_;
 #endif
 };
 
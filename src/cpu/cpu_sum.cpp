@@ -19,6 +19,7 @@
 #include "cpu/cpu_engine.hpp"
 
 #include "cpu/ref_sum.hpp"
+#include "cpu/simple_many_inputs_sum.hpp"
 #include "cpu/simple_sum.hpp"
 
 #if DNNL_X64
@@ -50,6 +51,12 @@ constexpr impl_list_item_t cpu_sum_impl_list[] = REG_SUM_P({
         INSTANCE(simple_sum_t<bf16>)
         INSTANCE(simple_sum_t<bf16, f32>)
         INSTANCE(simple_sum_t<f32>)
+        INSTANCE(simple_many_inputs_sum_t<f16>)
+        INSTANCE(simple_many_inputs_sum_t<f16, f32>)
+        INSTANCE(simple_many_inputs_sum_t<bf16>)
+        INSTANCE(simple_many_inputs_sum_t<bf16, f32>)
+        INSTANCE(simple_many_inputs_sum_t<f32>)
+        INSTANCE(simple_many_inputs_sum_t<f32, bf16>)
         INSTANCE(ref_sum_t)
         nullptr,
 });
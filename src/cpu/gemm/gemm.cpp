@@ -40,13 +40,19 @@
 #include "cpu/x64/gemm/f32/jit_avx_gemm_f32.hpp"
 
 #include "cpu/x64/gemm/gemm_driver.hpp"
+#include "cpu/x64/gemm/gemv_driver.hpp"
 
 using namespace dnnl::impl::cpu::x64;
 #elif DNNL_PPC64
 #include "cpu/ppc64/gemm/gemm_driver.hpp"
+#include "cpu/ppc64/ppc64_gemm_f32.hpp"
 using namespace dnnl::impl::cpu::ppc64;
 #elif DNNL_S390X
 #include "cpu/s390x/gemm.h"
+#elif DNNL_RV64
+#if DNNL_RISCV_USE_RVV_INTRINSICS
+#include "cpu/rv64/gemm/rvv_gemm_f32.hpp"
+#endif // DNNL_RISCV_USE_RVV_INTRINSICS
 #endif
 
 namespace dnnl {
@@ -145,6 +151,22 @@ dnnl_status_t extended_sgemm(const char *transa, const char *transb,
     }
 #endif
 
+#if DNNL_PPC64 && defined(__MMA__)
+    {
+        auto status = gemm_f32_ppc64(transa, transb, M, N, K, alpha, A, lda,
+                B, ldb, beta, C, ldc, bias);
+        if (status != dnnl_unimplemented) return status;
+    }
+#endif
+
+#if DNNL_RV64 && DNNL_RISCV_USE_RVV_INTRINSICS
+    {
+        auto status = rv64::rvv_gemm_f32(transa, transb, M, N, K, alpha, A,
+                lda, B, ldb, beta, C, ldc, bias);
+        if (status != dnnl_unimplemented) return status;
+    }
+#endif
+
     return ref_gemm<float>(
             transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, bias);
 }
@@ -304,6 +326,10 @@ dnnl_status_t gemm_bf16bf16f32(const char *transa, const char *transb,
             (const bfloat16 *)A, *lda, (const bfloat16 *)B, *ldb, *beta, C,
             *ldc);
     return dnnl_success;
+#elif defined(__MMA__)
+    status = gemm_bf16bf16f32_ppc64(
+            transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+    if (status != dnnl_unimplemented) return status;
 #endif
 #endif
 
@@ -311,6 +337,42 @@ dnnl_status_t gemm_bf16bf16f32(const char *transa, const char *transb,
             transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
+dnnl_status_t sgemv_batch(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const float *const *A, const dim_t *lda, const float *const *B,
+        const dim_t *ldb, const float *beta, float *const *C, const dim_t *ldc,
+        dim_t batch) {
+#if DNNL_X64 && !__BUILD_GEMM_NONE && !defined(USE_CBLAS)
+    if (batch <= 0 || utils::any_null(A, B, C)) return dnnl_unimplemented;
+    dnnl_status_t status = check_gemm_input(transa, transb, M, N, K, A[0],
+            lda, B[0], ldb, C[0], ldc, alpha, beta, false);
+    if (status != dnnl_success) return status;
+
+    if (mayiuse(sse41))
+        return gemv_batch_driver(transa, transb, M, N, K, alpha, A, lda, B,
+                ldb, beta, C, ldc, batch);
+#endif
+    return dnnl_unimplemented;
+}
+
+dnnl_status_t gemv_bf16bf16f32_batch(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const bfloat16_t *const *A, const dim_t *lda,
+        const bfloat16_t *const *B, const dim_t *ldb, const float *beta,
+        float *const *C, const dim_t *ldc, dim_t batch) {
+#if DNNL_X64 && !__BUILD_GEMM_NONE
+    if (batch <= 0 || utils::any_null(A, B, C)) return dnnl_unimplemented;
+    dnnl_status_t status = check_gemm_input(transa, transb, M, N, K, A[0],
+            lda, B[0], ldb, C[0], ldc, alpha, beta, false);
+    if (status != dnnl_success) return status;
+
+    if (mayiuse(avx512_core) && __BUILD_GEMM_AVX512)
+        return gemv_batch_driver(transa, transb, M, N, K, alpha, A, lda, B,
+                ldb, beta, C, ldc, batch);
+#endif
+    return dnnl_unimplemented;
+}
+
 } // namespace cpu
 } // namespace impl
 } // namespace dnnl
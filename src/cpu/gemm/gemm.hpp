@@ -74,6 +74,21 @@ dnnl_status_t gemm_bf16bf16f32(const char *transa, const char *transb,
         const bfloat16_t *A, const dim_t *lda, const bfloat16_t *B,
         const dim_t *ldb, const float *beta, float *C, const dim_t *ldc);
 
+// Compute a batch of problems with M == 1 or N == 1 sharing everything but the
+// matrices in a single pass over the batch. Return dnnl_unimplemented if there
+// is no batched implementation for the problem.
+dnnl_status_t sgemv_batch(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const float *const *A, const dim_t *lda, const float *const *B,
+        const dim_t *ldb, const float *beta, float *const *C, const dim_t *ldc,
+        dim_t batch);
+
+dnnl_status_t gemv_bf16bf16f32_batch(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const bfloat16_t *const *A, const dim_t *lda,
+        const bfloat16_t *const *B, const dim_t *ldb, const float *beta,
+        float *const *C, const dim_t *ldc, dim_t batch);
+
 #if defined(USE_CBLAS)
 #define GEMM_IMPL_STR "x64:gemm:blas"
 #elif DNNL_X64
@@ -74,37 +74,48 @@ const int32_t *mul_zp_src_comp_from_wei_by_zp_src(const int zp_comp_size,
 }
 
 static zero_point_call_params_t prepare_zp_params(const conv_gemm_conf_t &jcp,
-        const memory_tracking::grantor_t &scratchpad, const int8_t *weights,
+        const memory_tracking::grantor_t &scratchpad,
+        const constant_quant_resource_t *cq_resource, const int8_t *weights,
         const memory_desc_wrapper &weights_md, bool with_groups,
         const int32_t *src_zero_points, const int32_t *dst_zero_points) {
 
-    int32_t *zp_src_comp_pad = nullptr;
+    const int32_t *zp_src_comp_pad = nullptr;
     const int32_t *zp_src_comp = nullptr;
 
     if (jcp.zp.src_exists) {
         const int32_t *zp_src_comp_from_wei = get_src_zp_comp_from_wei(
                 weights, weights_md, jcp.signed_input, jcp.ngroups, jcp.oc);
-        int32_t *zp_src_comp_scratch
-                = scratchpad.get<int32_t>(key_conv_gemm_zp_src_comp);
+        size_t zp_src_comp_scratch_size = 0;
+        int32_t *zp_src_comp_scratch = scratchpad.get<int32_t>(
+                key_conv_gemm_zp_src_comp, &zp_src_comp_scratch_size);
         static constexpr auto cache_line_size
                 = platform::get_cache_line_size() / sizeof(int);
         const auto zp_comp_size = jcp.oc * jcp.ngroups;
-
-        if (jcp.zp.src_is_common) {
-            zp_src_comp = mul_zp_src_comp_from_wei_by_zp_src(zp_comp_size,
-                    zp_src_comp_scratch, zp_src_comp_from_wei,
-                    *src_zero_points);
-        } else
-            zp_src_comp = zp_src_comp_from_wei;
-
-        if (jit_gemm_convolution_utils::padding_exists(jcp)) {
-            const auto shift = jcp.zp.src_is_common
-                    ? utils::rnd_up(zp_comp_size, cache_line_size)
-                    : 0;
-            zp_src_comp_pad = zp_src_comp_scratch + shift;
-            compute_zp_src_comp_pad(jcp, zp_src_comp_pad, src_zero_points,
-                    weights, weights_md, with_groups);
-        }
+        const bool with_pad_comp
+                = jit_gemm_convolution_utils::padding_exists(jcp);
+        const auto shift = jcp.zp.src_is_common
+                ? utils::rnd_up(zp_comp_size, cache_line_size)
+                : 0;
+
+        // Both compensations live in the same scratchpad buffer.
+        auto compute = [&]() -> const int32_t * {
+            if (jcp.zp.src_is_common)
+                mul_zp_src_comp_from_wei_by_zp_src(zp_comp_size,
+                        zp_src_comp_scratch, zp_src_comp_from_wei,
+                        *src_zero_points);
+            if (with_pad_comp)
+                compute_zp_src_comp_pad(jcp, zp_src_comp_scratch + shift,
+                        src_zero_points, weights, weights_md, with_groups);
+            return zp_src_comp_scratch;
+        };
+        const int32_t *zp_src_comp_buf = cq_resource
+                ? cq_resource->get<int32_t>(constant_quant_resource_t::zp_comp,
+                        zp_src_comp_scratch_size, compute)
+                : compute();
+
+        zp_src_comp = jcp.zp.src_is_common ? zp_src_comp_buf
+                                           : zp_src_comp_from_wei;
+        if (with_pad_comp) zp_src_comp_pad = zp_src_comp_buf + shift;
     }
 
     return {src_zero_points, dst_zero_points, zp_src_comp, zp_src_comp_pad};
@@ -131,8 +142,9 @@ status_t gemm_x8s8s32x_convolution_fwd_t::execute_forward(
 
     assert(IMPLICATION(jcp.ow_block != jcp.ow, jcp.oh_block == 1));
 
+    const auto *cq_resource = constant_quant_resource_t::get(this, ctx);
     const zero_point_call_params_t zp = prepare_zp_params(jcp, scratchpad,
-            wei_base, memory_desc_wrapper(pd()->weights_md(0)),
+            cq_resource, wei_base, memory_desc_wrapper(pd()->weights_md(0)),
             this->pd()->with_groups(), src_zero_points, dst_zero_points);
 
     std::atomic<status_t> st(status::success);
@@ -142,8 +154,9 @@ status_t gemm_x8s8s32x_convolution_fwd_t::execute_forward(
     DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
 
     const int wei_scale_mask = pd()->attr()->scales_.get_mask(DNNL_ARG_WEIGHTS);
-    const float *scales = precompute_scales(scratchpad, src_scales, wei_scales,
-            pd()->IC(), pd()->OC(), false, wei_scale_mask > 0, pd()->attr());
+    const float *scales = precompute_scales(scratchpad, cq_resource,
+            src_scales, wei_scales, pd()->IC(), pd()->OC(), false,
+            wei_scale_mask > 0, pd()->attr());
 
     parallel(jcp.nthr, [&](const int ithr, const int nthr) {
         status_t st_thr = execute_forward_thr(ithr, nthr, src_base, wei_base,
@@ -25,6 +25,7 @@
 
 #include "cpu/platform.hpp"
 
+#include "cpu/constant_quant_resource.hpp"
 #include "cpu/cpu_convolution_pd.hpp"
 
 #include "cpu/gemm_convolution_utils.hpp"
@@ -107,6 +108,11 @@ struct gemm_x8s8s32x_convolution_fwd_t : public primitive_t {
         return (pp_ker_) ? pp_ker_->create_kernel() : status::success;
     }
 
+    status_t create_resource(
+            engine_t *engine, resource_mapper_t &mapper) const override {
+        return constant_quant_resource_t::create(this, mapper);
+    }
+
     status_t execute(const exec_ctx_t &ctx) const override {
         return execute_forward(ctx);
     }
@@ -65,7 +65,8 @@ status_t gemm_x8s8s32x_inner_product_fwd_t::execute_forward(
 
     auto scratchpad = ctx.get_scratchpad_grantor();
     const int wei_scale_mask = pd()->attr()->scales_.get_mask(DNNL_ARG_WEIGHTS);
-    const float *scales = precompute_scales(scratchpad, src_scales, wei_scales,
+    const float *scales = precompute_scales(scratchpad,
+            constant_quant_resource_t::get(this, ctx), src_scales, wei_scales,
             IC, OC, false, wei_scale_mask > 0, pd()->attr());
 
     int32_t *acc = pd()->dst_is_acc_
@@ -123,6 +123,11 @@ struct gemm_x8s8s32x_inner_product_fwd_t : public primitive_t {
         return pp_kernel_->create_kernel();
     }
 
+    status_t create_resource(
+            engine_t *engine, resource_mapper_t &mapper) const override {
+        return constant_quant_resource_t::create(this, mapper);
+    }
+
     status_t execute(const exec_ctx_t &ctx) const override {
         return execute_forward(ctx);
     }
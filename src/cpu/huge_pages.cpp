@@ -0,0 +1,137 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include "common/memory_debug.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/huge_pages.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace huge_pages {
+
+namespace {
+
+// The default huge page size on x86_64 and most aarch64 configurations.
+constexpr size_t huge_page_size = size_t(2) << 20;
+
+std::atomic<policy_t> &policy() {
+    static std::atomic<policy_t> p {[] {
+        const std::string s = getenv_string_user("CPU_HUGE_PAGES");
+        if (s == "thp") return policy_t::thp;
+        if (s == "hugetlb") return policy_t::hugetlb;
+        return policy_t::none;
+    }()};
+    return p;
+}
+
+size_t min_size() {
+    static const size_t s
+            = getenv_size_user("CPU_HUGE_PAGES_MIN_SIZE", huge_page_size);
+    return s;
+}
+
+#if defined(__linux__)
+// Sizes of the hugetlbfs mappings, needed to unmap them.
+std::mutex &mappings_mutex() {
+    static std::mutex m;
+    return m;
+}
+
+std::unordered_map<void *, size_t> &mappings() {
+    static std::unordered_map<void *, size_t> m;
+    return m;
+}
+
+void *malloc_thp(size_t size) {
+    void *ptr = nullptr;
+    const size_t alloc_size = utils::rnd_up(size, huge_page_size);
+    if (::posix_memalign(&ptr, huge_page_size, alloc_size) != 0)
+        return nullptr;
+    // The advice is a hint, a failure leaves regular pages.
+    ::madvise(ptr, alloc_size, MADV_HUGEPAGE);
+    return ptr;
+}
+
+void *malloc_hugetlb(size_t size) {
+    const size_t alloc_size = utils::rnd_up(size, huge_page_size);
+    void *ptr = ::mmap(nullptr, alloc_size, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (ptr == MAP_FAILED) return nullptr;
+    std::lock_guard<std::mutex> lock(mappings_mutex());
+    mappings().emplace(ptr, alloc_size);
+    return ptr;
+}
+#endif
+
+} // namespace
+
+policy_t get_policy() {
+    return policy().load(std::memory_order_relaxed);
+}
+
+policy_t set_policy(policy_t p) {
+    return policy().exchange(p);
+}
+
+void *malloc(size_t size) {
+#if defined(__linux__)
+    const policy_t p = get_policy();
+    if (p == policy_t::none || size < min_size()) return nullptr;
+    // Guard pages of the memory debug mode need regular pages.
+    if (memory_debug::is_mem_debug()) return nullptr;
+
+    if (p == policy_t::hugetlb) {
+        void *ptr = malloc_hugetlb(size);
+        if (ptr) return ptr;
+    }
+    return malloc_thp(size);
+#else
+    UNUSED(size);
+    return nullptr;
+#endif
+}
+
+void free(void *ptr) {
+    if (!ptr) return;
+#if defined(__linux__)
+    {
+        std::lock_guard<std::mutex> lock(mappings_mutex());
+        auto it = mappings().find(ptr);
+        if (it != mappings().end()) {
+            ::munmap(ptr, it->second);
+            mappings().erase(it);
+            return;
+        }
+    }
+    ::free(ptr);
+#endif
+}
+
+} // namespace huge_pages
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
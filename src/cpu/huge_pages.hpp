@@ -0,0 +1,59 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_HUGE_PAGES_HPP
+#define CPU_HUGE_PAGES_HPP
+
+#include <cstddef>
+
+#include "common/c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace huge_pages {
+
+// Allocation policy for library-owned CPU buffers, set with the
+// ONEDNN_CPU_HUGE_PAGES environment variable. Only buffers of at least
+// ONEDNN_CPU_HUGE_PAGES_MIN_SIZE bytes are affected.
+enum class policy_t {
+    // Regular allocation.
+    none,
+    // Transparent huge pages: a huge page aligned buffer advised with
+    // MADV_HUGEPAGE.
+    thp,
+    // Explicit huge pages from the hugetlbfs pool. Falls back to `thp` when
+    // the pool is exhausted.
+    hugetlb,
+};
+
+policy_t get_policy();
+
+// Returns a buffer allocated according to the policy or nullptr if the
+// policy doesn't apply to the requested size. The buffer must be released
+// with `free()`.
+void *malloc(size_t size);
+void free(void *ptr);
+
+// Undocumented API for testing. Returns the previous policy.
+policy_t DNNL_API set_policy(policy_t policy);
+
+} // namespace huge_pages
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
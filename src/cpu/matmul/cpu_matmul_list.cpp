@@ -18,14 +18,17 @@
 
 #include "cpu/cpu_engine.hpp"
 
+#include "cpu/matmul/dyn_quant_matmul.hpp"
 #include "cpu/matmul/gemm_bf16_matmul.hpp"
 #include "cpu/matmul/gemm_f32_matmul.hpp"
 #include "cpu/matmul/gemm_x8s8s32x_matmul.hpp"
+#include "cpu/matmul/grouped_matmul.hpp"
 #include "cpu/matmul/ref_matmul.hpp"
 #include "cpu/matmul/ref_matmul_int8.hpp"
 #include "cpu/matmul/ref_sparse_matmul.hpp"
 
 #if DNNL_X64
+#include "cpu/x64/matmul/brgemm_bsr_matmul.hpp"
 #include "cpu/x64/matmul/brgemm_matmul.hpp"
 #include "cpu/x64/matmul/jit_uni_sparse_matmul.hpp"
 using namespace dnnl::impl::cpu::x64::matmul;
@@ -34,6 +37,7 @@ using namespace dnnl::impl::cpu::x64;
 #include "cpu/aarch64/matmul/brgemm_matmul.hpp"
 #include "cpu/aarch64/matmul/jit_bf16_matmul.hpp"
 #include "cpu/aarch64/matmul/jit_int8_matmul.hpp"
+#include "cpu/aarch64/matmul/jit_sme_matmul.hpp"
 #ifdef DNNL_AARCH64_USE_ACL
 #include "cpu/aarch64/matmul/acl_lowp_matmul.hpp"
 #include "cpu/aarch64/matmul/acl_lowp_matmul_sq.hpp"
@@ -54,6 +58,8 @@ using namespace dnnl::impl::cpu::matmul;
 
 // clang-format off
 constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
+        CPU_INSTANCE(dyn_quant_matmul_t)
+        CPU_INSTANCE_AARCH64(jit_sme_matmul_t)
         CPU_INSTANCE_AARCH64(brgemm_matmul_t<sve_512>)
         CPU_INSTANCE_AARCH64_ACL(acl_lowp_matmul_sq_t)
         CPU_INSTANCE_AARCH64_ACL(acl_lowp_matmul_t)
@@ -78,16 +84,23 @@ constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
         CPU_INSTANCE_AVX2(brgemm_matmul_t<avx2>)
         CPU_INSTANCE(ref_matmul_t)
         CPU_INSTANCE(ref_matmul_int8_t)
+        CPU_INSTANCE_X64(brgemm_bsr_matmul_t)
         CPU_INSTANCE_X64(jit_uni_sparse_matmul_t)
         CPU_INSTANCE(ref_sparse_matmul_t)
         /* eol */
         nullptr,
 });
+
+constexpr impl_list_item_t grouped_impl_list[] = REG_MATMUL_P({
+        CPU_INSTANCE(grouped_matmul_t)
+        /* eol */
+        nullptr,
+});
 // clang-format on
 } // namespace
 
 const impl_list_item_t *get_matmul_impl_list(const matmul_desc_t *desc) {
-    UNUSED(desc);
+    if (desc->group_offsets_desc.ndims != 0) return grouped_impl_list;
     return impl_list;
 }
 
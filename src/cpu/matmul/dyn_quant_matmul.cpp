@@ -0,0 +1,332 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "common/dnnl_thread.hpp"
+#include "common/dnnl_traits.hpp"
+#include "common/memory.hpp"
+#include "common/primitive_desc_iterator.hpp"
+#include "common/tag_traits.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_engine.hpp"
+#include "cpu/simple_q10n.hpp"
+
+#include "cpu/matmul/dyn_quant_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+namespace {
+
+// Quantizes every row of a dense source to s8 with a symmetric scale and
+// stores the dequantization scale of the row. The scale of a row is computed
+// from its absolute maximum unless the source scales are given, in which case
+// row `m` uses `src_scales[m % scales_period]`.
+template <data_type_t src_dt>
+void quantize_rows(const void *src, int8_t *qsrc, float *scales, dim_t MB,
+        dim_t K, const float *src_scales, dim_t scales_period) {
+    using src_t = typename prec_traits_t<src_dt>::type;
+    const auto *s = static_cast<const src_t *>(src);
+    const float qmax = static_cast<float>(nstl::numeric_limits<int8_t>::max());
+
+    parallel_nd(MB, [&](dim_t m) {
+        const src_t *s_row = s + m * K;
+        int8_t *q_row = qsrc + m * K;
+
+        float scale = 0.f;
+        if (src_scales) {
+            scale = src_scales[m % scales_period];
+        } else {
+            float amax = 0.f;
+            PRAGMA_OMP_SIMD(reduction(max : amax))
+            for (dim_t k = 0; k < K; k++)
+                amax = nstl::max(
+                        amax, std::fabs(static_cast<float>(s_row[k])));
+            scale = amax / qmax;
+        }
+
+        const float inv_scale = scale > 0.f ? 1.f / scale : 0.f;
+        PRAGMA_OMP_SIMD()
+        for (dim_t k = 0; k < K; k++)
+            q_row[k] = q10n::saturate_and_round<int8_t>(
+                    static_cast<float>(s_row[k]) * inv_scale);
+        scales[m] = scale;
+    });
+}
+
+} // namespace
+
+status_t dyn_quant_matmul_t::pd_t::set_default_formats() {
+    const format_tag_t tag = get_abx_tag(ndims());
+    if (src_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(src_md_, tag));
+    if (weights_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(weights_md_, tag));
+    if (dst_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(dst_md_, tag));
+    if (with_bias() && bias_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(bias_md_, tag));
+    return status::success;
+}
+
+status_t dyn_quant_matmul_t::pd_t::init_nested_attr(
+        primitive_attr_t &mm_attr) const {
+    mm_attr.src_dyn_quant_dt_ = data_type::undef;
+    // The source scales are applied with the row scales.
+    CHECK(mm_attr.scales_.set(DNNL_ARG_SRC, default_quant_entry()));
+
+    // Weights scales are either common or per N, the nested weights have
+    // three dimensions.
+    const auto &sc = attr()->scales_;
+    if (!sc.has_default_values(DNNL_ARG_WEIGHTS)) {
+        const int mask = sc.get_mask(DNNL_ARG_WEIGHTS) ? 1 << 2 : 0;
+        CHECK(mm_attr.scales_.set(DNNL_ARG_WEIGHTS, mask,
+                sc.get_data_type(DNNL_ARG_WEIGHTS), 0, {}));
+    }
+
+    // The row scales and the bias must be applied before the user post-ops.
+    post_ops_t po;
+    CHECK(po.append_binary(alg_kind::binary_mul, &scales_md_));
+    if (with_bias()) CHECK(po.append_binary(alg_kind::binary_add, &mm_bia_md_));
+    for (const auto &e : attr()->post_ops_.entry_)
+        po.entry_.push_back(e);
+    return mm_attr.set_post_ops(po);
+}
+
+status_t dyn_quant_matmul_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    VDISPATCH_MATMUL(attr()->src_dyn_quant_dt_ == s8, VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(is_dense_format_kind(), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(utils::one_of(src_md_.data_type, f32, bf16, f16)
+                    && weights_md_.data_type == s8
+                    && utils::one_of(dst_md_.data_type, f32, bf16, f16, s8, u8),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_MATMUL(IMPLICATION(with_bias(),
+                             utils::one_of(bias_md_.data_type, f32, bf16, f16)
+                                     && is_bias_1xN()),
+            VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_MATMUL(attr()->has_default_values(skip_mask_t::scales_data_type
+                                     | skip_mask_t::post_ops
+                                     | skip_mask_t::sum_dt
+                                     | skip_mask_t::src_dyn_quant
+                                     | skip_mask_t::fpmath_mode
+                                     | skip_mask_t::accumulation_mode
+                                     | skip_mask_t::dst_amax,
+                             dst_md_.data_type),
+            VERBOSE_UNSUPPORTED_ATTR);
+
+    // Source scales are computed by the primitive unless they are given,
+    // either common or per row, i.e. with groups of the whole row. Weights
+    // and destination scales are passed to the nested matmul without groups.
+    const auto &sc = attr()->scales_;
+    if (!sc.has_default_values(DNNL_ARG_SRC)) {
+        const int mask = sc.get_mask(DNNL_ARG_SRC);
+        const bool is_common
+                = mask == 0 && sc.get(DNNL_ARG_SRC).has_default_groups();
+        const bool is_per_row
+                = utils::one_of(mask, src_qmask_M() + src_qmask_K(),
+                          full_tensor_mask())
+                && sc.get_group(DNNL_ARG_SRC, 0) == 1
+                && sc.get_group(DNNL_ARG_SRC, 1) == K();
+        VDISPATCH_MATMUL((is_common || is_per_row)
+                        && sc.get_data_type(DNNL_ARG_SRC) == f32,
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+    }
+    VDISPATCH_MATMUL(attr_scales_ok()
+                    && sc.get(DNNL_ARG_WEIGHTS).has_default_groups()
+                    && utils::one_of(
+                            sc.get_mask(DNNL_ARG_WEIGHTS), 0, wei_qmask_N())
+                    && sc.get_mask(DNNL_ARG_DST) == 0,
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    // Binary and prelu post-ops take tensors of the original shape.
+    const auto &po = attr()->post_ops_;
+    VDISPATCH_MATMUL(po.find(primitive_kind::binary) == -1
+                    && po.find(primitive_kind::prelu) == -1,
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_MATMUL_SC(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+
+    const memory_desc_wrapper src_d(src_md_);
+    const memory_desc_wrapper wei_d(weights_md_);
+    const memory_desc_wrapper dst_d(dst_md_);
+    const memory_desc_wrapper bia_d(bias_md_);
+    VDISPATCH_MATMUL(!src_d.has_runtime_dims_or_strides()
+                    && !wei_d.has_runtime_dims_or_strides()
+                    && !dst_d.has_runtime_dims_or_strides()
+                    && !bia_d.has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    // All rows of the source and the destination are processed at once, so
+    // both must be dense, and weights must not have batch dimensions.
+    const format_tag_t abx = get_abx_tag(ndims());
+    VDISPATCH_MATMUL(src_d.matches_tag(abx) && dst_d.matches_tag(abx)
+                    && wei_d.is_plain()
+                    && IMPLICATION(with_bias(), bia_d.is_plain()),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL(utils::array_product(weights_md_.dims, ndims() - 2) == 1,
+            VERBOSE_BAD_DIM, "weights", 0);
+
+    const int nd = ndims();
+    MB_ = batch() * M();
+    const dim_t K = this->K();
+    const dim_t N = this->N();
+    const auto &wei_strides = wei_d.blocking_desc().strides;
+
+    memory_desc_t mm_src_md, mm_wei_md, mm_dst_md;
+    const dims_t mm_src_dims = {1, MB_, K};
+    CHECK(memory_desc_init_by_tag(
+            mm_src_md, 3, mm_src_dims, s8, format_tag::abc));
+    const dims_t mm_wei_dims = {1, K, N};
+    const dims_t mm_wei_strides
+            = {K * N, wei_strides[nd - 2], wei_strides[nd - 1]};
+    CHECK(memory_desc_init_by_strides(
+            mm_wei_md, 3, mm_wei_dims, s8, mm_wei_strides));
+    const dims_t mm_dst_dims = {1, MB_, N};
+    CHECK(memory_desc_init_by_tag(mm_dst_md, 3, mm_dst_dims,
+            dst_md_.data_type, format_tag::abc));
+
+    const dims_t scales_dims = {1, MB_, 1};
+    CHECK(memory_desc_init_by_tag(
+            scales_md_, 3, scales_dims, f32, format_tag::abc));
+    if (with_bias()) {
+        const auto &bia_strides = bia_d.blocking_desc().strides;
+        const dims_t mm_bia_dims = {1, 1, N};
+        const dims_t mm_bia_strides = {N, N, bia_strides[nd - 1]};
+        CHECK(memory_desc_init_by_strides(mm_bia_md_, 3, mm_bia_dims,
+                bias_md_.data_type, mm_bia_strides));
+    }
+
+    primitive_attr_t mm_attr(*attr());
+    VDISPATCH_MATMUL(mm_attr.is_initialized(), VERBOSE_UNSUPPORTED_ATTR);
+    CHECK(init_nested_attr(mm_attr));
+
+    matmul_desc_t mm_desc;
+    CHECK(matmul_desc_init(
+            &mm_desc, &mm_src_md, &mm_wei_md, nullptr, &mm_dst_md));
+
+    primitive_desc_iterator_t it(
+            engine, (op_desc_t *)&mm_desc, &mm_attr, nullptr);
+    if (!it.is_initialized()) return status::out_of_memory;
+    matmul_pd_ = *(++it);
+    VDISPATCH_MATMUL(matmul_pd_, VERBOSE_PRIMITIVE_CREATION_FAIL, "matmul");
+
+    name_.append(matmul_pd_->name());
+    init_scratchpad();
+
+    return status::success;
+}
+
+status_t dyn_quant_matmul_t::execute(const exec_ctx_t &ctx) const {
+    using namespace data_type;
+    using namespace memory_tracking::names;
+
+    const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    const auto wei = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS);
+    const auto bia = CTX_IN_MEM(const void *, DNNL_ARG_BIAS);
+    status_t status = status::success;
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    auto qsrc = scratchpad.get<int8_t>(key_matmul_src_dyn_quant);
+    auto scales = scratchpad.get<float>(key_matmul_src_dyn_quant_scales);
+
+    const dim_t MB = pd()->MB();
+    const dim_t K = pd()->K();
+    const auto src_scales
+            = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC);
+    // Common scales repeat every row, per-row scales over all batches every
+    // MB rows, per-row scales without the batch mask every M rows.
+    const auto &sc = pd()->attr()->scales_;
+    dim_t scales_period = 1;
+    if (sc.get_mask(DNNL_ARG_SRC) == pd()->full_tensor_mask())
+        scales_period = MB;
+    else if (sc.get_mask(DNNL_ARG_SRC) != 0)
+        scales_period = pd()->M();
+
+    switch (pd()->src_md()->data_type) {
+        case f32:
+            quantize_rows<f32>(
+                    src, qsrc, scales, MB, K, src_scales, scales_period);
+            break;
+        case bf16:
+            quantize_rows<bf16>(
+                    src, qsrc, scales, MB, K, src_scales, scales_period);
+            break;
+        case f16:
+            quantize_rows<f16>(
+                    src, qsrc, scales, MB, K, src_scales, scales_period);
+            break;
+        default: assert(!"unsupported data type"); return status::runtime_error;
+    }
+
+    const auto &mm_pd = *matmul_->pd();
+    engine_t *service_engine = get_service_engine();
+    constexpr auto mem_flag = memory_flags_t::use_runtime_ptr;
+
+    std::unique_ptr<memory_t, memory_deleter_t> src_mem;
+    CHECK(safe_ptr_assign(src_mem,
+            new memory_t(service_engine, mm_pd.src_md(), mem_flag, qsrc)));
+    std::unique_ptr<memory_t, memory_deleter_t> wei_mem;
+    CHECK(safe_ptr_assign(wei_mem,
+            new memory_t(service_engine, mm_pd.weights_md(), mem_flag,
+                    const_cast<void *>(wei))));
+    std::unique_ptr<memory_t, memory_deleter_t> dst_mem;
+    CHECK(safe_ptr_assign(dst_mem,
+            new memory_t(service_engine, mm_pd.dst_md(), mem_flag, dst)));
+    std::unique_ptr<memory_t, memory_deleter_t> scales_mem;
+    CHECK(safe_ptr_assign(scales_mem,
+            new memory_t(service_engine, pd()->scales_md(), mem_flag, scales)));
+
+    exec_args_t matmul_args;
+    matmul_args[DNNL_ARG_SRC] = {src_mem.get(), true};
+    matmul_args[DNNL_ARG_WEIGHTS] = {wei_mem.get(), true};
+    matmul_args[DNNL_ARG_DST] = {dst_mem.get(), false};
+    matmul_args[DNNL_ARG_ATTR_MULTIPLE_POST_OP(0) | DNNL_ARG_SRC_1]
+            = {scales_mem.get(), true};
+
+    std::unique_ptr<memory_t, memory_deleter_t> bia_mem;
+    if (pd()->with_bias()) {
+        CHECK(safe_ptr_assign(bia_mem,
+                new memory_t(service_engine, pd()->mm_bia_md(), mem_flag,
+                        const_cast<void *>(bia))));
+        matmul_args[DNNL_ARG_ATTR_MULTIPLE_POST_OP(1) | DNNL_ARG_SRC_1]
+                = {bia_mem.get(), true};
+    }
+
+    // Weights and destination scales and the destination absolute maximum
+    // are passed as is.
+    for (int arg : {DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS,
+                 DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST, DNNL_ARG_ATTR_DST_AMAX}) {
+        const auto it = ctx.args().find(arg);
+        if (it != ctx.args().end()) matmul_args[arg] = it->second;
+    }
+
+    exec_ctx_t matmul_ctx(ctx, std::move(matmul_args));
+    nested_scratchpad_t ns(ctx, key_nested, matmul_);
+    matmul_ctx.set_scratchpad_grantor(ns.grantor());
+    return matmul_->execute(matmul_ctx);
+}
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,98 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_MATMUL_DYN_QUANT_MATMUL_HPP
+#define CPU_MATMUL_DYN_QUANT_MATMUL_HPP
+
+#include <memory>
+#include <string>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+// Matmul with dynamic quantization of a floating-point source. Every row of
+// the source is quantized to s8 with a symmetric scale computed from its
+// absolute maximum, or given as source scales, in a single pass. The int8 problem is computed by a nested
+// matmul over all rows at once, [1, MB, K] x [1, K, N], where the row scales
+// and the bias are applied as binary post-ops ahead of the user post-ops.
+struct dyn_quant_matmul_t : public primitive_t {
+    struct pd_t : public cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        pd_t(const pd_t &other)
+            : cpu_matmul_pd_t(other)
+            , matmul_pd_(other.matmul_pd_->clone())
+            , name_(other.name_)
+            , MB_(other.MB_)
+            , scales_md_(other.scales_md_)
+            , mm_bia_md_(other.mm_bia_md_) {}
+
+        DECLARE_COMMON_PD_T(name_.c_str(), dyn_quant_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        // Total number of source rows, all batch dimensions included.
+        dim_t MB() const { return MB_; }
+        const memory_desc_t *scales_md() const { return &scales_md_; }
+        const memory_desc_t *mm_bia_md() const { return &mm_bia_md_; }
+
+        std::shared_ptr<primitive_desc_t> matmul_pd_;
+
+    private:
+        std::string name_ = "dyn_quant:any+";
+        dim_t MB_ = 0;
+        memory_desc_t scales_md_, mm_bia_md_;
+
+        status_t set_default_formats();
+        status_t init_nested_attr(primitive_attr_t &mm_attr) const;
+
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.book<int8_t>(key_matmul_src_dyn_quant, MB_ * K());
+            scratchpad.book<float>(key_matmul_src_dyn_quant_scales, MB_);
+            scratchpad.book(key_nested, matmul_pd_->scratchpad_registry());
+        }
+    };
+
+    dyn_quant_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        return pd()->matmul_pd_->create_primitive(matmul_, engine);
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    std::shared_ptr<primitive_t> matmul_;
+};
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -244,7 +244,62 @@ status_t gemm_f32_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
             == (1 << (ndims - 1));
 
     std::atomic<status_t> st(status::success);
-    if (!use_single_gemm_call) {
+    // Many independent matrix-vector products (e.g. decoding across heads):
+    // each thread streams whole weights matrices through the batched gemv
+    // driver instead of splitting every product across threads.
+    const bool use_gemv_batch = !use_single_gemm_call && M == 1
+            && batch >= nthr && dst_is_acc && !params.has_pp_kernel_;
+    bool gemv_batch_done = false;
+    if (use_gemv_batch) {
+        const int src_mask
+                = utils::get_dims_mask(dst_d.dims(), src_d.dims(), ndims);
+        const int wei_mask
+                = utils::get_dims_mask(dst_d.dims(), weights_d.dims(), ndims);
+        parallel(nthr, [&](int ithr, int nthr) {
+            dim_t b_start {0}, b_end {0};
+            balance211(batch, nthr, ithr, b_start, b_end);
+
+            constexpr dim_t max_blk = 64;
+            const src_data_t *s_ptrs[max_blk];
+            const weights_data_t *w_ptrs[max_blk];
+            acc_data_t *c_ptrs[max_blk];
+            dims_t s_dims_idx, w_dims_idx, d_dims_idx;
+
+            for (dim_t b0 = b_start; b0 < b_end; b0 += max_blk) {
+                const dim_t cnt = nstl::min(max_blk, b_end - b0);
+                for (dim_t i = 0; i < cnt; i++) {
+                    utils::l_dims_by_l_offset(
+                            d_dims_idx, (b0 + i) * N, dst_d.dims(), ndims);
+                    utils::copy_dims_with_mask(
+                            s_dims_idx, d_dims_idx, batch_ndims, src_mask);
+                    s_dims_idx[ndims - 2] = 0;
+                    s_dims_idx[ndims - 1] = 0;
+                    utils::copy_dims_with_mask(
+                            w_dims_idx, d_dims_idx, batch_ndims, wei_mask);
+                    w_dims_idx[ndims - 2] = 0;
+                    w_dims_idx[ndims - 1] = 0;
+                    s_ptrs[i] = src + src_d.off_v(s_dims_idx);
+                    w_ptrs[i] = weights + weights_d.off_v(w_dims_idx);
+                    c_ptrs[i] = acc + dst_d.off_v(d_dims_idx);
+                }
+                const status_t st_thr = sgemv_batch(&transB, &transA, &N, &M,
+                        &K, &alpha, w_ptrs, &ldb, s_ptrs, &lda, &beta, c_ptrs,
+                        &acc_ldc, cnt);
+                if (st_thr != status::success) {
+                    st = st_thr;
+                    return;
+                }
+            }
+        });
+        // `sgemv_batch` reports `unimplemented` before touching any data, so
+        // it is safe to fall back to the regular path below.
+        gemv_batch_done = st != status::unimplemented;
+        if (!gemv_batch_done) st = status::success;
+    }
+
+    if (gemv_batch_done) {
+        // Nothing to do, the batched gemv path computed the destination.
+    } else if (!use_single_gemm_call) {
         const int src_mask
                 = utils::get_dims_mask(dst_d.dims(), src_d.dims(), ndims);
         const int wei_mask
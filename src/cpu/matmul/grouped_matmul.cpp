@@ -0,0 +1,301 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory.hpp"
+#include "common/primitive_desc_iterator.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_engine.hpp"
+
+#include "cpu/matmul/grouped_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+status_t grouped_matmul_t::pd_t::set_default_formats() {
+    using namespace format_tag;
+    if (src_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(src_md_, ab));
+    if (weights_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(weights_md_, abc));
+    if (dst_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(dst_md_, ab));
+    if (with_bias() && bias_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(bias_md_, ab));
+    return status::success;
+}
+
+status_t grouped_matmul_t::pd_t::init(engine_t *engine) {
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    VDISPATCH_MATMUL(is_grouped(), VERBOSE_BAD_PARAM, "group_offsets");
+    VDISPATCH_MATMUL(is_dense_format_kind(), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(attr()->has_default_values(skip_mask_t::post_ops
+                             | skip_mask_t::sum_dt | skip_mask_t::fpmath_mode
+                             | skip_mask_t::accumulation_mode),
+            VERBOSE_UNSUPPORTED_ATTR);
+    // Binary and prelu post-ops take extra tensors that would have to be
+    // sliced per group as well.
+    const auto &po = attr()->post_ops_;
+    VDISPATCH_MATMUL(po.find(primitive_kind::binary) == -1
+                    && po.find(primitive_kind::prelu) == -1,
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_MATMUL_SC(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+
+    const memory_desc_wrapper src_d(src_md_);
+    const memory_desc_wrapper wei_d(weights_md_);
+    const memory_desc_wrapper dst_d(dst_md_);
+    const memory_desc_wrapper bia_d(bias_md_);
+    VDISPATCH_MATMUL(src_d.is_plain() && wei_d.is_plain() && dst_d.is_plain()
+                    && IMPLICATION(with_bias(), bia_d.is_plain()),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL(!src_d.has_runtime_strides()
+                    && !wei_d.has_runtime_dims_or_strides()
+                    && !dst_d.has_runtime_strides()
+                    && !bia_d.has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    const dim_t N = dst_md_.dims[1];
+    // Blocks are big enough to amortize the nested primitive call.
+    M_blk_ = 256;
+    N_blk_ = nstl::max<dim_t>(1, nstl::min<dim_t>(N, 64));
+    nthr_ = dnnl_get_max_threads();
+
+    CHECK(init_matmul_pd(engine, N_blk_, matmul_pd_));
+    if (N % N_blk_ != 0)
+        CHECK(init_matmul_pd(engine, N % N_blk_, matmul_tail_pd_));
+
+    src_blk_md_ = *matmul_pd_->src_md();
+    src_blk_md_.dims[0] = src_blk_md_.padded_dims[0] = M_blk_;
+
+    name_.append(matmul_pd_->name());
+    init_scratchpad();
+
+    return status::success;
+}
+
+status_t grouped_matmul_t::pd_t::init_matmul_pd(engine_t *engine, dim_t N_b,
+        std::shared_ptr<primitive_desc_t> &mm_pd) {
+    const memory_desc_wrapper src_d(src_md_);
+    const memory_desc_wrapper wei_d(weights_md_);
+    const memory_desc_wrapper dst_d(dst_md_);
+    const memory_desc_wrapper bia_d(bias_md_);
+
+    const dim_t K = src_md_.dims[1];
+    const auto &src_strides = src_d.blocking_desc().strides;
+    const auto &wei_strides = wei_d.blocking_desc().strides;
+    const auto &dst_strides = dst_d.blocking_desc().strides;
+
+    // The nested matmul sees a block of a single group: M is defined at
+    // execution time, all the tensors keep the strides of the grouped ones.
+    memory_desc_t mm_src_md, mm_wei_md, mm_dst_md, mm_bia_md;
+    const dims_t mm_src_dims = {DNNL_RUNTIME_DIM_VAL, K};
+    const dims_t mm_src_strides = {src_strides[0], src_strides[1]};
+    CHECK(memory_desc_init_by_strides(mm_src_md, 2, mm_src_dims,
+            src_md_.data_type, mm_src_strides));
+    const dims_t mm_wei_dims = {K, N_b};
+    const dims_t mm_wei_strides = {wei_strides[1], wei_strides[2]};
+    CHECK(memory_desc_init_by_strides(mm_wei_md, 2, mm_wei_dims,
+            weights_md_.data_type, mm_wei_strides));
+    const dims_t mm_dst_dims = {DNNL_RUNTIME_DIM_VAL, N_b};
+    const dims_t mm_dst_strides = {dst_strides[0], dst_strides[1]};
+    CHECK(memory_desc_init_by_strides(mm_dst_md, 2, mm_dst_dims,
+            dst_md_.data_type, mm_dst_strides));
+    if (with_bias()) {
+        const auto &bia_strides = bia_d.blocking_desc().strides;
+        const dims_t mm_bia_dims = {1, N_b};
+        const dims_t mm_bia_strides = {bia_strides[0], bia_strides[1]};
+        CHECK(memory_desc_init_by_strides(mm_bia_md, 2, mm_bia_dims,
+                bias_md_.data_type, mm_bia_strides));
+    }
+
+    matmul_desc_t mm_desc;
+    CHECK(matmul_desc_init(&mm_desc, &mm_src_md, &mm_wei_md,
+            with_bias() ? &mm_bia_md : nullptr, &mm_dst_md));
+
+    // The blocks are executed in parallel, every block by a single thread.
+    primitive_attr_t mm_attr(*attr());
+    mm_attr.max_threads_ = 1;
+    primitive_desc_iterator_t it(
+            engine, (op_desc_t *)&mm_desc, &mm_attr, nullptr);
+    if (!it.is_initialized()) return status::out_of_memory;
+    mm_pd = *(++it);
+    VDISPATCH_MATMUL(mm_pd, VERBOSE_PRIMITIVE_CREATION_FAIL, "matmul");
+    return status::success;
+}
+
+status_t grouped_matmul_t::execute(const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    const auto wei = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    const auto bia = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    const auto offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_GROUP_OFFSETS);
+    status_t status = status::success;
+    auto dst = CTX_OUT_CLEAN_MEM(char *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const memory_desc_wrapper src_d(
+            ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md()));
+    const memory_desc_wrapper wei_d(pd()->weights_md());
+    const memory_desc_wrapper dst_d(
+            ctx.memory_mdw(DNNL_ARG_DST, pd()->dst_md()));
+    const memory_desc_wrapper bia_d(pd()->weights_md(1));
+
+    const dim_t M_total = src_d.dims()[0];
+    const dim_t N = dst_d.dims()[1];
+    const dim_t G = pd()->n_groups();
+    const dim_t M_blk = pd()->M_blk();
+    const dim_t N_blk = pd()->N_blk();
+    const dim_t nb_N = utils::div_up(N, N_blk);
+
+    // The first block of every group in the list of all the blocks.
+    std::vector<dim_t> blk_start(G + 1, 0);
+    dim_t row_beg = 0;
+    for (dim_t g = 0; g < G; g++) {
+        const dim_t row_end = offsets[g];
+        if (row_end < row_beg || row_end > M_total)
+            return status::invalid_arguments;
+        blk_start[g + 1]
+                = blk_start[g] + utils::div_up(row_end - row_beg, M_blk) * nb_N;
+        row_beg = row_end;
+    }
+    const dim_t work_amount = blk_start[G];
+    if (work_amount == 0) return status::success;
+
+    engine_t *service_engine = get_service_engine();
+    constexpr auto mem_flag = memory_flags_t::use_runtime_ptr;
+    using mem_ptr_t = std::unique_ptr<memory_t, memory_deleter_t>;
+    auto make_mem = [&](mem_ptr_t &mem, const memory_desc_t *md,
+                            const void *ptr) -> status_t {
+        return safe_ptr_assign(mem,
+                new memory_t(
+                        service_engine, md, mem_flag, const_cast<void *>(ptr)));
+    };
+
+    std::atomic<status_t> st(status::success);
+    parallel(pd()->nthr(), [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start == end) return;
+
+        // The nested primitives are created to run on a single thread.
+        max_threads_limit_guard_t max_threads_guard(1);
+        const int key = key_nested_multiple + ithr;
+        nested_scratchpad_t ns(ctx, key, matmul_);
+        std::unique_ptr<nested_scratchpad_t> ns_tail;
+        if (matmul_tail_)
+            ns_tail = utils::make_unique<nested_scratchpad_t>(
+                    ctx, key, matmul_tail_);
+
+        // Memory objects of full blocks are reused by the thread, only the
+        // data handles change between the blocks.
+        mem_ptr_t src_blk_mem, wei_mem[2], bia_mem[2], dst_blk_mem[2];
+
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t g = std::upper_bound(blk_start.begin(),
+                                    blk_start.end(), iwork)
+                    - blk_start.begin() - 1;
+            const dim_t mb = (iwork - blk_start[g]) / nb_N;
+            const dim_t nb = (iwork - blk_start[g]) % nb_N;
+            const dim_t row0 = (g == 0 ? 0 : offsets[g - 1]) + mb * M_blk;
+            const dim_t M_b = nstl::min(M_blk, offsets[g] - row0);
+            const dim_t n0 = nb * N_blk;
+            const int is_tail = n0 + N_blk > N;
+            const auto &mm = is_tail ? matmul_tail_ : matmul_;
+            const auto &mm_pd = *mm->pd();
+
+            const char *src_b
+                    = src + src_d.off(row0, 0) * src_d.data_type_size();
+            const char *wei_b
+                    = wei + wei_d.off(g, 0, n0) * wei_d.data_type_size();
+            char *dst_b = dst + dst_d.off(row0, n0) * dst_d.data_type_size();
+
+            mem_ptr_t src_tail_mem, dst_tail_mem;
+            memory_t *src_mem = nullptr, *dst_mem = nullptr;
+            status_t st_blk = status::success;
+            if (M_b == M_blk) {
+                if (!src_blk_mem)
+                    st_blk = make_mem(
+                            src_blk_mem, &pd()->src_blk_md(), src_b);
+                if (st_blk == status::success && !dst_blk_mem[is_tail]) {
+                    memory_desc_t dst_blk_md = *mm_pd.dst_md();
+                    dst_blk_md.dims[0] = dst_blk_md.padded_dims[0] = M_blk;
+                    st_blk = make_mem(dst_blk_mem[is_tail], &dst_blk_md, dst_b);
+                }
+                src_mem = src_blk_mem.get();
+                dst_mem = dst_blk_mem[is_tail].get();
+            } else {
+                memory_desc_t src_tail_md = pd()->src_blk_md();
+                src_tail_md.dims[0] = src_tail_md.padded_dims[0] = M_b;
+                memory_desc_t dst_tail_md = *mm_pd.dst_md();
+                dst_tail_md.dims[0] = dst_tail_md.padded_dims[0] = M_b;
+                st_blk = make_mem(src_tail_mem, &src_tail_md, src_b);
+                if (st_blk == status::success)
+                    st_blk = make_mem(dst_tail_mem, &dst_tail_md, dst_b);
+                src_mem = src_tail_mem.get();
+                dst_mem = dst_tail_mem.get();
+            }
+            if (st_blk == status::success && !wei_mem[is_tail])
+                st_blk = make_mem(wei_mem[is_tail], mm_pd.weights_md(), wei_b);
+            if (st_blk == status::success && pd()->with_bias()
+                    && !bia_mem[is_tail])
+                st_blk = make_mem(bia_mem[is_tail], mm_pd.weights_md(1), bia);
+            if (st_blk != status::success) {
+                st = st_blk;
+                return;
+            }
+
+            src_mem->set_data_handle(const_cast<char *>(src_b));
+            dst_mem->set_data_handle(dst_b);
+            wei_mem[is_tail]->set_data_handle(const_cast<char *>(wei_b));
+
+            exec_args_t matmul_args;
+            matmul_args[DNNL_ARG_SRC] = {src_mem, true};
+            matmul_args[DNNL_ARG_WEIGHTS] = {wei_mem[is_tail].get(), true};
+            matmul_args[DNNL_ARG_DST] = {dst_mem, false};
+            if (pd()->with_bias()) {
+                const char *bia_b
+                        = bia + bia_d.off(g, n0) * bia_d.data_type_size();
+                bia_mem[is_tail]->set_data_handle(const_cast<char *>(bia_b));
+                matmul_args[DNNL_ARG_BIAS] = {bia_mem[is_tail].get(), true};
+            }
+
+            exec_ctx_t matmul_ctx(ctx, std::move(matmul_args));
+            matmul_ctx.set_scratchpad_grantor(
+                    is_tail ? ns_tail->grantor() : ns.grantor());
+            st_blk = mm->execute(matmul_ctx);
+            if (st_blk != status::success) {
+                st = st_blk;
+                return;
+            }
+        }
+    });
+
+    return st;
+}
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
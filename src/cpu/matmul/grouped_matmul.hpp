@@ -0,0 +1,119 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_MATMUL_GROUPED_MATMUL_HPP
+#define CPU_MATMUL_GROUPED_MATMUL_HPP
+
+#include <memory>
+#include <string>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+// Grouped matmul implemented on top of a regular single-threaded matmul with
+// runtime M. The rows of every group are split in blocks of `M_blk` rows and
+// the columns in blocks of `N_blk` columns, and all the blocks of all the
+// groups are distributed between the threads. Every block is an execution of
+// the nested primitive over slices of the source and destination and over the
+// group's own weights and bias. The last column block may use a separate
+// nested primitive for the tail.
+struct grouped_matmul_t : public primitive_t {
+    struct pd_t : public cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        pd_t(const pd_t &other)
+            : cpu_matmul_pd_t(other)
+            , matmul_pd_(other.matmul_pd_->clone())
+            , matmul_tail_pd_(other.matmul_tail_pd_
+                              ? other.matmul_tail_pd_->clone()
+                              : nullptr)
+            , M_blk_(other.M_blk_)
+            , N_blk_(other.N_blk_)
+            , nthr_(other.nthr_)
+            , src_blk_md_(other.src_blk_md_)
+            , name_(other.name_) {}
+
+        DECLARE_COMMON_PD_T(name_.c_str(), grouped_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        dim_t M_blk() const { return M_blk_; }
+        dim_t N_blk() const { return N_blk_; }
+        int nthr() const { return nthr_; }
+        // Returns the source descriptor of a full block of rows.
+        const memory_desc_t &src_blk_md() const { return src_blk_md_; }
+
+        std::shared_ptr<primitive_desc_t> matmul_pd_;
+        std::shared_ptr<primitive_desc_t> matmul_tail_pd_;
+
+    private:
+        dim_t M_blk_ = 0;
+        dim_t N_blk_ = 0;
+        int nthr_ = 0;
+        memory_desc_t src_blk_md_;
+        std::string name_ = "grouped:any+";
+
+        status_t set_default_formats();
+        status_t init_matmul_pd(engine_t *engine, dim_t N_b,
+                std::shared_ptr<primitive_desc_t> &mm_pd);
+
+        void init_scratchpad() {
+            // Every thread runs the nested primitives with its own
+            // scratchpad.
+            const auto &reg = matmul_pd_->scratchpad_registry();
+            const auto &tail_reg = matmul_tail_pd_
+                    ? matmul_tail_pd_->scratchpad_registry()
+                    : reg;
+            auto scratchpad = scratchpad_registry().registrar();
+            for (int ithr = 0; ithr < nthr_; ithr++)
+                scratchpad.book(
+                        memory_tracking::names::key_nested_multiple + ithr,
+                        tail_reg.size() > reg.size() ? tail_reg : reg);
+        }
+    };
+
+    grouped_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        CHECK(pd()->matmul_pd_->create_primitive(matmul_, engine));
+        if (pd()->matmul_tail_pd_)
+            CHECK(pd()->matmul_tail_pd_->create_primitive(
+                    matmul_tail_, engine));
+        return status::success;
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    std::shared_ptr<primitive_t> matmul_;
+    std::shared_ptr<primitive_t> matmul_tail_;
+};
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
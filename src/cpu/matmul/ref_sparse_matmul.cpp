@@ -63,6 +63,13 @@ status_t ref_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
         const int32_t *wei_indices = nullptr;
         const int32_t *wei_pointers = nullptr;
 
+        if (weights_d.encoding() == sparse_encoding::bsr) {
+            run_bsr_kernel(src, wei_values, wei_buffer_1, wei_buffer_2, dst, M,
+                    N, K, weights_d.block_dims()[0], weights_d.block_dims()[1],
+                    mm_dt);
+            return status::success;
+        }
+
         if (weights_d.encoding() == sparse_encoding::csr) {
             // For CSR encodings, pointer and indices assignment is
             // staightforward as,
@@ -197,6 +204,34 @@ void ref_sparse_matmul_t::run_csr_kernel(const void *dmat, const void *values,
     }
 }
 
+void ref_sparse_matmul_t::run_bsr_kernel(const void *src, const void *values,
+        const int32_t *indices, const int32_t *pointers, void *res,
+        const dim_t M, const dim_t N, const dim_t K, const dim_t R,
+        const dim_t C, const data_type_t mm_dt) const {
+    // Every row of the source is multiplied by all stored blocks, the
+    // destination is zero-initialized by the caller.
+    parallel_nd(M, [&](dim_t m) {
+        for (dim_t kb = 0; kb < K / R; kb++) {
+            for (dim_t p = pointers[kb]; p < pointers[kb + 1]; p++) {
+                const dim_t blk_off = p * R * C;
+                const dim_t n_start = indices[p] * C;
+                for (dim_t r = 0; r < R; r++) {
+                    const float a_val = io::load_float_value(
+                            mm_dt, src, m * K + kb * R + r);
+                    for (dim_t c = 0; c < C; c++) {
+                        const dim_t c_idx = m * N + n_start + c;
+                        const float b_val = io::load_float_value(
+                                mm_dt, values, blk_off + r * C + c);
+                        float c_val = io::load_float_value(mm_dt, res, c_idx);
+                        c_val += a_val * b_val;
+                        io::store_float_value(mm_dt, c_val, res, c_idx);
+                    }
+                }
+            }
+        }
+    });
+}
+
 } // namespace matmul
 } // namespace cpu
 } // namespace impl
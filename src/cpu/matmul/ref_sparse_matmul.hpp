@@ -57,7 +57,8 @@ struct ref_sparse_matmul_t : public primitive_t {
             VDISPATCH_MATMUL(IMPLICATION(wei_d.is_sparse_desc(),
                                      utils::one_of(wei_d.encoding(),
                                              sparse_encoding::csr,
-                                             sparse_encoding::coo)),
+                                             sparse_encoding::coo,
+                                             sparse_encoding::bsr)),
                     VERBOSE_UNSUPPORTED_SPARSE_CFG);
 
             VDISPATCH_MATMUL(
@@ -86,7 +87,9 @@ struct ref_sparse_matmul_t : public primitive_t {
                         VERBOSE_UNSUPPORTED_SPARSE_CFG);
 
                 VDISPATCH_MATMUL(
-                        IMPLICATION(sparse_mem_encoding == sparse_encoding::csr,
+                        IMPLICATION(utils::one_of(sparse_mem_encoding,
+                                            sparse_encoding::csr,
+                                            sparse_encoding::bsr),
                                 utils::everyone_is(s32, wei_d.metadata_type(0),
                                         wei_d.metadata_type(1))),
                         VERBOSE_UNSUPPORTED_SPARSE_CFG);
@@ -148,6 +151,13 @@ struct ref_sparse_matmul_t : public primitive_t {
             const dim_t M, const dim_t N, const dim_t K,
             const data_type_t mm_dt, bool is_src_sparse) const;
 
+    // Executes the matrix multiplication C = A x B for a BSR encoded
+    // multiplicand B with `R` x `C` blocks.
+    void run_bsr_kernel(const void *src, const void *values,
+            const int32_t *indices, const int32_t *pointers, void *res,
+            const dim_t M, const dim_t N, const dim_t K, const dim_t R,
+            const dim_t C, const data_type_t mm_dt) const;
+
     status_t execute(const exec_ctx_t &ctx) const override;
 
 private:
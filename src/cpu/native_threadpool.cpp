@@ -0,0 +1,266 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl_config.h"
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL \
+        && defined(DNNL_ENABLE_NATIVE_THREADPOOL)
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_affinity.hpp"
+#include "cpu/native_threadpool.hpp"
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace native_threadpool {
+
+namespace {
+
+using threadpool_iface = dnnl::threadpool_interop::threadpool_iface;
+
+// A single parallel_for() call is executed by all the threads of the pool.
+// The submitting thread takes part as thread 0 and returns only after all
+// the workers are done, so the state of a call never outlives it.
+class native_threadpool_t : public threadpool_iface {
+public:
+    native_threadpool_t(int nthr, int spin_us, bool pin)
+        : nthr_(nthr)
+        , spin_us_(spin_us) {
+        // Ranges are allocated separately to keep them on different cache
+        // lines.
+        ranges_.reserve(nthr_);
+        for (int ithr = 0; ithr < nthr_; ithr++)
+            ranges_.emplace_back(utils::make_unique<range_t>());
+        std::vector<int> cpus = affinity::get_cpus();
+        if (cpus.empty() && pin) cpus = affinity::get_process_cpus();
+        workers_.reserve(nthr_ - 1);
+        for (int ithr = 1; ithr < nthr_; ithr++) {
+            const int cpu
+                    = cpus.empty() ? -1 : cpus[ithr % (int)cpus.size()];
+            workers_.emplace_back([this, ithr, cpu] { worker(ithr, cpu); });
+        }
+    }
+
+    ~native_threadpool_t() override {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            stop_.store(true);
+            generation_.fetch_add(1);
+        }
+        sleep_cv_.notify_all();
+        for (auto &w : workers_)
+            w.join();
+    }
+
+    int get_num_threads() const override { return nthr_; }
+
+    bool get_in_parallel() const override { return current_pool() == this; }
+
+    uint64_t get_flags() const override { return 0; }
+
+    void parallel_for(
+            int n, const std::function<void(int, int)> &fn) override {
+        if (n <= 0) return;
+        if (n == 1 || nthr_ == 1 || get_in_parallel()) {
+            // Nested calls from the tasks must see they are in parallel.
+            const native_threadpool_t *prev = current_pool();
+            current_pool() = this;
+            for (int i = 0; i < n; i++)
+                fn(i, n);
+            current_pool() = prev;
+            return;
+        }
+
+        // Calls from concurrent streams are serialized, the pool runs one
+        // parallel region at a time.
+        std::lock_guard<std::mutex> submit_lock(submit_mutex_);
+
+        fn_ = &fn;
+        n_ = n;
+        for (int ithr = 0; ithr < nthr_; ithr++) {
+            int start = 0, end = 0;
+            balance211(n, nthr_, ithr, start, end);
+            ranges_[ithr]->begin = start;
+            ranges_[ithr]->end = end;
+        }
+        n_done_workers_.store(0, std::memory_order_relaxed);
+
+        generation_.fetch_add(1);
+        if (n_sleeping_.load() > 0) {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            sleep_cv_.notify_all();
+        }
+
+        run(0);
+
+        // Wait for all the workers, including the ones that found no work,
+        // before the state of the call can be reused.
+        const int n_workers = nthr_ - 1;
+        auto all_done = [&] {
+            return n_done_workers_.load(std::memory_order_acquire)
+                    == n_workers;
+        };
+        if (!spin_until(all_done))
+            while (!all_done())
+                std::this_thread::yield();
+        fn_ = nullptr;
+    }
+
+private:
+    // Tasks [begin, end) not started yet. The owner takes tasks from the
+    // front, thieves take the back half.
+    struct range_t {
+        std::mutex mutex;
+        int begin = 0;
+        int end = 0;
+    };
+
+    static const native_threadpool_t *&current_pool() {
+        static thread_local const native_threadpool_t *pool = nullptr;
+        return pool;
+    }
+
+    // Spins for at most `spin_us_` microseconds. Returns whether `pred`
+    // became true.
+    template <typename F>
+    bool spin_until(F pred) const {
+        if (pred()) return true;
+        const auto deadline = std::chrono::steady_clock::now()
+                + std::chrono::microseconds(spin_us_);
+        for (int i = 1;; i++) {
+            if (pred()) return true;
+            if (i % 64 == 0 && std::chrono::steady_clock::now() >= deadline)
+                return false;
+        }
+    }
+
+    bool pop(int ithr, int &task) {
+        auto &r = *ranges_[ithr];
+        std::lock_guard<std::mutex> lock(r.mutex);
+        if (r.begin >= r.end) return false;
+        task = r.begin++;
+        return true;
+    }
+
+    // Moves the back half of the largest-looking victim range into the range
+    // of `ithr`.
+    bool steal(int ithr) {
+        for (int k = 1; k < nthr_; k++) {
+            auto &victim = *ranges_[(ithr + k) % nthr_];
+            int start, end;
+            {
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                const int left = victim.end - victim.begin;
+                if (left <= 0) continue;
+                start = victim.end - utils::div_up(left, 2);
+                end = victim.end;
+                victim.end = start;
+            }
+            auto &own = *ranges_[ithr];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            own.begin = start;
+            own.end = end;
+            return true;
+        }
+        return false;
+    }
+
+    void run(int ithr) {
+        const native_threadpool_t *prev = current_pool();
+        current_pool() = this;
+        int task;
+        do {
+            while (pop(ithr, task))
+                (*fn_)(task, n_);
+        } while (steal(ithr));
+        current_pool() = prev;
+    }
+
+    void worker(int ithr, int cpu) {
+        affinity::pin_to_cpu(cpu);
+        uint64_t seen = 0;
+        for (;;) {
+            const bool woke = spin_until(
+                    [&] { return generation_.load() != seen; });
+            if (!woke) {
+                n_sleeping_.fetch_add(1);
+                std::unique_lock<std::mutex> lock(sleep_mutex_);
+                sleep_cv_.wait(lock, [&] { return generation_.load() != seen; });
+                n_sleeping_.fetch_sub(1);
+            }
+            seen = generation_.load();
+            if (stop_.load()) return;
+            run(ithr);
+            n_done_workers_.fetch_add(1, std::memory_order_release);
+        }
+    }
+
+    const int nthr_;
+    const int spin_us_;
+    std::vector<std::unique_ptr<range_t>> ranges_;
+    std::vector<std::thread> workers_;
+
+    const std::function<void(int, int)> *fn_ = nullptr;
+    int n_ = 0;
+
+    std::mutex submit_mutex_;
+    std::atomic<uint64_t> generation_ {0};
+    std::atomic<int> n_done_workers_ {0};
+
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_cv_;
+    std::atomic<int> n_sleeping_ {0};
+    std::atomic<bool> stop_ {false};
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(native_threadpool_t);
+};
+
+} // namespace
+
+dnnl::threadpool_interop::threadpool_iface *get() {
+    static native_threadpool_t pool(
+            std::max(1,
+                    getenv_int_user("NATIVE_THREADPOOL_NUM_THREADS",
+                            (int)platform::get_max_threads_to_use())),
+            std::max(0, getenv_int_user("NATIVE_THREADPOOL_SPIN_US", 50)),
+            getenv_int_user("NATIVE_THREADPOOL_PIN", 0) == 1);
+    return &pool;
+}
+
+dnnl::threadpool_interop::threadpool_iface *create(
+        int nthr, int spin_us, bool pin) {
+    return new native_threadpool_t(
+            std::max(1, nthr), std::max(0, spin_us), pin);
+}
+
+} // namespace native_threadpool
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
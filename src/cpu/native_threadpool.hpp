@@ -0,0 +1,59 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_NATIVE_THREADPOOL_HPP
+#define CPU_NATIVE_THREADPOOL_HPP
+
+#include "oneapi/dnnl/dnnl_config.h"
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL \
+        && defined(DNNL_ENABLE_NATIVE_THREADPOOL)
+
+#include "oneapi/dnnl/dnnl_threadpool_iface.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace native_threadpool {
+
+// Returns the built-in threadpool used by streams created without a user
+// threadpool. The pool is created on first use; its workers execute tasks
+// from per-thread ranges and steal from the other ranges when they run out
+// of work.
+//
+// The pool is configured with the following environment variables:
+// - ONEDNN_NATIVE_THREADPOOL_NUM_THREADS: number of threads, including the
+//   thread that submits the work (default: the number of cores).
+// - ONEDNN_NATIVE_THREADPOOL_SPIN_US: time in microseconds an idle worker
+//   spins before it goes to sleep (default: 50).
+// - ONEDNN_NATIVE_THREADPOOL_PIN: when set to 1, pins each worker to a core
+//   from the process affinity mask (default: 0). Ignored when a placement
+//   policy is set with ONEDNN_CPU_AFFINITY, see cpu_affinity.hpp.
+dnnl::threadpool_interop::threadpool_iface *get();
+
+// Undocumented API for testing. Creates a separate pool with `nthr` threads
+// that the caller owns.
+dnnl::threadpool_interop::threadpool_iface DNNL_API *create(
+        int nthr, int spin_us, bool pin);
+
+} // namespace native_threadpool
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+#endif
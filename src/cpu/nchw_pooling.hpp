@@ -162,6 +162,9 @@ struct nchw_pooling_bwd_t : public primitive_t {
 
             if (desc()->alg_kind == pooling_max) {
                 const auto ws_dt = hint_fwd_pd_->workspace_md()->data_type;
+                VDISPATCH_POOLING(utils::one_of(ws_dt, data_type::u8,
+                                          data_type::s32),
+                        VERBOSE_UNSUPPORTED_DT);
                 init_default_ws(ws_dt);
                 VDISPATCH_POOLING(
                         compare_ws(hint_fwd_pd_), VERBOSE_WS_MISMATCH);
@@ -22,6 +22,7 @@
 #include "common/c_types_map.hpp"
 #include "common/compiler_workarounds.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/experimental.hpp"
 #include "common/math_utils.hpp"
 #include "common/type_helpers.hpp"
 
@@ -92,7 +93,58 @@ status_t nspc_batch_normalization_fwd_t<d_type>::execute_forward(
     };
     const int nthr = pd()->nthr_;
 
-    if (calculate_stats) {
+    const bool stats_one_pass = experimental::use_bnorm_stats_one_pass();
+
+    if (calculate_stats && stats_one_pass) {
+        // Single pass over src: accumulate sums of data shifted by the first
+        // point of each channel. The shift keeps E[x^2] - E[x]^2 from
+        // catastrophic cancellation when |mean| >> stddev.
+        acc_data_t *ws_reduce_sq = ws_reduce + C * nthr;
+        for (dim_t c = 0; c < C; c++)
+            mean[c] = static_cast<acc_data_t>(src[c]);
+
+        parallel(nthr, [&](const int ithr, const int nthr) {
+            dim_t N_s = 0, N_e = 0;
+            balance211(N, nthr, ithr, N_s, N_e);
+
+            for (dim_t c = 0; c < C; c++) {
+                ws_reduce[C * ithr + c] = 0.;
+                ws_reduce_sq[C * ithr + c] = 0.;
+            }
+
+            for (dim_t n = N_s; n < N_e; n++) {
+                for (dim_t sp = 0; sp < SP; sp++) {
+                    const acc_data_t *_src;
+                    const size_t s_off = (size_t)n * SP * C + sp * C;
+                    if (utils::one_of(d_type, bf16, f16)) {
+                        // convert src from xf16 to f32
+                        acc_data_t *tmp_src = tmp_data_ + ithr * C_align;
+                        types::cvt_to_float(tmp_src, src + s_off, C);
+                        _src = tmp_src;
+                    } else {
+                        _src = reinterpret_cast<const acc_data_t *>(
+                                src + s_off);
+                    }
+                    PRAGMA_OMP_SIMD()
+                    for (int c = 0; c < C; c++) {
+                        acc_data_t m = _src[c] - mean[c];
+                        ws_reduce[C * ithr + c] += m;
+                        ws_reduce_sq[C * ithr + c] += m * m;
+                    }
+                }
+            }
+        });
+        parallel_nd(C, [&](dim_t c) {
+            acc_data_t sum = 0, sum_sq = 0;
+            for (dim_t n = 0; n < nthr; n++) {
+                sum += ws_reduce[C * n + c];
+                sum_sq += ws_reduce_sq[C * n + c];
+            }
+            const acc_data_t d = sum / (SP * N);
+            mean[c] += d;
+            variance[c] = nstl::max(sum_sq / (SP * N) - d * d, 0.f);
+        });
+    } else if (calculate_stats) {
         parallel(nthr, [&](const int ithr, const int nthr) {
             dim_t N_s = 0, N_e = 0;
             balance211(N, nthr, ithr, N_s, N_e);
@@ -167,11 +219,18 @@ status_t nspc_batch_normalization_fwd_t<d_type>::execute_forward(
                 variance[c] += ws_reduce[C * n + c];
             variance[c] /= SP * N;
         });
+    }
+
+    if (calculate_stats) {
         parallel(nthr, [&](const int ithr, const int nthr) {
+            acc_data_t *mean_loc = tmp_mean + nstl::max(C, (dim_t)16) * ithr;
             acc_data_t *variance_loc = tmp_var + nstl::max(C, (dim_t)16) * ithr;
             if (ithr > 0 || save_stats) {
-                for (dim_t c = 0; c < C; c++)
+                for (dim_t c = 0; c < C; c++) {
+                    // two-pass algorithm already copied the mean
+                    if (stats_one_pass) mean_loc[c] = mean[c];
                     variance_loc[c] = variance[c];
+                }
             }
         });
     }
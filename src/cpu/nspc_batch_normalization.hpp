@@ -21,6 +21,7 @@
 
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/experimental.hpp"
 #include "common/memory_tracking.hpp"
 #include "common/primitive.hpp"
 #include "common/type_helpers.hpp"
@@ -92,8 +93,11 @@ struct nspc_batch_normalization_fwd_t : public primitive_t {
             auto scratchpad = scratchpad_registry().registrar();
             if (!stats_is_src()) {
                 const size_t stats_buf_sz = nstl::max(C(), dim_t(16)) * nthr_;
+                // one-pass statistics reduce sums and sums of squares at once
+                const size_t n_reductions
+                        = experimental::use_bnorm_stats_one_pass() ? 2 : 1;
                 scratchpad.template book<acc_data_t>(
-                        key_bnorm_reduction, stats_buf_sz);
+                        key_bnorm_reduction, n_reductions * stats_buf_sz);
                 scratchpad.template book<acc_data_t>(
                         key_bnorm_tmp_mean, stats_buf_sz);
                 scratchpad.template book<acc_data_t>(
@@ -0,0 +1,163 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include "common/utils.hpp"
+
+#include "cpu/numa.hpp"
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace numa {
+
+namespace {
+
+// Parses a Linux cpu list such as "0-3,8,10-11".
+std::vector<int> parse_list(const std::string &s) {
+    std::vector<int> out;
+    size_t pos = 0;
+    while (pos < s.size()) {
+        size_t end = s.find(',', pos);
+        if (end == std::string::npos) end = s.size();
+        const std::string tok = s.substr(pos, end - pos);
+        const size_t dash = tok.find('-');
+        const int first = std::atoi(tok.c_str());
+        const int last = dash == std::string::npos
+                ? first
+                : std::atoi(tok.c_str() + dash + 1);
+        for (int i = first; i <= last; i++)
+            out.push_back(i);
+        pos = end + 1;
+    }
+    return out;
+}
+
+std::string read_line(const std::string &path) {
+    std::string line;
+    FILE *f = fopen(path.c_str(), "r");
+    if (!f) return line;
+    char buf[4096];
+    if (std::fgets(buf, sizeof(buf), f)) line = buf;
+    std::fclose(f);
+    while (!line.empty() && (line.back() == '\n' || line.back() == ' '))
+        line.pop_back();
+    return line;
+}
+
+struct topology_t {
+    topology_t() {
+#if defined(__linux__)
+        const std::string sys = "/sys/devices/system/node/";
+        const auto nodes = parse_list(read_line(sys + "online"));
+        for (int node : nodes) {
+            const auto cpus = parse_list(read_line(
+                    sys + "node" + std::to_string(node) + "/cpulist"));
+            for (int cpu : cpus) {
+                if (cpu >= (int)cpu_to_node.size())
+                    cpu_to_node.resize(cpu + 1, 0);
+                cpu_to_node[cpu] = node;
+            }
+            num_nodes = std::max(num_nodes, node + 1);
+        }
+#endif
+    }
+
+    int num_nodes = 1;
+    std::vector<int> cpu_to_node;
+};
+
+const topology_t &topology() {
+    static const topology_t t;
+    return t;
+}
+
+} // namespace
+
+int get_num_nodes() {
+    return topology().num_nodes;
+}
+
+int get_current_node() {
+#if defined(__linux__)
+    const auto &t = topology();
+    if (t.num_nodes == 1) return 0;
+    const int cpu = sched_getcpu();
+    if (cpu < 0 || cpu >= (int)t.cpu_to_node.size()) return 0;
+    return t.cpu_to_node[cpu];
+#else
+    return 0;
+#endif
+}
+
+int get_cpu_node(int cpu) {
+    const auto &t = topology();
+    if (cpu < 0 || cpu >= (int)t.cpu_to_node.size()) return 0;
+    return t.cpu_to_node[cpu];
+}
+
+bool is_weights_replication_enabled() {
+    static const bool enabled
+            = getenv_int_user("CPU_NUMA_REPLICATE_WEIGHTS", 0) != 0;
+    return enabled;
+}
+
+replicas_t::replicas_t(const void *src, size_t size)
+    : src_(src)
+    , size_(size)
+    , replicas_(new replica_t[get_num_nodes()])
+    , num_nodes_(get_num_nodes()) {}
+
+replicas_t::~replicas_t() {
+    for (int i = 0; i < num_nodes_; i++)
+        if (replicas_[i].state.load() == ready) impl::free(replicas_[i].ptr);
+}
+
+const void *replicas_t::get_local() {
+    const int node = get_current_node();
+    if (node < 0 || node >= num_nodes_) return src_;
+    auto &r = replicas_[node];
+
+    int state = r.state.load(std::memory_order_acquire);
+    if (state == ready) return r.ptr;
+    if (state != empty || !r.state.compare_exchange_strong(state, copying))
+        return src_;
+
+    void *ptr = impl::malloc(size_, PAGE_4K);
+    if (!ptr) {
+        r.state.store(failed, std::memory_order_release);
+        return src_;
+    }
+    std::memcpy(ptr, src_, size_);
+    r.ptr = ptr;
+    r.state.store(ready, std::memory_order_release);
+    return ptr;
+}
+
+} // namespace numa
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,80 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_NUMA_HPP
+#define CPU_NUMA_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace numa {
+
+// Returns the number of NUMA nodes of the system, 1 if unknown.
+int get_num_nodes();
+
+// Returns the NUMA node of the CPU the calling thread runs on, 0 if unknown.
+int get_current_node();
+
+// Returns the NUMA node of `cpu`, 0 if unknown.
+int get_cpu_node(int cpu);
+
+// Returns whether constant weights are replicated per NUMA node, which is
+// enabled with ONEDNN_CPU_NUMA_REPLICATE_WEIGHTS=1.
+bool is_weights_replication_enabled();
+
+// Copies of a read-only buffer, one per NUMA node. A copy is made by the
+// first thread that requests it on a node, so the first-touch policy of the
+// operating system places it in the node memory.
+struct replicas_t {
+    replicas_t(const void *src, size_t size);
+    ~replicas_t();
+
+    const void *src() const { return src_; }
+    size_t size() const { return size_; }
+
+    // Returns the copy for the node of the calling thread. While another
+    // thread makes the copy, or if it cannot be made, returns the source.
+    const void *get_local();
+
+private:
+    enum state_t { empty = 0, copying, ready, failed };
+    struct replica_t {
+        std::atomic<int> state {empty};
+        void *ptr = nullptr;
+    };
+
+    const void *src_;
+    size_t size_;
+    std::unique_ptr<replica_t[]> replicas_;
+    int num_nodes_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(replicas_t);
+};
+
+} // namespace numa
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
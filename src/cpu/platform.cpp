@@ -277,6 +277,22 @@ unsigned get_num_cores() {
 #endif
 }
 
+bool is_hybrid() {
+#if DNNL_X64
+    static const bool hybrid = [] {
+        uint32_t data[4] = {};
+        Xbyak::util::Cpu::getCpuidEx(0, 0, data);
+        if (data[0] < 7) return false;
+        // CPUID.(EAX=07H,ECX=0):EDX[15] reports a hybrid part.
+        Xbyak::util::Cpu::getCpuidEx(7, 0, data);
+        return (data[3] & (1u << 15)) != 0;
+    }();
+    return hybrid;
+#else
+    return false;
+#endif
+}
+
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
 // The purpose of this function is to return the potential maximum number of
 // threads in user's threadpool. It is assumed that the number of threads in an
@@ -172,6 +172,9 @@ unsigned DNNL_API get_per_core_cache_size(int level);
 uint32_t get_num_ways_in_cache(int level);
 uint32_t get_num_sets_in_cache(int level);
 unsigned DNNL_API get_num_cores();
+// Returns true if the CPU has cores of different types, e.g. performance and
+// efficiency cores.
+bool DNNL_API is_hybrid();
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
 unsigned DNNL_API get_max_threads_to_use();
 #endif
@@ -0,0 +1,218 @@
+/*******************************************************************************
+* Copyright 2025 IBM Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifdef __MMA__
+#include <altivec.h>
+
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/ppc64/ppc64_gemm_f32.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace ppc64 {
+
+namespace {
+
+typedef __vector unsigned char vec_t;
+
+// A 16x8 tile of C is computed with all 8 accumulators: 4 vectors of A rows
+// times 2 vectors of B columns.
+constexpr dim_t mr = 16;
+constexpr dim_t nr = 8;
+// Cache blocking of a task.
+constexpr dim_t mc = 128;
+constexpr dim_t nc = 64;
+constexpr dim_t kc = 256;
+
+// kp is the number of consecutive k values one MMA rank update consumes.
+template <typename T>
+struct mma_traits_t {};
+
+template <>
+struct mma_traits_t<float> {
+    static constexpr int kp = 1;
+    static void ger(__vector_quad *acc, vec_t x, vec_t y) {
+        __builtin_mma_xvf32gerpp(acc, x, y);
+    }
+};
+
+template <>
+struct mma_traits_t<bfloat16_t> {
+    static constexpr int kp = 2;
+    static void ger(__vector_quad *acc, vec_t x, vec_t y) {
+        __builtin_mma_xvbf16ger2pp(acc, x, y);
+    }
+};
+
+// Packs rows [r0, r0 + r_len) and columns [k0, k0 + k_len) of a matrix into
+// panels of `rp` rows laid out as [k / kp][rp][kp]. Elements outside of the
+// matrix are zeroed. `r_contig` tells that the rows are contiguous in memory.
+template <typename T>
+void pack(const T *src, dim_t ld, bool r_contig, dim_t r0, dim_t r_len,
+        dim_t k0, dim_t k_len, dim_t rp, T *dst) {
+    constexpr int kp = mma_traits_t<T>::kp;
+    const dim_t k_pairs = utils::div_up(k_len, kp);
+    for (dim_t rb = 0; rb < r_len; rb += rp) {
+        for (dim_t kk = 0; kk < k_pairs; kk++)
+            for (dim_t r = 0; r < rp; r++)
+                for (int p = 0; p < kp; p++) {
+                    const dim_t k = kk * kp + p;
+                    const dim_t row = rb + r;
+                    T v = T(0.f);
+                    if (row < r_len && k < k_len) {
+                        v = r_contig ? src[(k0 + k) * ld + r0 + row]
+                                     : src[(r0 + row) * ld + k0 + k];
+                    }
+                    *dst++ = v;
+                }
+    }
+}
+
+// Computes a 16x8 tile of op(A) * op(B) over k_len values of K and stores
+// it column-major with the leading dimension mr.
+template <typename T>
+void kernel(dim_t k_len, const T *ap, const T *bp, float *tile) {
+    constexpr int kp = mma_traits_t<T>::kp;
+    __vector_quad acc[4][2];
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 2; j++)
+            __builtin_mma_xxsetaccz(&acc[i][j]);
+
+    const dim_t k_pairs = utils::div_up(k_len, kp);
+    for (dim_t kk = 0; kk < k_pairs; kk++) {
+        vec_t a[4], b[2];
+        for (int i = 0; i < 4; i++)
+            a[i] = *(const vec_t *)(ap + (kk * mr + 4 * i) * kp);
+        for (int j = 0; j < 2; j++)
+            b[j] = *(const vec_t *)(bp + (kk * nr + 4 * j) * kp);
+        // B goes first, so that the rows of an accumulator are columns of C.
+        for (int i = 0; i < 4; i++)
+            for (int j = 0; j < 2; j++)
+                mma_traits_t<T>::ger(&acc[i][j], b[j], a[i]);
+    }
+
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 2; j++) {
+            __vector float res[4];
+            __builtin_mma_disassemble_acc((void *)res, &acc[i][j]);
+            for (int r = 0; r < 4; r++)
+                *(__vector float *)(tile + (4 * j + r) * mr + 4 * i) = res[r];
+        }
+}
+
+template <typename T>
+dnnl_status_t gemm_mma(const char *transa, const char *transb, dim_t m,
+        dim_t n, dim_t k, float alpha, const T *A, dim_t lda, const T *B,
+        dim_t ldb, float beta, float *C, dim_t ldc, const float *bias) {
+    if (!utils::one_of(*transa, 'n', 'N', 't', 'T')
+            || !utils::one_of(*transb, 'n', 'N', 't', 'T'))
+        return dnnl_unimplemented;
+    if (m == 0 || n == 0) return dnnl_success;
+
+    const bool trA = utils::one_of(*transa, 't', 'T');
+    const bool trB = utils::one_of(*transb, 't', 'T');
+
+    const dim_t nb_m = utils::div_up(m, mc);
+    const dim_t nb_n = utils::div_up(n, nc);
+    const dim_t nb_k = nstl::max(utils::div_up(k, kc), dim_t(1));
+
+    const int nthr_gemm
+            = nstl::min<dim_t>(dnnl_get_max_threads(), nb_m * nb_n);
+    const size_t ap_size = mc * kc, bp_size = kc * nc, tile_size = mr * nr;
+    const size_t thr_size = (ap_size + bp_size) * sizeof(T)
+            + tile_size * sizeof(float);
+    char *mem = (char *)malloc(thr_size * nthr_gemm, 128);
+    if (mem == nullptr) return dnnl_out_of_memory;
+
+    parallel(nthr_gemm, [&](const int ithr, const int nthr) {
+        T *ap = (T *)(mem + ithr * thr_size);
+        T *bp = ap + ap_size;
+        float *tile = (float *)(bp + bp_size);
+
+        dim_t start = 0, end = 0;
+        balance211(nb_m * nb_n, nthr, ithr, start, end);
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t m0 = (iwork % nb_m) * mc;
+            const dim_t n0 = (iwork / nb_m) * nc;
+            const dim_t m_len = nstl::min(mc, m - m0);
+            const dim_t n_len = nstl::min(nc, n - n0);
+
+            for (dim_t kb = 0; kb < nb_k; kb++) {
+                const dim_t k0 = kb * kc;
+                const dim_t k_len = nstl::min(kc, k - k0);
+                const dim_t k_pad = utils::rnd_up(k_len, mma_traits_t<T>::kp);
+                pack(A, lda, !trA, m0, m_len, k0, k_len, mr, ap);
+                pack(B, ldb, trB, n0, n_len, k0, k_len, nr, bp);
+
+                // The first block applies beta, the last one adds bias.
+                const bool first = kb == 0;
+                const bool last = kb == nb_k - 1;
+                for (dim_t j0 = 0; j0 < n_len; j0 += nr)
+                    for (dim_t i0 = 0; i0 < m_len; i0 += mr) {
+                        kernel(k_len, ap + i0 * k_pad, bp + j0 * k_pad, tile);
+                        const dim_t i_len = nstl::min(mr, m_len - i0);
+                        const dim_t j_len = nstl::min(nr, n_len - j0);
+                        for (dim_t j = 0; j < j_len; j++) {
+                            float *c = C + (n0 + j0 + j) * ldc + m0 + i0;
+                            for (dim_t i = 0; i < i_len; i++) {
+                                float v = alpha * tile[j * mr + i];
+                                // C is not read when beta is zero as it may
+                                // be uninitialized.
+                                if (!first)
+                                    v += c[i];
+                                else if (beta != 0.f)
+                                    v += beta * c[i];
+                                if (last && bias) v += bias[m0 + i0 + i];
+                                c[i] = v;
+                            }
+                        }
+                    }
+            }
+        }
+    });
+
+    free(mem);
+    return dnnl_success;
+}
+
+} // namespace
+
+dnnl_status_t gemm_f32_ppc64(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const float *A, const dim_t *lda, const float *B, const dim_t *ldb,
+        const float *beta, float *C, const dim_t *ldc, const float *bias) {
+    return gemm_mma<float>(transa, transb, *M, *N, *K, *alpha, A, *lda, B,
+            *ldb, *beta, C, *ldc, bias);
+}
+
+dnnl_status_t gemm_bf16bf16f32_ppc64(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const bfloat16_t *A, const dim_t *lda, const bfloat16_t *B,
+        const dim_t *ldb, const float *beta, float *C, const dim_t *ldc) {
+    return gemm_mma<bfloat16_t>(transa, transb, *M, *N, *K, *alpha, A, *lda, B,
+            *ldb, *beta, C, *ldc, nullptr);
+}
+
+} // namespace ppc64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // __MMA__
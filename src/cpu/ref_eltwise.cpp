@@ -22,6 +22,7 @@
 #include "common/type_helpers.hpp"
 
 #include "cpu/ref_eltwise.hpp"
+#include "cpu/ref_io_helper.hpp"
 #include "cpu/simple_q10n.hpp"
 
 namespace dnnl {
@@ -38,6 +39,28 @@ namespace cpu {
                                                             : (f).off(n, c, d, \
                                                                     h, w))))
 
+template <data_type_t data_type>
+status_t ref_eltwise_fwd_t<data_type>::stash_activation(
+        const exec_ctx_t &ctx, bool is_dst) const {
+    status_t status = status::success;
+    const data_t *data = is_dst ? CTX_OUT_MEM(const data_t *, DNNL_ARG_DST)
+                                : CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto ws = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_WORKSPACE, status);
+    CHECK(status);
+
+    const memory_desc_wrapper data_d(pd()->src_md());
+    const memory_desc_wrapper ws_d(pd()->workspace_md());
+    const data_type_t ws_dt = ws_d.data_type();
+    data += data_d.offset0();
+
+    // The workspace is a dense copy of the dense data tensor, so that the
+    // physical offsets are the same.
+    parallel_nd(ws_d.nelems(true), [&](dim_t e) {
+        io::store_float_value(ws_dt, static_cast<float>(data[e]), ws, e);
+    });
+    return status::success;
+}
+
 template <data_type_t data_type>
 status_t ref_eltwise_fwd_t<data_type>::execute_forward_nCspBc_padded(
         const exec_ctx_t &ctx) const {
@@ -267,6 +290,37 @@ status_t ref_eltwise_bwd_t<data_type>::execute_backward_dense(
     return status::success;
 }
 
+template <data_type_t data_type>
+status_t ref_eltwise_bwd_t<data_type>::execute_backward_stashed(
+        const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+    const void *ws = CTX_IN_MEM(const void *, DNNL_ARG_WORKSPACE);
+    const void *diff_dst = CTX_IN_MEM(const void *, DNNL_ARG_DIFF_DST);
+    void *diff_src = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DIFF_SRC, status);
+    CHECK(status);
+
+    const memory_desc_wrapper ws_d(pd()->workspace_md());
+    const memory_desc_wrapper diff_data_d(pd()->diff_src_md());
+
+    const data_type_t ws_dt = ws_d.data_type();
+    const auto alg_kind = pd()->desc()->alg_kind;
+    const float alpha = pd()->desc()->alpha;
+    const float beta = pd()->desc()->beta;
+    const dim_t diff_off0 = diff_data_d.offset0();
+
+    // The diff tensors have the dense layout of the data tensor, see
+    // pd_t::init(), so the workspace shares their physical offsets.
+    parallel_nd(ws_d.nelems(true), [&](dim_t e) {
+        const float s = io::load_float_value(ws_dt, ws, e);
+        const float dd
+                = io::load_float_value(data_type, diff_dst, diff_off0 + e);
+        const float ds
+                = compute_eltwise_scalar_bwd(alg_kind, dd, s, alpha, beta);
+        io::store_float_value(data_type, ds, diff_src, diff_off0 + e);
+    });
+    return status::success;
+}
+
 template struct ref_eltwise_fwd_t<data_type::f32>;
 template struct ref_eltwise_fwd_t<data_type::bf16>;
 template struct ref_eltwise_fwd_t<data_type::f16>;
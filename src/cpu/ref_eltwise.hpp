@@ -53,7 +53,8 @@ struct ref_eltwise_fwd_t : public primitive_t {
                     VERBOSE_UNSUPPORTED_DT);
             VDISPATCH_ELTWISE(platform::has_data_type_support(data_type),
                     VERBOSE_UNSUPPORTED_DT);
-            VDISPATCH_ELTWISE(attr()->has_default_values(sm::post_ops),
+            VDISPATCH_ELTWISE(attr()->has_default_values(
+                                      sm::post_ops | sm::activation_stash),
                     VERBOSE_UNSUPPORTED_ATTR);
             VDISPATCH_ELTWISE(
                     ref_post_ops_t::primitive_kind_ok(attr()->post_ops_),
@@ -65,6 +66,8 @@ struct ref_eltwise_fwd_t : public primitive_t {
             VDISPATCH_ELTWISE(
                     attr_.set_default_formats(dst_md(0)) == status::success,
                     VERBOSE_UNSUPPORTED_POSTOP);
+            VDISPATCH_ELTWISE_SC(init_activation_stash_ws(*src_md()),
+                    VERBOSE_UNSUPPORTED_TAG);
 
             use_dense_ = src_d.is_dense(true) && dst_d.is_dense(true)
                     && IMPLICATION(!src_d.is_dense() || !dst_d.is_dense(),
@@ -99,16 +102,26 @@ struct ref_eltwise_fwd_t : public primitive_t {
     using data_t = typename prec_traits_t<data_type>::type;
 
     status_t execute(const exec_ctx_t &ctx) const override {
+        // The source is stashed before the computations, as they may
+        // overwrite it when executed in place.
+        const bool with_stash = pd()->with_activation_stash();
+        const bool stash_dst = pd()->is_alg_use_dst_for_bwd();
+        if (with_stash && !stash_dst) CHECK(stash_activation(ctx, false));
+
         if (pd()->use_dense_)
-            return execute_forward_dense(ctx);
+            CHECK(execute_forward_dense(ctx));
         else if (pd()->use_nCspBc_padded_)
-            return execute_forward_nCspBc_padded(ctx);
+            CHECK(execute_forward_nCspBc_padded(ctx));
         else
-            return execute_forward_generic(ctx);
+            CHECK(execute_forward_generic(ctx));
+
+        if (with_stash && stash_dst) CHECK(stash_activation(ctx, true));
+        return status::success;
     }
 
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    status_t stash_activation(const exec_ctx_t &ctx, bool is_dst) const;
     status_t execute_forward_nCspBc_padded(const exec_ctx_t &ctx) const;
     status_t execute_forward_dense(const exec_ctx_t &ctx) const;
     status_t execute_forward_generic(const exec_ctx_t &ctx) const;
@@ -137,11 +150,21 @@ struct ref_eltwise_bwd_t : public primitive_t {
             VDISPATCH_ELTWISE(platform::has_data_type_support(data_type),
                     VERBOSE_UNSUPPORTED_DT);
             VDISPATCH_ELTWISE(
-                    attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+                    attr()->has_default_values(
+                            primitive_attr_t::skip_mask_t::activation_stash),
+                    VERBOSE_UNSUPPORTED_ATTR);
             VDISPATCH_ELTWISE(
                     set_default_formats_common(), VERBOSE_UNSUPPORTED_TAG);
             VDISPATCH_ELTWISE(diff_dst_d == diff_src_d,
                     VERBOSE_INCONSISTENT_MDS, "diff_src", "diff_dst");
+            VDISPATCH_ELTWISE_SC(init_activation_stash_ws(*data_md()),
+                    VERBOSE_UNSUPPORTED_TAG);
+            // The stash is written by the forward primitive.
+            VDISPATCH_ELTWISE(IMPLICATION(with_activation_stash(),
+                                      hint_fwd_pd_ != nullptr
+                                              && *hint_fwd_pd_->workspace_md()
+                                                      == *workspace_md()),
+                    VERBOSE_WS_MISMATCH);
 
             use_dense_ = diff_dst_d.is_dense()
                     || (diff_dst_d.is_dense(true) && is_zero_preserved());
@@ -149,8 +172,11 @@ struct ref_eltwise_bwd_t : public primitive_t {
             if (has_zero_dim_memory()) use_dense_ = false;
             if (diff_dst_d != memory_desc_wrapper(data_md()))
                 use_dense_ = false;
+            VDISPATCH_ELTWISE(IMPLICATION(with_activation_stash(), use_dense_),
+                    VERBOSE_UNSUPPORTED_TAG);
 
-            if (utils::one_of(data_type, bf16, f16, f8_e5m2, f8_e4m3))
+            if (utils::one_of(data_type, bf16, f16, f8_e5m2, f8_e4m3)
+                    && !with_activation_stash())
                 init_scratchpad();
 
             return status::success;
@@ -176,13 +202,16 @@ struct ref_eltwise_bwd_t : public primitive_t {
     using data_t = typename prec_traits_t<data_type>::type;
 
     status_t execute(const exec_ctx_t &ctx) const override {
-        if (pd()->use_dense_)
+        if (pd()->with_activation_stash())
+            return execute_backward_stashed(ctx);
+        else if (pd()->use_dense_)
             return execute_backward_dense(ctx);
         else
             return execute_backward_generic(ctx);
     }
 
 private:
+    status_t execute_backward_stashed(const exec_ctx_t &ctx) const;
     status_t execute_backward_dense(const exec_ctx_t &ctx) const;
     status_t execute_backward_generic(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
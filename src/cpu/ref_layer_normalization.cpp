@@ -37,6 +37,7 @@ status_t ref_layer_normalization_fwd_t::execute_forward(
     const memory_desc_wrapper sc_d(pd()->weights_md());
 
     auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    auto src_1 = CTX_IN_MEM(const void *, DNNL_ARG_SRC_1);
     auto scale = CTX_IN_MEM(const void *, DNNL_ARG_SCALE);
     auto shift = CTX_IN_MEM(const void *, DNNL_ARG_SHIFT);
     auto mean = pd()->stats_are_src()
@@ -46,6 +47,7 @@ status_t ref_layer_normalization_fwd_t::execute_forward(
             ? const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE))
             : CTX_OUT_MEM(float *, DNNL_ARG_VARIANCE);
     auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+    auto dst_1 = CTX_OUT_MEM(void *, DNNL_ARG_DST_1);
 
     DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
     DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
@@ -57,6 +59,16 @@ status_t ref_layer_normalization_fwd_t::execute_forward(
     const bool save_stats = pd()->is_training();
     const bool calculate_stats = !pd()->stats_are_src();
     const bool skip_mean = pd()->skip_mean();
+    const bool fuse_residual_add = pd()->fuse_residual_add();
+    const bool save_residual_sum = pd()->save_residual_sum();
+
+    // The value being normalized: src, or the sum of src and the residual.
+    auto load_src = [&](dim_t off) {
+        float s = io::load_float_value(src_d.data_type(), src, off);
+        if (fuse_residual_add)
+            s += io::load_float_value(src_d.data_type(), src_1, off);
+        return s;
+    };
 
     /* fast return */
     if (this->pd()->has_zero_dim_memory()) {
@@ -78,8 +90,7 @@ status_t ref_layer_normalization_fwd_t::execute_forward(
             if (!skip_mean) {
                 for (dim_t c = 0; c < C; ++c) {
                     const auto s_off = src_d.off_l(n * C + c);
-                    float s = io::load_float_value(
-                            src_d.data_type(), src, s_off);
+                    float s = load_src(s_off);
                     v_mean += s;
                 }
                 v_mean /= C;
@@ -87,7 +98,7 @@ status_t ref_layer_normalization_fwd_t::execute_forward(
 
             for (dim_t c = 0; c < C; ++c) {
                 const auto s_off = src_d.off_l(n * C + c);
-                float s = io::load_float_value(src_d.data_type(), src, s_off);
+                float s = load_src(s_off);
                 float m = s - v_mean;
                 v_variance += m * m;
             }
@@ -106,7 +117,9 @@ status_t ref_layer_normalization_fwd_t::execute_forward(
             const float sm = scale_val / sqrt_variance;
             const auto s_off = src_d.off_l(n * C + c);
             const auto d_off = dst_d.off_l(n * C + c);
-            float s = io::load_float_value(src_d.data_type(), src, s_off);
+            float s = load_src(s_off);
+            if (save_residual_sum)
+                io::store_float_value(src_d.data_type(), s, dst_1, s_off);
             float d = sm * (s - v_mean) + shift_val;
             d *= src_scales[0];
 
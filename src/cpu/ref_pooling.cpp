@@ -169,13 +169,44 @@ status_t ref_pooling_fwd_t<data_type, acc_type>::execute_forward(
         d /= num_summands;
     };
 
-    const bool is_max_pool = alg == alg_kind::pooling_max;
+    // Adaptive windows are [start, end) ranges derived per output point; the
+    // workspace index is relative to the window start.
+    auto ker_adaptive = [=](float &d, dim_t mb, dim_t oc, dim_t od, dim_t oh,
+                                dim_t ow) {
+        const bool is_max = alg == alg_kind::pooling_adaptive_max;
+        const dim_t id_s = adaptive_pool_start(od, ID, OD);
+        const dim_t id_e = adaptive_pool_end(od, ID, OD);
+        const dim_t ih_s = adaptive_pool_start(oh, IH, OH);
+        const dim_t ih_e = adaptive_pool_end(oh, IH, OH);
+        const dim_t iw_s = adaptive_pool_start(ow, IW, OW);
+        const dim_t iw_e = adaptive_pool_end(ow, IW, OW);
+
+        if (is_max) set_ws(mb, oc, od, oh, ow, 0);
+        for_(dim_t id = id_s; id < id_e; ++id)
+        for_(dim_t ih = ih_s; ih < ih_e; ++ih)
+        for (dim_t iw = iw_s; iw < iw_e; ++iw) {
+            const auto s = src[get_offset(src_d, mb, oc, id, ih, iw)];
+            if (!is_max) {
+                d += s;
+            } else if (s > d) {
+                d = s;
+                set_ws(mb, oc, od, oh, ow,
+                        ((id - id_s) * KH + (ih - ih_s)) * KW + (iw - iw_s));
+            }
+        }
+        if (!is_max) d /= (id_e - id_s) * (ih_e - ih_s) * (iw_e - iw_s);
+    };
+
+    const bool is_max_pool = utils::one_of(
+            alg, alg_kind::pooling_max, alg_kind::pooling_adaptive_max);
 
     float base_res
             = is_max_pool ? (float)numeric_limits<data_t>::lowest() : 0.f;
     using ker_t
             = std::function<void(float &, dim_t, dim_t, dim_t, dim_t, dim_t)>;
-    ker_t kernel = is_max_pool ? (ker_t)ker_max : (ker_t)ker_avg;
+    ker_t kernel = pd()->is_adaptive() ? (ker_t)ker_adaptive
+            : is_max_pool              ? (ker_t)ker_max
+                                       : (ker_t)ker_avg;
 
     parallel_nd(MB, OC, OD, OH, OW,
             [&](dim_t mb, dim_t oc, dim_t od, dim_t oh, dim_t ow) {
@@ -318,6 +349,44 @@ status_t ref_pooling_bwd_t::execute(const exec_ctx_t &ctx) const {
         }
     };
 
+    auto ker_adaptive = [=](dim_t mb, dim_t oc, dim_t od, dim_t oh, dim_t ow) {
+        const dim_t id_s = adaptive_pool_start(od, ID, OD);
+        const dim_t id_e = adaptive_pool_end(od, ID, OD);
+        const dim_t ih_s = adaptive_pool_start(oh, IH, OH);
+        const dim_t ih_e = adaptive_pool_end(oh, IH, OH);
+        const dim_t iw_s = adaptive_pool_start(ow, IW, OW);
+        const dim_t iw_e = adaptive_pool_end(ow, IW, OW);
+
+        const auto diff_dst_off = get_offset(diff_dst_d, mb, oc, od, oh, ow);
+        const float dd = io::load_float_value(
+                diff_dst_d.data_type(), diff_dst, diff_dst_off);
+
+        auto accumulate = [&](dim_t id, dim_t ih, dim_t iw, float val) {
+            const auto diff_src_off
+                    = get_offset(diff_src_d, mb, oc, id, ih, iw);
+            const float ds = io::load_float_value(
+                    data_type::f32, diff_src, diff_src_off);
+            io::store_float_value(
+                    data_type::f32, ds + val, diff_src, diff_src_off);
+        };
+
+        if (alg == alg_kind::pooling_adaptive_max) {
+            const auto ws_off = get_offset(ws_d, mb, oc, od, oh, ow);
+            const dim_t index
+                    = io::load_int_value(ws_d.data_type(), ws, ws_off);
+            accumulate(id_s + (index / KW) / KH, ih_s + (index / KW) % KH,
+                    iw_s + index % KW, dd);
+            return;
+        }
+
+        const dim_t num_summands
+                = (id_e - id_s) * (ih_e - ih_s) * (iw_e - iw_s);
+        for_(dim_t id = id_s; id < id_e; ++id)
+        for_(dim_t ih = ih_s; ih < ih_e; ++ih)
+        for (dim_t iw = iw_s; iw < iw_e; ++iw)
+            accumulate(id, ih, iw, dd / num_summands);
+    };
+
     dim_t ow_start
             = max(dim_t(0), utils::div_up(padL - ((KW - 1) * DW + KW) + 1, SW));
     dim_t ow_end = min(OW, 1 + (padL + IW - 1) / SW);
@@ -330,9 +399,18 @@ status_t ref_pooling_bwd_t::execute(const exec_ctx_t &ctx) const {
             = max(dim_t(0), utils::div_up(padF - ((KD - 1) * DD + KD) + 1, SD));
     dim_t od_end = min(OD, 1 + (padF + ID - 1) / SD);
 
+    if (pd()->is_adaptive()) {
+        // Every output point has a non-empty window inside the source.
+        ow_start = oh_start = od_start = 0;
+        ow_end = OW;
+        oh_end = OH;
+        od_end = OD;
+    }
+
     using ker_t = std::function<void(dim_t, dim_t, dim_t, dim_t, dim_t)>;
-    ker_t kernel
-            = alg == alg_kind::pooling_max ? (ker_t)ker_max : (ker_t)ker_avg;
+    ker_t kernel = pd()->is_adaptive() ? (ker_t)ker_adaptive
+            : alg == alg_kind::pooling_max ? (ker_t)ker_max
+                                           : (ker_t)ker_avg;
 
     const int nthr = pd()->nthr_;
     parallel(nthr, [&](const int ithr, const int nthr) {
@@ -63,8 +63,9 @@ struct ref_pooling_fwd_t : public primitive_t {
                     VERBOSE_UNSUPPORTED_POSTOP);
 
             bool is_training = desc_.prop_kind == prop_kind::forward_training;
-            if (desc()->alg_kind == alg_kind::pooling_max && is_training)
-                init_default_ws();
+            const bool is_max = utils::one_of(desc()->alg_kind,
+                    alg_kind::pooling_max, alg_kind::pooling_adaptive_max);
+            if (is_max && is_training) init_default_ws();
 
             return status::success;
         }
@@ -118,7 +119,8 @@ struct ref_pooling_bwd_t : public primitive_t {
             VDISPATCH_POOLING(
                     attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
 
-            if (desc()->alg_kind == alg_kind::pooling_max) {
+            if (utils::one_of(desc()->alg_kind, alg_kind::pooling_max,
+                        alg_kind::pooling_adaptive_max)) {
                 const auto ws_dt = hint_fwd_pd_->workspace_md()->data_type;
                 init_default_ws(ws_dt);
                 VDISPATCH_POOLING(
@@ -16,6 +16,7 @@
 
 #include <cassert>
 #include <cfloat>
+#include <vector>
 
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
@@ -152,6 +153,24 @@ void ref_resampling_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
                 bilin_interp(c001, c011, c101, c111, w0, w1), w2);
     };
 
+    // Cubic and antialiased linear algorithms are separable filters, their
+    // coefficients are computed once per spatial dimension.
+    const bool is_filter = utils::one_of(alg, alg_kind::resampling_cubic,
+            alg_kind::resampling_linear_antialias);
+    const dim_t KD = is_filter ? filter_taps(alg, OD, ID) : 0;
+    const dim_t KH = is_filter ? filter_taps(alg, OH, IH) : 0;
+    const dim_t KW = is_filter ? filter_taps(alg, OW, IW) : 0;
+    std::vector<dim_t> idx_d(OD * KD), idx_h(OH * KH), idx_w(OW * KW);
+    std::vector<float> wei_d(OD * KD), wei_h(OH * KH), wei_w(OW * KW);
+    if (is_filter) {
+        for (dim_t od = 0; od < OD; od++)
+            filter_coeffs(alg, od, OD, ID, &idx_d[od * KD], &wei_d[od * KD]);
+        for (dim_t oh = 0; oh < OH; oh++)
+            filter_coeffs(alg, oh, OH, IH, &idx_h[oh * KH], &wei_h[oh * KH]);
+        for (dim_t ow = 0; ow < OW; ow++)
+            filter_coeffs(alg, ow, OW, IW, &idx_w[ow * KW], &wei_w[ow * KW]);
+    }
+
     parallel_nd(MB, C, OD, OH, OW,
             [&](dim_t mb, dim_t ch, dim_t od, dim_t oh, dim_t ow) {
                 const dim_t data_p_off = get_offset(dst_d, mb, ch, od, oh, ow);
@@ -190,6 +209,19 @@ void ref_resampling_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
                     res = trilin_interp(src_l[0], src_l[1], src_l[2], src_l[3],
                             src_l[4], src_l[5], src_l[6], src_l[7], id.wei[0],
                             ih.wei[0], iw.wei[0]);
+                } else if (is_filter) {
+                    for_(dim_t kd = 0; kd < KD; kd++)
+                    for_(dim_t kh = 0; kh < KH; kh++)
+                    for (dim_t kw = 0; kw < KW; kw++) {
+                        const float w = wei_d[od * KD + kd]
+                                * wei_h[oh * KH + kh] * wei_w[ow * KW + kw];
+                        res += w
+                                * load_fn(src,
+                                        get_offset(src_d, mb, ch,
+                                                idx_d[od * KD + kd],
+                                                idx_h[oh * KH + kh],
+                                                idx_w[ow * KW + kw]));
+                    }
                 }
 
                 ref_post_ops_t::args_t args;
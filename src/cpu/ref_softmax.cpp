@@ -237,9 +237,51 @@ status_t ref_softmax_fwd_t::execute_forward_generic(
     const auto axis_size = pd()->axis_size(true);
     const int nthr = pd()->nthr_;
 
+    // Attention scores preprocessing. A mask implies `inner_size_ == 1`, so
+    // `ou` enumerates rows of the scores matrix.
+    const float attn_scale = pd()->with_scale()
+            ? CTX_IN_MEM(const float *, DNNL_ARG_SCALE)[0]
+            : 1.f;
+    const auto mask = CTX_IN_MEM(const void *, DNNL_ARG_ATTN_MASK);
+    const memory_desc_wrapper mask_d(pd()->arg_md(DNNL_ARG_ATTN_MASK));
+    const int ndims = pd()->ndims();
+    const dim_t *dims = pd()->dst_md()->dims;
+
     parallel_nd_ext(nthr, outer_size_, [&](int ithr, int, dim_t ou) {
         const dim_t thr_shift = ithr * axis_size;
 
+        dim_t mask_off = 0, mask_c_stride = 0, n_valid = channels_;
+        if (pd()->mask_type() != attn_mask_type::undef) {
+            dims_t pos;
+            utils::l_dims_by_l_offset(pos, ou * channels_, dims, ndims);
+            if (pd()->with_mask_buffer()) {
+                for (int d = 0; d < ndims; d++)
+                    if (mask_d.dims()[d] == 1) pos[d] = 0;
+                mask_off = mask_d.off_v(pos);
+                mask_c_stride = mask_d.dims()[ndims - 1] == 1
+                        ? 0
+                        : mask_d.blocking_desc().strides[ndims - 1];
+            } else {
+                const dim_t diag_off
+                        = pd()->mask_type() == attn_mask_type::bottom_right
+                        ? dims[ndims - 1] - dims[ndims - 2]
+                        : 0;
+                n_valid = nstl::max<dim_t>(0,
+                        nstl::min<dim_t>(
+                                channels_, pos[ndims - 2] + 1 + diag_off));
+            }
+        }
+        auto load_src = [&](size_t src_off, int c) {
+            float s = io::load_float_value(src_d.data_type(), src, src_off);
+            if (!pd()->with_attn_preprocessing()) return s;
+            s *= attn_scale;
+            if (pd()->with_mask_buffer())
+                s += io::load_float_value(
+                        mask_d.data_type(), mask, mask_off + c * mask_c_stride);
+            if (c >= n_valid) s = -INFINITY;
+            return s;
+        };
+
         float space_max_val = 0, space_denom_val = 0;
         float *space_max = &space_max_val, *space_denom = &space_denom_val;
         if (inner_size_ > 1) {
@@ -257,13 +299,13 @@ status_t ref_softmax_fwd_t::execute_forward_generic(
 
             for (int c = 0; c < channels_; c++) {
                 size_t off = src_d.off_l(ou_in_offset + c * inner_size_);
-                float s = io::load_float_value(src_d.data_type(), src, off);
+                float s = load_src(off, c);
                 space_max[in] = nstl::max(space_max[in], s);
             }
 
             for (int c = 0; c < channels_; c++) {
                 size_t src_off = src_d.off_l(ou_in_offset + c * inner_size_);
-                float s = io::load_float_value(src_d.data_type(), src, src_off);
+                float s = load_src(src_off, c);
                 float d = s - space_max[in];
                 if (pd()->is_softmax()) {
                     d = expf(d);
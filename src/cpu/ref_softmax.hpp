@@ -54,8 +54,8 @@ struct ref_softmax_fwd_t : public primitive_t {
             VDISPATCH_SOFTMAX(
                     utils::one_of(src_md()->data_type, f32, bf16, f16, s8, u8),
                     VERBOSE_UNSUPPORTED_DT);
-            VDISPATCH_SOFTMAX(
-                    utils::one_of(dst_md()->data_type, f32, bf16, f16, s8, u8),
+            VDISPATCH_SOFTMAX(utils::one_of(dst_md()->data_type, f32, bf16,
+                                      f16, s8, u8, f8_e5m2, f8_e4m3),
                     VERBOSE_UNSUPPORTED_DT);
             VDISPATCH_SOFTMAX(attr()->has_default_values(skip_mask_t::scales
                                       | skip_mask_t::post_ops),
@@ -134,9 +134,11 @@ struct ref_softmax_fwd_t : public primitive_t {
             if (bd.inner_idxs[iblk] == axis)
                 axis_blk_size *= bd.inner_blks[iblk];
 
+        // Attention scores preprocessing is handled by the generic path only.
         use_dense_ = inner_size_ == 1 && src_d == dst_d && src_d.is_dense(true)
                 && src_d.only_padded_dim(axis)
-                && bd.strides[axis] == axis_blk_size;
+                && bd.strides[axis] == axis_blk_size
+                && !pd()->with_attn_preprocessing();
 
         ref_post_ops
                 = utils::make_unique<ref_post_ops_t>(pd()->attr()->post_ops_);
@@ -0,0 +1,123 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_REF_SPLIT_HPP
+#define CPU_REF_SPLIT_HPP
+
+#include "common/engine.hpp"
+#include "common/primitive.hpp"
+#include "common/reorder.hpp"
+#include "common/reorder_pd.hpp"
+#include "common/stream.hpp"
+
+#include "cpu/cpu_split_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Reorders the image of every destination in the source into the
+// destination. Used when destinations have layouts different from the source.
+struct ref_split_t : public primitive_t {
+    struct pd_t : public cpu_split_pd_t {
+        using cpu_split_pd_t::cpu_split_pd_t;
+
+        DECLARE_SPLIT_PD_T("ref:any", ref_split_t);
+
+        status_t init(engine_t *engine) {
+            VDISPATCH_SPLIT(
+                    attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_SPLIT(cpu_split_pd_t::init() == status::success,
+                    VERBOSE_PRIMITIVE_CREATION_FAIL, "split");
+
+            reorder_pds_.resize(n_);
+            for (int i = 0; i < n_; ++i) {
+                CHECK(reorder_primitive_desc_create(
+                        reorder_pds_[i], engine, dst_image_md(i), dst_md(i)));
+            }
+            init_scratchpad();
+            return status::success;
+        }
+
+        std::vector<std::shared_ptr<primitive_desc_t>> reorder_pds_;
+
+    private:
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            auto scratchpad = scratchpad_registry().registrar();
+            for (size_t i = 0; i < reorder_pds_.size(); i++) {
+                scratchpad.book(key_nested_multiple + (int)i,
+                        reorder_pds_[i]->scratchpad_registry());
+            }
+        }
+    };
+
+    ref_split_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        const size_t n = pd()->reorder_pds_.size();
+        reorders_.resize(n);
+        for (size_t i = 0; i < n; ++i)
+            CHECK(pd()->reorder_pds_[i]->create_primitive(
+                    reorders_[i], engine));
+        return status::success;
+    }
+
+    ~ref_split_t() override = default;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        using namespace memory_tracking::names;
+        engine_t *engine = ctx.stream()->engine();
+        const auto n = pd()->n_outputs();
+
+        auto &src_mem_storage = CTX_IN_STORAGE(DNNL_ARG_SRC);
+        const void *src_ptr = src_mem_storage.data_handle();
+        for (int i = 0; i < n; ++i) {
+            const auto &dst_arg = ctx.args().at(DNNL_ARG_MULTIPLE_DST + i);
+            // A view of the source needs no copy.
+            if (pd()->is_view(i)
+                    && CTX_OUT_STORAGE(DNNL_ARG_MULTIPLE_DST + i).data_handle()
+                            == src_ptr)
+                continue;
+
+            std::unique_ptr<memory_t, memory_deleter_t> src_img_i;
+            CHECK(safe_ptr_assign(src_img_i,
+                    new memory_t(engine, pd()->dst_image_md(i),
+                            src_mem_storage.clone())));
+
+            exec_args_t r_args;
+            r_args[DNNL_ARG_SRC] = {src_img_i.get(), true};
+            r_args[DNNL_ARG_DST] = dst_arg;
+            exec_ctx_t r_ctx(ctx, std::move(r_args));
+
+            nested_scratchpad_t ns(
+                    ctx, key_nested_multiple + i, reorders_[i]);
+            r_ctx.set_scratchpad_grantor(ns.grantor());
+            CHECK(reorders_[i]->execute(r_ctx));
+        }
+        return status::success;
+    }
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    std::vector<std::shared_ptr<primitive_t>> reorders_;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
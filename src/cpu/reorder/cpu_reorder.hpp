@@ -30,6 +30,7 @@
 
 #include "cpu/cpu_engine.hpp"
 #include "cpu/reorder/cpu_reorder_pd.hpp"
+#include "cpu/reorder/dyn_quant_reorder.hpp"
 
 #if DNNL_X64
 #include "cpu/x64/jit_uni_reorder.hpp"
@@ -26,6 +26,7 @@ const impl_list_map_t &regular_bf16_impl_list_map() {
     static const impl_list_map_t the_map = REG_REORDER_P({
         // bf16 ->
         {{bf16, data_type::undef, 0}, {
+            CPU_REORDER_INSTANCE(dyn_quant_reorder_t)
             CPU_REORDER_INSTANCE(rnn_weights_reorder_t<bf16, bf16>)
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::brgemm_matmul_copy_reorder_t))
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_direct_copy_t))
@@ -26,6 +26,7 @@ const impl_list_map_t &regular_f16_impl_list_map() {
     static const impl_list_map_t the_map = REG_REORDER_P({
         // f16 ->
         {{f16, data_type::undef, 0}, {
+            CPU_REORDER_INSTANCE(dyn_quant_reorder_t)
             DNNL_AARCH64_ONLY(REG_SR_DIRECT_COPY(f16, f16))
 
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::brgemm_matmul_copy_reorder_t))
@@ -0,0 +1,234 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <cstring>
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/reorder/dyn_quant_reorder.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t dyn_quant_reorder_t::pd_t::create(reorder_pd_t **reorder_pd,
+        engine_t *engine, const primitive_attr_t *attr, engine_t *src_engine,
+        const memory_desc_t *src_md, engine_t *dst_engine,
+        const memory_desc_t *dst_md) {
+    auto _pd = make_unique_pd<pd_t>(
+            attr, src_engine->kind(), src_md, dst_engine->kind(), dst_md);
+    if (_pd == nullptr) return status::out_of_memory;
+
+    CHECK(_pd->init(engine, src_engine, dst_engine));
+    CHECK(_pd->init_scratchpad_md());
+
+    return safe_ptr_assign(*reorder_pd, _pd.release());
+}
+
+status_t dyn_quant_reorder_t::pd_t::init(
+        engine_t *engine, engine_t *src_engine, engine_t *dst_engine) {
+    using namespace data_type;
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    VDISPATCH_REORDER(attr()->dst_dyn_quant_, VERBOSE_UNSUPPORTED_ATTR);
+    CHECK(cpu_reorder_pd_t::init(engine, src_engine, dst_engine));
+    VDISPATCH_REORDER(
+            attr()->has_default_values(skip_mask_t::scales_data_type
+                    | skip_mask_t::scales_groups
+                    | skip_mask_t::zero_points_data_type
+                    | skip_mask_t::zero_points_groups
+                    | skip_mask_t::dst_dyn_quant),
+            VERBOSE_UNSUPPORTED_ATTR);
+
+    VDISPATCH_REORDER(is_dense_format_kind({src_md(), dst_md()}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+    VDISPATCH_REORDER(!src_d.has_runtime_dims_or_strides()
+                    && !dst_d.has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_REORDER(src_d.is_blocking_desc() && dst_d.is_blocking_desc()
+                    && !dst_d.is_additional_buffer(),
+            VERBOSE_UNSUPPORTED_FORMAT_KIND);
+    VDISPATCH_REORDER(utils::one_of(src_d.data_type(), f32, bf16, f16),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_REORDER(utils::one_of(dst_d.data_type(), s8, u8, s4, u4,
+                              f8_e5m2, f8_e4m3),
+            VERBOSE_UNSUPPORTED_DT);
+    // Int4 values are packed in place over the whole buffer
+    VDISPATCH_REORDER(IMPLICATION(utils::one_of(dst_d.data_type(), s4, u4),
+                              dst_d.is_dense(true) && dst_d.offset0() == 0),
+            VERBOSE_UNSUPPORTED_TENSOR_LAYOUT, "dst");
+
+    const auto &scales = attr()->scales_;
+    const auto &zero_points = attr()->zero_points_;
+    VDISPATCH_REORDER(!scales.has_default_values(DNNL_ARG_DST)
+                    && utils::one_of(scales.get_data_type(DNNL_ARG_DST), f32,
+                            bf16, f16),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    with_zp_ = !zero_points.has_default_values(DNNL_ARG_DST);
+    VDISPATCH_REORDER(
+            IMPLICATION(with_zp_,
+                    utils::one_of(zero_points.get_data_type(DNNL_ARG_DST), s32,
+                            s8, u8)),
+            VERBOSE_UNSUPPORTED_ZP_CFG);
+
+    const int ndims = dst_d.ndims();
+    group0_ = scales.get_group(DNNL_ARG_DST, 0);
+    group1_ = scales.get_group(DNNL_ARG_DST, 1);
+    utils::copy_dims_with_mask(quant_dims_, dst_d.dims(), ndims,
+            scales.get_mask(DNNL_ARG_DST), /* fill_with_ones = */ true);
+    if (ndims >= 2) {
+        quant_dims_[ndims - 1] /= group1_;
+        quant_dims_[ndims - 2] /= group0_;
+    }
+
+    if (utils::one_of(dst_d.data_type(), s4, u4)) {
+        auto scratchpad = scratchpad_registry().registrar();
+        scratchpad.template book<int8_t>(
+                memory_tracking::names::key_reorder_space,
+                dst_d.nelems(true));
+    }
+
+    return status::success;
+}
+
+status_t dyn_quant_reorder_t::execute(const exec_ctx_t &ctx) const {
+    using namespace data_type;
+
+    auto src = CTX_IN_MEM(const void *, DNNL_ARG_FROM);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_TO);
+    auto scales = CTX_OUT_MEM(void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST);
+    auto zero_points
+            = CTX_OUT_MEM(void *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_DST);
+    const bool with_zp = pd()->with_zp_;
+    if (scales == nullptr || (with_zp && zero_points == nullptr))
+        return status::invalid_arguments;
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const auto &attr = *pd()->attr();
+    const data_type_t src_dt = src_d.data_type();
+    const data_type_t dst_dt = dst_d.data_type();
+    const data_type_t scales_dt = attr.scales_.get_data_type(DNNL_ARG_DST);
+    const data_type_t zp_dt = with_zp
+            ? attr.zero_points_.get_data_type(DNNL_ARG_DST)
+            : data_type::undef;
+    const int ndims = dst_d.ndims();
+
+    float qmin = 0.f, qmax = 0.f;
+    switch (dst_dt) {
+        case s8: qmin = -128.f, qmax = 127.f; break;
+        case u8: qmin = 0.f, qmax = 255.f; break;
+        case s4: qmin = -8.f, qmax = 7.f; break;
+        case u4: qmin = 0.f, qmax = 15.f; break;
+        case f8_e5m2: qmin = -57344.f, qmax = 57344.f; break;
+        case f8_e4m3: qmin = -448.f, qmax = 448.f; break;
+        default: assert(!"unsupported data type"); return status::runtime_error;
+    }
+
+    // Quantized int4 values are first written as bytes and packed in the end.
+    const bool is_int4 = utils::one_of(dst_dt, s4, u4);
+    int8_t *int4_buf = nullptr;
+    if (is_int4) {
+        int4_buf = ctx.get_scratchpad_grantor().template get<int8_t>(
+                memory_tracking::names::key_reorder_space);
+        if (dst_d.nelems(true) != dst_d.nelems())
+            std::memset(int4_buf, 0, dst_d.nelems(true));
+    } else {
+        ctx.zero_pad_output(DNNL_ARG_TO);
+    }
+
+    // Elements of the source covered by a single scale along each dimension.
+    dims_t group_dims;
+    for (int d = 0; d < ndims; d++)
+        group_dims[d] = dst_d.dims()[d] / pd()->quant_dims_[d];
+    const dim_t group_size = utils::array_product(group_dims, ndims);
+    const dim_t n_groups = utils::array_product(pd()->quant_dims_, ndims);
+
+    parallel_nd(n_groups, [&](dim_t q) {
+        dims_t start, idx;
+        utils::l_dims_by_l_offset(start, q, pd()->quant_dims_, ndims);
+        for (int d = 0; d < ndims; d++)
+            start[d] *= group_dims[d];
+        const auto get_idx = [&](dim_t e) {
+            utils::l_dims_by_l_offset(idx, e, group_dims, ndims);
+            for (int d = 0; d < ndims; d++)
+                idx[d] += start[d];
+        };
+
+        // The range always contains zero for it to be exactly representable.
+        float vmin = 0.f, vmax = 0.f;
+        for (dim_t e = 0; e < group_size; e++) {
+            get_idx(e);
+            const float v
+                    = io::load_float_value(src_dt, src, src_d.off_v(idx));
+            vmin = nstl::min(vmin, v);
+            vmax = nstl::max(vmax, v);
+        }
+
+        float scale = with_zp ? (vmax - vmin) / (qmax - qmin)
+                              : nstl::max(vmax, -vmin) / qmax;
+        if (scale == 0.f) scale = 1.f;
+        // Quantize with the scale as stored in memory.
+        io::store_float_value(scales_dt, scale, scales, q);
+        scale = io::load_float_value(scales_dt, scales, q);
+
+        float zp = 0.f;
+        if (with_zp) {
+            zp = nstl::min(
+                    qmax, nstl::max(qmin, qmin - nearbyintf(vmin / scale)));
+            io::store_float_value(zp_dt, zp, zero_points, q);
+        }
+
+        for (dim_t e = 0; e < group_size; e++) {
+            get_idx(e);
+            const float v
+                    = io::load_float_value(src_dt, src, src_d.off_v(idx));
+            const float qv = v / scale + zp;
+            const dim_t dst_off = dst_d.off_v(idx);
+            if (is_int4)
+                int4_buf[dst_off] = static_cast<int8_t>(
+                        nstl::min(qmax, nstl::max(qmin, nearbyintf(qv))));
+            else
+                io::store_float_value(dst_dt, qv, dst, dst_off);
+        }
+    });
+
+    if (is_int4) {
+        const dim_t nelems = dst_d.nelems(true);
+        auto dst_u8 = static_cast<uint8_t *>(dst);
+        parallel_nd(utils::div_up(nelems, 2), [&](dim_t b) {
+            const uint8_t lo = int4_buf[2 * b] & 0xF;
+            const uint8_t hi
+                    = 2 * b + 1 < nelems ? int4_buf[2 * b + 1] & 0xF : 0;
+            dst_u8[b] = static_cast<uint8_t>(lo | (hi << 4));
+        });
+    }
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -86,15 +86,24 @@ struct simple_sparse_reorder_impl_t<SIMPLE_SPARSE_REORDER_TEMPL_CALL,
                 input_d.is_blocking_desc(), VERBOSE_UNSUPPORTED_FORMAT_KIND);
         VDISPATCH_REORDER_IC(
                 output_d.is_sparse_desc(), VERBOSE_UNSUPPORTED_FORMAT_KIND);
-        VDISPATCH_REORDER_IC(
-                output_d.sparse_desc().encoding == sparse_encoding::packed,
+        VDISPATCH_REORDER_IC(output_d.is_sparse_packed_desc(),
                 VERBOSE_UNSUPPORTED_FEATURE,
-                "only sparse_encoding::packed is supported for dst");
+                "only packed sparse encodings are supported for dst");
         VDISPATCH_REORDER_IC(output_d.blocking_desc().inner_nblks > 0,
                 VERBOSE_UNSUPPORTED_TENSOR_LAYOUT, "dst");
         VDISPATCH_REORDER_IC(output_d.blk_size() % 64 == 0,
                 VERBOSE_UNSUPPORTED_TENSOR_LAYOUT, "dst");
 
+        if (output_d.encoding() == sparse_encoding::packed_2_4) {
+            // The groups of 4 must be formed by the innermost block that goes
+            // along the reduction dimension.
+            const auto &bd = output_d.blocking_desc();
+            const int last = bd.inner_nblks - 1;
+            VDISPATCH_REORDER_IC(bd.inner_idxs[last] == output_d.ndims() - 2
+                            && bd.inner_blks[last] % 4 == 0,
+                    VERBOSE_UNSUPPORTED_TENSOR_LAYOUT, "dst");
+        }
+
         return status::success;
     }
 
@@ -109,9 +118,17 @@ struct simple_sparse_reorder_impl_t<SIMPLE_SPARSE_REORDER_TEMPL_CALL,
 
     static status_t execute(const cpu_reorder_pd_t *pd, const exec_ctx_t &ctx,
             const std::shared_ptr<primitive_t> &reorder) {
+        const auto output_d = ctx.memory_mdw(DNNL_ARG_TO, pd->dst_md());
+        const bool is_2_4 = output_d.encoding() == sparse_encoding::packed_2_4;
+
+        // The 2:4 encoding has no offsets buffer.
         auto output_values = CTX_OUT_MEM(data_t<type_o> *, DNNL_ARG_TO, 0);
-        auto output_offsets = CTX_OUT_MEM(int64_t *, DNNL_ARG_TO, 1);
-        auto output_bitmask = CTX_OUT_MEM(uint64_t *, DNNL_ARG_TO, 2);
+        auto output_offsets = is_2_4
+                ? nullptr
+                : CTX_OUT_MEM(int64_t *, DNNL_ARG_TO, 1);
+        auto output_bitmask = is_2_4
+                ? CTX_OUT_MEM(uint64_t *, DNNL_ARG_TO, 1)
+                : CTX_OUT_MEM(uint64_t *, DNNL_ARG_TO, 2);
 
         engine_t *engine = ctx.stream()->engine();
         const auto scratchpad = ctx.get_scratchpad_grantor();
@@ -136,16 +153,54 @@ struct simple_sparse_reorder_impl_t<SIMPLE_SPARSE_REORDER_TEMPL_CALL,
         auto *wspace = scratchpad.template get<data_t<type_o>>(
                 memory_tracking::names::key_reorder_space);
 
-        const auto output_d = ctx.memory_mdw(DNNL_ARG_TO, pd->dst_md());
         const auto nelems = output_d.nelems(true);
         const auto blk_sz = output_d.blk_size();
         const auto nblks = nelems / blk_sz;
 
+        static constexpr int bitmask_step = sizeof(uint64_t) * CHAR_BIT;
+        if (is_2_4) {
+            // Keep the 2 values of the largest magnitude in every group of 4
+            // consecutive values. Exactly half of the values is stored so
+            // every block starts at a fixed offset.
+            static constexpr int group_sz = 4;
+            parallel_nd(nblks, [&](dim_t b) {
+                const auto *blk = wspace + b * blk_sz;
+                auto *blk_values = output_values + b * blk_sz / 2;
+                for (dim_t i = 0; i < blk_sz / bitmask_step; i++) {
+                    uint64_t &bm = output_bitmask[b * blk_sz / bitmask_step + i];
+                    bm = 0;
+                    for (dim_t g = 0; g < bitmask_step; g += group_sz) {
+                        const auto *grp = blk + bitmask_step * i + g;
+                        int first = 0, second = 1;
+                        if (std::abs((float)grp[second])
+                                > std::abs((float)grp[first]))
+                            std::swap(first, second);
+                        for (int j = 2; j < group_sz; j++) {
+                            const float v = std::abs((float)grp[j]);
+                            if (v > std::abs((float)grp[first])) {
+                                second = first;
+                                first = j;
+                            } else if (v > std::abs((float)grp[second])) {
+                                second = j;
+                            }
+                        }
+                        const int lo = nstl::min(first, second);
+                        const int hi = nstl::max(first, second);
+                        const dim_t val_off = (bitmask_step * i + g) / 2;
+                        blk_values[val_off] = grp[lo];
+                        blk_values[val_off + 1] = grp[hi];
+                        bm |= (uint64_t(1) << (g + lo));
+                        bm |= (uint64_t(1) << (g + hi));
+                    }
+                }
+            });
+            return status::success;
+        }
+
         dim_t *nnz_per_blocks
                 = reinterpret_cast<dim_t *>(reinterpret_cast<char *>(wspace)
                         + nelems * output_d.data_type_size());
 
-        static constexpr int bitmask_step = sizeof(uint64_t) * CHAR_BIT;
         // Fill output_bitmask and move non-zero elements to the begining of the
         // blocks. Also, remember number of non-zero elements per-block to
         // calculate output_offsets later.
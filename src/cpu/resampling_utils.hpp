@@ -72,6 +72,73 @@ private:
     static dim_t left(float s) { return nstl::max((dim_t)s, (dim_t)0); }
 };
 
+// Cubic convolution kernel with a = -0.75.
+static inline float cubic_weight(float x) {
+    constexpr float a = -0.75f;
+    x = nstl::abs(x);
+    if (x <= 1.f) return ((a + 2.f) * x - (a + 3.f)) * x * x + 1.f;
+    if (x < 2.f) return ((a * x - 5.f * a) * x + 8.f * a) * x - 4.f * a;
+    return 0.f;
+}
+
+// Number of source points contributing to one destination point along a
+// spatial dimension for the cubic and antialiased linear algorithms. The
+// antialiased filter is a triangle stretched by the downscaling factor. When
+// the sizes are equal both filters are the identity.
+static inline dim_t filter_taps(alg_kind_t alg, dim_t y_max, dim_t x_max) {
+    if (y_max == x_max) return 1;
+    if (alg == alg_kind::resampling_cubic) return 4;
+    const float support = nstl::max(
+            1.f, static_cast<float>(x_max) / static_cast<float>(y_max));
+    return static_cast<dim_t>(std::ceil(2.f * support));
+}
+
+// Fills `filter_taps()` indices and weights of source points used for
+// destination point `y`. Indices are always within [0, x_max), weights of
+// padding taps are zero.
+static inline void filter_coeffs(alg_kind_t alg, dim_t y, dim_t y_max,
+        dim_t x_max, dim_t *idx, float *wei) {
+    const dim_t taps = filter_taps(alg, y_max, x_max);
+    if (taps == 1) {
+        idx[0] = y;
+        wei[0] = 1.f;
+        return;
+    }
+
+    const float s = linear_map(y, y_max, x_max);
+    auto clamp = [&](dim_t x) {
+        return nstl::min(nstl::max(x, (dim_t)0), x_max - 1);
+    };
+
+    if (alg == alg_kind::resampling_cubic) {
+        const float s_floor = std::floor(s);
+        const float t = s - s_floor;
+        for (dim_t k = 0; k < taps; k++) {
+            idx[k] = clamp(static_cast<dim_t>(s_floor) + k - 1);
+            wei[k] = cubic_weight(t - static_cast<float>(k - 1));
+        }
+        return;
+    }
+
+    // Points outside of the source image are dropped and the remaining
+    // weights are normalized.
+    const float support = nstl::max(
+            1.f, static_cast<float>(x_max) / static_cast<float>(y_max));
+    const dim_t start = static_cast<dim_t>(std::floor(s - support)) + 1;
+    float sum = 0.f;
+    for (dim_t k = 0; k < taps; k++) {
+        const dim_t x = start + k;
+        const bool is_inside = x >= 0 && x < x_max;
+        idx[k] = clamp(x);
+        wei[k] = is_inside ? nstl::max(0.f,
+                         1.f - nstl::abs(static_cast<float>(x) - s) / support)
+                           : 0.f;
+        sum += wei[k];
+    }
+    for (dim_t k = 0; k < taps; k++)
+        wei[k] /= sum;
+}
+
 struct bwd_linear_coeffs_t {
     bwd_linear_coeffs_t(dim_t x, dim_t y_max, dim_t x_max) {
         start[0] = x == 0 ? 0 : left_start(x, y_max, x_max);
@@ -29,12 +29,16 @@
 
  */
 
+#include <atomic>
+#include <cstring>
+
 #include "common/dnnl_thread.hpp"
 #include "common/matmul_pd.hpp"
 #include "common/primitive.hpp"
 #include "common/primitive_desc_iterator.hpp"
 #include "common/stream.hpp"
 
+#include "cpu/ref_io_helper.hpp"
 #include "cpu/simple_q10n.hpp"
 
 #include "cpu/gemm/gemm.hpp"
@@ -318,6 +322,11 @@ ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::pd_t::init_brgemm(
             this->attr()->fpmath_.mode_, fpmath_mode::bf16, fpmath_mode::any);
     bool allow_down_conversion_to_bf16
             = is_f32 && is_fpmath_bf16 && is_impl_bf16;
+    bool allow_wei_decompression = is_impl_bf16
+            && src_layer_dt == data_type::bf16
+            && weights_iter_dt == weights_layer_dt
+            && one_of(weights_layer_dt, data_type::s8, data_type::u8,
+                    data_type::s4, data_type::u4);
 
     // Initialized rnn_ early to get correct verbose output
     rnn_ = zero<decltype(rnn_)>();
@@ -343,9 +352,12 @@ ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::pd_t::init_brgemm(
     VDISPATCH_RNN(IMPLICATION(aprop == backward,
                           this->diff_weights_overwrite() == false),
             VERBOSE_BAD_PROPKIND);
+    // brgemm kernels are generated for a fixed batch block
+    VDISPATCH_RNN(!this->with_seq_lengths(), "with_seq_lengths");
     // cell_type (or src_type) and primitive data type should
-    // match, except for the bf32 case.
-    VDISPATCH_RNN(IMPLICATION(!allow_down_conversion_to_bf16,
+    // match, except for the bf32 and weights decompression cases.
+    VDISPATCH_RNN(IMPLICATION(!allow_down_conversion_to_bf16
+                                  && !allow_wei_decompression,
                           src_layer_dt == src_type
                                   && everyone_is(weights_type, weights_iter_dt,
                                           weights_layer_dt)),
@@ -433,13 +445,37 @@ ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::pd_t::init_brgemm(
     /* check that only supported attr have been passed */
     primitive_attr_t::skip_mask_t attr_mask
             = primitive_attr_t::skip_mask_t::rnn_tparams;
-    if (weights_layer_dt == data_type::s8)
+    if (weights_layer_dt == data_type::s8 && !rnn_.is_wei_decompression())
         attr_mask = attr_mask | primitive_attr_t::skip_mask_t::rnn_data_qparams
                 | primitive_attr_t::skip_mask_t::rnn_weights_qparams
                 | primitive_attr_t::skip_mask_t::rnn_weights_projection_qparams
                 | primitive_attr_t::skip_mask_t::fpmath_mode;
+    if (rnn_.is_wei_decompression())
+        attr_mask = attr_mask | primitive_attr_t::skip_mask_t::scales_groups
+                | primitive_attr_t::skip_mask_t::scales_data_type;
     VDISPATCH_RNN(this->attr()->has_default_values(attr_mask),
             VERBOSE_UNSUPPORTED_ATTR);
+    if (rnn_.is_wei_decompression()) {
+        const auto &scales = this->attr()->scales_;
+        VDISPATCH_RNN(scales.has_default_values(
+                              {DNNL_ARG_WEIGHTS_LAYER, DNNL_ARG_WEIGHTS_ITER}),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        for (int arg : {DNNL_ARG_WEIGHTS_LAYER, DNNL_ARG_WEIGHTS_ITER}) {
+            if (scales.has_default_values(arg)) continue;
+            const auto &dims = this->arg_md(arg)->dims;
+            const int mask = scales.get_mask(arg);
+            bool scales_ok = one_of(scales.get_data_type(arg), data_type::f32,
+                    data_type::bf16, data_type::f16);
+            // Groups may be set along any ldigo dimension covered by the
+            // mask.
+            for (int d = 0; d < 5; d++) {
+                const dim_t group = scales.get_group(arg, d);
+                scales_ok = scales_ok && group > 0 && dims[d] % group == 0
+                        && IMPLICATION(group > 1, mask & (1 << d));
+            }
+            VDISPATCH_RNN(scales_ok, VERBOSE_UNSUPPORTED_SCALES_CFG);
+        }
+    }
 
     set_conf<class_name>(rnn_, *this->desc(), this->weights_md(0),
             this->weights_md(1), this->arg_md(DNNL_ARG_WEIGHTS_PROJECTION),
@@ -512,6 +548,10 @@ ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::pd_t::init_brgemm(
     VDISPATCH_RNN(this->check_layout_consistency(true /*is_brgemm*/)
                     == status::success,
             "layout consistency check failed");
+    // Weights are decompressed into the bf16 blocked layout of the cell
+    VDISPATCH_RNN(IMPLICATION(rnn_.is_wei_decompression(),
+                          one_of(rnn_.n_block, 32, 64)),
+            VERBOSE_BLOCKING_FAIL, "unsupported n_block for weights");
 
     if (rnn_.is_bf32()) {
         const memory_desc_wrapper weights_layer_d(this->weights_layer_md_);
@@ -1013,6 +1053,54 @@ rnn_grid_execution_sig((ref_rnn_common_t<aprop, src_type, weights_type,
     const auto src_iter_c_mdw = memory_desc_wrapper(pd()->src_md(2));
     const auto dst_iter_c_mdw = memory_desc_wrapper(pd()->dst_md(2));
 
+    // With variable-length sequences the cells are executed for the rows
+    // whose sequences are not complete yet only. The states of complete
+    // sequences are carried over to the next iteration unchanged, so that
+    // the last iteration holds the final state of every sequence.
+    const int32_t *seq_lengths = rnn.with_seq_lengths
+            ? CTX_IN_MEM(const int32_t *, DNNL_ARG_SEQ_LENGTHS)
+            : nullptr;
+    rnn_conf_t active_rnn = rnn;
+    const bool with_c_state = pd()->cell_kind() == alg_kind::vanilla_lstm;
+    const auto carry_states = [&](cell_position_t cell_position, int mb_begin,
+                                      dst_layer_t *dst_layer,
+                                      dst_iter_t *dst_iter,
+                                      const src_iter_t *src_iter,
+                                      void *dst_iter_c,
+                                      const void *src_iter_c) {
+        const dim_t dst_layer_ld = rnn.dst_layer_ld(cell_position, true);
+        const dim_t dst_iter_ld = rnn.dst_iter_ld(cell_position);
+        const dim_t src_iter_ld = rnn.src_iter_ld(cell_position);
+        const dim_t dst_iter_c_ld = rnn.dst_iter_c_ld(cell_position);
+        const dim_t src_iter_c_ld = rnn.src_iter_c_ld(cell_position);
+        parallel_nd(rnn.mb - mb_begin, [&](dim_t i) {
+            const dim_t b = mb_begin + i;
+            const src_iter_t *ss = src_iter + b * src_iter_ld;
+            PRAGMA_OMP_SIMD()
+            for (int s = 0; s < rnn.dic; s++)
+                dst_layer[b * dst_layer_ld + s] = ss[s];
+            if (dst_iter) {
+                PRAGMA_OMP_SIMD()
+                for (int s = 0; s < rnn.dic; s++)
+                    dst_iter[b * dst_iter_ld + s] = ss[s];
+            }
+            if (!with_c_state) return;
+            for (int s = 0; s < rnn.dhc; s++) {
+                const float c = to_float(inc_ptr(src_iter_c, rnn.src_iter_c_dt,
+                                                 b * src_iter_c_ld + s),
+                        rnn.src_iter_c_dt);
+                void *dd = inc_ptr(
+                        dst_iter_c, rnn.dst_iter_c_dt, b * dst_iter_c_ld + s);
+                if (rnn.dst_iter_c_dt == data_type::f32)
+                    *static_cast<float *>(dd) = c;
+                else if (rnn.dst_iter_c_dt == data_type::bf16)
+                    *static_cast<bfloat16_t *>(dd) = c;
+                else if (rnn.dst_iter_c_dt == data_type::f16)
+                    *static_cast<float16_t *>(dd) = c;
+            }
+        });
+    };
+
 // Since the function FN(...) returns by reference so an extra exception
 // has to be made for nullptr argument
 #define SAFE_PTR(FN, ...) CONCAT2(FN, _) ? &(FN(__VA_ARGS__)) : nullptr
@@ -1046,6 +1134,187 @@ rnn_grid_execution_sig((ref_rnn_common_t<aprop, src_type, weights_type,
                   return dnnl_success;
               };
 
+    const auto compute_cell = [&](int dir, int j, int lay, int iter,
+                                      const rnn_conf_t &cell_rnn,
+                                      scratch_t *scratch_gates,
+                                      scratch_t *scratch_cell) {
+        // We set parameters to the cell execution call
+
+        // dst_layer is equal to dst_iter. To avoid
+        // duplication of memory access we hence use only
+        // dst_layer and set dst_iter to nullptr, unless we
+        // cannot for one of the following condition:
+        // - in the last layer and last iteration, we need to
+        //   copy ht in two tensors (dst_layer and dst_iter)
+        dst_layer_t *cell_dst_layer
+                = &(ws_states_layer(lay + 1, dir, iter + 1, 0));
+        dst_iter_t *cell_dst_iter = nullptr;
+        const src_layer_t *cell_src_layer
+                = &(ws_states_layer(lay, dir, iter + 1, 0));
+        const src_iter_t *cell_src_iter
+                = &(ws_states_iter(lay + 1, dir, iter, 0));
+
+        void *cell_dst_iter_c = const_cast<void *>(
+                ws_states_iter_c(lay + 1, dir, iter + 1, 0));
+        const void *cell_src_iter_c = ws_states_iter_c(lay + 1, dir, iter, 0);
+
+        // the cell_position is used only when skip_data_copy is
+        // supported currently supported only for forward
+        cell_position_t cell_position = middle_cell;
+        if (iter == 0) cell_position |= first_iter;
+        if (lay == 0) cell_position |= first_layer;
+        if (iter == rnn.n_iter - 1) cell_position |= last_iter;
+        if (lay == rnn.n_layer - 1) cell_position |= last_layer;
+
+        // The dst_* paths should be before the src_* paths as
+        // the later will override cell_src_layer and
+        // cell_src_iter appropriately for 1st layer and 1st
+        // iter.
+        const bool last_iter_skip_copy
+                = rnn.skip_dst_iter_copy() && (cell_position & last_iter);
+        if (last_iter_skip_copy) {
+            cell_dst_layer = dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0);
+            cell_src_layer = dst_iter_ + dst_iter_mdw.off(lay - 1, dir, 0, 0);
+        }
+
+        if (rnn.skip_dst_layer_copy() && (cell_position & last_layer)) {
+            // Note: for last layer and last iter, the output is in dst_layer
+            // and still need to be copied to dst_iter
+            cell_dst_layer = dst_layer_ + dst_layer_mdw.off(iter, 0, 0);
+            cell_dst_iter = last_iter_skip_copy
+                    ? dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0)
+                    : nullptr;
+            cell_src_iter = (iter != 0)
+                    ? dst_layer_ + dst_layer_mdw.off(iter - 1, 0, 0)
+                    : cell_src_iter;
+        }
+        if (rnn.skip_src_iter_copy() && (cell_position & first_iter))
+            cell_src_iter = src_iter_ + src_iter_mdw.off(lay, dir, 0, 0);
+
+        if (rnn.skip_src_layer_copy() && (cell_position & first_layer))
+            cell_src_layer = src_layer_ + src_layer_mdw.off(iter, 0, 0);
+
+        // because the c state is always f32 and require no
+        // conversion, we can always skip to copy for the 1st
+        // and last iteration
+        if (iter == 0 && src_iter_c_) {
+            cell_src_iter_c = inc_ptr(src_iter_c_, rnn.src_iter_c_dt,
+                    src_iter_c_mdw.off(lay, dir, 0, 0));
+            cell_position |= c_state_first_iter;
+        }
+        if (iter == rnn.n_iter - 1 && dst_iter_c_) {
+            cell_dst_iter_c = inc_ptr(dst_iter_c_, rnn.dst_iter_c_dt,
+                    dst_iter_c_mdw.off(lay, dir, 0, 0));
+            cell_position |= c_state_last_iter;
+        }
+        const size_t sg_start_idx = rnn.n_iter_scratch_gates == 1
+                ? static_cast<size_t>(0)
+                : static_cast<size_t>(iter) * rnn.scratch_gates_nld
+                        * rnn.scratch_gates_ld;
+        const auto cell_scratch_gates = &scratch_gates[sg_start_idx];
+
+        dst_iter_t *proj_ht = nullptr;
+        if (rnn.is_lstm_projection) {
+            if (rnn.is_training)
+                proj_ht = &(ws_ht(lay, dir, iter, 0));
+            else
+                proj_ht = scratch_ht_;
+        }
+
+#if DNNL_X64
+        CHECK((this->*cell_func)(ctx, cell_rnn, cell_position, cell_dst_layer,
+                cell_dst_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
+                SAFE_PTR(diff_augru_attention, iter, 0, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
+                SAFE_PTR(weights_layer, lay, dir, 0),
+                SAFE_PTR(weights_iter, lay, dir, 0),
+                SAFE_PTR(weights_projection, lay, dir),
+                SAFE_PTR(weights_peephole, lay, dir, 0),
+                w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
+                            : nullptr,
+                bias(lay, dir), cell_src_layer,
+                SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
+                cell_src_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
+                SAFE_PTR(diff_weights_layer, lay, dir, 0),
+                SAFE_PTR(diff_weights_iter, lay, dir, 0),
+                SAFE_PTR(diff_weights_projection, lay, dir, 0),
+                SAFE_PTR(diff_weights_peephole, lay, dir, 0),
+                SAFE_PTR(diff_bias, lay, dir, 0),
+                SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
+                proj_ht, scratch_diff_ht_,
+                SAFE_PTR(ws_grid, lay, dir, iter, 0), scratch_cell,
+                scratch_gates_blocked_, scratch_src_layer_,
+                scratch_src_iter_, cell_dst_iter, amx_scratchpad,
+                addr_batch_global));
+#else
+        CHECK((this->*cell_func)(ctx, cell_rnn, cell_position, cell_dst_layer,
+                cell_dst_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
+                SAFE_PTR(diff_augru_attention, iter, 0, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
+                SAFE_PTR(weights_layer, lay, dir, 0),
+                SAFE_PTR(weights_iter, lay, dir, 0),
+                SAFE_PTR(weights_projection, lay, dir),
+                SAFE_PTR(weights_peephole, lay, dir, 0),
+                w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
+                            : nullptr,
+                bias(lay, dir), cell_src_layer,
+                SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
+                cell_src_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
+                SAFE_PTR(diff_weights_layer, lay, dir, 0),
+                SAFE_PTR(diff_weights_iter, lay, dir, 0),
+                SAFE_PTR(diff_weights_projection, lay, dir, 0),
+                SAFE_PTR(diff_weights_peephole, lay, dir, 0),
+                SAFE_PTR(diff_bias, lay, dir, 0),
+                SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
+                proj_ht, scratch_diff_ht_,
+                SAFE_PTR(ws_grid, lay, dir, iter, 0), scratch_cell,
+                cell_dst_iter, amx_scratchpad));
+#endif
+        if (cell_rnn.mb < rnn.mb)
+            carry_states(cell_position, cell_rnn.mb, cell_dst_layer,
+                    cell_dst_iter, cell_src_iter, cell_dst_iter_c,
+                    cell_src_iter_c);
+        return dnnl_success;
+    };
+
+    if (rnn.use_wavefront) {
+        // Wave w holds the cells with lay + iter == w of all directions. The
+        // inputs of a cell are produced by the previous wave only, so cells of
+        // a wave run concurrently, each on its own slot of scratch buffers.
+        const size_t scratch_cell_slot
+                = static_cast<size_t>(rnn.scratch_gates_nld)
+                * rnn.scratch_gates_ld;
+        for (int w = 0; w < rnn.n_layer + rnn.n_iter - 1; w++) {
+            const int lay_start = nstl::max(0, w - rnn.n_iter + 1);
+            const int lay_end = nstl::min(rnn.n_layer, w + 1);
+            const int n_cells = rnn.n_dir * (lay_end - lay_start);
+            std::atomic<status_t> st(status::success);
+            parallel_nd(n_cells, [&](dim_t k) {
+                const int dir = static_cast<int>(k % rnn.n_dir);
+                const int lay = lay_start + static_cast<int>(k / rnn.n_dir);
+                scratch_t *cell_scratch_cell = scratch_cell_
+                        ? scratch_cell_ + k * scratch_cell_slot
+                        : nullptr;
+                const status_t st_cell = compute_cell(dir, lay, lay, w - lay,
+                        rnn, scratch_gates_ + k * scratch_cell_slot,
+                        cell_scratch_cell);
+                if (st_cell != status::success) st = st_cell;
+            });
+            CHECK(st);
+        }
+        return dnnl_success;
+    }
+
     // We run the grid of computation
     for_(int dir = 0; dir < rnn.n_dir; dir++)
     for (int j = 0; j < rnn.n_layer; j++) {
@@ -1056,154 +1325,21 @@ rnn_grid_execution_sig((ref_rnn_common_t<aprop, src_type, weights_type,
 
         // TODO: enable merging projection gemm in bwd lstm projection
 
+        int active_mb = rnn.mb;
         for (int i = 0; i < rnn.n_iter; i++) {
             const int iter
                     = (aprop == prop_kind::forward) ? i : rnn.n_iter - i - 1;
 
-            // We set parameters to the cell execution call
-
-            // dst_layer is equal to dst_iter. To avoid
-            // duplication of memory access we hence use only
-            // dst_layer and set dst_iter to nullptr, unless we
-            // cannot for one of the following condition:
-            // - in the last layer and last iteration, we need to
-            //   copy ht in two tensors (dst_layer and dst_iter)
-            dst_layer_t *cell_dst_layer
-                    = &(ws_states_layer(lay + 1, dir, iter + 1, 0));
-            dst_iter_t *cell_dst_iter = nullptr;
-            const src_layer_t *cell_src_layer
-                    = &(ws_states_layer(lay, dir, iter + 1, 0));
-            const src_iter_t *cell_src_iter
-                    = &(ws_states_iter(lay + 1, dir, iter, 0));
-
-            void *cell_dst_iter_c = const_cast<void *>(
-                    ws_states_iter_c(lay + 1, dir, iter + 1, 0));
-            const void *cell_src_iter_c
-                    = ws_states_iter_c(lay + 1, dir, iter, 0);
-
-            // the cell_position is used only when skip_data_copy is
-            // supported currently supported only for forward
-            cell_position_t cell_position = middle_cell;
-            if (iter == 0) cell_position |= first_iter;
-            if (lay == 0) cell_position |= first_layer;
-            if (iter == rnn.n_iter - 1) cell_position |= last_iter;
-            if (lay == rnn.n_layer - 1) cell_position |= last_layer;
-
-            // The dst_* paths should be before the src_* paths as
-            // the later will override cell_src_layer and
-            // cell_src_iter appropriately for 1st layer and 1st
-            // iter.
-            const bool last_iter_skip_copy
-                    = rnn.skip_dst_iter_copy() && (cell_position & last_iter);
-            if (last_iter_skip_copy) {
-                cell_dst_layer = dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0);
-                cell_src_layer
-                        = dst_iter_ + dst_iter_mdw.off(lay - 1, dir, 0, 0);
-            }
-
-            if (rnn.skip_dst_layer_copy() && (cell_position & last_layer)) {
-                // Note: for last layer and last iter, the output is in dst_layer
-                // and still need to be copied to dst_iter
-                cell_dst_layer = dst_layer_ + dst_layer_mdw.off(iter, 0, 0);
-                cell_dst_iter = last_iter_skip_copy
-                        ? dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0)
-                        : nullptr;
-                cell_src_iter = (iter != 0)
-                        ? dst_layer_ + dst_layer_mdw.off(iter - 1, 0, 0)
-                        : cell_src_iter;
-            }
-            if (rnn.skip_src_iter_copy() && (cell_position & first_iter))
-                cell_src_iter = src_iter_ + src_iter_mdw.off(lay, dir, 0, 0);
-
-            if (rnn.skip_src_layer_copy() && (cell_position & first_layer))
-                cell_src_layer = src_layer_ + src_layer_mdw.off(iter, 0, 0);
-
-            // because the c state is always f32 and require no
-            // conversion, we can always skip to copy for the 1st
-            // and last iteration
-            if (iter == 0 && src_iter_c_) {
-                cell_src_iter_c = inc_ptr(src_iter_c_, rnn.src_iter_c_dt,
-                        src_iter_c_mdw.off(lay, dir, 0, 0));
-                cell_position |= c_state_first_iter;
-            }
-            if (iter == rnn.n_iter - 1 && dst_iter_c_) {
-                cell_dst_iter_c = inc_ptr(dst_iter_c_, rnn.dst_iter_c_dt,
-                        dst_iter_c_mdw.off(lay, dir, 0, 0));
-                cell_position |= c_state_last_iter;
-            }
-            const size_t sg_start_idx = rnn.n_iter_scratch_gates == 1
-                    ? static_cast<size_t>(0)
-                    : static_cast<size_t>(iter) * rnn.scratch_gates_nld
-                            * rnn.scratch_gates_ld;
-            const auto cell_scratch_gates = &scratch_gates_[sg_start_idx];
-
-            dst_iter_t *proj_ht = nullptr;
-            if (rnn.is_lstm_projection) {
-                if (rnn.is_training)
-                    proj_ht = &(ws_ht(lay, dir, iter, 0));
-                else
-                    proj_ht = scratch_ht_;
+            // Variable-length sequences are supported in forward only
+            if (seq_lengths) {
+                while (seq_lengths[active_mb - 1] <= iter)
+                    active_mb--;
+                active_rnn.mb = active_mb;
             }
+            const rnn_conf_t &cell_rnn = seq_lengths ? active_rnn : rnn;
 
-#if DNNL_X64
-            CHECK((this->*cell_func)(ctx, rnn, cell_position, cell_dst_layer,
-                    cell_dst_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
-                    SAFE_PTR(diff_augru_attention, iter, 0, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
-                    SAFE_PTR(weights_layer, lay, dir, 0),
-                    SAFE_PTR(weights_iter, lay, dir, 0),
-                    SAFE_PTR(weights_projection, lay, dir),
-                    SAFE_PTR(weights_peephole, lay, dir, 0),
-                    w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
-                                : nullptr,
-                    bias(lay, dir), cell_src_layer,
-                    SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
-                    cell_src_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
-                    SAFE_PTR(diff_weights_layer, lay, dir, 0),
-                    SAFE_PTR(diff_weights_iter, lay, dir, 0),
-                    SAFE_PTR(diff_weights_projection, lay, dir, 0),
-                    SAFE_PTR(diff_weights_peephole, lay, dir, 0),
-                    SAFE_PTR(diff_bias, lay, dir, 0),
-                    SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
-                    proj_ht, scratch_diff_ht_,
-                    SAFE_PTR(ws_grid, lay, dir, iter, 0), scratch_cell_,
-                    scratch_gates_blocked_, scratch_src_layer_,
-                    scratch_src_iter_, cell_dst_iter, amx_scratchpad,
-                    addr_batch_global));
-#else
-            CHECK((this->*cell_func)(ctx, rnn, cell_position, cell_dst_layer,
-                    cell_dst_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
-                    SAFE_PTR(diff_augru_attention, iter, 0, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
-                    SAFE_PTR(weights_layer, lay, dir, 0),
-                    SAFE_PTR(weights_iter, lay, dir, 0),
-                    SAFE_PTR(weights_projection, lay, dir),
-                    SAFE_PTR(weights_peephole, lay, dir, 0),
-                    w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
-                                : nullptr,
-                    bias(lay, dir), cell_src_layer,
-                    SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
-                    cell_src_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
-                    SAFE_PTR(diff_weights_layer, lay, dir, 0),
-                    SAFE_PTR(diff_weights_iter, lay, dir, 0),
-                    SAFE_PTR(diff_weights_projection, lay, dir, 0),
-                    SAFE_PTR(diff_weights_peephole, lay, dir, 0),
-                    SAFE_PTR(diff_bias, lay, dir, 0),
-                    SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
-                    proj_ht, scratch_diff_ht_,
-                    SAFE_PTR(ws_grid, lay, dir, iter, 0), scratch_cell_,
-                    cell_dst_iter, amx_scratchpad));
-#endif
+            CHECK(compute_cell(dir, j, lay, iter, cell_rnn, scratch_gates_,
+                    scratch_cell_));
         }
 
         CHECK(compute_merged_layer_part_if_applicable(
@@ -1984,6 +2120,69 @@ rnn_weights_assign_sig((ref_rnn_common_t<aprop, src_type, weights_type,
         }
 }
 
+// Converts weight-only quantized weights in ldigo layout into the bf16
+// ldgOI{n_block}o2i layout used by the brgemm cells, applying the weights
+// scales. Padded elements are filled with zeros.
+static void decompress_weights_bf16(const rnn_conf_t &rnn,
+        const primitive_attr_t &attr, int arg, const memory_desc_t &md,
+        const void *wei, const void *scales, bfloat16_t *dst) {
+    const memory_desc_wrapper wei_d(md);
+    const auto &dims = wei_d.dims();
+    const auto &strides = wei_d.blocking_desc().strides;
+    const dim_t L = dims[0], D = dims[1], I = dims[2], G = dims[3],
+                O = dims[4];
+    const dim_t o_block = rnn.n_block, i_block = 2;
+    const dim_t nb_o = utils::div_up(O, o_block);
+    const dim_t nb_i = utils::div_up(I, i_block);
+
+    const bool with_scales = !attr.scales_.has_default_values(arg);
+    const int mask = with_scales ? attr.scales_.get_mask(arg) : 0;
+    const data_type_t scales_dt = with_scales
+            ? attr.scales_.get_data_type(arg)
+            : data_type::f32;
+    // Scales are dense over the dimensions of the mask, each dimension
+    // being divided by its group size.
+    dims_t sc_dims, sc_groups;
+    for (int d = 0; d < 5; d++) {
+        sc_groups[d] = attr.scales_.get_group(arg, d);
+        sc_dims[d] = (mask & (1 << d)) ? dims[d] / sc_groups[d] : 1;
+    }
+    const auto sc_idx = [&](int d, dim_t v) {
+        return (mask & (1 << d)) ? v / sc_groups[d] : 0;
+    };
+
+    parallel_nd(L, D, G, nb_o, nb_i,
+            [&](dim_t l, dim_t d, dim_t g, dim_t ob, dim_t ib) {
+                bfloat16_t *blk = dst
+                        + ((((l * D + d) * G + g) * nb_o + ob) * nb_i + ib)
+                                * o_block * i_block;
+                for (dim_t oo = 0; oo < o_block; oo++)
+                    for (dim_t ii = 0; ii < i_block; ii++) {
+                        const dim_t o = ob * o_block + oo;
+                        const dim_t i = ib * i_block + ii;
+                        float val = 0.f;
+                        if (o < O && i < I) {
+                            const dim_t off = wei_d.offset0()
+                                    + l * strides[0] + d * strides[1]
+                                    + i * strides[2] + g * strides[3]
+                                    + o * strides[4];
+                            val = io::load_float_value(
+                                    wei_d.data_type(), wei, off);
+                            if (with_scales) {
+                                const dim_t pos[5] = {l, d, i, g, o};
+                                dim_t sc_off = 0;
+                                for (int k = 0; k < 5; k++)
+                                    sc_off = sc_off * sc_dims[k]
+                                            + sc_idx(k, pos[k]);
+                                val *= io::load_float_value(
+                                        scales_dt, scales, sc_off);
+                            }
+                        }
+                        blk[oo * i_block + ii] = val;
+                    }
+            });
+}
+
 //********************* Execution function *********************//
 template <prop_kind_t aprop, data_type_t src_type, data_type_t weights_type,
         data_type_t acc_type>
@@ -2004,6 +2203,24 @@ status_t ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute(
             = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS_PROJECTION);
     auto bias = CTX_IN_MEM(const void *, DNNL_ARG_BIAS);
 
+    // Sequences must be sorted by non-increasing length, so the active rows
+    // of an iteration always form the leading part of the batch.
+    const int32_t *seq_lengths = rnn.with_seq_lengths
+            ? CTX_IN_MEM(const int32_t *, DNNL_ARG_SEQ_LENGTHS)
+            : nullptr;
+    if (rnn.with_seq_lengths) {
+        VCONDCHECK(primitive, exec, check, rnn, seq_lengths != nullptr,
+                status::invalid_arguments, VERBOSE_NULL_ARG);
+        for (int b = 0; b < rnn.mb; b++) {
+            const bool len_ok = seq_lengths[b] >= 1
+                    && seq_lengths[b] <= rnn.n_iter
+                    && IMPLICATION(b > 0, seq_lengths[b] <= seq_lengths[b - 1]);
+            VCONDCHECK(primitive, exec, check, rnn, len_ok,
+                    status::invalid_arguments, VERBOSE_BAD_PARAM,
+                    "seq_lengths");
+        }
+    }
+
     auto dst_layer = rnn.is_fwd
             ? CTX_OUT_MEM(char *, DNNL_ARG_DST_LAYER)
             : const_cast<char *>(CTX_IN_MEM(const char *, DNNL_ARG_DST_LAYER));
@@ -2183,6 +2400,31 @@ status_t ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute(
             weights_iter_md = &wei_iter_desc;
         }
     }
+
+    if (rnn.is_wei_decompression()) {
+        const auto &attr = *pd()->attr();
+        auto wei_layer_decomp
+                = scratchpad.template get<weights_t>(key_rnn_wei_layer_decomp);
+        decompress_weights_bf16(rnn, attr, DNNL_ARG_WEIGHTS_LAYER,
+                *weights_layer_md,
+                CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS_LAYER),
+                CTX_IN_MEM(const void *,
+                        DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS_LAYER),
+                reinterpret_cast<bfloat16_t *>(wei_layer_decomp));
+        w_layer = wei_layer_decomp;
+        weights_layer_md = &wei_layer_desc;
+
+        auto wei_iter_decomp
+                = scratchpad.template get<weights_t>(key_rnn_wei_iter_decomp);
+        decompress_weights_bf16(rnn, attr, DNNL_ARG_WEIGHTS_ITER,
+                *weights_iter_md,
+                CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS_ITER),
+                CTX_IN_MEM(const void *,
+                        DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS_ITER),
+                reinterpret_cast<bfloat16_t *>(wei_iter_decomp));
+        w_iter = wei_iter_decomp;
+        weights_iter_md = &wei_iter_desc;
+    }
 #endif
 
     (this->*weights_iter_assign_func)(rnn, weights_iter_md,
@@ -2274,6 +2516,18 @@ status_t ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute(
                     ws_diff_states_iter_c);
     }
 
+    // dst_layer rows past the end of a sequence are filled with zeros. This
+    // is done last as dst_iter may be taken from the last dst_layer rows.
+    if (rnn.with_seq_lengths) {
+        const memory_desc_wrapper dst_layer_d(pd()->dst_md(0));
+        const size_t dt_size = dst_layer_d.data_type_size();
+        parallel_nd(rnn.n_iter, rnn.mb, [&](dim_t it, dim_t b) {
+            if (it < seq_lengths[b]) return;
+            char *dd = dst_layer + dst_layer_d.blk_off(it, b, 0) * dt_size;
+            std::memset(dd, 0, rnn.dlc * dt_size);
+        });
+    }
+
     return status::success;
 };
 /* Fix for MSVS warning C4661 */
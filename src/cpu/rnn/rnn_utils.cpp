@@ -290,7 +290,11 @@ status_t rnn_utils::set_expected_desc(rnn_conf_t &rnn,
                     tag = utils::map(n_block, format_tag::undef, 32,
                             format_tag::ldOi32o, 16, format_tag::ldOi16o);
             } else if (rnn.is_fwd) {
-                if (rnn.is_int8_conf())
+                // Compressed weights are kept plain and are decompressed to
+                // the blocked bf16 layout at execution
+                if (rnn.is_wei_decompression())
+                    tag = format_tag::ldigo;
+                else if (rnn.is_int8_conf())
                     tag = utils::map(n_block, format_tag::undef, 64,
                             format_tag::ldgOI64o4i, 32, ldgOI32o4i, 16,
                             ldgOI16o4i);
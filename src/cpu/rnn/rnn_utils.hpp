@@ -21,6 +21,7 @@
 #include <type_traits>
 
 #include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
 #include "common/memory_desc_wrapper.hpp"
 #include "common/primitive.hpp"
 #include "common/utils.hpp"
@@ -312,6 +313,9 @@ struct rnn_conf_t {
     data_type_t bias_dt = data_type::undef;
     data_type_t src_iter_c_dt = data_type::undef;
     data_type_t dst_iter_c_dt = data_type::undef;
+    // Data type of weight-only quantized weights decompressed to bf16 before
+    // the cell execution, `undef` when weights are not compressed.
+    data_type_t wei_decomp_dt = data_type::undef;
 
     int n_layer = 0, n_iter = 0, n_dir = 0, n_gates = 0, n_states = 0;
     int mb = 0;
@@ -410,6 +414,14 @@ struct rnn_conf_t {
 
     bool diff_weights_overwrite = false;
     bool use_matmul = false;
+    // Rows of the batch are sorted by decreasing sequence length, and the
+    // cells are executed for the leading rows that are still active only.
+    bool with_seq_lengths = false;
+    // Cells with the same layer + iteration index of both directions are
+    // independent and computed concurrently, each with its own scratch_gates
+    // and scratch_cell buffers. n_wave_cells is the widest wave size.
+    bool use_wavefront = false;
+    int n_wave_cells = 1;
 
     inline bool is_int8_conf() const {
         return is_signed_int8_conf() || is_unsigned_int8_conf();
@@ -478,6 +490,10 @@ struct rnn_conf_t {
 
     inline bool is_bf32() const { return is_cell_bf16_amx() && is_f32_conf(); }
 
+    inline bool is_wei_decompression() const {
+        return wei_decomp_dt != data_type::undef;
+    }
+
     inline bool skip_src_layer_copy() const {
         return (exec_dir == l2r) && !is_bf32()
                 && utils::one_of(dt_conf, s8s8s8f32, f32s8f32f32, s8s8s8s8,
@@ -717,19 +733,26 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
         default: break;
     }
 
+    const data_type_t wei_dt = weights_layer_d.data_type();
+    const bool is_wei_decomp
+            = rd.prop_kind == prop_kind::forward_inference
+            && utils::one_of(wei_dt, data_type::s8, data_type::u8,
+                    data_type::s4, data_type::u4);
     if (utils::everyone_is(data_type::f32, src_layer_d.data_type(),
-                dst_layer_d.data_type(), weights_layer_d.data_type()))
+                dst_layer_d.data_type(), wei_dt))
         rnn.dt_conf = all_f32;
     else if (utils::everyone_is(data_type::bf16, src_layer_d.data_type(),
-                     dst_layer_d.data_type(), weights_layer_d.data_type())) {
+                     dst_layer_d.data_type())
+            && (wei_dt == data_type::bf16 || is_wei_decomp)) {
         if (!platform::has_data_type_support(data_type::bf16)) return false;
 #if DNNL_X64
         if (!(x64::mayiuse(x64::avx512_core) || x64::mayiuse(x64::avx2_vnni_2)))
             return false;
 #endif
         rnn.dt_conf = all_bf16;
+        if (is_wei_decomp) rnn.wei_decomp_dt = wei_dt;
     } else if (utils::everyone_is(data_type::f16, src_layer_d.data_type(),
-                       dst_layer_d.data_type(), weights_layer_d.data_type())) {
+                       dst_layer_d.data_type(), wei_dt)) {
         if (!platform::has_data_type_support(data_type::f16)) return false;
 #if DNNL_X64
         if (!(x64::mayiuse(x64::avx512_core_fp16)
@@ -784,8 +807,10 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
 
     // set members with user memories leading dimensions
     // Assumption: weights datatype size is the same as state datatype size
-    assert(types::data_type_size(weights_layer_d.data_type())
-            == types::data_type_size(src_layer_d.data_type()));
+    // unless the weights are decompressed before the cell execution
+    assert(IMPLICATION(!rnn.is_wei_decompression(),
+            types::data_type_size(weights_layer_d.data_type())
+                    == types::data_type_size(src_layer_d.data_type())));
 
     // set workspace leading dimensions (and non leading-dimensions)
 
@@ -880,7 +905,12 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
     rnn.parts_bias[0] = rnn.n_bias;
     rnn.parts_bias[1] = 0;
 
+    rnn.with_seq_lengths = rd.flags & rnn_flags::seq_lengths;
+
+    // Matmul primitives are created for a fixed batch, so they are not used
+    // when the active batch shrinks over iterations.
     rnn.use_matmul = !rnn.is_brgemm && rnn.is_fwd // TODO: Enable BWD
+            && !rnn.with_seq_lengths
     // TODO: Below checks are for legacy and a performance study is
     // required to avoid regressions.
 #if DNNL_X64
@@ -971,6 +1001,22 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
     rnn.use_projection_packed_gemm = false;
 #endif
 
+    /* Decide if cells are computed in waves across layers and directions.
+     * Small batch gemms do not scale over all cores, while the cell
+     * (lay, iter) only depends on the cells (lay - 1, iter) and
+     * (lay, iter - 1). The merged layer gemm needs the whole previous layer,
+     * so it is not used. Packed gemm is not used as its threading is decided
+     * at packing. */
+    const int wave_width = rnn.n_dir * nstl::min(rnn.n_layer, rnn.n_iter);
+    rnn.use_wavefront = !rnn.is_brgemm && rnn.is_fwd && !rnn.use_matmul
+            && !rnn.is_lstm_projection && !rnn.with_seq_lengths
+            && !rnn.use_layer_packed_gemm && !rnn.use_iter_packed_gemm
+            && rnn.mb < 32 && wave_width > 1 && dnnl_get_max_threads() > 1;
+    if (rnn.use_wavefront) {
+        rnn.merge_gemm_layer = false;
+        rnn.n_wave_cells = wave_width;
+    }
+
     /* Set packed gemm sizes */
     /* TODO: investigate the benefit of mixing packed and non-packed weights parts */
     const auto set_pack_sizes
@@ -1167,8 +1213,8 @@ void set_workspace_sizes(rnn_conf_t &rnn, const rnn_desc_t &rd) {
     rnn.n_iter_scratch_gates
             = (rnn.merge_gemm_layer || rnn.merge_gemm_iter) ? rnn.n_iter : 1;
     rnn.scratch_gates_size = sizeof(typename T::scratch_t)
-            * rnn.n_iter_scratch_gates * rnn.scratch_gates_nld
-            * rnn.scratch_gates_ld;
+            * rnn.n_iter_scratch_gates * rnn.n_wave_cells
+            * rnn.scratch_gates_nld * rnn.scratch_gates_ld;
     rnn.scratch_ht_size
             = sizeof(typename T::ht_t) * rnn.scratch_ht_nld * rnn.scratch_ht_ld;
     rnn.scratch_diff_ht_size = rnn.is_training ? sizeof(typename T::gemm_acc_t)
@@ -1180,8 +1226,8 @@ void set_workspace_sizes(rnn_conf_t &rnn, const rnn_desc_t &rd) {
     rnn.scratch_cell_size = (utils::one_of(rd.cell_kind, alg_kind::vanilla_gru,
                                      alg_kind::vanilla_augru, alg_kind::lbr_gru,
                                      alg_kind::lbr_augru)
-                    ? sizeof(typename T::scratch_t) * rnn.scratch_gates_nld
-                            * rnn.scratch_gates_ld
+                    ? sizeof(typename T::scratch_t) * rnn.n_wave_cells
+                            * rnn.scratch_gates_nld * rnn.scratch_gates_ld
                     : 0);
     /// workspace needed for lbr GRU
     rnn.ws_per_cell = (size_t)rnn.is_lbr * rnn.mb * rnn.dhc
@@ -0,0 +1,140 @@
+/******************************************************************************
+* Copyright 2025 KNS Group LLC (YADRO)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <riscv_vector.h>
+
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/rv64/gemm/rvv_gemm_f32.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace rv64 {
+
+namespace {
+
+// Blocking of C: every task computes an m_blk x n_blk block, columns are
+// processed by groups of max_nr with one accumulator per column.
+constexpr dim_t m_blk = 256;
+constexpr dim_t n_blk = 64;
+constexpr int max_nr = 4;
+
+inline void store_col(vfloat32m4_t acc, float *c, const float *bias,
+        float alpha, float beta, size_t vl) {
+    acc = __riscv_vfmul_vf_f32m4(acc, alpha, vl);
+    // C is not read when beta is zero as it may be uninitialized.
+    if (beta != 0.f)
+        acc = __riscv_vfmacc_vf_f32m4(
+                acc, beta, __riscv_vle32_v_f32m4(c, vl), vl);
+    if (bias)
+        acc = __riscv_vfadd_vv_f32m4(acc, __riscv_vle32_v_f32m4(bias, vl), vl);
+    __riscv_vse32_v_f32m4(c, acc, vl);
+}
+
+// Computes nr columns of C for m_len rows. Rows are vectorized, so A is
+// loaded contiguously when it is not transposed and with a stride otherwise.
+template <int nr>
+void kernel(dim_t m_len, dim_t K, float alpha, const float *A, dim_t lda,
+        bool trA, const float *B, dim_t ldb, bool trB, float beta, float *C,
+        dim_t ldc, const float *bias) {
+    const dim_t b_col_stride = trB ? 1 : ldb;
+    const dim_t b_k_stride = trB ? ldb : 1;
+    for (dim_t m = 0; m < m_len;) {
+        const size_t vl = __riscv_vsetvl_e32m4(m_len - m);
+        vfloat32m4_t c0 = __riscv_vfmv_v_f_f32m4(0.f, vl);
+        vfloat32m4_t c1 = c0, c2 = c0, c3 = c0;
+        for (dim_t k = 0; k < K; ++k) {
+            const vfloat32m4_t a = trA
+                    ? __riscv_vlse32_v_f32m4(
+                            A + m * lda + k, lda * sizeof(float), vl)
+                    : __riscv_vle32_v_f32m4(A + k * lda + m, vl);
+            const float *b = B + k * b_k_stride;
+            c0 = __riscv_vfmacc_vf_f32m4(c0, b[0], a, vl);
+            if (nr > 1)
+                c1 = __riscv_vfmacc_vf_f32m4(c1, b[b_col_stride], a, vl);
+            if (nr > 2)
+                c2 = __riscv_vfmacc_vf_f32m4(c2, b[2 * b_col_stride], a, vl);
+            if (nr > 3)
+                c3 = __riscv_vfmacc_vf_f32m4(c3, b[3 * b_col_stride], a, vl);
+        }
+        const float *bias_m = bias ? bias + m : nullptr;
+        store_col(c0, C + m, bias_m, alpha, beta, vl);
+        if (nr > 1) store_col(c1, C + ldc + m, bias_m, alpha, beta, vl);
+        if (nr > 2) store_col(c2, C + 2 * ldc + m, bias_m, alpha, beta, vl);
+        if (nr > 3) store_col(c3, C + 3 * ldc + m, bias_m, alpha, beta, vl);
+        m += vl;
+    }
+}
+
+} // namespace
+
+dnnl_status_t rvv_gemm_f32(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const float *A, const dim_t *lda, const float *B, const dim_t *ldb,
+        const float *beta, float *C, const dim_t *ldc, const float *bias) {
+    if (!utils::one_of(*transa, 'n', 'N', 't', 'T')
+            || !utils::one_of(*transb, 'n', 'N', 't', 'T'))
+        return dnnl_unimplemented;
+
+    const bool trA = utils::one_of(*transa, 't', 'T');
+    const bool trB = utils::one_of(*transb, 't', 'T');
+    const dim_t m = *M, n = *N, k = *K;
+    if (m == 0 || n == 0) return dnnl_success;
+
+    const dim_t nb_m = utils::div_up(m, m_blk);
+    const dim_t nb_n = utils::div_up(n, n_blk);
+
+    parallel_nd(nb_n, nb_m, [&](dim_t ibn, dim_t ibm) {
+        const dim_t m0 = ibm * m_blk;
+        const dim_t m_len = std::min(m_blk, m - m0);
+        const dim_t n_end = std::min((ibn + 1) * n_blk, n);
+
+        const float *a = A + (trA ? m0 * *lda : m0);
+        const float *bias_m = bias ? bias + m0 : nullptr;
+        for (dim_t j = ibn * n_blk; j < n_end; j += max_nr) {
+            const float *b = B + (trB ? j : j * *ldb);
+            float *c = C + j * *ldc + m0;
+            switch (std::min<dim_t>(max_nr, n_end - j)) {
+                case 4:
+                    kernel<4>(m_len, k, *alpha, a, *lda, trA, b, *ldb, trB,
+                            *beta, c, *ldc, bias_m);
+                    break;
+                case 3:
+                    kernel<3>(m_len, k, *alpha, a, *lda, trA, b, *ldb, trB,
+                            *beta, c, *ldc, bias_m);
+                    break;
+                case 2:
+                    kernel<2>(m_len, k, *alpha, a, *lda, trA, b, *ldb, trB,
+                            *beta, c, *ldc, bias_m);
+                    break;
+                default:
+                    kernel<1>(m_len, k, *alpha, a, *lda, trA, b, *ldb, trB,
+                            *beta, c, *ldc, bias_m);
+                    break;
+            }
+        }
+    });
+
+    return dnnl_success;
+}
+
+} // namespace rv64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
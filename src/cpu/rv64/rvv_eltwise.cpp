@@ -0,0 +1,91 @@
+/******************************************************************************
+* Copyright 2025 KNS Group LLC (YADRO)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <riscv_vector.h>
+
+#include "common/dnnl_thread.hpp"
+#include "cpu/rv64/rvv_eltwise.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace rv64 {
+
+namespace {
+vfloat32m8_t compute(alg_kind_t alg, vfloat32m8_t v, float alpha, float beta,
+        size_t vl) {
+    using namespace alg_kind;
+    switch (alg) {
+        case eltwise_relu: {
+            if (alpha == 0.f) return __riscv_vfmax_vf_f32m8(v, 0.f, vl);
+            const vbool4_t neg = __riscv_vmflt_vf_f32m8_b4(v, 0.f, vl);
+            return __riscv_vfmul_vf_f32m8_mu(neg, v, v, alpha, vl);
+        }
+        case eltwise_linear:
+            return __riscv_vfadd_vf_f32m8(
+                    __riscv_vfmul_vf_f32m8(v, alpha, vl), beta, vl);
+        case eltwise_clip:
+            return __riscv_vfmin_vf_f32m8(
+                    __riscv_vfmax_vf_f32m8(v, alpha, vl), beta, vl);
+        case eltwise_abs: return __riscv_vfabs_v_f32m8(v, vl);
+        case eltwise_square: return __riscv_vfmul_vv_f32m8(v, v, vl);
+        case eltwise_sqrt: return __riscv_vfsqrt_v_f32m8(v, vl);
+        default: assert(!"unsupported algorithm"); return v;
+    }
+}
+} // namespace
+
+template <data_type_t d_type>
+riscv_eltwise_fwd_t<d_type>::riscv_eltwise_fwd_t(const pd_t *apd)
+    : primitive_t(apd) {}
+
+template <>
+status_t riscv_eltwise_fwd_t<data_type::f32>::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+
+    src += src_d.offset0();
+    dst += src_d.offset0();
+
+    const dim_t nelems = src_d.nelems(true);
+    const alg_kind_t alg = pd()->desc()->alg_kind;
+    const float alpha = pd()->desc()->alpha;
+    const float beta = pd()->desc()->beta;
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(nelems, nthr, ithr, start, end);
+        for (dim_t i = start; i < end;) {
+            const size_t vl = __riscv_vsetvl_e32m8(end - i);
+            vfloat32m8_t v = __riscv_vle32_v_f32m8(&src[i], vl);
+            v = compute(alg, v, alpha, beta, vl);
+            __riscv_vse32_v_f32m8(&dst[i], v, vl);
+            i += vl;
+        }
+    });
+
+    return status::success;
+}
+
+template struct riscv_eltwise_fwd_t<data_type::f32>;
+
+} // namespace rv64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -139,6 +139,26 @@ const float *precompute_scales(const memory_tracking::grantor_t &scratchpad,
     return scales;
 }
 
+const float *precompute_scales(const memory_tracking::grantor_t &scratchpad,
+        const constant_quant_resource_t *resource, const float *src_scales,
+        const float *wei_scales, dim_t IC, dim_t OC,
+        const bool wei_scale_per_ic, const bool wei_scale_per_oc,
+        const primitive_attr_t *attr) {
+    using namespace dnnl::impl::memory_tracking::names;
+
+    auto compute = [&]() {
+        return precompute_scales(scratchpad, src_scales, wei_scales, IC, OC,
+                wei_scale_per_ic, wei_scale_per_oc, attr);
+    };
+    // Without a copy the user buffers are returned, there is nothing to keep.
+    if (!resource || !req_copy_scales(attr->scales_)) return compute();
+
+    size_t size = 0;
+    scratchpad.template get<float>(key_precomputed_scales, &size);
+    return resource->get<float>(
+            constant_quant_resource_t::scales, size, compute);
+}
+
 } // namespace cpu
 } // namespace impl
 } // namespace dnnl
@@ -21,6 +21,8 @@
 #include "common/memory_tracking.hpp"
 #include "common/primitive_attr.hpp"
 
+#include "cpu/constant_quant_resource.hpp"
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -46,6 +48,14 @@ const float *precompute_scales(const memory_tracking::grantor_t &scratchpad,
         const bool wei_scale_per_ic, const bool wei_scale_per_oc,
         const primitive_attr_t *attr, float scale_adjust_factor = 1.0f,
         bool req_transpose = false);
+// Same as above, but for a primitive with constant quantization parameters,
+// i.e. with non-null `resource`, the scales are only computed by the first
+// execution and are kept in the resource.
+const float *precompute_scales(const memory_tracking::grantor_t &scratchpad,
+        const constant_quant_resource_t *resource, const float *src_scales,
+        const float *wei_scales, dim_t ic, dim_t oc,
+        const bool wei_scale_per_ic, const bool wei_scale_per_oc,
+        const primitive_attr_t *attr);
 
 } // namespace cpu
 } // namespace impl
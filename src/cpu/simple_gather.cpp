@@ -0,0 +1,195 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "common/dnnl_thread.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/simple_gather.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace memory_tracking::names;
+
+namespace {
+
+// Indices are random, so rows are requested from memory a few indices ahead of
+// their use to hide the latency of the cache misses.
+constexpr dim_t prefetch_distance = 4;
+constexpr dim_t cache_line_size = 64;
+
+inline void prefetch_row(const void *ptr, size_t size) {
+#if defined(__GNUC__)
+    const char *p = static_cast<const char *>(ptr);
+    for (size_t off = 0; off < size; off += cache_line_size)
+        __builtin_prefetch(p + off, 0, 0);
+#else
+    UNUSED(ptr);
+    UNUSED(size);
+#endif
+}
+
+} // namespace
+
+template <data_type_t src_type>
+status_t simple_gather_t::execute_impl(const exec_ctx_t &ctx) const {
+    using src_data_t = typename prec_traits_t<src_type>::type;
+
+    auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
+    auto indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_INDICES);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+    const int32_t *src_zero_points = CTX_IN_MEM(
+            const int32_t *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_SRC);
+
+    const auto &attr = *pd()->attr();
+    const bool with_scales = !attr.scales_.has_default_values(DNNL_ARG_SRC);
+    const bool per_row_scales
+            = with_scales && attr.scales_.get_mask(DNNL_ARG_SRC) != 0;
+    const bool with_zp = !attr.zero_points_.has_default_values(DNNL_ARG_SRC);
+    const bool per_row_zp
+            = with_zp && attr.zero_points_.get_mask(DNNL_ARG_SRC) != 0;
+
+    const memory_desc_wrapper src_d(pd()->src_md(0));
+    const memory_desc_wrapper idx_d(pd()->src_md(1));
+    const memory_desc_wrapper dst_d(pd()->dst_md(0));
+    const auto dst_dt = dst_d.data_type();
+
+    const dim_t V = pd()->num_rows();
+    const dim_t C = pd()->row_size();
+    const dim_t B = pd()->num_bags();
+    const dim_t L = pd()->bag_size();
+    const auto src_row_stride = src_d.blocking_desc().strides[0];
+    const auto &idx_strides = idx_d.blocking_desc().strides;
+    const auto &dst_strides = dst_d.blocking_desc().strides;
+    const size_t row_bytes = C * sizeof(src_data_t);
+
+    auto index = [&](dim_t b, dim_t l) {
+        return indices[idx_d.offset0() + b * idx_strides[0]
+                + l * idx_strides[1]];
+    };
+    auto is_valid = [&](dim_t i) { return i >= 0 && i < V; };
+    auto row = [&](dim_t i) {
+        return src + src_d.offset0() + i * src_row_stride;
+    };
+
+    // Accumulates `alpha * (row(i) - zp) * scale` into `acc`.
+    auto accumulate_row = [&](float *acc, dim_t i, float alpha) {
+        const src_data_t *r = row(i);
+        const float s = alpha * src_scales[per_row_scales ? i : 0];
+        const float zp = with_zp
+                ? static_cast<float>(src_zero_points[per_row_zp ? i : 0])
+                : 0.f;
+        PRAGMA_OMP_SIMD()
+        for (dim_t c = 0; c < C; ++c)
+            acc[c] += (static_cast<float>(r[c]) - zp) * s;
+    };
+
+    auto store_row = [&](const float *acc, dim_t dst_off) {
+        if (dst_dt == data_type::f32) {
+            float *d = static_cast<float *>(dst) + dst_off;
+            PRAGMA_OMP_SIMD()
+            for (dim_t c = 0; c < C; ++c)
+                d[c] = acc[c];
+        } else {
+            for (dim_t c = 0; c < C; ++c)
+                io::store_float_value(dst_dt, acc[c], dst, dst_off + c);
+        }
+    };
+
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    float *acc_base = scratchpad.template get<float>(key_gather_acc);
+
+    if (!pd()->with_reduction()) {
+        parallel(0, [&](const int ithr, const int nthr) {
+            dim_t start {0}, end {0};
+            balance211(B * L, nthr, ithr, start, end);
+
+            float *acc = acc_base + ithr * C;
+            for (dim_t bl = start; bl < end; ++bl) {
+                const dim_t b = bl / L, l = bl % L;
+                if (bl + prefetch_distance < end) {
+                    const dim_t next = bl + prefetch_distance;
+                    const dim_t i_next = index(next / L, next % L);
+                    if (is_valid(i_next)) prefetch_row(row(i_next), row_bytes);
+                }
+
+                std::fill(acc, acc + C, 0.f);
+                const dim_t i = index(b, l);
+                if (is_valid(i)) accumulate_row(acc, i, 1.f);
+                store_row(acc,
+                        dst_d.offset0() + b * dst_strides[0]
+                                + l * dst_strides[1]);
+            }
+        });
+        return status::success;
+    }
+
+    const bool is_mean = pd()->desc()->alg_kind == alg_kind::gather_mean;
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(B, nthr, ithr, start, end);
+
+        float *acc = acc_base + ithr * C;
+        for (dim_t b = start; b < end; ++b) {
+            dim_t n_valid = 0;
+            for (dim_t l = 0; l < L; ++l)
+                n_valid += is_valid(index(b, l));
+            const float alpha = is_mean && n_valid > 0 ? 1.f / n_valid : 1.f;
+
+            std::fill(acc, acc + C, 0.f);
+            for (dim_t l = 0; l < L; ++l) {
+                // Look ahead within the bag and into the next one.
+                const dim_t next = b * L + l + prefetch_distance;
+                if (next < end * L) {
+                    const dim_t i_next = index(next / L, next % L);
+                    if (is_valid(i_next)) prefetch_row(row(i_next), row_bytes);
+                }
+
+                const dim_t i = index(b, l);
+                if (is_valid(i)) accumulate_row(acc, i, alpha);
+            }
+            store_row(acc, dst_d.offset0() + b * dst_strides[0]);
+        }
+    });
+
+    return status::success;
+}
+
+status_t simple_gather_t::execute(const exec_ctx_t &ctx) const {
+    if (pd()->has_zero_dim_memory()) return status::success;
+
+    using namespace data_type;
+    switch (pd()->src_md(0)->data_type) {
+        case f32: return execute_impl<f32>(ctx);
+        case bf16: return execute_impl<bf16>(ctx);
+        case f16: return execute_impl<f16>(ctx);
+        case s8: return execute_impl<s8>(ctx);
+        case u8: return execute_impl<u8>(ctx);
+        default: assert(!"unsupported data type");
+    }
+    return status::runtime_error;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
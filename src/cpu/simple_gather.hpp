@@ -0,0 +1,114 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SIMPLE_GATHER_HPP
+#define CPU_SIMPLE_GATHER_HPP
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_gather_pd.hpp"
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Copies or reduces rows of a dense row-major table. Table rows are
+// dequantized to f32 on load, which allows int8, bf16 and f16 tables to be
+// used with a floating-point destination. Indices outside of the table are
+// treated as padding: they produce zero rows for `gather_none` and are
+// skipped by the reductions.
+struct simple_gather_t : public primitive_t {
+    struct pd_t : public cpu_gather_pd_t {
+        using cpu_gather_pd_t::cpu_gather_pd_t;
+
+        DECLARE_COMMON_PD_T("simple:any", simple_gather_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            using sm = primitive_attr_t::skip_mask_t;
+            const auto src_type = src_md(0)->data_type;
+            const auto dst_type = dst_md(0)->data_type;
+
+            VDISPATCH_GATHER(utils::one_of(src_type, f32, bf16, f16, s8, u8),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_GATHER(utils::one_of(dst_type, f32, bf16, f16),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_GATHER(platform::has_data_type_support(src_type),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_GATHER(platform::has_data_type_support(dst_type),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_GATHER(set_default_params() == status::success,
+                    VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_GATHER(
+                    attr()->has_default_values(sm::scales | sm::zero_points),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_GATHER(
+                    attr()->scales_.has_default_data_type(DNNL_ARG_SRC),
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
+            VDISPATCH_GATHER(
+                    attr()->zero_points_.has_default_data_type(DNNL_ARG_SRC),
+                    VERBOSE_UNSUPPORTED_ZP_CFG);
+
+            // Rows of the table and of the destination must be dense.
+            const memory_desc_wrapper src_d(src_md(0));
+            const memory_desc_wrapper idx_d(src_md(1));
+            const memory_desc_wrapper dst_d(dst_md(0));
+            VDISPATCH_GATHER(src_d.is_plain()
+                            && src_d.blocking_desc().strides[1] == 1,
+                    VERBOSE_UNSUPPORTED_TAG_S, "src");
+            VDISPATCH_GATHER(idx_d.is_plain(), VERBOSE_UNSUPPORTED_TAG_S,
+                    "indices");
+            VDISPATCH_GATHER(dst_d.is_plain()
+                            && dst_d.blocking_desc().strides[dst_d.ndims() - 1]
+                                    == 1,
+                    VERBOSE_UNSUPPORTED_TAG_S, "dst");
+
+            init_scratchpad();
+
+            return status::success;
+        }
+
+    private:
+        // A row is accumulated in f32 before the conversion to the
+        // destination data type.
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.template book<float>(
+                    key_gather_acc, row_size() * dnnl_get_max_threads());
+        }
+    };
+
+    simple_gather_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    template <data_type_t src_type>
+    status_t execute_impl(const exec_ctx_t &ctx) const;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -40,6 +40,8 @@ status_t simple_layer_normalization_fwd_t::pd_t::init(engine_t *engine) {
     const memory_desc_wrapper src_d(src_md());
 
     VDISPATCH_LNORM(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_LNORM(!fuse_residual_add(), VERBOSE_UNSUPPORTED_FEATURE,
+            "residual add");
     VDISPATCH_LNORM(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
     VDISPATCH_LNORM(utils::one_of(src_md()->data_type, f32, bf16, f16, s8, u8),
             VERBOSE_UNSUPPORTED_DT);
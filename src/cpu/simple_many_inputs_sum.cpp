@@ -0,0 +1,123 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "common/bfloat16.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/math_utils.hpp"
+
+#include "cpu/simple_many_inputs_sum.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+// The number of destination elements accumulated at once. The accumulator
+// and the converted input of a block take 8 KB and stay in the L1 cache.
+constexpr dim_t block_size = 1024;
+} // namespace
+
+template <data_type_t src_data_type, data_type_t dst_data_type>
+status_t simple_many_inputs_sum_t<src_data_type, dst_data_type>::execute(
+        const exec_ctx_t &ctx) const {
+    if (pd()->has_zero_dim_memory()) return status::success;
+
+    const memory_desc_wrapper o_d(pd()->dst_md());
+    auto output = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST) + o_d.blk_off(0);
+
+    const int num_arrs = pd()->n_inputs();
+    std::vector<const src_data_t *> input_ptrs(num_arrs);
+    for (int a = 0; a < num_arrs; ++a) {
+        const memory_desc_wrapper i_d(pd()->src_md(a));
+        input_ptrs[a]
+                = CTX_IN_MEM(const src_data_t *, DNNL_ARG_MULTIPLE_SRC + a)
+                + i_d.blk_off(0);
+    }
+
+    const bool stochastic_rounding = pd()->stochastic_rounding_;
+    const uint32_t seed = stochastic_rounding
+            ? *CTX_IN_MEM(const uint32_t *, DNNL_ARG_ATTR_ROUNDING_SEED)
+            : 0;
+
+    const auto scales = pd()->scales();
+    const dim_t nelems = o_d.nelems();
+    const dim_t nblocks = utils::div_up(nelems, block_size);
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(nblocks, nthr, ithr, start, end);
+
+        acc_data_t acc[block_size];
+        acc_data_t cvt[block_size];
+        for (dim_t nb = start; nb < end; ++nb) {
+            const dim_t off = nb * block_size;
+            const dim_t len = nstl::min(block_size, nelems - off);
+
+            for (int a = 0; a < num_arrs; ++a) {
+                const src_data_t *in = input_ptrs[a] + off;
+                const acc_data_t *in_f32 = nullptr;
+                if (src_data_type == data_type::f32) {
+                    in_f32 = reinterpret_cast<const acc_data_t *>(in);
+                } else {
+                    types::cvt_to_float(cvt, in, len);
+                    in_f32 = cvt;
+                }
+
+                // Prefetching the block of the next input hides the latency
+                // of the jump between input buffers.
+#if defined(__GNUC__)
+                if (a + 1 < num_arrs)
+                    __builtin_prefetch(input_ptrs[a + 1] + off, 0, 0);
+#endif
+
+                const float s = scales[a];
+                if (a == 0) {
+                    PRAGMA_OMP_SIMD()
+                    for (dim_t e = 0; e < len; ++e)
+                        acc[e] = s * in_f32[e];
+                } else {
+                    PRAGMA_OMP_SIMD()
+                    for (dim_t e = 0; e < len; ++e)
+                        acc[e] += s * in_f32[e];
+                }
+            }
+
+            dst_data_t *out = output + off;
+            if (stochastic_rounding) {
+                for (dim_t e = 0; e < len; ++e)
+                    out[e] = math::stochastic_round_fwd(
+                            acc[e], (uint32_t)(off + e), seed, dst_data_type);
+            } else {
+                types::cvt_from_float(out, acc, len);
+            }
+        }
+    });
+
+    return status::success;
+}
+
+template struct simple_many_inputs_sum_t<data_type::f32>;
+template struct simple_many_inputs_sum_t<data_type::f32, data_type::bf16>;
+template struct simple_many_inputs_sum_t<data_type::bf16>;
+template struct simple_many_inputs_sum_t<data_type::bf16, data_type::f32>;
+template struct simple_many_inputs_sum_t<data_type::f16>;
+template struct simple_many_inputs_sum_t<data_type::f16, data_type::f32>;
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,97 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SIMPLE_MANY_INPUTS_SUM_HPP
+#define CPU_SIMPLE_MANY_INPUTS_SUM_HPP
+
+#include "common/dnnl_thread.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_sum_pd.hpp"
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Sums an arbitrary number of inputs in a single pass over the destination.
+// The destination is processed in blocks that fit the L1 cache: an f32
+// accumulator of a block stays in cache while every input streams through
+// it once, and the destination is written once at the end. Unlike
+// simple_sum_t, the number of inputs is not limited, and the conversion of
+// the result to a low precision destination may use stochastic rounding.
+template <data_type_t src_data_type, data_type_t dst_data_type = src_data_type>
+struct simple_many_inputs_sum_t : public primitive_t {
+    struct pd_t : public cpu_sum_pd_t {
+        using cpu_sum_pd_t::cpu_sum_pd_t;
+
+        DECLARE_SUM_PD_T("simple:many_inputs", simple_many_inputs_sum_t);
+
+        status_t init(engine_t *engine) {
+            using smask_t = primitive_attr_t::skip_mask_t;
+            const int n = n_inputs();
+
+            VDISPATCH_SUM(platform::has_data_type_support(src_data_type),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_SUM(platform::has_data_type_support(dst_data_type),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_SUM(cpu_sum_pd_t::init(engine, smask_t::rounding_mode)
+                            == status::success,
+                    VERBOSE_BAD_ENGINE_KIND);
+
+            const memory_desc_wrapper o_d(dst_md());
+            VDISPATCH_SUM(o_d.data_type() == dst_data_type,
+                    VERBOSE_INCONSISTENT_DT, "o_d", "dst");
+            VDISPATCH_SUM(o_d.is_dense(), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+            for (int i = 0; i < n; ++i) {
+                const memory_desc_wrapper i_d(src_md(i));
+                VDISPATCH_SUM(i_d.data_type() == src_data_type,
+                        VERBOSE_UNSUPPORTED_DT);
+                VDISPATCH_SUM(o_d.similar_to(i_d, true, false, 0),
+                        VERBOSE_INCONSISTENT_MDS, "o_d", "i_d");
+                VDISPATCH_SUM(i_d.is_dense(), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+            }
+
+            stochastic_rounding_ = dst_data_type != data_type::f32
+                    && attr()->rounding_mode_.get(DNNL_ARG_DST)
+                            == rounding_mode::stochastic;
+            return status::success;
+        }
+
+        // Rounding of the f32 accumulator to a low precision destination is
+        // stochastic rather than to the nearest.
+        bool stochastic_rounding_ = false;
+    };
+
+    simple_many_inputs_sum_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+    using src_data_t = typename prec_traits_t<src_data_type>::type;
+    using dst_data_t = typename prec_traits_t<dst_data_type>::type;
+    using acc_data_t = typename prec_traits_t<data_type::f32>::type;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,185 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "common/dnnl_thread.hpp"
+#include "common/math_utils.hpp"
+
+#include "cpu/simple_optimizer.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+// The number of elements updated at once. The current values of the
+// parameters are kept in f32 on the stack for a block.
+constexpr dim_t block_size = 64;
+
+} // namespace
+
+template <data_type_t param_type, data_type_t grad_type>
+status_t simple_optimizer_t::execute_impl(const exec_ctx_t &ctx) const {
+    using namespace alg_kind;
+    using param_t = typename prec_traits_t<param_type>::type;
+    using grad_t = typename prec_traits_t<grad_type>::type;
+
+    const memory_desc_wrapper param_d(pd()->dst_md(0));
+    const memory_desc_wrapper grad_d(pd()->src_md(0));
+    const memory_desc_wrapper moment_d(pd()->dst_md(1));
+    const memory_desc_wrapper master_d(pd()->master_md());
+
+    auto grad = CTX_IN_MEM(const grad_t *, DNNL_ARG_SRC) + grad_d.offset0();
+    auto param = CTX_OUT_MEM(param_t *, DNNL_ARG_DST) + param_d.offset0();
+    const float lr = *CTX_IN_MEM(const float *, DNNL_ARG_LEARNING_RATE);
+
+    const int n_moments = pd()->n_moments();
+    float *m1 = n_moments > 0
+            ? CTX_OUT_MEM(float *, DNNL_ARG_MOMENT_1) + moment_d.offset0()
+            : nullptr;
+    float *m2 = n_moments > 1
+            ? CTX_OUT_MEM(float *, DNNL_ARG_MOMENT_2) + moment_d.offset0()
+            : nullptr;
+    float *master = pd()->with_master_weights()
+            ? CTX_OUT_MEM(float *, DNNL_ARG_MASTER_WEIGHTS)
+                    + master_d.offset0()
+            : nullptr;
+
+    const bool stochastic_rounding = pd()->stochastic_rounding_;
+    const uint32_t seed = stochastic_rounding
+            ? *CTX_IN_MEM(const uint32_t *, DNNL_ARG_ATTR_ROUNDING_SEED)
+            : 0;
+
+    const auto *d = pd()->desc();
+    const alg_kind_t alg = d->alg_kind;
+    const float beta1 = d->momentum;
+    const float beta2 = d->beta2;
+    const float eps = d->epsilon;
+    const float wd = d->weight_decay;
+
+    // Adam bias corrections are folded into the step size and epsilon:
+    //   p -= lr / bc1 * m / (sqrt(v / bc2) + eps)
+    //     == step * m / (sqrt(v) + eps * sqrt(bc2)).
+    float step_size = lr, eps_hat = eps;
+    if (pd()->is_adam()) {
+        const int32_t t = *CTX_IN_MEM(const int32_t *, DNNL_ARG_STEP);
+        VCONDCHECK(primitive, exec, check, optimizer, t >= 1,
+                status::invalid_arguments, VERBOSE_BAD_PARAM, "step");
+        const float bc1 = 1.f - std::pow(beta1, (float)t);
+        const float bc2_sqrt = std::sqrt(1.f - std::pow(beta2, (float)t));
+        step_size = lr * bc2_sqrt / bc1;
+        eps_hat = eps * bc2_sqrt;
+    }
+    // AdamW decays the parameters directly instead of the gradients.
+    const float decay = alg == optimizer_adamw ? 1.f - lr * wd : 1.f;
+    const float grad_wd = alg == optimizer_adamw ? 0.f : wd;
+
+    const dim_t nelems = param_d.nelems();
+    const dim_t nblocks = utils::div_up(nelems, block_size);
+
+    parallel(0, [&](int ithr, int nthr) {
+        dim_t start {0}, end {0};
+        balance211(nblocks, nthr, ithr, start, end);
+
+        float p[block_size];
+        for (dim_t b = start; b < end; ++b) {
+            const dim_t off = b * block_size;
+            const dim_t len = nstl::min(block_size, nelems - off);
+            const grad_t *g_b = grad + off;
+
+            if (master) {
+                PRAGMA_OMP_SIMD()
+                for (dim_t i = 0; i < len; ++i)
+                    p[i] = master[off + i];
+            } else {
+                PRAGMA_OMP_SIMD()
+                for (dim_t i = 0; i < len; ++i)
+                    p[i] = static_cast<float>(param[off + i]);
+            }
+
+            if (alg == optimizer_sgd && m1) {
+                float *m1_b = m1 + off;
+                PRAGMA_OMP_SIMD()
+                for (dim_t i = 0; i < len; ++i) {
+                    const float g = static_cast<float>(g_b[i]) + wd * p[i];
+                    m1_b[i] = beta1 * m1_b[i] + g;
+                    p[i] -= lr * m1_b[i];
+                }
+            } else if (alg == optimizer_sgd) {
+                PRAGMA_OMP_SIMD()
+                for (dim_t i = 0; i < len; ++i) {
+                    const float g = static_cast<float>(g_b[i]) + wd * p[i];
+                    p[i] -= lr * g;
+                }
+            } else {
+                float *m1_b = m1 + off;
+                float *m2_b = m2 + off;
+                PRAGMA_OMP_SIMD()
+                for (dim_t i = 0; i < len; ++i) {
+                    const float g
+                            = static_cast<float>(g_b[i]) + grad_wd * p[i];
+                    m1_b[i] = beta1 * m1_b[i] + (1.f - beta1) * g;
+                    m2_b[i] = beta2 * m2_b[i] + (1.f - beta2) * g * g;
+                    p[i] = decay * p[i]
+                            - step_size * m1_b[i]
+                                    / (std::sqrt(m2_b[i]) + eps_hat);
+                }
+            }
+
+            if (master) {
+                PRAGMA_OMP_SIMD()
+                for (dim_t i = 0; i < len; ++i)
+                    master[off + i] = p[i];
+            }
+            if (stochastic_rounding) {
+                for (dim_t i = 0; i < len; ++i)
+                    param[off + i] = math::stochastic_round_fwd(
+                            p[i], (uint32_t)(off + i), seed, param_type);
+            } else {
+                PRAGMA_OMP_SIMD()
+                for (dim_t i = 0; i < len; ++i)
+                    param[off + i] = p[i];
+            }
+        }
+    });
+
+    return status::success;
+}
+
+status_t simple_optimizer_t::execute(const exec_ctx_t &ctx) const {
+    using namespace data_type;
+    if (pd()->has_zero_dim_memory()) return status::success;
+
+    const auto param_type = pd()->dst_md(0)->data_type;
+    const bool f32_grad = pd()->src_md(0)->data_type == f32;
+    switch (param_type) {
+        case f32: return execute_impl<f32, f32>(ctx);
+        case bf16:
+            return f32_grad ? execute_impl<bf16, f32>(ctx)
+                            : execute_impl<bf16, bf16>(ctx);
+        case f16:
+            return f32_grad ? execute_impl<f16, f32>(ctx)
+                            : execute_impl<f16, f16>(ctx);
+        default: assert(!"unsupported data type");
+    }
+    return status::unimplemented;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,97 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SIMPLE_OPTIMIZER_HPP
+#define CPU_SIMPLE_OPTIMIZER_HPP
+
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_optimizer_pd.hpp"
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Updates the parameters and the optimizer state in a single pass over
+// memory. All tensors share the same dense layout, so the update is applied
+// to a flat array of elements, which also allows to update many parameter
+// tensors placed in one buffer with a single call.
+struct simple_optimizer_t : public primitive_t {
+    struct pd_t : public cpu_optimizer_pd_t {
+        using cpu_optimizer_pd_t::cpu_optimizer_pd_t;
+
+        DECLARE_COMMON_PD_T("simple:any", simple_optimizer_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            using smask_t = primitive_attr_t::skip_mask_t;
+            const auto param_type = dst_md(0)->data_type;
+            const auto grad_type = src_md(0)->data_type;
+
+            VDISPATCH_OPTIMIZER(utils::one_of(param_type, f32, bf16, f16),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_OPTIMIZER(utils::one_of(grad_type, param_type, f32),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_OPTIMIZER(platform::has_data_type_support(param_type),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_OPTIMIZER(
+                    attr()->has_default_values(smask_t::rounding_mode),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_OPTIMIZER(set_default_params() == status::success,
+                    VERBOSE_UNSUPPORTED_TAG);
+
+            const memory_desc_wrapper param_d(dst_md(0));
+            VDISPATCH_OPTIMIZER(param_d.is_dense(), VERBOSE_UNSUPPORTED_TAG_S,
+                    "param");
+            VDISPATCH_OPTIMIZER(
+                    types::blocking_desc_is_equal(*src_md(0), *dst_md(0)),
+                    VERBOSE_BLOCKING_FAIL, "grad and param layouts differ");
+            if (with_master_weights())
+                VDISPATCH_OPTIMIZER(
+                        types::blocking_desc_is_equal(*master_md(), *dst_md(0)),
+                        VERBOSE_BLOCKING_FAIL,
+                        "master and param layouts differ");
+
+            stochastic_rounding_ = param_type != f32
+                    && attr()->rounding_mode_.get(DNNL_ARG_DST)
+                            == rounding_mode::stochastic;
+
+            return status::success;
+        }
+
+        // Rounding of the f32 result to a low precision parameter is
+        // stochastic rather than to the nearest.
+        bool stochastic_rounding_ = false;
+    };
+
+    simple_optimizer_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    template <data_type_t param_type, data_type_t grad_type>
+    status_t execute_impl(const exec_ctx_t &ctx) const;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
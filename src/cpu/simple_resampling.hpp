@@ -65,6 +65,10 @@ struct simple_resampling_fwd_t : public primitive_t {
             using sm = primitive_attr_t::skip_mask_t;
 
             VDISPATCH_RESAMPLING(is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_RESAMPLING(utils::one_of(desc()->alg_kind,
+                                         alg_kind::resampling_nearest,
+                                         alg_kind::resampling_linear),
+                    VERBOSE_BAD_ALGORITHM);
             VDISPATCH_RESAMPLING(
                     !has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
             VDISPATCH_RESAMPLING(utils::one_of(src_md()->data_type, f32, s32,
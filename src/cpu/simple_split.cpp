@@ -0,0 +1,118 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "common/dnnl_thread.hpp"
+
+#include "cpu/simple_split.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace memory_tracking::names;
+
+status_t simple_split_t::execute(const exec_ctx_t &ctx) const {
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    auto iptrs = scratchpad.template get<const char *>(key_split_iptrs);
+    auto optrs = scratchpad.template get<char *>(key_split_optrs);
+    auto nelems_to_copy = scratchpad.template get<dim_t>(key_split_nelems);
+    auto os = scratchpad.template get<strides_t>(key_split_ostrides);
+
+    const int num_arrs = pd()->n_outputs();
+    const int *perm = pd()->perm_, *iperm = pd()->iperm_;
+    const int split_dim = pd()->split_dim();
+    const memory_desc_wrapper i_d(pd()->src_md());
+    const size_t dt_size = i_d.data_type_size();
+    auto i_base_ptr = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    if (i_base_ptr == nullptr) return status::success;
+
+    for (int a = 0; a < num_arrs; ++a) {
+        const memory_desc_wrapper o_d(pd()->dst_md(a));
+        const memory_desc_wrapper img_d(pd()->dst_image_md(a));
+        const auto optr = CTX_OUT_MEM(char *, DNNL_ARG_MULTIPLE_DST + a);
+        // A view of the source needs no copy.
+        const bool is_view = pd()->is_view(a) && optr == i_base_ptr;
+        if (optr == nullptr || is_view) {
+            optrs[a] = nullptr;
+            nelems_to_copy[a] = 0;
+            continue;
+        }
+        iptrs[a] = i_base_ptr + img_d.blk_off(0) * dt_size;
+        optrs[a] = optr + o_d.blk_off(0) * dt_size;
+        nelems_to_copy[a] = pd()->nelems_to_split(o_d);
+        for (int i = 0; i < DNNL_MAX_NDIMS; i++) {
+            if (i < perm[split_dim])
+                os[a][i] = size_t(o_d.blocking_desc().strides[iperm[i]]);
+            else
+                os[a][i] = 0;
+        }
+    }
+
+    strides_t is = {0};
+    dims_t phys_dims;
+    bool has_outer_loop = false;
+    for (int i = 0; i < DNNL_MAX_NDIMS; i++) {
+        if (i < perm[split_dim]) {
+            is[i] = i_d.blocking_desc().strides[iperm[i]];
+            phys_dims[i]
+                    = i_d.padded_dims()[iperm[i]] / pd()->blocks_[iperm[i]];
+            if (phys_dims[i] != 1) has_outer_loop = true;
+        } else
+            phys_dims[i] = 1;
+    }
+
+    // Applies when split axis is the outermost dimension, e.g. split_axis = 0
+    // or split_axis = 1, and dims[0] = 1;
+    if (!has_outer_loop) {
+        int nthr = dnnl_get_max_threads();
+        parallel(nthr, [&](int ithr, int nthr) {
+            for (int a = 0; a < num_arrs; ++a) {
+                if (optrs[a] == nullptr) continue;
+                dim_t start {0}, end {0};
+                balance211(nelems_to_copy[a], nthr, ithr, start, end);
+                if (start >= end) continue;
+
+                std::memcpy(optrs[a] + start * dt_size,
+                        iptrs[a] + start * dt_size, (end - start) * dt_size);
+            }
+        });
+
+        return status::success;
+    }
+
+    parallel_nd(phys_dims[0], phys_dims[1], phys_dims[2], phys_dims[3],
+            phys_dims[4], num_arrs,
+            [&](dim_t n0, dim_t n1, dim_t n2, dim_t n3, dim_t n4, dim_t a) {
+                // check if zero memory or a view
+                if (optrs[a] == nullptr) return;
+
+                size_t in_off = is[0] * n0 + is[1] * n1 + is[2] * n2
+                        + is[3] * n3 + is[4] * n4;
+                size_t out_off = os[a][0] * n0 + os[a][1] * n1 + os[a][2] * n2
+                        + os[a][3] * n3 + os[a][4] * n4;
+                std::memcpy(&optrs[a][out_off * dt_size],
+                        &iptrs[a][in_off * dt_size],
+                        nelems_to_copy[a] * dt_size);
+            });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,173 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SIMPLE_SPLIT_HPP
+#define CPU_SIMPLE_SPLIT_HPP
+
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/cpu_split_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Copies all destinations in a single pass over the source. Every contiguous
+// chunk of the source belongs to exactly one destination, so the source is
+// read once regardless of the number of outputs. Destinations passed as views
+// of the source buffer are skipped.
+struct simple_split_t : public primitive_t {
+    struct pd_t : public cpu_split_pd_t {
+        using cpu_split_pd_t::cpu_split_pd_t;
+
+        pd_t(const pd_t &rhs) : cpu_split_pd_t(rhs) { copy_from(rhs); }
+
+        DECLARE_SPLIT_PD_T("simple:any", simple_split_t);
+
+        status_t init(engine_t *engine) {
+            const memory_desc_wrapper src_d(src_md());
+            VDISPATCH_SPLIT(platform::has_data_type_support(src_d.data_type()),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_SPLIT(
+                    attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_SPLIT(cpu_split_pd_t::init() == status::success,
+                    VERBOSE_PRIMITIVE_CREATION_FAIL, "split");
+            VDISPATCH_SPLIT(src_d.ndims() <= 6, VERBOSE_BAD_NDIMS, "src",
+                    src_d.ndims());
+
+            for (int i = 0; i < n_outputs(); ++i) {
+                const memory_desc_wrapper o_d(&dst_mds_[i]);
+                const memory_desc_wrapper i_d(&dst_image_mds_[i]);
+
+                const bool ignore_strides = true;
+
+                VDISPATCH_SPLIT(o_d.format_kind() == format_kind::blocked,
+                        VERBOSE_UNSUPPORTED_TAG);
+                VDISPATCH_SPLIT(types::blocking_desc_is_equal(
+                                        *o_d.md_, *i_d.md_, ignore_strides),
+                        VERBOSE_BLOCKING_FAIL, "blocking descriptor mismatch");
+                VDISPATCH_SPLIT(!o_d.is_additional_buffer(),
+                        "memory format does not have additional buffer");
+            }
+
+            src_d.compute_blocks(blocks_);
+            format_perm();
+
+            // start dim is the first dimension after which the split would
+            // happen contiguously
+            const int start_dim = perm_[split_dim()];
+
+            // check that contiguous part is indeed contiguous (i.e. dense)
+            const dim_t split_dim_nblks
+                    = src_d.padded_dims()[split_dim()] / blocks_[split_dim()];
+            VDISPATCH_SPLIT(nelems_to_split(src_d)
+                            == split_dim_nblks
+                                    * src_d.blocking_desc().strides[split_dim()],
+                    VERBOSE_INCONSISTENT_NDIMS, "src",
+                    "(padded_dims, split_dim)");
+
+            // check that all outputs have the same strides as the source for
+            // the contiguous part [split_dim .. ndims] for the *major* dims.
+            // the block part is already checked above
+            for (int i = 0; i < n_outputs(); ++i) {
+                const memory_desc_wrapper o_d(&dst_mds_[i]);
+                for (int d = start_dim; d < src_d.ndims(); ++d) {
+                    VDISPATCH_SPLIT(src_d.blocking_desc().strides[iperm_[d]]
+                                    == o_d.blocking_desc().strides[iperm_[d]],
+                            "outputs have inconsistent strides for major "
+                            "dims");
+                }
+            }
+
+            init_scratchpad();
+
+            return status::success;
+        }
+
+        int perm_[DNNL_MAX_NDIMS] {};
+        int iperm_[DNNL_MAX_NDIMS] {};
+        dims_t blocks_ {};
+
+        dim_t nelems_to_split(const memory_desc_wrapper &data_d) const {
+            const int ndims = data_d.ndims();
+
+            dim_t nelems = 1;
+            for (int i = perm_[split_dim()]; i < ndims; i++)
+                nelems *= data_d.padded_dims()[iperm_[i]] / blocks_[iperm_[i]];
+            for (int i = 0; i < ndims; i++)
+                nelems *= blocks_[i];
+
+            return nelems;
+        }
+
+    private:
+        void format_perm() {
+            const memory_desc_wrapper src_d(src_md());
+            const int ndims = src_d.ndims();
+
+            strides_t strides = {0};
+            utils::array_copy(strides, src_d.blocking_desc().strides, ndims);
+
+            dims_t ou_blocks = {0};
+            utils::array_copy(ou_blocks, src_d.padded_dims(), ndims);
+
+            for (int d = 0; d < ndims; d++) {
+                iperm_[d] = d;
+                ou_blocks[d] /= blocks_[d];
+            }
+
+            utils::simultaneous_sort(strides, ou_blocks, iperm_, ndims,
+                    [](stride_t a, stride_t b) { return b - a; });
+
+            for (int i = 0; i < ndims; i++)
+                perm_[iperm_[i]] = i;
+        }
+
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.template book<const char *>(
+                    key_split_iptrs, n_outputs());
+            scratchpad.template book<char *>(key_split_optrs, n_outputs());
+            scratchpad.template book<dim_t>(key_split_nelems, n_outputs());
+            scratchpad.template book<strides_t>(
+                    key_split_ostrides, n_outputs());
+        }
+
+        void copy_from(const pd_t &rhs) {
+            int ndims = rhs.src_md_.ndims;
+            utils::array_copy(perm_, rhs.perm_, ndims);
+            utils::array_copy(iperm_, rhs.iperm_, ndims);
+            utils::array_copy(blocks_, rhs.blocks_, ndims);
+        }
+    };
+
+    simple_split_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
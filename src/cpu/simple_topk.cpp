@@ -0,0 +1,204 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include "common/dnnl_thread.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/simple_topk.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace memory_tracking::names;
+
+namespace {
+
+struct candidate_t {
+    float value;
+    int32_t index;
+};
+
+// Larger values go first. Equal values keep the order of their indices.
+inline bool better(const candidate_t &a, const candidate_t &b) {
+    return a.value > b.value || (a.value == b.value && a.index < b.index);
+}
+
+// The number of elements a block of a row is compared with the heap at once.
+constexpr dim_t block_size = 16;
+
+// Returns the offset of the first element of the row `r`, where rows
+// enumerate all positions of the tensor with the `axis` coordinate equal to 0.
+dim_t row_offset(const memory_desc_wrapper &mdw, int axis, dim_t r) {
+    dims_t pos = {0};
+    for (int d = mdw.ndims() - 1; d >= 0; --d) {
+        if (d == axis) continue;
+        pos[d] = r % mdw.dims()[d];
+        r /= mdw.dims()[d];
+    }
+    return mdw.off_v(pos);
+}
+
+// Keeps the k best elements of `src[begin:end]` in `heap` and returns them in
+// the descending order. `heap` is a min-heap with respect to `better`, so the
+// weakest candidate is always at the front.
+template <typename data_t>
+void topk_chunk(const data_t *src, dim_t stride, dim_t begin, dim_t end,
+        dim_t k, std::vector<candidate_t> &heap) {
+    heap.clear();
+    const dim_t first_end = nstl::min(end, begin + k);
+    for (dim_t i = begin; i < first_end; ++i)
+        heap.push_back({static_cast<float>(src[i * stride]), (int32_t)i});
+    std::make_heap(heap.begin(), heap.end(), better);
+
+    float threshold = heap.front().value;
+    for (dim_t b = first_end; b < end; b += block_size) {
+        const dim_t b_end = nstl::min(end, b + block_size);
+        // Later elements lose ties, so the block may be skipped when no
+        // element is strictly greater than the weakest candidate.
+        float block_max = -nstl::numeric_limits<float>::max();
+        PRAGMA_OMP_SIMD(reduction(max : block_max))
+        for (dim_t i = b; i < b_end; ++i)
+            block_max = nstl::max(
+                    block_max, static_cast<float>(src[i * stride]));
+        if (block_max <= threshold) continue;
+
+        for (dim_t i = b; i < b_end; ++i) {
+            const float v = static_cast<float>(src[i * stride]);
+            if (v <= threshold) continue;
+            std::pop_heap(heap.begin(), heap.end(), better);
+            heap.back() = {v, (int32_t)i};
+            std::push_heap(heap.begin(), heap.end(), better);
+            threshold = heap.front().value;
+        }
+    }
+    std::sort_heap(heap.begin(), heap.end(), better);
+}
+
+} // namespace
+
+template <data_type_t src_type>
+status_t simple_topk_t::execute_impl(const exec_ctx_t &ctx) const {
+    using src_data_t = typename prec_traits_t<src_type>::type;
+
+    auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+    auto indices = CTX_OUT_MEM(int32_t *, DNNL_ARG_DST_INDICES);
+
+    const memory_desc_wrapper src_d(pd()->src_md(0));
+    const memory_desc_wrapper dst_d(pd()->dst_md(0));
+    const memory_desc_wrapper idx_d(pd()->dst_md(1));
+    const auto dst_dt = dst_d.data_type();
+
+    const int axis = pd()->axis();
+    const dim_t rows = pd()->num_rows();
+    const dim_t n = pd()->axis_size();
+    const dim_t k = pd()->k();
+    const dim_t nchunks = pd()->nchunks_;
+    const dim_t chunk_size = pd()->chunk_size_;
+    const dim_t src_stride = src_d.blocking_desc().strides[axis];
+    const dim_t dst_stride = dst_d.blocking_desc().strides[axis];
+    const dim_t idx_stride = idx_d.blocking_desc().strides[axis];
+
+    auto store_row = [&](dim_t r, const candidate_t *best) {
+        const dim_t dst_off = row_offset(dst_d, axis, r);
+        const dim_t idx_off = row_offset(idx_d, axis, r);
+        for (dim_t i = 0; i < k; ++i) {
+            io::store_float_value(
+                    dst_dt, best[i].value, dst, dst_off + i * dst_stride);
+            indices[idx_off + i * idx_stride] = best[i].index;
+        }
+    };
+
+    if (nchunks == 1) {
+        parallel(0, [&](const int ithr, const int nthr) {
+            dim_t start {0}, end {0};
+            balance211(rows, nthr, ithr, start, end);
+
+            std::vector<candidate_t> heap;
+            heap.reserve(k);
+            for (dim_t r = start; r < end; ++r) {
+                const src_data_t *row = src + row_offset(src_d, axis, r);
+                topk_chunk(row, src_stride, 0, n, k, heap);
+                store_row(r, heap.data());
+            }
+        });
+        return status::success;
+    }
+
+    // Every chunk of a long row produces its own k candidates first.
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    float *values_buf = scratchpad.template get<float>(key_topk_values);
+    int32_t *indices_buf = scratchpad.template get<int32_t>(key_topk_indices);
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(rows * nchunks, nthr, ithr, start, end);
+
+        std::vector<candidate_t> heap;
+        heap.reserve(k);
+        for (dim_t rc = start; rc < end; ++rc) {
+            const dim_t r = rc / nchunks, c = rc % nchunks;
+            const src_data_t *row = src + row_offset(src_d, axis, r);
+            const dim_t begin = c * chunk_size;
+            const dim_t chunk_end = nstl::min(n, begin + chunk_size);
+            topk_chunk(row, src_stride, begin, chunk_end, k, heap);
+            for (dim_t i = 0; i < k; ++i) {
+                values_buf[rc * k + i] = heap[i].value;
+                indices_buf[rc * k + i] = heap[i].index;
+            }
+        }
+    });
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(rows, nthr, ithr, start, end);
+
+        std::vector<candidate_t> candidates(nchunks * k);
+        for (dim_t r = start; r < end; ++r) {
+            for (dim_t i = 0; i < nchunks * k; ++i)
+                candidates[i] = {values_buf[r * nchunks * k + i],
+                        indices_buf[r * nchunks * k + i]};
+            std::partial_sort(candidates.begin(), candidates.begin() + k,
+                    candidates.end(), better);
+            store_row(r, candidates.data());
+        }
+    });
+
+    return status::success;
+}
+
+status_t simple_topk_t::execute(const exec_ctx_t &ctx) const {
+    if (pd()->has_zero_dim_memory()) return status::success;
+
+    using namespace data_type;
+    switch (pd()->src_md(0)->data_type) {
+        case f32: return execute_impl<f32>(ctx);
+        case bf16: return execute_impl<bf16>(ctx);
+        case f16: return execute_impl<f16>(ctx);
+        case s8: return execute_impl<s8>(ctx);
+        case u8: return execute_impl<u8>(ctx);
+        default: assert(!"unsupported data type");
+    }
+    return status::runtime_error;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
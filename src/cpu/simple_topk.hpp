@@ -0,0 +1,116 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SIMPLE_TOPK_HPP
+#define CPU_SIMPLE_TOPK_HPP
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_topk_pd.hpp"
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Selects the k largest elements of every row with a heap of the k best
+// candidates. Blocks of the row are skipped without touching the heap when
+// their maximum does not exceed the smallest candidate, which is the common
+// case for long rows and small k. When there are fewer rows than threads,
+// long rows are split into chunks that are processed in parallel and merged.
+struct simple_topk_t : public primitive_t {
+    struct pd_t : public cpu_topk_pd_t {
+        using cpu_topk_pd_t::cpu_topk_pd_t;
+
+        DECLARE_COMMON_PD_T("simple:any", simple_topk_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            const auto src_type = src_md(0)->data_type;
+            const auto dst_type = dst_md(0)->data_type;
+
+            VDISPATCH_TOPK(utils::one_of(src_type, f32, bf16, f16, s8, u8),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_TOPK(utils::one_of(dst_type, src_type, f32),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_TOPK(platform::has_data_type_support(src_type),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_TOPK(attr()->has_default_values(),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_TOPK(set_default_params() == status::success,
+                    VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_TOPK(memory_desc_wrapper(src_md(0)).is_plain(),
+                    VERBOSE_UNSUPPORTED_TAG_S, "src");
+            VDISPATCH_TOPK(memory_desc_wrapper(dst_md(0)).is_plain(),
+                    VERBOSE_UNSUPPORTED_TAG_S, "dst");
+            VDISPATCH_TOPK(memory_desc_wrapper(dst_md(1)).is_plain(),
+                    VERBOSE_UNSUPPORTED_TAG_S, "indices");
+
+            init_chunks();
+            init_scratchpad();
+
+            return status::success;
+        }
+
+        // The number of parts every row is split into.
+        dim_t nchunks_ = 1;
+        // The number of elements in a part of a row, except the last one.
+        dim_t chunk_size_ = 0;
+
+    private:
+        void init_chunks() {
+            const int nthr = dnnl_get_max_threads();
+            const dim_t rows = num_rows();
+            const dim_t n = axis_size();
+            // A shorter chunk is not worth a separate merge.
+            const dim_t min_chunk = nstl::max<dim_t>(4096, 4 * k());
+
+            nchunks_ = 1;
+            if (rows < nthr && n >= 2 * min_chunk)
+                nchunks_ = nstl::min<dim_t>(
+                        utils::div_up(nthr, rows), n / min_chunk);
+            chunk_size_ = utils::div_up(n, nchunks_);
+        }
+
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            if (nchunks_ == 1) return;
+            auto scratchpad = scratchpad_registry().registrar();
+            const dim_t size = num_rows() * nchunks_ * k();
+            scratchpad.template book<float>(key_topk_values, size);
+            scratchpad.template book<int32_t>(key_topk_indices, size);
+        }
+    };
+
+    simple_topk_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    template <data_type_t src_type>
+    status_t execute_impl(const exec_ctx_t &ctx) const;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
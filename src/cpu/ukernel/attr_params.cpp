@@ -64,6 +64,15 @@ status_t dnnl_ukernel_attr_params_set_B_scales(
     return status::unimplemented;
 }
 
+status_t dnnl_ukernel_attr_params_set_B_zero_points(
+        attr_params_t *attr_params, const void *b_zero_points) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_ukernel_attr_params_set_B_zero_points(
+            attr_params, b_zero_points);
+#endif
+    return status::unimplemented;
+}
+
 status_t dnnl_ukernel_attr_params_set_D_scales(
         attr_params_t *attr_params, const void *d_scales) {
 #if DNNL_X64
@@ -76,6 +76,15 @@ status_t dnnl_brgemm_set_D_scales(brgemm_t *brgemm, int d_scale_mask) {
     return status::unimplemented;
 }
 
+status_t dnnl_brgemm_set_prefetch_distance(
+        brgemm_t *brgemm, int A_distance, int B_distance) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_brgemm_set_prefetch_distance(
+            brgemm, A_distance, B_distance);
+#endif
+    return status::unimplemented;
+}
+
 status_t dnnl_brgemm_finalize(brgemm_t *brgemm) {
 #if DNNL_X64
     return x64::ukernel::dnnl_brgemm_finalize(brgemm);
@@ -147,6 +156,27 @@ status_t dnnl_brgemm_execute_postops(const brgemm_t *brgemm, const void *A_ptr,
     return status::unimplemented;
 }
 
+status_t dnnl_brgemm_execute_with_M(const brgemm_t *brgemm, dim_t M,
+        const void *A_ptr, const void *B_ptr, const dim_t *A_B_offsets,
+        void *C_ptr, void *scratchpad_ptr) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_brgemm_execute_with_M(
+            brgemm, M, A_ptr, B_ptr, A_B_offsets, C_ptr, scratchpad_ptr);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_brgemm_execute_postops_with_M(const brgemm_t *brgemm, dim_t M,
+        const void *A_ptr, const void *B_ptr, const dim_t *A_B_offsets,
+        const void *C_ptr, void *D_ptr, void *scratchpad_ptr,
+        const attr_params_t *attr_params) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_brgemm_execute_postops_with_M(brgemm, M, A_ptr,
+            B_ptr, A_B_offsets, C_ptr, D_ptr, scratchpad_ptr, attr_params);
+#endif
+    return status::unimplemented;
+}
+
 status_t dnnl_brgemm_destroy(brgemm_t *brgemm) {
 #if DNNL_X64
     return x64::ukernel::dnnl_brgemm_destroy(brgemm);
@@ -40,6 +40,32 @@ status_t dnnl_transform_create(transform_t **transform, dim_t K, dim_t N,
     return status::unimplemented;
 }
 
+status_t dnnl_transform_create_pack_A(transform_t **transform, dim_t M,
+        dim_t K, pack_type_t in_pack_type, dim_t in_ld, data_type_t dt) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_transform_create_pack_A(
+            transform, M, K, in_pack_type, in_ld, dt);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_transform_set_scales(
+        transform_t *transform, int mask, dim_t group_K) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_transform_set_scales(transform, mask, group_K);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_transform_set_zero_points(
+        transform_t *transform, int mask, dim_t group_K, data_type_t zp_dt) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_transform_set_zero_points(
+            transform, mask, group_K, zp_dt);
+#endif
+    return status::unimplemented;
+}
+
 status_t dnnl_transform_generate(transform_t *transform) {
 #if DNNL_X64
     return x64::ukernel::dnnl_transform_generate(transform);
@@ -55,6 +81,15 @@ status_t dnnl_transform_execute(
     return status::unimplemented;
 }
 
+status_t dnnl_transform_execute_with_params(const transform_t *transform,
+        const void *in_ptr, void *out_ptr, const attr_params_t *attr_params) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_transform_execute_with_params(
+            transform, in_ptr, out_ptr, attr_params);
+#endif
+    return status::unimplemented;
+}
+
 status_t dnnl_transform_destroy(transform_t *transform) {
 #if DNNL_X64
     return x64::ukernel::dnnl_transform_destroy(transform);
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstring>
+
 #include "cpu/x64/amx_tile_configure.hpp"
 #include "cpu/x64/jit_generator.hpp"
 
@@ -89,9 +91,38 @@ private:
     }
 };
 
+namespace {
+// A copy of the palette that was last loaded on the current thread by the
+// functions below. `ldtilecfg` is costly compared to small tile workloads, so
+// loading the same palette again is skipped. The copy is dropped on release,
+// which every AMX driver calls once it is done with the tiles. That keeps the
+// cache from outliving a primitive execution, and external code that
+// reconfigures the tiles on the same thread in between cannot make it stale.
+// Drivers of kernels that issue `ldtilecfg` or `tilerelease` on their own
+// (e.g. the AMX 1x1 convolution and gemm kernels) must drop the copy with
+// `amx_tile_invalidate_palette_cache()`.
+struct amx_palette_cache_t {
+    bool is_valid = false;
+    char palette[AMX_PALETTE_SIZE];
+
+    bool is_loaded(const char *p) const {
+        return is_valid && std::memcmp(palette, p, AMX_PALETTE_SIZE) == 0;
+    }
+    void set(const char *p) {
+        std::memcpy(palette, p, AMX_PALETTE_SIZE);
+        is_valid = true;
+    }
+    void reset() { is_valid = false; }
+};
+
+thread_local amx_palette_cache_t palette_cache;
+} // namespace
+
 status_t amx_tile_configure(const char palette[AMX_PALETTE_SIZE]) {
     static const jit_amx_tilecfg_t tilecfg(/* is_lazy = */ false);
+    if (palette_cache.is_loaded(palette)) return status::success;
     tilecfg.tile_configure(palette);
+    palette_cache.set(palette);
     return status::success;
 };
 
@@ -101,15 +132,22 @@ status_t amx_tile_lazy_configure(const char palette[AMX_PALETTE_SIZE]) {
     // a member of `jit_amx_tilecfg_t` class.
     char palette_storage[AMX_PALETTE_SIZE];
     tilecfg.tile_lazy_configure(palette, palette_storage);
+    palette_cache.set(palette);
     return status::success;
 };
 
 status_t amx_tile_release() {
     static const jit_amx_tilerelease_t tilerls;
     tilerls.tile_release();
+    palette_cache.reset();
     return status::success;
 };
 
+status_t amx_tile_invalidate_palette_cache() {
+    palette_cache.reset();
+    return status::success;
+}
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
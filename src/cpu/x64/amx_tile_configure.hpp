@@ -28,6 +28,10 @@ static constexpr size_t AMX_PALETTE_SIZE = 64;
 status_t DNNL_API amx_tile_configure(const char palette[AMX_PALETTE_SIZE]);
 status_t DNNL_API amx_tile_lazy_configure(const char palette[AMX_PALETTE_SIZE]);
 status_t DNNL_API amx_tile_release();
+// Drops the palette the calling thread remembers as loaded. Must be called
+// when a kernel issues `ldtilecfg` or `tilerelease` on its own, so that the
+// next configuration loads the palette again.
+status_t DNNL_API amx_tile_invalidate_palette_cache();
 
 } // namespace x64
 } // namespace cpu
@@ -100,6 +100,7 @@ void brgemm_kernel_execute(const brgemm_kernel_t *brg_kernel, int bs,
         brgemm_p.dynamic_LDB = dynamic_values->dynamic_LDB;
         brgemm_p.dynamic_LDC = dynamic_values->dynamic_LDC;
         brgemm_p.dynamic_LDD = dynamic_values->dynamic_LDD;
+        brgemm_p.dynamic_M = dynamic_values->dynamic_M;
     }
 
     assert(brg_kernel);
@@ -129,6 +130,7 @@ void brgemm_kernel_execute(const brgemm_kernel_t *brg_kernel, int bs,
         brgemm_p.dynamic_LDB = dynamic_values->dynamic_LDB;
         brgemm_p.dynamic_LDC = dynamic_values->dynamic_LDC;
         brgemm_p.dynamic_LDD = dynamic_values->dynamic_LDD;
+        brgemm_p.dynamic_M = dynamic_values->dynamic_M;
     }
 
     assert(brg_kernel);
@@ -170,6 +172,7 @@ void brgemm_kernel_execute_postops(const brgemm_kernel_t *brg_kernel, int bs,
         brgemm_p.dynamic_LDB = dynamic_values->dynamic_LDB;
         brgemm_p.dynamic_LDC = dynamic_values->dynamic_LDC;
         brgemm_p.dynamic_LDD = dynamic_values->dynamic_LDD;
+        brgemm_p.dynamic_M = dynamic_values->dynamic_M;
     }
 
     assert(brg_kernel);
@@ -213,6 +216,7 @@ void brgemm_kernel_execute_postops(const brgemm_kernel_t *brg_kernel, int bs,
         brgemm_p.dynamic_LDB = dynamic_values->dynamic_LDB;
         brgemm_p.dynamic_LDC = dynamic_values->dynamic_LDC;
         brgemm_p.dynamic_LDD = dynamic_values->dynamic_LDD;
+        brgemm_p.dynamic_M = dynamic_values->dynamic_M;
     }
 
     assert(brg_kernel);
@@ -252,15 +256,19 @@ status_t brgemm_desc_init(brgemm_desc_t *brg, cpu_isa_t isa,
     if (utils::one_of(true, brg->is_runtime_lda, brg->is_runtime_ldb))
         return status::unimplemented;
 
-    if (M <= 0 || N <= 0 || K <= 0) return status::invalid_arguments;
+    if (brg->is_runtime_m && brg->layout != brgemm_row_major)
+        return status::unimplemented;
+    if ((M <= 0 && !brg->is_runtime_m) || N <= 0 || K <= 0)
+        return status::invalid_arguments;
 
     // Upper bound, this can likely be improved by accounting for blocking
+    const dim_t M_bound = brg->is_runtime_m ? dim_t(brg->bcast_dim) : M;
     dim_t max_a_stride = brg->LDA * types::data_type_size(brg->dt_a)
-            * (brg->layout == brgemm_col_major ? K : M);
+            * (brg->layout == brgemm_col_major ? K : M_bound);
     dim_t max_b_stride = brg->LDB * types::data_type_size(brg->dt_b)
             * (brg->layout == brgemm_col_major ? N : K);
     dim_t max_c_stride = brg->LDC * types::data_type_size(brg->dt_c)
-            * (brg->layout == brgemm_col_major ? N : M);
+            * (brg->layout == brgemm_col_major ? N : M_bound);
 
     // Required for EVEX encoding for offsets
     const dim_t max_stride = std::numeric_limits<int32_t>::max();
@@ -566,10 +574,27 @@ status_t brgemm_desc_finalize(brgemm_desc_t *brg) {
         if ((max_vpad > min_bd_block)) return status::unimplemented;
     }
 
+    if (brg->is_runtime_m) {
+        // Runtime M is implemented as a rows loop with run-time dispatched
+        // tails in the vector kernel and does not cover features that depend
+        // on the exact number of rows.
+        const bool has_rd_tail_rows = brg->rdb_tail != 0
+                && (brg->is_bf16 || brg->is_f16 || brg->is_int8 || brg->is_fp8)
+                && brg->rdb_tail % brg->rd_step != 0;
+        if (brg->is_dgmm || brg->is_tmm || max_vpad > 0
+                || brg->brgattr.bd_mask_level > 0
+                || brg->type == brgemm_static_offs || brg->with_binary
+                || has_rd_tail_rows)
+            return status::unimplemented;
+    }
+
     return status::success;
 }
 
-status_t brgemm_kernel_create(
+namespace {
+// Allocates the kernel object matching the descriptor without generating
+// code.
+status_t brgemm_kernel_alloc(
         brgemm_kernel_t **brg_kernel, const brgemm_desc_t &brg) {
     if (!brg_kernel) return status::invalid_arguments;
     *brg_kernel = nullptr;
@@ -604,16 +629,64 @@ status_t brgemm_kernel_create(
         }
     }
     if (!(*brg_kernel)) return status::unimplemented;
+    return status::success;
+}
+} // namespace
+
+status_t brgemm_kernel_create(
+        brgemm_kernel_t **brg_kernel, const brgemm_desc_t &brg) {
+    CHECK(brgemm_kernel_alloc(brg_kernel, brg));
     status_t st = (*brg_kernel)->create_kernel();
     if (st != status::success) {
         // `brg_kernel` points to a pointer to kernel class created by `new`.
         // If kernel creation failed, release this resource before returning.
         delete *brg_kernel;
+        *brg_kernel = nullptr;
+        return st;
+    }
+    return status::success;
+}
+
+status_t brgemm_kernel_create_from_cache_blob(brgemm_kernel_t **brg_kernel,
+        const brgemm_desc_t &brg, cache_blob_t &cache_blob) {
+    // The code is only valid for the ISA it was generated for.
+    cpu_isa_t isa = isa_undef;
+    CHECK(cache_blob.get_value((uint8_t *)&isa, sizeof(isa)));
+    if (isa != brg.isa_impl) return status::invalid_arguments;
+
+    const uint8_t *binary = nullptr;
+    size_t binary_size = 0;
+    CHECK(cache_blob.get_binary(&binary, &binary_size));
+
+    CHECK(brgemm_kernel_alloc(brg_kernel, brg));
+    status_t st = (*brg_kernel)->create_kernel_from_binary(binary, binary_size);
+    if (st != status::success) {
+        delete *brg_kernel;
+        *brg_kernel = nullptr;
         return st;
     }
     return status::success;
 }
 
+status_t brgemm_kernel_get_cache_blob_size(
+        const brgemm_kernel_t *brg_kernel, size_t *size) {
+    if (!brg_kernel || !size) return status::invalid_arguments;
+    const auto *jit = brg_kernel->get_jit_generator();
+    if (!jit || !jit->is_relocatable()) return status::unimplemented;
+    *size = sizeof(cpu_isa_t) + sizeof(size_t) + jit->getSize();
+    return status::success;
+}
+
+status_t brgemm_kernel_get_cache_blob(
+        const brgemm_kernel_t *brg_kernel, cache_blob_t &cache_blob) {
+    if (!brg_kernel) return status::invalid_arguments;
+    const auto *jit = brg_kernel->get_jit_generator();
+    if (!jit || !jit->is_relocatable()) return status::unimplemented;
+    const cpu_isa_t isa = brg_kernel->get_brg().isa_impl;
+    CHECK(cache_blob.add_value((const uint8_t *)&isa, sizeof(isa)));
+    return cache_blob.add_binary(jit->jit_ker(), jit->getSize());
+}
+
 status_t brgemm_kernel_destroy(brgemm_kernel_t *brg_kernel) {
     delete brg_kernel;
     return status::success;
@@ -712,6 +785,7 @@ int brgemm_cmp(const brgemm_desc_t &lhs, const brgemm_desc_t &rhs) {
 
     // Compare all non-pointer parameters of brgemm_desc_t except derived
     CMP_BRGEMM_FIELD(bcast_dim);
+    CMP_BRGEMM_FIELD(is_runtime_m);
     CMP_BRGEMM_FIELD(load_dim);
     CMP_BRGEMM_FIELD(reduce_dim);
     CMP_BRGEMM_FIELD(LDA);
@@ -775,7 +849,9 @@ int brgemm_cmp(const brgemm_desc_t &lhs, const brgemm_desc_t &rhs) {
     CMP_BRGEMM_FIELD(brgattr.use_uker);
     CMP_BRGEMM_FIELD(brgattr.use_interleave_stores);
     CMP_BRGEMM_FIELD(brgattr.b_is_vnni);
+    CMP_BRGEMM_FIELD(brgattr.share_post_ops);
     CMP_BRGEMM_FIELD(brgattr.fpmath_mode);
+    CMP_BRGEMM_FIELD(brgattr.acc_mode);
     CMP_BRGEMM_FIELD(brgattr.LDA2);
     CMP_BRGEMM_FIELD(brgattr.LDB2);
     CMP_BRGEMM_FIELD(brgattr.LDC2_M);
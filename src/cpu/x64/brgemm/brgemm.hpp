@@ -17,6 +17,8 @@
 #ifndef CPU_X64_BRGEMM_BRGEMM_HPP
 #define CPU_X64_BRGEMM_BRGEMM_HPP
 
+#include "common/cache_blob.hpp"
+
 #include "cpu/x64/brgemm/brgemm_types.hpp"
 
 namespace dnnl {
@@ -55,6 +57,9 @@ namespace x64 {
 /// @param LDC Specifies the leading dimension of matrix C.
 ///       LDC must be at least max(1, N)
 /// @param M Specifies the number of rows of the matrix A and of the matrix C.
+///        May be DNNL_RUNTIME_DIM_VAL for the row-major layout on non-AMX
+///        ISAs. In that case the actual value is passed at execution time
+///        through `brgemm_dynamic_values_t::dynamic_M`.
 /// @param N Specifies the number of columns of the matrix B and
 ///        the number of columns of the matrix C
 /// @param K Specifies the number of columns of the matrix A and
@@ -147,6 +152,35 @@ status_t DNNL_API brgemm_desc_finalize(brgemm_desc_t *brg);
 status_t DNNL_API brgemm_kernel_create(
         brgemm_kernel_t **brg_kernel, const brgemm_desc_t &brg);
 
+/// Creates a BRGEMM kernel based on descriptor, restoring its code from a
+/// cache blob instead of generating it
+///
+/// @param brg_kernel Output BRGEMM kernel
+/// @param brg BRGEMM descriptor
+/// @param cache_blob Cache blob positioned at an entry written by
+///     `brgemm_kernel_get_cache_blob` for a kernel with the same descriptor
+///
+status_t brgemm_kernel_create_from_cache_blob(brgemm_kernel_t **brg_kernel,
+        const brgemm_desc_t &brg, cache_blob_t &cache_blob);
+
+/// Queries the size of the cache blob entry of a BRGEMM kernel
+///
+/// @param brg_kernel BRGEMM kernel
+/// @param size Output size in bytes
+/// @returns status::unimplemented if the kernel code can't be relocated
+///
+status_t brgemm_kernel_get_cache_blob_size(
+        const brgemm_kernel_t *brg_kernel, size_t *size);
+
+/// Appends the generated code of a BRGEMM kernel to a cache blob
+///
+/// @param brg_kernel BRGEMM kernel
+/// @param cache_blob Cache blob to write to
+/// @returns status::unimplemented if the kernel code can't be relocated
+///
+status_t brgemm_kernel_get_cache_blob(
+        const brgemm_kernel_t *brg_kernel, cache_blob_t &cache_blob);
+
 /// Destroys a BRGEMM kernel
 ///
 /// @param brg_kernel BRGEMM kernel
@@ -14,6 +14,16 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include "common/dnnl_thread.hpp"
+#include "common/primitive.hpp"
+#include "common/primitive_attr.hpp"
+#include "common/type_helpers.hpp"
+
 #include "cpu/x64/brgemm/brgemm_containers.hpp"
 #include "cpu/x64/brgemm/jit_brdgmm_kernel.hpp"
 
@@ -26,6 +36,154 @@ using namespace dnnl::impl::utils;
 
 namespace brgemm_containers {
 
+namespace {
+
+// brgemm_desc_t comparison skips the attributes and the destination memory
+// descriptor, which differ between primitives, so they are checked here.
+bool is_same_kernel_config(const brgemm_desc_t &lhs, const brgemm_desc_t &rhs) {
+    const auto *lhs_attr = lhs.attr(), *rhs_attr = rhs.attr();
+    if ((lhs_attr == nullptr) != (rhs_attr == nullptr)) return false;
+    if (lhs_attr && !(*lhs_attr == *rhs_attr)) return false;
+    const auto *lhs_md = lhs.dst_md(), *rhs_md = rhs.dst_md();
+    if ((lhs_md == nullptr) != (rhs_md == nullptr)) return false;
+    return !lhs_md || *lhs_md == *rhs_md;
+}
+
+constexpr size_t kernel_cache_min_sweep_size = 64;
+
+struct kernel_cache_t {
+    // Returns an alive kernel matching `brg`, or nullptr.
+    std::shared_ptr<brgemm_kernel_t> find(const brgemm_desc_t &brg) {
+        const auto range = map_.equal_range(brg);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (!is_same_kernel_config(it->first, brg)) continue;
+            auto kernel = it->second.lock();
+            if (kernel) return kernel;
+        }
+        return nullptr;
+    }
+
+    void insert(const brgemm_desc_t &brg,
+            const std::shared_ptr<brgemm_kernel_t> &kernel) {
+        map_.emplace(brg, kernel);
+        if (map_.size() < sweep_size_) return;
+        // Drop the entries of the destroyed kernels.
+        for (auto it = map_.begin(); it != map_.end();) {
+            if (it->second.expired())
+                it = map_.erase(it);
+            else
+                ++it;
+        }
+        sweep_size_ = nstl::max(kernel_cache_min_sweep_size, 2 * map_.size());
+    }
+
+    std::mutex mutex;
+
+private:
+    std::multimap<brgemm_desc_t, std::weak_ptr<brgemm_kernel_t>> map_;
+    size_t sweep_size_ = kernel_cache_min_sweep_size;
+};
+
+kernel_cache_t &kernel_cache() {
+    static kernel_cache_t cache;
+    return cache;
+}
+
+} // namespace
+
+status_t get_or_create_kernel(
+        std::shared_ptr<brgemm_kernel_t> &kernel, const brgemm_desc_t &brg) {
+    // The comparison of such descriptors dereferences the pointers, which
+    // may be destroyed together with the primitive that owns them.
+    const bool is_cacheable
+            = brg.brgattr.bd_mask_level == 0 && brg.type != brgemm_static_offs;
+
+    auto &cache = kernel_cache();
+    if (is_cacheable) {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        kernel = cache.find(brg);
+        if (kernel) return status::success;
+    }
+
+    // Generate the code without holding the lock. Another thread may have
+    // generated the same kernel meanwhile, the first one wins.
+    brgemm_kernel_t *brg_kernel = nullptr;
+    CHECK(brgemm_kernel_create(&brg_kernel, brg));
+    kernel.reset(brg_kernel);
+    if (!is_cacheable) return status::success;
+
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    auto cached = cache.find(brg);
+    if (cached)
+        kernel = cached;
+    else
+        cache.insert(brg, kernel);
+    return status::success;
+}
+
+status_t get_or_create_kernels(
+        std::vector<std::shared_ptr<brgemm_kernel_t>> &kernels,
+        const std::vector<const brgemm_desc_t *> &brgs) {
+    const dim_t nkernels = static_cast<dim_t>(brgs.size());
+    kernels.resize(nkernels);
+    std::vector<status_t> statuses(nkernels, status::success);
+    // The code size of the kernels is reported to the thread generating
+    // them, so the one reported by worker threads is forwarded to the
+    // creating thread and accounted in the primitive footprint.
+    std::vector<size_t> footprints(nkernels, 0);
+    const auto creator_id = std::this_thread::get_id();
+    parallel_nd(nkernels, [&](dim_t i) {
+        const size_t footprint_start = get_reported_primitive_footprint();
+        statuses[i] = get_or_create_kernel(kernels[i], *brgs[i]);
+        if (std::this_thread::get_id() != creator_id)
+            footprints[i]
+                    = get_reported_primitive_footprint() - footprint_start;
+    });
+    size_t footprint = 0;
+    for (const auto f : footprints)
+        footprint += f;
+    report_primitive_footprint(footprint);
+    for (const auto st : statuses)
+        CHECK(st);
+    return status::success;
+}
+
+status_t create_kernels_from_cache_blob(
+        std::vector<std::shared_ptr<brgemm_kernel_t>> &kernels,
+        const std::vector<const brgemm_desc_t *> &brgs,
+        cache_blob_t &cache_blob) {
+    // The entries are read sequentially, so the kernels are restored in
+    // order.
+    kernels.resize(brgs.size());
+    for (size_t i = 0; i < brgs.size(); i++) {
+        brgemm_kernel_t *brg_kernel = nullptr;
+        CHECK(brgemm_kernel_create_from_cache_blob(
+                &brg_kernel, *brgs[i], cache_blob));
+        kernels[i].reset(brg_kernel);
+    }
+    return status::success;
+}
+
+status_t get_kernels_cache_blob_size(
+        const std::vector<const brgemm_kernel_t *> &kernels, size_t *size) {
+    if (!size) return status::invalid_arguments;
+    *size = 0;
+    for (const auto *kernel : kernels) {
+        size_t kernel_size = 0;
+        CHECK(brgemm_kernel_get_cache_blob_size(kernel, &kernel_size));
+        *size += kernel_size;
+    }
+    return status::success;
+}
+
+status_t get_kernels_cache_blob(
+        const std::vector<const brgemm_kernel_t *> &kernels,
+        cache_blob_t &cache_blob) {
+    for (const auto *kernel : kernels)
+        CHECK(brgemm_kernel_get_cache_blob(kernel, cache_blob));
+    return status::success;
+}
+
 std::set<std::shared_ptr<brgemm_kernel_t>,
         decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *> &
 brgemm_kernel_container_t::get_set() {
@@ -108,9 +266,8 @@ status_t brgemm_kernel_container_t::insert(int idx, const brgemm_desc_t *brg) {
     // entry in kernel storage using kernel code as key
     const auto brgemm_it = brgemm_map_.find(brg);
     if (brgemm_it == brgemm_map_.end()) {
-        brgemm_kernel_t *brg_kernel = nullptr;
-        CHECK(brgemm_kernel_create(&brg_kernel, *brg));
-        std::shared_ptr<brgemm_kernel_t> sptr(brg_kernel);
+        std::shared_ptr<brgemm_kernel_t> sptr;
+        CHECK(get_or_create_kernel(sptr, *brg));
         lock_write();
         const auto kernel_ret = get_set().insert(sptr);
         refs_[idx] = kernel_ret.first->get();
@@ -123,6 +280,37 @@ status_t brgemm_kernel_container_t::insert(int idx, const brgemm_desc_t *brg) {
     return status::success;
 }
 
+status_t brgemm_kernel_container_t::insert(const std::vector<int> &idxs,
+        const std::vector<const brgemm_desc_t *> &brgs,
+        cache_blob_t cache_blob) {
+    assert(idxs.size() == brgs.size());
+    // Generate the kernels which are not in the local map yet, each unique
+    // descriptor once.
+    std::vector<const brgemm_desc_t *> new_brgs;
+    for (const auto *brg : brgs) {
+        if (brgemm_map_.count(brg)) continue;
+        if (std::find(new_brgs.begin(), new_brgs.end(), brg) != new_brgs.end())
+            continue;
+        new_brgs.push_back(brg);
+    }
+    std::vector<std::shared_ptr<brgemm_kernel_t>> kernels;
+    if (cache_blob)
+        CHECK(create_kernels_from_cache_blob(kernels, new_brgs, cache_blob));
+    else
+        CHECK(get_or_create_kernels(kernels, new_brgs));
+
+    lock_write();
+    for (size_t i = 0; i < new_brgs.size(); i++) {
+        const auto kernel_ret = get_set().insert(kernels[i]);
+        brgemm_map_.insert({new_brgs[i], kernel_ret.first->get()});
+    }
+    unlock_write();
+
+    for (size_t i = 0; i < idxs.size(); i++)
+        refs_[idxs[i]] = brgemm_map_.at(brgs[i]);
+    return status::success;
+}
+
 bool brgemm_palette_container_t::insert(int idx, const brgemm_desc_t *brg) {
     S_t kernel_palette;
     auto status = brgemm_init_tiles(*brg, kernel_palette.data());
@@ -17,6 +17,7 @@
 #ifndef CPU_X64_BRGEMM_BRGEMM_CONTAINERS_HPP
 #define CPU_X64_BRGEMM_BRGEMM_CONTAINERS_HPP
 
+#include <memory>
 #include <set>
 #include "common/rw_mutex.hpp"
 #include "cpu/x64/amx_tile_configure.hpp"
@@ -29,6 +30,36 @@ namespace x64 {
 
 namespace brgemm_containers {
 
+// Returns a kernel for `brg` from the process-wide kernel cache, generating
+// it on a miss. The cache holds weak references, so a kernel is destroyed
+// when the last primitive using it is destroyed. Descriptors referring to
+// primitive-owned data (bd_mask, static offsets) are not cached.
+status_t get_or_create_kernel(
+        std::shared_ptr<brgemm_kernel_t> &kernel, const brgemm_desc_t &brg);
+
+// Same as `get_or_create_kernel` for a set of descriptors. The code for the
+// kernels is generated in parallel on the threading runtime, as primitives
+// may need dozens of kernel variants. `kernels[i]` corresponds to `brgs[i]`.
+status_t get_or_create_kernels(
+        std::vector<std::shared_ptr<brgemm_kernel_t>> &kernels,
+        const std::vector<const brgemm_desc_t *> &brgs);
+
+// Restores the kernels for `brgs` from consecutive entries of a cache blob
+// written by `get_kernels_cache_blob` for the same descriptors. The code is
+// not generated and the kernels are not added to the kernel cache.
+status_t create_kernels_from_cache_blob(
+        std::vector<std::shared_ptr<brgemm_kernel_t>> &kernels,
+        const std::vector<const brgemm_desc_t *> &brgs,
+        cache_blob_t &cache_blob);
+
+// Query the size of and write the cache blob entries of `kernels` in order.
+// Return status::unimplemented if the code of any kernel can't be relocated.
+status_t get_kernels_cache_blob_size(
+        const std::vector<const brgemm_kernel_t *> &kernels, size_t *size);
+status_t get_kernels_cache_blob(
+        const std::vector<const brgemm_kernel_t *> &kernels,
+        cache_blob_t &cache_blob);
+
 // These containers are intended to be used as local objects in brgemm
 // primitives to ensure that references are unique and correct.
 
@@ -79,6 +110,12 @@ struct brgemm_kernel_container_t {
     }
 
     status_t insert(int idx, const brgemm_desc_t *brg);
+    // Inserts the kernels for `brgs[i]` at `idxs[i]`, the missing kernels are
+    // generated in parallel. With a cache blob they are restored from it
+    // instead, one entry per distinct descriptor in the order of `brgs`.
+    status_t insert(const std::vector<int> &idxs,
+            const std::vector<const brgemm_desc_t *> &brgs,
+            cache_blob_t cache_blob = cache_blob_t());
     static bool brgemm_kernel_cmp(const std::shared_ptr<brgemm_kernel_t> &lhs,
             const std::shared_ptr<brgemm_kernel_t> &rhs);
 
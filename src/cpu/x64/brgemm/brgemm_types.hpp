@@ -200,7 +200,16 @@ struct DNNL_API brgemm_attr_t {
     // interleave stores or not
     bool use_interleave_stores;
     impl::fpmath_mode_t fpmath_mode = fpmath_mode::strict;
+    // Value of acc_mode other than `strict` allows the kernel to keep f16 sums
+    // in f16 within a single call. See `brgemm_desc_t::is_f16_acc()`.
+    impl::accumulation_mode_t acc_mode = accumulation_mode::strict;
     bool b_is_vnni {false};
+    // If "true" then the post-ops chain is generated once per store variant
+    // as a subroutine shared by all the places that store the accumulators
+    // with post-ops. It reduces the kernel code size when the same variant is
+    // stored several times, e.g. with virtual padding or skip accumulation.
+    // Supported by brgemm kernel for non-AMX isa only.
+    bool share_post_ops {false};
     // Second level leading dimension describing distance between 16-line
     // blocks in case of blocked layout. Used to calculate address of next
     // bd block. By default are equal to regular leading dimension parameters
@@ -344,6 +353,10 @@ struct brgemm_desc_t {
     bool is_runtime_ldb = false;
     bool is_runtime_ldc = false;
     bool is_runtime_ldd = false;
+    // The number of rows (M) is passed at execution time through
+    // `brgemm_dynamic_values_t`. `bcast_dim` keeps a nominal value used only
+    // to select blocking.
+    bool is_runtime_m = false;
 
     static constexpr int MAX_VPAD = 100;
     static constexpr int AMX_TILES_NUM = 8;
@@ -514,6 +527,17 @@ struct brgemm_desc_t {
                 && isa == avx512_core_fp16;
     }
 
+    // Indicates that f16 products are accumulated natively in f16. Each f16
+    // accumulator holds two adjacent ld blocks and is up-converted to f32
+    // right before the accumulators are stored.
+    bool is_f16_acc() const {
+        return utils::one_of(brgattr.acc_mode, accumulation_mode::f16,
+                       accumulation_mode::relaxed, accumulation_mode::any)
+                && utils::everyone_is(data_type::f16, dt_a, dt_b)
+                && isa_impl == avx512_core_fp16 && is_zmm
+                && !is_f16_b_non_amx_vnni() && !n_bcast_1_load && !embd_bcst;
+    }
+
     bool reduce_by_words() const {
         return is_bf16_tmm || is_f16_tmm || is_input_convert();
     }
@@ -556,11 +580,14 @@ struct brgemm_dynamic_values_t {
     dim_t dynamic_LDB = 0;
     dim_t dynamic_LDC = 0;
     dim_t dynamic_LDD = 0;
-    brgemm_dynamic_values_t(dim_t LDA, dim_t LDB, dim_t LDC, dim_t LDD)
+    dim_t dynamic_M = 0;
+    brgemm_dynamic_values_t(
+            dim_t LDA, dim_t LDB, dim_t LDC, dim_t LDD, dim_t M = 0)
         : dynamic_LDA(LDA)
         , dynamic_LDB(LDB)
         , dynamic_LDC(LDC)
-        , dynamic_LDD(LDD) {}
+        , dynamic_LDD(LDD)
+        , dynamic_M(M) {}
 };
 
 struct brgemm_kernel_params_t {
@@ -606,6 +633,7 @@ struct brgemm_kernel_params_t {
     dim_t dynamic_LDB = 0;
     dim_t dynamic_LDC = 0;
     dim_t dynamic_LDD = 0;
+    dim_t dynamic_M = 0;
 };
 
 template <typename Vmm>
@@ -619,6 +647,11 @@ struct brgemm_kernel_t {
     brgemm_kernel_t() = default;
     virtual ~brgemm_kernel_t() = default;
     virtual status_t create_kernel() = 0;
+    // Restores the kernel from code serialized by an identical kernel.
+    virtual status_t create_kernel_from_binary(
+            const uint8_t *binary, size_t binary_size) {
+        return status::unimplemented;
+    }
     virtual void operator()(brgemm_kernel_params_t *) const = 0;
     virtual const jit_generator_t *get_jit_generator() const = 0;
     virtual const brgemm_desc_t &get_brg() const = 0;
@@ -636,6 +669,8 @@ struct brgemm_kernel_common_t : public brgemm_kernel_t {
     ~brgemm_kernel_common_t() override;
 
     status_t create_kernel() override;
+    status_t create_kernel_from_binary(
+            const uint8_t *binary, size_t binary_size) override;
     void operator()(brgemm_kernel_params_t *) const override;
     const jit_generator_t *get_jit_generator() const override;
     const brgemm_desc_t &get_brg() const override {
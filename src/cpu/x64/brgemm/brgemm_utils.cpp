@@ -39,6 +39,9 @@ enum {
     undefined,
 };
 
+// A number of rows used to select blocking when M is a runtime value.
+constexpr int runtime_m_nominal_bcast_dim = 1024;
+
 impl::data_type_t get_accum_datatype(brgemm_desc_t *brg) {
     // this assert should check if 'init_kernel_datatype()' was previously
     // called.
@@ -101,7 +104,8 @@ bool can_dispatch_uker(const brgemm_desc_t *brg) {
             && one_of(brg->type, brgemm_addr, brgemm_offs, brgemm_static_offs)
             && brg->brgattr.use_uker
             && everyone_is(false, brg->is_runtime_lda, brg->is_runtime_ldb,
-                    brg->is_runtime_ldc, brg->is_runtime_ldd);
+                    brg->is_runtime_ldc, brg->is_runtime_ldd,
+                    brg->is_runtime_m);
 }
 
 void maybe_try_bf32(brgemm_desc_t *brg) {
@@ -128,7 +132,9 @@ void set_isa_impl(brgemm_desc_t *brg) {
         return mayiuse(isa) &&
                 // maybe IMPLICATION(brg->isa_user != isa_undef,
                 //  is_superset(brg->isa_user, isa)), but the API is not clear.
-                one_of(brg->isa_user, isa_undef, isa);
+                one_of(brg->isa_user, isa_undef, isa)
+                // AMX kernels configure tiles for a fixed number of rows.
+                && IMPLICATION(brg->is_runtime_m, !is_superset(isa, amx_tile));
     };
 
     if (brg->is_tf32) {
@@ -730,7 +736,11 @@ status_t brgemm_blocking_vmm(brgemm_desc_t *brg) {
 
     float best_bd_block_eff = 0.f;
     brg->bd_block = max_bcast_block;
-    for (int bd_block = max_bcast_block; bd_block >= min_block; bd_block--) {
+    // The actual number of rows is not known for runtime M, so the largest
+    // block is used and tails are handled by the kernel at run time.
+    const int min_bd_block = brg->is_runtime_m ? max_bcast_block : min_block;
+    for (int bd_block = max_bcast_block; bd_block >= min_bd_block;
+            bd_block--) {
         const auto bd_block_disb = static_cast<float>(brg->bcast_dim)
                 / rnd_up(brg->bcast_dim, bd_block);
         const auto brgemm_microkernel_eff
@@ -917,6 +927,7 @@ status_t init_brgemm_conf(brgemm_desc_t *brg, cpu_isa_t isa,
     brg->typesize_D = types::data_type_size(brg->dt_d);
 
     brg->isa_user = isa;
+    brg->is_runtime_m = is_runtime_value(M);
 
     brg->is_tf32 = is_tf32
             && utils::one_of(brg->isa_user, isa_undef, avx10_2_512_amx_2)
@@ -955,6 +966,7 @@ status_t init_brgemm_conf(brgemm_desc_t *brg, cpu_isa_t isa,
 
     brg->bcast_dim
             = (brg->is_row_major()) ? static_cast<int>(M) : static_cast<int>(N);
+    if (brg->is_runtime_m) brg->bcast_dim = runtime_m_nominal_bcast_dim;
     brg->load_dim
             = (brg->is_row_major()) ? static_cast<int>(N) : static_cast<int>(M);
     brg->reduce_dim = static_cast<int>(K);
@@ -97,6 +97,7 @@ struct jit_brgemm_amx_uker_base_t : public jit_base_brgemm_kernel_t {
             eltwise_injector::static_params_t esp;
             esp.preserve_vmm = preserve_vmm;
             esp.preserve_p_table = false;
+            esp.fpmath_mode = brg.brgattr.fpmath_mode;
 
             auto st = safe_ptr_assign(postops_injector_,
                     po_injector_t::create(this, brg.isa_impl,
@@ -13,7 +13,9 @@
 * See the License for the specific language governing permissions and
 * limitations under the License.
 *******************************************************************************/
+#include <map>
 #include <memory>
+#include <tuple>
 #include <vector>
 
 #include "common/c_types_map.hpp"
@@ -109,9 +111,12 @@ struct jit_brgemm_kernel_t : public jit_base_brgemm_kernel_t {
                     binary_injector::get_all_strategies_supported_by_injector(),
                     rhs_sp, f8_e5m2_cvt_.get(), f8_e4m3_cvt_.get()};
 
+            eltwise_injector::static_params_t esp;
+            esp.fpmath_mode = brg.brgattr.fpmath_mode;
+
             auto st = safe_ptr_assign(postops_injector_,
-                    po_injector_t::create(
-                            this, brg.isa_impl, brg.attr()->post_ops_, bsp));
+                    po_injector_t::create(this, brg.isa_impl,
+                            brg.attr()->post_ops_, bsp, esp));
             if (st != status::success) {
                 assert(!"postops_injector creation failed");
             }
@@ -131,6 +136,15 @@ struct jit_brgemm_kernel_t : public jit_base_brgemm_kernel_t {
 
     const brgemm_desc_t &get_brg() const override { return brg; }
 
+    // AMX tile configuration, fp8/bf16 emulation, f16 permutation tables, sum
+    // scale/zero-point pointers and post-op injectors may embed absolute
+    // addresses into the generated code.
+    bool is_relocatable() const override {
+        return !brg.is_tmm && !brg.is_fp8 && !brg.is_bf16_emu
+                && !brg.is_f16_b_non_amx_vnni() && !brg.with_eltwise
+                && !brg.with_binary && !brg.with_sum;
+    }
+
 private:
     brgemm_desc_t brg;
 
@@ -273,10 +287,15 @@ private:
     // these are used for FP8 as temporary push/pop spaces
     constexpr static int reg_val_tmp_1_ = 256;
     constexpr static int reg_val_tmp_2_ = 264;
-    constexpr static int stack_space_needed_ = 272;
+    constexpr static int reg_M_offs_ = 272;
+    constexpr static int reg_post_ops_ret_offs_ = 280;
+    constexpr static int stack_space_needed_ = 288;
 
     bool is_ldb_loop_ = false;
     bool with_binary_non_scalar_bcast_ = false;
+    // Entry points of the post-ops subroutines keyed by
+    // (bd_block, ld_block2, is_ld_tail), see brgattr.share_post_ops.
+    std::map<std::tuple<dim_t, dim_t, bool>, Xbyak::Label> post_ops_subs_;
     const int max_effective_vregs;
 
     Xbyak::Opmask ld_full_mask = Xbyak::Opmask(2);
@@ -296,6 +315,11 @@ private:
         return isa_num_vregs(brg.isa_impl) - used_vregs;
     }
 
+    // f16 accumulation is used for full pairs of ld blocks only.
+    bool use_f16_acc(dim_t ld_block2, bool is_ld_tail) const {
+        return brg.is_f16_acc() && !is_ld_tail && ld_block2 % 2 == 0;
+    }
+
     Vmm accm(dim_t ld_block, dim_t bd, dim_t ld) {
         return Vmm(max_effective_vregs - 1 - (bd * ld_block + ld));
     }
@@ -420,6 +444,9 @@ private:
             dim_t bd_block, dim_t ld_block, bool is_ld_tail);
     void store_accumulators_apply_post_ops(dim_t bd_block, dim_t ld_block,
             dim_t ldb_and_bdb_offset, bool is_ld_tail);
+    void call_post_ops_subroutine(
+            dim_t bd_block, dim_t ld_block2, bool is_ld_tail);
+    void generate_post_ops_subroutines();
     void apply_compensation(dim_t bd_block, dim_t ld_block, bool is_ld_tail);
     void apply_alpha_beta(dim_t bd_block, dim_t ld_block, bool is_ld_tail);
     void apply_post_ops(dim_t bd_block, dim_t ld_block2,
@@ -971,6 +998,11 @@ void jit_brgemm_kernel_t<Wmm>::read_params() {
         mov(ptr[rsp + reg_C_shift_bytes_offs_], reg_tmp_read_values);
     }
 
+    if (brg.is_runtime_m) {
+        mov(reg_tmp_read_values, ptr[param1 + GET_OFF(dynamic_M)]);
+        mov(ptr[rsp + reg_M_offs_], reg_tmp_read_values);
+    }
+
     if (brg.is_runtime_ldd) {
         mov(reg_tmp_read_values, ptr[param1 + GET_OFF(dynamic_LDD)]);
         if (brg.typesize_D > 1) shl(reg_tmp_read_values, (brg.typesize_D >> 1));
@@ -1810,6 +1842,19 @@ void jit_brgemm_kernel_t<Wmm>::store_accumulators(dim_t bd_block2,
     } else {
         dim_t bd_block = (is_bdb_tail) ? brg.bdb_tail : brg.bd_block;
 
+        // Up-convert the f16 sums, the upper half of an accumulator belongs
+        // to the next ld block.
+        if (use_f16_acc(ld_block2, is_ld_tail)) {
+            for_(dim_t bd = 0; bd < bd_block; bd++)
+            for (dim_t ld = 0; ld < ld_block2; ld += 2) {
+                const Zmm zmm(accm(ld_block2, bd, ld).getIdx());
+                const Zmm zmm_hi(accm(ld_block2, bd, ld + 1).getIdx());
+                vextractf64x4(Ymm(zmm_hi.getIdx()), zmm, 1);
+                vcvtph2psx(zmm_hi, Ymm(zmm_hi.getIdx()));
+                vcvtph2psx(zmm, Ymm(zmm.getIdx()));
+            }
+        }
+
         if (need_generate_zp_a_compensation) {
             Label label_store_without_comp;
             mov(reg_do_comp, ptr[rsp + reg_do_comp_offs_]);
@@ -1829,8 +1874,11 @@ void jit_brgemm_kernel_t<Wmm>::store_accumulators(dim_t bd_block2,
             mov(reg_do_post_ops, ptr[rsp + reg_do_post_ops_offs_]);
             cmp(reg_do_post_ops, 0);
             jz(label_store_without_post_ops, T_NEAR);
-            store_accumulators_apply_post_ops(
-                    bd_block, ld_block2, 0, is_ld_tail);
+            if (brg.brgattr.share_post_ops)
+                call_post_ops_subroutine(bd_block, ld_block2, is_ld_tail);
+            else
+                store_accumulators_apply_post_ops(
+                        bd_block, ld_block2, 0, is_ld_tail);
             jmp(label_done, T_NEAR);
 
             L_aligned(label_store_without_post_ops);
@@ -1840,6 +1888,34 @@ void jit_brgemm_kernel_t<Wmm>::store_accumulators(dim_t bd_block2,
     }
 }
 
+// The post-ops subroutines are entered and left with jumps, so `rsp` stays
+// the same as at the call site and all stack offsets remain valid. The return
+// address is kept in the kernel stack frame.
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::call_post_ops_subroutine(
+        dim_t bd_block, dim_t ld_block2, bool is_ld_tail) {
+    const auto &sub = post_ops_subs_[std::make_tuple(
+            bd_block, ld_block2, is_ld_tail)];
+    Label return_label;
+    lea(reg_tmp_gpr, ptr[rip + return_label]);
+    mov(ptr[rsp + reg_post_ops_ret_offs_], reg_tmp_gpr);
+    jmp(sub, T_NEAR);
+    L(return_label);
+}
+
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::generate_post_ops_subroutines() {
+    for (auto &sub : post_ops_subs_) {
+        dim_t bd_block, ld_block2;
+        bool is_ld_tail;
+        std::tie(bd_block, ld_block2, is_ld_tail) = sub.first;
+        align(16);
+        L(sub.second);
+        store_accumulators_apply_post_ops(bd_block, ld_block2, 0, is_ld_tail);
+        jmp(ptr[rsp + reg_post_ops_ret_offs_]);
+    }
+}
+
 template <typename Wmm>
 void jit_brgemm_kernel_t<Wmm>::restore_A_B_matrices() {
     auto restore_reg_batch = brg.brgattr.max_bs > 1 || vpad_exist;
@@ -2267,6 +2343,24 @@ void jit_brgemm_kernel_t<Wmm>::gemm_microkernel(dim_t bd_block2,
     } else
         rd_loop = brg.rd_block;
 
+    if (use_f16_acc(ld_block2, is_ld_tail)) {
+        // One f16 vector of B covers two adjacent ld blocks, the sums are
+        // kept in the accumulator of the even block.
+        for (dim_t rd = 0; rd < rd_loop; rd++) {
+            for (dim_t ld = 0; ld < ld_block2; ld += 2)
+                vmovups(Zmm(load(ld).getIdx()),
+                        ptr[reg_aux_B + B_offset(ld, rd)]);
+            for (dim_t bd = bd_b; bd < bd_e; bd++) {
+                const Zmm zmm_bcast(bcst().getIdx());
+                vpbroadcastw(zmm_bcast, ptr[reg_aux_A + A_offset(bd, rd)]);
+                for (dim_t ld = 0; ld < ld_block2; ld += 2)
+                    vfmadd231ph(Zmm(accm(ld_block2, bd, ld).getIdx()),
+                            Zmm(load(ld).getIdx()), zmm_bcast);
+            }
+        }
+        return;
+    }
+
     if (brg.req_s8s8_compensation) {
         mov(ptr[rsp + reg_bdb_loop_offs_], reg_bdb_loop);
         mov(reg_s8_input_shift, 128);
@@ -2738,7 +2832,41 @@ void jit_brgemm_kernel_t<Wmm>::bdb_loop() {
                         brg.bd_block);
     }
 
+    // With runtime M the number of rows comes from the kernel parameters:
+    // full bd blocks are processed in a loop and the remaining rows are
+    // dispatched to one of the tail bodies generated for every tail size.
+    auto bdb_loop_runtime_m = [&](bool skip_accumulation) {
+        Label bdb_loop_label, bdb_tail_label, bdb_loop_end_label;
+        mov(reg_bdb_loop, ptr[rsp + reg_M_offs_]);
+        cmp(reg_bdb_loop, brg.bd_block);
+        jl(bdb_tail_label, T_NEAR);
+        L_aligned(bdb_loop_label, 64);
+        {
+            bdb_loop_body(1, false, false, false, 0, skip_accumulation);
+            sub(reg_bdb_loop, brg.bd_block);
+            cmp(reg_bdb_loop, brg.bd_block);
+            jge(bdb_loop_label, T_NEAR);
+        }
+        L(bdb_tail_label);
+        const auto bdb_tail = brg.bdb_tail;
+        for (int tail = 1; tail < brg.bd_block; tail++) {
+            Label next_tail_label;
+            cmp(reg_bdb_loop, tail);
+            jne(next_tail_label, T_NEAR);
+            brg.bdb_tail = tail;
+            do_ldb_loop(1, true, false, false, 0, skip_accumulation);
+            jmp(bdb_loop_end_label, T_NEAR);
+            L(next_tail_label);
+        }
+        brg.bdb_tail = bdb_tail;
+        L_aligned(bdb_loop_end_label, 64);
+    };
+
     auto bdb_loop_avx512 = [&](bool skip_accumulation) {
+        if (brg.is_runtime_m) {
+            bdb_loop_runtime_m(skip_accumulation);
+            return;
+        }
         Label bdb_loop_end_label, no_vpad_label;
         if (vpad_exist) {
             // max_top_vp is restricted by bd_block due to
@@ -2965,6 +3093,8 @@ void jit_brgemm_kernel_t<Wmm>::generate() {
 
     postamble();
 
+    generate_post_ops_subroutines();
+
     align(32);
     const dim_t simd = vreg_traits_t<Vmm>::vlen / sizeof(float);
     if (!isa_has_masks(brg.isa_impl) && brg.ldb_tail > 0) {
@@ -3045,6 +3175,14 @@ status_t brgemm_kernel_common_t<Wmm>::create_kernel() {
     return status::out_of_memory;
 }
 
+template <typename Wmm>
+status_t brgemm_kernel_common_t<Wmm>::create_kernel_from_binary(
+        const uint8_t *binary, size_t binary_size) {
+    if (brgemm_kernel_)
+        return brgemm_kernel_->create_kernel_from_binary(binary, binary_size);
+    return status::out_of_memory;
+}
+
 template <typename Wmm>
 void brgemm_kernel_common_t<Wmm>::operator()(
         brgemm_kernel_params_t *params) const {
@@ -0,0 +1,466 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <cstring>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/brgemm_sdpa.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::memory_tracking::names;
+
+namespace {
+// Sizes picked to keep the per-thread working set (packed Q/K/V blocks, the
+// score block and the output accumulator) within L2 for typical head sizes.
+constexpr dim_t default_q_blk = 32;
+constexpr dim_t default_k_blk = 128;
+
+bool is_supported_dt(data_type_t dt) {
+    return one_of(dt, f32, bf16, f16);
+}
+
+// Copies a `rows` x `cols` block of a strided tensor into a dense f32 buffer
+// with leading dimension `ld`, converting from `dt` on the fly.
+void pack_block(float *dst, dim_t ld, const void *src, data_type_t dt,
+        dim_t rows, dim_t cols, dim_t row_stride, dim_t col_stride) {
+    if (dt == f32 && col_stride == 1) {
+        const float *src_f32 = static_cast<const float *>(src);
+        for (dim_t r = 0; r < rows; r++)
+            std::memcpy(dst + r * ld, src_f32 + r * row_stride,
+                    cols * sizeof(float));
+        return;
+    }
+    for_(dim_t r = 0; r < rows; r++)
+    for (dim_t c = 0; c < cols; c++)
+        dst[r * ld + c] = io::load_float_value(
+                dt, src, r * row_stride + c * col_stride);
+}
+} // namespace
+
+status_t brgemm_sdpa_t::pd_t::init(engine_t *engine) {
+    const auto q_dt = qry_md()->data_type;
+    const auto k_dt = key_md()->data_type;
+    const auto v_dt = val_md()->data_type;
+    const auto dst_dt = dst_md()->data_type;
+
+    VDISPATCH_SDPA(desc()->prop_kind == prop_kind::forward_inference,
+            VERBOSE_BAD_PROPKIND);
+    VDISPATCH_SDPA(!with_score_mods(), VERBOSE_UNSUPPORTED_FEATURE,
+            "score modifiers");
+    VDISPATCH_SDPA(
+            is_supported_dt(q_dt) && is_supported_dt(k_dt)
+                    && is_supported_dt(v_dt) && is_supported_dt(dst_dt),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_SDPA(!with_attn_mask()
+                    || is_supported_dt(attn_mask_md()->data_type),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_SDPA(!with_attn_scale() || is_supported_dt(desc()->scale_dt),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_SDPA(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_SDPA(!with_key_scales() && !with_value_scales()
+                    && !with_key_zp() && !with_value_zp(),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_SDPA(one_of(desc()->softmax_alg, alg_kind::softmax_accurate,
+                           alg_kind::softmax_accurate_inf_as_zero),
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_SDPA(everyone_is(4, qry_md()->ndims, key_md()->ndims,
+                           val_md()->ndims, dst_md()->ndims),
+            VERBOSE_BAD_NDIMS, "sdpa", qry_md()->ndims);
+    VDISPATCH_SDPA(!with_attn_mask() || attn_mask_md()->ndims == 4,
+            VERBOSE_BAD_NDIMS, "mask", attn_mask_md()->ndims);
+    VDISPATCH_SDPA(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+
+    for (const auto *md : {qry_md(), key_md(), val_md(), dst_md()}) {
+        const memory_desc_wrapper mdw(md);
+        VDISPATCH_SDPA(!mdw.has_runtime_dims_or_strides(),
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        VDISPATCH_SDPA(mdw.is_plain(), VERBOSE_UNSUPPORTED_TAG);
+    }
+    if (with_attn_mask()) {
+        const memory_desc_wrapper mdw(attn_mask_md());
+        VDISPATCH_SDPA(!mdw.has_runtime_dims_or_strides(),
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        VDISPATCH_SDPA(mdw.is_plain(), VERBOSE_UNSUPPORTED_TAG);
+    }
+
+    CHECK(init_conf(engine));
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    return status::success;
+}
+
+status_t brgemm_sdpa_t::pd_t::init_conf(engine_t *engine) {
+    auto &conf = conf_;
+    const auto *q = qry_md();
+    const auto *k = key_md();
+    const auto *v = val_md();
+    const auto *dst = dst_md();
+
+    conf.isa = mayiuse(avx512_core) ? avx512_core
+            : mayiuse(avx2)         ? avx2
+                                    : isa_undef;
+    VDISPATCH_SDPA(conf.isa != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+
+    conf.mb = dst->dims[0];
+    conf.nheads = dst->dims[1];
+    conf.kv_nheads = k->dims[1];
+    conf.nqueries = desc()->queries();
+    conf.nkeys = desc()->keys();
+    conf.head_size = desc()->head_size();
+    conf.val_head_size = desc()->values();
+
+    VDISPATCH_SDPA(q->dims[0] == conf.mb && q->dims[1] == conf.nheads,
+            VERBOSE_INCONSISTENT_DIM, "q", 0, "dst", 0);
+    VDISPATCH_SDPA(v->dims[1] == conf.kv_nheads, VERBOSE_INCONSISTENT_DIM,
+            "k", 1, "v", 1);
+    // Keys and values may be shared across query heads (GQA/MQA) and
+    // broadcast across the batch.
+    VDISPATCH_SDPA(conf.kv_nheads > 0 && conf.nheads % conf.kv_nheads == 0,
+            VERBOSE_INCONSISTENT_DIM, "q", 1, "k", 1);
+    for (const auto *md : {k, v})
+        VDISPATCH_SDPA(one_of(md->dims[0], 1, conf.mb),
+                VERBOSE_INVALID_BROADCAST, "kv", 0);
+    if (with_attn_mask()) {
+        const auto *msk = attn_mask_md();
+        const dim_t full_dims[4] = {conf.mb, conf.nheads, conf.nqueries,
+                conf.nkeys};
+        for (int d = 0; d < 4; d++)
+            VDISPATCH_SDPA(one_of(msk->dims[d], 1, full_dims[d]),
+                    VERBOSE_INVALID_BROADCAST, "mask", d);
+    }
+
+    conf.q_blk = nstl::min(conf.nqueries, default_q_blk);
+    conf.q_tail = conf.nqueries % conf.q_blk;
+    conf.nb_q = div_up(conf.nqueries, conf.q_blk);
+    conf.k_blk = nstl::min(conf.nkeys, default_k_blk);
+    conf.k_tail = conf.nkeys % conf.k_blk;
+
+    // Keep every buffer cache-line aligned.
+    const auto aligned = [](dim_t nelems) { return rnd_up(nelems, 16); };
+    const dim_t D = conf.head_size, Dv = conf.val_head_size;
+    conf.q_buf_off = 0;
+    conf.k_buf_off = conf.q_buf_off + aligned(conf.q_blk * D);
+    conf.v_buf_off = conf.k_buf_off + aligned(D * conf.k_blk);
+    conf.s_buf_off = conf.v_buf_off + aligned(conf.k_blk * Dv);
+    conf.o_buf_off = conf.s_buf_off + aligned(conf.q_blk * conf.k_blk);
+    conf.ml_buf_off = conf.o_buf_off + aligned(conf.q_blk * Dv);
+    conf.per_thr_buf_sz = conf.ml_buf_off + aligned(2 * conf.q_blk);
+
+    conf.nthr = dnnl_get_max_threads();
+
+    return status::success;
+}
+
+status_t brgemm_sdpa_t::pd_t::init_brgemm_descs() {
+    const auto &conf = conf_;
+    const dim_t D = conf.head_size, Dv = conf.val_head_size;
+
+    brg_descs_.resize(8);
+    for_(bool q_tail : {false, true})
+    for (bool k_tail : {false, true}) {
+        const dim_t M = q_tail ? conf.q_tail : conf.q_blk;
+        const dim_t KB = k_tail ? conf.k_tail : conf.k_blk;
+        if (M == 0 || KB == 0) continue;
+
+        brgemm_attr_t brg_attr;
+        brg_attr.max_bs = 1;
+
+        // S = Q * K: [M x D] * [D x KB], overwrites the score block.
+        auto &brg_qk = brg_descs_[brg_idx(false, q_tail, k_tail)];
+        CHECK(brgemm_desc_init(&brg_qk, conf.isa, brgemm_addr, f32, f32,
+                false, false, brgemm_row_major, 1.f, 0.f, D, conf.k_blk,
+                conf.k_blk, M, KB, D));
+        CHECK(brgemm_desc_set_attr(&brg_qk, brg_attr));
+        CHECK(brgemm_desc_finalize(&brg_qk));
+
+        // O += P * V: [M x KB] * [KB x Dv], accumulates into the output.
+        auto &brg_pv = brg_descs_[brg_idx(true, q_tail, k_tail)];
+        CHECK(brgemm_desc_init(&brg_pv, conf.isa, brgemm_addr, f32, f32,
+                false, false, brgemm_row_major, 1.f, 1.f, conf.k_blk, Dv, Dv,
+                M, Dv, KB));
+        CHECK(brgemm_desc_set_attr(&brg_pv, brg_attr));
+        CHECK(brgemm_desc_finalize(&brg_pv));
+    }
+
+    return status::success;
+}
+
+void brgemm_sdpa_t::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book<float>(
+            key_brgemm_primitive_buffer, conf_.nthr * conf_.per_thr_buf_sz);
+}
+
+status_t brgemm_sdpa_t::init(engine_t *engine) {
+    const auto &descs = pd()->brg_descs_;
+    brg_kernels_.resize(descs.size());
+
+    auto blob = cache_blob();
+    for (size_t idx = 0; idx < descs.size(); ++idx) {
+        const auto &brg = descs[idx];
+        if (brg.bcast_dim * brg.load_dim == 0) continue;
+        brgemm_kernel_t *brg_kernel = nullptr;
+        if (blob)
+            CHECK(brgemm_kernel_create_from_cache_blob(
+                    &brg_kernel, brg, blob));
+        else
+            CHECK(brgemm_kernel_create(&brg_kernel, brg));
+        CHECK(safe_ptr_assign(brg_kernels_[idx], brg_kernel));
+    }
+
+    return status::success;
+}
+
+status_t brgemm_sdpa_t::get_cache_blob_size(
+        engine_t *engine, size_t *size) const {
+    if (!size) return status::invalid_arguments;
+    *size = 0;
+    for (const auto &brg_kernel : brg_kernels_) {
+        if (!brg_kernel) continue;
+        size_t kernel_size = 0;
+        CHECK(brgemm_kernel_get_cache_blob_size(
+                brg_kernel.get(), &kernel_size));
+        *size += kernel_size;
+    }
+    return status::success;
+}
+
+status_t brgemm_sdpa_t::get_cache_blob(
+        engine_t *engine, cache_blob_t &cache_blob) const {
+    // Kernels are stored in the order they are created in `init()`.
+    for (const auto &brg_kernel : brg_kernels_) {
+        if (!brg_kernel) continue;
+        CHECK(brgemm_kernel_get_cache_blob(brg_kernel.get(), cache_blob));
+    }
+    return status::success;
+}
+
+status_t brgemm_sdpa_t::execute(const exec_ctx_t &ctx) const {
+    const auto q_ptr = CTX_IN_MEM(const char *, DNNL_ARG_QUERIES);
+    const auto k_ptr = CTX_IN_MEM(const char *, DNNL_ARG_KEYS);
+    const auto v_ptr = CTX_IN_MEM(const char *, DNNL_ARG_VALUES);
+    const auto msk_ptr = CTX_IN_MEM(const char *, DNNL_ARG_ATTN_MASK);
+    const auto scale_ptr = CTX_IN_MEM(const void *, DNNL_ARG_SCALE);
+    auto dst_ptr = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const auto &conf = pd()->conf_;
+    const auto *d = pd()->desc();
+
+    const memory_desc_wrapper q_d(pd()->qry_md());
+    const memory_desc_wrapper k_d(pd()->key_md());
+    const memory_desc_wrapper v_d(pd()->val_md());
+    const memory_desc_wrapper msk_d(pd()->attn_mask_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const bool with_mask = pd()->with_attn_mask();
+    const bool with_causal_mask = pd()->with_causal_mask();
+    const bool inf_as_zero
+            = d->softmax_alg == alg_kind::softmax_accurate_inf_as_zero;
+
+    float scale = 1.f;
+    if (pd()->with_attn_scale()) {
+        scale = io::load_float_value(d->scale_dt, scale_ptr, 0);
+        if (d->invert_scale) scale = 1.f / scale;
+    }
+
+    // For a bottom-right aligned causal mask the diagonal is shifted so the
+    // last query attends to the last key.
+    const dim_t causal_shift = d->mask_type == attn_mask_type::bottom_right
+            ? conf.nkeys - conf.nqueries
+            : 0;
+
+    const dim_t D = conf.head_size, Dv = conf.val_head_size;
+    const dim_t kv_group = conf.nheads / conf.kv_nheads;
+    const auto &q_str = q_d.blocking_desc().strides;
+    const auto &k_str = k_d.blocking_desc().strides;
+    const auto &v_str = v_d.blocking_desc().strides;
+    const auto &dst_str = dst_d.blocking_desc().strides;
+    const size_t q_dsz = types::data_type_size(q_d.data_type());
+    const size_t k_dsz = types::data_type_size(k_d.data_type());
+    const size_t v_dsz = types::data_type_size(v_d.data_type());
+    const size_t dst_dsz = types::data_type_size(dst_d.data_type());
+    // Broadcast mask dimensions do not advance along keys.
+    const dim_t msk_k_stride = with_mask && msk_d.dims()[3] != 1
+            ? msk_d.blocking_desc().strides[3]
+            : 0;
+
+    float *buf_base = ctx.get_scratchpad_grantor().template get<float>(
+            key_brgemm_primitive_buffer);
+
+    const dim_t work_amount = conf.mb * conf.nheads * conf.nb_q;
+
+    parallel(conf.nthr, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        float *buf = buf_base + ithr * conf.per_thr_buf_sz;
+        float *q_buf = buf + conf.q_buf_off;
+        float *k_buf = buf + conf.k_buf_off;
+        float *v_buf = buf + conf.v_buf_off;
+        float *s_buf = buf + conf.s_buf_off;
+        float *o_buf = buf + conf.o_buf_off;
+        float *row_max = buf + conf.ml_buf_off;
+        float *row_sum = row_max + conf.q_blk;
+
+        brgemm_batch_element_t batch;
+
+        dim_t mb {0}, h {0}, qb {0};
+        nd_iterator_init(start, mb, conf.mb, h, conf.nheads, qb, conf.nb_q);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            const dim_t q_start = qb * conf.q_blk;
+            const dim_t q_len = nstl::min(conf.q_blk, conf.nqueries - q_start);
+            const bool is_q_tail = q_len < conf.q_blk;
+
+            const dim_t k_mb = k_d.dims()[0] == 1 ? 0 : mb;
+            const dim_t v_mb = v_d.dims()[0] == 1 ? 0 : mb;
+            const dim_t kv_h = h / kv_group;
+
+            pack_block(q_buf, D, q_ptr + q_dsz * q_d.blk_off(mb, h, q_start, 0),
+                    q_d.data_type(), q_len, D, q_str[2], q_str[3]);
+
+            for (dim_t i = 0; i < q_len; i++) {
+                row_max[i] = -INFINITY;
+                row_sum[i] = 0.f;
+            }
+            std::memset(o_buf, 0, sizeof(float) * q_len * Dv);
+
+            // With a causal mask, key blocks past the diagonal of the last
+            // query in the block contribute nothing and are skipped.
+            const dim_t k_end = with_causal_mask
+                    ? nstl::max(dim_t(0),
+                            nstl::min(conf.nkeys,
+                                    q_start + q_len + causal_shift))
+                    : conf.nkeys;
+
+            for (dim_t k_start = 0; k_start < k_end; k_start += conf.k_blk) {
+                const dim_t k_len
+                        = nstl::min(conf.k_blk, conf.nkeys - k_start);
+                const bool is_k_tail = k_len < conf.k_blk;
+
+                pack_block(k_buf, conf.k_blk,
+                        k_ptr + k_dsz * k_d.blk_off(k_mb, kv_h, 0, k_start),
+                        k_d.data_type(), D, k_len, k_str[2], k_str[3]);
+                pack_block(v_buf, Dv,
+                        v_ptr + v_dsz * v_d.blk_off(v_mb, kv_h, k_start, 0),
+                        v_d.data_type(), k_len, Dv, v_str[2], v_str[3]);
+
+                batch.ptr.A = q_buf;
+                batch.ptr.B = k_buf;
+                brgemm_kernel_execute(
+                        brg_kernels_[pd_t::brg_idx(false, is_q_tail, is_k_tail)]
+                                .get(),
+                        1, &batch, s_buf);
+
+                // Online softmax: rescale the running sums and the output
+                // accumulator whenever the row maximum grows.
+                for (dim_t i = 0; i < q_len; i++) {
+                    float *s = s_buf + i * conf.k_blk;
+                    const dim_t q = q_start + i;
+
+                    const dim_t msk_off = with_mask
+                            ? msk_d.blk_off(msk_d.dims()[0] == 1 ? 0 : mb,
+                                    msk_d.dims()[1] == 1 ? 0 : h,
+                                    msk_d.dims()[2] == 1 ? 0 : q, 0)
+                            : 0;
+
+                    float blk_max = -INFINITY;
+                    for (dim_t j = 0; j < k_len; j++) {
+                        const dim_t k = k_start + j;
+                        float val = s[j] * scale;
+                        if (with_mask)
+                            val += io::load_float_value(msk_d.data_type(),
+                                    msk_ptr, msk_off + k * msk_k_stride);
+                        if (with_causal_mask && k > q + causal_shift)
+                            val = -INFINITY;
+                        s[j] = val;
+                        blk_max = nstl::max(blk_max, val);
+                    }
+
+                    const float new_max = nstl::max(row_max[i], blk_max);
+                    if (new_max == -INFINITY) {
+                        // Everything seen so far is masked out.
+                        for (dim_t j = 0; j < k_len; j++)
+                            s[j] = 0.f;
+                        continue;
+                    }
+
+                    float blk_sum = 0.f;
+                    for (dim_t j = 0; j < k_len; j++) {
+                        s[j] = ::expf(s[j] - new_max);
+                        blk_sum += s[j];
+                    }
+
+                    const float corr = ::expf(row_max[i] - new_max);
+                    if (corr != 1.f) {
+                        float *o = o_buf + i * Dv;
+                        for (dim_t j = 0; j < Dv; j++)
+                            o[j] *= corr;
+                    }
+                    row_sum[i] = row_sum[i] * corr + blk_sum;
+                    row_max[i] = new_max;
+                }
+
+                batch.ptr.A = s_buf;
+                batch.ptr.B = v_buf;
+                brgemm_kernel_execute(
+                        brg_kernels_[pd_t::brg_idx(true, is_q_tail, is_k_tail)]
+                                .get(),
+                        1, &batch, o_buf);
+            }
+
+            for (dim_t i = 0; i < q_len; i++) {
+                const float *o = o_buf + i * Dv;
+                // Fully masked rows produce zeros or NaNs depending on the
+                // softmax flavor.
+                const float inv_sum = row_sum[i] > 0.f
+                        ? 1.f / row_sum[i]
+                        : (inf_as_zero ? 0.f : NAN);
+                char *dst_row = dst_ptr
+                        + dst_dsz * dst_d.blk_off(mb, h, q_start + i, 0);
+                for (dim_t j = 0; j < Dv; j++)
+                    io::store_float_value(dst_d.data_type(), o[j] * inv_sum,
+                            dst_row, j * dst_str[3]);
+            }
+
+            nd_iterator_step(mb, conf.mb, h, conf.nheads, qb, conf.nb_q);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,112 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_BRGEMM_SDPA_HPP
+#define CPU_X64_BRGEMM_SDPA_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_sdpa_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Flash-attention style SDPA: queries are processed in blocks of `q_blk`
+// rows while keys and values are streamed in blocks of `k_blk` rows. Both
+// matrix multiplications are done with f32 brgemm kernels on thread-local
+// packed copies of the Q/K/V blocks, and softmax is computed online with a
+// running maximum and sum per query row, so the full score matrix is never
+// materialized.
+struct brgemm_sdpa_conf_t {
+    cpu_isa_t isa;
+
+    dim_t mb; // batch size
+    dim_t nheads; // number of query heads
+    dim_t kv_nheads; // number of key-value heads
+    dim_t nqueries;
+    dim_t nkeys;
+    dim_t head_size; // D
+    dim_t val_head_size; // Dv
+
+    dim_t q_blk, q_tail, nb_q;
+    dim_t k_blk, k_tail;
+
+    // Per-thread scratchpad layout (in floats).
+    dim_t q_buf_off, k_buf_off, v_buf_off, s_buf_off, o_buf_off, ml_buf_off;
+    dim_t per_thr_buf_sz;
+
+    int nthr;
+};
+
+struct brgemm_sdpa_t : public primitive_t {
+    struct pd_t : public cpu_sdpa_pd_t {
+        using cpu_sdpa_pd_t::cpu_sdpa_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg_sdpa:", conf_.isa, ""),
+                brgemm_sdpa_t);
+
+        status_t init(engine_t *engine);
+
+        // Kernels are indexed by the kind of the matmul (QK^T or PV) and by
+        // whether the query block and the key block are tails.
+        static int brg_idx(bool is_pv, bool q_tail, bool k_tail) {
+            return 4 * is_pv + 2 * q_tail + k_tail;
+        }
+
+        brgemm_sdpa_conf_t conf_ = utils::zero<decltype(conf_)>();
+        std::vector<brgemm_desc_t> brg_descs_;
+
+    private:
+        status_t init_conf(engine_t *engine);
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+    };
+
+    brgemm_sdpa_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+    // All kernels are plain f32 brgemm kernels without post-ops, so their
+    // code can be serialized and restored without code generation.
+    status_t get_cache_blob_size(engine_t *engine, size_t *size) const override;
+    status_t get_cache_blob(
+            engine_t *engine, cache_blob_t &cache_blob) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::vector<std::unique_ptr<brgemm_kernel_t>> brg_kernels_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
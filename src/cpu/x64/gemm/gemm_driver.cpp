@@ -29,6 +29,7 @@
 #include "cpu/gemm/gemm.hpp"
 #include "cpu/gemm/gemm_msan_unpoison.hpp"
 
+#include "cpu/x64/amx_tile_configure.hpp"
 #include "cpu/x64/jit_generator.hpp"
 
 #include "cpu/x64/gemm/gemm_driver.hpp"
@@ -498,9 +499,17 @@ void gemm_kernel(dim_t m, dim_t n, const dim_t k, const float alpha,
     /* Column and row offsets are ignored by non-integer compute kernels.
      * Scaling is done only for bfloat16 kernels.
      */
-    if (m > 0 && n > 0)
+    if (m > 0 && n > 0) {
         arg->kernel[isBeta0][col_req][row_req](
                 &m, &n, &k, &alpha, a, b, c, ldc, col_offset, row_offset);
+        // AMX kernels load their own tile configuration and release the
+        // tiles when done.
+        constexpr bool is_bf16
+                = data_traits_t<a_type>::data_type == data_type::bf16;
+        if ((is_int8 || is_bf16) && mayiuse(avx512_core_amx)
+                && __BUILD_GEMM_AMX)
+            amx_tile_invalidate_palette_cache();
+    }
 
     msan_unpoison_matrix(c, m, n, ldc, sizeof(*c));
 
@@ -506,6 +506,62 @@ dnnl_status_t jump_to_gemv(const gemm_info_t<int8_t, int8_t, int32_t> *arg) {
     return dnnl_unimplemented;
 }
 
+template <typename a_t, typename b_t, typename c_t>
+static inline void gemv_driver(const bool use_threading, const int trans,
+        const dim_t m, const dim_t n, const float alpha, const a_t *a,
+        const dim_t lda, const b_t *x, const dim_t incx, const float beta,
+        c_t *y, const dim_t incy, const gemm_info_t<a_t, b_t, c_t> *arg) {
+    if (use_threading)
+        gemv_threading_driver(
+                trans, m, n, alpha, a, lda, x, incx, beta, y, incy, arg);
+    else
+        gemv_kernel_driver(
+                trans, m, n, alpha, a, lda, x, incx, beta, y, incy, arg);
+}
+
+// Maps a gemm problem with n == 1 or m == 1 onto a gemv with matrices `a`, `b`
+// and `c` instead of ones in `arg`. With `use_threading` the gemv is
+// distributed between threads, otherwise it is computed by the caller thread.
+template <typename a_t, typename b_t, typename c_t>
+static inline dnnl_status_t compute_gemv(const gemm_info_t<a_t, b_t, c_t> *arg,
+        const a_t *a, const b_t *b, c_t *c, bool use_threading) {
+    const int transa = arg->transa;
+    const int transb = arg->transb;
+
+    const dim_t m = arg->m;
+    const dim_t n = arg->n;
+    const dim_t k = arg->k;
+
+    const dim_t lda = arg->lda;
+    const dim_t ldb = arg->ldb;
+    const dim_t ldc = arg->ldc;
+
+    const float alpha = arg->alpha;
+    const float beta = arg->beta;
+
+    if (n == 1) {
+        if (transa == do_trans)
+            gemv_driver(use_threading, do_trans, k, m, alpha, a, lda, b,
+                    transb == no_trans ? 1 : ldb, beta, c, 1, arg);
+        else
+            gemv_driver(use_threading, no_trans, m, k, alpha, a, lda, b,
+                    transb == no_trans ? 1 : ldb, beta, c, 1, arg);
+        return dnnl_success;
+    }
+
+    if (m == 1) {
+        if (transb == no_trans)
+            gemv_driver(use_threading, do_trans, k, n, alpha, b, ldb, a,
+                    transa == no_trans ? lda : 1, beta, c, ldc, arg);
+        else
+            gemv_driver(use_threading, no_trans, n, k, alpha, b, ldb, a,
+                    transa == no_trans ? lda : 1, beta, c, ldc, arg);
+        return dnnl_success;
+    }
+
+    return dnnl_unimplemented;
+}
+
 template <typename a_t, typename b_t, typename c_t>
 dnnl_status_t jump_to_gemv(const gemm_info_t<a_t, b_t, c_t> *arg) {
     int transa = arg->transa;
@@ -517,78 +573,108 @@ dnnl_status_t jump_to_gemv(const gemm_info_t<a_t, b_t, c_t> *arg) {
 
     dim_t lda = arg->lda;
     dim_t ldb = arg->ldb;
-    dim_t ldc = arg->ldc;
 
     float alpha = arg->alpha;
-    float beta = arg->beta;
 
     const a_t *a = arg->a;
     const b_t *b = arg->b;
-    c_t *c = arg->c;
 
     if (k == 0) return dnnl_success;
 
     auto packing = (arg->packing != pack_type::none);
+    if (!packing) return compute_gemv(arg, a, b, arg->c, true);
+
+    if (n != 1 && m != 1) return dnnl_unimplemented;
+
     auto do_a = (arg->packing == pack_type::pack_a);
     gemm_pack_storage_t *pack_dst = arg->pack_dst;
 
-    if (n == 1 && (transa == do_trans || packing)) {
-        if (!packing) {
-            gemv_threading_driver(do_trans, k, m, alpha, a, lda, b,
-                    transb == no_trans ? 1 : ldb, beta, c, 1, arg);
-        } else {
-            if (do_a) {
-                gemm_utils::prep_gemm_pack<a_t, c_t>(
-                        do_a, do_trans, m, k, pack_dst);
-            } else {
-                gemm_utils::prep_gemm_pack<b_t, c_t>(
-                        do_a, no_trans, k, n, pack_dst);
-            }
+    if (do_a) {
+        gemm_utils::prep_gemm_pack<a_t, c_t>(do_a, do_trans, m, k, pack_dst);
+    } else {
+        gemm_utils::prep_gemm_pack<b_t, c_t>(do_a, no_trans, k, n, pack_dst);
+    }
 
-            if (arg->measure_only) return dnnl_success;
+    if (arg->measure_only) return dnnl_success;
 
-            if (do_a) {
-                gemm_utils::pack_no_copy(a, lda, m, k, transa, alpha, pack_dst);
-            } else {
-                gemm_utils::pack_no_copy(b, ldb, k, n, transb, alpha, pack_dst);
-            }
-        }
-        return dnnl_success;
-    } else if (n == 1 && transa == no_trans && !packing) {
-        gemv_threading_driver(no_trans, m, k, alpha, a, lda, b,
-                transb == no_trans ? 1 : ldb, beta, c, 1, arg);
-        return dnnl_success;
+    if (do_a) {
+        gemm_utils::pack_no_copy(a, lda, m, k, transa, alpha, pack_dst);
+    } else {
+        gemm_utils::pack_no_copy(b, ldb, k, n, transb, alpha, pack_dst);
     }
+    return dnnl_success;
+}
 
-    if (m == 1 && (transb == no_trans || packing)) {
-        if (!packing) {
-            gemv_threading_driver(do_trans, k, n, alpha, b, ldb, a,
-                    transa == no_trans ? lda : 1, beta, c, ldc, arg);
-        } else {
-            if (do_a) {
-                gemm_utils::prep_gemm_pack<a_t, c_t>(
-                        do_a, do_trans, m, k, pack_dst);
-            } else {
-                gemm_utils::prep_gemm_pack<b_t, c_t>(
-                        do_a, no_trans, k, n, pack_dst);
-            }
-
-            if (arg->measure_only) return dnnl_success;
+template <typename a_t, typename b_t, typename c_t>
+dnnl_status_t gemv_batch_driver(const char *transA, const char *transB,
+        const dim_t *m, const dim_t *n, const dim_t *k, const float *alpha,
+        const a_t *const *a, const dim_t *lda, const b_t *const *b,
+        const dim_t *ldb, const float *beta, c_t *const *c, const dim_t *ldc,
+        dim_t batch) {
+    if (batch <= 0) return dnnl_success;
+    if (*m != 1 && *n != 1) return dnnl_unimplemented;
+
+    // Kernels and blocking are shared by all problems of the batch, so they
+    // are set up once.
+    gemm_info_t<a_t, b_t, c_t> args(transA, transB, nullptr, m, n, k, alpha,
+            a[0], lda, nullptr, b[0], ldb, nullptr, beta, c[0], ldc, nullptr,
+            false, pack_type::none, nullptr, false);
+    if (!args.hasKernels()) return dnnl_unimplemented;
+    if (args.transa == packed || args.transb == packed)
+        return dnnl_unimplemented;
+    // Empty reduction only scales C, which is left to the regular driver.
+    if (args.k <= 0) return dnnl_unimplemented;
+    if (args.m <= 0 || args.n <= 0) return dnnl_success;
+
+    // The matrix that is not a vector is the one streamed from memory.
+    const bool stream_a = args.n == 1;
+    const dim_t ld_mat = stream_a ? args.lda : args.ldb;
+    const dim_t cols_mat = stream_a
+            ? (args.transa == no_trans ? args.k : args.m)
+            : (args.transb == no_trans ? args.n : args.k);
+    const size_t mat_bytes = (size_t)ld_mat * cols_mat
+            * (stream_a ? sizeof(a_t) : sizeof(b_t));
+
+    // A single problem that occupies all threads by itself is better computed
+    // problem by problem.
+    // Dimensions and transposition of the gemv as seen by `compute_gemv()`.
+    const int nthr_max = dnnl_get_current_num_threads();
+    const int gemv_trans = stream_a
+            ? (args.transa == do_trans ? do_trans : no_trans)
+            : (args.transb == no_trans ? do_trans : no_trans);
+    const dim_t gemv_len = stream_a ? args.m : args.n;
+    const int nthr_one = thread_checker<a_t>(nthr_max,
+            gemv_trans == do_trans ? args.k : gemv_len,
+            gemv_trans == do_trans ? gemv_len : args.k, gemv_trans);
+    if (nthr_max == 1 || nthr_one >= nthr_max) {
+        for (dim_t i = 0; i < batch; i++)
+            CHECK(compute_gemv(&args, a[i], b[i], c[i], nthr_max > 1));
+        return dnnl_success;
+    }
 
-            if (do_a) {
-                gemm_utils::pack_no_copy(a, lda, m, k, transa, alpha, pack_dst);
-            } else {
-                gemm_utils::pack_no_copy(b, ldb, k, n, transb, alpha, pack_dst);
+    // Requesting the beginning of the next matrix while the current one is
+    // computed hides the latency of the jump between matrices, the rest of
+    // it is brought by hardware prefetchers.
+    const size_t prefetch_bytes = nstl::min(mat_bytes, (size_t)4096);
+    const int nthr = static_cast<int>(nstl::min(dim_t(nthr_max), batch));
+    parallel(nthr, [&](int ithr, int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(batch, nthr, ithr, start, end);
+        for (dim_t i = start; i < end; i++) {
+#if defined(__GNUC__)
+            if (i + 1 < end) {
+                const char *next = stream_a
+                        ? reinterpret_cast<const char *>(a[i + 1])
+                        : reinterpret_cast<const char *>(b[i + 1]);
+                for (size_t off = 0; off < prefetch_bytes; off += 64)
+                    __builtin_prefetch(next + off, 0, 0);
             }
+#endif
+            compute_gemv(&args, a[i], b[i], c[i], false);
         }
-        return dnnl_success;
-    } else if (m == 1 && transb == do_trans && !packing) {
-        gemv_threading_driver(no_trans, n, k, alpha, b, ldb, a,
-                transa == no_trans ? lda : 1, beta, c, ldc, arg);
-        return dnnl_success;
-    }
+    });
 
-    return dnnl_unimplemented;
+    return dnnl_success;
 }
 
 template // Instatiate gemv_f32
@@ -600,6 +686,23 @@ template // Instatiate gemv_bf16bf16f32
         jump_to_gemv<bfloat16_t, bfloat16_t, float>(
                 const gemm_info_t<bfloat16_t, bfloat16_t, float> *arg);
 
+template // Instatiate batched gemv_f32
+        dnnl_status_t
+        gemv_batch_driver<float, float, float>(const char *transA,
+                const char *transB, const dim_t *m, const dim_t *n,
+                const dim_t *k, const float *alpha, const float *const *a,
+                const dim_t *lda, const float *const *b, const dim_t *ldb,
+                const float *beta, float *const *c, const dim_t *ldc,
+                dim_t batch);
+template // Instatiate batched gemv_bf16bf16f32
+        dnnl_status_t
+        gemv_batch_driver<bfloat16_t, bfloat16_t, float>(const char *transA,
+                const char *transB, const dim_t *m, const dim_t *n,
+                const dim_t *k, const float *alpha, const bfloat16_t *const *a,
+                const dim_t *lda, const bfloat16_t *const *b, const dim_t *ldb,
+                const float *beta, float *const *c, const dim_t *ldc,
+                dim_t batch);
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
@@ -29,6 +29,16 @@ namespace x64 {
 template <typename a_t, typename b_t, typename c_t>
 dnnl_status_t jump_to_gemv(const gemm_info_t<a_t, b_t, c_t> *arg);
 
+// Computes a batch of problems with m == 1 or n == 1 sharing everything but
+// the matrices. Problems are distributed between threads unless a single one
+// can occupy all threads by itself.
+template <typename a_t, typename b_t, typename c_t>
+dnnl_status_t gemv_batch_driver(const char *transA, const char *transB,
+        const dim_t *m, const dim_t *n, const dim_t *k, const float *alpha,
+        const a_t *const *a, const dim_t *lda, const b_t *const *b,
+        const dim_t *ldb, const float *beta, c_t *const *c, const dim_t *ldc,
+        dim_t batch);
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
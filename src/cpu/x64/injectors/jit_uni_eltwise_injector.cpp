@@ -445,17 +445,26 @@ void jit_uni_eltwise_injector_t<isa, Wmm>::exp_compute_vector_fwd(
     blend_with_mask(vmm_aux(1), vmm_src);
 
     // compute polynomial
-    h->uni_vmovups(vmm_src, table_val(exp_pol, 4));
-    h->uni_vfmadd213ps(vmm_src, vmm_aux(0), table_val(exp_pol, 3));
-    h->uni_vfmadd213ps(vmm_src, vmm_aux(0), table_val(exp_pol, 2));
-    h->uni_vfmadd213ps(vmm_src, vmm_aux(0), table_val(exp_pol, 1));
-    h->uni_vfmadd213ps(vmm_src, vmm_aux(0), table_val(exp_pol, 0));
-    h->uni_vfmadd213ps(vmm_src, vmm_aux(0), table_val(one));
+    exp_polynomial_compute(vmm_src, vmm_aux(0));
     // y = y * 2^n
     h->uni_vmulps(vmm_src, vmm_src, vmm_aux(1));
     h->uni_vmulps(vmm_src, vmm_src, table_val(two));
 }
 
+// Computes exp(r) for r in [-ln2/2, ln2/2]. The degree of the polynomial depends
+// on the accuracy tier.
+template <cpu_isa_t isa, typename Wmm>
+void jit_uni_eltwise_injector_t<isa, Wmm>::exp_polynomial_compute(
+        const Vmm &vmm_dst, const Vmm &vmm_r) {
+    const int degree = approx_tier_ == approx_tier_t::bf16 ? 3
+            : approx_tier_ == approx_tier_t::f16           ? 4
+                                                           : 5;
+    h->uni_vmovups(vmm_dst, table_val(exp_pol, degree - 1));
+    for (int i = degree - 2; i >= 0; i--)
+        h->uni_vfmadd213ps(vmm_dst, vmm_r, table_val(exp_pol, i));
+    h->uni_vfmadd213ps(vmm_dst, vmm_r, table_val(one));
+}
+
 template <cpu_isa_t isa, typename Wmm>
 void jit_uni_eltwise_injector_t<isa, Wmm>::relu_compute_vector_fwd(
         const Vmm &vmm_src) {
@@ -844,12 +853,7 @@ void jit_uni_eltwise_injector_t<isa, Wmm>::soft_relu_compute_vector_fwd(
     h->uni_vmulps(vmm_aux(0), vmm_aux(0), table_val(ln2f));
     h->uni_vsubps(vmm_aux(1), vmm_aux(1), vmm_aux(0));
     // compute exponent polynomial
-    h->uni_vmovups(vmm_aux(3), table_val(exp_pol, 4));
-    h->uni_vfmadd213ps(vmm_aux(3), vmm_aux(1), table_val(exp_pol, 3));
-    h->uni_vfmadd213ps(vmm_aux(3), vmm_aux(1), table_val(exp_pol, 2));
-    h->uni_vfmadd213ps(vmm_aux(3), vmm_aux(1), table_val(exp_pol, 1));
-    h->uni_vfmadd213ps(vmm_aux(3), vmm_aux(1), table_val(exp_pol, 0));
-    h->uni_vfmadd213ps(vmm_aux(3), vmm_aux(1), table_val(one));
+    exp_polynomial_compute(vmm_aux(3), vmm_aux(1));
 
     // We do not count 2^-n here, because n can reach 128 and 2^(-128) is not
     // representable by fp32, so to get around this problem, instead of computing
@@ -1401,16 +1405,14 @@ void jit_uni_eltwise_injector_t<isa, Wmm>::gelu_erf_compute_vector_fwd(
     // -exp(-x*x)*t
     h->uni_vmulps(vmm_src, vmm_src, vmm_aux(4));
 
-    // compute polynomialial r
-    h->uni_vmovups(vmm_aux(1), table_val(gelu_erf_Abramowitz_Stegun_pol, 4));
-    h->uni_vfmadd213ps(vmm_aux(1), vmm_aux(4),
-            table_val(gelu_erf_Abramowitz_Stegun_pol, 3));
-    h->uni_vfmadd213ps(vmm_aux(1), vmm_aux(4),
-            table_val(gelu_erf_Abramowitz_Stegun_pol, 2));
-    h->uni_vfmadd213ps(vmm_aux(1), vmm_aux(4),
-            table_val(gelu_erf_Abramowitz_Stegun_pol, 1));
-    h->uni_vfmadd213ps(vmm_aux(1), vmm_aux(4),
-            table_val(gelu_erf_Abramowitz_Stegun_pol, 0));
+    // compute polynomialial r, formula 7.1.25 for the bf16 tier and 7.1.26
+    // otherwise
+    const int degree = approx_tier_ == approx_tier_t::bf16 ? 3 : 5;
+    h->uni_vmovups(vmm_aux(1),
+            table_val(gelu_erf_Abramowitz_Stegun_pol, degree - 1));
+    for (int i = degree - 2; i >= 0; i--)
+        h->uni_vfmadd213ps(vmm_aux(1), vmm_aux(4),
+                table_val(gelu_erf_Abramowitz_Stegun_pol, i));
 
     // erf = sign * (1 - r * t * exp(-x*x))
     h->uni_vfmadd213ps(vmm_src, vmm_aux(1), table_val(one));
@@ -2210,6 +2212,21 @@ void jit_uni_eltwise_injector_t<isa, Wmm>::register_table_entries() {
             {exp_pol, {0x3c07cfce, true}} // p5 = 0.00828929059f
     };
 
+    // exp(x) minimax polynomial approximations of lower degrees
+    static const table_t exp_polynomial_f16 {
+            // p0 = 1.0f
+            {exp_pol, {0x3f7ffdf1, true}}, // p1 = 0.999968588f
+            {exp_pol, {0x3efffdf3, true}}, // p2 = 0.499984354f
+            {exp_pol, {0x3e2be056, true}}, // p3 = 0.167847961f
+            {exp_pol, {0x3d2c21f0, true}} // p4 = 0.0420245528f
+    };
+    static const table_t exp_polynomial_bf16 {
+            // p0 = 1.0f
+            {exp_pol, {0x3f807bd8, true}}, // p1 = 1.00377941f
+            {exp_pol, {0x3f00f613, true}}, // p2 = 0.503754795f
+            {exp_pol, {0x3e0037a1, true}} // p3 = 0.125212207f
+    };
+
     // mish(x) constants
     static const table_t mish_consts {
             {fwd_mish_max_x_for_equation_f, {0x42317217, true}},
@@ -2491,6 +2508,24 @@ void jit_uni_eltwise_injector_t<isa, Wmm>::register_table_entries() {
             {gelu_erf_Abramowitz_Stegun_one_over_sqrt_pi, {0x3f106eba, true}},
     };
 
+    // gelu_erf(x) constants for the lower accuracy approximation based on
+    // Abramowitz and Stegun algorithm (formula 7.1.25)
+    static const table_t gelu_erf_Abramowitz_Stegun_bf16_consts {
+            {gelu_erf_Abramowitz_Stegun_approx_const, {0x3ef0e172, true}},
+            {gelu_erf_Abramowitz_Stegun_one_over_sqrt_two, {0x3f3504f3, true}},
+            {gelu_erf_Abramowitz_Stegun_one_over_sqrt_pi, {0x3f106eba, true}},
+    };
+
+    // gelu_erf(x) polynomial approximation for formula 7.1.25
+    static const table_t gelu_erf_Abramowitz_Stegun_bf16_polynomial {
+            // p1 = 0.3480242f
+            {gelu_erf_Abramowitz_Stegun_pol, {0x3eb2303a, true}},
+            // p2 = -0.0958798f
+            {gelu_erf_Abramowitz_Stegun_pol, {0xbdc45ca1, true}},
+            // p3 = 0.7478556f
+            {gelu_erf_Abramowitz_Stegun_pol, {0x3f3f7377, true}},
+    };
+
     // gelu_erf(x) polynomial approximation based on Abramowitz and Stegun
     // algorithm
     static const table_t gelu_erf_Abramowitz_Stegun_polynomial {
@@ -2896,15 +2931,30 @@ void jit_uni_eltwise_injector_t<isa, Wmm>::register_table_entries() {
     push_arg_entry_of(beta, float2int(beta_), true);
     push_entries_of(common_values);
     if (need.exp()) push_entries_of(exp_consts);
-    if (need.exp()) push_entries_of(exp_polynomial);
+    if (need.exp()) {
+        switch (approx_tier_) {
+            case approx_tier_t::f16: push_entries_of(exp_polynomial_f16); break;
+            case approx_tier_t::bf16:
+                push_entries_of(exp_polynomial_bf16);
+                break;
+            default: push_entries_of(exp_polynomial); break;
+        }
+    }
     if (need.mish()) push_entries_of(mish_consts);
     if (need.tanh()) push_entries_of(tanh_consts);
     if (need.tanh()) push_entries_of(tanh_polynomial_table);
     if (need.soft_relu()) push_entries_of(soft_relu_consts);
     if (need.soft_relu()) push_entries_of(soft_relu_polynomial);
     if (need.gelu_tanh()) push_entries_of(gelu_tanh_consts);
-    if (need.gelu_erf()) push_entries_of(gelu_erf_Abramowitz_Stegun_consts);
-    if (need.gelu_erf()) push_entries_of(gelu_erf_Abramowitz_Stegun_polynomial);
+    if (need.gelu_erf()) {
+        if (approx_tier_ == approx_tier_t::bf16) {
+            push_entries_of(gelu_erf_Abramowitz_Stegun_bf16_consts);
+            push_entries_of(gelu_erf_Abramowitz_Stegun_bf16_polynomial);
+        } else {
+            push_entries_of(gelu_erf_Abramowitz_Stegun_consts);
+            push_entries_of(gelu_erf_Abramowitz_Stegun_polynomial);
+        }
+    }
     if (need.gelu_erf() && is_avx512_) push_entries_of(gelu_erf_minimax_consts);
     if (need.gelu_erf() && is_avx512_)
         push_entries_of(gelu_erf_minimax_polynomial);
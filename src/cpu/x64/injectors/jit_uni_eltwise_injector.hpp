@@ -40,14 +40,16 @@ struct static_params_t {
             Xbyak::Reg64 p_table = Xbyak::Reg64(Xbyak::Operand::RAX),
             Xbyak::Opmask k_mask = Xbyak::Opmask(1), bool is_fwd = true,
             bool use_dst = false, bool preserve_vmm = true,
-            bool preserve_p_table = true)
+            bool preserve_p_table = true,
+            fpmath_mode_t fpmath_mode = fpmath_mode::strict)
         : save_state(save_state)
         , p_table_(p_table)
         , k_mask_(k_mask)
         , is_fwd(is_fwd)
         , use_dst(use_dst)
         , preserve_vmm(preserve_vmm)
-        , preserve_p_table(preserve_p_table) {}
+        , preserve_p_table(preserve_p_table)
+        , fpmath_mode(fpmath_mode) {}
 
     bool save_state;
     Xbyak::Reg64 p_table_;
@@ -56,6 +58,7 @@ struct static_params_t {
     bool use_dst;
     bool preserve_vmm;
     bool preserve_p_table;
+    fpmath_mode_t fpmath_mode;
 };
 
 /*
@@ -91,13 +94,16 @@ struct jit_uni_eltwise_injector_t {
     //   - algorithm derivative.
     // use_dst - defines whether source or destination point is passed to alg
     //   code. Depends on algorithm. See `_use_dst_for_bwd` algs definition.
+    // fpmath_mode - when it allows down-conversion, forward algorithms use
+    //   approximations of lower accuracy. See `approx_tier_t` definition.
     jit_uni_eltwise_injector_t(jit_generator_t *host, alg_kind_t alg,
             float alpha, float beta, float scale,
             data_type_t dt = data_type::f32, bool save_state = true,
             Xbyak::Reg64 p_table = Xbyak::Reg64(Xbyak::Operand::RAX),
             Xbyak::Opmask k_mask = Xbyak::Opmask(1), bool is_fwd = true,
             bool use_dst = false, bool preserve_vmm = true,
-            bool preserve_p_table = true)
+            bool preserve_p_table = true,
+            fpmath_mode_t fpmath_mode = fpmath_mode::strict)
         : alg_(alg)
         , alpha_(alpha)
         , beta_(beta)
@@ -111,6 +117,7 @@ struct jit_uni_eltwise_injector_t {
         , use_dst_(use_dst)
         , preserve_vmm_(preserve_vmm)
         , preserve_p_table_(preserve_p_table)
+        , approx_tier_(get_approx_tier(fpmath_mode, is_fwd))
         , n_vregs_to_preserve_(aux_vecs_count(alg_, is_fwd_, alpha_)) {
         assert(eltwise_injector::is_supported(isa, alg_, dt_));
 
@@ -123,10 +130,12 @@ struct jit_uni_eltwise_injector_t {
             Xbyak::Reg64 p_table = Xbyak::Reg64(Xbyak::Operand::RAX),
             Xbyak::Opmask k_mask = Xbyak::Opmask(1), bool is_fwd = true,
             bool use_dst = false, bool preserve_vmm = true,
-            bool preserve_p_table = true)
+            bool preserve_p_table = true,
+            fpmath_mode_t fpmath_mode = fpmath_mode::strict)
         : jit_uni_eltwise_injector_t(host, eltwise.alg, eltwise.alpha,
                 eltwise.beta, eltwise.scale, dt, save_state, p_table, k_mask,
-                is_fwd, use_dst, preserve_vmm, preserve_p_table) {}
+                is_fwd, use_dst, preserve_vmm, preserve_p_table, fpmath_mode) {
+    }
 
     void compute_vector_range(size_t start_compute_idx, size_t end_compute_idx,
             const injector_utils::vmm_index_set_t &vmm_aux_indices = {});
@@ -163,6 +172,27 @@ private:
     const bool preserve_vmm_;
     const bool preserve_p_table_;
 
+    // Accuracy of polynomial approximations. Lower tiers keep the error below
+    // a half of ulp of the data type fpmath mode allows to down-convert to:
+    // - f16 (f16, tf32 modes): exp with degree 4, relative error < 6.2e-6;
+    // - bf16 (bf16, any modes): exp with degree 3, relative error < 4.4e-4;
+    //   erf without avx512 by Abramowitz and Stegun 7.1.25, absolute error
+    //   < 2.5e-5.
+    // Backward algorithms always use full accuracy.
+    enum class approx_tier_t { full, f16, bf16 };
+    const approx_tier_t approx_tier_;
+
+    static approx_tier_t get_approx_tier(fpmath_mode_t mode, bool is_fwd) {
+        if (!is_fwd) return approx_tier_t::full;
+        switch (mode) {
+            case fpmath_mode::f16:
+            case fpmath_mode::tf32: return approx_tier_t::f16;
+            case fpmath_mode::bf16:
+            case fpmath_mode::any: return approx_tier_t::bf16;
+            default: return approx_tier_t::full;
+        }
+    }
+
     Xbyak::Label l_table_;
 
     // if only the injector was inherited from jit_generator_t...
@@ -224,6 +254,7 @@ private:
     void test_mask();
 
     void exp_compute_vector_fwd(const Vmm &vmm_src);
+    void exp_polynomial_compute(const Vmm &vmm_dst, const Vmm &vmm_r);
     void relu_compute_vector_fwd(const Vmm &vmm_src);
     void relu_zero_ns_compute_vector_fwd(const Vmm &vmm_src);
     void elu_compute_vector_fwd(const Vmm &vmm_src);
@@ -302,7 +333,7 @@ private:
         gelu_tanh_fitting_const, // 0.044715f
         gelu_tanh_fitting_const_times_three, // 0.134145f
         gelu_tanh_sqrt_two_over_pi, // sqrtf(2.f/pi) = 0.797884f
-        // 0.3275911f - implementation based for approx
+        // 0.3275911f or 0.47047f - implementation based for approx
         gelu_erf_Abramowitz_Stegun_approx_const,
         gelu_erf_Abramowitz_Stegun_one_over_sqrt_two, // 1.f / sqrtf(2.f)
         // 1.f / sqrtf(pi) = 0.564190f
@@ -142,6 +142,9 @@ status_t jit_avx512_core_amx_1x1_convolution_fwd_t::execute_forward(
         p.tile_cfg_tail = tcfg + 64;
 
         amx_tile_configure(tcfg);
+        // The kernel switches between the main and the tail configurations
+        // on its own, so the loaded palette is no longer known.
+        amx_tile_invalidate_palette_cache();
 
         int mb {0}, g {0}, _osb {0}, _ocb {0};
         nd_iterator_init(start, mb, jcp.mb, g, jcp.ngroups, _osb, os_chunks,
@@ -153,38 +153,36 @@ void fp8_conversion_e5m2_t::vcvt_f8_to_f16(
         const Xbyak::Xmm &xmm_out, const Xbyak::Operand &op_in) {
     assert(utils::one_of(
             true, op_in.isXMM(), op_in.isYMM(), op_in.isZMM(), op_in.isMEM()));
-    const Xbyak::Ymm ymm_out(xmm_out.getIdx());
-    const Xbyak::Zmm zmm_out(xmm_out.getIdx());
+    assert(!utils::one_of(
+            xmm_out.getIdx(), xmm_aux1_.getIdx(), xmm_aux2_.getIdx()));
+    const auto vmm = [&](int idx) -> Xbyak::Xmm {
+        if (xmm_out.isZMM()) return Xbyak::Zmm(idx);
+        if (xmm_out.isYMM()) return Xbyak::Ymm(idx);
+        return Xbyak::Xmm(idx);
+    };
+    const Xbyak::Xmm vmm_out = vmm(xmm_out.getIdx());
+    const Xbyak::Xmm vmm_aux1 = vmm(xmm_aux1_.getIdx());
+    const Xbyak::Xmm vmm_qbit = vmm(xmm_aux2_.getIdx());
+    const Xbyak::Opmask kmask_out(xmm_out.getOpmaskIdx());
 
     // f16 <- f8_e5m2
     host_->vpmovzxbw(xmm_out, op_in);
     host_->vpsllw(xmm_out, xmm_out, 8);
     // Floating point conversions typically set quiet bit for NaN inputs.
-    // Here we add extra conversions to and from f32 to achieve this, but
-    // in practice it should be okay to skip this step.
-    if (xmm_out.isZMM()) {
-        assert(!utils::one_of(xmm_out.getIdx(), xmm_aux1_.getIdx(),
-                xmm_aux2_.getIdx(), xmm_aux3_.getIdx()));
-
-        const Xbyak::Ymm ymm_aux1(xmm_aux1_.getIdx());
-        const Xbyak::Zmm zmm_aux1(xmm_aux1_.getIdx());
-        // process upper bytes
-        host_->vextractf64x4(ymm_aux1, zmm_out, 1);
-        host_->vcvtph2psx(zmm_aux1, ymm_aux1);
-        host_->vcvtps2phx(ymm_aux1, zmm_aux1);
-        host_->vinsertf64x4(zmm_out, zmm_out, ymm_aux1, 1);
-
-        // process low bytes
-        host_->vextractf64x4(ymm_aux1, zmm_out, 0);
-        host_->vcvtph2psx(zmm_aux1, ymm_aux1);
-        host_->vcvtps2phx(ymm_aux1, zmm_aux1);
-        host_->vinsertf64x4(zmm_out, zmm_out, ymm_aux1, 0);
-    } else {
-        // f32 <- f16
-        host_->vcvtph2psx(zmm_out, ymm_out);
-        // f16 <- f32
-        host_->vcvtps2phx(ymm_out, zmm_out);
-    }
+    // Set it for signaling NaNs to match. A word is a NaN iff its absolute
+    // value is above 0x7c00, i.e. adding 0x03ff to it sets the sign bit. Only
+    // word granular operations are masked so that the lanes excluded by the
+    // output mask are kept intact, and no mask or gpr is clobbered.
+    host_->vpternlogd(vmm_aux1, vmm_aux1, vmm_aux1, 0xff);
+    host_->vpsrlw(vmm_aux1, vmm_aux1, 6); // 0x03ff
+    host_->vpsllw(vmm_qbit, vmm_out, 1);
+    host_->vpsrlw(vmm_qbit, vmm_qbit, 1); // abs value
+    host_->vpaddw(vmm_qbit, vmm_qbit, vmm_aux1);
+    host_->vpsrlw(vmm_qbit, vmm_qbit, 15);
+    host_->vpsllw(vmm_qbit, vmm_qbit, 9); // 0x0200 for NaNs, 0 otherwise
+    // Drop the quiet bit where it is already set, so adding it is an or.
+    host_->vpandnd(vmm_qbit, vmm_out, vmm_qbit);
+    host_->vpaddw(vmm_out | kmask_out, vmm_out, vmm_qbit);
 }
 
 void fp8_conversion_e5m2_t::prepare_f8_to_f16_vnni_masks(int zmm_permute_idx) {
@@ -324,9 +322,14 @@ void fp8_conversion_e4m3_t::vcvt_f8_to_f16_vnni_block(int num_rows,
     const Xbyak::Ymm ymm_out2(zmm_out2.getIdx());
 
     const Xbyak::Zmm zmm_permute(xmm_aux3_.getIdx());
-    for (int r = 0; r < num_rows; r += 2) {
+    if (is_fp8_native())
         host_->vmovups(zmm_permute,
                 host_->ptr[host_->rip + label_vnni_permute_index_table_]);
+    for (int r = 0; r < num_rows; r += 2) {
+        // The emulated conversion uses the permute register as a scratch.
+        if (!is_fp8_native())
+            host_->vmovups(zmm_permute,
+                    host_->ptr[host_->rip + label_vnni_permute_index_table_]);
 
         host_->vpermb(
                 zmm_out1, zmm_permute, host_->ptr[reg_data_in]); // 3210 -> 1302
@@ -523,6 +526,7 @@ jit_cvt_fp8_t::jit_cvt_fp8_t(f32_convert_mode_t mode)
         case f8_e5m2_to_f32:
         case f16_to_f8_e5m2:
         case f32_to_f8_e5m2:
+        case f8_e5m2_to_f16_x32:
             safe_ptr_assign(fp8_cvt_,
                     new fp8_conversion_e5m2_t(this, xmm_aux1, xmm_aux2,
                             xmm_aux3, kmask_aux, reg64_aux));
@@ -545,6 +549,7 @@ jit_cvt_fp8_t::jit_cvt_fp8_t(f32_convert_mode_t mode)
 void jit_cvt_fp8_t::generate() {
     const Xbyak::Zmm zmm_out(xmm_out.getIdx());
     const Xbyak::Ymm ymm_out(xmm_out.getIdx());
+    const Xbyak::Ymm ymm_inp(xmm_inp.getIdx());
     switch (mode_) {
         case f8_e5m2_to_f32:
         case f8_e4m3_to_f32:
@@ -560,6 +565,11 @@ void jit_cvt_fp8_t::generate() {
             fp8_cvt_->vcvt_f8_to_f16(ymm_out, xmm_inp);
             vmovw(word[reg64_out], xmm_out);
             break;
+        case f8_e5m2_to_f16_x32:
+            vmovdqu8(ymm_inp, yword[reg64_inp]);
+            fp8_cvt_->vcvt_f8_to_f16(zmm_out, ymm_inp);
+            vmovdqu16(zword[reg64_out], zmm_out);
+            break;
         case f16_to_f8_e5m2:
         case f16_to_f8_e4m3:
             vmovw(xmm_inp, word[reg64_inp]);
@@ -590,6 +600,7 @@ void jit_cvt_fp8_t::generate() {
         case f8_e4m3_to_f16:
         case f8_e5m2_to_f32:
         case f8_e4m3_to_f32:
+        case f8_e5m2_to_f16_x32:
         case f16_to_f8_e5m2:
         case f16_to_f8_e4m3:
         case f32_to_f8_e5m2:
@@ -632,6 +643,14 @@ bool try_cvt_f8_e4m3_to_f16(float16_t *out, const float8_e4m3_t *inp) {
     return true;
 }
 
+bool try_cvt_f8_e5m2_to_f16_x32(float16_t *out, const float8_e5m2_t *inp) {
+    if (!mayiuse(cpu_isa_t::avx512_core_fp16)) return false;
+
+    static const jit_cvt_fp8_t cvt(f8_e5m2_to_f16_x32);
+    cvt(out, inp);
+    return true;
+}
+
 bool try_cvt_f16_to_f8_e5m2(float8_e5m2_t *out, const float16_t *inp) {
     if (!mayiuse(cpu_isa_t::avx512_core_fp16)) return false;
 
@@ -189,6 +189,8 @@ enum f32_convert_mode_t {
     f32_to_f8_e4m3,
     f16_to_f32,
     f32_to_f16,
+    // Converts a full vector of 32 values.
+    f8_e5m2_to_f16_x32,
 };
 
 struct jit_cvt_fp8_t : public jit_generator_t {
@@ -217,6 +219,9 @@ bool DNNL_API try_cvt_f8_e5m2_to_f32(float *out, const float8_e5m2_t *inp);
 bool DNNL_API try_cvt_f8_e4m3_to_f32(float *out, const float8_e4m3_t *inp);
 bool DNNL_API try_cvt_f8_e5m2_to_f16(float16_t *out, const float8_e5m2_t *inp);
 bool DNNL_API try_cvt_f8_e4m3_to_f16(float16_t *out, const float8_e4m3_t *inp);
+// Converts 32 consecutive values.
+bool DNNL_API try_cvt_f8_e5m2_to_f16_x32(
+        float16_t *out, const float8_e5m2_t *inp);
 bool DNNL_API try_cvt_f16_to_f8_e5m2(float8_e5m2_t *out, const float16_t *inp);
 bool DNNL_API try_cvt_f16_to_f8_e4m3(float8_e4m3_t *out, const float16_t *inp);
 bool DNNL_API try_cvt_f32_to_f8_e5m2(float8_e5m2_t *out, const float *inp);
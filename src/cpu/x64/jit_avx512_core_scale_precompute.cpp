@@ -93,6 +93,31 @@ const float *precompute_scales(const memory_tracking::grantor_t &scratchpad,
     return scales;
 }
 
+const float *precompute_scales(const memory_tracking::grantor_t &scratchpad,
+        const constant_quant_resource_t *resource, const float *src_scales,
+        const float *wei_scales, dim_t IC, dim_t OC,
+        const bool wei_scale_per_ic, const bool wei_scale_per_oc,
+        const primitive_attr_t *attr,
+        const jit_avx512_core_scale_precompute_t *const jit_scale_precompute,
+        float scale_adjust_factor, bool req_transpose) {
+    auto compute = [&]() {
+        return precompute_scales(scratchpad, src_scales, wei_scales, IC, OC,
+                wei_scale_per_ic, wei_scale_per_oc, attr, jit_scale_precompute,
+                scale_adjust_factor, req_transpose);
+    };
+    // Without a copy the user buffers are returned, there is nothing to keep.
+    if (!resource
+            || !req_copy_scales(
+                    attr->scales_, scale_adjust_factor, req_transpose))
+        return compute();
+
+    size_t size = 0;
+    scratchpad.template get<float>(
+            memory_tracking::names::key_precomputed_scales, &size);
+    return resource->get<float>(
+            constant_quant_resource_t::scales, size, compute);
+}
+
 } // namespace scale_utils
 
 #define GET_OFF(field) offsetof(scale_utils::jit_call_t, field)
@@ -119,6 +144,13 @@ void jit_avx512_core_scale_precompute_t::cvt2ps(data_type_t type_in,
             vpmovzxwd(vmm, op);
             vpslld(vmm_in, vmm_in, 0x10);
             break;
+        case data_type::e8m0:
+            // The value is a biased exponent without mantissa.
+            vpmovzxbd(vmm, op);
+            vpslld(vmm_in, vmm_in, 23);
+            vpcmpeqd(knan_mask_, vmm_in, vmm_e8m0_nan_);
+            vmovdqu32(vmm_in | knan_mask_, vmm_f32_nan_);
+            break;
         default: assert(!"unsupported data type");
     }
 }
@@ -163,6 +195,12 @@ void jit_avx512_core_scale_precompute_t::generate() {
         vmovq(xmm_scale_factor_, reg_scale_factor_);
         vbroadcastss(vmm_scale_factor_, xmm_scale_factor_);
     }
+    if (wei_scales_dt_ == data_type::e8m0) {
+        mov(reg_mask_, 0x7f800000);
+        vpbroadcastd(vmm_e8m0_nan_, reg_mask_);
+        mov(reg_mask_, 0xffc00000);
+        vpbroadcastd(vmm_f32_nan_, reg_mask_);
+    }
 
     constexpr int n_unroll = 2;
     Xbyak::Label l_simd_loop[n_unroll + 2], l_done;
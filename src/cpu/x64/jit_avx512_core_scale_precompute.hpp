@@ -60,6 +60,16 @@ const float *precompute_scales(const memory_tracking::grantor_t &scratchpad,
         const primitive_attr_t *attr,
         const jit_avx512_core_scale_precompute_t *const jit_scale_precompute,
         float scale_adjust_factor = 1.0f, bool req_transpose = false);
+// Same as above, but for a primitive with constant quantization parameters,
+// i.e. with non-null `resource`, the scales are only computed by the first
+// execution and are kept in the resource.
+const float *precompute_scales(const memory_tracking::grantor_t &scratchpad,
+        const constant_quant_resource_t *resource, const float *src_scales,
+        const float *wei_scales, dim_t IC, dim_t OC,
+        const bool wei_scale_per_ic, const bool wei_scale_per_oc,
+        const primitive_attr_t *attr,
+        const jit_avx512_core_scale_precompute_t *const jit_scale_precompute,
+        float scale_adjust_factor = 1.0f, bool req_transpose = false);
 } // namespace scale_utils
 
 struct jit_avx512_core_scale_precompute_t : public jit_generator_t {
@@ -110,10 +120,15 @@ private:
     Xbyak::Reg32 reg_mask_ = eax;
 
     const Xbyak::Opmask ktail_f32_mask_ = Xbyak::Opmask(1);
+    const Xbyak::Opmask knan_mask_ = Xbyak::Opmask(2);
 
     const Vmm vmm_dst_ = Vmm(0);
     const Vmm vmm_wei_scales_ = Vmm(1);
     const Vmm vmm_scale_factor_ = Vmm(2);
+    // e8m0 conversion constants: the encoding of NaN after the shift into
+    // the f32 exponent and the f32 NaN value to replace it with.
+    const Vmm vmm_e8m0_nan_ = Vmm(3);
+    const Vmm vmm_f32_nan_ = Vmm(4);
 
     void setup_mask();
     void store(const int offset_base, const bool compute_tail);
@@ -118,6 +118,26 @@ void jit_avx512_sparse_decompress_kernel_t::generate() {
         const int bitmask_off = blk_offset / CHAR_BIT;
         const int nbytes_per_load = 64;
 
+        if (is_2_4_) {
+            for (int i = 0; i < b_blk_sz_; i += unroll_factor()) {
+                for (int uf = 0; uf < unroll_factor(); uf++) {
+                    const int row_off = (i + uf) * nbytes_per_load;
+                    auto zmm_reg = get_zmm(uf);
+                    // The upper half of the register is zeroed by the load.
+                    vmovdqu8(Xbyak::Ymm(zmm_reg.getIdx()),
+                            ptr[reg_src_ptr + (blk_offset + row_off) / 2]);
+
+                    auto expand_mask = get_expand_mask(uf);
+                    kmovq(expand_mask,
+                            ptr[reg_bitmask_ptr + (i + uf) * sizeof(uint64_t)
+                                    + bitmask_off]);
+                    vpexpandb(zmm_reg | expand_mask | T_z, zmm_reg);
+                    vmovdqu8(ptr[reg_dst_ptr + blk_offset + row_off], zmm_reg);
+                }
+            }
+            continue;
+        }
+
         for (int i = 0; i < b_blk_sz_; i += unroll_factor()) {
             for (int uf = 0; uf < unroll_factor(); uf++) {
                 auto reg_mask_tmp = get_reg_mask_tmp(uf);
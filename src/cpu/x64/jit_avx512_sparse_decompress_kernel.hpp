@@ -37,7 +37,8 @@ struct jit_avx512_sparse_decompress_kernel_t : public jit_generator_t {
 
     jit_avx512_sparse_decompress_kernel_t(
             const matmul::brgemm_matmul_conf_t &bgmmc)
-        : jit_generator_t("brgemm_decompress", avx512_core_amx) {
+        : jit_generator_t("brgemm_decompress", avx512_core_amx)
+        , is_2_4_(bgmmc.packed_2_4_sparse_weights) {
         switch (bgmmc.wei_tag) {
             case format_tag::BA16a64b4a:
             case format_tag::aCB16b64c4b: b_blk_sz_ = 64; break;
@@ -70,6 +71,9 @@ struct jit_avx512_sparse_decompress_kernel_t : public jit_generator_t {
 private:
     status_t ctor_status_ = status::success;
 
+    // With 2:4 structured sparsity every 64-byte row keeps exactly 32 values
+    // so the packed values are read at fixed offsets without popcnt.
+    const bool is_2_4_;
     int nblks_to_decompress_ = 0;
     int blk_sz_ = 0;
     int b_blk_sz_ = 0;
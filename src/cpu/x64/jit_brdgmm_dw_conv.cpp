@@ -789,6 +789,68 @@ status_t brdgmm_dw_convolution_fwd_t::execute(const exec_ctx_t &ctx) const {
     });
     return status::success;
 }
+
+void brdgmm_dw_convolution_fwd_t::execute_fused_rows(const char *src,
+        const char *weights, const char *bias, char *dst, int n, int oh_s,
+        int oh_e) const {
+    const auto &jcp = pd()->jcp_;
+    assert(jcp.od == 1 && !jcp.with_scale);
+    assert(!jcp.src_zero_point && !jcp.dst_zero_point);
+
+    const int max_bs = jcp.kd * jcp.kh * jcp.kw;
+
+    const size_t src_w_stride = jcp.ngroups * jcp.src_dsz;
+    const size_t src_h_stride = jcp.ngroups * jcp.iw * jcp.src_dsz;
+    const size_t dst_h_stride = jcp.ngroups * jcp.ow * jcp.dst_dsz;
+    const size_t dst_mb_stride = jcp.ngroups * jcp.oh * jcp.ow * jcp.dst_dsz;
+
+    // Same batch element selection as in `execute()` for a full row.
+    const auto w_blk_info = get_blocks_info(jcp.iw, jcp.ow, jcp.kw,
+            jcp.stride_w, jcp.l_pad, jcp.r_pad, jcp.ow_block);
+    const auto h_blk_info = get_blocks_info(
+            jcp.ih, jcp.oh, jcp.kh, jcp.stride_h, jcp.t_pad, jcp.b_pad, 1);
+    const int n_w_blks = w_blk_info.n_lpad_blks;
+    const int n_h_blks = h_blk_info.n_lpad_blks
+            + nstl::max(0, jcp.oh - h_blk_info.rpad_blk_start_idx);
+    MAYBE_UNUSED(n_h_blks);
+
+    const int w_shift = jcp.ow_block * jcp.stride_w;
+    const int rpad_0
+            = (jcp.ow_block - 1) * jcp.stride_w + jcp.kw - (jcp.iw + jcp.l_pad);
+    const int rpad_1 = rpad_0 + (nstl::max(0, -rpad_0) / w_shift + 1) * w_shift;
+    const int n_rpad_blks
+            = 1 + nstl::max(0, div_up(jcp.r_pad - (rpad_1 - w_shift), w_shift));
+    const int rpad
+            = (jcp.ow - 1) * jcp.stride_w - jcp.l_pad + jcp.kw - jcp.iw;
+    const int rpad_i
+            = rpad <= rpad_1 - w_shift ? 0 : 1 + div_up(rpad - rpad_1, w_shift);
+
+    // The first kernel computes a full row for all the channels.
+    const brgemm_kernel_t *kernel = brdgmm_kernels_[0].get();
+    brgemm_post_ops_data_t post_ops_data;
+    post_ops_data.bias = bias;
+    post_ops_data.data_C_ptr_ = dst;
+
+    for (int oh = oh_s; oh < oh_e; oh++) {
+        const int ih_s = oh * jcp.stride_h - jcp.t_pad;
+        const int iw_s = -jcp.l_pad;
+        const int h_bi = nstl::min(oh, h_blk_info.n_lpad_blks - 1)
+                + nstl::max(0, oh - h_blk_info.rpad_blk_start_idx + 1);
+        const int bi = h_bi * n_w_blks * n_rpad_blks + rpad_i;
+        assert(h_bi < n_h_blks);
+        const brgemm_batch_element_t *brg_batch
+                = &(pd()->batches_[bi * max_bs]);
+        const int bs = pd()->bs_[bi];
+
+        auto *ptr_A = src
+                + static_cast<ptrdiff_t>(
+                        ih_s * src_h_stride + iw_s * src_w_stride);
+        auto *ptr_C = dst + n * dst_mb_stride + oh * dst_h_stride;
+        brgemm_kernel_execute_postops(kernel, bs, ptr_A, weights, brg_batch,
+                ptr_C, ptr_C, post_ops_data, nullptr);
+    }
+}
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
@@ -54,6 +54,14 @@ struct brdgmm_dw_convolution_fwd_t : public primitive_t {
     status_t init(engine_t *engine) override;
     status_t execute(const exec_ctx_t &ctx) const override;
 
+    // Computes output rows [oh_s, oh_e) of image `n` in the calling thread.
+    // Used when the convolution is fused as a depthwise post-op: `src` points
+    // to the beginning of the input image, only the input rows read by the
+    // requested output rows have to be valid. Scales and zero points are not
+    // supported.
+    void execute_fused_rows(const char *src, const char *weights,
+            const char *bias, char *dst, int n, int oh_s, int oh_e) const;
+
 private:
     std::vector<std::unique_ptr<brgemm_kernel_t>> brdgmm_kernels_;
     std::unique_ptr<jit_avx512_core_scale_precompute_t> jit_scale_precompute_;
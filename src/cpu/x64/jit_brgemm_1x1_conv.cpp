@@ -59,7 +59,8 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
 
     using skip_mask_t = primitive_attr_t::skip_mask_t;
     auto skip_mask = skip_mask_t::post_ops | skip_mask_t::sum_dt
-            | skip_mask_t::zero_points | skip_mask_t::fpmath_mode;
+            | skip_mask_t::zero_points | skip_mask_t::fpmath_mode
+            | skip_mask_t::accumulation_mode;
     if (is_int8 || is_fp8) skip_mask |= skip_mask_t::scales;
 
     VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
@@ -79,13 +80,29 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
     VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
     VDISPATCH_CONV(attr()->has_default_values(skip_mask, dst_type),
             VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_CONV(one_of(attr()->acc_mode_, accumulation_mode::strict,
+                           accumulation_mode::relaxed, accumulation_mode::any)
+                    || (attr()->acc_mode_ == accumulation_mode::f16
+                            && everyone_is(f16, src_type, wei_type)),
+            VERBOSE_UNSUPPORTED_ATTR);
     VDISPATCH_CONV(attr()->post_ops_.check_sum_consistency(dst_type, is_int8),
             VERBOSE_UNSUPPORTED_POSTOP);
     CHECK(attr_scales_ok());
     CHECK(attr_zero_points_ok());
 
+    if (with_dw_conv()) {
+        VDISPATCH_CONV(!is_int8 && !is_fp8, VERBOSE_UNSUPPORTED_FEATURE,
+                "depthwise post-op with quantized data types");
+        VDISPATCH_CONV(attr_1x1_.copy_from(*attr()) == status::success,
+                VERBOSE_UNSUPPORTED_ATTR);
+        attr_1x1_.post_ops_.entry_.resize(
+                attr()->post_ops_.find(primitive_kind::convolution));
+    }
+    auto &attr_1x1_conf = with_dw_conv() ? attr_1x1_ : attr_;
+
     CHECK(brgemm_convolution_utils::init_1x1_conf(jcp_, isa, *desc(), src_md_,
-            weights_md_, dst_md_, bias_md_, attr_, dnnl_get_max_threads()));
+            weights_md_, dst_md_, bias_md_, attr_1x1_conf,
+            dnnl_get_max_threads()));
 
     brgs_ = std::make_shared<brgemm_containers::brgemm_desc_container_t>(32);
 
@@ -159,6 +176,71 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
         book_precomputed_scales(
                 scratchpad, attr()->scales_, OC(), jcp_.scale_adjust_factor);
 
+    if (with_dw_conv()) CHECK(depthwise_po_init(engine));
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_1x1_convolution_fwd_t<isa>::pd_t::depthwise_po_init(
+        engine_t *engine) {
+    const auto &jcp = jcp_;
+
+    VDISPATCH_CONV_IC(jcp.ngroups == 1, VERBOSE_UNSUPPORTED_FEATURE,
+            "groups with depthwise post-op");
+    // The intermediate rows are not stored to the user memory, binary
+    // post-ops offsets and sum are not defined for them.
+    VDISPATCH_CONV_IC(attr_1x1_.post_ops_.has_default_values(
+                              {primitive_kind::eltwise}),
+            VERBOSE_UNSUPPORTED_POSTOP);
+
+    convolution_desc_t cd_dw;
+    primitive_attr_t attr_dw;
+    CHECK(get_depthwise_conv_desc(cd_dw, dst_md_, *attr(), attr_dw,
+            attr()->post_ops_.find(primitive_kind::convolution)));
+    VDISPATCH_CONV_IC(
+            attr_dw.post_ops_.has_default_values({primitive_kind::eltwise}),
+            VERBOSE_UNSUPPORTED_POSTOP);
+
+    auto dw_pd = make_unique_pd<dw_pd_t>(&cd_dw, &attr_dw, nullptr);
+    if (!dw_pd || !dw_pd->is_initialized()) return status::out_of_memory;
+    CHECK(dw_pd->init(engine));
+    VDISPATCH_CONV_IC(dnnl_memory_desc_equal(&dst_md_, dw_pd->src_md(0)),
+            VERBOSE_INCONSISTENT_MDS, "dst_md", "dw_conv_pd_->src_md");
+    const auto &jcp_dw = dw_pd->jcp_;
+
+    // Size the tiles so that the intermediate rows stay in L2. With os
+    // blocking a tile is extended to whole os blocks, require enough rows to
+    // keep the recomputed part small.
+    const size_t row_size = static_cast<size_t>(jcp.ow) * jcp.oc_without_padding
+            * types::data_type_size(dst_md_.data_type);
+    const int os_block_rows
+            = jcp.is_os_blocking ? div_up(jcp.os_block, jcp.ow) : 0;
+    const int min_rows_in = nstl::max(jcp_dw.kh, 4 * os_block_rows);
+    const int l2_rows_in = static_cast<int>(
+            platform::get_per_core_cache_size(2) / 2 / row_size);
+    const int rows_in = nstl::max(min_rows_in, l2_rows_in);
+    int rows = nstl::max(1, (rows_in - jcp_dw.kh) / jcp_dw.stride_h + 1);
+    // Keep all the threads busy.
+    const int min_rows = nstl::max(
+            1, (min_rows_in - jcp_dw.kh) / jcp_dw.stride_h + 1);
+    const int thr_rows = div_up(jcp_dw.oh, div_up(jcp.nthr, jcp.mb));
+    rows = nstl::min(rows, nstl::max(min_rows, thr_rows));
+    dw_rows_per_tile_ = nstl::min(rows, jcp_dw.oh);
+
+    const int tile_rows_in = (dw_rows_per_tile_ - 1) * jcp_dw.stride_h
+            + jcp_dw.kh;
+    const size_t os_block_slack = jcp.is_os_blocking ? 2 * jcp.os_block : 0;
+    dw_buffer_per_thr_ = utils::rnd_up(tile_rows_in * row_size
+                    + os_block_slack * jcp.oc_without_padding
+                            * types::data_type_size(dst_md_.data_type),
+            platform::get_cache_line_size());
+
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<char>(
+            key_fusion_inout_buffer, dw_buffer_per_thr_ * jcp.nthr);
+
+    dw_conv_pd_ = std::move(dw_pd);
     return status::success;
 }
 
@@ -213,6 +295,7 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::pd_t::init_brgemm_desc() {
         brgattr.use_interleave_stores = jcp_.use_interleave_stores;
         brgattr.hint_prefetching = jcp_.hint_prefetching;
         brgattr.fpmath_mode = attr()->fpmath_.mode_;
+        brgattr.acc_mode = attr()->acc_mode_;
         // if post-ops are required and there are no intermediate calculations
         // (like ic_chunks > 1) then we don't need code without post-ops in
         // brgemm kernel
@@ -221,11 +304,11 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::pd_t::init_brgemm_desc() {
 
         CHECK(brgemm_desc_set_attr(&brg, brgattr));
         auto LDD = jcp_.oc_without_padding;
-        const auto &p = attr()->post_ops_;
+        const auto &p = attr_1x1()->post_ops_;
         brg.with_sum = p.find(primitive_kind::sum) != -1;
         brg.with_weights_scale_adjust = jcp_.scale_adjust_factor != 1.0f;
         CHECK(brgemm_desc_set_postops(
-                &brg, attr(), &dst_md_, LDD, jcp_.bia_dt));
+                &brg, attr_1x1(), &dst_md_, LDD, jcp_.bia_dt));
         CHECK(brgemm_desc_finalize(&brg));
 
         jcp_.amx_buf_size_per_thread = nstl::max(
@@ -300,6 +383,12 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::init(engine_t *engine) {
         }
     }
 
+    if (pd()->dw_conv_pd_) {
+        CHECK(safe_ptr_assign(dw_conv_p_,
+                new brdgmm_dw_convolution_fwd_t(pd()->dw_conv_pd_.get())));
+        CHECK(dw_conv_p_->init(engine));
+    }
+
     for (auto &params : pd()->brgemm_init_params_) {
         const auto brg_idx = get_brg_idx(jcp, params);
         const auto &brgs = *(pd()->brgs_);
@@ -414,7 +503,7 @@ void brgemm_1x1_convolution_fwd_t<isa>::exec_ker(
 
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper weights_d(pd()->weights_md());
-    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper dst_d(pd()->dst_1x1_md());
     const size_t src_dt_size = types::data_type_size(src_d.data_type());
     const size_t wei_dt_size = types::data_type_size(weights_d.data_type());
     const size_t dst_dt_size = types::data_type_size(dst_d.data_type());
@@ -715,6 +804,130 @@ void brgemm_1x1_convolution_fwd_t<isa>::execute_full_spatial(
     });
 }
 
+template <cpu_isa_t isa>
+void brgemm_1x1_convolution_fwd_t<isa>::execute_fused_dw(
+        const exec_ctx_t &ctx, const brgemm_exec_ctx_t &brgemm_ctx,
+        brgemm_batch_element_t *const brg_batch_global, const float *dst_scales,
+        const float *oscales, const int32_t *src_zero_points,
+        int32_t *src_zp_comp, const int32_t *dst_zero_points,
+        int32_t *s8s8_compensation, char *const c_buffer_global,
+        char *inp_buffer_base, uint8_t *inp_buffer_mask_base) const {
+
+    const auto &jcp = pd()->jcp_;
+    const auto &jcp_dw = pd()->dw_conv_pd_->jcp_;
+    const bool is_amx = brgemm_convolution_utils::is_amx(isa);
+
+    const auto weights_dw = CTX_IN_MEM(
+            const char *, DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS);
+    const auto bias_dw = CTX_IN_MEM(
+            const char *, DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS);
+    char *const dw_buffer_global
+            = ctx.get_scratchpad_grantor().template get<char>(
+                    key_fusion_inout_buffer);
+
+    const memory_desc_wrapper dst_d(pd()->dst_1x1_md());
+    const size_t dst_dsz = types::data_type_size(dst_d.data_type());
+
+    const int rows = pd()->dw_rows_per_tile_;
+    const int nb_rows = div_up(jcp_dw.oh, rows);
+    const int work_amount = jcp.mb * nb_rows;
+
+    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+        if (ithr >= work_amount) return;
+        brgemm_batch_element_t *const brg_batch
+                = brg_batch_global + (size_t)ithr * jcp.adjusted_batch_size;
+        char *const c_buffer = (jcp.use_buffer)
+                ? c_buffer_global + ithr * acc_dsz * jcp.LDC * jcp.M
+                : nullptr;
+        char *inp_buffer = (jcp.is_rtus)
+                ? inp_buffer_base + ithr * src_dsz * jcp.inp_buffer_size
+                : nullptr;
+        uint8_t *__restrict inp_buffer_mask = (jcp.is_rtus)
+                ? inp_buffer_mask_base + ithr * jcp.inp_buffer_mask_size
+                : nullptr;
+        char *const dw_buffer
+                = dw_buffer_global + ithr * pd()->dw_buffer_per_thr_;
+        int last_n = -1;
+        int last_brg_idx = -1;
+        int start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        int n {0}, rb {0};
+        nd_iterator_init(start, n, jcp.mb, rb, nb_rows);
+
+        for (auto work = start; work < end; work++) {
+            if (jcp.is_rtus && last_n != n)
+                std::memset(inp_buffer_mask, 0, jcp.inp_buffer_mask_size);
+
+            // Rows of the 1x1 output read by the tile of depthwise rows.
+            const int dw_oh_s = rb * rows;
+            const int dw_oh_e = nstl::min(dw_oh_s + rows, jcp_dw.oh);
+            const int oh_s = nstl::max(
+                    0, dw_oh_s * jcp_dw.stride_h - jcp_dw.t_pad);
+            const int oh_e = nstl::min(OH,
+                    (dw_oh_e - 1) * jcp_dw.stride_h - jcp_dw.t_pad
+                            + jcp_dw.kh);
+
+            // Spatial blocks covering these rows, the buffer starts at
+            // `os_start`.
+            int sb_s {0}, sb_e {0}, os_start {0};
+            if (jcp.is_os_blocking) {
+                sb_s = oh_s * OW / jcp.os_block;
+                sb_e = div_up(oh_e * OW, jcp.os_block);
+                os_start = sb_s * jcp.os_block;
+            } else {
+                sb_s = oh_s * jcp.nb_ow;
+                sb_e = oh_e * jcp.nb_ow;
+                os_start = oh_s * OW;
+            }
+
+            // Offsets computed by `exec_ker()` for the 1x1 destination are
+            // relative to the image, shift them to the buffer.
+            const dim_t buf_shift = dst_d.off_l(0)
+                    + n * dst_d.blk_off<false, true>(1)
+                    + (dim_t)os_start * jcp.oc_without_padding;
+            const brgemm_exec_ctx_t buf_ctx(
+                    brgemm_ctx, dw_buffer - dst_dsz * buf_shift);
+
+            for (int sb = sb_s; sb < sb_e; sb++) {
+                int oh {0}, ow {0};
+                bool is_last_os = false;
+                if (jcp.is_os_blocking) {
+                    const int os = sb * jcp.os_block;
+                    oh = os / OW;
+                    ow = os % OW;
+                    is_last_os = sb == jcp.nb_os - 1;
+                } else {
+                    oh = sb / jcp.nb_ow;
+                    ow = (sb % jcp.nb_ow) * jcp.ow_block;
+                }
+                const size_t rtus_offset = jcp.is_reduced_rtus
+                        ? 0
+                        : src_dsz * ((size_t)oh * OW + ow) * jcp.LDA;
+                char *inp_buffer_sp
+                        = jcp.is_rtus ? inp_buffer + rtus_offset : nullptr;
+                for_(int ocb = 0; ocb < jcp.nb_oc; ocb++)
+                for (int icc = 0; icc < pd()->ic_chunks_; icc++) {
+                    if (jcp.is_rtus)
+                        maybe_rtus(ithr, brgemm_ctx.src, inp_buffer_sp,
+                                inp_buffer_mask, 0, n, icc, 0, oh, ow);
+                    exec_ker(buf_ctx, ithr, brg_batch, c_buffer, inp_buffer_sp,
+                            0, n, ocb, 0, oh, ow, icc, &last_brg_idx, oscales,
+                            src_zero_points, src_zp_comp, dst_zero_points,
+                            s8s8_compensation, dst_scales, is_last_os);
+                }
+            }
+
+            dw_conv_p_->execute_fused_rows(
+                    dw_buffer - dst_dsz * os_start * jcp.oc_without_padding,
+                    weights_dw, bias_dw, brgemm_ctx.dst, n, dw_oh_s, dw_oh_e);
+
+            last_n = n;
+            nd_iterator_step(n, jcp.mb, rb, nb_rows);
+        }
+        if (is_amx) amx_tile_release();
+    });
+}
+
 template <cpu_isa_t isa>
 status_t brgemm_1x1_convolution_fwd_t<isa>::execute_forward_all(
         const exec_ctx_t &ctx) const {
@@ -769,7 +982,12 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::execute_forward_all(
             ? scratchpad.template get<uint8_t>(key_conv_brgemm_inp_buffer_mask)
             : nullptr;
 
-    if (jcp.is_os_blocking) {
+    if (pd()->dw_conv_pd_) {
+        execute_fused_dw(ctx, brgemm_ctx, brg_batch_global, dst_scales,
+                oscales, src_zero_points, zp_compensation, dst_zero_points,
+                s8s8_compensation, c_buffer_global, inp_buffer_base,
+                inp_buffer_mask_base);
+    } else if (jcp.is_os_blocking) {
         execute_os_blocking(brgemm_ctx, brg_batch_global, dst_scales, oscales,
                 src_zero_points, zp_compensation, dst_zero_points,
                 s8s8_compensation, c_buffer_global, inp_buffer_base,
@@ -26,6 +26,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/cpu_convolution_pd.hpp"
+#include "cpu/dw_convolution_utils.hpp"
 #include "cpu/platform.hpp"
 
 #include "cpu/x64/amx_tile_configure.hpp"
@@ -34,6 +35,7 @@
 #include "cpu/x64/cpu_barrier.hpp"
 #include "cpu/x64/cpu_reducer.hpp"
 #include "cpu/x64/jit_avx512_core_scale_precompute.hpp"
+#include "cpu/x64/jit_brdgmm_dw_conv.hpp"
 #include "cpu/x64/jit_brgemm_conv_trans_kernel.hpp"
 #include "cpu/x64/jit_brgemm_conv_utils.hpp"
 #include "cpu/x64/jit_brgemm_post_ops.hpp"
@@ -68,6 +70,47 @@ struct brgemm_1x1_convolution_fwd_t : public primitive_t {
             bool wary_tail_read_ {false};
         };
 
+        const memory_desc_t *dst_1x1_md(int index = 0) const {
+            return cpu_convolution_fwd_pd_t::dst_md(index);
+        }
+
+        // NOLINTBEGIN(google-default-arguments)
+        const memory_desc_t *dst_md(
+                int index = 0, bool user_input = false) const override {
+            return dw_conv_pd_
+                    ? dw_conv_pd_->dst_md(index, user_input)
+                    : cpu_convolution_fwd_pd_t::dst_md(index, user_input);
+        }
+
+        const memory_desc_t *arg_md(
+                int arg, bool user_input = false) const override {
+            if (dw_conv_pd_) {
+                switch (arg) {
+                    case DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_SRC:
+                        return cpu_convolution_fwd_pd_t::dst_md(0, user_input);
+                    case DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS:
+                        return dw_conv_pd_->weights_md(0);
+                    case DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS:
+                        return dw_conv_pd_->weights_md(1);
+                    default: break;
+                }
+            }
+            return convolution_fwd_pd_t::arg_md(arg, user_input);
+        }
+        // NOLINTEND(google-default-arguments)
+
+        arg_usage_t arg_usage(int arg) const override {
+            if (arg == (DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS))
+                return dw_conv_pd_ ? arg_usage_t::input : arg_usage_t::unused;
+
+            if (arg == (DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS))
+                return dw_conv_pd_ && dw_conv_pd_->with_bias()
+                        ? arg_usage_t::input
+                        : arg_usage_t::unused;
+
+            return convolution_fwd_pd_t::arg_usage(arg);
+        }
+
         std::shared_ptr<brgemm_containers::brgemm_desc_container_t> brgs_;
         std::forward_list<brgemm_init_params_t> brgemm_init_params_;
 
@@ -76,8 +119,27 @@ struct brgemm_1x1_convolution_fwd_t : public primitive_t {
 
         jit_brgemm_conv_conf_t jcp_ = utils::zero<decltype(jcp_)>();
 
+        // Fused depthwise convolution post-op. The 1x1 convolution computes
+        // the rows read by a tile of `dw_rows_per_tile_` depthwise output
+        // rows into a per-thread buffer, which is sized to stay in L2.
+        using dw_pd_t = brdgmm_dw_convolution_fwd_t::pd_t;
+        std::shared_ptr<dw_pd_t> dw_conv_pd_;
+        // Attributes of the 1x1 convolution itself, i.e. without the
+        // depthwise post-op and the post-ops following it.
+        primitive_attr_t attr_1x1_;
+        int dw_rows_per_tile_ = 0;
+        size_t dw_buffer_per_thr_ = 0;
+
     private:
+        bool with_dw_conv() const {
+            return attr()->post_ops_.find(primitive_kind::convolution) != -1;
+        }
+        const primitive_attr_t *attr_1x1() const {
+            return with_dw_conv() ? &attr_1x1_ : attr();
+        }
+
         status_t init_brgemm_desc();
+        status_t depthwise_po_init(engine_t *engine);
     };
 
     brgemm_1x1_convolution_fwd_t(const pd_t *apd)
@@ -108,6 +170,15 @@ private:
                       pd->attr()->post_ops_, ctx))
             , wsp_tile(ctx.get_scratchpad_grantor().template get<char>(
                       memory_tracking::names::key_conv_amx_tile_buffer)) {}
+        // Redirects the destination to `dst`, used to compute the 1x1
+        // convolution into the buffer of a fused depthwise convolution.
+        brgemm_exec_ctx_t(const brgemm_exec_ctx_t &other, char *dst)
+            : src(other.src)
+            , weights(other.weights)
+            , bias(other.bias)
+            , dst(dst)
+            , post_ops_binary_rhs_arg_vec(other.post_ops_binary_rhs_arg_vec)
+            , wsp_tile(other.wsp_tile) {}
         const char *const __restrict src;
         const char *const __restrict weights;
         const char *const __restrict bias;
@@ -141,6 +212,15 @@ private:
             const int32_t *dst_zero_points, int32_t *s8s8_compensation,
             char *const c_buffer_global) const;
 
+    void execute_fused_dw(const exec_ctx_t &ctx,
+            const brgemm_exec_ctx_t &brgemm_ctx,
+            brgemm_batch_element_t *const brg_batch_global,
+            const float *dst_scales, const float *oscales,
+            const int32_t *src_zero_points, int32_t *src_zp_comp,
+            const int32_t *dst_zero_points, int32_t *s8s8_compensation,
+            char *const c_buffer_global, char *inp_buffer_base,
+            uint8_t *inp_buffer_mask_base) const;
+
     status_t execute_forward_all(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
@@ -189,6 +269,7 @@ private:
                     jit_avx512_core_brgemm_conv_rtus_kernel_t>
             rtus_kernel_;
     std::unique_ptr<jit_avx512_core_scale_precompute_t> jit_scale_precompute_;
+    std::unique_ptr<brdgmm_dw_convolution_fwd_t> dw_conv_p_;
 
     const memory_desc_wrapper bias_d;
 
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/type_helpers.hpp"
@@ -311,8 +313,11 @@ status_t brgemm_convolution_fwd_t<isa>::pd_t::add_brg_descriptor(int vM,
     } else {
         brgattr.max_top_vpad = jcp_.max_vpad;
         brgattr.max_bottom_vpad = jcp_.max_vpad;
+        // Virtual padding generates several copies of the stores.
+        brgattr.share_post_ops = jcp_.max_vpad > 0;
     }
     brgattr.fpmath_mode = attr()->fpmath_.mode_;
+    brgattr.acc_mode = attr()->acc_mode_;
     brgattr.K_koef = (float)bs / KW;
 
     CHECK(brgemm_desc_set_attr(&brg, brgattr));
@@ -364,7 +369,8 @@ status_t brgemm_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
 
     using skip_mask_t = primitive_attr_t::skip_mask_t;
     auto skip_mask = skip_mask_t::post_ops | skip_mask_t::sum_dt
-            | skip_mask_t::zero_points | skip_mask_t::fpmath_mode;
+            | skip_mask_t::zero_points | skip_mask_t::fpmath_mode
+            | skip_mask_t::accumulation_mode;
     if (is_int8 || is_fp8) skip_mask |= skip_mask_t::scales;
 
     VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
@@ -381,6 +387,11 @@ status_t brgemm_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
     VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
     VDISPATCH_CONV(attr()->has_default_values(skip_mask, dst_type),
             VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_CONV(one_of(attr()->acc_mode_, accumulation_mode::strict,
+                           accumulation_mode::relaxed, accumulation_mode::any)
+                    || (attr()->acc_mode_ == accumulation_mode::f16
+                            && everyone_is(f16, src_type, wei_type)),
+            VERBOSE_UNSUPPORTED_ATTR);
     VDISPATCH_CONV(attr()->post_ops_.check_sum_consistency(dst_type, is_int8),
             VERBOSE_UNSUPPORTED_POSTOP);
     CHECK(attr_scales_ok());
@@ -700,19 +711,68 @@ brgemm_convolution_fwd_t<isa>::brgemm_convolution_fwd_t(const pd_t *apd)
     : primitive_t(apd), bias_d(pd()->weights_md(1)) {}
 
 template <cpu_isa_t isa>
-status_t brgemm_convolution_fwd_t<isa>::add_brg_kernel(int brg_idx) {
+void brgemm_convolution_fwd_t<isa>::get_brg_kernel_descs(
+        std::vector<int> &brg_idxs,
+        std::vector<const brgemm_desc_t *> &brg_descs) const {
     const auto _pd = pd();
     const auto &brgs = *(_pd->brgemm_descriptors_);
 
-    auto brg = brgs[brg_idx];
-    if (!brgemm_kernels_[brg_idx] && brg && brg->bcast_dim > 0
-            && brg->load_dim > 0 && brg->reduce_dim > 0) {
-        CHECK(brgemm_kernels_.insert(brg_idx, brg));
-        if (is_amx) brgemm_palettes_.insert(brg_idx, brg);
+    brg_idxs.clear();
+    brg_descs.clear();
+    for (const auto &key_value_pair : _pd->brg_indices) {
+        const int brg_idx = key_value_pair.second;
+        auto brg = brgs[brg_idx];
+        if (brg && brg->bcast_dim > 0 && brg->load_dim > 0
+                && brg->reduce_dim > 0
+                && std::find(brg_idxs.begin(), brg_idxs.end(), brg_idx)
+                        == brg_idxs.end()) {
+            brg_idxs.push_back(brg_idx);
+            brg_descs.push_back(brg);
+        }
+    }
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_convolution_fwd_t<isa>::add_brg_kernels() {
+    std::vector<int> brg_idxs;
+    std::vector<const brgemm_desc_t *> brg_descs;
+    get_brg_kernel_descs(brg_idxs, brg_descs);
+
+    // The kernels are generated in parallel, or restored from the cache blob.
+    CHECK(brgemm_kernels_.insert(brg_idxs, brg_descs, cache_blob()));
+    if (is_amx) {
+        for (size_t i = 0; i < brg_idxs.size(); i++)
+            brgemm_palettes_.insert(brg_idxs[i], brg_descs[i]);
     }
     return status::success;
 }
 
+template <cpu_isa_t isa>
+status_t brgemm_convolution_fwd_t<isa>::get_cache_blob_size(
+        engine_t *engine, size_t *size) const {
+    std::vector<int> brg_idxs;
+    std::vector<const brgemm_desc_t *> brg_descs;
+    get_brg_kernel_descs(brg_idxs, brg_descs);
+    std::vector<const brgemm_kernel_t *> kernels;
+    for (const int idx : brg_idxs)
+        kernels.push_back(brgemm_kernels_[idx]);
+    return brgemm_containers::get_kernels_cache_blob_size(kernels, size);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_convolution_fwd_t<isa>::get_cache_blob(
+        engine_t *engine, cache_blob_t &cache_blob) const {
+    // The entries follow the order in which `add_brg_kernels()` restores the
+    // kernels.
+    std::vector<int> brg_idxs;
+    std::vector<const brgemm_desc_t *> brg_descs;
+    get_brg_kernel_descs(brg_idxs, brg_descs);
+    std::vector<const brgemm_kernel_t *> kernels;
+    for (const int idx : brg_idxs)
+        kernels.push_back(brgemm_kernels_[idx]);
+    return brgemm_containers::get_kernels_cache_blob(kernels, cache_blob);
+}
+
 template <cpu_isa_t isa>
 status_t brgemm_convolution_fwd_t<isa>::add_po_kernel(
         brgemm_desc_t *bcfg, int ker_idx, bool is_init) {
@@ -727,12 +787,36 @@ status_t brgemm_convolution_fwd_t<isa>::add_po_kernel(
     bcfg->typesize_D = types::data_type_size(bcfg->dt_d);
     bcfg->alpha = !is_init && IMPLICATION(jcp.with_sum, jcp.use_buffer);
     bcfg->beta = is_init ? 0 : 1;
+    if (is_lazy_po_kernels_) {
+        po_kernel_descs_[ker_idx] = utils::make_unique<brgemm_desc_t>(*bcfg);
+        return status::success;
+    }
+    return create_po_kernel(*bcfg, ker_idx);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_convolution_fwd_t<isa>::create_po_kernel(
+        const brgemm_desc_t &bcfg, int ker_idx) const {
     // See the comment in `add_po_kernels` why `*_pd->attr()` is needed so far.
     CHECK(safe_ptr_assign(kernels_po_[ker_idx],
             jit_brgemm_kernel_post_ops_base_t::create(
-                    isa, *bcfg, *_pd->attr())));
-    kernels_po_[ker_idx]->generate_kernel();
-    return status::success;
+                    isa, bcfg, *pd()->attr())));
+    return kernels_po_[ker_idx]->generate_kernel();
+}
+
+template <cpu_isa_t isa>
+const jit_brgemm_kernel_post_ops_base_t *
+brgemm_convolution_fwd_t<isa>::get_po_kernel(int ker_idx) const {
+    if (is_lazy_po_kernels_ && po_kernel_descs_[ker_idx]) {
+        std::call_once(po_kernel_once_[ker_idx], [&] {
+            const size_t footprint_start = get_reported_primitive_footprint();
+            if (create_po_kernel(*po_kernel_descs_[ker_idx], ker_idx)
+                    != status::success)
+                kernels_po_[ker_idx].reset();
+            add_footprint(get_reported_primitive_footprint() - footprint_start);
+        });
+    }
+    return kernels_po_[ker_idx].get();
 }
 
 template <cpu_isa_t isa>
@@ -746,6 +830,11 @@ void brgemm_convolution_fwd_t<isa>::add_po_kernels(
     if (N <= 0) return;
     auto i_K = (jcp.K_tail > 0);
 
+    const auto has_po_kernel = [&](int ker_idx) {
+        return is_lazy_po_kernels_ ? po_kernel_descs_[ker_idx] != nullptr
+                                   : kernels_po_[ker_idx] != nullptr;
+    };
+
     const auto brg_idx = _pd->get_any_brg_idx(i_N, i_K);
 
     if (init_bcast_dim > 0) {
@@ -764,7 +853,7 @@ void brgemm_convolution_fwd_t<isa>::add_po_kernels(
             // sub-calls and a developer should be careful about that.
             auto init_cfg = *(brgs[brg_idx]);
             auto ker_init_idx = get_ker_po_idx(init_bcast_dim - 1, false, i_N);
-            if (init_cfg.load_dim > 0 && kernels_po_[ker_init_idx] == nullptr) {
+            if (init_cfg.load_dim > 0 && !has_po_kernel(ker_init_idx)) {
                 init_cfg.bcast_dim = init_bcast_dim;
                 add_po_kernel(&init_cfg, ker_init_idx, true);
             }
@@ -775,7 +864,7 @@ void brgemm_convolution_fwd_t<isa>::add_po_kernels(
         if (brgs[brg_idx]) {
             auto po_cfg = *(brgs[brg_idx]);
             auto ker_po_idx = get_ker_po_idx(po_bcast_dim - 1, true, i_N);
-            if (po_cfg.load_dim > 0 && kernels_po_[ker_po_idx] == nullptr) {
+            if (po_cfg.load_dim > 0 && !has_po_kernel(ker_po_idx)) {
                 po_cfg.bcast_dim = po_bcast_dim;
                 add_po_kernel(&po_cfg, ker_po_idx, false);
             }
@@ -924,6 +1013,11 @@ status_t brgemm_convolution_fwd_t<isa>::init(engine_t *engine) {
 
     int num_po_kernels = nstl::max(jcp.M, jcp.M_tail);
     kernels_po_.resize(num_po_kernels * 2 * 2);
+    is_lazy_po_kernels_ = get_jit_lazy_kernels();
+    if (is_lazy_po_kernels_) {
+        po_kernel_descs_.resize(kernels_po_.size());
+        po_kernel_once_.reset(new std::once_flag[kernels_po_.size()]);
+    }
 
     if (jcp.exec_type == exec_trans) {
         CHECK(safe_ptr_assign(copy_to_pbuffer_,
@@ -1022,10 +1116,7 @@ status_t brgemm_convolution_fwd_t<isa>::init(engine_t *engine) {
 
     is_amx = brgemm_convolution_utils::is_amx(isa);
 
-    for (const auto &key_value_pair : _pd->brg_indices) {
-        const int brg_idx = key_value_pair.second;
-        add_brg_kernel(brg_idx);
-    }
+    CHECK(add_brg_kernels());
 
     for_(int i_N = N_begin; i_N < N_end; i_N++)
     for (int i_M = M_begin; i_M < M_end; i_M++) {
@@ -1350,6 +1441,8 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
     // or made ic_chunks = 1 if use_buffer
     // or (looks more general) increase buffer size to store several rows
 
+    // Set when a lazily generated kernel fails to be created.
+    std::atomic<status_t> status {status::success};
     parallel(jcp.nthr, [&](const int ithr, const int nthr) {
         if (ithr >= work_amount) return;
 
@@ -1426,15 +1519,17 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
                 btc.oh = oh;
                 btc.icc = icc;
 
+                status_t st = status::success;
                 if (jcp.exec_type == exec_base) {
-                    ker_base(btc);
+                    st = ker_base(btc);
                 } else if (jcp.exec_type == exec_trans) {
                     maybe_conv_inp(btc, last_btc, src);
-                    ker_trans(btc);
+                    st = ker_trans(btc);
                 } else if (jcp.exec_type == exec_vpad) {
-                    ker_vpad(btc);
+                    st = ker_vpad(btc);
                 } else
                     assert(!"Unknown exec type");
+                if (st != status::success) status = st;
                 last_btc.n = n;
                 last_btc.g = g;
                 last_btc.icc = icc;
@@ -1447,6 +1542,8 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
         if (is_amx) { amx_tile_release(); }
     });
 
+    CHECK(status.load());
+
     if (_pd->wants_zero_pad_dst()) ctx.memory(DNNL_ARG_DST)->zero_pad(ctx);
 
     return status::success;
@@ -1569,7 +1666,7 @@ status_t brgemm_convolution_fwd_t<isa>::cal_compensation(
 }
 
 template <cpu_isa_t isa>
-void brgemm_convolution_fwd_t<isa>::perform_outwork(
+status_t brgemm_convolution_fwd_t<isa>::perform_outwork(
         const brgemm_thread_ctx_t &btc, char *dst_base, const char *bias_w,
         int ow, int g_oc, bool is_oc_tail, int ker_ow_s, int ker_ow_f, int kd_l,
         int kh_l, bool maybe_do_init, bool do_postwork, size_t comp_ker_offs,
@@ -1580,7 +1677,7 @@ void brgemm_convolution_fwd_t<isa>::perform_outwork(
 
     const auto do_init
             = maybe_do_init && IMPLICATION(jcp.with_sum, jcp.use_buffer);
-    if (!do_init && !do_postwork) return;
+    if (!do_init && !do_postwork) return status::success;
 
     const bool is_ow_tail = (OW - ow < jcp.ow_block);
 
@@ -1603,11 +1700,12 @@ void brgemm_convolution_fwd_t<isa>::perform_outwork(
     }
 
     auto call_outwork_ker = [&](bool is_postwork, bool has_postcomp,
-                                    int ow_pw_s, int ow_pw_l) {
+                                    int ow_pw_s, int ow_pw_l) -> status_t {
         auto ker_po_idx = get_ker_po_idx(ow_pw_l - 1, is_postwork, is_oc_tail);
-        const auto &outwork_ker = kernels_po_[ker_po_idx].get();
-        assert(outwork_ker != nullptr
-                && ow_pw_l == outwork_ker->get_bcast_dim());
+        const auto &outwork_ker = get_po_kernel(ker_po_idx);
+        // A lazily generated kernel is null if its generation failed.
+        if (outwork_ker == nullptr) return status::out_of_memory;
+        assert(ow_pw_l == outwork_ker->get_bcast_dim());
         if (is_postwork) {
             p.apply_comp = has_postcomp;
             p.a_zp_compensation = has_postcomp && jcp.src_zero_point
@@ -1636,20 +1734,24 @@ void brgemm_convolution_fwd_t<isa>::perform_outwork(
             p.ptr_out = static_cast<void *>(ptr_Cz);
         }
         (*outwork_ker)(&p);
+        return status::success;
     };
 
     if (ow < ow_s) {
         // left side
         const auto ow_pw_l = ow_s - ow;
-        if (do_init) call_outwork_ker(false, false, ow, ow_pw_l);
-        if (do_postwork) call_outwork_ker(true, do_post_comp, ow, ow_pw_l);
+        if (do_init) CHECK(call_outwork_ker(false, false, ow, ow_pw_l));
+        if (do_postwork)
+            CHECK(call_outwork_ker(true, do_post_comp, ow, ow_pw_l));
     }
     if (ow_f < ow + M) {
         // right side
         const auto ow_pw_l = ow + M - ow_f;
-        if (do_init) call_outwork_ker(false, false, ow_f, ow_pw_l);
-        if (do_postwork) call_outwork_ker(true, do_post_comp, ow_f, ow_pw_l);
+        if (do_init) CHECK(call_outwork_ker(false, false, ow_f, ow_pw_l));
+        if (do_postwork)
+            CHECK(call_outwork_ker(true, do_post_comp, ow_f, ow_pw_l));
     }
+    return status::success;
 }
 
 template <cpu_isa_t isa>
@@ -2027,7 +2129,8 @@ void brgemm_convolution_fwd_t<isa>::maybe_conv_inp(brgemm_thread_ctx_t &btc,
     int kd_b(0), kd_e(0), kh_b(0), kh_e(0), k_l(0), iiw_b(0);
 
 template <cpu_isa_t isa>
-void brgemm_convolution_fwd_t<isa>::ker_base(brgemm_thread_ctx_t &btc) const {
+status_t brgemm_convolution_fwd_t<isa>::ker_base(
+        brgemm_thread_ctx_t &btc) const {
 
     const auto _pd = pd();
     const auto &jcp = _pd->jcp_;
@@ -2075,8 +2178,8 @@ void brgemm_convolution_fwd_t<isa>::ker_base(brgemm_thread_ctx_t &btc) const {
                 bias_w, g_oc, do_postops, comp_ker_offs, do_only_comp);
     };
 
-    const auto kdhw_loop = [&]() {
-        if (kw_e - kw_b <= 0) return;
+    const auto kdhw_loop = [&]() -> status_t {
+        if (kw_e - kw_b <= 0) return status::success;
         brgemm_convolution_utils::get_ow_range(jcp, ow, kw_b, ow_b, ow_e);
         const auto do_init
                 = btc.icc == 0 && kd_b == kd_s && kh_b == kh_s && kw_b == kw_s;
@@ -2084,7 +2187,8 @@ void brgemm_convolution_fwd_t<isa>::ker_base(brgemm_thread_ctx_t &btc) const {
                 && btc.icc == (_pd->ic_chunks - 1) && kd_e == kd_f
                 && kh_e == kh_f && kw_e == kw_f;
         const auto do_post_comp = do_postwork && need_compensation;
-        if (ow_e - ow_b <= 0 && !do_init && !do_postwork) return;
+        if (ow_e - ow_b <= 0 && !do_init && !do_postwork)
+            return status::success;
 
         iiw_b = ow_b * SW - LP;
         ptr_D = dst_base
@@ -2122,9 +2226,9 @@ void brgemm_convolution_fwd_t<isa>::ker_base(brgemm_thread_ctx_t &btc) const {
 
         const auto post_comp_ker_offs = get_comp_offset(
                 btc.g, btc.ocb, 0, 0, kd_s, kd_f, kh_s, kh_f, 0, KW);
-        perform_outwork(btc, dst_base, bias_w, ow, g_oc, is_oc_tail, ow_b, ow_e,
-                kd_l, kh_l, do_init, do_postwork, post_comp_ker_offs,
-                do_post_comp);
+        return perform_outwork(btc, dst_base, bias_w, ow, g_oc, is_oc_tail,
+                ow_b, ow_e, kd_l, kh_l, do_init, do_postwork,
+                post_comp_ker_offs, do_post_comp);
     };
 
     if (kd_f > kd_s && kh_f > kh_s && kw_f > kw_s) {
@@ -2137,7 +2241,7 @@ void brgemm_convolution_fwd_t<isa>::ker_base(brgemm_thread_ctx_t &btc) const {
                     for (auto kw = kw_s; kw < kw_full_s; kw++) {
                         kw_b = kw;
                         kw_e = kw + 1;
-                        kdhw_loop();
+                        CHECK(kdhw_loop());
                     }
                 }
             }
@@ -2151,7 +2255,7 @@ void brgemm_convolution_fwd_t<isa>::ker_base(brgemm_thread_ctx_t &btc) const {
                     kh_e = nstl::min(kh_f, kh_b + KH_BLOCK);
                     for (kw_b = kw_full_s; kw_b < kw_full_f; kw_b += KW_BLOCK) {
                         kw_e = nstl::min(kw_full_f, kw_b + KW_BLOCK);
-                        kdhw_loop();
+                        CHECK(kdhw_loop());
                     }
                 }
             }
@@ -2166,7 +2270,7 @@ void brgemm_convolution_fwd_t<isa>::ker_base(brgemm_thread_ctx_t &btc) const {
                     for (int kw = kw_full_f; kw < kw_f; kw++) {
                         kw_b = kw;
                         kw_e = kw + 1;
-                        kdhw_loop();
+                        CHECK(kdhw_loop());
                     }
                 }
             }
@@ -2176,13 +2280,15 @@ void brgemm_convolution_fwd_t<isa>::ker_base(brgemm_thread_ctx_t &btc) const {
         const auto do_postwork
                 = _pd->need_postwork && btc.icc == (_pd->ic_chunks - 1);
         brgemm_convolution_utils::get_ow_range(jcp, ow, kw_b, ow_b, ow_e);
-        perform_outwork(btc, dst_base, bias_w, ow, g_oc, is_oc_tail, ow_b, ow_e,
-                kd_l, kh_l, do_init, do_postwork, 0, false);
+        CHECK(perform_outwork(btc, dst_base, bias_w, ow, g_oc, is_oc_tail,
+                ow_b, ow_e, kd_l, kh_l, do_init, do_postwork, 0, false));
     }
+    return status::success;
 }
 
 template <cpu_isa_t isa>
-void brgemm_convolution_fwd_t<isa>::ker_trans(brgemm_thread_ctx_t &btc) const {
+status_t brgemm_convolution_fwd_t<isa>::ker_trans(
+        brgemm_thread_ctx_t &btc) const {
 
     const auto _pd = pd();
     const auto &jcp = _pd->jcp_;
@@ -2311,13 +2417,15 @@ void brgemm_convolution_fwd_t<isa>::ker_trans(brgemm_thread_ctx_t &btc) const {
         const auto do_init = btc.icc == 0;
         const auto do_postwork
                 = _pd->need_postwork && btc.icc == (_pd->ic_chunks - 1);
-        perform_outwork(btc, dst_base, bias_w, ow, g_oc, is_oc_tail, ow, ow,
-                kd_l, kh_l, do_init, do_postwork, 0, false);
+        CHECK(perform_outwork(btc, dst_base, bias_w, ow, g_oc, is_oc_tail,
+                ow, ow, kd_l, kh_l, do_init, do_postwork, 0, false));
     }
+    return status::success;
 }
 
 template <cpu_isa_t isa>
-void brgemm_convolution_fwd_t<isa>::ker_vpad(brgemm_thread_ctx_t &btc) const {
+status_t brgemm_convolution_fwd_t<isa>::ker_vpad(
+        brgemm_thread_ctx_t &btc) const {
 
     const auto _pd = pd();
     const auto &jcp = _pd->jcp_;
@@ -2408,9 +2516,10 @@ void brgemm_convolution_fwd_t<isa>::ker_vpad(brgemm_thread_ctx_t &btc) const {
         const auto do_init = btc.icc == 0;
         const auto do_postwork
                 = _pd->need_postwork && btc.icc == (_pd->ic_chunks - 1);
-        perform_outwork(btc, dst_base, bias_w, ow, g_oc, is_oc_tail, ow, ow,
-                kd_l, kh_l, do_init, do_postwork, 0, false);
+        CHECK(perform_outwork(btc, dst_base, bias_w, ow, g_oc, is_oc_tail,
+                ow, ow, kd_l, kh_l, do_init, do_postwork, 0, false));
     }
+    return status::success;
 }
 
 #undef BRGEMM_CONV_KER_HEADER
@@ -18,6 +18,7 @@
 #define CPU_X64_JIT_BRGEMM_CONV_HPP
 
 #include <array>
+#include <mutex>
 #include <unordered_map>
 
 #include "common/c_types_map.hpp"
@@ -147,6 +148,12 @@ struct brgemm_convolution_fwd_t : public primitive_t {
 protected:
     status_t init(engine_t *engine) override;
 
+    // Only the brgemm kernels are stored, the post-ops and auxiliary kernels
+    // are generated again when the primitive is restored.
+    status_t get_cache_blob_size(engine_t *engine, size_t *size) const override;
+    status_t get_cache_blob(
+            engine_t *engine, cache_blob_t &cache_blob) const override;
+
 private:
     //  brgemm convolution execution context
     struct brgemm_exec_ctx_t {
@@ -184,11 +191,11 @@ private:
     dim_t get_src_base_offset(
             const brgemm_thread_ctx_t &btc, const dim_t ic) const;
 
-    void ker_base(brgemm_thread_ctx_t &btc) const;
-    void ker_trans(brgemm_thread_ctx_t &btc) const;
-    void ker_vpad(brgemm_thread_ctx_t &btc) const;
+    status_t ker_base(brgemm_thread_ctx_t &btc) const;
+    status_t ker_trans(brgemm_thread_ctx_t &btc) const;
+    status_t ker_vpad(brgemm_thread_ctx_t &btc) const;
 
-    void perform_outwork(const brgemm_thread_ctx_t &btc, char *dst_base,
+    status_t perform_outwork(const brgemm_thread_ctx_t &btc, char *dst_base,
             const char *bias_w, int ow, int g_oc, bool is_oc_tail, int ker_ow_s,
             int ker_ow_f, int kd_l, int kh_l, bool maybe_do_init,
             bool do_postwork, size_t comp_ker_offs, bool do_post_comp) const;
@@ -206,9 +213,15 @@ private:
             const char *__restrict input_weights,
             const char *__restrict &wei) const;
 
+    // Returns the distinct brgemm descriptors with a kernel and their
+    // indices in the order the kernels are created.
+    void get_brg_kernel_descs(std::vector<int> &brg_idxs,
+            std::vector<const brgemm_desc_t *> &brg_descs) const;
+    status_t add_brg_kernels();
     status_t add_po_kernel(brgemm_desc_t *bcfg, int ker_idx, bool is_init);
+    status_t create_po_kernel(const brgemm_desc_t &bcfg, int ker_idx) const;
+    const jit_brgemm_kernel_post_ops_base_t *get_po_kernel(int ker_idx) const;
     void add_po_kernels(int i_N, int init_bcast_dim, int po_bcast_dim);
-    status_t add_brg_kernel(int brg_idx);
 
     status_t cal_compensation(const char *__restrict weights,
             int32_t *src_zp_buffer, int32_t *s8s8_comp_buffer) const;
@@ -225,7 +238,13 @@ private:
     brgemm_containers::brgemm_kernel_container_t brgemm_kernels_;
     brgemm_containers::brgemm_palette_container_t brgemm_palettes_;
 
-    std::vector<std::unique_ptr<jit_brgemm_kernel_post_ops_base_t>> kernels_po_;
+    // With lazy kernels the post-ops kernels for the borders and tails are
+    // generated on the first use, from the descriptors saved at creation.
+    mutable std::vector<std::unique_ptr<jit_brgemm_kernel_post_ops_base_t>>
+            kernels_po_;
+    bool is_lazy_po_kernels_ = false;
+    std::vector<std::unique_ptr<brgemm_desc_t>> po_kernel_descs_;
+    std::unique_ptr<std::once_flag[]> po_kernel_once_;
     std::unique_ptr<jit_avx512_core_brgemm_conv_trans_kernel::
                     jit_avx512_core_brgemm_conv_trans_kernel_t>
             copy_to_pbuffer_;
@@ -732,6 +732,7 @@ status_t brg_blocking_t::get_brgemm_ur(
         brgattr.max_top_vpad = max_vpad;
         brgattr.max_bottom_vpad = max_vpad;
         brgattr.fpmath_mode = attr->fpmath_.mode_;
+        brgattr.acc_mode = attr->acc_mode_;
         CHECK(brgemm_desc_set_attr(&brg, brgattr));
 
         brg.with_sum = with_sum;
@@ -2109,6 +2110,11 @@ status_t init_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
     const bool relo_supported_isa = IMPLICATION(
             is_int8_convolution, cpu().has(Xbyak::util::Cpu::tAVX512_VBMI));
     const bool relo_reasonable_isa = is_superset(isa, avx512_core);
+    // First layer (stem) convolutions have only a few input channels, e.g.
+    // 3 or 4 for images, so without relo most of every vnni block is padding
+    // and each kernel tap turns into a tiny brgemm batch element.
+    const bool is_stem_conv
+            = jcp.ngroups == 1 && jcp.vnni_block > 1 && jcp.ic <= 4;
 
     // try_relo_wi
     bool try_relo_wi = false;
@@ -2140,9 +2146,9 @@ status_t init_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
                 perf_relo = true;
         } else {
             if (one_of(jcp.wei_dt, f32, s8)) {
-                if (jcp.ic == 1) perf_relo = true;
+                if (jcp.ic == 1 || is_stem_conv) perf_relo = true;
             } else {
-                if (jcp.ic < jcp.vnni_block) perf_relo = true;
+                if (jcp.ic < jcp.vnni_block || is_stem_conv) perf_relo = true;
             }
         }
         perf_relo = perf_relo && jcp.kw > 1;
@@ -2190,9 +2196,11 @@ status_t init_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
                 perf_relo = true;
         } else {
             if (one_of(jcp.wei_dt, f32, s8)) {
-                if (jcp.ic == 1 && jcp.ow > 4) perf_relo = true;
+                if ((jcp.ic == 1 || is_stem_conv) && jcp.ow > 4)
+                    perf_relo = true;
             } else {
-                if (jcp.ic < jcp.vnni_block && jcp.ow > 4) perf_relo = true;
+                if ((jcp.ic < jcp.vnni_block || is_stem_conv) && jcp.ow > 4)
+                    perf_relo = true;
             }
         }
         perf_relo = perf_relo && jcp.kh > 1;
@@ -19,6 +19,9 @@
 #include "common/dnnl_thread.hpp"
 #include "common/nstl.hpp"
 #include "common/primitive_desc_iterator.hpp"
+#include "common/reorder.hpp"
+#include "common/stream.hpp"
+#include "common/tag_traits.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
@@ -141,6 +144,30 @@ status_t bwd_conv_desc_create(const deconvolution_desc_t *fwd_deconv_d,
 
     return status::success;
 }
+
+// Restricts the spatial dimensions of `md` to `sizes` points taken with
+// `steps` starting from `starts`. The spatial dimensions start at `sp_off`
+// and must not be blocked.
+status_t init_strided_view(memory_desc_t &view_md, const memory_desc_t &md,
+        int sp_off, int ndims_spatial, const dims_t sizes, const dims_t starts,
+        const dims_t steps) {
+    if (md.format_kind != format_kind::blocked || md.extra.flags != 0)
+        return status::unimplemented;
+    const auto &blk = md.format_desc.blocking;
+    for (int b = 0; b < blk.inner_nblks; b++)
+        if (blk.inner_idxs[b] >= sp_off) return status::unimplemented;
+
+    view_md = md;
+    auto &view_blk = view_md.format_desc.blocking;
+    for (int i = 0; i < ndims_spatial; i++) {
+        const int d = sp_off + i;
+        view_md.dims[d] = sizes[i];
+        view_md.padded_dims[d] = sizes[i];
+        view_md.offset0 += starts[i] * blk.strides[d];
+        view_blk.strides[d] = blk.strides[d] * steps[i];
+    }
+    return status::success;
+}
 } // namespace
 
 template <typename implementation_pd>
@@ -150,6 +177,168 @@ status_t check_embedded_impl_init(primitive_desc_iterator_t &it) {
     return status::unimplemented;
 }
 
+template <cpu_isa_t isa>
+bool brgemm_deconvolution_fwd_t<isa>::pd_t::subpixel_ok() const {
+    // A phase covers a subset of dst points only, so post-ops must not depend
+    // on the point: no sum and binary post-ops broadcast over mb and spatial.
+    const auto &po = attr()->post_ops_;
+    for (int i = 0; i < po.len(); i++) {
+        const auto &e = po.entry_[i];
+        if (e.is_eltwise()) continue;
+        if (!e.is_binary()) return false;
+        const auto &src1_md = e.binary.src1_desc;
+        if (src1_md.dims[0] != 1) return false;
+        for (int d = 2; d < src1_md.ndims; d++)
+            if (src1_md.dims[d] != 1) return false;
+    }
+
+    const int ndims_spatial = ndims() - 2;
+    for (int i = 0; i < ndims_spatial; i++)
+        if (desc()->dilates[i] != 0 || desc()->padding[0][i] < 0) return false;
+    return true;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_deconvolution_fwd_t<isa>::pd_t::init_subpixel(
+        engine_t *engine) {
+    if (!subpixel_ok()) return status::unimplemented;
+
+    const deconvolution_desc_t *dd = desc();
+    const int ndims_spatial = ndims() - 2;
+    const int wei_sp_off = 2 + with_groups();
+
+    memory_desc_t src_md = src_md_;
+    memory_desc_t wei_md = weights_md_;
+    memory_desc_t dst_md = dst_md_;
+    // The phase taps are gathered from plain weights by a strided view.
+    if (wei_md.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(wei_md, get_abx_tag(wei_md.ndims)));
+
+    dim_t nphases = 1;
+    for (int i = 0; i < ndims_spatial; i++)
+        nphases *= dd->strides[i];
+
+    std::vector<subpixel_phase_t> phases(nphases);
+    for (dim_t ph = 0; ph < nphases; ph++) {
+        auto &phase = phases[ph];
+
+        // For the output phase `p`, the contributing taps are `r + S * t`
+        // and the output point `S * j + p` takes src point `j + l - t`, which
+        // is a unit-stride deconvolution with left padding `l`.
+        dims_t p, r, kp, odp, pl, pr;
+        dim_t rem = ph;
+        for (int i = ndims_spatial - 1; i >= 0; i--) {
+            p[i] = rem % dd->strides[i];
+            rem /= dd->strides[i];
+        }
+        for (int i = 0; i < ndims_spatial; i++) {
+            const dim_t S = dd->strides[i];
+            const dim_t K = wei_md.dims[wei_sp_off + i];
+            const dim_t ID = dd->src_desc.dims[2 + i];
+            const dim_t OD = dd->dst_desc.dims[2 + i];
+            const dim_t PL = dd->padding[0][i];
+            r[i] = (p[i] + PL) % S;
+            if (r[i] >= K || p[i] >= OD) return status::unimplemented;
+            kp[i] = utils::div_up(K - r[i], S);
+            odp[i] = utils::div_up(OD - p[i], S);
+            pl[i] = (p[i] + PL - r[i]) / S;
+            pr[i] = ID + kp[i] - 1 - pl[i] - odp[i];
+            if (pr[i] < 0) return status::unimplemented;
+        }
+
+        CHECK(init_strided_view(phase.wei_md, wei_md, wei_sp_off,
+                ndims_spatial, kp, r, dd->strides));
+
+        memory_desc_t phase_wei_md, phase_dst_md;
+        dims_t wei_dims, dst_dims;
+        utils::array_copy(wei_dims, wei_md.dims, wei_md.ndims);
+        utils::array_copy(dst_dims, dd->dst_desc.dims, dd->dst_desc.ndims);
+        for (int i = 0; i < ndims_spatial; i++) {
+            wei_dims[wei_sp_off + i] = kp[i];
+            dst_dims[2 + i] = odp[i];
+        }
+        CHECK(memory_desc_init_by_tag(phase_wei_md, wei_md.ndims, wei_dims,
+                wei_md.data_type, format_tag::any));
+        CHECK(memory_desc_init_by_tag(phase_dst_md, dd->dst_desc.ndims,
+                dst_dims, dd->dst_desc.data_type, format_tag::any));
+
+        deconvolution_desc_t phase_d = *dd;
+        phase_d.src_desc = src_md;
+        phase_d.weights_desc = phase_wei_md;
+        phase_d.dst_desc = phase_dst_md;
+        for (int i = 0; i < ndims_spatial; i++) {
+            phase_d.strides[i] = 1;
+            phase_d.padding[0][i] = pl[i];
+            phase_d.padding[1][i] = pr[i];
+        }
+
+        primitive_desc_iterator_t it(engine,
+                reinterpret_cast<const op_desc_t *>(&phase_d), attr(),
+                nullptr);
+        if (!it.is_initialized()) return status::out_of_memory;
+        while (++it != it.end()) {
+            if (check_embedded_impl_init<pd_t>(it) == status::success) break;
+        }
+        if (it == it.end()) return status::unimplemented;
+        phase.deconv_pd = *it;
+
+        // The layouts chosen for the first phase are used for all of them.
+        if (src_md.format_kind == format_kind::any)
+            src_md = *phase.deconv_pd->src_md();
+        if (dst_md.format_kind == format_kind::any) {
+            const auto phase_dst_md = phase.deconv_pd->dst_md();
+            if (phase_dst_md->format_kind != format_kind::blocked)
+                return status::unimplemented;
+            CHECK(memory_desc_init_by_blocking_desc(
+                    dst_md, phase_dst_md->format_desc.blocking));
+        }
+
+        CHECK(init_strided_view(phase.dst_md, dst_md, 2, ndims_spatial, odp,
+                p, dd->strides));
+        CHECK(reorder_primitive_desc_create(phase.wei_reorder_pd, engine,
+                &phase.wei_md, phase.deconv_pd->weights_md()));
+        CHECK(reorder_primitive_desc_create(phase.dst_reorder_pd, engine,
+                phase.deconv_pd->dst_md(), &phase.dst_md));
+    }
+
+    src_md_ = src_md;
+    weights_md_ = wei_md;
+    dst_md_ = dst_md;
+    subpixel_phases_ = std::move(phases);
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_deconvolution_fwd_t<isa>::pd_t::init_scratchpad() {
+    using namespace memory_tracking::names;
+    auto scratchpad = scratchpad_registry().registrar();
+    if (!use_subpixel()) {
+        scratchpad.book(key_nested, conv_pd_->scratchpad_registry());
+        return;
+    }
+
+    // Phases are executed one after another, so they share the buffers.
+    size_t wei_size = 0, dst_size = 0;
+    const memory_tracking::registry_t *nested_registry = nullptr;
+    const auto update_nested = [&](const primitive_desc_t *nested_pd) {
+        const auto &registry = nested_pd->scratchpad_registry();
+        if (!nested_registry || registry.size() > nested_registry->size())
+            nested_registry = &registry;
+    };
+    for (const auto &phase : subpixel_phases_) {
+        wei_size = nstl::max(wei_size,
+                memory_desc_wrapper(phase.deconv_pd->weights_md()).size());
+        dst_size = nstl::max(dst_size,
+                memory_desc_wrapper(phase.deconv_pd->dst_md()).size());
+        update_nested(phase.deconv_pd.get());
+        update_nested(phase.wei_reorder_pd.get());
+        update_nested(phase.dst_reorder_pd.get());
+    }
+    scratchpad.book<char>(key_deconv_subpixel_wei, wei_size);
+    scratchpad.book<char>(key_deconv_subpixel_dst, dst_size);
+    scratchpad.book(key_nested, *nested_registry);
+}
+
 template <cpu_isa_t isa>
 status_t brgemm_deconvolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
     using namespace data_type;
@@ -193,6 +382,15 @@ status_t brgemm_deconvolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
         }
     }
 
+    if (has_strides_ && init_subpixel(engine) == status::success) {
+        attr_.set_default_formats(&dst_md_);
+        if (bias_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_tag(bias_md_, x));
+        init_name();
+        init_scratchpad();
+        return status::success;
+    }
+
     if (has_strides_) {
         CHECK(bwd_conv_desc_create(fwd_deconv_d, &conv_d));
         primitive_desc_iterator_t it(engine,
@@ -268,20 +466,90 @@ status_t brgemm_deconvolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
         CHECK(memory_desc_init_by_tag(bias_md_, x));
 
     init_name();
-    auto scratchpad = scratchpad_registry().registrar();
-    scratchpad.book(memory_tracking::names::key_nested,
-            conv_pd_->scratchpad_registry());
+    init_scratchpad();
 
     return status::success;
 }
 
 template <cpu_isa_t isa>
 status_t brgemm_deconvolution_fwd_t<isa>::init(engine_t *engine) {
+    if (pd()->use_subpixel()) {
+        for (const auto &phase : pd()->subpixel_phases_) {
+            subpixel_phase_prims_t prims;
+            CHECK(phase.deconv_pd->create_primitive(prims.deconv, engine));
+            CHECK(phase.wei_reorder_pd->create_primitive(
+                    prims.wei_reorder, engine));
+            CHECK(phase.dst_reorder_pd->create_primitive(
+                    prims.dst_reorder, engine));
+            subpixel_prims_.push_back(prims);
+        }
+        return status::success;
+    }
     return pd()->conv_pd_->create_primitive(conv_p_, engine);
 }
 
+template <cpu_isa_t isa>
+status_t brgemm_deconvolution_fwd_t<isa>::execute_subpixel(
+        const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+    engine_t *engine = ctx.stream()->engine();
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    const auto &args = ctx.args();
+    const memory_t *user_wei = args.at(DNNL_ARG_WEIGHTS).mem;
+    const memory_t *user_dst = args.at(DNNL_ARG_DST).mem;
+
+    const auto execute_nested = [&](const std::shared_ptr<primitive_t> &prim,
+                                        exec_args_t &&nested_args) {
+        exec_ctx_t nested_ctx(ctx, std::move(nested_args));
+        nested_scratchpad_t ns(ctx, key_nested, prim);
+        nested_ctx.set_scratchpad_grantor(ns.grantor());
+        return prim->execute(nested_ctx);
+    };
+
+    for (size_t i = 0; i < subpixel_prims_.size(); i++) {
+        const auto &phase = pd()->subpixel_phases_[i];
+        const auto &prims = subpixel_prims_[i];
+
+        std::unique_ptr<memory_t, memory_deleter_t> wei_view, wei;
+        CHECK(safe_ptr_assign(wei_view,
+                new memory_t(engine, &phase.wei_md,
+                        user_wei->memory_storage()->clone())));
+        CHECK(safe_ptr_assign(wei,
+                new memory_t(engine, phase.deconv_pd->weights_md(),
+                        scratchpad.get_memory_storage(
+                                key_deconv_subpixel_wei))));
+
+        std::unique_ptr<memory_t, memory_deleter_t> dst_view, dst;
+        CHECK(safe_ptr_assign(dst_view,
+                new memory_t(engine, &phase.dst_md,
+                        user_dst->memory_storage()->clone())));
+        CHECK(safe_ptr_assign(dst,
+                new memory_t(engine, phase.deconv_pd->dst_md(),
+                        scratchpad.get_memory_storage(
+                                key_deconv_subpixel_dst))));
+
+        exec_args_t wei_args;
+        wei_args[DNNL_ARG_SRC] = {wei_view.get(), true};
+        wei_args[DNNL_ARG_DST] = {wei.get(), false};
+        CHECK(execute_nested(prims.wei_reorder, std::move(wei_args)));
+
+        exec_args_t deconv_args(args);
+        deconv_args[DNNL_ARG_WEIGHTS] = {wei.get(), true};
+        deconv_args[DNNL_ARG_DST] = {dst.get(), false};
+        CHECK(execute_nested(prims.deconv, std::move(deconv_args)));
+
+        exec_args_t dst_args;
+        dst_args[DNNL_ARG_SRC] = {dst.get(), true};
+        dst_args[DNNL_ARG_DST] = {dst_view.get(), false};
+        CHECK(execute_nested(prims.dst_reorder, std::move(dst_args)));
+    }
+    return status::success;
+}
+
 template <cpu_isa_t isa>
 status_t brgemm_deconvolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
+    if (pd()->use_subpixel()) return execute_subpixel(ctx);
+
     const auto &args = ctx.args();
     exec_args_t conv_args(args);
     if (pd()->has_strides_) {
@@ -17,6 +17,9 @@
 #ifndef CPU_X64_JIT_BRGEMM_DECONV_HPP
 #define CPU_X64_JIT_BRGEMM_DECONV_HPP
 
+#include <memory>
+#include <vector>
+
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/memory_tracking.hpp"
@@ -42,8 +45,9 @@ struct brgemm_deconvolution_fwd_t : public primitive_t {
 
         pd_t(const pd_t &other)
             : cpu_deconvolution_fwd_pd_t(other)
-            , conv_pd_(other.conv_pd_->clone())
+            , conv_pd_(other.conv_pd_ ? other.conv_pd_->clone() : nullptr)
             , has_strides_(other.has_strides_)
+            , subpixel_phases_(other.subpixel_phases_)
             , name_(other.name_) {}
 
         DECLARE_COMMON_PD_T(name_.c_str(), brgemm_deconvolution_fwd_t);
@@ -82,16 +86,43 @@ struct brgemm_deconvolution_fwd_t : public primitive_t {
                     : brgemm_broadcast_t::per_tensor;
         }
 
+        // Sub-pixel decomposition of a strided deconvolution. Outputs with
+        // the same remainder of the spatial index modulo the stride form a
+        // phase, and only every stride-th kernel tap contributes to them, so
+        // each phase is a dense unit-stride deconvolution over the whole src.
+        // A phase computes into a dense buffer which is then interleaved
+        // into dst; the phase taps are gathered from the user weights.
+        struct subpixel_phase_t {
+            std::shared_ptr<primitive_desc_t> deconv_pd;
+            std::shared_ptr<primitive_desc_t> wei_reorder_pd;
+            std::shared_ptr<primitive_desc_t> dst_reorder_pd;
+            memory_desc_t wei_md; // strided view of the phase taps
+            memory_desc_t dst_md; // strided view of the phase outputs
+        };
+
+        bool use_subpixel() const { return !subpixel_phases_.empty(); }
+
         std::shared_ptr<primitive_desc_t> conv_pd_;
         bool has_strides_ = false;
+        std::vector<subpixel_phase_t> subpixel_phases_;
 
     private:
         std::string name_;
 
+        bool subpixel_ok() const;
+        status_t init_subpixel(engine_t *engine);
+        void init_scratchpad();
+
         void init_name() {
             name_ = JIT_IMPL_NAME_HELPER("brg_deconv:", isa, "");
             name_.append("+");
-            name_.append(conv_pd_->name());
+            if (use_subpixel()) {
+                const auto phase_pd = static_cast<const pd_t *>(
+                        subpixel_phases_[0].deconv_pd.get());
+                name_.append("subpixel+");
+                name_.append(phase_pd->conv_pd_->name());
+            } else
+                name_.append(conv_pd_->name());
         }
     };
 
@@ -104,11 +135,20 @@ struct brgemm_deconvolution_fwd_t : public primitive_t {
     status_t execute(const exec_ctx_t &ctx) const override;
 
 private:
+    struct subpixel_phase_prims_t {
+        std::shared_ptr<primitive_t> deconv;
+        std::shared_ptr<primitive_t> wei_reorder;
+        std::shared_ptr<primitive_t> dst_reorder;
+    };
+
     const pd_t *pd() const {
         return static_cast<const pd_t *>(primitive_t::pd().get());
     }
 
+    status_t execute_subpixel(const exec_ctx_t &ctx) const;
+
     std::shared_ptr<primitive_t> conv_p_;
+    std::vector<subpixel_phase_prims_t> subpixel_prims_;
 };
 
 } // namespace x64
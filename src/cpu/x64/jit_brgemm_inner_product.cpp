@@ -637,9 +637,22 @@ template struct brgemm_inner_product_fwd_t<avx10_2_512>;
 template struct brgemm_inner_product_fwd_t<avx10_2_512_amx_2>;
 
 template <cpu_isa_t isa>
-void brgemm_inner_product_bwd_data_t<isa>::execute_backward_data(
+status_t brgemm_inner_product_bwd_data_t<isa>::execute_backward_data(
         const exec_ctx_t &ctx) const {
 
+    DEFINE_ARG_SCALES_BUFFER(diff_dst_scales, DNNL_ARG_DIFF_DST);
+    DEFINE_ARG_SCALES_BUFFER(wei_scales, DNNL_ARG_WEIGHTS);
+    DEFINE_ARG_SCALES_BUFFER(diff_src_scales, DNNL_ARG_DIFF_SRC);
+
+    // Only common scales are supported, the kernels expect them broadcast.
+    alignas(64) float oscales[16];
+    alignas(64) float diff_src_scales_inv[16];
+    utils::array_set(oscales, diff_dst_scales[0] * wei_scales[0], 16);
+    utils::array_set(diff_src_scales_inv, 1.f / diff_src_scales[0], 16);
+    const brgemm_post_ops_data_t po_data {nullptr, oscales, nullptr, 0, 0,
+            nullptr, 0, nullptr, nullptr, nullptr, false, 1, false, false,
+            diff_src_scales_inv};
+
     auto diff_dst_ = CTX_IN_MEM(const char *, DNNL_ARG_DIFF_DST);
     auto weights_ = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
     auto diff_src_ = CTX_OUT_MEM(char *, DNNL_ARG_DIFF_SRC);
@@ -824,10 +837,8 @@ void brgemm_inner_product_bwd_data_t<isa>::execute_backward_data(
                     && is_last_oc_chunk && !is_oc_tail) {
                 void *scratch
                         = is_amx ? static_cast<void *>(wsp_tile) : nullptr;
-                const brgemm_post_ops_data_t empty_po_data {};
                 brgemm_kernel_execute_postops(brg_kernel, nb_oc_b, addr_batch,
-                        (void *)c_buffer, (void *)ptr_D, empty_po_data,
-                        scratch);
+                        (void *)c_buffer, (void *)ptr_D, po_data, scratch);
 
             } else {
                 brgemm_kernel_execute(brg_kernel, nb_oc_b, addr_batch,
@@ -860,10 +871,8 @@ void brgemm_inner_product_bwd_data_t<isa>::execute_backward_data(
             if (jbgp.use_buffer && jbgp.nthr_oc_b <= 1) {
                 void *scratch
                         = is_amx ? static_cast<void *>(wsp_tile) : nullptr;
-                const brgemm_post_ops_data_t empty_po_data {};
                 brgemm_kernel_execute_postops(brg_kernel_oc_tail, 1, addr_batch,
-                        (void *)c_buffer, (void *)ptr_D, empty_po_data,
-                        scratch);
+                        (void *)c_buffer, (void *)ptr_D, po_data, scratch);
 
             } else {
                 brgemm_kernel_execute(brg_kernel_oc_tail, 1, addr_batch,
@@ -1013,6 +1022,8 @@ void brgemm_inner_product_bwd_data_t<isa>::execute_backward_data(
             }
         });
     }
+
+    return status::success;
 }
 
 template struct brgemm_inner_product_bwd_data_t<avx2>;
@@ -1784,6 +1795,29 @@ void brgemm_inner_product_bwd_weights_t<isa>::execute_backward_weights(
     }
 }
 
+template <cpu_isa_t isa>
+status_t brgemm_inner_product_bwd_weights_t<isa>::apply_scales(
+        const exec_ctx_t &ctx) const {
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+    DEFINE_ARG_SCALES_BUFFER(diff_dst_scales, DNNL_ARG_DIFF_DST);
+
+    const float wei_scale = src_scales[0] * diff_dst_scales[0];
+    const float bia_scale = diff_dst_scales[0];
+
+    auto diff_weights = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_WEIGHTS);
+    const memory_desc_wrapper diff_weights_d(pd()->diff_weights_md(0));
+    // Padded elements are zeros and stay such.
+    const dim_t wei_nelems = diff_weights_d.size() / sizeof(float);
+    if (wei_scale != 1.f)
+        parallel_nd(wei_nelems, [&](dim_t i) { diff_weights[i] *= wei_scale; });
+
+    if (pd()->with_bias() && bia_scale != 1.f) {
+        auto diff_bias = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_BIAS);
+        parallel_nd(pd()->OC(), [&](dim_t oc) { diff_bias[oc] *= bia_scale; });
+    }
+    return status::success;
+}
+
 template struct brgemm_inner_product_bwd_weights_t<avx512_core_amx_fp16>;
 template struct brgemm_inner_product_bwd_weights_t<avx512_core_fp16>;
 template struct brgemm_inner_product_bwd_weights_t<avx512_core_amx>;
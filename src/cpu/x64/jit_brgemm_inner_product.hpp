@@ -58,11 +58,12 @@ struct brgemm_inner_product_fwd_t : public primitive_t {
             auto dst_dt = invariant_dst_md()->data_type;
             auto wei_dt = invariant_wei_md()->data_type;
             const bool is_int8 = one_of(src_dt, u8, s8);
+            const bool is_fp8 = one_of(src_dt, f8_e5m2, f8_e4m3);
 
             using skip_mask_t = primitive_attr_t::skip_mask_t;
             auto skip_mask = skip_mask_t::post_ops | skip_mask_t::sum_dt
                     | skip_mask_t::fpmath_mode;
-            if (is_int8) skip_mask |= skip_mask_t::scales;
+            if (is_int8 || is_fp8) skip_mask |= skip_mask_t::scales;
             // disabling verbose dispatch messages for unsupported isa for
             // better readability
             if (!mayiuse(isa)) return status::unimplemented;
@@ -206,9 +207,8 @@ struct brgemm_inner_product_fwd_t : public primitive_t {
             int idx = pd()->get_brg_kernel_idx(i_bs, i_init, i_M, i_N, i_K, bs);
             if (idx < 0) continue;
 
-            brgemm_kernel_t *ker = nullptr;
-            CHECK(brgemm_kernel_create(&ker, pd()->brg_descs_[idx]));
-            CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+            CHECK(brgemm_containers::get_or_create_kernel(
+                    brg_kernels_[idx], pd()->brg_descs_[idx]));
             if (pd()->jbgp_.is_amx)
                 brgemm_palettes_.insert(idx, pd()->brg_descs_[idx]);
         }
@@ -245,7 +245,7 @@ private:
     status_t execute_forward(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
-    std::unique_ptr<brgemm_kernel_t>
+    std::shared_ptr<brgemm_kernel_t>
             brg_kernels_[brgemm_inner_product_utils::max_num_brg_kernels_ip];
     std::unique_ptr<jit_brgemm_copy_to_coarse_t> copy_src_kernel_;
     std::unique_ptr<cpu_accumulator_1d_t<data_type::f32>> acc_ker_;
@@ -268,6 +268,10 @@ struct brgemm_inner_product_bwd_data_t : public primitive_t {
             auto diff_src_dt = invariant_src_md()->data_type;
             auto diff_dst_dt = invariant_dst_md()->data_type;
             auto wei_dt = invariant_wei_md()->data_type;
+            const bool is_fp8 = utils::one_of(
+                    wei_dt, data_type::f8_e5m2, data_type::f8_e4m3);
+            auto skip_mask = skip_mask_t::fpmath_mode;
+            if (is_fp8) skip_mask |= skip_mask_t::scales;
             // disabling verbose dispatch messages for unsupported isa for
             // better readability
             if (!mayiuse(isa)) return status::unimplemented;
@@ -286,15 +290,28 @@ struct brgemm_inner_product_bwd_data_t : public primitive_t {
             VDISPATCH_INNER_PRODUCT(
                     utils::one_of(diff_src_dt, data_type::f32, diff_dst_dt),
                     VERBOSE_UNSUPPORTED_DT);
-            VDISPATCH_INNER_PRODUCT(
-                    attr()->has_default_values(skip_mask_t::fpmath_mode),
+            VDISPATCH_INNER_PRODUCT(attr()->has_default_values(skip_mask),
                     VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_INNER_PRODUCT(
+                    arg_scales_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
 
             memory_desc_t dummy_bias_md;
             CHECK(jbgp_.init_conf(isa, *desc(), diff_src_md_, weights_md_,
                     diff_dst_md_, dummy_bias_md, attr_,
                     dnnl_get_max_threads()));
 
+            // The kernels see diff_dst, weights and diff_src as their source,
+            // weights and destination.
+            primitive_attr_t brg_attr(*attr());
+            CHECK(brg_attr.scales_.set(DNNL_ARG_SRC,
+                    attr()->scales_.get(DNNL_ARG_DIFF_DST)));
+            CHECK(brg_attr.scales_.set(DNNL_ARG_DST,
+                    attr()->scales_.get(DNNL_ARG_DIFF_SRC)));
+            CHECK(brg_attr.scales_.set(
+                    DNNL_ARG_DIFF_DST, default_quant_entry()));
+            CHECK(brg_attr.scales_.set(
+                    DNNL_ARG_DIFF_SRC, default_quant_entry()));
+
             const float alpha = 1.0;
             const float beta = 1.0;
             const float beta_init = 0.0;
@@ -320,8 +337,8 @@ struct brgemm_inner_product_bwd_data_t : public primitive_t {
                         dt_b, false, false, brgemm_row_major, alpha, vbeta,
                         jbgp_.LDA, jbgp_.LDB, jbgp_.LDC, vM, vN, vK));
 
-                CHECK(brgemm_desc_set_postops(
-                        &brg, attr(), &diff_src_md_, jbgp_.LDD, jbgp_.bia_dt));
+                CHECK(brgemm_desc_set_postops(&brg, &brg_attr, &diff_src_md_,
+                        jbgp_.LDD, jbgp_.bia_dt));
                 if (jbgp_.is_amx) {
                     brgemm_attr_t brgattr;
                     brgattr.max_bs = bs;
@@ -351,6 +368,15 @@ struct brgemm_inner_product_bwd_data_t : public primitive_t {
             return status::success;
         }
 
+        // Scales are applied to the accumulated values, so the weights
+        // scales can't vary along the reduction dimension.
+        bool arg_scales_ok() const {
+            const std::vector<int> supported_args
+                    = {DNNL_ARG_DIFF_DST, DNNL_ARG_WEIGHTS, DNNL_ARG_DIFF_SRC};
+            return attr_scales_ok(supported_args)
+                    && attr()->scales_.get_mask(DNNL_ARG_WEIGHTS) <= 0;
+        }
+
         int get_brg_kernel_idx(bool is_bs_tail, bool do_initialization,
                 bool is_M_tail, bool is_N_tail, bool is_K_tail, int bs) const {
             auto vM = (is_M_tail) ? jbgp_.M_tail : jbgp_.M;
@@ -394,9 +420,8 @@ struct brgemm_inner_product_bwd_data_t : public primitive_t {
             int idx = pd()->get_brg_kernel_idx(i_bs, i_init, i_M, i_N, i_K, bs);
             if (idx < 0) continue;
 
-            brgemm_kernel_t *ker = nullptr;
-            CHECK(brgemm_kernel_create(&ker, pd()->brg_descs_[idx]));
-            CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+            CHECK(brgemm_containers::get_or_create_kernel(
+                    brg_kernels_[idx], pd()->brg_descs_[idx]));
             if (jbgp.is_amx)
                 brgemm_palettes_.insert(idx, pd()->brg_descs_[idx]);
         }
@@ -417,15 +442,14 @@ struct brgemm_inner_product_bwd_data_t : public primitive_t {
     }
 
     status_t execute(const exec_ctx_t &ctx) const override {
-        execute_backward_data(ctx);
-        return status::success;
+        return execute_backward_data(ctx);
     }
 
 private:
-    void execute_backward_data(const exec_ctx_t &ctx) const;
+    status_t execute_backward_data(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
-    std::unique_ptr<brgemm_kernel_t>
+    std::shared_ptr<brgemm_kernel_t>
             brg_kernels_[brgemm_inner_product_utils::max_num_brg_kernels_ip];
     std::unique_ptr<jit_brgemm_copy_to_coarse_t> copy_diff_dst_kernel_;
     std::unique_ptr<jit_brgemm_trans_wei_t> trans_B_kernel_;
@@ -450,6 +474,10 @@ struct brgemm_inner_product_bwd_weights_t : public primitive_t {
             auto diff_wei_type = invariant_wei_md()->data_type;
             auto diff_dst_type = invariant_dst_md()->data_type;
             auto diff_bia_type = invariant_bia_md()->data_type;
+            const bool is_fp8 = utils::one_of(
+                    src_dt, data_type::f8_e5m2, data_type::f8_e4m3);
+            auto skip_mask = skip_mask_t::fpmath_mode;
+            if (is_fp8) skip_mask |= skip_mask_t::scales;
             // disabling verbose dispatch messages for unsupported isa for
             // better readability
             if (!mayiuse(isa)) return status::unimplemented;
@@ -477,9 +505,10 @@ struct brgemm_inner_product_bwd_weights_t : public primitive_t {
             VDISPATCH_INNER_PRODUCT(
                     utils::one_of(diff_wei_type, data_type::f32, src_dt),
                     VERBOSE_UNSUPPORTED_DT);
-            VDISPATCH_INNER_PRODUCT(
-                    attr()->has_default_values(skip_mask_t::fpmath_mode),
+            VDISPATCH_INNER_PRODUCT(attr()->has_default_values(skip_mask),
                     VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_INNER_PRODUCT(
+                    arg_scales_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
 
             CHECK(jbgp_.init_conf(isa, *desc(), src_md_, diff_weights_md_,
                     diff_dst_md_, diff_bias_md_, attr_,
@@ -540,6 +569,22 @@ struct brgemm_inner_product_bwd_weights_t : public primitive_t {
             return status::success;
         }
 
+        // The scales are applied to the reduced f32 diff weights and bias,
+        // the low precision ones are rounded before that happens.
+        bool arg_scales_ok() const {
+            const std::vector<int> supported_args
+                    = {DNNL_ARG_SRC, DNNL_ARG_DIFF_DST};
+            if (!attr_scales_ok(supported_args)) return false;
+            if (attr()->scales_.has_default_values()) return true;
+            return diff_weights_md(0)->data_type == data_type::f32
+                    && IMPLICATION(with_bias(),
+                            diff_weights_md(1)->data_type == data_type::f32);
+        }
+
+        bool with_scales() const {
+            return !attr()->scales_.has_default_values();
+        }
+
         int get_brg_kernel_idx(bool is_bs_tail, bool do_initialization,
                 bool is_M_tail, bool is_N_tail, bool is_K_tail, int bs) const {
             auto vM = (is_M_tail) ? jbgp_.M_tail : jbgp_.M;
@@ -579,9 +624,8 @@ struct brgemm_inner_product_bwd_weights_t : public primitive_t {
             int idx = pd()->get_brg_kernel_idx(i_bs, i_init, i_M, i_N, i_K, bs);
             if (idx < 0) continue;
 
-            brgemm_kernel_t *ker = nullptr;
-            CHECK(brgemm_kernel_create(&ker, pd()->brg_descs_[idx]));
-            CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+            CHECK(brgemm_containers::get_or_create_kernel(
+                    brg_kernels_[idx], pd()->brg_descs_[idx]));
             if (jbgp.is_amx)
                 brgemm_palettes_.insert(idx, pd()->brg_descs_[idx]);
 
@@ -628,6 +672,7 @@ struct brgemm_inner_product_bwd_weights_t : public primitive_t {
 
     status_t execute(const exec_ctx_t &ctx) const override {
         execute_backward_weights(ctx);
+        if (pd()->with_scales()) return apply_scales(ctx);
         return status::success;
     }
 
@@ -636,7 +681,7 @@ private:
     using ker_diff_bias_t = jit_brgemm_kernel_diff_bias_t<
             typename cpu_isa_traits_t<isa>::Vmm>;
     std::unique_ptr<ker_diff_bias_t> kernels_db_[2][2];
-    std::unique_ptr<brgemm_kernel_t>
+    std::shared_ptr<brgemm_kernel_t>
             brg_kernels_[brgemm_inner_product_utils::max_num_brg_kernels_ip];
     std::unique_ptr<jit_brgemm_trans_src_t> trans_A_kernel_;
     std::unique_ptr<jit_brgemm_trans_to_vnni_t> trans_B_kernel_;
@@ -645,6 +690,8 @@ private:
     std::unique_ptr<jit_amx_ip_trans_diff_wei_t> diff_wei_trans_kernel_;
 
     void execute_backward_weights(const exec_ctx_t &ctx) const;
+    // Scales the f32 diff weights and bias by the source and diff_dst scales.
+    status_t apply_scales(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     void compute_diff_weights_and_bias(const thread_info_t *ti) const;
     void reduce_and_convert_diff_weights_and_bias(
@@ -851,8 +851,12 @@ status_t jit_brgemm_ip_bwd_d_conf_t::init_conf(cpu_isa_t isa,
     // Use oc reduction if we have
     //   * very large output channels
     //   * small work amount available to each thread
-    bool use_oc_reduction = other_work < 2 * jbgp.nthr
-            || jbgp.oc > (is_bf16 || jbgp.is_bf32 ? 4096 : 1024);
+    //   * no scales, which are applied to the final sums only
+    bool use_oc_reduction = (other_work < 2 * jbgp.nthr
+                                    || jbgp.oc > (is_bf16 || jbgp.is_bf32
+                                                    ? 4096
+                                                    : 1024))
+            && !jbgp.with_scales && !jbgp.with_dst_scales;
     if (use_oc_reduction) {
         const int min_chunk_sz
                 = (is_avx512_bf16) ? 2 * jbgp.simd_w : jbgp.simd_w;
@@ -908,7 +912,10 @@ status_t jit_brgemm_ip_bwd_d_conf_t::init_conf(cpu_isa_t isa,
     jbgp.adjusted_batch_size
             = div_up(rnd_up(jbgp.gemm_batch_size * sc_size, 4096), sc_size);
 
-    jbgp.use_buffer = jbgp.src_dt != jbgp.acc_dt || jbgp.nthr_oc_b > 1;
+    // Scales are applied when the accumulated values are stored from the
+    // buffer.
+    jbgp.use_buffer = jbgp.src_dt != jbgp.acc_dt || jbgp.nthr_oc_b > 1
+            || jbgp.with_scales || jbgp.with_dst_scales;
 
     jbgp.M = jbgp.os_block;
     jbgp.M_tail = jbgp.os % jbgp.os_block;
@@ -1391,6 +1398,18 @@ status_t jit_brgemm_ip_conf_t::init_conf_base(cpu_isa_t isa,
     } else
         jbgp.acc_dt = f32;
 
+    // fp8 scales are optional. Backward by data takes them for diff_dst,
+    // weights and diff_src, backward by weights applies them to the result.
+    if (is_fp8 && jbgp.prop_kind != backward_weights) {
+        const auto &sc = attr.scales_;
+        const bool is_bwd_d = jbgp.prop_kind == backward_data;
+        const int a_arg = is_bwd_d ? DNNL_ARG_DIFF_DST : DNNL_ARG_SRC;
+        const int c_arg = is_bwd_d ? DNNL_ARG_DIFF_SRC : DNNL_ARG_DST;
+        jbgp.with_scales = !sc.has_default_values(a_arg)
+                || !sc.has_default_values(DNNL_ARG_WEIGHTS);
+        jbgp.with_dst_scales = !sc.has_default_values(c_arg);
+    }
+
     jbgp.simd_w = isa_max_vlen(jbgp.isa) / types::data_type_size(jbgp.acc_dt);
 
     // Dispatch small shapes to VNNI for better performance
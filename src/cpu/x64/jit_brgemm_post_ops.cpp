@@ -562,8 +562,9 @@ dnnl::impl::cpu::x64::jit_brgemm_kernel_post_ops_t<
         const auto &reserved_eltwise_gpr = reg_reserved_eltwise;
         const auto reserved_eltwise_maskr = Xbyak::Opmask(1);
 
-        const eltwise_injector::static_params_t esp {
+        eltwise_injector::static_params_t esp {
                 save_state, reserved_eltwise_gpr, reserved_eltwise_maskr};
+        esp.fpmath_mode = attr_.fpmath_.mode_;
 
         auto st = safe_ptr_assign(postops_injector_,
                 po_injector_t::create(
@@ -0,0 +1,514 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/amx_tile_configure.hpp"
+#include "cpu/x64/jit_brgemm_wino_conv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::memory_tracking::names;
+
+namespace {
+
+// F(4x4, 3x3) parameters.
+constexpr int wino_m = 4; // output tile size
+constexpr int wino_r = 3; // filter size
+constexpr int wino_alpha = wino_m + wino_r - 1; // input tile size
+constexpr int wino_nxi = wino_alpha * wino_alpha; // number of gemms
+// Channels transformed at once, sized to keep the temporary tiles on stack.
+constexpr dim_t wino_ch_blk = 64;
+
+// The 1D transforms below compute `out[k * out_s + c]` from
+// `in[k * in_s + c]` for `n` channels, the channels loop is vectorized.
+
+// Input transform, out = B^T * in.
+void wino_trans_input(
+        const float *in, dim_t in_s, float *out, dim_t out_s, dim_t n) {
+    PRAGMA_OMP_SIMD()
+    for (dim_t c = 0; c < n; c++) {
+        const float d0 = in[c], d1 = in[in_s + c], d2 = in[2 * in_s + c],
+                    d3 = in[3 * in_s + c], d4 = in[4 * in_s + c],
+                    d5 = in[5 * in_s + c];
+        out[c] = 4.f * d0 - 5.f * d2 + d4;
+        out[out_s + c] = -4.f * d1 - 4.f * d2 + d3 + d4;
+        out[2 * out_s + c] = 4.f * d1 - 4.f * d2 - d3 + d4;
+        out[3 * out_s + c] = -2.f * d1 - d2 + 2.f * d3 + d4;
+        out[4 * out_s + c] = 2.f * d1 - d2 - 2.f * d3 + d4;
+        out[5 * out_s + c] = 4.f * d1 - 5.f * d3 + d5;
+    }
+}
+
+// Weights transform, out = G * in.
+void wino_trans_weights(
+        const float *in, dim_t in_s, float *out, dim_t out_s, dim_t n) {
+    PRAGMA_OMP_SIMD()
+    for (dim_t c = 0; c < n; c++) {
+        const float g0 = in[c], g1 = in[in_s + c], g2 = in[2 * in_s + c];
+        out[c] = g0 / 4.f;
+        out[out_s + c] = -(g0 + g1 + g2) / 6.f;
+        out[2 * out_s + c] = -(g0 - g1 + g2) / 6.f;
+        out[3 * out_s + c] = g0 / 24.f + g1 / 12.f + g2 / 6.f;
+        out[4 * out_s + c] = g0 / 24.f - g1 / 12.f + g2 / 6.f;
+        out[5 * out_s + c] = g2;
+    }
+}
+
+// Output transform, out = A^T * in.
+void wino_trans_output(
+        const float *in, dim_t in_s, float *out, dim_t out_s, dim_t n) {
+    PRAGMA_OMP_SIMD()
+    for (dim_t c = 0; c < n; c++) {
+        const float m0 = in[c], m1 = in[in_s + c], m2 = in[2 * in_s + c],
+                    m3 = in[3 * in_s + c], m4 = in[4 * in_s + c],
+                    m5 = in[5 * in_s + c];
+        out[c] = m0 + m1 + m2 + m3 + m4;
+        out[out_s + c] = m1 - m2 + 2.f * m3 - 2.f * m4;
+        out[2 * out_s + c] = m1 + m2 + 4.f * m3 + 4.f * m4;
+        out[3 * out_s + c] = m1 - m2 + 8.f * m3 - 8.f * m4 + m5;
+    }
+}
+
+} // namespace
+
+status_t brgemm_wino_convolution_fwd_t::pd_t::init(engine_t *engine) {
+    using namespace format_tag;
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    const auto src_dt = invariant_src_md()->data_type;
+    const auto wei_dt = invariant_wei_md()->data_type;
+    const auto dst_dt = invariant_dst_md()->data_type;
+    const auto bia_dt = invariant_bia_md()->data_type;
+
+    const bool is_f32 = everyone_is(f32, src_dt, wei_dt, dst_dt);
+    const bool is_bf16
+            = everyone_is(bf16, src_dt, wei_dt) && one_of(dst_dt, f32, bf16);
+
+    VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_CONV(desc()->alg_kind == alg_kind::convolution_winograd,
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_CONV(is_f32 || is_bf16, VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_CONV(IMPLICATION(with_bias(), one_of(bia_dt, f32, src_dt)),
+            VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_CONV(
+            attr()->has_default_values(skip_mask_t::post_ops, dst_dt),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_CONV(attr()->post_ops_.has_default_values(
+                           {primitive_kind::eltwise, primitive_kind::sum}),
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_CONV(attr()->post_ops_.check_sum_consistency(dst_dt, false),
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_CONV(ndims() == 4, VERBOSE_BAD_NDIMS, "src", ndims());
+    VDISPATCH_CONV(!with_groups(), VERBOSE_UNSUPPORTED_FEATURE, "groups");
+    VDISPATCH_CONV(KH() == wino_r && KW() == wino_r,
+            VERBOSE_UNSUPPORTED_FEATURE, "kernel size other than 3x3");
+    VDISPATCH_CONV(KSH() == 1 && KSW() == 1, VERBOSE_UNSUPPORTED_FEATURE,
+            "non-unit strides");
+    VDISPATCH_CONV(KDH() == 0 && KDW() == 0, VERBOSE_UNSUPPORTED_FEATURE,
+            "dilations");
+    VDISPATCH_CONV(!has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_CONV(set_default_formats_common(nhwc, hwio, nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper wei_d(weights_md());
+    const memory_desc_wrapper dst_d(dst_md());
+    VDISPATCH_CONV(src_d.matches_one_of_tag(nhwc) == nhwc
+                    && dst_d.matches_one_of_tag(nhwc) == nhwc,
+            VERBOSE_UNSUPPORTED_TAG);
+    // The weights are transformed at execution, any plain or blocked layout
+    // works.
+    VDISPATCH_CONV(wei_d.is_blocking_desc(), VERBOSE_UNSUPPORTED_TAG);
+
+    CHECK(init_conf());
+    VDISPATCH_CONV(conf_.isa != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    return status::success;
+}
+
+status_t brgemm_wino_convolution_fwd_t::pd_t::init_conf() {
+    auto &conf = conf_;
+
+    conf.src_dt = src_md()->data_type;
+    conf.dst_dt = dst_md()->data_type;
+    conf.bia_dt = with_bias() ? weights_md(1)->data_type : data_type::undef;
+    conf.with_bias = with_bias();
+    if (conf.src_dt == bf16) {
+        conf.isa = mayiuse(avx512_core_amx) ? avx512_core_amx
+                : mayiuse(avx512_core_bf16) ? avx512_core_bf16
+                                            : isa_undef;
+    } else {
+        conf.isa = mayiuse(avx512_core) ? avx512_core : isa_undef;
+    }
+    if (conf.isa == isa_undef) return status::success;
+    conf.is_amx = is_superset(conf.isa, avx512_core_amx);
+
+    conf.mb = MB();
+    conf.ic = IC();
+    conf.oc = OC();
+    conf.ih = IH();
+    conf.iw = IW();
+    conf.oh = OH();
+    conf.ow = OW();
+    conf.t_pad = padT();
+    conf.l_pad = padL();
+
+    // bf16 kernels read pairs of input channels.
+    conf.ic_pad = conf.src_dt == bf16 ? rnd_up(conf.ic, 2) : conf.ic;
+
+    conf.tiles_h = div_up(conf.oh, wino_m);
+    conf.tiles_w = div_up(conf.ow, wino_m);
+    conf.tiles = conf.tiles_h * conf.tiles_w;
+
+    conf.oc_blk = nstl::min(conf.oc, dim_t(64));
+    conf.nb_oc = div_up(conf.oc, conf.oc_blk);
+
+    // Keep the transformed input of a tiles block within half of L2, it is
+    // reused for all output channels blocks.
+    const size_t src_dsz = types::data_type_size(conf.src_dt);
+    const dim_t max_tile_blk = conf.is_amx ? 32 : 28;
+    const dim_t l2_tiles = static_cast<dim_t>(platform::get_per_core_cache_size(2)
+            / 2 / (wino_nxi * conf.ic_pad * src_dsz));
+    conf.tile_blk = nstl::max(
+            dim_t(1), nstl::min(nstl::min(max_tile_blk, l2_tiles), conf.tiles));
+    conf.nb_tiles = div_up(conf.tiles, conf.tile_blk);
+
+    conf.nthr = dnnl_get_max_threads();
+
+    return status::success;
+}
+
+status_t brgemm_wino_convolution_fwd_t::pd_t::init_brgemm_descs() {
+    auto &conf = conf_;
+
+    brg_descs_.resize(4);
+    for_(bool tile_tail : {false, true})
+    for (bool oc_tail : {false, true}) {
+        const dim_t M = tile_tail ? conf.tiles % conf.tile_blk : conf.tile_blk;
+        const dim_t N = oc_tail ? conf.oc % conf.oc_blk : conf.oc_blk;
+        if (M == 0 || N == 0) continue;
+
+        // M[xi] (tiles x OC) = V[xi] (tiles x IC) * U[xi] (IC x OC).
+        auto &brg = brg_descs_[brg_idx(tile_tail, oc_tail)];
+        CHECK(brgemm_desc_init(&brg, conf.isa, brgemm_addr, conf.src_dt,
+                conf.src_dt, false, false, brgemm_row_major, 1.f, 0.f,
+                conf.ic_pad, conf.oc, conf.oc_blk, M, N, conf.ic_pad));
+
+        brgemm_attr_t brg_attr;
+        brg_attr.max_bs = 1;
+        CHECK(brgemm_desc_set_attr(&brg, brg_attr));
+        CHECK(brgemm_desc_finalize(&brg));
+
+        conf.wsp_tile_per_thr_bytes = nstl::max(
+                brg.get_wsp_buffer_size(), conf.wsp_tile_per_thr_bytes);
+    }
+
+    return status::success;
+}
+
+void brgemm_wino_convolution_fwd_t::pd_t::init_scratchpad() {
+    const auto &conf = conf_;
+    const size_t src_dsz = types::data_type_size(conf.src_dt);
+
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book(key_wino_U, wino_nxi * conf.ic_pad * conf.oc, src_dsz);
+    scratchpad.book(key_wino_V,
+            conf.nthr * wino_nxi * conf.tile_blk * conf.ic_pad, src_dsz);
+    scratchpad.book<float>(
+            key_wino_M, conf.nthr * wino_nxi * conf.tile_blk * conf.oc_blk);
+    scratchpad.book<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch, conf.nthr);
+    if (conf.is_amx)
+        scratchpad.book<char>(key_conv_amx_tile_buffer,
+                static_cast<size_t>(conf.nthr) * conf.wsp_tile_per_thr_bytes);
+}
+
+status_t brgemm_wino_convolution_fwd_t::init(engine_t *engine) {
+    const auto &descs = pd()->brg_descs_;
+    brg_kernels_.resize(descs.size());
+    brgemm_palettes_.resize(descs.size());
+
+    for (size_t idx = 0; idx < descs.size(); ++idx) {
+        const auto &brg = descs[idx];
+        if (brg.bcast_dim * brg.load_dim == 0) continue;
+        brgemm_kernel_t *brg_kernel = nullptr;
+        CHECK(brgemm_kernel_create(&brg_kernel, brg));
+        CHECK(safe_ptr_assign(brg_kernels_[idx], brg_kernel));
+        if (pd()->conf_.is_amx && !brgemm_palettes_.insert(idx, brg))
+            return status::runtime_error;
+    }
+
+    CHECK(safe_ptr_assign(
+            ref_post_ops_, new ref_post_ops_t(pd()->attr()->post_ops_)));
+    CHECK(ref_post_ops_->init(pd()->dst_md()));
+
+    return status::success;
+}
+
+void brgemm_wino_convolution_fwd_t::transform_weights(
+        const exec_ctx_t &ctx, char *wino_wei) const {
+    const auto wei = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS);
+    const auto &conf = pd()->conf_;
+    const memory_desc_wrapper wei_d(pd()->weights_md());
+    const auto wei_dt = wei_d.data_type();
+    const dim_t OC = conf.oc, IC = conf.ic, IC_pad = conf.ic_pad;
+
+    // U[xi][ic][oc] = (G * g * G^T)[xi] for every (oc, ic) pair. With bf16
+    // pairs of input channels are interleaved (VNNI layout).
+    parallel_nd(IC_pad, [&](dim_t ic) {
+        std::vector<float> g(wino_r * wino_r * OC, 0.f);
+        std::vector<float> tmp(wino_alpha * wino_r * OC);
+        std::vector<float> u(wino_nxi * OC);
+        if (ic < IC) {
+            for_(dim_t oc = 0; oc < OC; oc++)
+            for_(int kh = 0; kh < wino_r; kh++)
+            for (int kw = 0; kw < wino_r; kw++)
+                g[(kh * wino_r + kw) * OC + oc] = io::load_float_value(
+                        wei_dt, wei, wei_d.off(oc, ic, kh, kw));
+        }
+        for (int j = 0; j < wino_r; j++)
+            wino_trans_weights(g.data() + j * OC, wino_r * OC,
+                    tmp.data() + j * OC, wino_r * OC, OC);
+        for (int i = 0; i < wino_alpha; i++)
+            wino_trans_weights(tmp.data() + i * wino_r * OC, OC,
+                    u.data() + i * wino_alpha * OC, OC, OC);
+
+        for (int xi = 0; xi < wino_nxi; xi++) {
+            const float *u_xi = u.data() + xi * OC;
+            if (conf.src_dt == bf16) {
+                auto *U = reinterpret_cast<bfloat16_t *>(wino_wei)
+                        + xi * IC_pad * OC + (ic / 2) * 2 * OC + ic % 2;
+                for (dim_t oc = 0; oc < OC; oc++)
+                    U[2 * oc] = u_xi[oc];
+            } else {
+                auto *U = reinterpret_cast<float *>(wino_wei)
+                        + xi * IC_pad * OC + ic * OC;
+                std::memcpy(U, u_xi, OC * sizeof(float));
+            }
+        }
+    });
+}
+
+status_t brgemm_wino_convolution_fwd_t::execute(const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    const auto bias = CTX_IN_MEM(const void *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const auto &conf = pd()->conf_;
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const dim_t IC = conf.ic, IC_pad = conf.ic_pad, OC = conf.oc;
+    const dim_t tile_blk = conf.tile_blk, oc_blk = conf.oc_blk;
+    const size_t src_dsz = types::data_type_size(conf.src_dt);
+    const bool is_bf16 = conf.src_dt == bf16;
+
+    char *wino_wei = scratchpad.template get<char>(key_wino_U);
+    transform_weights(ctx, wino_wei);
+
+    char *wino_src_base = scratchpad.template get<char>(key_wino_V);
+    float *wino_dst_base = scratchpad.template get<float>(key_wino_M);
+    auto batch_base = scratchpad.template get<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch);
+    auto wsp_tile_base = conf.is_amx
+            ? scratchpad.template get<char>(key_conv_amx_tile_buffer)
+            : nullptr;
+
+    const bool has_post_ops = pd()->attr()->post_ops_.len() > 0;
+
+    // Output channels blocks are innermost so that the input transform of
+    // a tiles block is reused.
+    const dim_t work_amount = conf.mb * conf.nb_tiles * conf.nb_oc;
+
+    parallel(conf.nthr, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        char *wino_src = wino_src_base
+                + src_dsz * ithr * wino_nxi * tile_blk * IC_pad;
+        float *wino_dst = wino_dst_base + ithr * wino_nxi * tile_blk * oc_blk;
+        brgemm_batch_element_t *batch = batch_base + ithr;
+        char *wsp_tile = conf.is_amx
+                ? wsp_tile_base + ithr * conf.wsp_tile_per_thr_bytes
+                : nullptr;
+        int prev_ker_idx = -1;
+        dim_t prev_n = -1, prev_tb = -1;
+
+        float d[wino_nxi * wino_ch_blk];
+        float tmp[wino_nxi * wino_ch_blk];
+        float v[wino_nxi * wino_ch_blk];
+
+        dim_t n {0}, tb {0}, ocb {0};
+        nd_iterator_init(start, n, conf.mb, tb, conf.nb_tiles, ocb, conf.nb_oc);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            const dim_t tile_s = tb * tile_blk;
+            const dim_t cur_tiles = nstl::min(tile_blk, conf.tiles - tile_s);
+            const dim_t oc_s = ocb * oc_blk;
+            const dim_t cur_oc = nstl::min(oc_blk, OC - oc_s);
+
+            if (n != prev_n || tb != prev_tb) {
+                // Input transform: V[xi][t][ic] = (B^T * d * B)[xi].
+                for (dim_t t = 0; t < cur_tiles; t++) {
+                    const dim_t th = (tile_s + t) / conf.tiles_w;
+                    const dim_t tw = (tile_s + t) % conf.tiles_w;
+                    const dim_t ih_s = th * wino_m - conf.t_pad;
+                    const dim_t iw_s = tw * wino_m - conf.l_pad;
+
+                    for (dim_t ic_s = 0; ic_s < IC_pad; ic_s += wino_ch_blk) {
+                        const dim_t nch = nstl::min(wino_ch_blk, IC_pad - ic_s);
+                        const dim_t nch_valid = nstl::max(
+                                dim_t(0), nstl::min(nch, IC - ic_s));
+                        for_(int i = 0; i < wino_alpha; i++)
+                        for (int j = 0; j < wino_alpha; j++) {
+                            float *d_ij = d + (i * wino_alpha + j) * nch;
+                            const dim_t ih = ih_s + i, iw = iw_s + j;
+                            const bool is_pad = ih < 0 || ih >= conf.ih
+                                    || iw < 0 || iw >= conf.iw;
+                            dim_t nloaded = 0;
+                            if (!is_pad) {
+                                const char *s = src
+                                        + src_dsz
+                                                * (src_d.blk_off(n, 0, ih, iw)
+                                                        + ic_s);
+                                if (is_bf16)
+                                    cvt_bfloat16_to_float(d_ij,
+                                            reinterpret_cast<const bfloat16_t *>(
+                                                    s),
+                                            nch_valid);
+                                else
+                                    std::memcpy(
+                                            d_ij, s, nch_valid * sizeof(float));
+                                nloaded = nch_valid;
+                            }
+                            for (dim_t c = nloaded; c < nch; c++)
+                                d_ij[c] = 0.f;
+                        }
+
+                        for (int j = 0; j < wino_alpha; j++)
+                            wino_trans_input(d + j * nch, wino_alpha * nch,
+                                    tmp + j * nch, wino_alpha * nch, nch);
+                        for (int i = 0; i < wino_alpha; i++)
+                            wino_trans_input(tmp + i * wino_alpha * nch, nch,
+                                    v + i * wino_alpha * nch, nch, nch);
+
+                        for (int xi = 0; xi < wino_nxi; xi++) {
+                            const dim_t off = (xi * tile_blk + t) * IC_pad + ic_s;
+                            if (is_bf16)
+                                cvt_float_to_bfloat16(
+                                        reinterpret_cast<bfloat16_t *>(
+                                                wino_src)
+                                                + off,
+                                        v + xi * nch, nch);
+                            else
+                                std::memcpy(reinterpret_cast<float *>(wino_src)
+                                                + off,
+                                        v + xi * nch, nch * sizeof(float));
+                        }
+                    }
+                }
+                prev_n = n;
+                prev_tb = tb;
+            }
+
+            // Elementwise products in the Winograd domain.
+            const int ker_idx = pd_t::brg_idx(
+                    cur_tiles < tile_blk, cur_oc < oc_blk);
+            brgemm_palettes_.maybe_tile_configure(
+                    conf.is_amx, prev_ker_idx, ker_idx);
+            for (int xi = 0; xi < wino_nxi; xi++) {
+                batch->ptr.A = wino_src + src_dsz * xi * tile_blk * IC_pad;
+                // In the VNNI layout an output channel takes 2 elements.
+                batch->ptr.B = wino_wei
+                        + src_dsz
+                                * (xi * IC_pad * OC
+                                        + oc_s * (is_bf16 ? 2 : 1));
+                brgemm_kernel_execute(brg_kernels_[ker_idx].get(), 1, batch,
+                        wino_dst + xi * tile_blk * oc_blk, wsp_tile);
+            }
+
+            // Output transform: y = A^T * M * A, then bias and post-ops.
+            for (dim_t t = 0; t < cur_tiles; t++) {
+                const dim_t th = (tile_s + t) / conf.tiles_w;
+                const dim_t tw = (tile_s + t) % conf.tiles_w;
+
+                for (int j = 0; j < wino_alpha; j++)
+                    wino_trans_output(wino_dst + (j * tile_blk + t) * oc_blk,
+                            wino_alpha * tile_blk * oc_blk, tmp + j * cur_oc,
+                            wino_alpha * cur_oc, cur_oc);
+                for (int i = 0; i < wino_m; i++)
+                    wino_trans_output(tmp + i * wino_alpha * cur_oc, cur_oc,
+                            v + i * wino_m * cur_oc, cur_oc, cur_oc);
+
+                for_(int i = 0; i < wino_m; i++)
+                for (int j = 0; j < wino_m; j++) {
+                    const dim_t oh = th * wino_m + i, ow = tw * wino_m + j;
+                    if (oh >= conf.oh || ow >= conf.ow) continue;
+                    float *y = v + (i * wino_m + j) * cur_oc;
+                    const dim_t dst_off = dst_d.blk_off(n, oc_s, oh, ow);
+                    for (dim_t oc = 0; oc < cur_oc; oc++) {
+                        float res = y[oc];
+                        if (conf.with_bias)
+                            res += io::load_float_value(
+                                    conf.bia_dt, bias, oc_s + oc);
+                        if (has_post_ops) {
+                            ref_post_ops_t::args_t args;
+                            args.dst_val = io::load_float_value(
+                                    conf.dst_dt, dst, dst_off + oc);
+                            ref_post_ops_->execute(res, args);
+                        }
+                        io::store_float_value(
+                                conf.dst_dt, res, dst, dst_off + oc);
+                    }
+                }
+            }
+
+            nd_iterator_step(n, conf.mb, tb, conf.nb_tiles, ocb, conf.nb_oc);
+        }
+
+        if (conf.is_amx) amx_tile_release();
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
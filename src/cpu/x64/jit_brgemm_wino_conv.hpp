@@ -0,0 +1,111 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_WINO_CONV_HPP
+#define CPU_X64_JIT_BRGEMM_WINO_CONV_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+#include "cpu/primitive_attr_postops.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/brgemm/brgemm_containers.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Winograd F(4x4, 3x3) forward convolution. The output is split into 4x4
+// tiles, each computed from a 6x6 input tile. A thread takes a block of tiles
+// and an output channels block, and computes it in three fused steps while the
+// data stays in its cache:
+// - input transform of the tiles block into V[36][tiles][IC],
+// - 36 brgemm calls M[xi] = V[xi] * U[xi], U[36][IC][OC] being the weights
+//   transformed once per execution,
+// - output transform of M into the destination with bias and post-ops.
+struct brgemm_wino_conf_t {
+    cpu_isa_t isa;
+    bool is_amx;
+
+    data_type_t src_dt, dst_dt, bia_dt;
+    dim_t mb, ic, oc, ih, iw, oh, ow;
+    dim_t t_pad, l_pad;
+    bool with_bias;
+
+    // IC padded for the VNNI layout of bf16 data.
+    dim_t ic_pad;
+    // Number of tiles along the output height and width.
+    dim_t tiles_h, tiles_w, tiles;
+    dim_t tile_blk, nb_tiles;
+    dim_t oc_blk, nb_oc;
+
+    int wsp_tile_per_thr_bytes;
+    int nthr;
+};
+
+struct brgemm_wino_convolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg_wino:", conf_.isa, ""),
+                brgemm_wino_convolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        static int brg_idx(bool tile_tail, bool oc_tail) {
+            return 2 * tile_tail + oc_tail;
+        }
+
+        brgemm_wino_conf_t conf_ = utils::zero<decltype(conf_)>();
+        std::vector<brgemm_desc_t> brg_descs_;
+
+    private:
+        status_t init_conf();
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+    };
+
+    brgemm_wino_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    void transform_weights(const exec_ctx_t &ctx, char *wino_wei) const;
+
+    std::vector<std::unique_ptr<brgemm_kernel_t>> brg_kernels_;
+    brgemm_containers::brgemm_palette_container_t brgemm_palettes_;
+    std::unique_ptr<ref_post_ops_t> ref_post_ops_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -17,11 +17,13 @@
 #ifndef CPU_X64_JIT_GENERATOR_HPP
 #define CPU_X64_JIT_GENERATOR_HPP
 
+#include <atomic>
 #include <limits.h>
 #include <vector>
 
 #include "common/bit_cast.hpp"
 #include "common/compiler_workarounds.hpp"
+#include "common/exec_trace.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
@@ -2757,6 +2759,9 @@ public:
 
     template <typename... kernel_args_t>
     void operator()(kernel_args_t... args) const {
+        if (exec_trace::enabled_flag.load(std::memory_order_relaxed)
+                && exec_trace::tracking_task_kernel)
+            exec_trace::set_task_kernel(trace_id());
         using jit_kernel_func_t = void (*)(const kernel_args_t... args);
         auto *fptr = (jit_kernel_func_t)jit_ker_;
         (*fptr)(std::forward<kernel_args_t>(args)...);
@@ -2771,10 +2776,43 @@ public:
         return (jit_ker_) ? status::success : status::runtime_error;
     }
 
+    // A kernel is relocatable when its generated code doesn't embed absolute
+    // addresses (pointers to static data, to the kernel object itself or to
+    // labels through `putL()` and `mov(reg, label)`). Only such kernels can
+    // be saved and restored in another process.
+    virtual bool is_relocatable() const { return false; }
+
+    // Restores the kernel from the code obtained with `jit_ker()` and
+    // `getSize()` by an identically configured kernel, skipping `generate()`.
+    status_t create_kernel_from_binary(
+            const Xbyak::uint8 *binary, size_t binary_size) {
+        if (!is_relocatable()) return status::unimplemented;
+        if (!binary || binary_size == 0) return status::invalid_arguments;
+        int err_code = Xbyak::GetError();
+        if (err_code == Xbyak::ERR_CANT_ALLOC) return status::out_of_memory;
+        if (err_code != Xbyak::ERR_NONE) return status::runtime_error;
+        db(binary, binary_size);
+        jit_ker_ = getCode();
+        return (jit_ker_) ? status::success : status::runtime_error;
+    }
+
     inline cpu_isa_t max_cpu_isa() const noexcept { return max_cpu_isa_; }
 
 private:
     const cpu_isa_t max_cpu_isa_;
+    // Id of the kernel in the execution trace, registered on first use.
+    mutable std::atomic<uint64_t> trace_id_ {0};
+
+    uint64_t trace_id() const {
+        uint64_t id = trace_id_.load(std::memory_order_relaxed);
+        if (id != 0) return id;
+        // Concurrent first calls may register the kernel twice, only one of
+        // the ids is used.
+        const uint64_t new_id = exec_trace::register_kernel(name());
+        if (trace_id_.compare_exchange_strong(id, new_id)) return new_id;
+        return id;
+    }
+
     const Xbyak::uint8 *getCode() {
         this->ready();
         if (!is_initialized()) return nullptr;
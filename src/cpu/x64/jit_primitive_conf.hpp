@@ -521,6 +521,7 @@ struct jit_pool_conf_t {
     int kd, kh, kw;
     int f_pad, t_pad, l_pad;
     alg_kind_t alg;
+    bool is_adaptive;
     bool is_training;
     bool pad_w_is_null;
     bool is_backward;
@@ -602,6 +603,13 @@ struct jit_resampling_conf_t {
     // the possible variants for the number of corners are 2, 4, 8.
     unsigned number_of_corners = 0;
 
+    // The cubic and antialiased linear algorithms are separable filters.
+    // Every destination point is a weighted sum of filter_taps_w points
+    // along the width and filter_taps_row rows, the latter covering both
+    // the depth and the height.
+    unsigned filter_taps_w = 0;
+    unsigned filter_taps_row = 0;
+
     bool is_data_size_bigger_than_L3 = false;
     bool is_saturation_needed = false;
     data_type_t src_data_type = data_type::undef;
@@ -635,6 +643,8 @@ struct jit_uni_resampling_args_t {
     const void *weights = nullptr;
     const void *post_ops_binary_rhs_arg_vec = nullptr;
     const void *dst_orig = nullptr;
+    const void *row_indices = nullptr;
+    const void *row_weights = nullptr;
 
     size_t c_offset = 0;
 
@@ -956,6 +966,16 @@ struct jit_reduction_conf_t {
 
     dim_t idle_size = 0;
     dim_t reduce_size = 0;
+    // Divisor of reduction_mean, differs from reduce_size only for the
+    // combining step of the split reduction.
+    dim_t mean_divisor = 0;
+
+    // When the kept elements are too few to occupy all threads, the reduced
+    // axis is split into split_nchunks chunks of split_chunk_size elements.
+    // Chunks are reduced in parallel into f32 partials which are combined
+    // afterwards.
+    dim_t split_nchunks = 1;
+    dim_t split_chunk_size = 0;
 
     bool is_saturation_needed = false;
 
@@ -19,6 +19,7 @@
 
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/experimental.hpp"
 #include "common/math_utils.hpp"
 #include "common/memory_tracking.hpp"
 #include "common/nstl.hpp"
@@ -27,6 +28,7 @@
 
 #include "cpu/cpu_batch_normalization_utils.hpp"
 #include "cpu/platform.hpp"
+#include "cpu/ref_io_helper.hpp"
 #include "cpu/x64/cpu_barrier.hpp"
 #include "cpu/x64/jit_generator.hpp"
 
@@ -55,6 +57,17 @@ bool is_nspc(const memory_desc_wrapper &d) {
     const bool is_nspc = d.matches_one_of_tag(nc, nwc, nhwc, ndhwc);
     return is_nspc;
 }
+
+// Single pass statistics accumulate sum and sum of squares of data shifted by
+// the first point of each channel. Not supported for sse41 which processes a
+// channel block in two halves, and for interleaved xf16 loads on avx2.
+bool use_stats_one_pass(const batch_normalization_pd_t *pd, cpu_isa_t isa) {
+    const bool is_avx2_ne_xf16 = isa == avx2 && mayiuse(avx2_vnni_2)
+            && utils::one_of(pd->src_md()->data_type, data_type::bf16,
+                    data_type::f16);
+    return experimental::use_bnorm_stats_one_pass() && pd->is_fwd()
+            && !pd->stats_is_src() && isa != sse41 && !is_avx2_ne_xf16;
+}
 } // namespace
 
 struct jit_bnorm_conf_t {
@@ -62,6 +75,7 @@ struct jit_bnorm_conf_t {
     // diverging definitions of derived parameters
     const batch_normalization_pd_t *pd_;
 
+    int nthr_ {0};
     int simd_w_ {0};
     size_t dt_size_ {0};
     bool is_nspc_ {false};
@@ -82,6 +96,7 @@ struct jit_bnorm_conf_t {
 
     jit_bnorm_conf_t(const batch_normalization_pd_t *pd, int nthr, int simd_w)
         : pd_(pd)
+        , nthr_(nthr)
         , simd_w_(simd_w)
         , dt_size_(types::data_type_size(pd_->src_md()->data_type)) {
 
@@ -252,6 +267,10 @@ struct jit_bnorm_t : public jit_generator_t {
     bool is_bf16_ = false;
     bool is_f16_ = false;
     bool is_avx2_ne_xf16_ = false;
+    bool stats_one_pass_ = false;
+    // one-pass statistics keep sums of squares and channel shifts in the
+    // reduction buffer at this distance after the sums and squares
+    size_t rbuf_sq_offt_ = 0;
 
     // set by ctor depending on data type (xF16 or FP32);
     int vlen_spat_data_ = 0;
@@ -736,6 +755,14 @@ struct jit_bnorm_t : public jit_generator_t {
         return vmmword[reg_diff_shift + reg_coff + offt];
     }
 
+    Address rbuf_sq_ptr(size_t offt = 0) {
+        return vmmword[reg_rbuf1 + reg_coff + rbuf_sq_offt_ + offt];
+    }
+
+    Address stat_shift_ptr(size_t offt = 0) {
+        return vmmword[reg_rbuf1 + reg_coff + 2 * rbuf_sq_offt_ + offt];
+    }
+
     Address gamma_ptr(size_t offt = 0) {
         return vmmword[reg_scale + reg_coff + offt];
     }
@@ -818,6 +845,49 @@ struct jit_bnorm_t : public jit_generator_t {
         }
     }
 
+    void mean_var_channels() {
+        Label ch_label;
+        L(ch_label);
+        {
+            uni_vmovups(vmean, stat_shift_ptr());
+            uni_vmovups(Vmm(0), vmmword[reg_rbuf1 + reg_coff]);
+            uni_vmovups(Vmm(1), rbuf_sq_ptr());
+            spat_loop(
+                    spat_size, unroll_blocks, unroll_regs,
+                    [this](size_t base_reg) {
+                        Vmm v = Vmm(base_reg * 3);
+                        Vmm vsq = Vmm(base_reg * 3 + 1);
+                        if (base_reg) {
+                            uni_vpxor(v, v, v);
+                            uni_vpxor(vsq, vsq, vsq);
+                        }
+                    },
+                    [this](size_t base_reg, size_t i) {
+                        Vmm v = Vmm(3 * base_reg);
+                        Vmm vsq = Vmm(3 * base_reg + 1);
+                        Vmm vtmp0 = Vmm(3 * base_reg + 2);
+                        size_t offt = i * vlen_spat_data_;
+                        uni_vmovups_spat_data(
+                                vtmp0, vmmword[reg_src + reg_soff + offt]);
+                        uni_vsubps(vtmp0, vtmp0, vmean);
+                        uni_vaddps(v, v, vtmp0);
+                        uni_vfmadd231ps(vsq, vtmp0, vtmp0);
+                    },
+                    [this](size_t base_reg) {
+                        if (base_reg) {
+                            uni_vaddps(Vmm(0), Vmm(0), Vmm(base_reg * 3));
+                            uni_vaddps(Vmm(1), Vmm(1), Vmm(base_reg * 3 + 1));
+                        }
+                    });
+            uni_vmovups(vmmword[reg_rbuf1 + reg_coff], Vmm(0));
+            uni_vmovups(rbuf_sq_ptr(), Vmm(1));
+
+            add(reg_coff, vlen);
+            cmp(reg_coff, reg_coff_max);
+            jl(ch_label);
+        }
+    }
+
     void mean_variance_nspc(
             const int num_ch_blks, int num_spat_pts, bool compute_mean) {
 
@@ -884,6 +954,23 @@ struct jit_bnorm_t : public jit_generator_t {
             }
         };
 
+        auto mean_variance_compute = [this](int num_ch_blks,
+                                             int num_spat_pts) {
+            for (int spat_pt = 0; spat_pt < num_spat_pts; ++spat_pt) {
+                for (int ch_idx = 0; ch_idx < num_ch_blks; ++ch_idx) {
+                    const int offt = ch_idx * vlen_spat_data_;
+                    const Vmm vsrc = vtmp;
+                    const Vmm vsum_sq_ch = Vmm(ch_idx + num_ch_blks);
+                    uni_vmovups_spat_data(
+                            vsrc, vmmword[reg_src + reg_soff_nspc + offt]);
+                    uni_vsubps(vsrc, vsrc, stat_shift_ptr(ch_idx * vlen));
+                    uni_vaddps(Vmm(ch_idx), Vmm(ch_idx), vsrc);
+                    uni_vfmadd231ps(vsum_sq_ch, vsrc, vsrc);
+                }
+                add(reg_soff_nspc, spat_step);
+            }
+        };
+
         auto variance_compute = [this](int num_ch_blks, int num_spat_pts) {
             for (int spat_pt = 0; spat_pt < num_spat_pts; ++spat_pt) {
                 for (int ch_idx = 0; ch_idx < num_ch_blks; ++ch_idx) {
@@ -902,7 +989,10 @@ struct jit_bnorm_t : public jit_generator_t {
         for (int idx = 0; idx < num_ch_blks; ++idx) {
             const int coff = idx * vlen;
             uni_vmovups(Vmm(idx), vmmword[reg_rbuf1 + reg_coff + coff]);
-            if (!compute_mean) {
+            if (stats_one_pass_) {
+                const Vmm vsum_sq_ch = Vmm(idx + num_ch_blks);
+                uni_vmovups(vsum_sq_ch, rbuf_sq_ptr(coff));
+            } else if (!compute_mean) {
                 // pre-load mean to avoid extra data movement during variance
                 const Vmm vmean_ch = Vmm(idx + num_ch_blks);
                 uni_vmovups_maybe_tail(vmean_ch, mean_ptr(coff));
@@ -931,6 +1021,8 @@ struct jit_bnorm_t : public jit_generator_t {
                         ? mean_compute_avx2_ne_xf16(num_ch_blks, num_spat_pts)
                         : variance_compute_avx2_ne_xf16(
                                 num_ch_blks, num_spat_pts);
+            else if (stats_one_pass_)
+                mean_variance_compute(num_ch_blks, num_spat_pts);
             else
                 compute_mean ? mean_compute(num_ch_blks, num_spat_pts)
                              : variance_compute(num_ch_blks, num_spat_pts);
@@ -941,6 +1033,8 @@ struct jit_bnorm_t : public jit_generator_t {
         for (int idx = 0; idx < num_ch_blks; ++idx) {
             const int coff = idx * vlen;
             uni_vmovups(vmmword[reg_rbuf1 + reg_coff + coff], Vmm(idx));
+            if (stats_one_pass_)
+                uni_vmovups(rbuf_sq_ptr(coff), Vmm(idx + num_ch_blks));
         }
     }
 
@@ -1165,6 +1259,53 @@ struct jit_bnorm_t : public jit_generator_t {
         }
     }
 
+    // Reduction of one-pass statistics: with d = E[x - K], where K is the
+    // channel shift, mean = K + d and variance = E[(x - K)^2] - d^2.
+    void reduce_mean_variance() {
+        Label no_reduction;
+        barrier();
+        {
+            mov(reg_tmp, ptr[rsp + stack_off_N_ithr]);
+            cmp(reg_tmp, 0);
+            jne(no_reduction);
+            mov(reg_nnthr, ptr[rsp + stack_off_N_nthr]);
+            xor_(reg_coff, reg_coff);
+            Label reduction_channels;
+            L(reduction_channels);
+            {
+                mov(reg_roff, reg_coff);
+                uni_vpxor(Vmm(0), Vmm(0), Vmm(0));
+                uni_vpxor(Vmm(1), Vmm(1), Vmm(1));
+                mov(reg_ctr, reg_nnthr);
+                Label reduction_thrs;
+                L(reduction_thrs);
+                {
+                    uni_vaddps(Vmm(0), Vmm(0), vmmword[reg_rbuf1 + reg_roff]);
+                    uni_vaddps(Vmm(1), Vmm(1),
+                            vmmword[reg_rbuf1 + reg_roff + rbuf_sq_offt_]);
+                    add(reg_roff, reg_coff_max);
+                    sub(reg_ctr, 1);
+                    jnz(reduction_thrs);
+                }
+                uni_vdivps(Vmm(0), Vmm(0), vchan_size);
+                uni_vdivps(Vmm(1), Vmm(1), vchan_size);
+                uni_vfnmadd231ps(Vmm(1), Vmm(0), Vmm(0));
+                // rounding may make variance slightly negative
+                uni_vpxor(Vmm(2), Vmm(2), Vmm(2));
+                uni_vmaxps(Vmm(1), Vmm(1), Vmm(2));
+                uni_vaddps(Vmm(0), Vmm(0), stat_shift_ptr());
+                uni_vmovups_maybe_tail(mean_ptr(), Vmm(0));
+                uni_vmovups_maybe_tail(var_ptr(), Vmm(1));
+
+                add(reg_coff, vlen);
+                cmp(reg_coff, reg_coff_max);
+                jl(reduction_channels);
+            }
+        }
+        L(no_reduction);
+        barrier();
+    }
+
     void compute_mean_variance() {
         uni_vpxor(Vmm(0), Vmm(0), Vmm(0));
         xor_(reg_coff, reg_coff);
@@ -1172,6 +1313,7 @@ struct jit_bnorm_t : public jit_generator_t {
         L(zero_rbuf);
         {
             uni_vmovups(vmmword[reg_rbuf1 + reg_coff], Vmm(0));
+            if (stats_one_pass_) uni_vmovups(rbuf_sq_ptr(), Vmm(0));
             add(reg_coff, isa == sse41 ? vlen / 2 : vlen);
             cmp(reg_coff, reg_coff_max);
             jne(zero_rbuf);
@@ -1187,7 +1329,10 @@ struct jit_bnorm_t : public jit_generator_t {
 
             if (isa == sse41) mov(reg_tmp_off, reg_soff);
 
-            jbp_->is_nspc_ ? compute_mean_variance_nspc() : mean_channels();
+            if (jbp_->is_nspc_)
+                compute_mean_variance_nspc();
+            else
+                stats_one_pass_ ? mean_var_channels() : mean_channels();
 
             if (isa == sse41) {
                 mov(reg_soff, reg_tmp_off);
@@ -1214,6 +1359,11 @@ struct jit_bnorm_t : public jit_generator_t {
 
         if (jbp_->is_nspc_) mov(reg_src, ptr[rsp + stack_off_src]); // comeback
 
+        if (stats_one_pass_) {
+            reduce_mean_variance();
+            return;
+        }
+
         Label no_mean_reduction;
         barrier();
         {
@@ -2081,6 +2231,10 @@ struct jit_bnorm_t : public jit_generator_t {
         , is_f16_(pd_->src_md()->data_type == data_type::f16)
         , is_avx2_ne_xf16_(
                   isa == avx2 && mayiuse(avx2_vnni_2) && (is_bf16_ || is_f16_))
+        , stats_one_pass_(use_stats_one_pass(pd_, isa))
+        , rbuf_sq_offt_(stats_one_pass_
+                          ? sizeof(acc_data_t) * get_c_padded(pd_) * jbp_->nthr_
+                          : 0)
         , vlen_spat_data_(vlen / (1 + is_xf16())) // 32B of xF16 -> 64B of FP32
         , unroll_blocks(isa == avx512_core && !jbp_->is_spatial_thr_ ? 4 : 1)
         , unroll_regs(isa == avx512_core && !jbp_->is_spatial_thr_ ? 4 : 1) {
@@ -2142,7 +2296,10 @@ struct driver_t : public c_compatible {
         auto sbuf_sz = use_tmp_stats(pd) * 2 * C_PADDED;
         auto pbuf_sz
                 = (use_tmp_diff_scale(pd) + use_tmp_diff_shift(pd)) * C_PADDED;
-        auto rbuf_sz = (pd->is_fwd() ? 1 : 2) * C_PADDED * nthr;
+        // one-pass statistics also keep sums of squares and channel shifts
+        const int n_rbufs = pd->is_fwd() ? (use_stats_one_pass(pd, isa) ? 3 : 1)
+                                         : 2;
+        auto rbuf_sz = n_rbufs * C_PADDED * nthr;
 
         scratchpad.book<acc_data_t>(key_bnorm_tmp_stats, sbuf_sz);
         scratchpad.book<acc_data_t>(key_bnorm_tmp_diff_ss, pbuf_sz);
@@ -2289,6 +2446,21 @@ struct driver_t : public c_compatible {
                             * simd_w;
             // rbuf1 and rbuf2 have to be disjoint
             p.rbuf2 = p.rbuf1 + C_PADDED * nthr;
+            if (ker_.stats_one_pass_) {
+                // Shift each channel by its first point. Every thread reducing
+                // the channel must use the same value.
+                acc_data_t *stat_shift
+                        = rbuf + 2 * C_PADDED * nthr + (p.rbuf1 - rbuf);
+                const dim_t src_off = jbp_.is_nspc_
+                        ? coff_base
+                        : global_C_blk_s * p.spat_size * simd_w;
+                const dim_t blk_stride = jbp_.is_nspc_ ? simd_w : SP * simd_w;
+                for (dim_t cb = 0; cb < C_blks_thr; cb++)
+                    for (dim_t c = 0; c < simd_w; c++)
+                        stat_shift[cb * simd_w + c] = io::load_float_value(
+                                pd_->src_md()->data_type, src,
+                                src_off + cb * blk_stride + c);
+            }
             p.is_cblk_tail
                     = (it * jbp_.C_blks_per_iter_ + C_blk_e) * simd_w > C;
 
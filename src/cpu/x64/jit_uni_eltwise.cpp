@@ -95,7 +95,8 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
         eltwise_injector_.reset(new jit_uni_eltwise_injector_t<injector_isa>(
                 this, desc.alg_kind, desc.alpha, desc.beta, 1.f, data_type::f32,
                 save_state, reg_injector_table, injector_mask, is_fwd_,
-                pd_->use_dst()));
+                pd_->use_dst(), true /*preserve_vmm*/,
+                true /*preserve_p_table*/, pd_->attr()->fpmath_.mode_));
         io::io_conf_t io_conf;
         io::io_tail_conf_t io_tail_conf(simd_w_, tail_size_, tail_opmask_idx_,
                 vmm_tail_mask.getIdx(), reg_tmp);
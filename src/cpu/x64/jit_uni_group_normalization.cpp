@@ -758,6 +758,444 @@ protected:
 template struct kernel_stat_t<avx2>;
 template struct kernel_stat_t<avx512_core>;
 
+template <cpu_isa_t isa>
+struct kernel_diff_ss_t
+    : public jit_uni_group_normalization_bwd_t::kernel_diff_ss_base_t,
+      public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(
+            jit_uni_group_normalization_bwd_t::kernel_diff_ss_t);
+
+    kernel_diff_ss_t(const group_normalization_pd_t *pd)
+        : jit_generator_t(jit_name())
+        , src_d_(pd->src_md())
+        , diff_dst_d_(pd->diff_dst_md())
+        , C_(pd->C())
+        , C_PER_G_(pd->C() / pd->G())
+        , simd_w_(vlen / sizeof(float))
+        , axis_simd_tail_(C_PER_G_ % simd_w_)
+        , n_vecs_(utils::div_up(C_PER_G_, simd_w_)) {
+
+        io::io_conf_t io_conf;
+        io::io_tail_conf_t io_tail_conf(simd_w_, axis_simd_tail_,
+                tail_opmask_idx, vmm_tail_mask.getIdx(), reg_tmp);
+        io::io_emu_bf16_conf_t io_bf16_conf(bf16_emu_zmm_1_idx,
+                bf16_emu_zmm_2_idx, bf16_emu_zmm_3_idx, reg_tmp,
+                bf16_emu_zmm_4_idx);
+        const auto io_isa = get_io_isa(isa,
+                utils::one_of(f16, src_d_.data_type(), diff_dst_d_.data_type()),
+                utils::one_of(
+                        bf16, src_d_.data_type(), diff_dst_d_.data_type()));
+        io_ = io::jit_io_multi_dt_helper_t<Vmm>(this, io_isa,
+                {src_d_.data_type(), diff_dst_d_.data_type(), f32 /* stats */},
+                io_conf, io_tail_conf, io_bf16_conf);
+
+        VDEBUGINFO(1, primitive, group_normalization,
+                "%s:\n    C_=%" PRId64 "\n    C_PER_G_=%" PRId64
+                "\n    simd_w_=%zu\n    axis_simd_tail_=%" PRId64
+                "\n    n_vecs_=%" PRId64,
+                jit_name(), C_, C_PER_G_, simd_w_, axis_simd_tail_, n_vecs_);
+    }
+
+    status_t create_kernel() override {
+        return jit_generator_t::create_kernel();
+    }
+
+    void generate() override {
+        preamble();
+
+        io_.init_bf16();
+        if (axis_simd_tail_) io_.prepare_tail_mask();
+
+#define PARAM_OFF(x) offsetof(ker_args_t, x)
+        mov(reg_src_start, ptr[reg_param + PARAM_OFF(src)]);
+        mov(reg_diff_dst_start, ptr[reg_param + PARAM_OFF(diff_dst)]);
+        mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
+        mov(reg_diff_gamma, ptr[reg_param + PARAM_OFF(diff_gamma)]);
+        mov(reg_diff_beta, ptr[reg_param + PARAM_OFF(diff_beta)]);
+#undef PARAM_OFF
+
+        // Broadcasting a single mean value per group.
+        io_[f32]->broadcast(mean_ptr(), vmm_mean);
+
+        // Channels are processed in blocks of `unroll_c_` vectors, each block
+        // goes through the whole spatial block accumulating sums in
+        // registers.
+        for (dim_t v = 0; v < n_vecs_; v += unroll_c_) {
+            const dim_t unroll = std::min(unroll_c_, n_vecs_ - v);
+            compute_block(v, unroll);
+        }
+
+        postamble();
+    }
+
+    void operator()(const void *src, const void *diff_dst, const float *mean,
+            float *diff_gamma, float *diff_beta,
+            size_t block_size) const override {
+        ker_args_t args;
+        args.src = src;
+        args.diff_dst = diff_dst;
+        args.mean = mean;
+        args.diff_gamma = diff_gamma;
+        args.diff_beta = diff_beta;
+        args.block_size
+                = block_size * C_ * types::data_type_size(src_d_.data_type());
+
+        jit_generator_t::operator()(&args);
+    }
+
+protected:
+    using Vmm = typename cpu_isa_traits_t<isa>::Vmm;
+    const Xbyak::AddressFrame &vmmword = (isa == sse41) ? xword
+            : (isa == avx2)                             ? yword
+                                                        : zword;
+    const int vlen = cpu_isa_traits_t<isa>::vlen;
+
+    struct ker_args_t {
+        const void *src;
+        const void *diff_dst;
+        const float *mean;
+        float *diff_gamma;
+        float *diff_beta;
+        size_t block_size;
+    };
+
+    const memory_desc_wrapper src_d_, diff_dst_d_;
+    const dim_t C_;
+    const dim_t C_PER_G_;
+    const size_t simd_w_;
+    const dim_t axis_simd_tail_;
+    const dim_t n_vecs_;
+    static constexpr dim_t unroll_c_ = 4;
+
+    io::jit_io_multi_dt_helper_t<Vmm> io_;
+
+    void compute_block(dim_t v_start, dim_t unroll) {
+        const size_t c_src_size
+                = C_ * types::data_type_size(src_d_.data_type());
+        const size_t c_diff_dst_size
+                = C_ * types::data_type_size(diff_dst_d_.data_type());
+        const auto is_tail = [&](dim_t v) {
+            return axis_simd_tail_ && v == n_vecs_ - 1;
+        };
+
+        for (dim_t ur = 0; ur < unroll; ur++) {
+            uni_vpxor(Vmm_diff_beta(ur), Vmm_diff_beta(ur), Vmm_diff_beta(ur));
+            uni_vpxor(Vmm_diff_gamma(ur), Vmm_diff_gamma(ur),
+                    Vmm_diff_gamma(ur));
+        }
+
+#define PARAM_OFF(x) offsetof(ker_args_t, x)
+        mov(reg_sp_block_end, ptr[reg_param + PARAM_OFF(block_size)]);
+#undef PARAM_OFF
+        mov(reg_src, reg_src_start);
+        mov(reg_diff_dst, reg_diff_dst_start);
+        // add block_start to block_size to define block_end
+        add(reg_sp_block_end, reg_src);
+
+        Xbyak::Label sp_blk_loop, sp_blk_loop_end;
+        L(sp_blk_loop);
+        {
+            cmp(reg_sp_block_end, reg_src);
+            jle(sp_blk_loop_end, T_NEAR);
+
+            for (dim_t ur = 0; ur < unroll; ur++) {
+                const dim_t offt = (v_start + ur) * simd_w_;
+                const bool tail = is_tail(v_start + ur);
+                // Lanes beyond the tail are zeroes for both tensors, thus,
+                // they don't contribute into sums.
+                io_[src_d_.data_type()]->load(src_ptr(offt), vmm_src, tail);
+                io_[diff_dst_d_.data_type()]->load(
+                        diff_dst_ptr(offt), vmm_diff_dst, tail);
+                uni_vsubps(vmm_src, vmm_src, vmm_mean);
+                uni_vaddps(Vmm_diff_beta(ur), Vmm_diff_beta(ur), vmm_diff_dst);
+                uni_vfmadd231ps(Vmm_diff_gamma(ur), vmm_diff_dst, vmm_src);
+            }
+
+            add(reg_src, c_src_size);
+            add(reg_diff_dst, c_diff_dst_size);
+            jmp(sp_blk_loop);
+        }
+        L(sp_blk_loop_end);
+
+        for (dim_t ur = 0; ur < unroll; ur++) {
+            const dim_t offt = (v_start + ur) * simd_w_;
+            const bool tail = is_tail(v_start + ur);
+            io_[f32]->store(Vmm_diff_gamma(ur), diff_gamma_ptr(offt), tail);
+            io_[f32]->store(Vmm_diff_beta(ur), diff_beta_ptr(offt), tail);
+        }
+    }
+
+    Vmm Vmm_diff_beta(dim_t ur = 0) { return Vmm(1 + 0 * unroll_c_ + ur); }
+    Vmm Vmm_diff_gamma(dim_t ur = 0) { return Vmm(1 + 1 * unroll_c_ + ur); }
+
+    Xbyak::Address src_ptr(size_t offt = 0) {
+        return vmmword[reg_src + offt * src_d_.data_type_size()];
+    }
+
+    Xbyak::Address diff_dst_ptr(size_t offt = 0) {
+        return vmmword[reg_diff_dst + offt * diff_dst_d_.data_type_size()];
+    }
+
+    Xbyak::Address mean_ptr(size_t offt = 0) {
+        return vmmword[reg_mean + offt * sizeof(float)];
+    }
+
+    Xbyak::Address diff_gamma_ptr(size_t offt = 0) {
+        return vmmword[reg_diff_gamma + offt * sizeof(float)];
+    }
+
+    Xbyak::Address diff_beta_ptr(size_t offt = 0) {
+        return vmmword[reg_diff_beta + offt * sizeof(float)];
+    }
+
+    const Xbyak::Reg64 reg_param = abi_param1;
+    const Xbyak::Reg64 reg_src = rdx;
+    const Xbyak::Reg64 reg_src_start = rax;
+    const Xbyak::Reg64 reg_mean = rbx;
+    const Xbyak::Reg64 reg_diff_dst = r8;
+    const Xbyak::Reg64 reg_sp_block_end = r9;
+    const Xbyak::Reg64 reg_diff_dst_start = r10;
+    const Xbyak::Reg64 reg_tmp = r11;
+    const Xbyak::Reg64 reg_diff_gamma = r12;
+    const Xbyak::Reg64 reg_diff_beta = r13;
+
+    const Vmm vmm_tail_mask = Vmm(0);
+    const Vmm vmm_src = Vmm(9);
+    const Vmm vmm_diff_dst = Vmm(10);
+    const Vmm vmm_mean = Vmm(11);
+
+    const int bf16_emu_zmm_1_idx = 28;
+    const int bf16_emu_zmm_2_idx = 29;
+    const int bf16_emu_zmm_3_idx = 30;
+    const int bf16_emu_zmm_4_idx = 31;
+    const int tail_opmask_idx = 1;
+};
+
+template struct kernel_diff_ss_t<avx2>;
+template struct kernel_diff_ss_t<avx512_core>;
+
+template <cpu_isa_t isa>
+struct kernel_diff_src_t
+    : public jit_uni_group_normalization_bwd_t::kernel_diff_src_base_t,
+      public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(
+            jit_uni_group_normalization_bwd_t::kernel_diff_src_t);
+
+    kernel_diff_src_t(const group_normalization_pd_t *pd)
+        : jit_generator_t(jit_name())
+        , src_d_(pd->src_md())
+        , diff_dst_d_(pd->diff_dst_md())
+        , diff_src_d_(pd->diff_src_md())
+        , C_(pd->C())
+        , C_PER_G_(pd->C() / pd->G())
+        , simd_w_(vlen / sizeof(float))
+        , axis_simd_full_(C_PER_G_ / simd_w_)
+        , axis_simd_tail_(C_PER_G_ % simd_w_)
+        , use_scale_(pd->use_scale())
+        , calculate_diff_stats_(!pd->stats_is_src()) {
+
+        io::io_conf_t io_conf;
+        io::io_tail_conf_t io_tail_conf(simd_w_, axis_simd_tail_,
+                tail_opmask_idx, vmm_tail_mask.getIdx(), reg_tmp);
+        io::io_emu_bf16_conf_t io_bf16_conf(bf16_emu_zmm_1_idx,
+                bf16_emu_zmm_2_idx, bf16_emu_zmm_3_idx, reg_tmp,
+                bf16_emu_zmm_4_idx);
+        const auto io_isa = get_io_isa(isa,
+                utils::one_of(f16, src_d_.data_type(), diff_dst_d_.data_type(),
+                        diff_src_d_.data_type()),
+                utils::one_of(bf16, src_d_.data_type(),
+                        diff_dst_d_.data_type(), diff_src_d_.data_type()));
+        io_ = io::jit_io_multi_dt_helper_t<Vmm>(this, io_isa,
+                {src_d_.data_type(), diff_dst_d_.data_type(),
+                        diff_src_d_.data_type(), f32 /* stats */},
+                io_conf, io_tail_conf, io_bf16_conf);
+
+        VDEBUGINFO(1, primitive, group_normalization,
+                "%s:\n    C_=%" PRId64 "\n    C_PER_G_=%" PRId64
+                "\n    simd_w_=%zu\n    axis_simd_full_=%" PRId64
+                "\n    axis_simd_tail_=%" PRId64
+                "\n    use_scale_=%d\n    calculate_diff_stats_=%d",
+                jit_name(), C_, C_PER_G_, simd_w_, axis_simd_full_,
+                axis_simd_tail_, use_scale_, calculate_diff_stats_);
+    }
+
+    status_t create_kernel() override {
+        return jit_generator_t::create_kernel();
+    }
+
+    void generate() override {
+        const size_t c_src_size
+                = C_ * types::data_type_size(src_d_.data_type());
+        const size_t c_diff_dst_size
+                = C_ * types::data_type_size(diff_dst_d_.data_type());
+        const size_t c_diff_src_size
+                = C_ * types::data_type_size(diff_src_d_.data_type());
+
+        preamble();
+
+        io_.init_bf16();
+        if (axis_simd_tail_) io_.prepare_tail_mask();
+
+#define PARAM_OFF(x) offsetof(ker_args_t, x)
+        mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+        mov(reg_diff_dst, ptr[reg_param + PARAM_OFF(diff_dst)]);
+        mov(reg_diff_src, ptr[reg_param + PARAM_OFF(diff_src)]);
+        mov(reg_scale, ptr[reg_param + PARAM_OFF(scale)]);
+        mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
+        mov(reg_coeffs, ptr[reg_param + PARAM_OFF(coeffs)]);
+        mov(reg_block_end, ptr[reg_param + PARAM_OFF(block_size)]);
+#undef PARAM_OFF
+
+        // Broadcasting a single mean value and coefficients per group.
+        io_[f32]->broadcast(mean_ptr(), vmm_mean);
+        io_[f32]->broadcast(coeff_ptr(0), vmm_coeff_dd);
+        io_[f32]->broadcast(coeff_ptr(1), vmm_coeff_mean);
+        io_[f32]->broadcast(coeff_ptr(2), vmm_coeff_src);
+
+        // add block_start to block_size to define block_end
+        add(reg_block_end, reg_src);
+
+        Xbyak::Label unroll_loop, end;
+        L(unroll_loop);
+        {
+            cmp(reg_block_end, reg_src);
+            jle(end, T_NEAR);
+
+            compute_diff_src();
+
+            add(reg_src, c_src_size);
+            add(reg_diff_dst, c_diff_dst_size);
+            add(reg_diff_src, c_diff_src_size);
+
+            jmp(unroll_loop);
+        }
+        L(end);
+
+        postamble();
+    }
+
+    void operator()(const void *src, const void *diff_dst, void *diff_src,
+            const float *scale, const float *mean, const float *coeffs,
+            size_t block_size) const override {
+        ker_args_t args;
+        args.src = src;
+        args.diff_dst = diff_dst;
+        args.diff_src = diff_src;
+        args.scale = scale;
+        args.mean = mean;
+        args.coeffs = coeffs;
+        args.block_size
+                = block_size * C_ * types::data_type_size(src_d_.data_type());
+
+        jit_generator_t::operator()(&args);
+    }
+
+protected:
+    using Vmm = typename cpu_isa_traits_t<isa>::Vmm;
+    const Xbyak::AddressFrame &vmmword = (isa == sse41) ? xword
+            : (isa == avx2)                             ? yword
+                                                        : zword;
+    const int vlen = cpu_isa_traits_t<isa>::vlen;
+
+    struct ker_args_t {
+        const void *src;
+        const void *diff_dst;
+        void *diff_src;
+        const float *scale;
+        const float *mean;
+        const float *coeffs;
+        size_t block_size;
+    };
+
+    const memory_desc_wrapper src_d_, diff_dst_d_, diff_src_d_;
+    const dim_t C_;
+    const dim_t C_PER_G_;
+    const size_t simd_w_;
+    const dim_t axis_simd_full_;
+    const dim_t axis_simd_tail_;
+    const bool use_scale_;
+    const bool calculate_diff_stats_;
+
+    io::jit_io_multi_dt_helper_t<Vmm> io_;
+
+    void compute_diff_src_body(size_t offt_elems, bool tail = false) {
+        io_[diff_dst_d_.data_type()]->load(
+                diff_dst_ptr(offt_elems), vmm_diff_dst, tail);
+        if (use_scale_) {
+            io_[f32]->load(scale_ptr(offt_elems), vmm_scale, tail);
+            uni_vmulps(vmm_diff_dst, vmm_diff_dst, vmm_scale);
+        }
+        uni_vmulps(vmm_diff_dst, vmm_diff_dst, vmm_coeff_dd);
+        if (calculate_diff_stats_) {
+            io_[src_d_.data_type()]->load(src_ptr(offt_elems), vmm_src, tail);
+            uni_vsubps(vmm_src, vmm_src, vmm_mean);
+            uni_vfnmadd231ps(vmm_diff_dst, vmm_src, vmm_coeff_src);
+            uni_vsubps(vmm_diff_dst, vmm_diff_dst, vmm_coeff_mean);
+        }
+        io_[diff_src_d_.data_type()]->store(
+                vmm_diff_dst, diff_src_ptr(offt_elems), tail);
+    }
+
+    void compute_diff_src() {
+        for (dim_t i = 0; i < axis_simd_full_; i++)
+            compute_diff_src_body(i * simd_w_);
+        if (axis_simd_tail_)
+            compute_diff_src_body(axis_simd_full_ * simd_w_, true);
+    }
+
+    Xbyak::Address src_ptr(size_t offt = 0) {
+        return vmmword[reg_src + offt * src_d_.data_type_size()];
+    }
+
+    Xbyak::Address diff_dst_ptr(size_t offt = 0) {
+        return vmmword[reg_diff_dst + offt * diff_dst_d_.data_type_size()];
+    }
+
+    Xbyak::Address diff_src_ptr(size_t offt = 0) {
+        return vmmword[reg_diff_src + offt * diff_src_d_.data_type_size()];
+    }
+
+    Xbyak::Address mean_ptr(size_t offt = 0) {
+        return vmmword[reg_mean + offt * sizeof(float)];
+    }
+
+    Xbyak::Address coeff_ptr(size_t offt = 0) {
+        return vmmword[reg_coeffs + offt * sizeof(float)];
+    }
+
+    Xbyak::Address scale_ptr(size_t offt = 0) {
+        return vmmword[reg_scale + offt * sizeof(float)];
+    }
+
+    const Xbyak::Reg64 reg_param = abi_param1;
+    const Xbyak::Reg64 reg_src = rdx;
+    const Xbyak::Reg64 reg_diff_dst = rax;
+    const Xbyak::Reg64 reg_diff_src = rbx;
+    const Xbyak::Reg64 reg_scale = r8;
+    const Xbyak::Reg64 reg_block_end = r9;
+    const Xbyak::Reg64 reg_mean = r10;
+    const Xbyak::Reg64 reg_tmp = r11;
+    const Xbyak::Reg64 reg_coeffs = r12;
+
+    const Vmm vmm_tail_mask = Vmm(0);
+    const Vmm vmm_coeff_dd = Vmm(1);
+    const Vmm vmm_coeff_mean = Vmm(2);
+    const Vmm vmm_coeff_src = Vmm(3);
+    const Vmm vmm_mean = Vmm(4);
+    const Vmm vmm_scale = Vmm(5);
+    const Vmm vmm_diff_dst = Vmm(6);
+    const Vmm vmm_src = Vmm(7);
+
+    const int bf16_emu_zmm_1_idx = 28;
+    const int bf16_emu_zmm_2_idx = 29;
+    const int bf16_emu_zmm_3_idx = 30;
+    const int bf16_emu_zmm_4_idx = 31;
+    const int tail_opmask_idx = 1;
+};
+
+template struct kernel_diff_src_t<avx2>;
+template struct kernel_diff_src_t<avx512_core>;
+
 } // namespace
 
 jit_uni_group_normalization_fwd_t::kernel_base_t *
@@ -1085,6 +1523,238 @@ status_t jit_uni_group_normalization_fwd_t::execute_forward(
     return status::success;
 }
 
+jit_uni_group_normalization_bwd_t::kernel_diff_ss_base_t *
+jit_uni_group_normalization_bwd_t::kernel_diff_ss_base_t::create(
+        const group_normalization_pd_t *pd) {
+    if (mayiuse(avx512_core)) {
+        return new kernel_diff_ss_t<avx512_core>(pd);
+    } else if (mayiuse(avx2)) {
+        return new kernel_diff_ss_t<avx2>(pd);
+    } else {
+        assert(!"kernel is empty.");
+        return nullptr;
+    }
+}
+
+jit_uni_group_normalization_bwd_t::kernel_diff_src_base_t *
+jit_uni_group_normalization_bwd_t::kernel_diff_src_base_t::create(
+        const group_normalization_pd_t *pd) {
+    if (mayiuse(avx512_core)) {
+        return new kernel_diff_src_t<avx512_core>(pd);
+    } else if (mayiuse(avx2)) {
+        return new kernel_diff_src_t<avx2>(pd);
+    } else {
+        assert(!"kernel is empty.");
+        return nullptr;
+    }
+}
+
+status_t jit_uni_group_normalization_bwd_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using namespace format_tag;
+
+    VDISPATCH_GNORM(!is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_GNORM(mayiuse(avx2), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_GNORM(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_GNORM(utils::one_of(src_md()->data_type, f32, bf16, f16),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_GNORM(utils::one_of(diff_dst_md()->data_type, f32, bf16, f16),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_GNORM(utils::one_of(diff_src_md()->data_type, f32, bf16, f16),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_GNORM(IMPLICATION(utils::one_of(bf16, src_md()->data_type,
+                                        diff_dst_md()->data_type,
+                                        diff_src_md()->data_type),
+                            mayiuse(avx512_core) || mayiuse(avx2_vnni_2)),
+            VERBOSE_ISA_DT_MISMATCH);
+    VDISPATCH_GNORM(IMPLICATION(utils::one_of(f16, src_md()->data_type,
+                                        diff_dst_md()->data_type,
+                                        diff_src_md()->data_type),
+                            mayiuse(avx512_core_fp16) || mayiuse(avx2_vnni_2)),
+            VERBOSE_ISA_DT_MISMATCH);
+    VDISPATCH_GNORM(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_GNORM(set_default_formats_common(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_GNORM(
+            memory_desc_matches_one_of_tag(*src_md(), ndhwc, nhwc, nwc, nc),
+            VERBOSE_UNSUPPORTED_TAG_S, "src");
+    VDISPATCH_GNORM(memory_desc_matches_one_of_tag(
+                            *diff_dst_md(), ndhwc, nhwc, nwc, nc),
+            VERBOSE_UNSUPPORTED_TAG_S, "diff_dst");
+    VDISPATCH_GNORM(memory_desc_matches_one_of_tag(
+                            *diff_src_md(), ndhwc, nhwc, nwc, nc),
+            VERBOSE_UNSUPPORTED_TAG_S, "diff_src");
+    VDISPATCH_GNORM(impl::is_dense_format_kind(
+                            {src_md(), diff_dst_md(), diff_src_md()}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    // See the comment in the forward implementation.
+    const size_t C_PER_G = C() / G();
+    VDISPATCH_GNORM(C_PER_G > 1, "Instance norm is not supported");
+
+    // A group is split over spatial into chunks when there are not enough
+    // groups to keep all threads busy. Each chunk produces partial sums that
+    // are reduced before `diff_src` computations.
+    nthr_ = dnnl_get_max_threads();
+    const dim_t SP = D() * H() * W();
+    sp_chunks_ = std::max<dim_t>(1,
+            std::min<dim_t>(SP, utils::div_up(nthr_, MB() * G())));
+
+    using namespace memory_tracking::names;
+    auto scratchpad = scratchpad_registry().registrar();
+    // Sums of `diff_dst * (src - mean)` and `diff_dst` per channel per chunk.
+    scratchpad.template book<float>(
+            key_gnorm_reduction, 2 * MB() * C() * sp_chunks_);
+
+    return status::success;
+}
+
+status_t jit_uni_group_normalization_bwd_t::execute_backward(
+        const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
+    status_t status = status::success;
+
+    const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    const auto mean = CTX_IN_MEM(const float *, DNNL_ARG_MEAN);
+    const auto variance = CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE);
+    const auto diff_dst = CTX_IN_MEM(const void *, DNNL_ARG_DIFF_DST);
+    const auto scale = CTX_IN_MEM(const float *, DNNL_ARG_SCALE);
+
+    auto diff_src = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DIFF_SRC, status);
+    CHECK(status);
+    auto diff_scale = CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_DIFF_SCALE, status);
+    CHECK(status);
+    auto diff_shift = CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_DIFF_SHIFT, status);
+    CHECK(status);
+
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    auto reduction = scratchpad.template get<float>(key_gnorm_reduction);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
+    const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
+
+    const dim_t N = pd()->MB();
+    const dim_t C_padded = src_d.padded_dims()[1];
+    const dim_t C = pd()->C();
+    const dim_t G = pd()->G();
+    const dim_t C_PER_G = C / G;
+    const dim_t SP = pd()->D() * pd()->H() * pd()->W();
+    const dim_t CSP = C_PER_G * SP;
+    const float eps = pd()->desc()->group_norm_epsilon;
+
+    const bool calculate_diff_stats = !pd()->stats_is_src();
+    const int nthr = pd()->nthr_;
+    const dim_t sp_chunks = pd()->sp_chunks_;
+    const dim_t SP_chunk = SP / sp_chunks;
+    const dim_t work_amount = N * G * sp_chunks;
+
+    // Work item `i` is a spatial chunk `i % sp_chunks` of a group
+    // `(i / sp_chunks) % G` of an image `i / (sp_chunks * G)`. Partial sums of
+    // a work item are stored at `reduction + i * 2 * C_PER_G`, first go sums
+    // of `diff_dst * (src - mean)`, then sums of `diff_dst`.
+    const auto data_off = [&](dim_t i) {
+        const dim_t n = i / (sp_chunks * G);
+        const dim_t g = (i / sp_chunks) % G;
+        const dim_t sp_chunk = i % sp_chunks;
+        return (size_t)n * SP * C_padded + sp_chunk * SP_chunk * C_padded
+                + g * C_PER_G;
+    };
+    const auto sp_block_size = [&](dim_t i) {
+        const dim_t sp_chunk = i % sp_chunks;
+        return sp_chunk == sp_chunks - 1 ? SP - sp_chunk * SP_chunk
+                                         : SP_chunk;
+    };
+    const auto inv_sqrtvar = [&](dim_t stat_off) {
+        return 1.f / sqrtf(variance[stat_off] + eps);
+    };
+
+    const bool need_sums = calculate_diff_stats || diff_scale || diff_shift;
+    if (need_sums) {
+        parallel(nthr, [&](const int ithr, const int nthr) {
+            dim_t start = 0, end = 0;
+            balance211(work_amount, nthr, ithr, start, end);
+            for (dim_t i = start; i < end; i++) {
+                const size_t off = data_off(i);
+                const char *__restrict src_ptr = static_cast<const char *>(src)
+                        + off * src_d.data_type_size();
+                const char *__restrict diff_dst_ptr
+                        = static_cast<const char *>(diff_dst)
+                        + off * diff_dst_d.data_type_size();
+                float *ws = reduction + i * 2 * C_PER_G;
+                (*kernel_diff_ss_)(src_ptr, diff_dst_ptr,
+                        mean + i / sp_chunks, ws, ws + C_PER_G,
+                        sp_block_size(i));
+            }
+        });
+
+        // Reduce spatial chunks into the first one of a group.
+        parallel_nd(N * G, [&](dim_t ng) {
+            float *ws0 = reduction + ng * sp_chunks * 2 * C_PER_G;
+            for (dim_t chunk = 1; chunk < sp_chunks; chunk++) {
+                const float *ws = ws0 + chunk * 2 * C_PER_G;
+                PRAGMA_OMP_SIMD()
+                for (dim_t c = 0; c < 2 * C_PER_G; c++)
+                    ws0[c] += ws[c];
+            }
+        });
+
+        if (diff_scale || diff_shift) {
+            parallel_nd(C, [&](dim_t c) {
+                const dim_t g = c / C_PER_G;
+                const dim_t c_in_g = c % C_PER_G;
+                float diff_gamma = 0.f, diff_beta = 0.f;
+                for (dim_t n = 0; n < N; n++) {
+                    const float *ws
+                            = reduction + (n * G + g) * sp_chunks * 2 * C_PER_G;
+                    diff_gamma += ws[c_in_g] * inv_sqrtvar(n * G + g);
+                    diff_beta += ws[C_PER_G + c_in_g];
+                }
+                if (diff_scale) diff_scale[c] = diff_gamma;
+                if (diff_shift) diff_shift[c] = diff_beta;
+            });
+        }
+    }
+
+    parallel(nthr, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(work_amount, nthr, ithr, start, end);
+        for (dim_t i = start; i < end; i++) {
+            const dim_t ng = i / sp_chunks;
+            const dim_t g = ng % G;
+            const float inv_std = inv_sqrtvar(ng);
+
+            float coeffs[3] = {inv_std, 0.f, 0.f};
+            if (calculate_diff_stats) {
+                const float *ws = reduction + ng * sp_chunks * 2 * C_PER_G;
+                float sum_dd_scaled = 0.f, sum_dd_src_scaled = 0.f;
+                for (dim_t c = 0; c < C_PER_G; c++) {
+                    const float gamma = scale ? scale[g * C_PER_G + c] : 1.f;
+                    sum_dd_src_scaled += gamma * ws[c];
+                    sum_dd_scaled += gamma * ws[C_PER_G + c];
+                }
+                coeffs[1] = inv_std * sum_dd_scaled / CSP;
+                coeffs[2] = inv_std * inv_std * inv_std * sum_dd_src_scaled
+                        / CSP;
+            }
+
+            const size_t off = data_off(i);
+            const char *__restrict src_ptr = static_cast<const char *>(src)
+                    + off * src_d.data_type_size();
+            const char *__restrict diff_dst_ptr
+                    = static_cast<const char *>(diff_dst)
+                    + off * diff_dst_d.data_type_size();
+            char *__restrict diff_src_ptr = static_cast<char *>(diff_src)
+                    + off * diff_src_d.data_type_size();
+            const float *scale_ptr = scale ? scale + g * C_PER_G : nullptr;
+            (*kernel_diff_src_)(src_ptr, diff_dst_ptr, diff_src_ptr, scale_ptr,
+                    mean + ng, coeffs, sp_block_size(i));
+        }
+    });
+
+    return status::success;
+}
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
@@ -95,6 +95,67 @@ protected:
     std::unique_ptr<kernel_stat_base_t> kernel_var_;
 };
 
+struct jit_uni_group_normalization_bwd_t : public primitive_t {
+    using primitive_t::primitive_t;
+
+    struct pd_t : public cpu_group_normalization_bwd_pd_t {
+        using cpu_group_normalization_bwd_pd_t::
+                cpu_group_normalization_bwd_pd_t;
+
+        DECLARE_COMMON_PD_T("jit_group:uni", jit_uni_group_normalization_bwd_t);
+
+        status_t init(engine_t *engine);
+
+        int nthr_; // To not exceed the limit in execute used for set up.
+        dim_t sp_chunks_; // Number of spatial chunks a group is split into.
+    };
+
+    status_t init(engine_t *engine) override {
+        CHECK(safe_ptr_assign(
+                kernel_diff_ss_, kernel_diff_ss_base_t::create(pd())));
+        CHECK(safe_ptr_assign(
+                kernel_diff_src_, kernel_diff_src_base_t::create(pd())));
+        if (kernel_diff_ss_) CHECK(kernel_diff_ss_->create_kernel());
+        if (kernel_diff_src_) CHECK(kernel_diff_src_->create_kernel());
+        return status::success;
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_backward(ctx);
+    }
+
+    // Computes per-channel sums of `diff_dst` and `diff_dst * (src - mean)`
+    // over a spatial block of a single group.
+    struct kernel_diff_ss_base_t {
+        virtual void operator()(const void *src, const void *diff_dst,
+                const float *mean, float *diff_gamma, float *diff_beta,
+                size_t block_size) const = 0;
+        static kernel_diff_ss_base_t *create(
+                const group_normalization_pd_t *pd);
+        virtual status_t create_kernel() = 0;
+        virtual ~kernel_diff_ss_base_t() = default;
+    };
+
+    // Computes `diff_src` over a spatial block of a single group as
+    // `scale * diff_dst * coeffs[0] - coeffs[1] - (src - mean) * coeffs[2]`.
+    struct kernel_diff_src_base_t {
+        virtual void operator()(const void *src, const void *diff_dst,
+                void *diff_src, const float *scale, const float *mean,
+                const float *coeffs, size_t block_size) const = 0;
+        static kernel_diff_src_base_t *create(
+                const group_normalization_pd_t *pd);
+        virtual status_t create_kernel() = 0;
+        virtual ~kernel_diff_src_base_t() = default;
+    };
+
+protected:
+    status_t execute_backward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<kernel_diff_ss_base_t> kernel_diff_ss_;
+    std::unique_ptr<kernel_diff_src_base_t> kernel_diff_src_;
+};
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
@@ -23,6 +23,7 @@
 #include "common/type_helpers.hpp"
 
 #include "cpu/cpu_primitive.hpp"
+#include "cpu/platform.hpp"
 
 #include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
@@ -84,11 +85,14 @@ struct jit_stat_and_data_base_kernel_t : stat_and_data_kernel_t,
     void operator()(const void *src, void *dst, const float *scale,
             const float *shift, float *mean, float *var,
             const float *src_scales, const float *dst_scales,
-            const void *post_ops_binary_rhs_arg_vec,
-            const size_t block_size) const override {
+            const void *post_ops_binary_rhs_arg_vec, const size_t block_size,
+            const void *src_1, void *dst_1, float *sum_row) const override {
         ker_args_t args;
         args.src = src;
         args.dst = dst;
+        args.src_1 = src_1;
+        args.dst_1 = dst_1;
+        args.sum_row = sum_row;
         args.scale = scale;
         args.shift = shift;
         args.mean = mean;
@@ -120,10 +124,14 @@ struct jit_stat_and_data_base_kernel_t : stat_and_data_kernel_t,
         , save_stats_(pd_->is_training())
         , calculate_stats_(!pd_->stats_are_src())
         , eps_(pd_->desc()->layer_norm_epsilon)
+        , fuse_residual_add_(pd_->fuse_residual_add())
+        , save_residual_sum_(pd_->save_residual_sum())
         , has_ne_convert_src_xf16_(isa == avx2 && mayiuse(avx2_vnni_2)
+                  && !fuse_residual_add_
                   && utils::one_of(
                           src_d_.data_type(), data_type::f16, data_type::bf16))
-        , skip_mean_(pd_->skip_mean()) {
+        , skip_mean_(pd_->skip_mean())
+        , data_dt_(fuse_residual_add_ ? f32 : src_d_.data_type()) {
 
         const auto &post_ops = pd_->attr()->post_ops_;
         with_postops_ = post_ops.len() != 0;
@@ -162,6 +170,9 @@ protected:
     struct ker_args_t {
         const void *src;
         void *dst;
+        const void *src_1;
+        void *dst_1;
+        float *sum_row;
         const float *scale;
         const float *shift;
         const float *mean;
@@ -184,8 +195,13 @@ protected:
     const bool save_stats_;
     const bool calculate_stats_;
     const float eps_;
+    const bool fuse_residual_add_;
+    const bool save_residual_sum_;
     const bool has_ne_convert_src_xf16_;
     const bool skip_mean_;
+    // Data type of the values being normalized: the residual sum is kept in a
+    // f32 row buffer.
+    const data_type_t data_dt_;
     bool with_postops_ = false;
     bool with_binary_ = false;
     bool with_eltwise_ = false;
@@ -207,6 +223,12 @@ protected:
     const Reg64 reg_var = r13;
     const Reg64 reg_src_scales = r14;
     const Reg64 reg_dst_scales = r15;
+    // Residual add: src_1 and dst_1 share the src layout, so they are
+    // addressed via their offsets from the current src row.
+    const Reg64 reg_src_1_off = rsi;
+    const Reg64 reg_dst_1_off = rbp;
+    // Epsilon is only read once at the kernel start.
+    const Reg64 reg_sum_row = reg_eps;
 
     const Vmm vmm_tail_mask = Vmm(0);
     const Vmm vmm_zero = Vmm(4); // In unroll range, safe for dst compute.
@@ -245,6 +267,22 @@ protected:
         return vmmword[reg_dst + offt * dst_d_.data_type_size()];
     }
 
+    Address src_1_ptr(size_t offt = 0) {
+        return vmmword[reg_src + reg_src_1_off
+                + offt * src_d_.data_type_size()];
+    }
+
+    Address dst_1_ptr(size_t offt = 0) {
+        return vmmword[reg_src + reg_dst_1_off
+                + offt * src_d_.data_type_size()];
+    }
+
+    Address data_ptr(size_t offt = 0) {
+        if (fuse_residual_add_)
+            return vmmword[reg_sum_row + offt * sizeof(float)];
+        return src_ptr(offt);
+    }
+
     Address mean_ptr(size_t offt = 0) {
         return vmmword[reg_mean + offt * sizeof(float)];
     }
@@ -364,8 +402,8 @@ protected:
             // unrolled loop
             for (int i = 0; i < axis_simd_full_ / unroll; i++)
                 for (int j = base_idx; j < base_idx + unroll; j++) {
-                    io_[src_d_.data_type()]->load(
-                            src_ptr((i * unroll + j - base_idx) * simd_w_),
+                    io_[data_dt_]->load(
+                            data_ptr((i * unroll + j - base_idx) * simd_w_),
                             Vmm(j + unroll), need_tail);
                     op(Vmm(j), Vmm(j + unroll), need_tail);
                 }
@@ -381,8 +419,8 @@ protected:
             // unrolled loop remainder
             for (int i = utils::rnd_dn(axis_simd_full_, unroll);
                     i < axis_simd_full_; i++) {
-                io_[src_d_.data_type()]->load(
-                        src_ptr(i * simd_w_), Vmm(base_idx + 1), need_tail);
+                io_[data_dt_]->load(
+                        data_ptr(i * simd_w_), Vmm(base_idx + 1), need_tail);
                 op(Vmm(base_idx), Vmm(base_idx + 1), need_tail);
             }
         }
@@ -390,7 +428,7 @@ protected:
         if (axis_simd_tail_ > 0) {
             need_tail = true;
             // vector remainder
-            io_[src_d_.data_type()]->load(src_ptr(axis_simd_full_ * simd_w_),
+            io_[data_dt_]->load(data_ptr(axis_simd_full_ * simd_w_),
                     Vmm(base_idx + 1), need_tail);
             op(Vmm(base_idx), Vmm(base_idx + 1), need_tail);
         }
@@ -400,6 +438,27 @@ protected:
         uni_vmovups(vmm_stat, Vmm(base_idx));
     }
 
+    // Computes the src + src_1 row into the f32 row buffer, and writes it to
+    // dst_1 if requested, so the following passes read it from cache.
+    void compute_residual_sum_body(size_t offt_elems, bool tail = false) {
+        const Vmm vmm_sum = Vmm(1);
+        const Vmm vmm_res = Vmm(2);
+        io_[src_d_.data_type()]->load(src_ptr(offt_elems), vmm_sum, tail);
+        io_[src_d_.data_type()]->load(src_1_ptr(offt_elems), vmm_res, tail);
+        uni_vaddps(vmm_sum, vmm_sum, vmm_res);
+        io_[f32]->store(vmm_sum, data_ptr(offt_elems), tail);
+        if (save_residual_sum_)
+            io_[src_d_.data_type()]->store(
+                    vmm_sum, dst_1_ptr(offt_elems), tail);
+    }
+
+    void compute_residual_sum() {
+        for (int i = 0; i < axis_simd_full_; i++)
+            compute_residual_sum_body(i * simd_w_);
+        if (axis_simd_tail_)
+            compute_residual_sum_body(axis_simd_full_ * simd_w_, true);
+    }
+
     void compute_mean() {
         if (has_ne_convert_src_xf16_)
             compute_ne_convert_xf16(
@@ -488,7 +547,7 @@ protected:
         if (use_shift_) {
             io_[f32]->load(shift_ptr(offt_elems), vmm_shift, tail);
         }
-        io_[src_d_.data_type()]->load(src_ptr(offt_elems), vmm_dst, tail);
+        io_[data_dt_]->load(data_ptr(offt_elems), vmm_dst, tail);
         if (!skip_mean_) uni_vsubps(vmm_dst, vmm_dst, vmm_mean);
         uni_vmulps(vmm_dst, vmm_dst, vmm_inv_sqrtvar);
         if (use_scale_ && use_shift_)
@@ -584,12 +643,22 @@ protected:
         mov(reg_dst_scales, ptr[reg_param + PARAM_OFF(dst_scales)]);
         mov(reg_block_end, ptr[reg_param + PARAM_OFF(block_size)]);
         mov(reg_eps, ptr[reg_param + PARAM_OFF(eps)]);
-#undef PARAM_OFF
 
         // load epsilon
         uni_vmovq(xmm_tmp, reg_eps);
         uni_vbroadcastss(vmm_eps, xmm_tmp);
 
+        if (fuse_residual_add_) {
+            mov(reg_sum_row, ptr[reg_param + PARAM_OFF(sum_row)]);
+            mov(reg_src_1_off, ptr[reg_param + PARAM_OFF(src_1)]);
+            sub(reg_src_1_off, reg_src);
+            if (save_residual_sum_) {
+                mov(reg_dst_1_off, ptr[reg_param + PARAM_OFF(dst_1)]);
+                sub(reg_dst_1_off, reg_src);
+            }
+        }
+#undef PARAM_OFF
+
         // load ones
         mov(reg_tmp, float2int(1.f));
         uni_vmovq(xmm_tmp, reg_tmp);
@@ -608,6 +677,8 @@ protected:
             cmp(reg_block_end, reg_src);
             jle(end, T_NEAR);
 
+            if (fuse_residual_add_) compute_residual_sum();
+
             if (calculate_stats_) {
                 // compute stats
                 if (!skip_mean_) { compute_mean(); }
@@ -1233,6 +1304,9 @@ status_t jit_uni_layer_normalization_fwd_t::pd_t::init(engine_t *engine) {
                                         dst_md()->data_type),
                             mayiuse(avx512_core_fp16) || mayiuse(avx2_vnni_2)),
             VERBOSE_ISA_DT_MISMATCH);
+    VDISPATCH_LNORM(IMPLICATION(fuse_residual_add(),
+                            utils::one_of(src_md()->data_type, f32, bf16, f16)),
+            VERBOSE_UNSUPPORTED_DT);
     VDISPATCH_LNORM(stat_md()->data_type == f32, VERBOSE_UNSUPPORTED_DT);
     VDISPATCH_LNORM(check_scale_shift_data_type(), VERBOSE_UNSUPPORTED_FEATURE,
             "unsupported scale or shift data type");
@@ -1285,6 +1359,8 @@ status_t jit_uni_layer_normalization_fwd_t::execute_forward(
     auto scratchpad = ctx.get_scratchpad_grantor();
     const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
     auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+    const auto src_1 = CTX_IN_MEM(const void *, DNNL_ARG_SRC_1);
+    auto dst_1 = CTX_OUT_MEM(void *, DNNL_ARG_DST_1);
 
     auto scale = CTX_IN_MEM(const float *, DNNL_ARG_SCALE);
     auto shift = CTX_IN_MEM(const float *, DNNL_ARG_SHIFT);
@@ -1317,21 +1393,35 @@ status_t jit_uni_layer_normalization_fwd_t::execute_forward(
     const memory_desc_wrapper dst_d(pd()->dst_md());
 
     const dim_t N = pd()->across_axis();
+    const dim_t C = pd()->norm_axis();
     const dim_t C_padded = src_d.padded_dims()[pd()->ndims() - 1];
 
+    const bool fuse_residual_add = pd()->fuse_residual_add();
+    float *residual_sum = fuse_residual_add
+            ? scratchpad.template get<float>(key_lnorm_residual_sum)
+            : nullptr;
+
     parallel(0, [&](const int ithr, const int nthr) {
         dim_t N_start = 0, N_end = 0;
         balance211(N, nthr, ithr, N_start, N_end);
+        const dim_t src_off = N_start * C_padded * src_d.data_type_size();
         const char *const __restrict src_ptr
-                = reinterpret_cast<const char *>(src)
-                + N_start * C_padded * src_d.data_type_size();
+                = reinterpret_cast<const char *>(src) + src_off;
         char *const __restrict dst_ptr = reinterpret_cast<char *>(dst)
                 + N_start * C_padded * dst_d.data_type_size();
+        const char *src_1_ptr = fuse_residual_add
+                ? reinterpret_cast<const char *>(src_1) + src_off
+                : nullptr;
+        char *dst_1_ptr
+                = dst_1 ? reinterpret_cast<char *>(dst_1) + src_off : nullptr;
+        float *sum_row
+                = fuse_residual_add ? &residual_sum[ithr * C] : nullptr;
         const int block_size = N_end - N_start;
         float *mean_ptr = skip_mean ? nullptr : &mean[N_start];
         (*stat_and_data_kernel_)(src_ptr, dst_ptr, scale, shift, mean_ptr,
                 &variance[N_start], src_scales, dst_scales,
-                post_ops_binary_rhs_arg_vec.data(), block_size);
+                post_ops_binary_rhs_arg_vec.data(), block_size, src_1_ptr,
+                dst_1_ptr, sum_row);
     });
     return status::success;
 }
@@ -1383,56 +1473,84 @@ status_t jit_uni_layer_normalization_bwd_t::execute_backward(
 
     const int max_nthr = pd()->nthr_;
 
+    // Rows are processed in chunks that fit in L2, and both kernels are
+    // applied to a chunk one after another, so that src and diff_dst are read
+    // from memory only once. The scale and shift gradients don't depend on
+    // diff_src, and diff_src only needs the row statistics.
+    const size_t row_size = C_padded
+            * (src_d.data_type_size() + diff_dst_d.data_type_size()
+                    + diff_src_d.data_type_size());
+    const dim_t chunk_rows = nstl::max<dim_t>(1,
+            platform::get_per_core_cache_size(2) / 2
+                    / nstl::max<size_t>(1, row_size));
+
+    // The runtime may provide fewer threads than requested, e.g. when called
+    // from a parallel region.
+    int nthr_used = max_nthr;
     parallel(max_nthr, [&](int ithr, int nthr) {
+        if (ithr == 0) nthr_used = nthr;
         dim_t N_start = 0, N_end = 0;
         balance211(N, nthr, ithr, N_start, N_end);
-        const int block_size = N_end - N_start;
-        const char *const __restrict src_ptr
-                = reinterpret_cast<const char *>(src)
-                + N_start * C_padded * src_d.data_type_size();
-        const char *const __restrict diff_dst_ptr
-                = reinterpret_cast<const char *>(diff_dst)
-                + N_start * C_padded * diff_dst_d.data_type_size();
 
         float *my_diff_gamma = reduce + C * ithr;
-        float *my_diff_beta = reduce + C * nthr + C * ithr;
+        float *my_diff_beta = reduce + C * max_nthr + C * ithr;
         for (dim_t c = 0; c < C; c++) {
             my_diff_gamma[c] = 0.;
             my_diff_beta[c] = 0.;
         }
-        const float *mean_ptr = skip_mean ? nullptr : &mean[N_start];
-        (*diff_ss_kernel_)(src_ptr, diff_dst_ptr, my_diff_gamma, my_diff_beta,
-                mean_ptr, &variance[N_start], &inv_sqrtvar[N_start],
-                block_size);
-    });
 
-    parallel_nd(C, [&](dim_t c) {
-        float diff_gamma = 0, diff_beta = 0;
-        for (dim_t n = 0; n < max_nthr; n++) {
-            diff_gamma += reduce[C * n + c];
-            diff_beta += reduce[C * max_nthr + C * n + c];
+        for (dim_t n = N_start; n < N_end; n += chunk_rows) {
+            const int block_size = nstl::min(chunk_rows, N_end - n);
+            const char *const __restrict src_ptr
+                    = reinterpret_cast<const char *>(src)
+                    + n * C_padded * src_d.data_type_size();
+            const char *const __restrict diff_dst_ptr
+                    = reinterpret_cast<const char *>(diff_dst)
+                    + n * C_padded * diff_dst_d.data_type_size();
+            char *const __restrict diff_src_ptr
+                    = reinterpret_cast<char *>(diff_src)
+                    + n * C_padded * diff_src_d.data_type_size();
+
+            const float *mean_ptr = skip_mean ? nullptr : &mean[n];
+            (*diff_ss_kernel_)(src_ptr, diff_dst_ptr, my_diff_gamma,
+                    my_diff_beta, mean_ptr, &variance[n], &inv_sqrtvar[n],
+                    block_size);
+            (*diff_data_kernel_)(src_ptr, diff_dst_ptr, diff_src_ptr, scale,
+                    mean_ptr, &inv_sqrtvar[n], block_size);
         }
-        diff_scale[c] = diff_gamma;
-        diff_shift[c] = diff_beta;
     });
 
-    parallel(max_nthr, [&](int ithr, int nthr) {
-        dim_t N_start = 0, N_end = 0;
-        balance211(N, nthr, ithr, N_start, N_end);
-        const int block_size = N_end - N_start;
-        const char *const __restrict src_ptr
-                = reinterpret_cast<const char *>(src)
-                + N_start * C_padded * src_d.data_type_size();
-        const char *const __restrict diff_dst_ptr
-                = reinterpret_cast<const char *>(diff_dst)
-                + N_start * C_padded * diff_dst_d.data_type_size();
-        char *const __restrict diff_src_ptr = reinterpret_cast<char *>(diff_src)
-                + N_start * C_padded * diff_src_d.data_type_size();
-
-        const float *mean_ptr = skip_mean ? nullptr : &mean[N_start];
-        (*diff_data_kernel_)(src_ptr, diff_dst_ptr, diff_src_ptr, scale,
-                mean_ptr, &inv_sqrtvar[N_start], block_size);
-    });
+    // With few channels a reduction over channels can't occupy all threads,
+    // so the per-thread partial sums are added pairwise instead, which
+    // takes log2(nthr) steps parallel over both the pairs and the channels.
+    float *diff_gamma_partials = reduce;
+    float *diff_beta_partials = reduce + C * max_nthr;
+    const int simd_w = 16;
+    if (C < simd_w * nthr_used) {
+        for (int stride = 1; stride < nthr_used; stride *= 2) {
+            const dim_t npairs = utils::div_up(nthr_used - stride, 2 * stride);
+            parallel_nd(npairs, C, [&](dim_t p, dim_t c) {
+                const dim_t dst_off = C * 2 * stride * p + c;
+                const dim_t src_off = dst_off + C * stride;
+                diff_gamma_partials[dst_off] += diff_gamma_partials[src_off];
+                diff_beta_partials[dst_off] += diff_beta_partials[src_off];
+            });
+        }
+        parallel_nd(C, [&](dim_t c) {
+            diff_scale[c] = diff_gamma_partials[c];
+            diff_shift[c] = diff_beta_partials[c];
+        });
+    } else {
+        parallel_nd(C, [&](dim_t c) {
+            float diff_gamma = 0, diff_beta = 0;
+            for (dim_t n = 0; n < nthr_used; n++) {
+                diff_gamma += diff_gamma_partials[C * n + c];
+                diff_beta += diff_beta_partials[C * n + c];
+            }
+            diff_scale[c] = diff_gamma;
+            diff_shift[c] = diff_beta;
+        });
+    }
     return status::success;
 }
 
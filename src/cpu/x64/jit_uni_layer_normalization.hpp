@@ -43,8 +43,8 @@ struct stat_and_data_kernel_t {
     virtual void operator()(const void *src, void *dst, const float *scale,
             const float *shift, float *mean, float *var,
             const float *src_scales, const float *dst_scales,
-            const void *post_ops_binary_rhs_arg_vec,
-            const size_t block_size) const {};
+            const void *post_ops_binary_rhs_arg_vec, const size_t block_size,
+            const void *src_1, void *dst_1, float *sum_row) const {};
 
     virtual status_t create_kernel() { return status::success; }
 
@@ -116,6 +116,13 @@ struct jit_uni_layer_normalization_fwd_t : public primitive_t {
             if (reordered_stat_md_ != *stat_md() && !stats_are_tmp()) {
                 scratchpad.book(key_nested, reorder_pd_->scratchpad_registry());
             }
+            // A row of the residual sum in f32 per thread, it stays in cache
+            // between the statistics and the normalization passes.
+            if (fuse_residual_add()) {
+                scratchpad.template book<float>(key_lnorm_residual_sum,
+                        static_cast<size_t>(dnnl_get_max_threads())
+                                * norm_axis());
+            }
         }
     };
 
@@ -211,6 +211,7 @@ status_t jit_uni_pool_kernel_t<isa>::init_conf(
     jpp.c_block = is_avx512 ? 16 : 8;
 
     jpp.alg = pd.alg_kind;
+    jpp.is_adaptive = ppd->is_adaptive();
 
     jpp.src_dt = jpp.is_backward ? pd.diff_src_desc.data_type
                                  : pd.src_desc.data_type;
@@ -332,8 +333,15 @@ status_t jit_uni_pool_kernel_t<isa>::init_conf(
             VERBOSE_ISA_DT_MISMATCH);
     VDISPATCH_POOLING_IC(
             utils::one_of(pd.alg_kind, pooling_max, pooling_avg_include_padding,
-                    pooling_avg_exclude_padding),
+                    pooling_avg_exclude_padding, pooling_adaptive_max,
+                    pooling_adaptive_avg),
             VERBOSE_BAD_ALGORITHM);
+    // Adaptive windows are forward only and do not record max indices.
+    VDISPATCH_POOLING_IC(IMPLICATION(jpp.is_adaptive, !jpp.is_backward),
+            VERBOSE_BAD_PROPKIND);
+    VDISPATCH_POOLING_IC(
+            IMPLICATION(jpp.alg == pooling_adaptive_max, !jpp.is_training),
+            VERBOSE_BAD_PROPKIND);
 
     const bool is_xf16_avx2_vnni_2
             = (jpp.is_bf16 || jpp.is_f16) && isa == avx2_vnni_2;
@@ -367,12 +375,18 @@ status_t jit_uni_pool_kernel_t<isa>::init_conf(
     jpp.t_pad = (ndims == 3) ? 0 : pd.padding[0][ndims - 4];
     jpp.l_pad = pd.padding[0][ndims - 3];
 
-    const int back_pad = calculate_end_padding(
-            jpp.f_pad, jpp.od, jpp.id, jpp.stride_d, jpp.kd);
-    const int bottom_pad = calculate_end_padding(
-            jpp.t_pad, jpp.oh, jpp.ih, jpp.stride_h, jpp.kh);
-    const int right_pad = calculate_end_padding(
-            jpp.l_pad, jpp.ow, jpp.iw, jpp.stride_w, jpp.kw);
+    const int back_pad = jpp.is_adaptive
+            ? 0
+            : calculate_end_padding(
+                    jpp.f_pad, jpp.od, jpp.id, jpp.stride_d, jpp.kd);
+    const int bottom_pad = jpp.is_adaptive
+            ? 0
+            : calculate_end_padding(
+                    jpp.t_pad, jpp.oh, jpp.ih, jpp.stride_h, jpp.kh);
+    const int right_pad = jpp.is_adaptive
+            ? 0
+            : calculate_end_padding(
+                    jpp.l_pad, jpp.ow, jpp.iw, jpp.stride_w, jpp.kw);
 
     VDISPATCH_POOLING_IC(
             !(jpp.f_pad >= jpp.kd || jpp.t_pad >= jpp.kh || jpp.l_pad >= jpp.kw
@@ -382,12 +396,22 @@ status_t jit_uni_pool_kernel_t<isa>::init_conf(
 
     jpp.ind_dt = ppd->workspace_md() ? ppd->workspace_md()->data_type
                                      : data_type::undef;
+    VDISPATCH_POOLING_IC(
+            IMPLICATION(jpp.ind_dt == data_type::u4, is_u4_ind_supported(jpp)),
+            VERBOSE_UNSUPPORTED_DT);
 
     jpp.simple_alg = jpp.is_training
             || IMPLICATION(jpp.is_backward, jpp.kd <= jpp.stride_d);
 
+    // The width windows of adaptive pooling are unrolled over the whole
+    // output row.
+    const int adaptive_max_unroll = 4096;
+    VDISPATCH_POOLING_IC(IMPLICATION(jpp.is_adaptive,
+                                 jpp.ow * jpp.kw <= adaptive_max_unroll),
+            VERBOSE_BLOCKING_FAIL, "adaptive window is too large");
+
     jpp.ur = 0;
-    if (jpp.alg == pooling_max) {
+    if (utils::one_of(jpp.alg, pooling_max, pooling_adaptive_max)) {
         jpp.ur = is_avx512 ? 16 : 4;
 
         if (utils::one_of(isa, avx, avx2, avx2_vnni_2) && jpp.c_tail > 0)
@@ -575,10 +599,43 @@ inline void jit_uni_pool_kernel_t<isa>::pad_with_zeros(const int idx) {
         uni_vmovups(Vmm(idx) | k_c_tail_mask | T_z, Vmm(idx));
 }
 
+template <cpu_isa_t isa>
+bool jit_uni_pool_kernel_t<isa>::is_u4_ind_supported(
+        const jit_pool_conf_t &jpp) {
+    // A byte keeps indices of two neighboring channels, so a pixel has to
+    // start at a byte boundary to be written by a single thread.
+    return is_superset(isa, avx512_core) && jpp.alg == alg_kind::pooling_max
+            && jpp.tag_kind != jit_memory_tag_kind_t::ncsp && jpp.c % 2 == 0
+            && jpp.kd * jpp.kh * jpp.kw <= 16 && !jpp.is_fp8;
+}
+
+template <cpu_isa_t isa>
+void jit_uni_pool_kernel_t<isa>::prepare_ind_tail_mask() {
+    if (jpp.ind_dt != data_type::u4 || jpp.c_tail == 0) return;
+    mov(tmp_gpr.cvt32(), (1 << utils::div_up(jpp.c_tail, 2)) - 1);
+    kmovw(k_ind_tail_mask, tmp_gpr.cvt32());
+}
+
 template <cpu_isa_t isa>
 inline void jit_uni_pool_kernel_t<isa>::load_indices(
         const int indr_i, const int step_index, bool is_c_tail_processing) {
-    if (jpp.ind_dt == data_type::u8) {
+    if (jpp.ind_dt == data_type::u4) {
+        // The low nibble of a byte keeps the index of the even channel.
+        auto indvr = vreg(indr_i);
+        auto indxr = xreg(indr_i);
+        if (is_c_tail_processing && !jpp.is_c_padded)
+            vpmovzxbw(indxr | k_ind_tail_mask | T_z,
+                    ptr[reg_index + step_index]);
+        else
+            vpmovzxbw(indxr, ptr[reg_index + step_index]);
+        // Split every word `lo | hi << 4` into bytes `lo` and `hi`.
+        vpsrlw(xmm_tmp, indxr, 4);
+        vpsllw(xmm_tmp, xmm_tmp, 8);
+        vpsllw(indxr, indxr, 12);
+        vpsrlw(indxr, indxr, 12);
+        vpord(indxr, indxr, xmm_tmp);
+        vpmovzxbd(indvr, indxr);
+    } else if (jpp.ind_dt == data_type::u8) {
         auto indvr = vreg(indr_i);
         auto indxr = xreg(indr_i);
         if (isa == sse41) {
@@ -623,7 +680,24 @@ template <cpu_isa_t isa>
 inline void jit_uni_pool_kernel_t<isa>::store_indices(const int indr_i,
         const int step_index, const bool is_c_tail_processing,
         const bool is_first_w_block) {
-    if (jpp.ind_dt == data_type::u8) {
+    if (jpp.ind_dt == data_type::u4) {
+        auto vr = vreg(indr_i);
+        auto xr = xreg(indr_i);
+        if (is_c_tail_processing && jpp.is_c_padded) {
+            knotw(k_c_tail_mask, k_c_tail_mask);
+            vpxord(vr | k_c_tail_mask, vr, vr);
+            knotw(k_c_tail_mask, k_c_tail_mask);
+        }
+        vpmovusdb(xr, vr);
+        // Indices are below 16, so every word `lo | hi << 8` becomes
+        // `lo | hi << 4` in its low byte.
+        vpsrlw(xmm_tmp, xr, 4);
+        vpord(xr, xr, xmm_tmp);
+        if (is_c_tail_processing && !jpp.is_c_padded)
+            vpmovwb(ptr[reg_index + step_index] | k_ind_tail_mask, xr);
+        else
+            vpmovwb(ptr[reg_index + step_index], xr);
+    } else if (jpp.ind_dt == data_type::u8) {
         auto xr = xreg(indr_i);
         if (isa == sse41) {
             for (int i = 0; i < (jpp.c_block / 2); ++i) {
@@ -791,14 +865,33 @@ void jit_uni_pool_kernel_t<isa>::apply_postops(int ur_bc, int ur_w, int c_block,
     postops_injector_->compute_vector_range(start_idx, end_idx, rhs_arg_params);
 }
 
+template <cpu_isa_t isa>
+inline int jit_uni_pool_kernel_t<isa>::input_w_offset(
+        int jj, int ki, int stride_w, int pad_l) const {
+    if (!jpp.is_adaptive) return ki + jj * stride_w - pad_l;
+
+    // Adaptive offsets are relative to the beginning of the row, -1 marks a
+    // kernel point outside of the window of the output column.
+    const int ow = adaptive_ow_s_ + jj;
+    const int iw_s = adaptive_pool_start(ow, jpp.iw, jpp.ow);
+    const int iw_e = adaptive_pool_end(ow, jpp.iw, jpp.ow);
+    return iw_s + ki < iw_e ? iw_s + ki : -1;
+}
+
 template <cpu_isa_t isa>
 inline void jit_uni_pool_kernel_t<isa>::maybe_recalculate_divisor(
         int jj, int ur_w, int pad_l, int pad_r, bool with_c_tail_proccessing) {
-    if (jpp.alg == pooling_avg_exclude_padding) {
+    if (utils::one_of(
+                jpp.alg, pooling_avg_exclude_padding, pooling_adaptive_avg)) {
         int kw = jpp.kw;
         int stride_w = jpp.stride_w;
 
         int non_zero_kw = kw;
+        if (jpp.is_adaptive) {
+            const int ow = adaptive_ow_s_ + jj;
+            non_zero_kw = adaptive_pool_end(ow, jpp.iw, jpp.ow)
+                    - adaptive_pool_start(ow, jpp.iw, jpp.ow);
+        }
         non_zero_kw -= nstl::max(0, pad_l - jj * stride_w);
         non_zero_kw -= nstl::max(0, pad_r - (ur_w - 1 - jj) * stride_w);
 
@@ -889,8 +982,9 @@ inline void jit_uni_pool_kernel_t<isa>::avg_step(int ur_w, int ur_bc, int pad_l,
                 const auto accvr = vreg(reg_ind(0, bci, jj, ur_bc, ur_w));
                 const auto inpr_i = reg_ind(1, bci, jj, ur_bc, ur_w);
                 auto inpvr = vreg(inpr_i);
-                int aux_input_offset
-                        = (ki + jj * stride_w - pad_l) * c_off + bci * c_block;
+                const int input_w = input_w_offset(jj, ki, stride_w, pad_l);
+                if (input_w < 0) continue;
+                int aux_input_offset = input_w * c_off + bci * c_block;
                 if (aux_input_offset >= iw * c_off) continue;
                 int input_offset = dt_size * aux_input_offset;
                 if (jpp.is_backward) {
@@ -1010,8 +1104,9 @@ inline void jit_uni_pool_kernel_t<isa>::max_step_fwd(int ur_w, int ur_bc,
                 const auto inpvr = vreg(inpr_i);
                 const auto indvr = vreg(reg_ind(2, bci, jj, ur_bc, ur_w));
                 const auto cvtvr = vreg(reg_ind(3, bci, jj, ur_bc, ur_w));
-                int aux_input_offset
-                        = (ki + jj * stride_w - pad_l) * c_off + bci * c_block;
+                const int input_w = input_w_offset(jj, ki, stride_w, pad_l);
+                if (input_w < 0) continue;
+                int aux_input_offset = input_w * c_off + bci * c_block;
                 if (aux_input_offset >= iw * c_off) continue;
                 int input_offset = jpp.dt_size * aux_input_offset;
                 load(jpp.src_dt, reg_idx(inpr_i), aux_reg_input, input_offset,
@@ -1092,8 +1187,8 @@ inline void jit_uni_pool_kernel_t<isa>::max_step_fwd(int ur_w, int ur_bc,
                 is_c_tail_processing);
 
         if (jpp.is_training) {
-            const size_t step_index = (jj * c_off + bci * c_block)
-                    * types::data_type_size(jpp.ind_dt);
+            const size_t step_index
+                    = ind_offset(jj * c_off + bci * c_block);
 
             const auto indr_i = reg_ind(2, bci, jj, ur_bc, ur_w);
             const bool is_first_w_block = jj == 0;
@@ -1143,8 +1238,8 @@ inline void jit_uni_pool_kernel_t<isa>::max_step_bwd(int ur_w, int ur_bc,
         const bool is_c_tail_processing = is_tail_processing(bci);
         load(jpp.dst_dt, reg_idx(outr_i), reg_output, out_offset,
                 is_c_tail_processing);
-        const size_t step_index = (jj * output_c_off + bci * c_block)
-                * types::data_type_size(jpp.ind_dt);
+        const size_t step_index
+                = ind_offset(jj * output_c_off + bci * c_block);
 
         const auto indr_i = reg_ind(1, bci, jj, ur_bc, ur_w);
         load_indices(indr_i, step_index, is_c_tail_processing);
@@ -1399,15 +1494,14 @@ void jit_uni_pool_kernel_t<isa>::generate() {
 
         auto output_dt_size = jpp.dt_size;
         auto shift = (isa == sse41) ? vlen : 0;
-        add(reg_input,
-                input_dt_size * nstl::max(0, ur_w * stride_w - lpad)
-                                * input_c_off
-                        - shift);
+        // Adaptive steps address the input from the beginning of the row.
+        const int input_w_shift
+                = jpp.is_adaptive ? 0 : nstl::max(0, ur_w * stride_w - lpad);
+        add(reg_input, input_dt_size * input_w_shift * input_c_off - shift);
         add(reg_output, output_dt_size * ur_w * output_c_off - shift);
         if (jpp.alg == pooling_max && (jpp.is_training || jpp.is_backward)) {
             auto ishift = (isa == sse41) ? jpp.c_block / 2 : 0;
-            auto ind_dt_size = types::data_type_size(jpp.ind_dt);
-            add(reg_index, (ur_w * output_c_off - ishift) * ind_dt_size);
+            add(reg_index, ind_offset(ur_w * output_c_off - ishift));
         }
     };
 
@@ -1417,7 +1511,8 @@ void jit_uni_pool_kernel_t<isa>::generate() {
         if (jpp.is_backward && jpp.simple_alg)
             zero_diff_src(ur_bc, with_c_tail_processing);
 
-        if (jpp.alg == pooling_avg_exclude_padding
+        if (utils::one_of(jpp.alg, pooling_avg_exclude_padding,
+                    pooling_adaptive_avg)
                 && (!with_c_tail_processing
                         || (!utils::one_of(isa, avx, avx2, avx2_vnni_2)))) {
             // vmm_ker_area_h and vmm_c_tail_mask are stored in one register
@@ -1448,6 +1543,17 @@ void jit_uni_pool_kernel_t<isa>::generate() {
 
         const int ur_w = nstl::min(jpp.ow, jpp.ur / jpp.ur_bc);
         const int n_oi_iterations = utils::div_up(ow, ur_w);
+
+        if (jpp.is_adaptive) {
+            for (int i = 0; i < n_oi_iterations; ++i) {
+                adaptive_ow_s_ = i * ur_w;
+                const int cur_ur_w = nstl::min(ow, adaptive_ow_s_ + ur_w)
+                        - adaptive_ow_s_;
+                process_oi(cur_ur_w, ur_bc, 0, 0, with_c_tail_processing);
+            }
+            return;
+        }
+
         const int ur_stride_w = ur_w * stride_w;
         const int l_pad_iterations
                 = nstl::min(n_oi_iterations, utils::div_up(l_pad, ur_stride_w));
@@ -1519,7 +1625,10 @@ void jit_uni_pool_kernel_t<isa>::generate() {
         // care of c tail processing if number of channels
         // is not divided by number of channels in block
         L(ur_bc_tail_label);
-        if (jpp.c_tail != 0) io_.prepare_tail_mask();
+        if (jpp.c_tail != 0) {
+            io_.prepare_tail_mask();
+            prepare_ind_tail_mask();
+        }
         perform_ker(jpp.ur_bc_tail, jpp.c_tail != 0);
 
         L(finish_label);
@@ -1528,6 +1637,7 @@ void jit_uni_pool_kernel_t<isa>::generate() {
 
         L(c_tail_processing_label);
         io_.prepare_tail_mask();
+        prepare_ind_tail_mask();
         perform_ker(jpp.ur_bc, true);
 
         L(finish_label);
@@ -51,6 +51,10 @@ struct jit_uni_pool_kernel_t : public jit_generator_t {
     static void init_scratchpad(const jit_pool_conf_t &jpp,
             memory_tracking::registrar_t &scratchpad);
 
+    // Returns true if max pooling indices can be kept in a u4 workspace,
+    // two indices per byte.
+    static bool is_u4_ind_supported(const jit_pool_conf_t &jpp);
+
 private:
     using Xmm = Xbyak::Xmm;
     using Ymm = Xbyak::Ymm;
@@ -108,6 +112,8 @@ private:
     // k_c_tail_mask is shared with jit_io_multi_dt_helper_t and jit_uni_postops_injector_t
     Opmask k_c_tail_mask = Opmask(4);
     Opmask k_store_mask = Opmask(5);
+    // Bytes of a u4 indices tail
+    Opmask k_ind_tail_mask = Opmask(6);
 
     using reg64_t = const Reg64;
     reg64_t reg_param = abi_param1;
@@ -138,6 +144,9 @@ private:
     bool disable_postops_when_sse_high_half_processed_ = false;
 
     int prev_kw;
+    // First output column of the block processed by a step of adaptive
+    // pooling, whose windows are resolved at kernel generation time.
+    int adaptive_ow_s_ = 0;
 
     void put_one_in_vmm();
     void uni_broadcast_reg_val(const int reg_idx, const int vmm_idx);
@@ -148,10 +157,15 @@ private:
     void store(const data_type_t dt, const int idx, const reg64_t &reg_ptr,
             const int offset, const bool is_c_tail_proccessing);
     void pad_with_zeros(int idx);
+    size_t ind_offset(size_t nelems) const {
+        return types::elements_to_bytes(jpp.ind_dt, nelems);
+    }
+    void prepare_ind_tail_mask();
     void load_indices(int indr_i, int step_index, bool is_c_tail_processing);
     void store_indices(int indr_i, int step_index, bool is_c_tail_processing,
             bool is_first_w_block);
 
+    int input_w_offset(int jj, int ki, int stride_w, int pad_l) const;
     void maybe_recalculate_divisor(int jj, int ur_w, int pad_l, int pad_r,
             bool with_c_tail_proccessing);
     void avg_step(int ur_w, int ur_bc, int pad_l, int pad_r,
@@ -165,7 +179,8 @@ private:
 
     void step(int ur_w, int ur_bc, int pad_l, int pad_r,
             bool with_c_tail_proccessing) {
-        if (jpp.alg == alg_kind::pooling_max) {
+        if (utils::one_of(jpp.alg, alg_kind::pooling_max,
+                    alg_kind::pooling_adaptive_max)) {
             if (jpp.is_backward)
                 max_step_bwd(
                         ur_w, ur_bc, pad_l, pad_r, with_c_tail_proccessing);
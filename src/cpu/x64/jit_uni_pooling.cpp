@@ -697,8 +697,6 @@ void jit_uni_pooling_fwd_t<isa, d_type>::execute_forward(const data_t *src,
     const memory_desc_wrapper src_d = pd()->src_md();
     const memory_desc_wrapper dst_d = pd()->dst_md();
     const memory_desc_wrapper indices_d = pd()->workspace_md();
-    const auto ind_dt_size
-            = indices ? types::data_type_size(indices_d.data_type()) : 0;
     const auto &jpp = pd()->jpp_;
     const auto post_ops_binary_rhs_arg_vec
             = binary_injector::prepare_binary_args(jpp.post_ops, ctx);
@@ -719,10 +717,16 @@ void jit_uni_pooling_fwd_t<isa, d_type>::execute_forward(const data_t *src,
         jit_uni_pooling_args_t args;
 
         const int ij = oh * jpp.stride_h;
-        const int i_t_overflow = nstl::max(0, jpp.t_pad - ij);
-        const int i_b_overflow
-                = nstl::max(jpp.ih, ij + jpp.kh - jpp.t_pad) - jpp.ih;
-        const int ih = nstl::max(ij - jpp.t_pad, 0);
+        int i_t_overflow = nstl::max(0, jpp.t_pad - ij);
+        int i_b_overflow = nstl::max(jpp.ih, ij + jpp.kh - jpp.t_pad) - jpp.ih;
+        int ih = nstl::max(ij - jpp.t_pad, 0);
+        if (jpp.is_adaptive) {
+            // The adaptive window is passed as a kernel clipped at the bottom.
+            ih = adaptive_pool_start(oh, jpp.ih, jpp.oh);
+            i_t_overflow = 0;
+            i_b_overflow
+                    = jpp.kh - (adaptive_pool_end(oh, jpp.ih, jpp.oh) - ih);
+        }
         assert(IMPLICATION(pd()->ndims() == 3, utils::everyone_is(0, ih, oh)));
         const int c_off
                 = ((jpp.tag_kind == jit_memory_tag_kind_t::nspc) ? jpp.c_block
@@ -756,16 +760,14 @@ void jit_uni_pooling_fwd_t<isa, d_type>::execute_forward(const data_t *src,
             if (trans_dst)
                 args.indices = transpose_facade.get_indices_addr(ithr, oh, jpp);
             else {
-                const size_t ind_off = indices_d.blk_off(n, c_off, oh);
-                args.indices = static_cast<const void *>(
-                        &indices[ind_off * ind_dt_size]);
+                const size_t ind_off = types::elements_to_bytes(
+                        indices_d.data_type(), indices_d.blk_off(n, c_off, oh));
+                args.indices = static_cast<const void *>(&indices[ind_off]);
             }
         }
         args.kh_padding = jpp.kh - i_t_overflow - i_b_overflow;
         args.kh_padding_shift = i_t_overflow * jpp.kw;
-        args.ker_area_h = static_cast<float>(jpp.kh
-                - nstl::max(0, oh * jpp.stride_h - jpp.t_pad + jpp.kh - jpp.ih)
-                - nstl::max(0, jpp.t_pad - oh * jpp.stride_h));
+        args.ker_area_h = static_cast<float>(args.kh_padding);
         args.ur_bc = ur_bc;
         args.b_c = b_c;
         args.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec.data();
@@ -827,8 +829,6 @@ void jit_uni_pooling_fwd_t<isa, d_type>::execute_forward_3d(const data_t *src,
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper dst_d(pd()->dst_md());
     const memory_desc_wrapper indices_d(pd()->workspace_md());
-    const size_t ind_dt_size
-            = indices ? types::data_type_size(indices_d.data_type()) : 0;
     const auto post_ops_binary_rhs_arg_vec
             = binary_injector::prepare_binary_args(jpp.post_ops, ctx);
 
@@ -850,10 +850,20 @@ void jit_uni_pooling_fwd_t<isa, d_type>::execute_forward_3d(const data_t *src,
         jit_uni_pooling_args_t args;
 
         const int ij = oh * jpp.stride_h;
-        const int i_t_overflow = nstl::max(0, jpp.t_pad - ij);
-        const int i_b_overflow
-                = nstl::max(jpp.ih, ij + jpp.kh - jpp.t_pad) - jpp.ih;
-        const int ih = nstl::max(ij - jpp.t_pad, 0);
+        int i_t_overflow = nstl::max(0, jpp.t_pad - ij);
+        int i_b_overflow = nstl::max(jpp.ih, ij + jpp.kh - jpp.t_pad) - jpp.ih;
+        int ih = nstl::max(ij - jpp.t_pad, 0);
+        if (jpp.is_adaptive) {
+            // Adaptive windows are passed as kernels clipped at the end.
+            id = adaptive_pool_start(od, jpp.id, jpp.od);
+            d_t_overflow = 0;
+            d_b_overflow
+                    = jpp.kd - (adaptive_pool_end(od, jpp.id, jpp.od) - id);
+            ih = adaptive_pool_start(oh, jpp.ih, jpp.oh);
+            i_t_overflow = 0;
+            i_b_overflow
+                    = jpp.kh - (adaptive_pool_end(oh, jpp.ih, jpp.oh) - ih);
+        }
         const int c_off
                 = ((jpp.tag_kind == jit_memory_tag_kind_t::nspc) ? jpp.c_block
                                                                  : 1)
@@ -885,8 +895,10 @@ void jit_uni_pooling_fwd_t<isa, d_type>::execute_forward_3d(const data_t *src,
                 args.indices = transpose_facade.get_indices_addr_3d(
                         ithr, od, oh, jpp);
             } else {
-                const size_t ind_off = indices_d.blk_off(n, c_off, od, oh);
-                args.indices = &indices[ind_off * ind_dt_size];
+                const size_t ind_off
+                        = types::elements_to_bytes(indices_d.data_type(),
+                                indices_d.blk_off(n, c_off, od, oh));
+                args.indices = &indices[ind_off];
             }
         }
 
@@ -895,15 +907,7 @@ void jit_uni_pooling_fwd_t<isa, d_type>::execute_forward_3d(const data_t *src,
         args.kh_padding_shift
                 = i_t_overflow * jpp.kw + d_t_overflow * jpp.kw * jpp.kh;
         args.kd_padding_shift = (i_t_overflow + i_b_overflow) * jpp.kw;
-        args.ker_area_h = (float)(jpp.kh
-                                  - nstl::max(0,
-                                          oh * jpp.stride_h - jpp.t_pad + jpp.kh
-                                                  - jpp.ih)
-                                  - nstl::max(0, jpp.t_pad - oh * jpp.stride_h))
-                * (jpp.kd
-                        - nstl::max(0,
-                                od * jpp.stride_d - jpp.f_pad + jpp.kd - jpp.id)
-                        - nstl::max(0, jpp.f_pad - od * jpp.stride_d));
+        args.ker_area_h = (float)(args.kh_padding * args.kd_padding);
 
         args.ur_bc = ur_bc;
         args.b_c = b_c;
@@ -1042,8 +1046,6 @@ void jit_uni_pooling_bwd_t<isa, d_type>::execute_backward(
     const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
     const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
     const memory_desc_wrapper indices_d(pd()->workspace_md());
-    const size_t ind_dt_size
-            = indices ? types::data_type_size(indices_d.data_type()) : 0;
     const auto &jpp = pd()->jpp_;
     const auto transpose_facade
             = jit_uni_pooling_utils::bwd_pooling_transpose_facade_t<data_t,
@@ -1086,8 +1088,9 @@ void jit_uni_pooling_bwd_t<isa, d_type>::execute_backward(
                 args.indices = transpose_facade.get_indices_addr(ithr, oh, jpp);
 
             else {
-                const size_t ind_off = indices_d.blk_off(n, c_off, oh);
-                args.indices = &indices[ind_off * ind_dt_size];
+                const size_t ind_off = types::elements_to_bytes(
+                        indices_d.data_type(), indices_d.blk_off(n, c_off, oh));
+                args.indices = &indices[ind_off];
             }
         }
 
@@ -1167,8 +1170,6 @@ void jit_uni_pooling_bwd_t<isa, d_type>::execute_backward_3d(
     const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
     const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
     const memory_desc_wrapper indices_d(pd()->workspace_md());
-    const size_t ind_dt_size
-            = indices ? types::data_type_size(indices_d.data_type()) : 0;
 
     const auto &jpp = pd()->jpp_;
 
@@ -1234,8 +1235,10 @@ void jit_uni_pooling_bwd_t<isa, d_type>::execute_backward_3d(
                 args.indices = transpose_facade.get_indices_addr_3d(
                         ithr, od, oh, jpp);
             } else {
-                const size_t ind_off = indices_d.blk_off(n, c_off, od, oh);
-                args.indices = (const void *)&indices[ind_off * ind_dt_size];
+                const size_t ind_off
+                        = types::elements_to_bytes(indices_d.data_type(),
+                                indices_d.blk_off(n, c_off, od, oh));
+                args.indices = (const void *)&indices[ind_off];
             }
         }
 
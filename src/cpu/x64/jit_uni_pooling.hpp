@@ -72,6 +72,14 @@ struct jit_uni_pooling_fwd_t : public primitive_t {
 
             CHECK(jit_uni_pool_kernel_t<isa>::init_conf(jpp_, attr_, this));
 
+            // Indices of windows up to 16 points are packed in 4 bits to
+            // halve the workspace kept for the backward propagation.
+            if (jpp_.ind_dt == data_type::u8
+                    && jit_uni_pool_kernel_t<isa>::is_u4_ind_supported(jpp_)) {
+                ws_md_.data_type = data_type::u4;
+                jpp_.ind_dt = data_type::u4;
+            }
+
             auto scratchpad = scratchpad_registry().registrar();
             jit_uni_pool_kernel_t<isa>::init_scratchpad(jpp_, scratchpad);
 
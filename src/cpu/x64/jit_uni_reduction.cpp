@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
 
 #include "cpu/x64/jit_uni_reduction.hpp"
 
@@ -138,6 +139,7 @@ status_t jit_uni_reduction_t::pd_t::init(engine_t *engine) {
         } else
             break;
     }
+    conf_.mean_divisor = conf_.reduce_size;
 
     VDISPATCH_REDUCTION(
             num_of_reduced_dims != 0, "dimensionality reduction not possible");
@@ -152,22 +154,89 @@ status_t jit_uni_reduction_t::pd_t::init(engine_t *engine) {
                     reduction_norm_lp_power_p_sum)),
             VERBOSE_BAD_ALGORITHM);
 
+    init_split_conf();
+
     return status::success;
 }
 
+void jit_uni_reduction_t::pd_t::init_split_conf() {
+    using namespace data_type;
+
+    // The split pays off only when the kept elements cannot occupy all
+    // threads and each chunk is long enough to amortize the combining step.
+    // Chunks are aligned to a multiple of any vector length, so only the
+    // last one has a tail.
+    static constexpr dim_t min_chunk_size = 16 * 1024;
+    static constexpr dim_t chunk_alignment = 64;
+    const dim_t nthr = dnnl_get_max_threads();
+    if (conf_.idle_size >= nthr || conf_.reduce_size < 2 * min_chunk_size)
+        return;
+
+    const dim_t nchunks_desired = utils::div_up(nthr, conf_.idle_size);
+    const dim_t chunk_size_desired
+            = utils::div_up(conf_.reduce_size, nchunks_desired);
+    const dim_t chunk_size = utils::rnd_up(
+            nstl::max(min_chunk_size, chunk_size_desired), chunk_alignment);
+    const dim_t nchunks = utils::div_up(conf_.reduce_size, chunk_size);
+    if (nchunks < 2) return;
+
+    conf_.split_nchunks = nchunks;
+    conf_.split_chunk_size = chunk_size;
+
+    // Chunks are reduced into f32 partials without post-ops, a mean is
+    // accumulated as a sum and divided while combining.
+    chunk_conf_ = conf_;
+    if (chunk_conf_.alg == alg_kind::reduction_mean)
+        chunk_conf_.alg = alg_kind::reduction_sum;
+    chunk_conf_.dst_type = f32;
+    chunk_conf_.dst_dt_size = types::data_type_size(f32);
+    chunk_conf_.reduce_size = chunk_size;
+    chunk_conf_.is_saturation_needed = false;
+    chunk_conf_.post_ops = post_ops_t();
+    chunk_conf_.with_postops = chunk_conf_.with_eltwise
+            = chunk_conf_.with_binary = chunk_conf_.with_sum = false;
+    chunk_conf_.sum_scales = std::queue<float>();
+
+    chunk_tail_conf_ = chunk_conf_;
+    chunk_tail_conf_.reduce_size
+            = conf_.reduce_size - (nchunks - 1) * chunk_size;
+
+    combine_conf_ = conf_;
+    combine_conf_.src_type = f32;
+    combine_conf_.src_dt_size = types::data_type_size(f32);
+    combine_conf_.reduce_size = nchunks;
+
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(
+            memory_tracking::names::key_reduction, conf_.idle_size * nchunks);
+}
+
 status_t jit_uni_reduction_t::init(engine_t *engine) {
     using namespace format_tag;
 
     const memory_desc_t *dst_md = pd()->dst_md();
     const jit_reduction_conf_t &conf = pd()->get_conf();
+    const bool is_split = conf.split_nchunks > 1;
 
-    CHECK(get_proper_kernel(dst_md, conf));
+    CHECK(get_proper_kernel(kernel_, dst_md,
+            is_split ? pd()->get_combine_conf() : conf));
     CHECK(kernel_->create_kernel());
 
+    if (is_split) {
+        CHECK(get_proper_kernel(
+                chunk_kernel_, dst_md, pd()->get_chunk_conf(false)));
+        CHECK(chunk_kernel_->create_kernel());
+        CHECK(get_proper_kernel(
+                chunk_tail_kernel_, dst_md, pd()->get_chunk_conf(true)));
+        CHECK(chunk_tail_kernel_->create_kernel());
+    }
+
     return status::success;
 }
 
 status_t jit_uni_reduction_t::execute(const exec_ctx_t &ctx) const {
+    if (pd()->get_conf().split_nchunks > 1) return execute_split(ctx);
+
     const auto src = CTX_IN_MEM(const uint8_t *, DNNL_ARG_SRC);
     auto dst = CTX_OUT_MEM(uint8_t *, DNNL_ARG_DST);
 
@@ -195,51 +264,98 @@ status_t jit_uni_reduction_t::execute(const exec_ctx_t &ctx) const {
     return status::success;
 }
 
+status_t jit_uni_reduction_t::execute_split(const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const uint8_t *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(uint8_t *, DNNL_ARG_DST);
+    auto partials = ctx.get_scratchpad_grantor().template get<float>(
+            memory_tracking::names::key_reduction);
+
+    const dim_t idle_size = pd()->get_conf().idle_size;
+    const dim_t reduce_size = pd()->get_conf().reduce_size;
+    const dim_t nchunks = pd()->get_conf().split_nchunks;
+    const dim_t chunk_size = pd()->get_conf().split_chunk_size;
+    const std::size_t src_dt_size = pd()->get_conf().src_dt_size;
+    const std::size_t dst_dt_size = pd()->get_conf().dst_dt_size;
+    const auto &post_ops = pd()->attr()->post_ops_;
+    const auto &post_ops_binary_rhs_arg_vec
+            = binary_injector::prepare_binary_args(post_ops, ctx);
+
+    // Stage 1: every chunk of the reduced axis is reduced into a partial.
+    parallel_nd(idle_size, nchunks, [&](dim_t i, dim_t c) {
+        const dim_t src_off = (i * reduce_size + c * chunk_size) * src_dt_size;
+
+        jit_uni_reduction_args_t args;
+        args.src = src + src_off;
+        args.dst = partials + i * nchunks + c;
+        args.dst_orig = partials;
+
+        if (c == nchunks - 1)
+            (*chunk_tail_kernel_)(&args);
+        else
+            (*chunk_kernel_)(&args);
+    });
+
+    // Stage 2: partials are combined, the result is finalized as in the
+    // regular case.
+    parallel_nd(idle_size, [&](dim_t i) {
+        jit_uni_reduction_args_t args;
+        args.src = partials + i * nchunks;
+        args.dst = dst + i * dst_dt_size;
+        args.dst_orig = dst;
+        args.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec.data();
+
+        (*kernel_)(&args);
+    });
+
+    return status::success;
+}
+
 status_t jit_uni_reduction_t::get_proper_kernel(
+        std::unique_ptr<jit_uni_reduction_kernel_base_t> &kernel,
         const memory_desc_t *dst_md, const jit_reduction_conf_t &conf) {
     using namespace data_type;
 
     if (conf.isa == avx512_core_fp16)
-        return safe_ptr_assign(kernel_,
+        return safe_ptr_assign(kernel,
                 new jit_uni_reduction_kernel_t<avx512_core_fp16>(conf, dst_md));
     if (conf.isa == avx512_core_bf16)
-        return safe_ptr_assign(kernel_,
+        return safe_ptr_assign(kernel,
                 new jit_uni_reduction_kernel_t<avx512_core_bf16>(conf, dst_md));
     else if (conf.isa == avx512_core)
-        return safe_ptr_assign(kernel_,
+        return safe_ptr_assign(kernel,
                 new jit_uni_reduction_kernel_t<avx512_core>(conf, dst_md));
     else if (is_superset(conf.isa, avx)) {
         const bool is_src_i8 = utils::one_of(conf.src_type, s8, u8);
         const bool is_dst_i8 = utils::one_of(conf.dst_type, s8, u8);
         if (conf.isa == avx2_vnni_2) {
             if (is_src_i8 || is_dst_i8)
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx2_vnni_2, Xbyak::Xmm>(
                                 conf, dst_md));
             else
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx2_vnni_2>(
                                 conf, dst_md));
         } else if (conf.isa == avx2) {
             if (is_src_i8 || is_dst_i8)
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx2, Xbyak::Xmm>(
                                 conf, dst_md));
             else
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx2>(conf, dst_md));
         } else {
             if (is_src_i8 || is_dst_i8)
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx, Xbyak::Xmm>(
                                 conf, dst_md));
             else
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx>(conf, dst_md));
         }
     } else if (conf.isa == sse41)
         return safe_ptr_assign(
-                kernel_, new jit_uni_reduction_kernel_t<sse41>(conf, dst_md));
+                kernel, new jit_uni_reduction_kernel_t<sse41>(conf, dst_md));
     else
         return status::runtime_error;
 }
@@ -41,11 +41,23 @@ struct jit_uni_reduction_t : public primitive_t {
         status_t init(engine_t *engine);
 
         const jit_reduction_conf_t &get_conf() const { return conf_; };
+        const jit_reduction_conf_t &get_chunk_conf(bool is_tail) const {
+            return is_tail ? chunk_tail_conf_ : chunk_conf_;
+        }
+        const jit_reduction_conf_t &get_combine_conf() const {
+            return combine_conf_;
+        }
 
     private:
         bool fill_post_ops_conf();
+        void init_split_conf();
 
         jit_reduction_conf_t conf_;
+        // Configurations of the split reduction kernels: chunks (the last
+        // one may be shorter) and combining of the partials.
+        jit_reduction_conf_t chunk_conf_;
+        jit_reduction_conf_t chunk_tail_conf_;
+        jit_reduction_conf_t combine_conf_;
     };
 
     jit_uni_reduction_t(const pd_t *apd) : primitive_t(apd) {}
@@ -57,11 +69,15 @@ struct jit_uni_reduction_t : public primitive_t {
 
 private:
     status_t get_proper_kernel(
+            std::unique_ptr<jit_uni_reduction_kernel_base_t> &kernel,
             const memory_desc_t *dst_md, const jit_reduction_conf_t &conf);
+    status_t execute_split(const exec_ctx_t &ctx) const;
 
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
     std::unique_ptr<jit_uni_reduction_kernel_base_t> kernel_;
+    std::unique_ptr<jit_uni_reduction_kernel_base_t> chunk_kernel_;
+    std::unique_ptr<jit_uni_reduction_kernel_base_t> chunk_tail_kernel_;
 };
 
 } // namespace x64
@@ -397,7 +397,8 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::finalize() {
     if (conf_.alg == alg_kind::reduction_mean) {
         const Xmm xmm_acc(vmm_acc_.getIdx());
         const Xmm xmm_reduce_size(vmm_tmp1_.getIdx());
-        mov(reg_tmp_.cvt32(), float2int(static_cast<float>(conf_.reduce_size)));
+        mov(reg_tmp_.cvt32(),
+                float2int(static_cast<float>(conf_.mean_divisor)));
         uni_vmovd(xmm_reduce_size, reg_tmp_.cvt32());
         uni_vdivss(xmm_acc, xmm_acc, xmm_reduce_size);
     }
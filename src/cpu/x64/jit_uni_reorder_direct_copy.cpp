@@ -16,6 +16,8 @@
 
 #include "common/dnnl_thread.hpp"
 
+#include "cpu/platform.hpp"
+
 #include "cpu/x64/jit_uni_reorder_direct_copy.hpp"
 
 #include "cpu/x64/jit_generator.hpp"
@@ -34,13 +36,16 @@ struct direct_copy_kernel_t
       public jit_generator_t {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(direct_copy_kernel_t)
 
-    direct_copy_kernel_t(const reorder_pd_t *pd, cpu_isa_t isa)
+    direct_copy_kernel_t(
+            const reorder_pd_t *pd, cpu_isa_t isa, bool use_nt_stores)
         : jit_uni_reorder_direct_copy_t::kernel_base_t(pd)
         , jit_generator_t(jit_name(), isa)
         , isa_(isa)
         , src_dt_(pd_->src_md()->data_type)
-        , dst_dt_(pd_->dst_md()->data_type) {
+        , dst_dt_(pd_->dst_md()->data_type)
+        , use_nt_stores_(use_nt_stores) {
         assert(!utils::one_of(isa_, isa_undef, isa_all));
+        assert(IMPLICATION(use_nt_stores_, dst_dt_ == data_type::f32));
 
         const memory_desc_wrapper src_d(pd_->src_md());
 
@@ -66,6 +71,9 @@ struct direct_copy_kernel_t
     static constexpr int simd_w_ = vlen_ / sizeof(float);
     static constexpr int unroll_12_ = 12;
     static constexpr int unroll_4_ = 4;
+    // Distance in bytes to prefetch the source with when streaming the
+    // destination past the cache.
+    static constexpr int prefetch_distance_ = 2048;
 
     int get_max_unroll() const override { return unroll_12_; }
 
@@ -91,7 +99,23 @@ struct direct_copy_kernel_t
         return Vmm(idx + 1);
     }
 
+    void store(const Vmm &vmm, const Address &addr, const bool tail) {
+        // Tail stores are masked, which non-temporal stores don't support.
+        if (use_nt_stores_ && !tail)
+            uni_vmovntps(addr, vmm);
+        else
+            io_[dst_dt_]->store(vmm, addr, tail);
+    }
+
     void copy(const int unroll, const bool tail) {
+        if (use_nt_stores_ && unroll == unroll_12_) {
+            const int src_bytes
+                    = unroll * types::data_type_size(src_dt_) * simd_w_;
+            for (int off = 0; off < src_bytes;
+                    off += platform::get_cache_line_size())
+                prefetcht0(src_ptr(prefetch_distance_ + off));
+        }
+
         // Copy two simdw at once in vectorized loop first when `ne_convert`
         // instructions are available for xf16.
         if (isa_ == avx2_vnni_2
@@ -107,11 +131,11 @@ struct direct_copy_kernel_t
                         vmm_src_even, vmm_src_odd);
                 io_[src_dt_]->merge_interleaved_to_plain(
                         vmm_src_even, vmm_src_odd, vmm_tmp);
-                io_[dst_dt_]->store(vmm_src_even,
+                store(vmm_src_even,
                         dst_ptr(2 * i * types::data_type_size(dst_dt_)
                                 * simd_w_),
                         tail);
-                io_[dst_dt_]->store(vmm_src_odd,
+                store(vmm_src_odd,
                         dst_ptr((2 * i + 1) * types::data_type_size(dst_dt_)
                                 * simd_w_),
                         tail);
@@ -123,7 +147,7 @@ struct direct_copy_kernel_t
                         vmm_src(i), tail);
             }
             for (int i = 0; i < unroll; i++) {
-                io_[dst_dt_]->store(vmm_src(i),
+                store(vmm_src(i),
                         dst_ptr(i * types::data_type_size(dst_dt_) * simd_w_),
                         tail);
             }
@@ -192,6 +216,9 @@ struct direct_copy_kernel_t
         }
         L(end);
 
+        // Order the streamed data before any store that follows the kernel.
+        if (use_nt_stores_) sfence();
+
         postamble();
 
         if (is_f8()) io_.prepare_table_fp8();
@@ -219,6 +246,7 @@ private:
 
     cpu_isa_t isa_;
     data_type_t src_dt_, dst_dt_;
+    bool use_nt_stores_;
     io::jit_io_multi_dt_helper_t<Vmm> io_;
     size_t tail_size_;
 
@@ -331,12 +359,21 @@ status_t jit_uni_reorder_direct_copy_t::pd_t::init(
 
     VDISPATCH_REORDER(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
 
+    // Outputs not fitting into the last level cache are written with
+    // non-temporal stores. This saves the read-for-ownership traffic and keeps
+    // the cache content for the next primitive. Only f32 destination is stored
+    // without a conversion that would change the register width.
+    const size_t llc_size = static_cast<size_t>(dnnl_get_current_num_threads())
+            * platform::get_per_core_cache_size(3);
+    const size_t data_size = src_d.size() + dst_d.size();
+    use_nt_stores_ = dst_dt == f32 && llc_size > 0 && data_size > llc_size;
+
     return status::success;
 }
 
 jit_uni_reorder_direct_copy_t::kernel_base_t *
 jit_uni_reorder_direct_copy_t::kernel_base_t::create(
-        const reorder_pd_t *pd, cpu_isa_t isa) {
+        const reorder_pd_t *pd, cpu_isa_t isa, bool use_nt_stores) {
     // Reorder must support blocked formats such as aBx8b.
     // These variables will help to dispatch smaller blocks into proper kernels.
     const bool has_blocks = !memory_desc_wrapper(pd->src_md()).is_plain();
@@ -344,12 +381,12 @@ jit_uni_reorder_direct_copy_t::kernel_base_t::create(
 
     if (is_superset(isa, avx512_core)
             && IMPLICATION(has_blocks, blocks_size >= 16)) {
-        return new direct_copy_kernel_t<Zmm>(pd, isa);
+        return new direct_copy_kernel_t<Zmm>(pd, isa, use_nt_stores);
     } else if (is_superset(isa, avx2)
             && IMPLICATION(has_blocks, blocks_size >= 8)) {
-        return new direct_copy_kernel_t<Ymm>(pd, isa);
+        return new direct_copy_kernel_t<Ymm>(pd, isa, use_nt_stores);
     } else if (is_superset(isa, sse41)) {
-        return new direct_copy_kernel_t<Xmm>(pd, isa);
+        return new direct_copy_kernel_t<Xmm>(pd, isa, use_nt_stores);
     } else {
         assert(!"unexpected");
     }
@@ -358,8 +395,14 @@ jit_uni_reorder_direct_copy_t::kernel_base_t::create(
 
 status_t jit_uni_reorder_direct_copy_t::init(engine_t *engine) {
     const auto isa = pd()->isa_;
-    CHECK(safe_ptr_assign(kernel_, kernel_base_t::create(pd(), isa)));
-    return kernel_->create_kernel();
+    CHECK(safe_ptr_assign(kernel_, kernel_base_t::create(pd(), isa, false)));
+    CHECK(kernel_->create_kernel());
+    if (pd()->use_nt_stores_) {
+        CHECK(safe_ptr_assign(
+                kernel_nt_, kernel_base_t::create(pd(), isa, true)));
+        CHECK(kernel_nt_->create_kernel());
+    }
+    return status::success;
 }
 
 status_t jit_uni_reorder_direct_copy_t::execute(const exec_ctx_t &ctx) const {
@@ -378,6 +421,13 @@ status_t jit_uni_reorder_direct_copy_t::execute(const exec_ctx_t &ctx) const {
             = static_cast<dim_t>(kernel_->get_max_unroll()) * simd_w;
     int nthr = nelems < thr_granularity ? 1 : 0;
 
+    // Non-temporal stores require the destination aligned to a vector. Thread
+    // chunks start at multiples of a vector, so checking the base is enough.
+    const auto dst_addr
+            = reinterpret_cast<uintptr_t>(out + dst_d.offset0() * dst_dt_size);
+    const bool is_dst_aligned = dst_addr % isa_max_vlen(pd()->isa_) == 0;
+    const auto &kernel = kernel_nt_ && is_dst_aligned ? kernel_nt_ : kernel_;
+
     parallel(nthr, [&](const int ithr, const int nthr) {
         dim_t start {0}, end {0};
 
@@ -386,7 +436,7 @@ status_t jit_uni_reorder_direct_copy_t::execute(const exec_ctx_t &ctx) const {
         end = nstl::min(nelems, end * simd_w);
         if (start == end) return;
 
-        (*kernel_)(in + (start + src_d.offset0()) * src_dt_size,
+        (*kernel)(in + (start + src_d.offset0()) * src_dt_size,
                 out + (start + dst_d.offset0()) * dst_dt_size, end - start);
     });
 
@@ -40,6 +40,9 @@ struct jit_uni_reorder_direct_copy_t : public primitive_t {
                 engine_t *engine, engine_t *src_engine, engine_t *dst_engine);
 
         cpu_isa_t isa_;
+        // Whether a kernel with non-temporal stores is generated for outputs
+        // exceeding the last level cache.
+        bool use_nt_stores_ = false;
 
     private:
         static status_t create(reorder_pd_t **reorder_pd, engine_t *engine,
@@ -56,7 +59,8 @@ struct jit_uni_reorder_direct_copy_t : public primitive_t {
     struct kernel_base_t {
         virtual void operator()(
                 const void *src, void *dst, size_t work_amount) const = 0;
-        static kernel_base_t *create(const reorder_pd_t *pd, cpu_isa_t isa);
+        static kernel_base_t *create(
+                const reorder_pd_t *pd, cpu_isa_t isa, bool use_nt_stores);
         virtual status_t create_kernel() = 0;
         virtual int get_max_unroll() const = 0;
         virtual ~kernel_base_t() = default;
@@ -72,6 +76,8 @@ struct jit_uni_reorder_direct_copy_t : public primitive_t {
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     std::unique_ptr<kernel_base_t> kernel_;
+    // Used instead of `kernel_` when the destination is aligned to a vector.
+    std::unique_ptr<kernel_base_t> kernel_nt_;
 };
 
 } // namespace x64
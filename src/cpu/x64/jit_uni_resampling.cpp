@@ -111,6 +111,18 @@ status_t jit_uni_resampling_fwd_t::pd_t::init(engine_t *engine) {
     if (conf_.alg == alg_kind::resampling_linear)
         conf_.number_of_corners = pow(2, conf_.ndims - 2);
 
+    if (utils::one_of(conf_.alg, alg_kind::resampling_cubic,
+                alg_kind::resampling_linear_antialias)) {
+        VDISPATCH_RESAMPLING(conf_.tag_kind != jit_memory_tag_kind_t::ncsp,
+                VERBOSE_UNSUPPORTED_TAG);
+        conf_.filter_taps_w = filter_taps(conf_.alg, OW(), IW());
+        conf_.filter_taps_row = filter_taps(conf_.alg, OD(), ID())
+                * filter_taps(conf_.alg, OH(), IH());
+        // Width taps are unrolled in the kernel.
+        VDISPATCH_RESAMPLING(conf_.filter_taps_w <= 16, VERBOSE_BLOCKING_FAIL,
+                "too many filter taps");
+    }
+
     conf_.src_dt_size = types::data_type_size(conf_.src_data_type);
     conf_.dst_dt_size = types::data_type_size(conf_.dst_data_type);
 
@@ -286,6 +298,9 @@ status_t jit_uni_resampling_fwd_t::fill_data_for_interpolation() {
     switch (pd()->desc()->alg_kind) {
         case alg_kind::resampling_nearest: return fill_data_for_nearest();
         case alg_kind::resampling_linear: return fill_data_for_linear();
+        case alg_kind::resampling_cubic:
+        case alg_kind::resampling_linear_antialias:
+            return fill_data_for_filter();
         default:
             assert(!"Invalid resampling algorithm.");
             return status::invalid_arguments;
@@ -418,6 +433,60 @@ status_t jit_uni_resampling_fwd_t::fill_data_for_linear() {
     return status::success;
 }
 
+status_t jit_uni_resampling_fwd_t::fill_data_for_filter() {
+    const alg_kind_t alg = pd()->desc()->alg_kind;
+    const dim_t OD = pd()->OD();
+    const dim_t OH = pd()->OH();
+    const dim_t OW = pd()->OW();
+    const dim_t ID = pd()->ID();
+    const dim_t IH = pd()->IH();
+    const dim_t IW = pd()->IW();
+    const unsigned stride_w = pd()->get_conf().stride_w;
+    const unsigned stride_h = pd()->get_conf().stride_h;
+    const unsigned stride_d = pd()->get_conf().stride_d;
+    const dim_t taps_w = pd()->get_conf().filter_taps_w;
+    const dim_t taps_row = pd()->get_conf().filter_taps_row;
+    const dim_t taps_d = filter_taps(alg, OD, ID);
+    const dim_t taps_h = filter_taps(alg, OH, IH);
+    assert(taps_d * taps_h == taps_row);
+
+    indices_.resize(OW * taps_w + OD * OH * taps_row);
+    weights_.resize(OW * taps_w + OD * OH * taps_row);
+
+    std::vector<dim_t> idx(nstl::max(taps_w, nstl::max(taps_d, taps_h)));
+    std::vector<float> wei(idx.size());
+
+    for (dim_t ow = 0; ow < OW; ow++) {
+        filter_coeffs(alg, ow, OW, IW, idx.data(), wei.data());
+        for (dim_t k = 0; k < taps_w; k++) {
+            indices_[ow * taps_w + k] = idx[k] * stride_w;
+            weights_[ow * taps_w + k] = wei[k];
+        }
+    }
+
+    std::vector<dim_t> idx_h(OH * taps_h);
+    std::vector<float> wei_h(OH * taps_h);
+    for (dim_t oh = 0; oh < OH; oh++)
+        filter_coeffs(
+                alg, oh, OH, IH, &idx_h[oh * taps_h], &wei_h[oh * taps_h]);
+
+    unsigned *indices_row = &indices_[OW * taps_w];
+    float *weights_row = &weights_[OW * taps_w];
+    for (dim_t od = 0; od < OD; od++) {
+        filter_coeffs(alg, od, OD, ID, idx.data(), wei.data());
+        for_(dim_t oh = 0; oh < OH; oh++)
+        for_(dim_t kd = 0; kd < taps_d; kd++)
+        for (dim_t kh = 0; kh < taps_h; kh++) {
+            const dim_t off = (od * OH + oh) * taps_row + kd * taps_h + kh;
+            indices_row[off] = idx[kd] * stride_d
+                    + idx_h[oh * taps_h + kh] * stride_h;
+            weights_row[off] = wei[kd] * wei_h[oh * taps_h + kh];
+        }
+    }
+
+    return status::success;
+}
+
 status_t jit_uni_resampling_fwd_t::execute(const exec_ctx_t &ctx) const {
     const auto src = CTX_IN_MEM(const uint8_t *, DNNL_ARG_SRC);
     auto dst = CTX_OUT_MEM(uint8_t *, DNNL_ARG_DST);
@@ -431,6 +500,9 @@ status_t jit_uni_resampling_fwd_t::execute(const exec_ctx_t &ctx) const {
             return interpolate_nearest(src, dst, post_ops_binary_rhs_arg_vec);
         case alg_kind::resampling_linear:
             return interpolate_linear(src, dst, post_ops_binary_rhs_arg_vec);
+        case alg_kind::resampling_cubic:
+        case alg_kind::resampling_linear_antialias:
+            return interpolate_filter(src, dst, post_ops_binary_rhs_arg_vec);
         default:
             assert(!"Invalid resampling algorithm.");
             return status::invalid_arguments;
@@ -587,6 +659,56 @@ status_t jit_uni_resampling_fwd_t::interpolate_linear(const uint8_t *src,
     return status::success;
 }
 
+status_t jit_uni_resampling_fwd_t::interpolate_filter(const uint8_t *src,
+        uint8_t *dst, const std::vector<const void *> &post_ops_args) const {
+    const size_t src_dt_size = pd()->get_conf().src_dt_size;
+    const size_t dst_dt_size = pd()->get_conf().dst_dt_size;
+    const size_t inner_stride = pd()->get_conf().inner_stride;
+    const dim_t taps_w = pd()->get_conf().filter_taps_w;
+    const dim_t taps_row = pd()->get_conf().filter_taps_row;
+
+    const dim_t MB = pd()->MB();
+    const dim_t C = pd()->C();
+    const dim_t CB = utils::div_up(C, inner_stride);
+    const dim_t nsp_outer = MB * CB;
+    const dim_t OD = pd()->OD();
+    const dim_t OH = pd()->OH();
+    const dim_t OW = pd()->OW();
+    const dim_t ID = pd()->ID();
+    const dim_t IH = pd()->IH();
+    const dim_t IW = pd()->IW();
+
+    assert(pd()->get_conf().tag_kind != jit_memory_tag_kind_t::ncsp);
+
+    const unsigned *indices_row = &indices_[OW * taps_w];
+    const float *weights_row = &weights_[OW * taps_w];
+
+    parallel_nd(nsp_outer, OD, OH, [&](dim_t nsp, dim_t od, dim_t oh) {
+        const dim_t src_off = nsp * ID * IH * IW * inner_stride * src_dt_size;
+        const dim_t dst_off = (((nsp * OD + od) * OH + oh) * OW) * inner_stride
+                * dst_dt_size;
+        const dim_t row_off = (od * OH + oh) * taps_row;
+
+        const size_t cb = std::div(nsp, CB).rem;
+
+        jit_uni_resampling_args_t args;
+        args.batch_of_sp_points_to_process = OW;
+        args.src = src + src_off;
+        args.dst = dst + dst_off;
+        args.dst_orig = dst;
+        args.indices = &indices_[0];
+        args.weights = &weights_[0];
+        args.row_indices = &indices_row[row_off];
+        args.row_weights = &weights_row[row_off];
+        args.post_ops_binary_rhs_arg_vec = post_ops_args.data();
+        args.c_offset = static_cast<size_t>(cb * inner_stride);
+
+        (*kernel_)(&args);
+    });
+
+    return status::success;
+}
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
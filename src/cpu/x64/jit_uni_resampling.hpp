@@ -164,11 +164,32 @@ private:
      * sp_1 = weight_1_front * weight_1_bottom * weight_1_left
      * ...
      */
+    status_t fill_data_for_filter();
+    /*
+     * Fills indices_ and weights_ with the taps of the separable filter
+     * used by the cubic and antialiased linear algorithms. Only NSPC and
+     * BLOCKED formats are supported.
+     * The data is arranged as follows (tw = filter_taps_w,
+     * tr = filter_taps_row):
+     *
+     * indices_:
+     * ow_0 = iw_0_0 ... iw_0_tw-1
+     * ow_1 = iw_1_0 ... iw_1_tw-1
+     * ...
+     * od_0_oh_0 = id_ih_0_0 ... id_ih_0_tr-1
+     * od_0_oh_1 = id_ih_1_0 ... id_ih_1_tr-1
+     * ...
+     *
+     * weights_ has the same layout, a row weight being the product of the
+     * depth and height weights.
+     */
 
     status_t interpolate_nearest(const uint8_t *src, uint8_t *dst,
             const std::vector<const void *> &post_ops_args) const;
     status_t interpolate_linear(const uint8_t *src, uint8_t *dst,
             const std::vector<const void *> &post_ops_args) const;
+    status_t interpolate_filter(const uint8_t *src, uint8_t *dst,
+            const std::vector<const void *> &post_ops_args) const;
 
     status_t get_proper_kernel_for_avx512(
             const memory_desc_t *dst_md, const jit_resampling_conf_t &conf);
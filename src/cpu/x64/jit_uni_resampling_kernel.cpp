@@ -858,6 +858,122 @@ void jit_uni_resampling_kernel_t<isa, Vmm>::linear_c_oriented_format(
     L(loop_end);
 }
 
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_resampling_kernel_t<isa, Vmm>::compute_filter_c_interpolate(
+        const int c_to_compute_without_tail, const bool is_tail) {
+    const Reg64 &reg_c = reg_tmp_;
+
+    auto filter_interpolation = [&](const bool is_tail) {
+        const bool load_and_store_with_tail
+                = is_tail && conf_.tag_kind == tag_kind::nspc;
+
+        // dst = sum_r(w_row[r] * sum_k(w_w[k] * src[row[r] + col[k]]))
+        uni_vxorps(vmm_filter_acc_, vmm_filter_acc_, vmm_filter_acc_);
+        mov(reg_row_indices_, ptr[reg_param + GET_OFF(row_indices)]);
+        mov(reg_row_weights_, ptr[reg_param + GET_OFF(row_weights)]);
+        mov(reg_row_work_, conf_.filter_taps_row);
+
+        Label row_loop;
+        L(row_loop);
+        {
+            mov(reg_src_row_, reg_src_);
+            mov(reg_tap_offset_.cvt32(), dword[reg_row_indices_]);
+            add(reg_src_row_, reg_tap_offset_);
+
+            uni_vxorps(vmm_filter_row_acc_, vmm_filter_row_acc_,
+                    vmm_filter_row_acc_);
+            for (unsigned k = 0; k < conf_.filter_taps_w; k++) {
+                mov(reg_tap_offset_.cvt32(),
+                        dword[reg_indices_ + k * conf_.el_size_of_indices]);
+                io_.at(conf_.src_data_type)
+                        ->load(ptr[reg_src_row_ + reg_tap_offset_], vmm_src_,
+                                load_and_store_with_tail);
+                uni_vbroadcastss(
+                        vmm_weights_, ptr[reg_weights + k * sizeof(float)]);
+                uni_vfmadd231ps(vmm_filter_row_acc_, vmm_src_, vmm_weights_);
+            }
+            uni_vbroadcastss(vmm_weights_, ptr[reg_row_weights_]);
+            uni_vfmadd231ps(vmm_filter_acc_, vmm_filter_row_acc_, vmm_weights_);
+
+            add(reg_row_indices_, conf_.el_size_of_indices);
+            add(reg_row_weights_, sizeof(float));
+            dec(reg_row_work_);
+            jnz(row_loop, T_NEAR);
+        }
+
+        if (conf_.with_postops)
+            apply_postops(vmm_filter_acc_.getIdx(), is_tail);
+
+        io_.at(conf_.dst_data_type)
+                ->store(vmm_filter_acc_, ptr[reg_dst_],
+                        load_and_store_with_tail);
+    };
+
+    Label c_loop_begin, c_loop_end;
+    xor_(reg_c, reg_c);
+    L(c_loop_begin);
+    {
+        cmp(reg_c, c_to_compute_without_tail);
+        je(c_loop_end, T_NEAR);
+
+        filter_interpolation(false);
+        add(reg_src_, simd_w_ * conf_.src_dt_size);
+        add(reg_dst_, simd_w_ * conf_.dst_dt_size);
+
+        add(reg_c, simd_w_);
+        jmp(c_loop_begin, T_NEAR);
+    }
+    L(c_loop_end);
+
+    if (is_tail) {
+        filter_interpolation(true);
+        if (conf_.tag_kind == tag_kind::nspc)
+            add(reg_dst_, tail_size_ * conf_.dst_dt_size);
+        else if (conf_.tag_kind == tag_kind::blocked)
+            add(reg_dst_, simd_w_ * conf_.dst_dt_size);
+    }
+}
+
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_resampling_kernel_t<isa, Vmm>::filter_c_oriented_format(
+        const bool is_tail_in_blocked_format) {
+    const int c_to_compute_without_tail
+            = get_channels_to_compute_without_tail(is_tail_in_blocked_format);
+    const bool insert_tail_processsing_code
+            = (conf_.tag_kind == tag_kind::nspc && tail_size_ > 0)
+            || is_tail_in_blocked_format;
+
+    Label loop_begin, loop_end;
+
+    L(loop_begin);
+    {
+        cmp(reg_work_, 1);
+        jl(loop_end, T_NEAR);
+
+        push(reg_src_);
+
+        compute_filter_c_interpolate(c_to_compute_without_tail, false);
+
+        if (insert_tail_processsing_code) {
+            if (tail_size_ > 0) compute_filter_c_interpolate(0, true);
+
+            if (conf_.tag_kind == tag_kind::blocked)
+                preserve_zero_padding(
+                        c_to_compute_without_tail, is_tail_in_blocked_format);
+        }
+
+        pop(reg_src_);
+
+        // Width taps of the next point follow the current ones.
+        add(reg_indices_, conf_.filter_taps_w * conf_.el_size_of_indices);
+        add(reg_weights, conf_.filter_taps_w * sizeof(float));
+
+        dec(reg_work_);
+        jmp(loop_begin, T_NEAR);
+    }
+    L(loop_end);
+}
+
 template <cpu_isa_t isa, typename Vmm>
 void jit_uni_resampling_kernel_t<isa, Vmm>::generate() {
     preamble();
@@ -905,6 +1021,15 @@ void jit_uni_resampling_kernel_t<isa, Vmm>::generate() {
                         linear_c_oriented_format(is_tail_in_blocked_format);
                     });
         }
+    } else if (utils::one_of(conf_.alg, alg_kind::resampling_cubic,
+                       alg_kind::resampling_linear_antialias)) {
+        assert(conf_.tag_kind != tag_kind::ncsp);
+        mov(reg_src_, ptr[reg_param + GET_OFF(src)]);
+        mov(reg_weights, ptr[reg_param + GET_OFF(weights)]);
+        interpolate_c_oriented_format(
+                [&](const bool is_tail_in_blocked_format) {
+                    filter_c_oriented_format(is_tail_in_blocked_format);
+                });
     }
 
     postamble();
@@ -106,6 +106,9 @@ private:
             const int c_to_compute_without_tail, const bool is_tail);
     void compute_ne_xf16_linear_c_interpolate(
             const int c_to_compute_without_tail);
+    void filter_c_oriented_format(const bool is_tail_in_blocked_format);
+    void compute_filter_c_interpolate(
+            const int c_to_compute_without_tail, const bool is_tail);
 
     void generate() override;
 
@@ -196,6 +199,16 @@ private:
             = {reg_src_ftl_, reg_src_ftr_, reg_src_fbl_, reg_src_fbr_,
                     reg_src_btl_, reg_src_btr_, reg_src_bbl_, reg_src_bbr_};
 
+    // Registers which are used only for cubic and antialiased linear
+    // algorithms, these are computed as a sum of filtered rows.
+    const Vmm vmm_filter_acc_ = Vmm(vmm_idx(0));
+    const Vmm vmm_filter_row_acc_ = Vmm(vmm_idx(1));
+    const Reg64 reg_row_indices_ = reg_aux_src_0_;
+    const Reg64 reg_row_weights_ = reg_aux_src_1_;
+    const Reg64 reg_row_work_ = reg_aux_src_2_;
+    const Reg64 reg_src_row_ = r12;
+    const Reg64 reg_tap_offset_ = r13;
+
     static constexpr bool is_zmm_ = std::is_same<Vmm, Xbyak::Zmm>::value;
     static constexpr bool is_ymm_ = std::is_same<Vmm, Xbyak::Ymm>::value;
     static constexpr bool is_xmm_ = std::is_same<Vmm, Xbyak::Xmm>::value;
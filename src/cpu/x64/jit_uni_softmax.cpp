@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <assert.h>
+#include <limits>
 
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
@@ -89,8 +90,10 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
     Reg64 reg_interim_spat_offt = abi_not_param1;
     Reg64 reg_src_scales = rsi;
     Reg64 reg_dst_scales = rdx;
+    Reg64 reg_attn_mask = rbp;
 
     Opmask injector_mask = Opmask(1);
+    Opmask causal_opmask = Opmask(3);
 
     Vmm vtmp; // assigned at placed where used
     Vmm tail_vmask = Vmm(0);
@@ -104,6 +107,8 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
     Vmm vzero = Vmm(is_superset(isa, avx512_core) ? 21 : 11);
     Vmm vcvt_vmm = Vmm(is_superset(isa, avx512_core) ? 22 : 10);
     Vmm vsaturation_ubound = vneg_flt_max;
+    // Last unmasked element index relative to the current unroll block.
+    Vmm vcausal_limit = Vmm(is_superset(isa, avx512_core) ? 27 : 9);
 
     bool is_bf16_ = false;
     bool is_f16_ = false;
@@ -118,6 +123,9 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
     bool with_src_scales_ = false;
     bool with_dst_scales_ = false;
     bool use_ext_aux_vmms_ = false;
+    bool with_attn_scale_ = false;
+    bool with_attn_mask_buffer_ = false;
+    bool with_causal_mask_ = false;
 
     size_t unroll_regs_ = 4;
 
@@ -139,6 +147,9 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
 
     Opmask tail_opmask = Opmask(tail_opmask_idx_);
 
+    Label l_causal_iota_;
+    Label l_neg_inf_;
+
     void operator()(const call_params_t *p) const override {
         return jit_generator_t::operator()(p);
     }
@@ -147,6 +158,10 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
         return jit_generator_t::create_kernel();
     }
 
+    bool with_attn_preprocessing() const {
+        return with_attn_scale_ || with_attn_mask_buffer_ || with_causal_mask_;
+    }
+
     bool is_data_type_xf16(data_type_t dt) {
         return utils::one_of(dt, bf16, f16);
     }
@@ -200,6 +215,57 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
         }
         mov(reg_src_scales, ptr[reg_param + PARAM_OFF(src_scales)]);
         mov(reg_dst_scales, ptr[reg_param + PARAM_OFF(dst_scales)]);
+        if (with_attn_mask_buffer_)
+            mov(reg_attn_mask, ptr[reg_param + PARAM_OFF(attn_mask)]);
+    }
+
+    // Broadcasts an index of the last unmasked element relative to the
+    // current position of `reg_src_spat_offt`. Must be called at the start of
+    // a loop body as it uses `reg_tmp`.
+    void prepare_causal_limit() {
+        mov(reg_tmp, ptr[reg_param + PARAM_OFF(attn_mask_n_valid_bytes)]);
+        sub(reg_tmp, reg_src_spat_offt);
+        const int dt_size_shift = math::ilog2q(src_d_.data_type_size());
+        if (dt_size_shift) sar(reg_tmp, dt_size_shift);
+        sub(reg_tmp, 1);
+        uni_vpbroadcastd(vcausal_limit, reg_tmp.cvt32());
+    }
+
+    // Scales the `i`-th loaded src vector of a loop body and applies the mask.
+    // Masked out elements of a causal mask are set to -inf. Uses `vsum` as a
+    // temporary, which is free while the axis is traversed.
+    void apply_attn_preprocessing(const Vmm &vreg_src, int i, bool tail) {
+        const Vmm vaux = vsum;
+        if (with_attn_scale_) {
+            uni_vbroadcastss(vaux, ptr[reg_param + PARAM_OFF(attn_scale)]);
+            uni_vmulps(vreg_src, vreg_src, vaux);
+        }
+        if (with_attn_mask_buffer_) {
+            io_[src_d_.data_type()]->load(
+                    attn_mask_ptr(src_next_vreg_stride_ * i), vaux, tail);
+            uni_vaddps(vreg_src, vreg_src, vaux);
+        }
+        if (with_causal_mask_) {
+            const Address iota = ptr[rip + l_causal_iota_ + i * vlen];
+            if (is_superset(isa, avx512_core)) {
+                vpcmpd(causal_opmask, vcausal_limit, iota, 1 /* lt */);
+                vbroadcastss(vreg_src | causal_opmask, ptr[rip + l_neg_inf_]);
+            } else {
+                uni_vmovups(vaux, iota);
+                vpcmpgtd(vaux, vaux, vcausal_limit);
+                uni_vblendvps(vreg_src, vreg_src, ptr[rip + l_neg_inf_], vaux);
+            }
+        }
+    }
+
+    void prepare_causal_table() {
+        align(64);
+        L(l_causal_iota_);
+        for (size_t i = 0; i < unroll_regs_ * simd_w_; i++)
+            dd(static_cast<uint32_t>(i));
+        L(l_neg_inf_);
+        for (size_t i = 0; i < simd_w_; i++)
+            dd(float2int(-std::numeric_limits<float>::infinity()));
     }
 
     Address diff_src_ptr(size_t offt = 0) {
@@ -210,6 +276,10 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
         return vmmword[reg_src + reg_src_spat_offt + offt];
     }
 
+    Address attn_mask_ptr(size_t offt = 0) {
+        return vmmword[reg_attn_mask + reg_src_spat_offt + offt];
+    }
+
     Address interim_ptr(size_t offt = 0) {
         return vmmword[reg_interim + reg_interim_spat_offt + offt];
     }
@@ -451,19 +521,23 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
         // It removes dependency on a single vmm when reading data, but
         // introduces a synchronization between them in a post-body call.
         const auto body = [&](int unroll, int max_unroll, bool tail = false) {
+            if (with_causal_mask_) prepare_causal_limit();
             for (int i = 0; i < unroll; i++) {
                 Vmm vreg_tmp_src = Vmm(i + 1);
                 Vmm vreg_tmp_max = get_aux_vmm(vreg_tmp_src, max_unroll);
                 // do maxps directly from memory on f32 avx2 for performance
                 if (!tail && is_superset(isa, avx2)
                         && !is_superset(isa, avx512_core)
-                        && src_d_.data_type() == f32) {
+                        && src_d_.data_type() == f32
+                        && !with_attn_preprocessing()) {
                     uni_vmaxps(vreg_tmp_max, vreg_tmp_max,
                             src_ptr(src_next_vreg_stride_ * i));
                 } else {
                     io_[src_d_.data_type()]->load(
                             src_ptr(src_next_vreg_stride_ * i), vreg_tmp_src,
                             tail);
+                    if (with_attn_preprocessing())
+                        apply_attn_preprocessing(vreg_tmp_src, i, tail);
                     uni_vmaxps_maybe_tail(
                             vreg_tmp_max, vreg_tmp_src, vtmp = vsum, tail);
                 }
@@ -607,10 +681,13 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
         // It removes dependency on a single vmm when reading data, but
         // introduces a synchronization between them in a post-body call.
         const auto body = [&](int unroll, int max_unroll, bool tail = false) {
+            if (with_causal_mask_) prepare_causal_limit();
             for (int i = 0; i < unroll; i++) {
                 Vmm vreg_tmp_src = Vmm(i + 1);
                 io_[src_d_.data_type()]->load(
                         src_ptr(src_next_vreg_stride_ * i), vreg_tmp_src, tail);
+                if (with_attn_preprocessing())
+                    apply_attn_preprocessing(vreg_tmp_src, i, tail);
                 uni_vsubps(vreg_tmp_src, vreg_tmp_src, vmax);
                 if (is_logsoftmax_) { // store before applying exp
                     if (need_scratchpad_)
@@ -692,7 +769,11 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
 
         get_horizontal_op(vsum, vtmp = vmax, op_t::sum);
 
-        if (pd_->alg_kind() == alg_kind::softmax_accurate_inf_as_zero) {
+        // Rows masked out entirely produce zeros, as in the reference.
+        const bool skip_zero_sum_div
+                = pd_->alg_kind() == alg_kind::softmax_accurate_inf_as_zero
+                || (is_softmax_ && pd_->mask_type() != attn_mask_type::undef);
+        if (skip_zero_sum_div) {
             Xbyak::Label skip_div;
             // `vptest` sets the `ZF` flag if all bits in the result are 0 of
             // the bitwise AND of source operands.
@@ -935,7 +1016,9 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
         if (pd_->is_fwd() || is_logsoftmax_)
             exp_injector_.reset(new jit_uni_eltwise_injector_t<isa>(this,
                     alg_kind::eltwise_exp, 0.0f, 0.0f, 1.0f, data_type::f32,
-                    !use_ext_aux_vmms_, reg_exp_injector_table, injector_mask));
+                    !use_ext_aux_vmms_, reg_exp_injector_table, injector_mask,
+                    true /*is_fwd*/, false /*use_dst*/, true /*preserve_vmm*/,
+                    true /*preserve_p_table*/, pd_->attr()->fpmath_.mode_));
         if (pd_->is_fwd() && is_logsoftmax_) {
             log_injector_.reset(new jit_uni_eltwise_injector_t<isa>(this,
                     alg_kind::eltwise_log, 0.0f, 0.0f, 1.0f, data_type::f32,
@@ -979,6 +1062,7 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
         if (log_injector_) log_injector_->prepare_table();
         if (with_eltwise_ && postops_injector_)
             postops_injector_->prepare_table(/* generate = */ true);
+        if (with_causal_mask_) prepare_causal_table();
     }
 
     jit_softmax_dense_kernel_t(const softmax_pd_t *pd)
@@ -1014,6 +1098,10 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
         with_dst_scales_ = is_superset(isa, avx2)
                 && !attr_scales.has_default_values(DNNL_ARG_DST);
 
+        with_attn_scale_ = pd_->with_scale();
+        with_attn_mask_buffer_ = pd_->with_mask_buffer();
+        with_causal_mask_ = pd_->with_causal_mask();
+
         io::io_conf_t io_conf;
         io::io_tail_conf_t io_tail_conf(simd_w_, axis_simd_tail_,
                 tail_opmask_idx_, tail_vmask.getIdx(), reg_tmp);
@@ -1508,7 +1596,9 @@ struct jit_softmax_strided_kernel_t : jit_softmax_kernel_base_t,
         if (pd_->is_fwd() || is_logsoftmax_)
             exp_injector_.reset(new jit_uni_eltwise_injector_t<isa>(this,
                     alg_kind::eltwise_exp, 0.0f, 0.0f, 1.0f, data_type::f32,
-                    true, reg_exp_injector_table, injector_mask));
+                    true, reg_exp_injector_table, injector_mask,
+                    true /*is_fwd*/, false /*use_dst*/, true /*preserve_vmm*/,
+                    true /*preserve_p_table*/, pd_->attr()->fpmath_.mode_));
         if (pd_->is_fwd() && is_logsoftmax_) {
             log_injector_.reset(new jit_uni_eltwise_injector_t<isa>(this,
                     alg_kind::eltwise_log, 0.0f, 0.0f, 1.0f, data_type::f32,
@@ -1612,6 +1702,311 @@ struct jit_softmax_strided_kernel_t : jit_softmax_kernel_base_t,
 // inner dimension processing `simd_w` axes at a time. This implies different
 // registers usage. To avoid collision and simplify the support, having a second
 // class is easier though certain pieces are same.
+// Online softmax kernel for plain rows much larger than L2. A row is split in
+// chunks aligned to `unroll_regs_ * simd_w_` elements, so only the chunk with
+// the end of a row may have a tail.
+// The stats pass reads a chunk once. For every block of vectors it updates a
+// running maximum and rescales the running sum of exponents by
+// exp(old_max - new_max) before adding exponents of the block. The chunk
+// maximum and sum are stored to `online_stats`.
+// The write pass takes the row maximum and the normalization constant from
+// `online_stats` and computes dst from src.
+template <cpu_isa_t isa>
+struct jit_softmax_online_kernel_t : jit_softmax_kernel_base_t,
+                                     public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_softmax_online_kernel_t)
+
+    using Vmm = typename cpu_isa_traits_t<isa>::Vmm;
+    const AddressFrame &vmmword = is_superset(isa, avx512_core) ? zword
+            : is_superset(isa, avx)                             ? yword
+                                                                : xword;
+    static constexpr auto vlen = cpu_isa_traits_t<isa>::vlen;
+    static constexpr auto n_vregs = cpu_isa_traits_t<isa>::n_vregs;
+    static constexpr auto simd_w_ = vlen / sizeof(float); // bf16 works on ymms
+    static constexpr size_t unroll_regs_ = 4;
+
+    const memory_desc_wrapper src_d_, dst_d_;
+    io::jit_io_multi_dt_helper_t<Vmm> io_;
+
+    std::unique_ptr<jit_uni_eltwise_injector_t<isa>> exp_injector_;
+
+    Reg64 reg_param = abi_param1;
+
+    Reg64 reg_exp_injector_table = rax;
+    Reg64 reg_src = r8;
+    Reg64 reg_dst = r9;
+    Reg64 reg_reverse_n_elems = r10;
+    Reg64 reg_stats = r11;
+    Reg64 reg_tmp = r13;
+
+    Opmask injector_mask = Opmask(1);
+
+    Vmm tail_vmask = Vmm(0);
+    // Vmm(1) - Vmm(unroll_regs_) are used for data.
+    // Running maximum in stats pass, row maximum in write pass.
+    Vmm vmax = Vmm(unroll_regs_ + 1);
+    // Running sum in stats pass, normalization constant in write pass.
+    Vmm vsum = Vmm(unroll_regs_ + 2);
+    Vmm vmax_new = Vmm(unroll_regs_ + 3);
+    Vmm vtmp = Vmm(unroll_regs_ + 4);
+    // Starting index of exp injector auxiliary vmms when those are passed.
+    const size_t exp_aux_vmm_start_idx_ = unroll_regs_ + 5;
+
+    const bool is_write_pass_;
+    bool is_softmax_ = pd_->is_softmax();
+    bool use_ext_aux_vmms_ = n_vregs > 16;
+    size_t axis_simd_tail_;
+
+    const int bf16_emu_zmm_1_idx_ = 23;
+    const int bf16_emu_zmm_2_idx_ = 24;
+    const int bf16_emu_zmm_3_idx_ = 25;
+    const int bf16_emu_zmm_4_idx_ = 26;
+    const int tail_opmask_idx_ = 2;
+
+    Opmask tail_opmask = Opmask(tail_opmask_idx_);
+
+    void operator()(const call_params_t *p) const override {
+        return jit_generator_t::operator()(p);
+    }
+
+    status_t create_kernel() override {
+        return jit_generator_t::create_kernel();
+    }
+
+    Address src_ptr(size_t offt = 0) { return vmmword[reg_src + offt]; }
+
+    Address dst_ptr(size_t offt = 0) { return vmmword[reg_dst + offt]; }
+
+    enum class op_t : unsigned { max, sum };
+
+    void perform_op(
+            const Vmm &vmm_dst, const Vmm &vmm1, const Vmm &vmm2, op_t op) {
+        if (op == op_t::max)
+            uni_vmaxps(vmm_dst, vmm1, vmm2);
+        else if (op == op_t::sum)
+            uni_vaddps(vmm_dst, vmm1, vmm2);
+    }
+
+    void get_horizontal_op(const Vmm &vsrc, const Vmm &vtmp, op_t op) {
+        const Zmm &zsrc = Zmm(vsrc.getIdx());
+        const Zmm &ztmp = Zmm(vtmp.getIdx());
+        const Ymm &ysrc = Ymm(vsrc.getIdx());
+        const Ymm &ytmp = Ymm(vtmp.getIdx());
+
+        if (is_superset(isa, avx512_core)) {
+            vshuff32x4(ztmp, zsrc, zsrc, 0x4E); // 256-bit shuffle
+            perform_op(vsrc, vsrc, vtmp, op);
+            vshuff32x4(ztmp, zsrc, zsrc, 0xB1); // 128/256-bit shuffle
+            perform_op(vsrc, vsrc, vtmp, op);
+        } else {
+            vperm2f128(ytmp, ysrc, ysrc, 0x1); // 128/256-bit shuffle
+            perform_op(vsrc, vsrc, vtmp, op);
+        }
+        uni_vshufps(vtmp, vsrc, vsrc, 0x4E); // 64/128-bit shuffle
+        perform_op(vsrc, vsrc, vtmp, op);
+        uni_vshufps(vtmp, vsrc, vsrc, 0xB1); // 32/64-bit shuffle
+        perform_op(vsrc, vsrc, vtmp, op);
+    }
+
+    void compute_exp(const injector_utils::vmm_index_set_t &vmm_idxs) {
+        if (use_ext_aux_vmms_) {
+            injector_utils::vmm_index_set_t exp_aux_indices;
+            const auto exp_vmm_aux_count
+                    = jit_uni_eltwise_injector_t<isa>::aux_vecs_count(
+                            alg_kind::eltwise_exp, true, 0.f);
+            for (size_t j = 0; j < exp_vmm_aux_count; j++)
+                exp_aux_indices.insert(exp_aux_vmm_start_idx_ + j);
+            exp_injector_->compute_vector_range(vmm_idxs, exp_aux_indices);
+        } else {
+            exp_injector_->compute_vector_range(vmm_idxs);
+        }
+    }
+
+    void broadcast_neg_flt_max(const Vmm &vmm) {
+        mov(reg_tmp, float2int(-FLT_MAX));
+        uni_vmovq(Xmm(vmm.getIdx()), reg_tmp);
+        uni_vbroadcastss(vmm, Xmm(vmm.getIdx()));
+    }
+
+    void stats_body(size_t unroll, bool tail) {
+        injector_utils::vmm_index_set_t exp_idxs;
+        for (size_t i = 0; i < unroll; i++) {
+            const Vmm vreg_src = Vmm(i + 1);
+            io_[src_d_.data_type()]->load(
+                    src_ptr(vlen_src() * i), vreg_src, tail);
+            exp_idxs.insert(vreg_src.getIdx());
+        }
+        if (tail) {
+            // Elements past the tail must not affect the maximum.
+            const Vmm vreg_src = Vmm(1);
+            broadcast_neg_flt_max(vtmp);
+            if (is_superset(isa, avx512_core))
+                vblendmps(vreg_src | tail_opmask, vtmp, vreg_src);
+            else
+                uni_vblendvps(vreg_src, vtmp, vreg_src, tail_vmask);
+        }
+
+        uni_vmovups(vmax_new, vmax);
+        for (size_t i = 0; i < unroll; i++)
+            uni_vmaxps(vmax_new, vmax_new, Vmm(i + 1));
+
+        // The sum accumulated so far is rescaled to the updated maximum.
+        uni_vsubps(vtmp, vmax, vmax_new);
+        uni_vmovups(vmax, vmax_new);
+        for (size_t i = 0; i < unroll; i++)
+            uni_vsubps(Vmm(i + 1), Vmm(i + 1), vmax);
+        exp_idxs.insert(vtmp.getIdx());
+        compute_exp(exp_idxs);
+        uni_vmulps(vsum, vsum, vtmp);
+
+        for (size_t i = 0; i < unroll; i++) {
+            const Vmm vreg_src = Vmm(i + 1);
+            if (!tail)
+                uni_vaddps(vsum, vsum, vreg_src);
+            else if (is_superset(isa, avx512_core))
+                uni_vaddps(vsum | tail_opmask, vsum, vreg_src);
+            else {
+                uni_vpxor(vtmp, vtmp, vtmp);
+                uni_vblendvps(vtmp, vtmp, vreg_src, tail_vmask);
+                uni_vaddps(vsum, vsum, vtmp);
+            }
+        }
+    }
+
+    void write_body(size_t unroll, bool tail) {
+        injector_utils::vmm_index_set_t exp_idxs;
+        for (size_t i = 0; i < unroll; i++) {
+            const Vmm vreg_src = Vmm(i + 1);
+            io_[src_d_.data_type()]->load(
+                    src_ptr(vlen_src() * i), vreg_src, tail);
+            exp_idxs.insert(vreg_src.getIdx());
+        }
+        if (is_softmax_) {
+            for (size_t i = 0; i < unroll; i++)
+                uni_vsubps(Vmm(i + 1), Vmm(i + 1), vmax);
+            compute_exp(exp_idxs);
+            for (size_t i = 0; i < unroll; i++)
+                uni_vmulps(Vmm(i + 1), Vmm(i + 1), vsum);
+        } else {
+            for (size_t i = 0; i < unroll; i++)
+                uni_vsubps(Vmm(i + 1), Vmm(i + 1), vsum);
+        }
+        for (size_t i = 0; i < unroll; i++)
+            io_[dst_d_.data_type()]->store(
+                    Vmm(i + 1), dst_ptr(vlen_dst() * i), tail);
+    }
+
+    size_t vlen_src() const { return simd_w_ * src_d_.data_type_size(); }
+    size_t vlen_dst() const { return simd_w_ * dst_d_.data_type_size(); }
+
+    void axis_loop() {
+        Label unroll_loop, single_loop, tail_axis, loop_end;
+
+        const auto body = [&](size_t unroll, bool tail) {
+            if (is_write_pass_)
+                write_body(unroll, tail);
+            else
+                stats_body(unroll, tail);
+        };
+        const auto advance = [&](size_t unroll) {
+            sub(reg_reverse_n_elems, unroll * simd_w_);
+            add(reg_src, unroll * vlen_src());
+            if (is_write_pass_) add(reg_dst, unroll * vlen_dst());
+        };
+
+        L(unroll_loop);
+        {
+            cmp(reg_reverse_n_elems, unroll_regs_ * simd_w_);
+            jl(single_loop, T_NEAR);
+            body(unroll_regs_, false);
+            advance(unroll_regs_);
+            jmp(unroll_loop, T_NEAR);
+        }
+
+        L(single_loop);
+        {
+            cmp(reg_reverse_n_elems, simd_w_);
+            jl(tail_axis, T_NEAR);
+            body(1, false);
+            advance(1);
+            jmp(single_loop, T_NEAR);
+        }
+
+        L(tail_axis);
+        {
+            if (axis_simd_tail_) {
+                cmp(reg_reverse_n_elems, 1);
+                jl(loop_end, T_NEAR);
+                body(1, true);
+            }
+        }
+
+        L(loop_end);
+    }
+
+    void generate() override {
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+        exp_injector_.reset(new jit_uni_eltwise_injector_t<isa>(this,
+                alg_kind::eltwise_exp, 0.0f, 0.0f, 1.0f, data_type::f32,
+                !use_ext_aux_vmms_, reg_exp_injector_table, injector_mask,
+                true /*is_fwd*/, false /*use_dst*/, true /*preserve_vmm*/,
+                true /*preserve_p_table*/, pd_->attr()->fpmath_.mode_));
+
+        preamble();
+        io_.init_bf16();
+        exp_injector_->load_table_addr();
+        if (axis_simd_tail_) io_.prepare_tail_mask();
+
+        mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+        mov(reg_reverse_n_elems, ptr[reg_param + PARAM_OFF(process_n_elems)]);
+        mov(reg_stats, ptr[reg_param + PARAM_OFF(online_stats)]);
+        if (is_write_pass_) {
+            mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
+            uni_vbroadcastss(vmax, ptr[reg_stats]);
+            uni_vbroadcastss(vsum, ptr[reg_stats + sizeof(float)]);
+        } else {
+            broadcast_neg_flt_max(vmax);
+            uni_vpxor(vsum, vsum, vsum);
+        }
+
+        axis_loop();
+
+        if (!is_write_pass_) {
+            // Reduce lanes: the maximum first, then lane sums rescaled to it.
+            uni_vmovups(vmax_new, vmax);
+            get_horizontal_op(vmax_new, vtmp, op_t::max);
+            uni_vsubps(vmax, vmax, vmax_new);
+            compute_exp({static_cast<size_t>(vmax.getIdx())});
+            uni_vmulps(vsum, vsum, vmax);
+            get_horizontal_op(vsum, vtmp, op_t::sum);
+            uni_vmovss(ptr[reg_stats], Xmm(vmax_new.getIdx()));
+            uni_vmovss(ptr[reg_stats + sizeof(float)], Xmm(vsum.getIdx()));
+        }
+
+        postamble();
+        exp_injector_->prepare_table();
+#undef PARAM_OFF
+    }
+
+    jit_softmax_online_kernel_t(const softmax_pd_t *pd, bool is_write_pass)
+        : jit_softmax_kernel_base_t(pd)
+        , jit_generator_t(jit_name(), isa)
+        , src_d_(pd_->invariant_src_md())
+        , dst_d_(pd_->dst_md())
+        , is_write_pass_(is_write_pass)
+        , axis_simd_tail_(pd_->axis_size() % simd_w_) {
+        io::io_conf_t io_conf;
+        io::io_tail_conf_t io_tail_conf(simd_w_, axis_simd_tail_,
+                tail_opmask_idx_, tail_vmask.getIdx(), reg_tmp);
+        io::io_emu_bf16_conf_t io_bf16_conf(bf16_emu_zmm_1_idx_,
+                bf16_emu_zmm_2_idx_, bf16_emu_zmm_3_idx_, reg_tmp,
+                bf16_emu_zmm_4_idx_);
+        io_ = io::jit_io_multi_dt_helper_t<Vmm>(this, isa,
+                {src_d_.data_type(), dst_d_.data_type()}, io_conf,
+                io_tail_conf, io_bf16_conf);
+    }
+};
+
 jit_softmax_kernel_base_t *jit_softmax_kernel_base_t::create(
         const softmax_pd_t *pd, const cpu_isa_t isa,
         bool axis_is_plain_and_strided) {
@@ -1634,6 +2029,22 @@ jit_softmax_kernel_base_t *jit_softmax_kernel_base_t::create(
     return nullptr;
 }
 
+jit_softmax_kernel_base_t *jit_softmax_kernel_base_t::create_online(
+        const softmax_pd_t *pd, const cpu_isa_t isa, bool is_write_pass) {
+
+#define HANDLE_ISA(isa_) \
+    if ((isa_) == isa) \
+        return new jit_softmax_online_kernel_t<isa_>(pd, is_write_pass);
+    REG_AVX512_ISA(HANDLE_ISA(avx512_core_fp16));
+    REG_AVX512_ISA(HANDLE_ISA(avx512_core_bf16));
+    REG_AVX512_ISA(HANDLE_ISA(avx512_core));
+    REG_AVX2_ISA(HANDLE_ISA(avx2_vnni_2));
+    REG_AVX2_ISA(HANDLE_ISA(avx2));
+#undef HANDLE_ISA
+    assert(!"kernel is empty.");
+    return nullptr;
+}
+
 std::vector<cpu_isa_t> get_supported_isa(bool is_fwd) {
     if (is_fwd)
         return {avx512_core_fp16, avx512_core_bf16, avx512_core, avx2_vnni_2,
@@ -1655,14 +2066,95 @@ jit_uni_softmax_fwd_t::jit_uni_softmax_fwd_t(const pd_t *apd)
     : primitive_t(apd) {}
 
 status_t jit_uni_softmax_fwd_t::init(engine_t *engine) {
-    CHECK(safe_ptr_assign(ker_,
-            softmax_impl::jit_softmax_kernel_base_t::create(
-                    pd(), pd()->isa_, pd()->axis_is_plain_and_strided_)));
+    if (pd()->use_online_) {
+        CHECK(safe_ptr_assign(ker_,
+                softmax_impl::jit_softmax_kernel_base_t::create_online(
+                        pd(), pd()->isa_, false)));
+        CHECK(safe_ptr_assign(ker_online_write_,
+                softmax_impl::jit_softmax_kernel_base_t::create_online(
+                        pd(), pd()->isa_, true)));
+        if (ker_online_write_) CHECK(ker_online_write_->create_kernel());
+    } else {
+        CHECK(safe_ptr_assign(ker_,
+                softmax_impl::jit_softmax_kernel_base_t::create(
+                        pd(), pd()->isa_, pd()->axis_is_plain_and_strided_)));
+    }
     if (ker_) CHECK(ker_->create_kernel());
     return status::success;
 }
 
+// A row is processed in `n_chunks` chunks by different threads. The first pass
+// collects a maximum and a sum of exponents per chunk, the second pass merges
+// statistics of all chunks of a row and writes the destination.
+status_t jit_uni_softmax_fwd_t::execute_online(const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+    auto stats = ctx.get_scratchpad_grantor().template get<float>(
+            memory_tracking::names::key_softmax_reduction);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const auto src_data_type_size = src_d.data_type_size();
+    const auto dst_data_type_size = dst_d.data_type_size();
+
+    const dim_t axis_size = pd()->axis_size();
+    const dim_t outer_size = src_d.nelems() / axis_size;
+    const dim_t n_chunks = pd()->online_n_chunks_;
+    const dim_t chunk_size = pd()->online_chunk_size_;
+    const bool is_softmax = pd()->is_softmax();
+    const bool inf_as_zero
+            = pd()->alg_kind() == alg_kind::softmax_accurate_inf_as_zero;
+
+    VDEBUGINFO(1, primitive, softmax,
+            "%s,src=%p dst=%p outer_size=%" PRId64 " n_chunks=%" PRId64
+            " chunk_size=%" PRId64,
+            pd()->impl_name(), src, dst, outer_size, n_chunks, chunk_size);
+
+    const auto chunk_params = [&](dim_t ou, dim_t ch) {
+        const dim_t offset = ou * axis_size + ch * chunk_size;
+        softmax_impl::jit_softmax_kernel_base_t::call_params_t p;
+        p.src = src + offset * src_data_type_size;
+        p.dst = dst + offset * dst_data_type_size;
+        p.process_n_elems = nstl::min(chunk_size, axis_size - ch * chunk_size);
+        p.online_stats = stats + 2 * (ou * n_chunks + ch);
+        return p;
+    };
+
+    parallel_nd(outer_size, n_chunks, [&](dim_t ou, dim_t ch) {
+        auto p = chunk_params(ou, ch);
+        (*ker_)(&p);
+    });
+
+    parallel_nd(outer_size, n_chunks, [&](dim_t ou, dim_t ch) {
+        const float *row_stats = stats + 2 * ou * n_chunks;
+        float max = row_stats[0];
+        for (dim_t c = 1; c < n_chunks; c++)
+            max = nstl::max(max, row_stats[2 * c]);
+        float sum = 0.f;
+        for (dim_t c = 0; c < n_chunks; c++)
+            sum += row_stats[2 * c + 1] * expf(row_stats[2 * c] - max);
+
+        // Every chunk keeps its own copy of the row statistics so that chunks
+        // of a row are written without synchronization.
+        float chunk_stats[2] = {max, 0.f};
+        if (!is_softmax)
+            chunk_stats[1] = max + logf(sum);
+        else if (inf_as_zero && sum == 0.f)
+            chunk_stats[1] = 0.f;
+        else
+            chunk_stats[1] = 1.f / sum;
+
+        auto p = chunk_params(ou, ch);
+        p.online_stats = chunk_stats;
+        (*ker_online_write_)(&p);
+    });
+
+    return status::success;
+}
+
 status_t jit_uni_softmax_fwd_t::execute(const exec_ctx_t &ctx) const {
+    if (pd()->use_online_) return execute_online(ctx);
+
     const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
     auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
     auto scratchpad_ptr = ctx.get_scratchpad_grantor().template get<char>(
@@ -1723,6 +2215,19 @@ status_t jit_uni_softmax_fwd_t::execute(const exec_ctx_t &ctx) const {
     const int nthr = pd()->nthr_;
     const char *dst_orig_ptr = dst;
 
+    // Attention scores preprocessing implies a plain src with the last axis
+    // normalized, so `ou` enumerates rows of the scores matrix.
+    const float attn_scale = pd()->with_scale()
+            ? CTX_IN_MEM(const float *, DNNL_ARG_SCALE)[0]
+            : 1.f;
+    const auto attn_mask = CTX_IN_MEM(const char *, DNNL_ARG_ATTN_MASK);
+    const memory_desc_wrapper mask_d(pd()->arg_md(DNNL_ARG_ATTN_MASK));
+    const int ndims = pd()->ndims();
+    const dim_t *dims = dst_d.dims();
+    const dim_t diag_off = pd()->mask_type() == attn_mask_type::bottom_right
+            ? dims[ndims - 1] - dims[ndims - 2]
+            : 0;
+
     VDEBUGINFO(1, primitive, softmax,
             "%s,src=%p dst=%p outer_size=%" PRId64 " outer_stride=%" PRId64
             " inner_size=%" PRId64 " inner_stride=%" PRId64
@@ -1758,6 +2263,26 @@ status_t jit_uni_softmax_fwd_t::execute(const exec_ctx_t &ctx) const {
                 p.dst_orig = dst_orig_ptr;
                 p.post_ops_binary_rhs_arg_vec
                         = post_ops_binary_rhs_arg_vec.data();
+                p.attn_scale = attn_scale;
+                p.attn_mask = nullptr;
+                p.attn_mask_n_valid_bytes = 0;
+                if (pd()->mask_type() != attn_mask_type::undef) {
+                    dims_t pos;
+                    utils::l_dims_by_l_offset(pos, ou * pd()->axis_size(),
+                            dims, ndims);
+                    if (pd()->with_mask_buffer()) {
+                        for (int d = 0; d < ndims; d++)
+                            if (mask_d.dims()[d] == 1) pos[d] = 0;
+                        p.attn_mask = attn_mask
+                                + mask_d.off_v(pos) * mask_d.data_type_size();
+                    } else {
+                        const dim_t n_valid = nstl::max<dim_t>(0,
+                                nstl::min<dim_t>(pd()->axis_size(),
+                                        pos[ndims - 2] + 1 + diag_off));
+                        p.attn_mask_n_valid_bytes
+                                = n_valid * src_data_type_size;
+                    }
+                }
                 (*ker_)(&p);
             });
 
@@ -26,6 +26,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/cpu_softmax_pd.hpp"
+#include "cpu/platform.hpp"
 
 #include "cpu/x64/cpu_isa_traits.hpp"
 #include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
@@ -42,6 +43,9 @@ namespace softmax_impl {
 struct jit_softmax_kernel_base_t {
     static jit_softmax_kernel_base_t *create(const softmax_pd_t *pd,
             const cpu_isa_t isa, bool axis_is_plain_and_strided);
+    // Kernels of a two-pass online softmax over chunks of a long plain row.
+    static jit_softmax_kernel_base_t *create_online(
+            const softmax_pd_t *pd, const cpu_isa_t isa, bool is_write_pass);
 
     virtual ~jit_softmax_kernel_base_t() = default;
 
@@ -56,6 +60,15 @@ struct jit_softmax_kernel_base_t {
         // post ops
         const void *dst_orig;
         const void *post_ops_binary_rhs_arg_vec;
+
+        // attention scores preprocessing
+        const void *attn_mask; // mask row matching the processed src row
+        size_t attn_mask_n_valid_bytes; // causal mask: src bytes left unmasked
+        float attn_scale;
+
+        // online softmax: {max, sum} of a chunk in the stats pass,
+        // {max, 1 / sum} (or {max, max + log(sum)}) in the write pass
+        void *online_stats;
     };
 
     virtual void operator()(const call_params_t *p) const = 0;
@@ -154,10 +167,16 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
                                                     f16, src_dt, dst_dt)),
                             memory_desc_wrapper(src_md()).is_plain()),
                     "avx2_vnni_2 only supports xf16 on plain layout");
+            VDISPATCH_SOFTMAX(IMPLICATION(with_attn_preprocessing(),
+                                      attn_preprocessing_ok()),
+                    VERBOSE_UNSUPPORTED_FEATURE,
+                    "attention scores preprocessing");
 
             const memory_desc_wrapper dst_d(dst_md());
             axis_is_plain_and_strided_ = dst_d.is_plain() && axis_stride() > 1;
             nthr_ = dnnl_get_max_threads();
+            use_online_ = online_softmax_ok();
+            if (use_online_) init_online_blocking();
             init_scratchpad();
 
             return status::success;
@@ -167,9 +186,24 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
         size_t scratch_size_per_thr_ = 0;
         cpu_isa_t isa_ = isa_undef;
         bool axis_is_plain_and_strided_ = false;
+        // Rows which do not fit L2 are split in chunks processed by different
+        // threads in two passes, reading src twice instead of three times.
+        bool use_online_ = false;
+        dim_t online_n_chunks_ = 1;
+        dim_t online_chunk_size_ = 0;
 
     private:
         void init_scratchpad() {
+            if (use_online_) {
+                const dim_t outer_size
+                        = memory_desc_wrapper(src_md()).nelems() / axis_size();
+                auto scratchpad = scratchpad_registry().registrar();
+                scratchpad.template book<float>(
+                        memory_tracking::names::key_softmax_reduction,
+                        2 * outer_size * online_n_chunks_);
+                return;
+            }
+
             const auto src_dt = src_md()->data_type;
             const auto dst_dt = dst_md()->data_type;
             // Relaxed accumulation allows to downconvert intermediate results
@@ -235,6 +269,72 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
                     && bin_po_ok;
         }
 
+        // Scale and mask are applied by the dense kernel only, over a plain
+        // row of scores with a row of a mask in the same data type.
+        bool attn_preprocessing_ok() const {
+            const auto src_dt = src_md()->data_type;
+            const auto dst_dt = dst_md()->data_type;
+            const bool is_avx2_ne_xf16 = is_superset(isa_, avx2_vnni_2)
+                    && !is_superset(isa_, avx512_core)
+                    && (utils::one_of(data_type::bf16, src_dt, dst_dt)
+                            || utils::one_of(data_type::f16, src_dt, dst_dt));
+            if (!is_superset(isa_, avx2) || is_avx2_ne_xf16) return false;
+            if (!memory_desc_wrapper(src_md()).is_plain()
+                    || axis() != ndims() - 1 || axis_stride() != 1)
+                return false;
+            if (!with_mask_buffer()) return true;
+
+            const memory_desc_wrapper mask_d(arg_md(DNNL_ARG_ATTN_MASK));
+            const int last = ndims() - 1;
+            return mask_d.data_type() == src_dt && mask_d.is_plain()
+                    && mask_d.dims()[last] == axis_size()
+                    && mask_d.blocking_desc().strides[last] == 1;
+        }
+
+        bool online_softmax_ok() const {
+            const auto src_dt = src_md()->data_type;
+            const auto dst_dt = dst_md()->data_type;
+            const bool is_avx2_ne_xf16 = is_superset(isa_, avx2_vnni_2)
+                    && !is_superset(isa_, avx512_core)
+                    && (utils::one_of(data_type::bf16, src_dt, dst_dt)
+                            || utils::one_of(data_type::f16, src_dt, dst_dt));
+            if (!is_superset(isa_, avx2) || is_avx2_ne_xf16
+                    || axis_is_plain_and_strided_)
+                return false;
+            if (!utils::one_of(src_dt, data_type::f32, data_type::bf16,
+                        data_type::f16)
+                    || !utils::one_of(dst_dt, data_type::f32, data_type::bf16,
+                            data_type::f16))
+                return false;
+            if (!memory_desc_wrapper(src_md()).is_plain()
+                    || axis() != ndims() - 1 || axis_stride() != 1)
+                return false;
+            if (!attr()->has_default_values() || with_attn_preprocessing())
+                return false;
+            const size_t row_bytes = axis_size()
+                    * (types::data_type_size(src_dt)
+                            + types::data_type_size(dst_dt));
+            return row_bytes > platform::get_per_core_cache_size(2);
+        }
+
+        // Rows are split only when there are not enough of them to occupy
+        // all threads. A chunk is a multiple of 4 vectors of the widest isa
+        // to keep the tail in the last chunk of a row.
+        void init_online_blocking() {
+            const dim_t outer_size
+                    = memory_desc_wrapper(src_md()).nelems() / axis_size();
+            static constexpr dim_t min_chunk_size = 4096;
+            static constexpr dim_t chunk_align = 64;
+            dim_t n_chunks = outer_size >= nthr_
+                    ? 1
+                    : utils::div_up(static_cast<dim_t>(nthr_), outer_size);
+            n_chunks = nstl::min(
+                    n_chunks, utils::div_up(axis_size(), min_chunk_size));
+            online_chunk_size_ = utils::rnd_up(
+                    utils::div_up(axis_size(), n_chunks), chunk_align);
+            online_n_chunks_ = utils::div_up(axis_size(), online_chunk_size_);
+        }
+
         bool is_dense(const cpu_isa_t isa) const {
             const memory_desc_wrapper src_d(src_md());
             const auto &bd = src_d.blocking_desc();
@@ -264,7 +364,10 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
 
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    status_t execute_online(const exec_ctx_t &ctx) const;
+
     std::unique_ptr<softmax_impl::jit_softmax_kernel_base_t> ker_;
+    std::unique_ptr<softmax_impl::jit_softmax_kernel_base_t> ker_online_write_;
 };
 
 struct jit_uni_softmax_bwd_t : public primitive_t {
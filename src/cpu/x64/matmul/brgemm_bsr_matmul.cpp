@@ -0,0 +1,325 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/amx_tile_configure.hpp"
+#include "cpu/x64/matmul/brgemm_bsr_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::memory_tracking::names;
+
+status_t brgemm_bsr_matmul_t::pd_t::init(engine_t *engine) {
+    const auto src_dt = src_md()->data_type;
+    const auto wei_dt = weights_md()->data_type;
+    const auto dst_dt = dst_md()->data_type;
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper wei_d(weights_md());
+    const memory_desc_wrapper dst_d(dst_md());
+
+    VDISPATCH_MATMUL(wei_d.is_sparse_desc()
+                    && wei_d.encoding() == sparse_encoding::bsr,
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(!src_d.is_sparse_desc() && !dst_d.is_sparse_desc(),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(
+            everyone_is(s32, wei_d.metadata_type(0), wei_d.metadata_type(1)),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(everyone_is(f32, src_dt, wei_dt, dst_dt)
+                    || (everyone_is(bf16, src_dt, wei_dt)
+                            && one_of(dst_dt, f32, bf16)),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_MATMUL(ndims() == 2, VERBOSE_BAD_NDIMS, "dst", ndims());
+    VDISPATCH_MATMUL(!has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_MATMUL(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_MATMUL(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL(src_d.matches_one_of_tag(format_tag::ab)
+                    && dst_d.matches_one_of_tag(format_tag::ab),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    CHECK(init_conf(engine));
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    return status::success;
+}
+
+status_t brgemm_bsr_matmul_t::pd_t::init_conf(engine_t *engine) {
+    auto &conf = conf_;
+    const memory_desc_wrapper wei_d(weights_md());
+
+    conf.src_dt = src_md()->data_type;
+    conf.dst_dt = dst_md()->data_type;
+    if (conf.src_dt == bf16) {
+        conf.isa = mayiuse(avx512_core_amx) ? avx512_core_amx
+                : mayiuse(avx512_core_bf16) ? avx512_core_bf16
+                                            : isa_undef;
+    } else {
+        conf.isa = mayiuse(avx512_core) ? avx512_core
+                : mayiuse(avx2)         ? avx2
+                                        : isa_undef;
+    }
+    VDISPATCH_MATMUL(conf.isa != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+    conf.is_amx = is_superset(conf.isa, avx512_core_amx);
+
+    conf.M = M();
+    conf.N = N();
+    conf.K = K();
+    conf.blk_k = wei_d.block_dims()[0];
+    conf.blk_n = wei_d.block_dims()[1];
+    conf.nb_k = conf.K / conf.blk_k;
+    conf.nb_n = conf.N / conf.blk_n;
+
+    // Blocks are repacked to VNNI pairs along K for bf16.
+    VDISPATCH_MATMUL(IMPLICATION(conf.src_dt == bf16, conf.blk_k % 2 == 0),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    // Two rows of tiles with AMX, otherwise enough rows to hide the latency
+    // of loading the weights block.
+    const dim_t default_M_blk = conf.is_amx ? 32 : 64;
+    conf.M_blk = nstl::min(conf.M, default_M_blk);
+    conf.M_tail = conf.M % conf.M_blk;
+    conf.nb_m = div_up(conf.M, conf.M_blk);
+    conf.use_buffer = conf.dst_dt != f32;
+
+    conf.nthr = dnnl_get_max_threads();
+
+    return status::success;
+}
+
+status_t brgemm_bsr_matmul_t::pd_t::init_brgemm_descs() {
+    auto &conf = conf_;
+
+    brg_descs_.resize(2);
+    for (bool m_tail : {false, true}) {
+        const dim_t M = m_tail ? conf.M_tail : conf.M_blk;
+        if (M == 0) continue;
+
+        // C[M x blk_n] = sum over stored blocks of A[M x blk_k] * B_blk.
+        const dim_t LDC = conf.use_buffer ? conf.blk_n : conf.N;
+        auto &brg = brg_descs_[brg_idx(m_tail)];
+        CHECK(brgemm_desc_init(&brg, conf.isa, brgemm_addr, conf.src_dt,
+                conf.src_dt, false, false, brgemm_row_major, 1.f, 0.f, conf.K,
+                conf.blk_n, LDC, M, conf.blk_n, conf.blk_k));
+
+        brgemm_attr_t brg_attr;
+        brg_attr.max_bs = static_cast<int>(conf.nb_k);
+        CHECK(brgemm_desc_set_attr(&brg, brg_attr));
+        CHECK(brgemm_desc_finalize(&brg));
+
+        conf.wsp_tile_per_thr_bytes = nstl::max(
+                brg.get_wsp_buffer_size(), conf.wsp_tile_per_thr_bytes);
+    }
+
+    return status::success;
+}
+
+void brgemm_bsr_matmul_t::pd_t::init_scratchpad() {
+    const auto &conf = conf_;
+    const memory_desc_wrapper wei_d(weights_md());
+    const dim_t nnz = wei_d.nnz();
+
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book<int32_t>(key_matmul_sparse_tmp_ptr, conf.nb_n + 1);
+    // Block row index and block index of every stored block, grouped by
+    // block columns.
+    scratchpad.book<int32_t>(key_matmul_sparse_col_blocks, 2 * nnz);
+    if (conf.src_dt == bf16)
+        scratchpad.book<bfloat16_t>(
+                key_matmul_sparse_wei_vnni, nnz * conf.blk_k * conf.blk_n);
+    scratchpad.book<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch, conf.nthr * conf.nb_k);
+    if (conf.use_buffer)
+        scratchpad.book<float>(key_brgemm_primitive_buffer,
+                conf.nthr * conf.M_blk * conf.blk_n);
+    if (conf.is_amx)
+        scratchpad.book<char>(key_conv_amx_tile_buffer,
+                static_cast<size_t>(conf.nthr) * conf.wsp_tile_per_thr_bytes);
+}
+
+status_t brgemm_bsr_matmul_t::init(engine_t *engine) {
+    const auto &descs = pd()->brg_descs_;
+    brg_kernels_.resize(descs.size());
+    brgemm_palettes_.resize(descs.size());
+
+    for (size_t idx = 0; idx < descs.size(); ++idx) {
+        const auto &brg = descs[idx];
+        if (brg.bcast_dim * brg.load_dim == 0) continue;
+        brgemm_kernel_t *brg_kernel = nullptr;
+        CHECK(brgemm_kernel_create(&brg_kernel, brg));
+        CHECK(safe_ptr_assign(brg_kernels_[idx], brg_kernel));
+        if (pd()->conf_.is_amx && !brgemm_palettes_.insert(idx, brg))
+            return status::runtime_error;
+    }
+
+    return status::success;
+}
+
+status_t brgemm_bsr_matmul_t::execute(const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    const auto wei_values = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS, 0);
+    const auto wei_indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 1);
+    const auto wei_pointers = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 2);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const auto &conf = pd()->conf_;
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    const memory_desc_wrapper wei_d(pd()->weights_md());
+
+    const dim_t K = conf.K, N = conf.N;
+    const dim_t blk_k = conf.blk_k, blk_n = conf.blk_n;
+    const dim_t blk_sz = blk_k * blk_n;
+    const size_t src_dsz = types::data_type_size(conf.src_dt);
+    const size_t dst_dsz = types::data_type_size(conf.dst_dt);
+    const dim_t nnz = wei_pointers[conf.nb_k];
+
+    // Gather the stored blocks by block columns. Blocks of a column stay
+    // sorted by block rows.
+    int32_t *col_ptr = scratchpad.template get<int32_t>(
+            key_matmul_sparse_tmp_ptr);
+    int32_t *col_rows = scratchpad.template get<int32_t>(
+            key_matmul_sparse_col_blocks);
+    int32_t *col_blks = col_rows + wei_d.nnz();
+
+    std::fill(col_ptr, col_ptr + conf.nb_n + 1, 0);
+    for (dim_t p = 0; p < nnz; p++)
+        col_ptr[wei_indices[p] + 1]++;
+    for (dim_t nb = 0; nb < conf.nb_n; nb++)
+        col_ptr[nb + 1] += col_ptr[nb];
+    for (dim_t kb = 0; kb < conf.nb_k; kb++) {
+        for (int32_t p = wei_pointers[kb]; p < wei_pointers[kb + 1]; p++) {
+            const int32_t pos = col_ptr[wei_indices[p]]++;
+            col_rows[pos] = static_cast<int32_t>(kb);
+            col_blks[pos] = p;
+        }
+    }
+    // Shift the pointers back after using them as insertion positions.
+    for (dim_t nb = conf.nb_n; nb > 0; nb--)
+        col_ptr[nb] = col_ptr[nb - 1];
+    col_ptr[0] = 0;
+
+    // bf16 kernels expect pairs of rows interleaved in every block.
+    const char *wei_blocks = wei_values;
+    if (conf.src_dt == bf16) {
+        const auto *wei_bf16 = reinterpret_cast<const bfloat16_t *>(wei_values);
+        bfloat16_t *wei_vnni = scratchpad.template get<bfloat16_t>(
+                key_matmul_sparse_wei_vnni);
+        parallel_nd(nnz, [&](dim_t p) {
+            const bfloat16_t *blk_src = wei_bf16 + p * blk_sz;
+            bfloat16_t *blk_dst = wei_vnni + p * blk_sz;
+            for_(dim_t k = 0; k < blk_k; k++)
+            for (dim_t n = 0; n < blk_n; n++)
+                blk_dst[(k / 2) * 2 * blk_n + 2 * n + k % 2]
+                        = blk_src[k * blk_n + n];
+        });
+        wei_blocks = reinterpret_cast<const char *>(wei_vnni);
+    }
+
+    auto batch_base = scratchpad.template get<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch);
+    auto acc_base = scratchpad.template get<float>(key_brgemm_primitive_buffer);
+    auto wsp_tile_base = conf.is_amx
+            ? scratchpad.template get<char>(key_conv_amx_tile_buffer)
+            : nullptr;
+
+    // Consecutive work items share the block column to reuse its blocks.
+    const dim_t work_amount = conf.nb_n * conf.nb_m;
+
+    parallel(conf.nthr, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        brgemm_batch_element_t *batch = batch_base + ithr * conf.nb_k;
+        float *acc = conf.use_buffer
+                ? acc_base + ithr * conf.M_blk * conf.blk_n
+                : nullptr;
+        char *wsp_tile = conf.is_amx
+                ? wsp_tile_base + ithr * conf.wsp_tile_per_thr_bytes
+                : nullptr;
+        int prev_ker_idx = -1;
+
+        dim_t nb {0}, mb {0};
+        nd_iterator_init(start, nb, conf.nb_n, mb, conf.nb_m);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            const dim_t m_start = mb * conf.M_blk;
+            const dim_t m_len = nstl::min(conf.M_blk, conf.M - m_start);
+            char *dst_blk = dst + dst_dsz * (m_start * N + nb * blk_n);
+
+            const int32_t bs = col_ptr[nb + 1] - col_ptr[nb];
+            if (bs == 0) {
+                // The whole block column is zero.
+                for (dim_t m = 0; m < m_len; m++)
+                    std::memset(dst_blk + dst_dsz * m * N, 0, dst_dsz * blk_n);
+                nd_iterator_step(nb, conf.nb_n, mb, conf.nb_m);
+                continue;
+            }
+
+            for (int32_t i = 0; i < bs; i++) {
+                const int32_t e = col_ptr[nb] + i;
+                batch[i].ptr.A
+                        = src + src_dsz * (m_start * K + col_rows[e] * blk_k);
+                batch[i].ptr.B = wei_blocks + src_dsz * col_blks[e] * blk_sz;
+            }
+
+            const int ker_idx = pd_t::brg_idx(m_len < conf.M_blk);
+            brgemm_palettes_.maybe_tile_configure(
+                    conf.is_amx, prev_ker_idx, ker_idx);
+            brgemm_kernel_execute(brg_kernels_[ker_idx].get(), bs, batch,
+                    conf.use_buffer ? (void *)acc : (void *)dst_blk, wsp_tile);
+
+            if (conf.use_buffer) {
+                for (dim_t m = 0; m < m_len; m++)
+                    cvt_float_to_bfloat16(
+                            reinterpret_cast<bfloat16_t *>(
+                                    dst_blk + dst_dsz * m * N),
+                            acc + m * blk_n, blk_n);
+            }
+
+            nd_iterator_step(nb, conf.nb_n, mb, conf.nb_m);
+        }
+
+        if (conf.is_amx) amx_tile_release();
+    });
+
+    return status::success;
+}
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
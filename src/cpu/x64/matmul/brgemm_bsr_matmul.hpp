@@ -0,0 +1,103 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_BRGEMM_BSR_MATMUL_HPP
+#define CPU_X64_MATMUL_BRGEMM_BSR_MATMUL_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/brgemm/brgemm_containers.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+// Matmul with dense source and BSR encoded weights. The destination is
+// computed one block column at a time: all stored blocks of a block column
+// form a single brgemm batch, so zero blocks are skipped and the accumulation
+// over K stays in registers (or AMX tiles). Block columns are gathered from
+// the block row pointers at execution time. With bf16 the blocks are also
+// repacked to the VNNI layout expected by the kernels.
+struct brgemm_bsr_matmul_conf_t {
+    cpu_isa_t isa;
+    bool is_amx;
+
+    data_type_t src_dt, dst_dt;
+    dim_t M, N, K;
+    dim_t blk_k, blk_n; // BSR block dimensions
+    dim_t nb_k, nb_n; // number of block rows and block columns
+
+    dim_t M_blk, M_tail, nb_m;
+    // With a non-f32 destination the kernels accumulate into a per-thread
+    // f32 buffer that is converted afterwards.
+    bool use_buffer;
+
+    int wsp_tile_per_thr_bytes;
+    int nthr;
+};
+
+struct brgemm_bsr_matmul_t : public primitive_t {
+    struct pd_t : public dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg_bsr:", conf_.isa, ""),
+                brgemm_bsr_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        static int brg_idx(bool m_tail) { return m_tail; }
+
+        brgemm_bsr_matmul_conf_t conf_ = utils::zero<decltype(conf_)>();
+        std::vector<brgemm_desc_t> brg_descs_;
+
+    private:
+        status_t init_conf(engine_t *engine);
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+    };
+
+    brgemm_bsr_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::vector<std::unique_ptr<brgemm_kernel_t>> brg_kernels_;
+    brgemm_containers::brgemm_palette_container_t brgemm_palettes_;
+};
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -17,12 +17,16 @@
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/memory_tracking.hpp"
+#include "common/primitive_desc_iterator.hpp"
+#include "common/scratchpad_debug.hpp"
+#include "common/stream.hpp"
 #include "common/tag_traits.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
 #include "cpu/cpu_primitive.hpp"
 #include "cpu/matmul/matmul_utils.hpp"
+#include "cpu/ref_io_helper.hpp"
 #include "cpu/scale_utils.hpp"
 
 #include "cpu/x64/amx_tile_configure.hpp"
@@ -130,6 +134,8 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
             && one_of(wei_dt, s8, u8, s4, u4) && one_of(dst_dt, bf16, f32);
     const bool is_f16_with_int_wei = src_dt == f16
             && one_of(wei_dt, s8, u8, s4, u4) && one_of(dst_dt, f16, f32);
+    const bool is_f32_with_int_wei
+            = src_dt == f32 && one_of(wei_dt, s8, u8, s4, u4) && dst_dt == f32;
 
     auto check_bias = [&]() -> bool {
         const auto bia_dt = weights_md(1)->data_type;
@@ -178,6 +184,12 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
             ok = ok && one_of(asc.get_data_type(DNNL_ARG_SRC), undef, f32);
             ok = ok && one_of(asc.get_data_type(DNNL_ARG_WEIGHTS), undef, f32);
             ok = ok && one_of(asc.get_data_type(DNNL_ARG_DST), undef, f32);
+        } else {
+            // Weights scales are converted to f32 by the scales precompute
+            // routine, e8m0 covers block-scaled (MX) weights.
+            ok = ok
+                    && one_of(asc.get_data_type(DNNL_ARG_WEIGHTS), undef, f32,
+                            bf16, f16, e8m0);
         }
         // This impl doesn't support scales over any batch dimensions.
         if (!asc.has_default_values(DNNL_ARG_WEIGHTS)) {
@@ -219,7 +231,8 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     };
     const bool problem_dt_correct
             = one_of(true, is_int8, is_f8, is_bf16, is_f32, is_f16, is_f32_f16,
-                    is_f32_bf16, is_bf16_with_int_wei, is_f16_with_int_wei);
+                    is_f32_bf16, is_bf16_with_int_wei, is_f16_with_int_wei,
+                    is_f32_with_int_wei);
 
     auto src_d = memory_desc_wrapper(src_md_);
     auto weights_d = memory_desc_wrapper(weights_md_);
@@ -236,6 +249,19 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     VDISPATCH_MATMUL(is_sparse_ok, VERBOSE_UNSUPPORTED_SPARSE_CFG);
     VDISPATCH_MATMUL(problem_dt_correct, VERBOSE_UNSUPPORTED_DT_CFG);
     VDISPATCH_MATMUL(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+
+    // Runtime M or N are handled by the tail kernels of 2D AMX int8 and bf16
+    // problems only, a primitive per shape is created for the rest.
+    const bool has_runtime_dims = src_d.has_runtime_dims()
+            || weights_d.has_runtime_dims() || dst_d.has_runtime_dims();
+    const bool is_runtime_M = is_runtime_value(M());
+    const bool is_runtime_N = is_runtime_value(N());
+    const bool runtime_dims_native = is_superset(isa, avx512_core_amx)
+            && ndims() == 2 && one_of(true, is_int8, is_bf16)
+            && !is_runtime_value(K()) && !(is_runtime_M && is_runtime_N);
+    if (has_runtime_dims && !runtime_dims_native)
+        return init_shape_dispatch(engine);
+
     VDISPATCH_MATMUL(
             attr()->has_default_values(
                     primitive_attr_t::skip_mask_t::scales_data_type
@@ -244,9 +270,18 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
                                     zero_points_data_type
                             | primitive_attr_t::skip_mask_t::post_ops
                             | primitive_attr_t::skip_mask_t::sum_dt
-                            | primitive_attr_t::skip_mask_t::fpmath_mode,
+                            | primitive_attr_t::skip_mask_t::fpmath_mode
+                            | primitive_attr_t::skip_mask_t::accumulation_mode
+                            | primitive_attr_t::skip_mask_t::dst_amax
+                            | primitive_attr_t::skip_mask_t::secondary_dst,
                     dst_dt),
             VERBOSE_UNSUPPORTED_ATTR);
+    // f16 accumulation is native on avx512_core_fp16 only, other ISAs keep
+    // the sums in f32 which is at least as accurate.
+    VDISPATCH_MATMUL(one_of(attr()->acc_mode_, accumulation_mode::strict,
+                             accumulation_mode::relaxed, accumulation_mode::any)
+                    || (attr()->acc_mode_ == accumulation_mode::f16 && is_f16),
+            VERBOSE_UNSUPPORTED_ATTR);
     const auto &po = attr()->post_ops_;
 
     VDISPATCH_MATMUL(po.check_sum_consistency(dst_dt, is_int8),
@@ -266,9 +301,24 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     CHECK(init_brgemm_matmul_conf(isa, bgmmc_, *desc(), src_md_, weights_md_,
             dst_md_, bias_md_, attr_));
 
-    // f32:f16 configuration on AVX2 doesn't support tails with proper
-    // instruction sequence in copy routines. Anchor: F32_F16_AVX2_NO_TAIL.
-    VDISPATCH_MATMUL(IMPLICATION((is_f32_f16 || is_f32_bf16) && isa == avx2,
+    // The destination absolute maximum is computed over the blocks a thread
+    // has written, overlapping tail kernels of runtime dimensions would
+    // require the blocks to be restored first.
+    VDISPATCH_MATMUL(IMPLICATION(bgmmc_.with_dst_amax,
+                             !bgmmc_.is_runtime_M && !bgmmc_.is_runtime_N),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    // Same applies to the secondary destination.
+    VDISPATCH_MATMUL(IMPLICATION(bgmmc_.with_secondary_dst,
+                             !bgmmc_.is_runtime_M && !bgmmc_.is_runtime_N),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    init_secondary_dst_md();
+
+    // f32:f16 and f32:int configurations on AVX2 don't support tails with
+    // proper instruction sequence in copy routines.
+    // Anchor: F32_F16_AVX2_NO_TAIL.
+    VDISPATCH_MATMUL(IMPLICATION((is_f32_f16 || is_f32_bf16
+                                         || bgmmc_.is_f32_with_int_wei)
+                                     && isa == avx2,
                              bgmmc_.N % 8 == 0),
             "unsupported configuration");
 
@@ -339,7 +389,10 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
         brgemm_attr_t brgattr;
         brgattr.generate_skip_accumulation
                 = bgmmc_.post_ops_applicable && bgmmc_.nthr_k > 1;
+        // Skip accumulation generates a second copy of the stores.
+        brgattr.share_post_ops = brgattr.generate_skip_accumulation;
         brgattr.mem_advice = bgmmc_.mem_advice;
+        brgattr.acc_mode = attr()->acc_mode_;
         if (is_superset(kernel_isa, avx512_core_amx)) {
             brgattr.use_uker = true;
             brgattr.use_interleave_stores = true;
@@ -382,8 +435,111 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     return status::success;
 }
 
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::pd_t::init_shape_dispatch(engine_t *engine) {
+    VDISPATCH_MATMUL(is_dense_format_kind(), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(!with_reduce(), VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    // The scratchpad of a nested primitive depends on the shape, so it can't
+    // be booked at creation to be passed by the user.
+    VDISPATCH_MATMUL(attr()->scratchpad_mode_ == scratchpad_mode::library,
+            VERBOSE_UNSUPPORTED_ATTR);
+    // Memory formats can't be picked without the dimensions.
+    VDISPATCH_MATMUL(!one_of(format_kind::any, src_md_.format_kind,
+                             weights_md_.format_kind, dst_md_.format_kind)
+                    && IMPLICATION(with_bias(),
+                            bias_md_.format_kind != format_kind::any),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    // Check the configuration with representative dimensions, so the
+    // problems the implementation can't handle for any shape still dispatch
+    // to other implementations.
+    const dim_t probe_dim = 256;
+    auto init_probe_md = [&](memory_desc_t &probe_md,
+                                 const memory_desc_t &md) -> status_t {
+        dims_t dims;
+        for (int d = 0; d < md.ndims; d++)
+            dims[d] = is_runtime_value(md.dims[d]) ? probe_dim : md.dims[d];
+        return memory_desc_init_by_strides(
+                probe_md, md.ndims, dims, md.data_type, nullptr);
+    };
+    memory_desc_t probe_src_md, probe_wei_md, probe_dst_md;
+    memory_desc_t probe_bia_md = glob_zero_md;
+    CHECK(init_probe_md(probe_src_md, src_md_));
+    CHECK(init_probe_md(probe_wei_md, weights_md_));
+    CHECK(init_probe_md(probe_dst_md, dst_md_));
+    if (with_bias()) CHECK(init_probe_md(probe_bia_md, bias_md_));
+
+    std::shared_ptr<primitive_desc_t> probe_pd;
+    VDISPATCH_MATMUL_SC(create_shape_pd(probe_pd, engine, &probe_src_md,
+                                &probe_wei_md, &probe_dst_md, &probe_bia_md,
+                                /* allow_fallback = */ false),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    use_shape_dispatch_ = true;
+    init_secondary_dst_md();
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::pd_t::create_shape_pd(
+        std::shared_ptr<primitive_desc_t> &shape_pd, engine_t *engine,
+        const memory_desc_t *src_md, const memory_desc_t *wei_md,
+        const memory_desc_t *dst_md, const memory_desc_t *bia_md,
+        bool allow_fallback) const {
+    matmul_desc_t shape_desc;
+    CHECK(matmul_desc_init(&shape_desc, src_md, wei_md, bia_md, dst_md));
+
+    // The scratchpad size depends on the shape, so the nested primitive
+    // scratchpad is allocated at execution.
+    primitive_attr_t shape_attr(*attr());
+    CHECK(shape_attr.set_scratchpad_mode(scratchpad_mode::library));
+
+    primitive_desc_t *brg_pd = nullptr;
+    if (primitive_desc_t::create<pd_t>(&brg_pd, (op_desc_t *)&shape_desc,
+                &shape_attr, engine, nullptr)
+            == status::success) {
+        shape_pd.reset(brg_pd);
+        return status::success;
+    }
+    if (!allow_fallback) return status::unimplemented;
+
+    primitive_desc_iterator_t it(
+            engine, (op_desc_t *)&shape_desc, &shape_attr, nullptr);
+    if (!it.is_initialized()) return status::out_of_memory;
+    shape_pd = *(++it);
+    return shape_pd ? status::success : status::unimplemented;
+}
+
+template <cpu_isa_t isa>
+std::vector<int> brgemm_matmul_t<isa>::get_brg_kernel_idxs() const {
+    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const int max_m_ker_idx
+            = bgmmc.is_runtime_M ? max_num_dynamic_m_tails + 1 : 2;
+    const int max_n_ker_idx
+            = bgmmc.is_runtime_N ? max_num_dynamic_n_tails + 1 : 2;
+
+    const int i_bs_end = bgmmc.brgemm_batch_tail_size ? 2 : 1;
+    const int i_init_start = bgmmc.K_blk != bgmmc.K ? 0 : 1;
+    const int i_K_end = bgmmc.K_tail ? 2 : 1;
+
+    std::vector<int> brg_idxs;
+    for_(int i_bs = 0; i_bs < i_bs_end; i_bs++)
+    for_(int i_M = 0; i_M < max_m_ker_idx; i_M++)
+    for_(int i_N = 0; i_N < max_n_ker_idx; i_N++)
+    for_(int i_K = 0; i_K < i_K_end; i_K++)
+    for (int i_init = i_init_start; i_init < 2; i_init++) {
+        int idx = pd()->get_brg_kernel_idx(i_bs, i_init, i_M, i_N, i_K);
+        if (idx < 0) continue;
+        brg_idxs.push_back(idx);
+    }
+    return brg_idxs;
+}
+
 template <cpu_isa_t isa>
 status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
+    // Nested primitives are created at execution.
+    if (pd()->use_shape_dispatch()) return status::success;
+
     const auto &bgmmc = pd()->get_brgemm_matmul_conf();
     const int max_m_ker_idx
             = bgmmc.is_runtime_M ? max_num_dynamic_m_tails + 1 : 2;
@@ -394,6 +550,22 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
     const int i_init_start = bgmmc.K_blk != bgmmc.K ? 0 : 1;
     const int i_K_end = bgmmc.K_tail ? 2 : 1;
 
+    // Generate the brgemm kernels in parallel first, or restore them from
+    // the cache blob. Other JIT kernels are always generated.
+    const std::vector<int> brg_idxs = get_brg_kernel_idxs();
+    std::vector<const brgemm_desc_t *> brg_descs;
+    for (const int idx : brg_idxs)
+        brg_descs.push_back(&pd()->get_brg_desc(idx));
+    std::vector<std::shared_ptr<brgemm_kernel_t>> kernels;
+    auto blob = cache_blob();
+    if (blob)
+        CHECK(brgemm_containers::create_kernels_from_cache_blob(
+                kernels, brg_descs, blob));
+    else
+        CHECK(brgemm_containers::get_or_create_kernels(kernels, brg_descs));
+    for (size_t i = 0; i < brg_idxs.size(); i++)
+        brg_kernels_[brg_idxs[i]] = kernels[i];
+
     for_(int i_bs = 0; i_bs < i_bs_end; i_bs++)
     for_(int i_M = 0; i_M < max_m_ker_idx; i_M++)
     for_(int i_N = 0; i_N < max_n_ker_idx; i_N++)
@@ -402,9 +574,6 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
         int idx = pd()->get_brg_kernel_idx(i_bs, i_init, i_M, i_N, i_K);
         if (idx < 0) continue;
 
-        brgemm_kernel_t *ker = nullptr;
-        CHECK(brgemm_kernel_create(&ker, pd()->get_brg_desc(idx)));
-        CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
         if (is_superset(pd()->get_brg_desc(idx).isa_impl, avx512_core_amx))
             brgemm_palettes_.insert(idx, pd()->get_brg_desc(idx));
 
@@ -471,6 +640,112 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
     return status::success;
 }
 
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::get_cache_blob_size(
+        engine_t *engine, size_t *size) const {
+    if (pd()->use_shape_dispatch()) return status::unimplemented;
+    std::vector<const brgemm_kernel_t *> kernels;
+    for (const int idx : get_brg_kernel_idxs())
+        kernels.push_back(brg_kernels_[idx].get());
+    return brgemm_containers::get_kernels_cache_blob_size(kernels, size);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::get_cache_blob(
+        engine_t *engine, cache_blob_t &cache_blob) const {
+    if (pd()->use_shape_dispatch()) return status::unimplemented;
+    // The entries follow the order in which `init()` restores the kernels.
+    std::vector<const brgemm_kernel_t *> kernels;
+    for (const int idx : get_brg_kernel_idxs())
+        kernels.push_back(brg_kernels_[idx].get());
+    return brgemm_containers::get_kernels_cache_blob(kernels, cache_blob);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::get_shape_primitive(
+        std::shared_ptr<primitive_t> &shape_p, engine_t *engine,
+        const memory_desc_wrapper &src_d, const memory_desc_wrapper &weights_d,
+        const memory_desc_wrapper &dst_d,
+        const memory_desc_wrapper &bias_d) const {
+    shape_key_t key;
+    for (const auto *mdw : {&src_d, &weights_d, &dst_d}) {
+        key.insert(key.end(), mdw->dims(), mdw->dims() + mdw->ndims());
+        if (!mdw->is_blocking_desc()) continue;
+        const auto &strides = mdw->blocking_desc().strides;
+        key.insert(key.end(), strides, strides + mdw->ndims());
+    }
+
+    auto lookup = [&]() -> bool {
+        for (auto it = shape_cache_.begin(); it != shape_cache_.end(); ++it) {
+            if (it->first != key) continue;
+            shape_cache_.splice(shape_cache_.begin(), shape_cache_, it);
+            shape_p = shape_cache_.front().second;
+            return true;
+        }
+        return false;
+    };
+
+    {
+        std::lock_guard<std::mutex> lock(shape_cache_mutex_);
+        if (lookup()) return status::success;
+    }
+
+    // Kernels are generated without the lock to let other shapes proceed.
+    std::shared_ptr<primitive_desc_t> shape_pd;
+    CHECK(pd()->create_shape_pd(shape_pd, engine, src_d.md_, weights_d.md_,
+            dst_d.md_, bias_d.is_zero() ? nullptr : bias_d.md_,
+            /* allow_fallback = */ true));
+    std::shared_ptr<primitive_t> new_p;
+    CHECK(shape_pd->create_primitive(new_p, engine));
+
+    std::lock_guard<std::mutex> lock(shape_cache_mutex_);
+    if (lookup()) return status::success;
+    if (shape_cache_.size() >= shape_cache_capacity) shape_cache_.pop_back();
+    shape_cache_.emplace_front(std::move(key), new_p);
+    shape_p = std::move(new_p);
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::execute_shape_dispatch(
+        const exec_ctx_t &ctx) const {
+    const auto src_d = ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md());
+    const auto weights_d = ctx.memory_mdw(DNNL_ARG_WEIGHTS, pd()->weights_md());
+    const auto dst_d = ctx.memory_mdw(DNNL_ARG_DST, pd()->dst_md());
+    const auto bias_d = ctx.memory_mdw(DNNL_ARG_BIAS, pd()->weights_md(1));
+    if (src_d.has_runtime_dims_or_strides()
+            || weights_d.has_runtime_dims_or_strides()
+            || dst_d.has_runtime_dims_or_strides())
+        return status::invalid_arguments;
+
+    engine_t *engine = ctx.stream()->engine();
+    std::shared_ptr<primitive_t> shape_p;
+    CHECK(get_shape_primitive(
+            shape_p, engine, src_d, weights_d, dst_d, bias_d));
+
+    exec_args_t shape_args = ctx.args();
+    exec_ctx_t shape_ctx(ctx, std::move(shape_args));
+
+    const size_t scratchpad_size
+            = shape_p->pd()->scratchpad_size(scratchpad_mode::library);
+    std::unique_ptr<scratchpad_t> scratchpad;
+    if (scratchpad_size > 0) {
+        // Follow the policy of the scratchpad of this primitive.
+        const bool use_global_scratchpad
+                = !scratchpad_debug::is_protect_scratchpad()
+                && this->use_global_scratchpad();
+        scratchpad.reset(create_scratchpad(
+                engine, scratchpad_size, use_global_scratchpad));
+        if (!scratchpad || !scratchpad->get_memory_storage())
+            return status::out_of_memory;
+    }
+    auto grantor = shape_p->pd()->scratchpad_registry().grantor(
+            scratchpad ? scratchpad->get_memory_storage() : nullptr,
+            shape_ctx);
+    shape_ctx.set_scratchpad_grantor(&grantor);
+    return shape_p->execute(shape_ctx);
+}
+
 template <cpu_isa_t isa>
 status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
     DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
@@ -491,11 +766,15 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
     const bool wei_scale_per_n
             = has_wei_scales && (wei_scale_mask & pd()->wei_qmask_N());
     const float *oscales = scale_utils::precompute_scales(
-            ctx.get_scratchpad_grantor(), src_scales, wei_scales, pd()->K(),
-            pd()->N(), wei_scale_per_k, wei_scale_per_n, pd()->attr(),
-            jit_scale_precompute_.get(), 1.f, bgmmc.req_transpose_scales);
+            ctx.get_scratchpad_grantor(),
+            constant_quant_resource_t::get(this, ctx), src_scales, wei_scales,
+            pd()->K(), pd()->N(), wei_scale_per_k, wei_scale_per_n,
+            pd()->attr(), jit_scale_precompute_.get(), 1.f,
+            bgmmc.req_transpose_scales);
 
     brg_matmul_exec_ctx_t brgmm_ctx(ctx, pd(), oscales, dst_scales, helper);
+    const auto B_replicas = get_B_replicas(
+            CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS), weights_d.size());
 
     const bool use_buffer_a
             = bgmmc.use_buffer_a || bgmmc.use_buffer_a_tail_only;
@@ -511,6 +790,32 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
 
     const int N_chunks = brgmm_ctx.get_N_chunks();
     const int N_chunk_tail = brgmm_ctx.get_N_chunk_tail();
+
+    // Every thread keeps the absolute maximum of the destination blocks it
+    // finalizes while they are still in cache. With parallel reduction over K
+    // the blocks are finalized by the reduction, which is followed by a
+    // separate pass.
+    float *thr_amax = bgmmc.with_dst_amax
+            ? ctx.get_scratchpad_grantor().template get<float>(
+                    memory_tracking::names::key_matmul_dst_amax)
+            : nullptr;
+    const bool amax_in_chunks
+            = thr_amax && !brgmm_ctx.parallel_reduction_is_used();
+    // The secondary destination is written the same way.
+    char *secondary_dst = bgmmc.with_secondary_dst
+            ? CTX_OUT_MEM(char *, DNNL_ARG_ATTR_SECONDARY_DST)
+            : nullptr;
+    const float secondary_dst_scale = bgmmc.with_secondary_dst
+            ? *CTX_IN_MEM(const float *, DNNL_ARG_ATTR_SECONDARY_DST_SCALE)
+            : 1.f;
+    const bool secondary_dst_in_chunks
+            = secondary_dst && !brgmm_ctx.parallel_reduction_is_used();
+    if (thr_amax) {
+        assert(num_threads <= bgmmc.nthr);
+        for (int ithr = 0; ithr < num_threads; ithr++)
+            thr_amax[ithr] = 0.f;
+    }
+
     parallel(num_threads, [&](const int ithr, const int nthr) {
         const int ithr_bmn = brgmm_ctx.get_thread_idx_for_bmn_gemm(ithr);
         const int ithr_k = brgmm_ctx.get_thread_idx_for_k(ithr);
@@ -526,6 +831,9 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
         int prev_ker_idx = -1;
         brgemm_palettes_.maybe_tile_configure(
                 is_amx, prev_ker_idx, brgmm_ctx.get_base_brgemm_kernel_idx());
+        const char *B_local_ptr = B_replicas
+                ? static_cast<const char *>(B_replicas->get_local())
+                : nullptr;
 
         int b {0}, mc {0}, nc {0}, b_per_t {0}, mc_per_t {0}, nc_per_t {0},
                 bt {0}, mt {0}, nt {0};
@@ -564,6 +872,7 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
         int b_prev = -1;
         const char *a_batch_ptr = nullptr;
         const char *b_batch_ptr = nullptr;
+        float amax = 0.f;
 
         while (start < end) {
             if (mc >= M_chunks || nc >= N_chunks || b >= bgmmc.batch) {
@@ -581,7 +890,7 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
             int kc_prev = -1;
             if (b != b_prev) {
                 a_batch_ptr = brgmm_ctx.get_data_A_batch_ptr(b);
-                b_batch_ptr = brgmm_ctx.get_data_B_batch_ptr(b);
+                b_batch_ptr = brgmm_ctx.get_data_B_batch_ptr(b, B_local_ptr);
             }
             for_(int kc = kc_start; kc < kc_end; kc++)
             {
@@ -626,17 +935,61 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
                     nb_prev = nb;
                 }
             }
+            if (amax_in_chunks)
+                amax = nstl::max(get_dst_amax(brgmm_ctx, b,
+                                         brgmm_ctx.get_M_idx(m_start),
+                                         brgmm_ctx.get_M_idx(m_end),
+                                         brgmm_ctx.get_N_idx(n_start),
+                                         brgmm_ctx.get_N_idx(n_end)),
+                        amax);
+            if (secondary_dst_in_chunks)
+                write_secondary_dst(brgmm_ctx, secondary_dst,
+                        secondary_dst_scale, b, brgmm_ctx.get_M_idx(m_start),
+                        brgmm_ctx.get_M_idx(m_end),
+                        brgmm_ctx.get_N_idx(n_start),
+                        brgmm_ctx.get_N_idx(n_end));
             mc_prev = mc;
             b_prev = b;
 
             advance_func();
         }
+        if (amax_in_chunks) thr_amax[ithr] = amax;
         if (is_amx) { amx_tile_release(); }
     });
 
     maybe_reduce_and_convert_partial_results_A(brgmm_ctx);
     maybe_reduce_partial_results_and_apply_postops(brgmm_ctx);
 
+    if (thr_amax) {
+        if (!amax_in_chunks) {
+            const dim_t M = brgmm_ctx.get_M();
+            const dim_t N = brgmm_ctx.get_N();
+            parallel(num_threads, [&](const int ithr, const int nthr) {
+                dim_t start {0}, end {0};
+                balance211(bgmmc.batch * M, nthr, ithr, start, end);
+                float amax = 0.f;
+                for (dim_t r = start; r < end; r++)
+                    amax = nstl::max(get_dst_amax(brgmm_ctx, (int)(r / M),
+                                             r % M, r % M + 1, 0, N),
+                            amax);
+                thr_amax[ithr] = amax;
+            });
+        }
+        float amax = 0.f;
+        for (int ithr = 0; ithr < num_threads; ithr++)
+            amax = nstl::max(thr_amax[ithr], amax);
+        *CTX_OUT_MEM(float *, DNNL_ARG_ATTR_DST_AMAX) = amax;
+    }
+
+    if (secondary_dst && !secondary_dst_in_chunks) {
+        const dim_t M = brgmm_ctx.get_M();
+        const dim_t N = brgmm_ctx.get_N();
+        parallel_nd(bgmmc.batch * M, [&](dim_t r) {
+            write_secondary_dst(brgmm_ctx, secondary_dst, secondary_dst_scale,
+                    (int)(r / M), r % M, r % M + 1, 0, N);
+        });
+    }
+
     return status::success;
 }
 
@@ -1234,6 +1587,115 @@ void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
     }
 }
 
+template <cpu_isa_t isa>
+float brgemm_matmul_t<isa>::get_dst_amax(
+        const brg_matmul_exec_ctx_t &brgmm_ctx, int b_idx, dim_t m_start,
+        dim_t m_end, dim_t n_start, dim_t n_end) const {
+    const dim_t M = brgmm_ctx.get_M();
+    const dim_t N = brgmm_ctx.get_N();
+    m_end = nstl::min(m_end, M);
+    n_end = nstl::min(n_end, N);
+    const dim_t len = n_end - n_start;
+    const auto dst_dt = pd()->get_brgemm_matmul_conf().dst_dt;
+
+    float amax = 0.f;
+    for (dim_t m = m_start; m < m_end; m++) {
+        const char *ptr = brgmm_ctx.get_data_C_ptr(b_idx, m, n_start);
+        switch (dst_dt) {
+            case f32: {
+                const auto *p = reinterpret_cast<const float *>(ptr);
+                PRAGMA_OMP_SIMD(reduction(max : amax))
+                for (dim_t n = 0; n < len; n++)
+                    amax = nstl::max(std::fabs(p[n]), amax);
+            } break;
+            case bf16: {
+                const auto *p = reinterpret_cast<const bfloat16_t *>(ptr);
+                PRAGMA_OMP_SIMD(reduction(max : amax))
+                for (dim_t n = 0; n < len; n++)
+                    amax = nstl::max(std::fabs(static_cast<float>(p[n])), amax);
+            } break;
+            case f16: {
+                const auto *p = reinterpret_cast<const float16_t *>(ptr);
+                PRAGMA_OMP_SIMD(reduction(max : amax))
+                for (dim_t n = 0; n < len; n++)
+                    amax = nstl::max(std::fabs(static_cast<float>(p[n])), amax);
+            } break;
+            default:
+                for (dim_t n = 0; n < len; n++)
+                    amax = nstl::max(
+                            std::fabs(io::load_float_value(dst_dt, ptr, n)),
+                            amax);
+                break;
+        }
+    }
+    return amax;
+}
+
+template <cpu_isa_t isa>
+void brgemm_matmul_t<isa>::write_secondary_dst(
+        const brg_matmul_exec_ctx_t &brgmm_ctx, char *secondary_dst,
+        float scale, int b_idx, dim_t m_start, dim_t m_end, dim_t n_start,
+        dim_t n_end) const {
+    const dim_t M = brgmm_ctx.get_M();
+    const dim_t N = brgmm_ctx.get_N();
+    m_end = nstl::min(m_end, M);
+    n_end = nstl::min(n_end, N);
+    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const auto dst_dt = bgmmc.dst_dt;
+    const auto sec_dt = bgmmc.secondary_dst_dt;
+    const dim_t sec_dt_sz = types::data_type_size(sec_dt);
+    const float inv_scale = 1.f / scale;
+
+    // The row is processed by pieces which are converted to f32 first.
+    constexpr dim_t n_blk = 64;
+    float buf[n_blk];
+    for (dim_t m = m_start; m < m_end; m++) {
+        for (dim_t n0 = n_start; n0 < n_end; n0 += n_blk) {
+            const dim_t len = nstl::min(n_blk, n_end - n0);
+            const dim_t off = brgmm_ctx.get_data_C_off(b_idx, m, n0);
+            const char *src = brgmm_ctx.get_data_C_ptr(b_idx, m, n0);
+            char *dst = secondary_dst + off / bgmmc.c_dt_sz * sec_dt_sz;
+            switch (dst_dt) {
+                case f32: {
+                    const auto *p = reinterpret_cast<const float *>(src);
+                    PRAGMA_OMP_SIMD()
+                    for (dim_t n = 0; n < len; n++)
+                        buf[n] = p[n] * inv_scale;
+                } break;
+                case bf16: {
+                    const auto *p = reinterpret_cast<const bfloat16_t *>(src);
+                    PRAGMA_OMP_SIMD()
+                    for (dim_t n = 0; n < len; n++)
+                        buf[n] = static_cast<float>(p[n]) * inv_scale;
+                } break;
+                default:
+                    for (dim_t n = 0; n < len; n++)
+                        buf[n] = io::load_float_value(dst_dt, src, n)
+                                * inv_scale;
+                    break;
+            }
+            switch (sec_dt) {
+                case s8: {
+                    auto *p = reinterpret_cast<int8_t *>(dst);
+                    PRAGMA_OMP_SIMD()
+                    for (dim_t n = 0; n < len; n++)
+                        p[n] = q10n::saturate_and_round<int8_t>(buf[n]);
+                } break;
+                case u8: {
+                    auto *p = reinterpret_cast<uint8_t *>(dst);
+                    PRAGMA_OMP_SIMD()
+                    for (dim_t n = 0; n < len; n++)
+                        p[n] = q10n::saturate_and_round<uint8_t>(buf[n]);
+                } break;
+                default:
+                    for (dim_t n = 0; n < len; n++)
+                        io::store_float_value(sec_dt, buf[n], dst, n);
+                    break;
+            }
+        }
+    }
+}
+
 template <cpu_isa_t isa>
 void brgemm_matmul_t<isa>::accumulate(
         char *result_ptr, const char *reduce_ptr, size_t size) const {
@@ -1247,6 +1709,26 @@ void brgemm_matmul_t<isa>::accumulate(
         assert(!"unsupported accumulation data type");
 }
 
+template <cpu_isa_t isa>
+std::shared_ptr<numa::replicas_t> brgemm_matmul_t<isa>::get_B_replicas(
+        const char *B_ptr, size_t size) const {
+    if (!numa::is_weights_replication_enabled() || numa::get_num_nodes() < 2)
+        return nullptr;
+    // Only weights declared constant across executions can be replicated:
+    // the data behind an unchanged handle may be updated in place.
+    if (!pd()->attr()->constant_quant_) return nullptr;
+    // Sparse weights are addressed through offsets into the original buffer.
+    if (!B_ptr || size == 0
+            || pd()->get_brgemm_matmul_conf().packed_sparse_weights)
+        return nullptr;
+
+    std::lock_guard<std::mutex> lock(B_replicas_mutex_);
+    if (!B_replicas_ || B_replicas_->src() != B_ptr
+            || B_replicas_->size() != size)
+        B_replicas_ = std::make_shared<numa::replicas_t>(B_ptr, size);
+    return B_replicas_;
+}
+
 template <cpu_isa_t isa>
 struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
     brg_matmul_exec_ctx_t(const exec_ctx_t &ctx, const pd_t *pd,
@@ -1263,7 +1745,13 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         , is_thread_chunks_exec_order_horizontal_(true) {
 
         const memory_desc_wrapper weights_d(pd->weights_md(0));
-        if (bgmmc_.packed_sparse_weights) {
+        if (bgmmc_.packed_2_4_sparse_weights) {
+            // The 2:4 encoding has no offsets, every block keeps half of its
+            // values.
+            data_B_offsets_ptr_ = nullptr;
+            data_B_bitmask_ptr_ = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS, 1);
+            B_packed_sparse_block_size_ = weights_d.blk_size();
+        } else if (bgmmc_.packed_sparse_weights) {
             data_B_offsets_ptr_
                     = CTX_IN_MEM(const int64_t *, DNNL_ARG_WEIGHTS, 1);
             data_B_bitmask_ptr_ = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS, 2);
@@ -1666,7 +2154,9 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         if (bgmmc_.packed_sparse_weights) {
             const dim_t blk_num
                     = (b_ptr - data_B_ptr_) / B_packed_sparse_block_size_;
-            const auto blk_off = data_B_offsets_ptr_[blk_num];
+            const auto blk_off = bgmmc_.packed_2_4_sparse_weights
+                    ? blk_num * B_packed_sparse_block_size_ / 2
+                    : data_B_offsets_ptr_[blk_num];
             return data_B_ptr_ + blk_off;
         }
         return b_ptr;
@@ -1696,9 +2186,11 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         return b_off;
     }
 
-    const char *get_data_B_batch_ptr(int b_idx) const {
+    // `B_ptr` is an optional copy of the weights to read from.
+    const char *get_data_B_batch_ptr(
+            int b_idx, const char *B_ptr = nullptr) const {
         const int b = get_bb_idx(b_idx, bgmmc_.bcast_B_desc);
-        return data_B_ptr_ + get_data_B_batch_off(b);
+        return (B_ptr ? B_ptr : data_B_ptr_) + get_data_B_batch_off(b);
     }
 
     const char *get_data_B_bitmask_ptr(int b, int k, int n) const {
@@ -17,11 +17,18 @@
 #ifndef CPU_X64_MATMUL_BRGEMM_MATMUL_HPP
 #define CPU_X64_MATMUL_BRGEMM_MATMUL_HPP
 
+#include <list>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
 #include "common/c_types_map.hpp"
 #include "common/primitive.hpp"
 #include "common/type_helpers.hpp"
 
 #include "cpu/matmul/cpu_matmul_pd.hpp"
+#include "cpu/numa.hpp"
 
 #include "cpu/x64/brgemm/brgemm.hpp"
 #include "cpu/x64/brgemm/brgemm_containers.hpp"
@@ -69,9 +76,24 @@ struct brgemm_matmul_t : public primitive_t {
 
         void maybe_set_LDB2();
 
+        // Returns true when the descriptor has runtime dimensions the
+        // kernels can't handle natively. Such a primitive creates a nested
+        // one for every shape met at execution instead.
+        bool use_shape_dispatch() const { return use_shape_dispatch_; }
+        // Creates a primitive descriptor for concrete memory descriptors.
+        // Falls back to any other implementation when `allow_fallback` is
+        // set and this one doesn't support the shape.
+        status_t create_shape_pd(std::shared_ptr<primitive_desc_t> &shape_pd,
+                engine_t *engine, const memory_desc_t *src_md,
+                const memory_desc_t *wei_md, const memory_desc_t *dst_md,
+                const memory_desc_t *bia_md, bool allow_fallback) const;
+
     private:
+        status_t init_shape_dispatch(engine_t *engine);
+
         brgemm_desc_t brg_descs_[max_num_brg_kernels_matmul];
         brgemm_matmul_conf_t bgmmc_;
+        bool use_shape_dispatch_ = false;
     };
 
     brgemm_matmul_t(const pd_t *apd) : primitive_t(apd) {}
@@ -79,7 +101,19 @@ struct brgemm_matmul_t : public primitive_t {
     status_t init(engine_t *engine) override;
     static constexpr data_type_t acc_type = data_type::s32;
 
+    status_t create_resource(
+            engine_t *engine, resource_mapper_t &mapper) const override {
+        return constant_quant_resource_t::create(this, mapper);
+    }
+
+    // Only the brgemm kernels are stored, the copy and reduction kernels are
+    // generated again when the primitive is restored.
+    status_t get_cache_blob_size(engine_t *engine, size_t *size) const override;
+    status_t get_cache_blob(
+            engine_t *engine, cache_blob_t &cache_blob) const override;
+
     status_t execute(const exec_ctx_t &ctx) const override {
+        if (pd()->use_shape_dispatch()) return execute_shape_dispatch(ctx);
         return execute_body(ctx);
     }
 
@@ -87,7 +121,17 @@ private:
     struct brg_matmul_exec_ctx_t;
 
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    // Returns the indices of the brgemm kernels in their creation order.
+    std::vector<int> get_brg_kernel_idxs() const;
     status_t execute_body(const exec_ctx_t &ctx) const;
+    status_t execute_shape_dispatch(const exec_ctx_t &ctx) const;
+    // Returns the nested primitive for the shape of the execution arguments
+    // creating it on the first call.
+    status_t get_shape_primitive(std::shared_ptr<primitive_t> &shape_p,
+            engine_t *engine, const memory_desc_wrapper &src_d,
+            const memory_desc_wrapper &weights_d,
+            const memory_desc_wrapper &dst_d,
+            const memory_desc_wrapper &bias_d) const;
     void compute_kernel(const brg_matmul_exec_ctx_t &brgmm_ctx,
             const char *A_data_batch_ptr, const char *B_data_batch_ptr,
             int ithr, int b_idx, int m_blk_idx, int n_blk_idx, int k_blk_idx,
@@ -107,8 +151,19 @@ private:
             const brg_matmul_exec_ctx_t &brgmm_ctx) const;
     void accumulate(
             char *result_ptr, const char *reduce_ptr, size_t size) const;
-
-    std::unique_ptr<brgemm_kernel_t> brg_kernels_[max_num_brg_kernels_matmul];
+    // Returns the absolute maximum of a rectangular area of the destination.
+    float get_dst_amax(const brg_matmul_exec_ctx_t &brgmm_ctx, int b_idx,
+            dim_t m_start, dim_t m_end, dim_t n_start, dim_t n_end) const;
+    // Quantizes a rectangular area of the destination into the secondary
+    // destination.
+    void write_secondary_dst(const brg_matmul_exec_ctx_t &brgmm_ctx,
+            char *secondary_dst, float scale, int b_idx, dim_t m_start,
+            dim_t m_end, dim_t n_start, dim_t n_end) const;
+    // Returns per-node copies of the weights if they are replicated.
+    std::shared_ptr<numa::replicas_t> get_B_replicas(
+            const char *B_ptr, size_t size) const;
+
+    std::shared_ptr<brgemm_kernel_t> brg_kernels_[max_num_brg_kernels_matmul];
     brgemm_containers::brgemm_palette_container_t brgemm_palettes_ {
             max_num_brg_kernels_matmul};
 
@@ -123,6 +178,18 @@ private:
     using reducer_t = x64::jit_brgemm_kernel_diff_bias_t<
             typename cpu_isa_traits_t<isa>::Vmm>;
     std::unique_ptr<reducer_t> reducers_[2][2];
+
+    // The weights are assumed constant while their handle doesn't change.
+    mutable std::mutex B_replicas_mutex_;
+    mutable std::shared_ptr<numa::replicas_t> B_replicas_;
+
+    // The most recently used shape primitives go first, the least recently
+    // used one is evicted once the capacity is reached.
+    static constexpr size_t shape_cache_capacity = 16;
+    using shape_key_t = std::vector<dim_t>;
+    mutable std::mutex shape_cache_mutex_;
+    mutable std::list<std::pair<shape_key_t, std::shared_ptr<primitive_t>>>
+            shape_cache_;
 };
 
 } // namespace matmul
@@ -3466,6 +3466,8 @@ private:
     Vmm vmm_permw = Vmm(1);
     Vmm vmm_permd = Vmm(2);
     Vmm vmm_zp_b_shift = Vmm(3);
+    // Per-lane shifts to unpack int4 values on ISAs without opmasks.
+    Vmm vmm_int4_shift = Vmm(4);
     Ymm ymm_tail_mask = ymm1;
 
     inline void kmovw(Opmask k, unsigned w) {
@@ -3525,17 +3527,29 @@ void jit_brgemm_matmul_copy_b_f32_t<Vmm>::load_data(
             uni_vpmovsxbd(maybe_mask(vmm_lower, is_tail), op);
             copy_half_int4(vmm_in, vmm_lower);
             vpermd(vmm_in, vmm_permd, vmm_in);
-            uni_vpslld(vmm_in | k5555, vmm_in, 28);
-            vpsrad(vmm_in | k5555, vmm_in, 28);
-            vpsrad(vmm_in | kAAAA, vmm_in, 4);
+            if (isa_has_masks(conf_->isa)) {
+                uni_vpslld(vmm_in | k5555, vmm_in, 28);
+                vpsrad(vmm_in | k5555, vmm_in, 28);
+                vpsrad(vmm_in | kAAAA, vmm_in, 4);
+            } else {
+                // Move the low (even lanes) or the high (odd lanes) nibble
+                // to the top and sign-extend it back.
+                vpsllvd(vmm_in, vmm_in, vmm_int4_shift);
+                vpsrad(vmm_in, vmm_in, 28);
+            }
             break;
         case data_type::u4:
             uni_vpmovzxbd(maybe_mask(vmm_lower, is_tail), op);
             copy_half_int4(vmm_in, vmm_lower);
             vpermd(vmm_in, vmm_permd, vmm_in);
-            uni_vpslld(vmm_in | k5555, vmm_in, 28);
-            vpsrld(vmm_in | k5555, vmm_in, 28);
-            vpsrld(vmm_in | kAAAA, vmm_in, 4);
+            if (isa_has_masks(conf_->isa)) {
+                uni_vpslld(vmm_in | k5555, vmm_in, 28);
+                vpsrld(vmm_in | k5555, vmm_in, 28);
+                vpsrld(vmm_in | kAAAA, vmm_in, 4);
+            } else {
+                vpsllvd(vmm_in, vmm_in, vmm_int4_shift);
+                vpsrld(vmm_in, vmm_in, 28);
+            }
             break;
         default: assert(!"unsupported data type");
     }
@@ -3549,7 +3563,11 @@ template <typename Vmm>
 void jit_brgemm_matmul_copy_b_f32_t<Vmm>::copy_16_x_n_block(
         int nrows, int ncolumns) {
     const int max_isa_regs = isa_num_vregs(conf_->isa);
-    const int reserved_regs = req_zp_b_shift_ ? 4 : is_src_int4_ ? 3 : 2;
+    const int reserved_regs = is_src_int4_ && !isa_has_masks(conf_->isa)
+            ? 5
+            : req_zp_b_shift_ ? 4
+            : is_src_int4_    ? 3
+                              : 2;
     const int max_regs_available = max_isa_regs - reserved_regs;
 
     auto get_vmm = [max_regs_available, reserved_regs](int reg_idx) {
@@ -3655,11 +3673,20 @@ void jit_brgemm_matmul_copy_b_f32_t<Vmm>::generate() {
     if (is_src_int4_) {
         alignas(64) static constexpr const uint32_t int4_permute[16]
                 = {0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15};
+        // Note: for Ymm, vpermd uses only the lower 3 bits of the indices,
+        // which gives the same {0, 0, 1, 1, ...} duplication of the bytes.
         mov(reg_tmp, reinterpret_cast<size_t>(int4_permute));
-        vmovdqa32(vmm_permd, ptr[reg_tmp]);
+        uni_vmovdqu(vmm_permd, ptr[reg_tmp]);
 
-        kmovw(kAAAA, 0xaaaa);
-        kmovw(k5555, 0x5555);
+        if (isa_has_masks(conf_->isa)) {
+            kmovw(kAAAA, 0xaaaa);
+            kmovw(k5555, 0x5555);
+        } else {
+            alignas(32) static constexpr const uint32_t int4_shift[8]
+                    = {28, 24, 28, 24, 28, 24, 28, 24};
+            mov(reg_tmp, reinterpret_cast<size_t>(int4_shift));
+            uni_vmovdqu(vmm_int4_shift, ptr[reg_tmp]);
+        }
     }
     if (req_zp_b_shift_) {
         mov(reg_tmp, ptr[param1 + GET_OFF(zp_b_value_ptr)]);
@@ -244,6 +244,8 @@ status_t check_isa_with_datatype(
                     is_superset(isa, avx512_core_bf16))
             && IMPLICATION(bm_conf_utils.is_f16_with_int_wei(),
                     one_of(isa, avx512_core_amx_fp16, avx512_core_fp16))
+            && IMPLICATION(bm_conf_utils.is_f32_with_int_wei(),
+                    one_of(isa, avx512_core, avx2))
             && IMPLICATION(bm_conf_utils.is_f8(),
                     is_superset(isa, avx512_core_amx_fp16)
                             || is_superset(isa, avx10_2_512))
@@ -260,9 +262,11 @@ status_t check_datatype_cfg(const brgemm_matmul_conf_utils_t &bm_conf_utils) {
                       bm_conf_utils.is_f8(), bm_conf_utils.is_int8(),
                       bm_conf_utils.is_tf32(),
                       bm_conf_utils.is_bf16_with_int_wei(),
-                      bm_conf_utils.is_f16_with_int_wei())
+                      bm_conf_utils.is_f16_with_int_wei(),
+                      bm_conf_utils.is_f32_with_int_wei())
             && IMPLICATION(bm_conf_utils.is_bf16_with_int_wei()
-                            || bm_conf_utils.is_f16_with_int_wei(),
+                            || bm_conf_utils.is_f16_with_int_wei()
+                            || bm_conf_utils.is_f32_with_int_wei(),
                     bm_conf_utils.with_weights_decompression());
     return ok ? status::success : status::unimplemented;
 }
@@ -291,8 +295,10 @@ brgemm_matmul_conf_utils_t::brgemm_matmul_conf_utils_t(
               && one_of(attr.fpmath_.mode_, fpmath_mode::tf32, fpmath_mode::any)
               && isa == avx10_2_512_amx_2)
     , weights_decompression_support(one_of(bgmmc.wei_dt, u8, s8, u4, s4)
-              && one_of(attr.fpmath_.mode_, fpmath_mode::bf16, fpmath_mode::f16,
-                      fpmath_mode::any)
+              && (one_of(attr.fpmath_.mode_, fpmath_mode::bf16,
+                          fpmath_mode::f16, fpmath_mode::any)
+                      || (attr.fpmath_.mode_ == fpmath_mode::strict
+                              && bgmmc.src_dt == f32))
               && IMPLICATION(attr.fpmath_.mode_ == fpmath_mode::f16,
                       bgmmc.src_dt == f16)
               && IMPLICATION(attr.fpmath_.mode_ == fpmath_mode::bf16,
@@ -310,6 +316,10 @@ brgemm_matmul_conf_utils_t::brgemm_matmul_conf_utils_t(
               && one_of(bgmmc.dst_dt, bf16, f32))
     , f16_with_int_wei_dt(weights_decompression_support && bgmmc.src_dt == f16
               && one_of(bgmmc.dst_dt, f16, f32))
+    // Integer weights are upconverted to f32 by the copy_b routine, the
+    // kernel computes in f32. Targets ISAs without bf16 or f16 compute.
+    , f32_with_int_wei_dt(weights_decompression_support && bgmmc.src_dt == f32
+              && bgmmc.dst_dt == f32)
     , A_any_layout(A_any_layout)
     , B_any_layout(B_any_layout)
     , C_any_layout(C_any_layout)
@@ -837,6 +847,60 @@ float compute_blocking_heuristic_avx512(brgemm_matmul_conf_t &bgmmc,
         }
     }
 
+    // Split K for skinny shapes, e.g. LLM decode: with a few rows the problem
+    // is bound by streaming B, and distributing N blocks alone leaves threads
+    // idle or imbalanced. Partial C results are reduced in parallel later.
+    const bool try_skinny_k_partitioning = start_nthr_k == 1
+            && matmul.M <= 16 && bgmmc.batch == 1
+            && bgmmc.acc_dt == data_type::f32 && !bgmmc.with_reduce
+            && !bgmmc.is_runtime_M && !bgmmc.is_runtime_N
+            && !bm_conf_utils.check_is_transposed(bgmmc.src_tag);
+    if (try_skinny_k_partitioning) {
+        const dim_t n_work = div_up(matmul.N, n_blk);
+        // Estimated per-thread traffic: B blocks streamed by the most loaded
+        // thread plus its share of the partial C results reduction.
+        auto estimate_traffic = [&](int cur_k_blk, int nthr_k) {
+            const dim_t k_chunks = div_up(matmul.K, cur_k_blk);
+            const int nthr_bmn = nthr / nthr_k;
+            const float b_traffic = static_cast<float>(div_up(n_work, nthr_bmn))
+                    * div_up(k_chunks, nthr_k) * cur_k_blk * n_blk
+                    * bgmmc.b_dt_sz;
+            const float reduce_traffic = nthr_k > 1
+                    ? static_cast<float>(nthr_k) * matmul.M * matmul.N
+                            * bgmmc.acc_dt_sz / nthr
+                    : 0.f;
+            return b_traffic + reduce_traffic;
+        };
+
+        const float no_split_traffic = estimate_traffic(k_blk, 1);
+        float best_traffic = no_split_traffic;
+        int best_k_blk = k_blk, best_nthr_k = 1;
+        // Smaller K blocks give more K chunks to distribute.
+        const int k_blk_candidates[] = {k_blk, 512, 256};
+        for (int i = 0; i < 3; i++) {
+            const int cur_k_blk = k_blk_candidates[i];
+            if (i > 0 && cur_k_blk >= k_blk) continue;
+            const int max_nthr_k = static_cast<int>(nstl::min<dim_t>(
+                    nthr, div_up(matmul.K, cur_k_blk)));
+            for (int nthr_k = 2; nthr_k <= max_nthr_k; nthr_k++) {
+                const float cur_traffic = estimate_traffic(cur_k_blk, nthr_k);
+                if (cur_traffic < best_traffic) {
+                    best_traffic = cur_traffic;
+                    best_k_blk = cur_k_blk;
+                    best_nthr_k = nthr_k;
+                }
+            }
+        }
+
+        // The reduction requires an extra parallel section, so split K only
+        // when it pays off noticeably. The value is empirical.
+        if (best_nthr_k > 1 && best_traffic < 0.8f * no_split_traffic) {
+            k_blk = best_k_blk;
+            start_nthr_k = best_nthr_k;
+            last_nthr_k = best_nthr_k;
+        }
+    }
+
     // Use large m-blocking if possible.
     const bool is_huge_n = matmul.N >= 20000;
     const bool large_bmn_parallelism = max_bmn_parallel > 10 * nthr;
@@ -1216,6 +1280,8 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.b_dt_sz = bgmmc.tr_b_dt_sz = types::data_type_size(bgmmc.wei_dt);
 
     bgmmc.packed_sparse_weights = weights_d.is_sparse_packed_desc();
+    bgmmc.packed_2_4_sparse_weights = bgmmc.packed_sparse_weights
+            && weights_d.encoding() == sparse_encoding::packed_2_4;
     if (bgmmc.packed_sparse_weights) {
         VCONDCHECK_BG(bgmmc.is_amx, VERBOSE_ISA_SPARSE_ENCODING_MISMATCH);
         VCONDCHECK_BG(bgmmc.wei_dt == s8, VERBOSE_UNSUPPORTED_DT);
@@ -1224,6 +1290,7 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.is_tf32 = bm_conf_utils.is_tf32();
     bgmmc.is_bf16_with_int_wei = bm_conf_utils.is_bf16_with_int_wei();
     bgmmc.is_f16_with_int_wei = bm_conf_utils.is_f16_with_int_wei();
+    bgmmc.is_f32_with_int_wei = bm_conf_utils.is_f32_with_int_wei();
     bgmmc.is_f32_f16 = bm_conf_utils.is_f32_f16();
     bgmmc.is_f32_bf16 = bm_conf_utils.is_f32_bf16();
     bgmmc.with_wei_decompression = bm_conf_utils.with_weights_decompression();
@@ -1259,6 +1326,9 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
         bgmmc.wei_dt = f16;
         bgmmc.tr_a_dt_sz = types::data_type_size(f16);
         bgmmc.tr_b_dt_sz = types::data_type_size(f16);
+    } else if (bgmmc.is_f32_with_int_wei) {
+        bgmmc.wei_dt = f32;
+        bgmmc.tr_b_dt_sz = types::data_type_size(f32);
     }
 
     bgmmc.acc_dt = bm_conf_utils.is_int8() ? s32 : f32;
@@ -1291,6 +1361,9 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
 
     const auto &dst_scales = attr.scales_.get(DNNL_ARG_DST);
     bgmmc.with_dst_scales = !dst_scales.has_default_values();
+    bgmmc.with_dst_amax = attr.dst_amax_;
+    bgmmc.secondary_dst_dt = attr.secondary_dst_dt_;
+    bgmmc.with_secondary_dst = bgmmc.secondary_dst_dt != data_type::undef;
     // only common scales are supported
     VCONDCHECK_BG(!(bgmmc.with_dst_scales && dst_scales.get_mask() > 0),
             VERBOSE_UNSUPPORTED_SCALES_CFG);
@@ -1398,6 +1471,10 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
         VCONDCHECK_BG(bm_conf_utils.check_is_plain(bgmmc.wei_tag)
                         || bm_conf_utils.check_is_transposed(bgmmc.wei_tag),
                 VERBOSE_UNSUPPORTED_TAG);
+    // The f32 copy_b routine upconverts plain weights only.
+    if (bgmmc.is_f32_with_int_wei)
+        VCONDCHECK_BG(bm_conf_utils.check_is_plain(bgmmc.wei_tag),
+                VERBOSE_UNSUPPORTED_TAG);
 
     const bool transposed_A = bm_conf_utils.check_is_transposed(bgmmc.src_tag);
     // When M == 1 MatMul always considers A to be non-transposed even if A md
@@ -1996,6 +2073,8 @@ void init_scratchpad(memory_tracking::registrar_t &scratchpad,
         scratchpad.book(key_brgemm_primitive_buffer_d,
                 bgmmc.M_blk * bgmmc.N_blk * bgmmc.c_dt_sz * bgmmc.nthr,
                 default_data_align);
+    if (bgmmc.with_dst_amax)
+        scratchpad.book<float>(key_matmul_dst_amax, bgmmc.nthr);
 }
 
 } // namespace matmul
@@ -108,8 +108,14 @@ struct brgemm_matmul_conf_t {
     bool with_binary;
     bool with_scales;
     bool with_dst_scales;
+    bool with_dst_amax;
+    bool with_secondary_dst;
+    data_type_t secondary_dst_dt;
     bool s8s8_compensation_required;
     bool packed_sparse_weights;
+    // Packed weights with 2:4 structured sparsity: every block keeps exactly
+    // half of its values, so blocks are at fixed offsets.
+    bool packed_2_4_sparse_weights;
     bool req_transpose_scales;
     bool with_wei_decompression;
     int postops_inst_count;
@@ -214,6 +220,7 @@ struct brgemm_matmul_conf_t {
     bool is_bf32 = false;
     bool is_bf16_with_int_wei = false;
     bool is_f16_with_int_wei = false;
+    bool is_f32_with_int_wei = false;
     bool is_f32_f16 = false;
     bool is_f32_bf16 = false;
     bool is_int4_weights = false;
@@ -266,6 +273,7 @@ struct brgemm_matmul_conf_utils_t {
         if (bgmmc.is_runtime_N) return true;
         if (bgmmc.is_bf16_with_int_wei) return true;
         if (bgmmc.is_f16_with_int_wei) return true;
+        if (bgmmc.is_f32_with_int_wei) return true;
         if (bgmmc.apply_scales_in_buffer_b) return true;
 
         if (bgmmc.is_amx)
@@ -352,6 +360,8 @@ struct brgemm_matmul_conf_utils_t {
 
     inline bool is_f16_with_int_wei() const { return f16_with_int_wei_dt; }
 
+    inline bool is_f32_with_int_wei() const { return f32_with_int_wei_dt; }
+
     inline bool with_weights_decompression() const {
         return !utils::one_of(bgmmc.src_dt, data_type::s8, data_type::u8,
                        data_type::s4, data_type::u4)
@@ -390,7 +400,7 @@ private:
     const bool f32_dt, bf16_dt, f16_dt, f8_dt, bf8_dt, int8_dt, bf32_dt,
             tf32_dt;
     const bool weights_decompression_support, bf16_with_int_wei_dt, f32_f16_dt,
-            f32_bf16_dt, f16_with_int_wei_dt;
+            f32_bf16_dt, f16_with_int_wei_dt, f32_with_int_wei_dt;
     const bool A_any_layout;
     const bool B_any_layout;
     const bool C_any_layout;
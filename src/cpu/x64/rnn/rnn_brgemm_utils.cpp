@@ -17,6 +17,7 @@
 #include <utility>
 #include "common/dnnl_thread.hpp"
 #include "cpu/rnn/rnn_utils.hpp"
+#include "cpu/x64/brgemm/brgemm_containers.hpp"
 #include "cpu/x64/rnn/rnn_brgemm_utils.hpp"
 
 namespace dnnl {
@@ -331,7 +332,7 @@ void rnn_brgemm_base_t::init_scratchpad(const cpu::rnn_utils::rnn_conf_t &rnn,
                 gemm_acc_type_size, gemm_acc_align);
     }
 
-    if (rnn.is_bf32()) {
+    if (rnn.is_bf32() || rnn.is_wei_decompression()) {
 
         const dims_t wei_layer_dims
                 = {rnn.n_layer, rnn.n_dir, rnn.n_gates, rnn.slc, rnn.dlc};
@@ -348,14 +349,18 @@ void rnn_brgemm_base_t::init_scratchpad(const cpu::rnn_utils::rnn_conf_t &rnn,
         memory_desc_init_by_tag(
                 wei_iter_desc, 5, wei_iter_dims, data_type::bf16, tag);
 
-        scratchpad.book(key_rnn_bf32_wei_layer_trans,
+        const bool is_bf32 = rnn.is_bf32();
+        scratchpad.book(is_bf32 ? key_rnn_bf32_wei_layer_trans
+                                : key_rnn_wei_layer_decomp,
                 memory_desc_wrapper(wei_layer_desc).size(), 64);
 
-        scratchpad.book(key_rnn_bf32_wei_iter_trans,
+        scratchpad.book(
+                is_bf32 ? key_rnn_bf32_wei_iter_trans : key_rnn_wei_iter_decomp,
                 memory_desc_wrapper(wei_iter_desc).size(), 64);
 
-        scratchpad.book(key_rnn_bf32_attention_trans,
-                rnn.n_iter * rnn.mb * sizeof(bfloat16_t), 64);
+        if (is_bf32)
+            scratchpad.book(key_rnn_bf32_attention_trans,
+                    rnn.n_iter * rnn.mb * sizeof(bfloat16_t), 64);
     }
 
     const int max_K_Block
@@ -574,7 +579,7 @@ status_t rnn_brgemm_t<prop_kind::forward>::configure_brgemm(
 
 status_t init_brgemm_kernel(x64::brgemm_desc_t *desc, x64::cpu_isa_t isa,
         impl::data_type_t src_type, impl::data_type_t weights_type,
-        std::unique_ptr<x64::brgemm_kernel_t> &ker, dim_t M, dim_t N, dim_t K,
+        brgemm_ker_ptr_t &ker, dim_t M, dim_t N, dim_t K,
         dim_t LDA, dim_t LDB, dim_t LDC, float beta, dim_t max_bs,
         dim_t hint_expected_A_size = LLONG_MAX,
         dim_t hint_expected_B_size = LLONG_MAX,
@@ -597,9 +602,7 @@ status_t init_brgemm_kernel(x64::brgemm_desc_t *desc, x64::cpu_isa_t isa,
     CHECK(brgemm_desc_set_attr(desc, brgattr));
     CHECK(brgemm_desc_finalize(desc));
 
-    x64::brgemm_kernel_t *_t_ptr;
-    CHECK(brgemm_kernel_create(&_t_ptr, *desc));
-    CHECK(safe_ptr_assign<x64::brgemm_kernel_t>(ker, _t_ptr));
+    CHECK(x64::brgemm_containers::get_or_create_kernel(ker, *desc));
 
     return status::success;
 };
@@ -632,7 +635,7 @@ status_t rnn_brgemm_t<prop_kind::forward>::init_kernels(
 
     const auto init_brgemm
             = [&](x64::brgemm_desc_t *desc, x64::cpu_isa_t isa,
-                      std::unique_ptr<x64::brgemm_kernel_t> &ker, dim_t M,
+                      brgemm_ker_ptr_t &ker, dim_t M,
                       dim_t N, dim_t K, dim_t LDA, dim_t LDB, dim_t LDC,
                       float beta, dim_t max_bs) {
                   return init_brgemm_kernel(desc, isa, src_type, weights_type,
@@ -1129,7 +1132,7 @@ static status_t init_kernels_diff_src(rnn_diff_src_brgemm_t &diff_src,
 
     const auto init_brgemm_diff_src
             = [&](x64::brgemm_desc_t *desc, x64::cpu_isa_t isa,
-                      std::unique_ptr<x64::brgemm_kernel_t> &ker, dim_t M,
+                      brgemm_ker_ptr_t &ker, dim_t M,
                       dim_t N, dim_t K, dim_t LDA, dim_t LDB, dim_t LDC,
                       float beta, dim_t max_bs) {
                   const dim_t A_size
@@ -1254,7 +1257,7 @@ static status_t init_kernels_diff_wei(rnn_diff_wei_brgemm_t &diff_wei,
 
     const auto init_brgemm_diff_wei
             = [&](x64::brgemm_desc_t *desc, x64::cpu_isa_t isa,
-                      std::unique_ptr<x64::brgemm_kernel_t> &ker, dim_t M,
+                      brgemm_ker_ptr_t &ker, dim_t M,
                       dim_t N, dim_t K, dim_t LDA, dim_t LDB, dim_t LDC,
                       float beta, dim_t max_bs) {
                   const dim_t A_size
@@ -41,7 +41,7 @@ struct jit_brgemm_trans_src_t;
 
 namespace rnn_brgemm_utils {
 
-using brgemm_ker_ptr_t = std::unique_ptr<brgemm_kernel_t>;
+using brgemm_ker_ptr_t = std::shared_ptr<brgemm_kernel_t>;
 using brgemm_pallete_t = char[64];
 using srcatch_gates_reorder_ker_ptr_t
         = std::unique_ptr<matmul::jit_brgemm_matmul_copy_b_t>;
@@ -48,6 +48,22 @@ const void *attr_params_t::get_scales(int arg) const {
     return nullptr;
 }
 
+status_t attr_params_t::set_zero_points(const void *zero_points, int arg) {
+    switch (arg) {
+        case DNNL_ARG_WEIGHTS: b_zero_points_ = zero_points; break;
+        default: assert(!"unsupported arg");
+    }
+    return status::success;
+}
+
+const void *attr_params_t::get_zero_points(int arg) const {
+    switch (arg) {
+        case DNNL_ARG_WEIGHTS: return b_zero_points_;
+        default: assert(!"unsupported arg");
+    }
+    return nullptr;
+}
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -83,6 +99,14 @@ status_t dnnl_ukernel_attr_params_set_B_scales(
     return status::success;
 }
 
+status_t dnnl_ukernel_attr_params_set_B_zero_points(
+        attr_params_t *attr_params, const void *b_zero_points) {
+    if (attr_params == nullptr) return status::invalid_arguments;
+
+    CHECK(attr_params->set_zero_points(b_zero_points, DNNL_ARG_WEIGHTS));
+    return status::success;
+}
+
 status_t dnnl_ukernel_attr_params_set_D_scales(
         attr_params_t *attr_params, const void *d_scales) {
     if (attr_params == nullptr) return status::invalid_arguments;
@@ -68,6 +68,12 @@ status_t brgemm_t::set_scales(int mask, int arg) {
     return status::success;
 }
 
+status_t brgemm_t::set_prefetch_distance(int A_distance, int B_distance) {
+    prf_A_distance_ = nstl::max(A_distance, -1);
+    prf_B_distance_ = nstl::max(B_distance, -1);
+    return status::success;
+}
+
 status_t brgemm_t::finalize() {
     brgemm_batch_kind_t batch_kind = brgemm_batch_kind_t::brgemm_offs;
 
@@ -80,6 +86,19 @@ status_t brgemm_t::finalize() {
         VCHECK_BRGEMM_STATUS(status, false, "brgemm_desc_init failed");
     }
 
+    if (brgemm_desc_.is_runtime_m) {
+        // Runtime M kernels are never AMX ones, B layout must still match the
+        // one reported by `get_B_pack_type` which doesn't know about M.
+        pack_type_t pack_type = pack_type::undef;
+        CHECK(get_B_pack_type(&pack_type, a_dt_, b_dt_));
+        const bool has_vnni_layout = brgemm_desc_t::is_b_data_layout_vnni(
+                a_dt_, b_dt_, /* brgattr.b_is_vnni = */ false,
+                brgemm_desc_.isa_impl);
+        VCHECK_BRGEMM_STATUS(status::unimplemented,
+                has_vnni_layout == (pack_type == pack_type::pack32),
+                "runtime M is not supported for this B layout");
+    }
+
     memory_desc_t D_md;
     dims_t dims {M_, N_};
     dims_t strides {ldc_, 1};
@@ -102,11 +121,15 @@ status_t brgemm_t::finalize() {
 
     brgemm_attr_t brgemm_attr;
     brgemm_attr.max_bs = batch_size_;
-    if (mayiuse(avx512_core_amx)) {
+    if (mayiuse(avx512_core_amx) && !brgemm_desc_.is_runtime_m) {
         brgemm_attr.use_uker = true;
         brgemm_attr.use_interleave_stores = true;
         brgemm_attr.hint_prefetching = brgemm_kernel_prefetching_t::brgemm_prf0;
     }
+    // Only the AMX unrolled kernel takes A and B prefetch distances into
+    // account, other kernels ignore them.
+    brgemm_attr.hint_prfA.dist1 = prf_A_distance_;
+    brgemm_attr.hint_prfB.dist1 = prf_B_distance_;
 
     status = brgemm_desc_set_attr(&brgemm_desc_, brgemm_attr);
     if (status != status::success) {
@@ -184,8 +207,27 @@ status_t brgemm_t::generate() {
     return status::success;
 }
 
+status_t brgemm_t::check_execute_M(dim_t M) const {
+    if (brgemm_desc_.is_runtime_m) {
+        VCHECK_BRGEMM_STATUS(status::invalid_arguments,
+                !is_runtime_value(M) && M >= 0,
+                "M must be a non-negative value passed at execution");
+    } else {
+        VCHECK_BRGEMM_STATUS(status::invalid_arguments,
+                is_runtime_value(M) || M == M_,
+                "M doesn't match the value passed at creation");
+    }
+    return status::success;
+}
+
 status_t brgemm_t::execute(const void *A_ptr, const void *B_ptr,
-        const dim_t *A_B_offsets, void *C_ptr, void *scratchpad_ptr) const {
+        const dim_t *A_B_offsets, void *C_ptr, void *scratchpad_ptr,
+        dim_t M) const {
+    CHECK(check_execute_M(M));
+    const brgemm_dynamic_values_t dynamic_values(lda_, ldb_, ldc_, ldd_, M);
+    const auto *dynamic_values_ptr
+            = brgemm_desc_.is_runtime_m ? &dynamic_values : nullptr;
+
     const auto batch_size = brgemm_desc_.brgattr.max_bs;
     std::vector<brgemm_batch_element_t> v_batch_element(batch_size);
     for (int i = 0; i < batch_size; i++) {
@@ -197,7 +239,7 @@ status_t brgemm_t::execute(const void *A_ptr, const void *B_ptr,
         double start_ms = get_msec();
         brgemm_kernel_execute(brgemm_kernel_, batch_size, A_ptr, B_ptr,
                 v_batch_element.data(), C_ptr, scratchpad_ptr,
-                /* dynamic_values = */ nullptr);
+                dynamic_values_ptr);
         double duration_ms = get_msec() - start_ms;
 
         stringstream_t ss;
@@ -207,20 +249,21 @@ status_t brgemm_t::execute(const void *A_ptr, const void *B_ptr,
     } else {
         brgemm_kernel_execute(brgemm_kernel_, batch_size, A_ptr, B_ptr,
                 v_batch_element.data(), C_ptr, scratchpad_ptr,
-                /* dynamic_values = */ nullptr);
+                dynamic_values_ptr);
     }
     return status::success;
 }
 
 status_t brgemm_t::execute(const void *A_ptr, const void *B_ptr,
         const dim_t *A_B_offsets, const void *C_ptr, void *D_ptr,
-        void *scratchpad_ptr, const attr_params_t *attr_params) const {
+        void *scratchpad_ptr, const attr_params_t *attr_params,
+        dim_t M) const {
     if (attr_params == nullptr) return status::invalid_arguments;
 
     if (!brgemm_desc_.are_post_ops_applicable()) {
         if (C_ptr == D_ptr) {
             return execute(A_ptr, B_ptr, A_B_offsets, const_cast<void *>(C_ptr),
-                    scratchpad_ptr);
+                    scratchpad_ptr, M);
         } else {
             VCHECK_BRGEMM_STATUS(status::runtime_error, false,
                     "the kernel won't return correct results with this "
@@ -228,6 +271,11 @@ status_t brgemm_t::execute(const void *A_ptr, const void *B_ptr,
         }
     }
 
+    CHECK(check_execute_M(M));
+    const brgemm_dynamic_values_t dynamic_values(lda_, ldb_, ldc_, ldd_, M);
+    const auto *dynamic_values_ptr
+            = brgemm_desc_.is_runtime_m ? &dynamic_values : nullptr;
+
     const auto batch_size = brgemm_desc_.brgattr.max_bs;
     std::vector<brgemm_batch_element_t> v_batch_element(batch_size);
     for (int i = 0; i < batch_size; i++) {
@@ -306,8 +354,7 @@ status_t brgemm_t::execute(const void *A_ptr, const void *B_ptr,
         double start_ms = get_msec();
         brgemm_kernel_execute_postops(brgemm_kernel_, batch_size, A_ptr, B_ptr,
                 v_batch_element.data(), const_cast<void *>(C_ptr), D_ptr,
-                post_ops_data, scratchpad_ptr,
-                /* dynamic_values = */ nullptr);
+                post_ops_data, scratchpad_ptr, dynamic_values_ptr);
         double duration_ms = get_msec() - start_ms;
 
         stringstream_t ss;
@@ -317,8 +364,7 @@ status_t brgemm_t::execute(const void *A_ptr, const void *B_ptr,
     } else {
         brgemm_kernel_execute_postops(brgemm_kernel_, batch_size, A_ptr, B_ptr,
                 v_batch_element.data(), const_cast<void *>(C_ptr), D_ptr,
-                post_ops_data, scratchpad_ptr,
-                /* dynamic_values = */ nullptr);
+                post_ops_data, scratchpad_ptr, dynamic_values_ptr);
     }
     return status::success;
 }
@@ -412,6 +458,14 @@ status_t dnnl_brgemm_set_D_scales(brgemm_t *brgemm, int d_scale_mask) {
     return status::success;
 }
 
+status_t dnnl_brgemm_set_prefetch_distance(
+        brgemm_t *brgemm, int A_distance, int B_distance) {
+    if (brgemm == nullptr) return status::invalid_arguments;
+
+    CHECK(brgemm->set_prefetch_distance(A_distance, B_distance));
+    return status::success;
+}
+
 status_t dnnl_brgemm_finalize(brgemm_t *brgemm) {
     if (brgemm == nullptr) return status::invalid_arguments;
 
@@ -478,6 +532,23 @@ status_t dnnl_brgemm_execute_postops(const brgemm_t *brgemm, const void *A_ptr,
     return status::success;
 }
 
+status_t dnnl_brgemm_execute_with_M(const brgemm_t *brgemm, dim_t M,
+        const void *A_ptr, const void *B_ptr, const dim_t *A_B_offsets,
+        void *C_ptr, void *scratchpad_ptr) {
+    CHECK(brgemm->execute(
+            A_ptr, B_ptr, A_B_offsets, C_ptr, scratchpad_ptr, M));
+    return status::success;
+}
+
+status_t dnnl_brgemm_execute_postops_with_M(const brgemm_t *brgemm, dim_t M,
+        const void *A_ptr, const void *B_ptr, const dim_t *A_B_offsets,
+        const void *C_ptr, void *D_ptr, void *scratchpad_ptr,
+        const attr_params_t *attr_params) {
+    CHECK(brgemm->execute(A_ptr, B_ptr, A_B_offsets, C_ptr, D_ptr,
+            scratchpad_ptr, attr_params, M));
+    return status::success;
+}
+
 status_t dnnl_brgemm_destroy(brgemm_t *brgemm) {
     delete brgemm;
     return status::success;
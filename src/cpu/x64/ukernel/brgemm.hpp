@@ -57,6 +57,8 @@ struct dnnl_brgemm : public dnnl::impl::c_compatible {
 
     dnnl::impl::status_t set_scales(int mask, int arg);
 
+    dnnl::impl::status_t set_prefetch_distance(int A_distance, int B_distance);
+
     dnnl::impl::status_t finalize();
 
     static dnnl::impl::status_t get_B_pack_type(
@@ -71,13 +73,17 @@ struct dnnl_brgemm : public dnnl::impl::c_compatible {
 
     dnnl::impl::status_t generate();
 
+    // `M` must be passed when the object was created with
+    // `DNNL_RUNTIME_DIM_VAL` as M, and is `DNNL_RUNTIME_DIM_VAL` otherwise.
     dnnl::impl::status_t execute(const void *A_ptr, const void *B_ptr,
             const dnnl::impl::dim_t *A_B_offsets, void *C_ptr,
-            void *scratchpad_ptr) const;
+            void *scratchpad_ptr,
+            dnnl::impl::dim_t M = DNNL_RUNTIME_DIM_VAL) const;
     dnnl::impl::status_t execute(const void *A_ptr, const void *B_ptr,
             const dnnl::impl::dim_t *A_B_offsets, const void *C_ptr,
             void *D_ptr, void *scratchpad_ptr,
-            const dnnl::impl::cpu::ukernel::attr_params_t *attr_params) const;
+            const dnnl::impl::cpu::ukernel::attr_params_t *attr_params,
+            dnnl::impl::dim_t M = DNNL_RUNTIME_DIM_VAL) const;
 
 private:
     // User's inputs.
@@ -85,6 +91,9 @@ private:
     dnnl::impl::dim_t lda_, ldb_, ldc_, ldd_;
     dnnl::impl::data_type_t a_dt_, b_dt_, c_dt_, d_dt_;
     float beta_;
+    // Software prefetch distances, negative values disable prefetching.
+    int prf_A_distance_ = -1;
+    int prf_B_distance_ = -1;
     // A copy of attributes to avoid dependency on user's attributes lifetime.
     dnnl::impl::primitive_attr_t attr_;
 
@@ -97,6 +106,9 @@ private:
     dnnl::impl::status_t create_verbose_info();
     std::string verbose_info_;
 
+    // Validates the number of rows passed at execution time.
+    dnnl::impl::status_t check_execute_M(dnnl::impl::dim_t M) const;
+
     bool palette_initialized_ = false;
     char palette_[dnnl::impl::cpu::x64::AMX_PALETTE_SIZE] = {};
 };
@@ -122,6 +134,9 @@ status_t dnnl_brgemm_set_B_scales(dnnl_brgemm *brgemm, int b_scale_mask);
 
 status_t dnnl_brgemm_set_D_scales(dnnl_brgemm *brgemm, int d_scale_mask);
 
+status_t dnnl_brgemm_set_prefetch_distance(
+        dnnl_brgemm *brgemm, int A_distance, int B_distance);
+
 status_t dnnl_brgemm_finalize(dnnl_brgemm *brgemm);
 
 status_t dnnl_brgemm_get_B_pack_type(
@@ -149,6 +164,15 @@ status_t dnnl_brgemm_execute_postops(const dnnl_brgemm *brgemm,
         const void *C_ptr, void *D_ptr, void *scratchpad_ptr,
         const dnnl_ukernel_attr_params *attr_params);
 
+status_t dnnl_brgemm_execute_with_M(const dnnl_brgemm *brgemm, dim_t M,
+        const void *A_ptr, const void *B_ptr, const dim_t *A_B_offsets,
+        void *C_ptr, void *scratchpad_ptr);
+
+status_t dnnl_brgemm_execute_postops_with_M(const dnnl_brgemm *brgemm, dim_t M,
+        const void *A_ptr, const void *B_ptr, const dim_t *A_B_offsets,
+        const void *C_ptr, void *D_ptr, void *scratchpad_ptr,
+        const dnnl_ukernel_attr_params *attr_params);
+
 status_t dnnl_brgemm_destroy(dnnl_brgemm *brgemm);
 
 } // namespace ukernel
@@ -14,8 +14,12 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstring>
+
 #include "common/verbose.hpp"
 
+#include "cpu/ref_io_helper.hpp"
+
 #include "cpu/x64/ukernel/transform.hpp"
 
 #ifdef DNNL_EXPERIMENTAL_UKERNEL
@@ -62,23 +66,198 @@ dnnl_transform::dnnl_transform(dim_t K, dim_t N, pack_type_t in_pack_type,
     }
 }
 
+dnnl_transform::dnnl_transform(dim_t M, dim_t K, pack_type_t in_pack_type,
+        dim_t in_ld, data_type_t dt)
+    : is_pack_A_(true)
+    , M_(M)
+    , K_(K)
+    , N_(0)
+    , in_ld_(in_ld)
+    , out_ld_(K)
+    , in_dt_(dt)
+    , out_dt_(dt) {
+    assert(in_pack_type == pack_type::no_trans ? in_ld_ >= K_ : in_ld_ >= M_);
+
+    if (in_pack_type == pack_type::trans) {
+        strides_[0] = 1;
+        strides_[1] = in_ld_;
+    } else if (in_pack_type == pack_type::no_trans) {
+        strides_[0] = in_ld_;
+        strides_[1] = 1;
+    } else {
+        assert(!"Unsupported pack type");
+    }
+}
+
+namespace {
+// Size of a dequantized block in bytes: the largest `K_blk` is 32 for 16-bit
+// output data types and the largest `out_ld` is 64.
+constexpr size_t dq_block_size = 4096;
+
+// Returns an offset of a scale or a zero point for a (k, n) point.
+dim_t quant_off(int mask, dim_t group_K, dim_t N, dim_t k, dim_t n) {
+    const dim_t k_idx = (mask & 1) ? k / group_K : 0;
+    return (mask & 2) ? k_idx * N + n : k_idx;
+}
+} // namespace
+
+status_t transform_t::set_scales(int mask, dim_t group_K) {
+    VCHECK_TRANSFORM(!is_pack_A_, "Scales are not supported for packing A.");
+    VCHECK_TRANSFORM(!generated_,
+            "Scales must be set before the transform is generated.");
+    VCHECK_TRANSFORM(mask >= 0 && mask <= 3, VERBOSE_BAD_PARAM, "mask");
+    VCHECK_TRANSFORM(IMPLICATION(mask & 1, group_K > 0 && K_ % group_K == 0),
+            VERBOSE_BAD_PARAM, "group_K");
+
+    scales_mask_ = mask;
+    scales_group_K_ = (mask & 1) ? group_K : K_;
+    return status::success;
+}
+
+status_t transform_t::set_zero_points(
+        int mask, dim_t group_K, data_type_t zp_dt) {
+    using namespace data_type;
+    VCHECK_TRANSFORM(
+            !is_pack_A_, "Zero points are not supported for packing A.");
+    VCHECK_TRANSFORM(!generated_,
+            "Zero points must be set before the transform is generated.");
+    VCHECK_TRANSFORM(mask >= 0 && mask <= 3, VERBOSE_BAD_PARAM, "mask");
+    VCHECK_TRANSFORM(IMPLICATION(mask & 1, group_K > 0 && K_ % group_K == 0),
+            VERBOSE_BAD_PARAM, "group_K");
+    VCHECK_TRANSFORM(utils::one_of(zp_dt, s32, s8, u8, s4, u4),
+            VERBOSE_UNSUPPORTED_DT);
+
+    zp_mask_ = mask;
+    zp_group_K_ = (mask & 1) ? group_K : K_;
+    zp_dt_ = zp_dt;
+    return status::success;
+}
+
+bool transform_t::req_dequantization() const {
+    return with_scales() || with_zero_points()
+            || (in_dt_ != out_dt_
+                    && utils::one_of(
+                            in_dt_, data_type::f8_e5m2, data_type::f8_e4m3));
+}
+
+void transform_t::dequantize_block(const void *src, const float *scales,
+        const void *zero_points, dim_t k, dim_t n, dim_t K_iters,
+        dim_t N_iters, void *block) const {
+    for (dim_t kk = 0; kk < K_iters; kk++) {
+        const dim_t k_idx = k + kk;
+        const dim_t src_off = k_idx * strides_[0] + n * strides_[1];
+        for (dim_t nn = 0; nn < N_iters; nn++) {
+            const dim_t n_idx = n + nn;
+            float v = cpu::io::load_float_value(
+                    in_dt_, src, src_off + nn * strides_[1]);
+            if (zero_points) {
+                const dim_t off
+                        = quant_off(zp_mask_, zp_group_K_, N_, k_idx, n_idx);
+                v -= cpu::io::load_int_value(zp_dt_, zero_points, off);
+            }
+            if (scales) {
+                v *= scales[quant_off(
+                        scales_mask_, scales_group_K_, N_, k_idx, n_idx)];
+            }
+            cpu::io::store_float_value(out_dt_, v, block, kk * out_ld_ + nn);
+        }
+    }
+}
+
 status_t transform_t::generate() {
     // Re-generation won't take any effect.
-    if (pack_B_kernel_ != nullptr) return status::success;
+    if (generated_) return status::success;
+
+    if (is_pack_A_) {
+        // The kernel transposes A blocks from K x M into M x K.
+        const bool use_kernel = strides_[0] == 1 && in_dt_ == data_type::f32
+                && mayiuse(avx2);
+        if (use_kernel) {
+            CHECK(matmul::init_conf(bmc_, /* batch = */ 1, M_, K_,
+                    /* N = */ 0, in_ld_, /* n_blk = */ 0, in_dt_, out_dt_,
+                    format_tag::ab));
+            CHECK(matmul::create_brgemm_matmul_copy_a(pack_A_kernel_, &bmc_));
+        }
+    } else if (req_dequantization()) {
+        using namespace data_type;
+        VCHECK_TRANSFORM(utils::one_of(out_dt_, f32, bf16, f16),
+                VERBOSE_UNSUPPORTED_DT);
+        VCHECK_TRANSFORM(utils::one_of(in_dt_, f32, bf16, f16, f8_e5m2,
+                                 f8_e4m3, s8, u8, s4, u4),
+                VERBOSE_UNSUPPORTED_DT);
+        // The kernel packs dequantized blocks which are already in the
+        // output data type and have `out_ld_` as a leading dimension.
+        CHECK(matmul::init_conf(bmc_, /* batch = */ 1, /* M = */ 0, K_, N_,
+                out_ld_, out_ld_, out_dt_, out_dt_, format_tag::ab));
+        const size_t max_block_size
+                = bmc_.K_blk * out_ld_ * types::data_type_size(out_dt_);
+        if (max_block_size > dq_block_size) return status::unimplemented;
+    }
 
-    CHECK(matmul::create_brgemm_matmul_copy_b(pack_B_kernel_, &bmc_));
+    if (!is_pack_A_)
+        CHECK(matmul::create_brgemm_matmul_copy_b(pack_B_kernel_, &bmc_));
 
     // Generate a verbose info string at the point where configuration is done.
     if (get_verbose(verbose_t::exec_profile, component_t::ukernel)) {
         CHECK(create_verbose_info());
     }
+    generated_ = true;
     return status::success;
 }
 
-status_t transform_t::execute(const void *src, void *dst) const {
-    double start_ms = 0;
-    if (get_verbose(verbose_t::exec_profile, component_t::ukernel))
-        start_ms = get_msec();
+void transform_t::pack_A(const void *src, void *dst) const {
+    const uint8_t *src_ptr = reinterpret_cast<const uint8_t *>(src);
+    uint8_t *dst_ptr = reinterpret_cast<uint8_t *>(dst);
+    const size_t dt_sz = types::data_type_size(in_dt_);
+
+    if (pack_A_kernel_) {
+        const auto &kernel_conf = bmc_;
+        for_(dim_t k = 0; k < K_; k += kernel_conf.K_blk)
+        for (dim_t m = 0; m < M_; m += kernel_conf.M_blk) {
+            auto ker_exec_ctx = matmul::jit_brgemm_matmul_copy_a_t::ctx_t();
+            ker_exec_ctx.current_K_blk = nstl::min(kernel_conf.K_blk, K_ - k);
+            ker_exec_ctx.current_M_blk = nstl::min(kernel_conf.M_blk, M_ - m);
+            ker_exec_ctx.src = &src_ptr[dt_sz * (k * in_ld_ + m)];
+            ker_exec_ctx.tr_src = &dst_ptr[dt_sz * (m * out_ld_ + k)];
+            (*pack_A_kernel_)(&ker_exec_ctx);
+        }
+        return;
+    }
+
+    if (strides_[1] == 1) {
+        // Rows are contiguous, only the leading dimension changes.
+        for (dim_t m = 0; m < M_; m++)
+            std::memcpy(&dst_ptr[dt_sz * m * out_ld_],
+                    &src_ptr[dt_sz * m * in_ld_], dt_sz * K_);
+        return;
+    }
+
+    // Transpose by blocks to keep both reads and writes in cache.
+    constexpr dim_t blk = 32;
+    for_(dim_t m0 = 0; m0 < M_; m0 += blk)
+    for_(dim_t k0 = 0; k0 < K_; k0 += blk)
+    for_(dim_t k = k0; k < nstl::min(k0 + blk, K_); k++)
+    for (dim_t m = m0; m < nstl::min(m0 + blk, M_); m++) {
+        std::memcpy(&dst_ptr[dt_sz * (m * out_ld_ + k)],
+                &src_ptr[dt_sz * (k * in_ld_ + m)], dt_sz);
+    }
+}
+
+status_t transform_t::pack_B(
+        const void *src, void *dst, const attr_params_t *attr_params) const {
+    const bool req_dq = req_dequantization();
+    const float *scales = with_scales() && attr_params
+            ? static_cast<const float *>(
+                    attr_params->get_scales(DNNL_ARG_WEIGHTS))
+            : nullptr;
+    const void *zero_points = with_zero_points() && attr_params
+            ? attr_params->get_zero_points(DNNL_ARG_WEIGHTS)
+            : nullptr;
+    VCHECK_TRANSFORM(IMPLICATION(with_scales(), scales != nullptr),
+            VERBOSE_NULL_ARG);
+    VCHECK_TRANSFORM(IMPLICATION(with_zero_points(), zero_points != nullptr),
+            VERBOSE_NULL_ARG);
+    alignas(64) uint8_t dq_block[dq_block_size];
 
     const uint8_t *src_ptr = reinterpret_cast<const uint8_t *>(src);
     uint8_t *dst_ptr = reinterpret_cast<uint8_t *>(dst);
@@ -98,38 +277,50 @@ status_t transform_t::execute(const void *src, void *dst) const {
         ker_exec_ctx.current_N_blk
                 = is_N_tail ? kernel_conf.N_tail : kernel_conf.N_blk;
 
-        int k_blk_idx = 0;
-        for (; k_blk_idx < kernel_conf.K / kernel_conf.K_blk; k_blk_idx++) {
-            const auto k = k_blk_idx * kernel_conf.K_blk;
-            const auto src_offset
-                    = i_dt_sz * (k * strides_[0] + n * strides_[1]);
-            const auto dst_offset
-                    = o_dt_sz * (k_blk_idx * blk_size + n_blk_idx * k_blks);
-            ker_exec_ctx.src = &src_ptr[src_offset];
-            ker_exec_ctx.tr_src = &dst_ptr[dst_offset];
-            ker_exec_ctx.current_K_start = k;
-            ker_exec_ctx.current_K_iters = kernel_conf.K_blk;
-            (*pack_B_kernel_)(&ker_exec_ctx);
-        }
-        if (kernel_conf.K_tail > 0) {
+        const auto pack_K_blk = [&](int k_blk_idx, dim_t K_iters) {
             const auto k = k_blk_idx * kernel_conf.K_blk;
-            const auto src_offset
-                    = i_dt_sz * (k * strides_[0] + n * strides_[1]);
             const auto dst_offset
                     = o_dt_sz * (k_blk_idx * blk_size + n_blk_idx * k_blks);
-            ker_exec_ctx.src = &src_ptr[src_offset];
+            if (req_dq) {
+                dequantize_block(src, scales, zero_points, k, n, K_iters,
+                        ker_exec_ctx.current_N_blk, dq_block);
+                ker_exec_ctx.src = dq_block;
+            } else {
+                const auto src_offset
+                        = i_dt_sz * (k * strides_[0] + n * strides_[1]);
+                ker_exec_ctx.src = &src_ptr[src_offset];
+            }
             ker_exec_ctx.tr_src = &dst_ptr[dst_offset];
             ker_exec_ctx.current_K_start = k;
-            ker_exec_ctx.current_K_iters = kernel_conf.K_tail;
+            ker_exec_ctx.current_K_iters = K_iters;
             (*pack_B_kernel_)(&ker_exec_ctx);
-        }
+        };
+
+        int k_blk_idx = 0;
+        for (; k_blk_idx < kernel_conf.K / kernel_conf.K_blk; k_blk_idx++)
+            pack_K_blk(k_blk_idx, kernel_conf.K_blk);
+        if (kernel_conf.K_tail > 0) pack_K_blk(k_blk_idx, kernel_conf.K_tail);
     }
+    return status::success;
+}
+
+status_t transform_t::execute(
+        const void *src, void *dst, const attr_params_t *attr_params) const {
+    double start_ms = 0;
+    if (get_verbose(verbose_t::exec_profile, component_t::ukernel))
+        start_ms = get_msec();
+
+    if (is_pack_A_)
+        pack_A(src, dst);
+    else
+        CHECK(pack_B(src, dst, attr_params));
 
     if (get_verbose(verbose_t::exec_profile, component_t::ukernel)) {
         double duration_ms = get_msec() - start_ms;
 
         stringstream_t ss;
-        ss << "cpu,transform,pack_B,undef," << verbose_info_;
+        ss << "cpu,transform," << (is_pack_A_ ? "pack_A" : "pack_B")
+           << ",undef," << verbose_info_;
         VPROF(start_ms, ukernel, exec, VERBOSE_profile, ss.str().c_str(),
                 duration_ms);
     }
@@ -144,7 +335,8 @@ status_t transform_t::create_verbose_info() {
     stringstream_t ss;
 
     memory_desc_t src_md;
-    const dims_t dims = {K_, N_};
+    // Packing A operates on an M x K matrix, packing B on a K x N one.
+    const dims_t dims = {is_pack_A_ ? M_ : K_, is_pack_A_ ? K_ : N_};
     CHECK(memory_desc_init_by_strides(src_md, 2, dims, in_dt_, strides_));
 
     memory_desc_t dst_md;
@@ -177,6 +369,40 @@ status_t dnnl_transform_create(transform_t **transform, dim_t K, dim_t N,
     return status::success;
 }
 
+status_t dnnl_transform_create_pack_A(transform_t **transform, dim_t M,
+        dim_t K, pack_type_t in_pack_type, dim_t in_ld, data_type_t dt) {
+    if (transform == nullptr) return status::invalid_arguments;
+    VCHECK_TRANSFORM(M > 0 && K > 0, VERBOSE_BAD_PARAM, "M or K");
+    VCHECK_TRANSFORM(
+            utils::one_of(in_pack_type, pack_type::no_trans, pack_type::trans),
+            VERBOSE_BAD_PARAM, "in_pack_type");
+    VCHECK_TRANSFORM(in_ld >= (in_pack_type == pack_type::trans ? M : K),
+            VERBOSE_BAD_PARAM, "in_ld");
+    VCHECK_TRANSFORM(types::data_type_size(dt) > 0
+                    && !utils::one_of(dt, data_type::s4, data_type::u4,
+                            data_type::f4_e2m1, data_type::f4_e3m0),
+            VERBOSE_UNSUPPORTED_DT);
+
+    *transform = new transform_t(M, K, in_pack_type, in_ld, dt);
+    return status::success;
+}
+
+status_t dnnl_transform_set_scales(
+        transform_t *transform, int mask, dim_t group_K) {
+    if (transform == nullptr) return status::invalid_arguments;
+
+    CHECK(transform->set_scales(mask, group_K));
+    return status::success;
+}
+
+status_t dnnl_transform_set_zero_points(
+        transform_t *transform, int mask, dim_t group_K, data_type_t zp_dt) {
+    if (transform == nullptr) return status::invalid_arguments;
+
+    CHECK(transform->set_zero_points(mask, group_K, zp_dt));
+    return status::success;
+}
+
 status_t dnnl_transform_generate(transform_t *transform) {
     if (transform == nullptr) return status::invalid_arguments;
 
@@ -193,6 +419,15 @@ status_t dnnl_transform_execute(
     return status::success;
 }
 
+status_t dnnl_transform_execute_with_params(const transform_t *transform,
+        const void *in_ptr, void *out_ptr, const attr_params_t *attr_params) {
+    if (utils::any_null(transform, in_ptr, out_ptr, attr_params))
+        return status::invalid_arguments;
+
+    CHECK(transform->execute(in_ptr, out_ptr, attr_params));
+    return status::success;
+}
+
 status_t dnnl_transform_destroy(transform_t *transform) {
     delete transform;
     return status::success;
@@ -23,6 +23,7 @@
 
 #include "cpu/x64/matmul/brgemm_matmul_copy_utils.hpp"
 #include "cpu/x64/matmul/brgemm_matmul_utils.hpp"
+#include "cpu/x64/ukernel/attr_params.hpp"
 
 #ifdef DNNL_EXPERIMENTAL_UKERNEL
 
@@ -33,27 +34,70 @@ struct dnnl_transform : public dnnl::impl::c_compatible {
             dnnl::impl::dim_t in_ld, dnnl::impl::dim_t out_ld,
             dnnl::impl::data_type_t in_dt, dnnl::impl::data_type_t out_dt);
 
+    // Ctor for packing A: the output is a row-major M x K matrix with the
+    // leading dimension equal to K.
+    dnnl_transform(dnnl::impl::dim_t M, dnnl::impl::dim_t K,
+            dnnl::impl::cpu::ukernel::pack_type_t in_pack_type,
+            dnnl::impl::dim_t in_ld, dnnl::impl::data_type_t dt);
+
+    // Sets scales and zero points to dequantize the input with before
+    // packing. Must be called before `generate()`.
+    dnnl::impl::status_t set_scales(int mask, dnnl::impl::dim_t group_K);
+    dnnl::impl::status_t set_zero_points(int mask, dnnl::impl::dim_t group_K,
+            dnnl::impl::data_type_t zp_dt);
+
     // Generates a transform kernel.
     dnnl::impl::status_t generate();
 
-    // Executes a transform kernel.
-    dnnl::impl::status_t execute(const void *src, void *dst) const;
+    // Executes a transform kernel. Scales and zero points, if set, are taken
+    // from `attr_params`.
+    dnnl::impl::status_t execute(const void *src, void *dst,
+            const dnnl_ukernel_attr_params *attr_params = nullptr) const;
+
+    bool with_scales() const { return scales_mask_ >= 0; }
+    bool with_zero_points() const { return zp_mask_ >= 0; }
 
 private:
     // User's inputs.
-    dnnl::impl::dim_t K_, N_;
+    bool is_pack_A_ = false;
+    dnnl::impl::dim_t M_ = 0, K_, N_;
     dnnl::impl::dim_t in_ld_, out_ld_;
     dnnl::impl::data_type_t in_dt_, out_dt_;
     // Save `strides_` for `execute` to get proper source offset.
     dnnl::impl::dims_t strides_ {};
+    // Dequantization parameters. A negative mask means no parameter.
+    int scales_mask_ = -1;
+    dnnl::impl::dim_t scales_group_K_ = 1;
+    int zp_mask_ = -1;
+    dnnl::impl::dim_t zp_group_K_ = 1;
+    dnnl::impl::data_type_t zp_dt_ = dnnl::impl::data_type::undef;
+
+    // Inputs with scales or zero points, as well as upconverted fp8 inputs,
+    // aren't supported by the packing kernels directly. Such inputs are
+    // dequantized block by block into a small buffer in the output data type
+    // which the kernel packs right after, while the block is hot in cache.
+    bool req_dequantization() const;
+    void dequantize_block(const void *src, const float *scales,
+            const void *zero_points, dnnl::impl::dim_t k,
+            dnnl::impl::dim_t n, dnnl::impl::dim_t K_iters,
+            dnnl::impl::dim_t N_iters, void *block) const;
 
     // A transform kernel.
     // Note: though it's a generic class for any kind of transformation, so far
-    // it's only matmul's copy_B.
+    // it's only matmul's copy_B and copy_A.
     dnnl::impl::cpu::x64::matmul::brgemm_matmul_conf_t bmc_;
     // `unique_ptr` is required by API that generates a kernel.
     std::unique_ptr<dnnl::impl::cpu::x64::matmul::jit_brgemm_matmul_copy_b_t>
             pack_B_kernel_;
+    // Only f32 transposed A has a kernel, the rest is copied by a reference
+    // routine.
+    std::unique_ptr<dnnl::impl::cpu::x64::matmul::jit_brgemm_matmul_copy_a_t>
+            pack_A_kernel_;
+    bool generated_ = false;
+
+    void pack_A(const void *src, void *dst) const;
+    dnnl::impl::status_t pack_B(const void *src, void *dst,
+            const dnnl_ukernel_attr_params *attr_params) const;
 
     // Creates a `verbose_info_` string once during `generate()` call, and calls
     // it during execute(). This is done to avoid string re-creation.
@@ -71,11 +115,25 @@ status_t dnnl_transform_create(dnnl_transform **transform, dim_t K, dim_t N,
         dnnl::impl::cpu::ukernel::pack_type_t in_pack_type, dim_t in_ld,
         dim_t out_ld, data_type_t in_dt, data_type_t out_dt);
 
+status_t dnnl_transform_create_pack_A(dnnl_transform **transform, dim_t M,
+        dim_t K, dnnl::impl::cpu::ukernel::pack_type_t in_pack_type,
+        dim_t in_ld, data_type_t dt);
+
+status_t dnnl_transform_set_scales(
+        dnnl_transform *transform, int mask, dim_t group_K);
+
+status_t dnnl_transform_set_zero_points(
+        dnnl_transform *transform, int mask, dim_t group_K, data_type_t zp_dt);
+
 status_t dnnl_transform_generate(dnnl_transform *transform);
 
 status_t dnnl_transform_execute(
         const dnnl_transform *transform, const void *in_ptr, void *out_ptr);
 
+status_t dnnl_transform_execute_with_params(const dnnl_transform *transform,
+        const void *in_ptr, void *out_ptr,
+        const dnnl_ukernel_attr_params *attr_params);
+
 status_t dnnl_transform_destroy(dnnl_transform *transform);
 
 } // namespace ukernel
@@ -66,6 +66,25 @@ status_t engine_t::set_rocblas_handle() {
     return status::success;
 }
 
+#ifdef DNNL_AMD_ENABLE_HIPBLASLT
+status_t engine_t::set_hipblaslt_handle() {
+    // scoped context will make sure the top of the stack context is
+    // the engine context while creating the hipblaslt handle.
+    hip_sycl_scoped_context_handler_t sc(*this);
+    hipblasLtHandle_t handle;
+    CHECK(HIPBLASLT_EXECUTE_FUNC_S(hipblasLtCreate, &handle));
+    hipblaslt_handle_.set(
+            std::unique_ptr<hipblasLtHandle_t, void (*)(hipblasLtHandle_t *)>(
+                    new hipblasLtHandle_t(handle), [](hipblasLtHandle_t *h) {
+                        if (h != nullptr)
+                            HIPBLASLT_EXECUTE_FUNC_V(hipblasLtDestroy, *h);
+                        delete h;
+                    }));
+    handle = nullptr;
+    return status::success;
+}
+#endif
+
 status_t engine_t::set_miopen_handle() {
     // scoped context will make sure the top of the stack context is
     // the engine context while creating the miopen handle.
@@ -105,6 +124,15 @@ rocblas_handle *engine_t::get_rocblas_handle() {
     return rocblas_handle_.get().get();
 }
 
+#ifdef DNNL_AMD_ENABLE_HIPBLASLT
+// The hipBLASLt handle is not bound to a stream, the stream is passed to
+// every call instead.
+hipblasLtHandle_t *engine_t::get_hipblaslt_handle() {
+    if (!hipblaslt_handle_.is_set()) set_hipblaslt_handle();
+    return hipblaslt_handle_.get().get();
+}
+#endif
+
 void engine_t::activate_stream_rocblas(HIPstream hip_stream) {
     hip_sycl_scoped_context_handler_t sc(*this);
     hipStream_t current_stream_id = nullptr;
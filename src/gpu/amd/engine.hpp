@@ -23,6 +23,9 @@
 #include <hip/hip_runtime.h>
 #include <miopen/miopen.h>
 #include <rocblas/rocblas.h>
+#ifdef DNNL_AMD_ENABLE_HIPBLASLT
+#include <hipblaslt/hipblaslt.h>
+#endif
 
 #include "common/stream.hpp"
 #include "common/thread_local_storage.hpp"
@@ -59,6 +62,9 @@ public:
     hipDevice_t get_underlying_device() const;
     miopenHandle_t *get_miopen_handle();
     rocblas_handle *get_rocblas_handle();
+#ifdef DNNL_AMD_ENABLE_HIPBLASLT
+    hipblasLtHandle_t *get_hipblaslt_handle();
+#endif
     const bool has_primary_context() const { return primary_context_; }
 
     bool mayiuse_system_memory_allocators() const override {
@@ -83,6 +89,12 @@ private:
     utils::thread_local_storage_t<
             std::unique_ptr<rocblas_handle, void (*)(rocblas_handle *)>>
             rocblas_handle_;
+#ifdef DNNL_AMD_ENABLE_HIPBLASLT
+    status_t set_hipblaslt_handle();
+    utils::thread_local_storage_t<std::unique_ptr<hipblasLtHandle_t,
+            void (*)(hipblasLtHandle_t *)>>
+            hipblaslt_handle_;
+#endif
     bool primary_context_;
 };
 
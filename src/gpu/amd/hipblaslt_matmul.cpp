@@ -0,0 +1,65 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gpu/amd/hipblaslt_matmul.hpp"
+
+#include "common/c_types_map.hpp"
+#include "common/type_helpers.hpp"
+
+#include "gpu/amd/engine.hpp"
+#include "gpu/amd/stream.hpp"
+#include "gpu/amd/sycl_hip_scoped_context.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace amd {
+
+status_t hipblaslt_matmul_t::execute(const exec_ctx_t &ctx) const {
+    if (pd()->has_zero_dim_memory()) return status::success;
+
+    amd::stream_t *hip_stream = utils::downcast<amd::stream_t *>(ctx.stream());
+    const auto matmul_impl = pd()->matmul_impl_;
+
+    return hip_stream->interop_task([&](::sycl::handler &cgh) {
+        auto arg_wei = CTX_IN_SYCL_MEMORY(DNNL_ARG_WEIGHTS);
+        auto arg_src = CTX_IN_SYCL_MEMORY(DNNL_ARG_SRC);
+        auto arg_bias = CTX_IN_SYCL_MEMORY(DNNL_ARG_BIAS);
+        auto arg_dst = CTX_OUT_SYCL_MEMORY(DNNL_ARG_DST);
+        auto arg_scratch = CTX_SCRATCH_SYCL_MEMORY(
+                memory_tracking::names::key_matmul_lt_algo_scratch);
+
+        compat::host_task(cgh, [=](const compat::interop_handle &ih) {
+            auto &sycl_engine
+                    = *utils::downcast<amd::engine_t *>(hip_stream->engine());
+            auto sc = hip_sycl_scoped_context_handler_t(sycl_engine);
+            auto native_stream = hip_stream->get_underlying_stream();
+            auto handle = *sycl_engine.get_hipblaslt_handle();
+
+            matmul_impl->execute(handle, native_stream,
+                    arg_wei.get_native_pointer(ih),
+                    arg_src.get_native_pointer(ih),
+                    arg_dst.get_native_pointer(ih),
+                    arg_bias.get_native_pointer(ih),
+                    arg_scratch.get_native_pointer(ih));
+        });
+    });
+}
+
+} // namespace amd
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,127 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GPU_AMD_HIPBLASLT_MATMUL_HPP
+#define GPU_AMD_HIPBLASLT_MATMUL_HPP
+
+#include <memory>
+
+#include "common/matmul_pd.hpp"
+
+#include "gpu/gpu_primitive.hpp"
+
+#include "gpu/amd/hipblaslt_matmul_impl.hpp"
+#include "gpu/amd/sycl_hip_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace amd {
+
+struct hipblaslt_matmul_t : public gpu::primitive_t {
+    using gpu::primitive_t::primitive_t;
+    struct pd_t : public matmul_pd_t {
+        using matmul_pd_t::matmul_pd_t;
+
+        DECLARE_COMMON_PD_T("hip:hipblaslt:any", hipblaslt_matmul_t);
+
+        status_t init(impl::engine_t *engine) {
+            using namespace data_type;
+            using smask_t = primitive_attr_t::skip_mask_t;
+
+            data_type_t src_dt = src_md()->data_type;
+            data_type_t dst_dt = dst_md()->data_type;
+            data_type_t wei_dt = weights_md(0)->data_type;
+            data_type_t bia_dt
+                    = with_bias() ? weights_md(1)->data_type : data_type::f32;
+
+            bool f32_case = utils::everyone_is(f32, src_dt, wei_dt, dst_dt);
+            bool f16_case = utils::everyone_is(f16, src_dt, wei_dt)
+                    && utils::one_of(dst_dt, f16, f32);
+            bool bf16_case = utils::everyone_is(bf16, src_dt, wei_dt)
+                    && utils::one_of(dst_dt, bf16, f32);
+
+            bool ok = (f32_case || f16_case || bf16_case)
+                    && IMPLICATION(
+                            with_bias(), utils::one_of(bia_dt, f32, dst_dt))
+                    && attr()->has_default_values(smask_t::post_ops)
+                    && attr_post_ops_ok()
+                    && utils::one_of(dst_md()->ndims, 2, 3)
+                    && set_default_formats() && blocking_ok()
+                    && IMPLICATION(with_bias(), bias_ok());
+            if (!ok) return status::unimplemented;
+
+            matmul_impl_.reset(new hipblaslt_matmul_impl_t());
+            return matmul_impl_->init(engine, this);
+        }
+
+        std::shared_ptr<hipblaslt_matmul_impl_t> matmul_impl_;
+
+    private:
+        // hipBLASLt fuses relu and the tanh approximation of gelu only.
+        bool attr_post_ops_ok() const {
+            using namespace primitive_kind;
+            const auto &p = attr()->post_ops_;
+            const int eltwise_idx = p.find(eltwise);
+
+            if (eltwise_idx != -1) {
+                using namespace alg_kind;
+                const auto &e = p.entry_[eltwise_idx].eltwise;
+                const bool ok = (e.alg == eltwise_relu && e.alpha == 0.f)
+                        || (e.alg == eltwise_gelu_tanh && e.scale == 1.f);
+                if (!ok) return false;
+            }
+
+            switch (p.len()) {
+                case 0: return true;
+                case 1: return p.contain(sum, 0) || p.contain(eltwise, 0);
+                case 2: return p.contain(sum, 0) && p.contain(eltwise, 1);
+                default: return false;
+            }
+        }
+
+        bool blocking_ok() const {
+            for (const memory_desc_t *md :
+                    {src_md(), weights_md(0), dst_md()}) {
+                memory_desc_wrapper mdw(md);
+                if (!mdw.is_plain()) return false;
+            }
+            return true;
+        }
+
+        // The epilogue bias is a dense vector along N.
+        bool bias_ok() const {
+            const memory_desc_wrapper bia_d(weights_md(1));
+            const int ndims = bia_d.ndims();
+            for (int d = 0; d < ndims - 1; d++)
+                if (bia_d.dims()[d] != 1) return false;
+            return bia_d.is_plain()
+                    && bia_d.blocking_desc().strides[ndims - 1] == 1;
+        }
+    };
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace amd
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
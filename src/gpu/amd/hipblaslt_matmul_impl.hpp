@@ -0,0 +1,247 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GPU_AMD_HIPBLASLT_MATMUL_IMPL_HPP
+#define GPU_AMD_HIPBLASLT_MATMUL_IMPL_HPP
+
+#include "common/matmul_pd.hpp"
+
+#include "gpu/amd/engine.hpp"
+#include "gpu/amd/sycl_hip_scoped_context.hpp"
+#include "gpu/amd/sycl_hip_utils.hpp"
+
+#include <hipblaslt/hipblaslt.h>
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace amd {
+
+// Matmul on hipBLASLt. oneDNN matrices are row-major, so the column-major
+// product dst^T = wei^T * src^T is computed: A is the weights, B is the
+// source and C/D is the destination. The bias and the activation are fused
+// into the gemm as epilogues and the sum post-op uses beta.
+struct hipblaslt_matmul_impl_t {
+    // Upper bound of the workspace the algorithm heuristics can pick from.
+    static constexpr size_t max_workspace_size = size_t(32) << 20;
+
+    ~hipblaslt_matmul_impl_t() { cleanup(); }
+
+    status_t init(impl::engine_t *engine, matmul_pd_t *pd) {
+        const memory_desc_wrapper src_d(pd->src_md());
+        const memory_desc_wrapper wei_d(pd->weights_md(0));
+        const memory_desc_wrapper dst_d(pd->dst_md());
+        const int ndims = dst_d.ndims();
+        const bool batched = ndims == 3;
+
+        hipDataType src_type, wei_type, dst_type;
+        CHECK(get_hip_data_type(src_d.data_type(), src_type));
+        CHECK(get_hip_data_type(wei_d.data_type(), wei_type));
+        CHECK(get_hip_data_type(dst_d.data_type(), dst_type));
+
+        const int64_t M = dst_d.dims()[ndims - 2];
+        const int64_t N = dst_d.dims()[ndims - 1];
+        const int64_t K = src_d.dims()[ndims - 1];
+        const int64_t batch = batched ? dst_d.dims()[0] : 1;
+
+        const auto &src_s = src_d.blocking_desc().strides;
+        const auto &wei_s = wei_d.blocking_desc().strides;
+        const auto &dst_s = dst_d.blocking_desc().strides;
+        if (dst_s[ndims - 1] != 1) return status::unimplemented;
+
+        // The weights are K x N row-major, i.e. N x K column-major.
+        hipblasOperation_t trans_a, trans_b;
+        int64_t lda, ldb;
+        if (wei_s[ndims - 1] == 1) {
+            trans_a = HIPBLAS_OP_N;
+            lda = nstl::max(wei_s[ndims - 2], N);
+        } else if (wei_s[ndims - 2] == 1) {
+            trans_a = HIPBLAS_OP_T;
+            lda = nstl::max(wei_s[ndims - 1], K);
+        } else
+            return status::unimplemented;
+        // The source is M x K row-major, i.e. K x M column-major.
+        if (src_s[ndims - 1] == 1) {
+            trans_b = HIPBLAS_OP_N;
+            ldb = nstl::max(src_s[ndims - 2], K);
+        } else if (src_s[ndims - 2] == 1) {
+            trans_b = HIPBLAS_OP_T;
+            ldb = nstl::max(src_s[ndims - 1], M);
+        } else
+            return status::unimplemented;
+        const int64_t ldc = nstl::max(dst_s[ndims - 2], N);
+
+        CHECK(create_layout(a_desc_, wei_type, trans_a == HIPBLAS_OP_N ? N : K,
+                trans_a == HIPBLAS_OP_N ? K : N, lda, batch,
+                batched && wei_d.dims()[0] > 1 ? wei_s[0] : 0));
+        CHECK(create_layout(b_desc_, src_type, trans_b == HIPBLAS_OP_N ? K : M,
+                trans_b == HIPBLAS_OP_N ? M : K, ldb, batch,
+                batched && src_d.dims()[0] > 1 ? src_s[0] : 0));
+        CHECK(create_layout(
+                c_desc_, dst_type, N, M, ldc, batch, batched ? dst_s[0] : 0));
+
+        CHECK(HIPBLASLT_EXECUTE_FUNC_S(hipblasLtMatmulDescCreate, &op_desc_,
+                HIPBLAS_COMPUTE_32F, HIP_R_32F));
+        CHECK(set_desc_attr(HIPBLASLT_MATMUL_DESC_TRANSA, trans_a));
+        CHECK(set_desc_attr(HIPBLASLT_MATMUL_DESC_TRANSB, trans_b));
+        CHECK(init_epilogue(pd));
+
+        auto *amd_engine = utils::downcast<amd::engine_t *>(engine);
+        hip_sycl_scoped_context_handler_t sc(*amd_engine);
+        CHECK(init_algo(*amd_engine->get_hipblaslt_handle()));
+
+        if (workspace_size_ > 0) {
+            pd->scratchpad_registry().registrar().book(
+                    memory_tracking::names::key_matmul_lt_algo_scratch,
+                    workspace_size_, size_t(1));
+        }
+        return status::success;
+    }
+
+    bool with_bias() const { return with_bias_; }
+    size_t workspace_size() const { return workspace_size_; }
+
+    void execute(hipblasLtHandle_t handle, hipStream_t stream, void *weights,
+            void *src, void *dst, void *bias, void *workspace) {
+        // The bias pointer is only known at execution.
+        if (with_bias_) {
+            HIPBLASLT_EXECUTE_FUNC(hipblasLtMatmulDescSetAttribute, op_desc_,
+                    HIPBLASLT_MATMUL_DESC_BIAS_POINTER, &bias, sizeof(bias));
+        }
+        HIPBLASLT_EXECUTE_FUNC(hipblasLtMatmul, handle, op_desc_, &alpha_,
+                weights, a_desc_, src, b_desc_, &beta_, dst, c_desc_, dst,
+                c_desc_, &algo_, workspace, workspace_size_, stream);
+    }
+
+    void cleanup() {
+        if (op_desc_) {
+            HIPBLASLT_EXECUTE_FUNC_V(hipblasLtMatmulDescDestroy, op_desc_);
+            op_desc_ = nullptr;
+        }
+        for (auto *layout : {&a_desc_, &b_desc_, &c_desc_}) {
+            if (*layout) {
+                HIPBLASLT_EXECUTE_FUNC_V(hipblasLtMatrixLayoutDestroy, *layout);
+                *layout = nullptr;
+            }
+        }
+    }
+
+private:
+    status_t get_hip_data_type(data_type_t data_type, hipDataType &hip_dt) {
+        switch (data_type) {
+            case data_type::f32: hip_dt = HIP_R_32F; return status::success;
+            case data_type::f16: hip_dt = HIP_R_16F; return status::success;
+            case data_type::bf16: hip_dt = HIP_R_16BF; return status::success;
+            default: return status::unimplemented;
+        }
+    }
+
+    template <typename T>
+    status_t set_desc_attr(hipblasLtMatmulDescAttributes_t attr, const T &v) {
+        return HIPBLASLT_EXECUTE_FUNC_S(hipblasLtMatmulDescSetAttribute,
+                op_desc_, attr, &v, sizeof(v));
+    }
+
+    status_t create_layout(hipblasLtMatrixLayout_t &layout, hipDataType dt,
+            int64_t rows, int64_t cols, int64_t ld, int64_t batch,
+            int64_t batch_stride) {
+        CHECK(HIPBLASLT_EXECUTE_FUNC_S(
+                hipblasLtMatrixLayoutCreate, &layout, dt, rows, cols, ld));
+        if (batch == 1) return status::success;
+        const int32_t batch_count = (int32_t)batch;
+        CHECK(HIPBLASLT_EXECUTE_FUNC_S(hipblasLtMatrixLayoutSetAttribute,
+                layout, HIPBLASLT_MATRIX_LAYOUT_BATCH_COUNT, &batch_count,
+                sizeof(batch_count)));
+        CHECK(HIPBLASLT_EXECUTE_FUNC_S(hipblasLtMatrixLayoutSetAttribute,
+                layout, HIPBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET,
+                &batch_stride, sizeof(batch_stride)));
+        return status::success;
+    }
+
+    status_t init_epilogue(const matmul_pd_t *pd) {
+        using namespace primitive_kind;
+        const auto &po = pd->attr()->post_ops_;
+        const int sum_idx = po.find(sum);
+        const int eltwise_idx = po.find(eltwise);
+        if (sum_idx != -1) beta_ = po.entry_[sum_idx].sum.scale;
+
+        with_bias_ = pd->with_bias();
+        const bool with_relu = eltwise_idx != -1
+                && po.entry_[eltwise_idx].eltwise.alg == alg_kind::eltwise_relu;
+        const bool with_gelu = eltwise_idx != -1 && !with_relu;
+
+        hipblasLtEpilogue_t epilogue = HIPBLASLT_EPILOGUE_DEFAULT;
+        if (with_relu)
+            epilogue = with_bias_ ? HIPBLASLT_EPILOGUE_RELU_BIAS
+                                  : HIPBLASLT_EPILOGUE_RELU;
+        else if (with_gelu)
+            epilogue = with_bias_ ? HIPBLASLT_EPILOGUE_GELU_BIAS
+                                  : HIPBLASLT_EPILOGUE_GELU;
+        else if (with_bias_)
+            epilogue = HIPBLASLT_EPILOGUE_BIAS;
+        CHECK(set_desc_attr(HIPBLASLT_MATMUL_DESC_EPILOGUE, epilogue));
+
+        if (with_bias_) {
+            hipDataType bias_type;
+            CHECK(get_hip_data_type(pd->weights_md(1)->data_type, bias_type));
+            CHECK(set_desc_attr(
+                    HIPBLASLT_MATMUL_DESC_BIAS_DATA_TYPE, bias_type));
+        }
+        return status::success;
+    }
+
+    status_t init_algo(hipblasLtHandle_t handle) {
+        hipblasLtMatmulPreference_t pref;
+        CHECK(HIPBLASLT_EXECUTE_FUNC_S(hipblasLtMatmulPreferenceCreate, &pref));
+        const uint64_t max_ws = max_workspace_size;
+        status_t status = HIPBLASLT_EXECUTE_FUNC_S(
+                hipblasLtMatmulPreferenceSetAttribute, pref,
+                HIPBLASLT_MATMUL_PREF_MAX_WORKSPACE_BYTES, &max_ws,
+                sizeof(max_ws));
+
+        hipblasLtMatmulHeuristicResult_t result = {};
+        int n_results = 0;
+        if (status == status::success)
+            status = HIPBLASLT_EXECUTE_FUNC_S(hipblasLtMatmulAlgoGetHeuristic,
+                    handle, op_desc_, a_desc_, b_desc_, c_desc_, c_desc_, pref,
+                    1, &result, &n_results);
+        HIPBLASLT_EXECUTE_FUNC_V(hipblasLtMatmulPreferenceDestroy, pref);
+        CHECK(status);
+        // No algorithm for the problem or the device.
+        if (n_results == 0) return status::unimplemented;
+
+        algo_ = result.algo;
+        workspace_size_ = result.workspaceSize;
+        return status::success;
+    }
+
+    hipblasLtMatmulDesc_t op_desc_ = nullptr;
+    hipblasLtMatrixLayout_t a_desc_ = nullptr;
+    hipblasLtMatrixLayout_t b_desc_ = nullptr;
+    hipblasLtMatrixLayout_t c_desc_ = nullptr;
+    hipblasLtMatmulAlgo_t algo_ = {};
+    size_t workspace_size_ = 0;
+    bool with_bias_ = false;
+    float alpha_ = 1.f;
+    float beta_ = 0.f;
+};
+
+} // namespace amd
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -44,7 +44,7 @@ struct miopen_softmax_fwd_t : public gpu::primitive_t {
         status_t init(impl::engine_t *) {
             const memory_desc_wrapper src_d(src_md());
             const memory_desc_wrapper dst_d(dst_md());
-            bool ok = is_fwd()
+            bool ok = is_fwd() && !with_attn_preprocessing()
                     && utils::one_of(
                             src_d.data_type(), data_type::f32, data_type::f16)
                     && attr()->has_default_values()
@@ -22,6 +22,9 @@
 #include "miopen/miopen.h"
 #include <hip/hip_runtime.h>
 #include <rocblas/rocblas.h>
+#ifdef DNNL_AMD_ENABLE_HIPBLASLT
+#include <hipblaslt/hipblaslt.h>
+#endif
 
 #include "dnnl_sycl.h"
 
@@ -242,6 +245,55 @@ inline status_t rocblas_to_dnnl_status(rocblas_status rocblas_status) {
     }
 }
 
+#ifdef DNNL_AMD_ENABLE_HIPBLASLT
+class hipblaslt_error : virtual public std::runtime_error {
+
+protected:
+    const char *hipblaslt_error_map(hipblasStatus_t error) {
+        switch (error) {
+            case HIPBLAS_STATUS_SUCCESS: return "HIPBLAS_STATUS_SUCCESS";
+            case HIPBLAS_STATUS_NOT_INITIALIZED:
+                return "HIPBLAS_STATUS_NOT_INITIALIZED";
+            case HIPBLAS_STATUS_ALLOC_FAILED:
+                return "HIPBLAS_STATUS_ALLOC_FAILED";
+            case HIPBLAS_STATUS_INVALID_VALUE:
+                return "HIPBLAS_STATUS_INVALID_VALUE";
+            case HIPBLAS_STATUS_ARCH_MISMATCH:
+                return "HIPBLAS_STATUS_ARCH_MISMATCH";
+            case HIPBLAS_STATUS_EXECUTION_FAILED:
+                return "HIPBLAS_STATUS_EXECUTION_FAILED";
+            case HIPBLAS_STATUS_INTERNAL_ERROR:
+                return "HIPBLAS_STATUS_INTERNAL_ERROR";
+            case HIPBLAS_STATUS_NOT_SUPPORTED:
+                return "HIPBLAS_STATUS_NOT_SUPPORTED";
+            default: return "<unknown>";
+        }
+    }
+
+    int error_number_;
+
+public:
+    explicit hipblaslt_error(const std::string &message, hipblasStatus_t result)
+        : std::runtime_error(
+                (message + std::string(hipblaslt_error_map(result)))) {
+        error_number_ = static_cast<int>(result);
+    }
+
+    virtual ~hipblaslt_error() throw() {}
+
+    virtual int get_error_number() const throw() { return error_number_; }
+};
+
+inline status_t hipblaslt_to_dnnl_status(hipblasStatus_t hipblas_status) {
+    switch (hipblas_status) {
+        case HIPBLAS_STATUS_SUCCESS: return status::success;
+        case HIPBLAS_STATUS_INVALID_VALUE: return status::invalid_arguments;
+        case HIPBLAS_STATUS_NOT_SUPPORTED: return status::unimplemented;
+        default: return status::runtime_error;
+    }
+}
+#endif
+
 class hip_error : virtual public std::runtime_error {
 
 protected:
@@ -303,6 +355,17 @@ static status_t miopen_to_dnnl_status(miopenStatus_t miopen_status) {
         } \
     }
 
+#define HIPBLASLT_EXECUTE_FUNC(name, ...) \
+    { \
+        auto err = name(__VA_ARGS__); \
+        if (err != HIPBLAS_STATUS_SUCCESS) { \
+            throw hipblaslt_error(std::string("At :") \
+                            + std::string(HIP_ERROR_LOCATION) \
+                            + std::string(#name) + std::string(" : "), \
+                    err); \
+        } \
+    }
+
 #define MIOPEN_EXECUTE_FUNC(name, ...) \
     { \
         auto err = name(__VA_ARGS__); \
@@ -353,6 +416,19 @@ static status_t miopen_to_dnnl_status(miopenStatus_t miopen_status) {
         } \
     }
 
+#define HIPBLASLT_EXECUTE_FUNC_V(name, ...) \
+    { \
+        auto err = name(__VA_ARGS__); \
+        if (err != HIPBLAS_STATUS_SUCCESS) { \
+            std::cout << hipblaslt_error(std::string("At :") \
+                            + std::string(HIP_ERROR_LOCATION) \
+                            + std::string(#name) + std::string(" : "), \
+                    err) \
+                                 .what() \
+                      << std::endl; \
+        } \
+    }
+
 #define MIOPEN_CHECK_V(e) \
     { \
         auto status = (e); \
@@ -379,6 +455,12 @@ static status_t miopen_to_dnnl_status(miopenStatus_t miopen_status) {
         return rocblas_to_dnnl_status(err); \
     }()
 
+#define HIPBLASLT_EXECUTE_FUNC_S(name, ...) \
+    [&]() { \
+        auto err = name(__VA_ARGS__); \
+        return hipblaslt_to_dnnl_status(err); \
+    }()
+
 inline status_t create_and_set_tensor_descriptor(
         miopenTensorDescriptor_t *tensor_desc, miopenDataType_t data_type,
         int ndims, int *dims, int *strides) {
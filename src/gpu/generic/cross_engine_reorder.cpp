@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include "common/math_utils.hpp"
 #include "common/reorder.hpp"
 #include "common/utils.hpp"
 
@@ -33,6 +34,22 @@ void cross_engine_reorder_t::pd_t::init_scratchpad(impl::engine_t *gpu_engine) {
         auto gpu_align = utils::downcast<gpu::engine_t *>(gpu_engine)
                                  ->get_buffer_alignment();
         auto scratchpad = scratchpad_registry().registrar();
+        if (zero_copy_src_) {
+            scratchpad.book(key_nested,
+                    reorder_pd_->scratchpad_registry().size(), 1, gpu_align);
+            return;
+        }
+        if (chunk_rows_ > 0) {
+            scratchpad.book(key_reorder_cross_space, 2 * chunk_buffer_size(),
+                    1, gpu_align);
+            size_t nested_size
+                    = chunk_reorder_pd_->scratchpad_registry().size();
+            if (tail_reorder_pd_)
+                nested_size = nstl::max(nested_size,
+                        tail_reorder_pd_->scratchpad_registry().size());
+            scratchpad.book(key_nested, nested_size, 1, gpu_align);
+            return;
+        }
         auto needs_dst = desc()->src_engine_kind == reorder_engine_kind_;
         memory_desc_wrapper wspace((needs_dst) ? dst_md() : src_md());
         scratchpad.book(key_reorder_cross_space, wspace.size(), 1, gpu_align);
@@ -41,13 +58,89 @@ void cross_engine_reorder_t::pd_t::init_scratchpad(impl::engine_t *gpu_engine) {
     }
 }
 
+size_t cross_engine_reorder_t::pd_t::chunk_buffer_size() const {
+    memory_desc_wrapper src_mdw(src_md());
+    return chunk_rows_ * (src_mdw.size() / src_mdw.dims()[0]);
+}
+
+status_t cross_engine_reorder_t::pd_t::init_pipeline(
+        impl::engine_t *gpu_engine, const primitive_attr_t *attr) {
+    memory_desc_wrapper src_mdw(src_md());
+    memory_desc_wrapper dst_mdw(dst_md());
+
+    // Chunks are contiguous slices of the outermost dimension in both
+    // layouts, and the attributes must not depend on the slice.
+    auto is_sliceable = [](const memory_desc_wrapper &mdw) {
+        if (!mdw.is_blocking_desc() || mdw.offset0() != 0) return false;
+        if (mdw.padded_dims()[0] != mdw.dims()[0]) return false;
+        const auto &bd = mdw.blocking_desc();
+        for (int i = 0; i < bd.inner_nblks; i++)
+            if (bd.inner_idxs[i] == 0) return false;
+        return bd.strides[0] * mdw.dims()[0] * mdw.data_type_size()
+                == (dim_t)mdw.size();
+    };
+    if (!attr->has_default_values() || !is_sliceable(src_mdw)
+            || !is_sliceable(dst_mdw) || src_mdw.size() < pipeline_min_size)
+        return status::success;
+
+    const dim_t rows = src_mdw.dims()[0];
+    const size_t src_row_size = src_mdw.size() / rows;
+    const size_t dst_row_size = dst_mdw.size() / rows;
+
+    // Chunk offsets are kept aligned for sub-buffers.
+    const size_t align = utils::downcast<gpu::engine_t *>(gpu_engine)
+                                 ->get_buffer_alignment();
+    const dim_t row_step = nstl::max(align / math::gcd(src_row_size, align),
+            align / math::gcd(dst_row_size, align));
+    const dim_t chunk_rows = utils::rnd_up(
+            nstl::max(dim_t(1), dim_t(pipeline_chunk_size / src_row_size)),
+            row_step);
+    if (chunk_rows >= rows) return status::success;
+
+    auto chunk_md = [](const memory_desc_t &md, dim_t n) {
+        memory_desc_t chunk = md;
+        chunk.dims[0] = chunk.padded_dims[0] = n;
+        chunk.extra = {};
+        return chunk;
+    };
+    auto create_chunk_pd = [&](std::shared_ptr<primitive_desc_t> &pd,
+                                   dim_t n) {
+        const auto src_chunk_md = chunk_md(*src_md(), n);
+        const auto dst_chunk_md = chunk_md(*dst_md(), n);
+        return reorder_primitive_desc_create(
+                pd, gpu_engine, &src_chunk_md, &dst_chunk_md, attr);
+    };
+
+    // Fall back to the whole tensor reorder if a chunk can't be reordered.
+    if (create_chunk_pd(chunk_reorder_pd_, chunk_rows) != status::success) {
+        chunk_reorder_pd_.reset();
+        return status::success;
+    }
+    if (rows % chunk_rows != 0
+            && create_chunk_pd(tail_reorder_pd_, rows % chunk_rows)
+                    != status::success) {
+        chunk_reorder_pd_.reset();
+        tail_reorder_pd_.reset();
+        return status::success;
+    }
+    chunk_rows_ = chunk_rows;
+    return status::success;
+}
+
 status_t cross_engine_reorder_t::pd_t::init(impl::engine_t *engine,
         impl::engine_t *src_engine, impl::engine_t *dst_engine) {
     VDISPATCH_REORDER(src_engine != dst_engine, VERBOSE_BAD_ENGINE_KIND);
     VDISPATCH_REORDER(utils::one_of(engine_kind::gpu, src_engine->kind(),
                               dst_engine->kind()),
             VERBOSE_BAD_ENGINE_KIND);
-    VDISPATCH_REORDER(attr_ok(), VERBOSE_UNSUPPORTED_ATTR);
+    // Quantization attributes are validated by the nested reorder, which
+    // allows grouped scales and zero points for weights compressed on upload.
+    using sm = dnnl_primitive_attr::skip_mask_t;
+    VDISPATCH_REORDER(attr()->has_default_values(sm::scales_data_type
+                              | sm::scales_groups | sm::zero_points_data_type
+                              | sm::zero_points_groups | sm::post_ops)
+                    && post_ops_ok(),
+            VERBOSE_UNSUPPORTED_ATTR);
     VDISPATCH_REORDER(extra_ok(true), VERBOSE_UNSUPPORTED_MD_FLAG, "extra_ok");
     VDISPATCH_REORDER(impl::is_dense_format_kind({src_md(), dst_md()}),
             VERBOSE_UNSUPPORTED_SPARSE_CFG);
@@ -83,6 +176,18 @@ status_t cross_engine_reorder_t::pd_t::init(impl::engine_t *engine,
     reorder_pd_t::init_desc(
             src_engine->kind(), dst_engine->kind(), true /* is_cross_engine */);
 
+    // On devices sharing memory with the host the reorder reads the host
+    // source directly, e.g. to compress f16 weights into int4 or fp8 in one
+    // pass without staging them in device memory.
+    zero_copy_src_ = do_reorder_ && src_engine->kind() == engine_kind::cpu
+            && src_engine->runtime_kind() != runtime_kind::sycl
+            && dst_engine->has_host_unified_memory()
+            && dst_engine->mayiuse_system_memory_allocators();
+
+    if (do_reorder_ && src_engine->kind() == engine_kind::cpu
+            && !zero_copy_src_)
+        CHECK(init_pipeline(reorder_engine, &r_attr));
+
     VDISPATCH_REORDER_SC(maybe_create_zp_precompute_conv_pd(dst_engine),
             "failed to create nested zp precompute convolution");
     init_scratchpad(
@@ -94,9 +199,81 @@ status_t cross_engine_reorder_t::init(impl::engine_t *engine) {
     CHECK(pd()->maybe_create_zp_precompute_conv(
             zp_precomp_conv_, engine, this));
     if (!pd()->do_reorder_) return status::success;
+    if (pd()->chunk_rows_ > 0) {
+        CHECK(create_nested_primitive(
+                chunk_reorder_, pd()->chunk_reorder_pd_, engine));
+        if (pd()->tail_reorder_pd_)
+            CHECK(create_nested_primitive(
+                    tail_reorder_, pd()->tail_reorder_pd_, engine));
+        return status::success;
+    }
     return create_nested_primitive(reorder_, pd()->reorder_pd_, engine);
 }
 
+status_t cross_engine_reorder_t::execute_pipelined(
+        const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+    auto *gpu_stream = utils::downcast<gpu::stream_t *>(ctx.stream());
+    auto &deps = gpu_stream->ctx().get_deps();
+
+    auto &src = CTX_IN_STORAGE(DNNL_ARG_FROM);
+    auto &dst = CTX_OUT_STORAGE(DNNL_ARG_TO);
+    auto wspace = ctx.get_scratchpad_grantor().get_memory_storage(
+            key_reorder_cross_space);
+
+    memory_desc_wrapper src_mdw(pd()->src_md());
+    memory_desc_wrapper dst_mdw(pd()->dst_md());
+    const dim_t rows = src_mdw.dims()[0];
+    const size_t src_row_size = src_mdw.size() / rows;
+    const size_t dst_row_size = dst_mdw.size() / rows;
+    const size_t buffer_size = pd()->chunk_buffer_size();
+
+    // A staging buffer can be overwritten once the reorder of the chunk
+    // copied into it before has completed. The copy doesn't wait for
+    // anything else and overlaps with the reorder of the previous chunk.
+    std::unique_ptr<xpu::event_t> buffer_deps[2] = {deps.clone(), deps.clone()};
+    for (dim_t row = 0, i = 0; row < rows; row += pd()->chunk_rows_, i++) {
+        const dim_t n = nstl::min(pd()->chunk_rows_, rows - row);
+        const auto &reorder = n == pd()->chunk_rows_ ? chunk_reorder_
+                                                     : tail_reorder_;
+
+        auto src_chunk
+                = src.get_sub_storage(row * src_row_size, n * src_row_size);
+        auto buffer = wspace->get_sub_storage(
+                (i % 2) * buffer_size, n * src_row_size);
+        auto dst_chunk
+                = dst.get_sub_storage(row * dst_row_size, n * dst_row_size);
+        if (!src_chunk || !buffer || !dst_chunk) return status::out_of_memory;
+
+        CHECK(gpu_stream->copy(*src_chunk, *buffer, n * src_row_size,
+                *buffer_deps[i % 2], deps));
+
+        std::unique_ptr<memory_t, memory_deleter_t> buffer_mem;
+        std::unique_ptr<memory_t, memory_deleter_t> dst_mem;
+        CHECK(safe_ptr_assign(buffer_mem,
+                new memory_t(ctx.stream()->engine(), reorder->pd()->src_md(),
+                        std::move(buffer))));
+        CHECK(safe_ptr_assign(dst_mem,
+                new memory_t(ctx.stream()->engine(), reorder->pd()->dst_md(),
+                        std::move(dst_chunk))));
+
+        exec_args_t r_args;
+        r_args[DNNL_ARG_SRC] = memory_arg_t {buffer_mem.get(), true};
+        r_args[DNNL_ARG_DST] = memory_arg_t {dst_mem.get(), false};
+        exec_ctx_t r_ctx(ctx, std::move(r_args));
+
+        nested_scratchpad_t ns(ctx, key_nested, reorder);
+        r_ctx.set_scratchpad_grantor(ns.grantor());
+        CHECK(reorder->execute(r_ctx));
+        buffer_deps[i % 2] = deps.clone();
+    }
+    // Reorders of earlier chunks complete before the last two through the
+    // staging buffer dependencies.
+    gpu_stream->ctx().append_deps(*buffer_deps[0]);
+    gpu_stream->ctx().append_deps(*buffer_deps[1]);
+    return status::success;
+}
+
 status_t cross_engine_reorder_t::execute(const exec_ctx_t &ctx) const {
     using namespace memory_tracking::names;
     auto *gpu_stream = utils::downcast<gpu::stream_t *>(ctx.stream());
@@ -106,8 +283,13 @@ status_t cross_engine_reorder_t::execute(const exec_ctx_t &ctx) const {
     auto &src = CTX_IN_STORAGE(DNNL_ARG_FROM);
     auto &dst = CTX_OUT_STORAGE(DNNL_ARG_TO);
 
+    if (pd()->chunk_rows_ > 0) {
+        CHECK(execute_pipelined(ctx));
+        return pd()->maybe_exec_zp_precompute_conv(ctx, zp_precomp_conv_);
+    }
+
     std::unique_ptr<memory_t, memory_deleter_t> wspace;
-    if (pd()->do_reorder_) {
+    if (pd()->do_reorder_ && !pd()->zero_copy_src_) {
         auto src_engine_kind = pd()->desc()->src_engine_kind;
         auto reorder_engine_kind = pd()->reorder_engine_kind_;
         auto scratchpad = ctx.get_scratchpad_grantor().get_memory_storage(
@@ -132,6 +314,11 @@ status_t cross_engine_reorder_t::execute(const exec_ctx_t &ctx) const {
                 = memory_arg_t {const_cast<memory_t *>(src_scales_mem), true};
         r_args[DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST]
                 = memory_arg_t {const_cast<memory_t *>(dst_scales_mem), true};
+        for (int arg : {DNNL_ARG_SRC, DNNL_ARG_DST}) {
+            const int zp_arg = DNNL_ARG_ATTR_ZERO_POINTS | arg;
+            r_args[zp_arg] = memory_arg_t {
+                    const_cast<memory_t *>(ctx.input(zp_arg)), true};
+        }
 
         exec_ctx_t r_ctx(ctx, std::move(r_args));
 
@@ -160,6 +347,26 @@ status_t cross_engine_reorder_t::execute(const exec_ctx_t &ctx) const {
                     dst_mdw.size(), gpu_stream->ctx().get_deps(),
                     gpu_stream->ctx().get_deps());
         }
+    } else if (pd()->zero_copy_src_) {
+        // CPU -> GPU, the device reads the host memory
+        void *host_ptr = nullptr;
+        CHECK(src.get_data_handle(&host_ptr));
+        memory_storage_t *host_storage_ptr = nullptr;
+        CHECK(ctx.stream()->engine()->create_memory_storage(&host_storage_ptr,
+                memory_flags_t::use_runtime_ptr
+                        | memory_flags_t::prefer_device_usm,
+                memory_desc_wrapper(pd()->src_md()).size(), host_ptr));
+        std::unique_ptr<memory_storage_t> host_storage(host_storage_ptr);
+
+        std::unique_ptr<memory_t, memory_deleter_t> host_mem;
+        CHECK(safe_ptr_assign(host_mem,
+                new memory_t(ctx.stream()->engine(),
+                        pd()->reorder_pd_->src_md(), std::move(host_storage))));
+        status = exec_reorder(host_mem.get(), ctx.output(DNNL_ARG_TO),
+                ctx.input(DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC),
+                ctx.input(DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST));
+        if (status == status::success)
+            status = pd()->maybe_exec_zp_precompute_conv(ctx, zp_precomp_conv_);
     } else {
         // CPU -> GPU
         memory_desc_wrapper src_mdw(pd()->src_md());
@@ -38,6 +38,13 @@ namespace generic {
 // For GPU -> CPU reorder, it includes 2 steps:
 // 1. GPU reorder
 // 2. GPU -> CPU copying
+//
+// On devices with memory unified with the host, the GPU reorder reads the CPU
+// memory directly and the copy is skipped.
+//
+// Large CPU -> GPU reorders are pipelined: the tensor is split into chunks
+// along the outermost dimension that go through two staging buffers, so that
+// copying of a chunk overlaps with the reorder of the previous one.
 struct cross_engine_reorder_t : public gpu::primitive_t {
     using gpu::primitive_t::primitive_t;
     struct pd_t : public gpu_reorder_pd_t {
@@ -51,8 +58,28 @@ struct cross_engine_reorder_t : public gpu::primitive_t {
         std::shared_ptr<primitive_desc_t> reorder_pd_;
         engine_kind_t reorder_engine_kind_ = engine_kind::gpu;
         bool do_reorder_ = true;
+        // CPU -> GPU reorder reads the source from the host memory without
+        // copying it to the device first.
+        bool zero_copy_src_ = false;
+
+        // Pipelined CPU -> GPU reorder: number of outermost rows per chunk,
+        // zero when the reorder is not pipelined, and the reorders of a full
+        // chunk and of the last partial one.
+        dim_t chunk_rows_ = 0;
+        std::shared_ptr<primitive_desc_t> chunk_reorder_pd_;
+        std::shared_ptr<primitive_desc_t> tail_reorder_pd_;
+
+        // Size of one staging buffer of the pipelined reorder.
+        size_t chunk_buffer_size() const;
 
     private:
+        // Chunks smaller than this do not saturate the host link.
+        static constexpr size_t pipeline_chunk_size = size_t(8) << 20;
+        // Tensors smaller than this are not split.
+        static constexpr size_t pipeline_min_size = size_t(32) << 20;
+
+        status_t init_pipeline(impl::engine_t *gpu_engine,
+                const primitive_attr_t *attr);
         void init_scratchpad(impl::engine_t *engine);
         DECLARE_GPU_REORDER_CREATE();
     };
@@ -62,7 +89,11 @@ struct cross_engine_reorder_t : public gpu::primitive_t {
 
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    status_t execute_pipelined(const exec_ctx_t &ctx) const;
+
     std::shared_ptr<impl::primitive_t> reorder_;
+    std::shared_ptr<impl::primitive_t> chunk_reorder_;
+    std::shared_ptr<impl::primitive_t> tail_reorder_;
     std::shared_ptr<impl::primitive_t> zp_precomp_conv_;
 };
 
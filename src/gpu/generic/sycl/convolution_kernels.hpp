@@ -78,7 +78,9 @@ struct convolution_kernel_fwd_t {
                                     .data_type()
                           : data_type_t::dnnl_f32) {}
 
-    void operator()(::sycl::nd_item<1> item) const {
+    void operator()(::sycl::nd_item<1> item, ::sycl::kernel_handler kh) const {
+        const auto po_spec
+                = kh.get_specialization_constant<post_ops_spec_id>();
         const float sm_data = (conf_.do_scale_data
                         ? load_float_value(scales_data_dt_, data_scale_ptr(), 0)
                         : 1.f);
@@ -214,8 +216,8 @@ struct convolution_kernel_fwd_t {
                 accumulator += bias;
             }
 
-            accumulator = conf_.post_ops.apply(
-                    accumulator, dst_, dst_md().off_v(logical_index));
+            accumulator = conf_.post_ops.apply(accumulator, dst_,
+                    dst_md().off_v(logical_index), po_spec);
 
             if (conf_.do_scale_dst) { accumulator /= sm_dst; }
             if (conf_.use_dst_zeropoints) {
@@ -306,6 +306,7 @@ struct matmul_kernel_fwd_t {
         }
 
         void apply_post_ops(sycl_post_ops_t post_ops,
+                const sycl_post_ops_t::spec_t &po_spec,
                 register_block<Rows, Cols> prev_dst, dims_t off_po, int dim1,
                 const matmul_kernel_fwd_t *kernel) {
             for (int row = 0; row < Rows; row++) {
@@ -316,7 +317,7 @@ struct matmul_kernel_fwd_t {
                         data[row][col][v_el]
                                 = post_ops.apply(data[row][col][v_el],
                                         prev_dst.data[row][col][v_el],
-                                        kernel->po_args_, off_po);
+                                        kernel->po_args_, off_po, po_spec);
                         off_po[dim1] -= row;
                         off_po[dim1 + 1] -= col * vec_len + v_el;
                     }
@@ -325,6 +326,7 @@ struct matmul_kernel_fwd_t {
         }
 
         void apply_post_ops_edge(sycl_post_ops_t post_ops,
+                const sycl_post_ops_t::spec_t &po_spec,
                 register_block<Rows, Cols> prev_dst, dims_t off_po, int dim1,
                 const matmul_kernel_fwd_t *kernel, int rows, int cols) {
             for (int row = 0; row < rows; row++) {
@@ -336,7 +338,7 @@ struct matmul_kernel_fwd_t {
                         data[row][col][v_el]
                                 = post_ops.apply(data[row][col][v_el],
                                         prev_dst.data[row][col][v_el],
-                                        kernel->po_args_, off_po);
+                                        kernel->po_args_, off_po, po_spec);
                         off_po[dim1] -= row;
                         off_po[dim1 + 1] -= col * vec_len + v_el;
                     }
@@ -347,7 +349,7 @@ struct matmul_kernel_fwd_t {
                     off_po[dim1 + 1] += col * vec_len + v_el;
                     data[row][col][v_el] = post_ops.apply(data[row][col][v_el],
                             prev_dst.data[row][col][v_el], kernel->po_args_,
-                            off_po);
+                            off_po, po_spec);
                     off_po[dim1] -= row;
                     off_po[dim1 + 1] -= col * vec_len + v_el;
                 }
@@ -409,7 +411,7 @@ struct matmul_kernel_fwd_t {
                   CTX_IN_SYCL_KERNEL_MEMORY(DNNL_ARG_ATTR_DROPOUT_PROBABILITY))
         , po_args_(cgh, ctx, conf_.post_ops) {}
 
-    void operator()(::sycl::nd_item<1> item) const {
+    void operator()(::sycl::nd_item<1> item, ::sycl::kernel_handler kh) const {
         using data_block_t = register_block<register_block_M, register_block_K>;
         using weights_block_t
                 = register_block<register_block_K, register_block_N>;
@@ -429,6 +431,8 @@ struct matmul_kernel_fwd_t {
         memory_plain_t dst_zeropoints_mem(dst_zeropoints_, dst_zeropoints_dt_);
 
         bool has_bias = bias_mem.md().ndims() != 0;
+        const auto po_spec
+                = kh.get_specialization_constant<post_ops_spec_id>();
 
         float data_scale, weights_scale, dst_scale, data_zeropoint,
                 weights_zeropoint, dst_zeropoint;
@@ -628,11 +632,12 @@ struct matmul_kernel_fwd_t {
                 std::swap(off_po[matmul_dim_1], off_po[matmul_dim_2]);
             }
             if (is_dst_edge_block) {
-                dst_block.apply_post_ops_edge(conf_.post_ops, prev_dst, off_po,
-                        matmul_dim_1, this, remaining_m, remaining_n);
+                dst_block.apply_post_ops_edge(conf_.post_ops, po_spec,
+                        prev_dst, off_po, matmul_dim_1, this, remaining_m,
+                        remaining_n);
             } else {
-                dst_block.apply_post_ops(
-                        conf_.post_ops, prev_dst, off_po, matmul_dim_1, this);
+                dst_block.apply_post_ops(conf_.post_ops, po_spec, prev_dst,
+                        off_po, matmul_dim_1, this);
             }
 
             if (conf_.do_scale_dst) {
@@ -672,6 +677,220 @@ private:
     post_op_input_args po_args_;
 };
 
+// Work-group tiled matmul: a work-group of tile x tile work items computes a
+// tile_m x tile_n block of dst. The blocks of data and weights along K are
+// staged in local memory, so that every element read from global memory is
+// reused by a whole row or column of work items, and the loads of the work
+// items are contiguous along the innermost dimension of plain layouts.
+template <int tile>
+struct matmul_kernel_tiled_fwd_t {
+    // Every work item computes rows_per_item elements of a dst column.
+    static constexpr int rows_per_item = 4;
+    static constexpr int tile_m = tile * rows_per_item;
+    static constexpr int tile_n = tile;
+    static constexpr int tile_k = tile;
+    // The rows of the data block are padded to avoid local memory bank
+    // conflicts when the work items of a column read them.
+    static constexpr int data_pitch = tile_k + 1;
+    static constexpr int weights_off = tile_m * data_pitch;
+    static constexpr int local_mem_size = weights_off + tile_k * tile_n;
+
+    matmul_kernel_tiled_fwd_t(const sycl_matmul_conf_t &conf,
+            ::sycl::local_accessor<float, 1> &local_mem, ::sycl::handler &cgh,
+            const exec_ctx_t &ctx)
+        : conf_(conf)
+        , data_(CTX_IN_SYCL_KERNEL_MEMORY(DNNL_ARG_SRC_0))
+        , weights_(CTX_IN_SYCL_KERNEL_MEMORY(DNNL_ARG_WEIGHTS))
+        , bias_(CTX_IN_SYCL_KERNEL_MEMORY(DNNL_ARG_BIAS))
+        , dst_(CTX_INOUT_SYCL_KERNEL_MEMORY(DNNL_ARG_DST))
+        , data_scale_(CTX_IN_SYCL_KERNEL_MEMORY(
+                  DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC_0))
+        , data_scales_dt_((conf_.do_scale_data)
+                          ? ctx.memory_mdw(
+                                       DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC_0)
+                                    .data_type()
+                          : data_type_t::dnnl_f32)
+        , weights_scale_(CTX_IN_SYCL_KERNEL_MEMORY(
+                  DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS))
+        , weights_scales_dt_((conf_.do_scale_weights)
+                          ? ctx.memory_mdw(
+                                       DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS)
+                                    .data_type()
+                          : data_type_t::dnnl_f32)
+        , dst_scale_(CTX_IN_SYCL_KERNEL_MEMORY(
+                  DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST))
+        , dst_scales_dt_((conf_.do_scale_dst)
+                          ? ctx.memory_mdw(DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST)
+                                    .data_type()
+                          : data_type_t::dnnl_f32)
+        , po_args_(cgh, ctx, conf_.post_ops)
+        , local_mem_(local_mem) {}
+
+    void operator()(::sycl::nd_item<3> item, ::sycl::kernel_handler kh) const {
+        memory_tensor_t data_mem(data_, conf_.data_md);
+        memory_tensor_t weights_mem(weights_, conf_.weights_md);
+        memory_tensor_t bias_mem(bias_, conf_.bias_md);
+        memory_tensor_t dst_mem(dst_, conf_.dst_md);
+        memory_plain_t data_scale_mem(data_scale_, data_scales_dt_);
+        memory_plain_t weights_scale_mem(weights_scale_, weights_scales_dt_);
+        memory_plain_t dst_scale_mem(dst_scale_, dst_scales_dt_);
+
+        const xpu::sycl::md_t dst_md = dst_mem.md();
+        const int matmul_dim_1 = dst_md.ndims() - 2;
+        const int matmul_dim_2 = dst_md.ndims() - 1;
+
+        int M = dst_md.dims()[matmul_dim_1];
+        int N = dst_md.dims()[matmul_dim_2];
+        if (conf_.transpose_dst) { std::swap(M, N); }
+        const int K = data_mem.md().dims()[conf_.transpose_data
+                        ? matmul_dim_1
+                        : matmul_dim_2];
+
+        // The batch dimensions are not affected by the transpositions of the
+        // last two dimensions in the descriptors.
+        dims_t off_batch;
+        int batch = item.get_group(0);
+        for (int i = matmul_dim_1 - 1; i >= 0; i--) {
+            off_batch[i] = batch % dst_md.dims()[i];
+            batch /= dst_md.dims()[i];
+        }
+        off_batch[matmul_dim_1] = 0;
+        off_batch[matmul_dim_2] = 0;
+
+        // Strides of the logical M x K data, K x N weights and M x N dst.
+        const auto &data_strides = data_mem.md().strides();
+        const auto &weights_strides = weights_mem.md().strides();
+        const auto &dst_strides = dst_md.strides();
+        const int data_stride_m = data_strides[conf_.transpose_data
+                        ? matmul_dim_2
+                        : matmul_dim_1];
+        const int data_stride_k = data_strides[conf_.transpose_data
+                        ? matmul_dim_1
+                        : matmul_dim_2];
+        const int weights_stride_k = weights_strides[conf_.transpose_weights
+                        ? matmul_dim_2
+                        : matmul_dim_1];
+        const int weights_stride_n = weights_strides[conf_.transpose_weights
+                        ? matmul_dim_1
+                        : matmul_dim_2];
+        const int dst_stride_m = dst_strides[conf_.transpose_dst
+                        ? matmul_dim_2
+                        : matmul_dim_1];
+        const int dst_stride_n = dst_strides[conf_.transpose_dst
+                        ? matmul_dim_1
+                        : matmul_dim_2];
+
+        const dim_t data_start
+                = data_mem.md().off_v_masked(off_batch, conf_.data_mask);
+        const dim_t weights_start
+                = weights_mem.md().off_v_masked(off_batch, conf_.weights_mask);
+        const dim_t dst_start = dst_md.off_v(off_batch);
+
+        const int lm = item.get_local_id(1);
+        const int ln = item.get_local_id(2);
+        const int m0 = item.get_group(1) * tile_m;
+        const int n = item.get_group(2) * tile_n + ln;
+
+        float acc[rows_per_item];
+        for (int r = 0; r < rows_per_item; r++) {
+            acc[r] = 0.f;
+        }
+
+        for (int k0 = 0; k0 < K; k0 += tile_k) {
+            for (int r = 0; r < rows_per_item; r++) {
+                const int i = r * tile + lm;
+                const int m = m0 + i;
+                const int k = k0 + ln;
+                local_mem_[i * data_pitch + ln] = (m < M && k < K)
+                        ? data_mem.load(data_start + m * data_stride_m
+                                + k * data_stride_k)
+                        : 0.f;
+            }
+            const int k = k0 + lm;
+            local_mem_[weights_off + lm * tile_n + ln] = (k < K && n < N)
+                    ? weights_mem.load(weights_start + k * weights_stride_k
+                            + n * weights_stride_n)
+                    : 0.f;
+            ::sycl::group_barrier(item.get_group());
+
+            for (int kk = 0; kk < tile_k; kk++) {
+                const float w = local_mem_[weights_off + kk * tile_n + ln];
+                for (int r = 0; r < rows_per_item; r++) {
+                    acc[r] += local_mem_[(r * tile + lm) * data_pitch + kk]
+                            * w;
+                }
+            }
+            ::sycl::group_barrier(item.get_group());
+        }
+
+        if (n >= N) return;
+
+        const bool has_bias = bias_mem.md().ndims() != 0;
+        const auto po_spec
+                = kh.get_specialization_constant<post_ops_spec_id>();
+        const int bias_mask = conf_.transpose_bias
+                ? matmul_kernel_fwd_t::transpose_mask(
+                          conf_.bias_mask, dst_md.ndims())
+                : conf_.bias_mask;
+
+        // The scales are common along K, so they are applied to the
+        // accumulated sums.
+        float scale = 1.f;
+        if (conf_.do_scale_data) { scale *= data_scale_mem.load(0); }
+        if (conf_.do_scale_weights) {
+            scale *= weights_scale_mem.load(
+                    conf_.single_weights_scale ? 0 : n);
+        }
+
+        for (int r = 0; r < rows_per_item; r++) {
+            const int m = m0 + r * tile + lm;
+            if (m >= M) break;
+
+            float res = acc[r] * scale;
+            if (has_bias) {
+                dims_t off_bias;
+                for (int i = 0; i < matmul_dim_1; i++) {
+                    off_bias[i] = off_batch[i];
+                }
+                off_bias[matmul_dim_1] = conf_.transpose_bias ? n : m;
+                off_bias[matmul_dim_2] = conf_.transpose_bias ? m : n;
+                res += bias_mem.load(
+                        bias_mem.md().off_v_masked(off_bias, bias_mask));
+            }
+
+            const dim_t dst_off
+                    = dst_start + m * dst_stride_m + n * dst_stride_n;
+            dims_t off_po;
+            for (int i = 0; i < matmul_dim_1; i++) {
+                off_po[i] = off_batch[i];
+            }
+            off_po[matmul_dim_1] = m;
+            off_po[matmul_dim_2] = n;
+            res = conf_.post_ops.apply(
+                    res, dst_mem.load(dst_off), po_args_, off_po, po_spec);
+
+            if (conf_.do_scale_dst) { res /= dst_scale_mem.load(0); }
+            dst_mem.store(res, dst_off);
+        }
+    }
+
+private:
+    sycl_matmul_conf_t conf_;
+
+    xpu::sycl::in_memory_arg_t data_;
+    xpu::sycl::in_memory_arg_t weights_;
+    xpu::sycl::in_memory_arg_t bias_;
+    xpu::sycl::inout_memory_arg_t dst_;
+    xpu::sycl::in_memory_arg_t data_scale_;
+    data_type_t data_scales_dt_;
+    xpu::sycl::in_memory_arg_t weights_scale_;
+    data_type_t weights_scales_dt_;
+    xpu::sycl::in_memory_arg_t dst_scale_;
+    data_type_t dst_scales_dt_;
+    post_op_input_args po_args_;
+    ::sycl::local_accessor<float, 1> local_mem_;
+};
+
 } // namespace sycl
 } // namespace generic
 } // namespace gpu
@@ -71,7 +71,7 @@ status_t ref_convolution_fwd_t::pd_t::init_conf() {
 
 status_t ref_convolution_fwd_t::init(impl::engine_t *engine) {
     const auto kid = ::sycl::get_kernel_id<convolution_kernel_fwd_t>();
-    CHECK(create_kernel(engine, kid, &kernel_));
+    CHECK(create_kernel(engine, kid, &kernel_, pd()->conf_.post_ops));
     return status::success;
 }
 
@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include "gpu/generic/sycl/ref_matmul.hpp"
+#include "gpu/generic/sycl/engine.hpp"
 #include "gpu/generic/sycl/matmul_kernels.hpp"
 
 namespace dnnl {
@@ -133,9 +134,71 @@ void ref_matmul_t::pd_t::init_rt_conf(sycl_matmul_conf_t &conf,
     conf.bias_mask = utils::get_dims_mask(dst_d.dims(), bias_d.dims(), ndims());
 }
 
+void ref_matmul_t::pd_t::init_tile(impl::engine_t *engine) {
+    tile_ = 0;
+    // The tiled kernel supports neither zero points nor dropout.
+    if (conf_.use_data_zeropoints || conf_.use_weights_zeropoints
+            || conf_.use_dst_zeropoints || conf_.use_dropout)
+        return;
+
+    const auto &device
+            = utils::downcast<const impl::xpu::sycl::engine_impl_t *>(
+                    engine->impl())
+                      ->device();
+    const size_t max_wg_size
+            = device.get_info<::sycl::info::device::max_work_group_size>();
+    const size_t local_mem_size
+            = device.get_info<::sycl::info::device::local_mem_size>();
+    // Pick the largest tile whose work-group and local memory fit the device.
+    if (max_wg_size >= 16 * 16
+            && local_mem_size >= sizeof(float)
+                            * matmul_kernel_tiled_fwd_t<16>::local_mem_size) {
+        tile_ = 16;
+    } else if (max_wg_size >= 8 * 8
+            && local_mem_size >= sizeof(float)
+                            * matmul_kernel_tiled_fwd_t<8>::local_mem_size) {
+        tile_ = 8;
+    }
+}
+
 status_t ref_matmul_t::init(impl::engine_t *engine) {
-    const auto kid = ::sycl::get_kernel_id<matmul_kernel_fwd_t>();
-    CHECK(create_kernel(engine, kid, &kernel_));
+    ::sycl::kernel_id kid = ::sycl::get_kernel_id<matmul_kernel_fwd_t>();
+    switch (pd()->tile_) {
+        case 16:
+            kid = ::sycl::get_kernel_id<matmul_kernel_tiled_fwd_t<16>>();
+            break;
+        case 8:
+            kid = ::sycl::get_kernel_id<matmul_kernel_tiled_fwd_t<8>>();
+            break;
+        default: break;
+    }
+    CHECK(create_kernel(engine, kid, &kernel_, pd()->conf_.post_ops));
+    return status::success;
+}
+
+template <int tile>
+status_t ref_matmul_t::execute_tiled(
+        const exec_ctx_t &ctx, const sycl_matmul_conf_t &conf) const {
+    using tiled_kernel_t = matmul_kernel_tiled_fwd_t<tile>;
+
+    const auto dst_d = ctx.memory_mdw(DNNL_ARG_DST, pd()->dst_md());
+    const int ndims = dst_d.ndims();
+    const dim_t M = dst_d.dims()[ndims - 2];
+    const dim_t N = dst_d.dims()[ndims - 1];
+    const dim_t batch = dst_d.nelems() / (M * N);
+
+    parallel_for(ctx, kernel_, [&](::sycl::handler &cgh) {
+        ::sycl::local_accessor<float, 1> local_mem(
+                tiled_kernel_t::local_mem_size, cgh);
+        tiled_kernel_t matmul_kernel(conf, local_mem, cgh, ctx);
+
+        const size_t m_wg_cnt = utils::div_up(M, tiled_kernel_t::tile_m);
+        const size_t n_wg_cnt = utils::div_up(N, tiled_kernel_t::tile_n);
+        const ::sycl::range<3> lws(1, tile, tile);
+        const ::sycl::range<3> gws(batch, m_wg_cnt * tile, n_wg_cnt * tile);
+        cgh.parallel_for(::sycl::nd_range<3>(gws, lws), matmul_kernel);
+    });
+
     return status::success;
 }
 
@@ -152,6 +215,12 @@ status_t ref_matmul_t::execute(const exec_ctx_t &ctx) const {
         pd()->init_rt_conf(conf, src_d, weights_d, dst_d, bias_d);
     }
 
+    switch (pd()->tile_) {
+        case 16: return execute_tiled<16>(ctx, conf);
+        case 8: return execute_tiled<8>(ctx, conf);
+        default: break;
+    }
+
     parallel_for(ctx, kernel_, [&](::sycl::handler &cgh) {
         matmul_kernel_fwd_t matmul_kernel(conf, cgh, ctx);
 
@@ -71,11 +71,15 @@ struct ref_matmul_t : public gpu::generic::sycl::primitive_t {
                     VERBOSE_OUT_OF_RANGE_DIMS, "weights");
 
             init_conf();
+            init_tile(engine);
             return status::success;
         }
 
         sycl_matmul_conf_t conf_;
         bool any_runtime_params_ = false;
+        // Tile size of the work-group tiled kernel, 0 if the untiled kernel
+        // is used.
+        int tile_ = 0;
 
         void init_rt_conf(sycl_matmul_conf_t &conf,
                 const memory_desc_wrapper src_d,
@@ -85,6 +89,7 @@ struct ref_matmul_t : public gpu::generic::sycl::primitive_t {
 
     private:
         void init_conf();
+        void init_tile(impl::engine_t *engine);
 
         status_t set_default_params() {
             if (src_md_.format_kind == format_kind::any) {
@@ -162,6 +167,11 @@ struct ref_matmul_t : public gpu::generic::sycl::primitive_t {
 
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    template <int tile>
+    status_t execute_tiled(
+            const exec_ctx_t &ctx, const sycl_matmul_conf_t &conf) const;
+
     kernel_t kernel_;
 };
 
@@ -53,6 +53,7 @@ struct ref_pooling_fwd_t : public gpu::generic::sycl::primitive_t {
             const memory_desc_wrapper ws_d(workspace_md(0));
 
             VDISPATCH_POOLING(is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_POOLING(!is_adaptive(), VERBOSE_BAD_ALGORITHM);
             VDISPATCH_POOLING_SC(set_default_params(), VERBOSE_UNSUPPORTED_TAG);
             VDISPATCH_POOLING(
                     (src_md(0)->format_desc.blocking.inner_nblks == 0),
@@ -115,6 +116,7 @@ struct ref_pooling_bwd_t : public gpu::generic::sycl::primitive_t {
             const memory_desc_wrapper ws_d(workspace_md(0));
 
             VDISPATCH_POOLING(!is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_POOLING(!is_adaptive(), VERBOSE_BAD_ALGORITHM);
             VDISPATCH_POOLING_SC(set_default_params(), VERBOSE_UNSUPPORTED_TAG);
             VDISPATCH_POOLING(
                     (utils::everyone_is(f32, diff_src_md(0)->data_type,
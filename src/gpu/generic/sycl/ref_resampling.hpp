@@ -48,6 +48,10 @@ struct ref_resampling_fwd_t : public gpu::generic::sycl::primitive_t {
             const memory_desc_wrapper dst_d(dst_md(0));
 
             VDISPATCH_RESAMPLING(is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_RESAMPLING(
+                    utils::one_of(desc()->alg_kind, resampling_nearest,
+                            resampling_linear),
+                    VERBOSE_BAD_ALGORITHM);
             VDISPATCH_RESAMPLING(is_supported_type(src_md(0)->data_type),
                     VERBOSE_UNSUPPORTED_DT);
             VDISPATCH_RESAMPLING(is_supported_type(dst_md(0)->data_type),
@@ -40,6 +40,9 @@ struct ref_sycl_softmax_fwd_t : public gpu::generic::sycl::primitive_t {
             using sm = primitive_attr_t::skip_mask_t;
 
             VDISPATCH_SOFTMAX(is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_SOFTMAX(!with_attn_preprocessing(),
+                    VERBOSE_UNSUPPORTED_FEATURE,
+                    "attention scores preprocessing");
             VDISPATCH_SOFTMAX(check_data_types(src_md()->data_type),
                     VERBOSE_UNSUPPORTED_DT);
             VDISPATCH_SOFTMAX(check_data_types(dst_md()->data_type),
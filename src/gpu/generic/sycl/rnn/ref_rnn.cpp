@@ -204,6 +204,7 @@ status_t ref_rnn_fwd_t::pd_t::init(impl::engine_t *engine) {
             one_of(cell_kind, alg_kind::vanilla_rnn), VERBOSE_BAD_ALGORITHM);
     VDISPATCH_RNN(weights_iter_dt == weights_layer_dt, VERBOSE_UNSUPPORTED_DT);
     VDISPATCH_RNN_SC(this->set_default_params(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_RNN(!this->with_seq_lengths(), "with_seq_lengths");
     VDISPATCH_RNN(this->with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
     VDISPATCH_RNN(IMPLICATION(this->desc()->prop_kind != forward_inference,
                           bias_dt == dnnl_f32),
@@ -22,6 +22,7 @@
 #include "xpu/sycl/memory_storage.hpp"
 
 #include "gpu/generic/sycl/sycl_gpu_kernel.hpp"
+#include "gpu/generic/sycl/sycl_post_ops.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -47,6 +48,23 @@ protected:
         return status::success;
     }
 
+    // Builds a kernel specialized for the structure of the post-op chain.
+    status_t create_kernel(impl::engine_t *engine, ::sycl::kernel_id kid,
+            kernel_t *kernel, const sycl_post_ops_t &post_ops) {
+        auto ctx = utils::downcast<const xpu::sycl::engine_impl_t *>(
+                engine->impl())
+                           ->context();
+        auto input_bundle
+                = ::sycl::get_kernel_bundle<::sycl::bundle_state::input>(
+                        ctx, {kid});
+        input_bundle.set_specialization_constant<post_ops_spec_id>(
+                post_ops.spec());
+        auto exe_bundle = ::sycl::build(input_bundle);
+
+        (*kernel) = kernel_t(exe_bundle);
+        return status::success;
+    }
+
     status_t parallel_for(const exec_ctx_t &ctx, const kernel_t &kernel,
             const std::function<void(::sycl::handler &)> &cgf) const {
         return kernel.parallel_for(*ctx.stream(), cgf);
@@ -58,6 +58,13 @@ struct ref_eltwise_fwd_t {
         return compute(alg_, s, alpha_, beta_) * scale_;
     }
 
+    // Same as above, with the algorithm known at kernel build time.
+    float compute(float s, alg_kind_t alg) const {
+        return compute(alg, s, alpha_, beta_) * scale_;
+    }
+
+    alg_kind_t alg() const { return alg_; }
+
     template <int width>
     ::sycl::vec<float, width> compute(::sycl::vec<float, width> src_vec) const {
         ::sycl::vec<float, width> scale_vec(scale_);
@@ -268,6 +275,18 @@ struct sycl_post_ops_t {
     // the number of post ops.
     static constexpr int max_post_ops = 5;
 
+    // Structure of a post-op chain: the number of post-ops, their kinds and
+    // the algorithms of the eltwise post-ops. Kernels built with it set as
+    // post_ops_spec_id apply the chain without dispatching on the kinds and
+    // the algorithms at run time.
+    struct spec_t {
+        bool is_specialized() const { return n_post_ops >= 0; }
+
+        int n_post_ops = -1;
+        primitive_kind_t kinds[max_post_ops] = {};
+        alg_kind_t algs[max_post_ops] = {};
+    };
+
     static bool post_ops_ok(const primitive_attr_t *attr,
             bool allow_inputs = true, bool allow_sum = true) {
         using namespace primitive_kind;
@@ -323,15 +342,26 @@ struct sycl_post_ops_t {
         n_post_ops_ = attr_po.len();
     }
 
+    spec_t spec() const {
+        spec_t spec;
+        spec.n_post_ops = n_post_ops_;
+        for (int i = 0; i < n_post_ops_; i++) {
+            spec.kinds[i] = ops_[i].kind_;
+            if (ops_[i].kind_ == primitive_kind::eltwise)
+                spec.algs[i] = ops_[i].eltwise_.alg();
+        }
+        return spec;
+    }
+
     inline float apply(float acc, const xpu::sycl::inout_memory_arg_t &dst,
             dim_t dst_offset, const post_op_input_args &po_args,
-            dims_t src_offset) const;
+            dims_t src_offset, const spec_t &spec = spec_t()) const;
     inline float apply(float acc, float dst, const post_op_input_args &po_args,
-            dims_t src_offset) const;
+            dims_t src_offset, const spec_t &spec = spec_t()) const;
     inline float apply(float acc, const post_op_input_args &po_args,
-            dims_t src_offset) const;
+            dims_t src_offset, const spec_t &spec = spec_t()) const;
     inline float apply(float acc, const xpu::sycl::inout_memory_arg_t &dst,
-            dim_t dst_offset) const;
+            dim_t dst_offset, const spec_t &spec = spec_t()) const;
 
     inline int get_post_op() const { return n_post_ops_; }
 
@@ -347,11 +377,28 @@ struct sycl_post_ops_t {
     dnnl::impl::data_type_t sum_dt_;
 
 private:
+    int len(const spec_t &spec) const {
+        return spec.is_specialized() ? spec.n_post_ops : n_post_ops_;
+    }
+    primitive_kind_t kind(int i, const spec_t &spec) const {
+        return spec.is_specialized() ? spec.kinds[i] : ops_[i].kind_;
+    }
+    float compute_eltwise(int i, float acc, const spec_t &spec) const {
+        return spec.is_specialized()
+                ? ops_[i].eltwise_.compute(acc, spec.algs[i])
+                : ops_[i].eltwise_.compute(acc);
+    }
+
     sycl_post_op_t ops_[max_post_ops];
     // Indicates the actual number of post ops.
     int n_post_ops_;
 };
 
+// Post-op chain structure the kernels are specialized for. The default value
+// leaves the chain to be interpreted at run time.
+inline constexpr ::sycl::specialization_id<sycl_post_ops_t::spec_t>
+        post_ops_spec_id;
+
 struct post_op_input_args {
     post_op_input_args(::sycl::handler &cgh, const exec_ctx_t &ctx,
             const sycl_post_ops_t &post_ops)
@@ -373,12 +420,13 @@ struct post_op_input_args {
 
 float sycl_post_ops_t::apply(float acc,
         const xpu::sycl::inout_memory_arg_t &dst, dim_t dst_offset,
-        const post_op_input_args &po_args, dims_t src_offset) const {
+        const post_op_input_args &po_args, dims_t src_offset,
+        const spec_t &spec) const {
     using namespace primitive_kind;
 
-    for (auto i = 0; i < n_post_ops_; ++i) {
-        switch (ops_[i].kind_) {
-            case eltwise: acc = ops_[i].eltwise_.compute(acc); break;
+    for (auto i = 0; i < len(spec); ++i) {
+        switch (kind(i, spec)) {
+            case eltwise: acc = compute_eltwise(i, acc, spec); break;
             case binary:
                 acc = ops_[i].binary_.load_and_compute(
                         acc, po_args.args_[i], src_offset);
@@ -398,12 +446,13 @@ float sycl_post_ops_t::apply(float acc,
 }
 
 float sycl_post_ops_t::apply(float acc, float dst,
-        const post_op_input_args &po_args, dims_t src_offset) const {
+        const post_op_input_args &po_args, dims_t src_offset,
+        const spec_t &spec) const {
     using namespace primitive_kind;
 
-    for (auto i = 0; i < n_post_ops_; ++i) {
-        switch (ops_[i].kind_) {
-            case eltwise: acc = ops_[i].eltwise_.compute(acc); break;
+    for (auto i = 0; i < len(spec); ++i) {
+        switch (kind(i, spec)) {
+            case eltwise: acc = compute_eltwise(i, acc, spec); break;
             case binary:
                 acc = ops_[i].binary_.load_and_compute(
                         acc, po_args.args_[i], src_offset);
@@ -419,13 +468,13 @@ float sycl_post_ops_t::apply(float acc, float dst,
     return acc;
 }
 
-float sycl_post_ops_t::apply(
-        float acc, const post_op_input_args &po_args, dims_t src_offset) const {
+float sycl_post_ops_t::apply(float acc, const post_op_input_args &po_args,
+        dims_t src_offset, const spec_t &spec) const {
     using namespace primitive_kind;
 
-    for (auto i = 0; i < n_post_ops_; ++i) {
-        switch (ops_[i].kind_) {
-            case eltwise: acc = ops_[i].eltwise_.compute(acc); break;
+    for (auto i = 0; i < len(spec); ++i) {
+        switch (kind(i, spec)) {
+            case eltwise: acc = compute_eltwise(i, acc, spec); break;
             case binary:
                 acc = ops_[i].binary_.load_and_compute(
                         acc, po_args.args_[i], src_offset);
@@ -441,12 +490,13 @@ float sycl_post_ops_t::apply(
 }
 
 float sycl_post_ops_t::apply(float acc,
-        const xpu::sycl::inout_memory_arg_t &dst, dim_t dst_offset) const {
+        const xpu::sycl::inout_memory_arg_t &dst, dim_t dst_offset,
+        const spec_t &spec) const {
     using namespace primitive_kind;
 
-    for (auto i = 0; i < n_post_ops_; ++i) {
-        switch (ops_[i].kind_) {
-            case eltwise: acc = ops_[i].eltwise_.compute(acc); break;
+    for (auto i = 0; i < len(spec); ++i) {
+        switch (kind(i, spec)) {
+            case eltwise: acc = compute_eltwise(i, acc, spec); break;
             case sum:
                 acc = ops_[i].sum_.load_and_compute(
                         acc, dst, sum_dt_, dst_offset);
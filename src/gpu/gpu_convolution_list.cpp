@@ -19,6 +19,7 @@
 #include <mutex>
 
 #if DNNL_GPU_VENDOR == DNNL_VENDOR_INTEL
+#include "gpu/intel/gemm_wino_convolution.hpp"
 #include "gpu/intel/jit/binary_format.hpp"
 #include "gpu/intel/jit/conv/gen_convolution.hpp"
 #include "gpu/intel/ref_convolution.hpp"
@@ -55,6 +56,7 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>>
         impl_list_map REG_CONV_P({
     {{forward}, {
         GPU_INSTANCE_INTEL(intel::jit::gen_convolution_fwd_t)
+        GPU_INSTANCE_INTEL(intel::gemm_wino_convolution_fwd_t)
         GPU_INSTANCE_INTEL(intel::xe_wino_convolution_fwd_t)
         GPU_INSTANCE_INTEL_REF(intel::ref_convolution_fwd_t)
         GPU_INSTANCE_INTEL_EXPERIMENTAL(intel::jit::v2::conv::gen_convolution_fwd_t)
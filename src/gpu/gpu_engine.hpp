@@ -47,6 +47,10 @@ public:
         return gpu::gpu_impl_list_t::get_concat_implementation_list();
     }
 
+    const impl_list_item_t *get_split_implementation_list() const override {
+        return gpu::gpu_impl_list_t::get_split_implementation_list();
+    }
+
     const impl_list_item_t *get_sum_implementation_list() const override {
         return gpu::gpu_impl_list_t::get_sum_implementation_list();
     }
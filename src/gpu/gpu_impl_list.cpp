@@ -49,6 +49,10 @@ const impl_list_item_t *gpu_impl_list_t::get_implementation_list(
             CASE(shuffle);
             CASE(softmax);
             CASE(zero_pad);
+            // Gather, top-k and optimizer are not implemented on GPU yet.
+            case primitive_kind::gather:
+            case primitive_kind::topk:
+            case primitive_kind::optimizer: return empty_list;
             default: assert(!"unknown primitive kind"); return empty_list;
         }
 #undef CASE
@@ -59,6 +63,12 @@ const impl_list_item_t *gpu_impl_list_t::get_concat_implementation_list() {
     return get_concat_impl_list();
 }
 
+// Split is not implemented on GPU yet.
+const impl_list_item_t *gpu_impl_list_t::get_split_implementation_list() {
+    static const impl_list_item_t empty_list[] = {nullptr};
+    return empty_list;
+}
+
 const impl_list_item_t *gpu_impl_list_t::get_sum_implementation_list() {
     return get_sum_impl_list();
 }
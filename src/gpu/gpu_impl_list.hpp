@@ -198,6 +198,7 @@ public:
     static const impl_list_item_t *get_implementation_list(
             const op_desc_t *desc);
     static const impl_list_item_t *get_concat_implementation_list();
+    static const impl_list_item_t *get_split_implementation_list();
     static const impl_list_item_t *get_sum_implementation_list();
     static const impl_list_item_t *get_reorder_implementation_list(
             const memory_desc_t *, const memory_desc_t *);
@@ -18,6 +18,7 @@
 
 #if DNNL_GPU_VENDOR == DNNL_VENDOR_INTEL
 #include "gpu/intel/gemm_matmul.hpp"
+#include "gpu/intel/grouped_matmul.hpp"
 #include "gpu/intel/ref_matmul.hpp"
 #include "gpu/intel/ref_sparse_matmul.hpp"
 #endif
@@ -31,6 +32,14 @@
 #include "gpu/amd/miopen_matmul.hpp"
 #endif
 
+// hipBLASLt is an optional dependency of the AMD backend.
+#if DNNL_GPU_VENDOR == DNNL_VENDOR_AMD && defined(DNNL_AMD_ENABLE_HIPBLASLT)
+#include "gpu/amd/hipblaslt_matmul.hpp"
+#define GPU_INSTANCE_AMD_HIPBLASLT(...) GPU_INSTANCE_AMD(__VA_ARGS__)
+#else
+#define GPU_INSTANCE_AMD_HIPBLASLT(...)
+#endif
+
 #ifdef GENERIC_SYCL_KERNELS_ENABLED
 #include "gpu/generic/sycl/ref_matmul.hpp"
 #endif
@@ -48,15 +57,21 @@ constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
         GPU_INSTANCE_INTEL_REF(intel::ref_matmul_t)
         GPU_INSTANCE_NVIDIA(nvidia::cudnn_matmul_lt_t)
         GPU_INSTANCE_NVIDIA(nvidia::cudnn_matmul_t)
+        GPU_INSTANCE_AMD_HIPBLASLT(amd::hipblaslt_matmul_t)
         GPU_INSTANCE_AMD(amd::miopen_matmul_t)
         GPU_INSTANCE_GENERIC_SYCL(generic::sycl::ref_matmul_t)
         nullptr,
 });
+
+constexpr impl_list_item_t grouped_impl_list[] = {
+        GPU_INSTANCE_INTEL(intel::grouped_matmul_t)
+        nullptr,
+};
 // clang-format on
 } // namespace
 
 const impl_list_item_t *get_matmul_impl_list(const matmul_desc_t *desc) {
-    UNUSED(desc);
+    if (desc->group_offsets_desc.ndims != 0) return grouped_impl_list;
     return impl_list;
 }
 
@@ -23,6 +23,10 @@
 #include "gpu/intel/ref_sdpa.hpp"
 #endif
 
+#if DNNL_GPU_VENDOR == DNNL_VENDOR_NVIDIA
+#include "gpu/nvidia/cudnn_sdpa.hpp"
+#endif
+
 namespace dnnl {
 namespace impl {
 namespace gpu {
@@ -33,6 +37,8 @@ namespace {
 constexpr impl_list_item_t impl_list[] = REG_SDPA_P({
         GPU_INSTANCE_INTEL(intel::micro_sdpa_t)
         GPU_INSTANCE_INTEL_DEVMODE(intel::ref_sdpa_t)
+        GPU_INSTANCE_INTEL(intel::ref_sdpa_bwd_t)
+        GPU_INSTANCE_NVIDIA(nvidia::cudnn_sdpa_fwd_t)
         nullptr,
 });
 // clang-format on
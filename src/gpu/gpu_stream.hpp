@@ -46,6 +46,12 @@ public:
     }
     xpu::stream_profiler_t &profiler() { return *profiler_; }
 
+    status_t get_last_exec_kernel_time(uint64_t *nsec) const override {
+        if (!is_profiling_enabled() || !profiler_)
+            return impl::stream_t::get_last_exec_kernel_time(nsec);
+        return profiler_->get_last_kernel_time(*nsec);
+    }
+
     virtual double get_freq(const xpu::event_t &event) const { return 0.0; }
 
 protected:
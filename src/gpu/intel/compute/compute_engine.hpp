@@ -144,6 +144,9 @@ public:
     bool mayiuse_system_memory_allocators() const override {
         return device_info_->mayiuse_system_memory_allocators();
     }
+    bool has_host_unified_memory() const override {
+        return device_info_->is_integrated();
+    }
     bool mayiuse_sub_group(int size) const {
         return device_info_->mayiuse_sub_group(size);
     }
@@ -40,6 +40,15 @@ public:
     virtual status_t enter_immediate_mode() { return status::success; }
     virtual status_t exit_immediate_mode() { return status::success; }
 
+    // Multi-tile execution. Between fork_tiles() and join_tiles(), kernels
+    // are submitted to the tile selected with set_tile(). The tiles start
+    // after the work previously submitted to the stream, and the work
+    // submitted after join_tiles() starts once all the tiles complete.
+    virtual int ntiles() const { return 1; }
+    virtual status_t fork_tiles() { return status::success; }
+    virtual status_t set_tile(int tile) { return status::success; }
+    virtual status_t join_tiles() { return status::success; }
+
 protected:
     bool has_zero_pad_primitive() const {
         return engine()->kind() == dnnl_gpu;
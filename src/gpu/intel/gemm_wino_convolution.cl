@@ -0,0 +1,156 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gpu/intel/ocl_post_ops.h"
+#include "gpu/intel/ocl_types.h"
+
+// Winograd F(4x4, 3x3): the tiles are 6x6 and the transformed tensors are
+// laid out as [TILE_SIZE * TILE_SIZE][rows][channels], so that each of the 36
+// tile elements is a plain row-major matrix for the batched gemm.
+#define TILE_SIZE 6
+#define WINO_M 4
+
+// Transformed input: B^T d.
+void wino_src_1d(const float d[TILE_SIZE], float r[TILE_SIZE]) {
+    r[0] = 4.f * d[0] - 5.f * d[2] + d[4];
+    r[1] = -4.f * (d[1] + d[2]) + d[3] + d[4];
+    r[2] = 4.f * (d[1] - d[2]) - d[3] + d[4];
+    r[3] = 2.f * (d[3] - d[1]) - d[2] + d[4];
+    r[4] = 2.f * (d[1] - d[3]) - d[2] + d[4];
+    r[5] = 4.f * d[1] - 5.f * d[3] + d[5];
+}
+
+// Transformed weights: G g.
+void wino_wei_1d(const float g[3], float r[TILE_SIZE]) {
+    r[0] = g[0] / 4.f;
+    r[1] = -(g[0] + g[1] + g[2]) / 6.f;
+    r[2] = -(g[0] - g[1] + g[2]) / 6.f;
+    r[3] = g[0] / 24.f + g[1] / 12.f + g[2] / 6.f;
+    r[4] = g[0] / 24.f - g[1] / 12.f + g[2] / 6.f;
+    r[5] = g[2];
+}
+
+// Output: A^T m.
+void wino_dst_1d(const float m[TILE_SIZE], float r[WINO_M]) {
+    r[0] = m[0] + m[1] + m[2] + m[3] + m[4];
+    r[1] = m[1] - m[2] + 2.f * (m[3] - m[4]);
+    r[2] = m[1] + m[2] + 4.f * (m[3] + m[4]);
+    r[3] = m[1] - m[2] + 8.f * (m[3] - m[4]) + m[5];
+}
+
+__kernel void gemm_wino_wei_transform(
+        const __global WEI_DATA_T *wei, __global WEI_DATA_T *U) {
+    const long oc = get_global_id(0);
+    const long ic = get_global_id(1);
+
+    float g[3][3];
+    for (int kh = 0; kh < 3; kh++)
+        for (int kw = 0; kw < 3; kw++)
+            g[kh][kw] = WEI_TO_REF(wei[oc * WEI_S_O + ic * WEI_S_I
+                    + kh * WEI_S_H + kw * WEI_S_W]);
+
+    // Rows first, then columns: G g G^T.
+    float tmp[3][TILE_SIZE];
+    for (int kh = 0; kh < 3; kh++)
+        wino_wei_1d(g[kh], tmp[kh]);
+    for (int j = 0; j < TILE_SIZE; j++) {
+        const float col[3] = {tmp[0][j], tmp[1][j], tmp[2][j]};
+        float u[TILE_SIZE];
+        wino_wei_1d(col, u);
+        for (int i = 0; i < TILE_SIZE; i++)
+            U[((long)(i * TILE_SIZE + j) * IC + ic) * OC + oc]
+                    = REF_TO_WEI(u[i]);
+    }
+}
+
+__kernel void gemm_wino_src_transform(
+        const __global SRC_DATA_T *src, __global SRC_DATA_T *V) {
+    const long ic = get_global_id(0);
+    const long tw = get_global_id(1);
+    const long mb = get_global_id(2) / TH;
+    const long th = get_global_id(2) % TH;
+    const long tile = (mb * TH + th) * TW + tw;
+
+    const long ih0 = th * WINO_M - PT;
+    const long iw0 = tw * WINO_M - PL;
+    const __global SRC_DATA_T *src_c = src + mb * SRC_S_MB + ic * SRC_S_C;
+
+    float tmp[TILE_SIZE][TILE_SIZE];
+    for (int i = 0; i < TILE_SIZE; i++) {
+        float d[TILE_SIZE];
+        const long ih = ih0 + i;
+        for (int j = 0; j < TILE_SIZE; j++) {
+            const long iw = iw0 + j;
+            const bool ok = ih >= 0 && ih < IH && iw >= 0 && iw < IW;
+            d[j] = ok ? SRC_TO_REF(src_c[ih * SRC_S_H + iw * SRC_S_W]) : 0.f;
+        }
+        wino_src_1d(d, tmp[i]);
+    }
+    for (int j = 0; j < TILE_SIZE; j++) {
+        float col[TILE_SIZE], v[TILE_SIZE];
+        for (int i = 0; i < TILE_SIZE; i++)
+            col[i] = tmp[i][j];
+        wino_src_1d(col, v);
+        for (int i = 0; i < TILE_SIZE; i++)
+            V[((long)(i * TILE_SIZE + j) * N_TILES + tile) * IC + ic]
+                    = REF_TO_SRC(v[i]);
+    }
+}
+
+__kernel void gemm_wino_dst_transform(const __global float *M,
+        const __global BIA_DATA_T *bias,
+        __global DST_DATA_T *dst POST_OP_ARGS) {
+    const long oc = get_global_id(0);
+    const long tw = get_global_id(1);
+    const long mb = get_global_id(2) / TH;
+    const long th = get_global_id(2) % TH;
+    const long tile = (mb * TH + th) * TW + tw;
+
+    float tmp[TILE_SIZE][WINO_M];
+    for (int i = 0; i < TILE_SIZE; i++) {
+        float m[TILE_SIZE];
+        for (int j = 0; j < TILE_SIZE; j++)
+            m[j] = M[((long)(i * TILE_SIZE + j) * N_TILES + tile) * OC + oc];
+        wino_dst_1d(m, tmp[i]);
+    }
+
+#if WITH_BIAS
+    const float b = BIA_TO_REF(bias[oc]);
+#else
+    const float b = 0.f;
+#endif
+
+    for (int j = 0; j < WINO_M; j++) {
+        const long ow = tw * WINO_M + j;
+        float col[TILE_SIZE], out[WINO_M];
+        for (int i = 0; i < TILE_SIZE; i++)
+            col[i] = tmp[i][j];
+        wino_dst_1d(col, out);
+        for (int i = 0; i < WINO_M; i++) {
+            const long oh = th * WINO_M + i;
+            if (oh >= OH || ow >= OW) continue;
+            const long dst_off = mb * DST_S_MB + oc * DST_S_C + oh * DST_S_H
+                    + ow * DST_S_W;
+            float res = out[i] + b;
+            POST_OP_DATA_T sum_src;
+#if WITH_SUM
+            sum_src = (POST_OP_DATA_T)SUM_TO_REF(AS_SUM_DATA_T(dst[dst_off]));
+#endif
+            APPLY_POST_OPS_SERIAL(res, sum_src, mb, oc, oh, ow, 0, 0);
+            dst[dst_off] = TO_DST(res);
+        }
+    }
+}
@@ -0,0 +1,255 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gpu/intel/gemm_wino_convolution.hpp"
+
+#include "common/c_types_map.hpp"
+#include "common/type_helpers.hpp"
+#include "gpu/intel/compute/compute_engine.hpp"
+#include "gpu/intel/gemm/gpu_gemm.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace intel {
+
+using namespace memory_tracking::names;
+
+status_t gemm_wino_convolution_fwd_t::pd_t::init(impl::engine_t *engine) {
+    using namespace data_type;
+    using namespace format_tag;
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    auto *compute_engine = utils::downcast<compute::compute_engine_t *>(engine);
+    const auto &cd = *desc();
+    const auto src_dt = invariant_src_md()->data_type;
+    const auto dst_dt = invariant_dst_md()->data_type;
+
+    VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_CONV(cd.alg_kind == alg_kind::convolution_winograd,
+            VERBOSE_BAD_ALGORITHM);
+    const auto bia_dt = with_bias() ? invariant_bia_md()->data_type : f32;
+    VDISPATCH_CONV(utils::one_of(src_dt, f16, bf16)
+                    && invariant_wei_md()->data_type == src_dt
+                    && utils::one_of(dst_dt, src_dt, f32)
+                    && utils::one_of(bia_dt, src_dt, f32),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_CONV(compute_engine->mayiuse(compute::device_ext_t::
+                                   intel_subgroup_matrix_multiply_accumulate),
+            VERBOSE_UNSUPPORTED_DEVICE_FEATURE, "systolic");
+    VDISPATCH_CONV(IMPLICATION(src_dt == f16,
+                           compute_engine->mayiuse(
+                                   compute::device_ext_t::khr_fp16)),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_CONV(
+            attr()->has_default_values(smask_t::post_ops | smask_t::sum_dt,
+                    dst_dt),
+            VERBOSE_UNSUPPORTED_ATTR);
+
+    VDISPATCH_CONV(ndims() == 4 && !with_groups() && KH() == 3 && KW() == 3
+                    && KSH() == 1 && KSW() == 1 && KDH() == 0 && KDW() == 0
+                    && padT() < 3 && padB() < 3 && padL() < 3 && padR() < 3,
+            VERBOSE_UNSUPPORTED_FEATURE, "non-winograd shape");
+
+    VDISPATCH_CONV(set_default_formats_common(nhwc, hwio, nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_CONV(attr()->post_ops_.check_sum_consistency(dst_dt, false),
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_CONV_SC(attr_.set_default_formats(dst_md(0)),
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_CONV(post_ops_with_binary_ok(attr(), *dst_md(), ndims()),
+            VERBOSE_UNSUPPORTED_POSTOP);
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper wei_d(weights_md());
+    const memory_desc_wrapper dst_d(dst_md());
+    VDISPATCH_CONV(src_d.is_plain() && wei_d.is_plain() && dst_d.is_plain(),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    mb = MB();
+    ic = IC();
+    oc = OC();
+    ih = IH();
+    iw = IW();
+    oh = OH();
+    ow = OW();
+    t_pad = padT();
+    l_pad = padL();
+    th = utils::div_up(oh, wino_m);
+    tw = utils::div_up(ow, wino_m);
+    n_tiles_total = mb * th * tw;
+
+    // The transformed tensors take several times the memory of the
+    // convolution tensors.
+    const dim_t scratch_elems
+            = n_tiles * (ic * oc + n_tiles_total * (ic + oc));
+    VDISPATCH_CONV(scratch_elems <= 300000000, VERBOSE_SHAPE_RESTRICTION);
+
+    // Batched gemm over the 36 tile elements: M = V * U, where V is
+    // n_tiles_total x ic and U is ic x oc for every tile element.
+    memory_desc_t a_md, b_md, c_md;
+    const dims_t a_dims = {n_tiles, n_tiles_total, ic};
+    const dims_t b_dims = {n_tiles, ic, oc};
+    const dims_t c_dims = {n_tiles, n_tiles_total, oc};
+    const dims_t a_strides = {n_tiles_total * ic, ic, 1};
+    const dims_t b_strides = {ic * oc, oc, 1};
+    const dims_t c_strides = {n_tiles_total * oc, oc, 1};
+    VDISPATCH_CONV_SC(
+            memory_desc_init_by_strides(a_md, 3, a_dims, src_dt, a_strides),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_CONV_SC(
+            memory_desc_init_by_strides(b_md, 3, b_dims, src_dt, b_strides),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_CONV_SC(
+            memory_desc_init_by_strides(c_md, 3, c_dims, f32, c_strides),
+            VERBOSE_UNSUPPORTED_TAG);
+    primitive_attr_t gemm_attr;
+    VDISPATCH_CONV_SC(create_gemm_pd(gemm_pd_, engine, &a_md, &b_md, &c_md,
+                              &glob_zero_md, f32, &gemm_attr, true),
+            VERBOSE_PRIMITIVE_CREATION_FAIL, "gemm");
+
+    attr_info = attr_info_t::create(attr());
+    init_scratchpad();
+    return status::success;
+}
+
+void gemm_wino_convolution_fwd_t::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    const size_t dt_size = types::data_type_size(invariant_src_md()->data_type);
+    scratchpad.book(
+            key_wino_U, n_tiles * ic * oc, dt_size, OCL_BUFFER_ALIGNMENT);
+    scratchpad.book(key_wino_V, n_tiles * n_tiles_total * ic, dt_size,
+            OCL_BUFFER_ALIGNMENT);
+    scratchpad.book(key_wino_M, n_tiles * n_tiles_total * oc, sizeof(float),
+            OCL_BUFFER_ALIGNMENT);
+    scratchpad.book(key_nested, gemm_pd_->scratchpad_registry());
+}
+
+status_t gemm_wino_convolution_fwd_t::init(impl::engine_t *engine) {
+    CHECK(create_nested_primitive(gemm_, pd()->gemm_pd_, engine));
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper wei_d(pd()->weights_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const auto &src_strides = src_d.blocking_desc().strides;
+    const auto &wei_strides = wei_d.blocking_desc().strides;
+    const auto &dst_strides = dst_d.blocking_desc().strides;
+
+    compute::kernel_ctx_t kernel_ctx;
+    kernel_ctx.define_int("IC", pd()->ic);
+    kernel_ctx.define_int("OC", pd()->oc);
+    kernel_ctx.define_int("IH", pd()->ih);
+    kernel_ctx.define_int("IW", pd()->iw);
+    kernel_ctx.define_int("OH", pd()->oh);
+    kernel_ctx.define_int("OW", pd()->ow);
+    kernel_ctx.define_int("PT", pd()->t_pad);
+    kernel_ctx.define_int("PL", pd()->l_pad);
+    kernel_ctx.define_int("TH", pd()->th);
+    kernel_ctx.define_int("TW", pd()->tw);
+    kernel_ctx.define_int("N_TILES", pd()->n_tiles_total);
+    kernel_ctx.define_int("SRC_S_MB", src_strides[0]);
+    kernel_ctx.define_int("SRC_S_C", src_strides[1]);
+    kernel_ctx.define_int("SRC_S_H", src_strides[2]);
+    kernel_ctx.define_int("SRC_S_W", src_strides[3]);
+    kernel_ctx.define_int("WEI_S_O", wei_strides[0]);
+    kernel_ctx.define_int("WEI_S_I", wei_strides[1]);
+    kernel_ctx.define_int("WEI_S_H", wei_strides[2]);
+    kernel_ctx.define_int("WEI_S_W", wei_strides[3]);
+    kernel_ctx.define_int("DST_S_MB", dst_strides[0]);
+    kernel_ctx.define_int("DST_S_C", dst_strides[1]);
+    kernel_ctx.define_int("DST_S_H", dst_strides[2]);
+    kernel_ctx.define_int("DST_S_W", dst_strides[3]);
+    kernel_ctx.define_int("WITH_BIAS", pd()->with_bias());
+
+    const auto &attr_info = pd()->attr_info;
+    kernel_ctx.set_data_type(dst_d.data_type());
+    def_data_type(kernel_ctx, src_d.data_type(), "SRC");
+    def_data_type(kernel_ctx, wei_d.data_type(), "WEI");
+    def_data_type(kernel_ctx,
+            pd()->with_bias() ? pd()->weights_md(1)->data_type : data_type::f32,
+            "BIA");
+    def_data_type(kernel_ctx, dst_d.data_type(), "DST");
+    def_data_type(kernel_ctx,
+            attr_info.sum_data_type == data_type::undef
+                    ? dst_d.data_type()
+                    : attr_info.sum_data_type,
+            "SUM");
+    CHECK(def_attr_info(kernel_ctx, attr_info, pd()->attr()->post_ops_,
+            *pd()->invariant_dst_md()));
+
+    std::vector<compute::kernel_t> kernels;
+    CHECK(create_kernels(engine, &kernels,
+            {"gemm_wino_wei_transform", "gemm_wino_src_transform",
+                    "gemm_wino_dst_transform"},
+            kernel_ctx));
+    wei_kernel_ = kernels[0];
+    src_kernel_ = kernels[1];
+    dst_kernel_ = kernels[2];
+    if (!wei_kernel_ || !src_kernel_ || !dst_kernel_)
+        return status::runtime_error;
+    return status::success;
+}
+
+status_t gemm_wino_convolution_fwd_t::execute(const exec_ctx_t &ctx) const {
+    auto &src = CTX_IN_STORAGE(DNNL_ARG_SRC);
+    auto &wei = CTX_IN_STORAGE(DNNL_ARG_WEIGHTS);
+    auto &bias = CTX_IN_STORAGE(DNNL_ARG_BIAS);
+    auto &dst = CTX_OUT_STORAGE(DNNL_ARG_DST);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    auto U = scratchpad.get_memory_storage(key_wino_U);
+    auto V = scratchpad.get_memory_storage(key_wino_V);
+    auto M = scratchpad.get_memory_storage(key_wino_M);
+
+    const size_t ic = pd()->ic, oc = pd()->oc;
+    const size_t th = pd()->th, tw = pd()->tw, mb = pd()->mb;
+
+    compute::kernel_arg_list_t wei_args;
+    wei_args.set(0, wei);
+    wei_args.set(1, *U);
+    CHECK(parallel_for(
+            ctx, compute::nd_range_t({oc, ic, 1}), wei_kernel_, wei_args));
+
+    compute::kernel_arg_list_t src_args;
+    src_args.set(0, src);
+    src_args.set(1, *V);
+    CHECK(parallel_for(ctx, compute::nd_range_t({ic, tw, mb * th}),
+            src_kernel_, src_args));
+
+    gemm_exec_args_t gemm_args;
+    gemm_args.a = V.get();
+    gemm_args.b = U.get();
+    gemm_args.c = M.get();
+    gemm_exec_ctx_t gemm_ctx(ctx, gemm_args);
+    nested_scratchpad_t ns(ctx, key_nested, gemm_);
+    gemm_ctx.set_scratchpad_grantor(ns.grantor());
+    CHECK(gpu_gemm(gemm_)->execute(gemm_ctx));
+
+    compute::kernel_arg_list_t dst_args;
+    int arg_idx = 0;
+    dst_args.set(arg_idx++, *M);
+    dst_args.set(arg_idx++, bias);
+    dst_args.set(arg_idx++, dst);
+    append_post_ops_to_arg_list(ctx, dst_args, arg_idx,
+            pd()->attr()->post_ops_, *pd()->invariant_dst_md());
+    return parallel_for(ctx, compute::nd_range_t({oc, tw, mb * th}),
+            dst_kernel_, dst_args);
+}
+
+} // namespace intel
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,82 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GPU_INTEL_GEMM_WINO_CONVOLUTION_HPP
+#define GPU_INTEL_GEMM_WINO_CONVOLUTION_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/gemm_utils.hpp"
+#include "common/primitive.hpp"
+#include "gpu/gpu_convolution_pd.hpp"
+#include "gpu/intel/gpu_primitive.hpp"
+#include "gpu/intel/primitive_conf.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace intel {
+
+// Winograd F(4x4, 3x3) convolution. The input and the weights are
+// transformed into 6x6 tiles by OpenCL kernels, the 36 element-wise products
+// of the tiles are computed as one batched gemm, which runs on the systolic
+// arrays of the device, and the output transform applies the bias and the
+// post-ops.
+struct gemm_wino_convolution_fwd_t : public gpu_primitive_t {
+    using gpu_primitive_t::gpu_primitive_t;
+    struct pd_t : public gpu_convolution_fwd_pd_t {
+        using gpu_convolution_fwd_pd_t::gpu_convolution_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T((gemm_pd_ ? gemm_pd_->name() : "ocl:gemm:wino"),
+                gemm_wino_convolution_fwd_t);
+
+        status_t init(impl::engine_t *engine);
+
+        // Output tile size m and tile size m + r - 1 of F(m, r).
+        static constexpr int wino_m = 4;
+        static constexpr int tile_size = 6;
+        static constexpr int n_tiles = tile_size * tile_size;
+
+        dim_t mb = 0, ic = 0, oc = 0;
+        dim_t ih = 0, iw = 0, oh = 0, ow = 0;
+        dim_t t_pad = 0, l_pad = 0;
+        // Number of output tiles along the spatial dimensions and in total.
+        dim_t th = 0, tw = 0, n_tiles_total = 0;
+
+        attr_info_t attr_info = {};
+        std::shared_ptr<primitive_desc_t> gemm_pd_;
+
+    private:
+        void init_scratchpad();
+    };
+
+    status_t init(impl::engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::shared_ptr<impl::primitive_t> gemm_;
+    compute::kernel_t wei_kernel_;
+    compute::kernel_t src_kernel_;
+    compute::kernel_t dst_kernel_;
+};
+
+} // namespace intel
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
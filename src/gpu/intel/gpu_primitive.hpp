@@ -18,8 +18,10 @@
 #define GPU_INTEL_GPU_PRIMITIVE_HPP
 
 #include <cassert>
+#include <functional>
 #include "gpu/intel/compute/utils.hpp"
 
+#include "common/background_pool.hpp"
 #include "common/cache_blob.hpp"
 #include "common/utils.hpp"
 #include "gpu/gpu_primitive.hpp"
@@ -145,7 +147,8 @@ struct gpu_primitive_t : public gpu::primitive_t {
     template <typename T>
     status_t create_kernels(impl::engine_t *engine,
             std::vector<compute::kernel_t> &kernels,
-            const std::vector<const char *> &kernel_names, const T &params) {
+            const std::vector<const char *> &kernel_names, const T &params,
+            bool register_kernel = true) {
         auto *compute_engine
                 = utils::downcast<compute::compute_engine_t *>(engine);
         if (cache_blob()) {
@@ -153,7 +156,7 @@ struct gpu_primitive_t : public gpu::primitive_t {
                     cache_blob(), kernels, kernel_names));
             for (auto &k : kernels)
                 k.hash_dump("blob");
-            CHECK(register_kernels(kernels));
+            if (register_kernel) CHECK(register_kernels(kernels));
             return status::success;
         }
 
@@ -171,21 +174,49 @@ struct gpu_primitive_t : public gpu::primitive_t {
 
         for (auto &k : kernels)
             k.hash_dump("real");
-        CHECK(register_kernels(kernels));
+        if (register_kernel) CHECK(register_kernels(kernels));
 
         return status::success;
     }
 
     template <typename T>
     status_t create_kernel(impl::engine_t *engine, compute::kernel_t &kernel,
-            const char *kernel_name, const T &params) {
+            const char *kernel_name, const T &params,
+            bool register_kernel = true) {
         std::vector<compute::kernel_t> kernels(1);
-        VCHECK_KERNEL(create_kernels(engine, kernels, {kernel_name}, params),
+        VCHECK_KERNEL(create_kernels(engine, kernels, {kernel_name}, params,
+                              register_kernel),
                 VERBOSE_KERNEL_CREATION_FAIL, kernel_name);
         kernel = kernels[0];
         return status::success;
     }
 
+    // A kernel creation step for create_kernels_concurrently(). `create`
+    // stores the kernel to `kernel` and registers it if requested.
+    struct kernel_task_t {
+        compute::kernel_t *kernel;
+        std::function<status_t(bool register_kernel)> create;
+    };
+
+    // Runs the tasks concurrently on the calling thread and the background
+    // pool, then registers the created kernels in the order of the tasks.
+    // Kernels are read from a cache blob in registration order, so the tasks
+    // run serially when the primitive is created from a cache blob.
+    status_t create_kernels_concurrently(
+            const std::vector<kernel_task_t> &tasks) {
+        if (cache_blob() || tasks.size() < 2) {
+            for (auto &t : tasks)
+                CHECK(t.create(true));
+            return status::success;
+        }
+        CHECK(background_pool_t::get().parallel_for((int)tasks.size(),
+                [&](int i) { return tasks[i].create(false); }));
+        std::vector<compute::kernel_t> kernels;
+        for (auto &t : tasks)
+            kernels.push_back(*t.kernel);
+        return register_kernels(kernels);
+    }
+
     // TODO: use inheritance for exec_ctx_t to get rid of such places...
     static status_t parallel_for(const gemm_exec_ctx_t &ctx,
             const compute::nd_range_t &range, const compute::kernel_t &kernel,
@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gpu/intel/ocl_post_ops.h"
+#include "gpu/intel/ocl_types.h"
+
+#define N_BLOCKS ((DIM_N + BLOCK - 1) / BLOCK)
+
+// Each work-group computes BLOCK x BLOCK blocks of dst, one element per work
+// item. The blocks of all the groups are numbered group after group, and the
+// work-groups take them from a global counter until none are left.
+__attribute__((reqd_work_group_size(BLOCK, BLOCK, 1))) __kernel void
+grouped_matmul(const __global SRC_DATA_T *src, const __global WEI_DATA_T *wei,
+        const __global BIA_DATA_T *bia, __global DST_DATA_T *dst,
+        const __global int *offsets, volatile __global int *counter,
+        int M POST_OP_ARGS) {
+    // Index of the first block and first row of every group, and the totals
+    // in the last entries.
+    __local int group_blocks[NGROUPS + 1];
+    __local int group_rows[NGROUPS + 1];
+    __local int next_block;
+    __local float src_tile[BLOCK][BLOCK];
+    __local float wei_tile[BLOCK][BLOCK];
+
+    const int ln = get_local_id(0);
+    const int lm = get_local_id(1);
+    const bool leader = ln == 0 && lm == 0;
+
+    if (leader) {
+        int nblocks = 0;
+        int row_end = 0;
+        for (int g = 0; g < NGROUPS; g++) {
+            const int row_begin = row_end;
+            row_end = max(row_begin, min(offsets[g], M));
+            group_blocks[g] = nblocks;
+            group_rows[g] = row_begin;
+            nblocks += (row_end - row_begin + BLOCK - 1) / BLOCK * N_BLOCKS;
+        }
+        group_blocks[NGROUPS] = nblocks;
+        group_rows[NGROUPS] = row_end;
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    for (;;) {
+        if (leader) next_block = atomic_inc(counter);
+        barrier(CLK_LOCAL_MEM_FENCE);
+        const int block = next_block;
+        // Keeps the leader from overwriting next_block before every work
+        // item has read it.
+        barrier(CLK_LOCAL_MEM_FENCE);
+        if (block >= group_blocks[NGROUPS]) break;
+
+        // Find the last group starting at or before the block, which skips
+        // the empty groups sharing its first block index.
+        int g = 0;
+        int hi = NGROUPS - 1;
+        while (g < hi) {
+            const int mid = (g + hi + 1) / 2;
+            if (group_blocks[mid] <= block)
+                g = mid;
+            else
+                hi = mid - 1;
+        }
+
+        const int row_begin = group_rows[g];
+        const int row_end = group_rows[g + 1];
+        const int group_block = block - group_blocks[g];
+        const long m = row_begin + (group_block / N_BLOCKS) * BLOCK + lm;
+        const long n = (group_block % N_BLOCKS) * BLOCK + ln;
+        const bool m_ok = m < row_end;
+        const bool n_ok = n < DIM_N;
+
+        const __global WEI_DATA_T *wei_g = wei + g * WEI_S0;
+
+        float acc = 0.f;
+        for (long k0 = 0; k0 < DIM_K; k0 += BLOCK) {
+            src_tile[lm][ln] = (m_ok && k0 + ln < DIM_K)
+                    ? SRC_TO_REF(src[m * SRC_S0 + (k0 + ln) * SRC_S1])
+                    : 0.f;
+            wei_tile[lm][ln] = (n_ok && k0 + lm < DIM_K)
+                    ? WEI_TO_REF(wei_g[(k0 + lm) * WEI_S1 + n * WEI_S2])
+                    : 0.f;
+            barrier(CLK_LOCAL_MEM_FENCE);
+            for (int k = 0; k < BLOCK; k++)
+                acc += src_tile[lm][k] * wei_tile[k][ln];
+            barrier(CLK_LOCAL_MEM_FENCE);
+        }
+
+        if (m_ok && n_ok) {
+            const long dst_off = m * DST_S0 + n * DST_S1;
+#if WITH_BIAS
+            acc += BIA_TO_REF(bia[g * BIA_S0 + n * BIA_S1]);
+#endif
+            float dst_data;
+#if WITH_SUM
+            dst_data = DST_TO_REF(dst[dst_off]);
+#endif
+            APPLY_POST_OPS_SERIAL(acc, dst_data, m, n, 0, 0, 0, 0);
+            dst[dst_off] = TO_DST(acc);
+        }
+    }
+}
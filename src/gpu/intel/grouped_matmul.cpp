@@ -0,0 +1,188 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gpu/intel/grouped_matmul.hpp"
+
+#include "common/c_types_map.hpp"
+#include "common/type_helpers.hpp"
+#include "gpu/intel/compute/compute_engine.hpp"
+#include "gpu/intel/compute/compute_stream.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace intel {
+
+status_t grouped_matmul_t::pd_t::set_default_formats() {
+    using namespace format_tag;
+    if (src_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(src_md_, ab));
+    if (weights_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(weights_md_, abc));
+    if (dst_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(dst_md_, ab));
+    if (with_bias() && bias_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(bias_md_, ab));
+    return status::success;
+}
+
+status_t grouped_matmul_t::pd_t::init(impl::engine_t *engine) {
+    using namespace data_type;
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    VDISPATCH_MATMUL(is_grouped(), VERBOSE_BAD_PARAM, "group_offsets");
+    VDISPATCH_MATMUL(is_dense_format_kind(), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(attr()->has_default_values(skip_mask_t::post_ops
+                             | skip_mask_t::sum_dt | skip_mask_t::fpmath_mode
+                             | skip_mask_t::accumulation_mode),
+            VERBOSE_UNSUPPORTED_ATTR);
+    const auto &po = attr()->post_ops_;
+    VDISPATCH_MATMUL(po.find(primitive_kind::binary) == -1
+                    && po.find(primitive_kind::prelu) == -1,
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_MATMUL_SC(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL_SC(attr_.set_default_formats(dst_md(0)),
+            VERBOSE_UNSUPPORTED_POSTOP);
+
+    const memory_desc_wrapper src_d(src_md_);
+    const memory_desc_wrapper wei_d(weights_md_);
+    const memory_desc_wrapper dst_d(dst_md_);
+    const memory_desc_wrapper bia_d(bias_md_);
+    VDISPATCH_MATMUL(src_d.is_plain() && wei_d.is_plain() && dst_d.is_plain()
+                    && IMPLICATION(with_bias(), bia_d.is_plain()),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL(!src_d.has_runtime_strides()
+                    && !wei_d.has_runtime_dims_or_strides()
+                    && !dst_d.has_runtime_strides()
+                    && !bia_d.has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    const auto src_dt = src_md_.data_type;
+    const auto wei_dt = weights_md_.data_type;
+    const auto dst_dt = dst_md_.data_type;
+    VDISPATCH_MATMUL(utils::one_of(src_dt, f32, f16, bf16) && wei_dt == src_dt
+                    && utils::one_of(dst_dt, f32, src_dt)
+                    && IMPLICATION(with_bias(),
+                            utils::one_of(bias_md_.data_type, f32, src_dt)),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+
+    auto *compute_engine = utils::downcast<compute::compute_engine_t *>(engine);
+    VDISPATCH_MATMUL(IMPLICATION(src_dt == f16,
+                             compute_engine->mayiuse(
+                                     compute::device_ext_t::khr_fp16)),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+
+    // A persistent grid of work-groups, a few per execution unit, is enough
+    // to keep the device busy whatever the distribution of the rows.
+    const auto *dev_info = compute_engine->device_info();
+    const dim_t N = dst_md_.dims[1];
+    const dim_t max_m_blocks = src_d.has_runtime_dims()
+            ? dim_t(dev_info->eu_count()) * 4
+            : utils::div_up(src_md_.dims[0], block) + n_groups();
+    const dim_t max_blocks = max_m_blocks * utils::div_up(N, block);
+    nthr_groups = (int)nstl::min<dim_t>(
+            max_blocks, nstl::max(dev_info->eu_count(), 1) * 4);
+
+    attr_info_ = attr_info_t::create(attr());
+    init_scratchpad();
+    return status::success;
+}
+
+status_t grouped_matmul_t::init(impl::engine_t *engine) {
+    compute::kernel_ctx_t kernel_ctx;
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper wei_d(pd()->weights_md(0));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper bia_d(pd()->weights_md(1));
+    const auto &src_strides = src_d.blocking_desc().strides;
+    const auto &wei_strides = wei_d.blocking_desc().strides;
+    const auto &dst_strides = dst_d.blocking_desc().strides;
+
+    kernel_ctx.define_int("BLOCK", pd_t::block);
+    kernel_ctx.define_int("NGROUPS", pd()->n_groups());
+    kernel_ctx.define_int("DIM_K", src_d.dims()[1]);
+    kernel_ctx.define_int("DIM_N", dst_d.dims()[1]);
+    kernel_ctx.define_int("SRC_S0", src_strides[0]);
+    kernel_ctx.define_int("SRC_S1", src_strides[1]);
+    kernel_ctx.define_int("WEI_S0", wei_strides[0]);
+    kernel_ctx.define_int("WEI_S1", wei_strides[1]);
+    kernel_ctx.define_int("WEI_S2", wei_strides[2]);
+    kernel_ctx.define_int("DST_S0", dst_strides[0]);
+    kernel_ctx.define_int("DST_S1", dst_strides[1]);
+    kernel_ctx.define_int("WITH_BIAS", pd()->with_bias());
+    if (pd()->with_bias()) {
+        kernel_ctx.define_int("BIA_S0", bia_d.blocking_desc().strides[0]);
+        kernel_ctx.define_int("BIA_S1", bia_d.blocking_desc().strides[1]);
+    }
+
+    kernel_ctx.set_data_type(dst_d.data_type());
+    def_data_type(kernel_ctx, src_d.data_type(), "SRC");
+    def_data_type(kernel_ctx, wei_d.data_type(), "WEI");
+    def_data_type(kernel_ctx, dst_d.data_type(), "DST");
+    def_data_type(kernel_ctx,
+            pd()->with_bias() ? bia_d.data_type() : data_type::f32, "BIA");
+    CHECK(def_attr_info(kernel_ctx, pd()->attr_info_, pd()->attr()->post_ops_,
+            *pd()->dst_md()));
+
+    CHECK(create_kernel(engine, &kernel_, "grouped_matmul", kernel_ctx));
+    if (!kernel_) return status::runtime_error;
+    return status::success;
+}
+
+status_t grouped_matmul_t::execute(const exec_ctx_t &ctx) const {
+    const auto &src = CTX_IN_STORAGE(DNNL_ARG_SRC);
+    const auto &wei = CTX_IN_STORAGE(DNNL_ARG_WEIGHTS);
+    const auto &bia = CTX_IN_STORAGE(DNNL_ARG_BIAS);
+    const auto &offsets = CTX_IN_STORAGE(DNNL_ARG_GROUP_OFFSETS);
+    auto &dst = CTX_OUT_STORAGE(DNNL_ARG_DST);
+
+    const auto src_d = ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md());
+    const dim_t M = src_d.dims()[0];
+    if (M == 0) return status::success;
+
+    // The work-groups take the dst blocks from a counter that has to start
+    // at zero for every execution.
+    auto counter = ctx.get_scratchpad_grantor().get_memory_storage(
+            memory_tracking::names::key_matmul_grouped_counter);
+    auto *compute_stream
+            = utils::downcast<compute::compute_stream_t *>(ctx.stream());
+    CHECK(compute_stream->fill(*counter, 0, sizeof(int32_t),
+            compute_stream->ctx().get_deps(),
+            compute_stream->ctx().get_deps()));
+
+    compute::kernel_arg_list_t arg_list;
+    int arg_idx = 0;
+    arg_list.set(arg_idx++, src);
+    arg_list.set(arg_idx++, wei);
+    arg_list.set(arg_idx++, bia);
+    arg_list.set(arg_idx++, dst);
+    arg_list.set(arg_idx++, offsets);
+    arg_list.set(arg_idx++, *counter);
+    arg_list.set(arg_idx++, into<int>(M));
+    append_post_ops_to_arg_list(
+            ctx, arg_list, arg_idx, pd()->attr()->post_ops_, *pd()->dst_md());
+
+    const size_t block = pd_t::block;
+    compute::range_t gws = {block, block * pd()->nthr_groups, 1};
+    compute::range_t lws = {block, block, 1};
+    return parallel_for(ctx, compute::nd_range_t(gws, lws), kernel_, arg_list);
+}
+
+} // namespace intel
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
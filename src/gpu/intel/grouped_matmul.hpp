@@ -0,0 +1,75 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GPU_INTEL_GROUPED_MATMUL_HPP
+#define GPU_INTEL_GROUPED_MATMUL_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+#include "gpu/gpu_matmul_pd.hpp"
+#include "gpu/intel/gpu_primitive.hpp"
+#include "gpu/intel/primitive_conf.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace intel {
+
+// Grouped matmul computing all the groups in a single dispatch. The dst
+// blocks of every group are numbered one group after another, and a
+// persistent grid of work-groups takes them from a global counter, so short
+// groups don't leave the device idle as separate launches per group would.
+struct grouped_matmul_t : public gpu_primitive_t {
+    using gpu_primitive_t::gpu_primitive_t;
+    struct pd_t : public gpu_matmul_pd_t {
+        using gpu_matmul_pd_t::gpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T("ocl:grouped:any", grouped_matmul_t);
+
+        status_t init(impl::engine_t *engine);
+
+        // Size of the square dst blocks computed by a work-group.
+        static constexpr int block = 16;
+
+        int nthr_groups = 0;
+        attr_info_t attr_info_ = {};
+
+    private:
+        status_t set_default_formats();
+
+        void init_scratchpad() {
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.book(memory_tracking::names::key_matmul_grouped_counter,
+                    1, sizeof(int32_t), OCL_BUFFER_ALIGNMENT);
+        }
+    };
+
+    status_t init(impl::engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    compute::kernel_t kernel_;
+};
+
+} // namespace intel
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
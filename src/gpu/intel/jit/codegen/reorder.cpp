@@ -629,7 +629,7 @@ void reorder_impl_t::emit_1d(copy_plan_t &plan, const reorder_operand_t &dst,
 
     const auto sat = ngen::InstructionModifier::createSaturate();
     ngen::InstructionModifier mod;
-    if (needs_saturate(dst.type(), src.type())) mod |= sat;
+    if (saturate_ && needs_saturate(dst.type(), src.type())) mod |= sat;
 
     dst.layout.for_each_tile(tile, [&](const icoord_t &start) {
         // Tile operands
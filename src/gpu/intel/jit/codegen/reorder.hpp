@@ -327,6 +327,14 @@ public:
         , src_layout_(reorder.src_layout)
         , dst_layout_(reorder.dst_layout) {
         layout_t::try_reinterpret_to_wider_type(src_layout_, dst_layout_);
+        // A sub-byte integer relayout moves raw nibbles: they are widened as
+        // unsigned values, so that packing them back needs no saturation.
+        if (src_layout_.type() == dst_layout_.type()
+                && src_layout_.type().is_x4()) {
+            src_layout_ = src_layout_.retype(type_t::u4());
+            dst_layout_ = dst_layout_.retype(type_t::u4());
+            saturate_ = false;
+        }
     }
 
     template <typename GeneratorT>
@@ -411,6 +419,7 @@ private:
     ngen::HW hw_;
     layout_t src_layout_;
     layout_t dst_layout_;
+    bool saturate_ = true;
 };
 
 } // namespace jit
@@ -16,7 +16,9 @@
 
 #include "gpu/intel/jit/conv/gen_convolution.hpp"
 
+#include <chrono>
 #include <iostream>
+#include <limits>
 #include <utility>
 
 #include "common/primitive_desc_iface.hpp"
@@ -28,6 +30,7 @@
 #include "gpu/gpu_zero_points_conv.hpp"
 #include "gpu/intel/jit/conv/config.hpp"
 #include "gpu/intel/jit/conv/conv_kernel.hpp"
+#include "gpu/intel/jit/conv/lookup_table.hpp"
 #include "gpu/intel/jit/conv/tiler.hpp"
 #include "gpu/intel/jit/conv/zero_out.hpp"
 #include "gpu/intel/jit/ir/kernel_info.hpp"
@@ -126,7 +129,6 @@ public:
     status_t init(T *primitive, impl::engine_t *engine) {
         auto *pd = primitive->pd();
         auto &data = *pd->data;
-        auto &tensor_cfg = data.tensor_cfg;
         auto tiler = std::make_shared<conv_tiler_t>(data.pd_cfg);
 
         if (primitive->cache_blob()) {
@@ -136,8 +138,6 @@ public:
             primitive->set_version(version);
         }
 
-        bool ok = false;
-        int max_tries = 100;
         conv_config_t cfg;
         layout_t zp_dst;
         if (data.zp_pd) zp_dst = layout_t(zp_conv_md_out(data), false);
@@ -146,6 +146,37 @@ public:
             tiler->set_cur_version(primitive->version());
         }
 
+        CHECK(create_kernels(primitive, engine, tiler, zp_dst, cfg));
+
+        if (!primitive->cache_blob() && can_tune(*pd, *tiler, cfg)) {
+            int32_t version = primitive->version();
+            CHECK(tune(primitive, engine, tiler, zp_dst, cfg, version));
+            tiler->set_cur_version(version);
+            if (version != primitive->version())
+                CHECK(create_kernels(primitive, engine, tiler, zp_dst, cfg));
+            const auto undef = blocking_params_t::bufs_hint_undef;
+            update_conv_tuning_db(cfg.key().to_filter(),
+                    cfg.params((!cfg.slm() && !cfg.prefetch()) ? 0 : undef));
+        }
+
+        CONV_CHECK(primitive->register_kernels(kernels_));
+
+        conv_tiler_t::after_create_hook(cfg, primitive);
+        return status::success;
+    }
+
+    // Creates the kernels for the first valid configuration starting from the
+    // current position of the tiler.
+    template <typename T>
+    status_t create_kernels(T *primitive, impl::engine_t *engine,
+            const std::shared_ptr<conv_tiler_t> &tiler, const layout_t &zp_dst,
+            conv_config_t &cfg) {
+        auto *pd = primitive->pd();
+        auto &data = *pd->data;
+        auto &tensor_cfg = data.tensor_cfg;
+
+        bool ok = false;
+        int max_tries = 100;
         for (int try_iter = 0; try_iter < max_tries; try_iter++) {
             if (try_iter != 0 && !tiler->is_tuning_mode())
                 tiler->move_next(cfg);
@@ -245,9 +276,119 @@ public:
         }
         if (!ok) return report_runtime_error(pd, engine);
         gpu_assert(kernels_.size() == data.kernel_infos.size());
-        CONV_CHECK(primitive->register_kernels(kernels_));
+        return status::success;
+    }
 
-        conv_tiler_t::after_create_hook(cfg, primitive);
+    // Online tuning benchmarks the convolution kernel alone so it's limited
+    // to problems where all its arguments can be allocated from the memory
+    // descriptors and no nested primitive is needed.
+    template <typename T>
+    static bool can_tune(
+            const T &pd, const conv_tiler_t &tiler, const conv_config_t &cfg) {
+        if (conv_online_tuning_configs() == 0) return false;
+        if (tiler.is_tuning_mode() || pd.data->zp_pd) return false;
+        if (!pd.attr()->has_default_values(
+                    primitive_attr_t::skip_mask_t::post_ops))
+            return false;
+        return find_conv_tuning_db(cfg.key()).is_empty();
+    }
+
+    // Benchmarks the convolution kernels of the following configurations of
+    // the tiler and returns the version of the fastest one in `version`.
+    template <typename T>
+    status_t tune(T *primitive, impl::engine_t *engine,
+            const std::shared_ptr<conv_tiler_t> &tiler, const layout_t &zp_dst,
+            const conv_config_t &cfg, int32_t &version) {
+        auto *pd = primitive->pd();
+        auto &data = *pd->data;
+        const kernel_info_t *info = nullptr;
+        compute::kernel_t kernel;
+        for (int i = 0; i < int(data.kernel_infos.size()); i++) {
+            if (data.kernel_infos[i].id() != kernel_id_t::convolution)
+                continue;
+            info = &data.kernel_infos[i];
+            kernel = kernels_[i];
+        }
+        gpu_assert(info);
+
+        double best_nsec = std::numeric_limits<double>::max();
+        if (time_kernel(primitive, engine, *info, cfg.nd_range(), kernel,
+                    best_nsec)
+                != status::success)
+            return status::success;
+        gpu_info() << "Tuning: " << cfg.params().str() << " " << best_nsec
+                   << " ns";
+
+        auto try_cfg = cfg;
+        for (int i = 1; i < conv_online_tuning_configs(); i++) {
+            tiler->move_next(try_cfg);
+            if (!tiler->is_valid()) break;
+            try {
+                try_cfg = data.pd_cfg;
+                try_cfg.set_pd(pd);
+                try_cfg.set_tiler(tiler);
+                if (init_cfg(try_cfg, primitive) != status::success) break;
+                if (!tiler->is_grf_limit_ok(try_cfg)) continue;
+                auto try_kernel = make_kernel<conv_kernel_t>(primitive,
+                        /*register_kernel=*/false, engine, try_cfg, *info,
+                        try_cfg.nd_range().local_range(), zp_dst);
+                if (!try_kernel) continue;
+                double nsec = 0;
+                CHECK(time_kernel(primitive, engine, *info,
+                        try_cfg.nd_range(), try_kernel, nsec));
+                gpu_info() << "Tuning: " << try_cfg.params().str() << " "
+                           << nsec << " ns";
+                if (nsec < best_nsec) {
+                    best_nsec = nsec;
+                    version = tiler->cur_version();
+                }
+            } catch (ngen::out_of_registers_exception &) {
+                tiler->notify_out_of_registers(try_cfg);
+            } catch (std::runtime_error &) { continue; }
+        }
+        return status::success;
+    }
+
+    // Returns the average execution time of `kernel` on the service stream
+    // of the engine with uninitialized buffers in place of the arguments.
+    template <typename T>
+    static status_t time_kernel(const T *primitive, impl::engine_t *engine,
+            const kernel_info_t &info, const compute::nd_range_t &nd_range,
+            const compute::kernel_t &kernel, double &nsec) {
+        std::vector<memory_storage_wrapper_t> storage_list(info.nargs());
+        for (int i = 0; i < info.nargs(); i++) {
+            if (!info.is_user(i) && !info.is_scratchpad(i)) continue;
+            const size_t size = info.arg_size(i, primitive);
+            if (size == 0) return status::unimplemented;
+            memory_storage_t *storage = nullptr;
+            CHECK(engine->create_memory_storage(&storage, size));
+            storage_list[i] = std::unique_ptr<memory_storage_t>(storage);
+        }
+        compute::kernel_arg_list_t arg_list;
+        info.set_args(arg_list, storage_list);
+
+        impl::stream_t *stream = nullptr;
+        CHECK(engine->get_service_stream(stream));
+        if (!stream) return status::runtime_error;
+        auto *compute_stream
+                = utils::downcast<compute::compute_stream_t *>(stream);
+        auto submit = [&]() {
+            auto &deps = compute_stream->ctx().get_deps();
+            return kernel.parallel_for(*stream, nd_range, arg_list, deps, deps);
+        };
+
+        // The first submission is excluded as it includes the time needed to
+        // load the kernel on the device.
+        const int iters = 5;
+        CHECK(submit());
+        CHECK(stream->wait());
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iters; i++)
+            CHECK(submit());
+        CHECK(stream->wait());
+        const auto end = std::chrono::steady_clock::now();
+        nsec = std::chrono::duration<double, std::nano>(end - start).count()
+                / iters;
         return status::success;
     }
 
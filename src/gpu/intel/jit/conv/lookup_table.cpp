@@ -16,6 +16,8 @@
 
 #include "gpu/intel/jit/conv/lookup_table.hpp"
 
+#include <cstdio>
+#include <fstream>
 #include <mutex>
 
 #include "common/utils.hpp"
@@ -167,6 +169,70 @@ conv_lookup_table_t &conv_lookup_table() {
     return conv_lookup_table_impl(/*read_only=*/false);
 }
 
+struct conv_tuning_db_instance_t {
+    conv_tuning_db_instance_t() {
+        path = getenv_string_user(env_path_name);
+        if (path.empty()) return;
+        std::ifstream in(path);
+        if (!in.good()) return;
+        table.parse(in);
+    }
+
+    // The database is written to a temporary file first and then renamed so
+    // that an interrupted process doesn't leave a truncated file behind.
+    void save() const {
+        if (path.empty()) return;
+        const std::string tmp_path = path + ".tmp";
+        {
+            std::ofstream out(tmp_path, std::ios::binary);
+            if (!out.good()) return;
+            out << "# oneDNN GPU convolution tuning database\n";
+            table.stringify(out);
+            out << "\n";
+            if (!out.good()) {
+                out.close();
+                std::remove(tmp_path.c_str());
+                return;
+            }
+        }
+        std::remove(path.c_str());
+        if (std::rename(tmp_path.c_str(), path.c_str()) != 0)
+            std::remove(tmp_path.c_str());
+    }
+
+    static const char *env_path_name;
+    std::string path;
+    conv_lookup_table_t table;
+    std::mutex mutex;
+};
+
+const char *conv_tuning_db_instance_t::env_path_name = "GPU_CONV_TUNING_DB";
+
+conv_tuning_db_instance_t &conv_tuning_db() {
+    static conv_tuning_db_instance_t instance;
+    return instance;
+}
+
+blocking_params_t find_conv_tuning_db(const conv_key_t &key) {
+    auto &db = conv_tuning_db();
+    std::lock_guard<std::mutex> lock(db.mutex);
+    return db.table.find(key);
+}
+
+void update_conv_tuning_db(
+        const conv_key_t &key, const blocking_params_t &params) {
+    auto &db = conv_tuning_db();
+    std::lock_guard<std::mutex> lock(db.mutex);
+    db.table.set(key, params);
+    db.save();
+}
+
+int conv_online_tuning_configs() {
+    static const int configs
+            = std::max(0, getenv_int_user("GPU_CONV_TUNING", 0));
+    return configs;
+}
+
 } // namespace jit
 } // namespace intel
 } // namespace gpu
@@ -57,6 +57,18 @@ private:
 const conv_lookup_table_t &const_conv_lookup_table();
 conv_lookup_table_t &conv_lookup_table();
 
+// Tuning database supplied by the user with ONEDNN_GPU_CONV_TUNING_DB. Its
+// entries take priority over the built-in table, and the results of online
+// tuning are added to it and saved back to the file.
+blocking_params_t find_conv_tuning_db(const conv_key_t &key);
+void update_conv_tuning_db(
+        const conv_key_t &key, const blocking_params_t &params);
+
+// Returns the number of configurations to benchmark for a convolution without
+// a tuning database entry, set with ONEDNN_GPU_CONV_TUNING. Online tuning is
+// disabled when 0 is returned.
+int conv_online_tuning_configs();
+
 } // namespace jit
 } // namespace intel
 } // namespace gpu
@@ -1585,7 +1585,9 @@ private:
                 break;
                 break;
             case tiler_mode_t::lookup: {
-                const auto params = const_conv_lookup_table().find(cfg.key());
+                auto params = find_conv_tuning_db(cfg.key());
+                if (params.is_empty() || !chk.is_ok(params.blocking()))
+                    params = const_conv_lookup_table().find(cfg.key());
                 if (!params.is_empty() && chk.is_ok(params.blocking())) {
                     gpu_info() << "Using lookup table config: " << params.str();
                     params_gen_ = params_generator_t(tune_level, simd_size, chk,
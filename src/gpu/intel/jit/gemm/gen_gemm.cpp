@@ -431,69 +431,113 @@ status_t gen_gemm_t::execute(const gemm_exec_ctx_t &ctx) const {
         }
     }
 
-    for (int64_t Bk = 0; Bk < nstl::max<dim_t>(k, 1); Bk += block_k) {
-        int64_t size_k = k - Bk;
-        bool last_k_block = (size_k <= block_k);
-        if (!last_k_block) size_k = block_k;
-
-        for (int64_t Bm = 0; Bm < m; Bm += block_m) {
-            int64_t size_m = m - Bm;
-            if (size_m > block_m) size_m = block_m;
-
-            auto off_a_src
-                    = off_a0 + (!transa ? (Bm + Bk * lda) : (Bk + Bm * lda));
-
-            for (int64_t Bn = 0; Bn < n; Bn += block_n) {
-                int64_t size_n = n - Bn;
-                if (size_n > block_n) size_n = block_n;
-
-                auto off_b_src = off_b0
-                        + (!transb ? (Bk + Bn * ldb) : (Bn + Bk * ldb));
-
-                auto off_c = off_c0 + Bm + Bn * ldc;
-
-                auto off_aq = off_aq0;
-                auto off_bq = off_bq0;
-                if (pd()->ao_dims_ >= 1 || a_scales) off_aq += Bm;
-                if (pd()->bo_dims_ >= 1 || b_scales) off_bq += Bn;
-
-                auto off_co = off_co0;
-                switch (cmask & 3) {
-                    case 1: off_co += Bn; break;
-                    case 2: off_co += Bm; break;
-                    case 3:
-                        off_co += isColMajor(problem.CO.layout)
-                                ? (Bn * ldco + Bm)
-                                : (Bm * ldco + Bn);
-                        break;
-                }
-
-                for (int i = 0; i < po_count; i++) {
-                    po_offsets[i] = po_offsets0[i];
-                    bool row = problem.postOps.binaryRow[i],
-                         col = problem.postOps.binaryCol[i];
-                    if (row && col) {
-                        auto ld = pd()->ld_binary(i);
-                        po_offsets[i] += isColMajor(problem.binary[i].layout)
-                                ? (Bn * ld + Bm)
-                                : (Bm * ld + Bn);
-                    } else if (row)
-                        po_offsets[i] += Bm;
-                    else if (col)
-                        po_offsets[i] += Bn;
+    // Launches the kernels computing the block [m_begin, m_end) x
+    // [n_begin, n_end) of C.
+    auto launch_block = [&](int64_t m_begin, int64_t m_end, int64_t n_begin,
+                                int64_t n_end) -> status_t {
+        for (int64_t Bk = 0; Bk < nstl::max<dim_t>(k, 1); Bk += block_k) {
+            int64_t size_k = k - Bk;
+            bool last_k_block = (size_k <= block_k);
+            if (!last_k_block) size_k = block_k;
+
+            for (int64_t Bm = m_begin; Bm < m_end; Bm += block_m) {
+                int64_t size_m = m_end - Bm;
+                if (size_m > block_m) size_m = block_m;
+
+                auto off_a_src = off_a0
+                        + (!transa ? (Bm + Bk * lda) : (Bk + Bm * lda));
+
+                for (int64_t Bn = n_begin; Bn < n_end; Bn += block_n) {
+                    int64_t size_n = n_end - Bn;
+                    if (size_n > block_n) size_n = block_n;
+
+                    auto off_b_src = off_b0
+                            + (!transb ? (Bk + Bn * ldb) : (Bn + Bk * ldb));
+
+                    auto off_c = off_c0 + Bm + Bn * ldc;
+
+                    auto off_aq = off_aq0;
+                    auto off_bq = off_bq0;
+                    if (pd()->ao_dims_ >= 1 || a_scales) off_aq += Bm;
+                    if (pd()->bo_dims_ >= 1 || b_scales) off_bq += Bn;
+
+                    auto off_co = off_co0;
+                    switch (cmask & 3) {
+                        case 1: off_co += Bn; break;
+                        case 2: off_co += Bm; break;
+                        case 3:
+                            off_co += isColMajor(problem.CO.layout)
+                                    ? (Bn * ldco + Bm)
+                                    : (Bm * ldco + Bn);
+                            break;
+                    }
+
+                    for (int i = 0; i < po_count; i++) {
+                        po_offsets[i] = po_offsets0[i];
+                        bool row = problem.postOps.binaryRow[i],
+                             col = problem.postOps.binaryCol[i];
+                        if (row && col) {
+                            auto ld = pd()->ld_binary(i);
+                            po_offsets[i]
+                                    += isColMajor(problem.binary[i].layout)
+                                    ? (Bn * ld + Bm)
+                                    : (Bm * ld + Bn);
+                        } else if (row)
+                            po_offsets[i] += Bm;
+                        else if (col)
+                            po_offsets[i] += Bn;
+                    }
+
+                    float eff_beta = (Bk == 0) ? beta : 1.0f;
+                    CHECK(launch_nocopy(ctx, compute_stream, zero_pool, a, b,
+                            c, ao, bo, a_scales, b_scales, *co, c_temp.get(),
+                            sround_seed, po_count, po_srcs, off_a_src,
+                            off_b_src, off_c, off_aq, off_bq, off_co,
+                            po_offsets, lda, ldb, ldc, size_m, size_n, size_k,
+                            k0, alpha, eff_beta, cmask, last_k_block, swapab,
+                            disable_hilbert));
                 }
-
-                float eff_beta = (Bk == 0) ? beta : 1.0f;
-                status = launch_nocopy(ctx, compute_stream, zero_pool, a, b, c,
-                        ao, bo, a_scales, b_scales, *co, c_temp.get(),
-                        sround_seed, po_count, po_srcs, off_a_src, off_b_src,
-                        off_c, off_aq, off_bq, off_co, po_offsets, lda, ldb,
-                        ldc, size_m, size_n, size_k, k0, alpha, eff_beta, cmask,
-                        last_k_block, swapab, disable_hilbert);
-
-                if (status) return status;
             }
         }
+        return status::success;
+    };
+
+    // Large problems are split across the tiles of the device along n, or
+    // along m when it's larger, with each tile computing a disjoint block
+    // of C. Kernels synchronizing through global memory, or accumulating
+    // in a temporary C, run on the whole device.
+    const double multi_tile_min_ops = 1e9;
+    const int ntiles = compute_stream->ntiles();
+    const bool split_n = n >= m;
+    const int64_t split_dim = split_n ? n : m;
+    const int64_t split_unit = nocopy_info()->wgTile(
+            split_n ? gemmstone::LoopN : gemmstone::LoopM);
+    const bool multi_tile = ntiles > 1 && !need_zero_pool()
+            && !nocopy_info()->needsTempC()
+            && !nocopy_info()->kParallelVariable()
+            && split_dim >= ntiles * split_unit
+            && (double)m * n * k >= multi_tile_min_ops;
+
+    if (!multi_tile) {
+        CHECK(launch_block(0, m, 0, n));
+    } else {
+        const int64_t chunk
+                = utils::rnd_up(utils::div_up(split_dim, ntiles), split_unit);
+        CHECK(compute_stream->fork_tiles());
+        for (int tile = 0; tile < ntiles; tile++) {
+            int64_t begin = nstl::min(tile * chunk, split_dim);
+            int64_t end = nstl::min(begin + chunk, split_dim);
+            if (begin == end) break;
+            status = compute_stream->set_tile(tile);
+            if (status == status::success)
+                status = split_n ? launch_block(0, m, begin, end)
+                                 : launch_block(begin, end, 0, n);
+            if (status != status::success) {
+                compute_stream->join_tiles();
+                return status;
+            }
+        }
+        CHECK(compute_stream->join_tiles());
     }
 
 #ifdef DNNL_WITH_SYCL
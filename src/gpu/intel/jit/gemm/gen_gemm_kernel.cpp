@@ -14,6 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <fstream>
+#include <unordered_map>
+
 #include "gpu/intel/jit/gemm/gen_gemm_kernel.hpp"
 #include "common/c_types_map.hpp"
 #include "common/impl_registration.hpp"
@@ -42,6 +45,72 @@ void entryObserver(
                 entry->str().c_str(), score);
     }
 };
+
+// Kernel database supplied by the user with ONEDNN_GPU_GEMM_KERNEL_DB. Each
+// line maps a problem key to the catalog entry to use for it, separated by a
+// tab. Entries are usually produced by scripts/gemm_tuner.py.
+const std::unordered_map<std::string, std::string> &user_kernel_db() {
+    static const auto db = []() {
+        std::unordered_map<std::string, std::string> ret;
+        const auto path = getenv_string_user("GPU_GEMM_KERNEL_DB");
+        if (path.empty()) return ret;
+        std::ifstream in(path);
+        std::string line;
+        while (std::getline(in, line)) {
+            if (line.empty() || line[0] == '#') continue;
+            const auto pos = line.find('\t');
+            if (pos == std::string::npos) continue;
+            ret[line.substr(0, pos)] = line.substr(pos + 1);
+        }
+        return ret;
+    }();
+    return db;
+}
+
+std::string user_kernel_db_key(
+        const MatchParams &pattern, const EvaluateParams &eval_params) {
+    ostringstream_t oss;
+    oss << pattern.selector.str(pattern.alignment);
+    oss << " tags:" << pattern.tags;
+    oss << " eus:" << eval_params.euCount;
+    oss << " mnk:" << eval_params.sizes.m << "x" << eval_params.sizes.n << "x"
+        << eval_params.sizes.k;
+    oss << " batch:" << eval_params.sizes.batch;
+    oss << " alpha:" << eval_params.alpha << " beta:" << eval_params.beta;
+    oss << " post_ops:" << eval_params.postOps;
+    return oss.str();
+}
+
+// Selects the catalog entry for the problem. An entry recorded in the user
+// kernel database for the problem takes priority over the one chosen by the
+// kernel selector as long as it matches one of the patterns.
+const kcatalog::Entry *select_entry(int npatterns, const MatchParams *patterns,
+        const EvaluateParams &eval_params, EvaluateAuxOutput &aux) {
+    SelectionObserver observer = entryObserver;
+    const auto cat = catalog();
+    auto *entry = select(cat, npatterns, patterns, eval_params, aux, &observer);
+    if (!entry) return nullptr;
+
+    const auto &db = user_kernel_db();
+    const bool print_key = get_verbose(verbose_t::debuginfo) >= 5;
+    if (db.empty() && !print_key) return entry;
+
+    const auto key = user_kernel_db_key(patterns[0], eval_params);
+    if (print_key)
+        dnnl::impl::verbose_printf("info,gpu,gemm,key:%s\n", key.c_str());
+    auto it = db.find(key);
+    if (it == db.end() || it->second == entry->str()) return entry;
+    for (int i = 0; i < npatterns; i++) {
+        for (auto e = match(cat, patterns[i]); e; e++) {
+            if (e->str() != it->second) continue;
+            EvaluateAuxOutput db_aux;
+            evaluate(*e, eval_params, db_aux);
+            aux = db_aux;
+            return &*e;
+        }
+    }
+    return entry;
+}
 } // anonymous namespace
 
 status_t gen_gemm_kernel_desc_t::create_generator(
@@ -639,9 +708,8 @@ status_t gen_gemm_nocopy_kernel_desc_t::select_kernel(compute::gpu_arch_t arch,
     eval_params.batch = (batch_dims > 0);
     eval_params.deterministic = (mode & mode_deterministic);
 
-    SelectionObserver observer = entryObserver;
-    entry_ = select(catalog(), static_cast<int>(match_params.size()),
-            match_params.data(), eval_params, aux_params_, &observer);
+    entry_ = select_entry(static_cast<int>(match_params.size()),
+            match_params.data(), eval_params, aux_params_);
 
     if (!entry_) return status::unimplemented;
 
@@ -785,9 +853,7 @@ status_t gen_gemm_xe_systolic_kernel_desc_t::select_kernel(
     eval_params.cConvert = (acc_type != c_type);
     eval_params.batch = (batch_dims > 0);
 
-    SelectionObserver observer = entryObserver;
-    entry_ = select(
-            catalog(), match_params, eval_params, aux_params_, &observer);
+    entry_ = select_entry(1, &match_params, eval_params, aux_params_);
 
     if (!entry_) return status::unimplemented;
 
@@ -514,9 +514,14 @@ status_t xe_hp_systolic_gemm_t::init(impl::engine_t *engine) {
         default: co_kind_ = 'N'; break;
     }
 
+    // The compute (assembly) and copy (OpenCL) kernels are independent and
+    // are created concurrently.
+    std::vector<kernel_task_t> tasks;
+    std::vector<std::pair<compute::kernel_t *, compute::kernel_t *>> aliases;
+
     // Initialize compute kernels (assembly)
     {
-        auto status = init_compute(engine);
+        auto status = init_compute(engine, tasks, aliases);
         if (status != status::success) return status;
     }
 
@@ -538,12 +543,21 @@ status_t xe_hp_systolic_gemm_t::init(impl::engine_t *engine) {
 
             // TODO: Refactor so this can be switched to 1 batch compilation.
             // Having up to 4 calls to the OpenCL compiler is sub-optimal.
-            CHECK(create_kernel(engine, copy_kernel_[copy_b][clear_sum],
-                    params.name(), params));
-            if (!copy_kernel_[copy_b][clear_sum]) return status::runtime_error;
+            auto *kernel = &copy_kernel_[copy_b][clear_sum];
+            tasks.push_back({kernel, [=](bool register_kernel) {
+                                 return create_kernel(engine, *kernel,
+                                         params.name(), params,
+                                         register_kernel);
+                             }});
         }
     }
 
+    CHECK(create_kernels_concurrently(tasks));
+    for (auto &t : tasks)
+        if (!*t.kernel) return status::runtime_error;
+    for (auto &a : aliases)
+        *a.first = *a.second;
+
     if (get_verbose(verbose_t::debuginfo) >= 2) {
         verbose_printf("info,gpu,gemm,kernel:%dx%d,%dx%dx%d\n",
                 pd()->unroll_m(), pd()->unroll_n(), compute_info_.wg[LoopM],
@@ -553,7 +567,10 @@ status_t xe_hp_systolic_gemm_t::init(impl::engine_t *engine) {
     return status::success;
 }
 
-status_t xe_hp_systolic_gemm_t::init_compute(impl::engine_t *engine) {
+status_t xe_hp_systolic_gemm_t::init_compute(impl::engine_t *engine,
+        std::vector<kernel_task_t> &tasks,
+        std::vector<std::pair<compute::kernel_t *, compute::kernel_t *>>
+                &aliases) {
     using kd_t = gen_gemm_xe_systolic_kernel_desc_t;
 
     auto *compute_engine = utils::downcast<compute::compute_engine_t *>(engine);
@@ -601,11 +618,11 @@ status_t xe_hp_systolic_gemm_t::init_compute(impl::engine_t *engine) {
             if ((!first_k_block || !last_k_block) && !may_k_block) continue;
             if (may_k_block && last_k_block && !pd()->with_c_zero_points()
                     && !with_post_ops)
-                kernel_[first_k_block][last_k_block]
-                        = kernel_[first_k_block][false];
+                aliases.emplace_back(&kernel_[first_k_block][last_k_block],
+                        &kernel_[first_k_block][false]);
             else if (may_k_block && first_k_block && pd()->beta() == 1.0f)
-                kernel_[first_k_block][last_k_block]
-                        = kernel_[false][last_k_block];
+                aliases.emplace_back(&kernel_[first_k_block][last_k_block],
+                        &kernel_[false][last_k_block]);
             else {
                 auto this_beta = pd()->beta();
                 bool this_c_offset = pd()->with_c_zero_points();
@@ -638,12 +655,13 @@ status_t xe_hp_systolic_gemm_t::init_compute(impl::engine_t *engine) {
                     got_info = true;
                 }
 
-                CHECK(create_kernel(engine,
-                        kernel_[first_k_block][last_k_block], "gemm_kernel",
-                        kd));
-
-                if (!kernel_[first_k_block][last_k_block])
-                    return status::runtime_error;
+                auto *kernel = &kernel_[first_k_block][last_k_block];
+                auto kd_ptr = std::make_shared<kd_t>(std::move(kd));
+                tasks.push_back({kernel, [=](bool register_kernel) {
+                                     return create_kernel(engine, *kernel,
+                                             "gemm_kernel", *kd_ptr,
+                                             register_kernel);
+                                 }});
             }
         }
     }
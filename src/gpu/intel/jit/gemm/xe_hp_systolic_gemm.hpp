@@ -178,7 +178,13 @@ public:
     status_t execute(const gemm_exec_ctx_t &ctx) const override;
 
 private:
-    status_t init_compute(impl::engine_t *engine);
+    // Adds the creation of the compute kernels to `tasks`. A kernel shared
+    // between k-blocks is recorded in `aliases` as a {copy, source} pair
+    // to be assigned once the kernels are created.
+    status_t init_compute(impl::engine_t *engine,
+            std::vector<kernel_task_t> &tasks,
+            std::vector<std::pair<compute::kernel_t *, compute::kernel_t *>>
+                    &aliases);
 
     bool enable_mn_blocking() const;
     std::tuple<int64_t, int64_t, int64_t> get_blocking() const;
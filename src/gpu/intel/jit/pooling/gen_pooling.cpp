@@ -44,11 +44,16 @@ status_t gen_pooling_fwd_t::pd_t::init(impl::engine_t *engine) {
     auto dst_data_t = dst_md()->data_type;
     auto acc_data_t = desc()->accum_data_type;
 
-    // TODO: add training(?), add bwd
+    // Forward only. Max pooling training needs a workspace, which the kernel
+    // does not write; such cases are left to the OpenCL implementations.
     VDISPATCH_POOLING_SC(set_default_params(), VERBOSE_UNSUPPORTED_TAG);
-    VDISPATCH_POOLING(utils::one_of(desc()->prop_kind,
-                              /*forward_training,*/ forward_inference),
+    VDISPATCH_POOLING(
+            utils::one_of(desc()->prop_kind, forward_training,
+                    forward_inference),
             VERBOSE_BAD_PROPKIND);
+    VDISPATCH_POOLING(IMPLICATION(desc()->prop_kind == forward_training,
+                              desc()->alg_kind != pooling_max),
+            VERBOSE_UNSUPPORTED_FEATURE, "workspace");
     VDISPATCH_POOLING(
             utils::one_of(desc()->alg_kind, pooling_max,
                     pooling_avg_include_padding, pooling_avg_exclude_padding),
@@ -57,8 +62,8 @@ status_t gen_pooling_fwd_t::pd_t::init(impl::engine_t *engine) {
             (utils::everyone_is(f32, src_data_t, dst_data_t, acc_data_t)
                     || utils::everyone_is(f16, src_data_t, dst_data_t)
                     || utils::everyone_is(bf16, src_data_t, dst_data_t)
-                    || utils::everyone_is(u8, src_data_t, dst_data_t)
-                    || utils::everyone_is(s8, src_data_t, dst_data_t)),
+                    || (utils::one_of(src_data_t, u8, s8)
+                            && utils::one_of(dst_data_t, u8, s8, f32, f16))),
             VERBOSE_UNSUPPORTED_DT);
     VDISPATCH_POOLING(IMPLICATION(utils::one_of(src_data_t, f16, s8, u8),
                               desc()->prop_kind == forward_inference),
@@ -73,7 +78,7 @@ status_t gen_pooling_fwd_t::pd_t::init(impl::engine_t *engine) {
             compute_engine->mayiuse(compute::device_ext_t::intel_subgroups),
             VERBOSE_UNSUPPORTED_DEVICE_FEATURE, "subgroups");
     VDISPATCH_POOLING(
-            IMPLICATION(src_data_t == f16,
+            IMPLICATION(utils::one_of(f16, src_data_t, dst_data_t),
                     compute_engine->mayiuse(compute::device_ext_t::khr_fp16)
                             && compute_engine->mayiuse(compute::device_ext_t::
                                             intel_subgroups_short)),
@@ -86,6 +91,15 @@ status_t gen_pooling_fwd_t::pd_t::init(impl::engine_t *engine) {
     dst = std::make_shared<layout_t>(invariant_dst_md());
     VDISPATCH_POOLING(src->ndims() == dst->ndims(), VERBOSE_INCONSISTENT_NDIMS,
             "src->ndims()", "dst_ndims()");
+    // The kernel maps source and destination tiles one to one, which holds
+    // for data types of different sizes only if the blocking is the same.
+    bool same_blocking = src->blocks().size() == dst->blocks().size();
+    for (size_t i = 0; same_blocking && i < src->blocks().size(); i++) {
+        const auto &s = src->blocks()[i];
+        const auto &d = dst->blocks()[i];
+        same_blocking = s.dim_idx == d.dim_idx && s.block == d.block;
+    }
+    VDISPATCH_POOLING(same_blocking, VERBOSE_UNSUPPORTED_TAG);
 
     pool_conf = std::make_shared<pool_conf_t>();
     set_default_pool_conf(*pool_conf, *desc(), *invariant_src_md(),
@@ -401,11 +401,14 @@ stmt_t pooling_ir_builder_t::try_build(pooling_ir_builder_t &pb,
     gpu_assert(src_tile.elems() == simd);
     gpu_assert(dst_tile.elems() == simd);
 
-    const bool is_identity(prb.kd * prb.kh * prb.kw <= 1);
-
     const type_t read_type(read_layout.type().kind(), simd);
     const type_t write_type(write_layout.type().kind(), simd);
 
+    // The read buffer is written directly only when the source and the
+    // destination types match, e.g. not for s8 to f32 pooling.
+    const bool is_identity = prb.kd * prb.kh * prb.kw <= 1
+            && read_type.kind() == write_type.kind();
+
     stmt_t stmt;
 
     auto gen_fill_values = [](int simd, bool isneg, type_t type) {
@@ -73,8 +73,13 @@ status_t gen_reorder_t::pd_t::init(impl::engine_t *engine,
                               f4_e3m0, f4_e2m1, s32, s8, u8, s4, u4, f64),
             VERBOSE_UNSUPPORTED_DT);
     VDISPATCH_REORDER(utils::one_of(dst_dt, f32, f16, bf16, f8_e5m2, f8_e4m3,
-                              f4_e3m0, f4_e2m1, s32, s8, u8, f64),
+                              f4_e3m0, f4_e2m1, s32, s8, u8, s4, u4, f64),
             VERBOSE_UNSUPPORTED_DT);
+    // int4 destinations are limited to repacking int4 data, which needs no
+    // conversion to the 4-bit range.
+    VDISPATCH_REORDER(IMPLICATION(utils::one_of(dst_dt, s4, u4),
+                              src_dt == dst_dt),
+            VERBOSE_UNSUPPORTED_DT_CFG);
     VDISPATCH_REORDER(IMPLICATION(src_dt == f16 || dst_dt == f16,
                               device_info->has_native(f16)),
             VERBOSE_UNSUPPORTED_DT_CFG);
@@ -130,15 +130,29 @@ std::string plan_registry_t::entry_t::registry_str() const {
     return oss.str();
 }
 
+// Unlike getenv_string_user() keeps the case of the value and allows long
+// values as the variable holds a file path.
+static std::string getenv_path(const char *name) {
+    const int len = 4096;
+    char value[len];
+    for (const auto &prefix : {"ONEDNN_", "DNNL_"}) {
+        auto full_name = std::string(prefix) + name;
+        if (getenv(full_name.c_str(), value, len) > 0) return value;
+    }
+    return {};
+}
+
 struct plan_registry_instance_t {
     static plan_registry_instance_t &get() {
         static plan_registry_instance_t _instance;
         return _instance;
     }
 
+    // A registry refitted for the device with gpu_conv_planner --refit is
+    // loaded from ONEDNN_GPU_CONV_PLAN_REGISTRY_PATH when the file exists,
+    // otherwise the built-in registry is used.
     plan_registry_instance_t() {
-#ifdef DNNL_DEV_MODE
-        registry_path = getenv_string_user(env_registry_path_name);
+        registry_path = getenv_path(env_registry_path_name);
         if (!registry_path.empty()) {
             std::ifstream in(registry_path);
             if (in.good()) {
@@ -148,7 +162,6 @@ struct plan_registry_instance_t {
                 return;
             }
         }
-#endif
         registry = plan_registry_t(get_plan_registry_entries());
     }
 
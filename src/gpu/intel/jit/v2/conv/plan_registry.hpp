@@ -51,6 +51,7 @@ public:
 
     void set(const entry_t &entry) { entries_.emplace_back(entry); }
     int size() const { return (int)entries_.size(); }
+    const std::vector<entry_t> &entries() const { return entries_; }
     kernel_desc_t find_best(const problem_t &prb,
             specialization_mode_t spec_mode
             = specialization_mode_t::none) const;
@@ -792,6 +792,36 @@ plan_registry_t::entry_t prepare_plan_registry_entry(
     return entry;
 }
 
+plan_registry_t refit_plan_registry(
+        const bench_manager_t &bench_mger, const plan_registry_t &registry) {
+    plan_registry_t ret;
+    int idx = 0;
+    for (auto &e : registry.entries()) {
+        idx++;
+        if (!is_compatible(e.desc.hw_desc, bench_mger.hw(), /*exact=*/false)) {
+            ret.set(e);
+            continue;
+        }
+        std::cout << "Refitting entry " << idx << "/" << registry.size()
+                  << ": " << e.desc.brief_str() << std::endl;
+        auto bd = bench(bench_mger, e.desc);
+        if (!bd) {
+            std::cout << "Warning: benchmarking failed, keeping the model"
+                      << std::endl;
+            ret.set(e);
+            continue;
+        }
+        plan_registry_t::entry_t entry(e.desc, model_set_t());
+        model_fit(bd, entry.model_set);
+        if (e.desc.ext.has(extension_kind_t::stream_k)) {
+            auto bd_sk = bench(bench_mger, to_stream_k(e.desc));
+            if (bd_sk) model_fit(bd_sk, entry.model_set);
+        }
+        ret.set(entry);
+    }
+    return ret;
+}
+
 } // namespace planner
 } // namespace conv
 } // namespace v2
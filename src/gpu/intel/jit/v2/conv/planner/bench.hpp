@@ -109,6 +109,10 @@ bench_data_t bench(const bench_manager_t &bench_mger,
         int nprbs = bench_input_params_t::default_nprbs);
 plan_registry_t::entry_t prepare_plan_registry_entry(
         const bench_manager_t &bench_mger, const kernel_desc_t &kernel_desc);
+// Benchmarks the kernel descriptors of the registry on the current device and
+// fits new models for them. Entries for other devices are kept as is.
+plan_registry_t refit_plan_registry(
+        const bench_manager_t &bench_mger, const plan_registry_t &registry);
 
 } // namespace planner
 } // namespace conv
@@ -63,13 +63,15 @@ std::string find_remove_key_value(const std::string &key, std::string &s) {
 
 void print_help() {
     std::cout
-            << R"(Usage: gpu_conv_planner [--help] [--bench] [--search] [--auto-search] [kernel descriptor arguments]
+            << R"(Usage: gpu_conv_planner [--help] [--bench] [--search] [--auto-search] [--refit] [kernel descriptor arguments]
 
 Optional arguments:
   --help                Shows help message and exits.
   --bench               Runs benchmarking with provided kernel descriptor.
   --search              Runs search, iterate through missing kernel descriptor properties.
   --auto-search         Runs auto-search to rebuild kernel registry.
+  --refit               Benchmarks kernel registry entries on the device and
+                        fits new models for them.
 
 )";
     std::cout << "Kernel descriptor arguments:" << std::endl;
@@ -85,6 +87,7 @@ void init_params(
     bool has_bench = find_remove("--bench", cmd_args);
     bool has_search = find_remove("--search", cmd_args);
     bool has_auto_search = find_remove("--auto-search", cmd_args);
+    bool has_refit = find_remove("--refit", cmd_args);
     bool has_help = (argc == 1) || find_remove("--help", cmd_args);
     auto s_model = find_remove_key_value("model", cmd_args);
 
@@ -97,8 +100,10 @@ void init_params(
     mode_count += (int)has_bench;
     mode_count += (int)has_search;
     mode_count += (int)has_auto_search;
+    mode_count += (int)has_refit;
     if (mode_count > 1) {
-        std::cout << "Error: --bench, --search and --auto-search are exclusive."
+        std::cout << "Error: --bench, --search, --auto-search and --refit are "
+                     "exclusive."
                   << std::endl;
         exit(1);
     }
@@ -108,11 +113,14 @@ void init_params(
         params.mode = planner_mode_t::search;
     } else if (has_auto_search) {
         params.mode = planner_mode_t::auto_search;
+    } else if (has_refit) {
+        params.mode = planner_mode_t::refit;
     } else {
         params.mode = planner_mode_t::trace;
     }
     switch (params.mode) {
-        case planner_mode_t::auto_search: return;
+        case planner_mode_t::auto_search:
+        case planner_mode_t::refit: return;
         case planner_mode_t::search:
             if (cmd_args.find("--iter") == std::string::npos) {
                 cmd_args += " --iter x";
@@ -163,6 +171,13 @@ void DNNL_API planner_main(int argc, const char **argv) {
             search(bench_mger, params);
             break;
         }
+        case planner_mode_t::refit: {
+            // Starts from the registry file when it exists, the refitted
+            // registry is written back on exit.
+            auto refitted = refit_plan_registry(bench_mger, plan_registry());
+            plan_registry() = std::move(refitted);
+            break;
+        }
         default: gpu_error_not_expected();
     }
 }
@@ -36,6 +36,7 @@ enum class planner_mode_t {
     bench,
     search,
     auto_search,
+    refit,
 };
 
 struct planner_params_t {
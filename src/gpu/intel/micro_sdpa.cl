@@ -305,7 +305,8 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
         const global KEY_ATTR_SCALES_DATA_T *K_scales,
         const global KEY_ATTR_ZP_DATA_T *K_zp,
         const global VAL_ATTR_SCALES_DATA_T *V_scales,
-        const global VAL_ATTR_ZP_DATA_T *V_zp, const int attn_mask_type
+        const global VAL_ATTR_ZP_DATA_T *V_zp, const int attn_mask_type,
+        const int window_size, const float alibi_max_bias, const float softcap
 #if WITH_ATTN_MASK
         ,
         const global MSK_DATA_T *msk
@@ -317,7 +318,7 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
         MSK_OFFSETS
 #endif
         ,
-        const int remainder_k, const int remainder_q) {
+        const int remainder_k, const int remainder_q, global float *stats) {
 
     uint sg_ij = sub_group_broadcast(get_local_id(1), 0);
     uint b0 = get_group_id(1);
@@ -336,6 +337,16 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
     }
 #endif
 
+    /* Skip the key blocks below the window of the first query */
+    int k0start = 0;
+#if WITH_SLIDING_WINDOW
+    int diag0 = wg_j0;
+    if (attn_mask_type == ATTN_MASK_BOTTOM_RIGHT) diag0 += k - q;
+    k0start = max(0, diag0 - window_size + 1);
+    k0start -= k0start % ugemm_kq_wg_tile_m;
+    if (k0start >= k0end) k0end = 0;
+#endif
+
     /* Leading dimension for matrices */
     uint ldk = TRANSPOSE_K ? KEY_S3 : KEY_S2;
     uint ldq = QRY_S2;
@@ -388,6 +399,9 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
     Q += QRY_BATCH(b1, b0);
     V += v_offset / VAL_ELEMENTS_PER_BYTE;
     A += DST_BATCH(b1, b0);
+#if WITH_STATS
+    stats += (b1 * get_num_groups(1) + b0) * q;
+#endif
 #if WITH_ATTN_MASK
     msk += MSK_BATCH(b1 % MSK_D0, b0 % MSK_D1);
 #if BLOCK_MSK == false
@@ -450,8 +464,8 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
     if (k0end > 0) {
         /* Prefetch first K tile. */
         cooperative_prefetch_2d_k(
-                /* ptr */ K,
-                /* r */ k,
+                /* ptr */ K + k0start * (TRANSPOSE_K ? ldk : 1),
+                /* r */ k - k0start,
                 /* c */ d,
                 /* rmax */ ugemm_kq_wg_tile_m,
                 /* cmax */ PREFETCH_D_MAX,
@@ -463,8 +477,8 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
 
 #if KEY_SCALES == QUANTIZE_2D
         cooperative_prefetch_2d_maybe_rem(
-                /* ptr */ K_scales,
-                /* r */ k,
+                /* ptr */ K_scales + k0start,
+                /* r */ k - k0start,
                 /* c */ num_key_groups,
                 /* rmax */ ugemm_kq_wg_tile_m,
                 /* cmax */ D_MAX / KEY_GROUP_SIZE,
@@ -476,8 +490,8 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
 #endif
 #if KEY_ZERO_POINTS == QUANTIZE_2D
         cooperative_prefetch_2d_maybe_rem(
-                /* ptr */ K_zp,
-                /* r */ k,
+                /* ptr */ K_zp + k0start,
+                /* r */ k - k0start,
                 /* c */ num_key_groups,
                 /* rmax */ ugemm_kq_wg_tile_m,
                 /* cmax */ D_MAX / KEY_GROUP_SIZE,
@@ -524,9 +538,34 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
 #endif
     }
 
+#if WITH_SLIDING_WINDOW
+    /* Start V at the first key block in the window */
+    V += ldv * k0start / VAL_ELEMENTS_PER_BYTE;
+#if VAL_SCALES == QUANTIZE_2D
+    V_scales += ldvq * k0start;
+#endif
+#if VAL_ZERO_POINTS == QUANTIZE_2D
+    V_zp += ldvq * k0start / VAL_ZP_ELEMENTS_PER_BYTE;
+#endif
+#endif
+
+#if WITH_SOFTCAP
+    /* Soft-capping in units of the unscaled scores */
+    const float cap = softcap * iscale;
+    const float rcap = native_recip(cap);
+#endif
+#if WITH_ALIBI
+    /* ALiBi slope of the head, in units of the unscaled scores */
+    const float alibi_slope = native_exp2(-alibi_max_bias * (float)(b0 + 1)
+                                      / (float)get_num_groups(1))
+            * iscale;
+    const int alibi_shift
+            = (attn_mask_type == ATTN_MASK_BOTTOM_RIGHT) ? k - q : 0;
+#endif
+
     /* Main loop over k blocks */
-    for (int k0 = 0; k0 < k0end; k0 += ugemm_kq_wg_tile_m) {
-        bool first = (k0 == 0);
+    for (int k0 = k0start; k0 < k0end; k0 += ugemm_kq_wg_tile_m) {
+        bool first = (k0 == k0start);
         int knext = k0 + ugemm_kq_wg_tile_m;
         bool last = (knext >= k0end);
 
@@ -587,6 +626,22 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
         tile_elementwise(S_tile, k_scale_op);
 #endif
 
+#if WITH_SOFTCAP
+        /* Apply soft-capping */
+#define softcap_op(x) (cap * tanh((x)*rcap))
+        tile_elementwise(S_tile, softcap_op);
+#endif
+
+#if WITH_ALIBI
+        /* Apply ALiBi biases */
+#define alibi_op(x, offset_k, offset_q) \
+    ((x) + alibi_slope * (float)((offset_k) - (offset_q)))
+        tile_indexed_elementwise_t(S_tile, k0 + sg_i0_kq,
+                wg_j0 + sg_j0_kq + alibi_shift, alibi_op, SUBGROUP_SIZE,
+                ugemm_kq_c_type_block0, ugemm_kq_c_type_block1,
+                ugemm_kq_c_type_nblock0, ugemm_kq_c_type_nblock1);
+#endif
+
         /* Apply attention mask */
 #if WITH_ATTN_MASK
 #define unscale(x) ((x)*iscale)
@@ -616,6 +671,17 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
                 less_than, -INFINITY, SUBGROUP_SIZE, ugemm_kq_c_type_block0,
                 ugemm_kq_c_type_block1, ugemm_kq_c_type_nblock0,
                 ugemm_kq_c_type_nblock1);
+
+#if WITH_SLIDING_WINDOW
+#define outside_window(offset_k, offset_q) \
+    ((offset_q) - (offset_k) >= window_size)
+
+        /* Apply sliding window mask */
+        tile_predicated_assignment_t(S_tile, k0 + sg_i0_kq, col_offset,
+                outside_window, -INFINITY, SUBGROUP_SIZE,
+                ugemm_kq_c_type_block0, ugemm_kq_c_type_block1,
+                ugemm_kq_c_type_nblock0, ugemm_kq_c_type_nblock1);
+#endif
 #endif
 
         /* Before softmax, we will need to scale columns by maximum values to avoid overflow. */
@@ -676,7 +742,8 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
         tile_load_full(&S_max_tile, S_max_slm, ugemm_kq_wg_tile_n, sg_j0_kq, 0);
 #endif
 
-#if SOFTMAX_INF_AS_ZERO
+#if SOFTMAX_INF_AS_ZERO || WITH_SLIDING_WINDOW
+        /* With a sliding window, a query may have no keys in a block. */
 #define set_zeros(v) vselect(-FLT_MAX, v, visfinite(v))
         tile_elementwise(S_max_tile, set_zeros);
 #endif
@@ -876,6 +943,11 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
         tile_binary(A_tile, A_tile1, binary_add);
     }
 
+#if WITH_STATS
+    a_scale_tile_type stats_tile;
+    tile_fill(stats_tile, -INFINITY);
+#endif
+
     if (k0end > 0) {
         /* Wait for column sums to be ready */
         if (need_sum_barrier)
@@ -891,6 +963,14 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
                     ugemm_vs_sg_tile_n * sg_j_vs, sg1);
             tile_binary(A_scale_tile, A_scale_tile_load, binary_add);
         }
+#if WITH_STATS
+        /* Log-sum-exp of each query: the sums are relative to the WG-wide
+         * maxima, which are in the unscaled log2 domain. */
+        tile_load_full(&stats_tile, S_max_slm, ugemm_kq_wg_tile_n,
+                ugemm_vs_sg_tile_n * sg_j_vs, 0);
+#define lse_op(m, s) (M_LN2_F * ((m)*scale + native_log2(s)))
+        tile_binary(stats_tile, A_scale_tile, lse_op);
+#endif
 #if VAL_SCALES == QUANTIZE_COMMON
 #define v_scale_op(x) ((x)*v_scale)
         tile_elementwise(A_tile, v_scale_op);
@@ -917,6 +997,10 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
     uint sg_i0_vs = sg_i_vs * ugemm_vs_sg_tile_m;
     uint sg_j0_vs = sg_j_vs * ugemm_vs_sg_tile_n + wg_j0;
 
+#if WITH_STATS
+    if (sg_i_vs == 0) tile_store(stats_tile, stats, q, 1, q, sg_j0_vs, 0);
+#endif
+
 #if BLOCK_2D_A
     tile_store_block2d(A_tile_dst, A, d, q, lda, sg_i0_vs, sg_j0_vs);
 #elif BLOCK_A
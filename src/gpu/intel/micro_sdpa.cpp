@@ -111,8 +111,14 @@ status_t micro_sdpa_t::pd_t::init_conf_microkernels(impl::engine_t *engine) {
     sdpa_config_t *config = nullptr;
     const dim_t thin_q_threshold = 16;
     bool thin_q = (d->queries() <= thin_q_threshold);
+    // Configurations for quantized K/V are tuned for 8-bit or narrower
+    // loads, which fp8 K/V also use.
     bool quantized = with_key_scales() || with_key_zp() || with_value_scales()
-            || with_value_zp();
+            || with_value_zp()
+            || utils::one_of(key_md()->data_type, data_type::f8_e5m2,
+                    data_type::f8_e4m3)
+            || utils::one_of(val_md()->data_type, data_type::f8_e5m2,
+                    data_type::f8_e4m3);
     bool is_integrated = compute_engine->device_info()->is_integrated();
     bool is_f32 = (qry_md()->data_type == data_type::f32);
     use_systolic_ukernel_
@@ -451,6 +457,9 @@ status_t micro_sdpa_t::pd_t::init_conf(impl::engine_t *engine) {
     conf.with_attn_mask = (pd->with_attn_mask() && !pd->with_causal_mask());
     conf.broadcast_mask_q = (msk_mdw.dims()[pd_t::mask_q_index] == 1);
     conf.with_causal_mask = pd->with_causal_mask();
+    conf.with_sliding_window = pd->with_sliding_window();
+    conf.with_alibi = pd->with_alibi();
+    conf.with_softcap = pd->with_softcap();
 
     conf.subgroup_size = pd->sg_size();
     conf.d_max = pd->d_max();
@@ -502,6 +511,7 @@ status_t micro_sdpa_t::pd_t::init_conf(impl::engine_t *engine) {
     conf.softmax_inf_as_zero
             = (d->softmax_alg == alg_kind::softmax_accurate_inf_as_zero);
     conf.use_systolic_ukernel = pd->use_systolic_ukernel();
+    conf.with_stats = pd->with_stats();
     return status::success;
 }
 
@@ -558,6 +568,9 @@ status_t micro_sdpa_params_t::get_kernel_ctx(
     kernel_ctx.define_int("WITH_ATTN_MASK", with_attn_mask);
     kernel_ctx.define_int("BROADCAST_MASK_Q", broadcast_mask_q);
     kernel_ctx.define_int("WITH_CAUSAL_MASK", with_causal_mask);
+    kernel_ctx.define_int("WITH_SLIDING_WINDOW", with_sliding_window);
+    kernel_ctx.define_int("WITH_ALIBI", with_alibi);
+    kernel_ctx.define_int("WITH_SOFTCAP", with_softcap);
 
     kernel_ctx.define_int("SUBGROUP_SIZE", subgroup_size);
     kernel_ctx.define_int("D_MAX", d_max);
@@ -577,6 +590,7 @@ status_t micro_sdpa_params_t::get_kernel_ctx(
     kernel_ctx.define_int("Q_ARRIVE_AWAIT_BARRIER", q_arrive_await_barrier);
     kernel_ctx.define_int("SOFTMAX_INF_AS_ZERO", softmax_inf_as_zero);
     kernel_ctx.define_int("USE_SYSTOLIC_UKERNEL", use_systolic_ukernel);
+    kernel_ctx.define_int("WITH_STATS", with_stats);
 
     gemmstone::HWInformation hw_info;
     gemmstone::GEMMProblem problem_kq, problem_vs;
@@ -668,6 +682,7 @@ status_t micro_sdpa_t::execute(const exec_ctx_t &ctx) const {
     auto &dst = CTX_OUT_STORAGE(DNNL_ARG_DST);
     const auto &scale = CTX_IN_STORAGE(DNNL_ARG_SCALE);
     const auto &attn_mask = CTX_IN_STORAGE(DNNL_ARG_ATTN_MASK);
+    auto &stats = CTX_OUT_STORAGE(DNNL_ARG_ATTN_STATS);
 
     const auto &key_scales
             = CTX_IN_STORAGE(DNNL_ARG_KEYS | DNNL_ARG_ATTR_SCALES);
@@ -733,6 +748,11 @@ status_t micro_sdpa_t::execute(const exec_ctx_t &ctx) const {
     arg_list.append(value_scales);
     arg_list.append(value_zp);
     arg_list.append(mask_type);
+    // The score modifiers are runtime arguments so that models with
+    // different windows, slopes, or caps share the kernel.
+    arg_list.append(into<int>(pd()->desc()->window_size));
+    arg_list.append(pd()->desc()->alibi_max_bias);
+    arg_list.append(pd()->desc()->softcap);
     if (pd()->with_attn_mask()) arg_list.append(attn_mask);
 
     append_offs(arg_list, key_off);
@@ -749,6 +769,7 @@ status_t micro_sdpa_t::execute(const exec_ctx_t &ctx) const {
 
     arg_list.append(remainder_k);
     arg_list.append(remainder_q);
+    arg_list.append(stats);
 
     compute::range_t lws = {(size_t)pd()->sg_size(), (size_t)sg_per_wg, 1};
     compute::range_t gws = lws;
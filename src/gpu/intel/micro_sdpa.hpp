@@ -78,7 +78,7 @@ struct micro_sdpa_params_t : trivially_serializable_t<micro_sdpa_params_t> {
             attn_mask_bottom_right;
     bool invert_scale, with_attn_scale, with_attn_mask, broadcast_mask_q,
             with_causal_mask;
-    uint8_t padding1[3] = {0};
+    bool with_sliding_window, with_alibi, with_softcap;
     int subgroup_size, d_max;
 
     bool d_full, arch_gte_hpc;
@@ -90,7 +90,7 @@ struct micro_sdpa_params_t : trivially_serializable_t<micro_sdpa_params_t> {
     bool softmax_inf_as_zero;
     bool q_arrive_await_barrier;
     bool use_systolic_ukernel;
-    uint8_t padding3[1] = {0};
+    bool with_stats;
 
     micro_sdpa_ukernel_params_t ukernel_config;
 };
@@ -110,6 +110,7 @@ struct micro_sdpa_t : public gpu_primitive_t {
         status_t init(impl::engine_t *engine) {
             using namespace data_type;
 
+            VDISPATCH_SDPA(is_fwd(), VERBOSE_BAD_PROPKIND);
             VCHECK_SDPA_COND(
                     utils::everyone_is(4, qry_md()->ndims, key_md()->ndims,
                             val_md()->ndims, dst_md()->ndims),
@@ -152,6 +153,9 @@ struct micro_sdpa_t : public gpu_primitive_t {
                             dnnl_dt2str(qry_md()->data_type));
                 }
             }
+            VCHECK_SDPA_COND(
+                    IMPLICATION(with_sliding_window(), with_causal_mask()),
+                    "sliding window requires a causal mask");
             VCHECK_SDPA_COND(
                     (utils::everyone_is(data_type::f16, qry_md()->data_type,
                              dst_md()->data_type)
@@ -161,13 +165,35 @@ struct micro_sdpa_t : public gpu_primitive_t {
                                     qry_md()->data_type, dst_md()->data_type)),
                     VERBOSE_UNSUPPORTED_DT);
             VCHECK_SDPA_COND(utils::one_of(key_md()->data_type, f32, bf16, f16,
-                                     u8, s8, u4, s4),
+                                     f8_e5m2, f8_e4m3, u8, s8, u4, s4),
                     VERBOSE_UNSUPPORTED_DT);
             VCHECK_SDPA_COND(utils::one_of(val_md()->data_type, f32, bf16, f16,
-                                     u8, s8, u4, s4),
+                                     f8_e5m2, f8_e4m3, u8, s8, u4, s4),
                     VERBOSE_UNSUPPORTED_DT);
+
+            // fp8 keys and values are up-converted to the Q data type within
+            // the microkernels and can be scaled but not shifted.
+            const bool is_f8_kv = utils::one_of(key_md()->data_type, f8_e5m2,
+                                          f8_e4m3)
+                    || utils::one_of(val_md()->data_type, f8_e5m2, f8_e4m3);
+            if (is_f8_kv) {
+                VCHECK_SDPA_COND(qry_md()->data_type != f32,
+                        "fp8 keys or values require a bf16 or f16 query");
+                VCHECK_SDPA_COND(!with_key_zp() && !with_value_zp(),
+                        "zero points are not supported with fp8 keys or "
+                        "values");
+            }
             VCHECK_SDPA_COND(set_default_formats() == status::success,
                     VERBOSE_UNSUPPORTED_TAG);
+            if (with_stats()) {
+                // Statistics are written as a dense f32 array.
+                if (memory_desc_wrapper(desc_.stats_desc).format_any())
+                    CHECK(memory_desc_init_by_tag(
+                            desc_.stats_desc, format_tag::abcd));
+                VCHECK_SDPA_COND(memory_desc_wrapper(stats_md()).matches_tag(
+                                         format_tag::abcd),
+                        VERBOSE_UNSUPPORTED_TAG);
+            }
             VCHECK_SDPA_COND(desc()->values() == desc()->head_size(),
                     "values does not match head size");
 
@@ -20,6 +20,7 @@
 
 #include "gpu/intel/ocl/engine.hpp"
 
+#include "common/primitive_disk_cache.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
@@ -104,6 +105,28 @@ status_t engine_t::init() {
 status_t engine_t::init(const std::vector<uint8_t> &cache_blob) {
     CHECK(init_impl());
     CHECK(compute::compute_engine_t::init(cache_blob));
+    CHECK(init_tiles());
+    return status::success;
+}
+
+status_t engine_t::init_tiles() {
+    static const bool multi_tile = getenv_int_user("GPU_MULTI_TILE", 0) != 0;
+    if (!multi_tile) return status::success;
+
+    cl_device_partition_property properties[3]
+            = {CL_DEVICE_PARTITION_BY_AFFINITY_DOMAIN,
+                    CL_DEVICE_AFFINITY_DOMAIN_NEXT_PARTITIONABLE, 0};
+    cl_uint ntiles = 0;
+    cl_int err = clCreateSubDevices(
+            device(), properties, 0, nullptr, &ntiles);
+    // Devices without tiles (or already exposed per tile) run as a whole.
+    if (err != CL_SUCCESS || ntiles < 2) return status::success;
+
+    std::vector<cl_device_id> tiles(ntiles);
+    OCL_CHECK(clCreateSubDevices(
+            device(), properties, ntiles, tiles.data(), nullptr));
+    for (cl_device_id tile : tiles)
+        tiles_.emplace_back(tile);
     return status::success;
 }
 
@@ -258,17 +281,44 @@ status_t engine_t::build_program_from_source(
             pp_code_str, options, dev_info->get_cl_ext_options());
 
     auto ctx = context();
+    auto dev = device();
+
+    // The binary of a program is reused from the on-disk cache when the same
+    // source is built with the same options on the same device and driver.
+    // Programs with debug information are always built from the source.
+    std::vector<uint8_t> disk_cache_id;
+    if (!src && primitive_disk_cache::is_enabled()) {
+        serialization_stream_t sstream;
+        static const std::string tag = "ocl_program";
+        sstream.append_array(tag.size(), tag.data());
+        CHECK(serialize_device(sstream));
+        sstream.append_array(options.size(), options.data());
+        sstream.append_array(pp_code_str.size(), pp_code_str.data());
+        disk_cache_id = sstream.get_data();
+
+        xpu::binary_t binary;
+        if (primitive_disk_cache::load(disk_cache_id, binary)
+                && xpu::ocl::create_program(program, dev, ctx, binary)
+                        == status::success)
+            return status::success;
+    }
+
     program = xpu::ocl::make_wrapper(
             clCreateProgramWithSource(ctx, 1, &pp_code_str_ptr, nullptr, &err));
     OCL_CHECK(err);
 
-    auto dev = device();
     err = clBuildProgram(program, 1, &dev, options.c_str(), nullptr, nullptr);
     OCL_CHECK(maybe_print_debug_info(err, program, dev));
 
     if (kernel_ctx.has_custom_headers())
         CHECK(fuse_microkernels(ctx, dev, program, pp_code_str_ptr));
 
+    if (!disk_cache_id.empty()) {
+        xpu::binary_t binary;
+        if (get_ocl_program_binary(program, dev, binary) == status::success)
+            primitive_disk_cache::store(disk_cache_id, binary);
+    }
+
     return status::success;
 }
 
@@ -80,6 +80,10 @@ public:
         return gpu_impl_list_t::get_reorder_implementation_list(src_md, dst_md);
     }
 
+    const impl_list_item_t *get_split_implementation_list() const override {
+        return gpu_impl_list_t::get_split_implementation_list();
+    }
+
     const impl_list_item_t *get_sum_implementation_list() const override {
         return gpu_impl_list_t::get_sum_implementation_list();
     }
@@ -103,6 +107,13 @@ public:
         return device_info_->get_cache_blob(size, cache_blob);
     }
 
+    // Sub-devices (tiles) of the device used to split large problems when
+    // multi-tile execution is enabled with ONEDNN_GPU_MULTI_TILE. Empty
+    // otherwise.
+    const std::vector<xpu::ocl::wrapper_t<cl_device_id>> &tiles() const {
+        return tiles_;
+    }
+
     status_t create_program(xpu::ocl::wrapper_t<cl_program> &program,
             compute::program_src_t &src,
             const std::vector<const char *> &kernel_names,
@@ -123,6 +134,11 @@ protected:
 
     status_t init_device_info() override;
     status_t init_device_info(const std::vector<uint8_t> &cache_blob) override;
+
+private:
+    status_t init_tiles();
+
+    std::vector<xpu::ocl::wrapper_t<cl_device_id>> tiles_;
 };
 
 } // namespace ocl
@@ -208,6 +208,9 @@ status_t kernel_t::parallel_for(impl::stream_t &stream,
     cl_uint ndims = static_cast<cl_uint>(range.ndims());
     if (range.is_zero()) { return status::success; }
 
+    if (ocl_stream->is_recording())
+        return ocl_stream->record_kernel(*kernel, ndims, range);
+
     xpu::ocl::wrapper_t<cl_event> event;
     if (ocl_stream->flags() & stream_flags::out_of_order) {
         const auto &event_wrappers = xpu::ocl::event_t::from(deps).events;
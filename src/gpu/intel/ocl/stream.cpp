@@ -23,6 +23,9 @@
 #include "xpu/ocl/engine_impl.hpp"
 #include "xpu/ocl/memory_storage.hpp"
 #include "xpu/ocl/stream_profiler.hpp"
+#include "xpu/ocl/utils.hpp"
+
+#include "gpu/intel/compute/utils.hpp"
 
 #include "gpu/intel/ocl/engine.hpp"
 #include "gpu/intel/ocl/stream.hpp"
@@ -34,6 +37,83 @@ namespace gpu {
 namespace intel {
 namespace ocl {
 
+namespace {
+
+// Entry points of cl_khr_command_buffer. Handles are passed as opaque
+// pointers as older OpenCL headers do not declare the extension types.
+using cl_command_buffer_handle_t = void *;
+using cl_sync_point_t = cl_uint;
+
+using clCreateCommandBufferKHR_func_t = cl_command_buffer_handle_t (*)(
+        cl_uint, const cl_command_queue *, const cl_ulong *, cl_int *);
+using clFinalizeCommandBufferKHR_func_t
+        = cl_int (*)(cl_command_buffer_handle_t);
+using clReleaseCommandBufferKHR_func_t
+        = cl_int (*)(cl_command_buffer_handle_t);
+using clEnqueueCommandBufferKHR_func_t = cl_int (*)(cl_uint,
+        cl_command_queue *, cl_command_buffer_handle_t, cl_uint,
+        const cl_event *, cl_event *);
+using clCommandNDRangeKernelKHR_func_t = cl_int (*)(
+        cl_command_buffer_handle_t, cl_command_queue, const cl_ulong *,
+        cl_kernel, cl_uint, const size_t *, const size_t *, const size_t *,
+        cl_uint, const cl_sync_point_t *, cl_sync_point_t *, void **);
+
+const xpu::ocl::ext_func_t<clCreateCommandBufferKHR_func_t> &
+create_command_buffer_func() {
+    static const xpu::ocl::ext_func_t<clCreateCommandBufferKHR_func_t>
+            ext_func("clCreateCommandBufferKHR");
+    return ext_func;
+}
+
+const xpu::ocl::ext_func_t<clFinalizeCommandBufferKHR_func_t> &
+finalize_command_buffer_func() {
+    static const xpu::ocl::ext_func_t<clFinalizeCommandBufferKHR_func_t>
+            ext_func("clFinalizeCommandBufferKHR");
+    return ext_func;
+}
+
+const xpu::ocl::ext_func_t<clReleaseCommandBufferKHR_func_t> &
+release_command_buffer_func() {
+    static const xpu::ocl::ext_func_t<clReleaseCommandBufferKHR_func_t>
+            ext_func("clReleaseCommandBufferKHR");
+    return ext_func;
+}
+
+const xpu::ocl::ext_func_t<clEnqueueCommandBufferKHR_func_t> &
+enqueue_command_buffer_func() {
+    static const xpu::ocl::ext_func_t<clEnqueueCommandBufferKHR_func_t>
+            ext_func("clEnqueueCommandBufferKHR");
+    return ext_func;
+}
+
+const xpu::ocl::ext_func_t<clCommandNDRangeKernelKHR_func_t> &
+command_nd_range_kernel_func() {
+    static const xpu::ocl::ext_func_t<clCommandNDRangeKernelKHR_func_t>
+            ext_func("clCommandNDRangeKernelKHR");
+    return ext_func;
+}
+
+} // namespace
+
+struct stream_t::command_buffer_t {
+    command_buffer_t(impl::engine_t *engine, cl_command_buffer_handle_t handle)
+        : engine(engine), handle(handle) {}
+
+    ~command_buffer_t() {
+        if (handle) release_command_buffer_func()(engine, handle);
+    }
+
+    impl::engine_t *engine;
+    cl_command_buffer_handle_t handle;
+    bool finalized = false;
+    // Commands are chained through sync points to preserve the in-order
+    // semantics of the stream.
+    bool has_sync_point = false;
+    cl_sync_point_t last_sync_point = 0;
+};
+
+stream_t::~stream_t() = default;
+
 status_t stream_t::init() {
     if (is_profiling_enabled()) {
         profiler_ = utils::make_unique<xpu::ocl::stream_profiler_t>(this);
@@ -88,6 +168,63 @@ status_t stream_t::init() {
         }
     }
 
+    init_tile_queues();
+    return status::success;
+}
+
+void stream_t::init_tile_queues() {
+    // Tile queues are synchronized with the stream through markers, which
+    // is only done for in-order streams without profiling.
+    if ((flags() & stream_flags::out_of_order) || is_profiling_enabled())
+        return;
+
+    const auto *ocl_engine = utils::downcast<const engine_t *>(engine());
+    for (const auto &tile : ocl_engine->tiles()) {
+        cl_int err;
+        xpu::ocl::wrapper_t<cl_command_queue> queue
+                = create_queue(ocl_engine->context(), tile, &err);
+        if (err != CL_SUCCESS) {
+            // Fall back to running on the whole device.
+            tile_queues_.clear();
+            return;
+        }
+        tile_queues_.push_back(std::move(queue));
+    }
+}
+
+int stream_t::ntiles() const {
+    // Recorded commands are replayed on the stream queue only.
+    if (tile_queues_.empty() || is_recording()) return 1;
+    return (int)tile_queues_.size();
+}
+
+status_t stream_t::fork_tiles() {
+    assert(tile_ < 0);
+    xpu::ocl::wrapper_t<cl_event> fork;
+    OCL_CHECK(clEnqueueMarkerWithWaitList(
+            impl()->queue(), 0, nullptr, &fork.unwrap()));
+    for (auto &q : tile_queues_)
+        OCL_CHECK(clEnqueueBarrierWithWaitList(q, 1, &fork.unwrap(), nullptr));
+    return status::success;
+}
+
+status_t stream_t::set_tile(int tile) {
+    assert(tile >= 0 && tile < ntiles());
+    tile_ = tile;
+    return status::success;
+}
+
+status_t stream_t::join_tiles() {
+    tile_ = -1;
+    std::vector<xpu::ocl::wrapper_t<cl_event>> joins(tile_queues_.size());
+    std::vector<cl_event> events;
+    for (size_t i = 0; i < tile_queues_.size(); i++) {
+        OCL_CHECK(clEnqueueMarkerWithWaitList(
+                tile_queues_[i], 0, nullptr, &joins[i].unwrap()));
+        events.push_back(joins[i]);
+    }
+    OCL_CHECK(clEnqueueBarrierWithWaitList(impl()->queue(),
+            (cl_uint)events.size(), events.data(), nullptr));
     return status::success;
 }
 
@@ -123,11 +260,21 @@ void stream_t::after_exec_hook() {
 status_t stream_t::copy(const memory_storage_t &src,
         const memory_storage_t &dst, size_t size, const xpu::event_t &deps,
         xpu::event_t &out_dep) {
+    if (is_recording()) {
+        VERROR(common, ocl,
+                "copy is not supported while recording a command buffer");
+        return status::unimplemented;
+    }
     return impl()->copy(this, src, dst, size, deps, out_dep, profiler_.get());
 }
 
 status_t stream_t::fill(const memory_storage_t &dst, uint8_t pattern,
         size_t size, const xpu::event_t &deps, xpu::event_t &out_dep) {
+    if (is_recording()) {
+        VERROR(common, ocl,
+                "fill is not supported while recording a command buffer");
+        return status::unimplemented;
+    }
     return impl()->fill(
             this, dst, pattern, size, deps, out_dep, profiler_.get());
 }
@@ -136,6 +283,81 @@ status_t stream_t::barrier() {
     return impl()->barrier();
 }
 
+status_t stream_t::begin_recording() {
+    if (is_recording()) {
+        VERROR(common, ocl, "stream is already recording");
+        return status::invalid_arguments;
+    }
+    if ((flags() & stream_flags::out_of_order) || is_profiling_enabled()) {
+        VERROR(common, ocl,
+                "command buffer recording requires an in-order stream "
+                "without profiling");
+        return status::unimplemented;
+    }
+
+    auto create = create_command_buffer_func().get_func(engine());
+    bool is_supported = create
+            && finalize_command_buffer_func().get_func(engine())
+            && release_command_buffer_func().get_func(engine())
+            && enqueue_command_buffer_func().get_func(engine())
+            && command_nd_range_kernel_func().get_func(engine());
+    if (!is_supported) {
+        VERROR(common, ocl,
+                "cl_khr_command_buffer is not supported by the device");
+        return status::unimplemented;
+    }
+
+    cl_command_queue queue = impl()->queue();
+    cl_int err;
+    cl_command_buffer_handle_t handle = create(1, &queue, nullptr, &err);
+    OCL_CHECK(err);
+
+    // Replaces a previously recorded command buffer, if any.
+    cmd_buf_ = utils::make_unique<command_buffer_t>(engine(), handle);
+    return status::success;
+}
+
+status_t stream_t::end_recording() {
+    if (!is_recording()) {
+        VERROR(common, ocl, "stream is not recording");
+        return status::invalid_arguments;
+    }
+    OCL_CHECK(finalize_command_buffer_func()(engine(), cmd_buf_->handle));
+    cmd_buf_->finalized = true;
+    return status::success;
+}
+
+status_t stream_t::replay() {
+    if (!(cmd_buf_ && cmd_buf_->finalized)) {
+        VERROR(common, ocl, "no recorded command buffer");
+        return status::invalid_arguments;
+    }
+    cl_command_queue queue = impl()->queue();
+    OCL_CHECK(enqueue_command_buffer_func()(
+            engine(), 1, &queue, cmd_buf_->handle, 0, nullptr, nullptr));
+    return status::success;
+}
+
+bool stream_t::is_recording() const {
+    return cmd_buf_ && !cmd_buf_->finalized;
+}
+
+status_t stream_t::record_kernel(cl_kernel kernel, cl_uint ndims,
+        const compute::nd_range_t &range) {
+    assert(is_recording());
+    auto &cb = *cmd_buf_;
+    cl_sync_point_t sync_point;
+    OCL_CHECK(command_nd_range_kernel_func()(engine(), cb.handle, nullptr,
+            nullptr, kernel, ndims, nullptr, range.global_range().data(),
+            range.local_range() ? range.local_range().data() : nullptr,
+            cb.has_sync_point ? 1 : 0,
+            cb.has_sync_point ? &cb.last_sync_point : nullptr, &sync_point,
+            nullptr));
+    cb.last_sync_point = sync_point;
+    cb.has_sync_point = true;
+    return status::success;
+}
+
 } // namespace ocl
 } // namespace intel
 } // namespace gpu
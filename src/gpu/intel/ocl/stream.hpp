@@ -78,7 +78,11 @@ struct stream_t : public compute::compute_stream_t {
         return profiler_->get_info(data_kind, num_entries, data);
     }
 
-    cl_command_queue queue() const { return impl()->queue(); }
+    // Returns the queue of the selected tile while the stream is forked
+    // across tiles, and the stream queue otherwise.
+    cl_command_queue queue() const {
+        return tile_ >= 0 ? tile_queues_[tile_] : impl()->queue();
+    }
 
     const mdapi_helper_t &mdapi_helper() const { return *mdapi_helper_; }
 
@@ -91,7 +95,23 @@ struct stream_t : public compute::compute_stream_t {
 
     status_t barrier() override;
 
-    ~stream_t() override = default;
+    int ntiles() const override;
+    status_t fork_tiles() override;
+    status_t set_tile(int tile) override;
+    status_t join_tiles() override;
+
+    // Command buffer recording (cl_khr_command_buffer). While recording,
+    // kernel submissions are appended to a command buffer instead of being
+    // enqueued. The finalized command buffer is owned by the stream and can
+    // be replayed on its queue any number of times.
+    status_t begin_recording();
+    status_t end_recording();
+    status_t replay();
+    bool is_recording() const;
+    status_t record_kernel(cl_kernel kernel, cl_uint ndims,
+            const compute::nd_range_t &range);
+
+    ~stream_t() override;
 
     const xpu::ocl::context_t &ocl_ctx() const { return impl()->ocl_ctx(); }
     xpu::ocl::context_t &ocl_ctx() { return impl()->ocl_ctx(); }
@@ -114,8 +134,17 @@ private:
 
     cl_command_queue create_queue(
             cl_context ctx, cl_device_id dev, cl_int *err) const;
+    void init_tile_queues();
 
     std::unique_ptr<mdapi_helper_t> mdapi_helper_;
+
+    struct command_buffer_t;
+    std::unique_ptr<command_buffer_t> cmd_buf_;
+
+    // In-order queues of the engine tiles, empty when the stream doesn't
+    // split work across tiles.
+    std::vector<xpu::ocl::wrapper_t<cl_command_queue>> tile_queues_;
+    int tile_ = -1;
 };
 
 } // namespace ocl
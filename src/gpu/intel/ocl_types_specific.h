@@ -369,7 +369,7 @@
 #define CONVERT_DST_DATA4_T CONCAT2(convert_, DST_DATA4_T)
 #define CONVERT_DST_DATA8_T CONCAT2(convert_, DST_DATA8_T)
 #define CONVERT_DST_DATA16_T CONCAT2(convert_, DST_DATA16_T)
-#elif DST_DT_BF16
+#elif DST_DT_BF16 || DST_DT_BF8 || DST_DT_HF8
 #define CONVERT_DST_DATA_T TO_DST
 #define CONVERT_DST_DATA2_T TO_DST2
 #define CONVERT_DST_DATA4_T TO_DST4
@@ -384,7 +384,7 @@
 #endif
 
 // Block read/write macros for dst.
-#if DST_DT_U8 || DST_DT_S8
+#if DST_DT_U8 || DST_DT_S8 || DST_DT_BF8 || DST_DT_HF8
 #define BLOCK_READ_DST2(ptr) \
     AS_DST_DATA2_T(intel_sub_group_block_read_uc2((__global uchar *)ptr))
 #define BLOCK_WRITE_DST2(ptr, v) \
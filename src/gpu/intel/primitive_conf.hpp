@@ -400,6 +400,8 @@ struct lnorm_conf_t {
     int vector_size_scaleshift;
     bool use_src_buffer;
     bool skip_mean;
+    bool fuse_residual_add;
+    bool save_residual_sum;
 
     compute::dispatch_t dispatch_scaleshift;
     compute::dispatch_t dispatch_scaleshift_finalize;
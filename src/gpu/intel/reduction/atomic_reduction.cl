@@ -40,7 +40,9 @@
         return 0; \
     }
 
-#if ATOMIC_REDUCTION_SIZE > 1
+#define USE_ATOMICS (ATOMIC_REDUCTION_SIZE > 1 && !DETERMINISTIC)
+
+#if USE_ATOMICS
 #define MAYBE_ATOMIC(x) ATOMIC(x)
 DEF_atomic_accumulate(float);
 #else
@@ -174,7 +176,7 @@ __kernel void atomic_reduce(__global SRC_DATA_T *src,
 #endif
         unroll_for(int v = 0; v < VECT_DT_N; v++) {
             DST_DATA_T dst_data = GET_ELEM(vect_dst_data, v);
-#if ATOMIC_REDUCTION_SIZE > 1
+#if USE_ATOMICS
             DST_DATA_T old_val = atomic_accumulate(
                     REDUCTION_ALG, &dst[v * subgroup_size], dst_data);
 #else
@@ -96,6 +96,7 @@ atomic_reduction_conf_t::atomic_reduction_conf_t(
         data_type_t dst_type, const compute::device_info_t &device_info,
         gpu_primitive_attr_t *gpu_attr)
     : reduction_subproblem_t(subprb) {
+    conf.deterministic = false;
     conf.src_type = src_type;
     conf.dst_type = dst_type;
     conf.subgroup_size = device_info.max_subgroup_size();
@@ -254,7 +255,10 @@ status_t atomic_reduction_conf_t::init_dispatcher(
     compute::named_buffer_t dst("DST", src);
     dst.remove_dim(reduction_dims::loop);
     dst.remove_dim(reduction_dims::local); // broadcasted
-    dst.remove_dim(reduction_dims::global); // broadcasted
+    // In deterministic mode, each atomic work-group writes its partial result
+    // to its own slice of dst: [outer][global][inner]
+    if (!conf.deterministic)
+        dst.remove_dim(reduction_dims::global); // broadcasted
 
     // Broadcast src's global/local dims, since we index the reduction dims manually
     src.remove_dim(reduction_dims::global, false);
@@ -264,7 +268,8 @@ status_t atomic_reduction_conf_t::init_dispatcher(
     dim_idx_t dst_outer_idx = dst.get_dim_idx(reduction_dims::outer);
     gpu_assert(dst_outer_idx != dim_idx::invalid);
     dst.format_desc.blocking.strides[dst_outer_idx]
-            = inner_block.block / conf.vect_size;
+            = inner_block.block / conf.vect_size
+            * (conf.deterministic ? conf.global_acc : 1);
 
     // Create the dispatcher
     compute::reusable_dispatch_config_t config(
@@ -290,25 +295,33 @@ status_t atomic_reduction_conf_t::init_dispatcher(
     return status::success;
 }
 
+size_t atomic_reduction_conf_t::dst_size() const {
+    const dim_t partials = conf.deterministic ? conf.global_acc : 1;
+    return into<size_t>(outer_block.block * partials * inner_block.block)
+            * types::data_type_size(conf.dst_type);
+}
+
 void atomic_reduction_t::pd_t::init_scratchpad() {
-    // Only need scratchpads for the first 2 phases, since we can reuse them
-    // and memory requirements are monotonically decreasing each phase.
+    // Phases alternate between 2 scratchpads. Memory requirements are not
+    // monotonic once deterministic partials are written, so each one is sized
+    // for the largest phase using it.
     const uint32_t keys[2] = {memory_tracking::names::key_reduction,
             memory_tracking::names::key_reduction_1};
 
-    // If we have to use a finalization kernel, we need another scratchpad
-    size_t num_phases = phases.size();
-    if (needs_finalization) num_phases++;
+    // If we have to use a finalization kernel, the last phase also writes to
+    // a scratchpad
+    const size_t num_sp_phases
+            = needs_finalization ? phases.size() : phases.size() - 1;
+
+    size_t sp_sizes[2] = {0, 0};
+    for (size_t i = 0; i < num_sp_phases; i++) {
+        sp_sizes[i % 2] = std::max(sp_sizes[i % 2], phases[i].dst_size());
+    }
 
     auto scratchpad = scratchpad_registry().registrar();
-    const size_t num_scratchpads = std::min(num_phases - 1, size_t {2});
-    for (size_t i = 0; i < num_scratchpads; i++) {
-        const atomic_reduction_conf_t &phase = phases[i];
-        const size_t sp_data_size = types::data_type_size(phase.conf.dst_type);
-        const size_t num_dst_elems = into<size_t>(
-                phase.outer_block.block * phase.inner_block.block);
-        scratchpad.book(
-                keys[i], num_dst_elems, sp_data_size, OCL_BUFFER_ALIGNMENT);
+    for (size_t i = 0; i < 2; i++) {
+        if (sp_sizes[i] == 0) continue;
+        scratchpad.book(keys[i], sp_sizes[i], 1, OCL_BUFFER_ALIGNMENT);
     }
 }
 
@@ -390,11 +403,27 @@ status_t atomic_reduction_t::pd_t::init_conf(impl::engine_t *engine) {
         if (phase.inner_block.block % phase.conf.subgroup_size != 0) {
             return status::unimplemented;
         }
+
+        // Deterministic mode: keep the work split of atomic accumulation, but
+        // write the per-work-group partials out and reduce them in a
+        // following phase, in a fixed order.
+        if (attr()->deterministic_ && phase.conf.global_acc > 1) {
+            phase.conf.deterministic = true;
+            phase.conf.dst_type = accum_data_type;
+            phase.conf.alg = from_alg(desc()->alg_kind, is_first, false);
+            phase.conf.secondary_alg = from_alg(desc()->alg_kind, false, false);
+
+            reduction_subproblem_t partials_subprb(phase.inner_block.block,
+                    phase.conf.global_acc, phase.outer_block.block);
+            partials_subprb.dst_zpads = std::move(phase.dst_zpads);
+            phase.dst_zpads.clear();
+            subprbs.insert(subprbs.begin() + i + 1, std::move(partials_subprb));
+        }
         CHECK(phase.init_dispatcher(compute_engine, gpu_attr));
     }
 
     for (atomic_reduction_conf_t &phase : phases) {
-        if (phase.conf.global_acc > 1) {
+        if (phase.conf.global_acc > 1 && !phase.conf.deterministic) {
             bool ok = compute_engine->mayiuse(
                     compute::device_ext_t::ext_float_atomics);
 
@@ -469,6 +498,7 @@ static void init_kernel_ctx_common(compute::kernel_ctx_t &kernel_ctx,
     // All of the variables needed to compute strides
     kernel_ctx.define_int("LOCAL_SIZE", conf.local_acc);
     kernel_ctx.define_int("ATOMIC_REDUCTION_SIZE", conf.global_acc);
+    kernel_ctx.define_int("DETERMINISTIC", conf.deterministic);
     // End stride vars
 
     kernel_ctx.define_int("FULL_UNROLL_FACTOR", conf.full_unroll_factor);
@@ -522,7 +552,7 @@ status_t atomic_reduction_t::execute_atomic(const exec_ctx_t &ctx) const {
                 = (i == kernels_.size() - 1) ? final_mem : *sp_reduce[i % 2];
 
         // Initialize dst if we're using atomic (global) accumulation
-        if (phase.conf.global_acc > 1) {
+        if (phase.conf.global_acc > 1 && !phase.conf.deterministic) {
             // min -> fill with inf (11111111), otherwise sum/mean fill with 0
             uint8_t pattern
                     = phase.conf.alg == reduction_alg_kind_t::min ? 255 : 0;
@@ -62,6 +62,10 @@ struct atomic_reduction_key_params_t
     int32_t tail_unroll_factor;
     int32_t global_acc;
     dim_t local_acc;
+    // Write one partial result per atomic work-group instead of accumulating
+    // them atomically; a following phase reduces the partials in order.
+    bool deterministic;
+    uint8_t padding[7] = {0};
 
     compute::dispatch_compile_params_t params;
 };
@@ -75,6 +79,8 @@ struct atomic_reduction_conf_t : public reduction_subproblem_t {
             gpu_primitive_attr_t *gpu_attr);
     status_t init_dispatcher(const compute::compute_engine_t *engine,
             const gpu_primitive_attr_t *gpu_attr);
+    // Size in bytes of the data written by the phase
+    size_t dst_size() const;
 
     atomic_reduction_key_params_t conf;
     compute::dispatch_runtime_params_t rt_conf;
@@ -98,8 +104,6 @@ struct atomic_reduction_t : public gpu_primitive_t {
                     VERBOSE_INCONSISTENT_NDIMS, "src", "dst");
             VDISPATCH_REDUCTION_SC(attr_.set_default_formats(dst_md(0)),
                     VERBOSE_UNSUPPORTED_TAG);
-            VDISPATCH_REDUCTION(
-                    !attr()->deterministic_, VERBOSE_UNSUPPORTED_ATTR);
 
             VDISPATCH_REDUCTION_SC(init_conf(engine), "init_conf");
             init_scratchpad();
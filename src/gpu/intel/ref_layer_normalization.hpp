@@ -52,6 +52,8 @@ struct ref_layer_normalization_fwd_t : public gpu_primitive_t {
             bool uses_f64 = utils::one_of(f64, src_dt, dst_dt);
 
             VDISPATCH_LNORM(is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_LNORM(!fuse_residual_add(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "residual add");
             VDISPATCH_LNORM(IMPLICATION(uses_f16,
                                     compute_engine->mayiuse(
                                             compute::device_ext_t::khr_fp16))
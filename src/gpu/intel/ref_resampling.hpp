@@ -40,6 +40,10 @@ struct ref_resampling_fwd_t : public gpu_primitive_t {
             const auto attr_skip_mask = sm::post_ops;
 
             VDISPATCH_RESAMPLING(is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_RESAMPLING(utils::one_of(desc()->alg_kind,
+                                         alg_kind::resampling_nearest,
+                                         alg_kind::resampling_linear),
+                    VERBOSE_BAD_ALGORITHM);
             VDISPATCH_RESAMPLING_SC(
                     set_default_params(), VERBOSE_UNSUPPORTED_TAG);
             VDISPATCH_RESAMPLING(attr()->has_default_values(attr_skip_mask),
@@ -14,9 +14,11 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include "gpu/intel/sdpa_utils.h"
+
+#if IS_FWD
 #include "gpu/intel/ocl_post_ops.h"
 #include "gpu/intel/ocl_types.h"
-#include "gpu/intel/sdpa_utils.h"
 
 __kernel void ref_sdpa(const __global QRY_DATA_T *Q,
         const __global KEY_DATA_T *K, const __global VAL_DATA_T *V,
@@ -76,3 +78,164 @@ __kernel void ref_sdpa(const __global QRY_DATA_T *Q,
         dst[dst_off] = TO_DST(acc);
     }
 }
+#endif
+
+#if IS_BWD
+#include "gpu/intel/ocl_io.h"
+
+// Backward pass. The attention probabilities P = softmax(scale * Q * K + M)
+// are recomputed from the log-sum-exp statistics saved by the forward pass:
+//   P = exp(scale * Q * K + M - stats)
+// With delta = rowsum(dO .* O) and dS = P .* (dO * V^T - delta):
+//   dV = P^T * dO, dQ = scale * dS * K^T, dK = scale * Q^T * dS.
+
+inline float attn_scale(const __global SCALE_DATA_T *scale_ptr) {
+#if WITH_ATTN_SCALE
+    float scale = load(scale, scale_ptr);
+#if INVERT_SCALE
+    scale = 1.f / scale;
+#endif
+    return scale;
+#else
+    return 1.f;
+#endif
+}
+
+inline bool is_masked_out(long q, long k) {
+#if WITH_CAUSAL_MASK
+#if CAUSAL_BOTTOM_RIGHT
+    return k > q + (SIZE_K - SIZE_Q);
+#else
+    return k > q;
+#endif
+#else
+    return false;
+#endif
+}
+
+// Returns the probability of key k for query q.
+inline float recompute_prob(const __global QRY_DATA_T *Q,
+        const __global KEY_DATA_T *K, const __global MSK_DATA_T *mask,
+        float scale, float lse, long b1, long b0, long b0_kv, long q, long k) {
+    if (is_masked_out(q, k) || lse == -INFINITY) return 0.f;
+
+    float s = 0;
+    for (long h = 0; h < HEAD_SIZE; h++) {
+        float qv = load(qv, Q + QRY_OFF(b1, b0, q, h));
+        float kv = load(kv, K + KEY_OFF(b1, b0_kv, h, k));
+        s += qv * kv;
+    }
+    s *= scale;
+#if WITH_ATTN_MASK
+    float m = load(m,
+            mask
+                    + MSK_OFF(b1 % MSK_DIM0, b0 % MSK_DIM1, q % MSK_DIM2,
+                            k));
+    s += m;
+#endif
+    return exp(s - lse);
+}
+
+// Returns dO(q, :) * V(k, :)^T.
+inline float diff_prob(const __global DIFF_DST_DATA_T *dO,
+        const __global VAL_DATA_T *V, long b1, long b0, long b0_kv, long q,
+        long k) {
+    float dp = 0;
+    for (long v = 0; v < SIZE_V; v++) {
+        float dov = load(dov, dO + DIFF_DST_OFF(b1, b0, q, v));
+        float vv = load(vv, V + VAL_OFF(b1, b0_kv, k, v));
+        dp += dov * vv;
+    }
+    return dp;
+}
+
+// One work item per query row: computes delta and dQ.
+__kernel void ref_sdpa_bwd_dq(const __global QRY_DATA_T *Q,
+        const __global KEY_DATA_T *K, const __global VAL_DATA_T *V,
+        const __global DST_DATA_T *O, const __global DIFF_DST_DATA_T *dO,
+        const __global float *stats, const __global SCALE_DATA_T *scale_ptr,
+        const __global MSK_DATA_T *mask, __global float *delta,
+        __global DIFF_QRY_DATA_T *dQ) {
+    long q = get_global_id(0);
+    long b0 = get_global_id(1);
+    long b1 = get_global_id(2);
+    long b0_kv = b0 / KV_GROUP_SIZE;
+
+    long row = (b1 * NUM_HEADS + b0) * SIZE_Q + q;
+    float lse = stats[row];
+    float scale = attn_scale(scale_ptr);
+
+    float d = 0;
+    for (long v = 0; v < SIZE_V; v++) {
+        float dov = load(dov, dO + DIFF_DST_OFF(b1, b0, q, v));
+        float ov = load(ov, O + DST_4D_OFF(b1, b0, q, v));
+        d += dov * ov;
+    }
+    delta[row] = d;
+
+    float dq[HEAD_SIZE];
+    for (long h = 0; h < HEAD_SIZE; h++)
+        dq[h] = 0;
+
+    for (long k = 0; k < SIZE_K; k++) {
+        float p = recompute_prob(Q, K, mask, scale, lse, b1, b0, b0_kv, q, k);
+        if (p == 0.f) continue;
+        float ds = p * (diff_prob(dO, V, b1, b0, b0_kv, q, k) - d) * scale;
+        for (long h = 0; h < HEAD_SIZE; h++) {
+            float kv = load(kv, K + KEY_OFF(b1, b0_kv, h, k));
+            dq[h] += ds * kv;
+        }
+    }
+
+    for (long h = 0; h < HEAD_SIZE; h++)
+        write(dQ + DIFF_QRY_OFF(b1, b0, q, h), dq[h]);
+}
+
+// One work item per key: computes dK and dV, accumulating over all the query
+// heads sharing the key/value head.
+__kernel void ref_sdpa_bwd_dkdv(const __global QRY_DATA_T *Q,
+        const __global KEY_DATA_T *K, const __global VAL_DATA_T *V,
+        const __global DIFF_DST_DATA_T *dO, const __global float *stats,
+        const __global SCALE_DATA_T *scale_ptr,
+        const __global MSK_DATA_T *mask, const __global float *delta,
+        __global DIFF_KEY_DATA_T *dK, __global DIFF_VAL_DATA_T *dV) {
+    long k = get_global_id(0);
+    long b0_kv = get_global_id(1);
+    long b1 = get_global_id(2);
+
+    float scale = attn_scale(scale_ptr);
+
+    float dk[HEAD_SIZE], dv[SIZE_V];
+    for (long h = 0; h < HEAD_SIZE; h++)
+        dk[h] = 0;
+    for (long v = 0; v < SIZE_V; v++)
+        dv[v] = 0;
+
+    for (long g = 0; g < KV_GROUP_SIZE; g++) {
+        long b0 = b0_kv * KV_GROUP_SIZE + g;
+        for (long q = 0; q < SIZE_Q; q++) {
+            long row = (b1 * NUM_HEADS + b0) * SIZE_Q + q;
+            float p = recompute_prob(
+                    Q, K, mask, scale, stats[row], b1, b0, b0_kv, q, k);
+            if (p == 0.f) continue;
+            float ds = p
+                    * (diff_prob(dO, V, b1, b0, b0_kv, q, k) - delta[row])
+                    * scale;
+            for (long v = 0; v < SIZE_V; v++) {
+                float dov = load(dov, dO + DIFF_DST_OFF(b1, b0, q, v));
+                dv[v] += p * dov;
+            }
+            for (long h = 0; h < HEAD_SIZE; h++) {
+                float qv = load(qv, Q + QRY_OFF(b1, b0, q, h));
+                dk[h] += ds * qv;
+            }
+        }
+    }
+
+    for (long h = 0; h < HEAD_SIZE; h++)
+        write(dK + DIFF_KEY_OFF(b1, b0_kv, h, k), dk[h]);
+    for (long v = 0; v < SIZE_V; v++)
+        write(dV + DIFF_VAL_OFF(b1, b0_kv, k, v), dv[v]);
+}
+
+#endif
@@ -58,6 +58,142 @@ status_t ref_sdpa_t::execute_ref(const exec_ctx_t &ctx) const {
     return parallel_for(ctx, nd_range, kernel_, arg_list);
 }
 
+void ref_sdpa_bwd_t::pd_t::init_scratchpad() {
+    // delta = rowsum(diff_dst * dst), one value per query row.
+    const dim_t rows = desc()->batch_size() * desc()->queries();
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book(memory_tracking::names::key_sdpa_bwd_delta, rows,
+            sizeof(float), OCL_BUFFER_ALIGNMENT);
+}
+
+status_t ref_sdpa_bwd_t::init(impl::engine_t *engine) {
+    compute::kernel_ctx_t kernel_ctx;
+
+    const auto *d = pd()->desc();
+    const int ndims = 4;
+    kernel_ctx.define_int("NDIMS", ndims);
+    kernel_ctx.define_int("IS_BWD", 1);
+
+    using offset_t = decltype(offsets_t().src_off);
+    auto def_md_offsets = [&](const memory_desc_t *md, const char *name) {
+        offset_t off;
+        set_offsets(memory_desc_wrapper(md), off);
+        def_offsets(off, kernel_ctx, name, ndims);
+    };
+    def_md_offsets(pd()->qry_md(), "QRY");
+    def_md_offsets(pd()->key_md(), "KEY");
+    def_md_offsets(pd()->val_md(), "VAL");
+    def_md_offsets(pd()->dst_md(), "DST");
+    def_md_offsets(pd()->diff_qry_md(), "DIFF_QRY");
+    def_md_offsets(pd()->diff_key_md(), "DIFF_KEY");
+    def_md_offsets(pd()->diff_val_md(), "DIFF_VAL");
+    def_md_offsets(pd()->diff_dst_md(), "DIFF_DST");
+    if (pd()->with_attn_mask()) {
+        const auto *msk = pd()->attn_mask_md();
+        def_md_offsets(msk, "MSK");
+        kernel_ctx.define_int("MSK_DIM0", msk->dims[0]);
+        kernel_ctx.define_int("MSK_DIM1", msk->dims[1]);
+        kernel_ctx.define_int("MSK_DIM2", msk->dims[2]);
+    }
+
+    kernel_ctx.define_int("SIZE_Q", d->queries());
+    kernel_ctx.define_int("SIZE_K", d->keys());
+    kernel_ctx.define_int("SIZE_V", d->values());
+    kernel_ctx.define_int("HEAD_SIZE", d->head_size());
+    kernel_ctx.define_int("NUM_HEADS", pd()->qry_md()->dims[1]);
+    kernel_ctx.define_int(
+            "KV_GROUP_SIZE", pd()->qry_md()->dims[1] / d->kv_head_number);
+
+    kernel_ctx.define_int("INVERT_SCALE", d->invert_scale);
+    kernel_ctx.define_int("WITH_ATTN_SCALE", pd()->with_attn_scale());
+    kernel_ctx.define_int("WITH_ATTN_MASK",
+            pd()->with_attn_mask() && !pd()->with_causal_mask());
+    kernel_ctx.define_int("WITH_CAUSAL_MASK", pd()->with_causal_mask());
+    kernel_ctx.define_int("CAUSAL_BOTTOM_RIGHT",
+            d->mask_type == attn_mask_type::bottom_right);
+
+    const bool with_punning = false;
+    def_data_type(kernel_ctx, pd()->qry_md()->data_type, "QRY", with_punning);
+    def_data_type(kernel_ctx, pd()->key_md()->data_type, "KEY", with_punning);
+    def_data_type(kernel_ctx, pd()->val_md()->data_type, "VAL", with_punning);
+    def_data_type(kernel_ctx, pd()->dst_md()->data_type, "DST", with_punning);
+    def_data_type(kernel_ctx, pd()->diff_qry_md()->data_type, "DIFF_QRY",
+            with_punning);
+    def_data_type(kernel_ctx, pd()->diff_key_md()->data_type, "DIFF_KEY",
+            with_punning);
+    def_data_type(kernel_ctx, pd()->diff_val_md()->data_type, "DIFF_VAL",
+            with_punning);
+    def_data_type(kernel_ctx, pd()->diff_dst_md()->data_type, "DIFF_DST",
+            with_punning);
+    def_data_type(kernel_ctx, pd()->attn_mask_md()->data_type, "MSK",
+            with_punning);
+    def_data_type(kernel_ctx, d->scale_dt, "SCALE", with_punning);
+
+    std::vector<compute::kernel_t> kernels;
+    CHECK(create_kernels(engine, &kernels,
+            {"ref_sdpa_bwd_dq", "ref_sdpa_bwd_dkdv"}, kernel_ctx));
+    dq_kernel_ = kernels[0];
+    dkdv_kernel_ = kernels[1];
+    if (!dq_kernel_ || !dkdv_kernel_) return status::runtime_error;
+    return status::success;
+}
+
+status_t ref_sdpa_bwd_t::execute_backward(const exec_ctx_t &ctx) const {
+    const auto &qry = CTX_IN_STORAGE(DNNL_ARG_QUERIES);
+    const auto &key = CTX_IN_STORAGE(DNNL_ARG_KEYS);
+    const auto &val = CTX_IN_STORAGE(DNNL_ARG_VALUES);
+    const auto &dst = CTX_IN_STORAGE(DNNL_ARG_DST);
+    const auto &diff_dst = CTX_IN_STORAGE(DNNL_ARG_DIFF_DST);
+    const auto &stats = CTX_IN_STORAGE(DNNL_ARG_ATTN_STATS);
+    const auto &scale = CTX_IN_STORAGE(DNNL_ARG_SCALE);
+    const auto &attn_mask = CTX_IN_STORAGE(DNNL_ARG_ATTN_MASK);
+    auto &diff_qry = CTX_OUT_STORAGE(DNNL_ARG_DIFF_QUERIES);
+    auto &diff_key = CTX_OUT_STORAGE(DNNL_ARG_DIFF_KEYS);
+    auto &diff_val = CTX_OUT_STORAGE(DNNL_ARG_DIFF_VALUES);
+
+    std::unique_ptr<memory_storage_t> delta
+            = ctx.get_scratchpad_grantor().get_memory_storage(
+                    memory_tracking::names::key_sdpa_bwd_delta);
+
+    const auto *d = pd()->desc();
+    const dim_t B1 = pd()->qry_md()->dims[0];
+    const dim_t B0 = pd()->qry_md()->dims[1];
+
+    // The dK/dV kernel consumes delta, so the dQ kernel runs first.
+    compute::kernel_arg_list_t dq_args;
+    dq_args.append(qry);
+    dq_args.append(key);
+    dq_args.append(val);
+    dq_args.append(dst);
+    dq_args.append(diff_dst);
+    dq_args.append(stats);
+    dq_args.append(scale);
+    dq_args.append(attn_mask);
+    dq_args.append(*delta);
+    dq_args.append(diff_qry);
+
+    compute::range_t dq_gws = {(size_t)d->queries(), (size_t)B0, (size_t)B1};
+    CHECK(parallel_for(
+            ctx, compute::nd_range_t(dq_gws), dq_kernel_, dq_args));
+
+    compute::kernel_arg_list_t dkdv_args;
+    dkdv_args.append(qry);
+    dkdv_args.append(key);
+    dkdv_args.append(val);
+    dkdv_args.append(diff_dst);
+    dkdv_args.append(stats);
+    dkdv_args.append(scale);
+    dkdv_args.append(attn_mask);
+    dkdv_args.append(*delta);
+    dkdv_args.append(diff_key);
+    dkdv_args.append(diff_val);
+
+    compute::range_t dkdv_gws
+            = {(size_t)d->keys(), (size_t)d->kv_head_number, (size_t)B1};
+    return parallel_for(
+            ctx, compute::nd_range_t(dkdv_gws), dkdv_kernel_, dkdv_args);
+}
+
 } // namespace intel
 } // namespace gpu
 } // namespace impl
@@ -47,6 +47,10 @@ struct ref_sdpa_t : public gpu_primitive_t {
             /* Reference SDPA is only enabled on-demand, for testing. */
             bool enable_ref = gpu_utils::dev_getenv("enable_ref_sdpa", false);
             VDISPATCH_SDPA(enable_ref, VERBOSE_SKIP_PRIMITIVE_IMPL);
+            VDISPATCH_SDPA(desc()->prop_kind == prop_kind::forward_inference,
+                    VERBOSE_BAD_PROPKIND);
+            VDISPATCH_SDPA(!with_score_mods(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "score modifiers");
 
             VDISPATCH_SDPA(attr()->has_default_values(smask_t::scales),
                     VERBOSE_UNSUPPORTED_ATTR);
@@ -89,6 +93,7 @@ struct ref_sdpa_t : public gpu_primitive_t {
         def_offsets(dst_off, kernel_ctx, "DST", ndims);
         def_offsets(msk_off, kernel_ctx, "MSK", ndims);
         kernel_ctx.define_int("NDIMS", ndims);
+        kernel_ctx.define_int("IS_FWD", 1);
 
         kernel_ctx.define_int("SIZE_K", pd()->desc()->keys());
         kernel_ctx.define_int("INVERT_SCALE", pd()->desc()->invert_scale);
@@ -116,6 +121,92 @@ private:
     compute::kernel_t kernel_;
 };
 
+struct ref_sdpa_bwd_t : public gpu_primitive_t {
+    using gpu_primitive_t::gpu_primitive_t;
+    struct pd_t : public sdpa_bwd_pd_t {
+        using sdpa_bwd_pd_t::sdpa_bwd_pd_t;
+
+        DECLARE_COMMON_PD_T("ocl:ref:any", ref_sdpa_bwd_t);
+
+        status_t init(impl::engine_t *engine) {
+            using namespace data_type;
+
+            const auto *compute_engine
+                    = utils::downcast<compute::compute_engine_t *>(engine);
+
+            VDISPATCH_SDPA(!is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_SDPA(!with_score_mods(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "score modifiers");
+            VDISPATCH_SDPA(attr()->has_default_values(),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_SDPA(!with_key_scales() && !with_value_scales()
+                            && !with_key_zp() && !with_value_zp(),
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
+            VDISPATCH_SDPA(
+                    utils::everyone_is(4, qry_md()->ndims, key_md()->ndims,
+                            val_md()->ndims, dst_md()->ndims),
+                    VERBOSE_UNSUPPORTED_TAG);
+
+            const auto dt = qry_md()->data_type;
+            VDISPATCH_SDPA(utils::one_of(dt, f32, bf16, f16),
+                    VERBOSE_UNSUPPORTED_DT);
+            for (auto *md : {key_md(), val_md(), dst_md(), diff_qry_md(),
+                         diff_key_md(), diff_val_md(), diff_dst_md()})
+                VDISPATCH_SDPA(md->data_type == dt, VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_SDPA(stats_md()->data_type == f32,
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_SDPA(IMPLICATION(dt == f16,
+                                   compute_engine->mayiuse(
+                                           compute::device_ext_t::khr_fp16)),
+                    VERBOSE_UNSUPPORTED_DT);
+            if (with_attn_mask()) {
+                VDISPATCH_SDPA(
+                        attn_mask_md()->ndims == 4, VERBOSE_UNSUPPORTED_TAG);
+                VDISPATCH_SDPA(utils::one_of(attn_mask_md()->data_type, f32,
+                                       bf16, f16),
+                        VERBOSE_UNSUPPORTED_DT);
+            }
+
+            // K and V may only be shared between query heads.
+            VDISPATCH_SDPA(key_md()->dims[0] == qry_md()->dims[0]
+                            && val_md()->dims[0] == qry_md()->dims[0],
+                    VERBOSE_INCONSISTENT_DIM, "key", 0, "query", 0);
+            VDISPATCH_SDPA(desc()->kv_head_number > 0
+                            && qry_md()->dims[1] % desc()->kv_head_number == 0,
+                    VERBOSE_BAD_DIM, "query", 1);
+
+            // Gradients of a query row and of a key are accumulated in
+            // private memory.
+            VDISPATCH_SDPA(desc()->head_size() <= 256
+                            && desc()->values() <= 256,
+                    VERBOSE_BAD_PARAM, "head_size");
+
+            VDISPATCH_SDPA(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_SDPA(memory_desc_wrapper(stats_md()).matches_tag(
+                                   format_tag::abcd),
+                    VERBOSE_UNSUPPORTED_TAG);
+
+            init_scratchpad();
+            return status::success;
+        }
+
+    private:
+        void init_scratchpad();
+    };
+
+    status_t init(impl::engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_backward(ctx);
+    }
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    status_t execute_backward(const exec_ctx_t &ctx) const;
+    compute::kernel_t dq_kernel_;
+    compute::kernel_t dkdv_kernel_;
+};
+
 } // namespace intel
 } // namespace gpu
 } // namespace impl
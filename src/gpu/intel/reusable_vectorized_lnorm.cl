@@ -32,13 +32,34 @@ VEC_SUM_DEFINE(float2)
 VEC_SUM_DEFINE(float4)
 VEC_SUM_DEFINE(float8)
 
+#define LOAD_VECT_SRC_DATA(ptr) \
+    CONVERT_VECT_FLOAT_T(AS_VECT_DATA_T( \
+            VECT_BLOCK_READ((const __global BLOCK_DATA_T *)(ptr))))
+
+// The value being normalized: src, or the sum of src and the residual.
+#if FUSE_RESIDUAL_ADD
+#define LOAD_VECT_SRC(off) \
+    (LOAD_VECT_SRC_DATA(&src[off]) + LOAD_VECT_SRC_DATA(&src1[off]))
+#else
+#define LOAD_VECT_SRC(off) LOAD_VECT_SRC_DATA(&src[off])
+#endif
+
 __attribute__((intel_reqd_sub_group_size(SG_SIZE))) __kernel void
 lnorm_reusable_vectorized(__global SRC_DATA_T *src, __global float *mean,
         __global float *variance, dim_t reduce_size, __global DST_DATA_T *dst,
         __global WEI_DATA_T *scale, __global WEI_DATA_T *shift, float eps,
         __global float *src_scale, __global float *dst_scale, int greads,
-        float rrs, dispatch_gws_rt_params_t gws_params) {
+        float rrs, __global SRC_DATA_T *src1, __global SRC_DATA_T *dst1,
+        dispatch_gws_rt_params_t gws_params) {
     src = (GWS_GET_BUFFER_POS(SRC, gws_params, src)) - get_sub_group_local_id();
+#if FUSE_RESIDUAL_ADD
+    src1 = (GWS_GET_BUFFER_POS(SRC, gws_params, src1))
+            - get_sub_group_local_id();
+#endif
+#if SAVE_RESIDUAL_SUM
+    dst1 = (GWS_GET_BUFFER_POS(SRC, gws_params, dst1))
+            - get_sub_group_local_id();
+#endif
 
     FLT_ACC_DATA_T local_variance = 0.f;
     FLT_ACC_DATA_T local_mean = 0.f;
@@ -47,19 +68,14 @@ lnorm_reusable_vectorized(__global SRC_DATA_T *src, __global float *mean,
         FLT_ACC_DATA_T sum = 0;
         unroll_for_by(N_UNROLL)(int sg_idx = 0; sg_idx < reduce_size;
                                 sg_idx += SG_STRIDE) {
-            VECT_FLOAT_T val
-                    = CONVERT_VECT_FLOAT_T(AS_VECT_DATA_T(VECT_BLOCK_READ(
-                            (const __global BLOCK_DATA_T *)(&src[sg_idx]))));
+            VECT_FLOAT_T val = LOAD_VECT_SRC(sg_idx);
             sum += vec_sum(val);
         }
 
         if (!SKIP_MEAN) local_mean = sub_group_reduce_add(sum) * rrs;
         FLT_ACC_DATA_T sumsq = 0;
         unroll_for_by(N_UNROLL)(int i = 0; i < greads; i++) {
-            VECT_FLOAT_T val;
-            val = CONVERT_VECT_FLOAT_T(AS_VECT_DATA_T(VECT_BLOCK_READ((
-                          const __global BLOCK_DATA_T *)(&src[i * SG_STRIDE]))))
-                    - local_mean;
+            VECT_FLOAT_T val = LOAD_VECT_SRC(i * SG_STRIDE) - local_mean;
             val *= val;
             sumsq += vec_sum(val);
         }
@@ -89,11 +105,12 @@ lnorm_reusable_vectorized(__global SRC_DATA_T *src, __global float *mean,
     float dst_scale_val = dst_scale ? native_recip(*dst_scale) : 1.f;
 
     unroll_for_by(N_UNROLL)(int i = greads - 1; i >= 0; i--) {
-        VECT_FLOAT_T res
-                = CONVERT_VECT_FLOAT_T(AS_VECT_DATA_T(VECT_BLOCK_READ((
-                          const __global BLOCK_DATA_T *)(&src[i * SG_STRIDE]))))
-                - local_mean;
-        res *= sqrt_variance;
+        VECT_FLOAT_T res = LOAD_VECT_SRC(i * SG_STRIDE);
+#if SAVE_RESIDUAL_SUM
+        VECT_BLOCK_WRITE((__global BLOCK_DATA_T *)(&dst1[i * SG_STRIDE]),
+                AS_VECT_BLOCK_DATA_T(CONVERT_VECTOR_DATA_T(res)));
+#endif
+        res = (res - local_mean) * sqrt_variance;
         if (USE_SCALE) res *= LOAD_VECT_WEI(scale);
         if (USE_SHIFT) res += LOAD_VECT_WEI(shift);
 
@@ -95,6 +95,8 @@ static status_t init_conf_common(const layer_normalization_pd_t *pd,
     conf->calculate_stats = !pd->stats_are_src();
     conf->save_stats = pd->is_training();
     conf->skip_mean = pd->skip_mean();
+    conf->fuse_residual_add = pd->fuse_residual_add();
+    conf->save_residual_sum = pd->save_residual_sum();
 
     // We require that the lnorm axis is a single dense block, so that it can
     // be represented by a stride + size alone.
@@ -207,13 +209,15 @@ reusable_vectorized_lnorm_params_t::get_kernel_ctx() const {
     kernel_ctx.set_data_type(input_dt);
     def_data_type(kernel_ctx, input_dt, "SRC");
     def_data_type(kernel_ctx, ss_dt, "WEI");
-    def_data_type(kernel_ctx, output_dt, "DST");
+    def_data_type(kernel_ctx, output_dt, "DST", /*with_punning=*/true);
 
     kernel_ctx.define_int("USE_SCALE", use_scale);
     kernel_ctx.define_int("USE_SHIFT", use_shift);
     kernel_ctx.define_int("SKIP_MEAN", skip_mean);
     kernel_ctx.define_int("CALCULATE_STATS", calculate_stats);
     kernel_ctx.define_int("SAVE_STATS", save_stats && calculate_stats);
+    kernel_ctx.define_int("FUSE_RESIDUAL_ADD", fuse_residual_add);
+    kernel_ctx.define_int("SAVE_RESIDUAL_SUM", save_residual_sum);
 
     kernel_ctx.define_int("SG_SIZE", sg_size);
     kernel_ctx.define_int("VECT_DT_N", vector_size);
@@ -234,6 +238,8 @@ status_t reusable_vectorized_layer_normalization_fwd_t::execute_forward(
     auto &scale = CTX_IN_STORAGE(DNNL_ARG_SCALE);
     auto &shift = CTX_IN_STORAGE(DNNL_ARG_SHIFT);
     auto &dst = CTX_OUT_STORAGE(DNNL_ARG_DST);
+    auto &src1 = CTX_IN_STORAGE(DNNL_ARG_SRC_1);
+    auto &dst1 = CTX_OUT_STORAGE(DNNL_ARG_DST_1);
 
     auto &src_scale = CTX_IN_STORAGE(DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC);
     auto &dst_scale = CTX_IN_STORAGE(DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST);
@@ -259,6 +265,8 @@ status_t reusable_vectorized_layer_normalization_fwd_t::execute_forward(
     lnorm_arg_list.append((int)utils::div_up(
             pd()->norm_axis(), conf.sg_size * conf.vector_size));
     lnorm_arg_list.append(1.f / (pd()->norm_axis()));
+    lnorm_arg_list.append(src1);
+    lnorm_arg_list.append(dst1);
 
     lnorm_arg_list.append(rt_conf.gws_params.get());
 
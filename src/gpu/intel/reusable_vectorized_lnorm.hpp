@@ -75,7 +75,13 @@ struct reusable_vectorized_lnorm_params_t
     /// Saves the mean and variance to memory
     bool save_stats = false;
 
-    uint8_t padding[3] = {false};
+    /// Adds the residual input to the source before normalization
+    bool fuse_residual_add = false;
+
+    /// Writes the sum of the source and the residual to memory
+    bool save_residual_sum = false;
+
+    uint8_t padding[1] = {false};
 };
 
 struct reusable_vectorized_lnorm_runtime_params_t {
@@ -101,7 +107,9 @@ struct reusable_vectorized_layer_normalization_fwd_t : public gpu_primitive_t {
             data_type_t src_dt = src_md()->data_type;
             data_type_t dst_dt = dst_md()->data_type;
 
-            const bool uses_f16 = utils::one_of(f16, src_dt, dst_dt);
+            // fp8 values are converted through f16.
+            const bool uses_f16 = utils::one_of(f16, src_dt, dst_dt)
+                    || utils::one_of(dst_dt, f8_e5m2, f8_e4m3);
             const bool uses_f64 = utils::one_of(f64, src_dt, dst_dt);
 
             /// TODO(umar): Can be implemented if we have a compatible WEI_TO_ACC macro in kernel
@@ -113,6 +121,9 @@ struct reusable_vectorized_layer_normalization_fwd_t : public gpu_primitive_t {
                     compute_engine->mayiuse(compute::device_ext_t::khr_fp64));
 
             VDISPATCH_LNORM(is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_LNORM(IMPLICATION(fuse_residual_add(),
+                                    utils::one_of(src_dt, f32, bf16, f16)),
+                    VERBOSE_UNSUPPORTED_DT);
             VDISPATCH_LNORM(f16_ok, VERBOSE_UNSUPPORTED_DEVICE_FEATURE, "fp16");
             VDISPATCH_LNORM(f64_ok, VERBOSE_UNSUPPORTED_DEVICE_FEATURE, "fp64");
             VDISPATCH_LNORM(check_scale_shift_data_type({f32, bf16, f16}),
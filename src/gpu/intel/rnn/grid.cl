@@ -1069,6 +1069,23 @@ void cell_common(const_wei_layer_cell_t wei_layer,
     }
 }
 
+#if CELL_GLOBAL_SYNC
+// Waits until the work-groups along dhc have all finished the iteration. The
+// counter only grows, so the work-groups wait for it to reach `target`
+// rather than for it to be reset.
+void cell_global_barrier(volatile __global atomic_int *counter, int target) {
+    barrier(CLK_GLOBAL_MEM_FENCE);
+    if (get_local_id(0) == 0 && get_local_id(1) == 0) {
+        atomic_fetch_add_explicit(
+                counter, 1, memory_order_release, memory_scope_device);
+        while (atomic_load_explicit(
+                       counter, memory_order_acquire, memory_scope_device)
+                < target) {}
+    }
+    barrier(CLK_GLOBAL_MEM_FENCE);
+}
+#endif
+
 __attribute__((intel_reqd_sub_group_size(SUBGROUP_SIZE))) __kernel void
 simple_rnn_cell_fwd(__global const WEI_LAYER_DATA_T *wei_layer_,
         dim_t wei_layer_off, int64x5_t wei_layer_strides_,
@@ -1095,6 +1112,9 @@ simple_rnn_cell_fwd(__global const WEI_LAYER_DATA_T *wei_layer_,
 #endif
 #if CELL_ENABLE_ITER_BLOCK
         dim_t iter_loop,
+#endif
+#if CELL_GLOBAL_SYNC
+        volatile __global atomic_int *sync_counters,
 #endif
         __global BIAS_DATA_T *bias_, dim_t bias_off, float alpha,
         __global float *tm_scales, dim_t mb, dim_t dhc, dim_t slc, dim_t sic,
@@ -1186,7 +1206,14 @@ simple_rnn_cell_fwd(__global const WEI_LAYER_DATA_T *wei_layer_,
         cell_common(wei_layer, wei_iter, cell_layer, cell_iter, gates, states,
                 scratch_gates, scratch_cell, cell_ctx, dims, cell_loops);
 
-        if (iter < iter_loop - 1) barrier(CLK_GLOBAL_MEM_FENCE);
+        if (iter < iter_loop - 1) {
+#if CELL_GLOBAL_SYNC
+            cell_global_barrier(sync_counters + get_group_id(1),
+                    (iter + 1) * get_num_groups(0));
+#else
+            barrier(CLK_GLOBAL_MEM_FENCE);
+#endif
+        }
     }
 
     return;
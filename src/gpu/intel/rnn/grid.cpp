@@ -324,6 +324,22 @@ static status_t init_ocl_conf(rnn_utils::ocl_conf_t &ocl_conf,
         ocl_conf.cell_comp.dhc_tg = into<int>(dhc_tg);
         ocl_conf.cell_comp.mb_thr = mb_thr;
         ocl_conf.cell_comp.mb_tg = into<int>(mb_tg);
+
+        // When the kernel loops over the iterations, the work-group barrier
+        // orders the iterations only if a single work-group covers dhc, which
+        // serializes large dhc on one subslice. Instead, split dhc across
+        // persistent work-groups synchronized by a global barrier. The
+        // barrier requires all the work-groups to be resident on the device
+        // at once.
+        const dim_t dhc_wg = utils::div_up(rnn.dhc, dhc_thr * dhc_tg);
+        const dim_t mb_wg = utils::div_up(rnn.mb, mb_thr * mb_tg);
+        const dim_t wg_threads = dhc_tg / ocl_conf.subgroup_size * mb_tg;
+        const bool fits_device = dhc_wg * mb_wg * wg_threads
+                <= device_info.hw_threads(threads_per_eu == 4);
+        const bool sync_dhc = dev_getenv("sync_dhc",
+                rnn.iter_loop > 1 && rnn.dhc_loop == rnn.dhc && dhc_wg > 1
+                        && fits_device);
+        ocl_conf.cell_comp.sync_dhc_wg = sync_dhc ? into<int>(dhc_wg) : 0;
     }
 
     return status::success;
@@ -453,6 +469,8 @@ status_t ocl_conf_t::init_kernel_ctx(compute::kernel_ctx_t &kernel_ctx) const {
                 "CELL_ENABLE_ITER_BLOCK", cell_comp.enable_iter_block);
         kernel_ctx.define_int("CELL_DHC_THR", cell_comp.dhc_thr);
         kernel_ctx.define_int("CELL_BATCH_THR", cell_comp.mb_thr);
+        kernel_ctx.define_int("CELL_GLOBAL_SYNC", cell_comp.sync_dhc_wg > 0);
+        if (cell_comp.sync_dhc_wg > 0) kernel_ctx.add_option("-cl-std=CL2.0");
     }
 
     return status::success;
@@ -601,6 +619,7 @@ status_t simple_rnn_common_t<aprop>::pd_t::init(impl::engine_t *engine) {
             VERBOSE_BAD_ALGORITHM);
     VDISPATCH_RNN(!this->is_lstm_peephole(), "is_lstm_peephole");
     VDISPATCH_RNN(!this->is_lstm_projection(), "is_lstm_projection");
+    VDISPATCH_RNN(!this->with_seq_lengths(), "with_seq_lengths");
     VDISPATCH_RNN(IMPLICATION(aprop == prop_kind::forward,
                           one_of(this->desc()->prop_kind, forward_training,
                                   forward_inference)),
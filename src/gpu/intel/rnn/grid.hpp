@@ -109,6 +109,14 @@ struct simple_rnn_common_t : public gpu_primitive_t {
             auto scratchpad = this->scratchpad_registry().registrar();
             scratchpad.book(key_rnn_space, workspace_size, 1,
                     OCL_BUFFER_ALIGNMENT, 4096);
+            // One barrier counter per work-group along the batch.
+            if (ocl_conf.cell_comp.sync_dhc_wg > 0) {
+                const dim_t mb_block = ocl_conf.cell_comp.mb_thr
+                        * ocl_conf.cell_comp.mb_tg;
+                scratchpad.book(key_rnn_cell_sync,
+                        utils::div_up(rnn_conf.mb, mb_block), sizeof(int32_t),
+                        OCL_BUFFER_ALIGNMENT);
+            }
             rnn_utils::scratch_t::book(scratchpad, rnn_conf,
                     {
                             gemm_iter_fwd_pd_.get(),
@@ -16,6 +16,8 @@
 
 #include "gpu/intel/rnn/simple_cell_fusion.hpp"
 
+#include "gpu/intel/compute/compute_stream.hpp"
+
 namespace dnnl {
 namespace impl {
 namespace gpu {
@@ -51,7 +53,10 @@ status_t compute_cell_fwd(const exec_ctx_t &ctx,
     const size_t dhc = conf.dhc;
     const size_t dhc_thr = cell_conf.dhc_thr;
     const size_t dhc_tg = cell_conf.dhc_tg;
-    const size_t dhc_loop = utils::rnd_up(conf.dhc_loop, dhc_thr * dhc_tg);
+    // With the global barrier, every work-group computes a single dhc block.
+    const size_t dhc_loop = cell_conf.sync_dhc_wg > 0
+            ? dhc_thr * dhc_tg
+            : utils::rnd_up(conf.dhc_loop, dhc_thr * dhc_tg);
 
     gpu_assert(dhc_tg % ocl_conf.subgroup_size == 0);
 
@@ -112,6 +117,19 @@ status_t compute_cell_fwd(const exec_ctx_t &ctx,
 
     if (cell_conf.enable_iter_block) { arg_list.append(conf.iter_loop); }
 
+    if (cell_conf.sync_dhc_wg > 0) {
+        // The barrier counters only grow, so they are reset for every launch.
+        auto sync = ctx.get_scratchpad_grantor().get_memory_storage(
+                memory_tracking::names::key_rnn_cell_sync);
+        auto *compute_stream
+                = utils::downcast<compute::compute_stream_t *>(ctx.stream());
+        CHECK(compute_stream->fill(*sync, 0,
+                utils::div_up(mb, batch_local) * sizeof(int32_t),
+                compute_stream->ctx().get_deps(),
+                compute_stream->ctx().get_deps()));
+        arg_list.append(*sync);
+    }
+
     arg_list.append(bias, ocl_conf.bia_dt);
     arg_list.append(alpha);
     arg_list.append(get_storage(tm_scales));
@@ -262,6 +262,10 @@ struct ocl_conf_t {
         int dhc_tg = 0;
         int mb_thr = 0;
         int mb_tg = 0;
+        // Number of work-groups splitting dhc when iterating over the time
+        // steps in one kernel. They synchronize through a global barrier
+        // after every iteration. A single work-group covers dhc when 0.
+        int sync_dhc_wg = 0;
 #if __cplusplus >= 202002L
         bool operator==(const comp_conf_t &) const = default;
 #endif
@@ -27,6 +27,11 @@
 #define KEY_OFF(x0, x1, x2, x3) _4D_OFF(KEY, x0, x1, x2, x3)
 #define VAL_OFF(x0, x1, x2, x3) _4D_OFF(VAL, x0, x1, x2, x3)
 #define MSK_OFF(x0, x1, x2, x3) _4D_OFF(MSK, x0, x1, x2, x3)
+#define DST_4D_OFF(x0, x1, x2, x3) _4D_OFF(DST, x0, x1, x2, x3)
+#define DIFF_QRY_OFF(x0, x1, x2, x3) _4D_OFF(DIFF_QRY, x0, x1, x2, x3)
+#define DIFF_KEY_OFF(x0, x1, x2, x3) _4D_OFF(DIFF_KEY, x0, x1, x2, x3)
+#define DIFF_VAL_OFF(x0, x1, x2, x3) _4D_OFF(DIFF_VAL, x0, x1, x2, x3)
+#define DIFF_DST_OFF(x0, x1, x2, x3) _4D_OFF(DIFF_DST, x0, x1, x2, x3)
 
 #define _BATCH_OFF(tag, x0, x1) ((x0)*tag##_S.array[0] + (x1)*tag##_S.array[1])
 
@@ -16,7 +16,24 @@
 
 #include "gpu/intel/binary_common.h"
 
-#if IS_TENSOR_OP && IS_DENSE && IS_SAME_MD && !WITH_BINARY_POST_OP
+#if IS_DENSE_KERNEL
+__kernel void simple_binary_dense(__global SRC0_DATA_T *src0,
+        __global SRC1_DATA_T *src1, __global DST_DATA_T *dst,
+        __global float *src0_scale, __global float *src1_scale, dim_t nelems) {
+    const dim_t off = get_global_id(0);
+    if (off >= nelems) return;
+
+    float tmp_src0 = SRC0_TO_FLOAT(src0[off]);
+    float tmp_src1 = SRC1_TO_FLOAT(src1[off]);
+#if WITH_SRC0_SCALE
+    tmp_src0 = tmp_src0 * (*src0_scale);
+#endif
+#if WITH_SRC1_SCALE
+    tmp_src1 = tmp_src1 * (*src1_scale);
+#endif
+    dst[off] = TO_DST(binary_op(BINARY_ALG, tmp_src0, tmp_src1));
+}
+#elif IS_TENSOR_OP && IS_DENSE && IS_SAME_MD && !WITH_BINARY_POST_OP
 KERNEL_ATTR
 __kernel void simple_binary(__global DATA_T *src0, __global DATA_T *src1,
 #if IS_TERNARY
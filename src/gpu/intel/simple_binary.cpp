@@ -97,6 +97,18 @@ status_t simple_binary_t::pd_t::init_conf(impl::engine_t *engine) {
         }
     }
 
+    // The shape-agnostic kernel covers the elementwise case, the ternary
+    // select and the post-ops keep the kernel specialized for the problem.
+    use_dense_kernel = conf.is_tensor_op && conf.is_dense && conf.is_same_md
+            && !is_ternary_op() && attr()->post_ops_.len() == 0;
+    if (use_dense_kernel) {
+        dense_conf.data_type = dst_d.data_type();
+        dense_conf.alg = conf.alg;
+        dense_conf.with_src0_scale = with_scales(DNNL_ARG_SRC_0);
+        dense_conf.with_src1_scale = with_scales(DNNL_ARG_SRC_1);
+        return status::success;
+    }
+
     auto *compute_engine = utils::downcast<compute::compute_engine_t *>(engine);
     conf.dispatch = compute_engine->create_dispatch(dst_d.md_);
     if (conf.is_tensor_op && conf.is_dense && conf.is_same_md
@@ -121,6 +133,21 @@ status_t simple_binary_t::pd_t::init_conf(impl::engine_t *engine) {
     return status::success;
 }
 
+compute::kernel_ctx_t simple_binary_dense_params_t::get_kernel_ctx() const {
+    compute::kernel_ctx_t kernel_ctx;
+    def_binary_alg_kinds(kernel_ctx);
+    kernel_ctx.define_int("BINARY_ALG", alg);
+    kernel_ctx.define_int("IS_DENSE_KERNEL", 1);
+    kernel_ctx.define_int("IS_PLAIN_LAYOUT", 1);
+    kernel_ctx.define_int("WITH_SRC0_SCALE", with_src0_scale);
+    kernel_ctx.define_int("WITH_SRC1_SCALE", with_src1_scale);
+    kernel_ctx.set_data_type(data_type);
+    def_data_type(kernel_ctx, data_type, "SRC0");
+    def_data_type(kernel_ctx, data_type, "SRC1");
+    def_data_type(kernel_ctx, data_type, "DST");
+    return kernel_ctx;
+}
+
 status_t simple_binary_t::pd_t::init_kernel_ctx(
         compute::kernel_ctx_t &kernel_ctx) const {
     def_binary_alg_kinds(kernel_ctx);
@@ -192,6 +219,24 @@ status_t simple_binary_t::execute_simple(const exec_ctx_t &ctx) const {
     auto &src0_scale = CTX_IN_STORAGE(DNNL_ARG_SRC_0 | DNNL_ARG_ATTR_SCALES);
     auto &src1_scale = CTX_IN_STORAGE(DNNL_ARG_SRC_1 | DNNL_ARG_ATTR_SCALES);
 
+    if (pd()->use_dense_kernel) {
+        const dim_t nelems = memory_desc_wrapper(pd()->dst_md()).nelems();
+        if (nelems == 0) return status::success;
+
+        compute::kernel_arg_list_t arg_list;
+        arg_list.set(0, src0);
+        arg_list.set(1, src1);
+        arg_list.set(2, dst);
+        arg_list.set(3, src0_scale);
+        arg_list.set(4, src1_scale);
+        arg_list.set(5, nelems);
+
+        const size_t lws = 256;
+        compute::nd_range_t nd_range(
+                {utils::rnd_up(into<size_t>(nelems), lws)}, {lws});
+        return parallel_for(ctx, nd_range, kernel_, arg_list);
+    }
+
     unsigned arg_idx = 0;
     compute::kernel_arg_list_t arg_list;
     arg_list.set(arg_idx++, src0);
@@ -19,6 +19,7 @@
 
 #include "common/c_types_map.hpp"
 #include "common/primitive.hpp"
+#include "common/serialization.hpp"
 #include "gpu/gpu_binary_pd.hpp"
 #include "gpu/intel/gpu_primitive.hpp"
 #include "gpu/intel/primitive_conf.hpp"
@@ -28,6 +29,31 @@ namespace impl {
 namespace gpu {
 namespace intel {
 
+// Parameters of the kernel for dense tensors sharing the dst layout and
+// without post-ops. The number of elements is passed at execution, so
+// problems differing only by their shape reuse the same kernel binary.
+struct simple_binary_dense_params_t
+    : public trivially_serializable_t<simple_binary_dense_params_t> {
+    status_t create_generator(const compute::compute_engine_t &engine,
+            compute::kernel_bundle_t &bundle) const {
+        return engine.create_kernel_bundle(
+                bundle, get_kernel_names(), get_kernel_ctx());
+    }
+
+    const std::vector<const char *> &get_kernel_names() const {
+        static const std::vector<const char *> names {"simple_binary_dense"};
+        return names;
+    }
+
+    compute::kernel_ctx_t get_kernel_ctx() const;
+
+    data_type_t data_type = data_type::undef;
+    alg_kind_t alg = alg_kind::undef;
+    bool with_src0_scale = false;
+    bool with_src1_scale = false;
+    uint8_t pad0[2] = {};
+};
+
 struct simple_binary_t : public gpu_primitive_t {
     using gpu_primitive_t::gpu_primitive_t;
     struct pd_t : public gpu_binary_pd_t {
@@ -150,6 +176,8 @@ struct simple_binary_t : public gpu_primitive_t {
         }
 
         binary_conf_t conf;
+        bool use_dense_kernel = false;
+        simple_binary_dense_params_t dense_conf;
 
     private:
         bool check_scales_mask() const {
@@ -160,6 +188,10 @@ struct simple_binary_t : public gpu_primitive_t {
     };
 
     status_t init(impl::engine_t *engine) override {
+        if (pd()->use_dense_kernel)
+            return create_kernel(
+                    engine, kernel_, "simple_binary_dense", pd()->dense_conf);
+
         compute::kernel_ctx_t kernel_ctx;
 
         auto status = pd()->init_kernel_ctx(kernel_ctx);
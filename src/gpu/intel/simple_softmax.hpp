@@ -53,6 +53,9 @@ struct simple_softmax_fwd_t : public gpu_primitive_t {
             using namespace data_type;
             using skip_mask_t = primitive_attr_t::skip_mask_t;
             VDISPATCH_SOFTMAX(is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_SOFTMAX(!with_attn_preprocessing(),
+                    VERBOSE_UNSUPPORTED_FEATURE,
+                    "attention scores preprocessing");
             VDISPATCH_SOFTMAX(
                     utils::one_of(src_dt, f64, f32, f16, bf16, u8, s8),
                     VERBOSE_UNSUPPORTED_DT);
@@ -0,0 +1,185 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl_ukernel.h"
+
+#include "gpu/intel/ukernel/gemm.hpp"
+
+#include "common/verbose.hpp"
+#include "gemmstone/microkernel_provider.hpp"
+#include "gpu/intel/compute/compute_engine.hpp"
+#include "gpu/intel/jit/gemm/gen_gemm_kernel.hpp"
+#include "gpu/intel/microkernels/fuser.hpp"
+#include "gpu/intel/microkernels/shim.hpp"
+
+#ifdef DNNL_EXPERIMENTAL_UKERNEL
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::gpu::intel;
+using namespace gemmstone;
+
+using gpu_gemm_t = dnnl_gpu_gemm;
+
+#define VCHECK_GPU_GEMM(cond, msg, ...) \
+    VCONDCHECK(ukernel, create, check, gpu_gemm, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__)
+
+status_t dnnl_gpu_gemm::fuse(std::vector<uint8_t> &binary) const {
+    try {
+        micro::fuseMicrokernels(binary, source_.c_str());
+    } catch (...) { return status::runtime_error; }
+    return status::success;
+}
+
+status_t dnnl_gpu_gemm_create(gpu_gemm_t **gemm, dnnl_engine_t engine,
+        const char *name, dim_t M, dim_t N, dim_t K, data_type_t a_dt,
+        data_type_t b_dt, dnnl_pack_type_t a_pack_type,
+        dnnl_pack_type_t b_pack_type, dim_t lda, dim_t ldb) {
+    using namespace data_type;
+    if (utils::any_null(gemm, engine, name)) return status::invalid_arguments;
+
+    VCHECK_GPU_GEMM(
+            engine->kind() == engine_kind::gpu, VERBOSE_BAD_ENGINE_KIND);
+    VCHECK_GPU_GEMM(utils::one_of(a_dt, f16, bf16) && b_dt == a_dt,
+            VERBOSE_UNSUPPORTED_DT);
+    VCHECK_GPU_GEMM(utils::one_of(a_pack_type, dnnl_pack_type_no_trans,
+                            dnnl_pack_type_trans)
+                    && utils::one_of(b_pack_type, dnnl_pack_type_no_trans,
+                            dnnl_pack_type_trans),
+            VERBOSE_BAD_PARAM, "pack_type");
+    VCHECK_GPU_GEMM(M > 0 && N > 0 && K > 0 && lda > 0 && ldb > 0,
+            VERBOSE_BAD_DIM, "M, N, K", 0);
+
+    auto *compute_engine = utils::downcast<compute::compute_engine_t *>(engine);
+    VCONDCHECK(ukernel, create, check, gpu_gemm,
+            compute::mayiuse_microkernels(compute_engine),
+            status::unimplemented,
+            "microkernels are not supported by the driver");
+
+    const auto *dev_info = compute_engine->device_info();
+    HWInformation hw_info;
+    hw_info.euCount = dev_info->eu_count();
+    hw_info.gmdid = dev_info->ip_version();
+    hw_info.systolicAvailable = dev_info->mayiuse_systolic();
+    if (hw_info.gmdid == 0) return status::unimplemented;
+
+    // The API follows the row-major convention of the CPU ukernels, which is
+    // the transposed layout for the column-major gemmstone problem.
+    auto to_layout = [](dnnl_pack_type_t pack_type) {
+        return pack_type == dnnl_pack_type_no_trans ? MatrixLayout::T
+                                                    : MatrixLayout::N;
+    };
+
+    GEMMProblem problem;
+    problem.Ta = problem.Ta_ext = jit::convert_dnnl_to_kernel_type(a_dt);
+    problem.Tb = problem.Tb_ext = jit::convert_dnnl_to_kernel_type(b_dt);
+    problem.Tc = problem.Tc_ext = Type::f32;
+    problem.Ts = problem.Tc;
+    problem.A.layout = to_layout(a_pack_type);
+    problem.B.layout = to_layout(b_pack_type);
+    problem.C.layout = MatrixLayout::T;
+    const int a_size = static_cast<int>(types::data_type_size(a_dt));
+    const int b_size = static_cast<int>(types::data_type_size(b_dt));
+    problem.A.setAlignment(alignmentForLD(into<int>(lda * a_size)));
+    problem.B.setAlignment(alignmentForLD(into<int>(ldb * b_size)));
+
+    SizeParams sizes;
+    sizes.m = M;
+    sizes.n = N;
+    sizes.k = K;
+    sizes.batch = 1;
+
+    micro::GEMMProtocol::Options opts;
+    micro::Package package;
+    try {
+        package = selectGEMMMicrokernel(opts, hw_info, sizes, problem);
+    } catch (const std::runtime_error &ex) {
+        VCONDCHECK(ukernel, create, check, gpu_gemm, false,
+                status::unimplemented,
+                "microkernel generation failure with message: %s", ex.what());
+    }
+
+    const int sg_size = dev_info->min_subgroup_size();
+    micro::ShimOptions shim_options;
+    shim_options.subgroupSize = sg_size;
+    shim_options.decorator = name;
+
+    std::string source;
+    try {
+        source = micro::generateShim(
+                package, micro::HostLanguage::OpenCL_C, shim_options);
+    } catch (const std::runtime_error &ex) {
+        VCONDCHECK(ukernel, create, check, gpu_gemm, false,
+                status::runtime_error,
+                "microkernel shim generation failure with message: %s",
+                ex.what());
+    }
+
+    std::string options;
+    if (package.grfMin > 128) options = "-cl-intel-256-GRF-per-thread";
+
+    *gemm = new gpu_gemm_t(std::move(package), std::move(source),
+            std::move(options), sg_size);
+    return status::success;
+}
+
+status_t dnnl_gpu_gemm_get_source(const gpu_gemm_t *gemm, const char **source) {
+    if (utils::any_null(gemm, source)) return status::invalid_arguments;
+    *source = gemm->source();
+    return status::success;
+}
+
+status_t dnnl_gpu_gemm_get_build_options(
+        const gpu_gemm_t *gemm, const char **options) {
+    if (utils::any_null(gemm, options)) return status::invalid_arguments;
+    *options = gemm->options();
+    return status::success;
+}
+
+status_t dnnl_gpu_gemm_get_work_group_info(const gpu_gemm_t *gemm,
+        dim_t *wg_tile_m, dim_t *wg_tile_n, int *sg_size, int *sg_per_wg_m,
+        int *sg_per_wg_n) {
+    if (gemm == nullptr) return status::invalid_arguments;
+    if (wg_tile_m) *wg_tile_m = gemm->setting("wg_tile_m");
+    if (wg_tile_n) *wg_tile_n = gemm->setting("wg_tile_n");
+    if (sg_size) *sg_size = gemm->sg_size();
+    if (sg_per_wg_m) *sg_per_wg_m = gemm->setting("sg_per_wg_m");
+    if (sg_per_wg_n) *sg_per_wg_n = gemm->setting("sg_per_wg_n");
+    return status::success;
+}
+
+status_t dnnl_gpu_gemm_fuse(const gpu_gemm_t *gemm, const uint8_t *binary,
+        size_t binary_size, uint8_t *fused, size_t *fused_size) {
+    if (utils::any_null(gemm, binary, fused_size))
+        return status::invalid_arguments;
+
+    std::vector<uint8_t> result(binary, binary + binary_size);
+    CHECK(gemm->fuse(result));
+
+    if (fused) {
+        if (*fused_size < result.size()) return status::invalid_arguments;
+        std::copy(result.begin(), result.end(), fused);
+    }
+    *fused_size = result.size();
+    return status::success;
+}
+
+status_t dnnl_gpu_gemm_destroy(gpu_gemm_t *gemm) {
+    delete gemm;
+    return status::success;
+}
+
+#endif
@@ -0,0 +1,59 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GPU_INTEL_UKERNEL_GEMM_HPP
+#define GPU_INTEL_UKERNEL_GEMM_HPP
+
+#include <string>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl_ukernel_types.h"
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+#include "gpu/intel/microkernels/package.hpp"
+
+#ifdef DNNL_EXPERIMENTAL_UKERNEL
+
+// A gemm microkernel exposed to user OpenCL C kernels. The object owns the
+// microkernel package selected for the problem and the shim source the user
+// kernel includes; the microkernel code is patched into the user program
+// binary by `fuse()`, as the library does for its own kernels.
+struct dnnl_gpu_gemm : public dnnl::impl::c_compatible {
+    dnnl_gpu_gemm(dnnl::impl::gpu::intel::micro::Package package,
+            std::string source, std::string options, int sg_size)
+        : package_(std::move(package))
+        , source_(std::move(source))
+        , options_(std::move(options))
+        , sg_size_(sg_size) {}
+
+    const char *source() const { return source_.c_str(); }
+    const char *options() const { return options_.c_str(); }
+    int sg_size() const { return sg_size_; }
+    int setting(const char *name) const { return package_.getSetting(name); }
+
+    dnnl::impl::status_t fuse(std::vector<uint8_t> &binary) const;
+
+private:
+    dnnl::impl::gpu::intel::micro::Package package_;
+    std::string source_;
+    std::string options_;
+    int sg_size_;
+};
+
+#endif
+
+#endif
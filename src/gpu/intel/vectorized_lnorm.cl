@@ -51,11 +51,27 @@
     VECT_BLOCK_WRITE((__global BLOCK_DATA_T *)(ptr), \
             AS_VECT_BLOCK_DATA_T(CONVERT_VECTOR_DATA_T(val)))
 
+#define STORE_VECT_DST(ptr, val) \
+    VECT_DST_BLOCK_WRITE(ptr, CONVERT_VECTOR_DST_DATA_T(val))
+
+#define LOAD_VECT_DATA(ptr) \
+    CONVERT_VECT_FLOAT_T(AS_VECT_DATA_T( \
+            VECT_BLOCK_READ((const __global BLOCK_DATA_T *)(ptr))))
+
+// The value being normalized: src, or the sum of src and the residual.
+#if FUSE_RESIDUAL_ADD
+#define LOAD_VECT_SRC(off) \
+    (LOAD_VECT_DATA(&src[off]) + LOAD_VECT_DATA(&src1[off]))
+#else
+#define LOAD_VECT_SRC(off) LOAD_VECT_DATA(&src[off])
+#endif
+
 KERNEL_ATTR
 __kernel void vectorized_lnorm_fwd(__global DATA_T *src, __global float *mean,
-        __global float *variance, __global DATA_T *dst,
+        __global float *variance, __global DST_DATA_T *dst,
         __global WEI_DATA_T *scale, __global WEI_DATA_T *shift, float eps,
-        __global float *src_scale, __global float *dst_scale) {
+        __global float *src_scale, __global float *dst_scale,
+        __global DATA_T *src1, __global DATA_T *dst1) {
 
     int x[6] = {0};
     x[0] = GWS_GET_X0();
@@ -78,8 +94,10 @@ __kernel void vectorized_lnorm_fwd(__global DATA_T *src, __global float *mean,
     for (int c = 0; c < VLEN_C_BLOCK; c++) {
         x[NDIMS - 1] = c * SUB_GROUP_SIZE * VECT_DT_N + c_block_off;
         int src_off = SRC_OFF(x[0], x[1], x[2], x[3], x[4], x[5]);
-        v_src[c] = CONVERT_VECT_FLOAT_T(AS_VECT_DATA_T(
-                VECT_BLOCK_READ((const __global BLOCK_DATA_T *)&src[src_off])));
+        v_src[c] = LOAD_VECT_SRC(src_off);
+#if SAVE_RESIDUAL_SUM
+        STORE_VECT_DATA(&dst1[src_off], v_src[c]);
+#endif
     }
 #if CALCULATE_STATS
     VECT_FLOAT_T v_acc = 0;
@@ -128,7 +146,7 @@ __kernel void vectorized_lnorm_fwd(__global DATA_T *src, __global float *mean,
         v_dst /= dst_scale[0];
 #endif
 
-        STORE_VECT_DATA(&dst[dst_off], v_dst);
+        STORE_VECT_DST(&dst[dst_off], v_dst);
     }
 #else // USE_SRC_BUFFER
     // Key feature of this version is only vectorized block read/write
@@ -139,8 +157,7 @@ __kernel void vectorized_lnorm_fwd(__global DATA_T *src, __global float *mean,
     for (int c = 0; c < C_BLOCK; c += SUB_GROUP_SIZE * VECT_DT_N) {
         x[NDIMS - 1] = c + c_block_off;
         int src_off = SRC_OFF(x[0], x[1], x[2], x[3], x[4], x[5]);
-        v_acc += CONVERT_VECT_FLOAT_T(AS_VECT_DATA_T(
-                VECT_BLOCK_READ((const __global BLOCK_DATA_T *)&src[src_off])));
+        v_acc += LOAD_VECT_SRC(src_off);
     }
 #if !SKIP_MEAN
     CALC_V_STAT(v_mean, v_acc);
@@ -152,9 +169,7 @@ __kernel void vectorized_lnorm_fwd(__global DATA_T *src, __global float *mean,
         x[NDIMS - 1] = c + c_block_off;
         int src_off = SRC_OFF(x[0], x[1], x[2], x[3], x[4], x[5]);
 
-        m = CONVERT_VECT_FLOAT_T(AS_VECT_DATA_T(
-                VECT_BLOCK_READ((const __global BLOCK_DATA_T *)&src[src_off])));
-        m -= v_mean;
+        m = LOAD_VECT_SRC(src_off) - v_mean;
         v_acc += m * m;
     }
     CALC_V_STAT(v_variance, v_acc);
@@ -178,8 +193,10 @@ __kernel void vectorized_lnorm_fwd(__global DATA_T *src, __global float *mean,
         x[NDIMS - 1] = c + c_block_off;
         const int src_off = SRC_OFF(x[0], x[1], x[2], x[3], x[4], x[5]);
         const int dst_off = DST_OFF(x[0], x[1], x[2], x[3], x[4], x[5]);
-        const VECT_FLOAT_T v_src = CONVERT_VECT_FLOAT_T(AS_VECT_DATA_T(
-                VECT_BLOCK_READ((const __global BLOCK_DATA_T *)&src[src_off])));
+        const VECT_FLOAT_T v_src = LOAD_VECT_SRC(src_off);
+#if SAVE_RESIDUAL_SUM
+        STORE_VECT_DATA(&dst1[src_off], v_src);
+#endif
         VECT_FLOAT_T v_dst = sm * (v_src - v_mean) + sv;
 
 #if WITH_SRC_SCALES
@@ -189,7 +206,7 @@ __kernel void vectorized_lnorm_fwd(__global DATA_T *src, __global float *mean,
         v_dst /= dst_scale[0];
 #endif
 
-        STORE_VECT_DATA(&dst[dst_off], v_dst);
+        STORE_VECT_DST(&dst[dst_off], v_dst);
     }
 #endif // USE_SRC_BUFFER
 
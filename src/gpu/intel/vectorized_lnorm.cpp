@@ -190,6 +190,7 @@ static status_t init_conf_common(lnorm_conf_t &conf,
     dim_idx_t ndims = into<dim_idx_t>(src_mdw.ndims());
 
     conf.src_dt = src_mdw.data_type();
+    conf.dst_dt = dst_mdw.data_type();
     conf.ndims = ndims;
     conf.norm_axis = into<dim_idx_t>(pd->norm_axis());
     conf.across_axis = into<dim_idx_t>(pd->across_axis());
@@ -199,6 +200,8 @@ static status_t init_conf_common(lnorm_conf_t &conf,
     conf.save_stats = pd->is_training();
     conf.eps = pd->desc()->layer_norm_epsilon;
     conf.skip_mean = pd->skip_mean();
+    conf.fuse_residual_add = pd->fuse_residual_add();
+    conf.save_residual_sum = pd->save_residual_sum();
 
     if (conf.use_scale || conf.use_shift) {
         memory_desc_wrapper weights_mdw(
@@ -468,6 +471,8 @@ static status_t init_kernel_ctx_common(
         kernel_ctx_t &kernel_ctx, const lnorm_conf_t &conf) {
     kernel_ctx.set_data_type(conf.src_dt);
     def_data_type(kernel_ctx, conf.weights_data_type, "WEI");
+    if (conf.is_fwd)
+        def_data_type(kernel_ctx, conf.dst_dt, "DST", /*with_punning=*/true);
 
     // Since FWD kernel aggressively uses GRF (allocates a private buffer for
     // SRC chunk), large GRF mode decreases number/probability of register
@@ -500,6 +505,8 @@ static status_t init_kernel_ctx_common(
     kernel_ctx.define_int("FINALIZE_N_CHUNKS", conf.finalize_n_chunks);
     kernel_ctx.define_int("USE_SRC_BUFFER", conf.use_src_buffer);
     kernel_ctx.define_int("SKIP_MEAN", conf.skip_mean);
+    kernel_ctx.define_int("FUSE_RESIDUAL_ADD", conf.fuse_residual_add);
+    kernel_ctx.define_int("SAVE_RESIDUAL_SUM", conf.save_residual_sum);
 
     kernel_ctx.add_option("-cl-std=CL2.0");
     def_memory_desc_info(kernel_ctx, conf.src_md_info, "SRC");
@@ -545,6 +552,8 @@ status_t vectorized_lnorm_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
     auto &dst = CTX_OUT_STORAGE(DNNL_ARG_DST);
     auto &src_scale = CTX_IN_STORAGE(DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC);
     auto &dst_scale = CTX_IN_STORAGE(DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST);
+    auto &src1 = CTX_IN_STORAGE(DNNL_ARG_SRC_1);
+    auto &dst1 = CTX_OUT_STORAGE(DNNL_ARG_DST_1);
 
     kernel_arg_list_t arg_list;
     arg_list.set(0, src);
@@ -556,6 +565,8 @@ status_t vectorized_lnorm_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
     arg_list.set(6, conf.eps);
     arg_list.set(7, src_scale);
     arg_list.set(8, dst_scale);
+    arg_list.set(9, src1);
+    arg_list.set(10, dst1);
 
     auto nd_range_kernel = conf.dispatch.nd_range();
     status = parallel_for(ctx, nd_range_kernel, kernel_, arg_list);
@@ -47,16 +47,24 @@ struct vectorized_lnorm_fwd_t : public gpu_primitive_t {
 
             VDISPATCH_LNORM(is_fwd(), VERBOSE_BAD_PROPKIND);
             VDISPATCH_LNORM(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
-            VDISPATCH_LNORM(
-                    (utils::everyone_is(u8, src_data_t, dst_data_t)
-                            || utils::everyone_is(s8, src_data_t, dst_data_t)
-                            || utils::everyone_is(f16, src_data_t, dst_data_t)
-                            || utils::everyone_is(bf16, src_data_t, dst_data_t)
-                            || utils::everyone_is(f32, src_data_t, dst_data_t)),
+            // Floating-point sources may be quantized to int8 or fp8 on
+            // output.
+            const bool is_flt_src = utils::one_of(src_data_t, f32, bf16, f16);
+            VDISPATCH_LNORM(utils::one_of(src_data_t, u8, s8, f16, bf16, f32)
+                            && (dst_data_t == src_data_t
+                                    || (is_flt_src
+                                            && utils::one_of(dst_data_t, u8,
+                                                    s8, f16, bf16, f32,
+                                                    f8_e5m2, f8_e4m3))),
                     VERBOSE_UNSUPPORTED_DT);
-            VDISPATCH_LNORM(IMPLICATION(f16 == src_data_t,
-                                    compute_engine->mayiuse(
-                                            compute::device_ext_t::khr_fp16)),
+            VDISPATCH_LNORM(IMPLICATION(fuse_residual_add(), is_flt_src),
+                    VERBOSE_UNSUPPORTED_DT_CFG);
+            VDISPATCH_LNORM(
+                    IMPLICATION(utils::one_of(f16, src_data_t, dst_data_t)
+                                    || utils::one_of(
+                                            dst_data_t, f8_e5m2, f8_e4m3),
+                            compute_engine->mayiuse(
+                                    compute::device_ext_t::khr_fp16)),
                     VERBOSE_UNSUPPORTED_DT_CFG);
             VDISPATCH_LNORM(
                     !memory_desc_ndims_ok(src_md(), dst_md(), stat_md()),
@@ -39,8 +39,10 @@ __attribute__((intel_reqd_sub_group_size(SIMD))) __kernel void xe_eltwise_fwd(
     VECT_DATA_T val;
     const int nel_per_read = SIMD * VECT_DT_N;
 
+    // The tail check is uniform across the sub-group, keeping it at runtime
+    // lets problems of any size share the kernel.
     // READ
-    if (!NELEMS_OVERFLOW || offset + nel_per_read < nelems) {
+    if (offset + nel_per_read < nelems) {
         val = AS_VECT_DATA_T(VECT_BLOCK_READ(read_pos));
 
     } else {
@@ -59,7 +61,7 @@ __attribute__((intel_reqd_sub_group_size(SIMD))) __kernel void xe_eltwise_fwd(
     }
 
     // WRITE
-    if (!NELEMS_OVERFLOW || offset + nel_per_read < nelems) {
+    if (offset + nel_per_read < nelems) {
         VECT_BLOCK_WRITE(write_pos, AS_VECT_BLOCK_DATA_T(val));
 
     } else {
@@ -97,7 +99,7 @@ __attribute__((intel_reqd_sub_group_size(SIMD))) __kernel void xe_eltwise_bwd(
     const int nel_per_read = SIMD * VECT_DT_N;
 
     // READ
-    if (!NELEMS_OVERFLOW || offset + nel_per_read < nelems) {
+    if (offset + nel_per_read < nelems) {
         val_src = AS_VECT_DATA_T(VECT_BLOCK_READ(src_pos));
         val_dd = AS_VECT_DATA_T(VECT_BLOCK_READ(diff_pos));
 
@@ -118,7 +120,7 @@ __attribute__((intel_reqd_sub_group_size(SIMD))) __kernel void xe_eltwise_bwd(
     }
 
     // WRITE
-    if (!NELEMS_OVERFLOW || offset + nel_per_read < nelems) {
+    if (offset + nel_per_read < nelems) {
         VECT_BLOCK_WRITE(write_pos, AS_VECT_BLOCK_DATA_T(val_dd));
 
     } else {
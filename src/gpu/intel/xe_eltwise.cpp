@@ -56,9 +56,6 @@ status_t xe_eltwise_jit_params_t::init(impl::engine_t *engine,
     vector_size = std::min(load_size / (dt_size * sub_group_size), 8);
     work_group_size = local_threads * sub_group_size;
 
-    const int local_block_size = work_group_size * vector_size;
-    with_overflow = (data_d.nelems(true) % local_block_size) != 0;
-
     return status::success;
 }
 
@@ -72,8 +69,6 @@ compute::kernel_ctx_t xe_eltwise_jit_params_t::get_kernel_ctx() const {
 
     kernel_ctx.define_int("VECT_DT_N", vector_size);
 
-    kernel_ctx.define_int("NELEMS_OVERFLOW", with_overflow);
-
     kernel_ctx.define_int("SIMD", sub_group_size);
 
     return kernel_ctx;
@@ -52,8 +52,6 @@ struct xe_eltwise_jit_params_t
     alg_kind_t alg_kind;
     int work_group_size;
     int sub_group_size;
-    bool with_overflow;
-    uint8_t pad0[3] = {};
 };
 
 struct xe_eltwise_fwd_t : public gpu_primitive_t {
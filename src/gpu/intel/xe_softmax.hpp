@@ -55,6 +55,9 @@ struct xe_softmax_fwd_t : public gpu_primitive_t {
                     != format_tag::undef);
 
             VDISPATCH_SOFTMAX(is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_SOFTMAX(!with_attn_preprocessing(),
+                    VERBOSE_UNSUPPORTED_FEATURE,
+                    "attention scores preprocessing");
             VDISPATCH_SOFTMAX(
                     IMPLICATION(is_blocked, axis_size() % buffer_size == 0),
                     VERBOSE_BAD_AXIS);
@@ -73,7 +73,7 @@ status_t cudnn_matmul_lt_t::execute(const exec_ctx_t &ctx) const {
     CHECK(executor_->execute(ctx, ctx.stream()->engine(), matmul_impl_,
             pd()->params_, src_d, weights_d, dst_d));
 
-    if (pd()->params_->with_bias_) {
+    if (pd()->params_->with_separate_bias_) {
         // bias sycl binary
         exec_args_t binary_args;
         std::unique_ptr<memory_t, memory_deleter_t> scratch_mem;
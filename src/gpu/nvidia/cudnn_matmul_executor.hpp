@@ -245,6 +245,10 @@ protected:
             xpu::sycl::interop_memory_arg_t<scratch_m> arg_block_a_scratch,
             xpu::sycl::interop_memory_arg_t<scratch_m> arg_block_b_scratch,
             xpu::sycl::interop_memory_arg_t<scratch_m> arg_block_c_scratch,
+            xpu::sycl::interop_memory_arg_t<::sycl::access::mode::read>
+                    arg_src_scale,
+            xpu::sycl::interop_memory_arg_t<::sycl::access::mode::read>
+                    arg_wei_scale,
             xpu::sycl::interop_memory_arg_t<::sycl::access::mode::read>
                     arg_dst_scale,
             uint8_t *algo_scratch_ptr, uint8_t *bias_scratch_ptr,
@@ -280,12 +284,14 @@ protected:
                     void *src = arg_src.get_native_pointer(ih);
                     void *dst = arg_dst.get_native_pointer(ih);
 
+                    void *src_scale = arg_src_scale.get_native_pointer(ih);
+                    void *wei_scale = arg_wei_scale.get_native_pointer(ih);
                     void *dst_scale = arg_dst_scale.get_native_pointer(ih);
 
                     matmul_impl_->execute(cublas_handle, params, weights, src,
                             dst, bias, algo_scratch, reorder_scratch,
                             block_a_scratch, block_b_scratch, block_c_scratch,
-                            nullptr, nullptr, dst_scale);
+                            src_scale, wei_scale, dst_scale);
 
                     free_runtime_scratch(params->has_runtime_params_,
                             cublas_handle, cuda_stream, algo_scratch_ptr,
@@ -354,6 +360,10 @@ struct cudnn_matmul_lt_exec_t final : public cudnn_matmul_lt_base_exec_t {
             auto arg_bias = CTX_IN_SYCL_MEMORY(DNNL_ARG_BIAS);
             auto arg_dst = CTX_OUT_SYCL_MEMORY(DNNL_ARG_DST);
 
+            auto arg_src_scale
+                    = CTX_IN_SYCL_MEMORY(DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC);
+            auto arg_wei_scale = CTX_IN_SYCL_MEMORY(
+                    DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS);
             auto arg_dst_scale
                     = CTX_IN_SYCL_MEMORY(DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST);
             auto arg_algo_scratch = params->algo_scratch_size_ != 0
@@ -385,8 +395,8 @@ struct cudnn_matmul_lt_exec_t final : public cudnn_matmul_lt_base_exec_t {
             interop_task(matmul_impl_, params, engine, cgh, cuda_stream, arg_wt,
                     arg_src, arg_dst, arg_bias, arg_algo_scratch,
                     arg_bias_scratch, arg_block_a_scratch, arg_block_b_scratch,
-                    arg_block_c_scratch, arg_dst_scale, nullptr, nullptr,
-                    nullptr, nullptr, nullptr);
+                    arg_block_c_scratch, arg_src_scale, arg_wei_scale,
+                    arg_dst_scale, nullptr, nullptr, nullptr, nullptr, nullptr);
         });
     }
 
@@ -446,13 +456,18 @@ struct cudnn_matmul_lt_runtime_args_exec_t final
             auto arg_block_c_scratch = init_scratch_from_ptr(
                     matmul_params->dest_size_, block_c_scratch_ptr);
 
+            auto arg_src_scale
+                    = CTX_IN_SYCL_MEMORY(DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC);
+            auto arg_wei_scale = CTX_IN_SYCL_MEMORY(
+                    DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS);
             auto arg_dst_scale
                     = CTX_IN_SYCL_MEMORY(DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST);
 
             interop_task(matmul_impl_, matmul_params, engine, cgh, cuda_stream,
                     arg_wt, arg_src, arg_dst, arg_bias, arg_algo_scratch,
                     arg_bias_scratch, arg_block_a_scratch, arg_block_b_scratch,
-                    arg_block_c_scratch, arg_dst_scale, algo_scratch_ptr,
+                    arg_block_c_scratch, arg_src_scale, arg_wei_scale,
+                    arg_dst_scale, algo_scratch_ptr,
                     bias_scratch_ptr, block_a_scratch_ptr, block_b_scratch_ptr,
                     block_c_scratch_ptr);
         });
@@ -64,26 +64,44 @@ struct cudnn_matmul_lt_t : public gpu::primitive_t {
                 s8_case = utils::everyone_is(s8, src_dt, wei_dt)
                         && utils::one_of(dst_dt, s32);
             }
+            // FP8 kernels do not support e5m2 for both inputs.
+            bool f8_case = utils::one_of(src_dt, f8_e4m3, f8_e5m2)
+                    && utils::one_of(wei_dt, f8_e4m3, f8_e5m2)
+                    && !utils::everyone_is(f8_e5m2, src_dt, wei_dt)
+                    && utils::one_of(dst_dt, f16, bf16);
             auto *sycl_engine_impl
                     = utils::downcast<const xpu::sycl::engine_impl_t *>(
                             engine->impl());
 
             bool is_eltwise_ok = eltwise_ok();
 
+            // FP8 kernels require the weights to be transposed.
+            if (f8_case && weights_md_.format_kind == format_kind::any) {
+                CHECK(memory_desc_init_by_tag(weights_md_,
+                        batched() ? format_tag::acb : format_tag::ba));
+            }
+
             bool ok = is_dense_format_kind()
                     && attr()->has_default_values(smask_t::scales)
                     // src & weights scaling is not supported as this implementation uses integer types
                     // for the compute type, but the scales are floating point numbers
-                    && attr()->scales_.get(DNNL_ARG_SRC).has_default_values()
-                    && attr()->scales_.get(DNNL_ARG_WEIGHTS)
-                               .has_default_values()
+                    && IMPLICATION(!f8_case,
+                            attr()->scales_.get(DNNL_ARG_SRC)
+                                            .has_default_values()
+                                    && attr()->scales_.get(DNNL_ARG_WEIGHTS)
+                                               .has_default_values())
+                    // FP8 kernels apply per-tensor f32 scales of the inputs
+                    && IMPLICATION(f8_case, f8_scales_ok())
                     && attr_post_ops_ok(attr())
                     && IMPLICATION(bf16_case,
                             has_bf16_support(sycl_engine_impl->device()))
+                    && IMPLICATION(f8_case,
+                            has_fp8_support(sycl_engine_impl->device()))
                     && (s8_case ? set_default_formats_lt()
                                 : (set_default_formats() && blocking_ok()))
                     && tags_ok()
-                    && (f32_case || f16_case || bf16_case || s8_case)
+                    && (f32_case || f16_case || bf16_case || s8_case
+                            || f8_case)
                     && IMPLICATION(with_bias(),
                             (IMPLICATION(f32_case, utils::one_of(bia_dt, f32))
                                     && IMPLICATION(f16_case,
@@ -110,7 +128,7 @@ struct cudnn_matmul_lt_t : public gpu::primitive_t {
                     && is_eltwise_ok;
             if (!ok) return status::unimplemented;
 
-            if (!with_bias() && !with_eltwise() && !s8_case) {
+            if (!with_bias() && !with_eltwise() && !s8_case && !f8_case) {
                 return status::unimplemented;
             }
             if (s8_case && with_eltwise() && is_eltwise_ok) {
@@ -277,6 +295,16 @@ struct cudnn_matmul_lt_t : public gpu::primitive_t {
             return src_scales_ok && wei_scales_ok;
         }
 
+        bool f8_scales_ok() const {
+            for (int arg : {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS}) {
+                if (default_scale(arg)) continue;
+                if (!single_scale(arg)
+                        || attr()->scales_.get_data_type(arg) != data_type::f32)
+                    return false;
+            }
+            return true;
+        }
+
         bool dst_ok() {
             bool ok = false;
 
@@ -348,9 +376,12 @@ struct cudnn_matmul_lt_t : public gpu::primitive_t {
             if (!with_eltwise()) { return true; }
 
             int eltwise_idx_ = attr()->post_ops_.find(primitive_kind::eltwise);
-            auto eltwise_algo
-                    = attr()->post_ops_.entry_[eltwise_idx_].eltwise.alg;
-            if (eltwise_algo == alg_kind::eltwise_relu) { return true; }
+            const auto &eltwise
+                    = attr()->post_ops_.entry_[eltwise_idx_].eltwise;
+            if (eltwise.alg == alg_kind::eltwise_relu) { return true; }
+            if (eltwise.alg == alg_kind::eltwise_gelu_tanh) {
+                return eltwise.scale == 1.f;
+            }
             return false;
         }
 
@@ -443,7 +474,8 @@ struct cudnn_matmul_lt_t : public gpu::primitive_t {
             matmul_impl_->set_non_runtime_params(pd()->params_);
         }
 
-        if (pd()->params_->with_bias_) {
+        // A bias applied in the epilogue needs no separate binary.
+        if (pd()->params_->with_separate_bias_) {
             CHECK(create_nested_primitive(binary_, pd()->binary_pd_, engine));
         }
 
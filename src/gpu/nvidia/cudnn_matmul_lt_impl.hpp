@@ -64,6 +64,9 @@ struct cublas_lt_params : cublas_base_params {
 
         // Initialise flags and variables for the imma case (E.g. imma_case_ flag).
         check_imma_case(src_d, weights_d, dst_d);
+        fp8_case_ = utils::one_of(src_d.data_type(), dnnl_f8_e4m3, dnnl_f8_e5m2)
+                && utils::one_of(
+                        weights_d.data_type(), dnnl_f8_e4m3, dnnl_f8_e5m2);
 
         with_bias_ = with_bias;
 
@@ -110,25 +113,34 @@ struct cublas_lt_params : cublas_base_params {
                 return status::unimplemented;
             } else {
                 with_relu_ = eltwise_algo(attr) == alg_kind::eltwise_relu;
-                if (!with_relu_ || dst_row_major || with_separate_bias_) {
+                // The GELU epilogue implements the tanh approximation.
+                with_gelu_
+                        = eltwise_algo(attr) == alg_kind::eltwise_gelu_tanh;
+                if (!(with_relu_ || with_gelu_) || dst_row_major
+                        || with_separate_bias_) {
                     with_separate_eltwise_ = true;
                 }
             }
         }
         with_relu_epilogue_ = with_relu_ && !with_separate_eltwise_;
+        with_gelu_epilogue_ = with_gelu_ && !with_separate_eltwise_;
 
         // Separate activation is not supported and separate bias in non-imma case not supported.
         if ((with_separate_bias_ && !imma_case_) || with_separate_eltwise_) {
             return status::unimplemented;
         }
 
-        // CublasLt is only used for the IMMA case and when the bias and relu are used in the epilogue
-        if (!imma_case_ && !with_relu_epilogue_ && !with_bias_epilogue_) {
+        // CublasLt is only used for the IMMA and FP8 cases and when the bias
+        // and activations are used in the epilogue
+        if (!imma_case_ && !fp8_case_ && !with_relu_epilogue_
+                && !with_gelu_epilogue_ && !with_bias_epilogue_) {
             return status::unimplemented;
         }
 
         // Imma case only supports default epilogue
-        if (imma_case_ && with_relu_epilogue_) { return status::unimplemented; }
+        if (imma_case_ && (with_relu_epilogue_ || with_gelu_epilogue_)) {
+            return status::unimplemented;
+        }
 
         // we use separate bias to support imma case
         if (imma_case_ && with_bias_epilogue_) {
@@ -139,7 +151,7 @@ struct cublas_lt_params : cublas_base_params {
         // if dst case is single value but we have post ops
         if (with_dst_scale_
                 && (with_bias_epilogue_ || with_separate_bias_
-                        || with_relu_epilogue_)) {
+                        || with_relu_epilogue_ || with_gelu_epilogue_)) {
             multi_dst_scale_ = true;
         }
 
@@ -183,6 +195,8 @@ struct cublas_lt_params : cublas_base_params {
         reorder_required_ = other->reorder_required_;
         with_bias_epilogue_ = other->with_bias_epilogue_;
         with_relu_epilogue_ = other->with_relu_epilogue_;
+        with_gelu_epilogue_ = other->with_gelu_epilogue_;
+        fp8_case_ = other->fp8_case_;
         imma_ampere_case_ = other->imma_ampere_case_;
         imma_plain_case_ = other->imma_plain_case_;
         alpha_beta_size_bytes_ = other->alpha_beta_size_bytes_;
@@ -199,6 +213,13 @@ struct cublas_lt_params : cublas_base_params {
         N_ = static_cast<uint64_t>(dst_d.dims()[isbatched_ + 0]);
         K_ = static_cast<uint64_t>(src_d.dims()[isbatched_ + 1]);
 
+        // FP8 kernels only support the TN configuration: transposed weights
+        // and non-transposed src.
+        if (fp8_case_
+                && (is_md_col_major(weights_d) || !is_md_col_major(src_d))) {
+            return status::unimplemented;
+        }
+
         if (imma_case_) {
             w_blocked_ = is_md_col32(weights_d);
             dst_blocked_ = is_md_col32(dst_d);
@@ -286,7 +307,7 @@ struct cublas_lt_params : cublas_base_params {
         auto dst_dt = dst_d.data_type();
         if (imma_case_ && reorder_required_) { dst_dt = dnnl_s32; }
 
-        if (dst_dt == dnnl_s8 || dst_dt == dnnl_bf16) {
+        if (dst_dt == dnnl_s8 || dst_dt == dnnl_bf16 || fp8_case_) {
             CHECK(get_cublas_data_type(dnnl_f32, acc_type_));
         } else {
             CHECK(get_cublas_data_type(dst_dt, acc_type_));
@@ -605,6 +626,9 @@ struct cublas_lt_params : cublas_base_params {
     bool with_bias_epilogue_ = false;
     bool with_relu_;
     bool with_relu_epilogue_ = false;
+    bool with_gelu_ = false;
+    bool with_gelu_epilogue_ = false;
+    bool fp8_case_ = false;
     bool imma_case_ = false;
     bool imma_ampere_case_ = false;
     bool imma_plain_case_ = false;
@@ -648,8 +672,8 @@ struct cudnn_matmul_lt_impl_t {
             const std::shared_ptr<cublas_lt_params> matmul_params, void *a,
             void *b, void *c, void *bias, void *algo_scratch,
             void *reorder_scratch, void *block_a_scratch, void *block_b_scratch,
-            void *block_c_scratch, void * /* src_scale */,
-            void * /* wei_scale */, void *dst_scale) {
+            void *block_c_scratch, void *src_scale, void *wei_scale,
+            void *dst_scale) {
 
         cudaStream_t cuda_stream;
         CUBLAS_EXECUTE_FUNC(cublasGetStream, cublas_handle, &cuda_stream);
@@ -690,23 +714,39 @@ struct cudnn_matmul_lt_impl_t {
         cublasLtEpilogue_t epilogue = CUBLASLT_EPILOGUE_DEFAULT;
         auto with_bias_epilogue = params->with_bias_epilogue_;
         auto with_relu_epilogue = params->with_relu_epilogue_;
+        auto with_gelu_epilogue = params->with_gelu_epilogue_;
 
         auto operation_desc = params->operation_desc_;
 
         if (with_bias_epilogue) {
             if (with_relu_epilogue) {
                 epilogue = CUBLASLT_EPILOGUE_RELU_BIAS;
+            } else if (with_gelu_epilogue) {
+                epilogue = CUBLASLT_EPILOGUE_GELU_BIAS;
             } else {
                 epilogue = CUBLASLT_EPILOGUE_BIAS;
             }
             CUBLAS_EXECUTE_FUNC(cublasLtMatmulDescSetAttribute, operation_desc,
                     CUBLASLT_MATMUL_DESC_BIAS_POINTER, &bias, sizeof(bias));
-        } else if (with_relu_epilogue && !with_bias_epilogue) {
+        } else if (with_relu_epilogue) {
             epilogue = CUBLASLT_EPILOGUE_RELU;
+        } else if (with_gelu_epilogue) {
+            epilogue = CUBLASLT_EPILOGUE_GELU;
         }
         CUBLAS_EXECUTE_FUNC(cublasLtMatmulDescSetAttribute, operation_desc,
                 CUBLASLT_MATMUL_DESC_EPILOGUE, &epilogue, sizeof(epilogue));
 
+        if (params->fp8_case_) {
+            // Per-tensor scales of the inputs are applied by the FP8 kernels
+            // from device memory, a null pointer standing for no scaling.
+            CUBLAS_EXECUTE_FUNC(cublasLtMatmulDescSetAttribute, operation_desc,
+                    CUBLASLT_MATMUL_DESC_A_SCALE_POINTER, &wei_scale,
+                    sizeof(wei_scale));
+            CUBLAS_EXECUTE_FUNC(cublasLtMatmulDescSetAttribute, operation_desc,
+                    CUBLASLT_MATMUL_DESC_B_SCALE_POINTER, &src_scale,
+                    sizeof(src_scale));
+        }
+
         float scale = 1.0f;
         float host_dst_scale = 1.0f;
         if (dst_scale && !params->multi_dst_scale_ && acc_type != CUDA_R_32I) {
@@ -0,0 +1,74 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gpu/nvidia/cudnn_sdpa.hpp"
+#include "gpu/nvidia/stream.hpp"
+#include "gpu/nvidia/sycl_cuda_scoped_context.hpp"
+#include "xpu/sycl/buffer_memory_storage.hpp"
+#include "xpu/sycl/memory_storage_helper.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace nvidia {
+
+status_t cudnn_sdpa_fwd_t::execute(const exec_ctx_t &ctx) const {
+    if (pd()->has_zero_dim_memory()) return status::success;
+
+    nvidia::stream_t *cuda_stream
+            = utils::downcast<nvidia::stream_t *>(ctx.stream());
+
+    return cuda_stream->interop_task([&](::sycl::handler &cgh) {
+        auto arg_q = CTX_IN_SYCL_MEMORY(DNNL_ARG_QUERIES);
+        auto arg_k = CTX_IN_SYCL_MEMORY(DNNL_ARG_KEYS);
+        auto arg_v = CTX_IN_SYCL_MEMORY(DNNL_ARG_VALUES);
+        auto arg_scale = CTX_IN_SYCL_MEMORY(DNNL_ARG_SCALE);
+        auto arg_mask = CTX_IN_SYCL_MEMORY(DNNL_ARG_ATTN_MASK);
+        auto arg_dst = CTX_OUT_SYCL_MEMORY(DNNL_ARG_DST);
+        auto arg_ws = CTX_SCRATCH_SYCL_MEMORY(
+                memory_tracking::names::key_sdpa_cudnn_workspace);
+
+        compat::host_task(cgh, [=, this](const compat::interop_handle &ih) {
+            auto &sycl_engine = *utils::downcast<nvidia::engine_t *>(
+                    cuda_stream->engine());
+            auto sc = cuda_sycl_scoped_context_handler_t(sycl_engine);
+            auto handle = cuda_stream->get_cudnn_handle();
+
+            // Arguments in the order of cudnn_sdpa_impl_t::arg_t.
+            std::vector<void *> args;
+            args.push_back(arg_q.get_native_pointer(ih));
+            args.push_back(arg_k.get_native_pointer(ih));
+            args.push_back(arg_v.get_native_pointer(ih));
+            args.push_back(arg_dst.get_native_pointer(ih));
+            args.push_back(pd()->with_attn_scale()
+                            ? arg_scale.get_native_pointer(ih)
+                            : nullptr);
+            args.push_back(pd()->with_attn_mask()
+                            ? arg_mask.get_native_pointer(ih)
+                            : nullptr);
+            args.push_back(pd()->sdpa_impl_->workspace_size() > 0
+                            ? arg_ws.get_native_pointer(ih)
+                            : nullptr);
+
+            pd()->sdpa_impl_->execute(handle, args.data());
+        });
+    });
+}
+
+} // namespace nvidia
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GPU_NVIDIA_CUDNN_SDPA_HPP
+#define GPU_NVIDIA_CUDNN_SDPA_HPP
+
+#include "cudnn.h"
+
+#include "common/sdpa_pd.hpp"
+#include "gpu/gpu_primitive.hpp"
+#include "gpu/nvidia/cudnn_sdpa_impl.hpp"
+#include "gpu/nvidia/engine.hpp"
+#include "gpu/nvidia/sycl_cuda_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace nvidia {
+
+struct cudnn_sdpa_fwd_t : public gpu::primitive_t {
+    using gpu::primitive_t::primitive_t;
+
+    struct pd_t : public sdpa_pd_t {
+        using sdpa_pd_t::sdpa_pd_t;
+
+        DECLARE_COMMON_PD_T("cuda:cudnn:any", cudnn_sdpa_fwd_t);
+
+        status_t init(impl::engine_t *engine) {
+            using namespace data_type;
+
+            auto sycl_dev
+                    = utils::downcast<nvidia::engine_t *>(engine)->device();
+            const auto dt = qry_md()->data_type;
+
+            VDISPATCH_SDPA(desc()->prop_kind == prop_kind::forward_inference,
+                    VERBOSE_BAD_PROPKIND);
+            VDISPATCH_SDPA(!with_score_mods(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "score modifiers");
+            VDISPATCH_SDPA(!with_key_scales() && !with_value_scales()
+                            && !with_key_zp() && !with_value_zp(),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_SDPA(attr()->has_default_values(),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_SDPA(utils::one_of(dt, f16, bf16)
+                            && utils::everyone_is(dt, key_md()->data_type,
+                                    val_md()->data_type, dst_md()->data_type),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_SDPA(IMPLICATION(dt == bf16, has_bf16_support(sycl_dev)),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_SDPA(IMPLICATION(with_attn_mask(),
+                                   utils::one_of(attn_mask_md()->data_type,
+                                           f32, f16, bf16)),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_SDPA(IMPLICATION(with_attn_scale(),
+                                   utils::one_of(
+                                           desc()->scale_dt, f32, f16, bf16)),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_SDPA(
+                    utils::everyone_is(4, qry_md()->ndims, key_md()->ndims,
+                            val_md()->ndims, dst_md()->ndims)
+                            && IMPLICATION(with_attn_mask(),
+                                    attn_mask_md()->ndims == 4),
+                    VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_SDPA(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_SDPA(memory_desc_wrapper(qry_md()).is_plain()
+                            && memory_desc_wrapper(key_md()).is_plain()
+                            && memory_desc_wrapper(val_md()).is_plain()
+                            && memory_desc_wrapper(dst_md()).is_plain()
+                            && IMPLICATION(with_attn_mask(),
+                                    memory_desc_wrapper(attn_mask_md())
+                                            .is_plain()),
+                    VERBOSE_UNSUPPORTED_TAG);
+
+            // Grouped-query attention, with fewer key-value heads than query
+            // heads, is only handled by the fused engine of recent cuDNN.
+            const dim_t q_heads = qry_md()->dims[1];
+            const dim_t kv_heads = key_md()->dims[1];
+            VDISPATCH_SDPA(kv_heads == val_md()->dims[1]
+                            && q_heads % kv_heads == 0
+                            && IMPLICATION(kv_heads != q_heads,
+                                    cudnnGetVersion() >= 8907),
+                    VERBOSE_INCONSISTENT_DIM, "key", 1, "query", 1);
+
+            sdpa_impl_.reset(new cudnn_sdpa_impl_t());
+            return sdpa_impl_->init(engine, this);
+        }
+
+        std::shared_ptr<cudnn_sdpa_impl_t> sdpa_impl_;
+    };
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace nvidia
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,443 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GPU_NVIDIA_CUDNN_SDPA_IMPL_HPP
+#define GPU_NVIDIA_CUDNN_SDPA_IMPL_HPP
+
+#include <limits>
+#include <vector>
+
+#include "cudnn.h"
+
+#include "common/sdpa_pd.hpp"
+#include "gpu/nvidia/engine.hpp"
+#include "gpu/nvidia/stream.hpp"
+#include "gpu/nvidia/sycl_cuda_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace nvidia {
+
+// Scaled dot-product attention expressed as a cuDNN operation graph:
+//
+//   S = Q x K, S = S * scale (or / scale), S = S + mask or causal select,
+//   P = softmax(S) built from reductions and pointwise ops, O = P x V.
+//
+// cuDNN recognizes the pattern and maps it to its fused flash-attention
+// engine, so the scores never leave the chip. The graph and the execution
+// plan are built once, at primitive descriptor creation.
+struct cudnn_sdpa_impl_t {
+    // Unique ids of the tensors passed through the variant pack.
+    enum uid_t : int64_t {
+        uid_q = 1,
+        uid_k,
+        uid_v,
+        uid_o,
+        uid_scale,
+        uid_mask,
+        uid_neg_inf,
+        uid_diag_shift,
+        uid_virtual, // First id of the intermediate tensors.
+    };
+
+    // Indices of the execute() arguments.
+    enum arg_t { arg_q, arg_k, arg_v, arg_o, arg_scale, arg_mask, arg_ws };
+
+    cudnn_sdpa_impl_t() = default;
+    cudnn_sdpa_impl_t(const cudnn_sdpa_impl_t &) = delete;
+    cudnn_sdpa_impl_t &operator=(const cudnn_sdpa_impl_t &) = delete;
+
+    ~cudnn_sdpa_impl_t() {
+        // Destroy in reverse order of creation, the plan goes first.
+        for (auto it = descs_.rbegin(); it != descs_.rend(); ++it)
+            CUDNN_CHECK_V(cudnnBackendDestroyDescriptor(*it));
+    }
+
+    status_t init(impl::engine_t *engine, sdpa_pd_t *pd) {
+        const auto *desc = pd->desc();
+        CHECK(convert_data_type(pd->qry_md(), &data_type_));
+
+        const memory_desc_wrapper q_d(pd->qry_md());
+        const memory_desc_wrapper k_d(pd->key_md());
+        const memory_desc_wrapper v_d(pd->val_md());
+        const memory_desc_wrapper o_d(pd->dst_md());
+
+        const dim_t mb = o_d.dims()[0];
+        const dim_t heads = o_d.dims()[1];
+        const dim_t queries = desc->queries();
+        const dim_t keys = desc->keys();
+        const dims4_t s_dims = {mb, heads, queries, keys};
+        const dims4_t r_dims = {mb, heads, queries, 1};
+
+        cudnnBackendDescriptor_t q, k, v, o;
+        CHECK(create_tensor(q, uid_q, data_type_, q_d));
+        CHECK(create_tensor(k, uid_k, data_type_, k_d));
+        CHECK(create_tensor(v, uid_v, data_type_, v_d));
+        CHECK(create_tensor(o, uid_o, data_type_, o_d));
+
+        // S = Q x K, accumulated in f32.
+        cudnnBackendDescriptor_t s;
+        CHECK(create_virtual(s, s_dims, CUDNN_DATA_FLOAT));
+        CHECK(add_matmul(q, k, s));
+
+        if (pd->with_attn_scale()) {
+            cudnnDataType_t scale_dt;
+            memory_desc_t scale_md = {};
+            scale_md.data_type = desc->scale_dt;
+            CHECK(convert_data_type(&scale_md, &scale_dt));
+            cudnnBackendDescriptor_t scale, scaled;
+            CHECK(create_tensor(scale, uid_scale, scale_dt, {1, 1, 1, 1},
+                    {1, 1, 1, 1}));
+            CHECK(create_virtual(scaled, s_dims, CUDNN_DATA_FLOAT));
+            CHECK(add_pointwise(desc->invert_scale ? CUDNN_POINTWISE_DIV
+                                                   : CUDNN_POINTWISE_MUL,
+                    s, scale, scaled));
+            s = scaled;
+        }
+
+        if (pd->with_attn_mask()) {
+            const memory_desc_wrapper m_d(pd->attn_mask_md());
+            cudnnDataType_t mask_dt;
+            CHECK(convert_data_type(pd->attn_mask_md(), &mask_dt));
+            cudnnBackendDescriptor_t mask, masked;
+            CHECK(create_tensor(mask, uid_mask, mask_dt, m_d));
+            CHECK(create_virtual(masked, s_dims, CUDNN_DATA_FLOAT));
+            CHECK(add_pointwise(CUDNN_POINTWISE_ADD, s, mask, masked));
+            s = masked;
+        }
+
+        if (pd->with_causal_mask()) CHECK(add_causal_mask(pd, s, s_dims));
+
+        // Numerically stable softmax along the keys.
+        cudnnBackendDescriptor_t max, sub, exp, sum, p;
+        CHECK(create_virtual(max, r_dims, CUDNN_DATA_FLOAT));
+        CHECK(add_reduction(CUDNN_REDUCE_TENSOR_MAX, s, max));
+        CHECK(create_virtual(sub, s_dims, CUDNN_DATA_FLOAT));
+        CHECK(add_pointwise(CUDNN_POINTWISE_SUB, s, max, sub));
+        CHECK(create_virtual(exp, s_dims, CUDNN_DATA_FLOAT));
+        CHECK(add_pointwise(CUDNN_POINTWISE_EXP, sub, nullptr, exp));
+        CHECK(create_virtual(sum, r_dims, CUDNN_DATA_FLOAT));
+        CHECK(add_reduction(CUDNN_REDUCE_TENSOR_ADD, exp, sum));
+        // The probabilities are converted to the input type for the second
+        // matmul, as the fused engine expects.
+        CHECK(create_virtual(p, s_dims, data_type_));
+        CHECK(add_pointwise(CUDNN_POINTWISE_DIV, exp, sum, p));
+
+        // O = P x V.
+        CHECK(add_matmul(p, v, o));
+
+        auto &sycl_engine = *utils::downcast<nvidia::engine_t *>(engine);
+        impl::stream_t *service_stream;
+        CHECK(sycl_engine.get_service_stream(service_stream));
+        auto cuda_stream = utils::downcast<nvidia::stream_t *>(service_stream);
+        auto handle = cuda_stream->get_cudnn_handle();
+
+        CHECK(create_plan(handle));
+        if (workspace_size_ > 0) {
+            pd->scratchpad_registry().registrar().book(
+                    memory_tracking::names::key_sdpa_cudnn_workspace,
+                    workspace_size_, size_t(1));
+        }
+        return status::success;
+    }
+
+    size_t workspace_size() const { return workspace_size_; }
+
+    void execute(cudnnHandle_t handle, void **args) const {
+        std::vector<int64_t> uids = {uid_q, uid_k, uid_v, uid_o};
+        std::vector<void *> ptrs
+                = {args[arg_q], args[arg_k], args[arg_v], args[arg_o]};
+        if (args[arg_scale]) {
+            uids.push_back(uid_scale);
+            ptrs.push_back(args[arg_scale]);
+        }
+        if (args[arg_mask]) {
+            uids.push_back(uid_mask);
+            ptrs.push_back(args[arg_mask]);
+        }
+        // By-value scalars are read from the host when the plan is executed.
+        float neg_inf = -std::numeric_limits<float>::infinity();
+        int32_t diag_shift = diag_shift_;
+        if (with_causal_mask_) {
+            uids.push_back(uid_neg_inf);
+            ptrs.push_back(&neg_inf);
+            uids.push_back(uid_diag_shift);
+            ptrs.push_back(&diag_shift);
+        }
+        void *workspace = args[arg_ws];
+
+        cudnnBackendDescriptor_t variant_pack;
+        CUDNN_EXECUTE_FUNC(cudnnBackendCreateDescriptor,
+                CUDNN_BACKEND_VARIANT_PACK_DESCRIPTOR, &variant_pack);
+        CUDNN_EXECUTE_FUNC(cudnnBackendSetAttribute, variant_pack,
+                CUDNN_ATTR_VARIANT_PACK_UNIQUE_IDS, CUDNN_TYPE_INT64,
+                (int64_t)uids.size(), uids.data());
+        CUDNN_EXECUTE_FUNC(cudnnBackendSetAttribute, variant_pack,
+                CUDNN_ATTR_VARIANT_PACK_DATA_POINTERS, CUDNN_TYPE_VOID_PTR,
+                (int64_t)ptrs.size(), ptrs.data());
+        CUDNN_EXECUTE_FUNC(cudnnBackendSetAttribute, variant_pack,
+                CUDNN_ATTR_VARIANT_PACK_WORKSPACE, CUDNN_TYPE_VOID_PTR, 1,
+                &workspace);
+        CUDNN_EXECUTE_FUNC(cudnnBackendFinalize, variant_pack);
+        CUDNN_EXECUTE_FUNC(cudnnBackendExecute, handle, plan_, variant_pack);
+        CUDNN_EXECUTE_FUNC(cudnnBackendDestroyDescriptor, variant_pack);
+    }
+
+private:
+    using dims4_t = std::vector<int64_t>;
+
+    status_t create_desc(cudnnBackendDescriptorType_t type,
+            cudnnBackendDescriptor_t &desc) {
+        CHECK(CUDNN_EXECUTE_FUNC_S(cudnnBackendCreateDescriptor, type, &desc));
+        descs_.push_back(desc);
+        return status::success;
+    }
+
+    template <typename T>
+    status_t set_attr(cudnnBackendDescriptor_t desc,
+            cudnnBackendAttributeName_t name, cudnnBackendAttributeType_t type,
+            int64_t count, const T *values) {
+        return CUDNN_EXECUTE_FUNC_S(
+                cudnnBackendSetAttribute, desc, name, type, count, values);
+    }
+
+    status_t create_tensor(cudnnBackendDescriptor_t &desc, int64_t uid,
+            cudnnDataType_t dt, const dims4_t &dims, const dims4_t &strides,
+            bool is_virtual = false, bool by_value = false) {
+        const int64_t alignment = 16;
+        CHECK(create_desc(CUDNN_BACKEND_TENSOR_DESCRIPTOR, desc));
+        CHECK(set_attr(desc, CUDNN_ATTR_TENSOR_DATA_TYPE,
+                CUDNN_TYPE_DATA_TYPE, 1, &dt));
+        CHECK(set_attr(desc, CUDNN_ATTR_TENSOR_DIMENSIONS, CUDNN_TYPE_INT64,
+                (int64_t)dims.size(), dims.data()));
+        CHECK(set_attr(desc, CUDNN_ATTR_TENSOR_STRIDES, CUDNN_TYPE_INT64,
+                (int64_t)strides.size(), strides.data()));
+        CHECK(set_attr(
+                desc, CUDNN_ATTR_TENSOR_UNIQUE_ID, CUDNN_TYPE_INT64, 1, &uid));
+        CHECK(set_attr(desc, CUDNN_ATTR_TENSOR_BYTE_ALIGNMENT,
+                CUDNN_TYPE_INT64, 1, &alignment));
+        CHECK(set_attr(desc, CUDNN_ATTR_TENSOR_IS_VIRTUAL, CUDNN_TYPE_BOOLEAN,
+                1, &is_virtual));
+        if (by_value)
+            CHECK(set_attr(desc, CUDNN_ATTR_TENSOR_IS_BY_VALUE,
+                    CUDNN_TYPE_BOOLEAN, 1, &by_value));
+        return CUDNN_EXECUTE_FUNC_S(cudnnBackendFinalize, desc);
+    }
+
+    status_t create_tensor(cudnnBackendDescriptor_t &desc, int64_t uid,
+            cudnnDataType_t dt, const memory_desc_wrapper &mdw) {
+        dims4_t dims(mdw.dims(), mdw.dims() + mdw.ndims());
+        const auto &s = mdw.blocking_desc().strides;
+        dims4_t strides(s, s + mdw.ndims());
+        return create_tensor(desc, uid, dt, dims, strides);
+    }
+
+    status_t create_virtual(cudnnBackendDescriptor_t &desc,
+            const dims4_t &dims, cudnnDataType_t dt) {
+        dims4_t strides(dims.size(), 1);
+        for (int i = (int)dims.size() - 2; i >= 0; i--)
+            strides[i] = strides[i + 1] * dims[i + 1];
+        return create_tensor(desc, next_uid_++, dt, dims, strides, true);
+    }
+
+    status_t add_op(cudnnBackendDescriptor_t op) {
+        CHECK(CUDNN_EXECUTE_FUNC_S(cudnnBackendFinalize, op));
+        ops_.push_back(op);
+        return status::success;
+    }
+
+    status_t add_matmul(cudnnBackendDescriptor_t a, cudnnBackendDescriptor_t b,
+            cudnnBackendDescriptor_t c) {
+        const cudnnDataType_t comp_dt = CUDNN_DATA_FLOAT;
+        cudnnBackendDescriptor_t mm, op;
+        CHECK(create_desc(CUDNN_BACKEND_MATMUL_DESCRIPTOR, mm));
+        CHECK(set_attr(mm, CUDNN_ATTR_MATMUL_COMP_TYPE, CUDNN_TYPE_DATA_TYPE,
+                1, &comp_dt));
+        CHECK(CUDNN_EXECUTE_FUNC_S(cudnnBackendFinalize, mm));
+
+        CHECK(create_desc(CUDNN_BACKEND_OPERATION_MATMUL_DESCRIPTOR, op));
+        CHECK(set_attr(op, CUDNN_ATTR_OPERATION_MATMUL_ADESC,
+                CUDNN_TYPE_BACKEND_DESCRIPTOR, 1, &a));
+        CHECK(set_attr(op, CUDNN_ATTR_OPERATION_MATMUL_BDESC,
+                CUDNN_TYPE_BACKEND_DESCRIPTOR, 1, &b));
+        CHECK(set_attr(op, CUDNN_ATTR_OPERATION_MATMUL_CDESC,
+                CUDNN_TYPE_BACKEND_DESCRIPTOR, 1, &c));
+        CHECK(set_attr(op, CUDNN_ATTR_OPERATION_MATMUL_DESC,
+                CUDNN_TYPE_BACKEND_DESCRIPTOR, 1, &mm));
+        return add_op(op);
+    }
+
+    // y = x <mode> b, or y = t ? x : b for the binary select.
+    status_t add_pointwise(cudnnPointwiseMode_t mode,
+            cudnnBackendDescriptor_t x, cudnnBackendDescriptor_t b,
+            cudnnBackendDescriptor_t y, cudnnBackendDescriptor_t t = nullptr,
+            int64_t axis = -1) {
+        const cudnnDataType_t comp_dt = CUDNN_DATA_FLOAT;
+        cudnnBackendDescriptor_t pw, op;
+        CHECK(create_desc(CUDNN_BACKEND_POINTWISE_DESCRIPTOR, pw));
+        CHECK(set_attr(
+                pw, CUDNN_ATTR_POINTWISE_MODE, CUDNN_TYPE_POINTWISE_MODE, 1,
+                &mode));
+        CHECK(set_attr(pw, CUDNN_ATTR_POINTWISE_MATH_PREC,
+                CUDNN_TYPE_DATA_TYPE, 1, &comp_dt));
+        if (axis >= 0)
+            CHECK(set_attr(pw, CUDNN_ATTR_POINTWISE_AXIS, CUDNN_TYPE_INT64, 1,
+                    &axis));
+        CHECK(CUDNN_EXECUTE_FUNC_S(cudnnBackendFinalize, pw));
+
+        CHECK(create_desc(CUDNN_BACKEND_OPERATION_POINTWISE_DESCRIPTOR, op));
+        CHECK(set_attr(op, CUDNN_ATTR_OPERATION_POINTWISE_PW_DESCRIPTOR,
+                CUDNN_TYPE_BACKEND_DESCRIPTOR, 1, &pw));
+        CHECK(set_attr(op, CUDNN_ATTR_OPERATION_POINTWISE_XDESC,
+                CUDNN_TYPE_BACKEND_DESCRIPTOR, 1, &x));
+        if (b)
+            CHECK(set_attr(op, CUDNN_ATTR_OPERATION_POINTWISE_BDESC,
+                    CUDNN_TYPE_BACKEND_DESCRIPTOR, 1, &b));
+        if (t)
+            CHECK(set_attr(op, CUDNN_ATTR_OPERATION_POINTWISE_TDESC,
+                    CUDNN_TYPE_BACKEND_DESCRIPTOR, 1, &t));
+        CHECK(set_attr(op, CUDNN_ATTR_OPERATION_POINTWISE_YDESC,
+                CUDNN_TYPE_BACKEND_DESCRIPTOR, 1, &y));
+        return add_op(op);
+    }
+
+    status_t add_reduction(cudnnReduceTensorOp_t mode,
+            cudnnBackendDescriptor_t x, cudnnBackendDescriptor_t y) {
+        const cudnnDataType_t comp_dt = CUDNN_DATA_FLOAT;
+        cudnnBackendDescriptor_t red, op;
+        CHECK(create_desc(CUDNN_BACKEND_REDUCTION_DESCRIPTOR, red));
+        CHECK(set_attr(red, CUDNN_ATTR_REDUCTION_OPERATOR,
+                CUDNN_TYPE_REDUCTION_OPERATOR_TYPE, 1, &mode));
+        CHECK(set_attr(red, CUDNN_ATTR_REDUCTION_COMP_TYPE,
+                CUDNN_TYPE_DATA_TYPE, 1, &comp_dt));
+        CHECK(CUDNN_EXECUTE_FUNC_S(cudnnBackendFinalize, red));
+
+        CHECK(create_desc(CUDNN_BACKEND_OPERATION_REDUCTION_DESCRIPTOR, op));
+        CHECK(set_attr(op, CUDNN_ATTR_OPERATION_REDUCTION_XDESC,
+                CUDNN_TYPE_BACKEND_DESCRIPTOR, 1, &x));
+        CHECK(set_attr(op, CUDNN_ATTR_OPERATION_REDUCTION_YDESC,
+                CUDNN_TYPE_BACKEND_DESCRIPTOR, 1, &y));
+        CHECK(set_attr(op, CUDNN_ATTR_OPERATION_REDUCTION_DESC,
+                CUDNN_TYPE_BACKEND_DESCRIPTOR, 1, &red));
+        return add_op(op);
+    }
+
+    // Keeps the scores of the keys at or before the diagonal and replaces the
+    // others with -inf. The diagonal of a bottom-right mask is shifted by the
+    // difference between the number of keys and queries.
+    status_t add_causal_mask(const sdpa_pd_t *pd, cudnnBackendDescriptor_t &s,
+            const dims4_t &s_dims) {
+        with_causal_mask_ = true;
+        diag_shift_ = pd->desc()->mask_type == attn_mask_type::bottom_right
+                ? (int32_t)(pd->desc()->keys() - pd->desc()->queries())
+                : 0;
+
+        cudnnBackendDescriptor_t row, col, shifted, keep, neg_inf, shift,
+                masked;
+        CHECK(create_virtual(row, s_dims, CUDNN_DATA_INT32));
+        CHECK(add_pointwise(CUDNN_POINTWISE_GEN_INDEX, s, nullptr, row,
+                nullptr, 2));
+        CHECK(create_virtual(col, s_dims, CUDNN_DATA_INT32));
+        CHECK(add_pointwise(CUDNN_POINTWISE_GEN_INDEX, s, nullptr, col,
+                nullptr, 3));
+
+        CHECK(create_tensor(shift, uid_diag_shift, CUDNN_DATA_INT32,
+                {1, 1, 1, 1}, {1, 1, 1, 1}, false, true));
+        CHECK(create_virtual(shifted, s_dims, CUDNN_DATA_INT32));
+        CHECK(add_pointwise(CUDNN_POINTWISE_ADD, row, shift, shifted));
+        CHECK(create_virtual(keep, s_dims, CUDNN_DATA_BOOLEAN));
+        CHECK(add_pointwise(CUDNN_POINTWISE_CMP_GE, shifted, col, keep));
+
+        CHECK(create_tensor(neg_inf, uid_neg_inf, CUDNN_DATA_FLOAT,
+                {1, 1, 1, 1}, {1, 1, 1, 1}, false, true));
+        CHECK(create_virtual(masked, s_dims, CUDNN_DATA_FLOAT));
+        CHECK(add_pointwise(
+                CUDNN_POINTWISE_BINARY_SELECT, s, neg_inf, masked, keep));
+        s = masked;
+        return status::success;
+    }
+
+    // Builds the operation graph and finalizes the plan of the first engine
+    // configuration proposed by the heuristics that supports it.
+    status_t create_plan(cudnnHandle_t handle) {
+        cudnnBackendDescriptor_t graph, heur;
+        CHECK(create_desc(CUDNN_BACKEND_OPERATIONGRAPH_DESCRIPTOR, graph));
+        CHECK(set_attr(graph, CUDNN_ATTR_OPERATIONGRAPH_OPS,
+                CUDNN_TYPE_BACKEND_DESCRIPTOR, (int64_t)ops_.size(),
+                ops_.data()));
+        CHECK(set_attr(graph, CUDNN_ATTR_OPERATIONGRAPH_HANDLE,
+                CUDNN_TYPE_HANDLE, 1, &handle));
+        CHECK(CUDNN_EXECUTE_FUNC_S(cudnnBackendFinalize, graph));
+
+        const cudnnBackendHeurMode_t mode = CUDNN_HEUR_MODE_A;
+        CHECK(create_desc(CUDNN_BACKEND_ENGINEHEUR_DESCRIPTOR, heur));
+        CHECK(set_attr(heur, CUDNN_ATTR_ENGINEHEUR_OPERATION_GRAPH,
+                CUDNN_TYPE_BACKEND_DESCRIPTOR, 1, &graph));
+        CHECK(set_attr(heur, CUDNN_ATTR_ENGINEHEUR_MODE, CUDNN_TYPE_HEUR_MODE,
+                1, &mode));
+        CHECK(CUDNN_EXECUTE_FUNC_S(cudnnBackendFinalize, heur));
+
+        int64_t n_cfgs = 0;
+        CHECK(CUDNN_EXECUTE_FUNC_S(cudnnBackendGetAttribute, heur,
+                CUDNN_ATTR_ENGINEHEUR_RESULTS, CUDNN_TYPE_BACKEND_DESCRIPTOR,
+                0, &n_cfgs, nullptr));
+        if (n_cfgs == 0) return status::unimplemented;
+
+        std::vector<cudnnBackendDescriptor_t> cfgs(n_cfgs);
+        for (auto &cfg : cfgs)
+            CHECK(create_desc(CUDNN_BACKEND_ENGINECFG_DESCRIPTOR, cfg));
+        CHECK(CUDNN_EXECUTE_FUNC_S(cudnnBackendGetAttribute, heur,
+                CUDNN_ATTR_ENGINEHEUR_RESULTS, CUDNN_TYPE_BACKEND_DESCRIPTOR,
+                n_cfgs, &n_cfgs, cfgs.data()));
+
+        for (int64_t i = 0; i < n_cfgs; i++) {
+            cudnnBackendDescriptor_t plan;
+            CHECK(create_desc(CUDNN_BACKEND_EXECUTION_PLAN_DESCRIPTOR, plan));
+            CHECK(set_attr(plan, CUDNN_ATTR_EXECUTION_PLAN_HANDLE,
+                    CUDNN_TYPE_HANDLE, 1, &handle));
+            CHECK(set_attr(plan, CUDNN_ATTR_EXECUTION_PLAN_ENGINE_CONFIG,
+                    CUDNN_TYPE_BACKEND_DESCRIPTOR, 1, &cfgs[i]));
+            if (cudnnBackendFinalize(plan) != CUDNN_STATUS_SUCCESS) continue;
+
+            int64_t ws_size = 0, count = 0;
+            CHECK(CUDNN_EXECUTE_FUNC_S(cudnnBackendGetAttribute, plan,
+                    CUDNN_ATTR_EXECUTION_PLAN_WORKSPACE_SIZE, CUDNN_TYPE_INT64,
+                    1, &count, &ws_size));
+            plan_ = plan;
+            workspace_size_ = (size_t)ws_size;
+            return status::success;
+        }
+        return status::unimplemented;
+    }
+
+    cudnnDataType_t data_type_ = CUDNN_DATA_HALF;
+    bool with_causal_mask_ = false;
+    int32_t diag_shift_ = 0;
+    int64_t next_uid_ = uid_virtual;
+    size_t workspace_size_ = 0;
+    cudnnBackendDescriptor_t plan_ = nullptr;
+    std::vector<cudnnBackendDescriptor_t> ops_;
+    // All the descriptors created, destroyed with the object.
+    std::vector<cudnnBackendDescriptor_t> descs_;
+};
+
+} // namespace nvidia
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
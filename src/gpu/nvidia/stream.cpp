@@ -15,6 +15,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstring>
+
+#include "common/primitive_desc_iface.hpp"
+#include "common/primitive_iface.hpp"
 #include "common/verbose.hpp"
 
 #include "gpu/nvidia/engine.hpp"
@@ -27,6 +31,45 @@ namespace impl {
 namespace gpu {
 namespace nvidia {
 
+namespace {
+
+struct cuda_capture_graph_t : public stream_capture_graph_t {
+    cuda_capture_graph_t(nvidia::stream_t *stream, CUgraphExec exec,
+            std::vector<std::unique_ptr<memory_storage_t>> &&buffers)
+        : stream_(stream), exec_(exec), buffers_(std::move(buffers)) {}
+
+    ~cuda_capture_graph_t() override {
+        // The last launch may still use the graph and the buffers.
+        stream_->wait();
+        auto &sycl_engine
+                = *utils::downcast<nvidia::engine_t *>(stream_->engine());
+        auto sc = cuda_sycl_scoped_context_handler_t(sycl_engine);
+        CUDA_EXECUTE_FUNC_V(cuGraphExecDestroy, exec_);
+    }
+
+    status_t launch(impl::stream_t *stream) override {
+        auto *cuda_stream = utils::downcast<nvidia::stream_t *>(stream);
+        CUgraphExec exec = exec_;
+        return cuda_stream->interop_task([&](::sycl::handler &cgh) {
+            compat::host_task(cgh, [=](const compat::interop_handle &) {
+                auto &sycl_engine = *utils::downcast<nvidia::engine_t *>(
+                        cuda_stream->engine());
+                auto sc = cuda_sycl_scoped_context_handler_t(sycl_engine);
+                CUDA_EXECUTE_FUNC(cuGraphLaunch, exec,
+                        cuda_stream->get_underlying_stream());
+            });
+        });
+    }
+
+private:
+    nvidia::stream_t *stream_;
+    CUgraphExec exec_;
+    // Pooled scratchpads the graph was recorded with.
+    std::vector<std::unique_ptr<memory_storage_t>> buffers_;
+};
+
+} // namespace
+
 cublasHandle_t &stream_t::get_cublas_handle(CUstream cuda_stream) {
     if (!cuda_stream) cuda_stream = get_underlying_stream();
     auto e = utils::downcast<nvidia::engine_t *>(engine());
@@ -103,6 +146,56 @@ status_t stream_t::init() {
     return status;
 }
 
+status_t stream_t::create_capture_graph(const stream_capture_t &capture,
+        std::unique_ptr<stream_capture_graph_t> &graph) {
+    // Only the cuDNN and cuBLAS based primitives submit all their work to
+    // the underlying CUDA stream, the work of the SYCL kernels would be
+    // missing from the graph.
+    for (size_t i = 0; i < capture.size(); i++) {
+        const char *name = capture.primitive_iface(i)->pd()->impl()->name();
+        if (std::strncmp(name, "cuda:", 5) != 0) return status::unimplemented;
+    }
+
+    // Work submitted before must not be recorded.
+    CHECK(wait());
+
+    auto &sycl_engine = *utils::downcast<nvidia::engine_t *>(engine());
+    auto sc = cuda_sycl_scoped_context_handler_t(sycl_engine);
+    CUstream cu_stream = get_underlying_stream();
+
+    // In the global mode, calls that would synchronize with the recorded
+    // work, such as the copies of arguments to the host, fail and invalidate
+    // the recording.
+    CHECK(CUDA_EXECUTE_FUNC_S(
+            cuStreamBeginCapture, cu_stream, CU_STREAM_CAPTURE_MODE_GLOBAL));
+    memory_pool()->begin_hold();
+    status_t status = status::success;
+    try {
+        status = capture.execute_entries();
+        // Waits for the host tasks to be recorded without synchronizing
+        // the CUDA stream.
+        if (status == status::success)
+            ::sycl::event::wait(sycl_ctx().get_sycl_deps().events);
+    } catch (...) { status = status::runtime_error; }
+    auto buffers = memory_pool()->end_hold();
+
+    CUgraph cu_graph = nullptr;
+    status_t end_status
+            = CUDA_EXECUTE_FUNC_S(cuStreamEndCapture, cu_stream, &cu_graph);
+    if (status == status::success) status = end_status;
+
+    CUgraphExec exec = nullptr;
+    if (status == status::success)
+        status = CUDA_EXECUTE_FUNC_S(
+                cuGraphInstantiateWithFlags, &exec, cu_graph, 0);
+    if (cu_graph) CUDA_EXECUTE_FUNC_V(cuGraphDestroy, cu_graph);
+    // The executions that failed to be recorded are replayed one by one.
+    if (status != status::success) return status::unimplemented;
+
+    graph.reset(new cuda_capture_graph_t(this, exec, std::move(buffers)));
+    return status::success;
+}
+
 status_t stream_t::interop_task(
         std::function<void(::sycl::handler &)> sycl_cuda_interop_) {
     try {
@@ -87,6 +87,14 @@ public:
         return impl()->register_deps(cgh);
     }
 
+    // Primitive executions are recorded into a CUDA graph, which requires
+    // the work to be serialized on the underlying CUDA stream.
+    bool is_capture_supported() const override {
+        return (flags() & stream_flags::in_order) != 0;
+    }
+    status_t create_capture_graph(const stream_capture_t &capture,
+            std::unique_ptr<stream_capture_graph_t> &graph) override;
+
     status_t interop_task(std::function<void(::sycl::handler &)>);
     CUstream get_underlying_stream();
     CUcontext get_underlying_context();
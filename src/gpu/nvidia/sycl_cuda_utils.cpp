@@ -87,6 +87,13 @@ bool has_imma_dst_int8_support() {
     return rt_version >= 12000;
 }
 
+bool has_fp8_support(const ::sycl::device &dev) {
+    // This function checks compute capabilities of the given device.
+    // FP8 matmul kernels are supported starting with compute capabilities 8.9.
+    auto prop = query_device_properties(dev);
+    return prop.major > 8 || (prop.major == 8 && prop.minor >= 9);
+}
+
 } // namespace nvidia
 } // namespace gpu
 } // namespace impl
@@ -62,6 +62,7 @@ cudaDeviceProp query_device_properties(const ::sycl::device &dev);
 bool has_bf16_support(const ::sycl::device &dev);
 bool has_imma_ampere_layout_support(const ::sycl::device &dev);
 bool has_imma_dst_int8_support();
+bool has_fp8_support(const ::sycl::device &dev);
 
 // Check if the device type matches the passed engine kind
 inline status_t check_device(dnnl::impl::engine_kind_t eng_kind) {
@@ -217,6 +218,12 @@ static status_t get_cublas_data_type(
         case dnnl_data_type_t::dnnl_s32:
             blas_dt = CUDA_R_32I;
             return status::success;
+        case dnnl_data_type_t::dnnl_f8_e4m3:
+            blas_dt = CUDA_R_8F_E4M3;
+            return status::success;
+        case dnnl_data_type_t::dnnl_f8_e5m2:
+            blas_dt = CUDA_R_8F_E5M2;
+            return status::success;
         default: return status::unimplemented;
     }
     return status::unimplemented;
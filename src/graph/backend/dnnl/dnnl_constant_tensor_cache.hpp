@@ -82,6 +82,16 @@ inline void dnnl_constant_cache_remove_if_exist(
     cache->remove_if_exist(dnnl_backend_t::get_singleton().get_id(), key);
 }
 
+inline bool dnnl_constant_cache_set_pinned(const dnnl::engine &eng,
+        graph::constant_tensor_cache_t::key_t key, bool pinned) {
+    auto cache = graph::get_constant_tensor_cache(
+            eng.get()->kind(), eng.get()->index());
+    assertm(cache,
+            "no available constant cache for specified engine kind and index");
+    return cache->set_pinned(
+            dnnl_backend_t::get_singleton().get_id(), key, pinned);
+}
+
 inline bool is_constant_cache_enabled(const dnnl::engine &eng) {
     auto cache = graph::get_constant_tensor_cache(
             eng.get()->kind(), eng.get()->index());
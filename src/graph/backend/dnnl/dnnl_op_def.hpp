@@ -575,15 +575,18 @@ DNNL_GRAPH_OP_SCHEMA(dnnl_conv_bwd_data, 1,
 DNNL_GRAPH_OP_SCHEMA(dnnl_conv_bwd_weights, 1,
         op_schema_t()
                 .set_num_inputs(2)
-                .set_num_outputs(2)
+                .set_outputs_option(op_schema_t::param_num_option::optional)
+                .set_num_outputs(std::set<size_t>({2, 3}))
                 .set_input(0, "input")
                 .set_input(1, "output_delta")
                 .set_output(0, "weight_delta")
-                .set_output(1, "scratchpad")
+                .set_output(1, "bias_delta") // optional
+                .set_output(2, "scratchpad")
                 .set_attr(op_attr::weights_shape, false, attribute_kind::is,
                         std::vector<int64_t>(DNNL_MAX_NDIMS, 0))
                 .SET_CONV_COMMON_ATTRS
                 // New added attributes
+                .set_attr(op_attr::with_bias, false, attribute_kind::b, false)
                 .set_attr(
                         op_attr::canonicalized, false, attribute_kind::b, false)
                 .SET_ATTR_IS_CONSTANT // used for constant prop and cache
@@ -805,6 +808,53 @@ DNNL_GRAPH_OP_SCHEMA(dnnl_gen_index, 1,
                         executable_creator<genindex_executable_t>)
                 .SET_ARG_INDICES_GETTER(genindex_executable_t))
 
+DNNL_GRAPH_OP_SCHEMA(dnnl_rotary_embedding, 1,
+        op_schema_t()
+                .set_num_inputs(3)
+                .set_num_outputs(1)
+                .set_input(0, "src")
+                .set_input(1, "cos")
+                .set_input(2, "sin")
+                .set_output(0, "dst")
+                .SET_ATTR_IS_CONSTANT // used for constant prop and cache
+                // Analysis rules
+                .set_shape_inference_function(infer_identity_output_shape)
+                .SET_LAYOUT_PROPAGATOR(layout_propagator_for_rotary_embedding)
+                .SET_EXECUTABLE_CREATOR(
+                        executable_creator<rotary_embedding_executable_t>)
+                .SET_ARG_INDICES_GETTER(rotary_embedding_executable_t))
+
+DNNL_GRAPH_OP_SCHEMA(dnnl_paged_cache_load, 1,
+        op_schema_t()
+                .set_num_inputs(2)
+                .set_num_outputs(1)
+                .set_input(0, "cache")
+                .set_input(1, "block_table")
+                .set_output(0, "dst")
+                .SET_ATTR_IS_CONSTANT // used for constant prop and cache
+                // Analysis rules
+                .set_shape_inference_function(
+                        infer_paged_cache_load_output_shape)
+                .SET_LAYOUT_PROPAGATOR(layout_propagator_for_paged_cache_load)
+                .SET_EXECUTABLE_CREATOR(
+                        executable_creator<paged_cache_load_executable_t>)
+                .SET_ARG_INDICES_GETTER(paged_cache_load_executable_t))
+
+DNNL_GRAPH_OP_SCHEMA(dnnl_gather, 1,
+        op_schema_t()
+                .set_num_inputs(2)
+                .set_num_outputs(1)
+                .set_input(0, "src")
+                .set_input(1, "indices")
+                .set_output(0, "dst")
+                .set_attr(op_attr::axis, false, attribute_kind::i, int64_t(0))
+                .SET_ATTR_IS_CONSTANT // used for constant prop and cache
+                // Analysis rules
+                .set_shape_inference_function(infer_gather_output_shape)
+                .SET_LAYOUT_PROPAGATOR(layout_propagator_for_gather)
+                .SET_EXECUTABLE_CREATOR(executable_creator<gather_executable_t>)
+                .SET_ARG_INDICES_GETTER(gather_executable_t))
+
 DNNL_GRAPH_OP_SCHEMA(dnnl_shuffle, 1,
         op_schema_t()
                 .set_num_inputs(1)
@@ -986,6 +1036,9 @@ DNNL_GRAPH_OP_SCHEMA(dnnl_matmul, 1,
                 .SET_ATTR_IS_CONSTANT // used for constant prop and cache
                 .set_attr(op_attr::keep_dst_layout, false, attribute_kind::b,
                         false)
+                // the src is quantized to s8 by the primitive at execution
+                .set_attr(op_attr::is_src_dyn_quant, false, attribute_kind::b,
+                        false)
                 // Analysis rules
                 .set_shape_inference_function(infer_matmul_output_shape)
                 .SET_LAYOUT_PROPAGATOR(layout_propagator_for_matmul)
@@ -1055,6 +1108,8 @@ DNNL_GRAPH_OP_SCHEMA(dnnl_layernorm, 1,
                 .set_attr(op_attr::fusion_info_key, false, attribute_kind::i,
                         (int64_t)-1)
                 // New added attributes
+                .set_attr(op_attr::is_rms_norm, false, attribute_kind::b,
+                        false)
                 .SET_ATTR_IS_CONSTANT // used for constant prop and cache
                 // Analysis rules
                 .set_shape_inference_function(infer_norm_output_shape)
@@ -151,7 +151,8 @@ status_t dnnl_partition_impl_t::compile(
     // compile kernel.
     // FIXME(qun) will modify the outputs inside the compile, which
     // break the constant semantics
-    ret = kernel->compile(part.get(), g_engine, inputs, outputs);
+    ret = kernel->compile(part.get(), g_engine, inputs, outputs,
+            compiled_partition->get_src_cache_blob());
     if (ret != status::success) return ret;
 
     std::vector<logical_tensor_t> ordered_inputs;
@@ -66,6 +66,11 @@ public:
         return kernel_->execute(g_stream, inputs, outputs);
     }
 
+    status_t prepare_constants(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs, bool pin) override {
+        return kernel_->prepare_constants(g_stream, inputs, pin);
+    }
+
 #ifdef DNNL_WITH_SYCL
     status_t execute_sycl(const stream_t *g_stream,
             const std::vector<tensor_t> &inputs,
@@ -93,6 +98,12 @@ public:
 
     std::string str() const override { return kernel_->str(); }
 
+    status_t get_cache_blob(std::vector<uint8_t> &cache_blob) const override {
+        return kernel_->get_cache_blob(cache_blob);
+    }
+
+    size_t footprint() const override { return kernel_->footprint(); }
+
 private:
     kernel_ptr kernel_;
 };
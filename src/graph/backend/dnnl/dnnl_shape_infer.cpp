@@ -401,8 +401,20 @@ status_t infer_dnnl_conv_bwd_weight_output_shape(op_t *n,
         std::vector<logical_tensor_t *> &inputs,
         std::vector<logical_tensor_t *> &outputs) {
     const size_t axis_with_groups = 0;
-    return infer_dnnl_conv_common_bwd_weight_output_shape(
+    const auto ret = infer_dnnl_conv_common_bwd_weight_output_shape(
             n, inputs, outputs, axis_with_groups);
+    if (ret != status::success) return ret;
+
+    // diff_bias has one element per channel of diff_dst
+    if (n->has_attr(op_attr::with_bias) && n->get_attr<bool>(op_attr::with_bias)
+            && logical_tensor_wrapper_t(outputs[1]).is_shape_unknown()) {
+        const auto &data_format
+                = n->get_attr<std::string>(op_attr::data_format);
+        const dim_t channels
+                = logical_tensor_wrapper_t(inputs[1]).get_src_c(data_format);
+        set_shape_and_strides(*outputs[1], {channels});
+    }
+    return status::success;
 }
 
 status_t infer_dnnl_batchnorm_output_shape(op_t *n,
@@ -100,7 +100,19 @@ dnnl::primitive_attr make_dnnl_primitive_attr(
                     int64_t axis = in_scales_op->has_attr(op_attr::axis)
                             ? in_scales_op->get_attr<int64_t>(op_attr::axis)
                             : 1;
-                    if (impl::utils::one_of(op->get_kind(),
+                    std::vector<int64_t> groups = default_groups;
+                    if (op->get_kind() == op_kind::dnnl_matmul
+                            && in_scales_indices == 0
+                            && op->has_attr(op_attr::is_src_dyn_quant)
+                            && op->get_attr<bool>(op_attr::is_src_dyn_quant)) {
+                        // The src quantized by the primitive takes per-row
+                        // scales as groups spanning the whole row.
+                        const auto &src_lt
+                                = op->get_input_value(0)->get_logical_tensor();
+                        const int ndims = src_lt.ndims;
+                        mask = (1 << (ndims - 2)) | (1 << (ndims - 1));
+                        groups = {1, src_lt.dims[ndims - 1]};
+                    } else if (impl::utils::one_of(op->get_kind(),
                                 op_kind::dnnl_convolution,
                                 op_kind::dnnl_convtranspose)
                             && in_scales_indices == 1) {
@@ -120,7 +132,7 @@ dnnl::primitive_attr make_dnnl_primitive_attr(
                     }
                     attr.set_scales(in_scales_indices == 0 ? DNNL_ARG_SRC
                                                            : DNNL_ARG_WEIGHTS,
-                            mask, default_groups,
+                            mask, groups,
                             static_cast<dnnl::memory::data_type>(
                                     scales_data_type));
                 } else { // per-group quantization
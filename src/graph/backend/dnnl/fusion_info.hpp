@@ -209,6 +209,20 @@ public:
         return *pos;
     }
 
+    // Returns all the ops fused into the op which owns this fusion info
+    std::vector<const op_t *> get_fused_ops() const {
+        std::vector<const op_t *> ops;
+        for (const auto &zps : input_zps_)
+            ops.emplace_back(zps.second->get_op());
+        if (output_zps_) ops.emplace_back(output_zps_->get_op());
+        for (const auto &scales : input_scales_)
+            ops.emplace_back(scales.second->get_op());
+        if (dst_scales_) ops.emplace_back(dst_scales_->get_op());
+        for (const auto &post_op : post_ops_)
+            ops.emplace_back(post_op->get_op());
+        return ops;
+    }
+
     bool has_post_binary() const {
         auto pos = std::find_if(post_ops_.begin(), post_ops_.end(),
                 [](const std::shared_ptr<meta_op_t> &mop) {
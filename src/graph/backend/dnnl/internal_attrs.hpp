@@ -48,6 +48,10 @@ const op_attr_t keep_dst_layout = 0x1000f;
 const op_attr_t with_scale = 0x10010;
 const op_attr_t is_invert_scale = 0x10011;
 const op_attr_t mask_type = 0x10012;
+const op_attr_t is_zero_copy = 0x10013;
+const op_attr_t is_rms_norm = 0x10014;
+const op_attr_t is_in_place_append = 0x10015;
+const op_attr_t is_src_dyn_quant = 0x10016;
 
 // int64_t
 const op_attr_t alg_kind = 0x10100;
@@ -92,6 +96,10 @@ static inline std::string internal_attr2str(op_attr_t attr) {
         CASE(with_scale);
         CASE(is_invert_scale);
         CASE(mask_type);
+        CASE(is_zero_copy);
+        CASE(is_rms_norm);
+        CASE(is_in_place_append);
+        CASE(is_src_dyn_quant);
         CASE(alg_kind);
         CASE(fusion_info_key);
         CASE(axis_row);
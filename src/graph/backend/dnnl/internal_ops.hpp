@@ -81,7 +81,10 @@ namespace op_kind {
     X(dnnl_gen_index, Dnnl_gen_index) \
     X(dnnl_mask, Dnnl_mask) \
     X(dnnl_sdpa, Dnnl_sdpa) \
-    X(dnnl_host_scalar, Dnnl_host_scalar)
+    X(dnnl_host_scalar, Dnnl_host_scalar) \
+    X(dnnl_rotary_embedding, Dnnl_rotary_embedding) \
+    X(dnnl_paged_cache_load, Dnnl_paged_cache_load) \
+    X(dnnl_gather, Dnnl_gather)
 
 enum kind_t {
     kDNNL_INTERNAL_OP_STARTER = 0x1234,
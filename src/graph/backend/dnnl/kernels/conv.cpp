@@ -52,6 +52,8 @@ status_t conv_fwd_t<quantized>::compile_impl(const dnnl_partition_impl_t *part,
 
     BACKEND_DNNL_ADD_PASS(pipeline, lower_down);
 
+    BACKEND_DNNL_ADD_PASS(pipeline, fuse_to_shuffle);
+    BACKEND_DNNL_ADD_PASS(pipeline, fold_shuffle_into_conv_weights);
     BACKEND_DNNL_ADD_PASS(pipeline, fuse_bias_add);
     if (!quantized) {
         BACKEND_DNNL_ADD_PASS(pipeline, insert_bn_folding);
@@ -0,0 +1,789 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "graph/backend/dnnl/kernels/gated_mlp_decomp.hpp"
+
+#include <cstring>
+
+#include "common/dnnl_thread.hpp"
+#include "common/primitive_desc_iface.hpp"
+#include "common/type_helpers.hpp"
+
+#include "graph/backend/dnnl/passes/utils.hpp"
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+#include "cpu/cpu_stream.hpp"
+#include "oneapi/dnnl/dnnl_threadpool.h"
+#endif
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+#define VCHECK_GATED_MLP_DECOMP(cond, status, msg, ...) \
+    VCONDCHECK(graph, create, check, gated_mlp_decomp_kernel_t, (cond), \
+            status, msg, ##__VA_ARGS__);
+
+namespace {
+
+using op_ptr = std::shared_ptr<op_t>;
+using ltw = logical_tensor_wrapper_t;
+
+op_ptr get_producer(const std::shared_ptr<value_t> &val) {
+    if (!val->has_producer()) return nullptr;
+    return val->get_producer().shared_from_this();
+}
+
+bool is_matmul(const op_ptr &op) {
+    return op && op->get_kind() == graph::op_kind::MatMul;
+}
+
+// Returns the DynamicDequantize producing `val` if any.
+op_ptr get_dequant(const std::shared_ptr<value_t> &val) {
+    const op_ptr p = get_producer(val);
+    return p && p->get_kind() == graph::op_kind::DynamicDequantize ? p
+                                                                   : nullptr;
+}
+
+// Activations that map to an eltwise post-op without extra parameters.
+bool is_supported_activation(const op_ptr &op) {
+    using namespace graph::op_kind;
+    return op
+            && impl::utils::one_of(op->get_kind(), Abs, Exp, GELU, Log, Mish,
+                    ReLU, Sigmoid, Sqrt, Square, Tanh);
+}
+
+// Returns the gate matmul if `val` is produced by an activation over a matmul
+// output, or by Sigmoid and Multiply forming a swish over a matmul output.
+op_ptr get_activated_matmul(const std::shared_ptr<value_t> &val,
+        op_ptr &act, bool &is_swish) {
+    const op_ptr p = get_producer(val);
+    if (is_supported_activation(p)) {
+        const op_ptr mm = get_producer(p->get_input_value(0));
+        if (!is_matmul(mm)) return nullptr;
+        act = p;
+        is_swish = false;
+        return mm;
+    }
+    if (p && p->get_kind() == graph::op_kind::Multiply) {
+        for (size_t i = 0; i < 2; i++) {
+            const op_ptr mm = get_producer(p->get_input_value(i));
+            const op_ptr sig = get_producer(p->get_input_value(1 - i));
+            if (!is_matmul(mm) || !sig
+                    || sig->get_kind() != graph::op_kind::Sigmoid)
+                continue;
+            if (get_producer(sig->get_input_value(0)) != mm) continue;
+            act = sig;
+            is_swish = true;
+            return mm;
+        }
+    }
+    return nullptr;
+}
+
+bool get_transpose(const op_ptr &mm, const op_attr_t attr) {
+    return mm->has_attr(attr) && mm->get_attr<bool>(attr);
+}
+
+// Weights of the sub-matmuls are addressed in place in the user buffer. The
+// descriptor describes a `rows x cols` block with the user strides, taking
+// into account the transposition flag of the original matmul.
+memory::desc make_wei_md(const logical_tensor_t &lt, bool transpose,
+        memory::dim rows, memory::dim cols, memory::dim &cols_stride,
+        memory::dim &rows_stride) {
+    const auto strides = ltw(lt).vstrides();
+    rows_stride = transpose ? strides[1] : strides[0];
+    cols_stride = transpose ? strides[0] : strides[1];
+    return memory::desc({rows, cols},
+            static_cast<memory::data_type>(ltw(lt).data_type()),
+            {rows_stride, cols_stride});
+}
+
+// Checks that all the dimensions but the last one can be collapsed into rows.
+bool rows_are_collapsible(const logical_tensor_t &lt) {
+    const auto dims = ltw(lt).vdims();
+    const auto strides = ltw(lt).vstrides();
+    const int nd = static_cast<int>(dims.size());
+    for (int d = 0; d < nd - 2; d++) {
+        if (dims[d] != 1 && strides[d] != dims[d + 1] * strides[d + 1])
+            return false;
+    }
+    return true;
+}
+
+} // namespace
+
+status_t gated_mlp_decomp_kernel_t::init_slice(slice_prims_t &s,
+        memory::dim I_blk, const memory::desc &wei_gate_md,
+        const memory::desc &wei_up_md, const memory::desc &wei_down_md,
+        memory::data_type up_dt, memory::data_type inter_dt,
+        const post_ops &act_pops, algorithm bin_alg) {
+    using tag = memory::format_tag;
+
+    s.I_blk = I_blk;
+    s.wei_gate_md = wei_gate_md;
+    s.wei_up_md = wei_up_md;
+    s.wei_down_md = wei_down_md;
+    s.up_md = memory::desc({M_, I_blk}, up_dt, tag::ab);
+    s.inter_md = memory::desc({M_, I_blk}, inter_dt, tag::ab);
+
+    primitive_attr attr;
+    attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+    auto fpmath = subgraph_->get_fpmath_mode();
+    attr.set_fpmath_mode(
+            static_cast<dnnl::fpmath_mode>(fpmath.mode_), fpmath.apply_to_int_);
+
+    // Integer weights get the dequantization as weights scales and zero
+    // points. They are gathered into dense buffers covering the slice only.
+    const auto wei_attr = [&](int w) {
+        primitive_attr a = attr;
+        const wei_quant_t &q = wei_q_[w];
+        if (q.scales_inport == -1) return a;
+        const memory::dim rows = w == down ? I_blk : K_;
+        const memory::dim cols = w == down ? H_ : I_blk;
+        const memory::dim n = ((q.mask & 1) ? rows / q.groups[0] : 1)
+                * ((q.mask & 2) ? cols / q.groups[1] : 1);
+        const memory::dims groups = q.is_grouped
+                ? memory::dims {q.groups[0], q.groups[1]}
+                : memory::dims {};
+        a.set_scales(DNNL_ARG_WEIGHTS, q.mask, groups, q.scales_dt);
+        s.scales_md[w] = memory::desc({n}, q.scales_dt, tag::a);
+        if (q.zps_inport != -1) {
+            a.set_zero_points(DNNL_ARG_WEIGHTS, q.mask, groups, q.zps_dt);
+            s.zps_md[w] = memory::desc({n}, q.zps_dt, tag::a);
+        }
+        return a;
+    };
+
+    auto up_pd = matmul::primitive_desc(
+            p_engine_, src_md_, wei_up_md, s.up_md, wei_attr(up), true);
+    VCHECK_GATED_MLP_DECOMP(up_pd, status::unimplemented,
+            "failed to create the up projection");
+
+    // The gate matmul gets the activation and the gating binary with the up
+    // projection result as post-ops.
+    primitive_attr g_attr = wei_attr(gate);
+    post_ops gate_pops = act_pops;
+    gate_pops.append_binary(bin_alg, s.up_md);
+    s.bin_po_idx = gate_pops.len() - 1;
+    g_attr.set_post_ops(gate_pops);
+    auto gate_pd = matmul::primitive_desc(
+            p_engine_, src_md_, wei_gate_md, s.inter_md, g_attr, true);
+    VCHECK_GATED_MLP_DECOMP(gate_pd, status::unimplemented,
+            "failed to create the gate projection");
+
+    auto down_pd = matmul::primitive_desc(p_engine_, s.inter_md, wei_down_md,
+            part_md_, wei_attr(down), true);
+    VCHECK_GATED_MLP_DECOMP(down_pd, status::unimplemented,
+            "failed to create the down projection");
+
+    s.up_prim = make_primitive<matmul>(up_pd);
+    s.gate_prim = make_primitive<matmul>(gate_pd);
+    s.down_prim = make_primitive<matmul>(down_pd);
+
+    for (const auto &md : {up_pd.scratchpad_desc(), gate_pd.scratchpad_desc(),
+                 down_pd.scratchpad_desc()}) {
+        if (md.get_size() > scratchpad_md_.get_size()) scratchpad_md_ = md;
+    }
+    return status::success;
+}
+
+status_t gated_mlp_decomp_kernel_t::init_wei_quant(wei_quant_t &q,
+        const std::shared_ptr<op_t> &deq, bool transpose,
+        const logical_tensor_t &scales_lt, const logical_tensor_t *zps_lt) {
+    using dt = memory::data_type;
+
+    q.scales_dt = static_cast<dt>(ltw(scales_lt).data_type());
+    VCHECK_GATED_MLP_DECOMP(
+            impl::utils::one_of(q.scales_dt, dt::f32, dt::bf16, dt::f16)
+                    && ltw(scales_lt).is_strided(),
+            status::unimplemented, "unsupported scales");
+    if (zps_lt) {
+        q.zps_dt = static_cast<dt>(ltw(*zps_lt).data_type());
+        // Zero points are gathered element-wise, so sub-byte data types are
+        // not supported.
+        VCHECK_GATED_MLP_DECOMP(
+                impl::utils::one_of(q.zps_dt, dt::s8, dt::u8, dt::s32)
+                        && ltw(*zps_lt).is_strided(),
+                status::unimplemented, "unsupported zero points");
+    }
+
+    // Dimension `d` of the weights descriptor is dimension `user_dim(d)` of
+    // the user weights.
+    const auto user_dim = [&](int d) { return transpose ? 1 - d : d; };
+    const int nd = ltw(scales_lt).ndims();
+    const std::string qtype = deq->has_attr(op_attr::qtype)
+            ? deq->get_attr<std::string>(op_attr::qtype)
+            : "per_tensor";
+    if (qtype == "per_tensor") {
+        q.mask = 0;
+    } else if (qtype == "per_channel") {
+        int64_t axis = deq->has_attr(op_attr::axis)
+                ? deq->get_attr<int64_t>(op_attr::axis)
+                : 1;
+        if (axis < 0) axis += 2;
+        VCHECK_GATED_MLP_DECOMP(nd == 1 && (axis == 0 || axis == 1),
+                status::unimplemented, "unsupported per-channel scales");
+        const int d = user_dim(static_cast<int>(axis));
+        q.mask = 1 << d;
+        q.scales_strides[d] = ltw(scales_lt).vstrides()[0];
+        if (zps_lt) q.zps_strides[d] = ltw(*zps_lt).vstrides()[0];
+    } else if (qtype == "per_group") {
+        VCHECK_GATED_MLP_DECOMP(deq->has_attr(op_attr::group_shape) && nd == 2
+                        && (!zps_lt || ltw(*zps_lt).ndims() == 2),
+                status::unimplemented, "unsupported per-group scales");
+        const auto &group_shape
+                = deq->get_attr<std::vector<int64_t>>(op_attr::group_shape);
+        VCHECK_GATED_MLP_DECOMP(group_shape.size() == 2, status::unimplemented,
+                "unsupported group shape");
+        q.mask = 3;
+        q.is_grouped = true;
+        for (int d = 0; d < 2; d++) {
+            q.groups[d] = group_shape[user_dim(d)];
+            q.scales_strides[d] = ltw(scales_lt).vstrides()[user_dim(d)];
+            if (zps_lt)
+                q.zps_strides[d] = ltw(*zps_lt).vstrides()[user_dim(d)];
+        }
+    } else {
+        VCHECK_GATED_MLP_DECOMP(false, status::unimplemented,
+                "unsupported quantization type %s", qtype.c_str());
+    }
+    return status::success;
+}
+
+void gated_mlp_decomp_kernel_t::gather_quant(int w, bool zps,
+        const slice_prims_t &s, memory::dim i0, const char *src,
+        char *dst) const {
+    const wei_quant_t &q = wei_q_[w];
+    const size_t dt_size
+            = memory::data_type_size(zps ? q.zps_dt : q.scales_dt);
+    const memory::dim *strides = zps ? q.zps_strides : q.scales_strides;
+
+    // A slice covers all the rows of W_gate and W_up and all the columns of
+    // W_down.
+    const memory::dim rows = w == down ? s.I_blk : K_;
+    const memory::dim cols = w == down ? H_ : s.I_blk;
+    const memory::dim r0 = w == down ? i0 : 0;
+    const memory::dim c0 = w == down ? 0 : i0;
+    const bool has_r = q.mask & 1, has_c = q.mask & 2;
+    const memory::dim nr = has_r ? rows / q.groups[0] : 1;
+    const memory::dim nc = has_c ? cols / q.groups[1] : 1;
+    const memory::dim sr0 = has_r ? r0 / q.groups[0] : 0;
+    const memory::dim sc0 = has_c ? c0 / q.groups[1] : 0;
+
+    for (memory::dim r = 0; r < nr; r++) {
+        const char *s_row
+                = src + ((sr0 + r) * strides[0] + sc0 * strides[1]) * dt_size;
+        char *d_row = dst + r * nc * dt_size;
+        if (strides[1] == 1) {
+            std::memcpy(d_row, s_row, nc * dt_size);
+            continue;
+        }
+        for (memory::dim c = 0; c < nc; c++)
+            std::memcpy(d_row + c * dt_size, s_row + c * strides[1] * dt_size,
+                    dt_size);
+    }
+}
+
+status_t gated_mlp_decomp_kernel_t::compile_impl(
+        const dnnl_partition_impl_t *part, const engine_t *g_engine,
+        const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs) {
+    using dt = memory::data_type;
+
+    p_engine_ = make_dnnl_engine(*g_engine);
+    g_alloc_
+            = reinterpret_cast<graph::allocator_t *>(g_engine->get_allocator());
+
+    subgraph_ = std::make_shared<subgraph_t>(part->get_ops(), p_engine_,
+            part->get_fpmath_mode(), part->get_use_blocked_layout(), true);
+    BACKEND_DNNL_CHECK(set_given_inputs_outputs(subgraph_, inputs, outputs));
+
+    VCHECK_GATED_MLP_DECOMP(outputs.size() == 1, status::unimplemented,
+            "unexpected number of outputs");
+
+    // Find the down projection: the only matmul with a produced source.
+    op_ptr mm_down;
+    for (const auto &op : subgraph_->get_ops()) {
+        if (is_matmul(op) && op->get_input_value(0)->has_producer())
+            mm_down = op;
+    }
+    VCHECK_GATED_MLP_DECOMP(mm_down, status::unimplemented,
+            "down projection is not found");
+    const op_ptr bin = get_producer(mm_down->get_input_value(0));
+    const auto &bin_map = get_binary_alg_map();
+    VCHECK_GATED_MLP_DECOMP(bin && bin_map.count(bin->get_kind())
+                    && bin->num_inputs() == 2,
+            status::unimplemented, "gating binary is not supported");
+    const algorithm bin_alg = bin_map.at(bin->get_kind());
+
+    // Tell the gate branch from the up branch.
+    op_ptr mm_gate, mm_up, act;
+    bool is_swish = false;
+    int gate_side = -1;
+    for (int i = 0; i < 2; i++) {
+        op_ptr a;
+        bool swish = false;
+        op_ptr mm = get_activated_matmul(bin->get_input_value(i), a, swish);
+        if (mm && is_matmul(get_producer(bin->get_input_value(1 - i)))) {
+            mm_gate = mm;
+            act = a;
+            is_swish = swish;
+            gate_side = i;
+            break;
+        }
+    }
+    if (gate_side == -1) {
+        // No activation: the gate is the first operand of the binary.
+        mm_gate = get_producer(bin->get_input_value(0));
+        gate_side = 0;
+    }
+    mm_up = get_producer(bin->get_input_value(1 - gate_side));
+    VCHECK_GATED_MLP_DECOMP(is_matmul(mm_gate) && is_matmul(mm_up),
+            status::unimplemented, "gate or up projection is not found");
+    // The gating binary is applied as `gate op up` by the post-op chain.
+    VCHECK_GATED_MLP_DECOMP(gate_side == 0
+                    || impl::utils::one_of(bin_alg, algorithm::binary_add,
+                            algorithm::binary_mul, algorithm::binary_max,
+                            algorithm::binary_min),
+            status::unimplemented, "non-commutative gating binary");
+
+    for (const auto &mm : {mm_gate, mm_up, mm_down}) {
+        VCHECK_GATED_MLP_DECOMP(mm->num_inputs() == 2, status::unimplemented,
+                "matmul with bias is not supported");
+        VCHECK_GATED_MLP_DECOMP(!get_transpose(mm, op_attr::transpose_a),
+                status::unimplemented, "transposed source is not supported");
+    }
+
+    const auto find_inport = [&](const std::shared_ptr<value_t> &val) {
+        for (int i = 0; i < (int)inputs.size(); i++) {
+            if (val->get_logical_tensor().id == inputs[i].id) return i;
+        }
+        return -1;
+    };
+    graph_inport_[src_idx] = find_inport(mm_gate->get_input_value(0));
+    VCHECK_GATED_MLP_DECOMP(
+            find_inport(mm_up->get_input_value(0)) == graph_inport_[src_idx],
+            status::unimplemented, "gate and up use different sources");
+
+    // Weights are either given directly or dequantized from integers.
+    const op_ptr mms[n_wei] = {mm_gate, mm_up, mm_down};
+    op_ptr deqs[n_wei];
+    size_t n_inputs = n_idx;
+    for (int w = 0; w < n_wei; w++) {
+        const auto wei_val = mms[w]->get_input_value(1);
+        deqs[w] = get_dequant(wei_val);
+        if (!deqs[w]) {
+            graph_inport_[wei_gate_idx + w] = find_inport(wei_val);
+            continue;
+        }
+        const op_ptr &deq = deqs[w];
+        graph_inport_[wei_gate_idx + w]
+                = find_inport(deq->get_input_value(0));
+        wei_q_[w].scales_inport = find_inport(deq->get_input_value(1));
+        VCHECK_GATED_MLP_DECOMP(wei_q_[w].scales_inport != -1,
+                status::unimplemented, "scales must be partition inputs");
+        n_inputs++;
+        if (deq->num_inputs() > 2) {
+            wei_q_[w].zps_inport = find_inport(deq->get_input_value(2));
+            VCHECK_GATED_MLP_DECOMP(wei_q_[w].zps_inport != -1,
+                    status::unimplemented,
+                    "zero points must be partition inputs");
+            n_inputs++;
+        }
+    }
+    VCHECK_GATED_MLP_DECOMP(inputs.size() == n_inputs, status::unimplemented,
+            "unexpected number of inputs");
+    for (int i = 0; i < n_idx; i++) {
+        VCHECK_GATED_MLP_DECOMP(graph_inport_[i] != -1
+                        && ltw(inputs[graph_inport_[i]]).is_strided(),
+                status::unimplemented, "inputs must have strided layouts");
+    }
+
+    const auto &src_lt = inputs[graph_inport_[src_idx]];
+    const auto &wg_lt = inputs[graph_inport_[wei_gate_idx]];
+    const auto &wu_lt = inputs[graph_inport_[wei_up_idx]];
+    const auto &wd_lt = inputs[graph_inport_[wei_down_idx]];
+    const auto src_dt = static_cast<dt>(ltw(src_lt).data_type());
+    VCHECK_GATED_MLP_DECOMP(
+            impl::utils::one_of(src_dt, dt::f32, dt::bf16, dt::f16),
+            status::unimplemented, "unsupported data types");
+    for (int w = 0; w < n_wei; w++) {
+        const auto &wei_lt = inputs[graph_inport_[wei_gate_idx + w]];
+        const auto wei_dt = static_cast<dt>(ltw(wei_lt).data_type());
+        wei_bits_[w] = types::data_type_bits(ltw(wei_lt).data_type());
+        if (!deqs[w]) {
+            VCHECK_GATED_MLP_DECOMP(wei_dt == src_dt, status::unimplemented,
+                    "unsupported data types");
+            continue;
+        }
+        const auto &deq_lt
+                = deqs[w]->get_output_value(0)->get_logical_tensor();
+        const auto deq_dt = static_cast<dt>(ltw(deq_lt).data_type());
+        VCHECK_GATED_MLP_DECOMP(
+                impl::utils::one_of(wei_dt, dt::s8, dt::u8, dt::s4, dt::u4)
+                        && deq_dt == src_dt,
+                status::unimplemented, "unsupported compressed weights");
+    }
+
+    const auto src_dims = ltw(src_lt).vdims();
+    const int src_nd = static_cast<int>(src_dims.size());
+    VCHECK_GATED_MLP_DECOMP(src_nd >= 2 && rows_are_collapsible(src_lt)
+                    && ltw(wg_lt).ndims() == 2 && ltw(wu_lt).ndims() == 2
+                    && ltw(wd_lt).ndims() == 2,
+            status::unimplemented, "unsupported shapes");
+
+    const bool tr_gate = get_transpose(mm_gate, op_attr::transpose_b);
+    const bool tr_up = get_transpose(mm_up, op_attr::transpose_b);
+    const bool tr_down = get_transpose(mm_down, op_attr::transpose_b);
+    M_ = 1;
+    for (int d = 0; d < src_nd - 1; d++)
+        M_ *= src_dims[d];
+    K_ = src_dims[src_nd - 1];
+    I_ = ltw(wg_lt).vdims()[tr_gate ? 0 : 1];
+    H_ = ltw(wd_lt).vdims()[tr_down ? 0 : 1];
+
+    // Slices of I must not split the quantization groups along I.
+    memory::dim I_blk_granularity = 64;
+    const bool trs[n_wei] = {tr_gate, tr_up, tr_down};
+    for (int w = 0; w < n_wei; w++) {
+        if (!deqs[w]) continue;
+        const logical_tensor_t *zps_lt = wei_q_[w].zps_inport == -1
+                ? nullptr
+                : &inputs[wei_q_[w].zps_inport];
+        BACKEND_DNNL_CHECK(init_wei_quant(wei_q_[w], deqs[w], trs[w],
+                inputs[wei_q_[w].scales_inport], zps_lt));
+        // I is along the columns of W_gate and W_up and the rows of W_down.
+        const int I_dim = w == down ? 0 : 1;
+        const memory::dim g = (wei_q_[w].mask & (1 << I_dim))
+                ? wei_q_[w].groups[I_dim]
+                : 1;
+        I_blk_granularity = std::max(I_blk_granularity, g);
+    }
+    for (int w = 0; w < n_wei; w++) {
+        const int I_dim = w == down ? 0 : 1;
+        if (!deqs[w] || !(wei_q_[w].mask & (1 << I_dim))) continue;
+        const memory::dim g = wei_q_[w].groups[I_dim];
+        VCHECK_GATED_MLP_DECOMP(I_blk_granularity % g == 0 && I_ % g == 0,
+                status::unimplemented, "unsupported quantization groups");
+    }
+
+    // Use a dense layout for the destination if the user didn't define it.
+    // The layout is reported back only if the kernel is created.
+    logical_tensor_t dst_lt = outputs[0];
+    if (ltw(dst_lt).is_any()) {
+        dst_lt.layout_type = layout_type::strided;
+        dim_t stride = 1;
+        for (int d = dst_lt.ndims - 1; d >= 0; d--) {
+            dst_lt.layout.strides[d] = stride;
+            stride *= dst_lt.dims[d];
+        }
+    }
+    VCHECK_GATED_MLP_DECOMP(ltw(dst_lt).is_strided()
+                    && rows_are_collapsible(dst_lt)
+                    && ltw(dst_lt).nelems() == M_ * H_,
+            status::unimplemented, "unsupported destination");
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
+    nthr_ = dnnl_get_current_num_threads();
+#else
+    nthr_ = dnnl_get_max_threads();
+#endif
+
+    // One slice of I per thread, rounded so that the sub-matmuls get full
+    // vector blocks.
+    I_blk_ = impl::utils::rnd_up(
+            impl::utils::div_up(I_, nthr_), I_blk_granularity);
+    I_blk_ = std::min(I_blk_, I_);
+    n_slices_ = impl::utils::div_up(I_, I_blk_);
+
+    // The partial results grow with M while the weights traffic doesn't.
+    // Stay with the primitive based kernel when summing up the partial
+    // results costs more than a fraction of reading the weights.
+    const size_t wei_size = ltw(wg_lt).size() + ltw(wu_lt).size()
+            + ltw(wd_lt).size();
+    const size_t reduction_size
+            = 2 * n_slices_ * M_ * H_ * memory::data_type_size(dt::f32);
+    VCHECK_GATED_MLP_DECOMP(n_slices_ > 1 && 4 * reduction_size <= wei_size,
+            status::unimplemented,
+            "shape is not profitable for decomposition, M: %ld, "
+            "slices: %ld",
+            static_cast<long int>(M_), static_cast<long int>(n_slices_));
+
+    const auto src_strides = ltw(src_lt).vstrides();
+    src_md_ = memory::desc({M_, K_}, src_dt,
+            {src_strides[src_nd - 2], src_strides[src_nd - 1]});
+    part_md_ = memory::desc({M_, H_}, dt::f32, memory::format_tag::ab);
+
+    const auto wei_md = [&](const logical_tensor_t &lt, bool tr,
+                                memory::dim rows, memory::dim cols,
+                                bool slice_rows, memory::dim &I_stride) {
+        memory::dim rs = 0, cs = 0;
+        auto md = make_wei_md(lt, tr, rows, cols, cs, rs);
+        I_stride = slice_rows ? rs : cs;
+        return md;
+    };
+
+    // The activation of the gate. The gating binary is appended per slice.
+    post_ops act_pops;
+    if (is_swish) {
+        act_pops.append_eltwise(algorithm::eltwise_swish, 1.f, 0.f);
+    } else if (act) {
+        act_pops.append_eltwise(
+                static_cast<algorithm>(get_eltwise_alg(act, false)), 0.f, 0.f);
+    }
+
+    const auto up_dt = static_cast<dt>(
+            ltw(mm_up->get_output_value(0)->get_logical_tensor()).data_type());
+    const auto inter_dt = static_cast<dt>(
+            ltw(bin->get_output_value(0)->get_logical_tensor()).data_type());
+
+    {
+        // The sub-primitives are executed in a parallel region by a single
+        // thread each.
+        max_threads_limit_guard_t max_threads_guard(1);
+        for (auto *s : {&slice_, &tail_}) {
+            const memory::dim I_blk
+                    = s == &slice_ ? I_blk_ : I_ - (n_slices_ - 1) * I_blk_;
+            if (s == &tail_ && I_blk == I_blk_) break;
+            BACKEND_DNNL_CHECK(init_slice(*s, I_blk,
+                    wei_md(wg_lt, tr_gate, K_, I_blk, false,
+                            wei_I_stride_[gate]),
+                    wei_md(wu_lt, tr_up, K_, I_blk, false, wei_I_stride_[up]),
+                    wei_md(wd_lt, tr_down, I_blk, H_, true,
+                            wei_I_stride_[down]),
+                    up_dt, inter_dt, act_pops, bin_alg));
+        }
+    }
+
+    // The partial results are summed up by a regular multithreaded sum.
+    const auto dst_strides = ltw(dst_lt).vstrides();
+    const int dst_nd = ltw(dst_lt).ndims();
+    dst_md_ = memory::desc({M_, H_},
+            static_cast<dt>(ltw(dst_lt).data_type()),
+            {dst_strides[dst_nd - 2], dst_strides[dst_nd - 1]});
+    std::vector<float> scales(n_slices_, 1.f);
+    std::vector<memory::desc> part_mds(n_slices_, part_md_);
+    sum_prim_ = sum(sum::primitive_desc(p_engine_, dst_md_, scales, part_mds));
+
+    registrar_t registrar = thr_registry_.registrar();
+    registrar.book(key_up, slice_.up_md.get_size());
+    registrar.book(key_inter, slice_.inter_md.get_size());
+    registrar.book(key_scratchpad, scratchpad_md_.get_size());
+    for (int w = 0; w < n_wei; w++) {
+        if (wei_q_[w].scales_inport == -1) continue;
+        registrar.book(key_scales + w, slice_.scales_md[w].get_size());
+        if (wei_q_[w].zps_inport != -1)
+            registrar.book(key_zps + w, slice_.zps_md[w].get_size());
+    }
+
+    const_cast<logical_tensor_t &>(outputs[0]) = dst_lt;
+
+    resource_ctor_ = [this]() {
+        return std::make_shared<gated_mlp_args_set_t>(this);
+    };
+
+    return status::success;
+}
+
+gated_mlp_decomp_kernel_t::gated_mlp_args_set_t::gated_mlp_args_set_t(
+        gated_mlp_decomp_kernel_t *kernel) {
+    const auto &eng = kernel->p_engine_;
+    src = memory(kernel->src_md_, eng, nullptr);
+    for (memory::dim i = 0; i < kernel->n_slices_; i++) {
+        parts.emplace_back(kernel->part_md_, eng, nullptr);
+        sum_args.insert({DNNL_ARG_MULTIPLE_SRC + static_cast<int>(i),
+                parts.back()});
+    }
+    sum_args.insert({DNNL_ARG_DST, memory(kernel->dst_md_, eng, nullptr)});
+
+    thr_args.resize(kernel->nthr_);
+    for (auto &a : thr_args)
+        init_thr_args(a, kernel->slice_, kernel->part_md_,
+                kernel->scratchpad_md_);
+    if (kernel->tail_.I_blk != 0) {
+        thr_tail_args.resize(kernel->nthr_);
+        for (auto &a : thr_tail_args)
+            init_thr_args(a, kernel->tail_, kernel->part_md_,
+                    kernel->scratchpad_md_);
+    }
+}
+
+void gated_mlp_decomp_kernel_t::gated_mlp_args_set_t::init_thr_args(
+        thr_args_t &a, const slice_prims_t &s, const memory::desc &part_md,
+        const memory::desc &scratchpad_md) {
+    const auto eng = src.get_engine();
+    a.wei_gate = memory(s.wei_gate_md, eng, nullptr);
+    a.wei_up = memory(s.wei_up_md, eng, nullptr);
+    a.wei_down = memory(s.wei_down_md, eng, nullptr);
+    a.up = memory(s.up_md, eng, nullptr);
+    a.inter = memory(s.inter_md, eng, nullptr);
+    a.part = memory(part_md, eng, nullptr);
+    a.scratchpad = memory(scratchpad_md, eng, nullptr);
+
+    a.up_args = {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, a.wei_up},
+            {DNNL_ARG_DST, a.up}, {DNNL_ARG_SCRATCHPAD, a.scratchpad}};
+    a.gate_args = {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, a.wei_gate},
+            {DNNL_ARG_DST, a.inter},
+            {DNNL_ARG_ATTR_MULTIPLE_POST_OP(s.bin_po_idx) | DNNL_ARG_SRC_1,
+                    a.up},
+            {DNNL_ARG_SCRATCHPAD, a.scratchpad}};
+    a.down_args = {{DNNL_ARG_SRC, a.inter}, {DNNL_ARG_WEIGHTS, a.wei_down},
+            {DNNL_ARG_DST, a.part}, {DNNL_ARG_SCRATCHPAD, a.scratchpad}};
+
+    std::unordered_map<int, memory> *args[n_wei]
+            = {&a.gate_args, &a.up_args, &a.down_args};
+    for (int w = 0; w < n_wei; w++) {
+        if (s.scales_md[w].is_zero()) continue;
+        a.scales[w] = memory(s.scales_md[w], eng, nullptr);
+        args[w]->insert({DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS, a.scales[w]});
+        if (s.zps_md[w].is_zero()) continue;
+        a.zps[w] = memory(s.zps_md[w], eng, nullptr);
+        args[w]->insert(
+                {DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS, a.zps[w]});
+    }
+}
+
+status_t gated_mlp_decomp_kernel_t::execute_impl(const stream_t *g_stream,
+        const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs) {
+    dnnl::stream strm = make_dnnl_stream(p_engine_, *g_stream);
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    auto *tp_stream
+            = dnnl::impl::utils::downcast<dnnl::impl::cpu::cpu_stream_t *>(
+                    const_cast<stream_t *>(g_stream));
+    tp_stream->before_exec_hook();
+#endif
+
+    thread_local_cache_t<gated_mlp_args_set_t> res_cache;
+    gated_mlp_args_set_t *res = res_cache.get_or_add(
+            reinterpret_cast<size_t>(this), resource_ctor_);
+
+    const auto handle = [&](int idx) {
+        return static_cast<char *>(
+                inputs[graph_inport_[idx]].get_data_handle());
+    };
+    char *src_ptr = handle(src_idx);
+    char *wei_ptr[n_wei] = {handle(wei_gate_idx), handle(wei_up_idx),
+            handle(wei_down_idx)};
+    const char *scales_ptr[n_wei] = {nullptr, nullptr, nullptr};
+    const char *zps_ptr[n_wei] = {nullptr, nullptr, nullptr};
+    for (int w = 0; w < n_wei; w++) {
+        if (wei_q_[w].scales_inport != -1)
+            scales_ptr[w] = static_cast<const char *>(
+                    inputs[wei_q_[w].scales_inport].get_data_handle());
+        if (wei_q_[w].zps_inport != -1)
+            zps_ptr[w] = static_cast<const char *>(
+                    inputs[wei_q_[w].zps_inport].get_data_handle());
+    }
+    res->src.set_data_handle(src_ptr);
+
+    // Per-thread buffers followed by the partial results of all slices.
+    const size_t thr_size = impl::utils::rnd_up(thr_registry_.size(), 64);
+    const size_t part_size = impl::utils::rnd_up(part_md_.get_size(), 64);
+    temporary_scratchpad_t scratchpad(
+            thr_size * nthr_ + part_size * n_slices_ + 64, p_engine_,
+            *g_alloc_);
+    char *base = reinterpret_cast<char *>(impl::utils::rnd_up(
+            reinterpret_cast<size_t>(scratchpad.get_buffer()),
+            static_cast<size_t>(64)));
+    char *parts_base = base + thr_size * nthr_;
+    for (memory::dim i = 0; i < n_slices_; i++)
+        res->parts[i].set_data_handle(parts_base + i * part_size);
+
+    const auto loop = [&](int ithr, int nthr, dim_t slice) {
+        const bool is_tail = tail_.I_blk != 0 && slice == n_slices_ - 1;
+        const slice_prims_t &s = is_tail ? tail_ : slice_;
+        thr_args_t &a = is_tail ? res->thr_tail_args[ithr]
+                                : res->thr_args[ithr];
+
+        grantor_t grantor = thr_registry_.grantor(base + ithr * thr_size);
+        a.up.set_data_handle(grantor.get(key_up));
+        a.inter.set_data_handle(grantor.get(key_inter));
+        a.scratchpad.set_data_handle(grantor.get(key_scratchpad));
+        a.part.set_data_handle(parts_base + slice * part_size);
+
+        // Slices start at an even index along I, so the offsets of sub-byte
+        // weights are whole bytes.
+        const memory::dim i0 = slice * I_blk_;
+        const auto wei_off = [&](int w) {
+            return static_cast<size_t>(i0 * wei_I_stride_[w]) * wei_bits_[w]
+                    / 8;
+        };
+        a.wei_gate.set_data_handle(wei_ptr[gate] + wei_off(gate));
+        a.wei_up.set_data_handle(wei_ptr[up] + wei_off(up));
+        a.wei_down.set_data_handle(wei_ptr[down] + wei_off(down));
+        for (int w = 0; w < n_wei; w++) {
+            if (!scales_ptr[w]) continue;
+            char *buf = grantor.get(key_scales + w);
+            gather_quant(w, false, s, i0, scales_ptr[w], buf);
+            a.scales[w].set_data_handle(buf);
+            if (!zps_ptr[w]) continue;
+            buf = grantor.get(key_zps + w);
+            gather_quant(w, true, s, i0, zps_ptr[w], buf);
+            a.zps[w].set_data_handle(buf);
+        }
+
+        // In parallel region - these primitives should use single thread.
+        max_threads_limit_guard_t max_threads_guard(1);
+        s.up_prim.execute(strm, a.up_args);
+        s.gate_prim.execute(strm, a.gate_args);
+        s.down_prim.execute(strm, a.down_args);
+    };
+
+    parallel_nd_ext(nthr_, n_slices_, loop);
+
+    res->sum_args.at(DNNL_ARG_DST).set_data_handle(
+            outputs[0].get_data_handle());
+    sum_prim_.execute(strm, res->sum_args);
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    tp_stream->after_exec_hook();
+#endif
+    return status::success;
+}
+
+#define RESET_PRIM_ENGINE(primitive_name, primitive_type) \
+    { \
+        const auto desc_t = (primitive_name).get_primitive_desc()->impl(); \
+        dnnl_primitive_desc new_pd_t(desc_t, p_engine_.get()); \
+        primitive_type::primitive_desc new_pd(&new_pd_t); \
+        (primitive_name) = primitive_type(new_pd); \
+    }
+
+status_t gated_mlp_decomp_kernel_t::reset_engine(const engine_t *g_engine) {
+    p_engine_ = make_dnnl_engine(*g_engine);
+    {
+        max_threads_limit_guard_t max_threads_guard(1);
+        for (auto *s : {&slice_, &tail_}) {
+            if (s->I_blk == 0) continue;
+            RESET_PRIM_ENGINE(s->up_prim, matmul);
+            RESET_PRIM_ENGINE(s->gate_prim, matmul);
+            RESET_PRIM_ENGINE(s->down_prim, matmul);
+        }
+    }
+    RESET_PRIM_ENGINE(sum_prim_, sum);
+    return status::success;
+}
+
+#undef RESET_PRIM_ENGINE
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,219 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_KERNELS_GATED_MLP_DECOMP_HPP
+#define GRAPH_BACKEND_DNNL_KERNELS_GATED_MLP_DECOMP_HPP
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "graph/backend/dnnl/kernels/kernel_base.hpp"
+
+#include "graph/backend/dnnl/dnnl_partition_impl.hpp"
+#include "graph/backend/dnnl/op_executable.hpp"
+#include "graph/backend/dnnl/scratchpad.hpp"
+#include "graph/backend/dnnl/subgraph.hpp"
+#include "graph/backend/dnnl/thread_local_cache.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// Decomposition kernel for the gated MLP on CPU:
+//
+//   dst = (act(src * W_gate) op (src * W_up)) * W_down
+//
+// The weights are either float or integer weights dequantized by
+// DynamicDequantize, which is fused into the sub-matmuls as weights scales and
+// zero points (weights decompression).
+//
+// The intermediate dimension I is split in slices, one slice per thread.
+// Every thread computes the up and gate projections for its slice with the
+// activation and the gating binary fused as post-ops of the gate matmul, and
+// immediately multiplies the result by the matching rows of W_down. The
+// intermediate tensor stays in the thread's cache, every weight is read once
+// and the per-slice partial results are summed into the destination at the
+// end. The reduction is proportional to the number of rows, so the kernel
+// targets the small-M (token generation) case only.
+struct gated_mlp_decomp_kernel_t : public kernel_base_t {
+private:
+    allocator_t *g_alloc_ = nullptr;
+
+    // Input offsets in the partition inputs: src, W_gate, W_up, W_down.
+    enum { src_idx = 0, wei_gate_idx, wei_up_idx, wei_down_idx, n_idx };
+    int graph_inport_[n_idx] = {-1, -1, -1, -1};
+
+    memory::dim M_ = 0, K_ = 0, I_ = 0, H_ = 0;
+    // Size of a regular slice along I and the number of slices.
+    memory::dim I_blk_ = 0, n_slices_ = 0;
+    int nthr_ = 1;
+
+    // Weights of the gate, up and down projections.
+    enum { gate = 0, up, down, n_wei };
+
+    // Strides in elements to move a weights pointer along I and the size of
+    // a weights element in bits.
+    memory::dim wei_I_stride_[n_wei] = {0, 0, 0};
+    size_t wei_bits_[n_wei] = {0, 0, 0};
+
+    // Dequantization parameters of integer weights. Scales and zero points
+    // of a slice are gathered into dense per-thread buffers on execution.
+    struct wei_quant_t {
+        int scales_inport = -1, zps_inport = -1;
+        // Mask and groups in the [rows, cols] orientation of the weights
+        // descriptor of the sub-matmul.
+        int mask = 0;
+        bool is_grouped = false;
+        memory::dim groups[2] = {1, 1};
+        memory::data_type scales_dt = memory::data_type::undef,
+                          zps_dt = memory::data_type::undef;
+        // Strides in elements of the user scales and zero points along the
+        // rows and the columns of the weights groups.
+        memory::dim scales_strides[2] = {0, 0}, zps_strides[2] = {0, 0};
+    };
+    wei_quant_t wei_q_[n_wei];
+
+    // Sub-primitives computing one slice of I. The last slice may be
+    // shorter and gets its own primitives.
+    struct slice_prims_t {
+        memory::dim I_blk = 0;
+        // Index of the gating binary in the gate matmul post-ops.
+        int bin_po_idx = 0;
+        matmul up_prim, gate_prim, down_prim;
+        memory::desc wei_gate_md, wei_up_md, wei_down_md, up_md, inter_md;
+        // Dense scales and zero points of the slice, empty for float weights.
+        memory::desc scales_md[n_wei], zps_md[n_wei];
+    };
+    slice_prims_t slice_, tail_;
+    memory::desc src_md_, part_md_, dst_md_, scratchpad_md_;
+    sum sum_prim_;
+
+    // Per-thread buffers: up and intermediate results and the scratchpad.
+    // Partial results are kept per slice.
+    registry_t thr_registry_;
+    enum {
+        key_up = 0,
+        key_inter,
+        key_scratchpad,
+        key_scales,
+        key_zps = key_scales + n_wei
+    };
+
+    status_t init_slice(slice_prims_t &s, memory::dim I_blk,
+            const memory::desc &wei_gate_md, const memory::desc &wei_up_md,
+            const memory::desc &wei_down_md, memory::data_type up_dt,
+            memory::data_type inter_dt, const post_ops &act_pops,
+            algorithm bin_alg);
+    status_t init_wei_quant(wei_quant_t &q, const std::shared_ptr<op_t> &deq,
+            bool transpose, const logical_tensor_t &scales_lt,
+            const logical_tensor_t *zps_lt);
+    // Gathers the scales or zero points of a slice of weights `w` starting
+    // at `i0` along I into a dense buffer.
+    void gather_quant(int w, bool zps, const slice_prims_t &s, memory::dim i0,
+            const char *src, char *dst) const;
+
+public:
+    gated_mlp_decomp_kernel_t() {
+        thread_local_cache_t<gated_mlp_args_set_t> res_cache;
+        res_cache.retain();
+    }
+
+    ~gated_mlp_decomp_kernel_t() override {
+        thread_local_cache_t<gated_mlp_args_set_t> res_cache;
+        res_cache.remove_if_exist(reinterpret_cast<size_t>(this));
+        res_cache.release();
+    }
+
+    status_t compile_impl(const dnnl_partition_impl_t *part,
+            const engine_t *g_engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs) override;
+
+    status_t execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) override;
+
+    // Memory objects and execution args of a single thread. The handles are
+    // updated on every execution.
+    struct thr_args_t {
+        memory wei_gate, wei_up, wei_down, up, inter, part, scratchpad;
+        memory scales[n_wei], zps[n_wei];
+        std::unordered_map<int, memory> up_args, gate_args, down_args;
+    };
+
+    class gated_mlp_args_set_t {
+    public:
+        gated_mlp_args_set_t(gated_mlp_decomp_kernel_t *kernel);
+
+        memory src;
+        std::vector<memory> parts;
+        std::vector<thr_args_t> thr_args, thr_tail_args;
+        std::unordered_map<int, memory> sum_args;
+
+    private:
+        void init_thr_args(thr_args_t &a, const slice_prims_t &s,
+                const memory::desc &part_md,
+                const memory::desc &scratchpad_md);
+    };
+
+    std::function<std::shared_ptr<gated_mlp_args_set_t>()> resource_ctor_;
+
+#ifdef DNNL_WITH_SYCL
+    status_t sycl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<::sycl::event> &sycl_deps,
+            ::sycl::event *sycl_event) override {
+        UNUSED(g_stream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        UNUSED(sycl_deps);
+        UNUSED(sycl_event);
+        return status::unimplemented;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    status_t ocl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<cl_event> &cl_deps,
+            cl_event *ret_event) override {
+        UNUSED(g_stream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        UNUSED(cl_deps);
+        UNUSED(ret_event);
+        return status::unimplemented;
+    }
+#endif
+
+    DEF_KERNEL_METHOD_STR(gated_mlp_decomp_kernel_t)
+    DNNL_DISALLOW_COPY_AND_ASSIGN(gated_mlp_decomp_kernel_t)
+    status_t reset_engine(const engine_t *g_engine) override;
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -14,28 +14,121 @@
  * limitations under the License.
  *******************************************************************************/
 
+#include <cstring>
+#include <map>
+
 #include "graph/backend/dnnl/kernels/kernel_base.hpp"
 #include "graph/backend/dnnl/dnnl_constant_tensor_cache.hpp"
+#include "graph/backend/dnnl/op_executable.hpp"
 
 namespace dnnl {
 namespace impl {
 namespace graph {
 namespace dnnl_impl {
 
+namespace {
+// The cache blob of a kernel is the number of primitives followed by the size
+// and the content of the cache blob id and of the cache blob of each of them.
+using blob_t = std::vector<uint8_t>;
+
+void write_blob(blob_t &dst, const blob_t &src) {
+    const uint64_t size = src.size();
+    const auto *p = reinterpret_cast<const uint8_t *>(&size);
+    dst.insert(dst.end(), p, p + sizeof(size));
+    dst.insert(dst.end(), src.begin(), src.end());
+}
+
+bool read_blob(const blob_t &src, size_t &offset, blob_t &dst) {
+    uint64_t size = 0;
+    if (src.size() - offset < sizeof(size)) return false;
+    std::memcpy(&size, src.data() + offset, sizeof(size));
+    offset += sizeof(size);
+    if (src.size() - offset < size) return false;
+    dst.assign(src.begin() + offset, src.begin() + offset + size);
+    offset += size;
+    return true;
+}
+
+status_t parse_cache_blob(
+        const blob_t &cache_blob, std::map<blob_t, blob_t> &blobs) {
+    if (cache_blob.empty()) return status::success;
+
+    size_t offset = 0;
+    uint64_t count = 0;
+    if (cache_blob.size() < sizeof(count)) return status::invalid_arguments;
+    std::memcpy(&count, cache_blob.data(), sizeof(count));
+    offset += sizeof(count);
+    for (uint64_t i = 0; i < count; ++i) {
+        blob_t id, blob;
+        if (!read_blob(cache_blob, offset, id)
+                || !read_blob(cache_blob, offset, blob))
+            return status::invalid_arguments;
+        blobs[id] = std::move(blob);
+    }
+    return offset == cache_blob.size() ? status::success
+                                       : status::invalid_arguments;
+}
+} // namespace
+
 status_t kernel_base_t::compile(const dnnl_partition_impl_t *part,
         const engine_t *aengine, const std::vector<logical_tensor_t> &inputs,
-        const std::vector<logical_tensor_t> &outputs) {
+        const std::vector<logical_tensor_t> &outputs,
+        const std::vector<uint8_t> &cache_blob) {
+    std::map<blob_t, blob_t> blobs;
+    CHECK(parse_cache_blob(cache_blob, blobs));
+
+    primitive_cache_blob_scope_t scope(blobs);
     auto ret = compile_impl(part, aengine, inputs, outputs);
     if (ret != status::success) return ret;
+    primitives_ = scope.created();
+    footprint_ = scope.footprint();
     return prepare_inplace_pairs_impl();
 }
 
+status_t kernel_base_t::get_cache_blob(std::vector<uint8_t> &cache_blob) const {
+    cache_blob.clear();
+    if (primitives_.empty()) return status::success;
+
+    const uint64_t count = primitives_.size();
+    const auto *p = reinterpret_cast<const uint8_t *>(&count);
+    cache_blob.insert(cache_blob.end(), p, p + sizeof(count));
+    try {
+        for (const auto &id_prim : primitives_) {
+            write_blob(cache_blob, id_prim.first);
+            write_blob(cache_blob, id_prim.second.get_cache_blob());
+        }
+    } catch (const dnnl::error &e) {
+        cache_blob.clear();
+        return static_cast<status_t>(e.status);
+    }
+    return status::success;
+}
+
+kernel_base_t::~kernel_base_t() {
+    if (pinned_keys_.empty() || !enabled_constant_cache()) return;
+    for (size_t key : pinned_keys_)
+        dnnl_constant_cache_set_pinned(p_engine_, key, false);
+}
+
 status_t kernel_base_t::execute(const stream_t *astream,
         const std::vector<tensor_t> &inputs,
         const std::vector<tensor_t> &outputs) {
     return execute_impl(astream, inputs, outputs);
 }
 
+status_t kernel_base_t::prepare_constants(const stream_t *astream,
+        const std::vector<tensor_t> &inputs, bool pin) {
+    if (!enabled_constant_cache()) return status::success;
+    return prepare_constants_impl(astream, inputs, pin);
+}
+
+void kernel_base_t::pin_constant_buffer(size_t key) {
+    // The buffer may not have been added when the cache is full
+    if (!dnnl_constant_cache_set_pinned(p_engine_, key, true)) return;
+    std::lock_guard<std::mutex> lock(pinned_mutex_);
+    pinned_keys_.emplace_back(key);
+}
+
 bool kernel_base_t::enabled_constant_cache() const {
     if (!p_engine_.get(true)) { return false; }
 
@@ -56,6 +149,51 @@ size_t kernel_base_t::encode_constant_cache_key(
     return encoded_cache_key;
 }
 
+constant_tensor_cache_t::cached_t kernel_base_t::map_shared_constant_buffer(
+        const std::vector<tensor_t> &inputs,
+        const std::vector<dnnl::memory::desc> &const_mds, size_t size,
+        size_t &shared_key) const {
+    shared_key = 0;
+    if (!is_shared_constant_cache_enabled(p_engine_.get()->kind()))
+        return nullptr;
+
+    // Unlike the key of the process local cache, the key can't depend on
+    // addresses or partition ids.
+    size_t key = hash_combine(0, std::string(dnnl_version()->hash));
+    key = generate_constant_md_hash(key, const_mds);
+    for (const auto &op : subgraph_->get_ops()) {
+        if (!op->has_attr(op_attr::is_constant)
+                || !op->get_attr<bool>(op_attr::is_constant))
+            continue;
+        key = hash_combine(key, static_cast<size_t>(op->get_kind()));
+    }
+    for (const auto &in : inputs) {
+        const logical_tensor_t &lt = in.get_logical_tensor();
+        if (!logical_tensor_wrapper_t(lt).is_constant()) continue;
+        const size_t nbytes = logical_tensor_wrapper_t(lt).size();
+        const auto *data = static_cast<const uint8_t *>(in.get_data_handle());
+        size_t i = 0;
+        for (; i + sizeof(uint64_t) <= nbytes; i += sizeof(uint64_t)) {
+            uint64_t word;
+            std::memcpy(&word, data + i, sizeof(word));
+            key = hash_combine(key, word);
+        }
+        for (; i < nbytes; i++)
+            key = hash_combine(key, data[i]);
+    }
+    shared_key = key;
+
+    return graph::map_shared_constant_buffer(key, size, p_engine_.get());
+}
+
+void kernel_base_t::store_shared_constant_buffer(dnnl::stream &p_stream,
+        size_t shared_key,
+        const constant_tensor_cache_t::cached_t &buffer) const {
+    if (!is_shared_constant_cache_enabled(p_engine_.get()->kind())) return;
+    p_stream.wait();
+    graph::store_shared_constant_buffer(shared_key, *buffer);
+}
+
 const std::vector<inplace_pair_t> &kernel_base_t::get_inplace_pairs() const {
     return inplace_pairs_;
 };
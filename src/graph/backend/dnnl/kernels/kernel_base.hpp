@@ -19,6 +19,8 @@
 
 #include <algorithm>
 #include <memory>
+#include <mutex>
+#include <utility>
 #include <vector>
 
 #include "graph/backend/dnnl/subgraph.hpp"
@@ -40,11 +42,14 @@ namespace dnnl_impl {
 class dnnl_partition_impl_t;
 
 struct kernel_base_t {
-    virtual ~kernel_base_t() = default;
+    virtual ~kernel_base_t();
 
+    // The primitives whose cache blob ids are found in the given cache blob
+    // are created from it.
     status_t compile(const dnnl_partition_impl_t *part, const engine_t *aengine,
             const std::vector<logical_tensor_t> &inputs,
-            const std::vector<logical_tensor_t> &outputs);
+            const std::vector<logical_tensor_t> &outputs,
+            const std::vector<uint8_t> &cache_blob = {});
 
     // each subclass should implement compile_impl()
     virtual status_t compile_impl(const dnnl_partition_impl_t *part,
@@ -104,6 +109,19 @@ struct kernel_base_t {
 
     virtual status_t prepare_inplace_pairs_impl() { return status::success; };
 
+    // Computes the constant buffers for the given constant inputs and adds
+    // them into the constant tensor cache ahead of the first execution. The
+    // non-constant inputs are not accessed. Pinned buffers are not flushed
+    // from the cache until the kernel is destroyed.
+    status_t prepare_constants(const stream_t *astream,
+            const std::vector<tensor_t> &inputs, bool pin);
+
+    // Kernels which don't implement it fill the cache on the first execution
+    virtual status_t prepare_constants_impl(const stream_t *astream,
+            const std::vector<tensor_t> &inputs, bool pin) {
+        return status::success;
+    }
+
     // A string identity used in verbose indicating which kernels is dispatched
     // for a compiled partition.
     virtual std::string str() const = 0;
@@ -113,12 +131,49 @@ struct kernel_base_t {
     size_t encode_constant_cache_key(
             const std::vector<tensor_t> &inputs, size_t cache_key) const;
 
+    // Returns the constant buffer of the given size stored by another process
+    // for the same constant inputs, or nullptr. The key of the buffer is
+    // computed from the content of the constant inputs, the constant ops of
+    // the subgraph and the given memory descriptors of the constant buffers,
+    // and is returned in `shared_key` to store the buffer once computed.
+    constant_tensor_cache_t::cached_t map_shared_constant_buffer(
+            const std::vector<tensor_t> &inputs,
+            const std::vector<dnnl::memory::desc> &const_mds, size_t size,
+            size_t &shared_key) const;
+
+    // Stores a computed constant buffer for the other processes. Does
+    // nothing if the shared constant cache is disabled.
+    void store_shared_constant_buffer(dnnl::stream &p_stream,
+            size_t shared_key,
+            const constant_tensor_cache_t::cached_t &buffer) const;
+
+    // Pins the cached constant buffer of the key until the kernel is
+    // destroyed.
+    void pin_constant_buffer(size_t key);
+
     const std::vector<inplace_pair_t> &get_inplace_pairs() const;
 
+    // Serializes the cache blobs of the primitives created by the op
+    // executables at compilation. The blob is empty if none of them supports
+    // cache blobs.
+    status_t get_cache_blob(std::vector<uint8_t> &cache_blob) const;
+
+    // Returns the memory held by the primitives created at compilation
+    size_t footprint() const { return footprint_; }
+
 protected:
     std::vector<inplace_pair_t> inplace_pairs_;
     dnnl::engine p_engine_;
     std::shared_ptr<subgraph_t> subgraph_;
+
+private:
+    // The primitives with cache blob ids and their ids
+    std::vector<std::pair<std::vector<uint8_t>, dnnl::primitive>> primitives_;
+    size_t footprint_ = 0;
+
+    // The keys of the constant buffers pinned by the kernel
+    std::vector<size_t> pinned_keys_;
+    std::mutex pinned_mutex_;
 };
 
 using kernel_ptr = std::shared_ptr<kernel_base_t>;
@@ -14,6 +14,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+#include "common/verbose.hpp"
+
 #include "graph/backend/dnnl/kernels/large_partition.hpp"
 
 #include "graph/backend/dnnl/passes/compile_ops.hpp"
@@ -34,6 +38,9 @@ namespace dnnl_impl {
 
 void larger_partition_kernel_t::setup_pipeline_stage1(
         pass_pipeline_t &pipeline) {
+    // Fold the ops without a 1 to 1 mapping into their siblings
+    BACKEND_DNNL_ADD_PASS(pipeline, fuse_bias_add_bwd_to_conv_bwd_weights);
+
     // Directly lower down (1 to 1 mapping)
     BACKEND_DNNL_ADD_PASS(pipeline, lower_down);
 
@@ -45,6 +52,7 @@ void larger_partition_kernel_t::setup_pipeline_stage1(
     BACKEND_DNNL_ADD_PASS(pipeline, fuse_mul_sigmoid_to_swish);
     BACKEND_DNNL_ADD_PASS(pipeline, fuse_to_dnnl_sum);
     BACKEND_DNNL_ADD_PASS(pipeline, fuse_to_shuffle);
+    BACKEND_DNNL_ADD_PASS(pipeline, fold_shuffle_into_conv_weights);
 
     // TODO(xx) The implementation of these two passes relay on a non-fully
     // lowered subgraph. We need to improve them.
@@ -124,6 +132,7 @@ void larger_partition_kernel_t::setup_pipeline_stage1(
     BACKEND_DNNL_ADD_PASS(
             pipeline, insert_permute_for_op_only_require_data_format);
     BACKEND_DNNL_ADD_PASS(pipeline, insert_to_group_for_conv_or_deconv);
+    BACKEND_DNNL_ADD_PASS(pipeline, fold_upsample_into_conv);
     BACKEND_DNNL_ADD_PASS(pipeline, conv_bwd_data_canonicalization);
     BACKEND_DNNL_ADD_PASS(pipeline, conv_bwd_weights_canonicalization);
     BACKEND_DNNL_ADD_PASS(pipeline, batchnorm_bwd_canonicalization);
@@ -142,10 +151,12 @@ void larger_partition_kernel_t::setup_pipeline_stage2(pass_pipeline_t &pipeline,
         BACKEND_DNNL_ADD_PASS(pipeline, constant_propagation);
     }
     BACKEND_DNNL_ADD_PASS(pipeline, infer_shape);
+    BACKEND_DNNL_ADD_PASS(pipeline, mark_in_place_append_concat);
     BACKEND_DNNL_ADD_PASS(pipeline, fuse_src_transpose_to_matmul);
     BACKEND_DNNL_ADD_PASS(pipeline, fuse_dst_transpose_to_predecessor);
     BACKEND_DNNL_ADD_PASS(pipeline, layout_propagation);
     BACKEND_DNNL_ADD_PASS(pipeline, common_reorder_elimination);
+    BACKEND_DNNL_ADD_PASS(pipeline, sink_reorders_by_cost);
     BACKEND_DNNL_ADD_PASS(pipeline, fuse_adjacent_reorders);
 
     // constant propagation
@@ -191,11 +202,13 @@ void larger_partition_kernel_t::prepare_host_scalar_args(
 void larger_partition_kernel_t::prepare_args_set(
         const execution_args_set_t *res, const std::vector<tensor_t> &inputs,
         const std::vector<tensor_t> &outputs, const scratchpad_t &scratchpad) {
-    // update the data of partition in/outputs args
+    // update the data of partition in/outputs args. The outputs are empty
+    // when only the constant executables are run.
     for (const auto &mem_idx : res->get_mems_use_external_inputs()) {
         mem_idx.first.set_data_handle(inputs[mem_idx.second].get_data_handle());
     }
     for (const auto &mem_idx : res->get_mems_use_external_outputs()) {
+        if (outputs.empty()) break;
         mem_idx.first.set_data_handle(
                 outputs[mem_idx.second].get_data_handle());
     }
@@ -208,6 +221,31 @@ void larger_partition_kernel_t::prepare_args_set(
     }
 }
 
+void larger_partition_kernel_t::prepare_exec_waves() {
+    exec_waves_.clear();
+    const auto &levels = memory_planner_.get_exec_levels();
+    if (levels.size() != subgraph_->execs_.size()) return;
+
+    for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
+        if (subgraph_->is_constant_[i]) continue;
+        if (levels[i] >= exec_waves_.size()) exec_waves_.resize(levels[i] + 1);
+        exec_waves_[levels[i]].emplace_back(i);
+    }
+
+    // levels with constant executables only become empty
+    exec_waves_.erase(std::remove_if(exec_waves_.begin(), exec_waves_.end(),
+                              [](const std::vector<size_t> &wave) {
+                                  return wave.empty();
+                              }),
+            exec_waves_.end());
+    // nothing to execute concurrently
+    if (std::all_of(exec_waves_.begin(), exec_waves_.end(),
+                [](const std::vector<size_t> &wave) {
+                    return wave.size() == 1;
+                }))
+        exec_waves_.clear();
+}
+
 status_t larger_partition_kernel_t::compile_impl(
         const dnnl_partition_impl_t *part, const engine_t *g_engine,
         const std::vector<logical_tensor_t> &inputs,
@@ -221,6 +259,14 @@ status_t larger_partition_kernel_t::compile_impl(
             part->get_fpmath_mode(), part->get_use_blocked_layout(), true);
     BACKEND_DNNL_CHECK(set_given_inputs_outputs(subgraph_, inputs, outputs));
 
+    // The independent branches of the subgraph can be executed concurrently on
+    // CPU. The feature is experimental and controlled by an internal env var.
+    memory_planner_.set_inter_op_parallelism(
+            p_engine_.get_kind() == dnnl::engine::kind::cpu
+            && graph::utils::getenv_int_internal(
+                       "ENABLE_INTER_OP_PARALLELISM", 0)
+                    > 0);
+
     // Populate the transform passes into the pipeline
     // Note: `std::call_once` should be kept in a single translation unit since
     // GCC 11.
@@ -234,6 +280,7 @@ status_t larger_partition_kernel_t::compile_impl(
 
     // Run the added passes
     BACKEND_DNNL_CHECK(pipeline_.run(subgraph_));
+    prepare_exec_waves();
 
     // fill information for inputs logical tensors
     for (size_t i = 0; i < inputs.size(); i++) {
@@ -257,6 +304,83 @@ status_t larger_partition_kernel_t::compile_impl(
     return status::success;
 }
 
+constant_tensor_cache_t::cached_t
+larger_partition_kernel_t::prepare_constant_buffer(dnnl::stream &p_stream,
+        execution_args_set_t *res, const std::vector<tensor_t> &inputs,
+        bool pin) {
+    if (!enabled_constant_cache()) return nullptr;
+
+    constant_tensor_cache_t::cached_t c_buffer;
+    const size_t encoded_key
+            = encode_constant_cache_key(inputs, const_md_hash_);
+    std::promise<constant_tensor_cache_t::cached_t> c_promise;
+    constant_tensor_cache_t::value_t cached_value
+            = dnnl_constant_cache_get_or_add(p_engine_, encoded_key,
+                    memory_planner_.total_internal_persistent_size(),
+                    c_promise.get_future());
+    bool is_from_cache = cached_value.valid();
+    if (is_from_cache) {
+        c_buffer = cached_value.get();
+        grantor_t c_grantor = memory_planner_.internal_persistent_grantor(
+                c_buffer->data<char>());
+        for (auto &mem_offkey : res->get_mems_use_internal_persistent()) {
+            mem_offkey.first.set_data_handle(c_grantor.get(mem_offkey.second));
+        }
+    } else {
+        size_t shared_key = 0;
+        c_buffer = map_shared_constant_buffer(inputs,
+                memory_planner_.get_exec_args_set()
+                        .get_persistent_mem_desc_list(),
+                memory_planner_.total_internal_persistent_size(),
+                shared_key);
+        const bool is_shared = c_buffer != nullptr;
+        if (!is_shared) {
+            c_buffer = std::make_shared<dnnl_constant_buffer_t>(
+                    memory_planner_.total_internal_persistent_size(), p_engine_,
+                    g_alloc_);
+        }
+        grantor_t c_grantor = memory_planner_.internal_persistent_grantor(
+                c_buffer->data<char>());
+        for (auto &mem_offkey : res->get_mems_use_internal_persistent()) {
+            mem_offkey.first.set_data_handle(c_grantor.get(mem_offkey.second));
+        }
+
+        if (!is_shared) {
+            for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
+                if (!subgraph_->is_constant_[i]) continue;
+                subgraph_->execs_[i]->execute(
+                        p_stream, res->get_exec_args()[i]);
+            }
+            store_shared_constant_buffer(p_stream, shared_key, c_buffer);
+        }
+
+        c_promise.set_value(c_buffer);
+    }
+    if (pin) pin_constant_buffer(encoded_key);
+    return c_buffer;
+}
+
+status_t larger_partition_kernel_t::prepare_constants_impl(
+        const stream_t *g_stream, const std::vector<tensor_t> &inputs,
+        bool pin) {
+    dnnl::stream p_stream = make_dnnl_stream(p_engine_, *g_stream);
+
+    thread_local_cache_t<execution_args_set_t> res_cache;
+    execution_args_set_t *res = res_cache.get_or_add(
+            reinterpret_cast<size_t>(this), resource_ctor_);
+
+    temporary_scratchpad_t scratchpad(
+            memory_planner_.total_internal_temporary_size(), p_engine_,
+            *g_alloc_);
+    prepare_host_scalar_args(res, inputs);
+    prepare_args_set(res, inputs, {}, scratchpad);
+
+    prepare_constant_buffer(p_stream, res, inputs, pin);
+    // the scratchpad is released on return
+    p_stream.wait();
+    return status::success;
+}
+
 status_t larger_partition_kernel_t::execute_impl(const stream_t *g_stream,
         const std::vector<tensor_t> &inputs,
         const std::vector<tensor_t> &outputs) {
@@ -276,48 +400,62 @@ status_t larger_partition_kernel_t::execute_impl(const stream_t *g_stream,
     prepare_host_scalar_args(res, inputs);
     prepare_args_set(res, inputs, outputs, scratchpad);
 
-    constant_tensor_cache_t::cached_t c_buffer;
-    if (enabled_constant_cache()) {
-        const size_t encoded_key
-                = encode_constant_cache_key(inputs, const_md_hash_);
-        std::promise<constant_tensor_cache_t::cached_t> c_promise;
-        constant_tensor_cache_t::value_t cached_value
-                = dnnl_constant_cache_get_or_add(p_engine_, encoded_key,
-                        memory_planner_.total_internal_persistent_size(),
-                        c_promise.get_future());
-        bool is_from_cache = cached_value.valid();
-        if (is_from_cache) {
-            c_buffer = cached_value.get();
-            grantor_t c_grantor = memory_planner_.internal_persistent_grantor(
-                    c_buffer->data<char>());
-            for (auto &mem_offkey : res->get_mems_use_internal_persistent()) {
-                mem_offkey.first.set_data_handle(
-                        c_grantor.get(mem_offkey.second));
-            }
-        } else {
-            c_buffer = std::make_shared<dnnl_constant_buffer_t>(
-                    memory_planner_.total_internal_persistent_size(), p_engine_,
-                    g_alloc_);
-            grantor_t c_grantor = memory_planner_.internal_persistent_grantor(
-                    c_buffer->data<char>());
-            for (auto &mem_offkey : res->get_mems_use_internal_persistent()) {
-                mem_offkey.first.set_data_handle(
-                        c_grantor.get(mem_offkey.second));
+    constant_tensor_cache_t::cached_t c_buffer
+            = prepare_constant_buffer(p_stream, res, inputs);
+
+    if (get_verbose(verbose_t::exec_profile, component_t::graph)) {
+        // Run the executables one by one and report the time and the bytes
+        // accessed by each of them, with the ids of the user ops it runs.
+        for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
+            if (subgraph_->is_constant_[i]) continue;
+            const auto &args = res->get_exec_args()[i];
+            size_t bytes = 0;
+            for (const auto &arg : args) {
+                if (arg.first == DNNL_ARG_SCRATCHPAD) continue;
+                bytes += arg.second.get_desc().get_size();
             }
 
-            for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
-                if (!subgraph_->is_constant_[i]) continue;
-                subgraph_->execs_[i]->execute(
-                        p_stream, res->get_exec_args()[i]);
-            }
+            p_stream.wait();
+            const double start_ms = get_msec();
+            subgraph_->execs_[i]->execute(p_stream, args);
+            p_stream.wait();
+            const double duration_ms = get_msec() - start_ms;
+            const std::string info = subgraph_->exec_infos_[i] + ","
+                    + std::to_string(bytes);
+            VPROF(start_ms, graph, exec, ":op", info.c_str(), duration_ms);
+        }
+        return status::success;
+    }
 
-            c_promise.set_value(c_buffer);
+    if (exec_waves_.empty()) {
+        for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
+            if (subgraph_->is_constant_[i]) continue;
+            subgraph_->execs_[i]->execute(p_stream, res->get_exec_args()[i]);
         }
+        return status::success;
     }
 
-    for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
-        if (subgraph_->is_constant_[i]) continue;
-        subgraph_->execs_[i]->execute(p_stream, res->get_exec_args()[i]);
+    // The threads are split evenly between the executables of a wave. Each
+    // executable is limited to its share of the threads.
+    const int nthr = dnnl_get_max_threads();
+    for (const auto &wave : exec_waves_) {
+        const int nexecs = static_cast<int>(wave.size());
+        if (nexecs == 1 || nthr == 1) {
+            for (size_t i : wave)
+                subgraph_->execs_[i]->execute(
+                        p_stream, res->get_exec_args()[i]);
+            continue;
+        }
+
+        const int exec_nthr = std::max(1, nthr / nexecs);
+        parallel(std::min(nexecs, nthr), [&](int ithr, int nthr_) {
+            max_threads_limit_guard_t max_threads_guard(exec_nthr);
+            for (int j = ithr; j < nexecs; j += nthr_) {
+                const size_t i = wave[j];
+                subgraph_->execs_[i]->execute(
+                        p_stream, res->get_exec_args()[i]);
+            }
+        });
     }
 
     return status::success;
@@ -53,6 +53,11 @@ protected:
     subgraph_visualizer_t vis_;
     pass_pipeline_t pipeline_;
 
+    // indices of the non-constant executables grouped by levels. The
+    // executables of a level are independent and executed concurrently. Empty
+    // if the subgraph is executed sequentially.
+    std::vector<std::vector<size_t>> exec_waves_;
+
 public:
     larger_partition_kernel_t() {
         thread_local_cache_t<execution_args_set_t> res_cache;
@@ -89,6 +94,17 @@ public:
             const std::vector<tensor_t> &outputs,
             const scratchpad_t &scratchpad);
 
+    void prepare_exec_waves();
+
+    // Binds the cached constant buffer to the executables, computing it on
+    // a cache miss. Returns nullptr if the constant cache is disabled.
+    constant_tensor_cache_t::cached_t prepare_constant_buffer(
+            dnnl::stream &p_stream, execution_args_set_t *res,
+            const std::vector<tensor_t> &inputs, bool pin = false);
+
+    status_t prepare_constants_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs, bool pin) override;
+
     status_t execute_impl(const stream_t *g_stream,
             const std::vector<tensor_t> &inputs,
             const std::vector<tensor_t> &outputs) override;
@@ -49,6 +49,9 @@ status_t matmul_t<quantized>::compile_impl(const dnnl_partition_impl_t *part,
     });
     pass_pipeline_t pipeline(vis);
 
+    if (quantized) {
+        BACKEND_DNNL_ADD_PASS(pipeline, fuse_dynamic_quant_to_matmul);
+    }
     BACKEND_DNNL_ADD_PASS(pipeline, lower_down);
 
     BACKEND_DNNL_ADD_PASS(pipeline, fuse_bias_add);
@@ -156,11 +159,13 @@ template <bool quantized>
 void matmul_t<quantized>::prepare_args_set(const execution_args_set_t *res,
         const std::vector<tensor_t> &inputs,
         const std::vector<tensor_t> &outputs, const scratchpad_t &scratchpad) {
-    // update the data of partition in/outputs args
+    // update the data of partition in/outputs args. The outputs are empty
+    // when only the constant executables are run.
     for (const auto &mem_idx : res->get_mems_use_external_inputs()) {
         mem_idx.first.set_data_handle(inputs[mem_idx.second].get_data_handle());
     }
     for (const auto &mem_idx : res->get_mems_use_external_outputs()) {
+        if (outputs.empty()) break;
         mem_idx.first.set_data_handle(
                 outputs[mem_idx.second].get_data_handle());
     }
@@ -173,6 +178,82 @@ void matmul_t<quantized>::prepare_args_set(const execution_args_set_t *res,
     }
 }
 
+template <bool quantized>
+constant_tensor_cache_t::cached_t matmul_t<quantized>::prepare_constant_buffer(
+        dnnl::stream &p_stream, execution_args_set_t *res,
+        const std::vector<tensor_t> &inputs, bool pin) {
+    if (!enabled_constant_cache()) return nullptr;
+
+    constant_tensor_cache_t::cached_t c_buffer;
+    const size_t encoded_key
+            = encode_constant_cache_key(inputs, const_md_hash_);
+    std::promise<constant_tensor_cache_t::cached_t> c_promise;
+    constant_tensor_cache_t::value_t cached_value
+            = dnnl_constant_cache_get_or_add(p_engine_, encoded_key,
+                    memory_planner_.total_internal_persistent_size(),
+                    c_promise.get_future());
+    bool is_from_cache = cached_value.valid();
+    if (is_from_cache) {
+        c_buffer = cached_value.get();
+        grantor_t c_grantor = memory_planner_.internal_persistent_grantor(
+                c_buffer->data<char>());
+        for (auto &mem_offkey : res->get_mems_use_internal_persistent()) {
+            mem_offkey.first.set_data_handle(c_grantor.get(mem_offkey.second));
+        }
+    } else {
+        size_t shared_key = 0;
+        c_buffer = map_shared_constant_buffer(inputs,
+                memory_planner_.get_exec_args_set()
+                        .get_persistent_mem_desc_list(),
+                memory_planner_.total_internal_persistent_size(),
+                shared_key);
+        const bool is_shared = c_buffer != nullptr;
+        if (!is_shared) {
+            c_buffer = std::make_shared<dnnl_constant_buffer_t>(
+                    memory_planner_.total_internal_persistent_size(), p_engine_,
+                    g_alloc_);
+        }
+        grantor_t c_grantor = memory_planner_.internal_persistent_grantor(
+                c_buffer->data<char>());
+        for (auto &mem_offkey : res->get_mems_use_internal_persistent()) {
+            mem_offkey.first.set_data_handle(c_grantor.get(mem_offkey.second));
+        }
+
+        if (!is_shared) {
+            for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
+                if (!subgraph_->is_constant_[i]) continue;
+                subgraph_->execs_[i]->execute(
+                        p_stream, res->get_exec_args()[i]);
+            }
+            store_shared_constant_buffer(p_stream, shared_key, c_buffer);
+        }
+
+        c_promise.set_value(c_buffer);
+    }
+    if (pin) pin_constant_buffer(encoded_key);
+    return c_buffer;
+}
+
+template <bool quantized>
+status_t matmul_t<quantized>::prepare_constants_impl(const stream_t *g_stream,
+        const std::vector<tensor_t> &inputs, bool pin) {
+    dnnl::stream p_stream = make_dnnl_stream(p_engine_, *g_stream);
+
+    thread_local_cache_t<execution_args_set_t> res_cache;
+    execution_args_set_t *res = res_cache.get_or_add(
+            reinterpret_cast<size_t>(this), resource_ctor_);
+
+    temporary_scratchpad_t scratchpad(
+            memory_planner_.total_internal_temporary_size(), p_engine_,
+            *g_alloc_);
+    prepare_args_set(res, inputs, {}, scratchpad);
+
+    prepare_constant_buffer(p_stream, res, inputs, pin);
+    // the scratchpad is released on return
+    p_stream.wait();
+    return status::success;
+}
+
 template <bool quantized>
 status_t matmul_t<quantized>::execute_impl(const stream_t *g_stream,
         const std::vector<tensor_t> &inputs,
@@ -192,44 +273,8 @@ status_t matmul_t<quantized>::execute_impl(const stream_t *g_stream,
             "no enough scratchpad memory");
     prepare_args_set(res, inputs, outputs, scratchpad);
 
-    constant_tensor_cache_t::cached_t c_buffer;
-    if (enabled_constant_cache()) {
-        const size_t encoded_key
-                = encode_constant_cache_key(inputs, const_md_hash_);
-        std::promise<constant_tensor_cache_t::cached_t> c_promise;
-        constant_tensor_cache_t::value_t cached_value
-                = dnnl_constant_cache_get_or_add(p_engine_, encoded_key,
-                        memory_planner_.total_internal_persistent_size(),
-                        c_promise.get_future());
-        bool is_from_cache = cached_value.valid();
-        if (is_from_cache) {
-            c_buffer = cached_value.get();
-            grantor_t c_grantor = memory_planner_.internal_persistent_grantor(
-                    c_buffer->data<char>());
-            for (auto &mem_offkey : res->get_mems_use_internal_persistent()) {
-                mem_offkey.first.set_data_handle(
-                        c_grantor.get(mem_offkey.second));
-            }
-        } else {
-            c_buffer = std::make_shared<dnnl_constant_buffer_t>(
-                    memory_planner_.total_internal_persistent_size(), p_engine_,
-                    g_alloc_);
-            grantor_t c_grantor = memory_planner_.internal_persistent_grantor(
-                    c_buffer->data<char>());
-            for (auto &mem_offkey : res->get_mems_use_internal_persistent()) {
-                mem_offkey.first.set_data_handle(
-                        c_grantor.get(mem_offkey.second));
-            }
-
-            for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
-                if (!subgraph_->is_constant_[i]) continue;
-                subgraph_->execs_[i]->execute(
-                        p_stream, res->get_exec_args()[i]);
-            }
-
-            c_promise.set_value(c_buffer);
-        }
-    }
+    constant_tensor_cache_t::cached_t c_buffer
+            = prepare_constant_buffer(p_stream, res, inputs);
 
     for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
         if (subgraph_->is_constant_[i]) continue;
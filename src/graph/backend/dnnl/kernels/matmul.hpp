@@ -72,6 +72,15 @@ public:
             const std::vector<tensor_t> &outputs,
             const scratchpad_t &scratchpad);
 
+    // Binds the cached constant buffer to the executables, computing it on
+    // a cache miss. Returns nullptr if the constant cache is disabled.
+    constant_tensor_cache_t::cached_t prepare_constant_buffer(
+            dnnl::stream &p_stream, execution_args_set_t *res,
+            const std::vector<tensor_t> &inputs, bool pin = false);
+
+    status_t prepare_constants_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs, bool pin) override;
+
     status_t execute_impl(const stream_t *g_stream,
             const std::vector<tensor_t> &inputs,
             const std::vector<tensor_t> &outputs) override;
@@ -173,7 +173,7 @@ status_t mqa_decomp_config_t::construct_params(std::shared_ptr<subgraph_t> &sg,
     sub_matmul1_attr.set_post_ops(dnnl_pops);
     auto sub_mm1_pd = matmul::primitive_desc(p_engine, sub_mm1_src_md,
             sub_mm1_wei_md, sub_mm1_dst_md, sub_matmul1_attr);
-    sub_mm1_prim = matmul(sub_mm1_pd);
+    sub_mm1_prim = make_primitive<matmul>(sub_mm1_pd);
 
     // Here in the original graph, we have reshape and transpose op to
     // change the dimension and layout of matmul's output. But with the
@@ -195,7 +195,7 @@ status_t mqa_decomp_config_t::construct_params(std::shared_ptr<subgraph_t> &sg,
             prop_kind::forward_inference, algo, sub_mm1_dst_md,
             sub_softmax_dst_md, sub_mm1_dst_md.get_ndims() - 1,
             sub_softmax_attr);
-    sub_softmax_prim = softmax_forward(sub_softmax_pd);
+    sub_softmax_prim = make_primitive<softmax_forward>(sub_softmax_pd);
 
     // reorder src of second matmul (Value)
     // create reorder2 primitive attr
@@ -228,7 +228,7 @@ status_t mqa_decomp_config_t::construct_params(std::shared_ptr<subgraph_t> &sg,
             = memory::desc(sub_mm2_dst_dims, dt_src_user, format_tag::abc);
     auto sub_mm2_pd = matmul::primitive_desc(p_engine, sub_mm2_src_md,
             sub_mm2_wei_md, sub_mm2_dst_md, sub_matmul2_attr);
-    sub_mm2_prim = matmul(sub_mm2_pd);
+    sub_mm2_prim = make_primitive<matmul>(sub_mm2_pd);
 
     // per-head: reorder dst2 from dense to strided
     primitive_attr sub_reorder3_attr;
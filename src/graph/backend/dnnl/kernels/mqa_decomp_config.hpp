@@ -31,6 +31,7 @@
 
 #include "graph/interface/c_types_map.hpp"
 
+#include "graph/backend/dnnl/op_executable.hpp"
 #include "graph/backend/dnnl/scratchpad.hpp"
 #include "graph/backend/dnnl/subgraph.hpp"
 
@@ -46,7 +47,7 @@ struct mqa_reorder_t {
 public:
     status_t init(const dnnl::reorder::primitive_desc &pd) {
         is_inplace_ = pd.src_desc() == pd.dst_desc();
-        reorder_ = dnnl::reorder(pd);
+        reorder_ = make_primitive<dnnl::reorder>(pd);
         return status::success;
     }
 
@@ -148,6 +148,14 @@ public:
     status_t reset_engine(const engine_t *g_engine) override {
         return kernel->reset_engine(g_engine);
     }
+
+    status_t prepare_inplace_pairs_impl() override {
+        status_t ret = kernel->prepare_inplace_pairs_impl();
+        if (ret != status::success) return ret;
+        inplace_pairs_ = kernel->get_inplace_pairs();
+        return status::success;
+    }
+
     std::string str() const override { return kernel->str(); }
 };
 } // namespace dnnl_impl
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstring>
+
 #include "graph/backend/dnnl/kernels/sdp_decomp.hpp"
 
 #include "graph/backend/dnnl/passes/compile_ops.hpp"
@@ -200,6 +202,47 @@ status_t sdp_decomp_kernel_t<quantized, dt>::execute_impl(
         return memory::data_type_size(m.get_desc().get_data_type());
     };
 
+    const int32_t *k_table = nullptr, *v_table = nullptr;
+    if (sdp_cfg_.is_paged_kv) {
+        k_table = static_cast<const int32_t *>(
+                inputs[sdp_cfg_.graph_inport
+                                [sdp_decomp_config_t::k_block_table]]
+                        .get_data_handle());
+        v_table = static_cast<const int32_t *>(
+                inputs[sdp_cfg_.graph_inport
+                                [sdp_decomp_config_t::v_block_table]]
+                        .get_data_handle());
+    }
+
+    // Copies the pages of a head listed in a block table row one by one into
+    // the consecutive page slots of the buffer of a matmul weights. Negative
+    // block ids mark unused slots, which are zero-filled.
+    const auto load_pages = [&](const sdp_reorder_t &reorder,
+                                    std::unordered_map<int, memory> &args,
+                                    const int32_t *table,
+                                    const dims &table_strides,
+                                    const dims &cache_strides, char *cache,
+                                    dim_t bo, dim_t head, char *buf) {
+        memory &src = args.at(DNNL_ARG_SRC);
+        memory &dst = args.at(DNNL_ARG_DST);
+        const size_t dt_size = get_mem_dt_size(src);
+        const size_t page_size = dst.get_desc().get_size();
+        for (dim_t j = 0; j < sdp_cfg_.kv_blocks_per_seq; j++) {
+            const int32_t blk
+                    = table[bo * table_strides[0] + j * table_strides[1]];
+            char *page = buf + j * page_size;
+            if (blk < 0) {
+                std::memset(page, 0, page_size);
+                continue;
+            }
+            src.set_data_handle(cache
+                    + (blk * cache_strides[0] + head * cache_strides[1])
+                            * dt_size);
+            dst.set_data_handle(page);
+            reorder.execute(strm, args);
+        }
+    };
+
     const auto loop = [&](int tid, int nthr, dim_t bo, dim_t bi) {
         // prepare execution args and allocate real memory
         prepare_sub_args(var_grantor, tid, block_size, res->mem_map);
@@ -371,13 +414,31 @@ status_t sdp_decomp_kernel_t<quantized, dt>::execute_impl(
 
         // in parallel region - these primitives should use single thread.
         sdp_cfg_.sub_reorder0.execute(strm, res->sub_reorder0_args[tid]);
-        sdp_cfg_.sub_reorder1.execute(strm, res->sub_reorder1_args[tid]);
+        if (sdp_cfg_.is_paged_kv) {
+            load_pages(sdp_cfg_.sub_reorder1, res->sub_reorder1_args[tid],
+                    k_table, sdp_cfg_.k_table_strides, sdp_cfg_.wei1_strides,
+                    wei1_user_pointer, bo, wei_head_offset,
+                    static_cast<char *>(
+                            res->mem_map[sdp_cfg_.sub_mm1_wei.get()][tid]
+                                    .get_data_handle()));
+        } else {
+            sdp_cfg_.sub_reorder1.execute(strm, res->sub_reorder1_args[tid]);
+        }
         sdp_cfg_.sub_mm1_prim.execute(strm, res->sub_mm1_args[tid]);
         if (sdp_cfg_.has_select)
             sdp_cfg_.sub_select_prim.execute(strm, res->sub_select_args[tid]);
         sdp_cfg_.sub_softmax_prim.execute(strm, res->sub_softmax_args[tid]);
 
-        sdp_cfg_.sub_reorder2.execute(strm, res->sub_reorder2_args[tid]);
+        if (sdp_cfg_.is_paged_kv) {
+            load_pages(sdp_cfg_.sub_reorder2, res->sub_reorder2_args[tid],
+                    v_table, sdp_cfg_.v_table_strides, sdp_cfg_.wei2_strides,
+                    wei2_user_pointer, bo, wei_head_offset,
+                    static_cast<char *>(
+                            res->mem_map[sdp_cfg_.sub_mm2_wei.get()][tid]
+                                    .get_data_handle()));
+        } else {
+            sdp_cfg_.sub_reorder2.execute(strm, res->sub_reorder2_args[tid]);
+        }
 
         sdp_cfg_.sub_mm2_prim.execute(strm, res->sub_mm2_args[tid]);
         sdp_cfg_.sub_reorder3.execute(strm, res->sub_reorder3_args[tid]);
@@ -57,6 +57,28 @@ bool sdp_decomp_config_t::initial_check(const std::shared_ptr<subgraph_t> &sg,
             static_cast<long int>(wei1_user_dims[1]),
             static_cast<long int>(wei2_user_dims[1]));
 
+    if (is_paged_kv) {
+        VCHECK_SDP_DECOMP(ndims == 4, false,
+                "Paged KV cache requires 4D query, but got %zu",
+                src1_user_dims.size());
+        // The caches are [num_blocks, num_head_kv, block_size, head_size]
+        // and the block tables are [batch_size, max_num_blocks_per_seq].
+        const ltw k_table(inputs[graph_inport[k_block_table]]);
+        const ltw v_table(inputs[graph_inport[v_block_table]]);
+        const dims k_table_dims = k_table.vdims();
+        const dims v_table_dims = v_table.vdims();
+        VCHECK_SDP_DECOMP(wei1_user_dims[2] == wei2_user_dims[2]
+                        && k_table_dims == v_table_dims,
+                false, "Key and value should have the same paging");
+        kv_block_size = wei1_user_dims[2];
+        kv_blocks_per_seq = k_table_dims[1];
+        k_table_strides = k_table.vstrides();
+        v_table_strides = v_table.vstrides();
+        // The batch of the caches is given by the block tables.
+        wei1_user_dims[0] = k_table_dims[0];
+        wei2_user_dims[0] = v_table_dims[0];
+    }
+
     // Check batch size compatibility.
 
     VCHECK_SDP_DECOMP(
@@ -91,6 +113,18 @@ bool sdp_decomp_config_t::initial_check(const std::shared_ptr<subgraph_t> &sg,
             "value:%s",
             dnnl_dt2str(ltw(inputs[graph_inport[mm1_wei]]).data_type()),
             dnnl_dt2str(ltw(inputs[graph_inport[mm2_wei]]).data_type()));
+
+    // fp8 query, key and value are consumed by fp8 matmuls directly, hence
+    // they cannot be mixed with integer or floating-point ones.
+    const auto is_f8 = [](data_type_t dt) {
+        return impl::utils::one_of(dt, data_type::f8_e5m2, data_type::f8_e4m3);
+    };
+    const auto dt_query = ltw(inputs[graph_inport[mm1_src]]).data_type();
+    const auto dt_key = ltw(inputs[graph_inport[mm1_wei]]).data_type();
+    VCHECK_SDP_DECOMP(is_f8(dt_query) == is_f8(dt_key), false,
+            "Query and key should be both fp8 or not. But got query:%s, "
+            "key:%s",
+            dnnl_dt2str(dt_query), dnnl_dt2str(dt_key));
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
 // RATIO is an empirical value used to determine the numerical relationship
 // between batch_size, num_head_q and thread number to determine whether to use
@@ -121,6 +155,8 @@ impl::status_t sdp_decomp_config_t::construct_params(
         const dnnl::engine &p_engine,
         const std::vector<logical_tensor_t> &inputs) {
 
+    VCHECK_SDP_DECOMP(!(quantized && is_paged_kv), status::unimplemented,
+            "Paged KV cache is not supported for quantized sdp");
     // Record the ops inside of SDP pattern for later usage
     CHECK(record_sdp_ops(sg, quantized));
     const int last_dim = ndims - 1, second_last_dim = ndims - 2;
@@ -137,7 +173,13 @@ impl::status_t sdp_decomp_config_t::construct_params(
             ltw(inputs[graph_inport[mm1_src]]).data_type());
     memory::data_type dt_wei_user = static_cast<memory::data_type>(
             ltw(inputs[graph_inport[mm1_wei]]).data_type());
-    memory::data_type dt_wei = quantized ? memory::data_type::s8 : dt_src_user;
+    // Integer keys and values are converted to s8 per head, while fp8 ones
+    // stay in fp8 so that both matmuls and the probabilities are fp8.
+    const bool is_f8_wei = impl::utils::one_of(dt_wei_user,
+            memory::data_type::f8_e5m2, memory::data_type::f8_e4m3);
+    memory::data_type dt_wei = quantized
+            ? (is_f8_wei ? dt_wei_user : memory::data_type::s8)
+            : dt_src_user;
     memory::data_type dt_inter = quantized
             ? dt
             : static_cast<memory::data_type>(
@@ -181,16 +223,26 @@ impl::status_t sdp_decomp_config_t::construct_params(
     dnnl::primitive_attr sub_reorder1_attr
             = make_primitive_attr(sdp_op[0], mgr);
     dims sub_wei1_dims = {head_size_qk, seq_len_kv};
-    auto wei_md = make_dnnl_memory_desc(
-            sdp_op[1]->get_input_value(1)->get_logical_tensor());
-    wei1_strides = wei_md.get_strides();
-    sub_wei1_user_md = memory::desc(sub_wei1_dims, dt_wei_user,
-            {wei1_strides[second_last_dim], wei1_strides[last_dim]});
+    if (is_paged_kv) {
+        // A page of the key cache is [block_size, head_size], it is read as
+        // its transpose into a column block of sub_mm1_wei.
+        sub_wei1_dims = {head_size_qk, kv_block_size};
+        wei1_strides = ltw(inputs[graph_inport[mm1_wei]]).vstrides();
+        sub_wei1_user_md = memory::desc(sub_wei1_dims, dt_wei_user,
+                {wei1_strides[last_dim], wei1_strides[second_last_dim]});
+    } else {
+        auto wei_md = make_dnnl_memory_desc(
+                sdp_op[1]->get_input_value(1)->get_logical_tensor());
+        wei1_strides = wei_md.get_strides();
+        sub_wei1_user_md = memory::desc(sub_wei1_dims, dt_wei_user,
+                {wei1_strides[second_last_dim], wei1_strides[last_dim]});
+    }
     // Flip the format to have `ba` weights MBI item in per thread loop.
     sub_wei1_md = memory::desc(sub_wei1_dims, dt_wei, format_tag::ba);
     auto sub_reorder1_pd = reorder::primitive_desc(p_engine, sub_wei1_user_md,
             p_engine, sub_wei1_md, sub_reorder1_attr);
-    sub_reorder1.init(sub_reorder1_pd);
+    // The pages must be copied to be contiguous.
+    sub_reorder1.init(sub_reorder1_pd, !is_paged_kv);
 
     // first matmul
     // create first matmul primitive attr
@@ -232,7 +284,7 @@ impl::status_t sdp_decomp_config_t::construct_params(
     sub_matmul1_attr.set_post_ops(dnnl_pops);
     auto sub_mm1_pd = matmul::primitive_desc(p_engine, sub_mm1_src_md,
             sub_mm1_wei_md, sub_mm1_dst_md, sub_matmul1_attr);
-    sub_mm1_prim = matmul(sub_mm1_pd);
+    sub_mm1_prim = make_primitive<matmul>(sub_mm1_pd);
 
     //select
     if (has_select) {
@@ -259,7 +311,7 @@ impl::status_t sdp_decomp_config_t::construct_params(
         auto sub_select_pd = binary::primitive_desc(p_engine,
                 algorithm::binary_select, sub_select_src0_md, sub_mm1_dst_md,
                 sub_select_cond_md, sub_mm1_dst_md, sub_select_attr);
-        sub_select_prim = binary(sub_select_pd);
+        sub_select_prim = make_primitive<binary>(sub_select_pd);
     }
 
     // softmax
@@ -295,13 +347,15 @@ impl::status_t sdp_decomp_config_t::construct_params(
             prop_kind::forward_inference, algo, sub_mm1_dst_md,
             sub_softmax_dst_md, sub_mm1_dst_md.get_ndims() - 1,
             sub_softmax_attr);
-    sub_softmax_prim = softmax_forward(sub_softmax_pd);
+    sub_softmax_prim = make_primitive<softmax_forward>(sub_softmax_pd);
 
     // reorder u8->s8 wei for second matmul
     // create reorder2 primitive attr
     dnnl::primitive_attr sub_reorder2_attr
             = make_primitive_attr(sdp_op[3], mgr);
+    // A page of the value cache is a row block of sub_mm2_wei.
     dims sub_wei2_dims = {seq_len_kv, head_size_v};
+    if (is_paged_kv) sub_wei2_dims[0] = kv_block_size;
     wei2_strides = ltw(inputs[graph_inport[mm2_wei]]).vstrides();
     sub_wei2_user_md = memory::desc(sub_wei2_dims, dt_wei_user,
             {wei2_strides[second_last_dim], wei2_strides[last_dim]});
@@ -309,7 +363,7 @@ impl::status_t sdp_decomp_config_t::construct_params(
     auto sub_wei2_md = memory::desc(sub_wei2_dims, dt_wei, format_tag::ab);
     auto sub_reorder2_pd = reorder::primitive_desc(p_engine, sub_wei2_user_md,
             p_engine, sub_wei2_md, sub_reorder2_attr);
-    sub_reorder2.init(sub_reorder2_pd);
+    sub_reorder2.init(sub_reorder2_pd, !is_paged_kv);
 
     // second matmul
     // create second matmul primitive attr
@@ -324,7 +378,7 @@ impl::status_t sdp_decomp_config_t::construct_params(
             = memory::desc(sub_mm2_dst_dims, dt_src_user, format_tag::ab);
     auto sub_mm2_pd = matmul::primitive_desc(p_engine, sub_mm2_src_md,
             sub_mm2_wei_md, sub_mm2_dst_md, sub_matmul2_attr);
-    sub_mm2_prim = matmul(sub_mm2_pd);
+    sub_mm2_prim = make_primitive<matmul>(sub_mm2_pd);
 
     // per-head: reorder dst2 from dense to strided
     primitive_attr sub_reorder3_attr;
@@ -379,6 +433,7 @@ impl::status_t sdp_decomp_config_t::construct_params(
     sub_src1 = memory(sub_src1_md, p_engine, nullptr);
     // reorder1: 2d strided u8 -> 2d ba s8
     sub_wei1_user = memory(sub_wei1_user_md, p_engine, nullptr);
+    if (is_paged_kv) sub_wei1_page = memory(sub_wei1_md, p_engine, nullptr);
     // mm1
     sub_mm1_src = memory(sub_mm1_src_md, p_engine, nullptr);
     sub_mm1_wei = memory(sub_mm1_wei_md, p_engine, nullptr);
@@ -413,6 +468,7 @@ impl::status_t sdp_decomp_config_t::construct_params(
     }
     // reorder2
     sub_wei2_user = memory(sub_wei2_user_md, p_engine, nullptr);
+    if (is_paged_kv) sub_wei2_page = memory(sub_wei2_md, p_engine, nullptr);
     // mm2
     sub_mm2_wei = memory(sub_mm2_wei_md, p_engine, nullptr);
     sub_mm2_dst = memory(sub_mm2_dst_md, p_engine, nullptr);
@@ -426,7 +482,8 @@ impl::status_t sdp_decomp_config_t::construct_params(
             {DNNL_ARG_SCRATCHPAD, sub_scratchpad}};
 
     sub_reorder1_args = {{DNNL_ARG_SRC, sub_wei1_user},
-            {DNNL_ARG_DST, sub_mm1_wei}, {DNNL_ARG_SCRATCHPAD, sub_scratchpad}};
+            {DNNL_ARG_DST, is_paged_kv ? sub_wei1_page : sub_mm1_wei},
+            {DNNL_ARG_SCRATCHPAD, sub_scratchpad}};
 
     sub_mm1_args = {{DNNL_ARG_SRC, sub_mm1_src},
             {DNNL_ARG_WEIGHTS, sub_mm1_wei}, {DNNL_ARG_DST, sub_mm1_dst},
@@ -456,7 +513,8 @@ impl::status_t sdp_decomp_config_t::construct_params(
     }
 
     sub_reorder2_args = {{DNNL_ARG_SRC, sub_wei2_user},
-            {DNNL_ARG_DST, sub_mm2_wei}, {DNNL_ARG_SCRATCHPAD, sub_scratchpad}};
+            {DNNL_ARG_DST, is_paged_kv ? sub_wei2_page : sub_mm2_wei},
+            {DNNL_ARG_SCRATCHPAD, sub_scratchpad}};
 
     sub_mm2_args = {{DNNL_ARG_SRC, sub_softmax_dst},
             {DNNL_ARG_WEIGHTS, sub_mm2_wei}, {DNNL_ARG_DST, sub_mm2_dst},
@@ -519,6 +577,11 @@ impl::status_t sdp_decomp_config_t::record_input_offset(
             = {graph::op_kind::Divide, graph::op_kind::Multiply,
                     graph::op_kind::Add, graph::op_kind::Select,
                     graph::op_kind::SoftMax};
+    for (const auto &cur_op : sg->get_ops()) {
+        VCHECK_SDP_DECOMP(cur_op->get_kind() != graph::op_kind::Concat,
+                status::unimplemented,
+                "Decomposed kernel does not support KV cache concat");
+    }
     for (const auto &cur_op : sg->get_ops()) {
         const auto &op_kind = cur_op->get_kind();
         VCHECK_SDP_DECOMP(op_kind != graph::op_kind::GenIndex,
@@ -644,6 +707,38 @@ impl::status_t sdp_decomp_config_t::record_input_offset(
         graph_inport.emplace_back(-1);
         graph_inport.emplace_back(-1);
     }
+
+    // Paged KV cache: the caches are the inputs of mm1_wei and mm2_wei found
+    // above, the block tables are recorded here.
+    const auto get_paged_load = [](const op_ptr &mm) -> op_ptr {
+        const auto in_val = mm->get_input_value(1);
+        if (!in_val->has_producer()
+                || in_val->get_producer().get_kind()
+                        != graph::op_kind::PagedCacheLoad)
+            return nullptr;
+        return in_val->get_producer().shared_from_this();
+    };
+    const op_ptr load_k = get_paged_load(mm1), load_v = get_paged_load(mm2);
+    VCHECK_SDP_DECOMP((load_k == nullptr) == (load_v == nullptr),
+            status::unimplemented,
+            "Key and value should be both paged or both not paged");
+    is_paged_kv = load_k != nullptr;
+    if (is_paged_kv) {
+        // Pages are [block_size, head_size] so the key must be transposed
+        // by the first matmul and the value must not by the second.
+        VCHECK_SDP_DECOMP(mm1->get_attr<bool>(op_attr::transpose_b)
+                        && !mm2->get_attr<bool>(op_attr::transpose_b),
+                status::unimplemented,
+                "Paged KV cache requires transpose_b of matmul 1 only");
+        graph_inport.emplace_back(
+                find_graph_inport(load_k->get_input_value(1)));
+        graph_inport.emplace_back(
+                find_graph_inport(load_v->get_input_value(1)));
+    } else {
+        //placeholder
+        graph_inport.emplace_back(-1);
+        graph_inport.emplace_back(-1);
+    }
     return status::success;
 }
 
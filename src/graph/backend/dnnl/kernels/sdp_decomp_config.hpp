@@ -31,6 +31,7 @@
 
 #include "graph/interface/c_types_map.hpp"
 
+#include "graph/backend/dnnl/op_executable.hpp"
 #include "graph/backend/dnnl/scratchpad.hpp"
 #include "graph/backend/dnnl/subgraph.hpp"
 
@@ -45,11 +46,14 @@ using registry_key = size_t;
 // TODO: merge with mqa_reorder_t
 struct sdp_reorder_t {
 public:
-    status_t init(const dnnl::reorder::primitive_desc &pd) {
+    // When allow_inplace is false, the reorder always copies the data even
+    // if src and dst have the same layout.
+    status_t init(const dnnl::reorder::primitive_desc &pd,
+            bool allow_inplace = true) {
         auto src_desc = pd.src_desc();
         auto dst_desc = pd.dst_desc();
-        if (src_desc == dst_desc) is_inplace_ = true;
-        reorder_prim_ = reorder(pd);
+        if (allow_inplace && src_desc == dst_desc) is_inplace_ = true;
+        reorder_prim_ = make_primitive<reorder>(pd);
         return status::success;
     }
 
@@ -89,11 +93,19 @@ public:
     dims src1_strides, wei1_strides, wei2_strides, dst_strides,
             post_add_strides;
 
+    // Paged KV cache. When key and value are loaded from paged caches, the
+    // pages listed in the block tables are copied one by one into the
+    // per-thread buffers, and wei1_strides and wei2_strides are the strides
+    // of the caches.
+    bool is_paged_kv = false;
+    dim_t kv_block_size = 0, kv_blocks_per_seq = 0;
+    dims k_table_strides, v_table_strides;
+
     // Thread nums during the workflow
     int nthr;
 
     // Used to record the exact input offset in subgraph
-    // [mm1_src,mm1_wei,mm2_wei,mm1_scale,mm1_soft_capping,mm1_add,select_condition,select_other_input]
+    // [mm1_src,mm1_wei,mm2_wei,mm1_scale,mm1_soft_capping,mm1_add,select_condition,select_other_input,k_block_table,v_block_table]
     std::vector<int> graph_inport;
     enum input_index_t {
         mm1_src = 0,
@@ -103,7 +115,9 @@ public:
         mm1_soft_capping,
         mm1_add,
         select_condition,
-        select_other_input
+        select_other_input,
+        k_block_table,
+        v_block_table
     };
 
     // Primitives that actually perform calculations
@@ -124,6 +138,8 @@ public:
     memory sub_src1;
     // reorder1
     memory sub_wei1_user, sub_wei1_zp;
+    // a page of sub_mm1_wei, the dst of reorder1 for paged KV cache
+    memory sub_wei1_page;
     //mm1
     memory sub_mm1_src, sub_mm1_wei, sub_mm1_dst;
     // sub_mm1_post_mem contains [post_scale, attn_mask(optional)]
@@ -134,6 +150,8 @@ public:
     memory sub_softmax_dst;
     //reorder2
     memory sub_wei2_user, sub_wei2_zp;
+    // a page of sub_mm2_wei, the dst of reorder2 for paged KV cache
+    memory sub_wei2_page;
     //mm2
     memory sub_mm2_wei, sub_mm2_dst;
     //reorder3
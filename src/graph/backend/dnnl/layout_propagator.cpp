@@ -1438,8 +1438,20 @@ status_t layout_propagator_for_conv_bwd_weights(op_ptr &op,
             "failed to fill layout info for reorder after conv_bwd_weights "
             "diff_weights");
 
+    const bool with_bias = op->has_attr(op_attr::with_bias)
+            && op->get_attr<bool>(op_attr::with_bias);
+    if (with_bias) {
+        insert_reorder_after(op, 1, pd.diff_bias_desc(), p_engine, mgr,
+                pd_cache, rewriter);
+        value_ptr diff_bias = op->get_output_value(1);
+        status = fill_layout_info(diff_bias, pd.diff_bias_desc());
+        VCHECK_LAYOUT_PROPAGATOR(status == status::success, status,
+                "failed to fill layout info for reorder after "
+                "conv_bwd_weights diff_bias");
+    }
+
     // fill scratchpads dimensions and data type to scratchpad value_t
-    auto scratchpad_val = op->get_output_value(1);
+    auto scratchpad_val = op->get_output_value(with_bias ? 2 : 1);
     const memory::desc scratchpad_desc = pd.scratchpad_desc();
     status = fill_layout_info(scratchpad_val, scratchpad_desc);
     return status;
@@ -1709,6 +1721,95 @@ status_t layout_propagator_for_mask(std::shared_ptr<op_t> &op,
     return status;
 }
 
+status_t layout_propagator_for_rotary_embedding(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
+        pd_cache_t &pd_cache, subgraph_rewriter_t &rewriter) {
+    // The op is computed by a reference loop on the host.
+    VCHECK_LAYOUT_PROPAGATOR(p_engine.get_kind() == engine::kind::cpu,
+            status::unimplemented,
+            "rotary embedding is only supported on CPU engine");
+
+    // All tensors are dense and plain, the broadcast of cos and sin is
+    // resolved by the executable.
+    for (size_t i = 0; i < op->num_inputs(); i++) {
+        const auto &in_lt = op->get_input_value(i)->get_logical_tensor();
+        const auto md = make_dnnl_memory_desc(in_lt);
+        const auto plain_md = dnnl::memory::desc(md.get_dims(),
+                md.get_data_type(), get_ncx_format(md.get_ndims()));
+        insert_reorder_before(
+                op, i, plain_md, p_engine, mgr, pd_cache, rewriter);
+    }
+
+    const auto src_md = make_dnnl_memory_desc(
+            op->get_input_value(0)->get_logical_tensor());
+    const auto &dst_lt = op->get_output_value(0)->get_logical_tensor();
+    const auto dst_md = dnnl::memory::desc(src_md.get_dims(),
+            static_cast<dnnl::memory::data_type>(dst_lt.data_type),
+            get_ncx_format(src_md.get_ndims()));
+    insert_reorder_after(op, 0, dst_md, p_engine, mgr, pd_cache, rewriter);
+    value_ptr dst_val = op->get_output_value(0);
+    return fill_layout_info(dst_val, dst_md);
+}
+
+status_t layout_propagator_for_paged_cache_load(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
+        pd_cache_t &pd_cache, subgraph_rewriter_t &rewriter) {
+    // The pages are copied by a loop on the host.
+    VCHECK_LAYOUT_PROPAGATOR(p_engine.get_kind() == engine::kind::cpu,
+            status::unimplemented,
+            "paged cache load is only supported on CPU engine");
+
+    // The cache is read with its own strides, as reordering it would copy
+    // all the pages. The block table is small and made plain.
+    const auto table_md = make_dnnl_memory_desc(
+            op->get_input_value(1)->get_logical_tensor());
+    const auto plain_table_md = dnnl::memory::desc(table_md.get_dims(),
+            table_md.get_data_type(), dnnl::memory::format_tag::ab);
+    insert_reorder_before(
+            op, 1, plain_table_md, p_engine, mgr, pd_cache, rewriter);
+
+    const auto &dst_lt = op->get_output_value(0)->get_logical_tensor();
+    const auto dst_md = dnnl::memory::desc(ltw(dst_lt).vdims(),
+            static_cast<dnnl::memory::data_type>(dst_lt.data_type),
+            dnnl::memory::format_tag::abcd);
+    insert_reorder_after(op, 0, dst_md, p_engine, mgr, pd_cache, rewriter);
+    value_ptr dst_val = op->get_output_value(0);
+    return fill_layout_info(dst_val, dst_md);
+}
+
+status_t layout_propagator_for_gather(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
+        pd_cache_t &pd_cache, subgraph_rewriter_t &rewriter) {
+    // The rows are copied by a loop on the host.
+    VCHECK_LAYOUT_PROPAGATOR(p_engine.get_kind() == engine::kind::cpu,
+            status::unimplemented, "gather is only supported on CPU engine");
+    VCHECK_LAYOUT_PROPAGATOR(
+            op->get_input_value(1)->get_logical_tensor().ndims > 0,
+            status::unimplemented, "gather doesn't support scalar indices");
+    VCHECK_LAYOUT_PROPAGATOR(
+            op->get_output_value(0)->get_logical_tensor().ndims <= 6,
+            status::unimplemented, "gather supports up to 6D dst");
+
+    // All tensors are dense and plain, so a gathered slice is contiguous in
+    // both src and dst.
+    for (size_t i = 0; i < op->num_inputs(); i++) {
+        const auto &in_lt = op->get_input_value(i)->get_logical_tensor();
+        const auto md = make_dnnl_memory_desc(in_lt);
+        const auto plain_md = dnnl::memory::desc(md.get_dims(),
+                md.get_data_type(), get_ncx_format(md.get_ndims()));
+        insert_reorder_before(
+                op, i, plain_md, p_engine, mgr, pd_cache, rewriter);
+    }
+
+    const auto &dst_lt = op->get_output_value(0)->get_logical_tensor();
+    const auto dst_md = dnnl::memory::desc(ltw(dst_lt).vdims(),
+            static_cast<dnnl::memory::data_type>(dst_lt.data_type),
+            get_ncx_format(dst_lt.ndims));
+    insert_reorder_after(op, 0, dst_md, p_engine, mgr, pd_cache, rewriter);
+    value_ptr dst_val = op->get_output_value(0);
+    return fill_layout_info(dst_val, dst_md);
+}
+
 status_t layout_propagator_for_sdpa(std::shared_ptr<op_t> &op,
         const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
         pd_cache_t &pd_cache, subgraph_rewriter_t &rewriter) {
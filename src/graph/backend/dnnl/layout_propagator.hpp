@@ -95,6 +95,9 @@ DECLARE_LAYOUT_PROPAGATOR(gen_index);
 DECLARE_LAYOUT_PROPAGATOR(mask);
 DECLARE_LAYOUT_PROPAGATOR(sdpa);
 DECLARE_LAYOUT_PROPAGATOR(host_scalar);
+DECLARE_LAYOUT_PROPAGATOR(rotary_embedding);
+DECLARE_LAYOUT_PROPAGATOR(paged_cache_load);
+DECLARE_LAYOUT_PROPAGATOR(gather);
 
 #undef DECLARE_LAYOUT_PROPAGATOR
 
@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  *******************************************************************************/
+#include <cstring>
 #include <map>
 #include <memory>
 #include <string>
@@ -26,6 +27,7 @@
 #include <graph/utils/utils.hpp>
 
 #include "common/dnnl_thread.hpp"
+#include "common/primitive_iface.hpp"
 #include "common/stream.hpp"
 
 #include "graph/backend/dnnl/common.hpp"
@@ -40,6 +42,15 @@ namespace impl {
 namespace graph {
 namespace dnnl_impl {
 
+primitive_cache_blob_scope_t *&primitive_cache_blob_scope_t::current() {
+    thread_local primitive_cache_blob_scope_t *scope = nullptr;
+    return scope;
+}
+
+size_t primitive_cache_blob_scope_t::footprint(const dnnl::primitive &prim) {
+    return prim ? prim.get()->footprint() : 0;
+}
+
 #define VCHECK_OP_EXECUTABLE(cond, msg, ...) \
     if (!(cond)) { VERROR(graph, op_executable, msg, ##__VA_ARGS__); }
 
@@ -350,6 +361,10 @@ matmul_executable_t::desc_t matmul_executable_t::create_desc(
         int64_t key = op->get_attr<int64_t>(op_attr::fusion_info_key);
         prm_attr = make_dnnl_primitive_attr(op, mgr.get_info(key));
     }
+    if (op->has_attr(op_attr::is_src_dyn_quant)
+            && op->get_attr<bool>(op_attr::is_src_dyn_quant)) {
+        prm_attr.set_src_dynamic_quantization(dnnl::memory::data_type::s8);
+    }
     prm_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     auto fpmath = mgr.get_fpmath_mode();
     prm_attr.set_fpmath_mode(
@@ -723,11 +738,16 @@ layernorm_executable_t::desc_t layernorm_executable_t::create_desc(
     bool use_affine = true;
     if (op->has_attr(op_attr::use_affine))
         use_affine = op->get_attr<bool>(op_attr::use_affine);
+    const bool is_rms_norm = op->has_attr(op_attr::is_rms_norm)
+            && op->get_attr<bool>(op_attr::is_rms_norm);
 
     auto flags = dnnl::normalization_flags::none;
-    if (use_affine)
-        flags |= (dnnl::normalization_flags::use_scale
-                | dnnl::normalization_flags::use_shift);
+    if (is_rms_norm) flags |= dnnl::normalization_flags::rms_norm;
+    if (use_affine) {
+        flags |= dnnl::normalization_flags::use_scale;
+        // rms_norm has no shift
+        if (!is_rms_norm) flags |= dnnl::normalization_flags::use_shift;
+    }
 
     prop_kind pkind = keep_stats ? prop_kind::forward_training
                                  : prop_kind::forward_inference;
@@ -896,14 +916,31 @@ conv_bwd_weights_executable_t::create_desc(std::shared_ptr<op_t> &op,
             op->get_output_value(0)->get_logical_tensor());
     diff_weight = to_format_any(diff_weight);
 
-    auto fwd_hints = dnnl::convolution_forward::primitive_desc(p_engine,
-            dnnl::prop_kind::forward_training,
-            dnnl::algorithm::convolution_direct, src, diff_weight, diff_dst,
-            strides, dilates, pads_begin, pads_end);
+    dnnl::convolution_backward_weights::primitive_desc pd;
+    if (op->has_attr(op_attr::with_bias)
+            && op->get_attr<bool>(op_attr::with_bias)) {
+        auto diff_bias = make_dnnl_memory_desc(
+                op->get_output_value(1)->get_logical_tensor());
+        diff_bias = to_format_any(diff_bias);
+        auto fwd_hints = dnnl::convolution_forward::primitive_desc(p_engine,
+                dnnl::prop_kind::forward_training,
+                dnnl::algorithm::convolution_direct, src, diff_weight,
+                diff_bias, diff_dst, strides, dilates, pads_begin, pads_end);
+
+        pd = dnnl::convolution_backward_weights::primitive_desc(p_engine,
+                dnnl::algorithm::convolution_direct, src, diff_weight,
+                diff_bias, diff_dst, strides, dilates, pads_begin, pads_end,
+                fwd_hints);
+    } else {
+        auto fwd_hints = dnnl::convolution_forward::primitive_desc(p_engine,
+                dnnl::prop_kind::forward_training,
+                dnnl::algorithm::convolution_direct, src, diff_weight,
+                diff_dst, strides, dilates, pads_begin, pads_end);
 
-    dnnl::convolution_backward_weights::primitive_desc pd(p_engine,
-            dnnl::algorithm::convolution_direct, src, diff_weight, diff_dst,
-            strides, dilates, pads_begin, pads_end, fwd_hints);
+        pd = dnnl::convolution_backward_weights::primitive_desc(p_engine,
+                dnnl::algorithm::convolution_direct, src, diff_weight,
+                diff_dst, strides, dilates, pads_begin, pads_end, fwd_hints);
+    }
 
     pd_cache.insert({op.get(), pd});
 
@@ -1067,18 +1104,24 @@ concat_executable_t::desc_t concat_executable_t::create_desc(
     }
     prm_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
 
+    // The given layouts of the inputs and the output are kept for in-place
+    // appending, as the first input is a part of the output buffer.
+    const bool is_in_place_append = op->has_attr(op_attr::is_in_place_append)
+            && op->get_attr<bool>(op_attr::is_in_place_append);
+    auto make_desc = [&](const logical_tensor_t &lt) {
+        const auto tmp_desc = make_dnnl_memory_desc(lt);
+        if (is_in_place_append && logical_tensor_wrapper_t(lt).is_strided())
+            return tmp_desc;
+        return memory::desc {tmp_desc.get_dims(), tmp_desc.get_data_type(),
+                get_forced_format_tag(tmp_desc.get_dims())};
+    };
+
     std::vector<memory::desc> src_mds;
     src_mds.reserve(op->num_inputs());
     for (const auto &in_val : op->get_input_values()) {
-        const auto tmp_desc
-                = make_dnnl_memory_desc(in_val->get_logical_tensor());
-        src_mds.emplace_back(tmp_desc.get_dims(), tmp_desc.get_data_type(),
-                get_forced_format_tag(tmp_desc.get_dims()));
+        src_mds.emplace_back(make_desc(in_val->get_logical_tensor()));
     }
-    const auto tmp_desc = make_dnnl_memory_desc(
-            op->get_output_value(0)->get_logical_tensor());
-    auto dst = memory::desc {tmp_desc.get_dims(), tmp_desc.get_data_type(),
-            get_forced_format_tag(tmp_desc.get_dims())};
+    auto dst = make_desc(op->get_output_value(0)->get_logical_tensor());
 
     dnnl::concat::primitive_desc pd(
             p_engine, dst, static_cast<int>(axis), src_mds, prm_attr);
@@ -1816,6 +1859,220 @@ void genindex_executable_t ::execute(const stream &stream,
     stream.get()->after_exec_hook();
 }
 
+rotary_embedding_executable_t::rotary_embedding_executable_t(
+        std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+        fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
+    UNUSED(p_engine);
+    UNUSED(mgr);
+    UNUSED(pd_cache);
+    const auto &src_lt = op->get_input_value(0)->get_logical_tensor();
+    const auto &cs_lt = op->get_input_value(1)->get_logical_tensor();
+    ndims_ = src_lt.ndims - 1;
+    d_ = src_lt.dims[ndims_];
+    rows_ = 1;
+    // cos and sin are aligned with src to the right.
+    const int bcast_ndims = src_lt.ndims - cs_lt.ndims;
+    dim_t cs_stride = 1;
+    for (int i = ndims_ - 1; i >= 0; i--) {
+        row_dims_[i] = src_lt.dims[i];
+        rows_ *= row_dims_[i];
+        const dim_t cs_dim
+                = i >= bcast_ndims ? cs_lt.dims[i - bcast_ndims] : 1;
+        cs_row_strides_[i] = cs_dim == 1 ? 0 : cs_stride;
+        cs_stride *= cs_dim;
+    }
+    src_dt_ = src_lt.data_type;
+    cs_dt_ = cs_lt.data_type;
+}
+
+namespace {
+template <typename src_t, typename cs_t>
+void rotary_embedding(const src_t *src, const cs_t *cos, const cs_t *sin,
+        src_t *dst, int ndims, dim_t rows, dim_t d, const dims_t row_dims,
+        const dims_t cs_row_strides) {
+    const dim_t half = d / 2;
+    dnnl::impl::parallel_nd(rows, [&](dim_t r) {
+        dim_t cs_row = 0;
+        dim_t idx = r;
+        for (int i = ndims - 1; i >= 0; i--) {
+            cs_row += (idx % row_dims[i]) * cs_row_strides[i];
+            idx /= row_dims[i];
+        }
+        const src_t *x = src + r * d;
+        src_t *y = dst + r * d;
+        const cs_t *c = cos + cs_row * d;
+        const cs_t *s = sin + cs_row * d;
+        // Both halves are read before they are written, so src and dst may
+        // share the buffer.
+        PRAGMA_OMP_SIMD()
+        for (dim_t i = 0; i < half; i++) {
+            const float x0 = static_cast<float>(x[i]);
+            const float x1 = static_cast<float>(x[i + half]);
+            const float c0 = static_cast<float>(c[i]);
+            const float c1 = static_cast<float>(c[i + half]);
+            const float s0 = static_cast<float>(s[i]);
+            const float s1 = static_cast<float>(s[i + half]);
+            y[i] = static_cast<src_t>(x0 * c0 - x1 * s0);
+            y[i + half] = static_cast<src_t>(x1 * c1 + x0 * s1);
+        }
+    });
+}
+
+template <typename src_t>
+void rotary_embedding(const void *src, const void *cos, const void *sin,
+        void *dst, data_type_t cs_dt, int ndims, dim_t rows, dim_t d,
+        const dims_t row_dims, const dims_t cs_row_strides) {
+#define CASE(dt, cs_t) \
+    case dt: \
+        rotary_embedding(static_cast<const src_t *>(src), \
+                static_cast<const cs_t *>(cos), \
+                static_cast<const cs_t *>(sin), static_cast<src_t *>(dst), \
+                ndims, rows, d, row_dims, cs_row_strides); \
+        break;
+    switch (cs_dt) {
+        CASE(graph::data_type::f32, float)
+        CASE(graph::data_type::bf16, dnnl::impl::bfloat16_t)
+        CASE(graph::data_type::f16, dnnl::impl::float16_t)
+        default: assert(!"unsupported data type");
+    }
+#undef CASE
+}
+} // namespace
+
+void rotary_embedding_executable_t::execute(const stream &stream,
+        const std::unordered_map<int, memory> &args) const {
+    const void *src = args.at(DNNL_ARG_SRC).get_data_handle();
+    const void *cos = args.at(DNNL_ARG_SRC_1).get_data_handle();
+    const void *sin = args.at(DNNL_ARG_SRC_2).get_data_handle();
+    void *dst = args.at(DNNL_ARG_DST).get_data_handle();
+
+    stream.get()->before_exec_hook();
+    switch (src_dt_) {
+        case graph::data_type::f32:
+            rotary_embedding<float>(src, cos, sin, dst, cs_dt_, ndims_, rows_,
+                    d_, row_dims_, cs_row_strides_);
+            break;
+        case graph::data_type::bf16:
+            rotary_embedding<dnnl::impl::bfloat16_t>(src, cos, sin, dst, cs_dt_,
+                    ndims_, rows_, d_, row_dims_, cs_row_strides_);
+            break;
+        case graph::data_type::f16:
+            rotary_embedding<dnnl::impl::float16_t>(src, cos, sin, dst, cs_dt_,
+                    ndims_, rows_, d_, row_dims_, cs_row_strides_);
+            break;
+        default: assert(!"unsupported data type");
+    }
+    stream.get()->after_exec_hook();
+}
+
+paged_cache_load_executable_t::paged_cache_load_executable_t(
+        std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+        fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
+    UNUSED(p_engine);
+    UNUSED(mgr);
+    UNUSED(pd_cache);
+    const auto &cache_lt = op->get_input_value(0)->get_logical_tensor();
+    const auto &table_lt = op->get_input_value(1)->get_logical_tensor();
+    const auto cache_strides = logical_tensor_wrapper_t(cache_lt).vstrides();
+    batch_ = table_lt.dims[0];
+    blocks_ = table_lt.dims[1];
+    head_ = cache_lt.dims[1];
+    block_size_ = cache_lt.dims[2];
+    head_size_ = cache_lt.dims[3];
+    for (size_t i = 0; i < cache_strides.size(); i++)
+        cache_strides_[i] = cache_strides[i];
+    dt_size_ = memory::data_type_size(
+            static_cast<memory::data_type>(cache_lt.data_type));
+}
+
+void paged_cache_load_executable_t::execute(const stream &stream,
+        const std::unordered_map<int, memory> &args) const {
+    const char *cache = static_cast<const char *>(
+            args.at(DNNL_ARG_SRC).get_data_handle());
+    const int32_t *table = static_cast<const int32_t *>(
+            args.at(DNNL_ARG_SRC_1).get_data_handle());
+    char *dst = static_cast<char *>(args.at(DNNL_ARG_DST).get_data_handle());
+
+    const size_t row_size = head_size_ * dt_size_;
+    const bool dense_rows = cache_strides_[3] == 1;
+
+    stream.get()->before_exec_hook();
+    dnnl::impl::parallel_nd(batch_, head_, blocks_,
+            [&](dim_t b, dim_t h, dim_t j) {
+                const int32_t blk = table[b * blocks_ + j];
+                char *d = dst
+                        + (((b * head_ + h) * blocks_ + j) * block_size_)
+                                * row_size;
+                if (blk < 0) {
+                    std::memset(d, 0, block_size_ * row_size);
+                    return;
+                }
+                const char *s = cache
+                        + (blk * cache_strides_[0] + h * cache_strides_[1])
+                                * dt_size_;
+                for (dim_t r = 0; r < block_size_; r++) {
+                    const char *s_row = s + r * cache_strides_[2] * dt_size_;
+                    char *d_row = d + r * row_size;
+                    if (dense_rows) {
+                        std::memcpy(d_row, s_row, row_size);
+                        continue;
+                    }
+                    for (dim_t k = 0; k < head_size_; k++)
+                        std::memcpy(d_row + k * dt_size_,
+                                s_row + k * cache_strides_[3] * dt_size_,
+                                dt_size_);
+                }
+            });
+    stream.get()->after_exec_hook();
+}
+
+gather_executable_t::gather_executable_t(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
+        pd_cache_t &pd_cache) {
+    UNUSED(p_engine);
+    UNUSED(mgr);
+    UNUSED(pd_cache);
+    const auto &src_lt = op->get_input_value(0)->get_logical_tensor();
+    const auto &indices_lt = op->get_input_value(1)->get_logical_tensor();
+    const auto src_dims = logical_tensor_wrapper_t(src_lt).vdims();
+    auto axis = op->get_attr<int64_t>(op_attr::axis);
+    if (axis < 0) axis += src_lt.ndims;
+
+    outer_ = 1;
+    inner_ = 1;
+    for (int64_t i = 0; i < axis; i++)
+        outer_ *= src_dims[i];
+    for (int64_t i = axis + 1; i < src_lt.ndims; i++)
+        inner_ *= src_dims[i];
+    axis_dim_ = src_dims[axis];
+    nindices_ = logical_tensor_wrapper_t(indices_lt).nelems();
+    dt_size_ = memory::data_type_size(
+            static_cast<memory::data_type>(src_lt.data_type));
+}
+
+void gather_executable_t::execute(const stream &stream,
+        const std::unordered_map<int, memory> &args) const {
+    const char *src = static_cast<const char *>(
+            args.at(DNNL_ARG_SRC).get_data_handle());
+    const int32_t *indices = static_cast<const int32_t *>(
+            args.at(DNNL_ARG_SRC_1).get_data_handle());
+    char *dst = static_cast<char *>(args.at(DNNL_ARG_DST).get_data_handle());
+
+    const size_t slice_size = inner_ * dt_size_;
+
+    stream.get()->before_exec_hook();
+    dnnl::impl::parallel_nd(outer_, nindices_, [&](dim_t o, dim_t i) {
+        char *d = dst + (o * nindices_ + i) * slice_size;
+        const int32_t idx = indices[i];
+        if (idx < 0 || idx >= axis_dim_) {
+            std::memset(d, 0, slice_size);
+            return;
+        }
+        std::memcpy(d, src + (o * axis_dim_ + idx) * slice_size, slice_size);
+    });
+    stream.get()->after_exec_hook();
+}
+
 static void get_arg_indices_for_post_ops(const op_t *op, fusion_info_mgr_t &mgr,
         arg_indices_t &indices, size_t &base_index) {
     const fusion_info_t &fusion_info
@@ -2146,8 +2403,13 @@ arg_indices_t conv_bwd_weights_executable_t::get_arg_indices(
     arg_indices.insert({DNNL_ARG_SRC, indices_t {input, 0}});
     arg_indices.insert({DNNL_ARG_DIFF_DST, indices_t {input, 1}});
 
-    arg_indices.insert({DNNL_ARG_DIFF_WEIGHTS, indices_t {output, 0}});
-    arg_indices.insert({DNNL_ARG_SCRATCHPAD, indices_t {output, 1}});
+    size_t index = 0;
+    arg_indices.insert({DNNL_ARG_DIFF_WEIGHTS, indices_t {output, index++}});
+    if (op->has_attr(op_attr::with_bias)
+            && op->get_attr<bool>(op_attr::with_bias)) {
+        arg_indices.insert({DNNL_ARG_DIFF_BIAS, indices_t {output, index++}});
+    }
+    arg_indices.insert({DNNL_ARG_SCRATCHPAD, indices_t {output, index++}});
 
     return arg_indices;
 }
@@ -2248,7 +2510,9 @@ static arg_indices_t get_arg_indices_for_lnorm_and_gnorm(
     if (!op->has_attr(op_attr::use_affine)
             || op->get_attr<bool>(op_attr::use_affine)) {
         arg_indices.insert({DNNL_ARG_SCALE, indices_t {input, in_index++}});
-        arg_indices.insert({DNNL_ARG_SHIFT, indices_t {input, in_index++}});
+        if (!op->has_attr(op_attr::is_rms_norm)
+                || !op->get_attr<bool>(op_attr::is_rms_norm))
+            arg_indices.insert({DNNL_ARG_SHIFT, indices_t {input, in_index++}});
     }
 
     const fusion_info_t &fusion_info
@@ -2436,6 +2700,46 @@ arg_indices_t genindex_executable_t::get_arg_indices(
     return arg_indices;
 }
 
+arg_indices_t rotary_embedding_executable_t::get_arg_indices(
+        const op_t *op, fusion_info_mgr_t &mgr) {
+    UNUSED(op);
+    UNUSED(mgr);
+
+    arg_indices_t arg_indices;
+    arg_indices.insert({DNNL_ARG_SRC, indices_t {input, 0}});
+    arg_indices.insert({DNNL_ARG_SRC_1, indices_t {input, 1}});
+    arg_indices.insert({DNNL_ARG_SRC_2, indices_t {input, 2}});
+    arg_indices.insert({DNNL_ARG_DST, indices_t {output, 0}});
+
+    return arg_indices;
+}
+
+arg_indices_t paged_cache_load_executable_t::get_arg_indices(
+        const op_t *op, fusion_info_mgr_t &mgr) {
+    UNUSED(op);
+    UNUSED(mgr);
+
+    arg_indices_t arg_indices;
+    arg_indices.insert({DNNL_ARG_SRC, indices_t {input, 0}});
+    arg_indices.insert({DNNL_ARG_SRC_1, indices_t {input, 1}});
+    arg_indices.insert({DNNL_ARG_DST, indices_t {output, 0}});
+
+    return arg_indices;
+}
+
+arg_indices_t gather_executable_t::get_arg_indices(
+        const op_t *op, fusion_info_mgr_t &mgr) {
+    UNUSED(op);
+    UNUSED(mgr);
+
+    arg_indices_t arg_indices;
+    arg_indices.insert({DNNL_ARG_SRC, indices_t {input, 0}});
+    arg_indices.insert({DNNL_ARG_SRC_1, indices_t {input, 1}});
+    arg_indices.insert({DNNL_ARG_DST, indices_t {output, 0}});
+
+    return arg_indices;
+}
+
 arg_indices_t sdpa_executable_t::get_arg_indices(
         const op_t *op, fusion_info_mgr_t &mgr) {
     UNUSED(mgr);
@@ -18,6 +18,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -176,6 +177,93 @@ inline std::shared_ptr<op_executable_t> executable_creator(
             const dnnl::engine &p_engine, fusion_info_mgr_t &mgr, \
             pd_cache_t &pd_cache);
 
+// Creates the primitives of op executables. While a scope is active on the
+// current thread, a primitive whose cache blob id is found in the blobs of the
+// scope is created from the cache blob, and every primitive with a cache blob
+// id is recorded so that its cache blob can be queried after compilation. The
+// memory held by the primitives created while the scope is active is summed up
+// in the footprint of the scope.
+class primitive_cache_blob_scope_t {
+public:
+    using blob_t = std::vector<uint8_t>;
+
+    primitive_cache_blob_scope_t(const std::map<blob_t, blob_t> &blobs)
+        : blobs_(blobs), prev_(current()) {
+        current() = this;
+    }
+
+    ~primitive_cache_blob_scope_t() { current() = prev_; }
+
+    primitive_cache_blob_scope_t(const primitive_cache_blob_scope_t &) = delete;
+    primitive_cache_blob_scope_t &operator=(
+            const primitive_cache_blob_scope_t &)
+            = delete;
+
+    // Makes a scope the active scope of the current thread, used by the
+    // threads creating op executables concurrently.
+    class thread_guard_t {
+    public:
+        thread_guard_t(primitive_cache_blob_scope_t *scope) : prev_(current()) {
+            current() = scope;
+        }
+        ~thread_guard_t() { current() = prev_; }
+
+        thread_guard_t(const thread_guard_t &) = delete;
+        thread_guard_t &operator=(const thread_guard_t &) = delete;
+
+    private:
+        primitive_cache_blob_scope_t *prev_;
+    };
+
+    static primitive_cache_blob_scope_t *get_current() { return current(); }
+
+    template <typename prim_t>
+    static prim_t create(const typename prim_t::primitive_desc &pd) {
+        primitive_cache_blob_scope_t *scope = current();
+        if (!scope) return prim_t(pd);
+        blob_t id = pd.get_cache_blob_id();
+
+        prim_t prim;
+        const auto it
+                = id.empty() ? scope->blobs_.end() : scope->blobs_.find(id);
+        if (it != scope->blobs_.end()) {
+            // A blob from another driver or device is not usable, the
+            // primitive is created as usual then.
+            try {
+                prim = prim_t(pd, it->second);
+            } catch (const dnnl::error &) { prim = prim_t(pd); }
+        } else {
+            prim = prim_t(pd);
+        }
+        const size_t bytes = footprint(prim);
+        std::lock_guard<std::mutex> lock(scope->mutex_);
+        scope->footprint_ += bytes;
+        if (!id.empty()) scope->created_.emplace_back(std::move(id), prim);
+        return prim;
+    }
+
+    const std::vector<std::pair<blob_t, dnnl::primitive>> &created() const {
+        return created_;
+    }
+
+    size_t footprint() const { return footprint_; }
+
+private:
+    static primitive_cache_blob_scope_t *&current();
+    static size_t footprint(const dnnl::primitive &prim);
+
+    const std::map<blob_t, blob_t> &blobs_;
+    std::vector<std::pair<blob_t, dnnl::primitive>> created_;
+    size_t footprint_ = 0;
+    std::mutex mutex_;
+    primitive_cache_blob_scope_t *prev_;
+};
+
+template <typename prim_t>
+inline prim_t make_primitive(const typename prim_t::primitive_desc &pd) {
+    return primitive_cache_blob_scope_t::create<prim_t>(pd);
+}
+
 // This class is a dummy executable which doesn't do any actual computation.
 // This dummy executable can be used to:
 // - support data formatting ops like permute/reshape/transpose
@@ -531,7 +619,7 @@ struct conv_fwd_executable_t : public op_executable_t {
             const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
             pd_cache_t &pd_cache) {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::convolution_forward(desc);
+        prim_ = make_primitive<dnnl::convolution_forward>(desc);
         if (op->has_attr(op_attr::with_sum))
             with_sum_ = op->get_attr<bool>(op_attr::with_sum);
     }
@@ -710,7 +798,7 @@ struct deconv_fwd_executable_t : public op_executable_t {
             const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
             pd_cache_t &pd_cache) {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::deconvolution_forward(desc);
+        prim_ = make_primitive<dnnl::deconvolution_forward>(desc);
         if (op->has_attr(op_attr::with_sum))
             with_sum_ = op->get_attr<bool>(op_attr::with_sum);
     }
@@ -790,7 +878,7 @@ struct deconv_bwd_data_executable_t : public op_executable_t {
             const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
             pd_cache_t &pd_cache) {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::deconvolution_backward_data(desc);
+        prim_ = make_primitive<dnnl::deconvolution_backward_data>(desc);
     }
 
     void execute(const stream &stream,
@@ -831,7 +919,7 @@ struct deconv_bwd_weights_executable_t : public op_executable_t {
             const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
             pd_cache_t &pd_cache) {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::deconvolution_backward_weights(desc);
+        prim_ = make_primitive<dnnl::deconvolution_backward_weights>(desc);
     }
 
     void execute(const stream &stream,
@@ -880,7 +968,7 @@ struct matmul_executable_t : public op_executable_t {
         }
 
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::matmul(desc);
+        prim_ = make_primitive<dnnl::matmul>(desc);
 
         // The scratchpad size of pd created by using any format tag may be
         // different from the scratchpad size of pd created by using queried
@@ -1005,7 +1093,7 @@ struct eltwise_executable_t : public op_executable_t {
             const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
             pd_cache_t &pd_cache) {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::eltwise_forward(desc);
+        prim_ = make_primitive<dnnl::eltwise_forward>(desc);
     }
 
     void execute(const stream &stream,
@@ -1045,7 +1133,7 @@ struct eltwise_bwd_executable_t : public op_executable_t {
             const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
             pd_cache_t &pd_cache) {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::eltwise_backward(desc);
+        prim_ = make_primitive<dnnl::eltwise_backward>(desc);
     }
 
     void execute(const stream &stream,
@@ -1094,7 +1182,7 @@ struct binary_executable_t : public op_executable_t {
         }
 
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::binary(desc);
+        prim_ = make_primitive<dnnl::binary>(desc);
 
         if (op->has_attr(op_attr::with_sum))
             with_sum_ = op->get_attr<bool>(op_attr::with_sum);
@@ -1202,16 +1290,64 @@ private:
 struct concat_executable_t : public op_executable_t {
     DECLARE_DESC_CLASS_AND_CREATOR(dnnl::concat::primitive_desc);
     DECLARE_ARG_INDICES_GETTER;
-    DECLARE_RESET_ENGINE(dnnl::concat);
 
     concat_executable_t(std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
             fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
+        // the inputs are written into the output by their producers, see
+        // memory_planner_t::prepare_zero_copy_concat()
+        if (op->has_attr(op_attr::is_zero_copy)
+                && op->get_attr<bool>(op_attr::is_zero_copy)) {
+            is_dummy_ = true;
+            return;
+        }
+
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::concat(desc);
+        prim_ = make_primitive<dnnl::concat>(desc);
+
+        // the rest of inputs are copied to their sub-memories of the output
+        // when the first input is already in the output buffer, see
+        // mark_in_place_append_concat()
+        if (op->has_attr(op_attr::is_in_place_append)
+                && op->get_attr<bool>(op_attr::is_in_place_append)) {
+            const auto dst_md = desc.dst_desc();
+            const auto res = utils::try_reverse_axis(
+                    op->get_attr<int64_t>(op_attr::axis), dst_md.get_ndims());
+            const auto axis = res.second;
+            memory::dims offsets(dst_md.get_ndims(), 0);
+            for (int i = 1; i < static_cast<int>(op->num_inputs()); i++) {
+                offsets[axis] += desc.src_desc(i - 1).get_dims()[axis];
+                const auto src_md = desc.src_desc(i);
+                const auto sub_md
+                        = dst_md.submemory_desc(src_md.get_dims(), offsets);
+                append_mds_.emplace_back(sub_md);
+                append_prims_.emplace_back(dnnl::reorder::primitive_desc(
+                        p_engine, src_md, p_engine, sub_md));
+            }
+        }
     }
 
     void execute(const stream &stream,
             const std::unordered_map<int, memory> &args) const override {
+        if (is_dummy_) {
+            dummy_impl_.execute(stream, args);
+            return;
+        }
+        if (!append_prims_.empty()) {
+            const memory &src = args.at(DNNL_ARG_MULTIPLE_SRC);
+            const memory &dst = args.at(DNNL_ARG_DST);
+            if (src.get_data_handle() == dst.get_data_handle()) {
+                for (size_t i = 0; i < append_prims_.size(); i++) {
+                    const int arg = DNNL_ARG_MULTIPLE_SRC + 1
+                            + static_cast<int>(i);
+                    memory sub(append_mds_[i], stream.get_engine(),
+                            dst.get_data_handle());
+                    append_prims_[i].execute(stream,
+                            {{DNNL_ARG_FROM, args.at(arg)},
+                                    {DNNL_ARG_TO, sub}});
+                }
+                return;
+            }
+        }
         prim_.execute(stream, args);
     }
 
@@ -1219,6 +1355,7 @@ struct concat_executable_t : public op_executable_t {
     ::sycl::event execute_sycl(const stream &stream,
             const std::unordered_map<int, memory> &args,
             const std::vector<::sycl::event> &deps) const override {
+        if (is_dummy_) { return dummy_impl_.execute_sycl(stream, args, deps); }
         auto e = dnnl::sycl_interop::execute(prim_, stream, args, deps);
         if (stream.get_engine().get_kind() == engine::kind::cpu) e.wait();
         return e;
@@ -1229,13 +1366,36 @@ struct concat_executable_t : public op_executable_t {
     cl_event execute_ocl(const stream &stream,
             const std::unordered_map<int, memory> &args,
             const std::vector<cl_event> &deps) const override {
+        if (is_dummy_) { return dummy_impl_.execute_ocl(stream, args, deps); }
         auto e = dnnl::ocl_interop::execute(prim_, stream, args, deps);
         return e;
     }
 #endif
 
+    status_t reset_engine(const dnnl::engine &p_engine) override {
+        if (is_dummy_) return status::success;
+        const auto desc_t = prim_.get_primitive_desc()->impl();
+        dnnl_primitive_desc new_pd_t(desc_t, p_engine.get());
+        dnnl::concat::primitive_desc new_pd(&new_pd_t);
+        prim_ = dnnl::concat(new_pd);
+        for (auto &append_prim : append_prims_) {
+            const auto append_desc_t
+                    = append_prim.get_primitive_desc()->impl();
+            dnnl_primitive_desc new_append_pd_t(
+                    append_desc_t, p_engine.get());
+            dnnl::reorder::primitive_desc new_append_pd(&new_append_pd_t);
+            append_prim = dnnl::reorder(new_append_pd);
+        }
+        return status::success;
+    }
+
 private:
     dnnl::concat prim_;
+    bool is_dummy_ {false};
+    dummy_impl_t dummy_impl_;
+    // reorders of the rest of inputs to the output for in-place appending
+    std::vector<dnnl::reorder> append_prims_;
+    std::vector<memory::desc> append_mds_;
 };
 
 struct shuffle_executable_t : public op_executable_t {
@@ -1247,7 +1407,7 @@ struct shuffle_executable_t : public op_executable_t {
             const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
             pd_cache_t &pd_cache) {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::shuffle_forward(desc);
+        prim_ = make_primitive<dnnl::shuffle_forward>(desc);
     }
 
     void execute(const stream &stream,
@@ -1286,7 +1446,7 @@ struct pool_executable_t : public op_executable_t {
     pool_executable_t(std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
             fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::pooling_forward(desc);
+        prim_ = make_primitive<dnnl::pooling_forward>(desc);
     }
 
     void execute(const stream &stream,
@@ -1326,7 +1486,7 @@ struct pool_bwd_executable_t : public op_executable_t {
             const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
             pd_cache_t &pd_cache) {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::pooling_backward(desc);
+        prim_ = make_primitive<dnnl::pooling_backward>(desc);
     }
 
     void execute(const stream &stream,
@@ -1365,7 +1525,7 @@ struct prelu_executable_t : public op_executable_t {
     prelu_executable_t(std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
             fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::prelu_forward(desc);
+        prim_ = make_primitive<dnnl::prelu_forward>(desc);
     }
 
     void execute(const stream &stream,
@@ -1405,7 +1565,7 @@ struct prelu_bwd_executable_t : public op_executable_t {
             const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
             pd_cache_t &pd_cache) {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::prelu_backward(desc);
+        prim_ = make_primitive<dnnl::prelu_backward>(desc);
     }
 
     void execute(const stream &stream,
@@ -1445,7 +1605,7 @@ struct reorder_executable_t : public op_executable_t {
             const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
             pd_cache_t &pd_cache) {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::reorder(desc);
+        prim_ = make_primitive<dnnl::reorder>(desc);
         if (op->has_attr(op_attr::with_sum))
             with_sum_ = op->get_attr<bool>(op_attr::with_sum);
     }
@@ -1575,16 +1735,16 @@ struct bn_folding_t : public op_executable_t {
     bn_folding_t(std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
             fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
         desc_ = create_desc(op, p_engine, mgr, pd_cache);
-        add_prim_ = dnnl::binary(desc_.add_pd_);
+        add_prim_ = make_primitive<dnnl::binary>(desc_.add_pd_);
 #if DNNL_GPU_RUNTIME != DNNL_RUNTIME_NONE \
         && DNNL_GPU_VENDOR == DNNL_VENDOR_NVIDIA
         // binary + sqrt post-op fusion is unsupported on NVIDIA GPU
         if (p_engine.get_kind() == dnnl::engine::kind::gpu) {
-            sqrt_prim_ = dnnl::eltwise_forward(desc_.sqrt_pd_);
+            sqrt_prim_ = make_primitive<dnnl::eltwise_forward>(desc_.sqrt_pd_);
         }
 #endif
-        mul_prim_ = dnnl::binary(desc_.mul_pd_);
-        sub_prim_ = dnnl::binary(desc_.sub_pd_);
+        mul_prim_ = make_primitive<dnnl::binary>(desc_.mul_pd_);
+        sub_prim_ = make_primitive<dnnl::binary>(desc_.sub_pd_);
     }
 
     void execute(const stream &stream,
@@ -1964,7 +2124,7 @@ struct conv_bwd_data_executable_t : public op_executable_t {
             const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
             pd_cache_t &pd_cache) {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::convolution_backward_data(desc);
+        prim_ = make_primitive<dnnl::convolution_backward_data>(desc);
     }
 
     void execute(const stream &stream,
@@ -2005,7 +2165,7 @@ struct conv_bwd_weights_executable_t : public op_executable_t {
             const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
             pd_cache_t &pd_cache) {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::convolution_backward_weights(desc);
+        prim_ = make_primitive<dnnl::convolution_backward_weights>(desc);
     }
 
     void execute(const stream &stream,
@@ -2051,7 +2211,7 @@ struct batchnorm_executable_t : public op_executable_t {
             momentum = op->get_attr<float>(op_attr::momentum);
         scales_ = {momentum, 1 - momentum};
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::batch_normalization_forward(desc);
+        prim_ = make_primitive<dnnl::batch_normalization_forward>(desc);
     }
 
     void execute(const stream &stream,
@@ -2224,7 +2384,7 @@ struct batchnorm_bwd_executable_t : public op_executable_t {
             const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
             pd_cache_t &pd_cache) {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::batch_normalization_backward(desc);
+        prim_ = make_primitive<dnnl::batch_normalization_backward>(desc);
     }
 
     void execute(const stream &stream,
@@ -2264,7 +2424,7 @@ struct resampling_executable_t : public op_executable_t {
             const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
             pd_cache_t &pd_cache) {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::resampling_forward(desc);
+        prim_ = make_primitive<dnnl::resampling_forward>(desc);
         if (op->has_attr(op_attr::with_sum))
             with_sum_ = op->get_attr<bool>(op_attr::with_sum);
     }
@@ -2349,7 +2509,7 @@ struct resampling_bwd_executable_t : public op_executable_t {
             const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
             pd_cache_t &pd_cache) {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::resampling_backward(desc);
+        prim_ = make_primitive<dnnl::resampling_backward>(desc);
     }
 
     void execute(const stream &stream,
@@ -2390,7 +2550,7 @@ struct layernorm_executable_t : public op_executable_t {
             const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
             pd_cache_t &pd_cache) {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::layer_normalization_forward(desc);
+        prim_ = make_primitive<dnnl::layer_normalization_forward>(desc);
     }
 
     void execute(const stream &stream,
@@ -2431,7 +2591,7 @@ struct layernorm_bwd_executable_t : public op_executable_t {
             const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
             pd_cache_t &pd_cache) {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::layer_normalization_backward(desc);
+        prim_ = make_primitive<dnnl::layer_normalization_backward>(desc);
     }
 
     void execute(const stream &stream,
@@ -2470,7 +2630,7 @@ struct sum_executable_t : public op_executable_t {
     sum_executable_t(std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
             fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::sum(desc);
+        prim_ = make_primitive<dnnl::sum>(desc);
     }
 
     void execute(const stream &stream,
@@ -2510,7 +2670,7 @@ struct softmax_executable_t : public op_executable_t {
             const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
             pd_cache_t &pd_cache) {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::softmax_forward(desc);
+        prim_ = make_primitive<dnnl::softmax_forward>(desc);
     }
 
     void execute(const stream &stream,
@@ -2550,7 +2710,7 @@ struct softmax_bwd_executable_t : public op_executable_t {
             const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
             pd_cache_t &pd_cache) {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::softmax_backward(desc);
+        prim_ = make_primitive<dnnl::softmax_backward>(desc);
     }
 
     void execute(const stream &stream,
@@ -2590,7 +2750,7 @@ struct reduction_executable_t : public op_executable_t {
             const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
             pd_cache_t &pd_cache) {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::reduction(desc);
+        prim_ = make_primitive<dnnl::reduction>(desc);
 
         if (op->has_attr(op_attr::with_sum))
             with_sum_ = op->get_attr<bool>(op_attr::with_sum);
@@ -2673,7 +2833,7 @@ struct groupnorm_executable_t : public op_executable_t {
             const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
             pd_cache_t &pd_cache) {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
-        prim_ = dnnl::group_normalization_forward(desc);
+        prim_ = make_primitive<dnnl::group_normalization_forward>(desc);
     }
 
     void execute(const stream &stream,
@@ -2866,6 +3026,175 @@ private:
 #endif
 };
 
+// Rotates the pairs of elements (i, i + D / 2) of every row of the last src
+// dimension D by the angles given with cos and sin. All tensors are dense and
+// plain, cos and sin are broadcast to src. CPU only.
+struct rotary_embedding_executable_t : public op_executable_t {
+    DECLARE_ARG_INDICES_GETTER;
+
+    rotary_embedding_executable_t(std::shared_ptr<op_t> &op,
+            const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
+            pd_cache_t &pd_cache);
+
+    void execute(const stream &stream,
+            const std::unordered_map<int, memory> &args) const override;
+
+#ifdef DNNL_WITH_SYCL
+    ::sycl::event execute_sycl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<::sycl::event> &deps) const override {
+        auto strm_t = stream.get();
+        auto *sycl_stream_impl = dnnl::impl::utils::downcast<
+                dnnl::impl::xpu::sycl::stream_impl_t *>(strm_t->impl());
+
+        strm_t->before_exec_hook();
+        if (!deps.empty()) { sycl_stream_impl->sycl_ctx().set_deps(deps); }
+
+        execute(stream, args);
+
+        ::sycl::event return_event = sycl_stream_impl->get_output_event();
+        strm_t->after_exec_hook();
+        return return_event;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    cl_event execute_ocl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<cl_event> &deps) const override {
+        UNUSED(stream);
+        UNUSED(args);
+        UNUSED(deps);
+        assertm(false, "rotary embedding is only implemented for CPU");
+        throw std::runtime_error("Unimplement");
+    }
+#endif
+
+    status_t reset_engine(const dnnl::engine &p_engine) override {
+        UNUSED(p_engine);
+        return status::success;
+    }
+
+private:
+    // src is rows_ rows of d_ elements. A row of cos and sin is found by
+    // the strides of cos and sin over the row dimensions of src, which are
+    // zero for the broadcast ones.
+    int ndims_;
+    dim_t rows_, d_;
+    dims_t row_dims_, cs_row_strides_;
+    data_type_t src_dt_, cs_dt_;
+};
+
+// Gathers the pages of a paged KV cache listed in a block table into a dense
+// [batch, head, blocks * block_size, head_size] tensor. Negative block ids
+// mark unused slots, which are zero-filled. CPU only.
+struct paged_cache_load_executable_t : public op_executable_t {
+    DECLARE_ARG_INDICES_GETTER;
+
+    paged_cache_load_executable_t(std::shared_ptr<op_t> &op,
+            const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
+            pd_cache_t &pd_cache);
+
+    void execute(const stream &stream,
+            const std::unordered_map<int, memory> &args) const override;
+
+#ifdef DNNL_WITH_SYCL
+    ::sycl::event execute_sycl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<::sycl::event> &deps) const override {
+        auto strm_t = stream.get();
+        auto *sycl_stream_impl = dnnl::impl::utils::downcast<
+                dnnl::impl::xpu::sycl::stream_impl_t *>(strm_t->impl());
+
+        strm_t->before_exec_hook();
+        if (!deps.empty()) { sycl_stream_impl->sycl_ctx().set_deps(deps); }
+
+        execute(stream, args);
+
+        ::sycl::event return_event = sycl_stream_impl->get_output_event();
+        strm_t->after_exec_hook();
+        return return_event;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    cl_event execute_ocl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<cl_event> &deps) const override {
+        UNUSED(stream);
+        UNUSED(args);
+        UNUSED(deps);
+        assertm(false, "paged cache load is only implemented for CPU");
+        throw std::runtime_error("Unimplement");
+    }
+#endif
+
+    status_t reset_engine(const dnnl::engine &p_engine) override {
+        UNUSED(p_engine);
+        return status::success;
+    }
+
+private:
+    dim_t batch_, head_, blocks_, block_size_, head_size_;
+    // Strides of the cache in elements, in the order of its dimensions.
+    dims_t cache_strides_;
+    size_t dt_size_;
+};
+
+// Gathers the slices of src along an axis at the given indices. An index out of
+// the range of the axis produces a slice of zeros. CPU only.
+struct gather_executable_t : public op_executable_t {
+    DECLARE_ARG_INDICES_GETTER;
+
+    gather_executable_t(std::shared_ptr<op_t> &op,
+            const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
+            pd_cache_t &pd_cache);
+
+    void execute(const stream &stream,
+            const std::unordered_map<int, memory> &args) const override;
+
+#ifdef DNNL_WITH_SYCL
+    ::sycl::event execute_sycl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<::sycl::event> &deps) const override {
+        auto strm_t = stream.get();
+        auto *sycl_stream_impl = dnnl::impl::utils::downcast<
+                dnnl::impl::xpu::sycl::stream_impl_t *>(strm_t->impl());
+
+        strm_t->before_exec_hook();
+        if (!deps.empty()) { sycl_stream_impl->sycl_ctx().set_deps(deps); }
+
+        execute(stream, args);
+
+        ::sycl::event return_event = sycl_stream_impl->get_output_event();
+        strm_t->after_exec_hook();
+        return return_event;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    cl_event execute_ocl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<cl_event> &deps) const override {
+        UNUSED(stream);
+        UNUSED(args);
+        UNUSED(deps);
+        assertm(false, "gather is only implemented for CPU");
+        throw std::runtime_error("Unimplement");
+    }
+#endif
+
+    status_t reset_engine(const dnnl::engine &p_engine) override {
+        UNUSED(p_engine);
+        return status::success;
+    }
+
+private:
+    // src is viewed as [outer, axis, inner] and dst as [outer, indices, inner]
+    dim_t outer_, axis_dim_, inner_, nindices_;
+    size_t dt_size_;
+};
+
 struct sdpa_executable_t : public op_executable_t {
     DECLARE_ARG_INDICES_GETTER;
 
@@ -14,10 +14,15 @@
  * limitations under the License.
  *******************************************************************************/
 
+#include <algorithm>
+#include <exception>
 #include <memory>
+#include <string>
 #include <vector>
 #include <unordered_map>
 
+#include "common/dnnl_thread.hpp"
+
 #include "graph/interface/c_types_map.hpp"
 #include "graph/interface/value.hpp"
 
@@ -35,6 +40,40 @@ namespace dnnl {
 namespace impl {
 namespace graph {
 namespace dnnl_impl {
+
+namespace {
+// Returns "<op name>,<user op ids>" of an op, where the ids of the op itself
+// and of the ops fused into it are joined with '+'.
+std::string get_exec_info(const op_t *op, const fusion_info_mgr_t &mgr) {
+    std::vector<const op_t *> srcs {op};
+    if (op->has_attr(op_attr::fusion_info_key)
+            && op->get_attr<int64_t>(op_attr::fusion_info_key) != -1) {
+        const int64_t key = op->get_attr<int64_t>(op_attr::fusion_info_key);
+        const auto fused_ops = mgr.get_info(key).get_fused_ops();
+        srcs.insert(srcs.end(), fused_ops.begin(), fused_ops.end());
+    }
+
+    std::vector<size_t> ids;
+    for (const op_t *src : srcs) {
+        if (src->is_fused()) {
+            ids.insert(ids.end(), src->get_op_ids().begin(),
+                    src->get_op_ids().end());
+        } else if (src->get_id() != op_t::DEFAULT_ID) {
+            ids.emplace_back(src->get_id());
+        }
+    }
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+    std::string info = op->get_name() + ",";
+    for (size_t i = 0; i < ids.size(); ++i) {
+        if (i > 0) info += "+";
+        info += std::to_string(ids[i]);
+    }
+    return info;
+}
+} // namespace
+
 /// After the lower down, infer shape, infer type and layout propagation passes,
 /// each op in the subgraph will has complete attributes and each edge will have
 /// complete shape/dtype/layout information. We can create executable for these
@@ -42,9 +81,9 @@ namespace dnnl_impl {
 status_t compile_ops(std::shared_ptr<subgraph_t> &sg) {
     auto &mgr = sg->fusion_info_mgr_;
     const auto &p_engine = *(sg->p_engine_);
-    auto &pd_cache = sg->pd_cache_;
 
-    return topo_order_visit(sg->get_output_ops(), [&](op_t *op) {
+    std::vector<op_t *> ops;
+    CHECK(topo_order_visit(sg->get_output_ops(), [&](op_t *op) {
         const op_schema_t *opm
                 = op_schema_registry_t::get_op_schema(op->get_kind());
 
@@ -55,17 +94,61 @@ status_t compile_ops(std::shared_ptr<subgraph_t> &sg) {
                 status::invalid_graph_op,
                 "no executable creator in schema of op %s",
                 op->get_name().c_str());
+        ops.emplace_back(op);
+        return status::success;
+    }));
+
+    // The executables don't depend on each other, so they are created
+    // concurrently. Each op gets its own copy of the pd cache entry since the
+    // cache is not thread-safe.
+    const size_t nops = ops.size();
+    std::vector<std::shared_ptr<op_executable_t>> execs(nops);
+    std::vector<pd_cache_t> pd_caches(nops);
+    for (size_t i = 0; i < nops; i++) {
+        const auto it = sg->pd_cache_.find(ops[i]);
+        if (it != sg->pd_cache_.end()) pd_caches[i].insert(*it);
+    }
 
-        auto cur_op = op->shared_from_this();
+    // Exceptions can't leave a parallel region, they are rethrown after it.
+    std::vector<std::exception_ptr> errors(nops);
+    primitive_cache_blob_scope_t *scope
+            = primitive_cache_blob_scope_t::get_current();
+    const auto create = [&](size_t i) {
+        primitive_cache_blob_scope_t::thread_guard_t guard(scope);
+        auto cur_op = ops[i]->shared_from_this();
+        const op_schema_t *opm
+                = op_schema_registry_t::get_op_schema(cur_op->get_kind());
         auto creator = opm->get_additional_item<executable_creator_func>(
                 "executable_creator");
+        try {
+            execs[i] = creator(cur_op, p_engine, mgr, pd_caches[i]);
+        } catch (...) { errors[i] = std::current_exception(); }
+    };
+
+    const int nthr = nstl::min(static_cast<int>(nops), dnnl_get_max_threads());
+    if (nthr <= 1 || dnnl_in_parallel()) {
+        for (size_t i = 0; i < nops; i++)
+            create(i);
+    } else {
+        parallel(nthr, [&](int ithr, int nthr_) {
+            for (size_t i = ithr; i < nops; i += nthr_)
+                create(i);
+        });
+    }
 
-        std::shared_ptr<op_executable_t> exec
-                = creator(cur_op, p_engine, mgr, pd_cache);
+    for (const auto &error : errors)
+        if (error) std::rethrow_exception(error);
+
+    for (size_t i = 0; i < nops; i++) {
+        op_t *op = ops[i];
+        for (auto &entry : pd_caches[i])
+            sg->pd_cache_[entry.first] = std::move(entry.second);
+
+        const auto &exec = execs[i];
         VCHECK_COMPILE_OPS(exec != nullptr, status::invalid_graph_op,
                 "unimplemented op, can't compile op %s",
                 op->get_name().c_str());
-        if (cur_op->get_kind() == op_kind::dnnl_sdpa) {
+        if (op->get_kind() == op_kind::dnnl_sdpa) {
             auto sdpa_exec = std::dynamic_pointer_cast<sdpa_executable_t>(exec);
             VCHECK_COMPILE_OPS(sdpa_exec->is_initialized(),
                     status::unimplemented,
@@ -73,11 +156,12 @@ status_t compile_ops(std::shared_ptr<subgraph_t> &sg) {
                     op->get_name().c_str());
         }
         sg->execs_.emplace_back(exec);
+        sg->exec_infos_.emplace_back(get_exec_info(op, mgr));
 
         sg->is_constant_.push_back(op->has_attr(op_attr::is_constant)
                 && op->get_attr<bool>(op_attr::is_constant));
-        return status::success;
-    });
+    }
+    return status::success;
 }
 
 } // namespace dnnl_impl
@@ -25,7 +25,9 @@
 #include "graph/interface/value.hpp"
 
 #include "graph/backend/dnnl/common.hpp"
+#include "graph/backend/dnnl/internal_attrs.hpp"
 #include "graph/backend/dnnl/op_executable.hpp"
+#include "graph/backend/dnnl/utils.hpp"
 
 #include "graph/backend/dnnl/passes/constant_propagation.hpp"
 #include "graph/backend/dnnl/passes/memory_planning.hpp"
@@ -552,6 +554,29 @@ status_t memory_planner_t::assign_internal_temporary_buffer(
             // already assigned buffer, skip it
             if (buffer_assignments_.count(out.get())) continue;
 
+            // zero-copy concat input is placed into the concat output buffer,
+            // which is allocated by the first producer of the concat inputs
+            auto view = concat_views_.find(out.get());
+            if (view != concat_views_.end()) {
+                const value_t *dst = view->second.first;
+                if (!buffer_assignments_.count(dst)) {
+                    size_t idx = temporary_buffer_assigner_.request(
+                            make_dnnl_memory_desc(dst->get_logical_tensor())
+                                    .get_size());
+                    buffer_assignments_.insert(std::make_pair(
+                            dst, assign_info_t(internal_temporary, idx)));
+                    temporary_buffer_ref_count[idx]
+                            = edge_ref_count.at(const_cast<value_t *>(dst));
+                }
+                const assign_info_t &dst_info = buffer_assignments_.at(dst);
+                buffer_assignments_.insert(std::make_pair(out.get(),
+                        assign_info_t(internal_temporary, dst_info.index_,
+                                view->second.second)));
+                temporary_buffer_ref_count[dst_info.index_]
+                        += edge_ref_count.at(out.get());
+                continue;
+            }
+
             // this output need a new buffer, record it
             auto lt = out->get_logical_tensor();
             size_t idx = temporary_buffer_assigner_.request(
@@ -594,6 +619,141 @@ status_t memory_planner_t::assign_internal_temporary_buffer(
     return topo_order_visit(sg->get_output_ops(), func);
 }
 
+// Compute the live range of each internal temporary buffer, which starts at the
+// first op using the buffer and ends at the last one in the execution order,
+// and lay out all the buffers in a single arena. With inter-op parallelism, the
+// live ranges are counted in levels. It's not used when the subgraph has
+// inplace pairs, as an external input may then be overwritten by one op while
+// being read by another one at the same level.
+status_t memory_planner_t::pack_internal_temporary_buffer(
+        std::shared_ptr<subgraph_t> &sg) {
+    const size_t num_buffers = temporary_buffer_assigner_.num_buffers();
+    std::vector<time_bound_t> bounds(
+            num_buffers, {static_cast<size_t>(-1), 0});
+
+    const bool by_level
+            = enable_inter_op_parallelism_ && inplace_pairs_.empty();
+    std::unordered_map<const op_t *, size_t> op_levels;
+    size_t step = 0, num_ops = 0;
+    auto update = [&](const value_t *val) {
+        const assign_info_t &info = buffer_assignments_.at(val);
+        if (info.kind_ != internal_temporary || info.index_ >= num_buffers)
+            return;
+        time_bound_t &bound = bounds[info.index_];
+        bound.start_ = std::min(bound.start_, step);
+        bound.end_ = std::max(bound.end_, step);
+    };
+    CHECK(topo_order_visit(sg->get_output_ops(), [&](op_t *op) {
+        size_t level = 0;
+        for (auto &in : op->get_input_values()) {
+            if (!in->has_producer()) continue;
+            auto pos = op_levels.find(&in->get_producer());
+            if (pos != op_levels.end())
+                level = std::max(level, pos->second + 1);
+        }
+        op_levels[op] = level;
+        if (by_level) exec_levels_.emplace_back(level);
+
+        step = by_level ? level : num_ops++;
+        for (auto &in : op->get_input_values())
+            update(in.get());
+        for (auto &out : op->get_output_values())
+            update(out.get());
+        return status::success;
+    }));
+
+    for (size_t i = 0; i < num_buffers; i++) {
+        if (bounds[i].start_ > bounds[i].end_) continue;
+        temporary_buffer_packer_.add(i,
+                temporary_buffer_assigner_.query_size(i), bounds[i].start_,
+                bounds[i].end_);
+    }
+    temporary_buffer_packer_.pack();
+    return status::success;
+}
+
+// Find the concat ops whose inputs can be written by their producers directly
+// into the concat output buffer, so that the concat itself does nothing. An
+// input qualifies when it is an internal temporary value consumed only by the
+// concat and either is a contiguous chunk of the concat output already, or is
+// produced by a reorder, which can write into the strided sub-memory of the
+// concat output. In the latter case the reorder output layout is changed to
+// the sub-memory one. A concat is handled only when all its inputs qualify.
+status_t memory_planner_t::prepare_zero_copy_concat(
+        std::shared_ptr<subgraph_t> &sg) {
+    for (auto &op : sg->get_ops()) {
+        if (op->get_kind() != op_kind::dnnl_concat) continue;
+        // fused scales and zero points require computations
+        if (op->has_attr(op_attr::fusion_info_key)
+                && op->get_attr<int64_t>(op_attr::fusion_info_key) != -1)
+            continue;
+
+        auto dst = op->get_output_value(0);
+        const logical_tensor_t dst_lt = dst->get_logical_tensor();
+        if (buffer_assignments_.count(dst.get()) || dst->get_consumers().empty()
+                || !ltw(dst_lt).is_strided() || ltw(dst_lt).has_zero_dim())
+            continue;
+
+        const auto axis_res = utils::try_reverse_axis(
+                op->get_attr<int64_t>(op_attr::axis), dst_lt.ndims);
+        if (!axis_res.first) continue;
+        const auto axis = axis_res.second;
+
+        const auto dst_md = make_dnnl_memory_desc(dst_lt);
+        const size_t dt_size
+                = memory::data_type_size(dst_md.get_data_type());
+        memory::dims offsets(dst_md.get_ndims(), 0);
+        std::vector<std::pair<value_t *, memory::desc>> views;
+        std::unordered_set<const value_t *> visited;
+        for (auto &in : op->get_input_values()) {
+            const logical_tensor_t in_lt = in->get_logical_tensor();
+            const auto in_md = make_dnnl_memory_desc(in_lt);
+            const auto sub_md
+                    = dst_md.submemory_desc(in_md.get_dims(), offsets);
+            offsets[axis] += in_md.get_dims()[axis];
+
+            const bool is_internal = in->has_producer()
+                    && in->get_consumers().size() == 1
+                    && !buffer_assignments_.count(in.get())
+                    && alias_analyzer_.get_all_aliases(in.get()).empty()
+                    && visited.insert(in.get()).second;
+            if (!is_internal || !ltw(in_lt).is_strided()
+                    || ltw(in_lt).has_zero_dim()
+                    || in_md.get_data_type() != dst_md.get_data_type())
+                break;
+
+            const bool is_chunk = in_md.get_strides() == sub_md.get_strides()
+                    && in_md.get_size() == ltw(in_lt).nelems() * dt_size;
+            const op_t &producer = in->get_producer();
+            const bool is_reorder
+                    = producer.get_kind() == op_kind::dnnl_reorder
+                    && !(producer.has_attr(op_attr::with_sum)
+                            && producer.get_attr<bool>(op_attr::with_sum));
+            if (!is_chunk && !is_reorder) break;
+
+            views.emplace_back(in.get(), sub_md);
+        }
+        if (views.size() != op->num_inputs()) continue;
+
+        for (auto &view : views) {
+            value_t *in = view.first;
+            const auto &sub_md = view.second;
+            if (make_dnnl_memory_desc(in->get_logical_tensor()).get_strides()
+                    != sub_md.get_strides()) {
+                in->set_strides(sub_md.get_strides());
+                // the reorder is compiled with the new layout
+                sg->pd_cache_.erase(&in->get_producer());
+            }
+            concat_views_.insert({in,
+                    {dst.get(),
+                            static_cast<size_t>(sub_md.get_submemory_offset())
+                                    * dt_size}});
+        }
+        op->set_attr<bool>(op_attr::is_zero_copy, true);
+    }
+    return status::success;
+}
+
 status_t memory_planner_t::prepare_subgraph_inplace_pairs(
         std::shared_ptr<subgraph_t> &sg, bool enable_standard_sharing) {
     size_t time_point = 0;
@@ -622,6 +782,19 @@ status_t memory_planner_t::prepare_subgraph_inplace_pairs(
                 break;
             }
 
+            // the output of an in-place appending concat can share the buffer
+            // of its first input, see mark_in_place_append_concat()
+            if (!inplace_shared && cur_op->get_kind() == op_kind::dnnl_concat
+                    && cur_op->has_attr(op_attr::is_in_place_append)
+                    && cur_op->get_attr<bool>(op_attr::is_in_place_append)) {
+                auto in_val = cur_op->get_input_value(0);
+                auto in_buf = buffer_assignments_.at(in_val.get());
+                if (in_buf.kind_ == external_input) {
+                    in_lt = sg->ins_[in_buf.index_];
+                    inplace_shared = true;
+                }
+            }
+
             // check if can standard sharing external input. note: from library
             // side, it's standard sharing, but from FWK side, it's inplace
             // sharing
@@ -719,6 +892,16 @@ status_t memory_planner_t::book_buffers(std::shared_ptr<subgraph_t> &sg) {
 
     registrar_t temporary_registrar = temporary_registry_.registrar();
     registrar_t persistent_registrar = persistent_registry_.registrar();
+
+    // with offset packing, the temporary buffers are views of an arena whose
+    // key follows the keys of the temporary buffers
+    size_t view_key = temporary_buffer_assigner_.num_buffers();
+    const size_t arena_key = view_key;
+    if (enable_offset_packing_) {
+        temporary_registrar.book(arena_key, temporary_buffer_packer_.peak());
+        view_key++;
+    }
+
     for (const value_t *val : to_be_booked) {
         const assign_info_t &info = buffer_assignments_.at(val);
         switch (info.kind_) {
@@ -728,8 +911,15 @@ status_t memory_planner_t::book_buffers(std::shared_ptr<subgraph_t> &sg) {
             case external_output: break;
             // book buffers for internal temporary and persistent
             case internal_temporary:
-                temporary_registrar.book(info.index_,
-                        temporary_buffer_assigner_.query_size(info.index_));
+                if (enable_offset_packing_) {
+                    temporary_registrar.book_view(info.index_, arena_key,
+                            temporary_buffer_packer_.query_offset(
+                                    info.index_));
+                } else {
+                    temporary_registrar.book(info.index_,
+                            temporary_buffer_assigner_.query_size(
+                                    info.index_));
+                }
                 break;
             case internal_persistent:
                 persistent_registrar.book(info.index_,
@@ -742,6 +932,15 @@ status_t memory_planner_t::book_buffers(std::shared_ptr<subgraph_t> &sg) {
                         info.kind_);
         }
     }
+
+    // zero-copy concat inputs are views of the concat output buffers. Their
+    // keys follow the keys of the temporary buffers and the arena.
+    for (const value_t *val : to_be_booked) {
+        if (!concat_views_.count(val) || view_keys_.count(val)) continue;
+        const assign_info_t &info = buffer_assignments_.at(val);
+        temporary_registrar.book_view(view_key, info.index_, info.offset_);
+        view_keys_.insert({val, view_key++});
+    }
     return status::success;
 }
 
@@ -761,7 +960,8 @@ status_t memory_planner_t::prepare_execution_args_set(
                 break;
             case internal_temporary:
                 exec_args_set_.add_mem_use_internal_temporary(
-                        {mem, info.index_});
+                        {mem, view_keys_.count(val) ? view_keys_.at(val)
+                                                    : info.index_});
                 break;
             case internal_persistent:
                 exec_args_set_.add_mem_use_internal_persistent(
@@ -887,11 +1087,14 @@ status_t memory_planner_t::run(std::shared_ptr<subgraph_t> &sg) {
         edge_ref_count[val]++;
     }
 
-    // By default, memory reuse is enabled. We can use this internal env
-    // var to disable it. The env var is for debugging purpose only and may
-    // be removed without any prior notice.
-    bool enable_memory_sharing
-            = graph::utils::getenv_int_internal("ENABLE_MEM_REUSE", 1) > 0;
+    // By default, memory reuse is enabled with offset packing. We can use this
+    // internal env var to disable it or to share whole buffers instead. The env
+    // var is for debugging purpose only and may be removed without any prior
+    // notice.
+    const int mem_reuse
+            = graph::utils::getenv_int_internal("ENABLE_MEM_REUSE", 1);
+    bool enable_memory_sharing = mem_reuse > 0;
+    enable_offset_packing_ = mem_reuse == 1;
     if (!enable_memory_sharing) {
         // if not enable memory sharing, we add additional 1 to edge reference
         // count, so that tensors will not be reused
@@ -924,11 +1127,18 @@ status_t memory_planner_t::run(std::shared_ptr<subgraph_t> &sg) {
         }
     }
 
+    // Let the producers of concat inputs write into the concat output
+    CHECK(prepare_zero_copy_concat(sg));
+
     // Re-assign internal temporary buffer for reset ones (will re-do memory
-    // sharing between temporary buffers)
-    CHECK(assign_internal_temporary_buffer(sg, edge_ref_count, mgr, true));
+    // sharing between temporary buffers). With offset packing, each value gets
+    // its own buffer and the sharing is done by packing the buffers into an
+    // arena according to their live ranges.
+    CHECK(assign_internal_temporary_buffer(
+            sg, edge_ref_count, mgr, !enable_offset_packing_));
     // Check which input/output pair of the subgraph can be inplaced
     CHECK(prepare_subgraph_inplace_pairs(sg, false));
+    if (enable_offset_packing_) CHECK(pack_internal_temporary_buffer(sg));
 
     CHECK(book_buffers(sg));
     // Bind memory object to each value
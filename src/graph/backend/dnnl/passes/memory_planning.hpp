@@ -270,6 +270,9 @@ public:
         free_.insert({e->max_bytes_, e});
     }
 
+    // return the number of allocated buffers
+    size_t num_buffers() const { return data_.size(); }
+
     // return the size of a buffer
     size_t query_size(size_t id) const {
         assertm(id < data_.size() || id == static_cast<size_t>(-1),
@@ -307,6 +310,113 @@ private:
     std::vector<std::unique_ptr<buffer_info_t>> data_;
 };
 
+// The buffer_packer_t class lays out buffers with known live ranges in a single
+// arena. Live ranges are given in execution steps and are inclusive. Buffers
+// are placed from the largest to the smallest one. Each buffer goes into the
+// smallest gap that can hold it between the already placed buffers whose live
+// ranges overlap with its own (best-fit), or on top of them if there is no such
+// gap. Unlike buffer_assigner_t, buffers of different sizes can partially share
+// memory, so the peak of the arena is usually smaller than the sum of the
+// buffers reused as a whole.
+class buffer_packer_t {
+public:
+    // constructor
+    explicit buffer_packer_t(const size_t alignment) : alignment_(alignment) {}
+
+    // add a buffer which is live in the steps [start, end]
+    void add(size_t id, size_t size, size_t start, size_t end) {
+        if (id >= data_.size()) data_.resize(id + 1);
+        data_[id] = buffer_info_t(size, start, end);
+    }
+
+    // compute the offsets of all the buffers and return the peak of the arena
+    size_t pack() {
+        std::vector<size_t> order(data_.size());
+        for (size_t i = 0; i < order.size(); i++)
+            order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            if (data_[a].size_ != data_[b].size_)
+                return data_[a].size_ > data_[b].size_;
+            return data_[a].start_ < data_[b].start_;
+        });
+
+        peak_ = 0;
+        std::vector<const buffer_info_t *> placed, live;
+        for (size_t id : order) {
+            buffer_info_t &buf = data_[id];
+            buf.offset_ = 0;
+            if (buf.size_ == 0) continue;
+
+            live.clear();
+            for (const buffer_info_t *p : placed) {
+                if (p->start_ <= buf.end_ && buf.start_ <= p->end_)
+                    live.emplace_back(p);
+            }
+            std::sort(live.begin(), live.end(),
+                    [](const buffer_info_t *a, const buffer_info_t *b) {
+                        return a->offset_ < b->offset_;
+                    });
+
+            // find the smallest gap which is large enough
+            const size_t none = static_cast<size_t>(-1);
+            size_t best = none, best_gap = none, cur = 0;
+            for (const buffer_info_t *p : live) {
+                if (p->offset_ > cur) {
+                    const size_t gap = p->offset_ - cur;
+                    if (gap >= buf.size_ && gap < best_gap) {
+                        best = cur;
+                        best_gap = gap;
+                    }
+                }
+                cur = std::max(cur, round_up(p->offset_ + p->size_));
+            }
+            buf.offset_ = best == none ? cur : best;
+            peak_ = std::max(peak_, buf.offset_ + buf.size_);
+            placed.emplace_back(&buf);
+        }
+        return peak_;
+    }
+
+    // return the offset of a buffer in the arena
+    size_t query_offset(size_t id) const {
+        if (id >= data_.size()) return 0;
+        return data_[id].offset_;
+    }
+
+    // return the peak of the arena computed by the last pack()
+    size_t peak() const { return peak_; }
+
+    void clear() {
+        data_.clear();
+        peak_ = 0;
+    }
+
+private:
+    size_t round_up(size_t size) const {
+        return (size + alignment_ - 1) / alignment_ * alignment_;
+    }
+
+    struct buffer_info_t {
+        buffer_info_t() = default;
+        buffer_info_t(size_t size, size_t start, size_t end)
+            : size_(size), start_(start), end_(end) {}
+        // size of the buffer in bytes.
+        size_t size_ = 0;
+        // first and last steps when the buffer is live.
+        size_t start_ = 0;
+        size_t end_ = 0;
+        // offset of the buffer in the arena.
+        size_t offset_ = 0;
+    };
+
+    // alignment of the buffer offsets
+    size_t alignment_;
+    // all the buffers, indexed by id
+    std::vector<buffer_info_t> data_;
+    // peak of the arena
+    size_t peak_ = 0;
+};
+
 // This memory_planner_t class is used to plan which buffer can be used by each
 // value in the subgraph. All the planning works are completed in compilation
 // stage for static shape cases.
@@ -326,15 +436,28 @@ private:
 //   Take this subgraph 't1 -> op1 -> t2 -> op2 -> t3 -> op3 -> t4-> op4 -> t5'
 //   as an example: when writing data to t4, t2 is not used any more, so they
 //   have disjoint live range and we can make them share same buffer.
+// - Zero-copy concat. The producers of concat inputs write directly into the
+//   sub-memories of the concat output buffer, and the concat does nothing.
+// - Offset packing. Instead of sharing whole buffers, all temporary buffers are
+//   laid out in a single arena by buffer_packer_t according to their live
+//   ranges, so the temporary scratchpad size is the peak of the arena.
 //
 // The following internal env vars can be used to control the memory planning:
 // - _ONEDNN_GRAPH_ENABLE_MEM_REUSE
 //     - 0: Disable memory sharing
-//     - 1 (default): Enable memory sharing
+//     - 1 (default): Enable memory sharing with offset packing
+//     - 2: Enable memory sharing of whole temporary buffers
+//
+// When inter-op parallelism is enabled, ops are grouped into levels, where an
+// op is one level above its deepest producer. The ops at the same level don't
+// depend on each other and may be executed concurrently, so the live ranges
+// used by offset packing are counted in levels instead of ops.
 class memory_planner_t {
 public:
     memory_planner_t()
-        : persistent_buffer_assigner_(16), temporary_buffer_assigner_(16) {}
+        : persistent_buffer_assigner_(16)
+        , temporary_buffer_assigner_(16)
+        , temporary_buffer_packer_(64) {}
 
     memory_planner_t(memory_planner_t &&) = delete;
     memory_planner_t(const memory_planner_t &other) = delete;
@@ -365,6 +488,14 @@ public:
         return inplace_pairs_;
     };
 
+    void set_inter_op_parallelism(bool enable) {
+        enable_inter_op_parallelism_ = enable;
+    }
+
+    // levels of the ops in the execution order. Empty if the buffers are not
+    // planned for concurrent execution.
+    const std::vector<size_t> &get_exec_levels() const { return exec_levels_; }
+
     std::string get_memory_info(const value_t *val) const {
         std::string str;
         auto pos = buffer_assignments_.find(val);
@@ -383,6 +514,7 @@ public:
         }
 
         str += std::to_string(info.index_);
+        if (info.offset_ != 0) str += "+" + std::to_string(info.offset_);
         return str;
     }
 
@@ -396,15 +528,16 @@ private:
 
     class assign_info_t {
     public:
-        assign_info_t(buffer_kind_t kind, size_t index)
-            : kind_(kind), index_(index) {}
+        assign_info_t(buffer_kind_t kind, size_t index, size_t offset = 0)
+            : kind_(kind), index_(index), offset_(offset) {}
 
         assign_info_t() = default;
         assign_info_t(const assign_info_t &other) = default;
         assign_info_t &operator=(const assign_info_t &other) = default;
 
         bool operator==(const assign_info_t &other) const {
-            return kind_ == other.kind_ && index_ == other.index_;
+            return kind_ == other.kind_ && index_ == other.index_
+                    && offset_ == other.offset_;
         }
 
         bool operator!=(const assign_info_t &other) const {
@@ -413,6 +546,7 @@ private:
 
         buffer_kind_t kind_;
         size_t index_; // the index to allocated buffer
+        size_t offset_ = 0; // the offset in bytes inside the buffer
     };
 
     struct time_bound_t {
@@ -426,10 +560,14 @@ private:
         exec_args_set_.clear();
         persistent_buffer_assigner_.clear();
         temporary_buffer_assigner_.clear();
+        temporary_buffer_packer_.clear();
         persistent_registry_.clear();
         temporary_registry_.clear();
         external_inputs_live_range_.clear();
         inplace_pairs_.clear();
+        concat_views_.clear();
+        view_keys_.clear();
+        exec_levels_.clear();
     }
 
     status_t assign_external_inputs_buffer(std::shared_ptr<subgraph_t> &sg,
@@ -446,6 +584,10 @@ private:
             const std::unordered_map<value_t *, size_t> &edge_ref_count,
             fusion_info_mgr_t &mgr, bool enable_standard_sharing);
 
+    status_t pack_internal_temporary_buffer(std::shared_ptr<subgraph_t> &sg);
+
+    status_t prepare_zero_copy_concat(std::shared_ptr<subgraph_t> &sg);
+
     status_t prepare_subgraph_inplace_pairs(
             std::shared_ptr<subgraph_t> &sg, bool enable_standard_sharing);
 
@@ -460,6 +602,10 @@ private:
 
     buffer_assigner_t persistent_buffer_assigner_;
     buffer_assigner_t temporary_buffer_assigner_;
+    buffer_packer_t temporary_buffer_packer_;
+    bool enable_offset_packing_ = false;
+    bool enable_inter_op_parallelism_ = false;
+    std::vector<size_t> exec_levels_;
     registry_t persistent_registry_;
     registry_t temporary_registry_;
 
@@ -467,6 +613,11 @@ private:
     std::unordered_map<const assign_info_t *, time_bound_t>
             external_inputs_live_range_;
     std::vector<inplace_pair_t> inplace_pairs_;
+    // zero-copy concat input -> (concat output, offset in bytes)
+    std::unordered_map<const value_t *, std::pair<const value_t *, size_t>>
+            concat_views_;
+    // zero-copy concat input -> key of its view in the temporary registry
+    std::unordered_map<const value_t *, size_t> view_keys_;
 };
 
 } // namespace dnnl_impl
@@ -810,6 +810,232 @@ status_t fuse_to_shuffle(std::shared_ptr<subgraph_t> &sg) {
     return status::success;
 }
 
+status_t fold_shuffle_into_conv_weights(std::shared_ptr<subgraph_t> &sg) {
+    // conv(shuffle(src, g), wei) == conv(src, shuffle(wei, C / g)) when the
+    // shuffle is done over the input channels. Moving the shuffle to the
+    // constant weights lets constant propagation and cache compute it only
+    // once instead of permuting the activations on every execution.
+    subgraph_rewriter_t rewriter(sg);
+    for (auto &cur_op : sg->get_ops()) {
+        if (cur_op->get_kind() != op_kind::dnnl_shuffle) continue;
+
+        auto out_val = cur_op->get_output_value(0);
+        if (out_val->get_consumers().size() != 1) continue;
+        auto &conv = out_val->get_consumers()[0].get_op();
+        if (conv.get_kind() != op_kind::dnnl_convolution
+                || out_val->get_consumers()[0].get_offset() != 0)
+            continue;
+
+        // a permutation across the groups can't be expressed with grouped
+        // weights
+        if (conv.has_attr(op_attr::groups)
+                && conv.get_attr<int64_t>(op_attr::groups) > 1)
+            continue;
+
+        const auto wei_lt = conv.get_input_value(1)->get_logical_tensor();
+        if (ltw(wei_lt).property_type() != property_type::constant) continue;
+
+        const auto src_lt = cur_op->get_input_value(0)->get_logical_tensor();
+        const auto ndims = ltw(src_lt).ndims();
+        const std::string data_fmt = conv.has_attr(op_attr::data_format)
+                ? conv.get_attr<std::string>(op_attr::data_format)
+                : "NCX";
+        const std::string wei_fmt = conv.has_attr(op_attr::weights_format)
+                ? conv.get_attr<std::string>(op_attr::weights_format)
+                : "OIX";
+        if (wei_fmt != "OIX" && wei_fmt != "XIO") continue;
+
+        const int64_t c_axis = data_fmt == "NCX" ? 1 : ndims - 1;
+        const auto axis = cur_op->get_attr<int64_t>(op_attr::axis);
+        if (axis != c_axis) continue;
+
+        const int64_t channels = ltw(src_lt).vdims()[c_axis];
+        const auto groups = cur_op->get_attr<int64_t>(op_attr::groups);
+        if (channels <= 0 || groups <= 0 || channels % groups != 0) continue;
+
+        const int64_t wei_ic_axis
+                = wei_fmt == "OIX" ? 1 : ltw(wei_lt).ndims() - 2;
+        op_ptr wei_shuffle = std::make_shared<op_t>(op_kind::dnnl_shuffle);
+        wei_shuffle->set_attr<int64_t>(op_attr::axis, wei_ic_axis);
+        wei_shuffle->set_attr<int64_t>(op_attr::groups, channels / groups);
+        rewriter.insert_op_before(wei_shuffle, conv.shared_from_this(), 1);
+        insert_empty_scratchpad(wei_shuffle);
+
+        rewriter.fuse_op_to_successor(cur_op);
+    }
+
+    rewriter.run();
+    return infer_shape(sg);
+}
+
+status_t fold_upsample_into_conv(std::shared_ptr<subgraph_t> &sg) {
+    // A stride 1 convolution over a nearest neighbor upsampling by integer
+    // factors s is a deconvolution with strides s over the original source.
+    // Its weights are the spatially flipped convolution weights summed over a
+    // box of s elements, so the kernel grows to K + s - 1 and the upsampled
+    // intermediate tensor is never materialized:
+    //     wei'[k'] = sum_{t < s} wei[K - 1 + t - k'],
+    //     pad_begin' = K - 1 - pad_begin, pad_end' = K - 1 - pad_end.
+    // The transformation is a matmul of the flattened constant weights with a
+    // constant 0/1 matrix, so constant cache computes it once.
+    subgraph_rewriter_t rewriter(sg);
+    for (auto &cur_op : sg->get_ops()) {
+        if (cur_op->get_kind() != op_kind::dnnl_resampling) continue;
+        if (cur_op->num_inputs() != 1
+                || cur_op->get_attr<std::string>(op_attr::mode) != "nearest")
+            continue;
+        if (cur_op->has_attr(op_attr::coordinate_transformation_mode)
+                && cur_op->get_attr<std::string>(
+                           op_attr::coordinate_transformation_mode)
+                        != "half_pixel")
+            continue;
+        if (cur_op->has_attr(op_attr::fusion_info_key)
+                && cur_op->get_attr<int64_t>(op_attr::fusion_info_key) != -1)
+            continue;
+
+        auto out_val = cur_op->get_output_value(0);
+        if (out_val->get_consumers().size() != 1) continue;
+        auto &conv = out_val->get_consumers()[0].get_op();
+        if (conv.get_kind() != op_kind::dnnl_convolution
+                || out_val->get_consumers()[0].get_offset() != 0)
+            continue;
+
+        // permutes and groups are expected to be canonicalized already
+        if (conv.get_attr<std::string>(op_attr::data_format) != "NCX"
+                || conv.get_attr<std::string>(op_attr::weights_format) != "OIX"
+                || conv.get_attr<int64_t>(op_attr::groups) != 1)
+            continue;
+        if (conv.has_attr(op_attr::auto_pad)
+                && conv.get_attr<std::string>(op_attr::auto_pad) != "None")
+            continue;
+
+        const auto wei_lt = conv.get_input_value(1)->get_logical_tensor();
+        if (ltw(wei_lt).property_type() != property_type::constant
+                || wei_lt.data_type != graph::data_type::f32)
+            continue;
+
+        const auto src_dims
+                = ltw(cur_op->get_input_value(0)->get_logical_tensor()).vdims();
+        const auto up_dims = ltw(out_val->get_logical_tensor()).vdims();
+        const auto wei_dims = ltw(wei_lt).vdims();
+        const size_t ndims = src_dims.size();
+        if (ndims < 3 || up_dims.size() != ndims || wei_dims.size() != ndims)
+            continue;
+
+        const auto &strides = conv.get_attr<std::vector<int64_t>>(
+                op_attr::strides);
+        const auto &dilations = conv.get_attr<std::vector<int64_t>>(
+                op_attr::dilations);
+        const auto &pads_begin = conv.get_attr<std::vector<int64_t>>(
+                op_attr::pads_begin);
+        const auto &pads_end = conv.get_attr<std::vector<int64_t>>(
+                op_attr::pads_end);
+
+        const size_t nsp = ndims - 2;
+        std::vector<int64_t> factors(nsp), new_kernel(nsp);
+        std::vector<int64_t> new_pads_begin(nsp), new_pads_end(nsp);
+        bool ok = true;
+        for (size_t d = 0; d < nsp && ok; ++d) {
+            const int64_t in = src_dims[d + 2], up = up_dims[d + 2];
+            const int64_t k = wei_dims[d + 2];
+            ok = in > 0 && up % in == 0 && strides[d] == 1
+                    && dilations[d] == 1 && pads_begin[d] < k
+                    && pads_end[d] < k;
+            if (!ok) break;
+            factors[d] = up / in;
+            new_kernel[d] = k + factors[d] - 1;
+            new_pads_begin[d] = k - 1 - pads_begin[d];
+            new_pads_end[d] = k - 1 - pads_end[d];
+        }
+        if (!ok) continue;
+
+        // 0/1 matrix of [prod(K), prod(K')] mapping the weights spatial
+        // elements to the deconvolution ones
+        int64_t k_size = 1, new_k_size = 1;
+        for (size_t d = 0; d < nsp; ++d) {
+            k_size *= wei_dims[d + 2];
+            new_k_size *= new_kernel[d];
+        }
+        std::vector<float> box(k_size * new_k_size, 0.f);
+        for (int64_t k = 0; k < k_size; ++k) {
+            for (int64_t kn = 0; kn < new_k_size; ++kn) {
+                bool in_box = true;
+                int64_t k_rem = k, kn_rem = kn;
+                for (size_t d = nsp; d-- > 0;) {
+                    const int64_t kd = k_rem % wei_dims[d + 2];
+                    const int64_t knd = kn_rem % new_kernel[d];
+                    k_rem /= wei_dims[d + 2];
+                    kn_rem /= new_kernel[d];
+                    const int64_t t = kd + knd - (wei_dims[d + 2] - 1);
+                    in_box = in_box && t >= 0 && t < factors[d];
+                }
+                if (in_box) box[k * new_k_size + kn] = 1.f;
+            }
+        }
+
+        op_ptr deconv = std::make_shared<op_t>(op_kind::dnnl_convtranspose);
+        deconv->merge_attributes(conv.get_attributes());
+        deconv->set_attr<std::vector<int64_t>>(op_attr::strides, factors);
+        deconv->set_attr<std::vector<int64_t>>(
+                op_attr::pads_begin, new_pads_begin);
+        deconv->set_attr<std::vector<int64_t>>(
+                op_attr::pads_end, new_pads_end);
+        deconv->set_attr<std::vector<int64_t>>(
+                op_attr::output_padding, std::vector<int64_t>(nsp, 0));
+
+        auto src_val = cur_op->get_input_value(0);
+        src_val->remove_consumer(*cur_op, 0);
+        deconv->connect_input(0, src_val);
+        for (size_t i = 1; i < conv.num_inputs(); ++i) {
+            auto in_val = conv.get_input_value(i);
+            in_val->remove_consumer(conv, i);
+            deconv->connect_input(i, in_val);
+        }
+        for (size_t i = 0; i < conv.num_outputs(); ++i)
+            deconv->add_output(conv.get_output_value(i));
+        rewriter.to_insert(deconv);
+        rewriter.to_remove(conv.shared_from_this());
+        rewriter.to_remove(cur_op);
+
+        // weights: [O, I, K...] -> [O * I, prod(K)] x box -> [O, I, K'...]
+        op_ptr wei_reshape_out = std::make_shared<op_t>(op_kind::dnnl_reshape);
+        std::vector<int64_t> new_wei_dims {wei_dims[0], wei_dims[1]};
+        new_wei_dims.insert(
+                new_wei_dims.end(), new_kernel.begin(), new_kernel.end());
+        wei_reshape_out->set_attr(op_attr::shape, new_wei_dims);
+        wei_reshape_out->set_attr(op_attr::special_zero, false);
+        rewriter.insert_op_before(wei_reshape_out, deconv, 1);
+
+        op_ptr wei_matmul = std::make_shared<op_t>(op_kind::dnnl_matmul);
+        wei_matmul->set_attr(op_attr::transpose_a, false);
+        wei_matmul->set_attr(op_attr::transpose_b, false);
+        rewriter.insert_op_before(wei_matmul, wei_reshape_out, 0);
+        insert_empty_scratchpad(wei_matmul);
+
+        op_ptr wei_reshape_in = std::make_shared<op_t>(op_kind::dnnl_reshape);
+        wei_reshape_in->set_attr(op_attr::shape,
+                std::vector<int64_t> {wei_dims[0] * wei_dims[1], k_size});
+        wei_reshape_in->set_attr(op_attr::special_zero, false);
+        rewriter.insert_op_before(wei_reshape_in, wei_matmul, 0);
+
+        op_ptr box_op = std::make_shared<op_t>(op_kind::dnnl_constant_scales);
+        box_op->set_attr(op_attr::scales, box);
+        box_op->set_attr(
+                op_attr::shape, std::vector<int64_t> {k_size, new_k_size});
+        logical_tensor_t box_lt = empty_logical_tensor_with_default_id();
+        auto box_val = std::make_shared<value_t>(*box_op, 0, box_lt, true);
+        box_val->set_data_type(graph::data_type::f32);
+        box_val->set_layout_type(layout_type::strided);
+        box_val->set_strides({new_k_size, 1});
+        box_op->add_output(box_val);
+        wei_matmul->connect_input(1, box_val);
+        rewriter.to_insert(box_op);
+    }
+
+    rewriter.run();
+    return infer_shape(sg);
+}
+
 status_t fuse_post_ops(std::shared_ptr<subgraph_t> &sg) {
     // lambda function to fuse one post op into base primitive
     auto fuse_post_ops_func = [&](bool &changed) -> status_t {
@@ -1837,6 +2063,54 @@ status_t conv_bwd_weights_canonicalization(std::shared_ptr<subgraph_t> &sg) {
     return infer_shape(sg);
 }
 
+status_t fuse_bias_add_bwd_to_conv_bwd_weights(
+        std::shared_ptr<subgraph_t> &sg) {
+    std::vector<std::pair<op_ptr, op_ptr>> fuse_groups;
+    std::set<op_t *> visited;
+    for (const auto &cur_op : sg->get_ops()) {
+        if (cur_op->get_kind() != graph::op_kind::BiasAddBackward
+                || visited.count(cur_op.get()) != 0)
+            continue;
+
+        // find a conv_bwd_weights sharing the diff_dst with the same format
+        auto diff_dst = cur_op->get_input_value(0);
+        const auto &data_format
+                = cur_op->get_attr<std::string>(op_attr::data_format);
+        for (const auto &consumer : diff_dst->get_consumers()) {
+            auto &conv_op = consumer.get_op();
+            if (conv_op.get_kind() != graph::op_kind::ConvolutionBackwardWeights
+                    || consumer.get_offset() != 1 || conv_op.num_inputs() != 2
+                    || conv_op.num_outputs() != 1 || visited.count(&conv_op))
+                continue;
+            if (conv_op.get_attr<std::string>(op_attr::data_format)
+                    != data_format)
+                continue;
+
+            fuse_groups.emplace_back(conv_op.shared_from_this(), cur_op);
+            visited.insert(&conv_op);
+            visited.insert(cur_op.get());
+            break;
+        }
+    }
+
+    if (fuse_groups.empty()) return status::success;
+
+    subgraph_rewriter_t rewriter(sg);
+    for (auto &fuse_ops : fuse_groups) {
+        op_ptr &conv_op = fuse_ops.first;
+        op_ptr &bias_bwd_op = fuse_ops.second;
+
+        auto diff_dst = bias_bwd_op->get_input_value(0);
+        diff_dst->remove_consumer(*bias_bwd_op, 0);
+        conv_op->add_output(bias_bwd_op->get_output_value(0));
+        conv_op->set_attr<bool>(op_attr::with_bias, true);
+        rewriter.to_remove(bias_bwd_op);
+    }
+
+    rewriter.run();
+    return status::success;
+}
+
 status_t pool_fwd_canonicalization(std::shared_ptr<subgraph_t> &sg) {
     subgraph_rewriter_t rewriter(sg);
 
@@ -3061,6 +3335,100 @@ status_t fuse_dynamic_sub_zps_mul_scales(std::shared_ptr<subgraph_t> &sg) {
     return status::success;
 }
 
+status_t fuse_dynamic_quant_to_matmul(std::shared_ptr<subgraph_t> &sg) {
+    // Only the CPU matmul can quantize its src at execution.
+    if (sg->get_engine_kind() != graph::engine_kind::cpu)
+        return status::success;
+
+    const auto is_dynamic_dequant = [](const op_t &op) {
+        return op.get_kind() == graph::op_kind::DynamicDequantize
+                && op.num_inputs() == 2;
+    };
+
+    std::vector<op_ptr> quant_ops;
+    for (const auto &cur_op : sg->get_ops()) {
+        if (cur_op->get_kind() != graph::op_kind::DynamicQuantize
+                || cur_op->num_inputs() != 2)
+            continue;
+
+        auto quant_dst = cur_op->get_output_value(0);
+        if (ltw(quant_dst->get_logical_tensor()).data_type()
+                != graph::data_type::s8)
+            continue;
+        const auto quant_consumers = quant_dst->get_consumers();
+        if (quant_consumers.size() != 1) continue;
+
+        // The quantized src must only be dequantized with the same scales.
+        auto &dequant_op = quant_consumers[0].get_op();
+        if (!is_dynamic_dequant(dequant_op)
+                || dequant_op.get_input_value(1) != cur_op->get_input_value(1))
+            continue;
+        const auto &qtype = cur_op->get_attr<std::string>(op_attr::qtype);
+        const auto axis = cur_op->get_attr<int64_t>(op_attr::axis);
+        if (dequant_op.get_attr<std::string>(op_attr::qtype) != qtype
+                || dequant_op.get_attr<int64_t>(op_attr::axis) != axis)
+            continue;
+
+        const auto dequant_consumers
+                = dequant_op.get_output_value(0)->get_consumers();
+        if (dequant_consumers.size() != 1
+                || dequant_consumers[0].get_offset() != 0)
+            continue;
+        auto &mm_op = dequant_consumers[0].get_op();
+        if (mm_op.get_kind() != graph::op_kind::MatMul) continue;
+        if (mm_op.has_attr(op_attr::transpose_a)
+                && mm_op.get_attr<bool>(op_attr::transpose_a))
+            continue;
+
+        // The scales are either common or one per row of a 2D src.
+        const int ndims
+                = cur_op->get_input_value(0)->get_logical_tensor().ndims;
+        const bool per_row = qtype == "per_channel" && ndims == 2
+                && (axis == 0 || axis == -2);
+        if (qtype != "per_tensor" && !per_row) continue;
+
+        // The weights must be s8 with common or per output channel scales.
+        auto wei = mm_op.get_input_value(1);
+        if (!wei->has_producer() || !is_dynamic_dequant(wei->get_producer()))
+            continue;
+        const auto &wei_dequant = wei->get_producer();
+        if (ltw(wei_dequant.get_input_value(0)->get_logical_tensor())
+                        .data_type()
+                != graph::data_type::s8)
+            continue;
+        if (wei_dequant.get_attr<std::string>(op_attr::qtype) == "per_group")
+            continue;
+
+        quant_ops.emplace_back(cur_op);
+    }
+
+    if (quant_ops.empty()) return status::success;
+
+    subgraph_rewriter_t rewriter(sg);
+    for (auto &quant_op : quant_ops) {
+        auto src = quant_op->get_input_value(0);
+        auto scales = quant_op->get_input_value(1);
+        auto quant_dst = quant_op->get_output_value(0);
+        auto &dequant_op = quant_dst->get_consumers()[0].get_op();
+        auto &mm_op
+                = dequant_op.get_output_value(0)->get_consumers()[0].get_op();
+
+        // Dequantize the original src, which the matmul fuses as src scales.
+        src->remove_consumer(*quant_op, 0);
+        scales->remove_consumer(*quant_op, 1);
+        quant_dst->remove_consumer(dequant_op, 0);
+        dequant_op.connect_input(0, src);
+        if (dequant_op.get_attr<std::string>(op_attr::qtype) == "per_channel")
+            dequant_op.set_attr<int64_t>(op_attr::axis, 0);
+
+        mm_op.set_attr<bool>(op_attr::is_src_dyn_quant, true);
+        rewriter.to_remove(quant_op);
+    }
+
+    rewriter.run();
+    return status::success;
+}
+
 impl::status_t convert_dynamic_quantize_ops(std::shared_ptr<subgraph_t> &sg) {
     std::vector<op_ptr> convert_ops;
     std::set<op_t *> visited;
@@ -3309,6 +3677,136 @@ status_t common_reorder_elimination(std::shared_ptr<subgraph_t> &sg) {
     return status::success;
 }
 
+status_t sink_reorders_by_cost(std::shared_ptr<subgraph_t> &sg) {
+    auto &mgr = sg->fusion_info_mgr_;
+    auto &p_engine = *(sg->p_engine_);
+    auto &pd_cache = sg->pd_cache_;
+
+    const auto md_of = [](const value_ptr &val) {
+        return make_dnnl_memory_desc(val->get_logical_tensor());
+    };
+    const auto is_output = [&](const value_ptr &val) {
+        const size_t id = val->get_logical_tensor().id;
+        return std::any_of(sg->outs_.begin(), sg->outs_.end(),
+                [id](const logical_tensor_t &lt) { return lt.id == id; });
+    };
+    // A reorder which only changes the layout.
+    const auto is_layout_reorder = [&](const op_t *op) {
+        if (op->get_kind() != op_kind::dnnl_reorder || op->num_inputs() != 1
+                || op->has_attr(op_attr::scales)
+                || op->has_attr(op_attr::src_zps)
+                || op->has_attr(op_attr::dst_zps))
+            return false;
+        if (op->has_attr(op_attr::fusion_info_key)
+                && op->get_attr<int64_t>(op_attr::fusion_info_key) != -1)
+            return false;
+        return op->get_input_value(0)->get_logical_tensor().data_type
+                == op->get_output_value(0)->get_logical_tensor().data_type;
+    };
+    // The single consumer of the main output of an op, if any.
+    const auto next_op = [&](op_t *op) -> op_t * {
+        const auto out_val = op->get_output_value(0);
+        if (out_val->get_consumers().size() != 1 || is_output(out_val))
+            return nullptr;
+        return &out_val->get_consumers()[0].get_op();
+    };
+    auto sink_one = [&](bool &changed) -> status_t {
+        changed = false;
+        for (auto &cur_op : sg->get_ops()) {
+            if (!is_layout_reorder(cur_op.get())) continue;
+
+            // Collect the eltwise chain between two reorders.
+            std::vector<op_t *> chain;
+            op_t *op = next_op(cur_op.get());
+            while (op && op->get_kind() == op_kind::dnnl_eltwise
+                    && op->num_inputs() == 1) {
+                chain.emplace_back(op);
+                op = next_op(op);
+            }
+            if (chain.empty() || !op || op->get_kind() != op_kind::dnnl_reorder
+                    || op->num_inputs() != 1)
+                continue;
+            op_t *last = op;
+
+            const memory::desc src_md = md_of(cur_op->get_input_value(0));
+            const memory::desc mid_md = md_of(cur_op->get_output_value(0));
+            const memory::desc dst_md = md_of(last->get_output_value(0));
+            // The eltwise ops keep the shape, so the size of a tensor in the
+            // layout of the producer is the size of src scaled by data type.
+            const auto size_in = [&](const memory::desc &layout,
+                                         const value_ptr &val) {
+                const size_t dt_size = memory::data_type_size(
+                        static_cast<memory::data_type>(
+                                val->get_logical_tensor().data_type));
+                return layout.get_size()
+                        / memory::data_type_size(layout.get_data_type())
+                        * dt_size;
+            };
+
+            size_t cost_before = src_md.get_size() + mid_md.get_size();
+            size_t cost_after = 0;
+            for (op_t *elt : chain) {
+                const auto in_val = elt->get_input_value(0);
+                const auto out_val = elt->get_output_value(0);
+                cost_before += md_of(in_val).get_size()
+                        + md_of(out_val).get_size();
+                cost_after
+                        += size_in(src_md, in_val) + size_in(src_md, out_val);
+            }
+            const auto last_in = last->get_input_value(0);
+            cost_before += md_of(last_in).get_size() + dst_md.get_size();
+            // Assume the eltwise ops keep the layout of their input.
+            const bool drop_last = is_layout_reorder(last) && src_md == dst_md;
+            if (!drop_last)
+                cost_after += size_in(src_md, last_in) + dst_md.get_size();
+            if (cost_after >= cost_before) continue;
+
+            // Run the chain on the input of the first reorder.
+            subgraph_rewriter_t rewriter(sg);
+            rewriter.fuse_op_to_successor(cur_op);
+            for (op_t *elt : chain) {
+                auto elt_ptr = elt->shared_from_this();
+                pd_cache.erase(elt);
+                const auto &pd = eltwise_executable_t::create_desc(
+                        elt_ptr, p_engine, mgr, pd_cache);
+                CHECK(fill_layout_info(
+                        elt->get_output_value(0), pd.dst_desc()));
+                if (elt->num_outputs() > 1)
+                    CHECK(fill_layout_info(
+                            elt->get_output_value(1), pd.scratchpad_desc()));
+            }
+
+            auto last_ptr = last->shared_from_this();
+            if (drop_last
+                    && md_of(chain.back()->get_output_value(0)) == dst_md) {
+                rewriter.fuse_op_to_predecessor(last_ptr);
+            } else {
+                pd_cache.erase(last);
+                const auto &pd = reorder_executable_t::create_desc(
+                        last_ptr, p_engine, mgr, pd_cache);
+                if (last->num_outputs() > 1)
+                    CHECK(fill_layout_info(
+                            last->get_output_value(1), pd.scratchpad_desc()));
+            }
+            rewriter.run();
+            changed = true;
+            return status::success;
+        }
+        return status::success;
+    };
+
+    int cnt = 0;
+    const int max_iter_num = static_cast<int>(sg->num_ops());
+
+    bool changed = true;
+    do {
+        CHECK(sink_one(changed));
+        cnt++;
+    } while (changed && cnt <= max_iter_num);
+
+    return status::success;
+}
+
 // combine scales around binary post op
 //
 //         |                     |        |
@@ -4387,6 +4885,46 @@ status_t fuse_sdpa(std::shared_ptr<subgraph_t> &sg) {
     return status::success;
 }
 
+status_t mark_in_place_append_concat(std::shared_ptr<subgraph_t> &sg) {
+    // the appending is implemented for native cpu runtimes only, see
+    // concat_executable_t
+    bool enabled = sg->p_engine_->get_kind() == dnnl::engine::kind::cpu;
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL
+    enabled = false;
+#endif
+    if (!enabled) return status::success;
+
+    for (auto &op : sg->get_ops()) {
+        if (op->get_kind() != op_kind::dnnl_concat || op->num_inputs() < 2)
+            continue;
+        if (op->has_attr(op_attr::fusion_info_key)
+                && op->get_attr<int64_t>(op_attr::fusion_info_key) != -1)
+            continue;
+
+        auto src = op->get_input_value(0);
+        auto dst = op->get_output_value(0);
+        const size_t dst_id = dst->get_logical_tensor().id;
+        if (src->has_producer()
+                || std::none_of(sg->outs_.begin(), sg->outs_.end(),
+                        [&](const logical_tensor_t &lt) {
+                            return lt.id == dst_id;
+                        }))
+            continue;
+
+        // the elements of the first input are at the same offsets in the
+        // output buffer
+        const ltw src_lt(src->get_logical_tensor());
+        const ltw dst_lt(dst->get_logical_tensor());
+        if (!src_lt.is_strided() || !dst_lt.is_strided()
+                || src_lt.data_type() != dst_lt.data_type()
+                || src_lt.vstrides() != dst_lt.vstrides())
+            continue;
+
+        op->set_attr<bool>(op_attr::is_in_place_append, true);
+    }
+    return status::success;
+}
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
@@ -43,6 +43,13 @@ status_t fuse_to_int8_concat(std::shared_ptr<subgraph_t> &sg);
 
 status_t fuse_to_shuffle(std::shared_ptr<subgraph_t> &sg);
 
+// Moves a channel shuffle feeding a convolution to its constant weights
+status_t fold_shuffle_into_conv_weights(std::shared_ptr<subgraph_t> &sg);
+
+// Replaces a nearest neighbor upsampling by integer factors followed by a
+// convolution with a strided deconvolution over the original source
+status_t fold_upsample_into_conv(std::shared_ptr<subgraph_t> &sg);
+
 status_t replace_quant_data_with_binary_post_op(
         std::shared_ptr<subgraph_t> &sg);
 
@@ -66,6 +73,12 @@ status_t conv_bwd_data_canonicalization(std::shared_ptr<subgraph_t> &sg);
 
 status_t conv_bwd_weights_canonicalization(std::shared_ptr<subgraph_t> &sg);
 
+// This pass folds a BiasAddBackward that reduces the diff_dst of a
+// ConvolutionBackwardWeights into it, so the primitive computes diff_bias
+// while reading diff_dst for diff_weights. It runs before lower_down.
+status_t fuse_bias_add_bwd_to_conv_bwd_weights(
+        std::shared_ptr<subgraph_t> &sg);
+
 status_t pool_fwd_canonicalization(std::shared_ptr<subgraph_t> &sg);
 
 status_t pool_bwd_canonicalization(std::shared_ptr<subgraph_t> &sg);
@@ -141,6 +154,12 @@ status_t fuse_dynamic_mul_scales_add_zps(std::shared_ptr<subgraph_t> &sg);
 // This pass handle dynamic dequantization:sub_zp+mul_scale
 status_t fuse_dynamic_sub_zps_mul_scales(std::shared_ptr<subgraph_t> &sg);
 
+// This pass removes a DynamicQuantize whose output is only dequantized by the
+// src DynamicDequantize of a MatMul with the same scales, and marks the MatMul
+// to quantize its src at execution instead. It runs before lower_down and only
+// on CPU.
+status_t fuse_dynamic_quant_to_matmul(std::shared_ptr<subgraph_t> &sg);
+
 // This pass is used to convert single mul_scale,add_zp,sub_zp to reorder
 // After "remove_quant_data_with_no_effect", maybe there is only single op.
 impl::status_t convert_dynamic_quantize_ops(std::shared_ptr<subgraph_t> &sg);
@@ -158,6 +177,24 @@ status_t softmax_bwd_canonicalization(std::shared_ptr<subgraph_t> &sg);
 ///            op3  op4        op3  op4
 status_t common_reorder_elimination(std::shared_ptr<subgraph_t> &sg);
 
+/// This pass moves a layout-changing reorder down through a chain of eltwise
+/// ops up to the next reorder when a cost model says it is cheaper, so that
+/// the eltwise ops run in the layout of the producer. Then the two reorders
+/// merge, or both disappear if the layouts at the ends of the chain match.
+/// The cost of an op is the number of bytes it reads and writes.
+///
+///     [A]                     [A]
+///      |                       |
+///   reorder                 eltwise
+///      |[B]                    |[A]
+///   eltwise       -->       eltwise
+///      |[B]                    |[A]
+///   eltwise                 reorder (removed if C is A)
+///      |[B]                    |[C]
+///   reorder
+///      |[C]
+status_t sink_reorders_by_cost(std::shared_ptr<subgraph_t> &sg);
+
 // This pass currently can be used for int8 Pooling and int8 Eltwise only (as
 // they are not supporting quantization-related attributes). Scales will get
 // combined only if there is a single binary post-op.
@@ -297,6 +334,12 @@ status_t fuse_implicit_causal_mask(std::shared_ptr<subgraph_t> &sg);
 /// This pass will transform the sdpa subgraph into a dnnl_sdpa op.
 status_t fuse_sdpa(std::shared_ptr<subgraph_t> &sg);
 
+/// This pass will mark the concat ops whose first input and output are the
+/// subgraph input and output with the same strides, e.g. the KV cache and the
+/// updated KV cache in LLM decoding. When users pass the same buffer for them,
+/// only the rest of inputs are appended to the buffer at execution.
+status_t mark_in_place_append_concat(std::shared_ptr<subgraph_t> &sg);
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include "graph/backend/dnnl/kernels/conv.hpp"
+#include "graph/backend/dnnl/kernels/large_partition.hpp"
 #include "graph/backend/dnnl/patterns/fusions.hpp"
 #include "graph/backend/dnnl/patterns/pattern_matcher_pass.hpp"
 #include "graph/backend/dnnl/patterns/utils.hpp"
@@ -826,31 +827,36 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(
         });
 
 /*
-                  wildcard
+                  unary_bwd
               \   /      \
       conv_bwd_weight  biasadd_bwd
                 |          |
 */
+/*
+Note: diff_bias is computed by the convolution backward weights primitive, so
+diff_dst is read once for both gradients. The output of unary_bwd is usually
+also consumed by the convolution backward data outside of the partition.
+*/
 #if BUILD_TRAINING
 DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, fp_conv_bwd_weights_bias)
-        .set_enable(false)
         .set_kind(partition_kind_t::convolution_backward_post_ops)
         .set_priority(9.7f)
         .set_attr<FCreatePattern>("FCreatePattern",
                 [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
-                    pm::pb_op_t *wildcard
-                            = pgraph->append_op(graph::op_kind::Wildcard);
+                    pm::pb_op_t *unary_bwd
+                            = pgraph->append_alternation(get_unary_bwd_ops());
+                    unary_bwd->allow_external_outputs();
                     graph::utils::pm::pb_op_t *p_conv_backward_weights
                             = pgraph->append_op(
                                     graph::op_kind::ConvolutionBackwardWeights,
-                                    in_edges_t {in_edge(1, wildcard, 0)});
+                                    in_edges_t {in_edge(1, unary_bwd, 0)});
                     p_conv_backward_weights->append_decision_function(
                             check_input_num<2>);
                     pgraph->append_op(graph::op_kind::BiasAddBackward,
-                            in_edges_t {in_edge(0, wildcard, 0)});
+                            in_edges_t {in_edge(0, unary_bwd, 0)});
                 })
         .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
-            return std::make_shared<conv_bwd_weights_t>();
+            return std::make_shared<larger_partition_kernel_t>();
         });
 #endif
 
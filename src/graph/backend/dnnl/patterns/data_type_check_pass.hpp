@@ -98,6 +98,7 @@ inline platform::dir_t get_op_dir(const std::shared_ptr<op_t> &aop) {
         // LayerNorm
         case LayerNorm: dir = dir_t::FWD_I; break;
         case LayerNormBackward: dir = dir_t::BWD_DW; break;
+        case RMSNorm: dir = dir_t::FWD_I; break;
         // Pool
         case MaxPool:
         case AvgPool: dir = dir_t::FWD_I; break;
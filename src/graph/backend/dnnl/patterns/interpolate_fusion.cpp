@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include "graph/backend/dnnl/kernels/large_partition.hpp"
 #include "graph/backend/dnnl/kernels/resampling.hpp"
 #include "graph/backend/dnnl/patterns/fusions.hpp"
 #include "graph/backend/dnnl/patterns/pattern_matcher_pass.hpp"
@@ -41,6 +42,21 @@ bool check_attributes(op_t *op) {
             "other coordinate_transformation_mode except half_pixel");
     return result;
 }
+
+bool check_nearest_upsample(op_t *op) {
+    return op->get_attr<std::string>(op_attr::mode) == "nearest"
+            && check_attributes(op);
+}
+
+bool check_unit_strided_conv(op_t *op) {
+    const auto is_one = [](int64_t v) { return v == 1; };
+    const auto &strides = op->get_attr<std::vector<int64_t>>(op_attr::strides);
+    const auto &dilations
+            = op->get_attr<std::vector<int64_t>>(op_attr::dilations);
+    return op->get_attr<int64_t>(op_attr::groups) == 1
+            && std::all_of(strides.begin(), strides.end(), is_one)
+            && std::all_of(dilations.begin(), dilations.end(), is_one);
+}
 } // namespace
 
 DNNL_BACKEND_REGISTER_PATTERN_DEF_BEGIN(interpolate_fusion)
@@ -70,6 +86,52 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, fp_interpolate_post_ops)
             return std::make_shared<resampling_fwd_t>();
         });
 
+/*
+      Interpolate (nearest)
+            |    /
+       Convolution
+            |
+       [BiasAdd]*
+            |
+[unary/binary]*[0,MAX_REPETITION)
+            |
+*/
+// The upsampling is folded into a strided deconvolution over the original
+// source, so the upsampled tensor is never written.
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, fp_upsample_conv_post_ops)
+        .set_priority(10.0f)
+        .set_kind(partition_kind_t::convolution_post_ops)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    pm::pb_op_t *interpolate
+                            = pgraph->append_op(graph::op_kind::Interpolate);
+                    interpolate->append_decision_function(
+                            check_nearest_upsample);
+                    interpolate->append_decision_function(
+                            check_input_num<1>);
+
+                    pm::pb_op_t *conv
+                            = pgraph->append_op(graph::op_kind::Convolution,
+                                    in_edges_t {in_edge(0, interpolate, 0)});
+                    conv->append_decision_function(check_unit_strided_conv);
+
+                    auto popt_bias = optional_bias_add(pgraph, conv, false);
+
+                    auto alt_graph = std::make_shared<pb_graph_t>();
+                    auto palt = alt_graph->append_alternation(
+                            get_unary_binary_ops());
+                    palt->allow_internal_inputs();
+                    alt_graph->create_input_port(0, palt, 0);
+                    alt_graph->create_output_port(0, palt, 0);
+
+                    pgraph->append_repetition(alt_graph, {0, 0}, 0,
+                            MAX_REPETITION,
+                            in_edges_t {in_edge(0, popt_bias, 0)});
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<larger_partition_kernel_t>();
+        });
+
 DNNL_BACKEND_REGISTER_PATTERN_DEF_END
 
 } // namespace pattern
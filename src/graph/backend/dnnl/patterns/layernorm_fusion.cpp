@@ -31,7 +31,7 @@ using in_edges_t = pm::in_edges_t;
 using pb_graph_t = pm::pb_graph_t;
 using FCreatePattern = graph::pass::FCreatePattern;
 
-//             LayerNorm
+//        LayerNorm | RMSNorm
 //                 |
 //            [TypeCast]*
 //                 |
@@ -47,8 +47,10 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, layernorm_post_ops_fusion_cpu)
         .set_engine_kind(engine_kind::cpu)
         .set_attr<FCreatePattern>("FCreatePattern",
                 [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
-                    pm::pb_op_t *layernorm_base
-                            = pgraph->append_op(graph::op_kind::LayerNorm);
+                    pm::pb_op_t *layernorm_base = pgraph->append_alternation(
+                            std::vector<graph::op_kind_t> {
+                                    graph::op_kind::LayerNorm,
+                                    graph::op_kind::RMSNorm});
                     layernorm_base->append_decision_function(
                             check_input_dtype_from_offset<impl::data_type::f32,
                                     1>);
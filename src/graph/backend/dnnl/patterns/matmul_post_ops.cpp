@@ -1025,6 +1025,71 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(
             return std::make_shared<quantized_matmul>();
         });
 
+/*
+        |
+  dynamic_quant_data
+        |
+  dynamic_dequant_data   dynamic_dequant_weight
+        \_____             _____/
+                matmul
+                  |
+                [bias]*
+                  |
+        [unary]*[0,MAX_REPETITION)
+                  |
+*/
+/*
+Note: The quantization of the activation is performed by the matmul primitive
+on CPU, so the s8 activation is never written to memory.
+*/
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(
+        dnnl, dynamic_quant_x8s8f_matmul_post_ops_cpu)
+        .set_priority(10.1f)
+        .set_engine_kind(engine_kind::cpu)
+        .set_kind(partition_kind_t::quantized_matmul_post_ops)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    pm::pb_op_t *quant_data = pgraph->append_op(
+                            graph::op_kind::DynamicQuantize);
+                    quant_data->append_decision_function(check_input_num<2>);
+                    quant_data->append_decision_function(
+                            check_output_dtype<graph::data_type::s8>);
+                    pm::pb_op_t *dequant_data = pgraph->append_op(
+                            graph::op_kind::DynamicDequantize,
+                            in_edges_t {in_edge(0, quant_data, 0)});
+                    dequant_data->append_decision_function(check_input_num<2>);
+
+                    pm::pb_op_t *dequant_weight = pgraph->append_op(
+                            graph::op_kind::DynamicDequantize);
+                    dequant_weight->append_decision_function(
+                            check_input_num<2>);
+                    dequant_weight->append_decision_function(
+                            check_input_dtype<graph::data_type::s8>);
+
+                    pm::pb_op_t *pmatmul
+                            = pgraph->append_op(graph::op_kind::MatMul,
+                                    in_edges_t {in_edge(0, dequant_data, 0),
+                                            in_edge(1, dequant_weight, 0)});
+
+                    // Optional bias_add
+                    auto popt_bias = optional_bias_add(pgraph, pmatmul, false);
+
+                    auto postop_graph = std::make_shared<pb_graph_t>();
+                    pm::pb_op_t *pop
+                            = postop_graph->append_alternation(get_unary_ops());
+                    postop_graph->create_input_port(0, pop, 0);
+                    postop_graph->create_output_port(0, pop, 0);
+
+                    pgraph->append_repetition(postop_graph, {0, 0}, 0,
+                            MAX_REPETITION,
+                            in_edges_t {in_edge(0, popt_bias, 0)});
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<quantized_matmul>();
+        });
+#endif
+
 DNNL_BACKEND_REGISTER_PATTERN_DEF_END
 
 } // namespace pattern
@@ -14,7 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
-#include "graph/backend/dnnl/kernels/large_partition.hpp"
+#include "graph/backend/dnnl/kernels/gated_mlp.hpp"
 
 #include "graph/backend/dnnl/patterns/fusions.hpp"
 #include "graph/backend/dnnl/patterns/pattern_matcher_pass.hpp"
@@ -77,7 +77,7 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, gated_mlp)
                             in_edges_t {in_edge(0, bin, 0)});
                 })
         .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
-            return std::make_shared<larger_partition_kernel_t>();
+            return std::make_shared<gated_mlp_base_t>();
         });
 
 // gated mlp with swish decomposed to sigmoid and multiply.
@@ -112,7 +112,7 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, gated_mlp_v1)
                             in_edges_t {in_edge(0, bin, 0)});
                 })
         .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
-            return std::make_shared<larger_partition_kernel_t>();
+            return std::make_shared<gated_mlp_base_t>();
         });
 
 /*
@@ -167,7 +167,7 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, quantized_gated_mlp)
                     pgraph->append_op(graph::op_kind::MatMul, fc_down_edges);
                 })
         .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
-            return std::make_shared<larger_partition_kernel_t>();
+            return std::make_shared<gated_mlp_base_t>();
         });
 
 // quantized gated mlp with swish decomposed to sigmoid and multiply.
@@ -209,7 +209,7 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, quantized_gated_mlp_v1)
                     pgraph->append_op(graph::op_kind::MatMul, fc_down_edges);
                 })
         .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
-            return std::make_shared<larger_partition_kernel_t>();
+            return std::make_shared<gated_mlp_base_t>();
         });
 
 DNNL_BACKEND_REGISTER_PATTERN_DEF_END
@@ -156,6 +156,103 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, float_sdp_gemma_fusion_cpu)
             return std::make_shared<sdp_base_t<>>();
         });
 
+/*
+ [key cache] [new key]
+          \   /
+ [query]  Concat       [value cache] [new value]
+      \    /                   \   /
+       MatMul                  Concat
+          |                      |
+ optional scale and masks        |
+          |                      |
+       Softmax                   |
+            \                   /
+                   MatMul
+                     |
+    optional transpose + reshape/reorder
+                     |
+                 [output]
+
+The new rows of key and value are appended to the caches by the Concat ops,
+whose outputs are also the outputs of the partition. When the caches and the
+updated caches are given with the same strides, the partition reports them as
+inplace pairs and only the new rows are copied if the same buffers are used.
+*/
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(
+        dnnl, float_sdp_with_kv_cache_fusion_cpu)
+        .set_priority(22.0f)
+        .set_kind(partition_kind_t::sdp)
+        .set_engine_kind(engine_kind::cpu)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    auto concat_k = pgraph->append_op(graph::op_kind::Concat);
+                    concat_k->append_decision_function(check_input_num<2>);
+                    concat_k->allow_external_outputs();
+                    auto matmul_qk = pgraph->append_op(
+                            graph::op_kind::MatMul, {in_edge(1, concat_k, 0)});
+                    auto optional_scale_and_mask
+                            = optional_scale_and_masks(pgraph, matmul_qk);
+                    auto softmax = pgraph->append_op(graph::op_kind::SoftMax,
+                            {in_edge(0, optional_scale_and_mask, 0)});
+                    auto concat_v = pgraph->append_op(graph::op_kind::Concat);
+                    concat_v->append_decision_function(check_input_num<2>);
+                    concat_v->allow_external_outputs();
+                    auto matmul_v = pgraph->append_op(graph::op_kind::MatMul,
+                            {in_edge(0, softmax, 0), in_edge(1, concat_v, 0)});
+                    // Optional transpose + reshape/reorder
+                    optional_transpose_reshape(pgraph, matmul_v, 0);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<sdp_base_t<>>();
+        });
+
+/*
+ [key cache] [block table]
+          \   /
+ [query] PagedCacheLoad  [value cache] [block table]
+      \    /                       \   /
+       MatMul                PagedCacheLoad
+          |                          |
+ optional scale and masks            |
+          |                          |
+       Softmax                       |
+            \                       /
+                   MatMul
+                     |
+    optional transpose + reshape/reorder
+                     |
+                 [output]
+
+Key and value are read from paged caches through the block tables. The
+decomposed kernel copies the listed pages of a head directly into its
+per-thread buffers, so no dense copy of the caches is materialized.
+*/
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(
+        dnnl, float_sdp_with_paged_cache_fusion_cpu)
+        .set_priority(22.0f)
+        .set_kind(partition_kind_t::sdp)
+        .set_engine_kind(engine_kind::cpu)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    auto load_k = pgraph->append_op(
+                            graph::op_kind::PagedCacheLoad);
+                    auto matmul_qk = pgraph->append_op(
+                            graph::op_kind::MatMul, {in_edge(1, load_k, 0)});
+                    auto optional_scale_and_mask
+                            = optional_scale_and_masks(pgraph, matmul_qk);
+                    auto softmax = pgraph->append_op(graph::op_kind::SoftMax,
+                            {in_edge(0, optional_scale_and_mask, 0)});
+                    auto load_v = pgraph->append_op(
+                            graph::op_kind::PagedCacheLoad);
+                    auto matmul_v = pgraph->append_op(graph::op_kind::MatMul,
+                            {in_edge(0, softmax, 0), in_edge(1, load_v, 0)});
+                    // Optional transpose + reshape/reorder
+                    optional_transpose_reshape(pgraph, matmul_v, 0);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<sdp_base_t<>>();
+        });
+
 // for implicit causal mask, gpu only supports f16/bf16 dtype
 DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, float_sdp_fusion_gpu)
         .set_priority(21.0f)
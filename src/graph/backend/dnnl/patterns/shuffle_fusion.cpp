@@ -15,9 +15,11 @@
 *******************************************************************************/
 
 #include "graph/backend/dnnl/internal_ops.hpp"
+#include "graph/backend/dnnl/kernels/conv.hpp"
 #include "graph/backend/dnnl/kernels/shuffle.hpp"
 #include "graph/backend/dnnl/patterns/fusions.hpp"
 #include "graph/backend/dnnl/patterns/pattern_matcher_pass.hpp"
+#include "graph/backend/dnnl/patterns/utils.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -32,6 +34,61 @@ using FCreatePattern = graph::pass::FCreatePattern;
 
 DNNL_BACKEND_REGISTER_PATTERN_DEF_BEGIN(shuffle_fusion)
 
+/*
+      StaticReshape
+            |
+     StaticTranspose
+            |
+      StaticReshape
+            |    /
+       Convolution
+            |
+       [BiasAdd]*
+            |
+[unary/binary]*[0,MAX_REPETITION)
+            |
+*/
+// The channel shuffle is folded into the constant weights of the following
+// non-grouped convolution, so no data is moved for it at execution.
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, fp_shuffle_conv_post_ops)
+        .set_priority(10.0f)
+        .set_kind(partition_kind_t::convolution_post_ops)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph> &pgraph) -> void {
+                    pm::pb_op_t *reshape0
+                            = pgraph->append_op(graph::op_kind::StaticReshape);
+                    pm::pb_op_t *transpose
+                            = pgraph->append_op(graph::op_kind::StaticTranspose,
+                                    in_edges_t {in_edge(0, reshape0, 0)});
+                    pm::pb_op_t *reshape1
+                            = pgraph->append_op(graph::op_kind::StaticReshape,
+                                    in_edges_t {in_edge(0, transpose, 0)});
+                    pm::pb_op_t *conv
+                            = pgraph->append_op(graph::op_kind::Convolution,
+                                    in_edges_t {in_edge(0, reshape1, 0)});
+                    conv->append_decision_function([](op_t *graph_op) -> bool {
+                        return !graph_op->has_attr(op_attr::groups)
+                                || graph_op->get_attr<int64_t>(op_attr::groups)
+                                == 1;
+                    });
+
+                    auto popt_bias = optional_bias_add(pgraph, conv, false);
+
+                    auto alt_graph = std::make_shared<pb_graph>();
+                    auto palt = alt_graph->append_alternation(
+                            get_unary_binary_ops());
+                    palt->allow_internal_inputs();
+                    alt_graph->create_input_port(0, palt, 0);
+                    alt_graph->create_output_port(0, palt, 0);
+
+                    pgraph->append_repetition(alt_graph, {0, 0}, 0,
+                            MAX_REPETITION,
+                            in_edges_t {in_edge(0, popt_bias, 0)});
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<float_conv_fwd>();
+        });
+
 DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, shuffle_fusion)
         .set_priority(8.2f)
         .set_kind(partition_kind_t::misc_post_ops)
@@ -209,6 +209,26 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, ln_pass)
             return std::make_shared<layer_norm_fwd_t>();
         });
 
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, rms_norm_pass)
+        .set_priority(DEFAULT_P)
+        .set_kind(partition_kind_t::misc_post_ops)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    graph::utils::pm::pb_op_t *p_rms_norm
+                            = pgraph->append_op(graph::op_kind::RMSNorm);
+                    p_rms_norm->append_decision_function(
+                            check_input_dtype_from_offset<graph::data_type::f32,
+                                    1>);
+                    p_rms_norm->append_decision_function(
+                            check_begin_norm_axis_attr);
+                    // primitive only support 2-5D data tensor for layernorm
+                    p_rms_norm->append_decision_function(
+                            check_input_ndim_from_offset<0, 2, 5>);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<layer_norm_fwd_t>();
+        });
+
 #if BUILD_TRAINING
 DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, ln_bw_pass)
         .set_priority(DEFAULT_P)
@@ -298,6 +318,11 @@ DNNL_BACKEND_SINGLE_OP_TRANSFORM(max_pool_pass, MaxPool, float_pooling_fwd)
 DNNL_BACKEND_SINGLE_OP_TRANSFORM(prelu_pass, PReLU, float_prelu_fwd)
 DNNL_BACKEND_SINGLE_OP_TRANSFORM(logsoftmax_pass, LogSoftmax, logsoftmax_fwd_t)
 DNNL_BACKEND_SINGLE_OP_TRANSFORM(softmax_pass, SoftMax, softmax_fwd_t)
+DNNL_BACKEND_SINGLE_OP_TRANSFORM(
+        rotary_embedding_pass, RotaryEmbedding, larger_partition_kernel_t)
+DNNL_BACKEND_SINGLE_OP_TRANSFORM(
+        paged_cache_load_pass, PagedCacheLoad, larger_partition_kernel_t)
+DNNL_BACKEND_SINGLE_OP_TRANSFORM(gather_pass, Gather, larger_partition_kernel_t)
 
 #if BUILD_TRAINING
 DNNL_BACKEND_SINGLE_OP_TRANSFORM(
@@ -394,6 +394,16 @@ void subgraph_rewriter_t::run() {
     to_be_inserted_ops_.clear();
 }
 
+// Record the ids of the user ops which an op comes from on the op replacing or
+// absorbing it, so that the executables can be mapped back to the user ops.
+static void inherit_op_ids(const op_t &from, op_t &to) {
+    if (from.is_fused()) {
+        to.add_op_ids(from.get_op_ids());
+    } else if (from.get_id() != op_t::DEFAULT_ID) {
+        to.add_op_ids(from.get_id());
+    }
+}
+
 void subgraph_rewriter_t::fuse_op_to_successor(const op_ptr &op) {
     assertm(op->num_inputs() == 1, "this op should have only one input value.");
     value_ptr in_val = op->get_input_value(0);
@@ -408,6 +418,7 @@ void subgraph_rewriter_t::fuse_op_to_successor(const op_ptr &op) {
     size_t offset = consumers[0].get_offset();
     in_val->add_consumer(successor, offset);
     successor.connect_input(offset, in_val);
+    inherit_op_ids(*op, successor);
 
     to_remove(op);
 }
@@ -428,6 +439,7 @@ void subgraph_rewriter_t::fuse_op_to_predecessor(const op_ptr &op, size_t i) {
         tmp->add_consumer(predecessor, predecessor.num_inputs());
         predecessor.add_input(tmp);
     }
+    inherit_op_ids(*op, predecessor);
 
     to_remove(op);
 }
@@ -525,6 +537,7 @@ void subgraph_rewriter_t::replace_op(
         auto out_val = org_op->get_output_value(i);
         new_op->add_output(out_val);
     }
+    inherit_op_ids(*org_op, *new_op);
 
     to_insert(new_op);
     to_remove(org_op);
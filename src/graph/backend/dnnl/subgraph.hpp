@@ -92,6 +92,10 @@ public:
 
     // The executable for each op in subgraph
     std::vector<std::shared_ptr<op_executable_t>> execs_;
+
+    // The name of each executable's op and the ids of the user ops it comes
+    // from, reported by per-op execution profiling
+    std::vector<std::string> exec_infos_;
 };
 
 class subgraph_visualizer_t {
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright 2021-2024 Intel Corporation
+ * Copyright 2021-2025 Intel Corporation
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,6 +16,8 @@
 #ifndef GRAPH_BACKEND_DNNL_THREAD_LOCAL_CACHE_HPP
 #define GRAPH_BACKEND_DNNL_THREAD_LOCAL_CACHE_HPP
 
+#include <array>
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -56,7 +58,10 @@ namespace dnnl_impl {
 // - If cache miss, we need to add a new value to the global table, and add its
 //   weak_ptr to the thread local table correspondingly. Ann we need to use a
 //   lock to protect the global table. The performance should be bad, but cache
-//   miss should be rare.
+//   miss should be rare. To not serialize threads executing different
+//   partitions, or many threads executing the same partition for the first
+//   time, the global table is split into shards by key, each with its own
+//   lock.
 // - We can read/write the found resource in each thread without lock, because
 //   each thread has its own replica.
 // - If a thread existed, the thread local table will be destroyed, during
@@ -76,7 +81,8 @@ public:
     // Check if we have a cached value for the given key in current thread
     bool has_resource(const size_t &key) {
         cache_type_t &cache = get_thread_local_cache();
-        return cache.data().count(key) && !cache.data()[key].expired();
+        auto it = cache.data().find(key);
+        return it != cache.data().end() && !it->second.expired();
     }
 
     // return the number of cached values in current thread
@@ -94,8 +100,8 @@ public:
             for (auto &it : lcache.data()) {
                 std::shared_ptr<T> value = it.second.lock();
                 if (value) {
-                    std::lock_guard<std::mutex> lock(gcache->mutex());
-                    auto &data = gcache->data();
+                    std::lock_guard<std::mutex> lock(gcache->mutex(it.first));
+                    auto &data = gcache->data(it.first);
 
                     auto ret = data.find(it.first);
                     if (ret != data.end()) {
@@ -121,9 +127,10 @@ public:
         global_cache_type_t *gcache = global_cache_type_t::get_global_cache();
         // for safety purpose. it should not be nullptr.
         if (gcache) {
-            std::lock_guard<std::mutex> lock(gcache->mutex());
-            auto pos = gcache->data().find(key);
-            if (pos != gcache->data().end()) { pos->second.clear(); }
+            std::lock_guard<std::mutex> lock(gcache->mutex(key));
+            auto &data = gcache->data(key);
+            auto pos = data.find(key);
+            if (pos != data.end()) { pos->second.clear(); }
         }
     }
 
@@ -132,29 +139,29 @@ public:
     T *get_or_add(const size_t &key,
             const std::function<std::shared_ptr<T>()> &creator) {
         cache_type_t &cache = get_thread_local_cache();
-        if (has_resource(key)) { // cache hit
-            return cache.data()[key].lock().get();
-        } else { // cache miss
-            // Cache miss shouldn't happen frequently, because the lock is
-            // heavy. No double-check is needed here since cached values won't
-            // be shared between threads
-            std::shared_ptr<T> ins = creator();
-            {
-                auto *gcache = global_cache_type_t::get_global_cache();
-                // for safety purpose. it should not be nullptr.
-                if (gcache) {
-                    std::lock_guard<std::mutex> lock(gcache->mutex());
-                    if (gcache->data().count(key)) {
-                        gcache->data().at(key).emplace_back(ins);
-                    } else {
-                        gcache->data().emplace(
-                                key, std::vector<std::shared_ptr<T>> {ins});
-                    }
-                }
+        // A single lookup in the thread local table, no locks on a hit. The
+        // value stays alive after `lock()` result is gone as the global table
+        // owns it.
+        auto it = cache.data().find(key);
+        if (it != cache.data().end()) {
+            T *value = it->second.lock().get();
+            if (value) return value; // cache hit
+        }
+
+        // Cache miss shouldn't happen frequently, because the lock is heavy.
+        // No double-check is needed here since cached values won't be shared
+        // between threads
+        std::shared_ptr<T> ins = creator();
+        {
+            auto *gcache = global_cache_type_t::get_global_cache();
+            // for safety purpose. it should not be nullptr.
+            if (gcache) {
+                std::lock_guard<std::mutex> lock(gcache->mutex(key));
+                gcache->data(key)[key].emplace_back(ins);
             }
-            cache.data()[key] = ins;
-            return ins.get();
         }
+        cache.data()[key] = ins;
+        return ins.get();
     }
 
     // This function increments the reference count
@@ -171,12 +178,13 @@ public:
 private:
     class global_cache_type_t {
     public:
+        using data_type_t
+                = std::unordered_map<size_t, std::vector<std::shared_ptr<T>>>;
+
         global_cache_type_t() : counter_(1) {}
         ~global_cache_type_t() = default;
-        std::mutex &mutex() { return mutex_; }
-        std::unordered_map<size_t, std::vector<std::shared_ptr<T>>> &data() {
-            return data_;
-        }
+        std::mutex &mutex(size_t key) { return shards_[shard(key)].mutex; }
+        data_type_t &data(size_t key) { return shards_[shard(key)].data; }
 
         static global_cache_type_t *get_global_cache() {
             // A global table to store cached values in ALL threads. This global
@@ -201,8 +209,23 @@ private:
         }
 
     private:
-        std::mutex mutex_;
-        std::unordered_map<size_t, std::vector<std::shared_ptr<T>>> data_;
+        static constexpr size_t n_shards = 16;
+
+        // Keys are usually addresses or hashes, mix the bits to not put
+        // aligned addresses into the same shard.
+        static size_t shard(size_t key) {
+            return static_cast<size_t>(
+                           (static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ULL)
+                           >> 32)
+                    % n_shards;
+        }
+
+        struct shard_t {
+            std::mutex mutex;
+            data_type_t data;
+        };
+
+        std::array<shard_t, n_shards> shards_;
         std::atomic<int32_t> counter_;
     };
 
@@ -218,11 +241,13 @@ private:
             for (auto &it : data_) {
                 std::shared_ptr<T> value = it.second.lock();
                 if (value) {
-                    std::lock_guard<std::mutex> lock(global_cache_ref_.mutex());
+                    std::lock_guard<std::mutex> lock(
+                            global_cache_ref_.mutex(it.first));
 
                     // Find the corresponding shared ptr in global table
-                    auto ret = global_cache_ref_.data().find(it.first);
-                    if (ret != global_cache_ref_.data().end()) {
+                    auto &data = global_cache_ref_.data(it.first);
+                    auto ret = data.find(it.first);
+                    if (ret != data.end()) {
                         std::vector<std::shared_ptr<T>> &thread_instances
                                 = ret->second;
                         auto pos = std::find_if(thread_instances.begin(),
@@ -156,6 +156,7 @@ const op_kind_t End = dnnl_graph_op_end;
 const op_kind_t Exp = dnnl_graph_op_exp;
 const op_kind_t GELU = dnnl_graph_op_gelu;
 const op_kind_t GELUBackward = dnnl_graph_op_gelu_backward;
+const op_kind_t Gather = dnnl_graph_op_gather;
 const op_kind_t GenIndex = dnnl_graph_op_gen_index;
 const op_kind_t GreaterEqual = dnnl_graph_op_greater_equal;
 const op_kind_t GroupNorm = dnnl_graph_op_group_norm;
@@ -179,6 +180,7 @@ const op_kind_t Minimum = dnnl_graph_op_minimum;
 const op_kind_t Mish = dnnl_graph_op_mish;
 const op_kind_t MishBackward = dnnl_graph_op_mish_backward;
 const op_kind_t Multiply = dnnl_graph_op_multiply;
+const op_kind_t PagedCacheLoad = dnnl_graph_op_paged_cache_load;
 const op_kind_t Pow = dnnl_graph_op_pow;
 const op_kind_t PReLU = dnnl_graph_op_prelu;
 const op_kind_t PReLUBackward = dnnl_graph_op_prelu_backward;
@@ -194,6 +196,8 @@ const op_kind_t ReduceSum = dnnl_graph_op_reduce_sum;
 const op_kind_t ReLU = dnnl_graph_op_relu;
 const op_kind_t ReLUBackward = dnnl_graph_op_relu_backward;
 const op_kind_t Reorder = dnnl_graph_op_reorder;
+const op_kind_t RMSNorm = dnnl_graph_op_rms_norm;
+const op_kind_t RotaryEmbedding = dnnl_graph_op_rotary_embedding;
 const op_kind_t Round = dnnl_graph_op_round;
 const op_kind_t Select = dnnl_graph_op_select;
 const op_kind_t Sigmoid = dnnl_graph_op_sigmoid;
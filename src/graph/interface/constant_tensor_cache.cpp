@@ -41,6 +41,11 @@
 
 #ifdef _WIN32
 #include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #endif
 
 namespace std {
@@ -220,6 +225,18 @@ void constant_tensor_cache_t::remove_if_exist(
     }
 }
 
+bool constant_tensor_cache_t::set_pinned(
+        c_key_t backend_id, c_key_t backend_specific_key, bool pinned) {
+    c_key_t key = combine_key(backend_id, backend_specific_key);
+
+    lock_write();
+    auto it = constant_map().find(key);
+    const bool found = it != constant_map().end();
+    if (found) it->second.pinned_ = pinned;
+    unlock_write();
+    return found;
+}
+
 // Get the total size of all cached buffers
 size_t constant_tensor_cache_t::get_size() const {
     size_t total_size = 0;
@@ -260,16 +277,31 @@ c_value_t constant_tensor_cache_t::get(const c_key_t &key) {
 // Evict n size of cached buffers
 void constant_tensor_cache_t::evict(size_t n) {
     using v_t = std::unordered_map<c_key_t, timed_entry_t>::value_type;
+    // Pinned buffers are only dropped when the cache gets disabled
+    const bool keep_pinned = capacity_in_bytes_ != 0;
     if (n == get_size()) {
-        constant_map().clear();
+        for (auto it = constant_map().begin(); it != constant_map().end();) {
+            if (keep_pinned && it->second.pinned_)
+                ++it;
+            else
+                it = constant_map().erase(it);
+        }
         return;
     }
 
     size_t evicted_size = 0;
     while (evicted_size < n) {
         // We evict the least recently used items
-        auto it = std::min_element(constant_map().begin(), constant_map().end(),
+        auto it = std::find_if(constant_map().begin(), constant_map().end(),
+                [&](const v_t &e) {
+                    return !keep_pinned || !e.second.pinned_;
+                });
+        if (it == constant_map().end()) break;
+        it = std::min_element(it, constant_map().end(),
                 [&](const v_t &left, const v_t &right) {
+                    if (keep_pinned
+                            && left.second.pinned_ != right.second.pinned_)
+                        return right.second.pinned_;
                     // By default, load() and operator T use sequentially
                     // consistent memory ordering, which enforces writing the
                     // timestamps into registers in the same exact order they
@@ -436,6 +468,103 @@ constant_tensor_cache_t *get_constant_tensor_cache(
     return cache.get();
 }
 
+namespace {
+const std::string &shared_constant_cache_dir() {
+    static const std::string dir
+            = impl::getenv_string_user("GRAPH_CONSTANT_TENSOR_CACHE_DIR");
+    return dir;
+}
+
+std::string shared_constant_buffer_path(size_t key) {
+    char name[64];
+    snprintf(name, sizeof(name), "/dnnl_graph_constant_%016zx.bin", key);
+    return shared_constant_cache_dir() + name;
+}
+
+#ifndef _WIN32
+// A read-only mapping of a shared buffer file
+class mapped_constant_buffer_t : public constant_buffer_t {
+public:
+    mapped_constant_buffer_t(void *data, size_t size, impl::engine_t *eng)
+        : constant_buffer_t(data, size, eng, free_func) {}
+
+    ~mapped_constant_buffer_t() override { munmap(data_, size_); }
+
+private:
+    // The mapping is released in the destructor, which knows its size
+    static void free_func(void *, impl::engine_t *, allocator_t *) {}
+};
+#endif
+} // namespace
+
+bool is_shared_constant_cache_enabled(impl::engine_kind_t eng_kind) {
+#ifdef _WIN32
+    UNUSED(eng_kind);
+    return false;
+#else
+    return eng_kind == impl::engine_kind::cpu
+            && !shared_constant_cache_dir().empty();
+#endif
+}
+
+std::shared_ptr<constant_buffer_t> map_shared_constant_buffer(
+        size_t key, size_t size, impl::engine_t *eng) {
+#ifdef _WIN32
+    UNUSED(key);
+    UNUSED(size);
+    UNUSED(eng);
+    return nullptr;
+#else
+    if (size == 0 || !is_shared_constant_cache_enabled(eng->kind()))
+        return nullptr;
+
+    const std::string path = shared_constant_buffer_path(key);
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return nullptr;
+
+    struct stat st;
+    void *data = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) == size)
+        data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return nullptr;
+
+    return std::make_shared<mapped_constant_buffer_t>(data, size, eng);
+#endif
+}
+
+void store_shared_constant_buffer(size_t key, const constant_buffer_t &buffer) {
+#ifdef _WIN32
+    UNUSED(key);
+    UNUSED(buffer);
+#else
+    if (buffer.size() == 0) return;
+
+    // The content is written to a temporary file which is then renamed, so
+    // that other processes never map a partially written file.
+    const std::string path = shared_constant_buffer_path(key);
+    const std::string tmp_path = path + "." + std::to_string(getpid());
+    const int fd = open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_EXCL, 0644);
+    if (fd < 0) {
+        VWARN(graph, constant_tensor_cache, "could not create %s",
+                tmp_path.c_str());
+        return;
+    }
+
+    const char *data = buffer.data<char>();
+    size_t written = 0;
+    while (written < buffer.size()) {
+        const ssize_t n = write(fd, data + written, buffer.size() - written);
+        if (n <= 0) break;
+        written += static_cast<size_t>(n);
+    }
+    close(fd);
+
+    if (written != buffer.size() || rename(tmp_path.c_str(), path.c_str()) != 0)
+        unlink(tmp_path.c_str());
+#endif
+}
+
 } // namespace graph
 } // namespace impl
 } // namespace dnnl
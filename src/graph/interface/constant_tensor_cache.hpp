@@ -75,6 +75,19 @@ public:
     virtual void notify_evict() {}
 
 protected:
+    // Wraps a buffer not allocated by the backend, which is released by
+    // free_func.
+    constant_buffer_t(void *data, size_t size, impl::engine_t *eng,
+            free_func_t free_func)
+        : data_(data)
+        , size_(size)
+        , eng_(eng)
+        , alc_(nullptr)
+        , malloc_func_(nullptr)
+        , free_func_(free_func) {
+        eng_->retain();
+    }
+
     void *data_;
     size_t size_;
     impl::engine_t *eng_;
@@ -112,6 +125,11 @@ struct constant_tensor_cache_t {
             size_t size, const value_t &value);
     void remove_if_exist(key_t backend_id, key_t backend_specific_key);
 
+    // Pinned entries are kept when the cache is flushed by a capacity change,
+    // unless the cache is disabled. Returns false if the entry doesn't exist.
+    bool set_pinned(
+            key_t backend_id, key_t backend_specific_key, bool pinned);
+
     size_t get_size() const;
 
     // The key_t is composed of two parts: backend id and backend specific key.
@@ -142,8 +160,9 @@ private:
     struct timed_entry_t {
         value_t value_;
         std::atomic<size_t> timestamp_;
+        bool pinned_;
         timed_entry_t(const value_t &value, size_t timestamp)
-            : value_(value), timestamp_(timestamp) {}
+            : value_(value), timestamp_(timestamp), pinned_(false) {}
     };
 
     std::unordered_map<key_t, timed_entry_t> &constant_map() {
@@ -168,6 +187,21 @@ private:
 constant_tensor_cache_t *get_constant_tensor_cache(
         impl::engine_kind_t eng_kind, size_t index);
 
+// Constant buffers of CPU engines can be shared between processes through
+// files in the directory set by ONEDNN_GRAPH_CONSTANT_TENSOR_CACHE_DIR. The
+// files are named by a key which backends compute from the content of the
+// constant inputs, and are mapped read-only into the processes using them.
+bool is_shared_constant_cache_enabled(impl::engine_kind_t eng_kind);
+
+// Maps the shared buffer of the key. Returns nullptr if there is none of the
+// given size.
+std::shared_ptr<constant_buffer_t> map_shared_constant_buffer(
+        size_t key, size_t size, impl::engine_t *eng);
+
+// Stores the content of a computed constant buffer as the shared buffer of
+// the key, unless another process has already done so.
+void store_shared_constant_buffer(size_t key, const constant_buffer_t &buffer);
+
 } // namespace graph
 } // namespace impl
 } // namespace dnnl
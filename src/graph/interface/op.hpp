@@ -394,6 +394,7 @@ public:
             CASE(Exp);
             CASE(GELU);
             CASE(GELUBackward);
+            CASE(Gather);
             CASE(GenIndex);
             CASE(GreaterEqual);
             CASE(GroupNorm);
@@ -417,6 +418,7 @@ public:
             CASE(Mish);
             CASE(MishBackward);
             CASE(Multiply);
+            CASE(PagedCacheLoad);
             CASE(Pow);
             CASE(PReLU);
             CASE(PReLUBackward);
@@ -432,6 +434,8 @@ public:
             CASE(ReLU);
             CASE(ReLUBackward);
             CASE(Reorder);
+            CASE(RMSNorm);
+            CASE(RotaryEmbedding);
             CASE(Round);
             CASE(Select);
             CASE(Sigmoid);
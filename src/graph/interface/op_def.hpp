@@ -447,6 +447,20 @@ DNNL_GRAPH_OP_SCHEMA(GELUBackward, 1,
                         "T", {data_type::f32, data_type::bf16, data_type::f16})
                 .set_shape_inference_function(infer_identity_output_shape))
 
+DNNL_GRAPH_OP_SCHEMA(Gather, 1,
+        op_schema_t()
+                .set_num_inputs(2)
+                .set_num_outputs(1)
+                .set_input(0, "src", "T1")
+                .set_input(1, "indices", "T2")
+                .set_output(0, "dst", "T1")
+                .set_attr(op_attr::axis, false, attribute_kind::i, int64_t(0))
+                .set_type_constraints("T1",
+                        {data_type::f32, data_type::bf16, data_type::f16,
+                                data_type::s8, data_type::u8})
+                .set_type_constraints("T2", {data_type::s32})
+                .set_shape_inference_function(infer_gather_output_shape))
+
 DNNL_GRAPH_OP_SCHEMA(GenIndex, 1,
         op_schema_t()
                 .set_num_inputs(1)
@@ -821,6 +835,19 @@ DNNL_GRAPH_OP_SCHEMA(Multiply, 1,
                 .set_shape_inference_function(
                         infer_elemwise_arithmetic_output_shape))
 
+DNNL_GRAPH_OP_SCHEMA(PagedCacheLoad, 1,
+        op_schema_t()
+                .set_num_inputs(2)
+                .set_num_outputs(1)
+                .set_input(0, "cache", "T1")
+                .set_input(1, "block_table", "T2")
+                .set_output(0, "dst", "T1")
+                .set_type_constraints(
+                        "T1", {data_type::f32, data_type::bf16, data_type::f16})
+                .set_type_constraints("T2", {data_type::s32})
+                .set_shape_inference_function(
+                        infer_paged_cache_load_output_shape))
+
 DNNL_GRAPH_OP_SCHEMA(Pow, 1,
         op_schema_t()
                 .set_num_inputs(1)
@@ -989,6 +1016,40 @@ DNNL_GRAPH_OP_SCHEMA(ReLUBackward, 1,
                         "T", {data_type::f32, data_type::bf16, data_type::f16})
                 .set_shape_inference_function(infer_identity_output_shape))
 
+DNNL_GRAPH_OP_SCHEMA(RMSNorm, 1,
+        op_schema_t()
+                .set_inputs_option(op_schema_t::param_num_option::optional)
+                .set_num_inputs(std::set<size_t>({1, 2}))
+                .set_num_outputs(1)
+                .set_input(0, "src", "T1")
+                .set_input(1, "gamma", "T2")
+                .set_output(0, "dst", "T1")
+                .set_attr(op_attr::begin_norm_axis, false, attribute_kind::i,
+                        int64_t(-1))
+                .set_attr(op_attr::use_affine, false, attribute_kind::b, true)
+                .set_attr(op_attr::epsilon, false, attribute_kind::f, 1e-5f)
+                .set_type_constraints(
+                        "T1", {data_type::f32, data_type::bf16, data_type::f16})
+                .set_type_constraints("T2", {data_type::f32, data_type::bf16})
+                .set_shape_inference_function(infer_identity_output_shape)
+                .set_op_def_constraint_function(check_ln_gn_data_type)
+                .set_op_def_constraint_function(check_rms_norm_use_affine))
+
+DNNL_GRAPH_OP_SCHEMA(RotaryEmbedding, 1,
+        op_schema_t()
+                .set_num_inputs(3)
+                .set_num_outputs(1)
+                .set_input(0, "src", "T1")
+                .set_input(1, "cos", "T2")
+                .set_input(2, "sin", "T2")
+                .set_output(0, "dst", "T1")
+                .set_type_constraints(
+                        "T1", {data_type::f32, data_type::bf16, data_type::f16})
+                .set_type_constraints(
+                        "T2", {data_type::f32, data_type::bf16, data_type::f16})
+                .set_shape_inference_function(
+                        infer_rotary_embedding_output_shape))
+
 DNNL_GRAPH_OP_SCHEMA(Round, 1,
         op_schema_t()
                 .set_num_inputs(1)
@@ -160,8 +160,11 @@ bool check_ln_gn_data_type(const op_t *n) {
     } else {
         if (input_values.size() > 2) {
             aux_lt = input_values[2]->get_logical_tensor();
-        } else {
+        } else if (output_values.size() > 1) {
             aux_lt = output_values[1]->get_logical_tensor();
+        } else {
+            // RMSNorm has gamma as the only optional input
+            aux_lt = input_values[1]->get_logical_tensor();
         }
     }
 
@@ -290,6 +293,20 @@ bool check_ln_bwd_use_affine(const op_t *n) {
     return true;
 }
 
+// check function for input number of RMSNorm.
+// gamma should be given if and only if use_affine is true.
+bool check_rms_norm_use_affine(const op_t *n) {
+    const size_t actual_num = n->num_inputs();
+    const bool use_affine = n->has_attr(op_attr::use_affine)
+            ? n->get_attr<bool>(op_attr::use_affine)
+            : true;
+    VCHECK_SHAPE_INFER((actual_num == (use_affine ? 2 : 1)),
+            "%s, inputs should include gamma if and only if use_affine is "
+            "true, given input num: %zu.",
+            op_t::kind2str(n->get_kind()).c_str(), actual_num);
+    return true;
+}
+
 // check function foraxes of Reduce.
 // including Reduce: L1/L2/Max/Mean/Min/Prod/Sum.
 // attribute_axes and input_axes is incompatible.
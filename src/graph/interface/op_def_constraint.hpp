@@ -50,6 +50,8 @@ bool check_ln_gn_fwd_outputs_num(const op_t *n);
 
 bool check_ln_bwd_use_affine(const op_t *n);
 
+bool check_rms_norm_use_affine(const op_t *n);
+
 bool check_reduce_axes(const op_t *n);
 
 bool check_quant_dequant_scales_zps(const op_t *n);
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <limits>
@@ -217,6 +218,56 @@ status_t DNNL_API dnnl_graph_partition_compile(partition_t *partition,
     return status::success;
 }
 
+status_t DNNL_API dnnl_graph_partition_compile_with_buckets(
+        partition_t *partition, compiled_partition_t *compiled_partition,
+        size_t in_num, const logical_tensor_t **inputs, size_t out_num,
+        const logical_tensor_t **outputs, size_t num_buckets,
+        const dim_t *buckets, engine_t *engine) {
+    if (utils::any_null(partition, compiled_partition, buckets, engine)
+            || num_buckets == 0) {
+        return status::invalid_arguments;
+    }
+
+    if (!partition->is_supported()) return status::invalid_arguments;
+
+    std::vector<const logical_tensor_t *> in {inputs, inputs + in_num};
+    std::vector<const logical_tensor_t *> out {outputs, outputs + out_num};
+    std::vector<dim_t> sizes {buckets, buckets + num_buckets};
+
+    if (get_verbose(dnnl::impl::verbose_t::create_profile,
+                dnnl::impl::component_t::graph)) {
+        double start_ms = dnnl::impl::get_msec();
+        CHECK(partition->compile_with_buckets(
+                compiled_partition, in, out, sizes, engine));
+        double duration_ms = dnnl::impl::get_msec() - start_ms;
+
+        VPROF(start_ms, graph, compile, "bucketed", compiled_partition->info(),
+                duration_ms);
+    } else {
+        CHECK(partition->compile_with_buckets(
+                compiled_partition, in, out, sizes, engine));
+    }
+    return status::success;
+}
+
+status_t DNNL_API dnnl_graph_partition_compile_from_cache_blob(
+        partition_t *partition, compiled_partition_t *compiled_partition,
+        size_t in_num, const logical_tensor_t **inputs, size_t out_num,
+        const logical_tensor_t **outputs, engine_t *engine, size_t size,
+        const uint8_t *cache_blob) {
+    if (utils::any_null(compiled_partition)
+            || (size != 0 && cache_blob == nullptr)) {
+        return status::invalid_arguments;
+    }
+
+    compiled_partition->set_src_cache_blob(
+            std::vector<uint8_t>(cache_blob, cache_blob + size));
+    const status_t ret = dnnl_graph_partition_compile(partition,
+            compiled_partition, in_num, inputs, out_num, outputs, engine);
+    compiled_partition->set_src_cache_blob({});
+    return ret;
+}
+
 status_t DNNL_API dnnl_graph_partition_get_input_ports_num(
         const partition_t *partition, size_t *num) {
     if (utils::any_null(partition, num)) { return status::invalid_arguments; }
@@ -335,6 +386,63 @@ status_t DNNL_API dnnl_graph_compiled_partition_execute(
     return status::success;
 }
 
+status_t DNNL_API dnnl_graph_compiled_partition_execute_with_callback(
+        const compiled_partition_t *compiled_partition, stream_t *stream,
+        size_t num_inputs, const tensor_t **inputs, size_t num_outputs,
+        const tensor_t **outputs, dnnl_graph_execute_callback_f callback,
+        void *user_data) {
+    if (utils::any_null(stream, compiled_partition, inputs, outputs, callback))
+        return status::invalid_arguments;
+    // SYCL and OpenCL runtimes report the completion with events.
+    if (stream->engine()->kind() != engine_kind::cpu)
+        return status::invalid_arguments;
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL
+    return status::invalid_arguments;
+#else
+    std::vector<tensor_t> ins, outs;
+    ins.reserve(num_inputs);
+    outs.reserve(num_outputs);
+
+    for (size_t i = 0; i < num_inputs; ++i) {
+        ins.emplace_back(**(inputs + i));
+    }
+    for (size_t i = 0; i < num_outputs; ++i) {
+        outs.emplace_back(**(outputs + i));
+    }
+
+    const auto on_complete = [callback, user_data](status_t status) {
+        callback(status, user_data);
+    };
+    if (get_verbose(dnnl::impl::verbose_t::exec_profile,
+                dnnl::impl::component_t::graph)) {
+        stream->wait();
+        double start_ms = dnnl::impl::get_msec();
+        CHECK(compiled_partition->execute(stream, ins, outs, on_complete));
+        stream->wait();
+        double duration_ms = dnnl::impl::get_msec() - start_ms;
+        VPROF(start_ms, graph, exec, VERBOSE_profile,
+                compiled_partition->info(), duration_ms);
+    } else {
+        CHECK(compiled_partition->execute(stream, ins, outs, on_complete));
+    }
+    return status::success;
+#endif
+}
+
+status_t DNNL_API dnnl_graph_compiled_partition_prepare_constants(
+        const compiled_partition_t *compiled_partition, stream_t *stream,
+        size_t num_inputs, const tensor_t **inputs, int pin) {
+    if (utils::any_null(stream, compiled_partition, inputs))
+        return status::invalid_arguments;
+
+    std::vector<tensor_t> ins;
+    ins.reserve(num_inputs);
+    for (size_t i = 0; i < num_inputs; ++i) {
+        ins.emplace_back(**(inputs + i));
+    }
+    return compiled_partition->prepare_constants(stream, ins, pin != 0);
+}
+
 status_t DNNL_API dnnl_graph_sycl_interop_compiled_partition_execute(
         const compiled_partition_t *compiled_partition, stream_t *stream,
         size_t num_inputs, const tensor_t **inputs, size_t num_outputs,
@@ -482,6 +590,24 @@ status_t DNNL_API dnnl_graph_compiled_partition_get_inplace_ports(
     return status::success;
 }
 
+status_t DNNL_API dnnl_graph_compiled_partition_get_cache_blob(
+        const compiled_partition_t *compiled_partition, size_t *size,
+        uint8_t *cache_blob) {
+    if (utils::any_null(compiled_partition, size))
+        return status::invalid_arguments;
+
+    std::vector<uint8_t> blob;
+    CHECK(compiled_partition->get_cache_blob(blob));
+    if (cache_blob == nullptr) {
+        *size = blob.size();
+        return status::success;
+    }
+
+    if (*size != blob.size()) return status::invalid_arguments;
+    std::copy(blob.begin(), blob.end(), cache_blob);
+    return status::success;
+}
+
 status_t dnnl_graph_partition::infer_shape(
         std::vector<const logical_tensor_t *> &inputs,
         std::vector<logical_tensor_t *> &outputs) {
@@ -657,9 +783,11 @@ status_t dnnl_graph_partition::compile(
         std::vector<const logical_tensor_t *> &inputs;
         std::vector<const logical_tensor_t *> &outputs;
         const engine_t *engine;
+        const std::vector<uint8_t> &cache_blob;
         cache_state_t cache_status;
     };
     create_context_t context {this, inputs, outputs, aengine,
+            compiled_partition.first->get_src_cache_blob(),
             cache_state_t::compiled_partition_hit};
 
     compiled_partition_cache_t::create_func_ptr_t create = [](void *context) {
@@ -667,6 +795,7 @@ status_t dnnl_graph_partition::compile(
         c.cache_status = cache_state_t::miss;
         std::shared_ptr<compiled_partition_t> cp
                 = std::make_shared<compiled_partition_t>(*c.partition);
+        cp->set_src_cache_blob(c.cache_blob);
         status_t status
                 = (c.partition)
                           ->compile(cp.get(), c.inputs, c.outputs, c.engine);
@@ -687,12 +816,114 @@ status_t dnnl_graph_partition::compile(
 
     return result.status;
 }
+
+status_t dnnl_graph_partition::compile_with_buckets(
+        compiled_partition_t *compiled_partition,
+        std::vector<const logical_tensor_t *> &inputs,
+        std::vector<const logical_tensor_t *> &outputs,
+        std::vector<dim_t> buckets, const engine_t *aengine) const {
+    std::sort(buckets.begin(), buckets.end());
+    buckets.erase(std::unique(buckets.begin(), buckets.end()), buckets.end());
+    if (buckets.front() <= 0) return status::invalid_arguments;
+
+    bool has_dynamic_dim = false;
+    for (const auto *in : inputs) {
+        for (int d = 0; d < in->ndims; d++)
+            has_dynamic_dim = has_dynamic_dim
+                    || in->dims[d] == DNNL_GRAPH_UNKNOWN_DIM;
+    }
+    if (!has_dynamic_dim) return status::invalid_arguments;
+
+    std::vector<std::shared_ptr<compiled_partition_t>> compiled;
+    compiled.reserve(buckets.size());
+    for (const dim_t size : buckets) {
+        std::vector<logical_tensor_t> ins, outs;
+        ins.reserve(inputs.size());
+        for (const auto *in : inputs) {
+            logical_tensor_t lt = *in;
+            bool is_dynamic = false;
+            for (int d = 0; d < lt.ndims; d++) {
+                if (lt.dims[d] != DNNL_GRAPH_UNKNOWN_DIM) continue;
+                lt.dims[d] = size;
+                is_dynamic = true;
+            }
+            // Strides of a dynamic input can't be given by the user, the
+            // input is dense for every bucket.
+            if (is_dynamic && lt.layout_type == layout_type::strided) {
+                dim_t stride = 1;
+                for (int d = lt.ndims - 1; d >= 0; d--) {
+                    lt.layout.strides[d] = stride;
+                    stride *= lt.dims[d];
+                }
+            }
+            ins.push_back(lt);
+        }
+        // Output shapes differ between buckets and are deduced.
+        outs.reserve(outputs.size());
+        for (const auto *out : outputs) {
+            logical_tensor_t lt = *out;
+            for (int d = 0; d < lt.ndims; d++) {
+                lt.dims[d] = DNNL_GRAPH_UNKNOWN_DIM;
+                if (lt.layout_type == layout_type::strided)
+                    lt.layout.strides[d] = DNNL_GRAPH_UNKNOWN_DIM;
+            }
+            outs.push_back(lt);
+        }
+
+        std::vector<const logical_tensor_t *> in_ptrs, out_ptrs;
+        for (const auto &lt : ins)
+            in_ptrs.push_back(&lt);
+        for (const auto &lt : outs)
+            out_ptrs.push_back(&lt);
+
+        auto cp = std::make_shared<compiled_partition_t>(*this);
+        std::pair<compiled_partition_t *, cache_state_t> cp_state {
+                cp.get(), cache_state_t::compiled_partition_hit};
+        CHECK(compile(cp_state, in_ptrs, out_ptrs, aengine));
+        compiled.push_back(cp);
+    }
+
+    compiled_partition->init(compiled.back()->pimpl_);
+    compiled_partition->buckets_ = std::move(compiled);
+    return status::success;
+}
+
+const compiled_partition_t *dnnl_graph_compiled_partition::get_bucket(
+        const std::vector<tensor_t> &inputs) const {
+    if (buckets_.empty()) return this;
+
+    const auto matches = [&](const compiled_partition_t &cp) {
+        for (const auto &in : inputs) {
+            const logical_tensor_t &lt = in.get_logical_tensor();
+            for (const auto &cp_lt : cp.get_inputs()) {
+                if (cp_lt.id != lt.id) continue;
+                if (cp_lt.ndims != lt.ndims
+                        || !std::equal(lt.dims, lt.dims + lt.ndims,
+                                cp_lt.dims))
+                    return false;
+            }
+        }
+        return true;
+    };
+    for (const auto &cp : buckets_) {
+        if (matches(*cp)) return cp.get();
+    }
+    return nullptr;
+}
+
 status_t dnnl_graph_compiled_partition::reset_engine(const engine_t *e) {
     return pimpl_->reset_engine(e);
 }
 status_t dnnl_graph_compiled_partition::execute(const stream_t *astream,
         const std::vector<tensor_t> &inputs,
-        const std::vector<tensor_t> &outputs) const {
+        const std::vector<tensor_t> &outputs,
+        const std::function<void(status_t)> &on_complete) const {
+    if (!buckets_.empty()) {
+        const compiled_partition_t *bucket = get_bucket(inputs);
+        if (!bucket) return status::invalid_arguments;
+        return bucket->execute(astream, inputs, outputs, on_complete);
+    }
+
     if (astream->engine()->kind() == engine_kind::gpu) {
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_SYCL
         return execute_sycl(astream, inputs, outputs, {}, nullptr);
@@ -721,17 +952,65 @@ status_t dnnl_graph_compiled_partition::execute(const stream_t *astream,
         pre_process(processed_inputs, inputs, backend);
         pre_process(processed_outputs, outputs, backend);
 
-        return pimpl_->execute(astream, processed_inputs, processed_outputs);
+        // The whole partition is one task of the stream, so the temporary
+        // buffers of the kernels are released after the computations
+        // complete on non-blocking streams.
+        auto pimpl = pimpl_;
+        auto task = [pimpl, astream, processed_inputs, processed_outputs,
+                            on_complete]() {
+            const status_t status = pimpl->execute(
+                    astream, processed_inputs, processed_outputs);
+            if (!on_complete) return status;
+            // The failure is reported to the callback only.
+            on_complete(status);
+            return status::success;
+        };
+        return const_cast<stream_t *>(astream)->enqueue_task(
+                task, on_complete);
 #endif
     }
 }
 
+status_t dnnl_graph_compiled_partition::prepare_constants(
+        const stream_t *astream, const std::vector<tensor_t> &inputs,
+        bool pin) const {
+    if (!buckets_.empty()) {
+        const compiled_partition_t *bucket = get_bucket(inputs);
+        if (!bucket) return status::invalid_arguments;
+        return bucket->prepare_constants(astream, inputs, pin);
+    }
+
+    if (!astream || astream->engine()->kind() != pimpl_->get_engine()->kind())
+        return status::invalid_arguments;
+
+    // The constant tensors of the SYCL and OpenCL runtimes are computed on
+    // the first execution.
+    if (astream->engine()->kind() == engine_kind::gpu) return status::success;
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL
+    return status::success;
+#else
+    const backend_t *backend = src_partition_.get_assigned_backend();
+    if (!backend) return status::invalid_arguments;
+
+    std::vector<tensor_t> processed_inputs;
+    pre_process(processed_inputs, inputs, backend);
+    return pimpl_->prepare_constants(astream, processed_inputs, pin);
+#endif
+}
+
 #ifdef DNNL_WITH_SYCL
 status_t dnnl_graph_compiled_partition::execute_sycl(const stream_t *astream,
         const std::vector<tensor_t> &inputs,
         const std::vector<tensor_t> &outputs,
         const std::vector<::sycl::event> &sycl_deps,
         ::sycl::event *sycl_event) const {
+    if (!buckets_.empty()) {
+        const compiled_partition_t *bucket = get_bucket(inputs);
+        if (!bucket) return status::invalid_arguments;
+        return bucket->execute_sycl(
+                astream, inputs, outputs, sycl_deps, sycl_event);
+    }
+
     // TODO(xxx): need to improve the check of two engines. On dev-graph, there
     // is a match function.
     if (!astream || (astream->engine()->kind() != pimpl_->get_engine()->kind()))
@@ -763,6 +1042,13 @@ graph::status_t dnnl_graph_compiled_partition::execute_ocl(
         const std::vector<graph::tensor_t> &inputs,
         const std::vector<graph::tensor_t> &outputs,
         const std::vector<cl_event> &ocl_deps, cl_event *ocl_event) const {
+    if (!buckets_.empty()) {
+        const compiled_partition_t *bucket = get_bucket(inputs);
+        if (!bucket) return status::invalid_arguments;
+        return bucket->execute_ocl(
+                astream, inputs, outputs, ocl_deps, ocl_event);
+    }
+
     if (!astream || (astream->engine()->kind() != pimpl_->get_engine()->kind()))
         return status::invalid_arguments;
 
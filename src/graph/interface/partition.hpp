@@ -18,6 +18,7 @@
 #define GRAPH_INTERFACE_PARTITION_HPP
 
 #include <cstring>
+#include <functional>
 #include <future>
 #include <memory>
 #include <sstream>
@@ -133,6 +134,16 @@ public:
             std::vector<const graph::logical_tensor_t *> &outputs,
             const graph::engine_t *aengine) const;
 
+    // Compiles the partition once per bucket size, substituting the size for
+    // every unknown input dimension, and stores the results in the given
+    // compiled partition.
+    graph::status_t compile_with_buckets(
+            graph::compiled_partition_t *compiled_partition,
+            std::vector<const graph::logical_tensor_t *> &inputs,
+            std::vector<const graph::logical_tensor_t *> &outputs,
+            std::vector<graph::dim_t> buckets,
+            const graph::engine_t *aengine) const;
+
     graph::status_t infer_shape(
             std::vector<const graph::logical_tensor_t *> &inputs,
             std::vector<graph::logical_tensor_t *> &outputs);
@@ -162,6 +173,12 @@ public:
 
     bool is_initialized() const { return pimpl_ != nullptr; }
 
+    // Returns the compiled partition of the bucket matching the shapes of the
+    // given inputs, nullptr if there is none, or this object if the partition
+    // was not compiled with buckets.
+    const dnnl_graph_compiled_partition *get_bucket(
+            const std::vector<graph::tensor_t> &inputs) const;
+
     const graph::compiled_partition_impl_t *get_pimpl() const {
         return pimpl_.get();
     }
@@ -176,9 +193,17 @@ public:
         return pimpl_->get_inplace_pairs();
     }
 
+    // On CPU streams, `on_complete` is called with the execution status once
+    // the execution completes. The execution is enqueued and the call returns
+    // immediately on non-blocking streams.
     graph::status_t execute(const graph::stream_t *astream,
             const std::vector<graph::tensor_t> &inputs,
-            const std::vector<graph::tensor_t> &outputs) const;
+            const std::vector<graph::tensor_t> &outputs,
+            const std::function<void(graph::status_t)> &on_complete
+            = nullptr) const;
+
+    graph::status_t prepare_constants(const graph::stream_t *astream,
+            const std::vector<graph::tensor_t> &inputs, bool pin) const;
 
 #ifdef DNNL_WITH_SYCL
     graph::status_t execute_sycl(const graph::stream_t *astream,
@@ -230,11 +255,42 @@ public:
 
     graph::status_t reset_engine(const graph::engine_t *e);
 
+    graph::status_t get_cache_blob(std::vector<uint8_t> &cache_blob) const {
+        if (!pimpl_) return graph::status::invalid_arguments;
+        return pimpl_->get_cache_blob(cache_blob);
+    }
+
+    // The memory held by the compiled partition. The implementation is shared
+    // with the largest bucket when the partition is compiled with buckets.
+    size_t footprint() const {
+        if (buckets_.empty()) return pimpl_ ? pimpl_->footprint() : 0;
+        size_t bytes = 0;
+        for (const auto &bucket : buckets_)
+            bytes += bucket->footprint();
+        return bytes;
+    }
+
+    // The cache blob given by the user to reuse the kernels of a previous
+    // compilation of the partition
+    void set_src_cache_blob(std::vector<uint8_t> cache_blob) {
+        src_cache_blob_ = std::move(cache_blob);
+    }
+
+    const std::vector<uint8_t> &get_src_cache_blob() const {
+        return src_cache_blob_;
+    }
+
 private:
     std::shared_ptr<graph::compiled_partition_impl_t> pimpl_;
 
+    std::vector<uint8_t> src_cache_blob_;
+
     const graph::partition_t src_partition_;
 
+    // Compiled partitions of the buckets in ascending order of the bucket
+    // size. Empty unless the partition was compiled with buckets.
+    std::vector<std::shared_ptr<dnnl_graph_compiled_partition>> buckets_;
+
     // Partition information
     mutable graph::utils::partition_info_t info_;
 };
@@ -37,13 +37,20 @@ compiled_partition_cache_t &compiled_partition_cache() {
 #ifndef DNNL_GRAPH_DISABLE_COMPILED_PARTITION_CACHE
     static const int capacity
             = getenv_int("DNNL_GRAPH_COMPILED_PARTITION_CACHE_CAPACITY", 1024);
+    static const size_t memory_limit = getenv_size_user(
+            "GRAPH_COMPILED_PARTITION_CACHE_MEMORY_LIMIT");
 #else
     static const int capacity = 0;
+    static const size_t memory_limit = 0;
 #endif
-    static compiled_partition_cache_t cache(capacity);
+    static compiled_partition_cache_t cache(capacity, memory_limit);
     return cache;
 }
 
+size_t compiled_partition_cache_t::footprint(const compiled_partition_t &cp) {
+    return cp.footprint();
+}
+
 const partition_t *compiled_partition_cache_t::get_partition(const key_t &key) {
     result_t result = cache_.get(key);
     return result.value != nullptr ? &(result.value->src_partition()) : nullptr;
@@ -73,3 +80,31 @@ dnnl::impl::graph::status_t dnnl_graph_set_compiled_partition_cache_capacity(
 #endif
     return dnnl::impl::graph::status::success;
 }
+
+dnnl::impl::graph::status_t
+dnnl_graph_get_compiled_partition_cache_memory_limit(size_t *limit) {
+    if (limit == nullptr) return dnnl::impl::graph::status::invalid_arguments;
+    *limit = 0;
+#ifndef DNNL_GRAPH_DISABLE_COMPILED_PARTITION_CACHE
+    *limit = dnnl::impl::graph::compiled_partition_cache().get_memory_limit();
+#endif
+    return dnnl::impl::graph::status::success;
+}
+
+dnnl::impl::graph::status_t
+dnnl_graph_set_compiled_partition_cache_memory_limit(size_t limit) {
+#ifndef DNNL_GRAPH_DISABLE_COMPILED_PARTITION_CACHE
+    dnnl::impl::graph::compiled_partition_cache().set_memory_limit(limit);
+#endif
+    return dnnl::impl::graph::status::success;
+}
+
+dnnl::impl::graph::status_t
+dnnl_graph_get_compiled_partition_cache_memory_usage(size_t *usage) {
+    if (usage == nullptr) return dnnl::impl::graph::status::invalid_arguments;
+    *usage = 0;
+#ifndef DNNL_GRAPH_DISABLE_COMPILED_PARTITION_CACHE
+    *usage = dnnl::impl::graph::compiled_partition_cache().get_memory_usage();
+#endif
+    return dnnl::impl::graph::status::success;
+}
@@ -48,7 +48,8 @@ struct compiled_partition_cache_t {
     using create_func_t = result_t (&)(void *);
     using create_func_ptr_t = result_t (*)(void *);
 
-    compiled_partition_cache_t(int capacity) : cache_(capacity) {}
+    compiled_partition_cache_t(int capacity, size_t memory_limit = 0)
+        : cache_(capacity, memory_limit) {}
 
     ~compiled_partition_cache_t() = default;
 
@@ -58,6 +59,13 @@ struct compiled_partition_cache_t {
     int get_capacity() const { return cache_.get_capacity(); }
     int get_size() const { return cache_.get_size(); }
 
+    // The least recently used compiled partitions are evicted once the memory
+    // held by the cached compiled partitions exceeds the limit. A limit of 0
+    // means no limit.
+    void set_memory_limit(size_t limit) { cache_.set_weight_limit(limit); }
+    size_t get_memory_limit() const { return cache_.get_weight_limit(); }
+    size_t get_memory_usage() const { return cache_.get_weight(); }
+
     result_t get_or_create(
             const key_t &key, create_func_t create, void *create_context) {
         // Always try to fetch the compiled_partition from the cache. There's no
@@ -69,10 +77,13 @@ struct compiled_partition_cache_t {
     const partition_t *get_partition(const key_t &key);
 
 private:
+    // Defined out of line, compiled_partition_t is incomplete here.
+    static size_t footprint(const compiled_partition_t &cp);
+
     // No need to set key_merge here since update_entry function is not need in
     // partition cache
     utils::lru_cache_t<key_t, compiled_partition_t, result_t,
-            /* key_merge */ nullptr>
+            /* key_merge */ nullptr, footprint>
             cache_;
 };
 
@@ -291,6 +291,34 @@ public:
 
     virtual status_t reset_engine(const engine_t *engine) = 0;
 
+    /// Serializes the compiled kernels which can be reused by a later
+    /// compilation of the same partition. The blob is empty if the backend
+    /// doesn't support it.
+    /// @param cache_blob The output cache blob
+    /// @return The status code
+    virtual status_t get_cache_blob(std::vector<uint8_t> &cache_blob) const {
+        cache_blob.clear();
+        return status::success;
+    }
+
+    /// Returns the memory held by the compiled partition in bytes, used to
+    /// bound the memory of the compiled partition cache. Backends which don't
+    /// report it return 0.
+    virtual size_t footprint() const { return 0; }
+
+    /// Computes the constant tensors of the compiled partition and adds them
+    /// into the constant tensor cache before the first execution. Backends
+    /// without constant tensors fill nothing.
+    /// @param astream The stream used to compute the constant tensors
+    /// @param inputs The inputs of the partition, of which only the constant
+    ///     ones are accessed
+    /// @param pin Whether to keep the cached tensors when the cache is flushed
+    /// @return The status code
+    virtual status_t prepare_constants(const stream_t *astream,
+            const std::vector<tensor_t> &inputs, bool pin) {
+        return status::success;
+    }
+
     /// The getters for inputs_, which is used in verbose mode
     const std::vector<logical_tensor_t> &get_inputs() const { return inputs_; }
 
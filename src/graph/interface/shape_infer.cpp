@@ -1770,6 +1770,96 @@ status_t infer_groupnorm_output_shape(op_t *n,
     return status::success;
 }
 
+status_t infer_rotary_embedding_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    const dims src_dims = logical_tensor_wrapper_t(inputs[0]).vdims();
+    const dims cos_dims = logical_tensor_wrapper_t(inputs[1]).vdims();
+    const dims sin_dims = logical_tensor_wrapper_t(inputs[2]).vdims();
+
+    VCHECK_INVALID_SHAPE(!src_dims.empty() && src_dims.back() % 2 == 0,
+            "%s, the last dimension of src should be even, src dims: %s",
+            op_t::kind2str(n->get_kind()).c_str(), dims2str(src_dims).c_str());
+    VCHECK_INVALID_SHAPE(cos_dims == sin_dims,
+            "%s, cos and sin dims should match, cos dims: %s, sin dims: %s",
+            op_t::kind2str(n->get_kind()).c_str(), dims2str(cos_dims).c_str(),
+            dims2str(sin_dims).c_str());
+    // cos and sin hold a value per element of the rotated dimension.
+    VCHECK_INVALID_SHAPE(!cos_dims.empty() && cos_dims.back() == src_dims.back()
+                    && one_way_broadcast(src_dims, cos_dims)
+                            == status::success,
+            "%s, cos and sin should be broadcastable to src with the same "
+            "last dimension, src dims: %s, cos dims: %s",
+            op_t::kind2str(n->get_kind()).c_str(), dims2str(src_dims).c_str(),
+            dims2str(cos_dims).c_str());
+
+    return infer_identity_output_shape(n, inputs, outputs);
+}
+
+status_t infer_paged_cache_load_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    const dims cache_dims = logical_tensor_wrapper_t(inputs[0]).vdims();
+    const dims table_dims = logical_tensor_wrapper_t(inputs[1]).vdims();
+
+    // cache: [num_blocks, num_head, block_size, head_size]
+    // block_table: [batch_size, max_num_blocks_per_seq]
+    VCHECK_INVALID_SHAPE(cache_dims.size() == 4 && table_dims.size() == 2,
+            "%s, cache should be 4D and block_table should be 2D, cache dims: "
+            "%s, block_table dims: %s",
+            op_t::kind2str(n->get_kind()).c_str(), dims2str(cache_dims).c_str(),
+            dims2str(table_dims).c_str());
+
+    // dst: [batch_size, num_head, max_num_blocks_per_seq * block_size,
+    //       head_size]
+    const dims output_dims = {table_dims[0], cache_dims[1],
+            table_dims[1] * cache_dims[2], cache_dims[3]};
+
+    auto out0 = logical_tensor_wrapper_t(outputs[0]);
+    if (!out0.is_shape_unknown()) {
+        VCHECK_INVALID_SHAPE(validate(output_dims, out0.vdims()),
+                "%s, inferred out shape and output shape are not compatible",
+                op_t::kind2str(n->get_kind()).c_str());
+        return status::success;
+    }
+
+    set_shape_and_strides(*outputs[0], output_dims);
+    return status::success;
+}
+
+status_t infer_gather_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    const dims src_dims = logical_tensor_wrapper_t(inputs[0]).vdims();
+    const dims indices_dims = logical_tensor_wrapper_t(inputs[1]).vdims();
+    const auto ndims = static_cast<int64_t>(src_dims.size());
+
+    int64_t axis = n->get_attr<int64_t>(op_attr::axis);
+    VCHECK_INVALID_SHAPE(axis >= -ndims && axis < ndims,
+            "%s, axis %d is out of range [%d, %d)",
+            op_t::kind2str(n->get_kind()).c_str(), static_cast<int>(axis),
+            static_cast<int>(-ndims), static_cast<int>(ndims));
+    if (axis < 0) axis += ndims;
+
+    // dst: src[:axis] + indices + src[axis + 1:]
+    dims output_dims(src_dims.begin(), src_dims.begin() + axis);
+    output_dims.insert(
+            output_dims.end(), indices_dims.begin(), indices_dims.end());
+    output_dims.insert(
+            output_dims.end(), src_dims.begin() + axis + 1, src_dims.end());
+
+    auto out0 = logical_tensor_wrapper_t(outputs[0]);
+    if (!out0.is_shape_unknown()) {
+        VCHECK_INVALID_SHAPE(validate(output_dims, out0.vdims()),
+                "%s, inferred out shape and output shape are not compatible",
+                op_t::kind2str(n->get_kind()).c_str());
+        return status::success;
+    }
+
+    set_shape_and_strides(*outputs[0], output_dims);
+    return status::success;
+}
+
 } // namespace graph
 } // namespace impl
 } // namespace dnnl
@@ -59,13 +59,22 @@ status_t buffer_memory_storage_t::map_data(
         return status::success;
     }
 
-    cl_mem_flags mem_flags;
-    OCL_CHECK(clGetMemObjectInfo(mem_object(), CL_MEM_FLAGS, sizeof(mem_flags),
-            &mem_flags, nullptr));
-
     size_t mem_bytes;
     OCL_CHECK(clGetMemObjectInfo(
             mem_object(), CL_MEM_SIZE, sizeof(mem_bytes), &mem_bytes, nullptr));
+    return map_data_range(mapped_ptr, stream, 0, mem_bytes);
+}
+
+status_t buffer_memory_storage_t::map_data_range(void **mapped_ptr,
+        impl::stream_t *stream, size_t offset, size_t size) const {
+    if (!mem_object()) {
+        *mapped_ptr = nullptr;
+        return status::success;
+    }
+
+    cl_mem_flags mem_flags;
+    OCL_CHECK(clGetMemObjectInfo(mem_object(), CL_MEM_FLAGS, sizeof(mem_flags),
+            &mem_flags, nullptr));
 
     cl_map_flags map_flags = 0;
     if (mem_flags & CL_MEM_READ_WRITE) {
@@ -82,8 +91,8 @@ status_t buffer_memory_storage_t::map_data(
 
     // Use blocking operation to simplify the implementation and API
     cl_int err;
-    *mapped_ptr = clEnqueueMapBuffer(queue, mem_object(), CL_TRUE, map_flags, 0,
-            mem_bytes, 0, nullptr, nullptr, &err);
+    *mapped_ptr = clEnqueueMapBuffer(queue, mem_object(), CL_TRUE, map_flags,
+            offset, size, 0, nullptr, nullptr, &err);
     return xpu::ocl::convert_to_dnnl(err);
 }
 
@@ -55,6 +55,8 @@ public:
 
     status_t map_data(
             void **mapped_ptr, impl::stream_t *stream, size_t) const override;
+    status_t map_data_range(void **mapped_ptr, impl::stream_t *stream,
+            size_t offset, size_t size) const override;
     status_t unmap_data(
             void *mapped_ptr, impl::stream_t *stream) const override;
 
@@ -27,6 +27,8 @@
 
 #include "xpu/ocl/stream_impl.hpp"
 
+#include "gpu/intel/ocl/stream.hpp"
+
 using namespace dnnl::impl;
 
 status_t dnnl_ocl_interop_stream_create(
@@ -62,3 +64,32 @@ status_t dnnl_ocl_interop_stream_get_command_queue(
     *queue = const_cast<xpu::ocl::stream_impl_t *>(ocl_stream_impl)->queue();
     return status::success;
 }
+
+status_t dnnl_ocl_interop_stream_begin_recording(stream_t *stream) {
+    bool args_ok = stream
+            && stream->engine()->runtime_kind() == runtime_kind::ocl
+            && stream->engine()->kind() == engine_kind::gpu;
+    if (!args_ok) return status::invalid_arguments;
+
+    return utils::downcast<gpu::intel::ocl::stream_t *>(stream)
+            ->begin_recording();
+}
+
+status_t dnnl_ocl_interop_stream_end_recording(stream_t *stream) {
+    bool args_ok = stream
+            && stream->engine()->runtime_kind() == runtime_kind::ocl
+            && stream->engine()->kind() == engine_kind::gpu;
+    if (!args_ok) return status::invalid_arguments;
+
+    return utils::downcast<gpu::intel::ocl::stream_t *>(stream)
+            ->end_recording();
+}
+
+status_t dnnl_ocl_interop_stream_replay(stream_t *stream) {
+    bool args_ok = stream
+            && stream->engine()->runtime_kind() == runtime_kind::ocl
+            && stream->engine()->kind() == engine_kind::gpu;
+    if (!args_ok) return status::invalid_arguments;
+
+    return utils::downcast<gpu::intel::ocl::stream_t *>(stream)->replay();
+}
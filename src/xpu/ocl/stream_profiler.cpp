@@ -51,14 +51,8 @@ status_t stream_profiler_t::get_info(profiling_data_kind_t data_kind,
     std::map<uint64_t, xpu::stream_profiler_t::entry_t> stamp2entry;
     int idx = 0;
     for (auto &ev : events_) {
-        const xpu::ocl::event_t &ocl_event
-                = *utils::downcast<xpu::ocl::event_t *>(ev.event.get());
-        cl_ulong beg, end;
-        assert(ocl_event.size() == 1);
-        OCL_CHECK(clGetEventProfilingInfo(ocl_event[0].get(),
-                CL_PROFILING_COMMAND_START, sizeof(beg), &beg, nullptr));
-        OCL_CHECK(clGetEventProfilingInfo(ocl_event[0].get(),
-                CL_PROFILING_COMMAND_END, sizeof(end), &end, nullptr));
+        uint64_t beg, end;
+        CHECK(get_event_time(*ev.event, beg, end));
         if (is_per_kernel) {
             data[idx++] = static_cast<uint64_t>(end - beg);
             continue;
@@ -66,6 +60,7 @@ status_t stream_profiler_t::get_info(profiling_data_kind_t data_kind,
         auto &entry = stamp2entry[ev.stamp];
         entry.min_nsec = std::min(entry.min_nsec, beg);
         entry.max_nsec = std::max(entry.max_nsec, end);
+        entry.kernel_nsec += end - beg;
         const auto *gpu_stream
                 = utils::downcast<const gpu::stream_t *>(stream_);
         entry.freq += gpu_stream->get_freq(*ev.event);
@@ -75,6 +70,20 @@ status_t stream_profiler_t::get_info(profiling_data_kind_t data_kind,
     return xpu::stream_profiler_t::get_info_impl(stamp2entry, data_kind, data);
 }
 
+status_t stream_profiler_t::get_event_time(
+        const xpu::event_t &event, uint64_t &beg, uint64_t &end) const {
+    const auto &ocl_event = xpu::ocl::event_t::from(event);
+    assert(ocl_event.size() == 1);
+    cl_ulong cl_beg, cl_end;
+    OCL_CHECK(clGetEventProfilingInfo(ocl_event[0].get(),
+            CL_PROFILING_COMMAND_START, sizeof(cl_beg), &cl_beg, nullptr));
+    OCL_CHECK(clGetEventProfilingInfo(ocl_event[0].get(),
+            CL_PROFILING_COMMAND_END, sizeof(cl_end), &cl_end, nullptr));
+    beg = static_cast<uint64_t>(cl_beg);
+    end = static_cast<uint64_t>(cl_end);
+    return status::success;
+}
+
 } // namespace ocl
 } // namespace xpu
 } // namespace impl
@@ -32,6 +32,8 @@ struct stream_profiler_t : public xpu::stream_profiler_t {
 
     status_t get_info(profiling_data_kind_t data_kind, int *num_entries,
             uint64_t *data) const override;
+    status_t get_event_time(const xpu::event_t &event, uint64_t &beg,
+            uint64_t &end) const override;
 };
 
 } // namespace ocl
@@ -30,9 +30,16 @@ struct map_usm_tag;
 
 status_t usm_memory_storage_t::map_data(
         void **mapped_ptr, impl::stream_t *stream, size_t size) const {
+    return map_data_range(mapped_ptr, stream, 0, size);
+}
 
+status_t usm_memory_storage_t::map_data_range(void **mapped_ptr,
+        impl::stream_t *stream, size_t offset, size_t size) const {
+    // Host and shared allocations are mapped without a copy.
     if (is_host_accessible()) {
-        *mapped_ptr = usm_ptr();
+        *mapped_ptr = usm_ptr()
+                ? reinterpret_cast<uint8_t *>(usm_ptr()) + offset
+                : nullptr;
         return status::success;
     }
 
@@ -48,11 +55,13 @@ status_t usm_memory_storage_t::map_data(
 
     auto leak_guard = decltype(usm_ptr_)(
             host_ptr, [this](void *p) { usm::free(engine(), p); });
-    CHECK(usm::memcpy(stream, host_ptr, usm_ptr(), size, 0, nullptr, nullptr));
+    // Only the mapped range is copied to the host and back.
+    auto *usm_ptr_for_unmap = reinterpret_cast<uint8_t *>(usm_ptr()) + offset;
+    CHECK(usm::memcpy(
+            stream, host_ptr, usm_ptr_for_unmap, size, 0, nullptr, nullptr));
     CHECK(stream->wait());
     leak_guard.release();
 
-    auto *usm_ptr_for_unmap = usm_ptr();
     auto unmap_callback = [size, usm_ptr_for_unmap](
                                   impl::stream_t *stream, void *mapped_ptr) {
         CHECK(usm::memcpy(stream, usm_ptr_for_unmap, mapped_ptr, size, 0,
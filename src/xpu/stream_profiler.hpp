@@ -41,6 +41,8 @@ struct stream_profiler_t {
         uint64_t max_nsec = 0;
         double freq = 0;
         int kernel_count = 0;
+        // Sum of the kernel durations, without the gaps between kernels.
+        uint64_t kernel_nsec = 0;
 
         uint64_t get_nsec() const { return max_nsec - min_nsec; }
     };
@@ -57,6 +59,23 @@ struct stream_profiler_t {
     virtual status_t get_info(profiling_data_kind_t data_kind, int *num_entries,
             uint64_t *data) const = 0;
 
+    // Returns the device start and end timestamps of a registered event.
+    virtual status_t get_event_time(
+            const xpu::event_t &event, uint64_t &beg, uint64_t &end) const = 0;
+
+    // Returns the sum of the kernel durations of the last profiled execution.
+    // The events of the execution must have completed.
+    status_t get_last_kernel_time(uint64_t &nsec) const {
+        nsec = 0;
+        for (auto it = events_.rbegin();
+                it != events_.rend() && it->stamp == stamp_; ++it) {
+            uint64_t beg = 0, end = 0;
+            CHECK(get_event_time(*it->event, beg, end));
+            nsec += end - beg;
+        }
+        return status::success;
+    }
+
     uint64_t stamp() const { return stamp_; }
 
     void register_event(std::unique_ptr<xpu::event_t> &&event) {
@@ -98,6 +117,9 @@ protected:
             auto &e = kv.second;
             switch ((int)data_kind) {
                 case profiling_data_kind::time: data[idx] = e.get_nsec(); break;
+                case profiling_data_kind::kernel_time:
+                    data[idx] = e.kernel_nsec;
+                    break;
                 case profiling_data_kind::cycles: {
                     double freq = e.freq / e.kernel_count;
                     data[idx] = static_cast<uint64_t>(
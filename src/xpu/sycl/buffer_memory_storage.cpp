@@ -57,7 +57,12 @@ buffer_memory_storage_t::buffer_memory_storage_t(
     : memory_storage_base_t(engine, root_storage) {}
 
 status_t buffer_memory_storage_t::map_data(
-        void **mapped_ptr, stream_t *stream, size_t) const {
+        void **mapped_ptr, stream_t *stream, size_t size) const {
+    return map_data_range(mapped_ptr, stream, 0, size);
+}
+
+status_t buffer_memory_storage_t::map_data_range(void **mapped_ptr,
+        stream_t *stream, size_t offset, size_t) const {
     if (!buffer_) {
         *mapped_ptr = nullptr;
         return status::success;
@@ -65,9 +70,11 @@ status_t buffer_memory_storage_t::map_data(
 
     auto &map_manager = memory_map_manager_t<map_buffer_tag>::instance();
 
+    // The host accessor covers the whole buffer, the runtime decides whether
+    // a copy is needed.
     auto acc = buffer_->get_host_access();
     auto *acc_ptr = new decltype(acc)(acc);
-    *mapped_ptr = static_cast<void *>(acc_ptr->get_pointer());
+    *mapped_ptr = static_cast<void *>(acc_ptr->get_pointer() + offset);
     auto unmap_callback = [acc_ptr](stream_t *, void *) {
         delete acc_ptr;
         return status::success;
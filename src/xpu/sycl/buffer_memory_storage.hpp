@@ -59,6 +59,8 @@ public:
 
     status_t map_data(
             void **mapped_ptr, stream_t *stream, size_t) const override;
+    status_t map_data_range(void **mapped_ptr, stream_t *stream,
+            size_t offset, size_t size) const override;
     status_t unmap_data(void *mapped_ptr, stream_t *stream) const override;
 
     bool is_host_accessible() const override { return false; }
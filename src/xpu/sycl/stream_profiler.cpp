@@ -31,7 +31,6 @@ namespace sycl {
 
 status_t stream_profiler_t::get_info(profiling_data_kind_t data_kind,
         int *num_entries, uint64_t *data) const {
-    using namespace ::sycl::info;
     if (!num_entries) return status::invalid_arguments;
     bool is_per_kernel = (data_kind == profiling_data_kind::time_per_kernel);
     if (!data) {
@@ -49,14 +48,8 @@ status_t stream_profiler_t::get_info(profiling_data_kind_t data_kind,
     std::map<uint64_t, stream_profiler_t::entry_t> stamp2entry;
     int idx = 0;
     for (auto &ev : events_) {
-        const xpu::sycl::event_t &sycl_event
-                = *utils::downcast<xpu::sycl::event_t *>(ev.event.get());
-        assert(sycl_event.size() == 1);
-        auto beg
-                = sycl_event[0]
-                          .get_profiling_info<event_profiling::command_start>();
-        auto end = sycl_event[0]
-                           .get_profiling_info<event_profiling::command_end>();
+        uint64_t beg, end;
+        CHECK(get_event_time(*ev.event, beg, end));
         if (is_per_kernel) {
             data[idx++] = static_cast<uint64_t>(end - beg);
             continue;
@@ -64,12 +57,23 @@ status_t stream_profiler_t::get_info(profiling_data_kind_t data_kind,
         auto &entry = stamp2entry[ev.stamp];
         entry.min_nsec = std::min(entry.min_nsec, beg);
         entry.max_nsec = std::max(entry.max_nsec, end);
+        entry.kernel_nsec += end - beg;
         entry.kernel_count++;
     }
     if (is_per_kernel) return status::success;
     return xpu::stream_profiler_t::get_info_impl(stamp2entry, data_kind, data);
 }
 
+status_t stream_profiler_t::get_event_time(
+        const xpu::event_t &event, uint64_t &beg, uint64_t &end) const {
+    using namespace ::sycl::info;
+    const auto &sycl_event = xpu::sycl::event_t::from(event);
+    assert(sycl_event.size() == 1);
+    beg = sycl_event[0].get_profiling_info<event_profiling::command_start>();
+    end = sycl_event[0].get_profiling_info<event_profiling::command_end>();
+    return status::success;
+}
+
 } // namespace sycl
 } // namespace xpu
 } // namespace impl
@@ -42,8 +42,16 @@ struct map_usm_tag;
 
 status_t usm_memory_storage_t::map_data(
         void **mapped_ptr, stream_t *stream, size_t size) const {
-    void *usm_ptr = this->usm_ptr(); // shadowing is bad
+    return map_data_range(mapped_ptr, stream, 0, size);
+}
+
+status_t usm_memory_storage_t::map_data_range(void **mapped_ptr,
+        stream_t *stream, size_t offset, size_t size) const {
+    // Only the mapped range is copied to the host and back.
+    void *usm_ptr = this->usm_ptr() ? this->usm_ptr() + offset : nullptr;
 
+    // Host allocations, and shared ones on devices with unified memory, are
+    // mapped without a copy.
     if (is_host_accessible()) {
         *mapped_ptr = usm_ptr;
         return status::success;
@@ -64,6 +64,8 @@ public:
 
     status_t map_data(
             void **mapped_ptr, stream_t *stream, size_t size) const override;
+    status_t map_data_range(void **mapped_ptr, stream_t *stream,
+            size_t offset, size_t size) const override;
     status_t unmap_data(void *mapped_ptr, stream_t *stream) const override;
 
     bool is_host_accessible() const override {
@@ -85,7 +87,12 @@ public:
          * on the host. However it didn't work well for benchdnn, though worked
          * perfectly fine for gtests. As we weren't able to find the cause of
          * this behavior we went with the approach above. Hopefully, the driver
-         * will be fixed and we can get rid of W/A altogether. */
+         * will be fixed and we can get rid of W/A altogether.
+         *
+         * Devices with unified memory don't migrate the data, so the W/A is
+         * not needed for them. */
+        if (usm_kind_ == ::sycl::usm::alloc::shared)
+            return engine()->has_host_unified_memory();
         return utils::one_of(usm_kind_, ::sycl::usm::alloc::host,
                 // ::sycl::usm::alloc::shared, // W/A (see above)
                 ::sycl::usm::alloc::unknown);
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <string>
 #include <utility>
 #include <vector>
@@ -23,6 +24,7 @@
 #include "common.hpp"
 #include "dnnl_common.hpp"
 #include "dnnl_memory.hpp"
+#include "utils/baseline.hpp"
 #include "utils/parser.hpp"
 
 #include "binary/binary.hpp"
@@ -43,6 +45,7 @@
 #include "reorder/reorder.hpp"
 #include "resampling/resampling.hpp"
 #include "rnn/rnn.hpp"
+#include "sdpa/sdpa.hpp"
 #include "self/self.hpp"
 #include "shuffle/shuffle.hpp"
 #include "softmax/softmax.hpp"
@@ -75,6 +78,8 @@ bool fast_ref {default_fast_ref};
 bool allow_enum_tags_only {true};
 int test_start {0};
 bool attr_same_pd_check {false};
+bool cold_create {false};
+bool warmup_stable {false};
 bool check_ref_impl {false};
 
 execution_mode_t execution_mode {execution_mode_t::direct};
@@ -141,6 +146,8 @@ int main(int argc, char **argv) {
         resampling::bench(--argc, ++argv);
     } else if (!strcmp("--reduction", argv[0])) {
         reduction::bench(--argc, ++argv);
+    } else if (!strcmp("--sdpa", argv[0])) {
+        sdpa::bench(--argc, ++argv);
     } else if (!strcmp("--zeropad", argv[0])) {
         zeropad::bench(--argc, ++argv);
     } else if (!strcmp("--brgemm", argv[0])) {
@@ -179,6 +186,54 @@ int main(int argc, char **argv) {
         printf("============================\n");
     }
 
+    if (has_bench_mode_bit(mode_bit_t::perf) && summary.latency
+            && !benchdnn_stat.latency_cases.empty()) {
+        printf("===========================================================\n");
+        printf("= Latency summary (--summary=no-latency to disable)       =\n");
+        printf("===========================================================\n");
+        printf("[\n");
+        const size_t n_cases = benchdnn_stat.latency_cases.size();
+        for (size_t i = 0; i < n_cases; i++) {
+            printf("%s%s\n", benchdnn_stat.latency_cases[i].c_str(),
+                    i + 1 < n_cases ? "," : "");
+        }
+        printf("]\n");
+        printf("============================\n");
+    }
+
+    if (summary.create && !benchdnn_stat.create_stats.empty()) {
+        // Average times per creation, in milliseconds. The slowest to create
+        // from scratch implementations go first.
+        using entry_t = std::pair<std::string, create_stat_t>;
+        std::vector<entry_t> stats(benchdnn_stat.create_stats.begin(),
+                benchdnn_stat.create_stats.end());
+        const auto avg = [](double ms, int n) { return n ? ms / n : 0.; };
+        std::sort(stats.begin(), stats.end(),
+                [&](const entry_t &a, const entry_t &b) {
+                    return avg(a.second.miss_ms, a.second.misses)
+                            > avg(b.second.miss_ms, b.second.misses);
+                });
+
+        printf("===========================================================\n");
+        printf("= Creation summary (--summary=no-create to disable)       =\n");
+        printf("===========================================================\n");
+        printf("impl,problems,pd_ms,misses,miss_ms,hits,hit_ms,blobs,"
+               "blob_ms\n");
+        for (const auto &e : stats) {
+            const auto &cs = e.second;
+            const int n_pd = cs.misses + cs.hits;
+            printf("%s,%d,%g,%d,%g,%d,%g,%d,%g\n", e.first.c_str(),
+                    cs.problems, avg(cs.pd_ms, n_pd), cs.misses,
+                    avg(cs.miss_ms, cs.misses), cs.hits,
+                    avg(cs.hit_ms, cs.hits), cs.blobs,
+                    avg(cs.blob_ms, cs.blobs));
+        }
+        printf("============================\n");
+    }
+
+    int regressed = 0;
+    if (has_bench_mode_bit(mode_bit_t::perf)) regressed = baseline_finalize();
+
     printf("tests:%d passed:%d skipped:%d mistrusted:%d unimplemented:%d "
            "invalid_arguments:%d failed:%d listed:%d\n",
             benchdnn_stat.tests, benchdnn_stat.passed, benchdnn_stat.skipped,
@@ -216,5 +271,5 @@ int main(int argc, char **argv) {
 
     finalize();
 
-    return !!benchdnn_stat.failed;
+    return benchdnn_stat.failed || regressed;
 }
@@ -41,12 +41,15 @@ void check_correctness(const settings_t &s) {
     for_(const auto &i_batch_size : s.batch_size)
     for_(const auto &i_brgemm_attr : s.brgemm_attr)
     for_(const auto &i_batch_kind : s.batch_kind)
+    for_(const auto &i_nthr : s.nthr)
+    for_(const bool i_shared_wei : s.shared_wei)
     for_(const auto &i_attr : s.attributes)
     for_(const auto &i_ctx_init : s.ctx_init)
     for (const auto &i_ctx_exe : s.ctx_exe) {
         const prb_t prb(s.prb_vdims, i_dt, i_stag, i_wtag, i_dtag, i_strides,
                 i_ld, i_bia_dt, i_alpha, i_beta, i_batch_size, i_brgemm_attr,
-                i_batch_kind, i_attr, i_ctx_init, i_ctx_exe, s.impl_filter);
+                i_batch_kind, i_nthr, i_shared_wei, i_attr, i_ctx_init,
+                i_ctx_exe, s.impl_filter);
         if (s.pattern && !match_regex(prb.str(), s.pattern)) return;
         BENCHDNN_PRINT(1, "run: %s\n", prb.str());
 
@@ -146,6 +149,16 @@ static const std::string help_brgemm_attr
         = "STRING    (Default: empty)\n    Specifies BRGeMM kernel attributes. "
           "If some values are skipped, the default one will be used.\n";
 
+static const std::string help_nthr
+        = "UINT    (Default: `1`)\n    Specifies the number of threads "
+          "executing independent kernel calls concurrently in performance "
+          "mode.\n    `0` stands for all available threads.\n";
+
+static const std::string help_shared_wei
+        = "BOOL    (Default: `false`)\n    When set to `true`, threads share "
+          "a single weights buffer in throughput mode. Otherwise, each thread "
+          "uses a private copy.\n";
+
 static const std::string help_batch_kind
         = "STRING    (Default: addr)\n    Specifies BRGeMM batch kind. "
           "Supported values are: `addr`, `offs`.\n";
@@ -177,6 +190,10 @@ int bench(int argc, char **argv) {
                         argv[0], "brgemm-attr", help_brgemm_attr)
                 || parse_vector_option(s.batch_kind, def.batch_kind, cstr2str,
                         argv[0], "batch-kind", help_batch_kind)
+                || parse_vector_option(
+                        s.nthr, def.nthr, atoi, argv[0], "nthr", help_nthr)
+                || parse_vector_option(s.shared_wei, def.shared_wei, str2bool,
+                        argv[0], "shared-wei", help_shared_wei)
                 || parse_attributes(s, def, argv[0])
                 || parse_test_pattern_match(s.pattern, argv[0])
                 || parse_perf_template(s.perf_template,
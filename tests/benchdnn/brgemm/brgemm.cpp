@@ -507,6 +507,14 @@ void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
 }
 
 void skip_invalid_prb(const prb_t *prb, res_t *res) {
+    if (prb->nthr > benchdnn_get_max_threads()) {
+        BENCHDNN_PRINT(2, "%s\n",
+                "Number of threads exceeds the number of available threads");
+        res->state = SKIPPED;
+        res->reason = skip_reason::invalid_case;
+        return;
+    }
+
 #if !defined(DNNL_EXPERIMENTAL_UKERNEL)
     // Reorder does not support s8 and zp compensations for arbitrary shapes,
     // so skip unsupported cases.
@@ -1137,6 +1145,61 @@ int brgemm_finalize() {
     return OK;
 }
 
+// Thread-private copies of kernel buffers for the throughput mode.
+struct thr_buffers_t {
+    thr_buffers_t() = default;
+    ~thr_buffers_t() {
+        for (auto *ptr : ptrs_)
+            zfree(ptr);
+    }
+
+    // Returns a copy of `size` bytes pointed by `ptr`.
+    char *copy(const void *ptr, size_t size) {
+        if (!ptr || size == 0) return nullptr;
+        char *copy_ptr = (char *)zmalloc(size, 64);
+        if (!copy_ptr) return nullptr;
+        memcpy(copy_ptr, ptr, size);
+        ptrs_.push_back(copy_ptr);
+        return copy_ptr;
+    }
+
+private:
+    thr_buffers_t(const thr_buffers_t &) = delete;
+    thr_buffers_t &operator=(const thr_buffers_t &) = delete;
+
+    std::vector<char *> ptrs_;
+};
+
+// Runs `thr_funcs` concurrently, one per thread, each thread executing kernel
+// calls over its own buffers. Single-thread performance is expected in the
+// perf timer and is saved to compute the scaling efficiency.
+int measure_perf_throughput(const prb_t *prb, res_t *res,
+        const kernel_args_t &kernel_args,
+        const std::vector<perf_function_t> &thr_funcs, args_t &args) {
+    res->timer_map.get_timer(timer::names::perf_1thr_timer)
+            = res->timer_map.perf_timer();
+
+    const int64_t nthr = static_cast<int64_t>(thr_funcs.size());
+    perf_function_t perf_func = [&](const dnnl_stream_t &stream,
+                                        const std::vector<dnnl_exec_arg_t>
+                                                &dnnl_args) {
+        std::vector<dnnl_status_t> st(nthr, dnnl_success);
+        benchdnn_parallel_nd(nthr, [&](int64_t ithr) {
+            // Hardware context is a thread state.
+            if (init_hw_config(kernel_args) != OK) {
+                st[ithr] = dnnl_runtime_error;
+                return;
+            }
+            st[ithr] = thr_funcs[ithr](stream, dnnl_args);
+        });
+        for (const auto &s : st)
+            if (s != dnnl_success) return s;
+        return dnnl_success;
+    };
+
+    return measure_perf(prb->ctx_exe, res, perf_func, args);
+}
+
 int doit(const prb_t *prb, res_t *res) {
     if (bench_mode == bench_mode_t::list) return res->state = LISTED, OK;
 
@@ -1352,6 +1415,82 @@ int doit(const prb_t *prb, res_t *res) {
 
     measure_perf(prb->ctx_exe, res, perf_func, args);
 
+    if (prb->nthr > 1 && has_bench_mode_bit(mode_bit_t::perf)) {
+        // Each thread gets private source, accumulator, destination and
+        // scratchpad buffers, and either private or shared weights.
+        const auto buf_size = [&](int arg) {
+            return mem_map.count(arg) ? mem_map.at(arg).size() : size_t(0);
+        };
+        thr_buffers_t thr_buffers;
+        std::vector<perf_function_t> thr_funcs(prb->nthr);
+#if !defined(DNNL_EXPERIMENTAL_UKERNEL)
+        std::vector<std::vector<namespace_impl::brgemm_batch_element_t>>
+                thr_batch_element(prb->nthr, v_batch_element);
+        std::vector<namespace_impl::brgemm_post_ops_data_t> thr_post_ops_data(
+                prb->nthr, post_ops_data);
+        for (int ithr = 0; ithr < prb->nthr; ithr++) {
+            const char *thr_src
+                    = thr_buffers.copy(src_ptr, buf_size(DNNL_ARG_SRC));
+            const char *thr_wei = prb->shared_wei
+                    ? wei_ptr
+                    : thr_buffers.copy(wei_ptr, buf_size(DNNL_ARG_WEIGHTS));
+            char *thr_dst = thr_buffers.copy(dst_ptr, buf_size(DNNL_ARG_DST));
+            char *thr_acc = prb->use_dst_as_acc()
+                    ? thr_dst
+                    : thr_buffers.copy(acc_ptr, buf_size(DNNL_ARG_DST_1));
+            char *thr_scratchpad = need_hidden_compensation
+                    ? const_cast<char *>(thr_wei) + wei_offset_s8s8
+                    : thr_buffers.copy(
+                            scratchpad_ptr, buf_size(DNNL_ARG_SCRATCHPAD));
+            if (!thr_src || !thr_wei || !thr_dst || !thr_acc)
+                return res->state = FAILED, FAIL;
+
+            auto &batch_element = thr_batch_element[ithr];
+            for (size_t i = 0; i < batch_element.size(); i++) {
+                if (prb->batch_kind != "addr") continue;
+                batch_element[i].ptr.A
+                        = thr_src + i * prb->get_src_batch_offset();
+                batch_element[i].ptr.B
+                        = thr_wei + i * prb->get_wei_batch_offset();
+            }
+            auto &thr_po_data = thr_post_ops_data[ithr];
+            thr_po_data.data_C_ptr_ = thr_dst;
+            thr_po_data.a_zp_compensations = thr_wei + wei_offset_zp;
+
+            thr_funcs[ithr] = std::bind(brgemm_kernel_execute_postops_wrapper,
+                    kernel_args.brgemm_kernel_, prb->batch_kind,
+                    prb->batch_size, thr_src, thr_wei, batch_element.data(),
+                    thr_acc, thr_dst, thr_po_data, thr_scratchpad,
+                    std::placeholders::_1, std::placeholders::_2);
+        }
+#else // !defined(DNNL_EXPERIMENTAL_UKERNEL)
+        for (int ithr = 0; ithr < prb->nthr; ithr++) {
+            const char *thr_src
+                    = thr_buffers.copy(src_ptr, buf_size(DNNL_ARG_SRC));
+            const char *thr_wei = prb->shared_wei
+                    ? wei_packed_ptr
+                    : thr_buffers.copy(
+                            wei_packed_ptr, buf_size(DNNL_ARG_WEIGHTS_1));
+            char *thr_dst = thr_buffers.copy(dst_ptr, buf_size(DNNL_ARG_DST));
+            char *thr_acc = prb->use_dst_as_acc()
+                    ? thr_dst
+                    : thr_buffers.copy(acc_ptr, buf_size(DNNL_ARG_DST_1));
+            char *thr_scratchpad = thr_buffers.copy(
+                    scratchpad_ptr, buf_size(DNNL_ARG_SCRATCHPAD));
+            if (!thr_src || !thr_wei || !thr_dst || !thr_acc)
+                return res->state = FAILED, FAIL;
+
+            thr_funcs[ithr] = std::bind(brgemm_kernel_execute_postops_wrapper,
+                    kernel_args.brgemm_, prb->use_dst_as_acc(), thr_src,
+                    thr_wei, offsets, thr_acc, thr_dst, thr_scratchpad,
+                    attr_params_ptr, std::placeholders::_1,
+                    std::placeholders::_2);
+        }
+#endif
+        SAFE(measure_perf_throughput(prb, res, kernel_args, thr_funcs, args),
+                WARN);
+    }
+
     SAFE(release_hw_config(kernel_args), WARN);
 
     return OK;
@@ -42,6 +42,7 @@
 #include "common.hpp"
 #include "dnnl_common.hpp"
 #include "utils/cfg.hpp"
+#include "utils/parallel.hpp"
 #include "utils/perf_report.hpp"
 #include "utils/settings.hpp"
 
@@ -61,6 +62,8 @@ struct settings_t : public base_settings_t {
     std::vector<float> alpha {1.f}, beta {0.f};
     std::vector<std::string> brgemm_attr {std::string()};
     std::vector<std::string> batch_kind {"addr"};
+    std::vector<int> nthr {1};
+    std::vector<bool> shared_wei {false};
 
     const char *perf_template_csv() const {
         static const std::string args;
@@ -77,7 +80,8 @@ struct prb_t : public prb_vdims_t {
             const std::vector<int64_t> &ld, dnnl_data_type_t bia_dt,
             float alpha, float beta, int batch_size,
             const std::string &brgemm_attr, const std::string &batch_kind,
-            const attr_t &attr, const thr_ctx_t &ctx_init,
+            int nthr, bool shared_wei, const attr_t &attr,
+            const thr_ctx_t &ctx_init,
             const thr_ctx_t &ctx_exe, const impl_filter_t &impl_filter)
         : prb_vdims_t(prb_vdims)
         , dt(dt)
@@ -92,6 +96,9 @@ struct prb_t : public prb_vdims_t {
         , batch_size(batch_size)
         , brgemm_attr(brgemm_attr)
         , batch_kind(batch_kind)
+        , user_nthr(nthr)
+        , nthr(nthr > 0 ? nthr : benchdnn_get_max_threads())
+        , shared_wei(shared_wei)
         , attr(attr)
         , ctx_init(ctx_init)
         , ctx_exe(ctx_exe)
@@ -113,7 +120,8 @@ struct prb_t : public prb_vdims_t {
 
         const auto nelems = std::accumulate(dst_dims.begin(), dst_dims.end(),
                 (dnnl_dim_t)1, std::multiplies<dnnl_dim_t>());
-        ops = 2. * nelems * k * batch_size;
+        // In throughput mode each thread does the same amount of work.
+        ops = 2. * nelems * k * batch_size * this->nthr;
 
         check_block_size();
 
@@ -133,6 +141,11 @@ struct prb_t : public prb_vdims_t {
     int64_t batch_size;
     std::string brgemm_attr;
     std::string batch_kind;
+    // Throughput mode settings: the number of threads executing independent
+    // kernel calls concurrently, where `0` stands for all available threads,
+    // and whether threads share the weights buffer.
+    int user_nthr, nthr;
+    bool shared_wei;
 
     attr_t attr;
     thr_ctx_t ctx_init, ctx_exe;
@@ -101,6 +101,10 @@ std::string prb_t::set_repro_line() {
         s << "--brgemm-attr=" << brgemm_attr << " ";
     if (canonical || batch_kind != def.batch_kind[0])
         s << "--batch-kind=" << batch_kind << " ";
+    if (canonical || user_nthr != def.nthr[0])
+        s << "--nthr=" << user_nthr << " ";
+    if (canonical || shared_wei != def.shared_wei[0])
+        s << "--shared-wei=" << bool2str(shared_wei) << " ";
 
     s << attr;
     s << static_cast<const prb_vdims_t &>(*this);
@@ -30,8 +30,11 @@
 
 #include "oneapi/dnnl/dnnl.h"
 
+#include "src/common/utils.hpp"
+
 #include "common.hpp"
 
+#include "utils/baseline.hpp"
 #include "utils/parallel.hpp"
 
 // BENCHDNN_MEMORY_CHECK macro enables guarding mechanism for memory allocation:
@@ -93,6 +96,45 @@ dir_t str2dir(const char *str) {
     return DIR_UNDEF;
 }
 
+// Escapes quotes and backslashes for a JSON string value.
+static std::string json_escape(const std::string &s) {
+    std::string escaped;
+    for (const auto &c : s) {
+        if (c == '"' || c == '\\') escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+// Returns a JSON object with the execution time distribution of a problem.
+static std::string dump_latency_json(int idx, const res_t &res,
+        const timer::timer_t &t, const char *pstr) {
+    using bt = timer::timer_t;
+
+    dnnl::impl::stringstream_t ss;
+    ss << "{\"idx\":" << idx << ",\"prb\":\""
+       << json_escape(pstr) << "\",\"impl\":\"" << json_escape(res.impl_name)
+       << "\",\"samples\":" << t.samples().size()
+       << ",\"min_ms\":" << t.ms(bt::min) << ",\"avg_ms\":" << t.ms(bt::avg)
+       << ",\"p50_ms\":" << t.percentile_ms(50)
+       << ",\"p90_ms\":" << t.percentile_ms(90)
+       << ",\"p99_ms\":" << t.percentile_ms(99)
+       << ",\"max_ms\":" << t.ms(bt::max)
+       << ",\"stddev_ms\":" << t.stddev_ms();
+    if (summary.histogram) {
+        static constexpr int n_bins = 10;
+        const char *delim = "";
+        ss << ",\"histogram\":[";
+        for (const auto &count : t.histogram(n_bins)) {
+            ss << delim << count;
+            delim = ",";
+        }
+        ss << "]";
+    }
+    ss << "}";
+    return ss.str();
+}
+
 void parse_result(res_t &res, const char *pstr) {
     auto &bs = benchdnn_stat;
 
@@ -172,6 +214,11 @@ void parse_result(res_t &res, const char *pstr) {
         const auto &t = res.timer_map.perf_timer();
         for (int mode = 0; mode < (int)bt::n_modes; ++mode)
             bs.ms[timer::names::perf_timer][mode] += t.ms((bt::mode_t)mode);
+        // `tests` was already updated for the current problem.
+        if (summary.latency && t.times() > 0)
+            bs.latency_cases.emplace_back(
+                    dump_latency_json(bs.tests - 1, res, t, pstr));
+        if (t.times() > 0) baseline_add(pstr, res.impl_name, t);
     }
 
     for (const auto &e : timer::get_global_service_timers()) {
@@ -183,6 +230,19 @@ void parse_result(res_t &res, const char *pstr) {
         // Only summary time is populated to the highest level report.
         bs.ms[t_name][bt::mode_t::sum] += t.sec(bt::mode_t::sum);
     }
+
+    if (summary.create && !res.impl_name.empty()) {
+        auto &tm = res.timer_map;
+        auto &cs = bs.create_stats[res.impl_name];
+        cs.problems++;
+        cs.misses += tm.cp_miss_timer().times();
+        cs.hits += tm.cp_hit_timer().times();
+        cs.blobs += tm.cp_blob_timer().times();
+        cs.pd_ms += tm.cpd_timer().ms(bt::mode_t::sum);
+        cs.miss_ms += tm.cp_miss_timer().ms(bt::mode_t::sum);
+        cs.hit_ms += tm.cp_hit_timer().ms(bt::mode_t::sum);
+        cs.blob_ms += tm.cp_blob_timer().ms(bt::mode_t::sum);
+    }
 }
 
 /* misc */
@@ -95,6 +95,8 @@ extern int verbose;
 extern bool canonical;
 extern bool mem_check;
 extern bool attr_same_pd_check;
+extern bool cold_create;
+extern bool warmup_stable;
 extern bool check_ref_impl;
 extern std::string skip_impl; /* empty or "" means skip nothing */
 extern std::string driver_name;
@@ -132,6 +134,16 @@ extern bool allow_enum_tags_only;
 extern int test_start;
 
 /* global stats */
+// Creation time of problems that picked the same implementation.
+struct create_stat_t {
+    int problems = 0;
+    // Number of primitive creations by primitive cache outcome and from a
+    // cache blob.
+    int misses = 0, hits = 0, blobs = 0;
+    // Total time in milliseconds.
+    double pd_ms = 0, miss_ms = 0, hit_ms = 0, blob_ms = 0;
+};
+
 struct stat_t {
     int tests;
     int passed;
@@ -144,6 +156,10 @@ struct stat_t {
     std::unordered_map<std::string, double[timer::timer_t::mode_t::n_modes]> ms;
     // Key is the number of the test, value is the repro string.
     std::map<int, std::string> failed_cases;
+    // JSON objects with execution time distribution, one per problem.
+    std::vector<std::string> latency_cases;
+    // Key is the implementation name.
+    std::map<std::string, create_stat_t> create_stats;
 };
 extern stat_t benchdnn_stat;
 
@@ -216,6 +232,14 @@ std::string benchdnn_getenv_string(const char *name);
 struct summary_t {
     // Prints up to 10 failed cases reproducers at the end of the run.
     bool failed_cases = true;
+    // Prints a JSON summary of execution time distribution for each problem
+    // at the end of the run. Requires performance mode.
+    bool latency = false;
+    // Adds execution time histograms to the latency summary.
+    bool histogram = false;
+    // Prints creation time statistics aggregated per implementation at the
+    // end of the run.
+    bool create = false;
 };
 
 extern summary_t summary;
@@ -452,6 +452,21 @@ void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
             trh *= (MAX2(1, pow(10, 0.4 * log_const)));
         }
     }
+
+    // f16, relaxed and any accumulation modes allow the library to keep
+    // forward partial sums in f16, the error of which grows with the
+    // reduction size.
+    const auto acc_mode = prb->attr.acc_mode;
+    const bool f16_acc = (prb->dir & FLAG_FWD) && prb->src_dt() == dnnl_f16
+            && prb->wei_dt() == dnnl_f16
+            && (acc_mode == dnnl_accumulation_mode_f16
+                    || acc_mode == dnnl_accumulation_mode_relaxed
+                    || acc_mode == dnnl_accumulation_mode_any);
+    if (f16_acc) {
+        const float acc_trh
+                = MAX2(1, prb->count_n_acc() - 1) * epsilon_dt(dnnl_f16) / 2;
+        trh = MAX2(trh, acc_trh);
+    }
     cmp.set_threshold(trh);
 
     const float zpp = (1.f - get_non_zero_trust_percent(prb, kind)) * 100.f;
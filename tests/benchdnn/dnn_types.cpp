@@ -95,6 +95,9 @@ static const std::map<int, std::vector<const char *>> supported_args {
         {DNNL_ARG_SRC_1, {"src1"}},
         {DNNL_ARG_WEIGHTS, {"wei"}},
         {DNNL_ARG_DST, {"dst"}},
+        {DNNL_ARG_DIFF_SRC, {"diff_src"}},
+        {DNNL_ARG_DIFF_WEIGHTS, {"diff_wei"}},
+        {DNNL_ARG_DIFF_DST, {"diff_dst"}},
         {DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_DST, {"attr_post_op_dw_dst"}},
         {DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS, {"attr_post_op_dw_wei"}},
 };
@@ -692,19 +695,23 @@ std::ostream &operator<<(
 }
 
 std::ostream &operator<<(
-        std::ostream &s, const attr_t::zero_points_t &zero_points) {
+        std::ostream &s, const attr_t::zero_points_t::entry_t &zero_point) {
     using ::operator<<;
 
+    s << zero_point.policy;
+    if (zero_point.policy == policy_t::COMMON) s << ":" << zero_point.value;
+    if (zero_point.dt != dnnl_s32 || !zero_point.groups.empty())
+        s << ':' << zero_point.dt;
+    if (!zero_point.groups.empty()) s << ":" << dims2str(zero_point.groups);
+    return s;
+}
+
+std::ostream &operator<<(
+        std::ostream &s, const attr_t::zero_points_t &zero_points) {
     const char *delim = "";
     for (const auto &point : zero_points.points) {
         s << delim;
-        s << arg2str(point.first) << ":" << point.second.policy;
-        if (point.second.policy == policy_t::COMMON)
-            s << ":" << point.second.value;
-        if (point.second.dt != dnnl_s32 || !point.second.groups.empty())
-            s << ':' << point.second.dt;
-        if (!point.second.groups.empty())
-            s << ":" << dims2str(point.second.groups);
+        s << arg2str(point.first) << ":" << point.second;
         delim = "+";
     }
 
@@ -941,6 +948,8 @@ std::ostream &dump_global_params(std::ostream &s) {
         s << "--attr-same-pd-check=" << bool2str(attr_same_pd_check) << " ";
     if (canonical || check_ref_impl != false)
         s << "--check-ref-impl=" << bool2str(check_ref_impl) << " ";
+    if (canonical || cold_create != false)
+        s << "--cold-create=" << bool2str(cold_create) << " ";
 #if defined(DNNL_WITH_SYCL) || DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
     if (canonical || memory_kind != default_memory_kind)
         s << "--memory-kind=" << memory_kind << " ";
@@ -561,8 +561,12 @@ private:
 std::ostream &operator<<(
         std::ostream &s, const sparse_options_t &sparse_options);
 std::ostream &operator<<(std::ostream &s, const policy_t &policy);
+std::ostream &operator<<(
+        std::ostream &s, const attr_t::zero_points_t::entry_t &zero_point);
 std::ostream &operator<<(
         std::ostream &s, const attr_t::zero_points_t &zero_points);
+std::ostream &operator<<(
+        std::ostream &s, const attr_t::arg_scales_t::entry_t &scale);
 std::ostream &operator<<(std::ostream &s, const attr_t::arg_scales_t &scales);
 std::ostream &operator<<(std::ostream &s, const attr_t::post_ops_t::kind_t &k);
 std::ostream &operator<<(std::ostream &s, const attr_t::post_ops_t &post_ops);
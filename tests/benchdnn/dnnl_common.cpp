@@ -49,6 +49,7 @@
 #include "utils/cold_cache.hpp"
 #include "utils/dnnl_query.hpp"
 #include "utils/fill.hpp"
+#include "utils/perf_counters.hpp"
 #include "utils/stream_kind.hpp"
 
 extern "C" dnnl_status_t dnnl_impl_notify_profiling_complete(
@@ -94,6 +95,24 @@ int check_primitive_cache(dnnl_primitive_t p, res_t *res) {
     return OK;
 }
 
+bool is_primitive_cache_hit(const_dnnl_primitive_desc_t pd) {
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    return dnnl::impl::is_pd_in_cache(pd);
+#endif
+    return false;
+}
+
+int flush_primitive_cache() {
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    int capacity = 0;
+    DNN_SAFE(dnnl_get_primitive_cache_capacity(&capacity), WARN);
+    // Setting a zero capacity evicts all entries.
+    DNN_SAFE(dnnl_set_primitive_cache_capacity(0), WARN);
+    DNN_SAFE(dnnl_set_primitive_cache_capacity(capacity), WARN);
+#endif
+    return OK;
+}
+
 size_t set_primitive_cache_capacity_without_clearing(size_t capacity) {
 #ifndef DNNL_DISABLE_PRIMITIVE_CACHE
     return dnnl::impl::set_primitive_cache_capacity_without_clearing(capacity);
@@ -217,11 +236,13 @@ int test_persistent_cache_api(
     dnnl_primitive_t p {};
     auto &cache = get_test_cache();
     auto cache_value = cache.get(cache_blob_id);
+    dnnl_status_t dnnl_st = dnnl_success;
     if (!cache_value.empty()) {
         const size_t size = cache_value.size();
         const uint8_t *cache_blob = cache_value.data();
-        auto dnnl_st = dnnl_primitive_create_from_cache_blob(
-                &p, pd, size, cache_blob);
+        TIME_FUNC(dnnl_st = dnnl_primitive_create_from_cache_blob(
+                          &p, pd, size, cache_blob),
+                res, timer::names::cp_blob_timer);
         if (dnnl_st != dnnl_success) return res->state = FAILED, FAIL;
     } else {
         std::vector<uint8_t> cache_blob;
@@ -245,8 +266,9 @@ int test_persistent_cache_api(
             return FAIL;
         }
 
-        auto dnnl_st = dnnl_primitive_create_from_cache_blob(
-                &p, pd, cache_blob.size(), cache_blob.data());
+        TIME_FUNC(dnnl_st = dnnl_primitive_create_from_cache_blob(&p, pd,
+                          cache_blob.size(), cache_blob.data()),
+                res, timer::names::cp_blob_timer);
         if (dnnl_st != dnnl_success) return res->state = FAILED, FAIL;
         cache.add(cache_blob_id, cache_blob);
     }
@@ -495,11 +517,51 @@ void finalize() {
     finalize_tbb();
 }
 
+// Executes `perf_func` until the average execution time of two consecutive
+// windows differs by less than `tolerance`, or the time limit is exhausted.
+// Stable execution time indicates the CPU has settled on a frequency for the
+// workload, which may be lower than the idle one for AVX-512 or AMX kernels.
+int warmup_until_stable(dnnl_stream_t stream, perf_function_t &perf_func,
+        std::vector<dnnl_exec_arg_t> &dnnl_args) {
+    static constexpr double window_ms = 50.;
+    static constexpr double max_warmup_ms = 2000.;
+    static constexpr double tolerance = 0.02;
+
+    timer::timer_t total;
+    double prev_avg_ms = 0;
+    while (total.total_ms() < max_warmup_ms) {
+        timer::timer_t window;
+        while (true) {
+            window.start();
+            DNN_SAFE(perf_func(stream, dnnl_args), WARN);
+            window.stamp();
+            if (window.total_ms() >= window_ms) break;
+        }
+        total.stamp(window.times());
+
+        const double avg_ms = window.ms(timer::timer_t::avg);
+        if (prev_avg_ms
+                && std::fabs(avg_ms - prev_avg_ms) < tolerance * prev_avg_ms)
+            break;
+        prev_avg_ms = avg_ms;
+    }
+    BENCHDNN_PRINT(
+            5, "[INFO] Warm-up until stable time: %g ms.\n", total.total_ms());
+    return OK;
+}
+
 inline int measure_perf_individual(timer::timer_t &t, dnnl_stream_t stream,
-        perf_function_t &perf_func, std::vector<dnnl_exec_arg_t> &dnnl_args) {
+        perf_function_t &perf_func, std::vector<dnnl_exec_arg_t> &dnnl_args,
+        perf_counters_t &perf_counters) {
     cold_cache_t cold_cache(dnnl_args, stream);
 
+    if (warmup_stable)
+        SAFE(warmup_until_stable(stream, perf_func, dnnl_args), WARN);
+
     t.reset();
+    // Counters stay enabled for the whole loop to keep syscalls out of the
+    // measured time, cold-cache updates are counted as well when enabled.
+    perf_counters.start();
     while (true) {
         if (!cold_cache.update_dnnl_args(dnnl_args)) break;
         t.start();
@@ -507,6 +569,7 @@ inline int measure_perf_individual(timer::timer_t &t, dnnl_stream_t stream,
         t.stamp();
         if (should_stop(t)) break;
     }
+    perf_counters.stop();
     return OK;
 }
 
@@ -642,8 +705,10 @@ int measure_perf(const thr_ctx_t &ctx, res_t *res, perf_function_t &perf_func,
     // overhead. DPCPP CPU follows the model of GPU, thus, handled similar.
     int ret = OK;
     if (is_cpu() && !is_sycl_engine(engine)) {
+        perf_counters_t perf_counters;
         ret = execute_in_thr_ctx(ctx, measure_perf_individual, t, v_stream[0],
-                perf_func, dnnl_args[0]);
+                perf_func, dnnl_args[0], perf_counters);
+        perf_counters.report(res, t.times());
     } else {
         ret = execute_in_thr_ctx(
                 ctx, measure_perf_aggregate, t, v_stream, perf_func, dnnl_args);
@@ -88,6 +88,11 @@ extern "C" dnnl_status_t dnnl_query_profiling_data(dnnl_stream_t stream,
 
 int check_pd_cache(const_dnnl_primitive_desc_t pd, res_t *res);
 int check_primitive_cache(dnnl_primitive_t p, res_t *res);
+// Returns `true` if a primitive for `pd` would be fetched from the primitive
+// cache.
+bool is_primitive_cache_hit(const_dnnl_primitive_desc_t pd);
+// Drops all primitives from the primitive cache.
+int flush_primitive_cache();
 
 extern dnnl_engine_kind_t engine_tgt_kind;
 extern size_t engine_index;
@@ -449,7 +454,13 @@ int create_primitive(benchdnn_dnnl_wrapper_t<dnnl_primitive_t> &primw,
         }
     }
 
-    TIME_C_PRIM(DNN_SAFE(dnnl_primitive_create(&prim, pdw), WARN));
+    // The cache outcome is identified prior to creation since the primitive is
+    // put into the cache by the creation itself.
+    const auto &cp_outcome_timer = is_primitive_cache_hit(pdw)
+            ? timer::names::cp_hit_timer
+            : timer::names::cp_miss_timer;
+    TIME_FUNC(TIME_C_PRIM(DNN_SAFE(dnnl_primitive_create(&prim, pdw), WARN)),
+            res, cp_outcome_timer);
     primw.reset(prim);
 
     return OK;
@@ -491,6 +502,9 @@ int init_prim(benchdnn_dnnl_wrapper_t<dnnl_primitive_t> &user_prim,
     if (res->state == SKIPPED) return OK;
 #ifndef DNNL_DISABLE_PRIMITIVE_CACHE
 
+    // Service primitives are not flushed to keep a tested primitive cold.
+    if (cold_create && !is_service_prim) SAFE(flush_primitive_cache(), WARN);
+
     int capacity = 0;
     DNN_SAFE(dnnl_get_primitive_cache_capacity(&capacity), FAIL);
     if (capacity > 0) {
@@ -365,8 +365,16 @@ bool miopen_check_correctness(const prb_t *prb,
 
 void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
         const args_t &ref_args) {
-    const float trh
-            = get_eltwise_threshold(prb->dt, prb->alg, prb->dir & FLAG_FWD);
+    float trh = get_eltwise_threshold(prb->dt, prb->alg, prb->dir & FLAG_FWD);
+    // Non-strict fpmath mode allows forward algorithms to use approximations
+    // accurate up to the data type it allows down-conversion to.
+    const auto fpmath_mode = prb->attr.fpmath_mode.mode;
+    if (prb->dt == dnnl_f32 && (prb->dir & FLAG_FWD)
+            && fpmath_mode != dnnl_fpmath_mode_strict) {
+        const bool is_f16_math = fpmath_mode == dnnl_fpmath_mode_f16
+                || fpmath_mode == dnnl_fpmath_mode_tf32;
+        trh = MAX2(trh, epsilon_dt(is_f16_math ? dnnl_f16 : dnnl_bf16));
+    }
     cmp.set_threshold(trh);
 
     cmp.set_zero_trust_percent(get_eltwise_zero_trust_percent(prb));
@@ -56,7 +56,7 @@ void check_correctness(const settings_t &s) {
         }
 
         BENCHDNN_PRINT(7, "[INFO] Graph dump:\n%s\n", dg.get_string().c_str());
-        const prb_t prb(dg, i_expected_n_partition);
+        const prb_t prb(dg, i_expected_n_partition, s.partition_report);
         BENCHDNN_PRINT(1, "run: %s\n", pstr);
 
         // A timer for each test case.
@@ -76,6 +76,12 @@ void check_correctness(const settings_t &s) {
     }
 }
 
+static const std::string help_partition_report
+        = "BOOL    (Default: `false`)\n    Instructs the driver to measure "
+          "every compiled partition individually in performance mode and to "
+          "print time and memory per partition along with totals when set to "
+          "`true`.\n";
+
 int bench(int argc, char **argv) {
     driver_name = "graph";
     using namespace parser;
@@ -92,7 +98,11 @@ int bench(int argc, char **argv) {
                 || parse_graph_expected_n_partitions(
                         s.expected_n_partition_vec, argv[0])
                 || parse_graph_fpmath_mode(s.fpmath_mode_vec, argv[0])
-                || parse_mb(s.mb, def.mb, argv[0]) || parse_reset(s, argv[0]);
+                || parse_mb(s.mb, def.mb, argv[0])
+                || parse_single_value_option(s.partition_report,
+                        def.partition_report, str2bool, argv[0],
+                        "partition-report", help_partition_report)
+                || parse_reset(s, argv[0]);
         if (!parsed_options) {
             if (!parse_input_file(s.json_file, argv[0]))
                 catch_unknown_options(argv[0]);
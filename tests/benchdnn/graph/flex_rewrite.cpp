@@ -505,6 +505,8 @@ int flex_rewrite_t::infer_output_shape(
             case dnnl::graph::op::kind::ReLUBackward:
             case dnnl::graph::op::kind::Reorder:
             case dnnl::graph::op::kind::Round:
+            case dnnl::graph::op::kind::RMSNorm:
+            case dnnl::graph::op::kind::RotaryEmbedding:
             case dnnl::graph::op::kind::Sigmoid:
             case dnnl::graph::op::kind::SigmoidBackward:
             case dnnl::graph::op::kind::SoftMaxBackward:
@@ -640,6 +642,29 @@ int flex_rewrite_t::infer_output_shape(
                 }
                 gi[out0][axis] = sum;
                 break;
+            // infer_paged_cache_load_output_shape
+            case dnnl::graph::op::kind::PagedCacheLoad:
+                in0 = aop.in_lts_[0].id_;
+                in1 = aop.in_lts_[1].id_;
+                out0 = aop.out_lts_[0].id_;
+                gi[out0] = {gi[in1][0], gi[in0][1], gi[in1][1] * gi[in0][2],
+                        gi[in0][3]};
+                break;
+            // infer_gather_output_shape
+            case dnnl::graph::op::kind::Gather:
+                in0 = aop.in_lts_[0].id_;
+                in1 = aop.in_lts_[1].id_;
+                out0 = aop.out_lts_[0].id_;
+                axis = 0;
+                if (aop.attrs_.find("axis") != aop.attrs_.end()) {
+                    axis = aop.attrs_["axis"].s64_value_;
+                }
+                if (axis < 0) { axis += gi[in0].size(); }
+                gi[out0].assign(gi[in0].begin(), gi[in0].begin() + axis);
+                gi[out0].insert(gi[out0].end(), gi[in1].begin(), gi[in1].end());
+                gi[out0].insert(gi[out0].end(), gi[in0].begin() + axis + 1,
+                        gi[in0].end());
+                break;
             // infer_convtranspose_bwd_data_output_shape
             case dnnl::graph::op::kind::ConvTransposeBackwardData: use_oi = 1;
             // infer_conv_output_shape
@@ -1649,6 +1674,8 @@ int flex_rewrite_t::update_output_info(deserialized_op_t &aop,
         case dnnl::graph::op::kind::ReLU:
         case dnnl::graph::op::kind::ReLUBackward:
         case dnnl::graph::op::kind::Round:
+        case dnnl::graph::op::kind::RMSNorm:
+        case dnnl::graph::op::kind::RotaryEmbedding:
         case dnnl::graph::op::kind::Select:
         case dnnl::graph::op::kind::Sigmoid:
         case dnnl::graph::op::kind::SigmoidBackward:
@@ -1704,6 +1731,8 @@ int flex_rewrite_t::update_output_info(deserialized_op_t &aop,
         // of those ops are modifing the input stride, and the output stride can
         // not be specified via flex rewrite currently, therefore a default stride
         // represented by "abcd..." is set to the output
+        case dnnl::graph::op::kind::Gather:
+        case dnnl::graph::op::kind::PagedCacheLoad:
         case dnnl::graph::op::kind::Reorder:
         case dnnl::graph::op::kind::StaticReshape:
         case dnnl::graph::op::kind::StaticTranspose: {
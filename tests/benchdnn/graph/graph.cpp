@@ -547,6 +547,64 @@ int skip_unimplemented_partitions(const std::vector<partition> &partitions,
     return OK;
 }
 
+/// Measure every compiled partition individually and print time and memory
+/// per partition along with totals for the whole graph.
+///
+/// @param dg a deserialized graph
+/// @param partitions a list of partitions
+/// @param c_partitions a list of compiled partitions
+/// @param input_ts_all input tensors for each compiled partition
+/// @param output_ts_all output tensors for each compiled partition
+/// @param total_t the timer of the whole graph execution
+int report_partitions(const deserialized_graph_t &dg,
+        const std::vector<partition> &partitions,
+        const std::vector<compiled_partition> &c_partitions,
+        const std::vector<std::vector<tensor>> &input_ts_all,
+        const std::vector<std::vector<tensor>> &output_ts_all,
+        const timer::timer_t &total_t, res_t *res) {
+    const auto get_mem_size = [](const std::vector<tensor> &ts) {
+        size_t size = 0;
+        for (const auto &t : ts)
+            size += t.get_logical_tensor().get_mem_size();
+        return size;
+    };
+    const double mb = 1024. * 1024.;
+
+    const size_t n_partitions
+            = std::min(c_partitions.size(), input_ts_all.size());
+    double sum_ms = 0, sum_mem = 0;
+    std::vector<double> part_ms(n_partitions);
+    std::vector<size_t> part_mem(n_partitions);
+    for (size_t i = 0; i < n_partitions; i++) {
+        timer::timer_t t;
+        SAFE(measure_perf(t, {c_partitions[i]}, {input_ts_all[i]},
+                     {output_ts_all[i]}, res),
+                WARN);
+        part_ms[i] = t.ms(timer::timer_t::min);
+        part_mem[i] = get_mem_size(input_ts_all[i])
+                + get_mem_size(output_ts_all[i]);
+        sum_ms += part_ms[i];
+        sum_mem += part_mem[i];
+    }
+
+    printf("partition,idx,n_ops,ops,min(ms),share(%%),mem(MB)\n");
+    for (size_t i = 0; i < n_partitions; i++) {
+        std::string ops;
+        const auto op_ids = partitions[i].get_ops();
+        for (const size_t op_id : op_ids)
+            ops += (ops.empty() ? "" : "+") + dg.get_op(op_id).kind_;
+        printf("partition,%zu,%zu,%s,%g,%.1f,%g\n", i, op_ids.size(),
+                ops.c_str(), part_ms[i],
+                sum_ms ? 100. * part_ms[i] / sum_ms : 0.,
+                part_mem[i] / mb);
+    }
+    printf("partition,total,n_compiled:%zu,sum(ms):%g,graph(ms):%g,"
+           "mem(MB):%g\n",
+            n_partitions, sum_ms, total_t.ms(timer::timer_t::min),
+            sum_mem / mb);
+    return OK;
+}
+
 int doit(const prb_t *prb, res_t *res) {
     if (bench_mode == bench_mode_t::list) return res->state = LISTED, OK;
 
@@ -736,6 +794,11 @@ int doit(const prb_t *prb, res_t *res) {
         SAFE(measure_perf(res->timer_map.perf_timer(), c_partitions,
                      input_ts_all, output_ts_all, res),
                 WARN);
+        if (prb->partition_report) {
+            SAFE(report_partitions(dg, partitions, c_partitions, input_ts_all,
+                         output_ts_all, res->timer_map.perf_timer(), res),
+                    WARN);
+        }
     }
 
     return OK;
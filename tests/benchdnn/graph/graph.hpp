@@ -54,6 +54,7 @@ struct settings_t : public base_settings_t {
             {{SIZE_MAX, dnnl_data_type_undef}}};
     std::vector<std::map<size_t, std::string>> op_kind_map {
             {{SIZE_MAX, "default"}}};
+    bool partition_report = false;
 
     const char *perf_template_csv = "perf,%engine%,%DESC%,%-time%,%0time%";
     static constexpr const char *perf_template_def
@@ -64,8 +65,11 @@ struct settings_t : public base_settings_t {
 
 // TODO evaluate prb_t struct
 struct prb_t {
-    prb_t(const deserialized_graph_t &dg, const size_t &expected_n_partition)
-        : dg(dg), expected_n_partition(expected_n_partition) {
+    prb_t(const deserialized_graph_t &dg, const size_t &expected_n_partition,
+            bool partition_report = false)
+        : dg(dg)
+        , expected_n_partition(expected_n_partition)
+        , partition_report(partition_report) {
 
         const auto &fpmath = dg.get_fpmath_mode();
         fpmath_mode.mode_ = fpmath.first;
@@ -74,6 +78,7 @@ struct prb_t {
 
     deserialized_graph_t dg;
     size_t expected_n_partition;
+    bool partition_report;
     graph_fpmath_mode_t fpmath_mode;
 };
 
@@ -83,13 +83,31 @@ void compute_ref_bwd_d_ip(const prb_t *prb, const args_t &args) {
     const dnn_mem_t &diff_src_m = args.find(DNNL_ARG_DIFF_SRC);
     const dnn_mem_t &wei_m = args.find(DNNL_ARG_WEIGHTS);
     const dnn_mem_t &diff_dst_m = args.find(DNNL_ARG_DIFF_DST);
+    const dnn_mem_t &diff_dst_scales
+            = args.find(DNNL_ARG_ATTR_SCALES | DNNL_ARG_DIFF_DST);
+    const dnn_mem_t &wei_scales
+            = args.find(DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS);
+    const dnn_mem_t &diff_src_scales
+            = args.find(DNNL_ARG_ATTR_SCALES | DNNL_ARG_DIFF_SRC);
+
+    const auto &sc = prb->attr.scales;
+    const float diff_dst_scale = sc.get(DNNL_ARG_DIFF_DST).is_def()
+            ? 1.f
+            : diff_dst_scales.get_f32_elem(0);
+    const float wei_scale = sc.get(DNNL_ARG_WEIGHTS).is_def()
+            ? 1.f
+            : wei_scales.get_f32_elem(0);
+    const float diff_src_scale = sc.get(DNNL_ARG_DIFF_SRC).is_def()
+            ? 1.f
+            : 1.f / diff_src_scales.get_f32_elem(0);
 
     int64_t M = prb->mb;
     int64_t N = prb->ic * prb->id * prb->ih * prb->iw;
     int64_t K = prb->oc;
 
-    gemm("C", "N", "N", M, N, K, 1.f, (float *)diff_dst_m, K, (float *)wei_m, N,
-            0.f, (float *)diff_src_m, N);
+    const float alpha = diff_dst_scale * wei_scale * diff_src_scale;
+    gemm("C", "N", "N", M, N, K, alpha, (float *)diff_dst_m, K, (float *)wei_m,
+            N, 0.f, (float *)diff_src_m, N);
 }
 
 void compute_ref_bwd_w_ip(const prb_t *prb, const args_t &args) {
@@ -97,13 +115,25 @@ void compute_ref_bwd_w_ip(const prb_t *prb, const args_t &args) {
     const dnn_mem_t &diff_wei_m = args.find(DNNL_ARG_DIFF_WEIGHTS);
     const dnn_mem_t &diff_dst_m = args.find(DNNL_ARG_DIFF_DST);
     const dnn_mem_t &diff_bia_m = args.find(DNNL_ARG_DIFF_BIAS);
+    const dnn_mem_t &src_scales
+            = args.find(DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC);
+    const dnn_mem_t &diff_dst_scales
+            = args.find(DNNL_ARG_ATTR_SCALES | DNNL_ARG_DIFF_DST);
+
+    const auto &sc = prb->attr.scales;
+    const float src_scale
+            = sc.get(DNNL_ARG_SRC).is_def() ? 1.f : src_scales.get_f32_elem(0);
+    const float diff_dst_scale = sc.get(DNNL_ARG_DIFF_DST).is_def()
+            ? 1.f
+            : diff_dst_scales.get_f32_elem(0);
 
     int64_t M = prb->oc;
     int64_t N = prb->ic * prb->id * prb->ih * prb->iw;
     int64_t K = prb->mb;
 
-    gemm("C", "T", "N", M, N, K, 1.f, (float *)diff_dst_m, M, (float *)src_m, N,
-            0.f, (float *)diff_wei_m, N);
+    gemm("C", "T", "N", M, N, K, src_scale * diff_dst_scale,
+            (float *)diff_dst_m, M, (float *)src_m, N, 0.f,
+            (float *)diff_wei_m, N);
 
     if (prb->bia_dt() == dnnl_data_type_undef) return;
 
@@ -115,6 +145,7 @@ void compute_ref_bwd_w_ip(const prb_t *prb, const args_t &args) {
             size_t dst_off = dst_off_f(prb, mb, oc);
             db += ((float *)diff_dst_m)[dst_off];
         }
+        db *= diff_dst_scale;
     });
 }
 
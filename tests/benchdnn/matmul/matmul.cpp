@@ -827,6 +827,18 @@ void skip_invalid_prb(const prb_t *prb, res_t *res) {
 void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
         const args_t &ref_args) {
     cmp.set_zero_trust_percent(90.f); // TODO: why so bad filling?
+
+    // f16, relaxed and any accumulation modes allow the library to keep
+    // partial sums in f16, the error of which grows with the reduction size.
+    const auto acc_mode = prb->attr.acc_mode;
+    const bool f16_acc = prb->src_dt() == dnnl_f16 && prb->wei_dt() == dnnl_f16
+            && (acc_mode == dnnl_accumulation_mode_f16
+                    || acc_mode == dnnl_accumulation_mode_relaxed
+                    || acc_mode == dnnl_accumulation_mode_any);
+    if (f16_acc) {
+        const float trh = MAX2(1, prb->k - 1) * epsilon_dt(dnnl_f16) / 2;
+        cmp.set_threshold(trh);
+    }
 }
 
 std::vector<int> supported_exec_args(dir_t dir) {
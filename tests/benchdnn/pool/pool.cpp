@@ -308,8 +308,12 @@ int init_ref_memory_args(dnn_mem_map_t &ref_mem_map, dnn_mem_map_t &mem_map,
             case DNNL_ARG_WORKSPACE:
                 if (query_md_ndims(mem_map.at(DNNL_ARG_WORKSPACE).md_) > 0
                         && is_fwd_prim) {
+                    // Note: u4 workspace is filled from f32 as there is no
+                    // s32 to u4 reorder.
                     const auto ws_dt
-                            = is_integral_dt(mem.dt()) ? dnnl_s32 : dnnl_f32;
+                            = is_integral_dt(mem.dt()) && mem.dt() != dnnl_u4
+                            ? dnnl_s32
+                            : dnnl_f32;
                     ref_mem_map[exec_arg] = dnn_mem_t(mem.md_, ws_dt, tag::abx,
                             ref_engine, /* prefill = */ false);
                     SAFE(fill_ws(prb, mem, ref_mem), WARN);
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 #include <math.h>
+#include <vector>
 
 #include "utils/parallel.hpp"
 
@@ -38,6 +39,55 @@ float weight(const int64_t y, const int64_t y_max, const int64_t x_max) {
     return fabs(linear_map(y, y_max, x_max) - left(y, y_max, x_max));
 }
 
+float cubic_weight(float x) {
+    const float a = -0.75f;
+    x = fabsf(x);
+    if (x <= 1.f) return ((a + 2.f) * x - (a + 3.f)) * x * x + 1.f;
+    if (x < 2.f) return ((a * x - 5.f * a) * x + 8.f * a) * x - 4.f * a;
+    return 0.f;
+}
+
+// Fills indices and weights of source points contributing to destination
+// point `y` for the cubic and antialiased linear algorithms.
+void filter_coeffs(alg_t alg, const int64_t y, const int64_t y_max,
+        const int64_t x_max, std::vector<int64_t> &idx,
+        std::vector<float> &wei) {
+    idx.clear();
+    wei.clear();
+    if (y_max == x_max) {
+        idx.push_back(y);
+        wei.push_back(1.f);
+        return;
+    }
+
+    const float s = linear_map(y, y_max, x_max);
+    auto clamp = [&](int64_t x) {
+        return MIN2(MAX2(x, (int64_t)0), x_max - 1);
+    };
+
+    if (alg == cubic) {
+        const int64_t s_floor = (int64_t)floorf(s);
+        for (int64_t x = s_floor - 1; x <= s_floor + 2; x++) {
+            idx.push_back(clamp(x));
+            wei.push_back(cubic_weight(s - x));
+        }
+        return;
+    }
+
+    const float support = MAX2(1.f, (float)x_max / y_max);
+    float sum = 0.f;
+    for (int64_t x = MAX2((int64_t)ceilf(s - support), (int64_t)0);
+            x <= MIN2((int64_t)floorf(s + support), x_max - 1); x++) {
+        const float w = 1.f - fabsf(x - s) / support;
+        if (w <= 0.f) continue;
+        idx.push_back(x);
+        wei.push_back(w);
+        sum += w;
+    }
+    for (auto &w : wei)
+        w /= sum;
+}
+
 void compute_ref_fwd(const prb_t *prb, const args_t &args) {
     const dnn_mem_t &src = args.find(DNNL_ARG_SRC);
     const dnn_mem_t &dst = args.find(DNNL_ARG_DST);
@@ -89,14 +139,33 @@ void compute_ref_fwd(const prb_t *prb, const args_t &args) {
         result = cw;
     };
 
+    auto ker_filter = [&](float &result, int64_t mb, int64_t ic, int64_t od,
+                              int64_t oh, int64_t ow) {
+        std::vector<int64_t> id, ih, iw;
+        std::vector<float> wd, wh, ww;
+        filter_coeffs(prb->alg, od, OD, ID, id, wd);
+        filter_coeffs(prb->alg, oh, OH, IH, ih, wh);
+        filter_coeffs(prb->alg, ow, OW, IW, iw, ww);
+
+        result = 0.f;
+        for_(size_t d = 0; d < id.size(); d++)
+        for_(size_t h = 0; h < ih.size(); h++)
+        for (size_t w = 0; w < iw.size(); w++)
+            result += wd[d] * wh[h] * ww[w]
+                    * src.get_f32_elem(
+                            src_off_f(prb, mb, ic, id[d], ih[h], iw[w]));
+    };
+
     auto v_po_masks = prb->attr.post_ops.get_po_masks(prb->ndims);
     benchdnn_parallel_nd(MB, IC, OD, OH, OW,
             [&](int64_t mb, int64_t ic, int64_t od, int64_t oh, int64_t ow) {
                 float result = 0.f;
                 if (prb->alg == nearest) {
                     ker_nearest(result, mb, ic, od, oh, ow);
-                } else {
+                } else if (prb->alg == linear) {
                     ker_linear(result, mb, ic, od, oh, ow);
+                } else {
+                    ker_filter(result, mb, ic, od, oh, ow);
                 }
                 const auto dst_off = dst_off_f(prb, mb, ic, od, oh, ow);
 
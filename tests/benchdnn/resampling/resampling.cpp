@@ -113,6 +113,14 @@ void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
     skip_unimplemented_sum_po(prb->attr, res, dnnl_resampling, prb->sdt);
     skip_unimplemented_binary_po(prb->attr, res);
     skip_unimplemented_prelu_po(prb->attr, res, dnnl_resampling);
+
+    // Cubic and antialiased linear algorithms are forward only.
+    if (!(prb->dir & FLAG_FWD)
+            && (prb->alg == cubic || prb->alg == linear_antialias)) {
+        res->state = SKIPPED;
+        res->reason = skip_reason::case_not_supported;
+        return;
+    }
 }
 
 void skip_invalid_prb(const prb_t *prb, res_t *res) {}
@@ -35,8 +35,12 @@ enum alg_t {
     undef,
     nearest,
     linear,
+    cubic,
+    linear_antialias,
     resampling_nearest = nearest,
     resampling_linear = linear,
+    resampling_cubic = cubic,
+    resampling_linear_antialias = linear_antialias,
 };
 alg_t str2alg(const char *str);
 const char *alg2str(alg_t alg);
@@ -37,6 +37,10 @@ alg_t str2alg(const char *str) {
     CASE(resampling_nearest);
     CASE(linear);
     CASE(resampling_linear);
+    CASE(cubic);
+    CASE(resampling_cubic);
+    CASE(linear_antialias);
+    CASE(resampling_linear_antialias);
 #undef CASE
     assert(!"unknown algorithm");
     return undef;
@@ -45,6 +49,8 @@ alg_t str2alg(const char *str) {
 const char *alg2str(alg_t alg) {
     if (alg == nearest) return "nearest";
     if (alg == linear) return "linear";
+    if (alg == cubic) return "cubic";
+    if (alg == linear_antialias) return "linear_antialias";
     assert(!"unknown algorithm");
     return "undef";
 }
@@ -52,6 +58,8 @@ const char *alg2str(alg_t alg) {
 dnnl_alg_kind_t alg2alg_kind(alg_t alg) {
     if (alg == nearest) return dnnl_resampling_nearest;
     if (alg == linear) return dnnl_resampling_linear;
+    if (alg == cubic) return dnnl_resampling_cubic;
+    if (alg == linear_antialias) return dnnl_resampling_linear_antialias;
     assert(!"unknown algorithm");
     return dnnl_alg_kind_undef;
 }
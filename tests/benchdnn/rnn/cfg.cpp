@@ -105,6 +105,45 @@ CFG(bf16) {
     DEFAULT(BF16_ENTRY_F32);
 }
 
+// Weight-only quantization: bf16 activations with integer weights that are
+// scaled by the weights scales attribute.
+dt_conf_t::entry_t WEI_DECOMP_ENTRY_S8 {dnnl_s8, INT8_MIN, INT8_MAX, -64.f,
+        64.f, 0.f, 32.f, EPS_BF16};
+dt_conf_t::entry_t WEI_DECOMP_ENTRY_U8 {
+        dnnl_u8, 0, UINT8_MAX, 0.f, 127.f, 28.f, 16.f, EPS_BF16};
+dt_conf_t::entry_t WEI_DECOMP_ENTRY_S4 {
+        dnnl_s4, -8, 7, -8.f, 7.f, 0.f, 4.f, EPS_BF16};
+dt_conf_t::entry_t WEI_DECOMP_ENTRY_U4 {
+        dnnl_u4, 0, 15, 0.f, 15.f, 8.f, 4.f, EPS_BF16};
+
+CFG(bf16s8) {
+    UNUSED_REG_VAR(bf16s8);
+    CASE(WEIGHTS_LAYER, WEI_DECOMP_ENTRY_S8);
+    CASE(WEIGHTS_ITER, WEI_DECOMP_ENTRY_S8);
+    DEFAULT(conf_bf16[kind]);
+}
+
+CFG(bf16u8) {
+    UNUSED_REG_VAR(bf16u8);
+    CASE(WEIGHTS_LAYER, WEI_DECOMP_ENTRY_U8);
+    CASE(WEIGHTS_ITER, WEI_DECOMP_ENTRY_U8);
+    DEFAULT(conf_bf16[kind]);
+}
+
+CFG(bf16s4) {
+    UNUSED_REG_VAR(bf16s4);
+    CASE(WEIGHTS_LAYER, WEI_DECOMP_ENTRY_S4);
+    CASE(WEIGHTS_ITER, WEI_DECOMP_ENTRY_S4);
+    DEFAULT(conf_bf16[kind]);
+}
+
+CFG(bf16u4) {
+    UNUSED_REG_VAR(bf16u4);
+    CASE(WEIGHTS_LAYER, WEI_DECOMP_ENTRY_U4);
+    CASE(WEIGHTS_ITER, WEI_DECOMP_ENTRY_U4);
+    DEFAULT(conf_bf16[kind]);
+}
+
 // bf32
 dt_conf_t::entry_t BF32_ENTRY {dnnl_f32, -f32_max_exact, f32_max_exact,
         MIN_BF16, MAX_BF16, MEAN_BF16, STDDEV_BF16, EPS_BF16};
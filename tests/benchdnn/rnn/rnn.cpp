@@ -93,8 +93,14 @@ dnnl_primitive_attr_t create_dnnl_rnn_attr(const prb_t &prb) {
         DNN_SAFE_V(dnnl_primitive_attr_set_rnn_tparams(dnnl_attr, true,
                 prb.n_gates(), prb.linear_scales, prb.linear_cscale));
 
-    DNN_SAFE_V(dnnl_primitive_attr_set_rnn_weights_qparams(
-            dnnl_attr, prb.wei_nscales, prb.wei_scales_mask, prb.wei_scales));
+    if (prb.is_wei_decomp()) {
+        for (int arg : {DNNL_ARG_WEIGHTS_LAYER, DNNL_ARG_WEIGHTS_ITER})
+            DNN_SAFE_V(dnnl_primitive_attr_set_scales_mask(
+                    dnnl_attr, arg, prb.wei_scales_mask));
+    } else {
+        DNN_SAFE_V(dnnl_primitive_attr_set_rnn_weights_qparams(dnnl_attr,
+                prb.wei_nscales, prb.wei_scales_mask, prb.wei_scales));
+    }
 
     if (prb.is_lstm_projection() && prb.is_int8())
         DNN_SAFE_V(dnnl_primitive_attr_set_rnn_weights_projection_qparams(
@@ -467,6 +473,15 @@ int fill_weights(const prb_t &prb, rnn_data_kind_t kind, dnn_mem_t &mem_dt,
                 int64_t i_off = ((19 * o + 7 * g + 11 * d + 13 * l) % I);
                 int64_t off = (((l * D + d) * I + i_off) * G + g) * O + o;
                 float val = gate_factor;
+                if (prb.is_wei_decomp()) {
+                    // The library gets an integer value and decompresses it
+                    // to bf16 with the weights scales.
+                    mem_pure_fp.set_f32_elem(off, wei_decomp_int_value);
+                    val = wei_decomp_int_value * scales[off % n_scales];
+                    mem_fp.set_f32_elem(off,
+                            round_to_nearest_representable(dnnl_bf16, val));
+                    return;
+                }
                 mem_pure_fp.set_f32_elem(off, val);
                 if (prb.is_int8()) val *= scales[off % n_scales];
                 mem_fp.set_f32_elem(
@@ -776,7 +791,8 @@ dnnl_status_t init_pd(init_pd_args_t<prb_t> &init_pd_args) {
 void skip_unimplemented_prb(const prb_t *prb_, res_t *res) {
     const prb_t &prb = *prb_;
     dir_t dir = str2dir(prop2str(prb.prop));
-    skip_unimplemented_data_type({prb.cfg[SRC_LAYER].dt}, dir, res);
+    skip_unimplemented_data_type(
+            {prb.cfg[SRC_LAYER].dt, prb.cfg[WEIGHTS_LAYER].dt}, dir, res);
     skip_unimplemented_sum_po(prb.attr, res, dnnl_rnn, prb.cfg[SRC_LAYER].dt);
     skip_unimplemented_binary_po(prb.attr, res);
     skip_unimplemented_prelu_po(prb.attr, res, dnnl_rnn);
@@ -865,6 +881,15 @@ void skip_unimplemented_prb(const prb_t *prb_, res_t *res) {
         }
     }
 
+    // Weight-only quantization is limited to inference LSTM and GRU cells in
+    // the CPU brgemm-based implementation, which has its own blocking
+    // restrictions. Convert all unimplemented cases into not supported.
+    if (prb.is_wei_decomp()) {
+        res->state = SKIPPED;
+        res->reason = skip_reason::case_not_supported;
+        return;
+    }
+
     // LSTM w/ projection is not supported for bf16
     if (prb.is_lstm_projection()
             && (prb.cfg[SRC_LAYER].dt == dnnl_bf16
@@ -1271,6 +1296,23 @@ int checkit(std::vector<benchdnn_dnnl_wrapper_t<dnnl_primitive_t>> &v_prim,
     return OK;
 }
 
+// Weights scales of weight-only quantized configurations are passed at
+// execution.
+int init_wei_decomp_scales(dnn_mem_map_t &mem_map, const prb_t &prb) {
+    const int64_t nscales = prb.wei_nscales;
+    auto scales_md = dnn_mem_t::init_md(1, &nscales, dnnl_f32, tag::abx);
+    dnn_mem_t scales_fp(scales_md, get_cpu_engine(), /* prefill = */ false);
+    for (int64_t i = 0; i < nscales; i++)
+        scales_fp.set_f32_elem(i, prb.wei_scales[i]);
+
+    for (int arg : {DNNL_ARG_WEIGHTS_LAYER, DNNL_ARG_WEIGHTS_ITER}) {
+        dnn_mem_t scales(scales_md, get_test_engine(), /* prefill = */ false);
+        SAFE(scales.reorder(scales_fp), WARN);
+        mem_map.emplace(DNNL_ARG_ATTR_SCALES | arg, std::move(scales));
+    }
+    return OK;
+}
+
 int doit(const std::vector<benchdnn_dnnl_wrapper_t<dnnl_primitive_t>> &v_prim,
         const prb_t &prb, res_t *res) {
     set_zmalloc_max_expected_size(res->mem_size_args.zmalloc_expected_size);
@@ -1280,6 +1322,8 @@ int doit(const std::vector<benchdnn_dnnl_wrapper_t<dnnl_primitive_t>> &v_prim,
     dnn_mem_map_t mem_map, ref_mem_map;
     init_memory_args<prb_t>(
             mem_map, &prb, v_prim[0], supported_exec_args(FLAG_FWD));
+    if (prb.is_wei_decomp())
+        SAFE(init_wei_decomp_scales(mem_map, prb), WARN);
     TIME_FILL(SAFE(
             init_ref_memory_args(ref_mem_map, mem_map, v_prim[0], &prb, res),
             WARN));
@@ -187,6 +187,10 @@ struct desc_t {
 int str2desc(desc_t *desc, const char *str);
 std::ostream &operator<<(std::ostream &s, const desc_t &d);
 
+// Value of the non-zero weights with weight-only quantized configurations. It
+// fits every supported integer data type.
+const float wei_decomp_int_value = 2.f;
+
 /** configuration structure, that controls initial data filling + error check
 *
 * dt defines precision
@@ -219,6 +223,13 @@ struct dt_conf_t {
                 || operator[](SRC_LAYER).dt == dnnl_s8;
     }
     bool is_s8() const { return operator[](SRC_LAYER).dt == dnnl_s8; }
+    // Weight-only quantization: integer weights with bf16 activations.
+    bool is_wei_decomp() const {
+        const auto wei_dt = operator[](WEIGHTS_LAYER).dt;
+        return operator[](SRC_LAYER).dt == dnnl_bf16
+                && (wei_dt == dnnl_s8 || wei_dt == dnnl_u8 || wei_dt == dnnl_s4
+                        || wei_dt == dnnl_u4);
+    }
 
     static const dt_conf_t &create(const std::string &str, const attr_t &attr);
 
@@ -463,6 +474,7 @@ struct prb_t : public desc_t {
     }
     bool is_u8() const { return cfg[SRC_LAYER].dt == dnnl_u8; }
     bool is_s8() const { return cfg[SRC_LAYER].dt == dnnl_s8; }
+    bool is_wei_decomp() const { return cfg.is_wei_decomp(); }
     bool is_lstm_peephole() const { return with_peephole; }
     bool is_lstm_projection() const { return with_projection; }
     bool is_augru() const { return alg == VANILLA_AUGRU || alg == LBR_AUGRU; }
@@ -568,6 +568,17 @@ rnn_data_kind_t data_kind2rnn_data_kind(data_kind_t data_kind) {
 }
 
 void prb_t::set_qparams(float fp_min, float fp_max) {
+    if (cfg.is_wei_decomp()) {
+        data_shift = 0.;
+        data_scale = 1.;
+        // Scales bring the integer weights back to the `1 / n_gates` order
+        // of the floating-point weights filling, see fill_weights().
+        for (int64_t i = 0; i < wei_nscales; i++)
+            wei_scales[i] = (1.f + (float)(i % 4) / 4)
+                    / (wei_decomp_int_value * n_gates());
+        return;
+    }
+
     if (!cfg.is_int8()) {
         data_shift = 0.;
         data_scale = 1.;
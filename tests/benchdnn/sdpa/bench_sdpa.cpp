@@ -0,0 +1,155 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dnnl_common.hpp"
+#include "utils/parser.hpp"
+#include "utils/task_executor.hpp"
+
+#include "sdpa/sdpa.hpp"
+
+namespace sdpa {
+
+TASK_EXECUTOR_DECL_TYPES;
+
+void check_correctness(
+        const settings_t &s, driver_task_executor_t &task_executor) {
+    for_(const auto &i_dt : s.dt)
+    for_(const auto &i_ktag : s.ktag)
+    for_(const auto &i_mask : s.mask)
+    for_(const auto &i_mskdt : s.mskdt)
+    for_(const auto &i_scale : s.scale)
+    for_(const auto &i_k_scales : s.k_scales)
+    for_(const auto &i_v_scales : s.v_scales)
+    for_(const auto &i_k_zp : s.k_zp)
+    for_(const auto &i_v_zp : s.v_zp)
+    for_(const auto &i_mb : s.mb)
+    for_(const auto &i_attr : s.attributes)
+    for_(const auto &i_ctx_init : s.ctx_init)
+    for (const auto &i_ctx_exe : s.ctx_exe) {
+        const prb_t prb(s.desc, i_dt, i_ktag, i_mask, i_mskdt, i_scale,
+                i_k_scales, i_v_scales, i_k_zp, i_v_zp, i_mb, i_attr,
+                i_ctx_init, i_ctx_exe, s.impl_filter);
+        if (s.pattern && !match_regex(prb.str(), s.pattern)) return;
+
+        task_executor.submit(prb, s.perf_template, createit, checkit, doit);
+    }
+}
+
+int verify_input(const settings_t &s) {
+    static constexpr int n_inputs = 4;
+
+    for (const auto &i_dt : s.dt) {
+        if (i_dt.size() != 1 && i_dt.size() != n_inputs) {
+            BENCHDNN_PRINT(0,
+                    "ERROR: sdpa driver: `dt` option expects either a single "
+                    "input or four inputs in Q, K, V, DST order. Current size "
+                    "is: \"%ld\"\n",
+                    (long)i_dt.size());
+            SAFE_V(FAIL);
+        }
+    }
+
+    // Quantization parameters vary only along batch, heads and tokens.
+    const auto is_supported_policy = [](policy_t policy) {
+        return policy == policy_t::COMMON || policy == policy_t::PER_DIM_0
+                || policy == policy_t::PER_DIM_01 || policy == policy_t::PER_OC
+                || policy == policy_t::PER_TENSOR;
+    };
+    for (const auto &v : {s.k_scales, s.v_scales}) {
+        for (const auto &e : v) {
+            if (is_supported_policy(e.policy)) continue;
+            BENCHDNN_PRINT(0,
+                    "ERROR: sdpa driver: scales policy `%s` is not "
+                    "supported.\n",
+                    attr_t::policy2str(e.policy));
+            SAFE_V(FAIL);
+        }
+    }
+    for (const auto &v : {s.k_zp, s.v_zp}) {
+        for (const auto &e : v) {
+            if (is_supported_policy(e.policy)) continue;
+            BENCHDNN_PRINT(0,
+                    "ERROR: sdpa driver: zero points policy `%s` is not "
+                    "supported.\n",
+                    attr_t::policy2str(e.policy));
+            SAFE_V(FAIL);
+        }
+    }
+    return OK;
+}
+
+static const std::string help_mask
+        = "MASK    (Default: `none`)\n    Specifies the attention mask.\n    "
+          "`MASK` values are: `none`, `buffer_1d`, `buffer_2d`, `causal_tl` "
+          "and `causal_br`.\n";
+
+static const std::string help_scale
+        = "SCALE    (Default: `div`)\n    Specifies how scores are scaled by "
+          "`sqrt(d)`.\n    `SCALE` values are: `none`, `mul` and `div`.\n";
+
+static const std::string help_kv_scales
+        = "POLICY[:SCALE][:DATA_TYPE[:GROUPS]]    (Default: not specified)\n "
+          "   Specifies quantization scales of keys or values.\n";
+
+static const std::string help_kv_zp
+        = "POLICY[:ZEROPOINT][:DATA_TYPE[:GROUPS]]    (Default: not "
+          "specified)\n    Specifies quantization zero points of keys or "
+          "values.\n";
+
+int bench(int argc, char **argv) {
+    driver_name = "sdpa";
+    using namespace parser;
+    static settings_t s;
+    static const settings_t def {};
+    static driver_task_executor_t task_executor;
+    for (; argc > 0; --argc, ++argv) {
+        const bool parsed_options = parse_bench_settings(argv[0])
+                || parse_batch(bench, argv[0])
+                || parse_multi_dt(s.dt, def.dt, argv[0], "dt")
+                || parse_tag(s.ktag, def.ktag, argv[0], "ktag")
+                || parse_vector_option(
+                        s.mask, def.mask, str2mask, argv[0], "mask", help_mask)
+                || parse_dt(s.mskdt, def.mskdt, argv[0], "mskdt")
+                || parse_vector_option(s.scale, def.scale, str2scale, argv[0],
+                        "scale", help_scale)
+                || parse_subattr(
+                        s.k_scales, argv[0], "k-scales", help_kv_scales)
+                || parse_subattr(
+                        s.v_scales, argv[0], "v-scales", help_kv_scales)
+                || parse_subattr(s.k_zp, argv[0], "k-zp", help_kv_zp)
+                || parse_subattr(s.v_zp, argv[0], "v-zp", help_kv_zp)
+                || parse_mb(s.mb, def.mb, argv[0])
+                || parse_driver_shared_settings(s, def, argv[0]);
+        if (!parsed_options) {
+            catch_unknown_options(argv[0]);
+
+            SAFE(str2desc(&s.desc, argv[0]), CRIT);
+            SAFE(verify_input(s), WARN);
+            s.finalize();
+            check_correctness(s, task_executor);
+        }
+    }
+
+    task_executor.flush();
+
+    return parse_last_argument();
+}
+
+} // namespace sdpa
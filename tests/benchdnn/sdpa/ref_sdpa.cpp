@@ -0,0 +1,136 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <math.h>
+
+#include "utils/parallel.hpp"
+
+#include "sdpa/sdpa.hpp"
+
+namespace sdpa {
+
+// Returns an offset in a quantization tensor of `q_dims` for the element at
+// `off` in a plain tensor of `dims`.
+int64_t get_quant_off(const dims_t &dims, const dims_t &q_dims, int64_t off) {
+    int64_t q_off = 0, q_stride = 1;
+    for (int i = static_cast<int>(dims.size()) - 1; i >= 0; i--) {
+        const int64_t idx = off % dims[i];
+        off /= dims[i];
+        q_off += idx / (dims[i] / q_dims[i]) * q_stride;
+        q_stride *= q_dims[i];
+    }
+    return q_off;
+}
+
+// Dequantizes keys or values as `(x - zp) * scale` into `out`.
+void dequantize(const prb_t *prb, const dnn_mem_t &mem,
+        const dnn_mem_t &scales, const dnn_mem_t &zero_points, bool is_keys,
+        std::vector<float> &out) {
+    const auto &sc = is_keys ? prb->k_scales : prb->v_scales;
+    const auto &zp = is_keys ? prb->k_zp : prb->v_zp;
+    const dims_t dims = is_keys ? prb->k_dims() : prb->v_dims();
+    const dims_t sc_dims = prb->get_quant_dims(sc.policy, sc.groups, is_keys);
+    const dims_t zp_dims = prb->get_quant_dims(zp.policy, zp.groups, is_keys);
+
+    const int64_t nelems = mem.nelems();
+    out.resize(nelems);
+    benchdnn_parallel_nd(nelems, [&](int64_t i) {
+        float val = mem.get_f32_elem(i);
+        if (zero_points)
+            val -= zero_points.get_f32_elem(get_quant_off(dims, zp_dims, i));
+        if (scales) val *= scales.get_f32_elem(get_quant_off(dims, sc_dims, i));
+        out[i] = val;
+    });
+}
+
+void compute_ref(const prb_t *prb, dir_t dir, const args_t &args,
+        dnnl_primitive_t prim_ref) {
+    const dnn_mem_t &q_m = args.find(DNNL_ARG_QUERIES);
+    const dnn_mem_t &k_m = args.find(DNNL_ARG_KEYS);
+    const dnn_mem_t &v_m = args.find(DNNL_ARG_VALUES);
+    const dnn_mem_t &msk_m = args.find(DNNL_ARG_ATTN_MASK);
+    const dnn_mem_t &scale_m = args.find(DNNL_ARG_SCALE);
+    const dnn_mem_t &dst_m = args.find(DNNL_ARG_DST);
+    const dnn_mem_t &k_scales_m
+            = args.find(DNNL_ARG_ATTR_SCALES | DNNL_ARG_KEYS);
+    const dnn_mem_t &v_scales_m
+            = args.find(DNNL_ARG_ATTR_SCALES | DNNL_ARG_VALUES);
+    const dnn_mem_t &k_zp_m
+            = args.find(DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_KEYS);
+    const dnn_mem_t &v_zp_m
+            = args.find(DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_VALUES);
+
+    std::vector<float> k, v;
+    dequantize(prb, k_m, k_scales_m, k_zp_m, /* is_keys = */ true, k);
+    dequantize(prb, v_m, v_scales_m, v_zp_m, /* is_keys = */ false, v);
+
+    const int64_t MB = prb->mb;
+    const int64_t H = prb->h;
+    const int64_t KVH = prb->kvh;
+    const int64_t SQ = prb->sq;
+    const int64_t SKV = prb->skv;
+    const int64_t D = prb->d;
+    const int64_t h_per_kvh = H / KVH;
+    const float scale = scale_m ? scale_m.get_f32_elem(0) : 1.f;
+
+    float *dst_ptr = (float *)dst_m;
+
+    benchdnn_parallel_nd(MB, H, SQ, [&](int64_t mb, int64_t h, int64_t sq) {
+        const int64_t kvh = h / h_per_kvh;
+        const int64_t q_off = ((mb * H + h) * SQ + sq) * D;
+        const int64_t kv_off = (mb * KVH + kvh) * D * SKV;
+
+        // Causal masks hide keys past the query position, the bottom-right
+        // alignment shifts the diagonal by the difference of lengths.
+        int64_t skv_end = SKV;
+        if (prb->mask == CAUSAL_TL)
+            skv_end = MIN2(SKV, sq + 1);
+        else if (prb->mask == CAUSAL_BR)
+            skv_end = MAX2(int64_t(0), MIN2(SKV, sq + 1 + SKV - SQ));
+
+        std::vector<float> s(skv_end);
+        float max_s = -INFINITY;
+        for (int64_t skv = 0; skv < skv_end; skv++) {
+            float acc = 0.f;
+            for (int64_t d = 0; d < D; d++)
+                acc += q_m.get_f32_elem(q_off + d) * k[kv_off + d * SKV + skv];
+            if (prb->scale == SCALE_MUL) acc *= scale;
+            if (prb->scale == SCALE_DIV) acc /= scale;
+            if (prb->with_mask_buffer()) {
+                const int64_t msk_sq = prb->mask == BUFFER_2D ? sq : 0;
+                acc += msk_m.get_f32_elem(msk_sq * SKV + skv);
+            }
+            s[skv] = acc;
+            max_s = MAX2(max_s, acc);
+        }
+
+        float sum = 0.f;
+        for (int64_t skv = 0; skv < skv_end; skv++) {
+            s[skv] = expf(s[skv] - max_s);
+            sum += s[skv];
+        }
+
+        // A fully masked row produces zeros.
+        for (int64_t d = 0; d < D; d++) {
+            float acc = 0.f;
+            for (int64_t skv = 0; skv < skv_end; skv++)
+                acc += s[skv] * v[kv_off + skv * D + d];
+            dst_ptr[q_off + d] = sum > 0.f ? acc / sum : 0.f;
+        }
+    });
+}
+
+} // namespace sdpa
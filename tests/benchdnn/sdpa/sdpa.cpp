@@ -0,0 +1,374 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "utils/fill.hpp"
+#include "utils/numeric.hpp"
+
+#include "dnnl_common.hpp"
+#include "dnnl_memory.hpp"
+
+#include "sdpa/sdpa.hpp"
+
+// The sdpa primitive has no public API yet. The internal interface and the
+// mask kinds are used directly. Must be removed once the primitive gets its
+// public counterpart.
+#include "src/common/c_types_map.hpp"
+#include "tests/gtests/internals/sdpa_internal.hpp"
+
+namespace sdpa {
+
+// Returns a new attribute with keys or values quantization parameters.
+dnnl_primitive_attr_t create_kv_attr(const prb_t *prb, bool is_keys) {
+    const auto &sc = is_keys ? prb->k_scales : prb->v_scales;
+    const auto &zp = is_keys ? prb->k_zp : prb->v_zp;
+
+    dnnl_primitive_attr_t dnnl_attr = nullptr;
+    DNN_SAFE_V(dnnl_primitive_attr_create(&dnnl_attr));
+
+    if (!sc.is_def()) {
+        const int mask = prb->get_quant_mask(sc.policy, is_keys);
+        DNN_SAFE_V(dnnl_primitive_attr_set_scales(dnnl_attr, DNNL_ARG_WEIGHTS,
+                mask, static_cast<int>(sc.groups.size()), sc.groups.data(),
+                sc.dt));
+    }
+    if (!zp.is_def()) {
+        const int mask = prb->get_quant_mask(zp.policy, is_keys);
+        DNN_SAFE_V(dnnl_primitive_attr_set_zero_points(dnnl_attr,
+                DNNL_ARG_WEIGHTS, mask, static_cast<int>(zp.groups.size()),
+                zp.groups.data(), zp.dt));
+    }
+
+    return dnnl_attr;
+}
+
+dnnl_status_t init_pd(init_pd_args_t<prb_t> &init_pd_args) {
+    const prb_t *prb = init_pd_args.prb;
+    res_t *res = init_pd_args.res;
+    const bool force_f32_dt = init_pd_args.force_f32_dt;
+
+    const auto q_dims = prb->q_dims();
+    const auto k_dims = prb->k_dims();
+    const auto v_dims = prb->v_dims();
+    const auto dst_dims = prb->dst_dims();
+    const auto msk_dims = prb->msk_dims();
+
+    auto q_d = dnn_mem_t::init_md(4, q_dims.data(),
+            force_f32_dt ? dnnl_f32 : prb->q_dt(), tag::abx);
+    auto k_d = dnn_mem_t::init_md(4, k_dims.data(),
+            force_f32_dt ? dnnl_f32 : prb->k_dt(), prb->ktag);
+    auto v_d = dnn_mem_t::init_md(4, v_dims.data(),
+            force_f32_dt ? dnnl_f32 : prb->v_dt(), tag::abx);
+    auto dst_d = dnn_mem_t::init_md(4, dst_dims.data(),
+            force_f32_dt ? dnnl_f32 : prb->dst_dt(), tag::abx);
+
+    benchdnn_dnnl_wrapper_t<dnnl_memory_desc_t> msk_d;
+    if (prb->with_mask_buffer()) {
+        msk_d = dnn_mem_t::init_md(4, msk_dims.data(),
+                force_f32_dt ? dnnl_f32 : prb->mskdt, tag::abx);
+    }
+
+    int mask_type = dnnl::impl::attn_mask_type::undef;
+    if (prb->with_mask_buffer())
+        mask_type = dnnl::impl::attn_mask_type::buffer;
+    else if (prb->mask == CAUSAL_TL)
+        mask_type = dnnl::impl::attn_mask_type::top_left;
+    else if (prb->mask == CAUSAL_BR)
+        mask_type = dnnl::impl::attn_mask_type::bottom_right;
+
+    const auto scale_dt = prb->scale == SCALE_NONE
+            ? dnnl_data_type_undef
+            : (force_f32_dt ? dnnl_f32 : prb->q_dt());
+    const auto softmax_alg = static_cast<dnnl_alg_kind_t>(
+            dnnl::impl::alg_kind::softmax_accurate_inf_as_zero);
+
+    attr_args_t attr_args;
+    auto dnnl_attr = make_benchdnn_dnnl_wrapper(
+            create_dnnl_attr(prb->attr, attr_args, 4));
+    auto kq_attr = make_benchdnn_dnnl_wrapper(create_kv_attr(prb, true));
+    auto vs_attr = make_benchdnn_dnnl_wrapper(create_kv_attr(prb, false));
+
+    TIME_C_PD(DNN_SAFE_STATUS(sdpa_primitive_desc_create(&init_pd_args.pd,
+            init_pd_args.engine, q_d, k_d, v_d, dst_d, msk_d, scale_dt,
+            prb->scale == SCALE_DIV, prb->kvh, mask_type, softmax_alg,
+            dnnl_attr, kq_attr, vs_attr)));
+
+    return dnnl_success;
+}
+
+void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
+    skip_unimplemented_data_type(prb->dt, prb->dir, res);
+    if (res->state == SKIPPED) return;
+    if (prb->with_mask_buffer()) {
+        skip_unimplemented_data_type({prb->mskdt}, prb->dir, res);
+        if (res->state == SKIPPED) return;
+    }
+
+    // Only the attributes of the matrix multiplications are supported.
+    if (!prb->attr.scales.is_def() || !prb->attr.zero_points.is_def()
+            || !prb->attr.post_ops.is_def()) {
+        res->state = SKIPPED;
+        res->reason = skip_reason::case_not_supported;
+        return;
+    }
+
+    if (is_cpu()) {
+#if !defined(DNNL_X64) || DNNL_X64 == 0
+        // The only CPU implementation is x64-specific.
+        res->state = SKIPPED;
+        res->reason = skip_reason::case_not_supported;
+        return;
+#endif
+        // The CPU implementation doesn't support quantized keys and values.
+        const auto is_fp = [](dnnl_data_type_t dt) {
+            return dt == dnnl_f32 || dt == dnnl_bf16 || dt == dnnl_f16;
+        };
+        if (prb->with_kv_quant() || !is_fp(prb->k_dt())
+                || !is_fp(prb->v_dt())) {
+            res->state = SKIPPED;
+            res->reason = skip_reason::case_not_supported;
+            return;
+        }
+    }
+
+    if (is_gpu()) {
+        // The GPU implementation writes the destination in the queries data
+        // type.
+        if (prb->q_dt() != prb->dst_dt()) {
+            res->state = SKIPPED;
+            res->reason = skip_reason::case_not_supported;
+            return;
+        }
+    }
+}
+
+void skip_invalid_prb(const prb_t *prb, res_t *res) {
+    // Each key-value head is shared by the same number of query heads.
+    if (prb->h % prb->kvh != 0) {
+        res->state = SKIPPED;
+        res->reason = skip_reason::invalid_case;
+        return;
+    }
+
+    // Quantization parameters follow the library rules for matmul weights.
+    for (const auto *sc : {&prb->k_scales, &prb->v_scales}) {
+        if (sc->is_def()) continue;
+        if (!(sc->dt == dnnl_f32 || sc->dt == dnnl_bf16
+                    || sc->dt == dnnl_f16)) {
+            res->state = SKIPPED;
+            res->reason = skip_reason::invalid_case;
+            return;
+        }
+    }
+    for (const auto *zp : {&prb->k_zp, &prb->v_zp}) {
+        if (zp->is_def()) continue;
+        if (!is_integral_dt(zp->dt)) {
+            res->state = SKIPPED;
+            res->reason = skip_reason::invalid_case;
+            return;
+        }
+    }
+}
+
+void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
+        const args_t &ref_args) {
+    // Both matrix multiplications are accumulated in f32, while intermediate
+    // scores may be down-converted to the queries data type.
+    const auto trh_dt = prb->q_dt() != dnnl_f32 ? prb->q_dt() : prb->dst_dt();
+    const float trh_coeff = trh_dt == dnnl_f32 ? 10.f : 5.f;
+    cmp.set_threshold(trh_coeff * epsilon_dt(trh_dt));
+
+    // A bottom-right causal mask hides whole rows when there are more queries
+    // than keys. Such rows are zeroed.
+    if (prb->mask == CAUSAL_BR && prb->sq > prb->skv)
+        cmp.set_zero_trust_percent(100.f);
+}
+
+std::vector<int> supported_exec_args(dir_t dir) {
+    static const std::vector<int> exec_fwd_args = {
+            DNNL_ARG_QUERIES,
+            DNNL_ARG_KEYS,
+            DNNL_ARG_VALUES,
+            DNNL_ARG_ATTN_MASK,
+            DNNL_ARG_DST,
+    };
+    return exec_fwd_args;
+};
+
+// Returns the scale the scores are multiplied or divided by.
+float get_attn_scale(const prb_t *prb) {
+    if (prb->scale == SCALE_NONE) return 1.f;
+    const float sqrt_d = sqrtf(static_cast<float>(prb->d));
+    return prb->scale == SCALE_DIV ? sqrt_d : 1.f / sqrt_d;
+}
+
+int init_ref_memory_args(dnn_mem_map_t &ref_mem_map, dnn_mem_map_t &mem_map,
+        dnnl_primitive_t prim, const prb_t *prb, res_t *res,
+        dnnl_primitive_t prim_ref) {
+    if (has_bench_mode_modifier(mode_modifier_t::no_ref_memory)) return OK;
+
+    const auto &ref_engine = get_cpu_engine();
+
+    for (auto &entry : mem_map) {
+        const int exec_arg = entry.first;
+        // The function targets regular exec_args that are positive.
+        // Negative args are used by bitwise and are broken in the `default`
+        // branch due to `&` always returns `true`.
+        if (exec_arg <= 0) continue;
+
+        auto &mem = entry.second; // `mem` is modified by filler (reorder).
+
+        // Scratchpad memory relates to a primitive. If reference needs it,
+        // use switch below to define a memory desc for it.
+        if (exec_arg != DNNL_ARG_SCRATCHPAD) {
+            ref_mem_map.emplace(exec_arg,
+                    dnn_mem_t(mem.md_, dnnl_f32, tag::abx, ref_engine,
+                            /* prefill = */ false));
+        }
+        auto &ref_mem = ref_mem_map[exec_arg];
+
+        switch (exec_arg) {
+            case DNNL_ARG_QUERIES:
+            case DNNL_ARG_KEYS:
+            case DNNL_ARG_VALUES: {
+                // Integer keys and values use a wider range to keep more than
+                // a couple of distinct values.
+                const float range = is_integral_dt(mem.dt()) ? 4.f : 1.f;
+                fill_cfg_t cfg(mem.dt(), -range, range, /* int = */ false,
+                        attr_t::post_ops_t::kind_t::ADD, "sdpa_qkv");
+                SAFE(fill_random_real(mem, ref_mem, res, cfg), WARN);
+            } break;
+            case DNNL_ARG_ATTN_MASK: {
+                fill_cfg_t cfg(mem.dt(), -4.f, 0.f, /* int = */ false,
+                        attr_t::post_ops_t::kind_t::ADD, "sdpa_mask");
+                SAFE(fill_random_real(mem, ref_mem, res, cfg), WARN);
+            } break;
+            case DNNL_ARG_SCALE: {
+                const float scale = round_to_nearest_representable(
+                        mem.dt(), get_attn_scale(prb));
+                mem.set_elem(0, scale);
+                ref_mem.set_f32_elem(0, scale);
+            } break;
+            case DNNL_ARG_ATTR_SCALES | DNNL_ARG_KEYS:
+                SAFE(fill_scales(prb->k_scales, mem, ref_mem), WARN);
+                break;
+            case DNNL_ARG_ATTR_SCALES | DNNL_ARG_VALUES:
+                SAFE(fill_scales(prb->v_scales, mem, ref_mem), WARN);
+                break;
+            case DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_KEYS:
+                SAFE(fill_zero_points(prb->k_zp, mem, ref_mem), WARN);
+                break;
+            case DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_VALUES:
+                SAFE(fill_zero_points(prb->v_zp, mem, ref_mem), WARN);
+                break;
+            default:
+                SAFE(init_ref_memory_args_default_case(
+                             exec_arg, mem, ref_mem, prb->attr, res),
+                        WARN);
+                break;
+        }
+        // Don't keep reference memory if it is not used further.
+        if (!has_bench_mode_bit(mode_bit_t::corr)) ref_mem_map.clear();
+    }
+
+    return OK;
+}
+
+// Adds memory objects the primitive descriptor can't report: the attention
+// scale and quantization parameters of keys and values.
+void init_extra_memory_args(dnn_mem_map_t &mem_map, const prb_t *prb) {
+    const auto &test_engine = get_test_engine();
+
+    if (prb->scale != SCALE_NONE) {
+        const dnnl_dims_t scale_dims = {1};
+        mem_map.emplace(DNNL_ARG_SCALE,
+                dnn_mem_t(1, scale_dims, prb->q_dt(), tag::abx, test_engine,
+                        /* prefill = */ false));
+    }
+
+    const auto add_quant_mem = [&](int exec_arg, policy_t policy,
+                                       const std::vector<int64_t> &groups,
+                                       dnnl_data_type_t dt, bool is_keys) {
+        const auto dims = prb->get_quant_dims(policy, groups, is_keys);
+        mem_map.emplace(exec_arg,
+                dnn_mem_t(static_cast<int>(dims.size()), dims.data(), dt,
+                        tag::abx, test_engine, /* prefill = */ false));
+    };
+
+    if (!prb->k_scales.is_def())
+        add_quant_mem(DNNL_ARG_ATTR_SCALES | DNNL_ARG_KEYS,
+                prb->k_scales.policy, prb->k_scales.groups, prb->k_scales.dt,
+                true);
+    if (!prb->v_scales.is_def())
+        add_quant_mem(DNNL_ARG_ATTR_SCALES | DNNL_ARG_VALUES,
+                prb->v_scales.policy, prb->v_scales.groups, prb->v_scales.dt,
+                false);
+    if (!prb->k_zp.is_def())
+        add_quant_mem(DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_KEYS,
+                prb->k_zp.policy, prb->k_zp.groups, prb->k_zp.dt, true);
+    if (!prb->v_zp.is_def())
+        add_quant_mem(DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_VALUES,
+                prb->v_zp.policy, prb->v_zp.groups, prb->v_zp.dt, false);
+}
+
+int createit(std::vector<benchdnn_dnnl_wrapper_t<dnnl_primitive_t>> &v_prim,
+        const prb_t *prb, res_t *res) {
+    v_prim.resize(1);
+    SAFE(init_prim(prb->ctx_init, v_prim[0], init_pd, prb, res), WARN);
+    return OK;
+}
+
+int checkit(std::vector<benchdnn_dnnl_wrapper_t<dnnl_primitive_t>> &v_prim,
+        const prb_t *prb, res_t *res) {
+    if (has_bench_mode_bit(mode_bit_t::exec)) {
+        SAFE(check_total_size(res), WARN);
+    }
+    if (has_bench_mode_bit(mode_bit_t::corr)) {
+        SAFE(check_caches(v_prim[0], prb, res), WARN);
+    }
+    return OK;
+}
+
+int doit(const std::vector<benchdnn_dnnl_wrapper_t<dnnl_primitive_t>> &v_prim,
+        const prb_t *prb, res_t *res) {
+    set_zmalloc_max_expected_size(res->mem_size_args.zmalloc_expected_size);
+
+    const auto &prim = v_prim[0];
+
+    dnn_mem_map_t mem_map, ref_mem_map;
+    init_memory_args<prb_t>(mem_map, prb, prim, supported_exec_args(prb->dir));
+    init_extra_memory_args(mem_map, prb);
+    TIME_FILL(SAFE(
+            init_ref_memory_args(ref_mem_map, mem_map, prim, prb, res), WARN));
+
+    args_t args(mem_map), ref_args(ref_mem_map);
+
+    SAFE(execute_and_wait(prim, args, res), WARN);
+
+    check_correctness(
+            prb, {DST}, args, ref_args, setup_cmp, res, prb->dir);
+    SAFE(check_bitwise(prim, {DST}, args, prb->attr, prb->inplace, res),
+            WARN);
+
+    return measure_perf(prb->ctx_exe, res, prim, args);
+}
+
+} // namespace sdpa
@@ -0,0 +1,269 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef SDPA_HPP
+#define SDPA_HPP
+
+#include <assert.h>
+#include <stdint.h>
+
+#include <iostream>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common.hpp"
+#include "dnn_types.hpp"
+#include "dnnl_common.hpp"
+#include "utils/perf_report.hpp"
+#include "utils/settings.hpp"
+
+// Argument names of the internal sdpa interface.
+#define DNNL_ARG_QUERIES DNNL_ARG_SRC_0
+#define DNNL_ARG_KEYS DNNL_ARG_SRC_1
+#define DNNL_ARG_VALUES DNNL_ARG_SRC_2
+#define DNNL_ARG_ATTN_MASK DNNL_ARG_SHIFT
+
+namespace sdpa {
+
+// Scaled dot product attention:
+//     dst = softmax(scale(Q * K) + mask) * V
+// with Q of `mb x h x sq x d`, K of `mb x kvh x d x skv`, V of
+// `mb x kvh x skv x d` and dst of `mb x h x sq x d`. Each group of `h / kvh`
+// query heads shares a single key-value head (grouped-query attention).
+
+enum mask_t {
+    NONE,
+    // An additive mask tensor broadcast over queries: `1 x 1 x 1 x skv`.
+    BUFFER_1D,
+    // An additive mask tensor: `1 x 1 x sq x skv`.
+    BUFFER_2D,
+    // Implicit causal masks aligned to the top-left and to the bottom-right
+    // corners of the scores matrix.
+    CAUSAL_TL,
+    CAUSAL_BR,
+};
+mask_t str2mask(const char *str);
+const char *mask2str(mask_t mask);
+
+enum scale_t {
+    SCALE_NONE,
+    // Scores are multiplied by `1 / sqrt(d)`.
+    SCALE_MUL,
+    // Scores are divided by `sqrt(d)`.
+    SCALE_DIV,
+};
+scale_t str2scale(const char *str);
+const char *scale2str(scale_t scale);
+
+struct desc_t {
+    int64_t mb, h, kvh, sq, skv, d;
+    std::string name;
+};
+int str2desc(desc_t *desc, const char *str);
+std::ostream &operator<<(std::ostream &s, const desc_t &d);
+
+using scales_t = attr_t::arg_scales_t::entry_t;
+using zero_points_t = attr_t::zero_points_t::entry_t;
+
+struct settings_t : public base_settings_t {
+    using base_settings_t::base_settings_t;
+
+    desc_t desc {};
+
+    std::vector<std::vector<dnnl_data_type_t>> dt {{dnnl_f32}};
+    std::vector<std::string> ktag {tag::abx};
+    std::vector<mask_t> mask {NONE};
+    std::vector<dnnl_data_type_t> mskdt {dnnl_f32};
+    std::vector<scale_t> scale {SCALE_DIV};
+    std::vector<scales_t> k_scales {scales_t()}, v_scales {scales_t()};
+    std::vector<zero_points_t> k_zp {zero_points_t()}, v_zp {zero_points_t()};
+
+    const char *perf_template_csv() const {
+        static const std::string args = "%sdt%,%ddt%,%alg%";
+        return perf_template_csv_base(args);
+    }
+
+    void reset() { *this = settings_t(perf_template); }
+
+    bool has_single_setup() const override {
+        return dt.size() == 1 && ktag.size() == 1 && mask.size() == 1
+                && mskdt.size() == 1 && scale.size() == 1
+                && k_scales.size() == 1 && v_scales.size() == 1
+                && k_zp.size() == 1 && v_zp.size() == 1
+                && base_settings_t::has_single_setup();
+    }
+};
+
+struct prb_t : public desc_t {
+    // A ctor with common interface across all drivers.
+    prb_t(const settings_t &s)
+        : prb_t(s.desc, s.dt[0], s.ktag[0], s.mask[0], s.mskdt[0], s.scale[0],
+                s.k_scales[0], s.v_scales[0], s.k_zp[0], s.v_zp[0], s.mb[0],
+                s.attributes.front(), s.ctx_init[0], s.ctx_exe[0],
+                s.impl_filter) {
+        SAFE_V(s.has_single_setup() ? OK : FAIL);
+    }
+
+    prb_t(const desc_t &desc, const std::vector<dnnl_data_type_t> &dt,
+            const std::string &ktag, mask_t mask, dnnl_data_type_t mskdt,
+            scale_t scale, const scales_t &k_scales, const scales_t &v_scales,
+            const zero_points_t &k_zp, const zero_points_t &v_zp, int64_t mb,
+            const attr_t &attr, const thr_ctx_t &ctx_init,
+            const thr_ctx_t &ctx_exe, const impl_filter_t &impl_filter)
+        : desc_t(desc)
+        , dt(dt)
+        , ktag(ktag)
+        , mask(mask)
+        , mskdt(mskdt)
+        , scale(scale)
+        , k_scales(k_scales)
+        , v_scales(v_scales)
+        , k_zp(k_zp)
+        , v_zp(v_zp)
+        , user_mb(mb)
+        , attr(attr)
+        , ctx_init(ctx_init)
+        , ctx_exe(ctx_exe)
+        , impl_filter(impl_filter) {
+        // Broadcast data type if needed.
+        if (dt.size() == 1) {
+            const auto val = dt[0]; // Need a copy here.
+            this->dt.assign(4, val);
+        }
+        if (mb) this->mb = mb;
+        // Two matrix multiplications: Q * K and softmax(...) * V.
+        ops = 2. * 2. * this->mb * h * sq * skv * d;
+        repro = set_repro_line(); // must be last in ctor to collect right info
+    }
+
+    std::vector<dnnl_data_type_t> dt;
+    std::string ktag;
+    mask_t mask;
+    dnnl_data_type_t mskdt;
+    scale_t scale;
+    scales_t k_scales, v_scales;
+    zero_points_t k_zp, v_zp;
+    int64_t user_mb;
+    dir_t dir = FWD_I; // Lacks placement, always considered `FWD_I`.
+    bool inplace = false; // Lacks placement, always considered `false`.
+    attr_t attr;
+    thr_ctx_t ctx_init, ctx_exe;
+    impl_filter_t impl_filter;
+    double ops;
+
+    dnnl_data_type_t q_dt() const { return dt[0]; }
+    dnnl_data_type_t k_dt() const { return dt[1]; }
+    dnnl_data_type_t v_dt() const { return dt[2]; }
+    dnnl_data_type_t dst_dt() const { return dt[3]; }
+
+    bool with_mask_buffer() const {
+        return mask == BUFFER_1D || mask == BUFFER_2D;
+    }
+    bool with_causal_mask() const {
+        return mask == CAUSAL_TL || mask == CAUSAL_BR;
+    }
+    bool with_kv_quant() const {
+        return !k_scales.is_def() || !v_scales.is_def() || !k_zp.is_def()
+                || !v_zp.is_def();
+    }
+
+    dims_t q_dims() const { return {mb, h, sq, d}; }
+    dims_t k_dims() const { return {mb, kvh, d, skv}; }
+    dims_t v_dims() const { return {mb, kvh, skv, d}; }
+    dims_t dst_dims() const { return {mb, h, sq, d}; }
+    dims_t msk_dims() const {
+        return {1, 1, mask == BUFFER_2D ? sq : 1, skv};
+    }
+
+    // Returns a mask of dimensions the quantization parameters of keys or
+    // values vary along.
+    int get_quant_mask(policy_t policy, bool is_keys) const;
+    // Returns dimensions of the keys or values quantization tensor.
+    dims_t get_quant_dims(policy_t policy, const std::vector<int64_t> &groups,
+            bool is_keys) const;
+
+    // Used to construct memory desc when dimensions are runtime since such
+    // mds can't be used directly from query and memory objects can't be
+    // constructed.
+    benchdnn_dnnl_wrapper_t<dnnl_memory_desc_t> get_md(int arg) const {
+        assert(!"No runtime dimensions support for this driver!");
+        return make_benchdnn_dnnl_wrapper<dnnl_memory_desc_t>(nullptr);
+    }
+
+    const char *str() const { return repro.c_str(); }
+
+private:
+    std::string repro;
+
+    std::string set_repro_line();
+};
+
+struct perf_report_t : public base_perf_report_t {
+    perf_report_t(const prb_t *prb, const char *perf_template)
+        : base_perf_report_t(perf_template)
+        , p_(prb)
+        , sdt_({p_->q_dt(), p_->k_dt(), p_->v_dt()}) {}
+
+    void dump_alg(std::ostream &s) const override { s << mask2str(p_->mask); }
+
+    void dump_desc(std::ostream &s) const override {
+        s << static_cast<const desc_t &>(*p_);
+    }
+
+    void dump_desc_csv(std::ostream &s) const override {
+        s << p_->mb << ',' << p_->h << ',' << p_->kvh << ',' << p_->sq << ','
+          << p_->skv << ',' << p_->d;
+    }
+
+    double ops() const override { return p_->ops; }
+    const int64_t *user_mb() const override { return &p_->user_mb; }
+    const attr_t *attr() const override { return &p_->attr; }
+    const thr_ctx_t *ctx_init() const override { return &p_->ctx_init; }
+    const thr_ctx_t *ctx_exe() const override { return &p_->ctx_exe; }
+    const std::string *name() const override { return &p_->name; }
+    const dir_t *dir() const override { return &p_->dir; }
+    const std::vector<dnnl_data_type_t> *sdt() const override { return &sdt_; }
+    const dnnl_data_type_t *ddt() const override { return &p_->dt[3]; }
+
+private:
+    const prb_t *p_;
+    std::vector<dnnl_data_type_t> sdt_;
+};
+
+dnnl_status_t init_pd(init_pd_args_t<prb_t> &init_pd_args);
+void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
+        const args_t &ref_args);
+std::vector<int> supported_exec_args(dir_t dir);
+int init_ref_memory_args(dnn_mem_map_t &ref_mem_map, dnn_mem_map_t &mem_map,
+        dnnl_primitive_t prim, const prb_t *prb, res_t *res,
+        dnnl_primitive_t prim_ref = nullptr);
+
+void skip_unimplemented_prb(const prb_t *prb, res_t *res);
+void skip_invalid_prb(const prb_t *prb, res_t *res);
+void compute_ref(const prb_t *prb, dir_t dir, const args_t &args,
+        dnnl_primitive_t prim_ref = nullptr);
+
+int createit(std::vector<benchdnn_dnnl_wrapper_t<dnnl_primitive_t>> &v_prim,
+        const prb_t *prb, res_t *res);
+int checkit(std::vector<benchdnn_dnnl_wrapper_t<dnnl_primitive_t>> &v_prim,
+        const prb_t *prb, res_t *res);
+int doit(const std::vector<benchdnn_dnnl_wrapper_t<dnnl_primitive_t>> &v_prim,
+        const prb_t *prb, res_t *res);
+int bench(int argc, char **argv);
+
+} // namespace sdpa
+
+#endif
@@ -0,0 +1,245 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <sstream>
+
+#include <assert.h>
+#include <stdlib.h>
+
+#include "dnnl_common.hpp"
+#include "dnnl_debug.hpp"
+
+#include "sdpa/sdpa.hpp"
+
+namespace sdpa {
+
+mask_t str2mask(const char *str) {
+#define CASE(_mask) \
+    if (!strcasecmp(STRINGIFY(_mask), str)) return _mask
+    CASE(NONE);
+    CASE(BUFFER_1D);
+    CASE(BUFFER_2D);
+    CASE(CAUSAL_TL);
+    CASE(CAUSAL_BR);
+#undef CASE
+    BENCHDNN_PRINT(0, "Error: mask value \'%s\' is not recognized.\n", str);
+    SAFE_V(FAIL);
+    return NONE;
+}
+
+const char *mask2str(mask_t mask) {
+    if (mask == NONE) return "NONE";
+    if (mask == BUFFER_1D) return "BUFFER_1D";
+    if (mask == BUFFER_2D) return "BUFFER_2D";
+    if (mask == CAUSAL_TL) return "CAUSAL_TL";
+    if (mask == CAUSAL_BR) return "CAUSAL_BR";
+    assert(!"unknown mask");
+    return "unknown mask";
+}
+
+scale_t str2scale(const char *str) {
+    if (!strcasecmp("none", str)) return SCALE_NONE;
+    if (!strcasecmp("mul", str)) return SCALE_MUL;
+    if (!strcasecmp("div", str)) return SCALE_DIV;
+    BENCHDNN_PRINT(0, "Error: scale value \'%s\' is not recognized.\n", str);
+    SAFE_V(FAIL);
+    return SCALE_NONE;
+}
+
+const char *scale2str(scale_t scale) {
+    if (scale == SCALE_NONE) return "none";
+    if (scale == SCALE_MUL) return "mul";
+    if (scale == SCALE_DIV) return "div";
+    assert(!"unknown scale");
+    return "unknown scale";
+}
+
+int str2desc(desc_t *desc, const char *str) {
+    // Canonical form: mbXhXkvhXsqXskvXdX_nS,
+    // where
+    //     X is integer
+    //     S is string
+    // note: symbol `_` is ignored.
+    // `kvh` defaults to `h`, `skv` defaults to `sq`.
+
+    desc_t d {0};
+    d.mb = 1;
+
+    const char *s = str;
+    assert(s);
+
+    auto mstrtoll = [](const char *nptr, char **endptr) {
+        return strtoll(nptr, endptr, 10);
+    };
+
+#define CASE_NN(prb, c) \
+    do { \
+        if (!strncmp(prb, s, strlen(prb))) { \
+            ok = 1; \
+            s += strlen(prb); \
+            char *end_s; \
+            d.c = mstrtoll(s, &end_s); \
+            if (end_s == s) { \
+                BENCHDNN_PRINT(0, \
+                        "ERROR: No value found for `%s` setting. Full " \
+                        "descriptor input: `%s`.\n", \
+                        prb, str); \
+                return FAIL; \
+            } \
+            s += (end_s - s); \
+            if (d.c < 0) { \
+                BENCHDNN_PRINT(0, \
+                        "ERROR: `%s` must be positive. Full descriptor " \
+                        "input: `%s`.\n", \
+                        prb, str); \
+                return FAIL; \
+            } \
+        } \
+    } while (0)
+#define CASE_N(c) CASE_NN(#c, c)
+    while (*s) {
+        int ok = 0;
+        CASE_N(mb);
+        CASE_N(kvh);
+        CASE_N(h);
+        CASE_N(skv);
+        CASE_N(sq);
+        CASE_N(d);
+        if (*s == 'n') {
+            d.name = s + 1;
+            break;
+        }
+        if (*s == '_') ++s;
+        if (!ok) {
+            BENCHDNN_PRINT(0,
+                    "ERROR: Unrecognized pattern in `%s` descriptor starting "
+                    "from `%s` entry.\n",
+                    str, s);
+            return FAIL;
+        }
+    }
+#undef CASE_NN
+#undef CASE_N
+
+#define CHECK_SET_OR_ZERO_VAL(val_str, val) \
+    if ((val) <= 0) { \
+        assert((val_str)[0] == 'd' && (val_str)[1] == '.'); \
+        const char *val_str__ = &(val_str)[2]; \
+        BENCHDNN_PRINT(0, \
+                "ERROR: setting `%s` was not specified or set to 0. Full " \
+                "descriptor input: `%s`.\n", \
+                val_str__, str); \
+        return FAIL; \
+    }
+
+#define CHECK_SET_OR_ZERO(val) CHECK_SET_OR_ZERO_VAL(#val, val)
+
+    CHECK_SET_OR_ZERO(d.h);
+    CHECK_SET_OR_ZERO(d.sq);
+    CHECK_SET_OR_ZERO(d.d);
+
+#undef CHECK_SET_OR_ZERO
+#undef CHECK_SET_OR_ZERO_VAL
+
+    if (d.kvh == 0) d.kvh = d.h;
+    if (d.skv == 0) d.skv = d.sq;
+
+    *desc = d;
+
+    return OK;
+}
+
+std::ostream &operator<<(std::ostream &s, const desc_t &d) {
+    if (canonical || d.mb != 1) s << "mb" << d.mb;
+
+    s << "h" << d.h;
+    if (canonical || d.kvh != d.h) s << "kvh" << d.kvh;
+    s << "sq" << d.sq;
+    if (canonical || d.skv != d.sq) s << "skv" << d.skv;
+    s << "d" << d.d;
+
+    if (!d.name.empty()) s << "n" << d.name;
+
+    return s;
+}
+
+int prb_t::get_quant_mask(policy_t policy, bool is_keys) const {
+    // Keys are `mb x kvh x d x skv` and values are `mb x kvh x skv x d`, a
+    // token is a point along `skv`.
+    switch (policy) {
+        case policy_t::COMMON: return 0;
+        case policy_t::PER_DIM_0: return 1 << 0;
+        case policy_t::PER_DIM_01: return (1 << 0) + (1 << 1);
+        case policy_t::PER_OC:
+            return is_keys ? (1 << 0) + (1 << 1) + (1 << 3)
+                           : (1 << 0) + (1 << 1) + (1 << 2);
+        case policy_t::PER_TENSOR: return (1 << 4) - 1;
+        default: assert(!"unsupported policy"); return 0;
+    }
+}
+
+dims_t prb_t::get_quant_dims(policy_t policy,
+        const std::vector<int64_t> &groups, bool is_keys) const {
+    const dims_t dims = is_keys ? k_dims() : v_dims();
+    const int mask = get_quant_mask(policy, is_keys);
+
+    dims_t quant_dims(dims.size(), 1);
+    for (size_t i = 0; i < dims.size(); i++) {
+        if (!(mask & (1 << i))) continue;
+        // Groups apply to the two innermost dimensions.
+        const bool has_group = !groups.empty() && i >= dims.size() - 2;
+        quant_dims[i] = has_group ? dims[i] / groups[i - (dims.size() - 2)]
+                                  : dims[i];
+    }
+    return quant_dims;
+}
+
+std::string prb_t::set_repro_line() {
+    dnnl::impl::stringstream_t s;
+    dump_global_params(s);
+    settings_t def;
+
+    bool has_default_dts = true;
+    for (const auto &i_dt : dt)
+        has_default_dts = has_default_dts && i_dt == dnnl_f32;
+
+    if (canonical || !has_default_dts) s << "--dt=" << dt << " ";
+    if (canonical || ktag != def.ktag[0]) s << "--ktag=" << ktag << " ";
+    if (canonical || mask != def.mask[0])
+        s << "--mask=" << mask2str(mask) << " ";
+    if (canonical || (with_mask_buffer() && mskdt != def.mskdt[0]))
+        s << "--mskdt=" << mskdt << " ";
+    if (canonical || scale != def.scale[0])
+        s << "--scale=" << scale2str(scale) << " ";
+    if (canonical || !k_scales.is_def()) s << "--k-scales=" << k_scales << " ";
+    if (canonical || !v_scales.is_def()) s << "--v-scales=" << v_scales << " ";
+    if (canonical || !k_zp.is_def()) s << "--k-zp=" << k_zp << " ";
+    if (canonical || !v_zp.is_def()) s << "--v-zp=" << v_zp << " ";
+
+    s << attr;
+    if (canonical || ctx_init != def.ctx_init[0])
+        s << "--ctx-init=" << ctx_init << " ";
+    if (canonical || ctx_exe != def.ctx_exe[0])
+        s << "--ctx-exe=" << ctx_exe << " ";
+    if (canonical || !impl_filter.is_def() || !global_impl_filter.is_def())
+        s << impl_filter;
+
+    s << static_cast<const desc_t &>(*this);
+
+    return s.str();
+}
+
+} // namespace sdpa
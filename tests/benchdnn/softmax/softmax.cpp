@@ -279,7 +279,18 @@ void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
     const bool is_relaxed_xf16
             = !is_strict_acc && (trh_dt == dnnl_f16 || trh_dt == dnnl_bf16);
     // Relaxed xf16 computation can get an ulp difference with f32 ref values.
-    const float trh = is_flt_or_dbl || is_relaxed_xf16 ? trh_f32 : 0.f;
+    // fp8 rounding of the same f32 value can differ by an ulp as well.
+    const bool is_f8 = trh_dt == dnnl_f8_e5m2 || trh_dt == dnnl_f8_e4m3;
+    float trh = is_flt_or_dbl || is_relaxed_xf16 || is_f8 ? trh_f32 : 0.f;
+    // Non-strict fpmath mode allows exponent approximations accurate up to the
+    // data type it allows down-conversion to.
+    const auto fpmath_mode = prb->attr.fpmath_mode.mode;
+    if (fpmath_mode != dnnl_fpmath_mode_strict) {
+        const bool is_f16_math = fpmath_mode == dnnl_fpmath_mode_f16
+                || fpmath_mode == dnnl_fpmath_mode_tf32;
+        trh = MAX2(trh, trh_coeff_log * trh_coeff_bwd
+                        * epsilon_dt(is_f16_math ? dnnl_f16 : dnnl_bf16));
+    }
 #endif
     cmp.set_threshold(trh);
     if (driver_name == "graph" && kind == DST_1) {
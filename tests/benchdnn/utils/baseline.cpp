@@ -0,0 +1,219 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <vector>
+
+#include "common.hpp"
+
+#include "utils/baseline.hpp"
+#include "utils/timer.hpp"
+
+std::string baseline_dump_file;
+std::string baseline_compare_file;
+const double default_baseline_threshold = 5.;
+double baseline_threshold = default_baseline_threshold;
+
+namespace baseline_utils {
+const std::string header = "# benchdnn baseline v1";
+
+// Running statistics merged with Chan's parallel algorithm to combine several
+// runs of the same problem without keeping all samples.
+struct entry_t {
+    int64_t n = 0;
+    double mean = 0, m2 = 0, min = 0;
+    std::string impl;
+
+    double stddev() const { return n > 1 ? std::sqrt(m2 / (n - 1)) : 0; }
+
+    void merge(const entry_t &other) {
+        if (other.n == 0) return;
+        if (n == 0) {
+            *this = other;
+            return;
+        }
+        const double delta = other.mean - mean;
+        const int64_t n_new = n + other.n;
+        mean += delta * other.n / n_new;
+        m2 += other.m2 + delta * delta * n * other.n / n_new;
+        min = MIN2(min, other.min);
+        n = n_new;
+        impl = other.impl;
+    }
+};
+
+// The key is a problem in REPRO style.
+std::map<std::string, entry_t> &get_collected() {
+    static std::map<std::string, entry_t> collected;
+    return collected;
+}
+
+bool read_baseline(
+        const std::string &file, std::map<std::string, entry_t> &entries) {
+    std::ifstream f(file);
+    if (!f.is_open()) return false;
+
+    std::string line;
+    if (!std::getline(f, line) || line != header) return false;
+
+    while (std::getline(f, line)) {
+        if (line.empty()) continue;
+        std::vector<std::string> fields;
+        size_t pos = 0;
+        for (int i = 0; i < 5 && pos != std::string::npos; i++) {
+            const size_t end = line.find('\t', pos);
+            if (end == std::string::npos) return false;
+            fields.push_back(line.substr(pos, end - pos));
+            pos = end + 1;
+        }
+        entry_t e;
+        e.n = std::stoll(fields[0]);
+        e.mean = std::stod(fields[1]);
+        e.m2 = std::pow(std::stod(fields[2]), 2) * MAX2(e.n - 1, int64_t(0));
+        e.min = std::stod(fields[3]);
+        e.impl = fields[4];
+        entries[line.substr(pos)] = e;
+    }
+    return true;
+}
+
+int write_baseline(
+        const std::string &file, const std::map<std::string, entry_t> &entries) {
+    std::ofstream f(file);
+    if (!f.is_open()) {
+        BENCHDNN_PRINT(0, "Error: can't open baseline file \'%s\'.\n",
+                file.c_str());
+        return FAIL;
+    }
+
+    f << header << "\n";
+    f.precision(9);
+    for (const auto &kv : entries) {
+        const auto &e = kv.second;
+        f << e.n << "\t" << e.mean << "\t" << e.stddev() << "\t" << e.min
+          << "\t" << e.impl << "\t" << kv.first << "\n";
+    }
+    return f.good() ? OK : FAIL;
+}
+
+// Returns `true` if the mean of `cur` is greater than the mean of `base` with
+// 95% confidence according to one-sided Welch's t-test. The critical value
+// uses a Cornish-Fisher approximation of Student's t distribution.
+bool is_significantly_slower(const entry_t &base, const entry_t &cur) {
+    // Not enough samples to estimate variance, rely on the threshold only.
+    if (base.n < 2 || cur.n < 2) return true;
+
+    const double vb = base.m2 / (base.n - 1) / base.n;
+    const double vc = cur.m2 / (cur.n - 1) / cur.n;
+    const double v = vb + vc;
+    if (v == 0) return cur.mean > base.mean;
+
+    const double t = (cur.mean - base.mean) / std::sqrt(v);
+    // Welch-Satterthwaite degrees of freedom.
+    const double df = v * v
+            / (vb * vb / (base.n - 1) + vc * vc / (cur.n - 1));
+    const double z = 1.6449; // 95% quantile of normal distribution.
+    const double t_crit = z + (z * z * z + z) / (4 * df);
+    return t > t_crit;
+}
+} // namespace baseline_utils
+
+bool is_baseline_enabled() {
+    return !baseline_dump_file.empty() || !baseline_compare_file.empty();
+}
+
+void baseline_add(const std::string &prb_str, const std::string &impl_name,
+        const timer::timer_t &t) {
+    if (!is_baseline_enabled()) return;
+
+    const auto &samples = t.samples();
+    if (samples.empty()) return;
+
+    baseline_utils::entry_t e;
+    e.impl = impl_name;
+    e.min = samples[0];
+    for (const auto &s : samples) {
+        e.n++;
+        const double delta = s - e.mean;
+        e.mean += delta / e.n;
+        e.m2 += delta * (s - e.mean);
+        e.min = MIN2(e.min, s);
+    }
+    baseline_utils::get_collected()[prb_str].merge(e);
+}
+
+int baseline_finalize() {
+    using namespace baseline_utils;
+    if (!is_baseline_enabled()) return 0;
+
+    const auto &collected = get_collected();
+
+    if (!baseline_dump_file.empty()) {
+        if (write_baseline(baseline_dump_file, collected) == OK) {
+            printf("Baseline with %d problems was written to \'%s\'.\n",
+                    static_cast<int>(collected.size()),
+                    baseline_dump_file.c_str());
+        }
+    }
+
+    if (baseline_compare_file.empty()) return 0;
+
+    std::map<std::string, entry_t> reference;
+    if (!read_baseline(baseline_compare_file, reference)) {
+        BENCHDNN_PRINT(0, "Error: can't read baseline file \'%s\'.\n",
+                baseline_compare_file.c_str());
+        return 0;
+    }
+
+    int compared = 0, regressed = 0, improved = 0, missing = 0;
+    printf("===========================================================\n");
+    printf("= Baseline comparison (threshold: %g%%)\n", baseline_threshold);
+    printf("===========================================================\n");
+    for (const auto &kv : collected) {
+        const auto it = reference.find(kv.first);
+        if (it == reference.end()) {
+            missing++;
+            continue;
+        }
+        compared++;
+
+        const auto &base = it->second;
+        const auto &cur = kv.second;
+        if (base.mean <= 0) continue;
+        const double diff = 100. * (cur.mean - base.mean) / base.mean;
+
+        if (diff > baseline_threshold && is_significantly_slower(base, cur)) {
+            regressed++;
+            std::string impl_change;
+            if (base.impl != cur.impl)
+                impl_change = " (impl:" + base.impl + "->" + cur.impl + ")";
+            printf("REGRESSED: %+.1f%% (base:%g ms cur:%g ms)%s __REPRO: "
+                   "%s\n",
+                    diff, base.mean, cur.mean, impl_change.c_str(),
+                    kv.first.c_str());
+        } else if (-diff > baseline_threshold
+                && is_significantly_slower(cur, base)) {
+            improved++;
+        }
+    }
+    printf("baseline: compared:%d regressed:%d improved:%d missing:%d\n",
+            compared, regressed, improved, missing);
+    printf("============================\n");
+
+    return regressed;
+}
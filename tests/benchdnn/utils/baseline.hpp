@@ -0,0 +1,55 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef UTILS_BASELINE_HPP
+#define UTILS_BASELINE_HPP
+
+#include <string>
+
+namespace timer {
+struct timer_t;
+}
+
+// Performance baseline of a run. Execution times of every problem are
+// collected in performance mode and either written into a file or compared
+// against the one written by a previous run.
+//
+// The file is a text file with a header line and a line per problem with
+// tab-separated values: number of samples, mean, standard deviation and
+// minimum time in milliseconds, implementation name and a problem in REPRO
+// style. Problems run several times, e.g., with `--repeats-per-prb`, are
+// merged into a single entry.
+
+// A file to write the baseline into, specified by `--baseline-dump`.
+extern std::string baseline_dump_file;
+// A file to compare the run against, specified by `--baseline-compare`.
+extern std::string baseline_compare_file;
+// A relative increase of the mean time in percent to consider a problem
+// regressed, specified by `--baseline-threshold`.
+extern double baseline_threshold;
+extern const double default_baseline_threshold;
+
+bool is_baseline_enabled();
+
+// Accumulates execution times of the problem `prb_str`.
+void baseline_add(const std::string &prb_str, const std::string &impl_name,
+        const timer::timer_t &t);
+
+// Writes the collected baseline or compares it against the reference one and
+// prints a report. Returns the number of regressed problems.
+int baseline_finalize();
+
+#endif
@@ -174,12 +174,17 @@ int fill_scales(const attr_t::arg_scales_t::entry_t &e, dnn_mem_t &mem_dt,
 
 int fill_zero_points(
         const attr_t &attr, int arg, dnn_mem_t &mem_dt, dnn_mem_t &mem_fp) {
+    const auto &e = attr.zero_points.get(arg);
+    return fill_zero_points(e, mem_dt, mem_fp);
+}
+
+int fill_zero_points(const attr_t::zero_points_t::entry_t &e,
+        dnn_mem_t &mem_dt, dnn_mem_t &mem_fp) {
     const auto nelems = mem_fp.nelems();
     if (nelems == 0) return OK;
 
     assert(mem_dt.nelems() == mem_fp.nelems());
 
-    const auto &e = attr.zero_points.get(arg);
     if (e.policy == policy_t::COMMON) {
         assert(nelems == 1);
         mem_fp.set_f32_elem(0, e.value);
@@ -17,8 +17,11 @@
 #include <algorithm>
 #include <cctype>
 
+#include "utils/baseline.hpp"
 #include "utils/cold_cache.hpp"
 #include "utils/parser.hpp"
+#include "utils/perf_counters.hpp"
+#include "utils/roofline.hpp"
 #include "utils/stream_kind.hpp"
 
 #include "dnnl_common.hpp"
@@ -495,6 +498,12 @@ summary_t parse_summary_str(const std::string &s) {
         auto option = parser::get_substr(subs, subs_pos, '\0');
         if (option == "failures") {
             v.failed_cases = !negate_option;
+        } else if (option == "latency") {
+            v.latency = !negate_option;
+        } else if (option == "histogram") {
+            v.histogram = !negate_option;
+        } else if (option == "create") {
+            v.create = !negate_option;
         } else {
             BENCHDNN_PRINT(0,
                     "Error: unsupported option-value combination "
@@ -580,6 +589,62 @@ cold_cache_input_t str2cold_cache_input(const std::string &s) {
     return c;
 }
 
+std::vector<std::string> str2perf_counters_input(const std::string &s) {
+    // Allowed input: EVENT[+EVENT[+...]]
+    std::vector<std::string> v;
+
+    size_t start_pos = 0;
+    while (start_pos != std::string::npos) {
+        std::string event = get_substr(s, start_pos, '+');
+        if (!is_perf_counter_name_valid(event)) {
+            BENCHDNN_PRINT(0,
+                    "Error: unknown hardware counter \'%s\'. Supported values "
+                    "are \'cycles\', \'instructions\', \'llc-misses\', "
+                    "\'dtlb-misses\', \'membw\', \'energy\', or "
+                    "\'rXXXX\'.\n",
+                    event.c_str());
+            SAFE_V(FAIL);
+        }
+        v.push_back(std::move(event));
+    }
+
+    return v;
+}
+
+std::map<std::string, double> str2peak_gflops_input(const std::string &s) {
+    // Allowed input: [DT:]GFLOPS[+DT:GFLOPS[+...]]
+    std::map<std::string, double> m;
+
+    size_t start_pos = 0;
+    while (start_pos != std::string::npos) {
+        const std::string entry = get_substr(s, start_pos, '+');
+        const size_t colon_pos = entry.find(':');
+        std::string dt_str;
+        if (colon_pos != std::string::npos) {
+            dt_str = entry.substr(0, colon_pos);
+            if (str2dt(dt_str.c_str()) == dnnl_data_type_undef) {
+                BENCHDNN_PRINT(0, "Error: unknown data type \'%s\'.\n",
+                        dt_str.c_str());
+                SAFE_V(FAIL);
+            }
+        }
+        const std::string val_str = colon_pos == std::string::npos
+                ? entry
+                : entry.substr(colon_pos + 1);
+        const float val = stof_safe(val_str);
+        if (val <= 0) {
+            BENCHDNN_PRINT(0,
+                    "Error: peak GFLOPs should be positive, but \'%s\' was "
+                    "specified.\n",
+                    val_str.c_str());
+            SAFE_V(FAIL);
+        }
+        m[dt_str] = val;
+    }
+
+    return m;
+}
+
 } // namespace parser_utils
 
 // vector types
@@ -990,8 +1055,8 @@ bool parse_main_help(
               "bnorm\n    * concat\n    * conv\n    * deconv\n    * eltwise\n  "
               "  * ip\n    * lnorm\n    * lrn\n    * matmul\n    * pool\n    * "
               "prelu\n    * reduction\n    * reorder\n    * resampling\n    * "
-              "rnn\n    * shuffle\n    * softmax\n    * sum\n    * "
-              "zeropad\n\nFor global and specific driver options, use:\n    "
+              "rnn\n    * sdpa\n    * shuffle\n    * softmax\n    * sum\n  "
+              "  * zeropad\n\nFor global and specific driver options, use:\n    "
               "benchdnn --<driver> --help\n\nMore details at "
             + benchdnn_url + "\n";
 
@@ -1070,6 +1135,45 @@ static bool parse_attr_same_pd_check(const char *str,
             attr_same_pd_check, false, str2bool, str, option_name, help);
 }
 
+static bool parse_baseline_compare(
+        const char *str, const std::string &option_name = "baseline-compare") {
+    static const std::string help
+            = "FILE    (Default: not specified)\n    Instructs the driver to "
+              "compare execution times against the baseline `FILE` written "
+              "by `--baseline-dump` at the end of the run.\n    Problems "
+              "slower than the baseline by more than `--baseline-threshold` "
+              "with statistical significance are reported as regressed and "
+              "make the run return an error.\n    Works in performance mode "
+              "only.\n";
+    return parse_single_value_option(baseline_compare_file, std::string(),
+            [](const std::string &s) { return s; }, str, option_name, help);
+}
+
+static bool parse_baseline_dump(
+        const char *str, const std::string &option_name = "baseline-dump") {
+    static const std::string help
+            = "FILE    (Default: not specified)\n    Instructs the driver to "
+              "write execution time statistics of every problem into the "
+              "baseline `FILE` at the end of the run.\n    Works in "
+              "performance mode only.\n";
+    return parse_single_value_option(baseline_dump_file, std::string(),
+            [](const std::string &s) { return s; }, str, option_name, help);
+}
+
+static bool parse_baseline_threshold(const char *str,
+        const std::string &option_name = "baseline-threshold") {
+    static const std::string help
+            = "PERCENT    (Default: `5`)\n    Specifies a relative increase "
+              "of the mean execution time in percent to consider a problem "
+              "regressed by `--baseline-compare`.\n";
+    return parse_single_value_option(baseline_threshold,
+            default_baseline_threshold,
+            [](const std::string &s) {
+                return static_cast<double>(parser_utils::stof_safe(s));
+            },
+            str, option_name, help);
+}
+
 static bool parse_canonical(
         const char *str, const std::string &option_name = "canonical") {
     static const std::string help
@@ -1092,6 +1196,30 @@ static bool parse_check_ref_impl(
             check_ref_impl, false, str2bool, str, option_name, help);
 }
 
+static bool parse_cold_create(
+        const char *str, const std::string &option_name = "cold-create") {
+    static const std::string help
+            = "BOOL    (Default: `false`)\n    Instructs the driver to clear "
+              "the primitive cache before creating each problem.\n    When "
+              "set to `true`, the first creation of a problem always misses "
+              "the primitive cache, as in a newly started process, even if "
+              "the same problem was created before.\n";
+    return parse_single_value_option(
+            cold_create, false, str2bool, str, option_name, help);
+}
+
+static bool parse_warmup_stable(
+        const char *str, const std::string &option_name = "warmup-stable") {
+    static const std::string help
+            = "BOOL    (Default: `false`)\n    Instructs the driver to keep "
+              "executing a problem before performance measurements until "
+              "execution time stabilizes.\n    It lets the CPU settle on the "
+              "frequency corresponding to the instructions and the thermal "
+              "state of the workload, e.g., for AVX-512 or AMX kernels.\n";
+    return parse_single_value_option(
+            warmup_stable, false, str2bool, str, option_name, help);
+}
+
 static bool parse_cold_cache(
         const char *str, const std::string &option_name = "cold-cache") {
     static const std::string help
@@ -1114,6 +1242,60 @@ static bool parse_cold_cache(
             option_name, help);
 }
 
+static bool parse_perf_counters(
+        const char *str, const std::string &option_name = "perf-counters") {
+    static const std::string help
+            = "EVENT[+EVENT...]    (Default: `empty`)\n    Instructs the "
+              "driver to collect hardware counters during the performance "
+              "measurement loop on CPU and to expose them through "
+              "`%pmu:EVENT%` performance template fields.\n    Supported "
+              "`EVENT` values are `cycles`, `instructions`, `llc-misses`, "
+              "`dtlb-misses`, `membw` (bytes transferred by memory "
+              "controllers), `energy` (joules consumed by CPU packages) and "
+              "`rXXXX` (a raw event in hexadecimal encoding).\n";
+    return parse_single_value_option(perf_counters_input,
+            default_perf_counters_input(),
+            parser_utils::str2perf_counters_input, str, option_name, help);
+}
+
+static bool parse_peak_bw(
+        const char *str, const std::string &option_name = "peak-bw") {
+    static const std::string help
+            = "GBPS|measure    (Default: not specified)\n    Specifies the "
+              "machine peak memory bandwidth in GB/s for roofline reporting "
+              "through `%ai%`, `%roofline%` and `%bound%` performance "
+              "template fields.\n    `measure` value instructs the driver to "
+              "measure the bandwidth with a parallel copy of large buffers on "
+              "the first use.\n";
+    return parse_single_value_option(peak_bw_input, default_peak_bw_input,
+            [](const std::string &s) {
+                if (s == "measure") return -1.;
+                const double val = parser_utils::stof_safe(s);
+                if (val <= 0) {
+                    BENCHDNN_PRINT(0,
+                            "Error: peak bandwidth should be positive, but "
+                            "\'%s\' was specified.\n",
+                            s.c_str());
+                    SAFE_V(FAIL);
+                }
+                return val;
+            },
+            str, option_name, help);
+}
+
+static bool parse_peak_gflops(
+        const char *str, const std::string &option_name = "peak-gflops") {
+    static const std::string help
+            = "[DT:]GFLOPS[+DT:GFLOPS...]    (Default: not specified)\n    "
+              "Specifies the machine peak compute throughput in GFLOPs for "
+              "roofline reporting.\n    `DT` selects a data type the peak "
+              "applies to. A value without `DT` applies to all other data "
+              "types.\n";
+    return parse_single_value_option(peak_gflops_input,
+            default_peak_gflops_input(), parser_utils::str2peak_gflops_input,
+            str, option_name, help);
+}
+
 static bool parse_cpu_isa_hints(
         const char *str, const std::string &option_name = "cpu-isa-hints") {
     static const std::string help
@@ -1578,17 +1760,21 @@ bool parse_bench_settings(const char *str) {
     }
 
     bool parsed = parse_allow_enum_tags_only(str)
-            || parse_attr_same_pd_check(str) || parse_canonical(str)
-            || parse_check_ref_impl(str) || parse_cold_cache(str)
+            || parse_attr_same_pd_check(str) || parse_baseline_compare(str)
+            || parse_baseline_dump(str) || parse_baseline_threshold(str)
+            || parse_canonical(str) || parse_check_ref_impl(str)
+            || parse_cold_cache(str) || parse_cold_create(str)
             || parse_cpu_isa_hints(str) || parse_engine(str)
             || parse_fast_ref(str) || parse_fix_times_per_prb(str)
             || parse_global_impl(str) || parse_global_skip_impl(str)
             || parse_max_ms_per_prb(str) || parse_num_streams(str)
             || parse_repeats_per_prb(str) || parse_mem_check(str)
             || parse_memory_kind(str) || parse_mode(str)
-            || parse_mode_modifier(str) || parse_start(str)
-            || parse_stream_kind(str) || parse_summary(str)
-            || parse_verbose(str) || parse_execution_mode(str);
+            || parse_mode_modifier(str) || parse_peak_bw(str)
+            || parse_peak_gflops(str) || parse_perf_counters(str)
+            || parse_start(str) || parse_stream_kind(str)
+            || parse_summary(str) || parse_verbose(str)
+            || parse_warmup_stable(str) || parse_execution_mode(str);
 
     // Last condition makes this help message to be triggered once driver_name
     // is already known.
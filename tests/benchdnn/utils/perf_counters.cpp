@@ -0,0 +1,360 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <fstream>
+
+#include "common.hpp"
+
+#include "utils/perf_counters.hpp"
+
+#ifdef __linux__
+#include <dirent.h>
+#include <sched.h>
+#include <unistd.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+std::vector<std::string> perf_counters_input;
+
+const std::vector<std::string> &default_perf_counters_input() {
+    static const std::vector<std::string> perf_counters_input;
+    return perf_counters_input;
+}
+
+namespace perf_counters_utils {
+// Returns `true` and the encoding in `config` if `name` is a raw event.
+bool parse_raw_event(const std::string &name, uint64_t &config) {
+    if (name.size() < 2 || name[0] != 'r') return false;
+    char *end = nullptr;
+    config = strtoull(name.c_str() + 1, &end, 16);
+    return end && *end == '\0';
+}
+} // namespace perf_counters_utils
+
+bool is_perf_counter_name_valid(const std::string &name) {
+    uint64_t config = 0;
+    return name == "cycles" || name == "instructions" || name == "llc-misses"
+            || name == "dtlb-misses" || name == "membw" || name == "energy"
+            || perf_counters_utils::parse_raw_event(name, config);
+}
+
+#ifdef __linux__
+namespace perf_counters_utils {
+// A size of a memory controller transaction in bytes.
+constexpr double cas_bytes = 64.;
+
+int perf_event_open(perf_event_attr *attr, pid_t pid, int cpu) {
+    return static_cast<int>(
+            syscall(__NR_perf_event_open, attr, pid, cpu, -1, 0));
+}
+
+perf_event_attr make_attr(uint32_t type, uint64_t config) {
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_hv = 1;
+    // Counts are scaled by enabled/running times if events get multiplexed.
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED
+            | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return attr;
+}
+
+// Returns CPUs from a list in the `0,2-4` format.
+std::vector<int> parse_cpu_list(const std::string &str) {
+    std::vector<int> cpus;
+    const char *s = str.c_str();
+    while (*s) {
+        char *end = nullptr;
+        const int first = static_cast<int>(strtol(s, &end, 10));
+        if (end == s) break;
+        int last = first;
+        s = end;
+        if (*s == '-') {
+            last = static_cast<int>(strtol(s + 1, &end, 10));
+            s = end;
+        }
+        for (int c = first; c <= last; c++)
+            cpus.push_back(c);
+        if (*s == ',') s++;
+    }
+    return cpus;
+}
+
+std::vector<int> get_affinity_cpus() {
+    std::vector<int> cpus;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) != 0) return cpus;
+    for (int c = 0; c < CPU_SETSIZE; c++)
+        if (CPU_ISSET(c, &set)) cpus.push_back(c);
+    return cpus;
+}
+
+bool read_file(const std::string &path, std::string &str) {
+    std::ifstream f(path);
+    if (!f.is_open()) return false;
+    std::getline(f, str);
+    return true;
+}
+
+// Converts a sysfs event description, e.g. `event=0x04,umask=0x03`, into an
+// event config using the PMU format description, e.g. `config:8-15` for the
+// `umask` term.
+bool parse_sysfs_event(
+        const std::string &pmu_path, const std::string &str, uint64_t &config) {
+    config = 0;
+    size_t pos = 0;
+    while (pos < str.size()) {
+        size_t end = str.find(',', pos);
+        if (end == std::string::npos) end = str.size();
+        const std::string term = str.substr(pos, end - pos);
+        pos = end + 1;
+
+        const size_t eq = term.find('=');
+        const std::string key = term.substr(0, eq);
+        const uint64_t val = eq == std::string::npos
+                ? 1
+                : strtoull(term.c_str() + eq + 1, nullptr, 0);
+
+        std::string format;
+        if (!read_file(pmu_path + "/format/" + key, format)) return false;
+        static const std::string prefix = "config:";
+        if (format.compare(0, prefix.size(), prefix) != 0) return false;
+        const int shift = atoi(format.c_str() + prefix.size());
+        config |= val << shift;
+    }
+    return true;
+}
+
+double read_energy_uj(const std::string &path) {
+    std::string str;
+    if (!read_file(path + "/energy_uj", str)) return 0;
+    return strtod(str.c_str(), nullptr);
+}
+} // namespace perf_counters_utils
+
+perf_counters_t::perf_counters_t() {
+    using namespace perf_counters_utils;
+    if (perf_counters_input.empty()) return;
+
+    const auto cpus = get_affinity_cpus();
+    bool ok = true;
+
+    auto open_core_event = [&](event_t &e, uint32_t type, uint64_t config) {
+        auto attr = make_attr(type, config);
+        for (int cpu : cpus) {
+            const int fd = perf_event_open(&attr, -1, cpu);
+            if (fd < 0) return false;
+            e.fds.push_back(fd);
+        }
+        return true;
+    };
+
+    // Memory controllers are uncore PMUs, each one is opened once per socket
+    // on CPUs listed in its `cpumask`.
+    auto open_membw_event = [&](event_t &e) {
+        static const std::string devices = "/sys/bus/event_source/devices";
+        static const std::string imc_prefix = "uncore_imc_";
+        DIR *dir = opendir(devices.c_str());
+        if (!dir) return false;
+        while (const dirent *entry = readdir(dir)) {
+            const std::string pmu = entry->d_name;
+            if (pmu.compare(0, imc_prefix.size(), imc_prefix) != 0) continue;
+
+            const std::string pmu_path = devices + "/" + pmu;
+            std::string type_str, cpumask_str;
+            if (!read_file(pmu_path + "/type", type_str)
+                    || !read_file(pmu_path + "/cpumask", cpumask_str))
+                continue;
+            const auto type = static_cast<uint32_t>(atoi(type_str.c_str()));
+
+            for (const char *ev : {"cas_count_read", "cas_count_write"}) {
+                std::string ev_str;
+                uint64_t config = 0;
+                if (!read_file(pmu_path + "/events/" + ev, ev_str)
+                        || !parse_sysfs_event(pmu_path, ev_str, config))
+                    continue;
+                auto attr = make_attr(type, config);
+                for (int cpu : parse_cpu_list(cpumask_str)) {
+                    const int fd = perf_event_open(&attr, -1, cpu);
+                    if (fd < 0) {
+                        closedir(dir);
+                        return false;
+                    }
+                    e.fds.push_back(fd);
+                }
+            }
+        }
+        closedir(dir);
+        return !e.fds.empty();
+    };
+
+    // Package domains are top level `intel-rapl:N` zones, sub-zones such as
+    // `intel-rapl:N:M` are parts of a package and are skipped.
+    auto open_energy_event = [&]() {
+        static const std::string powercap = "/sys/class/powercap";
+        static const std::string rapl_prefix = "intel-rapl:";
+        DIR *dir = opendir(powercap.c_str());
+        if (!dir) return false;
+        while (const dirent *entry = readdir(dir)) {
+            const std::string zone = entry->d_name;
+            if (zone.compare(0, rapl_prefix.size(), rapl_prefix) != 0
+                    || zone.find(':', rapl_prefix.size()) != std::string::npos)
+                continue;
+            const std::string zone_path = powercap + "/" + zone;
+            std::string energy_str, max_str;
+            if (!read_file(zone_path + "/energy_uj", energy_str)
+                    || !read_file(
+                            zone_path + "/max_energy_range_uj", max_str))
+                continue;
+            rapl_domains_.push_back(
+                    {zone_path, strtod(max_str.c_str(), nullptr), 0, 0});
+        }
+        closedir(dir);
+        return !rapl_domains_.empty();
+    };
+
+    for (const auto &name : perf_counters_input) {
+        events_.push_back({name, {}, 1.});
+        auto &e = events_.back();
+        uint64_t config = 0;
+        if (name == "cycles") {
+            ok = open_core_event(
+                    e, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+        } else if (name == "instructions") {
+            ok = open_core_event(
+                    e, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+        } else if (name == "llc-misses") {
+            ok = open_core_event(
+                    e, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+        } else if (name == "dtlb-misses") {
+            ok = open_core_event(e, PERF_TYPE_HW_CACHE,
+                    PERF_COUNT_HW_CACHE_DTLB
+                            | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                            | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+        } else if (name == "membw") {
+            e.scale = cas_bytes;
+            ok = open_membw_event(e);
+        } else if (name == "energy") {
+            ok = open_energy_event();
+        } else if (parse_raw_event(name, config)) {
+            ok = open_core_event(e, PERF_TYPE_RAW, config);
+        } else {
+            ok = false;
+        }
+        if (!ok) break;
+    }
+
+    if (!ok) {
+        static bool warned = false;
+        if (!warned) {
+            BENCHDNN_PRINT(0,
+                    "Warning: hardware counter \'%s\' can't be opened. Check "
+                    "that `/proc/sys/kernel/perf_event_paranoid` is set to `0` "
+                    "or lower, or that powercap `energy_uj` files are readable "
+                    "for `energy`. Counters collection is disabled.\n",
+                    events_.back().name.c_str());
+            warned = true;
+        }
+        close_all();
+    }
+}
+
+perf_counters_t::~perf_counters_t() {
+    close_all();
+}
+
+void perf_counters_t::close_all() {
+    for (const auto &e : events_)
+        for (int fd : e.fds)
+            close(fd);
+    events_.clear();
+    rapl_domains_.clear();
+}
+
+void perf_counters_t::start() {
+    for (const auto &e : events_)
+        for (int fd : e.fds) {
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    for (auto &d : rapl_domains_)
+        d.start_uj = perf_counters_utils::read_energy_uj(d.path);
+}
+
+void perf_counters_t::stop() {
+    for (const auto &e : events_)
+        for (int fd : e.fds)
+            ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    for (auto &d : rapl_domains_)
+        d.stop_uj = perf_counters_utils::read_energy_uj(d.path);
+}
+
+void perf_counters_t::report(res_t *res, int times) const {
+    if (times <= 0) return;
+    for (const auto &e : events_) {
+        if (e.name == "energy") {
+            double uj = 0;
+            for (const auto &d : rapl_domains_) {
+                double diff = d.stop_uj - d.start_uj;
+                if (diff < 0) diff += d.max_uj;
+                uj += diff;
+            }
+            res->perf_counters[e.name] = uj / 1e6 / times;
+            continue;
+        }
+        double count = 0;
+        for (int fd : e.fds) {
+            // `value`, `time_enabled` and `time_running` as requested by the
+            // read format.
+            uint64_t data[3] = {0, 0, 0};
+            if (read(fd, data, sizeof(data)) != sizeof(data)) continue;
+            if (data[2] == 0) continue;
+            count += static_cast<double>(data[0]) * data[1] / data[2];
+        }
+        res->perf_counters[e.name] = count * e.scale / times;
+    }
+}
+
+#else
+
+perf_counters_t::perf_counters_t() {
+    if (perf_counters_input.empty()) return;
+    static bool warned = false;
+    if (!warned) {
+        BENCHDNN_PRINT(0, "%s\n",
+                "Warning: hardware counters are supported on Linux only. "
+                "Counters collection is disabled.");
+        warned = true;
+    }
+}
+
+perf_counters_t::~perf_counters_t() = default;
+void perf_counters_t::close_all() {}
+void perf_counters_t::start() {}
+void perf_counters_t::stop() {}
+void perf_counters_t::report(res_t *res, int times) const {}
+
+#endif
@@ -0,0 +1,85 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef UTILS_PERF_COUNTERS_HPP
+#define UTILS_PERF_COUNTERS_HPP
+
+#include <string>
+#include <vector>
+
+#include "utils/res.hpp"
+
+// Hardware events requested by the user through `--perf-counters`. Supported
+// names are:
+// * `cycles`, `instructions`, `llc-misses` and `dtlb-misses` for generic core
+//   events;
+// * `rXXXX` for a raw core event with a hexadecimal encoding, e.g., for AMX or
+//   FMA utilization events specific to a CPU model;
+// * `membw` for the number of bytes read and written by memory controllers
+//   (uncore IMC events);
+// * `energy` for the energy consumed by CPU packages in joules, read from RAPL
+//   counters of the Linux powercap interface.
+extern std::vector<std::string> perf_counters_input;
+
+const std::vector<std::string> &default_perf_counters_input();
+
+// Returns `true` if `name` is a supported event name.
+bool is_perf_counter_name_valid(const std::string &name);
+
+// Counts hardware events around the performance measurement loop with Linux
+// `perf_event_open` interface. Core events are opened per CPU available to the
+// process to collect counts from all threads of the library; this requires
+// `perf_event_paranoid` set to `0` or lower, or `CAP_PERFMON` capability.
+// When events can't be opened, a warning is printed and the object stays
+// disabled.
+struct perf_counters_t {
+    perf_counters_t();
+    ~perf_counters_t();
+
+    perf_counters_t(const perf_counters_t &) = delete;
+    perf_counters_t &operator=(const perf_counters_t &) = delete;
+
+    bool is_enabled() const { return !events_.empty(); }
+
+    void start();
+    void stop();
+
+    // Saves per-execution event counts into `res->perf_counters`.
+    void report(res_t *res, int times) const;
+
+private:
+    struct event_t {
+        std::string name;
+        std::vector<int> fds;
+        // Converts a raw count into reported units, e.g. bytes for `membw`.
+        double scale;
+    };
+    std::vector<event_t> events_;
+
+    // RAPL package domain of the powercap interface.
+    struct rapl_domain_t {
+        std::string path;
+        // The counter wraps around at this value.
+        double max_uj;
+        double start_uj;
+        double stop_uj;
+    };
+    std::vector<rapl_domain_t> rapl_domains_;
+
+    void close_all();
+};
+
+#endif
@@ -17,7 +17,9 @@
 #include "dnn_types.hpp"
 #include "dnnl_common.hpp"
 
+#include "utils/parallel.hpp"
 #include "utils/perf_report.hpp"
+#include "utils/roofline.hpp"
 
 void base_perf_report_t::report(res_t *res, const char *prb_str) const {
     dump_perf_footer();
@@ -81,6 +83,81 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
         return t.ticks(mode) / t.sec(mode) / unit;
     };
 
+    // Relative spread of execution times, in percent of the average time.
+    auto get_jitter = [&](const timer::timer_t &t) -> double {
+        if (!t.ms(timer::timer_t::avg)) return 0;
+        return 100. * t.stddev_ms() / t.ms(timer::timer_t::avg);
+    };
+
+    // Multi-threaded throughput scaling efficiency, in percent. Every thread
+    // performs the same amount of work as the single-thread run, thus, perfect
+    // scaling keeps the time unchanged.
+    auto get_scaling = [&]() -> double {
+        const auto &timers = res->timer_map.timers;
+        const auto it = timers.find(timer::names::perf_1thr_timer);
+        if (it == timers.end()) return 0;
+        const double t_nthr = res->timer_map.perf_timer().ms(mode);
+        if (!t_nthr) return 0;
+        return 100. * it->second.ms(mode) / t_nthr;
+    };
+
+    // Arithmetic intensity in operations per byte of inputs and outputs.
+    auto get_ai = [&]() -> double {
+        const double bytes = static_cast<double>(res->ibytes + res->obytes);
+        return bytes ? ops() / bytes : 0;
+    };
+
+    // Attainable GFLOPs by the roofline model: the minimum of the compute
+    // peak and the memory roof for the problem arithmetic intensity. Memory
+    // roof is used alone if the compute peak is not specified.
+    auto get_roof = [&](bool &memory_bound) -> double {
+        dnnl_data_type_t prb_dt = dnnl_data_type_undef;
+        if (dt())
+            prb_dt = *dt();
+        else if (sdt() && !sdt()->empty())
+            prb_dt = sdt()->front();
+        const double peak_gflops = get_peak_gflops(prb_dt);
+        const double memory_roof = get_ai() * get_peak_bw();
+        memory_bound = memory_roof
+                && (!peak_gflops || memory_roof < peak_gflops);
+        return memory_bound ? memory_roof : peak_gflops;
+    };
+
+    // Percentage of the roofline achieved by the problem.
+    auto get_roofline = [&]() -> double {
+        bool memory_bound = false;
+        const double roof = get_roof(memory_bound);
+        if (!roof) return 0;
+        return 100. * get_flops(res->timer_map.perf_timer()) * unit / 1e9
+                / roof;
+    };
+
+    // The roof limiting the problem: `compute`, `memory`, or `undef` if no
+    // peaks are specified.
+    auto get_bound = [&]() -> const char * {
+        bool memory_bound = false;
+        if (!get_roof(memory_bound)) return "undef";
+        return memory_bound ? "memory" : "compute";
+    };
+
+    // Operations per joule, or FLOPs per watt, when `energy` is collected.
+    auto get_flopsw = [&]() -> double {
+        const auto it = res->perf_counters.find("energy");
+        if (it == res->perf_counters.end() || !it->second) return 0;
+        return ops() / it->second / unit;
+    };
+
+    // Average effective frequency of threads executing the problem, when
+    // `cycles` are collected. Cycles are counted only while cores are not
+    // halted, thus, idle threads don't contribute.
+    auto get_efreq = [&]() -> double {
+        const auto it = res->perf_counters.find("cycles");
+        if (it == res->perf_counters.end()) return 0;
+        const double sec = res->timer_map.perf_timer().sec(timer::timer_t::avg);
+        if (!sec) return 0;
+        return it->second / sec / benchdnn_get_max_threads() / unit;
+    };
+
     auto get_create_time = [&](const timer::timer_t &t) -> double {
         // If user didn't ask for mode, choose the maximum one to return time
         // for no-cache-hit creation.
@@ -142,14 +219,46 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
     HANDLE("iobytes", s << (res->ibytes + res->obytes) / unit);
     HANDLE("idx", s << benchdnn_stat.tests);
     HANDLE("time", s << res->timer_map.perf_timer().ms(mode) / unit);
+    HANDLE("p50time",
+            s << res->timer_map.perf_timer().percentile_ms(50) / unit);
+    HANDLE("p90time",
+            s << res->timer_map.perf_timer().percentile_ms(90) / unit);
+    HANDLE("p99time",
+            s << res->timer_map.perf_timer().percentile_ms(99) / unit);
+    HANDLE("stdtime", s << res->timer_map.perf_timer().stddev_ms() / unit);
+    HANDLE("jitter", s << get_jitter(res->timer_map.perf_timer()));
+    HANDLE("scaling", s << get_scaling());
+    HANDLE("ai", s << get_ai());
+    HANDLE("roofline", s << get_roofline());
+    HANDLE("bound", s << get_bound());
+    HANDLE("flopsw", s << get_flopsw());
+    HANDLE("efreq", s << get_efreq());
     HANDLE("ctime",
             s << get_create_time(res->timer_map.cp_timer())
                             + get_create_time(res->timer_map.cpd_timer()));
     HANDLE("cptime", s << get_create_time(res->timer_map.cp_timer()));
     HANDLE("cpdtime", s << get_create_time(res->timer_map.cpd_timer()));
+    HANDLE("cpmisstime",
+            s << get_create_time(res->timer_map.cp_miss_timer()));
+    HANDLE("cphittime", s << get_create_time(res->timer_map.cp_hit_timer()));
+    HANDLE("cpblobtime",
+            s << get_create_time(res->timer_map.cp_blob_timer()));
 
 #undef HANDLE
 
+    // Hardware counters requested with `--perf-counters`: `%pmu:EVENT%`.
+    static const std::string pmu_prefix = "pmu:";
+    if (!strncmp(pmu_prefix.c_str(), option, pmu_prefix.size())) {
+        const char *end = strchr(option, '%');
+        if (end) {
+            const std::string event(option + pmu_prefix.size(), end);
+            const auto it = res->perf_counters.find(event);
+            if (it != res->perf_counters.end()) s << it->second / unit;
+            option = end + 1;
+            return;
+        }
+    }
+
     auto opt_name = std::string(option);
     opt_name.pop_back();
     BENCHDNN_PRINT(0, "Error: perf report option \"%s\" is not supported\n",
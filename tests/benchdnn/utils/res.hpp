@@ -22,6 +22,7 @@
 #include "utils/timer.hpp"
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 /* result structure */
@@ -109,6 +110,8 @@ struct res_t {
     // TODO: fuse `ibytes` and `obytes` into `mem_size_args`.
     size_t ibytes, obytes;
     check_mem_size_args_t mem_size_args;
+    // Hardware counters per execution, see `--perf-counters`.
+    std::unordered_map<std::string, double> perf_counters;
 };
 
 #endif
@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string.h>
+
+#include "common.hpp"
+#include "dnnl_common.hpp"
+
+#include "utils/parallel.hpp"
+#include "utils/roofline.hpp"
+#include "utils/timer.hpp"
+
+std::map<std::string, double> peak_gflops_input;
+const double default_peak_bw_input = 0.;
+double peak_bw_input = default_peak_bw_input;
+
+const std::map<std::string, double> &default_peak_gflops_input() {
+    static const std::map<std::string, double> peak_gflops_input;
+    return peak_gflops_input;
+}
+
+double get_peak_gflops(dnnl_data_type_t dt) {
+    auto it = peak_gflops_input.find(dt2str(dt));
+    if (it == peak_gflops_input.end()) it = peak_gflops_input.find("");
+    return it == peak_gflops_input.end() ? 0. : it->second;
+}
+
+namespace roofline_utils {
+// Copies a buffer several times larger than the last level cache of a modern
+// CPU in parallel and returns the best observed bandwidth in GB/s, counting
+// both read and written bytes.
+double measure_peak_bw() {
+    const size_t size = 512 * 1024 * 1024;
+    const int n_times = 5;
+    char *src = (char *)zmalloc(size, 4096);
+    char *dst = (char *)zmalloc(size, 4096);
+    if (!src || !dst) {
+        zfree(src);
+        zfree(dst);
+        return 0.;
+    }
+
+    const int64_t chunk = 1024 * 1024;
+    const int64_t n_chunks = static_cast<int64_t>(size) / chunk;
+    // Touch the pages first to exclude page faults from the measurement.
+    benchdnn_parallel_nd(n_chunks, [&](int64_t i) {
+        memset(src + i * chunk, 1, chunk);
+        memset(dst + i * chunk, 0, chunk);
+    });
+
+    timer::timer_t t;
+    for (int i = 0; i < n_times; i++) {
+        t.start();
+        benchdnn_parallel_nd(n_chunks, [&](int64_t i) {
+            memcpy(dst + i * chunk, src + i * chunk, chunk);
+        });
+        t.stamp();
+    }
+    zfree(src);
+    zfree(dst);
+
+    const double sec = t.sec(timer::timer_t::min);
+    return sec ? 2. * size / sec / 1e9 : 0.;
+}
+} // namespace roofline_utils
+
+double get_peak_bw() {
+    if (peak_bw_input < 0) {
+        peak_bw_input = roofline_utils::measure_peak_bw();
+        BENCHDNN_PRINT(1, "[INFO] Measured peak memory bandwidth: %g GB/s\n",
+                peak_bw_input);
+    }
+    return peak_bw_input;
+}
@@ -0,0 +1,47 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef UTILS_ROOFLINE_HPP
+#define UTILS_ROOFLINE_HPP
+
+#include <map>
+#include <string>
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+// Machine peaks for roofline reporting.
+//
+// Peak compute throughput in GFLOPs per data type specified by
+// `--peak-gflops`. An entry with an empty key applies to data types without a
+// dedicated entry. Peaks depend on the ISA the library dispatches, thus, they
+// are expected to be provided for the machine and ISA hints of the run.
+extern std::map<std::string, double> peak_gflops_input;
+const std::map<std::string, double> &default_peak_gflops_input();
+
+// Peak memory bandwidth in GB/s specified by `--peak-bw`. `0` means not
+// specified, a negative value requests a measurement on the first use.
+extern double peak_bw_input;
+extern const double default_peak_bw_input;
+
+// Returns peak GFLOPs for a data type `dt` or `0` if not specified.
+double get_peak_gflops(dnnl_data_type_t dt);
+
+// Returns peak memory bandwidth in GB/s or `0` if not specified. A requested
+// measurement is performed once with a parallel copy of buffers larger than
+// the last level cache.
+double get_peak_bw();
+
+#endif
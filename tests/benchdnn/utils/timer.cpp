@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 
 #include "common.hpp"
 #include "utils/timer.hpp"
@@ -51,6 +52,7 @@ void timer_t::reset() {
     for (int i = 0; i < n_modes; ++i)
         ms_[i] = 0;
     ms_start_ = 0;
+    samples_.clear();
 
     start();
 }
@@ -86,12 +88,54 @@ void timer_t::stop(int add_times, int64_t add_ticks, double add_ms) {
             = times_ ? std::max(ticks_[mode_t::max], d_ticks) : d_ticks;
 
     times_ += add_times;
+    samples_.push_back(d_ms);
 }
 
 void timer_t::stamp(int add_times) {
     stop(add_times, ticks_now() - ticks_start_, ms_now() - ms_start_);
 }
 
+double timer_t::percentile_ms(double p) const {
+    if (samples_.empty()) return 0; // nothing to report
+
+    const size_t n = samples_.size();
+    const size_t rank = static_cast<size_t>(std::ceil(p / 100. * n));
+    const size_t idx = std::min(std::max(rank, size_t(1)), n) - 1;
+
+    std::vector<double> sorted(samples_);
+    std::nth_element(sorted.begin(), sorted.begin() + idx, sorted.end());
+    return sorted[idx];
+}
+
+double timer_t::stddev_ms() const {
+    const size_t n = samples_.size();
+    if (n < 2) return 0; // nothing to report
+
+    double mean = 0;
+    for (const auto &s : samples_)
+        mean += s;
+    mean /= n;
+
+    double var = 0;
+    for (const auto &s : samples_)
+        var += (s - mean) * (s - mean);
+    return std::sqrt(var / (n - 1));
+}
+
+std::vector<int64_t> timer_t::histogram(int n_bins) const {
+    std::vector<int64_t> bins(std::max(n_bins, 0), 0);
+    if (samples_.empty() || bins.empty()) return bins;
+
+    const auto minmax = std::minmax_element(samples_.begin(), samples_.end());
+    const double lo = *minmax.first;
+    const double width = (*minmax.second - lo) / n_bins;
+    for (const auto &s : samples_) {
+        const int bin = width > 0 ? static_cast<int>((s - lo) / width) : 0;
+        bins[std::min(bin, n_bins - 1)]++;
+    }
+    return bins;
+}
+
 timer_t &timer_t::operator=(const timer_t &rhs) {
     if (this == &rhs) return *this;
     *this = timer_t(rhs);
@@ -19,6 +19,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #define TIME_FUNC(func, res, name) \
     do { \
@@ -79,6 +80,20 @@ struct timer_t {
         return ticks_[mode] / (mode == avg ? times() : 1);
     }
 
+    // Latency distribution over recorded samples. A sample is a time of a
+    // single `stop` call divided by the number of times it accounts for, i.e.
+    // a batch of executions measured at once contributes a single sample.
+    //
+    // Returns the `p`-th percentile, `p` in [0, 100], by the nearest-rank
+    // method.
+    double percentile_ms(double p) const;
+    // Returns a sample standard deviation.
+    double stddev_ms() const;
+    // Returns the number of samples in each of `n_bins` equal-width bins
+    // between the minimum and the maximum samples.
+    std::vector<int64_t> histogram(int n_bins) const;
+    const std::vector<double> &samples() const { return samples_; }
+
     timer_t(const timer_t &rhs) = default;
     timer_t &operator=(const timer_t &rhs);
     timer_t &operator=(timer_t &&rhs) = default;
@@ -86,6 +101,7 @@ struct timer_t {
     int times_;
     uint64_t ticks_[n_modes], ticks_start_;
     double ms_[n_modes], ms_start_;
+    std::vector<double> samples_;
 };
 
 // Designated timers to support benchdnn performance reporting and general time
@@ -93,12 +109,19 @@ struct timer_t {
 namespace names {
 // Testing objects execution performance.
 const std::string perf_timer = "perf_timer";
+// Single-thread execution performance for multi-threaded throughput runs.
+const std::string perf_1thr_timer = "perf_1thr_timer";
 // Driver's reference computations.
 const std::string ref_timer = "compute_ref_timer";
 // Primitive descriptor creation performace.
 const std::string cpd_timer = "create_pd_timer";
 // Primitive creation performace.
 const std::string cp_timer = "create_prim_timer";
+// Primitive creation performance split by the primitive cache outcome.
+const std::string cp_miss_timer = "create_prim_miss_timer";
+const std::string cp_hit_timer = "create_prim_hit_timer";
+// Primitive creation from a cache blob performance.
+const std::string cp_blob_timer = "create_prim_blob_timer";
 // Driver's comparison.
 const std::string compare_timer = "compare_timer";
 // Driver's memory filling.
@@ -115,6 +138,9 @@ struct timer_map_t {
     timer_t &perf_timer() { return get_timer(names::perf_timer); }
     timer_t &cpd_timer() { return get_timer(names::cpd_timer); }
     timer_t &cp_timer() { return get_timer(names::cp_timer); }
+    timer_t &cp_miss_timer() { return get_timer(names::cp_miss_timer); }
+    timer_t &cp_hit_timer() { return get_timer(names::cp_hit_timer); }
+    timer_t &cp_blob_timer() { return get_timer(names::cp_blob_timer); }
 
     std::unordered_map<std::string, timer_t> timers;
 };
@@ -195,6 +195,49 @@ HANDLE_EXCEPTIONS_FOR_TEST_P(memory_map_test_cpp_t, Map) {
     mem.unmap_data(mapped_ptr);
 }
 
+HANDLE_EXCEPTIONS_FOR_TEST_P(memory_map_test_cpp_t, MapRange) {
+    auto engine_kind = static_cast<engine::kind>(GetParam());
+
+    SKIP_IF(engine::get_count(engine_kind) == 0,
+            "Engine kind is not supported");
+
+    engine eng(engine_kind, 0);
+
+    const dnnl::memory::dim N = 64;
+    memory::desc mem_d({N}, memory::data_type::f32, memory::format_tag::x);
+    auto mem = test::make_memory(mem_d, eng);
+
+    std::vector<float> buffer_ref(N);
+    std::iota(buffer_ref.begin(), buffer_ref.end(), 1);
+
+    float *mapped_ptr = mem.map_data<float>();
+    GTEST_EXPECT_NE(mapped_ptr, nullptr);
+    std::copy(buffer_ref.begin(), buffer_ref.end(), mapped_ptr);
+    mem.unmap_data(mapped_ptr);
+
+    // Modify a slice through a range mapping.
+    const size_t off = 16, len = 8;
+    float *range_ptr = mem.map_data_range<float>(
+            off * sizeof(float), len * sizeof(float));
+    GTEST_EXPECT_NE(range_ptr, nullptr);
+    for (size_t i = 0; i < len; i++) {
+        ASSERT_EQ(range_ptr[i], buffer_ref[off + i]);
+        range_ptr[i] = -range_ptr[i];
+        buffer_ref[off + i] = -buffer_ref[off + i];
+    }
+    mem.unmap_data(range_ptr);
+
+    mapped_ptr = mem.map_data<float>();
+    GTEST_EXPECT_NE(mapped_ptr, nullptr);
+    for (size_t i = 0; i < (size_t)N; i++) {
+        ASSERT_EQ(mapped_ptr[i], buffer_ref[i]);
+    }
+    mem.unmap_data(mapped_ptr);
+
+    EXPECT_ANY_THROW(mem.map_data_range(
+            (N - 1) * sizeof(float), 2 * sizeof(float)));
+}
+
 namespace {
 struct print_to_string_param_name_t {
     template <class ParamType>
@@ -116,6 +116,10 @@ TEST(APIOp, CreateAllOps) {
             op::kind::GroupNorm,
             op::kind::GenIndex,
             op::kind::GreaterEqual,
+            op::kind::RotaryEmbedding,
+            op::kind::RMSNorm,
+            op::kind::PagedCacheLoad,
+            op::kind::Gather,
     };
     // clang-format on
 
@@ -336,6 +336,25 @@ TEST(APIPartitionCache, GetSetCapacity) {
 #endif
 }
 
+TEST(APIPartitionCache, GetSetMemoryLimit) {
+    ASSERT_EQ(dnnl_graph_get_compiled_partition_cache_memory_limit(nullptr),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_graph_get_compiled_partition_cache_memory_usage(nullptr),
+            dnnl_invalid_arguments);
+
+    const size_t old_limit
+            = dnnl::graph::get_compiled_partition_cache_memory_limit();
+    ASSERT_NO_THROW(
+            dnnl::graph::set_compiled_partition_cache_memory_limit(1024));
+#ifndef DNNL_GRAPH_DISABLE_COMPILED_PARTITION_CACHE
+    ASSERT_EQ(dnnl::graph::get_compiled_partition_cache_memory_limit(), 1024U);
+    ASSERT_LE(dnnl::graph::get_compiled_partition_cache_memory_usage(), 1024U);
+#else
+    ASSERT_EQ(dnnl::graph::get_compiled_partition_cache_memory_usage(), 0U);
+#endif
+    dnnl::graph::set_compiled_partition_cache_memory_limit(old_limit);
+}
+
 // Test the f8f8f32 partition as below;
 //
 //      deq0_src     deq1_src
@@ -390,3 +409,186 @@ TEST(APIPartition, F8MatmulPartition) {
         parts[0].compile({deq0_src, deq1_src}, {mm_dst}, eng);
     }
 }
+
+TEST(APIPartition, CompileWithBuckets) {
+    using namespace dnnl::graph;
+    SKIP_IF(DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE
+                    || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "Skip the case when CPU runtime is NONE or SYCL");
+
+    const int64_t K = 16, N = 8;
+    logical_tensor src {0, logical_tensor::data_type::f32,
+            {DNNL_GRAPH_UNKNOWN_DIM, K}, logical_tensor::layout_type::strided};
+    logical_tensor wei {1, logical_tensor::data_type::f32, {K, N},
+            logical_tensor::layout_type::strided};
+    logical_tensor dst {2, logical_tensor::data_type::f32, 2,
+            logical_tensor::layout_type::strided};
+
+    op mm {0, op::kind::MatMul, "matmul"};
+    mm.add_inputs({src, wei});
+    mm.add_outputs({dst});
+
+    engine eng(engine::kind::cpu, 0);
+    partition part {mm, engine::kind::cpu};
+    // At least one input dimension has to be dynamic.
+    EXPECT_THROW(part.compile_with_buckets({wei, wei}, {dst}, {4}, eng),
+            dnnl::error);
+    auto cp = part.compile_with_buckets({src, wei}, {dst}, {32, 4, 8}, eng);
+
+    // Queries return the logical tensors of the largest bucket.
+    ASSERT_EQ(cp.query_logical_tensor(2).get_dims(),
+            std::vector<int64_t>({32, N}));
+
+    stream strm(eng);
+    std::vector<float> wei_data(K * N, 0.5f);
+    for (int64_t M : {4, 8, 32}) {
+        std::vector<float> src_data(M * K, 1.f);
+        std::vector<float> dst_data(M * N, 0.f);
+        logical_tensor src_m {0, logical_tensor::data_type::f32, {M, K},
+                logical_tensor::layout_type::strided};
+        logical_tensor dst_m {2, logical_tensor::data_type::f32, {M, N},
+                logical_tensor::layout_type::strided};
+        tensor ts_src {src_m, eng, src_data.data()};
+        tensor ts_wei {wei, eng, wei_data.data()};
+        tensor ts_dst {dst_m, eng, dst_data.data()};
+        cp.execute(strm, {ts_src, ts_wei}, {ts_dst});
+        strm.wait();
+        for (float v : dst_data)
+            ASSERT_EQ(v, 0.5f * K);
+    }
+
+    // There is no bucket for a size in between.
+    std::vector<float> src_data(5 * K), dst_data(5 * N);
+    logical_tensor src_5 {0, logical_tensor::data_type::f32, {5, K},
+            logical_tensor::layout_type::strided};
+    logical_tensor dst_5 {2, logical_tensor::data_type::f32, {5, N},
+            logical_tensor::layout_type::strided};
+    tensor ts_src {src_5, eng, src_data.data()};
+    tensor ts_wei {wei, eng, wei_data.data()};
+    tensor ts_dst {dst_5, eng, dst_data.data()};
+    EXPECT_THROW(cp.execute(strm, {ts_src, ts_wei}, {ts_dst}), dnnl::error);
+}
+
+TEST(APIPartition, CompileFromCacheBlob) {
+    using namespace dnnl::graph;
+    SKIP_IF(DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE
+                    || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "Skip the case when CPU runtime is NONE or SYCL");
+
+    const int64_t M = 4, K = 16, N = 8;
+    logical_tensor src {0, logical_tensor::data_type::f32, {M, K},
+            logical_tensor::layout_type::strided};
+    logical_tensor wei {1, logical_tensor::data_type::f32, {K, N},
+            logical_tensor::layout_type::strided};
+    logical_tensor dst {2, logical_tensor::data_type::f32, {M, N},
+            logical_tensor::layout_type::strided};
+
+    op mm {0, op::kind::MatMul, "matmul"};
+    mm.add_inputs({src, wei});
+    mm.add_outputs({dst});
+
+    engine eng(engine::kind::cpu, 0);
+    partition part {mm, engine::kind::cpu};
+    auto cp = part.compile({src, wei}, {dst}, eng);
+    // CPU kernels can't be stored in a cache blob.
+    const std::vector<uint8_t> blob = cp.get_cache_blob();
+    ASSERT_TRUE(blob.empty());
+
+    auto cp_from_blob = part.compile({src, wei}, {dst}, eng, blob);
+    stream strm(eng);
+    std::vector<float> src_data(M * K, 1.f), wei_data(K * N, 0.5f);
+    std::vector<float> dst_data(M * N, 0.f);
+    tensor ts_src {src, eng, src_data.data()};
+    tensor ts_wei {wei, eng, wei_data.data()};
+    tensor ts_dst {dst, eng, dst_data.data()};
+    cp_from_blob.execute(strm, {ts_src, ts_wei}, {ts_dst});
+    strm.wait();
+    for (float v : dst_data)
+        ASSERT_EQ(v, 0.5f * K);
+}
+
+TEST(APIPartition, PrepareConstants) {
+    using namespace dnnl::graph;
+    SKIP_IF(DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE
+                    || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "Skip the case when CPU runtime is NONE or SYCL");
+
+    const int64_t M = 4, K = 16, N = 8;
+    logical_tensor src {0, logical_tensor::data_type::f32, {M, K},
+            logical_tensor::layout_type::strided};
+    logical_tensor wei {1, logical_tensor::data_type::f32, {K, N},
+            logical_tensor::layout_type::strided,
+            logical_tensor::property_type::constant};
+    logical_tensor dst {2, logical_tensor::data_type::f32, {M, N},
+            logical_tensor::layout_type::strided};
+
+    op mm {0, op::kind::MatMul, "matmul"};
+    mm.add_inputs({src, wei});
+    mm.add_outputs({dst});
+
+    engine eng(engine::kind::cpu, 0);
+    partition part {mm, engine::kind::cpu};
+    auto cp = part.compile({src, wei}, {dst}, eng);
+
+    stream strm(eng);
+    std::vector<float> src_data(M * K, 1.f), wei_data(K * N, 0.5f);
+    std::vector<float> dst_data(M * N, 0.f);
+    tensor ts_src {src, eng, src_data.data()};
+    tensor ts_wei {wei, eng, wei_data.data()};
+    tensor ts_dst {dst, eng, dst_data.data()};
+    // only the constant input is accessed
+    tensor ts_no_src {src, eng, nullptr};
+    ASSERT_NO_THROW(cp.prepare_constants(strm, {ts_no_src, ts_wei}, true));
+    strm.wait();
+
+    cp.execute(strm, {ts_src, ts_wei}, {ts_dst});
+    strm.wait();
+    for (float v : dst_data)
+        ASSERT_EQ(v, 0.5f * K);
+}
+
+TEST(APIPartition, ExecuteWithCallback) {
+    using namespace dnnl::graph;
+    SKIP_IF(DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE
+                    || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "Skip the case when CPU runtime is NONE or SYCL");
+
+    const int64_t M = 4, K = 16, N = 8;
+    logical_tensor src {0, logical_tensor::data_type::f32, {M, K},
+            logical_tensor::layout_type::strided};
+    logical_tensor wei {1, logical_tensor::data_type::f32, {K, N},
+            logical_tensor::layout_type::strided};
+    logical_tensor dst {2, logical_tensor::data_type::f32, {M, N},
+            logical_tensor::layout_type::strided};
+
+    op mm {0, op::kind::MatMul, "matmul"};
+    mm.add_inputs({src, wei});
+    mm.add_outputs({dst});
+
+    engine eng(engine::kind::cpu, 0);
+    partition part {mm, engine::kind::cpu};
+    auto cp = part.compile({src, wei}, {dst}, eng);
+
+    stream strm(eng);
+    std::vector<float> src_data(M * K, 1.f), wei_data(K * N, 0.5f);
+    std::vector<float> dst_data(M * N, 0.f);
+    tensor ts_src {src, eng, src_data.data()};
+    tensor ts_wei {wei, eng, wei_data.data()};
+    tensor ts_dst {dst, eng, dst_data.data()};
+
+    int num_calls = 0;
+    status exec_status = status::runtime_error;
+    cp.execute(strm, {ts_src, ts_wei}, {ts_dst}, [&](status s) {
+        num_calls++;
+        exec_status = s;
+    });
+    strm.wait();
+    ASSERT_EQ(num_calls, 1);
+    ASSERT_EQ(exec_status, status::success);
+    for (float v : dst_data)
+        ASSERT_EQ(v, 0.5f * K);
+
+    ASSERT_EQ(dnnl_graph_compiled_partition_execute_with_callback(cp.get(),
+                      strm.get(), 0, nullptr, 0, nullptr, nullptr, nullptr),
+            dnnl_invalid_arguments);
+}
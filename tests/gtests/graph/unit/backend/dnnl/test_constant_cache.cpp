@@ -110,3 +110,43 @@ TEST(test_constant_cache, NoEvictWhenCacheFull) {
     // ignore since we use no_evict policy
     ASSERT_FALSE(cache.get_or_add(0, 3, 3, c_promise3_2.get_future()).valid());
 }
+
+TEST(test_constant_cache, PinnedEntryKeptOnFlush) {
+    graph::engine_t &engine = *get_engine();
+    auto p_engine_ = dnnl_impl::make_dnnl_engine(engine);
+    auto g_alloc_ = static_cast<graph::allocator_t *>(engine.get_allocator());
+
+    graph::constant_tensor_cache_t cache(5);
+    // nothing to pin
+    ASSERT_FALSE(cache.set_pinned(0, 1, true));
+
+    std::promise<graph::constant_tensor_cache_t::cached_t> c_promise1;
+    ASSERT_NO_THROW(cache.get_or_add(0, 1, 1, c_promise1.get_future()));
+    c_promise1.set_value(std::make_shared<dnnl_impl::dnnl_constant_buffer_t>(
+            1, p_engine_, g_alloc_));
+    std::promise<graph::constant_tensor_cache_t::cached_t> c_promise2;
+    ASSERT_NO_THROW(cache.get_or_add(0, 2, 2, c_promise2.get_future()));
+    c_promise2.set_value(std::make_shared<dnnl_impl::dnnl_constant_buffer_t>(
+            2, p_engine_, g_alloc_));
+    ASSERT_TRUE(cache.set_pinned(0, 1, true));
+
+    // only the pinned buffer is kept when the cache is flushed
+    ASSERT_EQ(cache.set_capacity(6), graph::status::success);
+    ASSERT_EQ(cache.get_size(), 1U);
+    std::promise<graph::constant_tensor_cache_t::cached_t> c_promise1_2;
+    ASSERT_TRUE(cache.get_or_add(0, 1, 1, c_promise1_2.get_future()).valid());
+
+    // unpinned buffers are flushed
+    ASSERT_TRUE(cache.set_pinned(0, 1, false));
+    ASSERT_EQ(cache.set_capacity(5), graph::status::success);
+    ASSERT_EQ(cache.get_size(), 0U);
+
+    // disabling the cache drops pinned buffers as well
+    std::promise<graph::constant_tensor_cache_t::cached_t> c_promise3;
+    ASSERT_NO_THROW(cache.get_or_add(0, 3, 3, c_promise3.get_future()));
+    c_promise3.set_value(std::make_shared<dnnl_impl::dnnl_constant_buffer_t>(
+            3, p_engine_, g_alloc_));
+    ASSERT_TRUE(cache.set_pinned(0, 3, true));
+    ASSERT_EQ(cache.set_capacity(0), graph::status::success);
+    ASSERT_EQ(cache.get_size(), 0U);
+}
@@ -412,6 +412,117 @@ TEST(test_convolution_execute, ConvolutionNcxOix) {
     }
 }
 
+TEST(test_convolution_execute, ReluBwdConvBwdWeightsBiasAddBwd) {
+    using dims = graph::dnnl_impl::dims;
+
+    graph::engine_t *eng = get_engine();
+    const int64_t N = 2, IC = 3, OC = 4, H = 3, W = 3;
+    const int64_t SP = H * W;
+
+    std::vector<float> fwd_src(N * OC * SP), diff_dst(N * OC * SP),
+            src(N * IC * SP);
+    for (size_t i = 0; i < fwd_src.size(); ++i) {
+        fwd_src[i] = static_cast<float>(i % 5) - 2.f;
+        diff_dst[i] = static_cast<float>(i % 7) * 0.5f - 1.f;
+    }
+    for (size_t i = 0; i < src.size(); ++i)
+        src[i] = static_cast<float>(i % 3) - 1.f;
+
+    // 1x1 convolution, so the weights gradient is a plain reduction
+    std::vector<float> ref_diff_wei(OC * IC, 0.f), ref_diff_bias(OC, 0.f);
+    for_(int64_t n = 0; n < N; ++n)
+    for_(int64_t oc = 0; oc < OC; ++oc)
+    for (int64_t sp = 0; sp < SP; ++sp) {
+        const int64_t off = (n * OC + oc) * SP + sp;
+        const float d = fwd_src[off] > 0.f ? diff_dst[off] : 0.f;
+        ref_diff_bias[oc] += d;
+        for (int64_t ic = 0; ic < IC; ++ic)
+            ref_diff_wei[oc * IC + ic] += d * src[(n * IC + ic) * SP + sp];
+    }
+
+    graph::op_t relu_bwd_op(0, graph::op_kind::ReLUBackward, "relu_bwd");
+    relu_bwd_op.set_attr<bool>(graph::op_attr::use_dst, false);
+
+    graph::op_t conv_op(1, graph::op_kind::ConvolutionBackwardWeights, "conv");
+    conv_op.set_attr<dims>(graph::op_attr::strides, dims {1, 1});
+    conv_op.set_attr<dims>(graph::op_attr::dilations, dims {1, 1});
+    conv_op.set_attr<dims>(graph::op_attr::pads_begin, dims {0, 0});
+    conv_op.set_attr<dims>(graph::op_attr::pads_end, dims {0, 0});
+    conv_op.set_attr<int64_t>(graph::op_attr::groups, 1);
+    conv_op.set_attr<std::string>(graph::op_attr::data_format, "NCX");
+    conv_op.set_attr<std::string>(graph::op_attr::weights_format, "OIX");
+    conv_op.set_attr<dims>(graph::op_attr::weights_shape, dims {OC, IC, 1, 1});
+
+    graph::op_t bias_bwd_op(2, graph::op_kind::BiasAddBackward, "bias_bwd");
+    bias_bwd_op.set_attr<std::string>(graph::op_attr::data_format, "NCX");
+
+    // prepare logical tensor
+    graph::logical_tensor_t fwd_src_lt = utils::logical_tensor_init(
+            0, {N, OC, H, W}, graph::data_type::f32);
+    graph::logical_tensor_t diff_dst_lt = utils::logical_tensor_init(
+            1, {N, OC, H, W}, graph::data_type::f32);
+    graph::logical_tensor_t diff_relu_lt = utils::logical_tensor_init(
+            2, {N, OC, H, W}, graph::data_type::f32);
+    graph::logical_tensor_t src_lt = utils::logical_tensor_init(
+            3, {N, IC, H, W}, graph::data_type::f32);
+    graph::logical_tensor_t diff_wei_lt = utils::logical_tensor_init(
+            4, {OC, IC, 1, 1}, graph::data_type::f32);
+    graph::logical_tensor_t diff_bias_lt
+            = utils::logical_tensor_init(5, {OC}, graph::data_type::f32);
+
+    relu_bwd_op.add_input(fwd_src_lt);
+    relu_bwd_op.add_input(diff_dst_lt);
+    relu_bwd_op.add_output(diff_relu_lt);
+    conv_op.add_input(src_lt);
+    conv_op.add_input(diff_relu_lt);
+    conv_op.add_output(diff_wei_lt);
+    bias_bwd_op.add_input(diff_relu_lt);
+    bias_bwd_op.add_output(diff_bias_lt);
+
+    graph::graph_t g(eng->kind());
+    g.add_op(&relu_bwd_op);
+    g.add_op(&conv_op);
+    g.add_op(&bias_bwd_op);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("fp_conv_bwd_weights_bias");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    // compile
+    graph::partition_t p;
+    p.init(part);
+
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {
+            &fwd_src_lt, &diff_dst_lt, &src_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {
+            &diff_wei_lt, &diff_bias_lt};
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+    test_tensor_t fwd_src_ts(fwd_src_lt, eng, fwd_src);
+    test_tensor_t diff_dst_ts(diff_dst_lt, eng, diff_dst);
+    test_tensor_t src_ts(src_lt, eng, src);
+    test_tensor_t diff_wei_ts(diff_wei_lt, eng);
+    test_tensor_t diff_bias_ts(diff_bias_lt, eng);
+
+    graph::stream_t *strm = get_stream();
+    cp.execute(strm, {fwd_src_ts.get(), diff_dst_ts.get(), src_ts.get()},
+            {diff_wei_ts.get(), diff_bias_ts.get()});
+    strm->wait();
+
+    const auto diff_wei = diff_wei_ts.as_vec_type<float>();
+    for (size_t i = 0; i < diff_wei.size(); ++i) {
+        ASSERT_NEAR(diff_wei[i], ref_diff_wei[i], 1e-5f);
+    }
+    const auto diff_bias = diff_bias_ts.as_vec_type<float>();
+    for (size_t i = 0; i < diff_bias.size(); ++i) {
+        ASSERT_NEAR(diff_bias[i], ref_diff_bias[i], 1e-5f);
+    }
+}
+
 TEST(test_convolution_execute, ConvtransposeWithGroups) {
     using dims = graph::dnnl_impl::dims;
 
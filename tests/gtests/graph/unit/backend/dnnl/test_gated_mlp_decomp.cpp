@@ -0,0 +1,309 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <functional>
+#include <string>
+#include <thread>
+
+#include "oneapi/dnnl/dnnl_graph.hpp"
+#include "gtest/gtest.h"
+
+#include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
+#include "graph/unit/unit_test_common.hpp"
+#include "graph/unit/utils.hpp"
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+namespace graph = dnnl::impl::graph;
+namespace utils = dnnl::graph::tests::unit::utils;
+using dim_t = dnnl_dim_t;
+using dims = std::vector<dim_t>;
+
+static inline void custom_setenv(
+        const char *name, const char *value, int overwrite) {
+#ifdef _WIN32
+    SetEnvironmentVariable(name, value);
+#else
+    ::setenv(name, value, overwrite);
+#endif
+}
+
+namespace {
+struct gated_mlp_params_t {
+    graph::data_type_t dt;
+    graph::data_type_t wei_dt;
+    dim_t mb, ic, inter, oc;
+    bool use_swish;
+};
+
+// Name of the pass matching the graph built by construct_gated_mlp().
+std::string gated_mlp_pass(const gated_mlp_params_t &p) {
+    std::string name = p.wei_dt != p.dt ? "quantized_gated_mlp" : "gated_mlp";
+    if (p.use_swish) name += "_v1";
+    return name;
+}
+
+// Builds the gated MLP, runs the pass and initializes the partition and its
+// inputs and outputs.
+void init_gated_mlp_partition(graph::engine_t *eng,
+        const gated_mlp_params_t &params, graph::partition_t &p,
+        std::vector<graph::logical_tensor_t> &partition_inputs,
+        std::vector<graph::logical_tensor_t> &partition_outputs) {
+    graph::graph_t g(eng->kind());
+    utils::construct_gated_mlp(&g, params.dt, params.wei_dt, params.mb,
+            params.ic, params.inter, params.oc, params.use_swish);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass(gated_mlp_pass(params));
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+    p.init(part);
+
+    const size_t n_wei_inputs = params.wei_dt != params.dt ? 6U : 3U;
+    partition_inputs = p.get_inputs();
+    partition_outputs = p.get_outputs();
+    ASSERT_EQ(partition_inputs.size(), n_wei_inputs + 1);
+    ASSERT_EQ(partition_outputs.size(), 1U);
+    for (auto &lt : partition_outputs) {
+        // set output to be strided
+        lt = utils::logical_tensor_init(
+                lt.id, lt.data_type, graph::layout_type::strided);
+    }
+}
+
+// Fills the partition inputs: the source and the weights with values around
+// one, integer weights with small integers and the scales around one.
+void fill_gated_mlp_inputs(graph::engine_t *eng,
+        const std::vector<graph::logical_tensor_t> &partition_inputs,
+        std::vector<test_tensor_t> &inputs_ts) {
+    for (auto &lt : partition_inputs) {
+        inputs_ts.emplace_back(lt, eng);
+        switch (lt.data_type) {
+            case graph::data_type::s8:
+                inputs_ts.back().fill<int8_t>(1, 2);
+                break;
+            case graph::data_type::u8:
+                inputs_ts.back().fill<uint8_t>(1, 2);
+                break;
+            case graph::data_type::bf16:
+                inputs_ts.back().fill<bfloat16_t>();
+                break;
+            default: inputs_ts.back().fill<float>(); break;
+        }
+    }
+}
+
+// Compiles and executes the partition with the primitive based kernel and
+// with the decomposition kernel, then compares the results.
+template <typename T>
+void check_gated_mlp_corr(const gated_mlp_params_t &params, float rtol) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    graph::partition_t p;
+    std::vector<graph::logical_tensor_t> partition_inputs, partition_outputs;
+    init_gated_mlp_partition(
+            eng, params, p, partition_inputs, partition_outputs);
+
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (auto &lt : partition_inputs) {
+        inputs.emplace_back(&lt);
+    }
+    for (auto &lt : partition_outputs) {
+        outputs.emplace_back(&lt);
+    }
+
+    std::vector<test_tensor_t> inputs_ts;
+    fill_gated_mlp_inputs(eng, partition_inputs, inputs_ts);
+
+    std::vector<test_tensor_t> outputs_ts[2];
+    for (int force_prim = 1; force_prim >= 0; force_prim--) {
+        custom_setenv("_ONEDNN_GRAPH_GATED_MLP_FORCE_PRIMITIVE",
+                force_prim ? "1" : "0", 1);
+        graph::compiled_partition_t cp(p);
+        ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+        for (auto &lt : outputs) {
+            graph::logical_tensor_t compiled_output;
+            cp.query_logical_tensor(lt->id, &compiled_output);
+            outputs_ts[force_prim].emplace_back(compiled_output, eng);
+        }
+        ASSERT_EQ(cp.execute(strm, test_tensor_t::to_graph_tensor(inputs_ts),
+                          test_tensor_t::to_graph_tensor(
+                                  outputs_ts[force_prim])),
+                graph::status::success);
+        strm->wait();
+    }
+
+    ASSERT_TRUE(allclose<T>(outputs_ts[1][0], outputs_ts[0][0], rtol,
+            /*atol*/ 1e-6f));
+}
+} // namespace
+
+TEST(test_gated_mlp_decomp_execute, F32GatedMlpDecomp_CPU) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    // The second intermediate size leaves a shorter tail slice.
+    for (dim_t inter : {1024, 1000}) {
+        for (bool use_swish : {true, false}) {
+            gated_mlp_params_t params {graph::data_type::f32,
+                    graph::data_type::f32, 4, 512, inter, 512, use_swish};
+            graph::partition_t p;
+            std::vector<graph::logical_tensor_t> partition_inputs,
+                    partition_outputs;
+            init_gated_mlp_partition(
+                    eng, params, p, partition_inputs, partition_outputs);
+
+            std::vector<const graph::logical_tensor_t *> inputs, outputs;
+            for (auto &lt : partition_inputs) {
+                inputs.emplace_back(&lt);
+            }
+            for (auto &lt : partition_outputs) {
+                outputs.emplace_back(&lt);
+            }
+
+            custom_setenv("_ONEDNN_GRAPH_GATED_MLP_FORCE_PRIMITIVE", "0", 1);
+            graph::compiled_partition_t cp(p);
+            ASSERT_EQ(p.compile(&cp, inputs, outputs, eng),
+                    graph::status::success);
+
+            std::vector<test_tensor_t> inputs_ts, outputs_ts;
+            fill_gated_mlp_inputs(eng, partition_inputs, inputs_ts);
+            for (auto &lt : outputs) {
+                graph::logical_tensor_t compiled_output;
+                cp.query_logical_tensor(lt->id, &compiled_output);
+                outputs_ts.emplace_back(compiled_output, eng);
+            }
+            ASSERT_EQ(
+                    cp.execute(strm, test_tensor_t::to_graph_tensor(inputs_ts),
+                            test_tensor_t::to_graph_tensor(outputs_ts)),
+                    graph::status::success);
+            strm->wait();
+        }
+    }
+}
+
+TEST(test_gated_mlp_decomp_execute, F32GatedMlpCorr_CPU) {
+    graph::engine_t *eng = get_engine();
+
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    for (dim_t inter : {1024, 1000}) {
+        for (bool use_swish : {true, false}) {
+            check_gated_mlp_corr<float>(
+                    {graph::data_type::f32, graph::data_type::f32, 4, 512,
+                            inter, 512, use_swish},
+                    /*rtol*/ 0.01f);
+        }
+    }
+}
+
+TEST(test_gated_mlp_decomp_execute, Bf16GatedMlpCorr_CPU) {
+    graph::engine_t *eng = get_engine();
+
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    static auto isa = dnnl_get_effective_cpu_isa();
+    SKIP_IF((isa < dnnl_cpu_isa_avx512_core)
+                    && eng->kind() == graph::engine_kind::cpu,
+            "Skip bf16 tests for systems that do not support avx512_core.");
+
+    for (bool use_swish : {true, false}) {
+        check_gated_mlp_corr<bfloat16_t>(
+                {graph::data_type::bf16, graph::data_type::bf16, 4, 512, 1024,
+                        512, use_swish},
+                /*rtol*/ 0.1f);
+    }
+}
+
+TEST(test_gated_mlp_decomp_execute, Int8WeiGatedMlpCorr_CPU) {
+    graph::engine_t *eng = get_engine();
+
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    for (dim_t inter : {1024, 1000}) {
+        for (bool use_swish : {true, false}) {
+            check_gated_mlp_corr<float>(
+                    {graph::data_type::f32, graph::data_type::s8, 4, 512,
+                            inter, 512, use_swish},
+                    /*rtol*/ 0.01f);
+        }
+    }
+}
+
+// Test multiple thread execute
+TEST(test_gated_mlp_decomp_execute, MultithreadGatedMlpDecomp_CPU) {
+    graph::engine_t *eng = get_engine();
+
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    gated_mlp_params_t params {graph::data_type::f32, graph::data_type::f32, 4,
+            512, 1024, 512, true};
+    graph::partition_t p;
+    std::vector<graph::logical_tensor_t> partition_inputs, partition_outputs;
+    init_gated_mlp_partition(
+            eng, params, p, partition_inputs, partition_outputs);
+
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (auto &lt : partition_inputs) {
+        inputs.emplace_back(&lt);
+    }
+    for (auto &lt : partition_outputs) {
+        outputs.emplace_back(&lt);
+    }
+
+    custom_setenv("_ONEDNN_GRAPH_GATED_MLP_FORCE_PRIMITIVE", "0", 1);
+    graph::compiled_partition_t cp(p);
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+    std::vector<test_tensor_t> inputs_ts;
+    fill_gated_mlp_inputs(eng, partition_inputs, inputs_ts);
+
+    auto func = [&]() {
+        graph::stream_t *strm;
+        dnnl_stream_create(&strm, eng, dnnl_stream_in_order);
+        std::vector<test_tensor_t> outputs_ts;
+        outputs_ts.reserve(partition_outputs.size());
+        for (auto &lt : partition_outputs) {
+            outputs_ts.emplace_back(lt, eng);
+        }
+        for (int i = 0; i < 10; i++)
+            ASSERT_EQ(cp.execute(strm,
+                              test_tensor_t::to_graph_tensor(inputs_ts),
+                              test_tensor_t::to_graph_tensor(outputs_ts)),
+                    graph::status::success);
+        strm->wait();
+        dnnl_stream_destroy(strm);
+    };
+
+    std::thread t1(func);
+    std::thread t2(func);
+    std::thread t3(func);
+    std::thread t4(func);
+    t1.join();
+    t2.join();
+    t3.join();
+    t4.join();
+}
@@ -0,0 +1,138 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gtest/gtest.h"
+
+#include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
+#include "graph/unit/unit_test_common.hpp"
+#include "graph/unit/utils.hpp"
+
+namespace graph = dnnl::impl::graph;
+namespace utils = dnnl::graph::tests::unit::utils;
+using dim_t = dnnl_dim_t;
+using dims = std::vector<dim_t>;
+
+namespace {
+void run_gather(const dims &src_dims, const dims &indices_dims, int64_t axis,
+        const std::vector<float> &src, const std::vector<int32_t> &indices,
+        const std::vector<float> &ref) {
+    graph::engine_t *engine = get_engine();
+
+    graph::op_t gather_op(graph::op_kind::Gather);
+    gather_op.set_attr<int64_t>(graph::op_attr::axis, axis);
+    graph::logical_tensor_t src_lt
+            = utils::logical_tensor_init(0, src_dims, graph::data_type::f32);
+    graph::logical_tensor_t indices_lt = utils::logical_tensor_init(
+            1, indices_dims, graph::data_type::s32);
+    graph::logical_tensor_t dst_lt
+            = utils::logical_tensor_init(2, graph::data_type::f32);
+    gather_op.add_input(src_lt);
+    gather_op.add_input(indices_lt);
+    gather_op.add_output(dst_lt);
+
+    graph::graph_t g(engine->kind());
+    g.add_op(&gather_op);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("gather_pass");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {&src_lt, &indices_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst_lt};
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, engine), graph::status::success);
+
+    graph::logical_tensor_t compiled_dst_lt;
+    cp.query_logical_tensor(dst_lt.id, &compiled_dst_lt);
+    ASSERT_EQ(graph::logical_tensor_wrapper_t(compiled_dst_lt).nelems(),
+            static_cast<dim_t>(ref.size()));
+
+    graph::stream_t *stream = get_stream();
+    test_tensor_t src_ts(src_lt, engine, src);
+    test_tensor_t indices_ts(indices_lt, engine, indices);
+    test_tensor_t dst_ts(compiled_dst_lt, engine);
+    ASSERT_EQ(cp.execute(stream, {src_ts.get(), indices_ts.get()},
+                      {dst_ts.get()}),
+            graph::status::success);
+    stream->wait();
+    const auto dst = dst_ts.as_vec_type<float>();
+    for (size_t i = 0; i < dst.size(); i++)
+        ASSERT_EQ(dst[i], ref[i]);
+}
+} // namespace
+
+TEST(test_gather_execute, EmbeddingLookup) {
+    graph::engine_t *engine = get_engine();
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu, "skip on gpu");
+
+    const dim_t V = 10, C = 16, B = 2, L = 3;
+    std::vector<float> table(V * C);
+    for (size_t i = 0; i < table.size(); i++)
+        table[i] = static_cast<float>(i);
+    // -1 and V are out of range and produce zero rows
+    const std::vector<int32_t> ids {3, 0, 9, -1, 7, V};
+    std::vector<float> ref(B * L * C, 0.f);
+    for (dim_t i = 0; i < B * L; i++) {
+        if (ids[i] < 0 || ids[i] >= V) continue;
+        for (dim_t c = 0; c < C; c++)
+            ref[i * C + c] = table[ids[i] * C + c];
+    }
+    run_gather({V, C}, {B, L}, 0, table, ids, ref);
+}
+
+TEST(test_gather_execute, InnerAxis) {
+    graph::engine_t *engine = get_engine();
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu, "skip on gpu");
+
+    // Gathers the rows of the cos table of rotary embedding at the position
+    // ids of the tokens: [1, S, D] -> [1, N, D]
+    const dim_t S = 8, D = 4, N = 5;
+    std::vector<float> cos(S * D);
+    for (size_t i = 0; i < cos.size(); i++)
+        cos[i] = static_cast<float>(i) * 0.5f;
+    const std::vector<int32_t> pos {7, 2, 2, 0, 5};
+    std::vector<float> ref(N * D);
+    for (dim_t n = 0; n < N; n++)
+        for (dim_t d = 0; d < D; d++)
+            ref[n * D + d] = cos[pos[n] * D + d];
+    run_gather({1, S, D}, {N}, -2, cos, pos, ref);
+}
+
+TEST(test_gather_execute, InvalidAxis) {
+    graph::engine_t *engine = get_engine();
+
+    graph::op_t gather_op(graph::op_kind::Gather);
+    gather_op.set_attr<int64_t>(graph::op_attr::axis, 2);
+    graph::logical_tensor_t src_lt
+            = utils::logical_tensor_init(0, {4, 8}, graph::data_type::f32);
+    graph::logical_tensor_t indices_lt
+            = utils::logical_tensor_init(1, {3}, graph::data_type::s32);
+    graph::logical_tensor_t dst_lt
+            = utils::logical_tensor_init(2, graph::data_type::f32);
+    gather_op.add_input(src_lt);
+    gather_op.add_input(indices_lt);
+    gather_op.add_output(dst_lt);
+
+    graph::graph_t g(engine->kind());
+    g.add_op(&gather_op);
+    g.finalize();
+    ASSERT_EQ(g.infer_shape(), graph::status::invalid_shape);
+}
@@ -37,6 +37,7 @@ TEST(test_internal_attrs, InternalAttr2str) {
     CASE(with_runtime_dst_zps);
     CASE(is_bias_add);
     CASE(with_sum);
+    CASE(is_zero_copy);
     CASE(alg_kind);
     CASE(fusion_info_key);
     CASE(dw_type);
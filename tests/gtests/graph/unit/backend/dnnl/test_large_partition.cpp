@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <cmath>
 #include <functional>
 #include <random>
 
@@ -1378,3 +1380,276 @@ TEST(test_large_partition_execute, Int8Bf16GptMha_CPU) {
             graph::status::success);
     strm->wait();
 }
+
+TEST(test_large_partition_execute, F32SdpWithKvCacheInPlace) {
+    graph::engine_t *eng = get_engine();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "in-place KV cache appending is supported on cpu only");
+    SKIP_IF(DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "host memory is used for the caches");
+    graph::stream_t *strm = get_stream();
+
+    // the caches are allocated for max_seq tokens and hold seq tokens
+    const graph::dim_t mb = 1, head = 2, seq = 4, max_seq = 5, size = 8;
+    const std::vector<graph::dim_t> q_dims {mb, head, 1, size};
+    const std::vector<graph::dim_t> cache_dims {mb, head, seq, size};
+    const std::vector<graph::dim_t> full_dims {mb, head, seq + 1, size};
+    const std::vector<graph::dim_t> cache_strides {
+            head * max_seq * size, max_seq * size, size, 1};
+
+    auto q = utils::logical_tensor_init(0, q_dims, graph::data_type::f32);
+    auto k_cache = utils::logical_tensor_init(
+            1, cache_dims, cache_strides, graph::data_type::f32);
+    auto k_new = utils::logical_tensor_init(2, q_dims, graph::data_type::f32);
+    auto k_full = utils::logical_tensor_init(
+            3, full_dims, cache_strides, graph::data_type::f32);
+    auto score = utils::logical_tensor_init(
+            4, {mb, head, 1, seq + 1}, graph::data_type::f32);
+    auto prob = utils::logical_tensor_init(
+            5, {mb, head, 1, seq + 1}, graph::data_type::f32);
+    auto v_cache = utils::logical_tensor_init(
+            6, cache_dims, cache_strides, graph::data_type::f32);
+    auto v_new = utils::logical_tensor_init(7, q_dims, graph::data_type::f32);
+    auto v_full = utils::logical_tensor_init(
+            8, full_dims, cache_strides, graph::data_type::f32);
+    auto dst = utils::logical_tensor_init(9, q_dims, graph::data_type::f32);
+
+    graph::op_t concat_k(0, graph::op_kind::Concat, "concat_k");
+    concat_k.set_attr<int64_t>(graph::op_attr::axis, 2);
+    concat_k.add_input(k_cache);
+    concat_k.add_input(k_new);
+    concat_k.add_output(k_full);
+    graph::op_t matmul_qk(1, graph::op_kind::MatMul, "matmul_qk");
+    matmul_qk.set_attr<bool>(graph::op_attr::transpose_b, true);
+    matmul_qk.add_input(q);
+    matmul_qk.add_input(k_full);
+    matmul_qk.add_output(score);
+    graph::op_t softmax(2, graph::op_kind::SoftMax, "softmax");
+    softmax.set_attr<int64_t>(graph::op_attr::axis, 3);
+    softmax.add_input(score);
+    softmax.add_output(prob);
+    graph::op_t concat_v(3, graph::op_kind::Concat, "concat_v");
+    concat_v.set_attr<int64_t>(graph::op_attr::axis, 2);
+    concat_v.add_input(v_cache);
+    concat_v.add_input(v_new);
+    concat_v.add_output(v_full);
+    graph::op_t matmul_v(4, graph::op_kind::MatMul, "matmul_v");
+    matmul_v.add_input(prob);
+    matmul_v.add_input(v_full);
+    matmul_v.add_output(dst);
+    // the updated caches are also the outputs of the graph
+    graph::op_t end_k(5, graph::op_kind::End, "end_k");
+    end_k.add_input(k_full);
+    graph::op_t end_v(6, graph::op_kind::End, "end_v");
+    end_v.add_input(v_full);
+
+    graph::graph_t g(eng->kind());
+    ASSERT_EQ(g.add_op(&concat_k), graph::status::success);
+    ASSERT_EQ(g.add_op(&matmul_qk), graph::status::success);
+    ASSERT_EQ(g.add_op(&softmax), graph::status::success);
+    ASSERT_EQ(g.add_op(&concat_v), graph::status::success);
+    ASSERT_EQ(g.add_op(&matmul_v), graph::status::success);
+    ASSERT_EQ(g.add_op(&end_k), graph::status::success);
+    ASSERT_EQ(g.add_op(&end_v), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass
+            = get_pass("float_sdp_with_kv_cache_fusion_cpu");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+    ASSERT_EQ(p.get_inputs().size(), 5U);
+    ASSERT_EQ(p.get_outputs().size(), 3U);
+
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (const auto *lt : {&q, &k_cache, &k_new, &v_cache, &v_new})
+        inputs.emplace_back(lt);
+    for (const auto *lt : {&k_full, &v_full, &dst})
+        outputs.emplace_back(lt);
+
+    graph::compiled_partition_t cp(p);
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+    const auto inplace_pairs = cp.get_inplace_pairs();
+    ASSERT_EQ(inplace_pairs.size(), 2U);
+    for (const auto &pair : inplace_pairs) {
+        ASSERT_TRUE((pair.input_id == k_cache.id && pair.output_id == k_full.id)
+                || (pair.input_id == v_cache.id
+                        && pair.output_id == v_full.id));
+    }
+
+    const size_t cache_nelems = mb * head * max_seq * size;
+    const size_t q_nelems = mb * head * size;
+    std::vector<float> q_data(q_nelems), k_new_data(q_nelems),
+            v_new_data(q_nelems);
+    std::vector<float> k_buf(cache_nelems), v_buf(cache_nelems);
+    std::default_random_engine generator(7);
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    for (auto *vec : {&q_data, &k_new_data, &v_new_data, &k_buf, &v_buf})
+        std::generate(vec->begin(), vec->end(),
+                [&]() { return distribution(generator); });
+
+    // reference run with separate buffers for the updated caches
+    std::vector<float> k_full_ref(cache_nelems), v_full_ref(cache_nelems),
+            dst_ref(q_nelems), dst_data(q_nelems);
+    std::vector<graph::tensor_t> inputs_ts {
+            graph::tensor_t(q, eng, q_data.data()),
+            graph::tensor_t(k_cache, eng, k_buf.data()),
+            graph::tensor_t(k_new, eng, k_new_data.data()),
+            graph::tensor_t(v_cache, eng, v_buf.data()),
+            graph::tensor_t(v_new, eng, v_new_data.data())};
+    ASSERT_EQ(cp.execute(strm, inputs_ts,
+                      {graph::tensor_t(k_full, eng, k_full_ref.data()),
+                              graph::tensor_t(v_full, eng, v_full_ref.data()),
+                              graph::tensor_t(dst, eng, dst_ref.data())}),
+            graph::status::success);
+    strm->wait();
+
+    // the new rows are appended to the caches in place
+    ASSERT_EQ(cp.execute(strm, inputs_ts,
+                      {graph::tensor_t(k_full, eng, k_buf.data()),
+                              graph::tensor_t(v_full, eng, v_buf.data()),
+                              graph::tensor_t(dst, eng, dst_data.data())}),
+            graph::status::success);
+    strm->wait();
+
+    for (size_t i = 0; i < q_nelems; i++)
+        ASSERT_FLOAT_EQ(dst_data[i], dst_ref[i]);
+    for (size_t i = 0; i < cache_nelems; i++) {
+        ASSERT_FLOAT_EQ(k_buf[i], k_full_ref[i]);
+        ASSERT_FLOAT_EQ(v_buf[i], v_full_ref[i]);
+    }
+}
+
+TEST(test_large_partition_execute, F32SdpWithPagedKvCache) {
+    graph::engine_t *eng = get_engine();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "paged KV cache is supported on cpu only");
+    SKIP_IF(DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "host memory is used for the caches");
+    graph::stream_t *strm = get_stream();
+
+    // every sequence holds blocks * block_size tokens in the pages listed in
+    // its row of the block table
+    const graph::dim_t mb = 2, head = 2, size = 8, num_blocks = 6,
+                       block_size = 4, blocks = 2, seq = blocks * block_size;
+    const std::vector<graph::dim_t> q_dims {mb, head, 1, size};
+    const std::vector<graph::dim_t> cache_dims {
+            num_blocks, head, block_size, size};
+    const std::vector<graph::dim_t> kv_dims {mb, head, seq, size};
+    const std::vector<int32_t> table_data {4, 1, 0, 5};
+
+    auto q = utils::logical_tensor_init(0, q_dims, graph::data_type::f32);
+    auto k_cache
+            = utils::logical_tensor_init(1, cache_dims, graph::data_type::f32);
+    auto table = utils::logical_tensor_init(
+            2, {mb, blocks}, graph::data_type::s32);
+    auto k = utils::logical_tensor_init(3, kv_dims, graph::data_type::f32);
+    auto score = utils::logical_tensor_init(
+            4, {mb, head, 1, seq}, graph::data_type::f32);
+    auto prob = utils::logical_tensor_init(
+            5, {mb, head, 1, seq}, graph::data_type::f32);
+    auto v_cache
+            = utils::logical_tensor_init(6, cache_dims, graph::data_type::f32);
+    auto v = utils::logical_tensor_init(7, kv_dims, graph::data_type::f32);
+    auto dst = utils::logical_tensor_init(8, q_dims, graph::data_type::f32);
+
+    graph::op_t load_k(0, graph::op_kind::PagedCacheLoad, "load_k");
+    load_k.add_input(k_cache);
+    load_k.add_input(table);
+    load_k.add_output(k);
+    graph::op_t matmul_qk(1, graph::op_kind::MatMul, "matmul_qk");
+    matmul_qk.set_attr<bool>(graph::op_attr::transpose_b, true);
+    matmul_qk.add_input(q);
+    matmul_qk.add_input(k);
+    matmul_qk.add_output(score);
+    graph::op_t softmax(2, graph::op_kind::SoftMax, "softmax");
+    softmax.set_attr<int64_t>(graph::op_attr::axis, 3);
+    softmax.add_input(score);
+    softmax.add_output(prob);
+    graph::op_t load_v(3, graph::op_kind::PagedCacheLoad, "load_v");
+    load_v.add_input(v_cache);
+    load_v.add_input(table);
+    load_v.add_output(v);
+    graph::op_t matmul_v(4, graph::op_kind::MatMul, "matmul_v");
+    matmul_v.add_input(prob);
+    matmul_v.add_input(v);
+    matmul_v.add_output(dst);
+
+    graph::graph_t g(eng->kind());
+    ASSERT_EQ(g.add_op(&load_k), graph::status::success);
+    ASSERT_EQ(g.add_op(&matmul_qk), graph::status::success);
+    ASSERT_EQ(g.add_op(&softmax), graph::status::success);
+    ASSERT_EQ(g.add_op(&load_v), graph::status::success);
+    ASSERT_EQ(g.add_op(&matmul_v), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass
+            = get_pass("float_sdp_with_paged_cache_fusion_cpu");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+    ASSERT_EQ(p.get_inputs().size(), 4U);
+    ASSERT_EQ(p.get_outputs().size(), 1U);
+
+    std::vector<const graph::logical_tensor_t *> inputs {
+            &q, &k_cache, &table, &v_cache};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst};
+
+    graph::compiled_partition_t cp(p);
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+    const size_t cache_nelems = num_blocks * head * block_size * size;
+    const size_t q_nelems = mb * head * size;
+    std::vector<float> q_data(q_nelems), k_data(cache_nelems),
+            v_data(cache_nelems), dst_data(q_nelems);
+    std::default_random_engine generator(7);
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    for (auto *vec : {&q_data, &k_data, &v_data})
+        std::generate(vec->begin(), vec->end(),
+                [&]() { return distribution(generator); });
+
+    ASSERT_EQ(cp.execute(strm,
+                      {graph::tensor_t(q, eng, q_data.data()),
+                              graph::tensor_t(k_cache, eng, k_data.data()),
+                              graph::tensor_t(table, eng,
+                                      const_cast<int32_t *>(table_data.data())),
+                              graph::tensor_t(v_cache, eng, v_data.data())},
+                      {graph::tensor_t(dst, eng, dst_data.data())}),
+            graph::status::success);
+    strm->wait();
+
+    // reference on the pages gathered by hand
+    const auto kv_offset = [&](graph::dim_t b, graph::dim_t h, graph::dim_t s) {
+        const int32_t blk = table_data[b * blocks + s / block_size];
+        return ((blk * head + h) * block_size + s % block_size) * size;
+    };
+    for (graph::dim_t b = 0; b < mb; b++)
+        for (graph::dim_t h = 0; h < head; h++) {
+            const float *qv = q_data.data() + (b * head + h) * size;
+            std::vector<float> s_ref(seq);
+            float max_s = -INFINITY, sum = 0.f;
+            for (graph::dim_t s = 0; s < seq; s++) {
+                s_ref[s] = 0.f;
+                for (graph::dim_t d = 0; d < size; d++)
+                    s_ref[s] += qv[d] * k_data[kv_offset(b, h, s) + d];
+                max_s = std::max(max_s, s_ref[s]);
+            }
+            for (graph::dim_t s = 0; s < seq; s++) {
+                s_ref[s] = std::exp(s_ref[s] - max_s);
+                sum += s_ref[s];
+            }
+            for (graph::dim_t d = 0; d < size; d++) {
+                float ref = 0.f;
+                for (graph::dim_t s = 0; s < seq; s++)
+                    ref += s_ref[s] / sum * v_data[kv_offset(b, h, s) + d];
+                ASSERT_NEAR(dst_data[(b * head + h) * size + d], ref, 1e-5f);
+            }
+        }
+}
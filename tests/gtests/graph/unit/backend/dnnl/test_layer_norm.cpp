@@ -277,6 +277,82 @@ TEST(test_layer_norm_execute, LayernormInferenceWithoutScaleShift) {
     }
 }
 
+TEST(test_layer_norm_execute, RMSNormInference) {
+    graph::engine_t *eng = get_engine();
+
+    std::vector<float> src {1.0, 7.0, 2.0, -14.0, -5.0, 5.0};
+    std::vector<float> scale {1.0, 2.0};
+    std::vector<float> ref_dst {0.2, 2.8, 0.2, -2.8, -1.0, 2.0};
+    std::vector<float> dst(src.size(), 0.0);
+
+    graph::op_t rms_norm_op(graph::op_kind::RMSNorm);
+
+    rms_norm_op.set_attr<float>(graph::op_attr::epsilon, 0);
+
+    graph::logical_tensor_t src_lt
+            = utils::logical_tensor_init(0, {1, 3, 2}, graph::data_type::f32);
+    graph::logical_tensor_t scale_lt
+            = utils::logical_tensor_init(1, {2}, graph::data_type::f32);
+    graph::logical_tensor_t dst_lt
+            = utils::logical_tensor_init(2, {1, 3, 2}, graph::data_type::f32);
+
+    graph::engine_t *engine = get_engine();
+    graph::graph_t g(engine->kind());
+
+    rms_norm_op.add_input(src_lt);
+    rms_norm_op.add_input(scale_lt);
+    rms_norm_op.add_output(dst_lt);
+
+    ASSERT_EQ(g.add_op(&rms_norm_op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("rms_norm_pass");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    // compile
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {&src_lt, &scale_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst_lt};
+
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, engine), graph::status::success);
+
+    test_tensor_t src_ts(src_lt, eng, src);
+    test_tensor_t scale_ts(scale_lt, eng, scale);
+    test_tensor_t dst_ts(dst_lt, eng, dst);
+
+    graph::stream_t *strm = get_stream();
+    cp.execute(strm, {src_ts.get(), scale_ts.get()}, {dst_ts.get()});
+    strm->wait();
+    dst = dst_ts.as_vec_type<float>();
+    for (size_t i = 0; i < ref_dst.size(); ++i) {
+        ASSERT_NEAR(dst[i], ref_dst[i], 1e-6);
+    }
+}
+
+TEST(test_layer_norm_execute, RMSNormWithoutAffineInputNum) {
+    graph::op_t rms_norm_op(graph::op_kind::RMSNorm);
+    rms_norm_op.set_attr<bool>(graph::op_attr::use_affine, false);
+
+    graph::logical_tensor_t src_lt
+            = utils::logical_tensor_init(0, {1, 3, 2}, graph::data_type::f32);
+    graph::logical_tensor_t scale_lt
+            = utils::logical_tensor_init(1, {2}, graph::data_type::f32);
+    graph::logical_tensor_t dst_lt
+            = utils::logical_tensor_init(2, {1, 3, 2}, graph::data_type::f32);
+
+    rms_norm_op.add_input(src_lt);
+    rms_norm_op.add_input(scale_lt);
+    rms_norm_op.add_output(dst_lt);
+
+    graph::graph_t g(get_engine()->kind());
+    ASSERT_EQ(g.add_op(&rms_norm_op), graph::status::invalid_graph_op);
+}
+
 TEST(test_layer_norm_execute, LayerNormBackwardFp32) {
     using dims = graph::dnnl_impl::dims;
 
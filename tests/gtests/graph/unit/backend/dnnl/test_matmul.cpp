@@ -2468,6 +2468,142 @@ TEST(test_matmul_execute_subgraph_int8, MatmulNdx2dX8s8f32) {
     }
 }
 
+TEST(test_matmul_execute_subgraph_int8, DynamicQuantMatmulX8s8f32_CPU) {
+    graph::engine_t *engine = get_engine();
+    graph::stream_t *strm = get_stream();
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu, "skip on gpu");
+
+    std::vector<std::string> qtypes {"per_tensor", "per_channel"};
+    const std::vector<int64_t> src_shape {8, 16};
+    const std::vector<int64_t> weight_shape {16, 4};
+    const std::vector<int64_t> dst_shape {8, 4};
+    for (const auto &qtype : qtypes) {
+        std::vector<float> src_data(product(src_shape));
+        std::vector<int8_t> weight_data(product(weight_shape));
+
+        // random seed = 7
+        std::default_random_engine generator(7);
+        std::uniform_real_distribution<float> f32_distribution(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> s8_distribution(-127.0f, 128.0f);
+        std::generate(src_data.begin(), src_data.end(),
+                [&]() { return f32_distribution(generator); });
+        std::generate(weight_data.begin(), weight_data.end(), [&]() {
+            return static_cast<int8_t>(s8_distribution(generator));
+        });
+
+        const bool per_channel = qtype == "per_channel";
+        const int64_t scales_src_size = per_channel ? src_shape[0] : 1;
+        const int64_t scales_wei_size = per_channel ? weight_shape[1] : 1;
+        std::vector<float> scales_src(scales_src_size);
+        for (int64_t m = 0; m < scales_src_size; ++m)
+            scales_src[m] = (1 + m % 2) / 127.f;
+        std::vector<float> scales_wei(scales_wei_size, 1 / 127.f);
+
+        graph::op_t qdata_op(0, graph::op_kind::DynamicQuantize, "qdata_op");
+        qdata_op.set_attr<std::string>(graph::op_attr::qtype, qtype);
+        qdata_op.set_attr<int64_t>(graph::op_attr::axis, 0);
+
+        graph::op_t dqdata_op(
+                1, graph::op_kind::DynamicDequantize, "dqdata_op");
+        dqdata_op.set_attr<std::string>(graph::op_attr::qtype, qtype);
+        dqdata_op.set_attr<int64_t>(graph::op_attr::axis, 0);
+
+        graph::op_t dqweight_op(
+                2, graph::op_kind::DynamicDequantize, "dqweight_op");
+        dqweight_op.set_attr<std::string>(graph::op_attr::qtype, qtype);
+        dqweight_op.set_attr<int64_t>(graph::op_attr::axis, 1);
+
+        graph::op_t matmul_op(3, graph::op_kind::MatMul, "matmul_op");
+        matmul_op.set_attr<bool>(graph::op_attr::transpose_a, false);
+        matmul_op.set_attr<bool>(graph::op_attr::transpose_b, false);
+
+        // prepare logical tensor
+        graph::logical_tensor_t src_f32 = utils::logical_tensor_init(
+                0, src_shape, graph::data_type::f32);
+        graph::logical_tensor_t scales_src_f32 = utils::logical_tensor_init(
+                1, {scales_src_size}, graph::data_type::f32);
+        graph::logical_tensor_t src_s8 = utils::logical_tensor_init(
+                2, src_shape, graph::data_type::s8);
+        graph::logical_tensor_t src_f32_dq = utils::logical_tensor_init(
+                3, src_shape, graph::data_type::f32);
+        graph::logical_tensor_t weight_s8 = utils::logical_tensor_init(
+                4, weight_shape, graph::data_type::s8);
+        graph::logical_tensor_t scales_wei_f32 = utils::logical_tensor_init(
+                5, {scales_wei_size}, graph::data_type::f32);
+        graph::logical_tensor_t weight_f32_dq = utils::logical_tensor_init(
+                6, weight_shape, graph::data_type::f32);
+        graph::logical_tensor_t dst_f32 = utils::logical_tensor_init(
+                7, dst_shape, graph::data_type::f32);
+
+        qdata_op.add_input(src_f32);
+        qdata_op.add_input(scales_src_f32);
+        qdata_op.add_output(src_s8);
+
+        dqdata_op.add_input(src_s8);
+        dqdata_op.add_input(scales_src_f32);
+        dqdata_op.add_output(src_f32_dq);
+
+        dqweight_op.add_input(weight_s8);
+        dqweight_op.add_input(scales_wei_f32);
+        dqweight_op.add_output(weight_f32_dq);
+
+        matmul_op.add_input(src_f32_dq);
+        matmul_op.add_input(weight_f32_dq);
+        matmul_op.add_output(dst_f32);
+
+        graph::graph_t g(engine->kind());
+        g.add_op(&qdata_op);
+        g.add_op(&dqdata_op);
+        g.add_op(&dqweight_op);
+        g.add_op(&matmul_op);
+        g.finalize();
+
+        test_tensor_t src_f32_ts(src_f32, engine, src_data);
+        test_tensor_t scales_src_ts(scales_src_f32, engine, scales_src);
+        test_tensor_t weight_s8_ts(weight_s8, engine, weight_data);
+        test_tensor_t scales_wei_ts(scales_wei_f32, engine, scales_wei);
+        // -------------------------case 1----------------------------------
+        std::vector<float> case1_out_data(product(dst_shape));
+        test_tensor_t dst_f32_ts(dst_f32, engine, case1_out_data);
+        ASSERT_EQ(run_graph(g,
+                          {src_f32_ts, scales_src_ts, weight_s8_ts,
+                                  scales_wei_ts},
+                          {dst_f32_ts}, *engine, *strm),
+                graph::status::success);
+        // -------------------------case 2----------------------------------
+        graph::pass::pass_base_ptr apass
+                = get_pass("dynamic_quant_x8s8f_matmul_post_ops_cpu");
+        apass->run(g);
+        ASSERT_EQ(g.get_num_partitions(), 1U);
+        auto part = g.get_partitions()[0];
+
+        // compile
+        graph::partition_t p;
+        p.init(part);
+
+        graph::compiled_partition_t cp(p);
+
+        std::vector<const graph::logical_tensor_t *> lt_ins {
+                &src_f32, &scales_src_f32, &weight_s8, &scales_wei_f32};
+        std::vector<const graph::logical_tensor_t *> lt_outs {&dst_f32};
+
+        ASSERT_EQ(p.compile(&cp, lt_ins, lt_outs, engine),
+                graph::status::success);
+
+        std::vector<float> case2_out_data(product(dst_shape));
+        test_tensor_t dst_f32_case2_ts(dst_f32, engine, case2_out_data);
+        cp.execute(strm,
+                {src_f32_ts.get(), scales_src_ts.get(), weight_s8_ts.get(),
+                        scales_wei_ts.get()},
+                {dst_f32_case2_ts.get()});
+        strm->wait();
+
+        ASSERT_TRUE(allclose<float>(dst_f32_ts, dst_f32_case2_ts,
+                /*rtol*/ 0.01f,
+                /*atol*/ 1.f));
+    }
+}
+
 TEST(test_matmul_execute_subgraph_int8, MatmulBiasGeluNdx2dX8s8f32) {
     graph::engine_t *engine = get_engine();
     graph::stream_t *strm = get_stream();
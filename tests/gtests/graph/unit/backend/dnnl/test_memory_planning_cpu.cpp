@@ -37,3 +37,24 @@ TEST(test_memory_planning, GetMemoryInfo) {
     graph::value_t val {op, 0, lt};
     ASSERT_NO_THROW(mp.get_memory_info(&val));
 }
+
+TEST(test_memory_planning, BufferPacker) {
+    dnnl_impl::buffer_packer_t packer(64);
+    // a chain of buffers where each one is live for two steps
+    packer.add(0, 128, 0, 1);
+    packer.add(1, 64, 1, 2);
+    packer.add(2, 100, 2, 3);
+    packer.add(3, 64, 3, 4);
+    packer.add(4, 0, 0, 4);
+
+    ASSERT_EQ(packer.pack(), 192U);
+    ASSERT_EQ(packer.peak(), 192U);
+    ASSERT_EQ(packer.query_offset(0), 0U);
+    ASSERT_EQ(packer.query_offset(1), 128U);
+    ASSERT_EQ(packer.query_offset(2), 0U);
+    ASSERT_EQ(packer.query_offset(3), 128U);
+    ASSERT_EQ(packer.query_offset(4), 0U);
+
+    packer.clear();
+    ASSERT_EQ(packer.peak(), 0U);
+}
@@ -11971,6 +11971,74 @@ TEST(test_pass, ShuffleFusion) {
     }
 }
 
+TEST(test_pass, ShuffleConvFusion) {
+    /*   reshape
+            |
+        transpose
+            |
+         reshape
+            |    /
+          conv
+    */
+    const int64_t g = 4;
+    const std::vector<int64_t> groups {1, 2};
+
+    for (const int64_t conv_groups : groups) {
+        op_t reshape0 {0, StaticReshape, "reshape0"};
+        reshape0.set_attr(op_attr::shape, std::vector<int64_t> {8, 2, g, 8, 8});
+        reshape0.set_attr(op_attr::special_zero, false);
+
+        op_t transpose {1, StaticTranspose, "transpose"};
+        transpose.set_attr(
+                op_attr::order, std::vector<int64_t> {0, 2, 1, 3, 4});
+
+        op_t reshape1 {2, StaticReshape, "reshape1"};
+        reshape1.set_attr(op_attr::shape, std::vector<int64_t> {8, 8, 8, 8});
+        reshape1.set_attr(op_attr::special_zero, false);
+
+        op_t conv {3, Convolution, "conv"};
+        set_conv_common_attr(conv, {1, 1}, {0, 0}, {0, 0}, {1, 1}, "None",
+                "NCX", "OIX", conv_groups);
+
+        logical_tensor_t reshape0_src = logical_tensor_init(0, data_type::f32);
+        logical_tensor_t reshape0_dst = logical_tensor_init(1, data_type::f32);
+        logical_tensor_t transpose_dst = logical_tensor_init(2, data_type::f32);
+        logical_tensor_t reshape1_dst = logical_tensor_init(3, data_type::f32);
+        logical_tensor_t wei = logical_tensor_init(4, data_type::f32);
+        logical_tensor_t conv_dst = logical_tensor_init(5, data_type::f32);
+
+        reshape0.add_input(reshape0_src);
+        reshape0.add_output(reshape0_dst);
+        transpose.add_input(reshape0_dst);
+        transpose.add_output(transpose_dst);
+        reshape1.add_input(transpose_dst);
+        reshape1.add_output(reshape1_dst);
+        conv.add_input(reshape1_dst);
+        conv.add_input(wei);
+        conv.add_output(conv_dst);
+
+        const auto engine_kind = get_test_engine_kind();
+        graph_t agraph(engine_kind);
+        ASSERT_EQ(agraph.add_op(&reshape0), status::success);
+        ASSERT_EQ(agraph.add_op(&transpose), status::success);
+        ASSERT_EQ(agraph.add_op(&reshape1), status::success);
+        ASSERT_EQ(agraph.add_op(&conv), status::success);
+        agraph.finalize();
+
+        pass::pass_base_ptr apass = get_pass("fp_shuffle_conv_post_ops");
+        apass->run(agraph);
+        // a shuffle can't be folded into grouped weights
+        ASSERT_EQ(agraph.get_num_partitions(), conv_groups == 1 ? 1U : 0U);
+        if (conv_groups != 1) continue;
+
+        ASSERT_EQ((agraph.get_partitions()[0])->get_kind(),
+                partition_kind_t::convolution_post_ops);
+        ASSERT_EQ(agraph.get_partitions()[0]->get_inputs().size(), 2U);
+        ASSERT_EQ(agraph.get_partitions()[0]->get_inputs()[0].id, 0U);
+        ASSERT_EQ(agraph.get_partitions()[0]->get_inputs()[1].id, 4U);
+    }
+}
+
 TEST(test_pass_system, FuseTypecaseQuantize) {
 
     /*
@@ -12677,6 +12745,61 @@ TEST(test_pass, FuseInterpolateRelu) {
     ASSERT_EQ(agraph.get_partitions()[0]->get_outputs()[0].id, 2U);
 }
 
+TEST(test_pass, FuseNearestInterpolateConv) {
+    /* interpolate
+            |    /
+          conv
+            |
+           relu
+    */
+    const std::vector<std::string> modes {"nearest", "linear"};
+    for (const auto &mode : modes) {
+        const auto engine_kind = get_test_engine_kind();
+        graph_t agraph(engine_kind);
+        op_t interpolate {0, Interpolate, "interpolate"};
+        interpolate.set_attr(op_attr::scales, std::vector<float> {2.f, 2.f});
+        interpolate.set_attr(op_attr::mode, mode);
+        interpolate.set_attr(op_attr::data_format, std::string("NCX"));
+        interpolate.set_attr(op_attr::coordinate_transformation_mode,
+                std::string("half_pixel"));
+        op_t conv {1, Convolution, "conv"};
+        set_conv_common_attr(conv, {1, 1}, {1, 1}, {1, 1}, {1, 1}, "None",
+                "NCX", "OIX");
+        op_t relu {2, ReLU, "relu"};
+
+        std::vector<logical_tensor_t> lt_vec = create_logical_tensors(5);
+        interpolate.add_input(lt_vec[0]);
+        interpolate.add_output(lt_vec[1]);
+        conv.add_input(lt_vec[1]);
+        conv.add_input(lt_vec[2]);
+        conv.add_output(lt_vec[3]);
+        relu.add_input(lt_vec[3]);
+        relu.add_output(lt_vec[4]);
+
+        ASSERT_EQ(agraph.add_op(&interpolate), status::success);
+        ASSERT_EQ(agraph.add_op(&conv), status::success);
+        ASSERT_EQ(agraph.add_op(&relu), status::success);
+        agraph.finalize();
+
+        pass::pass_base_ptr apass = get_pass("fp_upsample_conv_post_ops");
+        apass->run(agraph);
+        if (mode != "nearest") {
+            ASSERT_EQ(agraph.get_num_partitions(), 0U);
+            continue;
+        }
+        ASSERT_EQ(agraph.get_num_partitions(), 1U);
+        ASSERT_EQ((agraph.get_partitions()[0])->get_kind(),
+                partition_kind_t::convolution_post_ops);
+
+        ASSERT_EQ(agraph.get_partitions()[0]->get_inputs().size(), 2U);
+        ASSERT_EQ(agraph.get_partitions()[0]->get_inputs()[0].id, 0U);
+        ASSERT_EQ(agraph.get_partitions()[0]->get_inputs()[1].id, 2U);
+
+        ASSERT_EQ(agraph.get_partitions()[0]->get_outputs().size(), 1U);
+        ASSERT_EQ(agraph.get_partitions()[0]->get_outputs()[0].id, 4U);
+    }
+}
+
 TEST(test_pass, FuseInterpolateSwish) {
     /*    interpolate
             /    |
@@ -13962,7 +14085,7 @@ TEST(test_pass, SingleSoftPlusForwardAndBackwardPass) {
 }
 
 TEST(test_pass, FuseConvBwdBiasaddBwd) {
-    /*       Wildcard
+    /*     ReLUBackward
         \        /\
       Convolution  BiasAddBackward
     BackwardWeights
@@ -13970,12 +14093,13 @@ TEST(test_pass, FuseConvBwdBiasaddBwd) {
     const auto engine_kind = get_test_engine_kind();
     graph_t agraph(engine_kind);
     std::vector<logical_tensor_t> lt_vec = create_logical_tensors(6);
-    op_t op0 {0, ReLU, "op0"};
+    op_t op0 {0, ReLUBackward, "op0"};
     op_t op1 {1, ConvolutionBackwardWeights, "op1"};
     set_conv_common_attr(op1);
     op_t op2 {2, BiasAddBackward, "op2"};
 
     op0.add_input(lt_vec[0]);
+    op0.add_input(lt_vec[3]);
     op0.add_output(lt_vec[1]);
     op1.add_input(lt_vec[2]);
     op1.add_input(lt_vec[1]);
@@ -14002,8 +14126,9 @@ TEST(test_pass, FuseConvBwdBiasaddBwd) {
     input_ids.insert(agraph.get_partitions()[0]->get_inputs()[0].id);
     input_ids.insert(agraph.get_partitions()[0]->get_inputs()[1].id);
     input_ids.insert(agraph.get_partitions()[0]->get_inputs()[2].id);
+    ASSERT_TRUE(input_ids.find(0) != input_ids.end());
     ASSERT_TRUE(input_ids.find(2) != input_ids.end());
-    ASSERT_TRUE(input_ids.find(1) != input_ids.end());
+    ASSERT_TRUE(input_ids.find(3) != input_ids.end());
 
     ASSERT_EQ(agraph.get_partitions()[0]->get_outputs().size(), 2U);
     std::unordered_set<size_t> output_ids;
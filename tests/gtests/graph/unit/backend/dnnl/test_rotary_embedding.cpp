@@ -0,0 +1,124 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
+#include "graph/unit/unit_test_common.hpp"
+#include "graph/unit/utils.hpp"
+
+namespace graph = dnnl::impl::graph;
+namespace utils = dnnl::graph::tests::unit::utils;
+using dim_t = dnnl_dim_t;
+using dims = std::vector<dim_t>;
+
+TEST(test_rotary_embedding_execute, BroadcastCosSin) {
+    graph::engine_t *engine = get_engine();
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu, "skip on gpu");
+
+    const dim_t N = 2, H = 3, S = 5, D = 8;
+    std::vector<float> src(N * H * S * D), cos(S * D), sin(S * D);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<float>(i % 7) - 3.f;
+    for (dim_t s = 0; s < S; s++)
+        for (dim_t d = 0; d < D; d++) {
+            const float angle = static_cast<float>(s) / (1 + d % (D / 2));
+            cos[s * D + d] = std::cos(angle);
+            sin[s * D + d] = std::sin(angle);
+        }
+    std::vector<float> dst(src.size(), 0.f), ref(src.size());
+    for (dim_t r = 0; r < N * H * S; r++) {
+        const float *x = src.data() + r * D;
+        const float *c = cos.data() + (r % S) * D;
+        const float *sn = sin.data() + (r % S) * D;
+        for (dim_t d = 0; d < D / 2; d++) {
+            ref[r * D + d] = x[d] * c[d] - x[d + D / 2] * sn[d];
+            ref[r * D + d + D / 2]
+                    = x[d + D / 2] * c[d + D / 2] + x[d] * sn[d + D / 2];
+        }
+    }
+
+    graph::op_t rope_op(graph::op_kind::RotaryEmbedding);
+    graph::logical_tensor_t src_lt = utils::logical_tensor_init(
+            0, {N, H, S, D}, graph::data_type::f32);
+    graph::logical_tensor_t cos_lt
+            = utils::logical_tensor_init(1, {S, D}, graph::data_type::f32);
+    graph::logical_tensor_t sin_lt
+            = utils::logical_tensor_init(2, {S, D}, graph::data_type::f32);
+    graph::logical_tensor_t dst_lt = utils::logical_tensor_init(
+            3, {N, H, S, D}, graph::data_type::f32);
+    rope_op.add_input(src_lt);
+    rope_op.add_input(cos_lt);
+    rope_op.add_input(sin_lt);
+    rope_op.add_output(dst_lt);
+
+    graph::graph_t g(engine->kind());
+    g.add_op(&rope_op);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("rotary_embedding_pass");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {
+            &src_lt, &cos_lt, &sin_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst_lt};
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, engine), graph::status::success);
+
+    graph::stream_t *stream = get_stream();
+    test_tensor_t src_ts(src_lt, engine, src);
+    test_tensor_t cos_ts(cos_lt, engine, cos);
+    test_tensor_t sin_ts(sin_lt, engine, sin);
+    test_tensor_t dst_ts(dst_lt, engine, dst);
+    ASSERT_EQ(cp.execute(stream, {src_ts.get(), cos_ts.get(), sin_ts.get()},
+                      {dst_ts.get()}),
+            graph::status::success);
+    stream->wait();
+    dst = dst_ts.as_vec_type<float>();
+    for (size_t i = 0; i < dst.size(); i++)
+        ASSERT_NEAR(dst[i], ref[i], 1e-6f);
+}
+
+TEST(test_rotary_embedding_execute, InvalidShape) {
+    graph::engine_t *engine = get_engine();
+
+    graph::op_t rope_op(graph::op_kind::RotaryEmbedding);
+    // The last dimension of cos and sin has to match the one of src.
+    graph::logical_tensor_t src_lt = utils::logical_tensor_init(
+            0, {1, 2, 4, 8}, graph::data_type::f32);
+    graph::logical_tensor_t cos_lt
+            = utils::logical_tensor_init(1, {4, 4}, graph::data_type::f32);
+    graph::logical_tensor_t sin_lt
+            = utils::logical_tensor_init(2, {4, 4}, graph::data_type::f32);
+    graph::logical_tensor_t dst_lt
+            = utils::logical_tensor_init(3, graph::data_type::f32);
+    rope_op.add_input(src_lt);
+    rope_op.add_input(cos_lt);
+    rope_op.add_input(sin_lt);
+    rope_op.add_output(dst_lt);
+
+    graph::graph_t g(engine->kind());
+    g.add_op(&rope_op);
+    g.finalize();
+    ASSERT_EQ(g.infer_shape(), graph::status::invalid_shape);
+}
@@ -105,6 +105,28 @@ TEST(test_scratchpad, Registry) {
     ASSERT_TRUE(piece_end <= total_end); // make sure no overflow
 }
 
+TEST(test_scratchpad, RegistryView) {
+    using dnnl::impl::graph::dnnl_impl::grantor_t;
+    using dnnl::impl::graph::dnnl_impl::registrar_t;
+    using dnnl::impl::graph::dnnl_impl::registry_t;
+
+    registry_t registry;
+    registrar_t registrar = registry.registrar();
+    registrar.book(0, 100);
+    registrar.book(1, 200);
+    const size_t size = registry.size();
+
+    registrar.book_view(2, 1, 24);
+    registrar.book_view(3, 1, 0);
+    // views don't take any additional memory
+    ASSERT_EQ(registry.size(), size);
+
+    char *base_ptr = (char *)4096;
+    grantor_t grantor = registry.grantor(base_ptr);
+    ASSERT_EQ(grantor.get(2), grantor.get(1) + 24);
+    ASSERT_EQ(grantor.get(3), grantor.get(1));
+}
+
 TEST(test_scratchpad, RegistryMultithreading) {
     using dnnl::impl::graph::allocator_t;
     using dnnl::impl::graph::dnnl_impl::grantor_t;
@@ -133,3 +133,33 @@ TEST(test_thread_local_cache, RetainAndRelease) {
     func();
     t1.join();
 }
+
+TEST(test_thread_local_cache, RemoveInAllThreads) {
+    // Keys are spread over the shards of the global table, the removal must
+    // release the values created by all threads.
+    const size_t n_keys = 64;
+    const size_t key_base = 0x1000;
+    auto func = [&]() {
+        thread_local_cache_t<test_resource_t> cache;
+        for (size_t i = 0; i < n_keys; i++) {
+            const size_t key = key_base + i * 64;
+            test_resource_t *resource_ptr = cache.get_or_add(key,
+                    [&]() { return std::make_shared<test_resource_t>(i); });
+            ASSERT_EQ(resource_ptr->data_, i);
+        }
+    };
+
+    std::thread t1(func);
+    std::thread t2(func);
+    func();
+    t1.join();
+    t2.join();
+
+    thread_local_cache_t<test_resource_t> cache;
+    for (size_t i = 0; i < n_keys; i++) {
+        const size_t key = key_base + i * 64;
+        ASSERT_TRUE(cache.has_resource(key));
+        cache.remove_if_exist(key);
+        ASSERT_FALSE(cache.has_resource(key));
+    }
+}
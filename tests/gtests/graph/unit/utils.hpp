@@ -1389,6 +1389,95 @@ inline void construct_dnnl_float_JAX_MQA(dnnl::impl::graph::graph_t *agraph,
     agraph->add_op(&matmul_v);
 }
 
+// Constructs a gated MLP:
+//   dst = (act(src * W_gate) * (src * W_up)) * W_down
+// The activation is swish decomposed to Sigmoid and Multiply if `use_swish` is
+// set, GELU otherwise. Integer `wei_dtype` weights are dequantized per output
+// channel by DynamicDequantize with f32 scales.
+inline void construct_gated_mlp(dnnl::impl::graph::graph_t *agraph,
+        impl::data_type_t dtype = impl::data_type::f32,
+        impl::data_type_t wei_dtype = impl::data_type::f32,
+        impl::graph::dim_t mb = 4, impl::graph::dim_t ic = 512,
+        impl::graph::dim_t inter = 1024, impl::graph::dim_t oc = 512,
+        bool use_swish = true) {
+    using namespace dnnl::impl::graph;
+    using namespace dnnl::graph::tests;
+
+    const bool is_quantized = wei_dtype != dtype;
+    size_t lt_id = 0, op_id = 0;
+    auto src = unit::utils::logical_tensor_init(lt_id++, {mb, ic}, dtype);
+    auto gate_out
+            = unit::utils::logical_tensor_init(lt_id++, {mb, inter}, dtype);
+    auto up_out = unit::utils::logical_tensor_init(lt_id++, {mb, inter}, dtype);
+    auto act_out
+            = unit::utils::logical_tensor_init(lt_id++, {mb, inter}, dtype);
+    auto mul_out
+            = unit::utils::logical_tensor_init(lt_id++, {mb, inter}, dtype);
+    auto dst = unit::utils::logical_tensor_init(lt_id++, {mb, oc}, dtype);
+
+    std::vector<op_t> ops;
+    ops.reserve(10);
+    // Returns the weights of a matmul, dequantized if needed.
+    const auto add_weights = [&](dim_t rows, dim_t cols) {
+        auto wei = unit::utils::logical_tensor_init(
+                lt_id++, {rows, cols}, wei_dtype);
+        if (!is_quantized) return wei;
+        auto scales = unit::utils::logical_tensor_init(
+                lt_id++, {cols}, data_type::f32);
+        auto deq_wei = unit::utils::logical_tensor_init(
+                lt_id++, {rows, cols}, dtype);
+        ops.emplace_back(op_id++, op_kind::DynamicDequantize, "deq_wei");
+        ops.back().set_attr<std::string>(op_attr::qtype, "per_channel");
+        ops.back().set_attr<int64_t>(op_attr::axis, 1);
+        ops.back().add_input(wei);
+        ops.back().add_input(scales);
+        ops.back().add_output(deq_wei);
+        return deq_wei;
+    };
+
+    const auto wei_gate = add_weights(ic, inter);
+    ops.emplace_back(op_id++, op_kind::MatMul, "matmul_gate");
+    ops.back().add_input(src);
+    ops.back().add_input(wei_gate);
+    ops.back().add_output(gate_out);
+
+    const auto wei_up = add_weights(ic, inter);
+    ops.emplace_back(op_id++, op_kind::MatMul, "matmul_up");
+    ops.back().add_input(src);
+    ops.back().add_input(wei_up);
+    ops.back().add_output(up_out);
+
+    if (use_swish) {
+        auto sigmoid_out
+                = unit::utils::logical_tensor_init(lt_id++, {mb, inter}, dtype);
+        ops.emplace_back(op_id++, op_kind::Sigmoid, "swish_sigmoid");
+        ops.back().add_input(gate_out);
+        ops.back().add_output(sigmoid_out);
+        ops.emplace_back(op_id++, op_kind::Multiply, "swish_multiply");
+        ops.back().add_input(gate_out);
+        ops.back().add_input(sigmoid_out);
+        ops.back().add_output(act_out);
+    } else {
+        ops.emplace_back(op_id++, op_kind::GELU, "gelu");
+        ops.back().add_input(gate_out);
+        ops.back().add_output(act_out);
+    }
+
+    ops.emplace_back(op_id++, op_kind::Multiply, "multiply");
+    ops.back().add_input(act_out);
+    ops.back().add_input(up_out);
+    ops.back().add_output(mul_out);
+
+    const auto wei_down = add_weights(inter, oc);
+    ops.emplace_back(op_id++, op_kind::MatMul, "matmul_down");
+    ops.back().add_input(mul_out);
+    ops.back().add_input(wei_down);
+    ops.back().add_output(dst);
+
+    for (auto &op : ops)
+        agraph->add_op(&op);
+}
+
 inline void construct_int8_MHA(dnnl::impl::graph::graph_t *agraph,
         int batch_size = 1, int seq_len = 384, int num_head = 16,
         int head_dim = 1024, bool transpose = false,
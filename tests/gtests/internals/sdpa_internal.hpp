@@ -46,6 +46,54 @@ dnnl_status_t DNNL_API sdpa_primitive_desc_create(
         const_dnnl_primitive_attr_t kq_attr,
         const_dnnl_primitive_attr_t vs_attr);
 
+/// Creates a primitive descriptor for a scaled dot product attention primitive
+/// for forward training. In addition to the destination, the primitive writes
+/// the log-sum-exp of each query row to the statistics tensor.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param query_desc Query memory descriptor (tensor Q)
+/// @param key_desc Key memory descriptor (tensor K)
+/// @param value_desc Value memory descriptor (tensor V)
+/// @param dst_desc Destination memory descriptor.
+/// @param attn_mask_desc Attention mask memory descriptor.
+/// @param stats_desc Statistics memory descriptor (f32, queries x 1).
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+
+dnnl_status_t DNNL_API sdpa_training_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t query_desc, const_dnnl_memory_desc_t key_desc,
+        const_dnnl_memory_desc_t value_desc, const_dnnl_memory_desc_t dst_desc,
+        const_dnnl_memory_desc_t mask_desc,
+        const_dnnl_memory_desc_t stats_desc, dnnl_data_type_t scale_dt,
+        bool invert_scale, dnnl_dim_t kv_head_number, int attn_mask_type,
+        dnnl_alg_kind_t softmax_alg, const_dnnl_primitive_attr_t attr);
+
+/// Creates a primitive descriptor for a scaled dot product attention backward
+/// primitive.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param diff_query_desc Diff query memory descriptor.
+/// @param diff_key_desc Diff key memory descriptor.
+/// @param diff_value_desc Diff value memory descriptor.
+/// @param diff_dst_desc Diff destination memory descriptor.
+/// @param hint_fwd_pd Forward training primitive descriptor.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+
+dnnl_status_t DNNL_API sdpa_backward_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t diff_query_desc,
+        const_dnnl_memory_desc_t diff_key_desc,
+        const_dnnl_memory_desc_t diff_value_desc,
+        const_dnnl_memory_desc_t diff_dst_desc,
+        const_dnnl_primitive_desc_t hint_fwd_pd,
+        const_dnnl_primitive_attr_t attr);
+
 namespace dnnl {
 namespace impl {
 
@@ -80,6 +128,28 @@ struct sdpa : public dnnl::primitive {
                     "primitive");
             reset(pd);
         }
+
+        primitive_desc(const engine &aengine, const memory::desc &query_desc,
+                const memory::desc &key_desc, const memory::desc &value_desc,
+                const memory::desc *attn_mask_desc,
+                const memory::desc &stats_desc, memory::data_type scale_dt,
+                const memory::desc &output_desc, bool invert_scale,
+                memory::dim kv_head_number, int attn_mask_type, int softmax_alg,
+                const primitive_attr &attr = default_attr()) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = sdpa_training_primitive_desc_create(&pd,
+                    aengine.get(), query_desc.get(), key_desc.get(),
+                    value_desc.get(), output_desc.get(),
+                    optional_arg(attn_mask_desc), stats_desc.get(),
+                    (dnnl_data_type_t)scale_dt, invert_scale, kv_head_number,
+                    attn_mask_type, (dnnl_alg_kind_t)softmax_alg, attr.get());
+
+            dnnl::error::wrap_c_api(status,
+                    "could not create a primitive descriptor for a sdpa "
+                    "forward training primitive");
+            reset(pd);
+        }
     };
 
     /// Default constructor. Produces an empty object.
@@ -88,6 +158,48 @@ struct sdpa : public dnnl::primitive {
     /// Constructs a sdpa primitive.
     /// @param pd Primitive descriptor for a sdpa primitive.
     sdpa(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs a sdpa primitive from a cache blob.
+    /// @param pd Primitive descriptor for a sdpa primitive.
+    /// @param cache_blob Cache blob.
+    sdpa(const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// Scaled Dot Product Attention (sdpa) backward internal primitive.
+struct sdpa_backward : public dnnl::primitive {
+    /// Primitive descriptor for a sdpa backward primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        primitive_desc(const engine &aengine,
+                const memory::desc &diff_query_desc,
+                const memory::desc &diff_key_desc,
+                const memory::desc &diff_value_desc,
+                const memory::desc &diff_output_desc,
+                const sdpa::primitive_desc &hint_fwd_pd,
+                const primitive_attr &attr = default_attr()) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = sdpa_backward_primitive_desc_create(&pd,
+                    aengine.get(), diff_query_desc.get(), diff_key_desc.get(),
+                    diff_value_desc.get(), diff_output_desc.get(),
+                    hint_fwd_pd.get(), attr.get());
+
+            dnnl::error::wrap_c_api(status,
+                    "could not create a primitive descriptor for a sdpa "
+                    "backward primitive");
+            reset(pd);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    sdpa_backward() = default;
+
+    /// Constructs a sdpa backward primitive.
+    /// @param pd Primitive descriptor for a sdpa backward primitive.
+    sdpa_backward(const primitive_desc &pd) : primitive(pd) {}
 };
 } // namespace impl
 } // namespace dnnl
@@ -27,6 +27,16 @@
 #include "cpu/x64/amx_tile_configure.hpp"
 #include "cpu/x64/brgemm/brgemm.hpp"
 
+#include "xbyak/xbyak.h"
+
+#ifdef DNNL_EXPERIMENTAL_UKERNEL
+#include "oneapi/dnnl/dnnl_ukernel.hpp"
+#endif
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
 namespace dnnl {
 
 struct brgemm_params_t : test_params_t {
@@ -287,4 +297,180 @@ TEST_P(brgemm_test_t, TestsBRGEMM) {}
 INSTANTIATE_TEST_SUITE_P(TestBRGEMMSimple, brgemm_test_t,
         ::testing::ValuesIn(params_creator_t().create_simple_brgemm_params()));
 
+// Loads or stores the tile configuration behind the library's back, the way
+// kernels that reconfigure the tiles on their own do.
+struct raw_tilecfg_t : public Xbyak::CodeGenerator {
+    raw_tilecfg_t(bool store) {
+#ifdef _WIN32
+        const Xbyak::Reg64 &param = rcx;
+#else
+        const Xbyak::Reg64 &param = rdi;
+#endif
+        if (store)
+            sttilecfg(ptr[param]);
+        else
+            ldtilecfg(ptr[param]);
+        ret();
+    }
+    void operator()(char *palette) const {
+        getCode<void (*)(char *)>()(palette);
+    }
+};
+
+TEST(amx_palette_cache_test_t, TestExternalReconfiguration) {
+    using namespace impl::cpu::x64;
+    SKIP_IF(!dnnl::mayiuse(cpu_isa::avx512_core_amx),
+            "AMX is not supported.");
+
+    // Palettes that differ in the shape of the first tile.
+    auto init_palette = [](char *palette, uint8_t rows, uint16_t colsb) {
+        std::memset(palette, 0, AMX_PALETTE_SIZE);
+        palette[0] = 1;
+        std::memcpy(palette + 16, &colsb, sizeof(colsb));
+        palette[48] = static_cast<char>(rows);
+    };
+    char palette_a[AMX_PALETTE_SIZE], palette_b[AMX_PALETTE_SIZE];
+    init_palette(palette_a, 16, 64);
+    init_palette(palette_b, 8, 32);
+
+    const raw_tilecfg_t raw_load(false), raw_store(true);
+    char loaded[AMX_PALETTE_SIZE];
+
+    ASSERT_EQ(amx_tile_configure(palette_a), impl::status::success);
+    raw_store(loaded);
+    ASSERT_EQ(std::memcmp(loaded, palette_a, AMX_PALETTE_SIZE), 0);
+
+    // A kernel switches to another configuration and the driver drops the
+    // remembered palette, so the next configuration is loaded again.
+    raw_load(palette_b);
+    ASSERT_EQ(amx_tile_invalidate_palette_cache(), impl::status::success);
+    ASSERT_EQ(amx_tile_configure(palette_a), impl::status::success);
+    raw_store(loaded);
+    ASSERT_EQ(std::memcmp(loaded, palette_a, AMX_PALETTE_SIZE), 0);
+
+    ASSERT_EQ(amx_tile_release(), impl::status::success);
+}
+
+// Runtime M: a single row-major f32 kernel is executed with a number of rows
+// below, equal to and above its compile-time rows block (bd_block), and with
+// several blocks and a tail. Rows past M must stay untouched.
+class brgemm_runtime_m_test_t : public ::testing::Test {
+protected:
+    static constexpr int64_t N = 20, K = 12, lda = 16, ldb = 24, ldc = 28;
+
+    void init(int64_t M) {
+        A_.resize(M * lda);
+        B_.resize(K * ldb);
+        C_.assign((M + 1) * ldc, sentinel);
+        // Small integers keep f32 accumulation exact.
+        for (size_t i = 0; i < A_.size(); i++)
+            A_[i] = static_cast<float>(i % 7) - 3.f;
+        for (size_t i = 0; i < B_.size(); i++)
+            B_[i] = static_cast<float>(i % 5) - 2.f;
+    }
+
+    void check(int64_t M) const {
+        for_(int64_t m = 0; m < M; m++)
+        for (int64_t n = 0; n < N; n++) {
+            float ref = 0.f;
+            for (int64_t k = 0; k < K; k++)
+                ref += A_[m * lda + k] * B_[k * ldb + n];
+            ASSERT_EQ(C_[m * ldc + n], ref) << "M: " << M << " m: " << m;
+        }
+        for (int64_t n = 0; n < ldc; n++)
+            ASSERT_EQ(C_[M * ldc + n], sentinel) << "M: " << M;
+    }
+
+    static std::vector<int64_t> get_Ms(int64_t block) {
+        return {1, block - 1, block, block + 1, 2 * block, 3 * block + 2};
+    }
+
+    const float sentinel = -42.f;
+    std::vector<float> A_, B_, C_;
+};
+
+TEST_F(brgemm_runtime_m_test_t, TestKernel) {
+    using namespace impl::cpu::x64;
+
+    brgemm_desc_t desc;
+    auto st = brgemm_desc_init(&desc, isa_undef, brgemm_addr,
+            impl::data_type::f32, impl::data_type::f32, false, false,
+            brgemm_row_major, 1.f, 0.f, lda, ldb, ldc, DNNL_RUNTIME_DIM_VAL, N,
+            K);
+    SKIP_IF(st == impl::status::unimplemented, "Runtime M is not supported.");
+    ASSERT_EQ(st, impl::status::success);
+    ASSERT_TRUE(desc.is_runtime_m);
+
+    brgemm_attr_t attr;
+    attr.max_bs = 1;
+    ASSERT_EQ(brgemm_desc_set_attr(&desc, attr), impl::status::success);
+    ASSERT_EQ(brgemm_desc_finalize(&desc), impl::status::success);
+    ASSERT_FALSE(desc.is_tmm);
+
+    brgemm_kernel_t *kernel = nullptr;
+    ASSERT_EQ(brgemm_kernel_create(&kernel, desc), impl::status::success);
+
+    for (auto M : get_Ms(desc.bd_block)) {
+        if (M <= 0) continue;
+        init(M);
+        brgemm_batch_element_t batch_element;
+        batch_element.ptr.A = A_.data();
+        batch_element.ptr.B = B_.data();
+        const brgemm_dynamic_values_t dynamic_values(lda, ldb, ldc, ldc, M);
+        brgemm_kernel_execute(kernel, 1, &batch_element, C_.data(), nullptr,
+                &dynamic_values);
+        check(M);
+    }
+
+    ASSERT_EQ(brgemm_kernel_destroy(kernel), impl::status::success);
+}
+
+#ifdef DNNL_EXPERIMENTAL_UKERNEL
+TEST_F(brgemm_runtime_m_test_t, TestUkernelWithM) {
+    using namespace dnnl::ukernel;
+    using dt = memory::data_type;
+
+    SKIP_IF(brgemm::get_B_pack_type(dt::f32, dt::f32) != pack_type::no_trans,
+            "f32 B must not require packing.");
+
+    const std::vector<std::pair<memory::dim, memory::dim>> offsets {{0, 0}};
+    const int64_t M_fixed = 8;
+
+    // A runtime M object serves any M below, equal to and above M_fixed.
+    brgemm rt_brg(DNNL_RUNTIME_DIM_VAL, N, K, 1, lda, ldb, ldc, dt::f32,
+            dt::f32, dt::f32, /* allow_empty = */ true);
+    SKIP_IF(!rt_brg || !rt_brg.finalize(), "Runtime M is not supported.");
+    rt_brg.generate();
+    std::vector<uint8_t> scratchpad(rt_brg.get_scratchpad_size());
+
+    rt_brg.set_hw_context();
+    for (auto M : {M_fixed - 1, M_fixed, M_fixed + 1}) {
+        init(M);
+        rt_brg.execute(M, A_.data(), B_.data(), offsets, C_.data(),
+                scratchpad.data());
+        check(M);
+    }
+
+    // A fixed M object accepts only the value passed at creation.
+    brgemm brg(M_fixed, N, K, 1, lda, ldb, ldc, dt::f32, dt::f32, dt::f32);
+    ASSERT_TRUE(brg.finalize());
+    brg.generate();
+    scratchpad.resize(brg.get_scratchpad_size());
+    brg.set_hw_context();
+
+    init(M_fixed);
+    brg.execute(M_fixed, A_.data(), B_.data(), offsets, C_.data(),
+            scratchpad.data());
+    check(M_fixed);
+    for (auto M : {M_fixed - 1, M_fixed + 1}) {
+        init(M_fixed);
+        EXPECT_THROW(brg.execute(M, A_.data(), B_.data(), offsets, C_.data(),
+                             scratchpad.data()),
+                dnnl::error);
+    }
+
+    brgemm::release_hw_context();
+}
+#endif
+
 } // namespace dnnl
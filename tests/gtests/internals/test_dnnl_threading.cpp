@@ -29,6 +29,32 @@ TEST(test_parallel, Test) {
     });
 }
 
+TEST(test_parallel, TestNestedMaxThreadsLimit) {
+    const int old_limit = impl::get_max_threads_limit();
+    impl::set_max_threads_limit(0);
+    {
+        impl::max_threads_limit_guard_t outer(2);
+        ASSERT_EQ(impl::get_max_threads_limit(), 2);
+        {
+            // An inner guard cannot raise the outer limit.
+            impl::max_threads_limit_guard_t inner(4);
+            ASSERT_EQ(impl::get_max_threads_limit(), 2);
+        }
+        {
+            impl::max_threads_limit_guard_t inner(1);
+            ASSERT_EQ(impl::get_max_threads_limit(), 1);
+            impl::parallel(0, [&](int, int nthr) { ASSERT_EQ(nthr, 1); });
+        }
+        {
+            impl::max_threads_limit_guard_t inner(0);
+            ASSERT_EQ(impl::get_max_threads_limit(), 2);
+        }
+        ASSERT_EQ(impl::get_max_threads_limit(), 2);
+    }
+    ASSERT_EQ(impl::get_max_threads_limit(), 0);
+    impl::set_max_threads_limit(old_limit);
+}
+
 using data_t = ptrdiff_t;
 
 struct nd_params_t {
@@ -151,6 +177,13 @@ TEST_P(test_parallel_nd_t, Test) {
     CheckID();
 }
 
+TEST_P(test_parallel_nd_t, TestDynamicSchedule) {
+    const bool old_dynamic = impl::set_dynamic_nd_schedule(true);
+    emit_parallel_nd();
+    impl::set_dynamic_nd_schedule(old_dynamic);
+    CheckID();
+}
+
 CPU_INSTANTIATE_TEST_SUITE_P(Case, test_parallel_nd_t,
         ::testing::Values(np_t {{0}}, np_t {{1}}, np_t {{100}}, np_t {{0, 0}},
                 np_t {{1, 2}}, np_t {{10, 10}}, np_t {{0, 1, 0}},
@@ -0,0 +1,236 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "src/common/exec_trace.hpp"
+
+namespace dnnl {
+
+namespace exec_trace = impl::exec_trace;
+
+namespace {
+std::vector<char> read_file(const std::string &path) {
+    std::vector<char> data;
+    FILE *f = fopen(path.c_str(), "rb");
+    if (!f) return data;
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+        data.insert(data.end(), buf, buf + n);
+    fclose(f);
+    return data;
+}
+
+template <typename T>
+T read_value(const std::vector<char> &data, size_t &offset) {
+    T value;
+    std::memcpy(&value, data.data() + offset, sizeof(T));
+    offset += sizeof(T);
+    return value;
+}
+
+struct trace_t {
+    uint64_t primitive_id = 0;
+    std::map<uint64_t, std::string> names;
+    std::vector<std::vector<exec_trace::record_t>> threads;
+};
+
+// Dumps the recorded trace, disables it and decodes the dump. If `info` is
+// not empty, looks up the id of the primitive with this info string.
+void dump_and_decode(const std::string &info, trace_t &trace) {
+    const std::string path = "dnnl_exec_trace_test.bin";
+    ASSERT_EQ(exec_trace::dump(path.c_str()), impl::status::success);
+    exec_trace::set_capacity(0);
+    const auto data = read_file(path);
+    std::remove(path.c_str());
+
+    ASSERT_GE(data.size(), 16u);
+    ASSERT_EQ(std::memcmp(data.data(), "DNNLTRC1", 8), 0);
+    size_t offset = 8;
+    ASSERT_EQ(read_value<uint32_t>(data, offset), 3u);
+    ASSERT_EQ(read_value<uint32_t>(data, offset),
+            sizeof(exec_trace::record_t));
+
+    const auto n_primitives = read_value<uint64_t>(data, offset);
+    for (uint64_t i = 0; i < n_primitives; i++) {
+        const auto p_id = read_value<uint64_t>(data, offset);
+        const auto len = read_value<uint32_t>(data, offset);
+        std::string p_info(data.data() + offset, len);
+        offset += len;
+        trace.names[p_id] = p_info;
+        if (!info.empty() && p_info.find(info) != std::string::npos)
+            trace.primitive_id = p_id;
+    }
+    if (!info.empty()) {
+        ASSERT_NE(trace.primitive_id, 0u);
+    }
+
+    const auto n_threads = read_value<uint64_t>(data, offset);
+    for (uint64_t t = 0; t < n_threads; t++) {
+        read_value<uint32_t>(data, offset);
+        read_value<uint32_t>(data, offset);
+        const auto n_records = read_value<uint64_t>(data, offset);
+        std::vector<exec_trace::record_t> records;
+        for (uint64_t i = 0; i < n_records; i++)
+            records.push_back(read_value<exec_trace::record_t>(data, offset));
+        trace.threads.push_back(records);
+    }
+    ASSERT_EQ(offset, data.size());
+}
+
+// Executes a primitive `n_execs` times with the trace enabled and returns the
+// decoded trace.
+void run_and_decode(size_t capacity, int n_execs, trace_t &trace) {
+    engine eng(engine::kind::cpu, 0);
+    stream s(eng);
+
+    memory::desc md({4, 1024}, memory::data_type::f32, memory::format_tag::ab);
+    auto pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_relu, md, md);
+    eltwise_forward relu(pd);
+    memory src(md, eng), dst(md, eng);
+
+    exec_trace::set_capacity(capacity);
+    for (int i = 0; i < n_execs; i++)
+        relu.execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    s.wait();
+
+    dump_and_decode(pd.impl_info_str(), trace);
+}
+} // namespace
+
+TEST(exec_trace_test, TestRecords) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "This test requires CPU engine");
+    const int n_execs = 10;
+    trace_t trace;
+    run_and_decode(1024, n_execs, trace);
+
+    int n_exec_records = 0;
+    int n_kernel_tasks = 0;
+    for (const auto &records : trace.threads) {
+        uint64_t prev_start = 0;
+        for (const auto &r : records) {
+            ASSERT_EQ(r.primitive_id, trace.primitive_id);
+            ASSERT_LE(r.start_ns, r.end_ns);
+            if (r.kind == exec_trace::record_kind_t::exec) {
+                ASSERT_EQ(r.nargs, 2);
+                ASSERT_EQ(r.status, impl::status::success);
+                // Arguments are sorted by id.
+                ASSERT_EQ(r.args[0].arg, DNNL_ARG_SRC);
+                ASSERT_EQ(r.args[1].arg, DNNL_ARG_DST);
+                for (int i = 0; i < 2; i++) {
+                    ASSERT_EQ(r.args[i].data_type, dnnl_f32);
+                    ASSERT_EQ(r.args[i].format_kind, dnnl_blocked);
+                    ASSERT_EQ(r.args[i].ndims, 2);
+                    ASSERT_EQ(r.args[i].nelems, 4 * 1024);
+                }
+                ASSERT_LE(prev_start, r.start_ns);
+                prev_start = r.start_ns;
+                n_exec_records++;
+            } else {
+                ASSERT_EQ(r.kind, exec_trace::record_kind_t::task);
+                ASSERT_LE(0, r.ithr);
+                ASSERT_LT(r.ithr, r.nthr);
+                if (r.kernel_id != 0) {
+                    ASSERT_EQ(trace.names.count(r.kernel_id), 1u);
+                    ASSERT_EQ(trace.names[r.kernel_id].rfind("jit_", 0), 0u);
+                    n_kernel_tasks++;
+                }
+            }
+        }
+    }
+    ASSERT_EQ(n_exec_records, n_execs);
+    // Tasks of an x64 JIT implementation are attributed to its kernel.
+    const auto &p_info = trace.names[trace.primitive_id];
+    if (DNNL_X64 && p_info.find(",jit:") != std::string::npos) {
+        ASSERT_GT(n_kernel_tasks, 0);
+    }
+}
+
+TEST(exec_trace_test, TestRingBuffer) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "This test requires CPU engine");
+    const size_t capacity = 4;
+    trace_t trace;
+    run_and_decode(capacity, 10, trace);
+
+    ASSERT_FALSE(trace.threads.empty());
+    for (const auto &records : trace.threads)
+        ASSERT_LE(records.size(), capacity);
+}
+
+TEST(exec_trace_test, TestRingBufferWrapAround) {
+    // Records are pushed from this thread only, so its ring holds the newest
+    // records. The slot after the newest one may be in the middle of a write
+    // during a dump, so `capacity - 1` records are expected.
+    const size_t capacity = 4;
+    const int n_records = 10;
+    exec_trace::set_capacity(capacity);
+    for (int i = 0; i < n_records; i++)
+        exec_trace::record_task(0, i, i + 1, i, n_records);
+
+    trace_t trace;
+    dump_and_decode("", trace);
+    ASSERT_EQ(trace.threads.size(), 1u);
+    const auto &records = trace.threads[0];
+    ASSERT_EQ(records.size(), capacity - 1);
+    for (size_t i = 0; i < records.size(); i++) {
+        const int ithr = n_records - (int)(capacity - 1) + (int)i;
+        ASSERT_EQ(records[i].kind, exec_trace::record_kind_t::task);
+        ASSERT_EQ(records[i].ithr, ithr);
+        ASSERT_EQ(records[i].start_ns, (uint64_t)ithr);
+    }
+}
+
+TEST(exec_trace_test, TestChromeFormat) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "This test requires CPU engine");
+    engine eng(engine::kind::cpu, 0);
+    stream s(eng);
+
+    memory::desc md({16}, memory::data_type::f32, memory::format_tag::a);
+    auto pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_relu, md, md);
+    eltwise_forward relu(pd);
+    memory src(md, eng), dst(md, eng);
+
+    exec_trace::set_capacity(16);
+    relu.execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    s.wait();
+
+    const std::string path = "dnnl_exec_trace_test.json";
+    ASSERT_EQ(exec_trace::dump(path.c_str()), impl::status::success);
+    exec_trace::set_capacity(0);
+    const auto data = read_file(path);
+    std::remove(path.c_str());
+
+    const std::string json(data.begin(), data.end());
+    ASSERT_EQ(json.rfind("{\"traceEvents\":[", 0), 0u);
+    ASSERT_NE(json.find("\"cat\":\"primitive\""), std::string::npos);
+    ASSERT_NE(json.find(pd.impl_info_str()), std::string::npos);
+    ASSERT_NE(json.find("\"src0\":\"f32:1d:16\""), std::string::npos);
+}
+
+} // namespace dnnl
@@ -166,6 +166,40 @@ TEST(test_jit_float8_conversions, f8_e5m2_to_f32) {
     });
 }
 
+TEST(test_jit_float8_conversions, f8_e5m2_to_f16_vector) {
+    SKIP_IF(!impl::cpu::platform::has_data_type_support(
+                    impl::data_type::f8_e5m2),
+            "Engine does not support this data type.");
+
+    // Convert all 2^8 fp8 values a full vector at a time so that every
+    // value, including NaNs and infinities, goes through each lane.
+    constexpr int vlen = 32;
+    for (int shift = 0; shift < vlen; shift++) {
+        float8_e5m2_t x8[256];
+        for (int i = 0; i < 256; i++)
+            x8[i] = float8_e5m2_t(
+                    static_cast<uint8_t>((i + shift) & 0xff), true);
+        float16_t jit_x16[256];
+        for (int i = 0; i < 256; i += vlen)
+            ASSERT_TRUE(impl::cpu::x64::try_cvt_f8_e5m2_to_f16_x32(
+                    jit_x16 + i, x8 + i));
+
+        for (int i = 0; i < 256; i++) {
+            const uint16_t u16 = static_cast<uint16_t>(x8[i].raw_bits_) << 8;
+            const bool is_nan = (u16 & 0x7fff) > 0x7c00;
+            // NaNs are quieted, everything else is converted exactly.
+            const uint16_t expect = is_nan ? (u16 | 0x0200) : u16;
+            ASSERT_EQ(expect, bit_cast<uint16_t>(jit_x16[i]))
+                    << std::hex << "x8.raw_bits_ = "
+                    << static_cast<uint32_t>(x8[i].raw_bits_) << std::dec
+                    << " lane = " << i % vlen;
+            float16_t ref_x16 = x8[i];
+            ASSERT_EQ(bit_cast<uint16_t>(ref_x16),
+                    bit_cast<uint16_t>(jit_x16[i]));
+        }
+    }
+}
+
 TEST(test_jit_float8_conversions, f8_e4m3_to_f32) {
     SKIP_IF(!impl::cpu::platform::has_data_type_support(
                     impl::data_type::f8_e4m3),
@@ -0,0 +1,128 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <thread>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "src/common/scratchpad.hpp"
+
+namespace dnnl {
+
+namespace {
+impl::global_scratchpad_stats_t get_stats() {
+    impl::global_scratchpad_stats_t stats {};
+    impl::get_global_scratchpad_stats(&stats);
+    return stats;
+}
+
+// Strided convolution with dilation is commonly dispatched to a gemm-based
+// implementation that uses the global scratchpad.
+convolution_forward create_conv(const engine &eng) {
+    memory::desc src_md({1, 8, 34, 34}, memory::data_type::f32,
+            memory::format_tag::nchw);
+    memory::desc wei_md({8, 8, 3, 3}, memory::data_type::f32,
+            memory::format_tag::oihw);
+    memory::desc dst_md({1, 8, 15, 15}, memory::data_type::f32,
+            memory::format_tag::nchw);
+    auto pd = convolution_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::convolution_direct, src_md,
+            wei_md, memory::desc(), dst_md, memory::dims {2, 2},
+            memory::dims {1, 1}, memory::dims {0, 0}, memory::dims {0, 0});
+    return convolution_forward(pd);
+}
+} // namespace
+
+TEST(global_scratchpad_test, TestRetainLimit) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "This test requires CPU engine");
+    engine eng(engine::kind::cpu, 0);
+
+    const size_t old_limit = impl::set_global_scratchpad_retain_limit(0);
+    const int old_capacity = get_primitive_cache_capacity();
+    set_primitive_cache_capacity(0);
+
+    const auto s0 = get_stats();
+    { auto conv = create_conv(eng); }
+    const auto s1 = get_stats();
+    if (s1.n_allocations == s0.n_allocations) {
+        impl::set_global_scratchpad_retain_limit(old_limit);
+        set_primitive_cache_capacity(old_capacity);
+        SKIP_IF(true, "Implementation doesn't use the global scratchpad");
+    }
+
+    // Without retention, the buffer is allocated again.
+    { auto conv = create_conv(eng); }
+    const auto s2 = get_stats();
+    ASSERT_EQ(s2.n_allocations, s1.n_allocations + 1);
+
+    // With retention, the kept buffer is reused by the next primitive.
+    impl::set_global_scratchpad_retain_limit(size_t(1) << 30);
+    { auto conv = create_conv(eng); }
+    const auto s3 = get_stats();
+    { auto conv = create_conv(eng); }
+    const auto s4 = get_stats();
+    ASSERT_EQ(s4.n_allocations, s3.n_allocations);
+    ASSERT_EQ(s4.n_reuses, s3.n_reuses + 1);
+
+    // Lowering the limit releases the buffer when the last user is gone.
+    impl::set_global_scratchpad_retain_limit(1);
+    { auto conv = create_conv(eng); }
+    const auto s5 = get_stats();
+    ASSERT_EQ(s5.n_trims, s4.n_trims + 1);
+
+    impl::set_global_scratchpad_retain_limit(old_limit);
+    set_primitive_cache_capacity(old_capacity);
+}
+
+TEST(global_scratchpad_test, TestRetainAcrossThreads) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "This test requires CPU engine");
+    engine eng(engine::kind::cpu, 0);
+
+    const size_t old_limit
+            = impl::set_global_scratchpad_retain_limit(size_t(1) << 30);
+    const int old_capacity = get_primitive_cache_capacity();
+    set_primitive_cache_capacity(0);
+
+    // A buffer kept after its last user is gone does not belong to the
+    // thread, so it outlives the thread and is reused by another one.
+    const auto s0 = get_stats();
+    std::thread t([&]() { auto conv = create_conv(eng); });
+    t.join();
+    const auto s1 = get_stats();
+    if (s1.n_allocations == s0.n_allocations) {
+        impl::set_global_scratchpad_retain_limit(old_limit);
+        set_primitive_cache_capacity(old_capacity);
+        SKIP_IF(true, "Implementation doesn't use the global scratchpad");
+    }
+
+    { auto conv = create_conv(eng); }
+    const auto s2 = get_stats();
+    ASSERT_EQ(s2.n_allocations, s1.n_allocations);
+    ASSERT_EQ(s2.n_reuses, s1.n_reuses + 1);
+
+    // Lowering the limit releases the kept buffer right away.
+    impl::set_global_scratchpad_retain_limit(0);
+    const auto s3 = get_stats();
+    ASSERT_EQ(s3.n_trims, s2.n_trims + 1);
+
+    impl::set_global_scratchpad_retain_limit(old_limit);
+    set_primitive_cache_capacity(old_capacity);
+}
+
+} // namespace dnnl
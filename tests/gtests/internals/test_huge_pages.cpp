@@ -0,0 +1,58 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdint>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "src/cpu/huge_pages.hpp"
+
+namespace dnnl {
+
+namespace huge_pages = impl::cpu::huge_pages;
+
+#if defined(__linux__) && DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+TEST(huge_pages_test, TestAllocation) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "This test requires CPU engine");
+    engine eng(engine::kind::cpu, 0);
+
+    const size_t huge_page_size = size_t(2) << 20;
+    const memory::dim n = 3 * huge_page_size / sizeof(float);
+    memory::desc md({n}, memory::data_type::f32, memory::format_tag::a);
+
+    for (auto p : {huge_pages::policy_t::thp, huge_pages::policy_t::hugetlb}) {
+        const auto old_policy = huge_pages::set_policy(p);
+        memory mem(md, eng);
+        float *ptr = static_cast<float *>(mem.get_data_handle());
+        huge_pages::set_policy(old_policy);
+
+        ASSERT_NE(ptr, nullptr);
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % huge_page_size, 0u);
+        ptr[0] = 1.f;
+        ptr[n - 1] = 2.f;
+        ASSERT_EQ(ptr[0] + ptr[n - 1], 3.f);
+    }
+
+    // Small buffers keep the regular allocation.
+    const auto old_policy = huge_pages::set_policy(huge_pages::policy_t::thp);
+    ASSERT_EQ(huge_pages::malloc(64), nullptr);
+    huge_pages::set_policy(old_policy);
+}
+#endif
+
+} // namespace dnnl
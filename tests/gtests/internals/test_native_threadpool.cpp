@@ -0,0 +1,160 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl_config.h"
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL \
+        && defined(DNNL_ENABLE_NATIVE_THREADPOOL)
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "src/cpu/native_threadpool.hpp"
+
+namespace dnnl {
+
+namespace {
+using threadpool_iface = threadpool_interop::threadpool_iface;
+
+std::unique_ptr<threadpool_iface> create_pool(int nthr, int spin_us = 50) {
+    return std::unique_ptr<threadpool_iface>(
+            impl::cpu::native_threadpool::create(nthr, spin_us, false));
+}
+
+// Runs `n` tasks and checks that each of them is executed exactly once with
+// the right task count.
+void check_partitioning(threadpool_iface *tp, int n) {
+    std::vector<std::atomic<int>> counts(n);
+    for (auto &c : counts)
+        c.store(0);
+    std::atomic<int> n_bad_counts {0};
+    tp->parallel_for(n, [&](int i, int nn) {
+        if (nn != n || i < 0 || i >= n) {
+            n_bad_counts++;
+            return;
+        }
+        counts[i]++;
+    });
+    ASSERT_EQ(n_bad_counts.load(), 0);
+    for (int i = 0; i < n; i++)
+        ASSERT_EQ(counts[i].load(), 1) << "task " << i << " of " << n;
+}
+} // namespace
+
+class native_threadpool_test_t : public ::testing::TestWithParam<int> {};
+
+TEST_P(native_threadpool_test_t, TestPartitioning) {
+    const int nthr = GetParam();
+    auto tp = create_pool(nthr);
+    ASSERT_EQ(tp->get_num_threads(), nthr);
+    ASSERT_FALSE(tp->get_in_parallel());
+    for (int n : {0, 1, 2, nthr - 1, nthr, nthr + 1, 7 * nthr + 3, 1000})
+        check_partitioning(tp.get(), n);
+}
+
+TEST_P(native_threadpool_test_t, TestUnbalancedTasks) {
+    // Tasks of the first thread are much longer than the others, so the idle
+    // threads have to steal them.
+    const int nthr = GetParam();
+    const int n = 16 * nthr;
+    auto tp = create_pool(nthr);
+    std::vector<std::atomic<int>> counts(n);
+    for (auto &c : counts)
+        c.store(0);
+    tp->parallel_for(n, [&](int i, int) {
+        if (i < n / nthr)
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        counts[i]++;
+    });
+    for (int i = 0; i < n; i++)
+        ASSERT_EQ(counts[i].load(), 1);
+}
+
+TEST_P(native_threadpool_test_t, TestNested) {
+    // A nested call from a task runs inline on the calling thread.
+    const int nthr = GetParam();
+    const int n_outer = 2 * nthr + 1;
+    const int n_inner = 5;
+    auto tp = create_pool(nthr);
+    std::vector<std::atomic<int>> counts(n_outer * n_inner);
+    for (auto &c : counts)
+        c.store(0);
+    std::atomic<int> n_not_in_parallel {0};
+    std::atomic<int> n_moved_threads {0};
+    tp->parallel_for(n_outer, [&](int i, int) {
+        if (!tp->get_in_parallel()) n_not_in_parallel++;
+        const auto tid = std::this_thread::get_id();
+        tp->parallel_for(n_inner, [&](int j, int nn) {
+            if (std::this_thread::get_id() != tid || nn != n_inner)
+                n_moved_threads++;
+            counts[i * n_inner + j]++;
+        });
+    });
+    ASSERT_FALSE(tp->get_in_parallel());
+    ASSERT_EQ(n_not_in_parallel.load(), 0);
+    ASSERT_EQ(n_moved_threads.load(), 0);
+    for (size_t i = 0; i < counts.size(); i++)
+        ASSERT_EQ(counts[i].load(), 1);
+}
+
+TEST_P(native_threadpool_test_t, TestConcurrentSubmission) {
+    // Calls from different threads are serialized and all complete.
+    const int nthr = GetParam();
+    auto tp = create_pool(nthr);
+    std::vector<std::thread> submitters;
+    for (int t = 0; t < 4; t++)
+        submitters.emplace_back([&]() {
+            for (int k = 0; k < 10; k++)
+                check_partitioning(tp.get(), 3 * nthr + k);
+        });
+    for (auto &s : submitters)
+        s.join();
+}
+
+TEST_P(native_threadpool_test_t, TestShutdown) {
+    const int nthr = GetParam();
+    // A pool that never ran anything.
+    { auto tp = create_pool(nthr); }
+    // A pool destroyed right after a call, while its workers are spinning.
+    {
+        auto tp = create_pool(nthr);
+        check_partitioning(tp.get(), 100);
+    }
+    // A pool destroyed while its workers are sleeping.
+    {
+        auto tp = create_pool(nthr, 0);
+        check_partitioning(tp.get(), 100);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    // Pools created and destroyed back to back.
+    for (int k = 0; k < 20; k++) {
+        auto tp = create_pool(nthr, k % 2 ? 0 : 50);
+        if (k % 3) check_partitioning(tp.get(), nthr + k);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+        Threads, native_threadpool_test_t, ::testing::Values(1, 2, 3, 8));
+
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,183 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <dirent.h>
+#include <unistd.h>
+#endif
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "sdpa_internal.hpp"
+
+#include "src/common/primitive_disk_cache.hpp"
+#include "src/common/sdpa_types.hpp"
+
+namespace dnnl {
+
+namespace disk_cache = impl::primitive_disk_cache;
+
+#ifndef _WIN32
+class primitive_disk_cache_test_t : public ::testing::Test {
+protected:
+    void SetUp() override {
+        SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+                "This test requires CPU engine");
+        char dir_template[] = "/tmp/dnnl_disk_cache_XXXXXX";
+        ASSERT_NE(mkdtemp(dir_template), nullptr);
+        dir_ = dir_template;
+        saved_dir_ = disk_cache::get_dir();
+        saved_capacity_ = get_primitive_cache_capacity();
+        disk_cache::set_dir(dir_);
+    }
+
+    void TearDown() override {
+        if (dir_.empty()) return;
+        disk_cache::set_dir(saved_dir_);
+        set_primitive_cache_capacity(saved_capacity_);
+        for (const auto &f : entries())
+            std::remove(f.c_str());
+        rmdir(dir_.c_str());
+    }
+
+    std::vector<std::string> entries() const {
+        std::vector<std::string> files;
+        DIR *d = opendir(dir_.c_str());
+        if (!d) return files;
+        while (const dirent *e = readdir(d)) {
+            const std::string name = e->d_name;
+            if (name != "." && name != "..") files.push_back(dir_ + "/" + name);
+        }
+        closedir(d);
+        return files;
+    }
+
+    static void drop_in_memory_cache() {
+        const int capacity = get_primitive_cache_capacity();
+        set_primitive_cache_capacity(0);
+        set_primitive_cache_capacity(capacity);
+    }
+
+    std::string dir_, saved_dir_;
+    int saved_capacity_ = 0;
+};
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(primitive_disk_cache_test_t, TestSDPARoundTrip) {
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+
+    const memory::dim mb = 1, heads = 2, queries = 20, keys = 70, D = 32;
+    memory::desc q_md({mb, heads, queries, D}, memory::data_type::f32,
+            memory::format_tag::abcd);
+    memory::desc k_md({mb, heads, D, keys}, memory::data_type::f32,
+            memory::format_tag::abdc);
+    memory::desc v_md({mb, heads, keys, D}, memory::data_type::f32,
+            memory::format_tag::abcd);
+    memory::desc scale_md({1}, memory::data_type::f32, memory::format_tag::a);
+
+    auto create_pd = [&]() {
+        return impl::sdpa::primitive_desc(eng, q_md, k_md, v_md, nullptr,
+                memory::data_type::f32, q_md, /* invert_scale = */ true, heads,
+                impl::attn_mask_type::top_left,
+                impl::alg_kind::softmax_accurate_inf_as_zero);
+    };
+
+    impl::sdpa::primitive_desc pd;
+    try {
+        pd = create_pd();
+    } catch (const dnnl::error &e) {
+        if (e.status == dnnl_unimplemented)
+            GTEST_SKIP() << "Unimplemented: " << e.what();
+        throw;
+    }
+
+    std::vector<float> q(q_md.get_size() / sizeof(float));
+    std::vector<float> k(k_md.get_size() / sizeof(float));
+    std::vector<float> v(v_md.get_size() / sizeof(float));
+    for (size_t i = 0; i < q.size(); i++)
+        q[i] = ((i * 13) % 17) / 17.f - 0.5f;
+    for (size_t i = 0; i < k.size(); i++)
+        k[i] = ((i * 7) % 11) / 11.f - 0.5f;
+    for (size_t i = 0; i < v.size(); i++)
+        v[i] = ((i * 5) % 23) / 23.f - 0.5f;
+    float scale = 8.f;
+
+    memory q_mem(q_md, eng, q.data()), k_mem(k_md, eng, k.data()),
+            v_mem(v_md, eng, v.data()), scale_mem(scale_md, eng, &scale);
+    auto run = [&](const impl::sdpa &prim) {
+        memory dst_mem(q_md, eng);
+        prim.execute(strm,
+                {{DNNL_ARG_QUERIES, q_mem}, {DNNL_ARG_KEYS, k_mem},
+                        {DNNL_ARG_VALUES, v_mem}, {DNNL_ARG_SCALE, scale_mem},
+                        {DNNL_ARG_DST, dst_mem}});
+        strm.wait();
+        const float *ptr
+                = static_cast<const float *>(dst_mem.get_data_handle());
+        return std::vector<float>(ptr, ptr + q.size());
+    };
+
+    drop_in_memory_cache();
+    const auto ref = run(impl::sdpa(pd));
+
+    // Implementations without cache blob support don't leave any entries.
+    const auto files = entries();
+    if (files.empty()) GTEST_SKIP() << "Cache blobs are not supported";
+    ASSERT_EQ(files.size(), 1u);
+
+    // A miss in the in-memory cache is served from disk.
+    drop_in_memory_cache();
+    ASSERT_EQ(run(impl::sdpa(create_pd())), ref);
+    ASSERT_EQ(entries().size(), 1u);
+
+    // A truncated entry is ignored and the primitive is generated again.
+    FILE *f = fopen(files[0].c_str(), "wb");
+    ASSERT_NE(f, nullptr);
+    const char garbage[] = "garbage";
+    fwrite(garbage, 1, sizeof(garbage), f);
+    fclose(f);
+    drop_in_memory_cache();
+    ASSERT_EQ(run(impl::sdpa(create_pd())), ref);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(primitive_disk_cache_test_t, TestBinaryRoundTrip) {
+    const std::vector<uint8_t> id = {1, 2, 3, 4};
+    const std::vector<uint8_t> other_id = {1, 2, 3, 5};
+    const std::vector<uint8_t> binary = {42, 0, 17, 255, 8};
+
+    std::vector<uint8_t> loaded;
+    ASSERT_FALSE(disk_cache::load(id, loaded));
+
+    disk_cache::store(id, binary);
+    ASSERT_EQ(entries().size(), 1u);
+    ASSERT_TRUE(disk_cache::load(id, loaded));
+    ASSERT_EQ(loaded, binary);
+
+    // Entries are only served for the exact ID they were stored with.
+    ASSERT_FALSE(disk_cache::load(other_id, loaded));
+
+    // Empty binaries are not stored.
+    disk_cache::store(other_id, {});
+    ASSERT_EQ(entries().size(), 1u);
+}
+#endif
+
+} // namespace dnnl
@@ -858,6 +858,24 @@ INSTANTIATE_TEST_SUITE_P(DataTypes_f16_s8,
                     sdpa_dims_t{   1,       2,        2,    385,      1,     128,   128,     128,  mdt::f16,  mdt::f16,   mdt::s8,   mdt::f32,    mdt::s8,   mdt::s8,   mdt::f32,    mdt::s8,  mdt::f16, quantize_type::per_token,        no_key_transposed, mask_type::twoD }
     ), &print_to_string);
 
+INSTANTIATE_TEST_SUITE_P(DataTypes_f16_f8,
+    sdpa_test_t,
+                              //  mb,  hd_num,kv_hd_num,seq_len,qry_num, hd_size, kg_sz, vgrp_sz,        dt,       qdt,       kdt,       ksdt,       kzpdt,       vdt,       vsdt,      vzpdt,     mskdt,                    qtype
+    testing::Values(
+                    sdpa_dims_t{   1,       2,        2,    384,    384,     128,   128,     128,  mdt::f16,  mdt::f16, mdt::f8_e4m3, mdt::undef, mdt::undef, mdt::f8_e4m3, mdt::undef, mdt::undef,  mdt::f16, quantize_type::no_quantization,  no_key_transposed, mask_type::twoD },
+                    sdpa_dims_t{   1,       2,        2,    385,      1,     128,   128,     128,  mdt::f16,  mdt::f16, mdt::f8_e4m3, mdt::undef, mdt::undef, mdt::f8_e4m3, mdt::undef, mdt::undef,  mdt::f16, quantize_type::no_quantization,  no_key_transposed, mask_type::twoD },
+                    sdpa_dims_t{   1,       2,        2,    384,    384,     128,   128,     128,  mdt::f16,  mdt::f16, mdt::f8_e4m3,   mdt::f16, mdt::undef, mdt::f8_e4m3,   mdt::f16, mdt::undef,  mdt::f16, quantize_type::per_token,  no_key_transposed, mask_type::twoD },
+                    sdpa_dims_t{   1,       2,        2,    385,      1,     128,   128,     128,  mdt::f16,  mdt::f16, mdt::f8_e4m3,   mdt::f16, mdt::undef, mdt::f8_e4m3,   mdt::f16, mdt::undef,  mdt::f16, quantize_type::per_token,  no_key_transposed, mask_type::twoD },
+                    sdpa_dims_t{   1,       2,        2,    384,    384,     128,    32,      32,  mdt::f16,  mdt::f16, mdt::f8_e4m3,   mdt::f16, mdt::undef, mdt::f8_e4m3,   mdt::f16, mdt::undef,  mdt::f16, quantize_type::per_token_with_groups,  no_key_transposed, mask_type::twoD },
+                    sdpa_dims_t{   1,       2,        2,    385,      1,     128,    32,      32,  mdt::f16,  mdt::f16, mdt::f8_e4m3,   mdt::f16, mdt::undef, mdt::f8_e4m3,   mdt::f16, mdt::undef,  mdt::f16, quantize_type::per_token_with_groups,  no_key_transposed, mask_type::twoD },
+                    sdpa_dims_t{   1,       2,        2,    384,    384,     128,   128,     128,  mdt::f16,  mdt::f16, mdt::f8_e5m2, mdt::undef, mdt::undef, mdt::f8_e5m2, mdt::undef, mdt::undef,  mdt::f16, quantize_type::no_quantization,  no_key_transposed, mask_type::twoD },
+                    sdpa_dims_t{   1,       2,        2,    385,      1,     128,   128,     128,  mdt::f16,  mdt::f16, mdt::f8_e5m2, mdt::undef, mdt::undef, mdt::f8_e5m2, mdt::undef, mdt::undef,  mdt::f16, quantize_type::no_quantization,  no_key_transposed, mask_type::twoD },
+                    sdpa_dims_t{   1,       2,        2,    384,    384,     128,   128,     128,  mdt::f16,  mdt::f16, mdt::f8_e5m2,   mdt::f16, mdt::undef, mdt::f8_e5m2,   mdt::f16, mdt::undef,  mdt::f16, quantize_type::per_token,  no_key_transposed, mask_type::twoD },
+                    sdpa_dims_t{   1,       2,        2,    385,      1,     128,   128,     128,  mdt::f16,  mdt::f16, mdt::f8_e5m2,   mdt::f16, mdt::undef, mdt::f8_e5m2,   mdt::f16, mdt::undef,  mdt::f16, quantize_type::per_token,  no_key_transposed, mask_type::twoD },
+                    sdpa_dims_t{   1,       2,        2,    384,    384,     128,    32,      32,  mdt::f16,  mdt::f16, mdt::f8_e5m2,   mdt::f16, mdt::undef, mdt::f8_e5m2,   mdt::f16, mdt::undef,  mdt::f16, quantize_type::per_token_with_groups,  no_key_transposed, mask_type::twoD },
+                    sdpa_dims_t{   1,       2,        2,    385,      1,     128,    32,      32,  mdt::f16,  mdt::f16, mdt::f8_e5m2,   mdt::f16, mdt::undef, mdt::f8_e5m2,   mdt::f16, mdt::undef,  mdt::f16, quantize_type::per_token_with_groups,  no_key_transposed, mask_type::twoD }
+    ), &print_to_string);
+
 INSTANTIATE_TEST_SUITE_P(DataTypes_f16_s4,
     sdpa_test_t,
                               //  mb,  hd_num,kv_hd_num,seq_len,qry_num, hd_size, kg_sz, vgrp_sz,        dt,       qdt,       kdt,       ksdt,      kzpdt,       vdt,       vsdt,      vzpdt,     mskdt,                    qtype
@@ -0,0 +1,346 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <dnnl_test_common.hpp>
+#include <gtest/gtest.h>
+
+#include "sdpa_internal.hpp"
+#include "test_utils.hpp"
+
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using mdt = memory::data_type;
+using tag = memory::format_tag;
+
+enum class bwd_mask_type { no_mask, twoD, causal_tl, causal_br };
+
+struct sdpa_bwd_dims_t {
+    memory::dim mb;
+    memory::dim head_num;
+    memory::dim kv_head_num;
+    memory::dim query_num;
+    memory::dim key_num;
+    memory::dim head_size;
+    mdt dt;
+    bwd_mask_type mask;
+};
+
+std::ostream &operator<<(std::ostream &ss, const sdpa_bwd_dims_t &p) {
+    ss << "mb_" << p.mb << "_H_" << p.head_num << "_KVH_" << p.kv_head_num
+       << "_Q_" << p.query_num << "_K_" << p.key_num << "_D_" << p.head_size
+       << "_" << dnnl_dt2str(memory::convert_to_c(p.dt));
+    switch (p.mask) {
+        case bwd_mask_type::no_mask: ss << "_no_mask"; break;
+        case bwd_mask_type::twoD: ss << "_mask2D"; break;
+        case bwd_mask_type::causal_tl: ss << "_causal_tl"; break;
+        case bwd_mask_type::causal_br: ss << "_causal_br"; break;
+    }
+    return ss;
+}
+
+std::string print_to_string(
+        const ::testing::TestParamInfo<sdpa_bwd_dims_t> &info) {
+    std::stringstream ss;
+    ss << info.param;
+    return ss.str();
+}
+
+namespace {
+
+// Host reference of the sdpa forward and backward passes in double precision.
+// Q and dO are (mb, H, Q, D), K is (mb, KVH, D, K) and V is (mb, KVH, K, D).
+struct sdpa_bwd_ref_t {
+    sdpa_bwd_ref_t(const sdpa_bwd_dims_t &p) : p(p) {}
+
+    void compute(const std::vector<float> &q, const std::vector<float> &k,
+            const std::vector<float> &v, const std::vector<float> &mask,
+            const std::vector<float> &ddst, float scale) {
+        const auto Q = p.query_num, K = p.key_num, D = p.head_size;
+        const auto group = p.head_num / p.kv_head_num;
+
+        stats.assign(p.mb * p.head_num * Q, 0.f);
+        dq.assign(q.size(), 0.f);
+        dk.assign(k.size(), 0.f);
+        dv.assign(v.size(), 0.f);
+
+        std::vector<double> prob(K), dprob(K);
+        for_(memory::dim b1 = 0; b1 < p.mb; b1++)
+        for (memory::dim b0 = 0; b0 < p.head_num; b0++) {
+            const auto b0_kv = b0 / group;
+            const float *qp = &q[(b1 * p.head_num + b0) * Q * D];
+            const float *dop = &ddst[(b1 * p.head_num + b0) * Q * D];
+            const float *kp = &k[(b1 * p.kv_head_num + b0_kv) * D * K];
+            const float *vp = &v[(b1 * p.kv_head_num + b0_kv) * K * D];
+            float *dqp = &dq[(b1 * p.head_num + b0) * Q * D];
+            float *dkp = &dk[(b1 * p.kv_head_num + b0_kv) * D * K];
+            float *dvp = &dv[(b1 * p.kv_head_num + b0_kv) * K * D];
+
+            for (memory::dim i = 0; i < Q; i++) {
+                double max = -std::numeric_limits<double>::infinity();
+                for (memory::dim j = 0; j < K; j++) {
+                    double s = 0;
+                    for (memory::dim h = 0; h < D; h++)
+                        s += (double)qp[i * D + h] * kp[h * K + j];
+                    s *= scale;
+                    if (p.mask == bwd_mask_type::twoD) s += mask[i * K + j];
+                    if (masked_out(i, j))
+                        s = -std::numeric_limits<double>::infinity();
+                    prob[j] = s;
+                    max = std::max(max, s);
+                }
+                double sum = 0;
+                for (memory::dim j = 0; j < K; j++) {
+                    prob[j] = std::exp(prob[j] - max);
+                    sum += prob[j];
+                }
+                stats[(b1 * p.head_num + b0) * Q + i]
+                        = (float)(max + std::log(sum));
+
+                // delta = rowsum(dO .* O)
+                double delta = 0;
+                for (memory::dim j = 0; j < K; j++) {
+                    prob[j] /= sum;
+                    double dp = 0;
+                    for (memory::dim h = 0; h < D; h++)
+                        dp += (double)dop[i * D + h] * vp[j * D + h];
+                    dprob[j] = dp;
+                    delta += prob[j] * dp;
+                }
+                for (memory::dim j = 0; j < K; j++) {
+                    double ds = prob[j] * (dprob[j] - delta) * scale;
+                    for (memory::dim h = 0; h < D; h++) {
+                        dqp[i * D + h] += (float)(ds * kp[h * K + j]);
+                        dkp[h * K + j] += (float)(ds * qp[i * D + h]);
+                        dvp[j * D + h] += (float)(prob[j] * dop[i * D + h]);
+                    }
+                }
+            }
+        }
+    }
+
+    bool masked_out(memory::dim i, memory::dim j) const {
+        switch (p.mask) {
+            case bwd_mask_type::causal_tl: return j > i;
+            case bwd_mask_type::causal_br:
+                return j > i + (p.key_num - p.query_num);
+            default: return false;
+        }
+    }
+
+    sdpa_bwd_dims_t p;
+    std::vector<float> stats, dq, dk, dv;
+};
+
+int to_attn_mask_type(bwd_mask_type t) {
+    using namespace dnnl::impl::attn_mask_type;
+    switch (t) {
+        case bwd_mask_type::causal_tl: return static_cast<int>(top_left);
+        case bwd_mask_type::causal_br: return static_cast<int>(bottom_right);
+        default: return static_cast<int>(buffer);
+    }
+}
+
+std::vector<float> read_f32(
+        memory &mem, dnnl::engine &eng, dnnl::stream &strm) {
+    memory mem_f32({mem.get_desc().get_dims(), mdt::f32,
+                           mem.get_desc().get_strides()},
+            eng);
+    dnnl::reorder(mem, mem_f32).execute(strm, mem, mem_f32);
+    strm.wait();
+    auto ptr = map_memory<float>(mem_f32);
+    const float *data = ptr;
+    return std::vector<float>(
+            data, data + product(mem.get_desc().get_dims()));
+}
+
+void check(const std::vector<float> &gold, const std::vector<float> &test,
+        float threshold, const char *name) {
+    ASSERT_EQ(gold.size(), test.size());
+    int mismatches = 0;
+    for (size_t i = 0; i < gold.size(); i++) {
+        float abs_diff = std::abs(gold[i] - test[i]);
+        float rel_diff = abs_diff / std::max(std::abs(gold[i]), 1.f);
+        if (!(rel_diff <= threshold) && mismatches++ < 32) {
+            ADD_FAILURE() << name << "[" << i << "]: gold " << gold[i]
+                          << " test " << test[i];
+        }
+    }
+    ASSERT_EQ(mismatches, 0) << name;
+}
+
+} // namespace
+
+class sdpa_bwd_test_t : public ::testing::TestWithParam<sdpa_bwd_dims_t> {
+public:
+    void SetUp() override {
+#ifdef DNNL_SYCL_CUDA
+        GTEST_SKIP() << "SDPA primitive tests do not support CUDA";
+#endif
+#ifdef DNNL_SYCL_HIP
+        GTEST_SKIP() << "SDPA primitive tests do not support HIP";
+#endif
+#ifdef DNNL_TEST_WITH_ENGINE_PARAM
+        SKIP_IF(get_test_engine_kind() != dnnl::engine::kind::gpu,
+                "This test requires GPU engine");
+        eng = get_test_engine();
+#else
+        SKIP_IF(dnnl::engine::get_count(dnnl::engine::kind::gpu) == 0,
+                "SDPA tests require gpus.");
+        eng = dnnl::engine(dnnl::engine::kind::gpu, 0);
+#endif
+        strm = dnnl::stream(eng);
+        p = GetParam();
+    }
+
+protected:
+    dnnl::engine eng;
+    dnnl::stream strm;
+    sdpa_bwd_dims_t p;
+};
+
+GPU_TEST_P(sdpa_bwd_test_t, compare) {
+    using namespace dnnl::impl;
+    const auto Q = p.query_num, K = p.key_num, D = p.head_size;
+
+    memory::desc q_md({p.mb, p.head_num, Q, D}, p.dt, tag::abcd);
+    memory::desc k_md({p.mb, p.kv_head_num, D, K}, p.dt, tag::abdc);
+    memory::desc v_md({p.mb, p.kv_head_num, K, D}, p.dt, tag::abcd);
+    memory::desc dst_md({p.mb, p.head_num, Q, D}, p.dt, tag::abcd);
+    memory::desc mask_md({1, 1, Q, K}, p.dt, tag::abcd);
+    memory::desc stats_md({p.mb, p.head_num, Q, 1}, mdt::f32, tag::abcd);
+    memory::desc scale_md({1, 1, 1, 1}, mdt::f32, tag::abcd);
+
+    std::vector<float> q_data(product(q_md.get_dims()));
+    std::vector<float> k_data(product(k_md.get_dims()));
+    std::vector<float> v_data(product(v_md.get_dims()));
+    std::vector<float> ddst_data(product(dst_md.get_dims()));
+    std::vector<float> mask_data(product(mask_md.get_dims()));
+    fill_random(q_data, q_md);
+    fill_random(k_data, k_md);
+    fill_random(v_data, v_md);
+    fill_random(ddst_data, dst_md);
+    fill_random(mask_data, mask_md);
+
+    // Round the inputs to the tested data type so that the reference and
+    // the library consume the same values.
+    auto round = [&](std::vector<float> &data) {
+        for (auto &e : data) {
+            if (p.dt == mdt::f16)
+                e = (float)float16_t(e);
+            else if (p.dt == mdt::bf16)
+                e = (float)bfloat16_t(e);
+        }
+    };
+    round(q_data);
+    round(k_data);
+    round(v_data);
+    round(ddst_data);
+    round(mask_data);
+
+    // K is stored with keys innermost in both the reference and the memory.
+    memory q_mem(q_md, eng), k_mem(k_md, eng), v_mem(v_md, eng);
+    memory dst_mem(dst_md, eng), ddst_mem(dst_md, eng);
+    memory mask_mem(mask_md, eng), stats_mem(stats_md, eng);
+    memory scale_mem(scale_md, eng);
+    memory dq_mem(q_md, eng), dk_mem(k_md, eng), dv_mem(v_md, eng);
+
+    const float scale = std::sqrt((float)D);
+    write_to_dnnl_memory(q_data.data(), q_mem, eng, strm);
+    write_to_dnnl_memory(k_data.data(), k_mem, eng, strm);
+    write_to_dnnl_memory(v_data.data(), v_mem, eng, strm);
+    write_to_dnnl_memory(ddst_data.data(), ddst_mem, eng, strm);
+    write_to_dnnl_memory(mask_data.data(), mask_mem, eng, strm);
+    write_to_dnnl_memory(&scale, scale_mem, eng, strm);
+
+    const bool with_mask = p.mask == bwd_mask_type::twoD;
+    const memory::desc *mask_ptr = with_mask ? &mask_md : nullptr;
+
+    sdpa::primitive_desc fwd_pd;
+    sdpa_backward::primitive_desc bwd_pd;
+    try {
+        fwd_pd = sdpa::primitive_desc(eng, q_md, k_md, v_md, mask_ptr,
+                stats_md, mdt::f32, dst_md, /* invert_scale = */ true,
+                p.kv_head_num, to_attn_mask_type(p.mask),
+                alg_kind::softmax_accurate_inf_as_zero);
+        bwd_pd = sdpa_backward::primitive_desc(
+                eng, q_md, k_md, v_md, dst_md, fwd_pd);
+    } catch (const dnnl::error &e) {
+        if (e.status == dnnl_unimplemented)
+            GTEST_SKIP() << "Unimplemented: " << e.what();
+        else
+            throw;
+    }
+
+    std::unordered_map<int, memory> fwd_args
+            = {{DNNL_ARG_QUERIES, q_mem}, {DNNL_ARG_KEYS, k_mem},
+                    {DNNL_ARG_VALUES, v_mem}, {DNNL_ARG_DST, dst_mem},
+                    {DNNL_ARG_ATTN_STATS, stats_mem},
+                    {DNNL_ARG_SCALE, scale_mem}};
+    if (with_mask) fwd_args[DNNL_ARG_ATTN_MASK] = mask_mem;
+    sdpa(fwd_pd).execute(strm, fwd_args);
+
+    std::unordered_map<int, memory> bwd_args = fwd_args;
+    bwd_args[DNNL_ARG_DIFF_DST] = ddst_mem;
+    bwd_args[DNNL_ARG_DIFF_QUERIES] = dq_mem;
+    bwd_args[DNNL_ARG_DIFF_KEYS] = dk_mem;
+    bwd_args[DNNL_ARG_DIFF_VALUES] = dv_mem;
+    sdpa_backward(bwd_pd).execute(strm, bwd_args);
+    strm.wait();
+
+    sdpa_bwd_ref_t ref(p);
+    ref.compute(q_data, k_data, v_data, mask_data, ddst_data, 1.f / scale);
+
+    const float threshold = p.dt == mdt::f32 ? 1e-4f
+            : p.dt == mdt::f16                ? 1e-2f
+                                              : 5e-2f;
+    check(ref.stats, read_f32(stats_mem, eng, strm), threshold, "stats");
+    check(ref.dq, read_f32(dq_mem, eng, strm), threshold, "dQ");
+    check(ref.dk, read_f32(dk_mem, eng, strm), threshold, "dK");
+    check(ref.dv, read_f32(dv_mem, eng, strm), threshold, "dV");
+}
+
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(AllMaskTypes,
+    sdpa_bwd_test_t,
+                           // mb, hd_num, kv_hd_num, q_num, k_num, hd_size, dt, mask
+    testing::Values(
+                    sdpa_bwd_dims_t{ 1,  2,  2,  32,  32,  32, mdt::f16, bwd_mask_type::no_mask },
+                    sdpa_bwd_dims_t{ 1,  2,  2,  32,  32,  32, mdt::f16, bwd_mask_type::twoD },
+                    sdpa_bwd_dims_t{ 1,  2,  2,  32,  32,  32, mdt::f16, bwd_mask_type::causal_tl },
+                    sdpa_bwd_dims_t{ 1,  2,  2,  16,  48,  32, mdt::f16, bwd_mask_type::causal_br }
+    ), &print_to_string);
+
+INSTANTIATE_TEST_SUITE_P(DataTypes,
+    sdpa_bwd_test_t,
+                           // mb, hd_num, kv_hd_num, q_num, k_num, hd_size, dt, mask
+    testing::Values(
+                    sdpa_bwd_dims_t{ 2,  2,  2,  64,  64,  64, mdt::bf16, bwd_mask_type::causal_tl },
+                    sdpa_bwd_dims_t{ 2,  2,  2,  64,  64,  64, mdt::f16,  bwd_mask_type::causal_tl },
+                    sdpa_bwd_dims_t{ 2,  2,  2,  64,  64,  64, mdt::f32,  bwd_mask_type::causal_tl }
+    ), &print_to_string);
+
+INSTANTIATE_TEST_SUITE_P(GQA,
+    sdpa_bwd_test_t,
+                           // mb, hd_num, kv_hd_num, q_num, k_num, hd_size, dt, mask
+    testing::Values(
+                    sdpa_bwd_dims_t{ 1,  8,  2,  32,  64,  64, mdt::f16, bwd_mask_type::no_mask },
+                    sdpa_bwd_dims_t{ 1,  8,  1,  32,  64,  64, mdt::f16, bwd_mask_type::causal_br }
+    ), &print_to_string);
+// clang-format on
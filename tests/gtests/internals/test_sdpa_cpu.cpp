@@ -0,0 +1,212 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "sdpa_internal.hpp"
+
+#include "src/common/sdpa_types.hpp"
+
+namespace dnnl {
+
+using mdt = memory::data_type;
+using tag = memory::format_tag;
+
+struct sdpa_cpu_params_t {
+    memory::dim mb, heads, kv_heads, queries, keys, head_size;
+    int mask_type; // dnnl::impl::attn_mask_type_t
+    bool with_key_transposed;
+};
+
+class sdpa_cpu_test_t : public ::testing::TestWithParam<sdpa_cpu_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+                "This test requires CPU engine");
+        p = GetParam();
+    }
+
+    // Straightforward softmax(Q * K * scale + mask) * V, with the scale
+    // inverted to match the primitive configuration below.
+    std::vector<float> compute_ref(const std::vector<float> &q,
+            const std::vector<float> &k, const std::vector<float> &v,
+            const std::vector<float> &msk, float scale) const {
+        using namespace dnnl::impl::attn_mask_type;
+        const memory::dim H = p.heads, Hk = p.kv_heads, S = p.queries,
+                          K = p.keys, D = p.head_size;
+        std::vector<float> out(p.mb * H * S * D, 0.f);
+        std::vector<float> s(K);
+        for_(memory::dim b = 0; b < p.mb; b++)
+        for_(memory::dim h = 0; h < H; h++)
+        for (memory::dim i = 0; i < S; i++) {
+            const memory::dim hk = h / (H / Hk);
+            float max_val = -INFINITY;
+            for (memory::dim j = 0; j < K; j++) {
+                float acc = 0.f;
+                for (memory::dim d = 0; d < D; d++)
+                    acc += q[((b * H + h) * S + i) * D + d]
+                            * k[((b * Hk + hk) * K + j) * D + d];
+                acc /= scale;
+                if (p.mask_type == buffer) acc += msk[i * K + j];
+                const memory::dim shift
+                        = p.mask_type == bottom_right ? K - S : 0;
+                const bool is_causal = p.mask_type == top_left
+                        || p.mask_type == bottom_right;
+                if (is_causal && j > i + shift)
+                    acc = -INFINITY;
+                s[j] = acc;
+                max_val = std::max(max_val, acc);
+            }
+            float sum = 0.f;
+            for (memory::dim j = 0; j < K; j++) {
+                s[j] = max_val == -INFINITY ? 0.f : std::exp(s[j] - max_val);
+                sum += s[j];
+            }
+            for (memory::dim d = 0; d < D; d++) {
+                float acc = 0.f;
+                for (memory::dim j = 0; j < K; j++)
+                    acc += s[j] * v[((b * Hk + hk) * K + j) * D + d];
+                out[((b * H + h) * S + i) * D + d]
+                        = sum > 0.f ? acc / sum : 0.f;
+            }
+        }
+        return out;
+    }
+
+    sdpa_cpu_params_t p;
+};
+
+TEST_P(sdpa_cpu_test_t, TestsSDPA) {
+    using namespace dnnl::impl::attn_mask_type;
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+
+    const memory::dim D = p.head_size;
+    memory::desc q_md({p.mb, p.heads, p.queries, D}, mdt::f32, tag::abcd);
+    // Keys are logically [mb, heads, D, keys]; the transposed variant keeps
+    // the head dimension dense as most frameworks do.
+    memory::desc k_md({p.mb, p.kv_heads, D, p.keys}, mdt::f32,
+            p.with_key_transposed ? tag::abdc : tag::abcd);
+    memory::desc v_md({p.mb, p.kv_heads, p.keys, D}, mdt::f32, tag::abcd);
+    memory::desc dst_md({p.mb, p.heads, p.queries, D}, mdt::f32, tag::abcd);
+    memory::desc msk_md({1, 1, p.queries, p.keys}, mdt::f32, tag::abcd);
+    memory::desc scale_md({1}, mdt::f32, tag::a);
+
+    std::vector<float> q(q_md.get_size() / sizeof(float));
+    std::vector<float> k(k_md.get_size() / sizeof(float));
+    std::vector<float> v(v_md.get_size() / sizeof(float));
+    std::vector<float> msk(msk_md.get_size() / sizeof(float));
+    for (size_t i = 0; i < q.size(); i++)
+        q[i] = ((i * 13) % 17) / 17.f - 0.5f;
+    for (size_t i = 0; i < k.size(); i++)
+        k[i] = ((i * 7) % 11) / 11.f - 0.5f;
+    for (size_t i = 0; i < v.size(); i++)
+        v[i] = ((i * 5) % 23) / 23.f - 0.5f;
+    for (size_t i = 0; i < msk.size(); i++)
+        msk[i] = (i % 3 == 0) ? -INFINITY : 0.f;
+    const float scale = std::sqrt(static_cast<float>(D));
+
+    // The reference expects keys laid out as [mb, kv_heads, keys, D].
+    std::vector<float> k_ref(k.size());
+    for_(memory::dim b = 0; b < p.mb * p.kv_heads; b++)
+    for_(memory::dim d = 0; d < D; d++)
+    for (memory::dim j = 0; j < p.keys; j++) {
+        const memory::dim src_off = p.with_key_transposed
+                ? (b * p.keys + j) * D + d
+                : (b * D + d) * p.keys + j;
+        k_ref[(b * p.keys + j) * D + d] = k[src_off];
+    }
+
+    impl::sdpa::primitive_desc sdpa_pd;
+    try {
+        sdpa_pd = impl::sdpa::primitive_desc(eng, q_md, k_md, v_md,
+                p.mask_type == buffer ? &msk_md : nullptr, mdt::f32, dst_md,
+                /* invert_scale = */ true, p.kv_heads, p.mask_type,
+                impl::alg_kind::softmax_accurate_inf_as_zero);
+    } catch (const dnnl::error &e) {
+        if (e.status == dnnl_unimplemented)
+            GTEST_SKIP() << "Unimplemented: " << e.what();
+        throw;
+    }
+    impl::sdpa sdpa_prim(sdpa_pd);
+
+    float scale_val = scale;
+    memory q_mem(q_md, eng, q.data()), k_mem(k_md, eng, k.data()),
+            v_mem(v_md, eng, v.data()), msk_mem(msk_md, eng, msk.data()),
+            scale_mem(scale_md, eng, &scale_val), dst_mem(dst_md, eng);
+
+    std::unordered_map<int, memory> args = {{DNNL_ARG_QUERIES, q_mem},
+            {DNNL_ARG_KEYS, k_mem}, {DNNL_ARG_VALUES, v_mem},
+            {DNNL_ARG_SCALE, scale_mem}, {DNNL_ARG_DST, dst_mem}};
+    if (p.mask_type == buffer) args[DNNL_ARG_ATTN_MASK] = msk_mem;
+    sdpa_prim.execute(strm, args);
+    strm.wait();
+
+    const auto ref = compute_ref(q, k_ref, v, msk, scale);
+    const float *dst = static_cast<const float *>(dst_mem.get_data_handle());
+    for (size_t i = 0; i < ref.size(); i++)
+        ASSERT_NEAR(dst[i], ref[i], 1e-5f) << "at index " << i;
+
+    // A primitive restored from the cache blob must produce bitwise
+    // identical results.
+    std::vector<uint8_t> cache_blob;
+    try {
+        cache_blob = sdpa_prim.get_cache_blob();
+    } catch (const dnnl::error &e) {
+        if (e.status == dnnl_unimplemented) return;
+        throw;
+    }
+    ASSERT_FALSE(cache_blob.empty());
+    ASSERT_FALSE(sdpa_pd.get_cache_blob_id().empty());
+
+    impl::sdpa sdpa_prim_from_blob(sdpa_pd, cache_blob);
+    ASSERT_EQ(sdpa_prim_from_blob.get_cache_blob(), cache_blob);
+
+    memory dst_from_blob_mem(dst_md, eng);
+    args[DNNL_ARG_DST] = dst_from_blob_mem;
+    sdpa_prim_from_blob.execute(strm, args);
+    strm.wait();
+
+    const float *dst_from_blob
+            = static_cast<const float *>(dst_from_blob_mem.get_data_handle());
+    for (size_t i = 0; i < ref.size(); i++)
+        ASSERT_EQ(dst_from_blob[i], dst[i]) << "at index " << i;
+}
+
+static auto mask_types = ::testing::Values(
+        sdpa_cpu_params_t {1, 2, 2, 33, 150, 64, impl::attn_mask_type::undef,
+                false},
+        sdpa_cpu_params_t {1, 2, 2, 33, 150, 64, impl::attn_mask_type::buffer,
+                true},
+        sdpa_cpu_params_t {2, 2, 2, 40, 40, 32,
+                impl::attn_mask_type::top_left, true},
+        sdpa_cpu_params_t {2, 2, 2, 17, 300, 32,
+                impl::attn_mask_type::bottom_right, true});
+
+static auto gqa = ::testing::Values(
+        sdpa_cpu_params_t {1, 8, 2, 1, 385, 64, impl::attn_mask_type::undef,
+                true},
+        sdpa_cpu_params_t {2, 4, 1, 64, 129, 16,
+                impl::attn_mask_type::top_left, false});
+
+INSTANTIATE_TEST_SUITE_P(MaskTypes, sdpa_cpu_test_t, mask_types);
+INSTANTIATE_TEST_SUITE_P(GQA, sdpa_cpu_test_t, gqa);
+
+} // namespace dnnl
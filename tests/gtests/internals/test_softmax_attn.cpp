@@ -0,0 +1,193 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "src/common/sdpa_types.hpp"
+
+// NOLINTBEGIN(readability-identifier-naming)
+dnnl_status_t DNNL_API softmax_attn_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        dnnl_prop_kind_t prop_kind, dnnl_alg_kind_t alg_kind,
+        const_dnnl_memory_desc_t src_desc, const_dnnl_memory_desc_t dst_desc,
+        int axis, bool with_scale, int attn_mask_type,
+        const_dnnl_memory_desc_t mask_desc, const_dnnl_primitive_attr_t attr);
+// NOLINTEND(readability-identifier-naming)
+
+namespace dnnl {
+
+using mdt = memory::data_type;
+using tag = memory::format_tag;
+
+struct softmax_attn_params_t {
+    memory::dim mb, heads, queries, keys;
+    bool with_scale;
+    int mask_type; // dnnl::impl::attn_mask_type_t
+    // Mask dimensions for a buffer mask, broadcast over batch and heads.
+    memory::dim mask_queries, mask_keys;
+};
+
+class softmax_attn_test_t
+    : public ::testing::TestWithParam<softmax_attn_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+                "This test requires CPU engine");
+        p = GetParam();
+    }
+
+    // Straightforward softmax(src * scale + mask) over the last dimension.
+    std::vector<float> compute_ref(const std::vector<float> &src,
+            const std::vector<float> &msk, float scale) const {
+        using namespace dnnl::impl::attn_mask_type;
+        const memory::dim S = p.queries, K = p.keys;
+        std::vector<float> out(src.size());
+        std::vector<float> s(K);
+        for_(memory::dim bh = 0; bh < p.mb * p.heads; bh++)
+        for (memory::dim i = 0; i < S; i++) {
+            float max_val = -INFINITY;
+            for (memory::dim j = 0; j < K; j++) {
+                float v = src[(bh * S + i) * K + j];
+                if (p.with_scale) v *= scale;
+                if (p.mask_type == buffer) {
+                    const memory::dim mi = p.mask_queries == 1 ? 0 : i;
+                    const memory::dim mj = p.mask_keys == 1 ? 0 : j;
+                    v += msk[mi * p.mask_keys + mj];
+                }
+                const memory::dim shift
+                        = p.mask_type == bottom_right ? K - S : 0;
+                const bool is_causal = p.mask_type == top_left
+                        || p.mask_type == bottom_right;
+                if (is_causal && j > i + shift) v = -INFINITY;
+                s[j] = v;
+                max_val = std::max(max_val, v);
+            }
+            float sum = 0.f;
+            for (memory::dim j = 0; j < K; j++) {
+                s[j] = max_val == -INFINITY ? 0.f : std::exp(s[j] - max_val);
+                sum += s[j];
+            }
+            for (memory::dim j = 0; j < K; j++)
+                out[(bh * S + i) * K + j] = sum > 0.f ? s[j] / sum : 0.f;
+        }
+        return out;
+    }
+
+    softmax_attn_params_t p;
+};
+
+TEST_P(softmax_attn_test_t, TestsSoftmaxAttn) {
+    using namespace dnnl::impl::attn_mask_type;
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+
+    memory::desc data_md(
+            {p.mb, p.heads, p.queries, p.keys}, mdt::f32, tag::abcd);
+    memory::desc msk_md(
+            {1, 1, p.mask_queries, p.mask_keys}, mdt::f32, tag::abcd);
+    memory::desc scale_md({1}, mdt::f32, tag::a);
+
+    std::vector<float> src(data_md.get_size() / sizeof(float));
+    std::vector<float> msk(msk_md.get_size() / sizeof(float));
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = ((i * 13) % 17) / 4.f - 2.f;
+    for (size_t i = 0; i < msk.size(); i++)
+        msk[i] = (i % 5 == 0) ? -INFINITY : ((i * 7) % 11) / 11.f;
+    float scale = 0.125f;
+
+    dnnl_primitive_desc_t c_pd = nullptr;
+    const dnnl_status_t status = softmax_attn_primitive_desc_create(&c_pd,
+            eng.get(), dnnl_forward_inference, dnnl_softmax_accurate,
+            data_md.get(), data_md.get(), 3, p.with_scale, p.mask_type,
+            p.mask_type == buffer ? msk_md.get() : nullptr, nullptr);
+    if (status == dnnl_unimplemented) GTEST_SKIP() << "Unimplemented";
+    ASSERT_EQ(status, dnnl_success);
+    softmax_forward::primitive_desc pd(c_pd);
+    softmax_forward prim(pd);
+
+    memory src_mem(data_md, eng, src.data()), msk_mem(msk_md, eng, msk.data()),
+            scale_mem(scale_md, eng, &scale), dst_mem(data_md, eng);
+
+    std::unordered_map<int, memory> args
+            = {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_DST, dst_mem}};
+    if (p.with_scale) args[DNNL_ARG_SCALE] = scale_mem;
+    if (p.mask_type == buffer) args[DNNL_ARG_ATTN_MASK] = msk_mem;
+    prim.execute(strm, args);
+    strm.wait();
+
+    const auto ref = compute_ref(src, msk, scale);
+    const float *dst = static_cast<const float *>(dst_mem.get_data_handle());
+    for (size_t i = 0; i < ref.size(); i++)
+        ASSERT_NEAR(dst[i], ref[i], 1e-5f) << "at index " << i;
+}
+
+TEST(softmax_attn_test_t, TestsBadArguments) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "This test requires CPU engine");
+    using namespace dnnl::impl::attn_mask_type;
+    engine eng(engine::kind::cpu, 0);
+
+    memory::desc data_md({2, 4, 8}, mdt::f32, tag::abc);
+    memory::desc bad_msk_md({1, 3, 8}, mdt::f32, tag::abc);
+    dnnl_primitive_desc_t c_pd = nullptr;
+
+    // A mask requires normalization over the last dimension.
+    EXPECT_NE(softmax_attn_primitive_desc_create(&c_pd, eng.get(),
+                      dnnl_forward_inference, dnnl_softmax_accurate,
+                      data_md.get(), data_md.get(), 1, false, top_left,
+                      nullptr, nullptr),
+            dnnl_success);
+    // A buffer mask must be broadcastable to the destination.
+    EXPECT_EQ(softmax_attn_primitive_desc_create(&c_pd, eng.get(),
+                      dnnl_forward_inference, dnnl_softmax_accurate,
+                      data_md.get(), data_md.get(), 2, false, buffer,
+                      bad_msk_md.get(), nullptr),
+            dnnl_invalid_arguments);
+    EXPECT_EQ(softmax_attn_primitive_desc_create(&c_pd, eng.get(),
+                      dnnl_forward_inference, dnnl_softmax_accurate,
+                      data_md.get(), data_md.get(), 2, false, buffer, nullptr,
+                      nullptr),
+            dnnl_invalid_arguments);
+}
+
+static auto mask_types = ::testing::Values(
+        softmax_attn_params_t {2, 3, 17, 67, true, impl::attn_mask_type::undef,
+                1, 1},
+        softmax_attn_params_t {2, 3, 17, 67, true,
+                impl::attn_mask_type::buffer, 17, 67},
+        softmax_attn_params_t {1, 2, 40, 40, false,
+                impl::attn_mask_type::top_left, 1, 1},
+        softmax_attn_params_t {1, 2, 33, 130, true,
+                impl::attn_mask_type::bottom_right, 1, 1},
+        softmax_attn_params_t {1, 2, 48, 20, true,
+                impl::attn_mask_type::bottom_right, 1, 1});
+
+// Masks broadcast along the normalized axis are handled by the reference
+// implementation only.
+static auto mask_bcast = ::testing::Values(
+        softmax_attn_params_t {2, 2, 9, 35, false,
+                impl::attn_mask_type::buffer, 1, 35},
+        softmax_attn_params_t {2, 2, 9, 35, true,
+                impl::attn_mask_type::buffer, 9, 1});
+
+INSTANTIATE_TEST_SUITE_P(MaskTypes, softmax_attn_test_t, mask_types);
+INSTANTIATE_TEST_SUITE_P(MaskBroadcast, softmax_attn_test_t, mask_bcast);
+
+} // namespace dnnl
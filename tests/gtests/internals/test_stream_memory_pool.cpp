@@ -0,0 +1,93 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "src/common/stream_memory_pool.hpp"
+
+namespace dnnl {
+
+namespace {
+impl::stream_memory_pool_stats_t get_stats(const stream &strm) {
+    impl::stream_memory_pool_stats_t stats {};
+    impl::get_stream_memory_pool_stats(strm.get(), &stats);
+    return stats;
+}
+
+struct conv_t {
+    conv_t(const engine &eng, memory::dim ic) {
+        memory::desc src_md({1, ic, 34, 34}, memory::data_type::f32,
+                memory::format_tag::nchw);
+        memory::desc wei_md({8, ic, 3, 3}, memory::data_type::f32,
+                memory::format_tag::oihw);
+        memory::desc dst_md({1, 8, 15, 15}, memory::data_type::f32,
+                memory::format_tag::nchw);
+        pd = convolution_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                src_md, wei_md, memory::desc(), dst_md, memory::dims {2, 2},
+                memory::dims {1, 1}, memory::dims {0, 0}, memory::dims {0, 0});
+        args = {{DNNL_ARG_SRC, memory(src_md, eng)},
+                {DNNL_ARG_WEIGHTS, memory(wei_md, eng)},
+                {DNNL_ARG_DST, memory(dst_md, eng)}};
+    }
+
+    void execute(stream &strm) const {
+        convolution_forward(pd).execute(strm, args);
+        strm.wait();
+    }
+
+    convolution_forward::primitive_desc pd;
+    std::unordered_map<int, memory> args;
+};
+} // namespace
+
+TEST(stream_memory_pool_test, TestScratchpadReuse) {
+    SKIP_IF(engine::get_count(engine::kind::gpu) == 0,
+            "This test requires GPU engine");
+    engine eng(engine::kind::gpu, 0);
+    stream strm(eng);
+
+    conv_t conv(eng, 8);
+    SKIP_IF(conv.pd.scratchpad_desc().get_size() == 0,
+            "Implementation doesn't use a scratchpad");
+
+    const size_t old_limit
+            = impl::set_stream_memory_pool_limit(size_t(1) << 30);
+
+    // The first execution allocates the scratchpad, later executions reuse
+    // it.
+    const auto s0 = get_stats(strm);
+    conv.execute(strm);
+    const auto s1 = get_stats(strm);
+    conv.execute(strm);
+    const auto s2 = get_stats(strm);
+    ASSERT_EQ(s1.n_allocations, s0.n_allocations + 1);
+    ASSERT_EQ(s2.n_allocations, s1.n_allocations);
+    ASSERT_EQ(s2.n_reuses, s1.n_reuses + 1);
+    ASSERT_GE(s2.cached_bytes, conv.pd.scratchpad_desc().get_size());
+
+    // Lowering the limit releases the cached buffer.
+    impl::set_stream_memory_pool_limit(1);
+    conv.execute(strm);
+    const auto s3 = get_stats(strm);
+    ASSERT_EQ(s3.n_trims, s2.n_trims + 1);
+    ASSERT_EQ(s3.cached_bytes, 0u);
+
+    impl::set_stream_memory_pool_limit(old_limit);
+}
+
+} // namespace dnnl
@@ -375,6 +375,14 @@ TEST_F(ocl_stream_test_cpp_t, TestProfilingAPILibraryQueue) {
             nsec = get_profiling_data(stream, profiling_data_kind::time));
     ASSERT_FALSE(nsec.empty());
 
+    // The kernels of an execution can't take longer than the execution.
+    std::vector<uint64_t> kernel_nsec;
+    ASSERT_NO_THROW(kernel_nsec = get_profiling_data(
+                            stream, profiling_data_kind::kernel_time));
+    ASSERT_EQ(kernel_nsec.size(), nsec.size());
+    for (size_t i = 0; i < nsec.size(); i++)
+        ASSERT_LE(kernel_nsec[i], nsec[i]);
+
     // Reset profiler's state.
     ASSERT_NO_THROW(reset_profiling(stream));
     // Test that the profiler's state was reset.
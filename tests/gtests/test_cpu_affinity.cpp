@@ -0,0 +1,33 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+TEST(cpu_affinity_test_t, TestSetAffinity) {
+    for (const char *policy : {"", "bogus", "3-1", "0,,1", "numa:", "numa:0-1"})
+        ASSERT_EQ(set_cpu_affinity(policy), status::invalid_arguments)
+                << policy;
+
+    ASSERT_EQ(set_cpu_affinity("Compact"), status::success);
+    // The policy can be set only once.
+    ASSERT_EQ(set_cpu_affinity("0-3,8"), status::runtime_error);
+}
+
+} // namespace dnnl
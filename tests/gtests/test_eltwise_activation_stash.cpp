@@ -0,0 +1,143 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+class eltwise_activation_stash_test_t : public ::testing::Test {
+protected:
+    engine eng_ {engine::kind::cpu, 0};
+    stream strm_ {eng_};
+
+    // Runs the forward and backward passes with the activation stashed in
+    // `stash_dt` and compares the gradient with the one computed from the
+    // full precision activation.
+    void Test(algorithm alg, dt stash_dt, float rel_tol) {
+        const memory::dim n = 4 * 64;
+        memory::desc md({4, 64}, dt::f32, tag::ab);
+
+        primitive_attr attr;
+        attr.set_activation_stash(stash_dt);
+        auto fwd_pd = eltwise_forward::primitive_desc(
+                eng_, prop_kind::forward_training, alg, md, md, 0.f, 0.f, attr);
+        ASSERT_EQ(fwd_pd.get_primitive_attr().get_activation_stash(),
+                stash_dt);
+        const auto ws_md = fwd_pd.workspace_desc();
+        ASSERT_EQ(ws_md.get_data_type(), stash_dt);
+
+        auto bwd_pd = eltwise_backward::primitive_desc(
+                eng_, alg, md, md, md, 0.f, 0.f, fwd_pd, attr);
+        auto ref_bwd_pd = eltwise_backward::primitive_desc(
+                eng_, alg, md, md, md, 0.f, 0.f, fwd_pd);
+
+        memory src(md, eng_), dst(md, eng_), ws(ws_md, eng_);
+        memory diff_dst(md, eng_), diff_src(md, eng_), ref_diff_src(md, eng_);
+        fill_data<float>(n, src, 0.f, 2.f);
+        fill_data<float>(n, diff_dst, 1.f, 1.f);
+
+        eltwise_forward(fwd_pd).execute(strm_,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst},
+                        {DNNL_ARG_WORKSPACE, ws}});
+        eltwise_backward(bwd_pd).execute(strm_,
+                {{DNNL_ARG_DIFF_DST, diff_dst}, {DNNL_ARG_DIFF_SRC, diff_src},
+                        {DNNL_ARG_WORKSPACE, ws}});
+        eltwise_backward(ref_bwd_pd)
+                .execute(strm_,
+                        {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst},
+                                {DNNL_ARG_DIFF_DST, diff_dst},
+                                {DNNL_ARG_DIFF_SRC, ref_diff_src}});
+        strm_.wait();
+
+        auto got = map_memory<float>(diff_src);
+        auto ref = map_memory<float>(ref_diff_src);
+        for (memory::dim i = 0; i < n; i++)
+            ASSERT_NEAR(got[i], ref[i], rel_tol * (1.f + std::fabs(ref[i])))
+                    << "i=" << i;
+    }
+};
+
+TEST_F(eltwise_activation_stash_test_t, TestSrc) {
+    Test(algorithm::eltwise_gelu_erf, dt::bf16, 2e-2f);
+    Test(algorithm::eltwise_relu, dt::f8_e4m3, 0.f);
+}
+
+TEST_F(eltwise_activation_stash_test_t, TestDst) {
+    Test(algorithm::eltwise_tanh_use_dst_for_bwd, dt::f16, 1e-2f);
+    Test(algorithm::eltwise_relu_use_dst_for_bwd, dt::f8_e5m2, 0.f);
+}
+
+TEST_F(eltwise_activation_stash_test_t, TestDenseLayoutsOnly) {
+    memory::desc blocked_md({2, 3, 3, 3}, dt::f32, tag::nChw16c);
+    memory::desc strided_md({4, 64}, dt::f32, memory::dims {128, 1});
+    primitive_attr attr;
+    attr.set_activation_stash(dt::bf16);
+
+    // The stash keeps the padded area of blocked layouts.
+    auto fwd_pd = eltwise_forward::primitive_desc(eng_,
+            prop_kind::forward_training, algorithm::eltwise_relu, blocked_md,
+            blocked_md, 0.f, 0.f, attr);
+    const auto ws_md = fwd_pd.workspace_desc();
+    ASSERT_EQ(ws_md.get_data_type(), dt::bf16);
+    ASSERT_EQ(ws_md.get_size(), blocked_md.get_size() / 2);
+
+    // Layouts with gaps between the elements are not supported.
+    EXPECT_ANY_THROW(eltwise_forward::primitive_desc(eng_,
+            prop_kind::forward_training, algorithm::eltwise_relu, strided_md,
+            strided_md, 0.f, 0.f, attr));
+}
+
+TEST_F(eltwise_activation_stash_test_t, TestOtherPrimitives) {
+    primitive_attr attr;
+    attr.set_activation_stash(dt::bf16);
+
+    // Only eltwise stashes its activation.
+    memory::desc a_md({4, 8}, dt::f32, tag::ab);
+    memory::desc b_md({8, 16}, dt::f32, tag::ab);
+    memory::desc c_md({4, 16}, dt::f32, tag::ab);
+    EXPECT_ANY_THROW(matmul::primitive_desc(eng_, a_md, b_md, c_md, attr));
+
+    memory::desc ln_md({4, 16}, dt::f32, tag::ab);
+    EXPECT_ANY_THROW(layer_normalization_forward::primitive_desc(eng_,
+            prop_kind::forward_training, ln_md, ln_md, 1e-5f,
+            normalization_flags::none, attr));
+}
+
+TEST_F(eltwise_activation_stash_test_t, TestUnsupported) {
+    memory::desc md({4, 64}, dt::f32, tag::ab);
+    primitive_attr attr;
+    attr.set_activation_stash(dt::bf16);
+    auto fwd_pd = eltwise_forward::primitive_desc(eng_,
+            prop_kind::forward_training, algorithm::eltwise_relu, md, md, 0.f,
+            0.f);
+
+    // The forward primitive descriptor doesn't provide the stash.
+    EXPECT_ANY_THROW(eltwise_backward::primitive_desc(eng_,
+            algorithm::eltwise_relu, md, md, md, 0.f, 0.f, fwd_pd, attr));
+
+    // Integer types need scales and are not supported.
+    EXPECT_ANY_THROW(attr.set_activation_stash(dt::s8));
+}
+
+} // namespace dnnl
@@ -0,0 +1,267 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct gather_test_params_t {
+    algorithm aalgorithm;
+    memory::data_type src_dt;
+    memory::data_type dst_dt;
+    memory::dim rows; // V
+    memory::dim cols; // C
+    memory::dim bags; // B
+    memory::dim bag_size; // L
+    int scale_mask; // -1 for no scales
+    int zp_mask; // -1 for no zero points
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+class gather_test_t : public ::testing::TestWithParam<gather_test_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Gather is supported on CPU only.");
+        gather_test_params_t p
+                = ::testing::TestWithParam<decltype(p)>::GetParam();
+        SKIP_IF(unsupported_data_type(p.src_dt)
+                        || unsupported_data_type(p.dst_dt),
+                "Engine does not support this data type.");
+        catch_expected_failures(
+                [&]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    // Small integers keep the table exact in every supported data type.
+    static float table_value(memory::dim v, memory::dim c, bool is_unsigned) {
+        const float x = static_cast<float>((v * 7 + c * 3) % 11);
+        return is_unsigned ? x : x - 5.f;
+    }
+
+    // Every fifth index is out of the table and acts as padding.
+    static int index_value(memory::dim b, memory::dim l, memory::dim rows) {
+        const memory::dim n = b * 3 + l * 7;
+        if (n % 5 == 4) return n % 2 ? -1 : static_cast<int>(rows);
+        return static_cast<int>(n % rows);
+    }
+
+    void Test() {
+        auto p = ::testing::TestWithParam<gather_test_params_t>::GetParam();
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+        using dt = memory::data_type;
+        using tag = memory::format_tag;
+
+        const bool reduce = p.aalgorithm != algorithm::gather_none;
+        const memory::dims dst_dims = reduce
+                ? memory::dims {p.bags, p.cols}
+                : memory::dims {p.bags, p.bag_size, p.cols};
+
+        memory::desc src_md({p.rows, p.cols}, p.src_dt, tag::ab);
+        memory::desc idx_md({p.bags, p.bag_size}, dt::s32, tag::ab);
+        memory::desc dst_md(dst_dims, p.dst_dt, tag::any);
+
+        primitive_attr attr;
+        if (p.scale_mask >= 0) attr.set_scales_mask(DNNL_ARG_SRC, p.scale_mask);
+        if (p.zp_mask >= 0)
+            attr.set_zero_points_mask(DNNL_ARG_SRC, p.zp_mask);
+
+        auto pd = gather::primitive_desc(
+                eng, p.aalgorithm, src_md, idx_md, dst_md, attr);
+        // test construction from a C pd
+        pd = gather::primitive_desc(pd.get());
+        ASSERT_TRUE(pd.src_desc() == src_md);
+        ASSERT_TRUE(pd.indices_desc() == idx_md);
+        ASSERT_EQ(pd.get_algorithm(), p.aalgorithm);
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_INDICES)
+                == pd.indices_desc());
+
+        const bool is_unsigned = p.src_dt == dt::u8;
+        std::vector<float> table(p.rows * p.cols);
+        for (memory::dim v = 0; v < p.rows; v++)
+            for (memory::dim c = 0; c < p.cols; c++)
+                table[v * p.cols + c] = table_value(v, c, is_unsigned);
+
+        const memory::dim n_scales = p.scale_mask == 1 ? p.rows : 1;
+        const memory::dim n_zps = p.zp_mask == 1 ? p.rows : 1;
+        std::vector<float> scales(n_scales);
+        std::vector<int> zps(n_zps);
+        for (memory::dim i = 0; i < n_scales; i++)
+            scales[i] = 0.25f * (1 + i % 4);
+        for (memory::dim i = 0; i < n_zps; i++)
+            zps[i] = static_cast<int>(i % 3);
+
+        // The table is filled in f32 and converted by a reorder.
+        memory src_f32({{p.rows, p.cols}, dt::f32, tag::ab}, eng);
+        {
+            auto ptr = map_memory<float>(src_f32);
+            for (size_t i = 0; i < table.size(); i++)
+                ptr[i] = table[i];
+        }
+        auto src = test::make_memory(pd.src_desc(), eng);
+        reorder(src_f32, src).execute(strm, src_f32, src);
+
+        auto idx = test::make_memory(pd.indices_desc(), eng);
+        {
+            auto ptr = map_memory<int>(idx);
+            for (memory::dim b = 0; b < p.bags; b++)
+                for (memory::dim l = 0; l < p.bag_size; l++)
+                    ptr[b * p.bag_size + l] = index_value(b, l, p.rows);
+        }
+
+        auto dst = test::make_memory(pd.dst_desc(), eng);
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, src},
+                {DNNL_ARG_INDICES, idx}, {DNNL_ARG_DST, dst}};
+
+        if (p.scale_mask >= 0) {
+            memory scales_m({{n_scales}, dt::f32, tag::a}, eng);
+            auto ptr = map_memory<float>(scales_m);
+            for (memory::dim i = 0; i < n_scales; i++)
+                ptr[i] = scales[i];
+            args.insert({DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC, scales_m});
+        }
+        if (p.zp_mask >= 0) {
+            memory zps_m({{n_zps}, dt::s32, tag::a}, eng);
+            auto ptr = map_memory<int>(zps_m);
+            for (memory::dim i = 0; i < n_zps; i++)
+                ptr[i] = zps[i];
+            args.insert({DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_SRC, zps_m});
+        }
+
+        gather(pd).execute(strm, args);
+        strm.wait();
+
+        memory dst_f32({dst_dims, dt::f32, reduce ? tag::ab : tag::abc}, eng);
+        reorder(dst, dst_f32).execute(strm, dst, dst_f32);
+        strm.wait();
+
+        auto row_value = [&](memory::dim v, memory::dim c) {
+            const float s = p.scale_mask >= 0 ? scales[n_scales > 1 ? v : 0]
+                                              : 1.f;
+            const float zp = p.zp_mask >= 0 ? zps[n_zps > 1 ? v : 0] : 0.f;
+            return (table[v * p.cols + c] - zp) * s;
+        };
+        auto is_valid = [&](int v) { return v >= 0 && v < p.rows; };
+
+        auto out = map_memory<float>(dst_f32);
+        const float eps = p.dst_dt == dt::f32 ? 1e-6f : 1e-2f;
+        for (memory::dim b = 0; b < p.bags; b++) {
+            for (memory::dim c = 0; c < p.cols; c++) {
+                if (!reduce) {
+                    for (memory::dim l = 0; l < p.bag_size; l++) {
+                        const int v = index_value(b, l, p.rows);
+                        const float ref = is_valid(v) ? row_value(v, c) : 0.f;
+                        const float got
+                                = out[(b * p.bag_size + l) * p.cols + c];
+                        ASSERT_NEAR(ref, got, eps * (1.f + std::fabs(ref)));
+                    }
+                    continue;
+                }
+                float ref = 0.f;
+                int n_valid = 0;
+                for (memory::dim l = 0; l < p.bag_size; l++) {
+                    const int v = index_value(b, l, p.rows);
+                    if (!is_valid(v)) continue;
+                    ref += row_value(v, c);
+                    n_valid++;
+                }
+                if (p.aalgorithm == algorithm::gather_mean && n_valid > 0)
+                    ref /= n_valid;
+                const float got = out[b * p.cols + c];
+                ASSERT_NEAR(ref, got, eps * (1.f + std::fabs(ref)));
+            }
+        }
+    }
+};
+
+TEST_P(gather_test_t, TestsGather) {}
+
+using dt = memory::data_type;
+
+INSTANTIATE_TEST_SUITE_P(TestGatherF32, gather_test_t,
+        ::testing::Values(
+                gather_test_params_t {algorithm::gather_none, dt::f32, dt::f32,
+                        10, 16, 4, 3, -1, -1},
+                gather_test_params_t {algorithm::gather_sum, dt::f32, dt::f32,
+                        100, 64, 32, 20, -1, -1},
+                gather_test_params_t {algorithm::gather_mean, dt::f32, dt::f32,
+                        50, 13, 7, 9, -1, -1}));
+
+INSTANTIATE_TEST_SUITE_P(TestGatherLowPrecision, gather_test_t,
+        ::testing::Values(
+                gather_test_params_t {algorithm::gather_sum, dt::bf16, dt::f32,
+                        40, 32, 8, 6, -1, -1},
+                gather_test_params_t {algorithm::gather_none, dt::f16, dt::f16,
+                        40, 17, 3, 4, -1, -1},
+                gather_test_params_t {algorithm::gather_mean, dt::bf16,
+                        dt::bf16, 40, 32, 8, 6, -1, -1}));
+
+// Dequantization of int8 tables.
+INSTANTIATE_TEST_SUITE_P(TestGatherInt8, gather_test_t,
+        ::testing::Values(
+                gather_test_params_t {algorithm::gather_sum, dt::s8, dt::f32,
+                        64, 48, 16, 10, 1, -1},
+                gather_test_params_t {algorithm::gather_mean, dt::u8, dt::f32,
+                        64, 48, 16, 10, 1, 1},
+                gather_test_params_t {algorithm::gather_none, dt::s8, dt::bf16,
+                        20, 8, 5, 2, 0, 0},
+                gather_test_params_t {algorithm::gather_sum, dt::u8, dt::f32,
+                        20, 8, 5, 2, -1, -1}));
+
+INSTANTIATE_TEST_SUITE_P(TestGatherEF, gather_test_t,
+        ::testing::Values(
+                // scales are not supported for floating-point tables
+                gather_test_params_t {algorithm::gather_sum, dt::f32, dt::f32,
+                        10, 16, 4, 3, 0, -1, true, dnnl_unimplemented},
+                // unsupported scales mask
+                gather_test_params_t {algorithm::gather_sum, dt::s8, dt::f32,
+                        10, 16, 4, 3, 2, -1, true, dnnl_unimplemented},
+                // int8 destination is not supported
+                gather_test_params_t {algorithm::gather_sum, dt::s8, dt::s8,
+                        10, 16, 4, 3, -1, -1, true, dnnl_unimplemented}));
+
+// Inconsistent shapes.
+TEST(gather_test_shapes_t, TestsBadShapes) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Gather is supported on CPU only.");
+    auto eng = get_test_engine();
+    using tag = memory::format_tag;
+    memory::desc src_md({10, 16}, dt::f32, tag::ab);
+    memory::desc idx_md({4, 3}, dt::s32, tag::ab);
+    memory::desc idx_f32_md({4, 3}, dt::f32, tag::ab);
+    memory::desc dst_2d_md({4, 16}, dt::f32, tag::ab);
+    memory::desc dst_3d_md({4, 3, 16}, dt::f32, tag::abc);
+    memory::desc dst_bad_md({4, 8}, dt::f32, tag::ab);
+
+    // reduction requires a 2D destination
+    EXPECT_ANY_THROW(gather::primitive_desc(
+            eng, algorithm::gather_sum, src_md, idx_md, dst_3d_md));
+    // no reduction requires a 3D destination
+    EXPECT_ANY_THROW(gather::primitive_desc(
+            eng, algorithm::gather_none, src_md, idx_md, dst_2d_md));
+    // row sizes of the table and the destination differ
+    EXPECT_ANY_THROW(gather::primitive_desc(
+            eng, algorithm::gather_sum, src_md, idx_md, dst_bad_md));
+    // indices must be s32
+    EXPECT_ANY_THROW(gather::primitive_desc(
+            eng, algorithm::gather_sum, src_md, idx_f32_md, dst_2d_md));
+}
+
+} // namespace dnnl
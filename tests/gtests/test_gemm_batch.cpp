@@ -0,0 +1,146 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+namespace {
+
+// Row-major reference with non-transposed A and transposed B.
+template <typename a_t, typename b_t, typename c_t>
+void ref_gemm_nt(dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const a_t *A, dnnl_dim_t lda, int ao, const b_t *B, dnnl_dim_t ldb,
+        int bo, float beta, c_t *C, dnnl_dim_t ldc, const int32_t *co_row) {
+    for (dnnl_dim_t m = 0; m < M; m++) {
+        for (dnnl_dim_t n = 0; n < N; n++) {
+            double acc = 0;
+            for (dnnl_dim_t k = 0; k < K; k++)
+                acc += double(A[m * lda + k] - ao)
+                        * double(B[n * ldb + k] - bo);
+            double c = alpha * acc + beta * C[m * ldc + n];
+            if (co_row) c += co_row[m];
+            C[m * ldc + n] = static_cast<c_t>(c);
+        }
+    }
+}
+
+} // namespace
+
+class gemm_batch_test_t
+    : public ::testing::TestWithParam<std::pair<dnnl_dim_t, dnnl_dim_t>> {};
+
+TEST_P(gemm_batch_test_t, TestF32) {
+    const dnnl_dim_t batch = GetParam().first;
+    const dnnl_dim_t M = GetParam().second, N = 19, K = 23;
+    const dnnl_dim_t lda = K, ldb = K, ldc = N + 3;
+    const dnnl_dim_t stride_a = M * lda, stride_b = N * ldb;
+    const dnnl_dim_t stride_c = M * ldc;
+    const float alpha = 0.5f, beta = 1.f;
+
+    std::vector<float> A(batch * stride_a), B(batch * stride_b);
+    std::vector<float> C(batch * stride_c);
+    for (size_t i = 0; i < A.size(); i++)
+        A[i] = float(i % 7) - 3;
+    for (size_t i = 0; i < B.size(); i++)
+        B[i] = float(i % 5) - 2;
+    for (size_t i = 0; i < C.size(); i++)
+        C[i] = float(i % 3);
+    std::vector<float> C_ref(C), C_ptr(C);
+
+    ASSERT_EQ(sgemm_batch_strided('N', 'T', M, N, K, alpha, A.data(), lda,
+                      stride_a, B.data(), ldb, stride_b, beta, C.data(), ldc,
+                      stride_c, batch),
+            status::success);
+
+    std::vector<const float *> A_ptrs(batch), B_ptrs(batch);
+    std::vector<float *> C_ptrs(batch);
+    for (dnnl_dim_t i = 0; i < batch; i++) {
+        A_ptrs[i] = A.data() + i * stride_a;
+        B_ptrs[i] = B.data() + i * stride_b;
+        C_ptrs[i] = C_ptr.data() + i * stride_c;
+        ref_gemm_nt(M, N, K, alpha, A_ptrs[i], lda, 0, B_ptrs[i], ldb, 0, beta,
+                C_ref.data() + i * stride_c, ldc, nullptr);
+    }
+    ASSERT_EQ(sgemm_batch('N', 'T', M, N, K, alpha, A_ptrs.data(), lda,
+                      B_ptrs.data(), ldb, beta, C_ptrs.data(), ldc, batch),
+            status::success);
+
+    // Inputs are small integers, so results are exact.
+    for (size_t i = 0; i < C.size(); i++) {
+        ASSERT_EQ(C[i], C_ref[i]) << "index " << i;
+        ASSERT_EQ(C_ptr[i], C_ref[i]) << "index " << i;
+    }
+}
+
+TEST_P(gemm_batch_test_t, TestU8S8S32) {
+    const dnnl_dim_t batch = GetParam().first;
+    const dnnl_dim_t M = GetParam().second, N = 17, K = 29;
+    const dnnl_dim_t lda = K, ldb = K, ldc = N;
+    const dnnl_dim_t stride_a = M * lda, stride_b = N * ldb;
+    const dnnl_dim_t stride_c = M * ldc;
+    const uint8_t ao = 3;
+    const int8_t bo = -1;
+
+    std::vector<uint8_t> A(batch * stride_a);
+    std::vector<int8_t> B(batch * stride_b);
+    std::vector<int32_t> C(batch * stride_c, 1), co(M);
+    for (size_t i = 0; i < A.size(); i++)
+        A[i] = uint8_t(i % 11);
+    for (size_t i = 0; i < B.size(); i++)
+        B[i] = int8_t(i % 9) - 4;
+    for (dnnl_dim_t m = 0; m < M; m++)
+        co[m] = int32_t(m);
+    std::vector<int32_t> C_ref(C);
+
+    // Per-row offsets of C must follow the rows distributed between threads.
+    ASSERT_EQ(gemm_u8s8s32_batch_strided('N', 'T', 'C', M, N, K, 1.f,
+                      A.data(), lda, stride_a, ao, B.data(), ldb, stride_b, bo,
+                      1.f, C.data(), ldc, stride_c, co.data(), batch),
+            status::success);
+    for (dnnl_dim_t i = 0; i < batch; i++)
+        ref_gemm_nt(M, N, K, 1.f, A.data() + i * stride_a, lda, ao,
+                B.data() + i * stride_b, ldb, bo, 1.f,
+                C_ref.data() + i * stride_c, ldc, co.data());
+
+    for (size_t i = 0; i < C.size(); i++)
+        ASSERT_EQ(C[i], C_ref[i]) << "index " << i;
+}
+
+INSTANTIATE_TEST_SUITE_P(TestGemmBatch, gemm_batch_test_t,
+        ::testing::Values(std::make_pair(1, 1), std::make_pair(1, 200),
+                std::make_pair(3, 70), std::make_pair(64, 5),
+                std::make_pair(0, 8)));
+
+TEST(gemm_batch_test_t, TestInvalidArguments) {
+    float A[4] = {}, B[4] = {}, C[4] = {};
+    ASSERT_EQ(sgemm_batch_strided('N', 'N', 2, 2, 2, 1.f, A, 2, 0, B, 2, 0,
+                      0.f, C, 2, 0, -1),
+            status::invalid_arguments);
+    // Packed matrices are not supported in batches.
+    ASSERT_EQ(sgemm_batch_strided('P', 'N', 2, 2, 2, 1.f, A, 2, 0, B, 2, 0,
+                      0.f, C, 2, 0, 1),
+            status::invalid_arguments);
+    ASSERT_EQ(sgemm_batch('N', 'N', 2, 2, 2, 1.f, nullptr, 2, nullptr, 2, 0.f,
+                      nullptr, 2, 1),
+            status::invalid_arguments);
+}
+
+} // namespace dnnl
@@ -0,0 +1,140 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+class grouped_matmul_test_t : public ::testing::Test {
+protected:
+    engine eng_ = get_test_engine();
+    stream strm_ {eng_};
+
+    void SetUp() override {
+        SKIP_IF_CUDA(true, "Grouped matmul is not implemented on CUDA");
+        SKIP_IF_HIP(true, "Grouped matmul is not implemented on HIP");
+        SKIP_IF_GENERIC(true, "Grouped matmul is not implemented in Generic");
+    }
+
+    // Runs a grouped matmul over `group_sizes` and compares every row
+    // against a naive computation with the group's own weights and bias.
+    void Test(const std::vector<int32_t> &group_sizes, memory::dim K,
+            memory::dim N, bool with_bias) {
+        const memory::dim G = static_cast<memory::dim>(group_sizes.size());
+        std::vector<int32_t> offsets(G);
+        int32_t M_total = 0;
+        for (memory::dim g = 0; g < G; g++) {
+            M_total += group_sizes[g];
+            offsets[g] = M_total;
+        }
+
+        memory::desc src_md({M_total, K}, dt::f32, tag::ab);
+        memory::desc wei_md({G, K, N}, dt::f32, tag::abc);
+        memory::desc bia_md({G, N}, dt::f32, tag::ab);
+        memory::desc dst_md({M_total, N}, dt::f32, tag::ab);
+        memory::desc offs_md({G}, dt::s32, tag::a);
+
+        grouped_matmul::primitive_desc pd;
+        if (with_bias)
+            pd = grouped_matmul::primitive_desc(
+                    eng_, src_md, wei_md, bia_md, dst_md, offs_md);
+        else
+            pd = grouped_matmul::primitive_desc(
+                    eng_, src_md, wei_md, dst_md, offs_md);
+        ASSERT_EQ(pd.group_offsets_desc(), offs_md);
+
+        memory src(src_md, eng_), wei(wei_md, eng_), bia(bia_md, eng_),
+                dst(dst_md, eng_), offs(offs_md, eng_);
+        fill_data<float>(src_md.get_size() / sizeof(float), src, 1.f, 0.5f);
+        fill_data<float>(wei_md.get_size() / sizeof(float), wei, 1.f, 0.5f);
+        fill_data<float>(bia_md.get_size() / sizeof(float), bia, 1.f, 0.5f);
+        {
+            auto p = map_memory<int32_t>(offs);
+            for (memory::dim g = 0; g < G; g++)
+                p[g] = offsets[g];
+        }
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, src},
+                {DNNL_ARG_WEIGHTS, wei}, {DNNL_ARG_DST, dst},
+                {DNNL_ARG_GROUP_OFFSETS, offs}};
+        if (with_bias) args.insert({DNNL_ARG_BIAS, bia});
+        grouped_matmul(pd).execute(strm_, args);
+        strm_.wait();
+
+        auto s = map_memory<float>(src);
+        auto w = map_memory<float>(wei);
+        auto b = map_memory<float>(bia);
+        auto d = map_memory<float>(dst);
+        memory::dim row = 0;
+        for (memory::dim g = 0; g < G; g++) {
+            for (; row < offsets[g]; row++) {
+                for (memory::dim n = 0; n < N; n++) {
+                    float ref = with_bias ? b[g * N + n] : 0.f;
+                    for (memory::dim k = 0; k < K; k++)
+                        ref += s[row * K + k] * w[(g * K + k) * N + n];
+                    const float got = d[row * N + n];
+                    ASSERT_NEAR(got, ref, 1e-4f * K * (1.f + std::fabs(ref)))
+                            << "g=" << g << " m=" << row << " n=" << n;
+                }
+            }
+        }
+    }
+};
+
+TEST_F(grouped_matmul_test_t, TestVariableGroups) {
+    Test({3, 0, 17, 1, 32}, 64, 48, false);
+    Test({3, 0, 17, 1, 32}, 64, 48, true);
+}
+
+TEST_F(grouped_matmul_test_t, TestSingleGroup) {
+    Test({20}, 33, 17, true);
+}
+
+TEST_F(grouped_matmul_test_t, TestBlocking) {
+    // Groups spanning several row blocks and a column tail.
+    Test({300, 5, 0, 513}, 16, 150, true);
+    Test({700}, 8, 128, false);
+}
+
+TEST_F(grouped_matmul_test_t, TestInvalidShapes) {
+    memory::desc src_md({16, 8}, dt::f32, tag::ab);
+    memory::desc wei_md({4, 8, 8}, dt::f32, tag::abc);
+    memory::desc dst_md({16, 8}, dt::f32, tag::ab);
+
+    memory::desc offs_bad_dim_md({3}, dt::s32, tag::a);
+    EXPECT_ANY_THROW(grouped_matmul::primitive_desc(
+            eng_, src_md, wei_md, dst_md, offs_bad_dim_md));
+
+    memory::desc offs_bad_dt_md({4}, dt::f32, tag::a);
+    EXPECT_ANY_THROW(grouped_matmul::primitive_desc(
+            eng_, src_md, wei_md, dst_md, offs_bad_dt_md));
+
+    memory::desc wei_2d_md({8, 8}, dt::f32, tag::ab);
+    memory::desc offs_md({4}, dt::s32, tag::a);
+    EXPECT_ANY_THROW(grouped_matmul::primitive_desc(
+            eng_, src_md, wei_2d_md, dst_md, offs_md));
+}
+
+} // namespace dnnl
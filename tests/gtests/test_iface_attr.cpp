@@ -127,6 +127,275 @@ TEST_F(attr_test_t, TestDeterministic) {
     }
 }
 
+TEST_F(attr_test_t, TestMaxThreads) {
+    dnnl::primitive_attr attr;
+    // Check the default value
+    ASSERT_EQ(0, attr.get_max_threads());
+
+    for (int nthr : {1, 3, 0}) {
+        attr.set_max_threads(nthr);
+        ASSERT_EQ(nthr, attr.get_max_threads());
+    }
+
+    EXPECT_ANY_THROW(attr.set_max_threads(-1));
+}
+
+TEST_F(attr_test_t, TestConstantQuantization) {
+    dnnl::primitive_attr attr;
+    // Check the default value
+    ASSERT_EQ(false, attr.get_constant_quantization());
+
+    for (auto b : {true, false}) {
+        attr.set_constant_quantization(b);
+        ASSERT_EQ(b, attr.get_constant_quantization());
+    }
+}
+
+TEST_F(attr_test_t, TestSrcDynamicQuantization) {
+    dnnl::primitive_attr attr;
+    // Check the default value
+    ASSERT_EQ(memory::data_type::undef, attr.get_src_dynamic_quantization());
+
+    attr.set_src_dynamic_quantization(memory::data_type::s8);
+    ASSERT_EQ(memory::data_type::s8, attr.get_src_dynamic_quantization());
+    attr.set_src_dynamic_quantization(memory::data_type::undef);
+    ASSERT_EQ(memory::data_type::undef, attr.get_src_dynamic_quantization());
+
+    EXPECT_ANY_THROW(
+            attr.set_src_dynamic_quantization(memory::data_type::f32));
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestDstAmax) {
+    dnnl::primitive_attr attr;
+    // Check the default value
+    ASSERT_FALSE(attr.get_dst_amax());
+    attr.set_dst_amax(true);
+    ASSERT_TRUE(attr.get_dst_amax());
+
+    engine eng = get_test_engine();
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Destination absolute maximum is supported on CPU only");
+
+    const memory::dim M = 37, K = 64, N = 50;
+    memory::desc src_md({M, K}, memory::data_type::f32, memory::format_tag::ab);
+    memory::desc wei_md({K, N}, memory::data_type::f32, memory::format_tag::ab);
+    memory::desc dst_md({M, N}, memory::data_type::f32, memory::format_tag::ab);
+
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr);
+    ASSERT_EQ(pd.query_md(query::exec_arg_md, DNNL_ARG_ATTR_DST_AMAX),
+            memory::desc({1}, memory::data_type::f32, memory::format_tag::a));
+
+    auto src = test::make_memory(src_md, eng);
+    auto wei = test::make_memory(wei_md, eng);
+    auto dst = test::make_memory(dst_md, eng);
+    auto amax = test::make_memory(
+            pd.query_md(query::exec_arg_md, DNNL_ARG_ATTR_DST_AMAX), eng);
+    fill_data<float>(M * K, src);
+    fill_data<float>(K * N, wei);
+
+    stream s(eng);
+    matmul(pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei}, {DNNL_ARG_DST, dst},
+                    {DNNL_ARG_ATTR_DST_AMAX, amax}});
+    s.wait();
+
+    auto d = map_memory<float>(dst);
+    float ref = 0.f;
+    for (memory::dim i = 0; i < M * N; i++)
+        ref = std::max(ref, std::fabs(d[i]));
+    ASSERT_EQ(*map_memory<float>(amax), ref);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestSecondaryDst) {
+    dnnl::primitive_attr attr;
+    // Check the default value
+    ASSERT_EQ(memory::data_type::undef, attr.get_secondary_dst());
+    EXPECT_ANY_THROW(attr.set_secondary_dst(memory::data_type::f32));
+    attr.set_secondary_dst(memory::data_type::s8);
+    ASSERT_EQ(memory::data_type::s8, attr.get_secondary_dst());
+
+    engine eng = get_test_engine();
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Secondary destination is supported on CPU only");
+
+    const memory::dim M = 37, K = 64, N = 50;
+    memory::desc src_md({M, K}, memory::data_type::f32, memory::format_tag::ab);
+    memory::desc wei_md({K, N}, memory::data_type::f32, memory::format_tag::ab);
+    memory::desc dst_md({M, N}, memory::data_type::f32, memory::format_tag::ab);
+
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr);
+    const auto sec_md
+            = pd.query_md(query::exec_arg_md, DNNL_ARG_ATTR_SECONDARY_DST);
+    ASSERT_EQ(sec_md,
+            memory::desc(
+                    {M, N}, memory::data_type::s8, memory::format_tag::ab));
+
+    auto src = test::make_memory(src_md, eng);
+    auto wei = test::make_memory(wei_md, eng);
+    auto dst = test::make_memory(dst_md, eng);
+    auto sec = test::make_memory(sec_md, eng);
+    auto scale = test::make_memory(
+            pd.query_md(query::exec_arg_md, DNNL_ARG_ATTR_SECONDARY_DST_SCALE),
+            eng);
+    fill_data<float>(M * K, src);
+    fill_data<float>(K * N, wei);
+    *map_memory<float>(scale) = 0.5f;
+
+    stream s(eng);
+    matmul(pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei}, {DNNL_ARG_DST, dst},
+                    {DNNL_ARG_ATTR_SECONDARY_DST, sec},
+                    {DNNL_ARG_ATTR_SECONDARY_DST_SCALE, scale}});
+    s.wait();
+
+    auto d = map_memory<float>(dst);
+    auto q = map_memory<int8_t>(sec);
+    for (memory::dim i = 0; i < M * N; i++) {
+        const float v = std::min(std::max(d[i] / 0.5f, -128.f), 127.f);
+        ASSERT_EQ(q[i], static_cast<int8_t>(std::nearbyint(v)));
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestMaxThreadsExecution) {
+    engine eng = get_test_engine();
+
+    const memory::dim N = 4, C = 16, W = 64;
+
+    memory::desc data_md(
+            {N, C, W}, memory::data_type::f32, memory::format_tag::ncw);
+
+    dnnl::primitive_attr attr;
+    attr.set_max_threads(1);
+    auto softmax_pd = softmax_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::softmax_accurate,
+            data_md, data_md, 1, attr);
+    ASSERT_EQ(1, softmax_pd.get_primitive_attr().get_max_threads());
+    auto ref_pd = softmax_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::softmax_accurate,
+            data_md, data_md, 1);
+
+    auto src = test::make_memory(softmax_pd.src_desc(), eng);
+    auto dst = test::make_memory(softmax_pd.dst_desc(), eng);
+    auto ref_dst = test::make_memory(ref_pd.dst_desc(), eng);
+    fill_data<float>(src.get_desc().get_size() / sizeof(float), src);
+
+    stream s(eng);
+    softmax_forward(softmax_pd).execute(
+            s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    softmax_forward(ref_pd).execute(
+            s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, ref_dst}});
+    s.wait();
+
+    compare_data<float>(ref_dst, dst);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestConstantQuantizationExecution) {
+    engine eng = get_test_engine();
+
+    const memory::dim M = 8, K = 64, N = 48;
+    using dt = memory::data_type;
+    using tag = memory::format_tag;
+
+    memory::desc src_md({M, K}, dt::u8, tag::ab);
+    memory::desc wei_md({K, N}, dt::s8, tag::ab);
+    memory::desc dst_md({M, N}, dt::f32, tag::ab);
+
+    dnnl::primitive_attr attr, ref_attr;
+    for (auto *a : {&attr, &ref_attr}) {
+        a->set_scales_mask(DNNL_ARG_SRC, 0);
+        a->set_scales_mask(DNNL_ARG_WEIGHTS, 1 << 1);
+    }
+    attr.set_constant_quantization(true);
+
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr);
+    ASSERT_TRUE(pd.get_primitive_attr().get_constant_quantization());
+    auto ref_pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md, ref_attr);
+
+    auto src = test::make_memory(src_md, eng);
+    auto wei = test::make_memory(wei_md, eng);
+    auto dst = test::make_memory(dst_md, eng);
+    auto ref_dst = test::make_memory(dst_md, eng);
+    fill_data<uint8_t>(M * K, src);
+    fill_data<int8_t>(K * N, wei);
+
+    memory src_scales({{1}, dt::f32, tag::x}, eng);
+    memory wei_scales({{N}, dt::f32, tag::x}, eng);
+    map_memory<float>(src_scales)[0] = 0.5f;
+    {
+        auto s = map_memory<float>(wei_scales);
+        for (memory::dim n = 0; n < N; n++)
+            s[n] = 0.25f * (n % 5 + 1);
+    }
+
+    std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, src},
+            {DNNL_ARG_WEIGHTS, wei},
+            {DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC, src_scales},
+            {DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS, wei_scales}};
+
+    stream s(eng);
+    args[DNNL_ARG_DST] = ref_dst;
+    matmul(ref_pd).execute(s, args);
+
+    // The second execution reuses the scales computed by the first one.
+    matmul prim(pd);
+    args[DNNL_ARG_DST] = dst;
+    for (int i = 0; i < 2; i++) {
+        prim.execute(s, args);
+        s.wait();
+        compare_data<float>(ref_dst, dst);
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestMutableWeightsExecution) {
+    engine eng = get_test_engine();
+
+    const memory::dim M = 4, K = 32, N = 16;
+    using dt = memory::data_type;
+    using tag = memory::format_tag;
+
+    memory::desc src_md({M, K}, dt::f32, tag::ab);
+    memory::desc wei_md({K, N}, dt::f32, tag::ab);
+    memory::desc dst_md({M, N}, dt::f32, tag::ab);
+
+    // Without the constant quantization attribute the weights may change
+    // between executions of the same primitive object.
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md);
+    matmul prim(pd);
+
+    auto src = test::make_memory(src_md, eng);
+    auto wei = test::make_memory(wei_md, eng);
+    auto dst = test::make_memory(dst_md, eng);
+    {
+        auto s = map_memory<float>(src);
+        for (memory::dim i = 0; i < M * K; i++)
+            s[i] = static_cast<float>(i % 3);
+    }
+
+    stream s(eng);
+    for (int iter = 0; iter < 2; iter++) {
+        {
+            auto w = map_memory<float>(wei);
+            for (memory::dim i = 0; i < K * N; i++)
+                w[i] = static_cast<float>((i + iter) % 4);
+        }
+        prim.execute(s,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst}});
+        s.wait();
+
+        auto sp = map_memory<float>(src);
+        auto wp = map_memory<float>(wei);
+        auto dp = map_memory<float>(dst);
+        for (memory::dim m = 0; m < M; m++)
+            for (memory::dim n = 0; n < N; n++) {
+                float ref = 0.f;
+                for (memory::dim k = 0; k < K; k++)
+                    ref += sp[m * K + k] * wp[k * N + n];
+                ASSERT_EQ(dp[m * N + n], ref) << "iter=" << iter;
+            }
+    }
+}
+
 HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestScratchpadArg) {
     engine eng = get_test_engine();
 
@@ -158,6 +427,43 @@ HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestScratchpadArg) {
     }
 }
 
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestScratchpadStreamArena) {
+    engine eng = get_test_engine();
+
+    const memory::dim N = 4, C = 16, W = 64;
+
+    memory::desc src_md(
+            {N, C, W}, memory::data_type::f32, memory::format_tag::ncw);
+    memory::desc dst_md(
+            {N, C, W}, memory::data_type::f32, memory::format_tag::nwc);
+
+    dnnl::primitive_attr attr;
+    attr.set_scratchpad_mode(scratchpad_mode::user);
+    auto softmax_pd = softmax_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::softmax_accurate, src_md,
+            dst_md, 1, attr);
+    SKIP_IF(softmax_pd.scratchpad_desc().get_size() == 0,
+            "Implementation doesn't use a scratchpad");
+    auto ref_pd = softmax_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::softmax_accurate, src_md,
+            dst_md, 1);
+
+    auto src = test::make_memory(softmax_pd.src_desc(), eng);
+    auto dst = test::make_memory(softmax_pd.dst_desc(), eng);
+    auto ref_dst = test::make_memory(ref_pd.dst_desc(), eng);
+    fill_data<float>(src.get_desc().get_size() / sizeof(float), src);
+
+    stream s(eng);
+    // The scratchpad is served by the stream when the argument is missing.
+    softmax_forward(softmax_pd).execute(
+            s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    softmax_forward(ref_pd).execute(
+            s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, ref_dst}});
+    s.wait();
+
+    compare_data<float>(ref_dst, dst);
+}
+
 TEST_F(attr_test_t, TestZeroPoints) {
     dnnl::primitive_attr attr;
 
@@ -0,0 +1,69 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+class exec_stats_test_t : public ::testing::Test {};
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(exec_stats_test_t, TestExecStats) {
+    engine eng = get_test_engine();
+    stream s(eng);
+
+    memory::desc md({2, 64}, memory::data_type::f32, memory::format_tag::ab);
+    auto pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_relu, md, md);
+    eltwise_forward relu(pd);
+    auto src = test::make_memory(md, eng);
+    auto dst = test::make_memory(md, eng);
+
+    auto stats = relu.get_exec_stats();
+    ASSERT_EQ(stats.count, 0u);
+    ASSERT_EQ(stats.total_ns, 0u);
+    ASSERT_EQ(stats.max_ns, 0u);
+    ASSERT_EQ(stats.bytes, 0u);
+
+    // Executions are not counted without profiling.
+    set_verbose(0);
+    relu.execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    s.wait();
+    stats = relu.get_exec_stats();
+    ASSERT_EQ(stats.count, 0u);
+
+    set_verbose(2);
+    const int n_execs = 5;
+    for (int i = 0; i < n_execs; i++)
+        relu.execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    s.wait();
+    set_verbose(0);
+
+    stats = relu.get_exec_stats();
+    ASSERT_EQ(stats.count, (uint64_t)n_execs);
+    ASSERT_LE(stats.max_ns, stats.total_ns);
+    ASSERT_LE(stats.total_ns, n_execs * stats.max_ns);
+    ASSERT_EQ(stats.bytes, n_execs * 2 * md.get_size());
+
+    relu.reset_exec_stats();
+    stats = relu.get_exec_stats();
+    ASSERT_EQ(stats.count, 0u);
+    ASSERT_EQ(stats.bytes, 0u);
+}
+
+} // namespace dnnl
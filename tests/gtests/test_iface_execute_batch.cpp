@@ -0,0 +1,97 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+class execute_batch_test_t : public ::testing::Test {
+protected:
+    // Runs a small matmul over `nbatch` independent sets of arguments and
+    // checks the results against executions of the primitive one by one.
+    void Test(int nbatch, scratchpad_mode mode) {
+        engine eng = get_test_engine();
+        stream s(eng);
+
+        const memory::dim M = 8, K = 32, N = 16;
+        memory::desc src_md({M, K}, memory::data_type::f32,
+                memory::format_tag::ab);
+        memory::desc wei_md({K, N}, memory::data_type::f32,
+                memory::format_tag::ab);
+        memory::desc dst_md({M, N}, memory::data_type::f32,
+                memory::format_tag::ab);
+
+        primitive_attr attr;
+        attr.set_scratchpad_mode(mode);
+        auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr);
+        matmul prim(pd);
+
+        std::vector<std::unordered_map<int, memory>> batch_args(nbatch);
+        std::vector<memory> ref_dsts;
+        for (int i = 0; i < nbatch; i++) {
+            auto src = test::make_memory(src_md, eng);
+            auto wei = test::make_memory(wei_md, eng);
+            fill_data<float>(M * K, src, 1.f + i, 1.f);
+            fill_data<float>(K * N, wei, 2.f * i, 1.f);
+            batch_args[i] = {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, test::make_memory(dst_md, eng)}};
+            if (mode == scratchpad_mode::user) {
+                batch_args[i].insert({DNNL_ARG_SCRATCHPAD,
+                        test::make_memory(pd.scratchpad_desc(), eng)});
+            }
+
+            auto ref_args = batch_args[i];
+            ref_dsts.push_back(test::make_memory(dst_md, eng));
+            ref_args[DNNL_ARG_DST] = ref_dsts.back();
+            prim.execute(s, ref_args);
+        }
+        prim.execute_batch(s, batch_args);
+        s.wait();
+
+        for (int i = 0; i < nbatch; i++) {
+            auto dst = map_memory<float>(batch_args[i][DNNL_ARG_DST]);
+            auto ref = map_memory<float>(ref_dsts[i]);
+            for (memory::dim j = 0; j < M * N; j++)
+                ASSERT_EQ(dst[j], ref[j]) << "i=" << i << " j=" << j;
+        }
+    }
+};
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(execute_batch_test_t, TestLibraryScratchpad) {
+    Test(1, scratchpad_mode::library);
+    Test(37, scratchpad_mode::library);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(execute_batch_test_t, TestUserScratchpad) {
+    Test(23, scratchpad_mode::user);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(execute_batch_test_t, TestEmptyBatch) {
+    engine eng = get_test_engine();
+    stream s(eng);
+    memory::desc md({16}, memory::data_type::f32, memory::format_tag::a);
+    auto pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_relu, md, md,
+            0.f, 0.f);
+    eltwise_forward(pd).execute_batch(s, {});
+}
+
+} // namespace dnnl
@@ -0,0 +1,102 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#if !defined(_WIN32)
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+class memory_from_file_test_t : public ::testing::Test {};
+
+#if !defined(_WIN32)
+HANDLE_EXCEPTIONS_FOR_TEST_F(memory_from_file_test_t, TestMapFile) {
+    engine eng = get_test_engine();
+    SKIP_IF(eng.get_kind() != engine::kind::cpu
+                    || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "File-backed memory is supported on CPU only.");
+
+    memory::desc md({16, 32}, memory::data_type::f32, memory::format_tag::ab);
+    const size_t nelems = md.get_size() / sizeof(float);
+    std::vector<float> data(nelems);
+    for (size_t i = 0; i < nelems; i++)
+        data[i] = static_cast<float>(i);
+
+    // An offset that is not a multiple of the page size.
+    const size_t offset = 100;
+    const std::vector<char> header(offset, 'x');
+
+    char path[] = "/tmp/dnnl_test_memory_from_file_XXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    unlink(path);
+    ASSERT_EQ(write(fd, header.data(), header.size()), (ssize_t)offset);
+    ASSERT_EQ(write(fd, data.data(), md.get_size()), (ssize_t)md.get_size());
+
+    for (auto flags : {memory::map_flags::none, memory::map_flags::populate,
+                 memory::map_flags::prefetch}) {
+        memory mem(md, eng, fd, offset, flags);
+        const float *ptr = static_cast<const float *>(mem.get_data_handle());
+        ASSERT_NE(ptr, nullptr);
+        for (size_t i = 0; i < nelems; i++)
+            ASSERT_EQ(ptr[i], data[i]);
+    }
+
+    // The mapping stays valid after the file descriptor is closed.
+    memory mem(md, eng, fd, offset);
+    close(fd);
+
+    memory dst(md, eng);
+    auto pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_relu, md, md);
+    stream s(eng);
+    eltwise_forward(pd).execute(s, {{DNNL_ARG_SRC, mem}, {DNNL_ARG_DST, dst}});
+    s.wait();
+    const float *dst_ptr = static_cast<const float *>(dst.get_data_handle());
+    for (size_t i = 0; i < nelems; i++)
+        ASSERT_EQ(dst_ptr[i], data[i]);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(memory_from_file_test_t, TestMapFileOutOfBounds) {
+    engine eng = get_test_engine();
+    SKIP_IF(eng.get_kind() != engine::kind::cpu
+                    || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "File-backed memory is supported on CPU only.");
+
+    memory::desc md({16, 32}, memory::data_type::f32, memory::format_tag::ab);
+    const std::vector<char> data(md.get_size(), 0);
+
+    char path[] = "/tmp/dnnl_test_memory_from_file_XXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    unlink(path);
+    ASSERT_EQ(write(fd, data.data(), data.size()), (ssize_t)data.size());
+
+    EXPECT_ANY_THROW(memory(md, eng, fd, 1));
+    EXPECT_ANY_THROW(memory(md, eng, -1, 0));
+    close(fd);
+}
+#endif
+
+} // namespace dnnl
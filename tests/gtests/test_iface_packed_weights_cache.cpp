@@ -0,0 +1,96 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+class packed_weights_cache_test_t : public ::testing::Test {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Test is supported on CPU only.");
+        old_capacity_ = get_packed_weights_cache_capacity();
+        set_packed_weights_cache_capacity(size_t(1) << 20);
+    }
+    void TearDown() override {
+        if (get_test_engine_kind() != engine::kind::cpu) return;
+        set_packed_weights_cache_capacity(old_capacity_);
+    }
+
+    size_t old_capacity_ = 0;
+};
+
+TEST_F(packed_weights_cache_test_t, TestSharedCopy) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    const memory::dims dims = {32, 19, 3, 3};
+    memory weights({dims, dt::f32, tag::oihw}, eng);
+    {
+        auto ptr = map_memory<float>(weights);
+        for (size_t i = 0; i < weights.get_desc().get_size() / sizeof(float);
+                i++)
+            ptr[i] = static_cast<float>(i % 13);
+    }
+
+    memory::desc packed_md(dims, dt::f32, tag::OIhw16i16o);
+    auto packed0 = get_packed_weights(packed_md, weights, strm);
+    auto packed1 = get_packed_weights(packed_md, weights, strm);
+    ASSERT_TRUE(packed0.get_desc() == packed_md);
+    ASSERT_EQ(packed0.get_data_handle(), packed1.get_data_handle());
+
+    memory ref(packed_md, eng);
+    reorder(weights, ref).execute(strm, weights, ref);
+    strm.wait();
+    {
+        auto ref_ptr = map_memory<const float>(ref);
+        auto ptr = map_memory<const float>(packed0);
+        for (size_t i = 0; i < packed_md.get_size() / sizeof(float); i++)
+            ASSERT_EQ(ref_ptr[i], ptr[i]) << "at " << i;
+    }
+
+    // Another target layout is a separate entry.
+    memory::desc other_md(dims, dt::f32, tag::OIhw8i8o);
+    auto packed2 = get_packed_weights(other_md, weights, strm);
+    ASSERT_NE(packed0.get_data_handle(), packed2.get_data_handle());
+
+    // Disabling the cache drops the shared copies.
+    set_packed_weights_cache_capacity(0);
+    ASSERT_EQ(get_packed_weights_cache_capacity(), 0u);
+    auto packed3 = get_packed_weights(packed_md, weights, strm);
+    ASSERT_NE(packed0.get_data_handle(), packed3.get_data_handle());
+}
+
+TEST_F(packed_weights_cache_test_t, TestInvalidArguments) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    memory weights({{16, 16}, dt::f32, tag::ab}, eng);
+    memory::desc any_md({16, 16}, dt::f32, tag::any);
+    EXPECT_ANY_THROW(get_packed_weights(any_md, weights, strm));
+}
+
+} // namespace dnnl
@@ -0,0 +1,106 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+class prefetch_test_t : public ::testing::Test {};
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(prefetch_test_t, TestMatmul) {
+    engine eng = get_test_engine();
+    stream s(eng);
+
+    const memory::dim M = 1, K = 512, N = 4096;
+    memory::desc src_md({M, K}, memory::data_type::f32, memory::format_tag::ab);
+    memory::desc wei_md({K, N}, memory::data_type::f32, memory::format_tag::ab);
+    memory::desc bia_md({1, N}, memory::data_type::f32, memory::format_tag::ab);
+    memory::desc dst_md({M, N}, memory::data_type::f32, memory::format_tag::ab);
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, bia_md, dst_md);
+    matmul prim(pd);
+
+    auto src = test::make_memory(src_md, eng);
+    auto wei = test::make_memory(wei_md, eng);
+    auto bia = test::make_memory(bia_md, eng);
+    auto dst = test::make_memory(dst_md, eng);
+    auto ref = test::make_memory(dst_md, eng);
+    fill_data<float>(M * K, src, 1.f, 1.f);
+    fill_data<float>(K * N, wei, 2.f, 1.f);
+    fill_data<float>(N, bia, 3.f, 1.f);
+
+    std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, src},
+            {DNNL_ARG_WEIGHTS, wei}, {DNNL_ARG_BIAS, bia},
+            {DNNL_ARG_DST, ref}};
+    prim.execute(s, args);
+
+    // Prefetching is a hint and doesn't change the result.
+    args[DNNL_ARG_DST] = dst;
+    prim.prefetch(s, args);
+    prim.execute(s, args);
+    s.wait();
+
+    auto dst_ptr = map_memory<float>(dst);
+    auto ref_ptr = map_memory<float>(ref);
+    for (memory::dim i = 0; i < M * N; i++)
+        ASSERT_EQ(dst_ptr[i], ref_ptr[i]) << "i=" << i;
+}
+
+// The weights are released right after the execution while most of the
+// prefetch reads are still queued.
+HANDLE_EXCEPTIONS_FOR_TEST_F(prefetch_test_t, TestReleaseAfterExecution) {
+    engine eng = get_test_engine();
+    stream s(eng);
+
+    const memory::dim M = 1, K = 4096, N = 4096;
+    memory::desc src_md({M, K}, memory::data_type::f32, memory::format_tag::ab);
+    memory::desc wei_md({K, N}, memory::data_type::f32, memory::format_tag::ab);
+    memory::desc dst_md({M, N}, memory::data_type::f32, memory::format_tag::ab);
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md);
+    matmul prim(pd);
+
+    auto src = test::make_memory(src_md, eng);
+    auto dst = test::make_memory(dst_md, eng);
+    fill_data<float>(M * K, src, 1.f, 1.f);
+    for (int iter = 0; iter < 4; iter++) {
+        auto wei = test::make_memory(wei_md, eng);
+        fill_data<float>(K * N, wei, 2.f, 1.f);
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, src},
+                {DNNL_ARG_WEIGHTS, wei}, {DNNL_ARG_DST, dst}};
+        for (int i = 0; i < 8; i++)
+            prim.prefetch(s, args);
+        prim.execute(s, args);
+        s.wait();
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(prefetch_test_t, TestInvalidArguments) {
+    engine eng = get_test_engine();
+    stream s(eng);
+    memory::desc md({16}, memory::data_type::f32, memory::format_tag::a);
+    auto pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_relu, md, md,
+            0.f, 0.f);
+    eltwise_forward prim(pd);
+    EXPECT_EQ(dnnl_primitive_prefetch(prim.get(), s.get(), 1, nullptr),
+            dnnl_invalid_arguments);
+    EXPECT_EQ(dnnl_primitive_prefetch(nullptr, s.get(), 0, nullptr),
+            dnnl_invalid_arguments);
+}
+
+} // namespace dnnl
@@ -116,6 +116,83 @@ TEST(primitive_cache_test, TestCacheHit) {
 #endif
     ASSERT_EQ(get_primitive_cache_size(), 2);
 }
+
+TEST(primitive_cache_test, TestMemoryLimit) {
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(16);
+    set_primitive_cache_memory_limit(0);
+    ASSERT_EQ(get_primitive_cache_memory_limit(), 0u);
+
+    fill_primitive_cache(8);
+    ASSERT_EQ(get_primitive_cache_size(), 8);
+
+    size_t usage = 0;
+    ASSERT_EQ(impl::get_primitive_cache_memory_usage(&usage), dnnl_success);
+    // Only generated code is accounted for.
+    if (usage == 0) return;
+
+    const size_t limit = usage / 2;
+    set_primitive_cache_memory_limit(limit);
+    ASSERT_EQ(get_primitive_cache_memory_limit(), limit);
+    ASSERT_EQ(impl::get_primitive_cache_memory_usage(&usage), dnnl_success);
+    ASSERT_LE(usage, limit);
+    ASSERT_LT(get_primitive_cache_size(), 8);
+
+    set_primitive_cache_memory_limit(0);
+}
+
+TEST(primitive_cache_test, TestWarmUp) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(16);
+
+    engine eng(get_test_engine_kind(), 0);
+    std::vector<primitive_desc> pds;
+    for (int i = 1; i <= 6; i++) {
+        auto md = memory::desc({i, 8, 3, 3}, dt::f32, tag::nchw);
+        pds.push_back(eltwise_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::eltwise_relu, md, md,
+                0.f, 0.f));
+    }
+
+    ASSERT_NO_THROW(warm_up_primitive_cache(pds));
+    ASSERT_EQ(get_primitive_cache_size(), 6);
+
+    for (const auto &pd : pds)
+        auto p = primitive(pd);
+    ASSERT_EQ(get_primitive_cache_size(), 6);
+
+    ASSERT_EQ(dnnl_primitive_cache_warm_up(1, nullptr), dnnl_invalid_arguments);
+}
+
+TEST(primitive_cache_test, TestAsyncCreation) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(4);
+
+    engine eng(get_test_engine_kind(), 0);
+    auto md = memory::desc({2, 3, 4, 5}, dt::f32, tag::nchw);
+    auto relu_pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_relu, md, md, 0.f,
+            0.f);
+
+    primitive p;
+    ASSERT_NO_THROW(p = create_primitive_async(relu_pd).get());
+    ASSERT_TRUE(bool(p));
+    ASSERT_EQ(p.get_kind(), primitive::kind::eltwise);
+    ASSERT_EQ(get_primitive_cache_size(), 1);
+
+    // The primitive created in the background is a cache hit now.
+    auto relu = eltwise_forward(relu_pd);
+    ASSERT_EQ(get_primitive_cache_size(), 1);
+
+    ASSERT_EQ(dnnl_primitive_create_async(relu_pd.get(), nullptr, nullptr),
+            dnnl_invalid_arguments);
+}
 #endif
 
 } // namespace dnnl
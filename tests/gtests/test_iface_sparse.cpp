@@ -35,6 +35,15 @@ TEST(iface_sparse_test_t, TestSparseMDCreation) {
     ASSERT_NO_THROW(md = memory::desc::coo({64, 128}, dt::f32, nnz, dt::s32));
     // Packed.
     ASSERT_NO_THROW(md = memory::desc::packed({64, 128}, dt::f32, nnz));
+    // BSR.
+    ASSERT_NO_THROW(md = memory::desc::bsr({64, 128}, dt::f32, nnz, {16, 16},
+                            dt::s32, dt::s32));
+    // Dimensions must be divisible by the block dimensions.
+    EXPECT_ANY_THROW(md = memory::desc::bsr({64, 120}, dt::f32, nnz,
+                             {16, 16}, dt::s32, dt::s32));
+    // No more blocks than the tensor has.
+    EXPECT_ANY_THROW(md = memory::desc::bsr({64, 128}, dt::f32, 33,
+                             {16, 16}, dt::s32, dt::s32));
 }
 
 TEST(iface_sparse_test_t, TestSparseMDComparison) {
@@ -139,6 +148,34 @@ TEST(iface_sparse_test_t, TestSparseMDQueries) {
 
     ASSERT_EQ(md.get_nnz(), nnz);
     ASSERT_EQ(md.get_sparse_encoding(), memory::sparse_encoding::packed);
+
+    // Packed 2:4.
+    ASSERT_NO_THROW(md = memory::desc::packed_2_4(dims, data_type));
+    ASSERT_EQ(md.get_dims(), dims);
+    ASSERT_EQ(md.get_data_type(), data_type);
+    ASSERT_EQ(md.get_format_kind(), memory::format_kind::sparse);
+
+    ASSERT_EQ(md.get_nnz(), dims[0] * dims[1] / 2);
+    ASSERT_EQ(md.get_sparse_encoding(), memory::sparse_encoding::packed_2_4);
+    ASSERT_EQ(md.get_num_handles(), 2);
+
+    // BSR.
+    ASSERT_NO_THROW(md = memory::desc::bsr(dims, data_type, nnz, {16, 32},
+                            indices_dt, pointers_dt));
+    ASSERT_EQ(md.get_dims(), dims);
+    ASSERT_EQ(md.get_data_type(0), data_type);
+    ASSERT_EQ(md.get_format_kind(), memory::format_kind::sparse);
+
+    ASSERT_EQ(md.get_nnz(), nnz);
+    ASSERT_EQ(md.get_sparse_encoding(), memory::sparse_encoding::bsr);
+    ASSERT_EQ(md.get_data_type(1), indices_dt);
+    ASSERT_EQ(md.get_data_type(2), pointers_dt);
+
+    // Block dimensions are a part of the descriptor.
+    memory::desc md2;
+    ASSERT_NO_THROW(md2 = memory::desc::bsr(dims, data_type, nnz, {32, 16},
+                            indices_dt, pointers_dt));
+    ASSERT_NE(md, md2);
 }
 
 TEST(iface_sparse_test_t, TestSparseMDSize) {
@@ -194,6 +231,21 @@ TEST(iface_sparse_test_t, TestSparseMDSize) {
 
     // Size of bitmask.
     ASSERT_EQ(md.get_size(2), 0u);
+
+    // BSR.
+    ASSERT_NO_THROW(md = memory::desc::bsr({64, 128}, dt::f32, nnz, {16, 32},
+                            dt::s32, dt::s32));
+    // Size of values: every stored block is dense.
+    exp_values_size = nnz * 16 * 32 * memory::data_type_size(dt::f32);
+    ASSERT_EQ(md.get_size(), exp_values_size);
+    ASSERT_EQ(md.get_size(0), exp_values_size);
+
+    // Size of block column indices.
+    exp_indices_size = nnz * memory::data_type_size(dt::s32);
+    ASSERT_EQ(md.get_size(1), exp_indices_size);
+
+    // Size of block row pointers.
+    ASSERT_EQ(md.get_size(2), (64 / 16 + 1) * memory::data_type_size(dt::s32));
 }
 
 HANDLE_EXCEPTIONS_FOR_TEST(iface_sparse_test_t, TestSparseMemoryCreation) {
@@ -405,4 +457,73 @@ TEST(iface_sparse_test_t, TestSparseMemoryMapUnmap) {
     ASSERT_NO_THROW(mem.unmap_data(mapped_col_indices, 2));
 }
 
+HANDLE_EXCEPTIONS_FOR_TEST(iface_sparse_test_t, TestBsrMatmul) {
+    engine eng = get_test_engine();
+
+    const bool is_unimplemented = (eng.get_kind() == engine::kind::gpu
+            || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL);
+    if (is_unimplemented) return;
+
+    const memory::dim M = 37, K = 96, N = 64, R = 16, C = 16;
+    const memory::dim nb_k = K / R, nb_n = N / C;
+
+    // Keep every third block, the last block column is empty.
+    std::vector<float> values;
+    std::vector<int> indices, pointers(1, 0);
+    for (memory::dim kb = 0; kb < nb_k; kb++) {
+        for (memory::dim nb = 0; nb < nb_n - 1; nb++) {
+            if ((kb + nb) % 3 != 0) continue;
+            indices.push_back((int)nb);
+            for (memory::dim i = 0; i < R * C; i++)
+                values.push_back(((kb * 7 + nb * 3 + i) % 11 - 5) / 4.f);
+        }
+        pointers.push_back((int)indices.size());
+    }
+    const memory::dim nnz = (memory::dim)indices.size();
+
+    std::vector<float> src(M * K);
+    for (memory::dim i = 0; i < M * K; i++)
+        src[i] = ((i * 5) % 13 - 6) / 8.f;
+
+    // Reference computed from the blocks directly.
+    std::vector<float> ref(M * N, 0.f);
+    for_(memory::dim m = 0; m < M; m++)
+    for (memory::dim kb = 0; kb < nb_k; kb++)
+        for (int p = pointers[kb]; p < pointers[kb + 1]; p++)
+            for_(memory::dim r = 0; r < R; r++)
+            for (memory::dim c = 0; c < C; c++)
+                ref[m * N + indices[p] * C + c] += src[m * K + kb * R + r]
+                        * values[p * R * C + r * C + c];
+
+    const auto src_md = memory::desc({M, K}, dt::f32, memory::format_tag::ab);
+    const auto wei_md = memory::desc::bsr(
+            {K, N}, dt::f32, nnz, {R, C}, dt::s32, dt::s32);
+    const auto dst_md = memory::desc({M, N}, dt::f32, memory::format_tag::ab);
+
+    matmul::primitive_desc pd;
+    ASSERT_NO_THROW(pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md));
+
+    memory src_mem(src_md, eng, src.data());
+    memory wei_mem(
+            wei_md, eng, {values.data(), indices.data(), pointers.data()});
+    memory dst_mem(dst_md, eng);
+    // Zero blocks must be written as well.
+    float *dst_ptr = dst_mem.map_data<float>();
+    std::fill(dst_ptr, dst_ptr + M * N, 42.f);
+    dst_mem.unmap_data(dst_ptr);
+
+    stream strm(eng);
+    matmul(pd).execute(strm,
+            {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_WEIGHTS, wei_mem},
+                    {DNNL_ARG_DST, dst_mem}});
+    strm.wait();
+
+    dst_ptr = dst_mem.map_data<float>();
+    for (memory::dim i = 0; i < M * N; i++)
+        ASSERT_NEAR(dst_ptr[i], ref[i],
+                1e-4f * std::max(1.f, std::fabs(ref[i])))
+                << "i = " << i;
+    dst_mem.unmap_data(dst_ptr);
+}
+
 } // namespace dnnl
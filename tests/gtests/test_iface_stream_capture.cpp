@@ -0,0 +1,101 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+class stream_capture_test_t : public ::testing::Test {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu
+                        && !is_nvidia_gpu(get_test_engine()),
+                "Stream capture is supported for CPU and NVIDIA GPU only");
+    }
+};
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(stream_capture_test_t, TestReplay) {
+    engine eng = get_test_engine();
+    stream s(eng);
+
+    const memory::dim n = 64;
+    memory::desc md({n}, memory::data_type::f32, memory::format_tag::a);
+    auto relu_pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_relu, md, md,
+            0.f, 0.f);
+    auto linear_pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_linear, md, md,
+            2.f, 1.f);
+
+    auto src = test::make_memory(md, eng);
+    auto tmp = test::make_memory(md, eng);
+    auto dst = test::make_memory(md, eng);
+
+    auto fill = [&](float shift) {
+        auto ptr = map_memory<float>(src);
+        for (memory::dim i = 0; i < n; i++)
+            ptr[i] = static_cast<float>(i) - n / 2 + shift;
+    };
+    auto check = [&](float shift) {
+        auto ptr = map_memory<float>(dst);
+        for (memory::dim i = 0; i < n; i++) {
+            float x = static_cast<float>(i) - n / 2 + shift;
+            ASSERT_EQ(ptr[i], 2.f * (x > 0.f ? x : 0.f) + 1.f);
+        }
+    };
+
+    stream_capture capture;
+    {
+        // Primitives are kept alive by the capture.
+        eltwise_forward relu(relu_pd);
+        eltwise_forward linear(linear_pd);
+
+        fill(0.f);
+        stream_capture::begin(s);
+        relu.execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, tmp}});
+        linear.execute(s, {{DNNL_ARG_SRC, tmp}, {DNNL_ARG_DST, dst}});
+        capture = stream_capture::end(s);
+        s.wait();
+        check(0.f);
+    }
+
+    for (float shift : {3.f, -5.f}) {
+        fill(shift);
+        capture.replay(s);
+        s.wait();
+        check(shift);
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(stream_capture_test_t, TestInvalidUsage) {
+    engine eng = get_test_engine();
+    stream s(eng), other(eng);
+
+    EXPECT_ANY_THROW(stream_capture::end(s));
+
+    stream_capture::begin(s);
+    EXPECT_ANY_THROW(stream_capture::begin(s));
+    auto capture = stream_capture::end(s);
+
+    // A capture can only be replayed on the recorded stream.
+    EXPECT_ANY_THROW(capture.replay(other));
+    EXPECT_NO_THROW(capture.replay(s));
+}
+
+} // namespace dnnl
@@ -71,4 +71,104 @@ TEST_F(threadpool_test_t, TestMaxConcurrencyConcurrent) {
         ASSERT_EQ(r, dnnl_success);
 }
 
+// Forwards to the testing threadpool and requests non-blocking execution.
+struct non_blocking_threadpool_t
+    : public dnnl::threadpool_interop::threadpool_iface {
+    non_blocking_threadpool_t() : tp_(testing::get_threadpool()) {}
+
+    int get_num_threads() const override { return tp_->get_num_threads(); }
+    bool get_in_parallel() const override { return tp_->get_in_parallel(); }
+    void parallel_for(
+            int n, const std::function<void(int, int)> &fn) override {
+        tp_->parallel_for(n, fn);
+    }
+    uint64_t get_flags() const override {
+        return tp_->get_flags() | NON_BLOCKING;
+    }
+
+private:
+    dnnl::threadpool_interop::threadpool_iface *tp_;
+};
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(threadpool_test_t, TestNonBlockingStream) {
+    engine eng(engine::kind::cpu, 0);
+
+    non_blocking_threadpool_t tp;
+    stream s = threadpool_interop::make_stream(eng, &tp);
+
+    const memory::dim N = 16, C = 64;
+    memory::desc md({N, C}, memory::data_type::f32, memory::format_tag::ab);
+    memory src(md, eng), mid(md, eng), dst(md, eng);
+
+    const size_t nelems = md.get_size() / sizeof(float);
+    {
+        auto ptr = map_memory<float>(src);
+        for (size_t i = 0; i < nelems; i++)
+            ptr[i] = (float)i - (float)nelems / 2;
+    }
+
+    {
+        // The primitives are released before the stream is joined.
+        auto relu_pd = eltwise_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::eltwise_relu, md, md,
+                0.f);
+        auto linear_pd = eltwise_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::eltwise_linear, md,
+                md, 2.f, 1.f);
+        eltwise_forward(relu_pd).execute(
+                s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, mid}});
+        eltwise_forward(linear_pd).execute(
+                s, {{DNNL_ARG_SRC, mid}, {DNNL_ARG_DST, dst}});
+    }
+    s.wait();
+
+    auto src_ptr = map_memory<float>(src);
+    auto dst_ptr = map_memory<float>(dst);
+    for (size_t i = 0; i < nelems; i++)
+        ASSERT_EQ(dst_ptr[i], 2.f * std::max(src_ptr[i], 0.f) + 1.f);
+}
+
+// Plain layouts make the convolution use an implementation with a
+// scratchpad, which must be available on the thread executing the task.
+HANDLE_EXCEPTIONS_FOR_TEST_F(threadpool_test_t, TestNonBlockingScratchpad) {
+    engine eng(engine::kind::cpu, 0);
+
+    non_blocking_threadpool_t tp;
+    stream s = threadpool_interop::make_stream(eng, &tp);
+    stream ref_s
+            = threadpool_interop::make_stream(eng, testing::get_threadpool());
+
+    memory::desc src_md({2, 8, 14, 14}, memory::data_type::f32,
+            memory::format_tag::nchw);
+    memory::desc wei_md({16, 8, 3, 3}, memory::data_type::f32,
+            memory::format_tag::oihw);
+    memory::desc dst_md({2, 16, 12, 12}, memory::data_type::f32,
+            memory::format_tag::nchw);
+    auto pd = convolution_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::convolution_direct,
+            src_md, wei_md, dst_md, {1, 1}, {0, 0}, {0, 0});
+    convolution_forward conv(pd);
+
+    memory src(src_md, eng), wei(wei_md, eng), dst(dst_md, eng),
+            ref(dst_md, eng);
+    fill_data<float>(src_md.get_size() / sizeof(float), src, 1.f, 1.f);
+    fill_data<float>(wei_md.get_size() / sizeof(float), wei, 2.f, 1.f);
+
+    conv.execute(ref_s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, ref}});
+    ref_s.wait();
+    for (int i = 0; i < 2; i++)
+        conv.execute(s,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst}});
+    s.wait();
+
+    const size_t nelems = dst_md.get_size() / sizeof(float);
+    auto dst_ptr = map_memory<float>(dst);
+    auto ref_ptr = map_memory<float>(ref);
+    for (size_t i = 0; i < nelems; i++)
+        ASSERT_EQ(dst_ptr[i], ref_ptr[i]) << "i=" << i;
+}
+
 } // namespace dnnl
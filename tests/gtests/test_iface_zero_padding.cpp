@@ -0,0 +1,142 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+class zero_padding_test_t : public ::testing::Test {};
+
+// Linear eltwise maps zero to a non-zero value, so implementations that
+// compute over the padded area rely on the library to zero it afterwards.
+// Every execution must leave the padded area of the output zero, not only
+// the first one.
+HANDLE_EXCEPTIONS_FOR_TEST_F(zero_padding_test_t, TestRepeatedExecution) {
+    engine eng = get_test_engine();
+    stream s(eng);
+
+    const memory::dim N = 2, C = 3, H = 4, W = 4, blk = 16;
+    memory::desc md({N, C, H, W}, memory::data_type::f32,
+            memory::format_tag::nChw16c);
+    auto pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_linear, md, md,
+            1.f, 1.f);
+    eltwise_forward prim(pd);
+
+    auto src = test::make_memory(md, eng);
+    auto dst = test::make_memory(md, eng);
+    const memory::dim nelems = N * blk * H * W;
+    {
+        auto src_ptr = map_memory<float>(src);
+        for (memory::dim i = 0; i < nelems; i++)
+            src_ptr[i] = (i % blk < C) ? static_cast<float>(i % 7) : 0.f;
+    }
+
+    for (int iter = 0; iter < 2; iter++)
+        prim.execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    s.wait();
+
+    auto dst_ptr = map_memory<float>(dst);
+    for (memory::dim i = 0; i < nelems; i++) {
+        const float expected
+                = (i % blk < C) ? static_cast<float>(i % 7) + 1.f : 0.f;
+        ASSERT_EQ(dst_ptr[i], expected) << "i=" << i;
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(zero_padding_test_t, TestAlternatingPrimitives) {
+    engine eng = get_test_engine();
+    stream s(eng);
+
+    const memory::dim N = 2, C = 3, H = 4, W = 4, blk = 16;
+    memory::desc md({N, C, H, W}, memory::data_type::f32,
+            memory::format_tag::nChw16c);
+    auto linear_pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_linear, md, md,
+            1.f, 1.f);
+    auto relu_pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_relu, md, md);
+    eltwise_forward linear(linear_pd), relu(relu_pd);
+
+    auto src = test::make_memory(md, eng);
+    // The destination is never accessed by the user until the end, so its
+    // padding state is tracked by the library across the executions.
+    auto dst = test::make_memory(md, eng);
+    const memory::dim nelems = N * blk * H * W;
+    {
+        auto src_ptr = map_memory<float>(src);
+        for (memory::dim i = 0; i < nelems; i++)
+            src_ptr[i] = (i % blk < C) ? static_cast<float>(i % 7) - 3.f : 0.f;
+    }
+
+    for (int iter = 0; iter < 3; iter++) {
+        linear.execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+        relu.execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    }
+    s.wait();
+
+    auto dst_ptr = map_memory<float>(dst);
+    for (memory::dim i = 0; i < nelems; i++) {
+        const float expected = (i % blk < C)
+                ? std::max(static_cast<float>(i % 7) - 3.f, 0.f)
+                : 0.f;
+        ASSERT_EQ(dst_ptr[i], expected) << "i=" << i;
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(zero_padding_test_t, TestUserWritesPadding) {
+    engine eng = get_test_engine();
+    stream s(eng);
+
+    const memory::dim N = 2, C = 3, H = 4, W = 4, blk = 16;
+    memory::desc md({N, C, H, W}, memory::data_type::f32,
+            memory::format_tag::nChw16c);
+    auto pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_relu, md, md);
+    eltwise_forward prim(pd);
+
+    auto src = test::make_memory(md, eng);
+    auto dst = test::make_memory(md, eng);
+    const memory::dim nelems = N * blk * H * W;
+    {
+        auto src_ptr = map_memory<float>(src);
+        for (memory::dim i = 0; i < nelems; i++)
+            src_ptr[i] = (i % blk < C) ? static_cast<float>(i % 7) : 0.f;
+    }
+
+    prim.execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    s.wait();
+    {
+        // Dirty the padded area behind the library's back.
+        auto dst_ptr = map_memory<float>(dst);
+        for (memory::dim i = 0; i < nelems; i++)
+            if (i % blk >= C) dst_ptr[i] = 42.f;
+    }
+    prim.execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    s.wait();
+
+    auto dst_ptr = map_memory<float>(dst);
+    for (memory::dim i = 0; i < nelems; i++) {
+        const float expected
+                = (i % blk < C) ? static_cast<float>(i % 7) : 0.f;
+        ASSERT_EQ(dst_ptr[i], expected) << "i=" << i;
+    }
+}
+
+} // namespace dnnl
@@ -127,6 +127,16 @@ protected:
                             | flags::use_global_stats);
         }
 
+        // Residual add mode is supported on CPU only
+        if (get_test_engine_kind() == engine::kind::cpu
+                && p.src_dt == memory::data_type::f32
+                && p.dst_dt == memory::data_type::f32) {
+            ForwardResidual(training);
+            ForwardResidual(inference, flags::use_scale | flags::use_shift);
+            ForwardResidual(inference,
+                    flags::rms_norm | flags::use_scale | flags::use_shift);
+        }
+
         if (!impl::utils::one_of(p.dst_dt, memory::data_type::f16,
                     memory::data_type::s8, memory::data_type::u8)) {
             diff_src_md = std::make_shared<memory::desc>(
@@ -236,6 +246,91 @@ protected:
         execlnormFwd(isTraining, useGlobalStats, useScale, useShift, skipMean);
     }
 
+    // Compares the residual add mode against the normalization of the sum
+    // computed on the host.
+    void ForwardResidual(prop_kind pk,
+            normalization_flags flags = normalization_flags::none) {
+        using pd_t = layer_normalization_forward::primitive_desc;
+        const auto res_flags = flags | normalization_flags::fuse_residual_add
+                | normalization_flags::save_residual_sum;
+
+        auto res_pd = pd_t(
+                eng, pk, *src_md, *dst_md, *stat_d, epsilon, res_flags);
+        auto ref_pd = pd_t(eng, pk, *src_md, *dst_md, *stat_d, epsilon, flags);
+
+        ASSERT_TRUE(res_pd.query_md(query::exec_arg_md, DNNL_ARG_SRC_1)
+                == res_pd.src_desc());
+        ASSERT_TRUE(res_pd.query_md(query::exec_arg_md, DNNL_ARG_DST_1)
+                == res_pd.src_desc());
+        ASSERT_EQ(res_pd.get_flags(), res_flags);
+
+        bool useScale = (bool)(flags & normalization_flags::use_scale);
+        bool useShift = (bool)(flags & normalization_flags::use_shift);
+        bool skipMean = (bool)(flags & normalization_flags::rms_norm);
+        bool isTraining = pk == prop_kind::forward_training;
+
+        auto src_m = test::make_memory(res_pd.src_desc(), eng);
+        auto src_1_m = test::make_memory(res_pd.src_desc(), eng);
+        auto sum_m = test::make_memory(res_pd.src_desc(), eng);
+        auto ref_sum_m = test::make_memory(res_pd.src_desc(), eng);
+        auto dst_m = test::make_memory(res_pd.dst_desc(), eng);
+        auto ref_dst_m = test::make_memory(res_pd.dst_desc(), eng);
+
+        fill<float>(src_m);
+        fill<float>(src_1_m);
+        {
+            const auto nelems = res_pd.src_desc().get_size() / sizeof(float);
+            auto src_ptr = map_memory<float>(src_m);
+            auto src_1_ptr = map_memory<float>(src_1_m);
+            auto ref_sum_ptr = map_memory<float>(ref_sum_m);
+            for (size_t i = 0; i < nelems; i++)
+                ref_sum_ptr[i] = src_ptr[i] + src_1_ptr[i];
+        }
+
+        std::unordered_map<int, memory> res_args = {
+                {DNNL_ARG_SRC, src_m},
+                {DNNL_ARG_SRC_1, src_1_m},
+                {DNNL_ARG_DST, dst_m},
+                {DNNL_ARG_DST_1, sum_m},
+        };
+        std::unordered_map<int, memory> ref_args = {
+                {DNNL_ARG_SRC, ref_sum_m},
+                {DNNL_ARG_DST, ref_dst_m},
+        };
+
+        if (useScale) {
+            weights = test::make_memory(res_pd.weights_desc(), eng);
+            fill<float>(weights);
+            res_args.insert({DNNL_ARG_SCALE, weights});
+            ref_args.insert({DNNL_ARG_SCALE, weights});
+        }
+        if (useShift) {
+            bias = test::make_memory(res_pd.weights_desc(), eng);
+            fill<float>(bias);
+            res_args.insert({DNNL_ARG_SHIFT, bias});
+            ref_args.insert({DNNL_ARG_SHIFT, bias});
+        }
+        if (isTraining) {
+            auto ref_mean = test::make_memory(*stat_d, eng);
+            auto ref_variance = test::make_memory(*stat_d, eng);
+            mean = test::make_memory(*stat_d, eng);
+            variance = test::make_memory(*stat_d, eng);
+            if (!skipMean) {
+                res_args.insert({DNNL_ARG_MEAN, mean});
+                ref_args.insert({DNNL_ARG_MEAN, ref_mean});
+            }
+            res_args.insert({DNNL_ARG_VARIANCE, variance});
+            ref_args.insert({DNNL_ARG_VARIANCE, ref_variance});
+        }
+
+        layer_normalization_forward(res_pd).execute(strm, res_args);
+        layer_normalization_forward(ref_pd).execute(strm, ref_args);
+        strm.wait();
+
+        compare_data<float>(ref_sum_m, sum_m);
+        compare_data<float>(ref_dst_m, dst_m);
+    }
+
     void Backward(prop_kind pk,
             normalization_flags flags = normalization_flags::none) {
         bwd_iface_test_stat_any(pk, flags);
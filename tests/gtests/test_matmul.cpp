@@ -669,6 +669,76 @@ INSTANTIATE_TEST_SUITE_P(
 INSTANTIATE_TEST_SUITE_P(
         Generic_u8s8u8, iface, cases_x8(data_type::u8, data_type::u8));
 
+class runtime_shape_test_t : public ::testing::Test {};
+
+// Executes a matmul with runtime M over more distinct shapes than the x64
+// brgemm implementation keeps specialized primitives for, then goes back to
+// the evicted shapes.
+HANDLE_EXCEPTIONS_FOR_TEST_F(runtime_shape_test_t, TestRuntimeMDispatch) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Runtime dimensions are checked on CPU only.");
+    engine eng = get_test_engine();
+    stream strm(eng);
+
+    const memory::dim K = 32, N = 24;
+    const memory::dim RT = DNNL_RUNTIME_DIM_VAL;
+    memory::desc src_rt_md({RT, K}, data_type::f32, tag::ab);
+    memory::desc wei_md({K, N}, data_type::f32, tag::ab);
+    memory::desc dst_rt_md({RT, N}, data_type::f32, tag::ab);
+
+    auto wei = test::make_memory(wei_md, eng);
+    {
+        auto w = map_memory<float>(wei);
+        for (memory::dim i = 0; i < K * N; i++)
+            w[i] = static_cast<float>(i % 5) - 2.f;
+    }
+
+    std::vector<memory::dim> Ms;
+    for (memory::dim M = 1; M <= 20; M++)
+        Ms.push_back(M);
+    for (memory::dim M = 1; M <= 4; M++)
+        Ms.push_back(M);
+
+    for (auto mode : {scratchpad_mode::library, scratchpad_mode::user}) {
+        primitive_attr attr;
+        attr.set_scratchpad_mode(mode);
+        auto pd = matmul::primitive_desc(
+                eng, src_rt_md, wei_md, dst_rt_md, attr);
+        matmul prim(pd);
+        auto scratchpad = test::make_memory(pd.scratchpad_desc(), eng);
+
+        for (auto M : Ms) {
+            memory::desc src_md({M, K}, data_type::f32, tag::ab);
+            memory::desc dst_md({M, N}, data_type::f32, tag::ab);
+            auto src = test::make_memory(src_md, eng);
+            auto dst = test::make_memory(dst_md, eng);
+            {
+                auto s = map_memory<float>(src);
+                for (memory::dim i = 0; i < M * K; i++)
+                    s[i] = static_cast<float>((i + M) % 3);
+            }
+
+            std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, src},
+                    {DNNL_ARG_WEIGHTS, wei}, {DNNL_ARG_DST, dst}};
+            if (mode == scratchpad_mode::user)
+                args[DNNL_ARG_SCRATCHPAD] = scratchpad;
+            prim.execute(strm, args);
+            strm.wait();
+
+            auto s = map_memory<float>(src);
+            auto w = map_memory<float>(wei);
+            auto d = map_memory<float>(dst);
+            for (memory::dim m = 0; m < M; m++)
+                for (memory::dim n = 0; n < N; n++) {
+                    float ref = 0.f;
+                    for (memory::dim k = 0; k < K; k++)
+                        ref += s[m * K + k] * w[k * N + n];
+                    ASSERT_EQ(d[m * N + n], ref) << "M=" << M;
+                }
+        }
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(TensorDims, attr_test_t,
         ::testing::Values(
                 // {{src0, src1, dst same_dim}, { binary post-op dim }},
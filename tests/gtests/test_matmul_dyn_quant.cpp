@@ -0,0 +1,176 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+class matmul_dyn_quant_test_t : public ::testing::Test {
+protected:
+    engine eng_ {engine::kind::cpu, 0};
+    stream strm_ {eng_};
+
+    // Runs an f32 x s8 matmul with dynamic quantization of the source and
+    // compares the result against a naive computation over the source
+    // quantized with the same per-row scales.
+    void Test(const memory::dims &src_dims, memory::dim N, bool with_bias,
+            bool with_wei_scales, bool with_relu,
+            bool with_src_scales = false) {
+        const int nd = static_cast<int>(src_dims.size());
+        const memory::dim K = src_dims[nd - 1];
+        memory::dim MB = 1;
+        for (int d = 0; d < nd - 1; d++)
+            MB *= src_dims[d];
+
+        memory::dims wei_dims(nd, 1), bia_dims(nd, 1), dst_dims = src_dims;
+        wei_dims[nd - 2] = K;
+        wei_dims[nd - 1] = N;
+        bia_dims[nd - 1] = N;
+        dst_dims[nd - 1] = N;
+        const tag abx = nd == 2 ? tag::ab : tag::abc;
+
+        memory::desc src_md(src_dims, dt::f32, abx);
+        memory::desc wei_md(wei_dims, dt::s8, abx);
+        memory::desc bia_md(bia_dims, dt::f32, abx);
+        memory::desc dst_md(dst_dims, dt::f32, abx);
+
+        primitive_attr attr;
+        attr.set_src_dynamic_quantization(dt::s8);
+        if (with_wei_scales)
+            attr.set_scales_mask(DNNL_ARG_WEIGHTS, 1 << (nd - 1));
+        // one scale per row of all batches
+        if (with_src_scales)
+            attr.set_scales(DNNL_ARG_SRC, (1 << nd) - 1, {1, K}, dt::f32);
+        if (with_relu) {
+            post_ops po;
+            po.append_eltwise(algorithm::eltwise_relu, 0.f, 0.f);
+            attr.set_post_ops(po);
+        }
+
+        auto pd = with_bias ? matmul::primitive_desc(
+                          eng_, src_md, wei_md, bia_md, dst_md, attr)
+                            : matmul::primitive_desc(
+                                    eng_, src_md, wei_md, dst_md, attr);
+        ASSERT_EQ(pd.get_primitive_attr().get_src_dynamic_quantization(),
+                dt::s8);
+
+        memory src(src_md, eng_), wei(wei_md, eng_), bia(bia_md, eng_),
+                dst(dst_md, eng_);
+        memory wei_sc({{N}, dt::f32, tag::a}, eng_);
+        memory src_sc({{MB}, dt::f32, tag::a}, eng_);
+        fill_data<float>(MB * K, src, 1.f, 2.f);
+        {
+            auto w = map_memory<int8_t>(wei);
+            for (memory::dim i = 0; i < K * N; i++)
+                w[i] = static_cast<int8_t>((i * 7) % 15 - 7);
+            auto sc = map_memory<float>(wei_sc);
+            for (memory::dim n = 0; n < N; n++)
+                sc[n] = 0.25f * (1 + n % 3);
+            auto ssc = map_memory<float>(src_sc);
+            for (memory::dim m = 0; m < MB; m++)
+                ssc[m] = 0.02f * (1 + m % 4);
+        }
+        fill_data<float>(N, bia, 1.f, 0.5f);
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, src},
+                {DNNL_ARG_WEIGHTS, wei}, {DNNL_ARG_DST, dst}};
+        if (with_bias) args.insert({DNNL_ARG_BIAS, bia});
+        if (with_wei_scales)
+            args.insert({DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS, wei_sc});
+        if (with_src_scales)
+            args.insert({DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC, src_sc});
+        matmul(pd).execute(strm_, args);
+        strm_.wait();
+
+        auto s = map_memory<float>(src);
+        auto w = map_memory<int8_t>(wei);
+        auto b = map_memory<float>(bia);
+        auto sc = map_memory<float>(wei_sc);
+        auto ssc = map_memory<float>(src_sc);
+        auto d = map_memory<float>(dst);
+        std::vector<int8_t> q(K);
+        for (memory::dim m = 0; m < MB; m++) {
+            float amax = 0.f;
+            for (memory::dim k = 0; k < K; k++)
+                amax = std::max(amax, std::fabs(s[m * K + k]));
+            const float row_scale = with_src_scales ? ssc[m] : amax / 127.f;
+            const float inv_scale = row_scale > 0.f ? 1.f / row_scale : 0.f;
+            for (memory::dim k = 0; k < K; k++)
+                q[k] = static_cast<int8_t>(std::max(-128.f,
+                        std::min(127.f,
+                                std::nearbyint(s[m * K + k] * inv_scale))));
+
+            for (memory::dim n = 0; n < N; n++) {
+                int acc = 0;
+                for (memory::dim k = 0; k < K; k++)
+                    acc += q[k] * w[k * N + n];
+                float ref = acc * row_scale;
+                if (with_wei_scales) ref *= sc[n];
+                if (with_bias) ref += b[n];
+                if (with_relu) ref = std::max(ref, 0.f);
+                const float got = d[m * N + n];
+                ASSERT_NEAR(got, ref, 1e-5f * K * (1.f + std::fabs(ref)))
+                        << "m=" << m << " n=" << n;
+            }
+        }
+    }
+};
+
+TEST_F(matmul_dyn_quant_test_t, TestPlain) {
+    Test({1, 64}, 32, false, false, false);
+    Test({7, 96}, 48, true, false, false);
+}
+
+TEST_F(matmul_dyn_quant_test_t, TestScalesAndPostOps) {
+    Test({5, 128}, 64, true, true, true);
+    Test({2, 3, 64}, 17, true, true, false);
+}
+
+TEST_F(matmul_dyn_quant_test_t, TestSrcScales) {
+    Test({6, 64}, 16, false, false, false, true);
+    Test({2, 3, 32}, 24, true, true, true, true);
+}
+
+TEST_F(matmul_dyn_quant_test_t, TestUnsupported) {
+    memory::desc src_md({4, 16}, dt::f32, tag::ab);
+    memory::desc dst_md({4, 8}, dt::f32, tag::ab);
+
+    primitive_attr attr;
+    attr.set_src_dynamic_quantization(dt::s8);
+
+    // Floating-point weights can't be used with an integer source.
+    memory::desc wei_f32_md({16, 8}, dt::f32, tag::ab);
+    EXPECT_ANY_THROW(
+            matmul::primitive_desc(eng_, src_md, wei_f32_md, dst_md, attr));
+
+    // Given source scales must cover whole rows.
+    memory::desc wei_md({16, 8}, dt::s8, tag::ab);
+    attr.set_scales(DNNL_ARG_SRC, 3, {1, 8}, dt::f32);
+    EXPECT_ANY_THROW(
+            matmul::primitive_desc(eng_, src_md, wei_md, dst_md, attr));
+}
+
+} // namespace dnnl
@@ -0,0 +1,270 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct optimizer_test_params_t {
+    algorithm alg;
+    memory::data_type param_dt;
+    bool with_master;
+    float momentum;
+    float weight_decay;
+    memory::dims dims;
+    bool stochastic_rounding;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+class optimizer_test_t
+    : public ::testing::TestWithParam<optimizer_test_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Optimizer is supported on CPU only.");
+        optimizer_test_params_t p
+                = ::testing::TestWithParam<decltype(p)>::GetParam();
+        SKIP_IF(unsupported_data_type(p.param_dt),
+                "Engine does not support this data type.");
+        catch_expected_failures(
+                [&]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    static constexpr float lr = 0.1f;
+    static constexpr float beta2 = 0.999f;
+    static constexpr float eps = 1e-3f;
+    static constexpr int nsteps = 3;
+
+    // The initial values are exact in every supported data type.
+    static float param_value(memory::dim i) {
+        return static_cast<float>((i * 13) % 17 - 8) / 8.f;
+    }
+    static float grad_value(memory::dim i, int step) {
+        return static_cast<float>((i * 7 + step) % 11 - 5) / 16.f;
+    }
+
+    // Reference update of a single element in f32.
+    static void ref_update(const optimizer_test_params_t &p, int t, float g,
+            float &w, float &m, float &v) {
+        const float b1 = p.momentum, wd = p.weight_decay;
+        if (p.alg == algorithm::optimizer_sgd) {
+            g += wd * w;
+            if (b1 != 0.f) {
+                m = b1 * m + g;
+                g = m;
+            }
+            w -= lr * g;
+            return;
+        }
+        if (p.alg == algorithm::optimizer_adamw)
+            w *= 1.f - lr * wd;
+        else
+            g += wd * w;
+        m = b1 * m + (1.f - b1) * g;
+        v = beta2 * v + (1.f - beta2) * g * g;
+        const float m_hat = m / (1.f - std::pow(b1, (float)t));
+        const float v_hat = v / (1.f - std::pow(beta2, (float)t));
+        w -= lr * m_hat / (std::sqrt(v_hat) + eps);
+    }
+
+    void Test() {
+        auto p = ::testing::TestWithParam<optimizer_test_params_t>::GetParam();
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+        using dt = memory::data_type;
+        using tag = memory::format_tag;
+
+        const auto plain_tag = p.dims.size() == 1 ? tag::a : tag::ab;
+        memory::desc param_md(p.dims, p.param_dt, plain_tag);
+        memory::desc grad_md(p.dims, p.param_dt, tag::any);
+        memory::desc master_md = p.with_master
+                ? memory::desc(p.dims, dt::f32, tag::any)
+                : memory::desc();
+
+        primitive_attr attr;
+        if (p.stochastic_rounding)
+            attr.set_rounding_mode(DNNL_ARG_DST, rounding_mode::stochastic);
+
+        auto pd = optimizer::primitive_desc(eng, p.alg, grad_md, param_md,
+                master_md, p.momentum, beta2, eps, p.weight_decay, attr);
+        // test construction from a C pd
+        pd = optimizer::primitive_desc(pd.get());
+        ASSERT_EQ(pd.get_algorithm(), p.alg);
+        ASSERT_TRUE(pd.param_desc() == param_md);
+        ASSERT_TRUE(pd.master_desc() == memory::desc() || p.with_master);
+
+        const bool is_adam = p.alg != algorithm::optimizer_sgd;
+        const memory::dim nelems = param_md.get_size()
+                / memory::data_type_size(p.param_dt);
+
+        memory param_f32({p.dims, dt::f32, plain_tag}, eng);
+        {
+            auto ptr = map_memory<float>(param_f32);
+            for (memory::dim i = 0; i < nelems; i++)
+                ptr[i] = param_value(i);
+        }
+        auto param = test::make_memory(pd.param_desc(), eng);
+        reorder(param_f32, param).execute(strm, param_f32, param);
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_DST, param}};
+        if (p.with_master) {
+            auto master = test::make_memory(pd.master_desc(), eng);
+            reorder(param_f32, master).execute(strm, param_f32, master);
+            args.insert({DNNL_ARG_MASTER_WEIGHTS, master});
+        }
+        const int moment_args[] = {DNNL_ARG_MOMENT_1, DNNL_ARG_MOMENT_2};
+        for (int i = 0; i < 2; i++) {
+            auto md = pd.moment_desc(i);
+            if (md == memory::desc()) continue;
+            auto moment = test::make_memory(md, eng);
+            {
+                auto ptr = map_memory<float>(moment);
+                for (memory::dim e = 0; e < nelems; e++)
+                    ptr[e] = 0.f;
+            }
+            args.insert({moment_args[i], moment});
+        }
+
+        memory grad_f32({p.dims, dt::f32, plain_tag}, eng);
+        auto grad = test::make_memory(pd.grad_desc(), eng);
+        args.insert({DNNL_ARG_SRC, grad});
+
+        memory lr_mem({{1}, dt::f32, tag::a}, eng);
+        map_memory<float>(lr_mem)[0] = lr;
+        args.insert({DNNL_ARG_LEARNING_RATE, lr_mem});
+        memory step_mem({{1}, dt::s32, tag::a}, eng);
+        if (is_adam) args.insert({DNNL_ARG_STEP, step_mem});
+        memory seed_mem({{1}, dt::s32, tag::a}, eng);
+        map_memory<int32_t>(seed_mem)[0] = 0x1234;
+        if (p.stochastic_rounding)
+            args.insert({DNNL_ARG_ATTR_ROUNDING_SEED, seed_mem});
+
+        std::vector<float> ref_w(nelems), ref_m(nelems, 0.f),
+                ref_v(nelems, 0.f);
+        for (memory::dim i = 0; i < nelems; i++)
+            ref_w[i] = param_value(i);
+
+        optimizer prim(pd);
+        for (int t = 1; t <= nsteps; t++) {
+            {
+                auto ptr = map_memory<float>(grad_f32);
+                for (memory::dim i = 0; i < nelems; i++)
+                    ptr[i] = grad_value(i, t);
+            }
+            reorder(grad_f32, grad).execute(strm, grad_f32, grad);
+            map_memory<int32_t>(step_mem)[0] = t;
+            prim.execute(strm, args);
+            strm.wait();
+
+            for (memory::dim i = 0; i < nelems; i++)
+                ref_update(p, t, grad_value(i, t), ref_w[i], ref_m[i],
+                        ref_v[i]);
+
+            // Without master weights the reference continues from the
+            // rounded parameters.
+            if (!p.with_master && p.param_dt != dt::f32) {
+                memory tmp({p.dims, dt::f32, plain_tag}, eng);
+                reorder(param, tmp).execute(strm, param, tmp);
+                strm.wait();
+                auto ptr = map_memory<const float>(tmp);
+                for (memory::dim i = 0; i < nelems; i++) {
+                    ASSERT_NEAR(ref_w[i], ptr[i],
+                            1e-2f * std::fmax(1.f, std::fabs(ref_w[i])))
+                            << "step " << t << " at " << i;
+                    ref_w[i] = ptr[i];
+                }
+            }
+        }
+
+        memory result({p.dims, dt::f32, plain_tag}, eng);
+        reorder(param, result).execute(strm, param, result);
+        strm.wait();
+        auto res = map_memory<const float>(result);
+
+        // Low precision parameters are within one unit in the last place of
+        // the accurate value for both rounding modes.
+        const float param_tol = p.param_dt == dt::f32 ? 1e-5f
+                : p.param_dt == dt::bf16              ? 1.f / 128
+                                                      : 1.f / 1024;
+        for (memory::dim i = 0; i < nelems; i++) {
+            ASSERT_NEAR(ref_w[i], res[i],
+                    param_tol * std::fmax(1.f, std::fabs(ref_w[i])))
+                    << "at " << i;
+        }
+        if (p.with_master) {
+            auto master = map_memory<const float>(
+                    args.at(DNNL_ARG_MASTER_WEIGHTS));
+            for (memory::dim i = 0; i < nelems; i++)
+                ASSERT_NEAR(ref_w[i], master[i],
+                        1e-5f * std::fmax(1.f, std::fabs(ref_w[i])))
+                        << "at " << i;
+        }
+    }
+};
+
+TEST_P(optimizer_test_t, TestsOptimizer) {}
+
+using dt = memory::data_type;
+static const auto sgd = algorithm::optimizer_sgd;
+static const auto adam = algorithm::optimizer_adam;
+static const auto adamw = algorithm::optimizer_adamw;
+
+INSTANTIATE_TEST_SUITE_P(TestOptimizerF32, optimizer_test_t,
+        ::testing::Values(
+                optimizer_test_params_t {sgd, dt::f32, false, 0.f, 0.f, {37}},
+                optimizer_test_params_t {
+                        sgd, dt::f32, false, 0.9f, 0.01f, {16, 33}},
+                optimizer_test_params_t {
+                        adam, dt::f32, false, 0.9f, 0.f, {1000}},
+                optimizer_test_params_t {
+                        adam, dt::f32, false, 0.9f, 0.01f, {7, 129}},
+                optimizer_test_params_t {
+                        adamw, dt::f32, false, 0.9f, 0.01f, {64, 70}}));
+
+// A flat buffer with many small parameter tensors is updated at once.
+INSTANTIATE_TEST_SUITE_P(TestOptimizerArena, optimizer_test_t,
+        ::testing::Values(optimizer_test_params_t {
+                adamw, dt::f32, false, 0.9f, 0.1f, {100003}}));
+
+INSTANTIATE_TEST_SUITE_P(TestOptimizerLowPrecision, optimizer_test_t,
+        ::testing::Values(
+                optimizer_test_params_t {
+                        adamw, dt::bf16, true, 0.9f, 0.01f, {16, 65}},
+                optimizer_test_params_t {
+                        adamw, dt::bf16, true, 0.9f, 0.01f, {16, 65}, true},
+                optimizer_test_params_t {
+                        sgd, dt::bf16, true, 0.9f, 0.f, {300}, true},
+                optimizer_test_params_t {
+                        adam, dt::f16, true, 0.9f, 0.f, {300}},
+                optimizer_test_params_t {
+                        sgd, dt::bf16, false, 0.f, 0.f, {300}}));
+
+INSTANTIATE_TEST_SUITE_P(TestOptimizerEF, optimizer_test_t,
+        ::testing::Values(
+                // bad momentum
+                optimizer_test_params_t {sgd, dt::f32, false, 1.5f, 0.f, {8},
+                        false, true, dnnl_invalid_arguments},
+                // negative weight decay
+                optimizer_test_params_t {adam, dt::f32, false, 0.9f, -1.f,
+                        {8}, false, true, dnnl_invalid_arguments}));
+
+} // namespace dnnl
@@ -28,6 +28,64 @@ namespace dnnl {
 
 class persistent_cache_api_test_t : public ::testing::Test {};
 
+namespace {
+// Returns false if the implementation can't store itself in a cache blob.
+bool get_cache_blob_if_supported(
+        const primitive &p, std::vector<uint8_t> &cache_blob) {
+    try {
+        cache_blob = p.get_cache_blob();
+    } catch (const dnnl::error &e) {
+        if (e.status == dnnl_unimplemented) return false;
+        throw;
+    }
+    return true;
+}
+
+void fill(const memory &m) {
+    auto *ptr = static_cast<float *>(m.get_data_handle());
+    const size_t nelems = m.get_desc().get_size() / sizeof(float);
+    for (size_t i = 0; i < nelems; i++)
+        ptr[i] = static_cast<float>((i * 7) % 13) - 6.f;
+}
+
+// Executes `p` and the primitive restored from its cache blob with the same
+// inputs and checks that the results are bitwise identical.
+template <typename prim_t, typename pd_t>
+void check_restored_primitive(const pd_t &pd, const prim_t &p,
+        const std::vector<int> &input_args) {
+    std::vector<uint8_t> cache_blob;
+    if (!get_cache_blob_if_supported(p, cache_blob)) return;
+    ASSERT_FALSE(cache_blob.empty());
+
+    prim_t p_from_blob(pd, cache_blob);
+    ASSERT_EQ(p_from_blob.get_cache_blob(), cache_blob);
+
+    engine e = get_test_engine();
+    stream s(e);
+    std::unordered_map<int, memory> args;
+    for (const int arg : input_args) {
+        memory m(pd.query_md(query::exec_arg_md, arg), e);
+        fill(m);
+        args.insert({arg, m});
+    }
+    const auto dst_md = pd.dst_desc();
+    memory dst(dst_md, e), dst_from_blob(dst_md, e);
+
+    args.insert({DNNL_ARG_DST, dst});
+    p.execute(s, args);
+    args[DNNL_ARG_DST] = dst_from_blob;
+    p_from_blob.execute(s, args);
+    s.wait();
+
+    const auto *ref = static_cast<const float *>(dst.get_data_handle());
+    const auto *res
+            = static_cast<const float *>(dst_from_blob.get_data_handle());
+    const size_t nelems = dst_md.get_size() / sizeof(float);
+    for (size_t i = 0; i < nelems; i++)
+        ASSERT_EQ(res[i], ref[i]) << "at index " << i;
+}
+} // namespace
+
 HANDLE_EXCEPTIONS_FOR_TEST(
         persistent_cache_api_test_t, TestPersistentCacheAPI) {
     engine e = get_test_engine();
@@ -45,9 +103,19 @@ HANDLE_EXCEPTIONS_FOR_TEST(
     ASSERT_NO_THROW(cache_blob_id = pd.get_cache_blob_id());
     ASSERT_EQ(cache_blob_id, pd.get_cache_blob_id());
 
-    if (get_test_engine_kind() != engine::kind::gpu
-            || (get_test_engine_kind() == engine::kind::gpu
-                    && DNNL_GPU_RUNTIME != DNNL_RUNTIME_OCL)) {
+    if (get_test_engine_kind() == engine::kind::cpu) {
+        // CPU supports cache blobs only for implementations with
+        // relocatable JIT code.
+        ASSERT_EQ(cache_blob_id.empty(), false);
+        if (!get_cache_blob_if_supported(p, cache_blob)) {
+            ASSERT_EQ(cache_blob.empty(), true);
+            EXPECT_ANY_THROW(convolution_forward(pd, cache_blob));
+        } else {
+            ASSERT_EQ(cache_blob.empty(), false);
+            ASSERT_NO_THROW(p = convolution_forward(pd, cache_blob));
+            ASSERT_EQ(cache_blob, p.get_cache_blob());
+        }
+    } else if (DNNL_GPU_RUNTIME != DNNL_RUNTIME_OCL) {
         ASSERT_EQ(cache_blob_id.empty(), true);
         EXPECT_ANY_THROW(cache_blob = p.get_cache_blob());
         ASSERT_EQ(cache_blob.empty(), true);
@@ -61,6 +129,34 @@ HANDLE_EXCEPTIONS_FOR_TEST(
     }
 }
 
+HANDLE_EXCEPTIONS_FOR_TEST(
+        persistent_cache_api_test_t, TestPersistentCacheAPIMatmulCPU) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "CPU-specific test.");
+    engine e = get_test_engine();
+    auto pd = matmul::primitive_desc {e,
+            {{2, 37, 64}, memory::data_type::f32, memory::format_tag::abc},
+            {{2, 64, 45}, memory::data_type::f32, memory::format_tag::abc},
+            {{2, 37, 45}, memory::data_type::f32, memory::format_tag::abc}};
+    auto p = matmul(pd);
+    check_restored_primitive(pd, p, {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS});
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST(
+        persistent_cache_api_test_t, TestPersistentCacheAPIConvolutionCPU) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "CPU-specific test.");
+    engine e = get_test_engine();
+    auto pd = convolution_forward::primitive_desc {e,
+            prop_kind::forward_inference, algorithm::convolution_direct,
+            {{2, 32, 12, 12}, memory::data_type::f32, memory::format_tag::nhwc},
+            {{48, 32, 3, 3}, memory::data_type::f32, memory::format_tag::any},
+            {{2, 48, 10, 10}, memory::data_type::f32, memory::format_tag::nhwc},
+            {1, 1}, {0, 0}, {0, 0}};
+    auto p = convolution_forward(pd);
+    check_restored_primitive(pd, p, {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS});
+}
+
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
 HANDLE_EXCEPTIONS_FOR_TEST(
         persistent_cache_api_test_t, TestPersistentCacheAPIEngine) {
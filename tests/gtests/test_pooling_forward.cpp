@@ -103,6 +103,8 @@ void check_pool_fwd(const pool_test_params_t &p, const memory &src,
         if (w == nullptr) return -1;
         if (ws.get_desc().get_data_type() == dnnl_u8)
             return (int)w[idx];
+        else if (ws.get_desc().get_data_type() == dnnl_u4)
+            return (w[idx / 2] >> (4 * (idx % 2))) & 0xf;
         else
             return ((const int *)w)[idx];
     };
@@ -2198,4 +2200,84 @@ CPU_INSTANTIATE_TEST_SUITE_P(TestPoolingAsymmDilation, pooling_test_float,
 
 GPU_INST_TEST_CASE(pooling_test_float);
 
+struct pool_adaptive_test_params_t {
+    algorithm aalgorithm;
+    memory::format_tag tag;
+    memory::dim mb, c, ih, iw, oh, ow;
+};
+
+class pooling_adaptive_test_t
+    : public ::testing::TestWithParam<pool_adaptive_test_params_t> {
+protected:
+    void SetUp() override {
+        p = GetParam();
+        Test();
+    }
+
+    void Test() {
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        auto src_md = memory::desc(
+                {p.mb, p.c, p.ih, p.iw}, memory::data_type::f32, p.tag);
+        auto dst_md = memory::desc(
+                {p.mb, p.c, p.oh, p.ow}, memory::data_type::f32, p.tag);
+        auto pd = pooling_forward::primitive_desc(eng,
+                prop_kind::forward_inference, p.aalgorithm, src_md, dst_md);
+        ASSERT_EQ(pd.get_algorithm(), p.aalgorithm);
+
+        auto src = test::make_memory(pd.src_desc(), eng);
+        auto dst = test::make_memory(pd.dst_desc(), eng);
+        fill_data<float>(src.get_desc().get_size() / sizeof(float), src);
+
+        pooling_forward(pd).execute(
+                strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+        strm.wait();
+
+        auto src_data = map_memory<float>(src);
+        auto dst_data = map_memory<float>(dst);
+        const dnnl::impl::memory_desc_wrapper src_mdw(src_md.get());
+        const dnnl::impl::memory_desc_wrapper dst_mdw(dst_md.get());
+        const bool is_max = p.aalgorithm == algorithm::pooling_adaptive_max;
+
+        for_(memory::dim n = 0; n < p.mb; n++)
+        for_(memory::dim c = 0; c < p.c; c++)
+        for_(memory::dim oh = 0; oh < p.oh; oh++)
+        for (memory::dim ow = 0; ow < p.ow; ow++) {
+            const memory::dim ih_s = oh * p.ih / p.oh;
+            const memory::dim ih_e = ((oh + 1) * p.ih + p.oh - 1) / p.oh;
+            const memory::dim iw_s = ow * p.iw / p.ow;
+            const memory::dim iw_e = ((ow + 1) * p.iw + p.ow - 1) / p.ow;
+            float ref = is_max ? std::numeric_limits<float>::lowest() : 0.f;
+            for_(memory::dim ih = ih_s; ih < ih_e; ih++)
+            for (memory::dim iw = iw_s; iw < iw_e; iw++) {
+                const float s = src_data[src_mdw.off(n, c, ih, iw)];
+                ref = is_max ? std::max(ref, s) : ref + s;
+            }
+            if (!is_max) ref /= (ih_e - ih_s) * (iw_e - iw_s);
+            ASSERT_NEAR(dst_data[dst_mdw.off(n, c, oh, ow)], ref, 1e-6f);
+        }
+    }
+
+    pool_adaptive_test_params_t p;
+};
+
+TEST_P(pooling_adaptive_test_t, TestsPooling) {}
+
+CPU_INSTANTIATE_TEST_SUITE_P(TestPoolingForwardAdaptive,
+        pooling_adaptive_test_t,
+        ::testing::Values(
+                pool_adaptive_test_params_t {algorithm::pooling_adaptive_avg,
+                        memory::format_tag::nhwc, 2, 35, 10, 13, 3, 5},
+                pool_adaptive_test_params_t {algorithm::pooling_adaptive_max,
+                        memory::format_tag::nhwc, 2, 35, 10, 13, 3, 5},
+                pool_adaptive_test_params_t {algorithm::pooling_adaptive_avg,
+                        memory::format_tag::nChw16c, 2, 20, 7, 7, 1, 1},
+                pool_adaptive_test_params_t {algorithm::pooling_adaptive_max,
+                        memory::format_tag::nChw8c, 1, 19, 5, 9, 7, 4},
+                pool_adaptive_test_params_t {algorithm::pooling_adaptive_avg,
+                        memory::format_tag::nchw, 1, 3, 9, 11, 4, 3},
+                pool_adaptive_test_params_t {algorithm::pooling_adaptive_avg,
+                        memory::format_tag::nChw16c, 3, 64, 24, 24, 7, 7}));
+
 } // namespace dnnl
@@ -0,0 +1,123 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+class reorder_dyn_quant_test_t : public ::testing::Test {
+protected:
+    engine eng_ {engine::kind::cpu, 0};
+    stream strm_ {eng_};
+
+    // Quantizes a K x N f32 tensor with one scale per group of `G` rows of
+    // every column and checks that the dequantized values match the source
+    // within half of a quantization step.
+    void Test(memory::dim K, memory::dim N, memory::dim G, dt dst_dt,
+            bool with_zp) {
+        memory::desc src_md({K, N}, dt::f32, tag::ab);
+        memory::desc dst_md({K, N}, dst_dt, tag::ab);
+
+        primitive_attr attr;
+        attr.set_dst_dynamic_quantization(true);
+        attr.set_scales(DNNL_ARG_DST, 3, {G, 1}, dt::f32);
+        if (with_zp) attr.set_zero_points(DNNL_ARG_DST, 3, {G, 1}, dt::s32);
+
+        auto pd = reorder::primitive_desc(eng_, src_md, eng_, dst_md, attr);
+        ASSERT_TRUE(pd.get_primitive_attr().get_dst_dynamic_quantization());
+
+        const memory::dim n_groups = K / G * N;
+        memory src(src_md, eng_), dst(dst_md, eng_);
+        memory sc({{K / G, N}, dt::f32, tag::ab}, eng_);
+        memory zp({{K / G, N}, dt::s32, tag::ab}, eng_);
+        fill_data<float>(K * N, src, 1.f, 2.f);
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_FROM, src},
+                {DNNL_ARG_TO, dst}, {DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST, sc}};
+        if (with_zp)
+            args.insert({DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_DST, zp});
+        reorder(pd).execute(strm_, args);
+        strm_.wait();
+
+        auto s = map_memory<float>(src);
+        auto d = map_memory<uint8_t>(dst);
+        auto scales = map_memory<float>(sc);
+        auto zps = map_memory<int32_t>(zp);
+        for (memory::dim k = 0; k < K; k++)
+            for (memory::dim n = 0; n < N; n++) {
+                const memory::dim off = k * N + n;
+                int q = 0;
+                switch (dst_dt) {
+                    case dt::s8: q = static_cast<int8_t>(d[off]); break;
+                    case dt::u8: q = d[off]; break;
+                    case dt::u4:
+                        q = (d[off / 2] >> (4 * (off % 2))) & 0xF;
+                        break;
+                    case dt::s4:
+                        q = (d[off / 2] >> (4 * (off % 2))) & 0xF;
+                        if (q > 7) q -= 16;
+                        break;
+                    default: FAIL() << "unexpected data type";
+                }
+                const memory::dim g = k / G * N + n;
+                ASSERT_LT(g, n_groups);
+                const float z = with_zp ? static_cast<float>(zps[g]) : 0.f;
+                const float ref = s[off];
+                const float got = (q - z) * scales[g];
+                ASSERT_NEAR(got, ref, 0.51f * scales[g])
+                        << "k=" << k << " n=" << n;
+            }
+    }
+};
+
+TEST_F(reorder_dyn_quant_test_t, TestInt8) {
+    Test(64, 16, 32, dt::s8, false);
+    Test(64, 16, 16, dt::u8, true);
+}
+
+TEST_F(reorder_dyn_quant_test_t, TestInt4) {
+    Test(64, 16, 32, dt::s4, false);
+    Test(128, 8, 32, dt::u4, true);
+}
+
+TEST_F(reorder_dyn_quant_test_t, TestUnsupported) {
+    memory::desc src_md({64, 16}, dt::f32, tag::ab);
+    memory::desc dst_md({64, 16}, dt::u8, tag::ab);
+
+    // Unsigned destinations require zero points.
+    primitive_attr attr;
+    attr.set_dst_dynamic_quantization(true);
+    attr.set_scales(DNNL_ARG_DST, 3, {32, 1}, dt::f32);
+    EXPECT_ANY_THROW(
+            reorder::primitive_desc(eng_, src_md, eng_, dst_md, attr));
+
+    // Zero points must follow the scales groups.
+    attr.set_zero_points(DNNL_ARG_DST, 3, {16, 1}, dt::s32);
+    EXPECT_ANY_THROW(
+            reorder::primitive_desc(eng_, src_md, eng_, dst_md, attr));
+}
+
+} // namespace dnnl
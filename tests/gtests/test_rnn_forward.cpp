@@ -912,4 +912,130 @@ CPU_INSTANTIATE_TEST_SUITE_P(TestAUGRUlbr, lbr_augru_forward_test_f32,
                                 fmt::undef},
                         test_rnn_sizes_t {1, 1, 5, 1, 4, 4, 4, 4}}));
 
+// With variable-length sequences every row of the batch must match the
+// execution of its own sequence alone, and dst_layer rows past the end of a
+// sequence must be zero.
+TEST(rnn_seq_lengths_test_t, TestsLSTMSeqLengths) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "This test requires CPU engine");
+    using tag = memory::format_tag;
+    using vec = std::vector<float>;
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+
+    const memory::dim L = 2, T = 6, MB = 4, C = 8, G = 4;
+    std::vector<int32_t> lengths = {6, 4, 4, 1};
+
+    const auto fill = [](vec &v, size_t seed) {
+        for (size_t i = 0; i < v.size(); i++)
+            v[i] = ((i * 7 + seed) % 13) / 13.f - 0.5f;
+    };
+    vec wei_layer(L * C * G * C), wei_iter(L * C * G * C), bias(L * G * C);
+    vec src_layer(T * MB * C), src_iter(L * MB * C), src_iter_c(L * MB * C);
+    fill(wei_layer, 1);
+    fill(wei_iter, 2);
+    fill(bias, 3);
+    fill(src_layer, 4);
+    fill(src_iter, 5);
+    fill(src_iter_c, 6);
+
+    const auto f32_md = [](const memory::dims &dims, tag t) {
+        return memory::desc(dims, memory::data_type::f32, t);
+    };
+    const auto create_pd = [&](memory::dim t, memory::dim mb,
+                                   dnnl_rnn_direction_t dir, unsigned flags,
+                                   dnnl_primitive_desc_t *c_pd) {
+        const auto layer_md = f32_md({t, mb, C}, tag::tnc);
+        const auto iter_md = f32_md({L, 1, mb, C}, tag::ldnc);
+        const auto wei_md = f32_md({L, 1, C, G, C}, tag::ldigo);
+        const auto bias_md = f32_md({L, 1, G, C}, tag::ldgo);
+        return dnnl_lstm_forward_primitive_desc_create(c_pd, eng.get(),
+                dnnl_forward_inference, dir, layer_md.get(), iter_md.get(),
+                iter_md.get(), wei_md.get(), wei_md.get(), nullptr, nullptr,
+                bias_md.get(), layer_md.get(), iter_md.get(), iter_md.get(),
+                flags, nullptr);
+    };
+    const auto run = [&](memory::dim t, memory::dim mb, vec &s_layer,
+                             vec &s_iter, vec &s_iter_c, int32_t *seq_lengths,
+                             vec &d_layer, vec &d_iter, vec &d_iter_c) {
+        dnnl_primitive_desc_t c_pd = nullptr;
+        ASSERT_EQ(create_pd(t, mb, dnnl_unidirectional_left2right,
+                          seq_lengths ? dnnl_rnn_flags_seq_lengths
+                                      : dnnl_rnn_flags_undef,
+                          &c_pd),
+                dnnl_success);
+        lstm_forward::primitive_desc pd(c_pd);
+        d_layer.resize(t * mb * C);
+        d_iter.resize(L * mb * C);
+        d_iter_c.resize(L * mb * C);
+        std::unordered_map<int, memory> args = {
+                {DNNL_ARG_SRC_LAYER,
+                        memory(pd.src_layer_desc(), eng, s_layer.data())},
+                {DNNL_ARG_SRC_ITER,
+                        memory(pd.src_iter_desc(), eng, s_iter.data())},
+                {DNNL_ARG_SRC_ITER_C,
+                        memory(pd.src_iter_c_desc(), eng, s_iter_c.data())},
+                {DNNL_ARG_WEIGHTS_LAYER,
+                        memory(pd.weights_layer_desc(), eng, wei_layer.data())},
+                {DNNL_ARG_WEIGHTS_ITER,
+                        memory(pd.weights_iter_desc(), eng, wei_iter.data())},
+                {DNNL_ARG_BIAS, memory(pd.bias_desc(), eng, bias.data())},
+                {DNNL_ARG_DST_LAYER,
+                        memory(pd.dst_layer_desc(), eng, d_layer.data())},
+                {DNNL_ARG_DST_ITER,
+                        memory(pd.dst_iter_desc(), eng, d_iter.data())},
+                {DNNL_ARG_DST_ITER_C,
+                        memory(pd.dst_iter_c_desc(), eng, d_iter_c.data())}};
+        if (seq_lengths)
+            args[DNNL_ARG_SEQ_LENGTHS] = memory(
+                    pd.query_md(query::exec_arg_md, DNNL_ARG_SEQ_LENGTHS), eng,
+                    seq_lengths);
+        lstm_forward(pd).execute(strm, args);
+        strm.wait();
+    };
+
+    vec dst_layer, dst_iter, dst_iter_c;
+    run(T, MB, src_layer, src_iter, src_iter_c, lengths.data(), dst_layer,
+            dst_iter, dst_iter_c);
+
+    for (memory::dim b = 0; b < MB; b++) {
+        const memory::dim len = lengths[b];
+        vec s_layer(len * C), s_iter(L * C), s_iter_c(L * C);
+        for_(memory::dim t = 0; t < len; t++)
+        for (memory::dim c = 0; c < C; c++)
+            s_layer[t * C + c] = src_layer[(t * MB + b) * C + c];
+        for_(memory::dim l = 0; l < L; l++)
+        for (memory::dim c = 0; c < C; c++) {
+            s_iter[l * C + c] = src_iter[(l * MB + b) * C + c];
+            s_iter_c[l * C + c] = src_iter_c[(l * MB + b) * C + c];
+        }
+
+        vec d_layer, d_iter, d_iter_c;
+        run(len, 1, s_layer, s_iter, s_iter_c, nullptr, d_layer, d_iter,
+                d_iter_c);
+
+        for_(memory::dim t = 0; t < T; t++)
+        for (memory::dim c = 0; c < C; c++) {
+            const float ref = t < len ? d_layer[t * C + c] : 0.f;
+            ASSERT_NEAR(dst_layer[(t * MB + b) * C + c], ref, 1e-5f)
+                    << "dst_layer at t=" << t << " b=" << b;
+        }
+        for_(memory::dim l = 0; l < L; l++)
+        for (memory::dim c = 0; c < C; c++) {
+            ASSERT_NEAR(dst_iter[(l * MB + b) * C + c], d_iter[l * C + c],
+                    1e-5f)
+                    << "dst_iter at l=" << l << " b=" << b;
+            ASSERT_NEAR(dst_iter_c[(l * MB + b) * C + c], d_iter_c[l * C + c],
+                    1e-5f)
+                    << "dst_iter_c at l=" << l << " b=" << b;
+        }
+    }
+
+    // Only unidirectional left-to-right execution is supported.
+    dnnl_primitive_desc_t c_pd = nullptr;
+    EXPECT_EQ(create_pd(T, MB, dnnl_unidirectional_right2left,
+                      dnnl_rnn_flags_seq_lengths, &c_pd),
+            dnnl_invalid_arguments);
+}
+
 } // namespace dnnl
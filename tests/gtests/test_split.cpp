@@ -0,0 +1,172 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct split_test_params_t {
+    int split_dimension;
+    memory::format_tag src_format;
+    std::vector<memory::format_tag> dsts_format;
+    memory::dims src_dims;
+    std::vector<memory::dim> split_sizes;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+class split_test_t : public ::testing::TestWithParam<split_test_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Split is supported on CPU only.");
+        split_test_params_t p
+                = ::testing::TestWithParam<decltype(p)>::GetParam();
+        catch_expected_failures(
+                [&]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    // Checks that every point of `dst` equals the point of `src` shifted by
+    // `offset` along the split dimension.
+    void check_data(const memory &src, const memory &dst, int split_dim,
+            memory::dim offset) {
+        auto src_data = map_memory<const float>(src);
+        auto dst_data = map_memory<const float>(dst);
+        const impl::memory_desc_wrapper src_mdw(src.get_desc().get());
+        const impl::memory_desc_wrapper dst_mdw(dst.get_desc().get());
+
+        const int ndims = dst_mdw.ndims();
+        const memory::dim nelems = dst_mdw.nelems();
+        impl::dims_t pos;
+        for (memory::dim e = 0; e < nelems; e++) {
+            impl::utils::l_dims_by_l_offset(pos, e, dst_mdw.dims(), ndims);
+            const auto dst_off = dst_mdw.off_v(pos);
+            pos[split_dim] += offset;
+            const auto src_off = src_mdw.off_v(pos);
+            ASSERT_EQ(src_data[src_off], dst_data[dst_off]);
+        }
+    }
+
+    void Test() {
+        auto p = ::testing::TestWithParam<split_test_params_t>::GetParam();
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+        const auto dt = memory::data_type::f32;
+
+        memory::desc src_md(p.src_dims, dt, p.src_format);
+        std::vector<memory::desc> dsts_md;
+        for (size_t i = 0; i < p.split_sizes.size(); i++) {
+            memory::dims dims = p.src_dims;
+            if (p.split_dimension < (int)dims.size())
+                dims[p.split_dimension] = p.split_sizes[i];
+            dsts_md.emplace_back(dims, dt, p.dsts_format[i]);
+        }
+
+        auto split_pd = split::primitive_desc(
+                eng, src_md, p.split_dimension, dsts_md);
+        // test construction from a C pd
+        split_pd = split::primitive_desc(split_pd.get());
+        ASSERT_TRUE(split_pd.src_desc() == src_md);
+
+        auto src = test::make_memory(split_pd.src_desc(), eng);
+        fill_data<float>(src.get_desc().get_size() / sizeof(float), src);
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, src}};
+        std::vector<memory> dsts;
+        for (size_t i = 0; i < p.split_sizes.size(); i++) {
+            auto md = split_pd.dst_desc((int)i);
+            // Destinations with `any` format are views of the source.
+            const bool is_view = p.dsts_format[i] == memory::format_tag::any;
+            auto dst = is_view
+                    ? test::make_memory(md, eng, src.get_data_handle())
+                    : test::make_memory(md, eng);
+            if (!is_view) {
+                ASSERT_TRUE(md == dsts_md[i]);
+                fill_data<float>(md.get_size() / sizeof(float), dst);
+            }
+            args.insert({DNNL_ARG_MULTIPLE_DST + (int)i, dst});
+            dsts.push_back(dst);
+        }
+
+        split(split_pd).execute(strm, args);
+        strm.wait();
+
+        memory::dim offset = 0;
+        for (size_t i = 0; i < dsts.size(); i++) {
+            check_data(src, dsts[i], p.split_dimension, offset);
+            offset += p.split_sizes[i];
+        }
+    }
+};
+
+TEST_P(split_test_t, TestsSplit) {}
+
+using tag = memory::format_tag;
+
+// Splitting of a fused QKV projection into query, key and value.
+INSTANTIATE_TEST_SUITE_P(TestSplitQKV, split_test_t,
+        ::testing::Values(
+                split_test_params_t {2, tag::abc,
+                        {tag::abc, tag::abc, tag::abc},
+                        {2, 17, 96}, {32, 32, 32}},
+                split_test_params_t {2, tag::abc,
+                        {tag::any, tag::any, tag::any},
+                        {2, 17, 96}, {32, 32, 32}},
+                split_test_params_t {2, tag::abc,
+                        {tag::any, tag::abc, tag::any},
+                        {2, 17, 96}, {64, 16, 16}}));
+
+INSTANTIATE_TEST_SUITE_P(TestSplitOutermost, split_test_t,
+        ::testing::Values(
+                split_test_params_t {0, tag::abcd, {tag::abcd, tag::abcd},
+                        {6, 5, 4, 3}, {2, 4}},
+                split_test_params_t {1, tag::abcd, {tag::abcd, tag::abcd},
+                        {1, 50, 4, 3}, {13, 37}}));
+
+INSTANTIATE_TEST_SUITE_P(TestSplitBlocked, split_test_t,
+        ::testing::Values(
+                split_test_params_t {1, tag::aBcd8b, {tag::aBcd8b, tag::aBcd8b},
+                        {2, 32, 5, 5}, {8, 24}},
+                split_test_params_t {1, tag::aBcd8b, {tag::any, tag::aBcd8b},
+                        {2, 32, 5, 5}, {16, 16}}));
+
+// Destinations with a layout different from the source.
+INSTANTIATE_TEST_SUITE_P(TestSplitReorder, split_test_t,
+        ::testing::Values(
+                split_test_params_t {1, tag::abcd, {tag::acdb, tag::abcd},
+                        {2, 12, 3, 5}, {5, 7}},
+                split_test_params_t {3, tag::acdb, {tag::abcd, tag::abcd},
+                        {2, 12, 3, 5}, {1, 4}}));
+
+INSTANTIATE_TEST_SUITE_P(TestSplitEF, split_test_t,
+        ::testing::Values(
+                // sizes do not sum up to the source dimension
+                split_test_params_t {1, tag::abcd, {tag::abcd, tag::abcd},
+                        {2, 12, 3, 5}, {5, 6}, true, dnnl_invalid_arguments},
+                // bad split dimension
+                split_test_params_t {4, tag::abcd, {tag::abcd, tag::abcd},
+                        {2, 12, 3, 5}, {5, 7}, true, dnnl_invalid_arguments},
+                // the source format must be known
+                split_test_params_t {1, tag::any, {tag::abcd, tag::abcd},
+                        {2, 12, 3, 5}, {5, 7}, true, dnnl_invalid_arguments},
+                // a split in the middle of a block has no view of the source
+                split_test_params_t {1, tag::aBcd8b, {tag::abcd, tag::abcd},
+                        {2, 16, 3, 5}, {4, 12}, true, dnnl_unimplemented}));
+
+} // namespace dnnl
@@ -64,6 +64,96 @@ TEST_F(iface_sum_test_t, SumTestDstDataTypeCompliance) {
     }
 }
 
+TEST_F(iface_sum_test_t, SumTestManyInputs) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Many-input sum is tested on CPU only.");
+
+    using dt = memory::data_type;
+
+    // Gradient buckets sum dozens of tensors in a single primitive.
+    const int n = 40;
+    const memory::dims shape = {3, 5, 7, 11};
+    const memory::dim nelems = 3 * 5 * 7 * 11;
+    memory::desc md(shape, dt::f32, tag::abcd);
+
+    std::vector<memory::desc> src_mds(n, md);
+    std::vector<float> scales(n);
+    std::unordered_map<int, memory> args;
+    for (int i = 0; i < n; i++) {
+        scales[i] = i % 2 ? 0.5f : 1.f;
+        memory src(md, eng);
+        auto ptr = map_memory<float>(src);
+        for (memory::dim e = 0; e < nelems; e++)
+            ptr[e] = static_cast<float>((e + i) % 7 - 3) / 8.f;
+        args.insert({DNNL_ARG_MULTIPLE_SRC + i, src});
+    }
+    memory dst(md, eng);
+    args.insert({DNNL_ARG_DST, dst});
+
+    auto sum_pd = sum::primitive_desc(eng, md, scales, src_mds);
+    sum(sum_pd).execute(strm, args);
+    strm.wait();
+
+    // All the values are exact in f32.
+    auto dst_data = map_memory<const float>(dst);
+    for (memory::dim e = 0; e < nelems; e++) {
+        float ref = 0.f;
+        for (int i = 0; i < n; i++)
+            ref += scales[i] * static_cast<float>((e + i) % 7 - 3) / 8.f;
+        ASSERT_EQ(ref, dst_data[e]) << "at " << e;
+    }
+}
+
+TEST_F(iface_sum_test_t, SumTestStochasticRounding) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Stochastic rounding in sum is supported on CPU only.");
+
+    using dt = memory::data_type;
+    SKIP_IF(unsupported_data_type(dt::bf16),
+            "Engine does not support this data type.");
+
+    const int n = 24;
+    const memory::dims shape = {4, 1000};
+    const memory::dim nelems = 4 * 1000;
+    memory::desc src_md(shape, dt::f32, tag::ab);
+    memory::desc dst_md(shape, dt::bf16, tag::ab);
+
+    primitive_attr attr;
+    attr.set_rounding_mode(DNNL_ARG_DST, rounding_mode::stochastic);
+
+    std::vector<memory::desc> src_mds(n, src_md);
+    std::vector<float> scales(n, 1.f);
+    std::unordered_map<int, memory> args;
+    for (int i = 0; i < n; i++) {
+        memory src(src_md, eng);
+        auto ptr = map_memory<float>(src);
+        for (memory::dim e = 0; e < nelems; e++)
+            ptr[e] = 1.f + static_cast<float>((e * 31 + i) % 97) * 1e-3f;
+        args.insert({DNNL_ARG_MULTIPLE_SRC + i, src});
+    }
+    memory dst(dst_md, eng);
+    args.insert({DNNL_ARG_DST, dst});
+    memory seed({{1}, dt::s32, tag::a}, eng);
+    map_memory<int32_t>(seed)[0] = 0xcafe;
+    args.insert({DNNL_ARG_ATTR_ROUNDING_SEED, seed});
+
+    auto sum_pd = sum::primitive_desc(eng, dst_md, scales, src_mds, attr);
+    sum(sum_pd).execute(strm, args);
+
+    memory dst_f32(src_md, eng);
+    reorder(dst, dst_f32).execute(strm, dst, dst_f32);
+    strm.wait();
+
+    // The result is one of the two bf16 neighbors of the accurate sum.
+    auto dst_data = map_memory<const float>(dst_f32);
+    for (memory::dim e = 0; e < nelems; e++) {
+        float ref = 0.f;
+        for (int i = 0; i < n; i++)
+            ref += 1.f + static_cast<float>((e * 31 + i) % 97) * 1e-3f;
+        ASSERT_NEAR(ref, dst_data[e], ref / 128.f) << "at " << e;
+    }
+}
+
 /* correctness tests */
 
 struct sum_test_params {
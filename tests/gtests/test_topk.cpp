@@ -0,0 +1,180 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <numeric>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct topk_test_params_t {
+    memory::data_type dt;
+    memory::format_tag src_format;
+    memory::dims src_dims;
+    int axis;
+    memory::dim k;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+class topk_test_t : public ::testing::TestWithParam<topk_test_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Top-k is supported on CPU only.");
+        topk_test_params_t p
+                = ::testing::TestWithParam<decltype(p)>::GetParam();
+        SKIP_IF(unsupported_data_type(p.dt),
+                "Engine does not support this data type.");
+        catch_expected_failures(
+                [&]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    // Values repeat, so ties are resolved by the positions. The values are
+    // small integers and are exact in every supported data type.
+    static float src_value(memory::dim i) {
+        return static_cast<float>((i * 37 + 11) % 101) - 50.f;
+    }
+
+    void Test() {
+        auto p = ::testing::TestWithParam<topk_test_params_t>::GetParam();
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+        using dt = memory::data_type;
+        using tag = memory::format_tag;
+
+        const int ndims = static_cast<int>(p.src_dims.size());
+        memory::dims dst_dims = p.src_dims;
+        if (p.axis >= 0 && p.axis < ndims) dst_dims[p.axis] = p.k;
+
+        memory::desc src_md(p.src_dims, p.dt, p.src_format);
+        memory::desc dst_md(dst_dims, p.dt, tag::any);
+        memory::desc idx_md(dst_dims, dt::s32, tag::any);
+
+        auto pd = topk::primitive_desc(eng, src_md, dst_md, idx_md, p.axis);
+        // test construction from a C pd
+        pd = topk::primitive_desc(pd.get());
+        ASSERT_TRUE(pd.src_desc() == src_md);
+        ASSERT_EQ(pd.get_axis(), p.axis);
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_DST_INDICES)
+                == pd.indices_desc());
+
+        // The source is filled in f32 and converted by a reorder.
+        const memory::dim nelems
+                = src_md.get_size() / memory::data_type_size(p.dt);
+        memory src_f32({p.src_dims, dt::f32, p.src_format}, eng);
+        {
+            auto ptr = map_memory<float>(src_f32);
+            for (memory::dim i = 0; i < nelems; i++)
+                ptr[i] = src_value(i);
+        }
+        auto src = test::make_memory(pd.src_desc(), eng);
+        reorder(src_f32, src).execute(strm, src_f32, src);
+
+        auto dst = test::make_memory(pd.dst_desc(), eng);
+        auto idx = test::make_memory(pd.indices_desc(), eng);
+        topk(pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst},
+                        {DNNL_ARG_DST_INDICES, idx}});
+
+        // Outputs with the `any` format follow the source memory format.
+        memory dst_f32({dst_dims, dt::f32, p.src_format}, eng);
+        reorder(dst, dst_f32).execute(strm, dst, dst_f32);
+        strm.wait();
+
+        check_results(src_f32, dst_f32, idx, p);
+    }
+
+    void check_results(const memory &src, const memory &dst,
+            const memory &idx, const topk_test_params_t &p) {
+        auto src_data = map_memory<const float>(src);
+        auto dst_data = map_memory<const float>(dst);
+        auto idx_data = map_memory<const int>(idx);
+        const impl::memory_desc_wrapper src_mdw(src.get_desc().get());
+        const impl::memory_desc_wrapper dst_mdw(dst.get_desc().get());
+        const impl::memory_desc_wrapper idx_mdw(idx.get_desc().get());
+
+        const int ndims = src_mdw.ndims();
+        const memory::dim n = src_mdw.dims()[p.axis];
+        impl::dims_t row_dims;
+        impl::utils::array_copy(row_dims, src_mdw.dims(), ndims);
+        row_dims[p.axis] = 1;
+        const memory::dim rows = src_mdw.nelems() / n;
+
+        std::vector<std::pair<float, int>> ref(n);
+        impl::dims_t pos;
+        for (memory::dim r = 0; r < rows; r++) {
+            impl::utils::l_dims_by_l_offset(pos, r, row_dims, ndims);
+            for (memory::dim i = 0; i < n; i++) {
+                pos[p.axis] = i;
+                ref[i] = {src_data[src_mdw.off_v(pos)], (int)i};
+            }
+            std::stable_sort(ref.begin(), ref.end(),
+                    [](const std::pair<float, int> &a,
+                            const std::pair<float, int> &b) {
+                        return a.first > b.first;
+                    });
+            for (memory::dim i = 0; i < p.k; i++) {
+                pos[p.axis] = i;
+                ASSERT_EQ(ref[i].first, dst_data[dst_mdw.off_v(pos)]);
+                ASSERT_EQ(ref[i].second, idx_data[idx_mdw.off_v(pos)]);
+            }
+        }
+    }
+};
+
+TEST_P(topk_test_t, TestsTopk) {}
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+INSTANTIATE_TEST_SUITE_P(TestTopkF32, topk_test_t,
+        ::testing::Values(topk_test_params_t {dt::f32, tag::ab, {8, 100}, 1, 5},
+                topk_test_params_t {dt::f32, tag::ab, {8, 100}, 1, 1},
+                topk_test_params_t {dt::f32, tag::ab, {8, 100}, 1, 100},
+                topk_test_params_t {dt::f32, tag::abc, {3, 50, 7}, 1, 4},
+                topk_test_params_t {dt::f32, tag::acb, {3, 50, 7}, 1, 10},
+                topk_test_params_t {dt::f32, tag::abc, {3, 5, 7}, 0, 2}));
+
+// A few long rows are split between threads.
+INSTANTIATE_TEST_SUITE_P(TestTopkLongRows, topk_test_t,
+        ::testing::Values(
+                topk_test_params_t {dt::f32, tag::ab, {1, 128000}, 1, 40},
+                topk_test_params_t {dt::f32, tag::ab, {2, 50000}, 1, 1}));
+
+INSTANTIATE_TEST_SUITE_P(TestTopkLowPrecision, topk_test_t,
+        ::testing::Values(
+                topk_test_params_t {dt::bf16, tag::ab, {4, 1000}, 1, 8},
+                topk_test_params_t {dt::f16, tag::ab, {4, 1000}, 1, 8},
+                topk_test_params_t {dt::s8, tag::ab, {4, 1000}, 1, 8}));
+
+INSTANTIATE_TEST_SUITE_P(TestTopkEF, topk_test_t,
+        ::testing::Values(
+                // k is larger than the axis
+                topk_test_params_t {dt::f32, tag::ab, {8, 10}, 1, 11, true,
+                        dnnl_invalid_arguments},
+                // bad axis
+                topk_test_params_t {dt::f32, tag::ab, {8, 10}, 2, 1, true,
+                        dnnl_invalid_arguments},
+                // the source format must be known
+                topk_test_params_t {dt::f32, tag::any, {8, 10}, 1, 1, true,
+                        dnnl_invalid_arguments}));
+
+} // namespace dnnl